@@ -0,0 +1,35 @@
+#!/bin/bash
+
+# Measure the throughput of luxasx86 in lines per second. The compiler's
+# own sources (and a few of the bigger execute tests) are compiled to
+# x64 assembly once; each file is then assembled several times.
+#
+# LUX_BENCH_REPS: # of times each file is assembled (default 5)
+# LUX_BENCH_AS: assembler to measure (default src/luxx86/luxasx86)
+
+CC1=src/luxcc
+AS=${LUX_BENCH_AS:-src/luxx86/luxasx86}
+BENCH_PATH=$(mktemp -d)
+REPS=${LUX_BENCH_REPS:-5}
+
+trap 'rm -rf $BENCH_PATH' EXIT
+
+for file in src/*.c src/x64_cgen/x64_cgen.c src/tests/execute/bzip2.c \
+            src/tests/execute/tiny_basic.c src/tests/execute/AES/aes.c ; do
+	$CC1 -q -mx64 -Isrc/lib/include $file -o $BENCH_PATH/$(basename ${file%.*}).s 2>/dev/null ||
+	rm -f $BENCH_PATH/$(basename ${file%.*}).s
+done
+
+lines=$(cat $BENCH_PATH/*.s | wc -l)
+echo "== assembler benchmark begins... =="
+echo "$(ls $BENCH_PATH/*.s | wc -l) files, $lines lines, $REPS repetitions"
+start=$(date +%s%N)
+for i in $(seq $REPS) ; do
+	for file in $BENCH_PATH/*.s ; do
+		$AS -m64 $file -o $BENCH_PATH/out.o || echo "failed: $file"
+	done
+done
+end=$(date +%s%N)
+usecs=$(( (end-start)/1000 ))
+echo "$AS: $(( usecs/1000 )) ms, $(( lines*REPS*1000/(usecs/1000) )) lines/s"
+echo "== assembler benchmark done =="
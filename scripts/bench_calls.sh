@@ -0,0 +1,75 @@
+#!/bin/bash
+
+# Time call-heavy x64 code: the recursive execute tests with bigger
+# inputs, qsort() with a comparator and sprintf() from our libc (linked
+# statically). Each program is compiled with -O2.
+#
+# LUX_BENCH_CFLAGS: extra flags for the compiler (default none)
+
+CC1="src/luxdvr/luxdvr -q -mx64 -O2 -static $LUX_BENCH_CFLAGS"
+BENCH_PATH=$(mktemp -d)
+
+trap 'rm -rf $BENCH_PATH' EXIT
+
+cat >$BENCH_PATH/fib.c <<'END'
+int fib(int n) { return n < 2 ? n : fib(n-1)+fib(n-2); }
+int main(void) { return fib(32) != 2178309; }
+END
+
+cat >$BENCH_PATH/ackermann.c <<'END'
+int ack(int m, int n)
+{
+    if (m == 0)
+        return n+1;
+    if (n == 0)
+        return ack(m-1, 1);
+    return ack(m-1, ack(m, n-1));
+}
+int main(void) { return ack(3, 9) != 4093; }
+END
+
+cat >$BENCH_PATH/qsort.c <<'END'
+#include <stdlib.h>
+static int cmp(const void *p1, const void *p2)
+{
+    int a = *(const int *)p1, b = *(const int *)p2;
+    return a < b ? -1 : a > b;
+}
+int main(void)
+{
+    int i, *a;
+
+    a = malloc(300000*sizeof(int));
+    srand(1);
+    for (i = 0; i < 300000; i++)
+        a[i] = rand();
+    qsort(a, 300000, sizeof(int), cmp);
+    for (i = 1; i < 300000; i++)
+        if (a[i-1] > a[i])
+            return 1;
+    return 0;
+}
+END
+
+cat >$BENCH_PATH/sprintf.c <<'END'
+#include <stdio.h>
+int main(void)
+{
+    int i;
+    char buf[128];
+
+    for (i = 0; i < 300000; i++)
+        sprintf(buf, "%d %s %x %c %ld", i, "abc", i*3, 'a'+i%26, (long)i*i);
+    return 0;
+}
+END
+
+echo "== call benchmark begins... =="
+for file in $BENCH_PATH/*.c ; do
+	$CC1 $file -o ${file%.*} || { echo "failed: $file"; continue; }
+	start=$(date +%s%N)
+	${file%.*} || echo "wrong result: $file"
+	end=$(date +%s%N)
+	echo "$(basename ${file%.*}): $(( (end-start)/1000000 )) ms"
+done
+echo "== call benchmark done =="
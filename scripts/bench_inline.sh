@@ -0,0 +1,47 @@
+#!/bin/bash
+
+# Compare the execute tests built with -O2 and with -O3 (which adds
+# inlining) for x64. Every program is run LUX_BENCH_REPS times; the
+# time of each version and the speedup are reported per program.
+#
+# LUX_BENCH_REPS: number of runs of each program (default 20)
+
+CC1="src/luxdvr/luxdvr -q -mx64"
+TESTS_PATH=src/tests/execute
+REPS=${LUX_BENCH_REPS:-20}
+BENCH_PATH=$(mktemp -d)
+
+trap 'rm -rf $BENCH_PATH' EXIT
+
+run()
+{
+	local i start end
+
+	start=$(date +%s%N)
+	for ((i = 0; i < REPS; i++)) ; do
+		$1 >/dev/null 2>&1 </dev/null
+	done
+	end=$(date +%s%N)
+	echo $(( (end-start)/1000 ))
+}
+
+echo "== inlining benchmark begins... =="
+printf "%-24s %10s %10s %8s\n" program "-O2 (us)" "-O3 (us)" speedup
+tot2=0
+tot3=0
+for file in $(find $TESTS_PATH/ -maxdepth 1 -name '*.c' | sort) ; do
+	name=$(basename ${file%.*})
+	$CC1 -O2 $file -o $BENCH_PATH/o2 &>/dev/null || continue
+	$CC1 -O3 $file -o $BENCH_PATH/o3 &>/dev/null || { echo "failed: $file"; continue; }
+	if ! cmp -s <($BENCH_PATH/o2 2>&1 </dev/null) <($BENCH_PATH/o3 2>&1 </dev/null) ; then
+		echo "different output: $file"
+		continue
+	fi
+	t2=$(run $BENCH_PATH/o2)
+	t3=$(run $BENCH_PATH/o3)
+	let tot2=tot2+t2
+	let tot3=tot3+t3
+	printf "%-24s %10d %10d %7d%%\n" $name $t2 $t3 $(( t3 ? (t2*100)/t3-100 : 0 ))
+done
+printf "%-24s %10d %10d %7d%%\n" total $tot2 $tot3 $(( tot3 ? (tot2*100)/tot3-100 : 0 ))
+echo "== inlining benchmark done =="
@@ -0,0 +1,37 @@
+#!/bin/bash
+
+# Check the 64-bit arithmetic support library used by the 32-bit targets
+# (src/lib/liblux*.asm, src/lib/liblux.c) against the host compiler with
+# src/tests/execute/long_long_ops.c, then time each operation.
+#
+# LUX_BENCH_ROUNDS: # of rounds over the operand table (default 1000)
+
+CC1=src/luxdvr/luxdvr
+CC2=gcc
+TEST=src/tests/execute/long_long_ops.c
+BENCH_PATH=$(mktemp -d)
+ROUNDS=${LUX_BENCH_ROUNDS:-1000}
+
+trap 'rm -rf $BENCH_PATH' EXIT
+
+$CC1 -q -mx86 -static $TEST -o $BENCH_PATH/x86 || exit 1
+$CC2 $TEST -o $BENCH_PATH/host 2>/dev/null || exit 1
+
+$BENCH_PATH/host >$BENCH_PATH/expect
+if ! $BENCH_PATH/x86 >$BENCH_PATH/output 2>/dev/null ; then
+	echo "cannot run x86 binaries here"
+	exit 1
+fi
+if ! cmp -s $BENCH_PATH/output $BENCH_PATH/expect ; then
+	echo "results differ from the host's:"
+	diff $BENCH_PATH/output $BENCH_PATH/expect
+	exit 1
+fi
+
+echo "== liblux benchmark begins... =="
+echo "$ROUNDS rounds"
+echo "-- x86 (-static)"
+$BENCH_PATH/x86 $ROUNDS
+echo "-- host ($CC2)"
+$BENCH_PATH/host $ROUNDS
+echo "== liblux benchmark done =="
@@ -0,0 +1,41 @@
+#!/bin/bash
+
+# Time the allocator churn test (src/tests/execute/malloc.c) linked
+# statically against our libc and under the VM.
+#
+# LUX_BENCH_ROUNDS: # of allocation rounds (default 300000)
+
+CC1=src/luxdvr/luxdvr
+VM=src/luxvm/luxvm
+TEST=src/tests/execute/malloc.c
+BENCH_PATH=$(mktemp -d)
+ROUNDS=${LUX_BENCH_ROUNDS:-300000}
+if uname -i | grep -q "i386"; then
+	NATIVE="-mx86"
+	VMTARGET="-mvm32"
+else
+	NATIVE="-mx64"
+	VMTARGET="-mvm64"
+fi
+
+trap 'rm -rf $BENCH_PATH' EXIT
+
+$CC1 -q $NATIVE -static $TEST -o $BENCH_PATH/native || exit 1
+$CC1 -q $VMTARGET $TEST -o $BENCH_PATH/prog.vme || exit 1
+
+echo "== malloc benchmark begins... =="
+
+run()
+{
+	local start end
+
+	start=$(date +%s%N)
+	"$@" $ROUNDS >/dev/null || echo "failed: $*"
+	end=$(date +%s%N)
+	echo $(( (end-start)/1000000 ))
+}
+
+echo "$ROUNDS rounds"
+echo "native ($NATIVE -static): $(run $BENCH_PATH/native) ms"
+echo "vm ($VMTARGET):           $(run $VM $BENCH_PATH/prog.vme) ms"
+echo "== malloc benchmark done =="
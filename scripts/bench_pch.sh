@@ -0,0 +1,67 @@
+#!/bin/bash
+
+# Compile every file in src/tests/execute to assembly twice: once with a
+# prologue header (stdio.h, stdlib.h and string.h) included at its top,
+# and once with the precompiled version of that header (-include-pch).
+# Checks that both compilations give the same code, then times them
+# (the best of several rounds is reported).
+#
+# LUX_BENCH_TARGET: target machine (default x64)
+# LUX_BENCH_ROUNDS: # of rounds (default 3)
+
+CC1=src/luxcc
+BENCH_PATH=$(mktemp -d)
+TARGET=${LUX_BENCH_TARGET:-x64}
+ROUNDS=${LUX_BENCH_ROUNDS:-3}
+TESTS=$(find src/tests/execute -name '*.c')
+
+trap 'rm -rf $BENCH_PATH' EXIT
+
+printf '#include <stdio.h>\n#include <stdlib.h>\n#include <string.h>\n' >$BENCH_PATH/prologue.h
+$CC1 -q -m$TARGET -Isrc/lib/include -emit-pch $BENCH_PATH/prologue.h -o $BENCH_PATH/prologue.pch || exit 1
+
+# $1: file, $2: use the precompiled header
+compile()
+{
+	if [ "$2" = "1" ] ; then
+		$CC1 -q -m$TARGET -Isrc/lib/include -i$(dirname $1)/ -include-pch $BENCH_PATH/prologue.pch \
+		$1 -o $BENCH_PATH/pch.s 2>/dev/null
+	else
+		printf '#include "prologue.h"\n#include "%s"\n' $(basename $1) >$BENCH_PATH/w.c
+		$CC1 -q -m$TARGET -Isrc/lib/include -i$(dirname $1)/ $BENCH_PATH/w.c -o $BENCH_PATH/hdr.s 2>/dev/null
+	fi
+}
+
+n=0
+for file in $TESTS ; do
+	compile $file 0 2>/dev/null ; r1=$?
+	compile $file 1 2>/dev/null ; r2=$?
+	if [ $r1 != $r2 ] || [ $r1 = 0 ] && ! cmp -s $BENCH_PATH/hdr.s $BENCH_PATH/pch.s ; then
+		echo "$file: the code differs"
+		exit 1
+	fi
+	n=$((n+1))
+done
+
+echo "== pch benchmark begins... =="
+echo "$n files, target $TARGET, precompiled header $(stat -c %s $BENCH_PATH/prologue.pch) bytes"
+for pch in 0 1 ; do
+	best=0
+	for round in $(seq $ROUNDS) ; do
+		start=$(date +%s%N)
+		for file in $TESTS ; do
+			compile $file $pch 2>/dev/null
+		done
+		end=$(date +%s%N)
+		if [ $best = 0 ] || [ $((end-start)) -lt $best ] ; then
+			best=$((end-start))
+		fi
+	done
+	if [ $pch = 0 ] ; then
+		echo -n "#include: "
+	else
+		echo -n "-include-pch: "
+	fi
+	echo "$((best/1000000)) ms ($((best/1000/n)) us per file)"
+done
+echo "== pch benchmark done =="
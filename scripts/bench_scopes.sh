@@ -0,0 +1,41 @@
+#!/bin/bash
+
+# Time the front end (luxcc -a) on a generated source made of many
+# functions full of nested blocks, each one declaring a few identifiers
+# and a tag, plus switches and labels. Measures the cost of entering and
+# leaving scopes.
+#
+# LUX_BENCH_FUNCS: # of functions (default 300)
+# LUX_BENCH_DEPTH: block nesting depth (default 14)
+
+CC1=src/luxcc
+BENCH_PATH=$(mktemp -d)
+NFUNCS=${LUX_BENCH_FUNCS:-300}
+DEPTH=${LUX_BENCH_DEPTH:-14}
+
+trap 'rm -rf $BENCH_PATH' EXIT
+
+awk -v nfuncs=$NFUNCS -v depth=$DEPTH 'BEGIN {
+	for (f = 0; f < nfuncs; f++) {
+		printf "int f%d(int a)\n{\n    int x0 = a;\n", f
+		for (r = 0; r < 10; r++) {
+			for (d = 1; d < depth; d++) {
+				printf "%*s{ int x%d = x%d+1; struct t%d { int m; } s%d; s%d.m = x%d;\n", d*4, "", d, d-1, d, d, d, d
+				printf "%*sswitch (x%d) { case 1: x%d++; break; case 2: x%d--; default: break; }\n", d*4+4, "", d, d, d
+			}
+			printf "%*sx0 += x%d;\n", depth*4, "", depth-1
+			for (d = depth-1; d >= 1; d--)
+				printf "%*s}\n", d*4, ""
+		}
+		printf "    goto l%d;\nl%d:\n    return x0;\n}\n\n", f, f
+	}
+	printf "int main(void)\n{\n    return f0(0);\n}\n"
+}' > $BENCH_PATH/scopes.c
+
+echo "== scope benchmark begins... =="
+echo "$NFUNCS functions, $((NFUNCS*10*(DEPTH-1))) blocks, depth $DEPTH"
+start=$(date +%s%N)
+$CC1 -q -a $BENCH_PATH/scopes.c || echo "failed"
+end=$(date +%s%N)
+echo "luxcc -a: $(( (end-start)/1000000 )) ms"
+echo "== scope benchmark done =="
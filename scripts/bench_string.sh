@@ -0,0 +1,25 @@
+#!/bin/bash
+
+# Measure the throughput of the libc mem*()/str*() routines across
+# buffer sizes (src/tests/execute/string_ops.c), linked statically
+# against our libc.
+#
+# LUX_BENCH_MSECS: milliseconds per measurement (default 200)
+
+CC1=src/luxdvr/luxdvr
+TEST=src/tests/execute/string_ops.c
+BENCH_PATH=$(mktemp -d)
+MSECS=${LUX_BENCH_MSECS:-200}
+if uname -i | grep -q "i386"; then
+	NATIVE="-mx86"
+else
+	NATIVE="-mx64"
+fi
+
+trap 'rm -rf $BENCH_PATH' EXIT
+
+$CC1 -q $NATIVE -static $TEST -o $BENCH_PATH/native || exit 1
+
+echo "== string benchmark begins... =="
+$BENCH_PATH/native $MSECS
+echo "== string benchmark done =="
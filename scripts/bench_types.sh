@@ -0,0 +1,59 @@
+#!/bin/bash
+
+# Time the front end (luxcc -a) on albinfonts.c, on the compiler's own
+# sources, and on a generated source whose expressions mostly query
+# types: sizeofs of multidimensional arrays of structs and unions, member
+# accesses and assignments between pointers (the best of several rounds
+# is reported).
+#
+# LUX_BENCH_FUNCS:  # of functions of the generated source (default 300)
+# LUX_BENCH_ROUNDS: # of rounds (default 5)
+
+CC1=src/luxcc
+BENCH_PATH=$(mktemp -d)
+NFUNCS=${LUX_BENCH_FUNCS:-300}
+ROUNDS=${LUX_BENCH_ROUNDS:-5}
+SELF=$(ls src/*.c src/util/*.c src/*_cgen/*.c | grep -v ELF_util)
+
+trap 'rm -rf $BENCH_PATH' EXIT
+
+awk -v nfuncs=$NFUNCS 'BEGIN {
+	printf "struct s { int a; char b[3]; long c; };\n"
+	printf "union u { struct s s; long long d[4]; short h[9]; };\n"
+	printf "struct t { union u u[4][3]; struct s *p; struct t *next; };\n"
+	printf "typedef struct t T;\n\n"
+	for (f = 0; f < nfuncs; f++) {
+		printf "unsigned long f%d(T *x, T y[2][5])\n{\n    unsigned long n = 0;\n    T *q;\n    struct s *r;\n\n", f
+		for (i = 0; i < 20; i++) {
+			printf "    n += sizeof(y[%d][%d].u)+sizeof(x->u[%d])+sizeof(union u [%d][7]);\n", i%2, i%5, i%4, i+1
+			printf "    q = x->next, r = q->p, x = &y[%d][%d];\n", i%2, i%5
+			printf "    n += r->a+x->u[%d][%d].s.b[%d]+(long)y[1][%d].u[0][1].h[%d];\n", i%4, i%3, i%3, i%5, i%9
+		}
+		printf "    return n;\n}\n\n"
+	}
+}' >$BENCH_PATH/types.c
+
+# $1: file list, $2: extra flags
+best_time()
+{
+	local best round start end file
+
+	best=0
+	for round in $(seq $ROUNDS) ; do
+		start=$(date +%s%N)
+		for file in $1 ; do
+			$CC1 -a -q -mx64 $2 $file
+		done
+		end=$(date +%s%N)
+		if [ $best = 0 ] || [ $((end-start)) -lt $best ] ; then
+			best=$((end-start))
+		fi
+	done
+	echo "$((best/1000000)) ms"
+}
+
+echo "== types benchmark begins... =="
+echo "albinfonts.c: $(best_time src/tests/compile/AnsiLove-C-master/albinfonts.c -Isrc/lib/include)"
+echo "self ($(echo $SELF | wc -w) files): $(best_time "$SELF" -Isrc/lib/include)"
+echo "generated ($NFUNCS functions): $(best_time $BENCH_PATH/types.c)"
+echo "== types benchmark done =="
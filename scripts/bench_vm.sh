@@ -0,0 +1,62 @@
+#!/bin/bash
+
+# Compare the threaded and the switch dispatch of the VM
+# interpreter on the execution tests.
+#
+# LUX_BENCH_REPEAT: times each test is run (default 20)
+# LUX_BENCH_CFLAGS: flags used to build the VMs (default -O2)
+
+CC1=src/luxdvr/luxdvr
+VM_SRC=src/luxvm
+TESTS_PATH=src/tests/execute
+BENCH_PATH=$(mktemp -d)
+REPEAT=${LUX_BENCH_REPEAT:-20}
+CFLAGS=${LUX_BENCH_CFLAGS:--O2}
+if uname -i | grep -q "i386"; then
+	CC1="$CC1 -q -mvm32"
+	VMC=$VM_SRC/vm32.c
+else
+	CC1="$CC1 -q -mvm64"
+	VMC=$VM_SRC/vm64.c
+fi
+
+trap 'rm -rf $BENCH_PATH' EXIT
+
+make -s -C src/util util.o && make -s -C $VM_SRC operations.o || exit 1
+gcc -w $CFLAGS -o $BENCH_PATH/vm_threaded $VMC $VM_SRC/operations.o src/util/util.o || exit 1
+gcc -w $CFLAGS -DVM_SWITCH_DISPATCH -o $BENCH_PATH/vm_switch $VMC $VM_SRC/operations.o src/util/util.o || exit 1
+
+echo "== VM dispatch benchmark begins... =="
+
+ntests=0
+for file in $(find $TESTS_PATH/ | grep '\.c') ; do
+	if echo $file | grep -q "$TESTS_PATH/other\|llvm" ; then
+		continue
+	fi
+	prog=$(basename "${file%.*}")
+	if $CC1 $file -o $BENCH_PATH/$prog.vme &>/dev/null ; then
+		let ntests=ntests+1
+	fi
+done
+
+run_all()
+{
+	local vm=$1 start end i prog
+
+	start=$(date +%s%N)
+	for prog in $BENCH_PATH/*.vme ; do
+		for ((i = 0; i < REPEAT; i++)) ; do
+			$vm $prog &>/dev/null </dev/null
+		done
+	done
+	end=$(date +%s%N)
+	echo $(( (end-start)/1000000 ))
+}
+
+t_switch=$(run_all $BENCH_PATH/vm_switch)
+t_threaded=$(run_all $BENCH_PATH/vm_threaded)
+
+echo "$ntests tests, $REPEAT runs each, VMs built with '$CFLAGS'"
+echo "switch:   ${t_switch} ms"
+echo "threaded: ${t_threaded} ms"
+echo "== VM dispatch benchmark done =="
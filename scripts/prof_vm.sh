@@ -0,0 +1,40 @@
+#!/bin/bash
+
+# Profile opcode n-grams of the VM on the execution tests
+# and print the most frequent ones (see src/luxvm/prof.c).
+#
+# LUX_PROF_TOP: number of n-grams printed for each n (default 20)
+
+CC1=src/luxdvr/luxdvr
+VM=src/luxvm/luxvm_prof
+TESTS_PATH=src/tests/execute
+PROF_PATH=$(mktemp -d)
+TOP=${LUX_PROF_TOP:-20}
+if uname -i | grep -q "i386"; then
+	CC1="$CC1 -q -mvm32"
+else
+	CC1="$CC1 -q -mvm64"
+fi
+
+trap 'rm -rf $PROF_PATH' EXIT
+
+make -s -C src/luxvm luxvm_prof || exit 1
+
+echo "== VM profiling begins... =="
+
+for file in $(find $TESTS_PATH/ | grep '\.c') ; do
+	if echo $file | grep -q "$TESTS_PATH/other\|llvm" ; then
+		continue
+	fi
+	if $CC1 $file -o $PROF_PATH/test.vme &>/dev/null ; then
+		LUXVM_PROFILE=$PROF_PATH/counts $VM $PROF_PATH/test.vme &>/dev/null </dev/null
+	fi
+done
+
+for n in 1 2 3 ; do
+	echo "== most frequent $n-grams =="
+	awk -v n=$n '$1 == n { k = $3; for (i = 4; i <= NF; i++) k = k " " $i; c[k] += $2 }
+		END { for (k in c) printf "%14d  %s\n", c[k], k }' $PROF_PATH/counts | sort -rn | head -n $TOP
+done
+
+echo "== VM profiling done =="
@@ -2,6 +2,7 @@ mkdir -p src/tests/self
 cp src/*.c src/*.h src/tests/self/
 cp -r src/util/ src/tests/self/
 rm -f src/tests/self/util/ELF_util.c src/tests/self/util/ELF_util.h
+rm -rf src/tests/self/luxx86
 cp -r src/vm32_cgen/ src/tests/self/
 cp -r src/vm64_cgen/ src/tests/self/
 mkdir -p src/tests/self/luxvm
@@ -4,16 +4,21 @@ TEST_PATH=src/tests/self
 DVR=src/luxdvr/luxdvr
 CC1=$TEST_PATH/luxcc1.out
 CC2=$TEST_PATH/luxcc2.out
-ASM_TMP=$TEST_PATH/asm_tmp.asm
-CFLAGS="-q -alt-asm-tmp $ASM_TMP $1"
+CFLAGS="-q $1 -DINTEGRATED_AS -DLUXAS_LIB"
 CGENS="$TEST_PATH/vm32_cgen/*.c $TEST_PATH/vm64_cgen/*.c $TEST_PATH/x86_cgen/*.c $TEST_PATH/x64_cgen/*.c $TEST_PATH/mips_cgen/*.c $TEST_PATH/arm_cgen/*.c"
+ASM="$TEST_PATH/luxx86/*.c"
 
 /bin/bash scripts/self_copy.sh
 
+# the integrated assembler (luxcc -c)
+mkdir -p $TEST_PATH/luxx86
+cp src/luxx86/luxasx86.c src/luxx86/luxasx86.h $TEST_PATH/luxx86/
+cp src/util/ELF_util.c src/util/ELF_util.h $TEST_PATH/util/
+
 echo "== Self-compilation test begins... =="
 
 # phase 1
-$DVR $CFLAGS $TEST_PATH/*.c $TEST_PATH/util/*.c $CGENS -o $CC1 &>/dev/null
+$DVR $CFLAGS $TEST_PATH/*.c $TEST_PATH/util/*.c $CGENS $ASM -o $CC1 &>/dev/null
 if [ "$?" != "0" ] ; then
 	echo "Phase 1 failed!"
 	exit 1
@@ -24,7 +29,7 @@ fi
 # phase 2
 mv src/luxcc src/luxcc_tmp
 cp $CC1 src/luxcc
-$DVR $CFLAGS $TEST_PATH/*.c $TEST_PATH/util/*.c $CGENS -o $CC2 &>/dev/null
+$DVR $CFLAGS $TEST_PATH/*.c $TEST_PATH/util/*.c $CGENS $ASM -o $CC2 &>/dev/null
 if [ "$?" != "0" ] ; then
 	echo "Phase 2 failed!"
 	mv src/luxcc_tmp src/luxcc
@@ -2033,6 +2033,10 @@ static void arm_arg(int i, unsigned tar, unsigned arg1, unsigned arg2)
                     emitln("ldmia r%d, {r%d, r%d, r%d}", SCRATCH_REG, r, r+1, r+2);
                     siz2 = siz-12;
                     break;
+                case 4:
+                    emitln("ldmia r%d, {r%d, r%d, r%d, r%d}", SCRATCH_REG, r, r+1, r+2, r+3);
+                    siz2 = siz-16;
+                    break;
                 }
                 emitln("sub r13, r13, #12");
                 if (is_representable_in_imm12(siz-siz2))
@@ -2240,7 +2244,9 @@ static void arm_switch(int i, unsigned tar, unsigned arg1, unsigned arg2)
         i = case_start;
         interval_size = max-min+1;
         holes = interval_size-ncase;
-        if (holes <= JMP_TAB_MAX_HOLES)
+
+        /* max-min can overflow when the values are far apart */
+        if ((unsigned long long)max-min < (unsigned long long)ncase+JMP_TAB_MAX_HOLES)
             goto jump_table;
     }
     goto linear_search;
@@ -2401,6 +2407,7 @@ void arm_function_definition(TypeExp *decl_specs, TypeExp *header)
     curr_func = header->str;
     fn = new_cg_node(curr_func);
     size_of_local_area = round_up(cg_node(fn).size_of_local_area, 8);
+    compute_liveness_and_next_use(fn);
 
     ty.decl_specs = decl_specs;
     ty.idl = header->child->child;
@@ -2518,6 +2525,7 @@ void arm_function_definition(TypeExp *decl_specs, TypeExp *header)
     /*memset(pinned, 0, sizeof(int)*ARM_NREG);*/
     memset(modified, 0, sizeof(int)*ARM_NREG);
     free_all_temps();
+    ic_free_function(fn);
 #if 0
     memset(addr_descr_tab, -1, nid_counter*sizeof(int));
     memset(reg_descr_tab, 0, sizeof(unsigned)*ARM_NREG);
@@ -2815,7 +2823,6 @@ void arm_cgen(FILE *outf)
     arm_output_file = outf;
 
     ic_main(&func_def_list, &ext_sym_list);
-    compute_liveness_and_next_use();
 
     asm_decls = string_new(512);
     str_lits = string_new(512);
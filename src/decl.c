@@ -4,13 +4,16 @@
 #include <string.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <stddef.h>
 #include "util/util.h"
+#include "util/atom.h"
 #include "expr.h"
 #include "stmt.h"
 #include "util/arena.h"
 #include "imp_lim.h"
 #include "error.h"
 #include "luxcc.h"
+#include "pch.h"
 
 #define ERROR(tok, ...) emit_error(TRUE, (tok)->info->src_file, (tok)->info->src_line, (tok)->info->src_column, __VA_ARGS__)
 #define WARNING(tok, ...) emit_warning((tok)->info->src_file, (tok)->info->src_line, (tok)->info->src_column, __VA_ARGS__)
@@ -20,6 +23,7 @@
 #define FILE_SCOPE      0
 #define HASH_VAL(s)     (hash(s)%HASH_SIZE)
 #define HASH_VAL2(x)    (hash2(x)%HASH_SIZE)
+#define ATOM_HASH_VAL(a) (atom_hash(a)%HASH_SIZE)
 
 char *current_function_name; /* used to implement __func__ */
 
@@ -36,9 +40,22 @@ ExternId *get_external_declarations(void)
  * identifiers and tags name spaces.
  * The symbol table that implements label names is in stmt.c.
  * Structure and union members are handled in a special way.
+ *
+ * All the scopes share one hash table per name space. Chains are kept
+ * sorted by decreasing nesting level, so the first match is the innermost
+ * declaration and the entries of the innermost scope are at the front of
+ * their chains. Each scope also keeps a list of the entries declared in it;
+ * deleting a scope only touches those entries.
+ *
+ * Ordinary identifiers are atoms (see util/atom.h), they are compared by
+ * address and their hash value is already computed. Tags are compared by
+ * spelling: the name of each type a tag declares is a copy of its own (the
+ * address identifies the type, see struct_or_union_specifier()).
  */
-static Symbol *ordinary_identifiers[MAX_NEST][HASH_SIZE];
-static TypeTag *tags[MAX_NEST][HASH_SIZE];
+static Symbol *ordinary_identifiers[HASH_SIZE];
+static TypeTag *tags[HASH_SIZE];
+static Symbol *scope_oids[MAX_NEST];
+static TypeTag *scope_tags[MAX_NEST];
 
 static int nesting_level = OUTERMOST_LEVEL;
 static int delayed_delete;
@@ -186,12 +203,26 @@ TypeExp *get_type_qual(TypeExp *d)
 /* pop_scope() just set a flag. This function performs the actual delete. */
 static void delete_scope(void)
 {
+    unsigned h;
+    Symbol *sp;
+    TypeTag *tp;
+
     assert(nesting_level >= 0);
 
-    memset(&ordinary_identifiers[nesting_level][0], 0, sizeof(Symbol *)*HASH_SIZE);
+    for (sp = scope_oids[nesting_level]; sp != NULL; sp = sp->next_in_scope) {
+        h = ATOM_HASH_VAL(sp->declarator->str);
+        while (ordinary_identifiers[h]!=NULL && ordinary_identifiers[h]->nesting_level==nesting_level)
+            ordinary_identifiers[h] = ordinary_identifiers[h]->next;
+    }
+    scope_oids[nesting_level] = NULL;
     arena_reset(oids_arena[nesting_level]);
 
-    memset(&tags[nesting_level][0], 0, sizeof(TypeTag *)*HASH_SIZE);
+    for (tp = scope_tags[nesting_level]; tp != NULL; tp = tp->next_in_scope) {
+        h = HASH_VAL(tp->type->str);
+        while (tags[h]!=NULL && tags[h]->nesting_level==nesting_level)
+            tags[h] = tags[h]->next;
+    }
+    scope_tags[nesting_level] = NULL;
     arena_reset(tags_arena[nesting_level]);
 
     --nesting_level;
@@ -227,35 +258,32 @@ int get_curr_scope_id(void)
     return scope_id;
 }
 
+/*
+ * Entries of scopes deeper than the current nesting level are skipped; they
+ * exist while a function's declarator is analyzed at file scope (see
+ * analyze_function_definition()).
+ */
 TypeTag *lookup_tag(char *id, int all)
 {
-    int n;
-    unsigned h;
     TypeTag *np;
 
     if (delayed_delete)
         delete_scope();
 
-    n = nesting_level;
-    h = HASH_VAL(id);
-    if (all == TRUE) {
-        for (; n >= 0; n--)
-            for (np = tags[n][h]; np != NULL; np = np->next)
-                if (equal(id, np->type->str))
-                    return np;
-        return NULL; /* not found */
-    } else {
-        for (np = tags[n][h]; np != NULL; np = np->next)
-            if (equal(id, np->type->str))
-                return np;
-        return NULL; /* not found */
+    for (np = tags[HASH_VAL(id)]; np != NULL; np = np->next) {
+        if (np->nesting_level > nesting_level)
+            continue;
+        if (np->nesting_level<nesting_level && !all)
+            break;
+        if (equal(id, np->type->str))
+            return np;
     }
+    return NULL; /* not found */
 }
 
 void install_tag(TypeExp *ty)
 {
-    unsigned h;
-    TypeTag *np;
+    TypeTag *np, **pp;
 
     DEBUG_PRINTF("new tag `%s', nesting level: %d\n", ty->str, nesting_level);
 
@@ -264,60 +292,53 @@ void install_tag(TypeExp *ty)
 
     np = arena_alloc(tags_arena[nesting_level], sizeof(TypeTag));
     np->type = ty;
-    h = HASH_VAL(ty->str);
-    np->next = tags[nesting_level][h];
-    tags[nesting_level][h] = np;
+    np->nesting_level = nesting_level;
+    for (pp = &tags[HASH_VAL(ty->str)]; *pp!=NULL && (*pp)->nesting_level>nesting_level; pp = &(*pp)->next)
+        ;
+    np->next = *pp;
+    *pp = np;
+    np->next_in_scope = scope_tags[nesting_level];
+    scope_tags[nesting_level] = np;
 }
 
 Symbol *lookup_ordinary_id(char *id, int all)
 {
-    int n;
     Symbol *np;
-    unsigned h;
 
     if (delayed_delete)
         delete_scope();
 
-    n = nesting_level;
-    h = HASH_VAL(id);
-    if (all == TRUE) {
-        for (; n >= 0; n--)
-            for (np = ordinary_identifiers[n][h]; np != NULL; np = np->next)
-                if (equal(id, np->declarator->str))
-                    return np;
-        return NULL; /* not found */
-    } else {
-        for (np = ordinary_identifiers[n][h]; np != NULL; np = np->next)
-            if (equal(id, np->declarator->str))
-                return np;
-        return NULL; /* not found */
+    for (np = ordinary_identifiers[ATOM_HASH_VAL(id)]; np != NULL; np = np->next) {
+        if (np->nesting_level > nesting_level)
+            continue;
+        if (np->nesting_level<nesting_level && !all)
+            break;
+        if (id == np->declarator->str)
+            return np;
     }
+    return NULL; /* not found */
 }
 
 static void install_ordinary_id(TypeExp *decl_specs, TypeExp *declarator, int is_param)
 {
-    Symbol *np;
-    unsigned h;
+    Symbol *np, **pp;
     TypeExp *scs;
     Token curr_scs, prev_scs;
 
-    if (delayed_delete)
-        delete_scope();
-
-    h = HASH_VAL(declarator->str);
-    for (np = ordinary_identifiers[nesting_level][h]; np != NULL; np = np->next)
-        if (equal(declarator->str, np->declarator->str))
-            break;
-
-    if (np == NULL) { /* not found in this scope */
+    if ((np=lookup_ordinary_id(declarator->str, FALSE)) == NULL) { /* not found in this scope */
         np = arena_alloc(oids_arena[nesting_level], sizeof(Symbol));
         np->decl_specs = decl_specs;
         np->declarator = declarator;
         np->is_param = (short)is_param;
         np->nesting_level = (short)nesting_level;
         np->scope = scope_id;
-        np->next = ordinary_identifiers[nesting_level][h];
-        ordinary_identifiers[nesting_level][h] = np;
+        pp = &ordinary_identifiers[ATOM_HASH_VAL(declarator->str)];
+        while (*pp!=NULL && (*pp)->nesting_level>nesting_level)
+            pp = &(*pp)->next;
+        np->next = *pp;
+        *pp = np;
+        np->next_in_scope = scope_oids[nesting_level];
+        scope_oids[nesting_level] = np;
         return;
     }
 
@@ -394,8 +415,8 @@ ExternId *lookup_external_id(char *id)
 {
     ExternId *np;
 
-    for (np = external_declarations[HASH_VAL(id)]; np != NULL; np = np->next)
-        if (equal(id, np->declarator->str))
+    for (np = external_declarations[ATOM_HASH_VAL(id)]; np != NULL; np = np->next)
+        if (id == np->declarator->str)
             return np;
     return NULL; /* not found */
 }
@@ -409,7 +430,7 @@ static void install_external_id(TypeExp *decl_specs, TypeExp *declarator, ExtIdS
     np->decl_specs = decl_specs;
     np->declarator = declarator;
     np->status = status;
-    h = HASH_VAL(declarator->str);
+    h = ATOM_HASH_VAL(declarator->str);
     np->next = external_declarations[h];
     external_declarations[h] = np;
 }
@@ -1587,7 +1608,7 @@ void new_struct_member(TypeExp *decl_specs, TypeExp *declarator)
 
     /* before add, check for duplicate */
     for (p = descriptor_stack[descr_stack_top]->members; p != NULL; p = p->next)
-        if (equal(declarator->str, p->id))
+        if (declarator->str == p->id)
             ERROR(declarator, "duplicate member `%s'", declarator->str);
 
     n = arena_alloc(decl_node_arena, sizeof(StructMember));
@@ -1635,6 +1656,7 @@ void push_struct_descriptor(TypeExp *ty)
     n = arena_alloc(decl_node_arena, sizeof(StructDescriptor));
     n->tag = tag;
     n->size = n->alignment = 0;
+    n->is_union = (ty->op == TOK_UNION);
     n->members = NULL;
     descriptor_stack[++descr_stack_top] = n;
 }
@@ -1652,6 +1674,15 @@ void pop_struct_descriptor(void)
     --descr_stack_top;
     tag = n->tag;
 
+    /* a union is as big as its biggest member */
+    if (n->is_union) {
+        StructMember *m;
+
+        n->size = 0;
+        for (m = n->members; m != NULL; m = m->next)
+            if (m->size > n->size)
+                n->size = m->size;
+    }
     /* adjust the overall size to met with alignment requirements */
     n->size = round_up(n->size, n->alignment);
 
@@ -1682,7 +1713,7 @@ StructMember *get_member_descriptor(TypeExp *ty, char *id)
 
     m = lookup_struct_descriptor(ty->str)->members;
     while (m != NULL) {
-        if (equal(id, m->id))
+        if (id == m->id)
             return m;
         m = m->next;
     }
@@ -1820,6 +1851,159 @@ char *stringify_type_exp(Declaration *d, int show_decayed)
     return s;
 }
 
+/*
+ * Precompiled headers: everything declared at file scope is saved. Functions
+ * and objects defined are saved as if they had only been declared; their
+ * definitions are parsed again from their tokens (see parse_header()).
+ */
+void decl_save_pch(void)
+{
+    int i, n;
+    Symbol *sp;
+    TypeTag *tp;
+    StructDescriptor *sd;
+    StructMember *mp;
+    ExternId *ep;
+    PchOff vec, off, prev, moff;
+
+    if (delayed_delete)
+        delete_scope();
+
+    for (i = n = 0; i < HASH_SIZE; i++)
+        for (ep = external_declarations[i]; ep != NULL; ep = ep->next)
+            ++n;
+    vec = pch_new_vector(n);
+    for (i = n = 0; i < HASH_SIZE; i++) {
+        for (ep = external_declarations[i]; ep != NULL; ep = ep->next) {
+            off = pch_copy(ep, sizeof(ExternId));
+            if (ep->status == DEFINED) {
+                ExtIdStatus *st;
+
+                st = (ExtIdStatus *)pch_ptr(off+offsetof(ExternId, status));
+                if (ep->declarator->child!=NULL && ep->declarator->child->op==TOK_FUNCTION)
+                    *st = REFERENCED;
+                else
+                    *st = TENTATIVELY_DEFINED;
+            }
+            pch_set_ptr(off+offsetof(ExternId, decl_specs), pch_type_exp(ep->decl_specs));
+            pch_set_ptr(off+offsetof(ExternId, declarator), pch_type_exp(ep->declarator));
+            pch_set_str(off+offsetof(ExternId, enclosing_function), ep->enclosing_function);
+            pch_set_ptr(off+offsetof(ExternId, next), 0);
+            pch_set_elem(vec, n++, off);
+        }
+    }
+    pch_set_root(PCH_EXTERN_IDS, vec);
+
+    for (i = n = 0; i < HASH_SIZE; i++)
+        for (sp = ordinary_identifiers[i]; sp != NULL; sp = sp->next)
+            ++n;
+    vec = pch_new_vector(n);
+    for (i = n = 0; i < HASH_SIZE; i++) {
+        for (sp = ordinary_identifiers[i]; sp != NULL; sp = sp->next) {
+            off = pch_copy(sp, sizeof(Symbol));
+            pch_set_ptr(off+offsetof(Symbol, decl_specs), pch_type_exp(sp->decl_specs));
+            pch_set_ptr(off+offsetof(Symbol, declarator), pch_type_exp(sp->declarator));
+            pch_set_ptr(off+offsetof(Symbol, next), 0);
+            pch_set_ptr(off+offsetof(Symbol, next_in_scope), 0);
+            pch_set_elem(vec, n++, off);
+        }
+    }
+    pch_set_root(PCH_ORDINARY_IDS, vec);
+
+    for (i = n = 0; i < HASH_SIZE; i++)
+        for (tp = tags[i]; tp != NULL; tp = tp->next)
+            ++n;
+    vec = pch_new_vector(n);
+    for (i = n = 0; i < HASH_SIZE; i++) {
+        for (tp = tags[i]; tp != NULL; tp = tp->next) {
+            off = pch_copy(tp, sizeof(TypeTag));
+            pch_set_ptr(off+offsetof(TypeTag, type), pch_type_exp(tp->type));
+            pch_set_ptr(off+offsetof(TypeTag, next), 0);
+            pch_set_ptr(off+offsetof(TypeTag, next_in_scope), 0);
+            pch_set_elem(vec, n++, off);
+        }
+    }
+    pch_set_root(PCH_TAGS, vec);
+
+    for (i = n = 0; i < HASH_SIZE; i++)
+        for (sd = struct_descriptor_table[i]; sd != NULL; sd = sd->next)
+            ++n;
+    vec = pch_new_vector(n);
+    for (i = n = 0; i < HASH_SIZE; i++) {
+        for (sd = struct_descriptor_table[i]; sd != NULL; sd = sd->next) {
+            off = pch_copy(sd, sizeof(StructDescriptor));
+            pch_set_str(off+offsetof(StructDescriptor, tag), sd->tag);
+            pch_set_ptr(off+offsetof(StructDescriptor, next), 0);
+            prev = off+offsetof(StructDescriptor, members);
+            for (mp = sd->members; mp != NULL; mp = mp->next) {
+                moff = pch_copy(mp, sizeof(StructMember));
+                pch_set_str(moff+offsetof(StructMember, id), mp->id);
+                pch_set_ptr(moff+offsetof(StructMember, type.decl_specs), pch_type_exp(mp->type.decl_specs));
+                pch_set_ptr(moff+offsetof(StructMember, type.idl), pch_type_exp(mp->type.idl));
+                pch_set_ptr(moff+offsetof(StructMember, next), 0);
+                pch_set_ptr(prev, moff);
+                prev = moff+offsetof(StructMember, next);
+            }
+            pch_set_elem(vec, n++, off);
+        }
+    }
+    pch_set_root(PCH_STRUCT_DESCRIPTORS, vec);
+
+    pch_set_root(PCH_SCOPE_ID, scope_id);
+}
+
+/*
+ * The tables are empty at this point; entries are pushed in reverse
+ * so each chain ends up in the order it had when it was saved.
+ */
+void decl_load_pch(void)
+{
+    unsigned i, n, h;
+    void **v;
+
+    v = pch_get_vector(PCH_EXTERN_IDS, &n);
+    for (i = n; i-- > 0; ) {
+        ExternId *ep = v[i];
+
+        h = ATOM_HASH_VAL(ep->declarator->str);
+        ep->next = external_declarations[h];
+        external_declarations[h] = ep;
+    }
+
+    v = pch_get_vector(PCH_ORDINARY_IDS, &n);
+    for (i = n; i-- > 0; ) {
+        Symbol *sp = v[i];
+
+        h = ATOM_HASH_VAL(sp->declarator->str);
+        sp->next = ordinary_identifiers[h];
+        ordinary_identifiers[h] = sp;
+        sp->next_in_scope = scope_oids[FILE_SCOPE];
+        scope_oids[FILE_SCOPE] = sp;
+    }
+
+    v = pch_get_vector(PCH_TAGS, &n);
+    for (i = n; i-- > 0; ) {
+        TypeTag *tp = v[i];
+
+        h = HASH_VAL(tp->type->str);
+        tp->next = tags[h];
+        tags[h] = tp;
+        tp->next_in_scope = scope_tags[FILE_SCOPE];
+        scope_tags[FILE_SCOPE] = tp;
+    }
+
+    v = pch_get_vector(PCH_STRUCT_DESCRIPTORS, &n);
+    for (i = n; i-- > 0; ) {
+        StructDescriptor *sd = v[i];
+
+        h = HASH_VAL2((unsigned long)sd->tag);
+        sd->next = struct_descriptor_table[h];
+        struct_descriptor_table[h] = sd;
+    }
+
+    scope_id = (int)pch_get_root(PCH_SCOPE_ID);
+}
+
 static void complete_tentative_definition(TypeExp *decl_specs, TypeExp *declarator)
 {
     if (declarator->child == NULL) {
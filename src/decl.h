@@ -33,6 +33,7 @@ struct StructMember {
 struct StructDescriptor {
     char *tag;
     unsigned size, alignment; /* overall size and member's most restrictive alignment */
+    int is_union;
     StructMember *members;
     StructDescriptor *next;
 };
@@ -43,11 +44,14 @@ struct Symbol {
     short is_param, nesting_level;
     int scope;
     Symbol *next;
+    Symbol *next_in_scope;
 };
 
 struct TypeTag {
     TypeExp *type;
+    int nesting_level;
     TypeTag *next;
+    TypeTag *next_in_scope;
 };
 
 void analyze_translation_unit(void);
@@ -73,6 +77,8 @@ ExternId *lookup_external_id(char *id);
 ExternId *new_extern_id_node(void);
 
 void decl_init(void);
+void decl_save_pch(void);
+void decl_load_pch(void);
 void reset_enum_val(void);
 char *stringify_type_exp(Declaration *d, int show_decayed);
 int are_compatible(TypeExp *ds1, TypeExp *dct1, TypeExp *ds2, TypeExp *dct2, int qualified, int compose);
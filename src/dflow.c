@@ -12,6 +12,9 @@
 #include "expr.h"
 #include "util/bset.h"
 #include "util/arena.h"
+#include "luxcc.h"
+
+static int lnid_fn = -1;
 
 static
 void print_id_set(BSet *s)
@@ -20,155 +23,309 @@ void print_id_set(BSet *s)
 
     c = bset_card(s);
     for (i = bset_iterate(s); i != -1; i = bset_iterate(NULL))
-        printf("%s%s", nid2sid_tab[i], (c--!=1)?", ":"");
+        printf("%s%s", nid2sid_tab[cg_node(lnid_fn).lnid2nid[i]], (c--!=1)?", ":"");
+}
+
+// =======================================================================================
+// Local numbering of names.
+// =======================================================================================
+/*
+ * The sets of names used by the analyses are not indexed by nid, but by a dense
+ * renumbering of the nids that appear in the function being analyzed ("local
+ * nids"). This keeps the size of the sets independent of the number of names
+ * in the whole translation unit. Names that don't appear in a function can't
+ * affect the analyses of that function: the only names that can be referenced
+ * implicitly (address-taken variables and static objects) are also restricted
+ * to the ones the function mentions.
+ */
+int *nid2lnid;                  /* nid ==> local nid of the current function, or -1 */
+static BSet *lnid_atv;          /* address-taken variables of the current function */
+
+static void number_nids(unsigned fn)
+{
+    unsigned i, n, max;
+    int *lnids;
+
+    n = 0;
+    max = 64;
+    lnids = malloc(max*sizeof(int));
+    for (i = cfg_node(cg_node(fn).bb_i).leader; i <= cfg_node(cg_node(fn).bb_f).last; i++) {
+        unsigned k, a[3];
+
+        a[0] = instruction(i).tar;
+        a[1] = instruction(i).arg1;
+        a[2] = instruction(i).arg2;
+        for (k = 0; k < 3; k++) {
+            int nid;
+
+            if (address(a[k]).kind!=IdKind && address(a[k]).kind!=TempKind)
+                continue;
+            if (nid2lnid[nid=address_nid(a[k])] != -1)
+                continue;
+            if (n >= max) {
+                max *= 2;
+                lnids = realloc(lnids, max*sizeof(int));
+            }
+            nid2lnid[nid] = (int)n;
+            lnids[n++] = nid;
+        }
+    }
+    cg_node(fn).lnid2nid = lnids;
+    cg_node(fn).nlnid = n;
+}
+
+/*
+ * Make lnid() map the nids of function fn. The numbering is
+ * computed the first time the function is entered.
+ */
+void dflow_enter_function(unsigned fn)
+{
+    unsigned i;
+    int *lnids;
+
+    if (nid2lnid == NULL) {
+        nid2lnid = malloc(nid_counter*sizeof(int));
+        memset(nid2lnid, -1, nid_counter*sizeof(int));
+    }
+    if (lnid_fn == (int)fn)
+        return;
+
+    if (lnid_fn != -1)
+        for (i = 0, lnids = cg_node(lnid_fn).lnid2nid; i < cg_node(lnid_fn).nlnid; i++)
+            nid2lnid[lnids[i]] = -1;
+    lnid_fn = (int)fn;
+    if (cg_node(fn).lnid2nid == NULL)
+        number_nids(fn);
+    else
+        for (i = 0, lnids = cg_node(fn).lnid2nid; i < cg_node(fn).nlnid; i++)
+            nid2lnid[lnids[i]] = (int)i;
+
+    if (lnid_atv != NULL)
+        bset_free(lnid_atv);
+    lnid_atv = bset_new(cg_node(fn).nlnid);
+    for (i = 0, lnids = cg_node(fn).lnid2nid; i < cg_node(fn).nlnid; i++)
+        if (bset_member(address_taken_variables, lnids[i]))
+            bset_insert(lnid_atv, i);
+}
+
+/*
+ * Drop the local numbering of function fn (e.g. once the function
+ * has been emitted). It is computed again if fn is re-entered.
+ */
+void dflow_exit_function(unsigned fn)
+{
+    unsigned i;
+
+    if (lnid_fn == (int)fn) {
+        for (i = 0; i < cg_node(fn).nlnid; i++)
+            nid2lnid[cg_node(fn).lnid2nid[i]] = -1;
+        lnid_fn = -1;
+    }
+    free(cg_node(fn).lnid2nid);
+    cg_node(fn).lnid2nid = NULL;
+    cg_node(fn).nlnid = 0;
+}
+
+// =======================================================================================
+// Worklist solver
+// =======================================================================================
+/*
+ * Apply transfer() to the blocks of function fn until a fixed point is reached.
+ * transfer(b) recomputes the set of block b from the sets of its neighbours and
+ * returns TRUE if it changed; in that case the blocks that depend on b (the
+ * successors in a forward problem, the predecessors in a backward one) are put
+ * back in the worklist. The worklist is visited in reverse post-order (forward)
+ * or post-order (backward), wrapping around until it is empty.
+ */
+static void dflow_solve(unsigned fn, int forward, int (*transfer)(unsigned b))
+{
+    int k;
+    unsigned i, n, entry_bb;
+    unsigned *order, *pos;
+    BSet *pending;
+
+    entry_bb = cg_node(fn).bb_i;
+    n = cg_node(fn).bb_f-entry_bb+1;
+    order = malloc(n*sizeof(unsigned));
+    pos = malloc(n*sizeof(unsigned));
+    for (i = 0; i < n; i++) {
+        order[i] = forward ? cfg_node(entry_bb+i).RPO : cfg_node(entry_bb+i).PO;
+        assert(order[i]>=entry_bb && order[i]-entry_bb<n);
+        pos[order[i]-entry_bb] = i;
+    }
+    pending = bset_new(n);
+    bset_fill(pending, n);
+
+    for (k = 0; k != -1; ) {
+        unsigned b;
+        GraphEdge *dep;
+
+        bset_delete(pending, k);
+        b = order[k];
+        if (transfer(b)) {
+            dep = forward ? &cfg_node(b).out : &cfg_node(b).in;
+            for (i = 0; i < dep->n; i++)
+                bset_insert(pending, pos[dep->edges[i]-entry_bb]);
+        }
+        if ((k=bset_next(pending, k+1)) == -1)
+            k = bset_next(pending, 0);
+    }
+    bset_free(pending);
+    free(order), free(pos);
 }
 
 // =======================================================================================
 // Reaching definitions
 // =======================================================================================
-#if 0
-typedef struct VarDefPoint VarDefPoint;
-static struct VarDefPoint {
-    unsigned dp;
-    VarDefPoint *next;
-} **variable_definition_points;
-static Arena *vdp_arena;
+/*
+ * The definitions are the quads that assign a name. The DEDef, DefKill and
+ * ReachIn sets are indexed by the position of the quads in the function
+ * (its first quad is 0).
+ */
+static int *first_def;  /* local nid ==> last quad that assigns it, or -1 */
+static int *next_def;   /* quad ==> previous quad that assigns the same name, or -1 */
 
 static void reach_print_set(BSet *s, unsigned first);
-static void reach_init_block(unsigned b, unsigned ninstr, unsigned first);
 
 void reach_print_set(BSet *s, unsigned first)
 {
-    unsigned i, c;
+    int i, c;
 
     c = bset_card(s);
     for (i = bset_iterate(s); i != -1; i = bset_iterate(NULL))
-        printf("%d%s", i+first, (c--!=1)?", ":"");
+        printf("%u%s", i+first, (c--!=1)?", ":"");
 }
 
-void reach_init_block(unsigned b, unsigned ninstr, unsigned first)
+/* return the local nid of the name assigned by quad i, or -1 */
+static int reach_def(unsigned i)
 {
-    int i;
-    BSet *defined_names;
+    unsigned tar;
+
+    switch (instruction(i).op) {
+    case OpCall: case OpIndCall:
+    case OpAdd: case OpSub: case OpMul: case OpDiv:
+    case OpRem: case OpSHL: case OpSHR: case OpAnd:
+    case OpOr: case OpXor: case OpEQ: case OpNEQ:
+    case OpLT: case OpLET: case OpGT: case OpGET:
+    case OpNeg: case OpCmpl: case OpNot: case OpCh:
+    case OpUCh: case OpSh: case OpUSh: case OpAsn:
+    case OpAddrOf: case OpInd:
+        tar = instruction(i).tar;
+        if (tar==0 || address(tar).kind!=IdKind && address(tar).kind!=TempKind)
+            return -1;
+        return lnid(address_nid(tar));
+    default:
+        return -1;
+    }
+}
+
+static void reach_init_block(unsigned b, unsigned ninstr, unsigned first, BSet *defined_names)
+{
+    int i, l, d;
     BSet *DEDef, *DefKill;
 
-    defined_names = bset_new(nid_counter);
     DEDef = bset_new(ninstr);
     DefKill = bset_new(ninstr);
-
+    bset_clear(defined_names);
     for (i = cfg_node(b).last; i >= (int)cfg_node(b).leader; i--) {
-        int tar_nid;
-        unsigned tar/*, arg1, arg2*/;
-
-        tar = instruction(i).tar;
-        /*arg1 = instruction(i).arg1;
-        arg2 = instruction(i).arg2;*/
-
-        switch (instruction(i).op) {
-        case OpCall:
-        case OpIndCall:
-            if (!tar)
-                continue;
-        case OpAdd: case OpSub: case OpMul: case OpDiv:
-        case OpRem: case OpSHL: case OpSHR: case OpAnd:
-        case OpOr: case OpXor: case OpEQ: case OpNEQ:
-        case OpLT: case OpLET: case OpGT: case OpGET:
-        case OpNeg: case OpCmpl: case OpNot: case OpCh:
-        case OpUCh: case OpSh: case OpUSh: case OpAsn:
-        case OpAddrOf: case OpInd:
-            tar_nid = address_nid(tar);
-            if (!bset_member(defined_names, tar_nid)) {
-                VarDefPoint *p;
-
-                bset_insert(DEDef, i-first);
-                for (p = variable_definition_points[tar_nid]; p != NULL; p = p->next)
-                    bset_insert(DefKill, p->dp-first);
-                bset_delete(DefKill, i-first);
-                bset_insert(defined_names, tar_nid);
-            }
-            continue;
-
-        default:
+        if ((l=reach_def(i))==-1 || bset_member(defined_names, l))
             continue;
-        }
+        bset_insert(DEDef, i-first);
+        for (d = first_def[l]; d != -1; d = next_def[d])
+            if (d != i-first)
+                bset_insert(DefKill, d);
+        bset_insert(defined_names, l);
     }
     cfg_node(b).DEDef = DEDef;
     cfg_node(b).DefKill = DefKill;
-    bset_free(defined_names);
 }
 
-void dflow_ReachIn(unsigned fn, int is_last)
+static int reach_transfer(unsigned b)
 {
-    BSet *temp, *new_in;
-    unsigned entry_bb, exit_bb;
-    unsigned i, changed, ninstr;
+    int j, changed;
+    GraphEdge *in;
+
+    /* ReachIn(b) = the union over all predecessors p of DEDef(p) U (ReachIn(p) \ DefKill(p)) */
+    changed = FALSE;
+    in = &cfg_node(b).in;
+    for (j = 0; j < in->n; j++) {
+        unsigned p;
+
+        p = in->edges[j];
+        changed |= bset_union_diff(cfg_node(b).ReachIn, cfg_node(p).DEDef, cfg_node(p).ReachIn, cfg_node(p).DefKill);
+    }
+    return changed;
+}
+
+/*
+ * Compute the definitions that reach the start of every block of function fn.
+ * Nothing uses them at the moment.
+ */
+void dflow_ReachIn(unsigned fn)
+{
+    int l;
+    BSet *defined_names;
+    unsigned i, entry_bb, exit_bb, first, last, ninstr;
 
     if (cg_node_is_empty(fn))
         return;
 
+    dflow_enter_function(fn);
     entry_bb = cg_node(fn).bb_i;
     exit_bb = cg_node(fn).bb_f;
-    ninstr = cfg_node(exit_bb).last-cfg_node(entry_bb).leader+1;
+    first = cfg_node(entry_bb).leader;
+    last = cfg_node(exit_bb).last;
+    ninstr = last-first+1;
+
+    /* chain the definitions of every name */
+    first_def = malloc(cg_node(fn).nlnid*sizeof(int)); /* not used if nlnid is 0 */
+    memset(first_def, -1, cg_node(fn).nlnid*sizeof(int));
+    next_def = malloc(ninstr*sizeof(int));
+    for (i = first; i <= last; i++) {
+        if ((l=reach_def(i)) != -1) {
+            next_def[i-first] = first_def[l];
+            first_def[l] = (int)(i-first);
+        }
+    }
 
+    defined_names = bset_new(cg_node(fn).nlnid);
     for (i = entry_bb; i <= exit_bb; i++) {
-        reach_init_block(i, ninstr, cfg_node(entry_bb).leader);
-
-#if DEBUG
-        printf("DEDef[B%d]=", i);
-        reach_print_set(cfg_node(i).DEDef, cfg_node(entry_bb).leader);
-        printf("\n\n");
-
-        printf("DefKill[B%d]=", i);
-        reach_print_set(cfg_node(i).DefKill, cfg_node(entry_bb).leader);
-        printf("\n\n");
-#endif
-
+        reach_init_block(i, ninstr, first, defined_names);
         /* all ReachIn sets are initially empty */
         cfg_node(i).ReachIn = bset_new(ninstr);
     }
+    bset_free(defined_names);
+    free(first_def), free(next_def);
 
-    temp = bset_new(ninstr);
-    new_in = bset_new(ninstr);
-
-    changed = TRUE;
-    while (changed) {
-        DEBUG_PRINTF("==> ReachIn solver iteration\n");
-        changed = FALSE;
-        for (i = entry_bb; i <= exit_bb; i++) {
-            unsigned pred, b;
-
-            b = CFG_RPO[i];
-            for (pred = edge_iterate(&cfg_node(b).in); pred != -1; pred = edge_iterate(NULL)) {
-                bset_cpy(temp, cfg_node(pred).ReachIn);
-                bset_diff(temp, cfg_node(pred).DefKill);
-                bset_union(temp, cfg_node(pred).DEDef);
-                bset_union(new_in, temp);
-            }
-            if (!bset_eq(cfg_node(b).ReachIn, new_in)) {
-                bset_cpy(cfg_node(b).ReachIn, new_in);
-                changed = TRUE;
-            }
-            bset_clear(new_in);
-        }
-    }
-    bset_free(temp), bset_free(new_in);
-    if (is_last) {
-        free(variable_definition_points);
-        arena_destroy(vdp_arena);
-    } else {
-        memset(variable_definition_points, 0, nid_counter*sizeof(VarDefPoint *));
-        arena_reset(vdp_arena);
-    }
+    dflow_solve(fn, TRUE, reach_transfer);
 
 #if DEBUG
+    printf("Reaching definitions, function: `%s'\n", cg_node(fn).func_id);
     for (i = entry_bb; i <= exit_bb; i++) {
-        printf("ReachIn[%u]=", i);
-        reach_print_set(cfg_node(i).ReachIn, cfg_node(entry_bb).leader);
+        printf("DEDef[B%u]=", i);
+        reach_print_set(cfg_node(i).DEDef, first);
+        printf("\nDefKill[B%u]=", i);
+        reach_print_set(cfg_node(i).DefKill, first);
+        printf("\nReachIn[B%u]=", i);
+        reach_print_set(cfg_node(i).ReachIn, first);
         printf("\n\n");
     }
 #endif
 }
-#endif
+
+void dflow_free_ReachIn(unsigned fn)
+{
+    unsigned i;
+
+    if (cg_node_is_empty(fn))
+        return;
+    for (i = cg_node(fn).bb_i; i <= cg_node(fn).bb_f; i++) {
+        bset_free(cfg_node(i).DEDef);
+        bset_free(cfg_node(i).DefKill);
+        bset_free(cfg_node(i).ReachIn);
+        cfg_node(i).DEDef = cfg_node(i).DefKill = cfg_node(i).ReachIn = NULL;
+    }
+}
 // =======================================================================================
 // Dominance
 // =======================================================================================
@@ -183,69 +340,65 @@ void dom_print_set(BSet *s)
         printf("%d%s", i, (c--!=1)?", ":"");
 }
 
+static BSet *dom_tmp;
+static unsigned dom_entry_bb;
+
+static int dom_transfer(unsigned b)
+{
+    int j;
+    GraphEdge *in;
+
+    /* with unreachable code the first node in RPO may not be n0 */
+    in = &cfg_node(b).in;
+    if (b==dom_entry_bb || in->n==0)
+        return FALSE;
+
+    /* Dom(n) = { n } U (the intersection of Dom(p) for all predecessors p of n) */
+    bset_cpy(dom_tmp, cfg_node(in->edges[0]).Dom);
+    for (j = 1; j < in->n; j++)
+        bset_inters(dom_tmp, cfg_node(in->edges[j]).Dom);
+    bset_insert(dom_tmp, b-dom_entry_bb);
+    return bset_update(cfg_node(b).Dom, dom_tmp);
+}
+
+/*
+ * Compute the dominators of every block of function fn. The
+ * blocks in the Dom sets are numbered from the function's first
+ * block (cg_node(fn).bb_i is 0).
+ */
 void dflow_Dom(unsigned fn)
 {
     /*
-     * TBD:
-     * Unreachable code (e.g. the one caused by 'return' statements)
-     * makes the exit node be dominated by itself only.
+     * Unreachable nodes (e.g. the ones caused by 'return' statements)
+     * keep Dom(n) = N. They never execute, so they must not constrain
+     * the dominators of their successors.
      */
 
-    int i, changed;
-    BSet *N, *temp;
-    unsigned entry_bb, exit_bb;
+    int i;
+    unsigned entry_bb, exit_bb, n;
 
     if (cg_node_is_empty(fn))
         return;
 
     entry_bb = cg_node(fn).bb_i;
     exit_bb = cg_node(fn).bb_f;
+    n = exit_bb-entry_bb+1;
 
     /* Dom(n0) = { n0 } */
-    cfg_node(entry_bb).Dom = bset_new(cfg_nodes_counter);
-    bset_insert(cfg_node(entry_bb).Dom, entry_bb);
-
-    /* N = all nodes of the CFG */
-    N = bset_new(cfg_nodes_counter);
-    for (i = entry_bb; i <= exit_bb; i++)
-        bset_insert(N, i);
+    cfg_node(entry_bb).Dom = bset_new(n);
+    bset_insert(cfg_node(entry_bb).Dom, 0);
 
     /* for every n != n0, Dom(n) = N */
     for (i = entry_bb+1; i <= exit_bb; i++) {
-        cfg_node(i).Dom = bset_new(cfg_nodes_counter);
-        bset_cpy(cfg_node(i).Dom, N);
+        cfg_node(i).Dom = bset_new(n);
+        bset_fill(cfg_node(i).Dom, n);
     }
 
-    /* working set */
-    temp = bset_new(cfg_nodes_counter);
-
     /* solve equations */
-    changed = TRUE;
-    while (changed) {
-        DEBUG_PRINTF("==> Dom solver iteration\n");
-        changed = FALSE;
-        for (i = entry_bb+1; i <= exit_bb; i++) {
-            int j, i2;
-            unsigned pred;
-
-            i2 = cfg_node(i).RPO;
-            assert(i2 >= entry_bb);
-            assert(i2 <= exit_bb);
-            if ((pred = cfg_node(i2).in.edges[0])) {
-                bset_cpy(temp, cfg_node(pred).Dom);
-                for (j = 1; j<cfg_node(i2).in.n && (pred=cfg_node(i2).in.edges[j]); j++)
-                    bset_inters(temp, cfg_node(pred).Dom);
-            }
-            bset_insert(temp, i2);
-
-            if (!bset_eq(temp, cfg_node(i2).Dom)) {
-                bset_cpy(cfg_node(i2).Dom, temp);
-                changed = TRUE;
-            }
-            bset_clear(temp);
-        }
-    }
-    bset_free(N), bset_free(temp);
+    dom_tmp = bset_new(n);
+    dom_entry_bb = entry_bb;
+    dflow_solve(fn, TRUE, dom_transfer);
+    bset_free(dom_tmp);
 
 #if DEBUG
         printf("Dominance, function: `%s'\n", cg_node(fn).func_id);
@@ -257,12 +410,30 @@ void dflow_Dom(unsigned fn)
 #endif
 }
 
+void dflow_free_Dom(unsigned fn)
+{
+    unsigned i;
+
+    if (cg_node_is_empty(fn))
+        return;
+    for (i = cg_node(fn).bb_i; i <= cg_node(fn).bb_f; i++) {
+        bset_free(cfg_node(i).Dom);
+        cfg_node(i).Dom = NULL;
+    }
+}
+
 // =======================================================================================
 // Live analysis.
 // =======================================================================================
 static void live_init_block(unsigned b, int exit_bb);
 static BSet *live_tmp;
 static BSet *modified_static_objects;
+/*
+ * The sets of the live analysis are needed for one function at a
+ * time: they are allocated from this arena, which is recycled by
+ * dflow_free_LiveOut().
+ */
+static Arena *live_arena;
 
 /*
  * Compute UEVar(b) and VarKill(b).
@@ -274,8 +445,8 @@ void live_init_block(unsigned b, int exit_bb)
     BSet *UEVar, *VarKill;
 
     /* sets initially empty */
-    UEVar = bset_new(nid_counter);
-    VarKill = bset_new(nid_counter);
+    UEVar = bset_new_in(live_arena, cg_node(lnid_fn).nlnid);
+    VarKill = bset_new_in(live_arena, cg_node(lnid_fn).nlnid);
 
     if (exit_bb)
         bset_cpy(UEVar, modified_static_objects);
@@ -289,10 +460,10 @@ void live_init_block(unsigned b, int exit_bb)
 
         switch (instruction(i).op) {
 #define add_UEVar(e)\
-    if (!bset_member(VarKill, address_nid(e)))\
-        bset_insert(UEVar, address_nid(e))
+    if (!bset_member(VarKill, lnid(address_nid(e))))\
+        bset_insert(UEVar, lnid(address_nid(e)))
 #define add_VarKill(e)\
-    bset_insert(VarKill, address_nid(e))
+    bset_insert(VarKill, lnid(address_nid(e)))
 /*#define add_VarDefPoint(e)\
     do {\
         VarDefPoint **p;\
@@ -327,7 +498,7 @@ void live_init_block(unsigned b, int exit_bb)
         case OpAsn: /* keep track of static objects modified by this function */
             if ((address(tar).kind == IdKind)
             && (address(tar).cont.var.e->attr.var.duration == DURATION_STATIC))
-                bset_insert(modified_static_objects, address_nid(tar));
+                bset_insert(modified_static_objects, lnid(address_nid(tar)));
         case OpNeg: case OpCmpl: case OpNot: case OpCh:
         case OpUCh: case OpSh: case OpUSh:  case OpLLSX:
         case OpLLZX:
@@ -356,7 +527,7 @@ void live_init_block(unsigned b, int exit_bb)
              * references (assume all address-taken variables
              * are referenced).
              */
-            bset_cpy(live_tmp, address_taken_variables);
+            bset_cpy(live_tmp, lnid_atv);
             bset_diff(live_tmp, VarKill);
             bset_union(UEVar, live_tmp);
 
@@ -379,7 +550,7 @@ void live_init_block(unsigned b, int exit_bb)
 
         case OpCall:
         case OpIndCall:
-            bset_cpy(live_tmp, address_taken_variables);
+            bset_cpy(live_tmp, lnid_atv);
             bset_union(live_tmp, modified_static_objects);
             bset_diff(live_tmp, VarKill);
             bset_union(UEVar, live_tmp);
@@ -400,11 +571,27 @@ void live_init_block(unsigned b, int exit_bb)
     cfg_node(b).VarKill = VarKill;
 }
 
+static int live_transfer(unsigned b)
+{
+    int changed;
+    unsigned succ;
+
+    /*
+     * LiveOut(b) = the union of all successors of b, where the contribution
+     *              of each successor m is       __________
+     *                  UEVar(m) U (LiveOut(m) ∩ VarKill(m))
+     */
+    changed = FALSE;
+    for (succ = edge_iterate(&cfg_node(b).out); succ != -1; succ = edge_iterate(NULL))
+        changed |= bset_union_diff(cfg_node(b).LiveOut, cfg_node(succ).UEVar,
+        cfg_node(succ).LiveOut, cfg_node(succ).VarKill);
+    return changed;
+}
+
 /* compute LiveOut for all the blocks of the CFG */
 void dflow_LiveOut(unsigned fn)
 {
-    BSet *new_out;
-    unsigned i, changed;
+    unsigned i;
     unsigned entry_bb, exit_bb;
 
     if (cg_node_is_empty(fn))
@@ -412,10 +599,13 @@ void dflow_LiveOut(unsigned fn)
 
     entry_bb = cg_node(fn).bb_i;
     exit_bb = cg_node(fn).bb_f;
+    dflow_enter_function(fn);
     // variable_definition_points = calloc(nid_counter, sizeof(VarDefPoint *));
     // vdp_arena = arena_new(sizeof(VarDefPoint)*32);
-    live_tmp = bset_new(nid_counter);
-    modified_static_objects = bset_new(nid_counter);
+    if (live_arena == NULL)
+        live_arena = arena_new(4096, FALSE);
+    live_tmp = bset_new_in(live_arena, cg_node(fn).nlnid);
+    modified_static_objects = bset_new_in(live_arena, cg_node(fn).nlnid);
 
     /* gather initial information */
     for (i = entry_bb; i <= exit_bb; i++) {
@@ -432,42 +622,12 @@ void dflow_LiveOut(unsigned fn)
 #endif
 
         /* all LiveOut sets are initially empty */
-        cfg_node(i).LiveOut = bset_new(nid_counter);
+        cfg_node(i).LiveOut = bset_new_in(live_arena, cg_node(fn).nlnid);
     }
     cg_node(fn).modified_static_objects = modified_static_objects;
 
-    new_out = bset_new(nid_counter);
-
     /* solve equations */
-    changed = TRUE;
-    while (changed) {
-        DEBUG_PRINTF("==> LiveOut solver iteration\n");
-        changed = FALSE;
-        for (i = entry_bb; i <= exit_bb; i++) {
-            unsigned succ, b;
-
-            b = cfg_node(i).PO;
-            assert(b >= entry_bb);
-            assert(b <= exit_bb);
-            /*
-             * LiveOut(b) = the union of all successors of b, where the contribution
-             *              of each successor m is       __________
-             *                  UEVar(m) U (LiveOut(m) ∩ VarKill(m))
-             */
-            for (succ = edge_iterate(&cfg_node(b).out); succ != -1; succ = edge_iterate(NULL)) {
-                bset_cpy(live_tmp, cfg_node(succ).LiveOut);
-                bset_diff(live_tmp, cfg_node(succ).VarKill);
-                bset_union(live_tmp, cfg_node(succ).UEVar);
-                bset_union(new_out, live_tmp);
-            }
-            if (!bset_eq(cfg_node(b).LiveOut, new_out)) {
-                bset_cpy(cfg_node(b).LiveOut, new_out);
-                changed = TRUE;
-            }
-            bset_clear(new_out);
-        }
-    }
-    bset_free(live_tmp), bset_free(new_out);
+    dflow_solve(fn, FALSE, live_transfer);
 
 #if DEBUG
     for (i = entry_bb; i <= exit_bb; i++) {
@@ -478,6 +638,19 @@ void dflow_LiveOut(unsigned fn)
 #endif
 }
 
+void dflow_free_LiveOut(unsigned fn)
+{
+    unsigned b;
+
+    if (cg_node_is_empty(fn))
+        return;
+
+    for (b = cg_node(fn).bb_i; b <= cg_node(fn).bb_f; b++)
+        cfg_node(b).UEVar = cfg_node(b).VarKill = cfg_node(b).LiveOut = NULL;
+    cg_node(fn).modified_static_objects = NULL;
+    arena_reset(live_arena);
+}
+
 /*
  * Liveness and next-use.
  */
@@ -501,6 +674,71 @@ static void init_operand_table(BSet *block_LiveOut)
     bset_cpy(operand_liveness, block_LiveOut);
 }
 
+/*
+ * The code generators allocate stack slots for temporaries in code order and
+ * release a slot at the point where its temporary dies. That is only correct
+ * if the live range of every temporary is contiguous in code order, which is
+ * what the IC generator produces, but not necessarily what comes out of the
+ * optimizer (e.g. a GVN'd temp may be used in two unrelated case blocks of a
+ * switch). Temporaries live across block boundaries are therefore reported
+ * as live at every use, so their slots are never released.
+ */
+static void pin_cross_block_temps(unsigned fn)
+{
+    int b, i;
+
+    bset_clear(operand_liveness);
+    for (b = cg_node(fn).bb_i; b <= cg_node(fn).bb_f; b++)
+        bset_union(operand_liveness, cfg_node(b).LiveOut);
+
+    for (i = cfg_node(cg_node(fn).bb_i).leader; i <= cfg_node(cg_node(fn).bb_f).last; i++) {
+        unsigned tar, arg1, arg2;
+
+        tar = instruction(i).tar;
+        arg1 = instruction(i).arg1;
+        arg2 = instruction(i).arg2;
+#define cross_block(a)  (address(a).kind==TempKind && bset_member(operand_liveness, lnid(address_nid(a))))
+        switch (instruction(i).op) {
+        case OpAdd: case OpSub: case OpMul: case OpDiv:
+        case OpRem: case OpSHL: case OpSHR: case OpAnd:
+        case OpOr: case OpXor: case OpEQ: case OpNEQ:
+        case OpLT: case OpLET: case OpGT: case OpGET:
+            if (cross_block(arg2))
+                liveness_and_next_use[i] |= AR2_LIVE_MASK;
+            /* fall through */
+        case OpNeg: case OpCmpl: case OpNot: case OpCh:
+        case OpAsn: case OpUCh: case OpSh: case OpUSh:
+        case OpLLSX: case OpLLZX: case OpInd:
+            if (cross_block(arg1))
+                liveness_and_next_use[i] |= AR1_LIVE_MASK;
+            /* fall through */
+        case OpAddrOf:
+            if (cross_block(tar))
+                liveness_and_next_use[i] |= TAR_LIVE_MASK;
+            break;
+        case OpArg: case OpRet: case OpSwitch: case OpCBr:
+            if (cross_block(arg1))
+                liveness_and_next_use[i] |= AR1_LIVE_MASK;
+            break;
+        case OpIndAsn:
+            if (cross_block(arg1))
+                liveness_and_next_use[i] |= AR1_LIVE_MASK;
+            if (cross_block(arg2))
+                liveness_and_next_use[i] |= AR2_LIVE_MASK;
+            break;
+        case OpCall: case OpIndCall:
+            if (tar && cross_block(tar))
+                liveness_and_next_use[i] |= TAR_LIVE_MASK;
+            if (instruction(i).op==OpIndCall && cross_block(arg1))
+                liveness_and_next_use[i] |= AR1_LIVE_MASK;
+            break;
+        default:
+            break;
+        }
+#undef cross_block
+    }
+}
+
 static void compute_function_liveness_and_next_use(unsigned fn)
 {
     int b;
@@ -511,6 +749,9 @@ static void compute_function_liveness_and_next_use(unsigned fn)
 
     entry_bb = cg_node(fn).bb_i;
     last_bb = cg_node(fn).bb_f;
+    dflow_enter_function(fn);
+    operand_liveness = bset_new(cg_node(fn).nlnid);
+    operand_next_use = bset_new(cg_node(fn).nlnid);
 
     /* annotate the quads of every block with liveness and next-use information */
     for (b = entry_bb; b <= last_bb; b++) {
@@ -530,7 +771,7 @@ static void compute_function_liveness_and_next_use(unsigned fn)
         do {\
             int tar_nid;\
 \
-            tar_nid = address_nid(tar);\
+            tar_nid = lnid(address_nid(tar));\
             if (bset_member(operand_liveness, tar_nid)) {\
                 liveness_and_next_use[i] |= TAR_LIVE_MASK;\
                 bset_delete(operand_liveness, tar_nid);\
@@ -548,7 +789,7 @@ static void compute_function_liveness_and_next_use(unsigned fn)
         do {\
             int arg1_nid;\
 \
-            arg1_nid = address_nid(arg1);\
+            arg1_nid = lnid(address_nid(arg1));\
             if (bset_member(operand_liveness, arg1_nid)) {\
                 liveness_and_next_use[i] |= AR1_LIVE_MASK;\
             } else {\
@@ -566,7 +807,7 @@ static void compute_function_liveness_and_next_use(unsigned fn)
         do {\
             int arg2_nid;\
 \
-            arg2_nid = address_nid(arg2);\
+            arg2_nid = lnid(address_nid(arg2));\
             if (bset_member(operand_liveness, arg2_nid)) {\
                 liveness_and_next_use[i] |= AR2_LIVE_MASK;\
             } else {\
@@ -615,7 +856,7 @@ static void compute_function_liveness_and_next_use(unsigned fn)
             case OpInd:
                 update_tar();
                 update_arg1();
-                bset_union(operand_liveness, address_taken_variables);
+                bset_union(operand_liveness, lnid_atv);
                 continue;
 
             case OpIndAsn:
@@ -631,7 +872,7 @@ static void compute_function_liveness_and_next_use(unsigned fn)
                 if (instruction(i).op==OpIndCall && !const_addr(arg1))
                     update_arg1();
                 bset_union(operand_liveness, cg_node(fn).modified_static_objects);
-                bset_union(operand_liveness, address_taken_variables);
+                bset_union(operand_liveness, lnid_atv);
                 continue;
 
             default: /* other */
@@ -640,6 +881,11 @@ static void compute_function_liveness_and_next_use(unsigned fn)
         } /* instructions */
     } /* basic blocks */
 
+    if (opt_level)
+        pin_cross_block_temps(fn);
+    bset_free(operand_liveness);
+    bset_free(operand_next_use);
+
 #if DEBUG
     print_liveness_and_next_use(fn);
 #endif
@@ -751,15 +997,14 @@ void print_liveness_and_next_use(unsigned fn)
 }
 #endif
 
-void compute_liveness_and_next_use(void)
+/*
+ * Compute the LiveOut sets of function fn and annotate its quads.
+ * The sets remain available until dflow_free_LiveOut(fn).
+ */
+void compute_liveness_and_next_use(unsigned fn)
 {
-    int i;
-
-    liveness_and_next_use = calloc(ic_instructions_counter, sizeof(unsigned char));
-    operand_liveness = bset_new(nid_counter);
-    operand_next_use = bset_new(nid_counter);
-    for (i = 0; i < cg_nodes_counter; i++)
-        compute_function_liveness_and_next_use(i);
-    bset_free(operand_liveness);
-    bset_free(operand_next_use);
+    if (liveness_and_next_use == NULL)
+        liveness_and_next_use = calloc(ic_instructions_counter, sizeof(unsigned char));
+    dflow_LiveOut(fn);
+    compute_function_liveness_and_next_use(fn);
 }
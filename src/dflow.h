@@ -1,12 +1,20 @@
 #ifndef DFLOW_H_
 #define DFLOW_H_
 
+extern int *nid2lnid;
+#define lnid(nid)   (nid2lnid[nid])
+void dflow_enter_function(unsigned fn);
+void dflow_exit_function(unsigned fn);
+
 void dflow_Dom(unsigned fn);
+void dflow_free_Dom(unsigned fn);
 void dflow_LiveOut(unsigned fn);
-// void dflow_ReachIn(unsigned fn, int is_last);
+void dflow_free_LiveOut(unsigned fn);
+void dflow_ReachIn(unsigned fn);
+void dflow_free_ReachIn(unsigned fn);
 
 extern unsigned char *liveness_and_next_use;
-void compute_liveness_and_next_use(void);
+void compute_liveness_and_next_use(unsigned fn);
 
 #define TAR_LIVE_MASK   0x01
 #define AR1_LIVE_MASK   0x02
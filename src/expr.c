@@ -1999,18 +1999,8 @@ unsigned get_sizeof(Declaration *ty)
 
     cat = get_type_category(ty);
     switch (cat) {
-    case TOK_UNION: {
-        StructMember *sm;
-        StructDescriptor *sd;
-
-        sd = lookup_struct_descriptor(get_type_spec(ty->decl_specs)->str);
-        for (sm = sd->members; sm != NULL; sm = sm->next)
-            if (sm->size > size)
-                size = sm->size;
-        size = round_up(size, sd->alignment);
-        break;
-    }
     case TOK_STRUCT:
+    case TOK_UNION:
         size = lookup_struct_descriptor(get_type_spec(ty->decl_specs)->str)->size;
         break;
     case TOK_SUBSCRIPT:
@@ -15,6 +15,8 @@
 #include "imp_lim.h"
 #include "loc.h"
 #include "dflow.h"
+#include "opt.h"
+#include "loop.h"
 #include "util/bset.h"
 #include "ast2c.h"
 #include "luxcc.h"
@@ -53,7 +55,7 @@ CGNode *cg_nodes;
 static int label_counter, label_max;
 static unsigned *lab2instr;
 static unsigned true_addr, false_addr;
-static unsigned memset_addr, memcpy_addr;
+unsigned memset_addr, memcpy_addr;
 static ExecNode memset_node, memcpy_node;
 static TypeExp int_expr = { TOK_INT };
 static Declaration int_ty = { &int_expr };
@@ -157,14 +159,14 @@ int get_var_nid(char *sid, int scope)
     return np->nid;
 }
 
-static void edge_init(GraphEdge *p, unsigned max)
+void edge_init(GraphEdge *p, unsigned max)
 {
     p->edges = calloc(max, sizeof(unsigned));
     p->max = max;
     p->n = 0;
 }
 
-static void edge_free(GraphEdge *p)
+void edge_free(GraphEdge *p)
 {
     free(p->edges);
 }
@@ -242,7 +244,7 @@ static void new_cfg_node(unsigned leader)
     ++cfg_nodes_counter;
 }
 
-static void emit_i(OpKind op, Declaration *type, unsigned tar, unsigned arg1, unsigned arg2)
+void emit_i(OpKind op, Declaration *type, unsigned tar, unsigned arg1, unsigned arg2)
 {
     if (ic_instructions_counter >= ic_instructions_max) {
         void *p;
@@ -275,7 +277,7 @@ static void emit_src(char *s)
     C_source[ic_instructions_counter] = s;
 }
 
-static unsigned new_address(AddrKind kind)
+unsigned new_address(AddrKind kind)
 {
     if (ic_addresses_counter >= ic_addresses_max) {
         Address *p;
@@ -292,7 +294,7 @@ static unsigned new_address(AddrKind kind)
     return ic_addresses_counter++;
 }
 
-static unsigned new_temp_addr(void)
+unsigned new_temp_addr(void)
 {
     unsigned n;
     char s[10], *p;
@@ -421,6 +423,28 @@ static void ic_reset(void)
     base_node = NULL;
 }
 
+/*
+ * Release the per-function data of fn that the back-end no longer needs once
+ * the function has been emitted: its data-flow sets and local numbering, and
+ * the edges of its CFG. The quads stay (they are indexed TU-wide).
+ */
+void ic_free_function(unsigned fn)
+{
+    unsigned b;
+
+    if (cg_node_is_empty(fn))
+        return;
+
+    dflow_free_LiveOut(fn);
+    dflow_exit_function(fn);
+    for (b = cg_node(fn).bb_i; b <= cg_node(fn).bb_f; b++) {
+        edge_free(&cfg_node(b).out);
+        edge_free(&cfg_node(b).in);
+        memset(&cfg_node(b).out, 0, sizeof(GraphEdge));
+        memset(&cfg_node(b).in, 0, sizeof(GraphEdge));
+    }
+}
+
 #if 0
 static void ic_free_all(void)
 {
@@ -431,9 +455,6 @@ static void ic_free_all(void)
     for (i = 1; i < cfg_nodes_counter; i++) {
         edge_free(&cfg_node(i).out);
         edge_free(&cfg_node(i).in);
-        bset_free(cfg_node(i).UEVar);
-        bset_free(cfg_node(i).VarKill);
-        bset_free(cfg_node(i).LiveOut);
         bset_free(cfg_node(i).Dom);
     }
     free(cfg_nodes);
@@ -616,9 +637,9 @@ static void ic_simplify(void)
                 }
             } else if (is_iconst(arg2)) {
                 if (address(arg2).cont.val == 0) {
+                    /* arg1 may be used by other quads: don't change it */
                     instruction(i).op = OpAsn;
-                    address(arg1).kind = IConstKind;
-                    address(arg1).cont.val = 0;
+                    instruction(i).arg1 = arg2;
                 } else if (address(arg2).cont.val == 1) {
                     instruction(i).op = OpAsn;
                 } else if (address(arg2).cont.val == -1) {
@@ -670,8 +691,8 @@ static void ic_simplify(void)
             } else if (is_iconst(arg2)) {
                 if (address(arg2).cont.val==1) {
                     instruction(i).op = OpAsn;
-                    address(arg1).kind = IConstKind;
-                    address(arg1).cont.val = 0;
+                    instruction(i).arg1 = new_address(IConstKind);
+                    address(instruction(i).arg1).cont.val = 0;
                 } else if (is_po2(address(arg2).cont.uval)
                 && is_unsigned_int(get_type_category(instruction(i).type))) {
                     instruction(i).op = OpAnd;
@@ -792,7 +813,7 @@ static void ic_simplify(void)
             if (is_iconst(arg1) && is_iconst(arg2)) {
                 instruction(i).op = OpAsn;
                 address(arg1).kind = IConstKind;
-                if ((long)instruction(i).op & IC_SIGNED)
+                if ((long)instruction(i).type & IC_SIGNED)
                     address(arg1).cont.val = address(arg1).cont.val>address(arg2).cont.val;
                 else
                     address(arg1).cont.val = address(arg1).cont.uval>address(arg2).cont.uval;
@@ -803,7 +824,7 @@ static void ic_simplify(void)
             if (is_iconst(arg1) && is_iconst(arg2)) {
                 instruction(i).op = OpAsn;
                 address(arg1).kind = IConstKind;
-                if ((long)instruction(i).op & IC_SIGNED)
+                if ((long)instruction(i).type & IC_SIGNED)
                     address(arg1).cont.val = address(arg1).cont.val>=address(arg2).cont.val;
                 else
                     address(arg1).cont.val = address(arg1).cont.uval>=address(arg2).cont.uval;
@@ -1111,7 +1132,7 @@ static void number_subCG(unsigned n)
     ++pocount;
 }
 
-static void number_CG(void)
+void number_CG(void)
 {
     unsigned n, n2;
 
@@ -1354,6 +1375,97 @@ static void build_CFG(void)
     number_CFG();
 }
 
+/*                              */
+/* Rewriting of function bodies */
+/*                              */
+
+/*
+ * The passes that transform a function after its CFG was built (inlining,
+ * loop optimizations) append a new version of its quads to the instruction
+ * buffer and call replace_function_body() to make it the current one. The
+ * old quads and CFG nodes are not referenced anymore.
+ */
+
+int frame_area;                         /* local area of the function being rewritten */
+
+int is_atv(int nid)
+{
+    int i;
+
+    for (i = 0; i < atv_counter; i++)
+        if (atv_table[i] == nid)
+            return TRUE;
+    return FALSE;
+}
+
+/*
+ * Make a new automatic variable in frame_area like the variable 'a',
+ * but with type 'ty' (if not NULL).
+ */
+unsigned new_frame_var(unsigned a, Declaration *ty)
+{
+    int nid;
+    unsigned na;
+    ExecNode *e;
+
+    e = new_exec_node();
+    *e = *address(a).cont.var.e;
+    e->attr.var.is_param = FALSE;
+    if (ty != NULL)
+        e->type = *ty;
+    frame_area = round_up(frame_area-(int)get_sizeof(&e->type), get_alignment(&e->type));
+
+    nid = address_nid(a);
+    na = new_address(IdKind);
+    address(na).cont.var.e = e;
+    address(na).cont.var.offset = frame_area;
+    address(na).cont.nid = nid_counter;
+    if (is_atv(nid))
+        new_atv(nid_counter);
+    new_nid(nid2sid_tab[nid]);
+    return na;
+}
+
+/* return the number of labels used by the quads first..last */
+unsigned count_labels(unsigned first, unsigned last)
+{
+    unsigned i, n;
+
+    for (n = 0, i = first; i <= last; i++)
+        if (instruction(i).op==OpLab && address(instruction(i).tar).cont.val>=n)
+            n = (unsigned)address(instruction(i).tar).cont.val+1;
+    return n;
+}
+
+/*
+ * Make the quads from 'new_first' to the end of the instruction buffer
+ * the body of function 'fn' and rebuild its CFG. 'nlabels' is the number
+ * of labels used by the new body.
+ */
+void replace_function_body(unsigned fn, unsigned new_first, unsigned nlabels)
+{
+    unsigned i;
+
+    if (nlabels > label_max) {
+        unsigned *p;
+
+        label_max = nlabels;
+        if ((p=realloc(lab2instr, label_max*sizeof(unsigned))) == NULL)
+            ic_out_of_memory("replace_function_body");
+        lab2instr = p;
+    }
+    for (i = new_first; i < ic_instructions_counter; i++)
+        if (instruction(i).op == OpLab)
+            lab2instr[address(instruction(i).tar).cont.val] = i;
+    for (i = cg_node(fn).bb_i; i <= cg_node(fn).bb_f; i++) {
+        edge_free(&cfg_node(i).out);
+        edge_free(&cfg_node(i).in);
+    }
+    ic_func_first_instr = new_first;
+    curr_cg_node = fn;
+    build_CFG();
+}
+
 /*            */
 /* Statements */
 /*            */
@@ -2050,6 +2162,20 @@ void ic_zero(unsigned id, unsigned offset, unsigned nb)
         address(a1).cont.uval = nb;
         emit_i(OpArg, &unsigned_ty, 0, a1, 0);
     } else {
+        unsigned a4;
+
+        /* arg #1 (computed first so the OpArgs go in a row) */
+        a4 = new_temp_addr();
+        emit_i(OpAddrOf, NULL, a4, id, 0);
+        if (offset > 0) {
+            unsigned a2, a3;
+
+            a2 = new_address(IConstKind);
+            address(a2).cont.uval = offset;
+            a3 = new_temp_addr();
+            emit_i(OpAdd, &long_ty, a3, a4, a2);
+            a4 = a3;
+        }
         /* arg #3 */
         a1 = new_address(IConstKind);
         address(a1).cont.uval = nb;
@@ -2059,18 +2185,7 @@ void ic_zero(unsigned id, unsigned offset, unsigned nb)
         address(a1).cont.uval = 0;
         emit_i(OpArg, &int_ty, 0, a1, 0);
         /* arg #1 */
-        a1 = new_temp_addr();
-        emit_i(OpAddrOf, NULL, a1, id, 0);
-        if (offset > 0) {
-            unsigned a2, a3;
-
-            a2 = new_address(IConstKind);
-            address(a2).cont.uval = offset;
-            a3 = new_temp_addr();
-            emit_i(OpAdd, &long_ty, a3, a1, a2);
-            a1 = a3;
-        }
-        emit_i(OpArg, &int_ty, 0, a1, 0);
+        emit_i(OpArg, &int_ty, 0, a4, 0);
     }
     /* do the call */
     a1 = new_address(IConstKind);
@@ -2128,22 +2243,25 @@ void ic_auto_init(TypeExp *ds, TypeExp *dct, ExecNode *e, unsigned id, unsigned
                 emit_i(OpArg, &int_ty, 0, a2, 0);
                 emit_i(OpArg, &int_ty, 0, a1, 0);
             } else {
-                emit_i(OpArg, &int_ty, 0, a1, 0);
-                a1 = new_address(StrLitKind);
-                address(a1).cont.str = e->attr.str;
-                emit_i(OpArg, &int_ty, 0, a1, 0);
-                a1 = new_temp_addr();
-                emit_i(OpAddrOf, NULL, a1, id, 0);
+                unsigned a2;
+
+                /* arg #1 (computed first so the OpArgs go in a row) */
+                a2 = new_temp_addr();
+                emit_i(OpAddrOf, NULL, a2, id, 0);
                 if (offset > 0) {
-                    unsigned a2, a3;
+                    unsigned a3, a4;
 
-                    a2 = new_address(IConstKind);
-                    address(a2).cont.uval = offset;
-                    a3 = new_temp_addr();
-                    emit_i(OpAdd, &long_ty, a3, a1, a2);
-                    a1 = a3;
+                    a3 = new_address(IConstKind);
+                    address(a3).cont.uval = offset;
+                    a4 = new_temp_addr();
+                    emit_i(OpAdd, &long_ty, a4, a2, a3);
+                    a2 = a4;
                 }
                 emit_i(OpArg, &int_ty, 0, a1, 0);
+                a1 = new_address(StrLitKind);
+                address(a1).cont.str = e->attr.str;
+                emit_i(OpArg, &int_ty, 0, a1, 0);
+                emit_i(OpArg, &int_ty, 0, a2, 0);
             }
             a1 = new_address(IConstKind);
             address(a1).cont.val = 3;
@@ -2579,6 +2697,79 @@ static int function_argument(ExecNode *arg, DeclList *param)
     return n;
 }
 
+/*
+ * Return TRUE if the function called by 'e' is designated by its name.
+ */
+static int is_direct_call(ExecNode *e)
+{
+    ExecNode *tmp;
+
+    tmp = e->child[0];
+    while (tmp->kind.exp==OpExp /*&& tmp->attr.op==TOK_STAR*/)
+         tmp = tmp->child[0];
+    return (tmp->kind.exp==IdExp && get_type_category(&tmp->type)==TOK_FUNCTION);
+}
+
+/*
+ * Compute the arguments from right to left without emitting the OpArgs.
+ * Their addresses and types are left in 'ca' (one entry per argument,
+ * left to right). Return the number of arguments computed.
+ *
+ * A scalar variable is copied to a temporary when it is computed, so that
+ * it is read where it would be if its OpArg followed it (the arguments not
+ * yet computed can have side effects on it). 'last' is TRUE if nothing is
+ * computed between the first argument and the call.
+ */
+static int compute_arguments(ExecNode *arg, DeclList *param, ComputedArg *ca, int last)
+{
+    int n;
+    Token cat;
+
+    if (arg == NULL)
+        return 0;
+
+    n = 1;
+    if (param->decl->idl==NULL || param->decl->idl->op!=TOK_ELLIPSIS) {
+        /* this argument matches a declared (non-optional) parameter */
+
+        Declaration *ty;
+
+        n += compute_arguments(arg->sibling, param->next, ca+1, FALSE);
+        ty = param->decl;
+        if (ty->idl!=NULL && ty->idl->op==TOK_ID) { /* skip identifier */
+            ty = new_declaration_node();
+            ty->decl_specs = param->decl->decl_specs;
+            ty->idl = param->decl->idl->child;
+        }
+        ca->ty = ty;
+        ca->addr = ic_expr_convert(arg, ty);
+    } else {
+        /* this and the arguments that follow match the `...' */
+
+        n += compute_arguments(arg->sibling, param, ca+1, FALSE);
+        ca->ty = &arg->type;
+        ca->addr = ic_expression(arg, FALSE, NOLAB, NOLAB);
+    }
+    if (!last && address(ca->addr).kind==IdKind
+    && (cat=get_type_category(ca->ty))!=TOK_STRUCT && cat!=TOK_UNION) {
+        OpKind op;
+        unsigned t;
+
+        /* chars and shorts are extended as a load from memory would do */
+        switch (cat) {
+        case TOK_CHAR: case TOK_SIGNED_CHAR: op = OpCh;  break;
+        case TOK_UNSIGNED_CHAR:              op = OpUCh; break;
+        case TOK_SHORT:                      op = OpSh;  break;
+        case TOK_UNSIGNED_SHORT:             op = OpUSh; break;
+        default:                             op = OpAsn; break;
+        }
+        t = new_temp_addr();
+        emit_i(op, ca->ty, t, ca->addr, 0);
+        ca->addr = t;
+    }
+    return n;
+}
+
 static int is_wideval(Token cat)
 {
     if (targeting_arch64) {
@@ -3205,11 +3396,12 @@ unsigned ic_expression(ExecNode *e, int is_addr, unsigned true_lab, unsigned fal
         }
 
         case TOK_FUNCTION: {
-            int na;
+            int na, k;
             OpKind op;
             ExecNode *tmp;
             unsigned a1, a2;
             DeclList *p;
+            ComputedArg *ca;
 
             cg_node(curr_cg_node).is_leaf = FALSE;
             emit_i(OpBegArg, NULL, 0, 0, 0);
@@ -3227,6 +3419,22 @@ unsigned ic_expression(ExecNode *e, int is_addr, unsigned true_lab, unsigned fal
                     }
                 }
                 na += aligned_function_argument(e->child[1], e->locals);
+            } else if (target_arch == ARCH_X64) {
+                /*
+                 * Compute everything (the function designator included) before
+                 * emitting the OpArgs, so nothing gets between the OpArgs and
+                 * the call. The x64 code generator relies on this to load the
+                 * register arguments straight into their registers at the call.
+                 */
+                for (na = 0, tmp = e->child[1]; tmp != NULL; tmp = tmp->sibling)
+                    ++na;
+                ca = malloc(na*sizeof(ComputedArg)); /* not used if na is 0 */
+                compute_arguments(e->child[1], e->locals, ca, is_direct_call(e));
+                if (!is_direct_call(e))
+                    a1 = ic_expression(e->child[0], FALSE, NOLAB, NOLAB);
+                for (k = na-1; k >= 0; k--)
+                    emit_i(OpArg, ca[k].ty, 0, ca[k].addr, 0);
+                free(ca);
             } else {
                 na = function_argument(e->child[1], e->locals);
             }
@@ -3247,12 +3455,12 @@ unsigned ic_expression(ExecNode *e, int is_addr, unsigned true_lab, unsigned fal
                 }
             }
 
-            tmp = e->child[0];
-            while (tmp->kind.exp==OpExp /*&& tmp->attr.op==TOK_STAR*/)
-                 tmp = tmp->child[0];
-            if (tmp->kind.exp==IdExp && get_type_category(&tmp->type)==TOK_FUNCTION) {
+            if (is_direct_call(e)) {
                 unsigned tar_fn;
 
+                tmp = e->child[0];
+                while (tmp->kind.exp == OpExp)
+                     tmp = tmp->child[0];
                 op = OpCall;
                 a1 = new_address(IdKind);
                 address(a1).cont.var.e = tmp;
@@ -3262,7 +3470,8 @@ unsigned ic_expression(ExecNode *e, int is_addr, unsigned true_lab, unsigned fal
                 edge_add(&cg_node(curr_cg_node).out, tar_fn);
             } else {
                 op = OpIndCall;
-                a1 = ic_expression(e->child[0], FALSE, NOLAB, NOLAB);
+                if (target_arch != ARCH_X64)
+                    a1 = ic_expression(e->child[0], FALSE, NOLAB, NOLAB);
             }
             if (get_type_category(&e->type) != TOK_VOID) {
                 unsigned a3;
@@ -3492,8 +3701,15 @@ void ic_main(ExternId ***func_def_list, ExternId ***ext_sym_list)
     ExternId *ed;
     unsigned i, j;
 
-    *func_def_list = calloc(1, sizeof(ExternId *)*512);
-    *ext_sym_list  = calloc(1, sizeof(ExternId *)*512);
+    /* both lists are NULL terminated */
+    for (ed=get_external_declarations(), i=j=1; ed != NULL; ed = ed->next) {
+        if (ed->status == REFERENCED)
+            ++j;
+        else if (ed->declarator->child!=NULL && ed->declarator->child->op==TOK_FUNCTION)
+            ++i;
+    }
+    *func_def_list = calloc(i, sizeof(ExternId *));
+    *ext_sym_list  = calloc(j, sizeof(ExternId *));
 
     for (ed=get_external_declarations(), i=j=0; ed != NULL; ed = ed->next) {
         TypeExp *scs;
@@ -3530,6 +3746,10 @@ void ic_main(ExternId ***func_def_list, ExternId ***ext_sym_list)
         return;
 
     ic_find_atv();
+    if (opt_level >= 3) {
+        opt_inline_functions(*func_def_list);
+        loop_main();
+    }
     address_taken_variables = bset_new(nid_counter);
     for (i = 0; i < atv_counter; i++)
         bset_insert(address_taken_variables, atv_table[i]);
@@ -3541,7 +3761,8 @@ void ic_main(ExternId ***func_def_list, ExternId ***ext_sym_list)
      * correctly.
      */
     number_CG();
-    // opt_main();
+    if (opt_level)
+        opt_main();
     for (i = 0; i < cg_nodes_counter; i++) {
         if (ic_outpath!=NULL && equal(cg_node(i).func_id, ic_function_to_print)) {
             ic_file = fopen(ic_outpath, "wb");
@@ -3553,9 +3774,6 @@ void ic_main(ExternId ***func_def_list, ExternId ***ext_sym_list)
             print_CFG(i);
             fclose(cfg_dotfile);
         }
-        /*dflow_Dom(i);*/
-        dflow_LiveOut(i);
-        // dflow_ReachIn(i, i == cg_nodes_counter-1);
     }
     if (cg_outpath != NULL) {
         cg_dotfile = fopen(cg_outpath, "wb");
@@ -103,6 +103,7 @@ extern char **nid2sid_tab;
 #define address_nid(a)   (address(a).cont.nid)
 #define address_sid(a)   (nid2sid_tab[address_nid(a)])
 #define const_addr(a)    (address(a).kind==IConstKind || address(a).kind==StrLitKind)
+unsigned new_address(AddrKind kind);
 
 /*
  * Instructions
@@ -145,13 +146,11 @@ struct CFGNode { /* CFG node == basic block */
     BSet *UEVar;        /* upward-exposed variables in the block */
     BSet *VarKill;      /* variables defined/killed in the block */
     BSet *LiveOut;      /* variables live on exit from the block */
-    BSet *Dom;          /* blocks that dominate this block */
+    BSet *Dom;          /* blocks that dominate this block (numbered from the first block of the function) */
+    BSet *DEDef;        /* downward-exposed definitions */
+    BSet *DefKill;      /* all definition points obscured by this block */
+    BSet *ReachIn;      /* definitions that reach this block */
     unsigned PO, RPO;   /* post-order & reverse post-order numbers */
-#if 0
-    BSet *DEDef;    /* downward-exposed definitions */
-    BSet *DefKill;  /* all definition points obscured by this block */
-    BSet *ReachIn;  /* definitions that reach this block */
-#endif
 };
 extern CFGNode *cfg_nodes;
 extern unsigned cfg_nodes_counter;
@@ -168,6 +167,8 @@ struct CGNode { /* CG node == function */
     unsigned size_of_local_area;
     unsigned PO, RPO;
     int is_leaf;
+    int *lnid2nid;      /* nids that appear in the function, indexed by local nid */
+    unsigned nlnid;
     /*ParamNid *pn;*/
 };
 extern CGNode *cg_nodes;
@@ -184,6 +185,22 @@ int get_var_nid(char *sid, int scope);
 extern ExternId *static_objects_list;
 extern BSet *address_taken_variables;
 
+/*
+ * Rewriting of function bodies
+ */
+extern unsigned memset_addr, memcpy_addr;
+extern int frame_area;
+void emit_i(OpKind op, Declaration *type, unsigned tar, unsigned arg1, unsigned arg2);
+unsigned new_temp_addr(void);
+unsigned new_frame_var(unsigned a, Declaration *ty);
+int is_atv(int nid);
+unsigned count_labels(unsigned first, unsigned last);
+void replace_function_body(unsigned fn, unsigned new_first, unsigned nlabels);
+void edge_init(GraphEdge *p, unsigned max);
+void edge_free(GraphEdge *p);
+void number_CG(void);
+
 void ic_main(ExternId ***func_def_list, ExternId ***ext_sym_list);
+void ic_free_function(unsigned fn);
 
 #endif
@@ -10,5 +10,6 @@
 #define MAX_LOG_LINE_LEN    4095
 #define MAX_CASE_LABELS     1024 /* for a single switch statement */
 #define MAX_GOTOS_PER_FUNC  64
+#define MAX_IF_NEST         64   /* maximum nesting level of conditional inclusion directives */
 
 #endif
@@ -5,13 +5,16 @@
 #include <stdlib.h>
 #include <assert.h>
 #include "util/util.h"
+#include "util/atom.h"
 #include "error.h"
 #include "util/arena.h"
 #include "luxcc.h"
 
-extern Arena *pre_node_arena;
-
 static PreTokenNode *pre_tok; /* declared global so ERROR can access it */
+static PreTokenNode *pre_tok_ahead; /* token read ahead looking for adjacent strings */
+static TokenNode *free_tokens; /* recycled nodes */
+static char *str_buf; /* used to convert and concatenate string literals */
+static unsigned str_buf_size;
 Arena *lexer_node_arena;
 static Arena *lexer_str_arena;
 
@@ -154,7 +157,7 @@ const char *token_table[] = {
 static const struct Keyword {
     char *str;
     Token tok;
-} keywords_table[] = { /* sorted for bsearch() */
+} keywords_table[] = {
     {"__alignof__", TOK_ALIGNOF},
     {"__asm", TOK_ASM},
     {"__builtin_va_start", TOK_BUILTIN_VA_START},
@@ -196,30 +199,10 @@ static const struct Keyword {
     {"while", TOK_WHILE}
 };
 
-static int cmp_kw(const void *p1, const void *p2)
-{
-   struct Keyword *x1 = (struct Keyword *)p1;
-   struct Keyword *x2 = (struct Keyword *)p2;
-
-   return strcmp(x1->str, x2->str);
-}
-
-static Token lookup_id(char *s)
-{
-    struct Keyword key, *res;
-
-    key.str = s;
-    res = bsearch(&key, keywords_table, NELEMS(keywords_table), sizeof(keywords_table[0]), cmp_kw);
-    if (res == NULL)
-        return TOK_ID;
-    else
-        return res->tok;
-}
-
 static const struct Punctuator {
     char *str;
     Token tok;
-} punctuators_table[] = { /* sorted for bsearch() */
+} punctuators_table[] = {
     {"!", TOK_NEGATION},
     {"!=", TOK_NEQ},
     {"%", TOK_REM},
@@ -268,12 +251,25 @@ static const struct Punctuator {
     {"~", TOK_COMPLEMENT},
 };
 
-static int cmp_punct(const void *p1, const void *p2)
+/*
+ * Keywords and punctuators are recognized by the tags of their atoms.
+ * The tag is the token plus one (identifiers keep the zero tag).
+ */
+static void tag_atoms(void)
 {
-   struct Punctuator *x1 = (struct Punctuator *)p1;
-   struct Punctuator *x2 = (struct Punctuator *)p2;
+    unsigned i;
 
-   return strcmp(x1->str, x2->str);
+    for (i = 0; i < NELEMS(keywords_table); i++)
+        atom_set_tag(atom(keywords_table[i].str), keywords_table[i].tok+1);
+    for (i = 0; i < NELEMS(punctuators_table); i++)
+        atom_set_tag(atom(punctuators_table[i].str), punctuators_table[i].tok+1);
+}
+
+static Token lookup_token(char *s)
+{
+    int tag;
+
+    return ((tag=atom_tag(s)) != 0) ? (Token)(tag-1) : TOK_ID;
 }
 
 static int isodigit(int c)
@@ -339,19 +335,25 @@ static int get_esc_seq_val(char **c)
     }
 }
 
-/* convert escape sequences embedded in a string literal */
-static void convert_string(char *s)
+/*
+ * Convert the escape sequences embedded in the string literal `s' and
+ * append the result (without the quotes) at position `pos' of `str_buf'.
+ * Return the length of the string in `str_buf'. `s' is not modified.
+ */
+static unsigned convert_string(char *s, unsigned pos)
 {
     unsigned slen;
-    char *src, *dest;
+    char *src, *end, *dest;
 
-    /* remove "" */
     slen = strlen(s);
-    memmove(s, s+1, slen-1);
-    s[slen-2] = '\0';
-
-    src = dest = s;
-    while (*src != '\0') {
+    if (pos+slen > str_buf_size) {
+        str_buf_size = (pos+slen)*2;
+        str_buf = realloc(str_buf, str_buf_size);
+    }
+    src = s+1; /* skip " */
+    end = s+slen-1;
+    dest = str_buf+pos;
+    while (src < end) {
         if (*src == '\\') {
             ++src; /* skip \ */
             *dest++ = (char)get_esc_seq_val(&src);
@@ -359,7 +361,8 @@ static void convert_string(char *s)
             *dest++ = *src++;
         }
     }
-    *dest = *src; /* copy '\0' */
+    *dest = '\0';
+    return pos+strlen(str_buf+pos);
 }
 
 static Token get_iconst_kind(char *ic)
@@ -515,56 +518,75 @@ static TokenNode *new_token(Token token, PreTokenNode *ptok)
 {
     TokenNode *temp;
 
-    temp = arena_alloc(lexer_node_arena, sizeof(TokenNode));
+    if (free_tokens != NULL) {
+        temp = free_tokens;
+        free_tokens = free_tokens->next;
+    } else {
+        temp = arena_alloc(lexer_node_arena, sizeof(TokenNode));
+    }
     temp->token = token;
     temp->lexeme = ptok->lexeme;
     temp->src_line = ptok->src_line;
     temp->src_column = ptok->src_column;
     temp->src_file = ptok->src_file;
+    temp->in_ast = FALSE;
     temp->next = NULL;
     ++stat_number_of_c_tokens;
     return temp;
 }
 
+/* return a token the parser is done with to the free list */
+void free_c_token(TokenNode *t)
+{
+    t->next = free_tokens;
+    free_tokens = t;
+}
+
+/* get the next preprocessing token not deleted during preprocessing */
+static PreTokenNode *next_pre_token(void)
+{
+    PreTokenNode *p;
+
+    if ((p=pre_tok_ahead) != NULL) {
+        pre_tok_ahead = NULL;
+        return p;
+    }
+    while ((p=get_pre_token())->deleted)
+        free_pre_token(p);
+    return p;
+}
+
 /*
- * Take a sequence of preprocessing tokens and convert it in a sequence
- * of C tokens (roughly translation phases 5, 6, and part of 7 of the
- * standard).
+ * Return the next C token of the translation unit (roughly translation
+ * phases 5, 6, and part of 7 of the standard). The preprocessing tokens
+ * are requested as they are needed and recycled once they were converted.
  */
-TokenNode *tokenize(PreTokenNode *pre_token_list)
+TokenNode *get_c_token(void)
 {
-    TokenNode *first, *tok;
-
-    lexer_node_arena = arena_new(stat_number_of_pre_tokens*sizeof(TokenNode), FALSE);
-    lexer_str_arena = arena_new(1024, FALSE);
+    TokenNode *tok;
 
-    pre_tok = pre_token_list;
-    first = tok = malloc(sizeof(TokenNode)); /* dummy node, it's removed before return */
-    while (pre_tok != NULL) {
-        if (pre_tok->deleted) {
-            pre_tok = pre_tok->next;
-            continue;
-        }
+    if (lexer_node_arena == NULL) {
+        lexer_node_arena = arena_new(sizeof(TokenNode)*128, FALSE);
+        lexer_str_arena = arena_new(1024, FALSE);
+        tag_atoms();
+    }
 
+    for (;;) {
+        pre_tok = next_pre_token();
         switch (pre_tok->token) {
         case PRE_TOK_EOF:
-            tok->next = new_token(TOK_EOF, pre_tok);
-            break;
-        case PRE_TOK_PUNCTUATOR: {
-            struct Punctuator key, *res;
-
-            key.str = pre_tok->lexeme;
-            res = bsearch(&key, punctuators_table, NELEMS(punctuators_table), sizeof(punctuators_table[0]), cmp_punct);
-            assert(res != NULL);
-            tok->next = new_token(res->tok, pre_tok);
+            /* the EOF token is kept by the preprocessor */
+            return new_token(TOK_EOF, pre_tok);
+        case PRE_TOK_PUNCTUATOR:
+            assert(atom_tag(pre_tok->lexeme) != 0);
+            tok = new_token(lookup_token(pre_tok->lexeme), pre_tok);
             break;
-        }
         case PRE_TOK_NUM:
-            tok->next = new_token(get_iconst_kind(pre_tok->lexeme), pre_tok);
+            tok = new_token(get_iconst_kind(pre_tok->lexeme), pre_tok);
             break;
         case PRE_TOK_ID:
-            tok->next = new_token(TOK_ID, pre_tok);
-            tok->next->token = lookup_id(pre_tok->lexeme);
+            tok = new_token(TOK_ID, pre_tok);
+            tok->token = lookup_token(pre_tok->lexeme);
             break;
         case PRE_TOK_CHACON: {
             char buf[16], *p;
@@ -584,52 +606,30 @@ TokenNode *tokenize(PreTokenNode *pre_token_list)
                     ++p;
                 }
             }
-            tok->next = new_token(TOK_ICONST_D, pre_tok);
-            tok->next->lexeme = arena_alloc(lexer_str_arena, strlen(buf)+1); /* replace prev lexeme */
-            strcpy(tok->next->lexeme, buf);
+            tok = new_token(TOK_ICONST_D, pre_tok);
+            tok->lexeme = arena_alloc(lexer_str_arena, strlen(buf)+1); /* replace prev lexeme */
+            strcpy(tok->lexeme, buf);
         }
             break;
         case PRE_TOK_STRLIT: {
+            unsigned len;
             PreTokenNode *p;
 
-            tok->next = new_token(TOK_STRLIT, pre_tok);
+            tok = new_token(TOK_STRLIT, pre_tok);
+            len = convert_string(pre_tok->lexeme, 0);
 
             /*
              * Concatenate any adjacent strings.
              */
-            p = pre_tok->next;
-            while (p!=NULL && p->deleted)
-                p = p->next;
-            if (p!=NULL && p->token==PRE_TOK_STRLIT) {
-                int new_len;
-
-                /* get length of concatenated strings */
-                new_len = 0, p = pre_tok;
-                while (p!=NULL && (p->deleted || p->token==PRE_TOK_STRLIT)) {
-                    if (p->token == PRE_TOK_STRLIT) {
-                        convert_string(p->lexeme);
-                        new_len += strlen(p->lexeme);
-                    }
-                    p = p->next;
-                }
-                ++new_len; /* make room for '\0' */
-
-                /* allocate all at one time */
-                tok->next->lexeme = arena_alloc(lexer_str_arena, new_len);
-                tok->next->lexeme[0] = '\0';
-
-                /* copy the strings to the buffer (pre_tok is
-                   left pointing to the last string concatenated) */
-                new_len = 0, p = pre_tok;
-                while (p!=NULL && (p->deleted || p->token==PRE_TOK_STRLIT)) {
-                    if (p->token == PRE_TOK_STRLIT)
-                        strcat(tok->next->lexeme, p->lexeme);
-                    pre_tok = p;
-                    p = p->next;
-                }
-            } else { /* no adjacent string */
-                convert_string(tok->next->lexeme);
+            while ((p=next_pre_token())->token == PRE_TOK_STRLIT) {
+                free_pre_token(pre_tok);
+                pre_tok = p;
+                len = convert_string(p->lexeme, len);
             }
+            tok->lexeme = arena_alloc(lexer_str_arena, len+1);
+            memcpy(tok->lexeme, str_buf, len+1);
+            /* the token that follows is returned by the next call */
+            pre_tok_ahead = p;
             break;
         }
         case PRE_TOK_NL:
@@ -644,15 +644,10 @@ TokenNode *tokenize(PreTokenNode *pre_token_list)
                 WARNING("stray `%c' found; ignoring...", *pre_tok->lexeme);
             else
                 WARNING("stray `0x%02x' found; ignoring...", *pre_tok->lexeme);
-            pre_tok = pre_tok->next;
+            free_pre_token(pre_tok);
             continue;
         }
-        pre_tok = pre_tok->next;
-        tok = tok->next;
+        free_pre_token(pre_tok);
+        return tok;
     }
-    tok = first->next;
-    free(first); /* delete dummy node */
-    arena_destroy(pre_node_arena);
-
-    return tok;
 }
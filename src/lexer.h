@@ -165,12 +165,14 @@ struct TokenNode {
     Token token;
     char *lexeme, *src_file;
     int src_line, src_column;
+    char in_ast; /* TRUE if referenced by an AST node (it's not recycled) */
     TokenNode *next;
 };
 
 extern const char *token_table[];
 #define tok2lex(tok) (token_table[tok*2+1])
 
-TokenNode *tokenize(PreTokenNode *pre_token_list);
+TokenNode *get_c_token(void);
+void free_c_token(TokenNode *t);
 
 #endif
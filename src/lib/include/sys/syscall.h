@@ -24,6 +24,8 @@
 #define SYS_stat64  195
 #define SYS_stat    SYS_stat64
 #define SYS_utimes  271
+#define SYS_mmap    90  /* old_mmap(): takes a pointer to the six arguments */
+#define SYS_munmap  91
 #elif defined __x86_64__
 #define SYS_exit    60
 #define SYS_fork    57
@@ -47,6 +49,8 @@
 #define SYS_ioctl   16
 #define SYS_stat    4
 #define SYS_utimes  235
+#define SYS_mmap    9
+#define SYS_munmap  11
 #elif defined __mips__
 /* o32 style syscalls (range [4000, 4999]) */
 #define SYS_exit    4001
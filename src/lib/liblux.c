@@ -1,5 +1,12 @@
 /*
     Support library offering 64-bit arithmetic and logical operations.
+
+    Values are handled as pairs of 32-bit words. Nothing in here may use
+    64-bit operators that are themselves implemented by calls to this
+    library (multiplication, division, shifts and comparisons).
+
+    The x86 versions of these functions are in liblux_x86.asm and the ARM
+    version of __lux_mul64() is in liblux_arm.asm.
 */
 #include <stdint.h>
 #include <string.h>
@@ -17,210 +24,250 @@ typedef struct {
 #define CMP_EQ 1
 #define CMP_GT 2
 
+#define LO(x) ((x).d.i[0])
+#define HI(x) ((x).d.i[1])
+
 int __lux_ucmp64(LongLong a, LongLong b)
 {
-    int i;
-
-    for (i = 1; i >= 0; i--) {
-        if (a.d.i[i] > b.d.i[i])
-            return CMP_GT;
-        else if (a.d.i[i] < b.d.i[i])
-            return CMP_LT;
-    }
+    if (HI(a) != HI(b))
+        return (HI(a) > HI(b)) ? CMP_GT : CMP_LT;
+    if (LO(a) != LO(b))
+        return (LO(a) > LO(b)) ? CMP_GT : CMP_LT;
     return CMP_EQ;
 }
 
 int __lux_scmp64(LongLong a, LongLong b)
 {
-    uint32_t sa, sb;
-
-    sa = a.d.i[1]&0x80000000;
-    sb = b.d.i[1]&0x80000000;
-    if (sa != sb)
-        return (sa) ? CMP_LT : CMP_GT;
-    else
-        return __lux_ucmp64(a, b);
+    if (HI(a) != HI(b))
+        return ((int32_t)HI(a) > (int32_t)HI(b)) ? CMP_GT : CMP_LT;
+    if (LO(a) != LO(b))
+        return (LO(a) > LO(b)) ? CMP_GT : CMP_LT;
+    return CMP_EQ;
 }
 
 long long __lux_shl64(LongLong a, int n)
 {
-    uint32_t hob;
-
-    if (n <= 0)
-        return *(long long *)&a;
-    while (n--) {
-        hob = !!(a.d.i[0]&0x80000000);
-        a.d.i[0] = a.d.i[0]<<1;
-        a.d.i[1] = (a.d.i[1]<<1)+hob;
+    if (n <= 0) {
+        ;
+    } else if (n < 32) {
+        HI(a) = HI(a)<<n | LO(a)>>(32-n);
+        LO(a) = LO(a)<<n;
+    } else if (n < 64) {
+        HI(a) = LO(a)<<(n-32);
+        LO(a) = 0;
+    } else {
+        HI(a) = LO(a) = 0;
     }
     return *(long long *)&a;
 }
 
 long long __lux_ushr64(LongLong a, int n)
 {
-    uint32_t lob;
-
-    if (n <= 0)
-        goto done;
-    while (n--) {
-        lob = a.d.i[1]&1;
-        a.d.i[1] = a.d.i[1]>>1;
-        a.d.i[0] = (a.d.i[0]>>1)+(lob<<31);
+    if (n <= 0) {
+        ;
+    } else if (n < 32) {
+        LO(a) = LO(a)>>n | HI(a)<<(32-n);
+        HI(a) = HI(a)>>n;
+    } else if (n < 64) {
+        LO(a) = HI(a)>>(n-32);
+        HI(a) = 0;
+    } else {
+        HI(a) = LO(a) = 0;
     }
-done:
     return *(long long *)&a;
 }
 
 long long __lux_sshr64(LongLong a, int n)
 {
-    uint32_t lob;
-
-    if (n <= 0)
-        goto done;
-    while (n--) {
-        lob = a.d.i[1]&1;
-        a.d.i[1] = (uint32_t)((int32_t)a.d.i[1]>>1);
-        a.d.i[0] = (a.d.i[0]>>1)+(lob<<31);
+    if (n <= 0) {
+        ;
+    } else if (n < 32) {
+        LO(a) = LO(a)>>n | HI(a)<<(32-n);
+        HI(a) = (uint32_t)((int32_t)HI(a)>>n);
+    } else {
+        if (n > 63)
+            n = 63;
+        LO(a) = (uint32_t)((int32_t)HI(a)>>(n-32));
+        HI(a) = (uint32_t)((int32_t)HI(a)>>31);
     }
-done:
     return *(long long *)&a;
 }
 
+#ifndef __arm__
 long long __lux_mul64(LongLong a, LongLong b)
 {
     LongLong r;
-    LongLong p1, p2, p3, p4;
-
-    memset(&p1, 0, sizeof(LongLong));
-    memset(&p2, 0, sizeof(LongLong));
-    memset(&p3, 0, sizeof(LongLong));
-    memset(&p4, 0, sizeof(LongLong));
-    p1.d.i[0] = a.d.s[0]*b.d.s[0];
-    *(uint32_t *)&p2.d.s[1] = a.d.s[0]*b.d.s[1];
-    p3.d.i[1] = a.d.s[0]*b.d.s[2];
-    p4.d.s[3] = (uint16_t)(a.d.s[0]*b.d.s[3]);
-    *(long long *)&r = *(long long *)&p1+*(long long *)&p2+*(long long *)&p3+*(long long *)&p4;
-
-    memset(&p1, 0, sizeof(LongLong));
-    memset(&p2, 0, sizeof(LongLong));
-    memset(&p3, 0, sizeof(LongLong));
-    *(uint32_t *)&p1.d.s[1] = a.d.s[1]*b.d.s[0];
-    p2.d.i[1] = a.d.s[1]*b.d.s[1];
-    p3.d.s[3] = (uint16_t)(a.d.s[1]*b.d.s[2]);
-    *(long long *)&r += *(long long *)&p1+*(long long *)&p2+*(long long *)&p3;
-
-    memset(&p1, 0, sizeof(LongLong));
-    memset(&p2, 0, sizeof(LongLong));
-    p1.d.i[1] = a.d.s[2]*b.d.s[0];
-    p2.d.s[3] = (uint16_t)(a.d.s[2]*b.d.s[1]);
-    *(long long *)&r += *(long long *)&p1+*(long long *)&p2;
-
-    memset(&p1, 0, sizeof(LongLong));
-    p1.d.s[3] = (uint16_t)(a.d.s[3]*b.d.s[0]);
-    *(long long *)&r += *(long long *)&p1;
+    uint32_t al, ah, bl, bh;
+    uint32_t ll, lh, hl, mid;
+
+    /* 32x32->64 product of the low words, from 16-bit halves */
+    al = LO(a)&0xFFFF, ah = LO(a)>>16;
+    bl = LO(b)&0xFFFF, bh = LO(b)>>16;
+    ll = al*bl;
+    lh = al*bh;
+    hl = ah*bl;
+    mid = (ll>>16)+(lh&0xFFFF)+(hl&0xFFFF);
+    LO(r) = (ll&0xFFFF) | mid<<16;
+    HI(r) = ah*bh+(lh>>16)+(hl>>16)+(mid>>16);
+
+    /* the cross products only affect the high word */
+    HI(r) += LO(a)*HI(b)+HI(a)*LO(b);
 
     return *(long long *)&r;
 }
+#endif
 
-static long long __udivmod64(LongLong a, LongLong b, int retquo)
+/* number of leading zero bits of x != 0 */
+static int nlz32(uint32_t x)
 {
-    int i;
-    LongLong q, r;
+    int n;
+
+    n = 0;
+    if (x <= 0x0000FFFF) n += 16, x <<= 16;
+    if (x <= 0x00FFFFFF) n += 8, x <<= 8;
+    if (x <= 0x0FFFFFFF) n += 4, x <<= 4;
+    if (x <= 0x3FFFFFFF) n += 2, x <<= 2;
+    if (x <= 0x7FFFFFFF) n += 1;
+    return n;
+}
+
+/*
+ * Divide a by b, leaving the quotient in q and the remainder in a.
+ *
+ * The divisor is shifted left until its most significant bit lines up
+ * with the dividend's, so the shift-and-subtract loop only runs over the
+ * bit positions where the quotient can be non-zero rather than over all
+ * 64 of them. When both operands fit in 32 bits the native division is
+ * used instead.
+ */
+static void __udivmod64(LongLong *a, LongLong *b, LongLong *q)
+{
+    int n;
+    uint32_t a0, a1, d0, d1, q0, q1;
+
+    a0 = LO(*a), a1 = HI(*a);
+    d0 = LO(*b), d1 = HI(*b);
+    q0 = q1 = 0;
+    if (d1 == 0) {
+        if (d0 == 0) {
+            n = 0;
+            123/n;
+        }
+        if (a1 == 0) {
+            q0 = a0/d0;
+            a0 -= q0*d0;
+            goto done;
+        }
+    }
+    if (a1<d1 || a1==d1&&a0<d0)
+        goto done;
 
-    if (b.d.i[0]==0 && b.d.i[1]==0) {
-        i = 0;
-        123/i;
+    n = (d1?nlz32(d1):32+nlz32(d0))-(a1?nlz32(a1):32+nlz32(a0));
+    if (n >= 32) {
+        d1 = d0<<(n-32);
+        d0 = 0;
+    } else if (n > 0) {
+        d1 = d1<<n | d0>>(32-n);
+        d0 = d0<<n;
     }
-    memset(&q, 0, sizeof(LongLong));
-    memset(&r, 0, sizeof(LongLong));
-    for (i = 63; i >= 0; i--) {
-        *(long long *)&r <<= 1;
-        r.d.c[0] |= !!(a.d.c[i/8] & (1<<(i%8)));
-        if (*(unsigned long long *)&r >= *(unsigned long long *)&b) {
-            *(long long *)&r -= *(long long *)&b;
-            q.d.c[i/8] |= 1<<(i%8);
+    for (;;) {
+        q1 = q1<<1 | q0>>31;
+        q0 = q0<<1;
+        if (a1>d1 || a1==d1&&a0>=d0) {
+            a1 -= d1+(a0<d0);
+            a0 -= d0;
+            q0 |= 1;
         }
+        if (--n < 0)
+            break;
+        d0 = d0>>1 | d1<<31;
+        d1 = d1>>1;
     }
-    return retquo ? *(long long *)&q : *(long long *)&r;
+done:
+    LO(*a) = a0, HI(*a) = a1;
+    LO(*q) = q0, HI(*q) = q1;
 }
 
-long long __lux_udiv64(LongLong a, LongLong b)
+static void neg64(LongLong *a)
 {
-    return __udivmod64(a, b, 1);
+    LO(*a) = -LO(*a);
+    HI(*a) = -HI(*a)-(LO(*a)!=0);
 }
 
-long long __lux_umod64(LongLong a, LongLong b)
+long long __lux_udiv64(LongLong a, LongLong b)
 {
-    return __udivmod64(a, b, 0);
+    LongLong q;
+
+    __udivmod64(&a, &b, &q);
+    return *(long long *)&q;
 }
 
-static long long __sdivmod64(LongLong a, LongLong b, int retquo)
+long long __lux_umod64(LongLong a, LongLong b)
 {
-    int i;
-    int as, bs;
-    LongLong q, r;
+    LongLong q;
 
-    if (b.d.i[0]==0 && b.d.i[1]==0) {
-        i = 0;
-        123/i;
-    }
-    as = bs = 0;
-    if (a.d.c[7] & 0x80) {
-        *(long long *)&a = -*(long long *)&a;
-        as = 1;
-    }
-    if (b.d.c[7] & 0x80) {
-        *(long long *)&b = -*(long long *)&b;
-        bs = 1;
-    }
-    memset(&q, 0, sizeof(LongLong));
-    memset(&r, 0, sizeof(LongLong));
-
-    for (i = 63; i >= 0; i--) {
-        *(long long *)&r <<= 1;
-        r.d.c[0] |= !!(a.d.c[i/8] & (1<<(i%8)));
-        if (*(long long *)&r >= *(long long *)&b) {
-            *(long long *)&r -= *(long long *)&b;
-            q.d.c[i/8] |= 1<<(i%8);
-        }
-    }
-    if (retquo) {
-        if (as != bs)
-            *(long long *)&q = -*(long long *)&q;
-        return *(long long *)&q;
-    } else {
-        if (as)
-            *(long long *)&r = -*(long long *)&r;
-        return *(long long *)&r;
-    }
+    __udivmod64(&a, &b, &q);
+    return *(long long *)&a;
 }
 
 long long __lux_sdiv64(LongLong a, LongLong b)
 {
-    return __sdivmod64(a, b, 1);
+    int neg;
+    LongLong q;
+
+    neg = (HI(a)^HI(b)) & 0x80000000;
+    if (HI(a) & 0x80000000)
+        neg64(&a);
+    if (HI(b) & 0x80000000)
+        neg64(&b);
+    __udivmod64(&a, &b, &q);
+    if (neg)
+        neg64(&q);
+    return *(long long *)&q;
 }
 
 long long __lux_smod64(LongLong a, LongLong b)
 {
-    return __sdivmod64(a, b, 0);
+    int neg;
+    LongLong q;
+
+    neg = HI(a) & 0x80000000;
+    if (neg)
+        neg64(&a);
+    if (HI(b) & 0x80000000)
+        neg64(&b);
+    __udivmod64(&a, &b, &q);
+    if (neg)
+        neg64(&a);
+    return *(long long *)&a;
 }
 
+/*
+ * 32-bit division for targets without a divide instruction (ARM),
+ * using the same normalized shift-and-subtract loop as above.
+ */
 static uint32_t __udivmod32(uint32_t a, uint32_t b, int retquo)
 {
-    int i;
-    uint32_t q, r;
-
-    if (b == 0) i = 0, 123/i;
-    q = r = 0;
-    for (i = 31; i >= 0; i--) {
-        r <<= 1;
-        r |= !!(a&(1U<<i));
-        if (r >= b) {
-            r -= b;
-            q |= 1U<<i;
+    int n;
+    uint32_t q;
+
+    if (b == 0) n = 0, 123/n;
+    q = 0;
+    if (a < b)
+        return retquo ? q : a;
+    n = nlz32(b)-nlz32(a);
+    b <<= n;
+    for (;;) {
+        q <<= 1;
+        if (a >= b) {
+            a -= b;
+            q |= 1;
         }
+        if (--n < 0)
+            break;
+        b >>= 1;
     }
-    return retquo ? q : r;
+    return retquo ? q : a;
 }
 
 long long __lux_udiv32(uint32_t a, uint32_t b)
@@ -235,33 +282,16 @@ long long __lux_umod32(uint32_t a, uint32_t b)
 
 static int32_t __sdivmod32(int32_t a, int32_t b, int retquo)
 {
-    int i;
     int as, bs;
-    int32_t q, r;
+    uint32_t r;
 
-    if (b == 0) i = 0, 123/i;
-    as = bs = 0;
-    if (a & 0x80000000) {
-        a = -a;
-        as = 1;
-    }
-    if (b & 0x80000000) {
-        b = -b;
-        bs = 1;
-    }
-    q = r = 0;
-    for (i = 31; i >= 0; i--) {
-        r <<= 1;
-        r |= !!(a&(1<<i));
-        if (r >= b) {
-            r -= b;
-            q |= 1<<i;
-        }
-    }
+    as = a < 0;
+    bs = b < 0;
+    r = __udivmod32(as?-(uint32_t)a:(uint32_t)a, bs?-(uint32_t)b:(uint32_t)b, retquo);
     if (retquo)
-        return (as != bs) ? -q : q;
+        return (as != bs) ? -(int32_t)r : (int32_t)r;
     else
-        return as ? -r : r;
+        return as ? -(int32_t)r : (int32_t)r;
 }
 
 long long __lux_sdiv32(int32_t a, int32_t b)
@@ -0,0 +1,12 @@
+.text
+
+; long long __lux_mul64(long long a, long long b);
+; a is passed in r0:r1 and b in r2:r3 (low word first).
+.global __lux_mul64
+__lux_mul64:
+    mul r12, r0, r3
+    mla r12, r1, r2, r12
+    umull r3, r1, r0, r2
+    mov r0, r3
+    add r1, r1, r12
+    mov r15, r14
@@ -0,0 +1,356 @@
+section .text
+
+; 64-bit arithmetic and logical operations used by the x86 code generator.
+; Operands are passed on the stack as pairs of dwords (low dword first) and
+; results are returned in edx:eax. ebx, esi, edi and ebp are preserved.
+; The comparisons return 4 (less), 1 (equal) or 2 (greater).
+
+; long long __lux_mul64(long long a, long long b);
+global __lux_mul64:function
+__lux_mul64:
+    mov eax, [esp+4]
+    mov ecx, [esp+16]
+    imul ecx, eax
+    mov edx, [esp+8]
+    imul edx, [esp+12]
+    add ecx, edx
+    mul dword [esp+12]
+    add edx, ecx
+    ret
+
+; Unsigned 64-bit division.
+; In:  edx:eax dividend, edi:esi divisor.
+; Out: edx:eax quotient, ecx:ebx remainder.
+; Clobbers ebp.
+__udivmod64:
+    test edi, edi
+    jne .big
+    cmp edx, esi
+    jae .two
+    ; the quotient fits in 32 bits, a single div does it
+    div esi
+    mov ebx, edx
+    xor ecx, ecx
+    xor edx, edx
+    ret
+.two:
+    ; long division with 32-bit digits: two divs
+    mov ebx, eax
+    mov eax, edx
+    xor edx, edx
+    div esi
+    mov ecx, eax
+    mov eax, ebx
+    div esi
+    mov ebx, edx
+    mov edx, ecx
+    xor ecx, ecx
+    ret
+.big:
+    ; The divisor doesn't fit in 32 bits, so the quotient does.
+    ; Estimate it by dividing the dividend shifted right one bit
+    ; by the 32 most significant bits of the normalized divisor;
+    ; the estimate is then off by at most one (Hacker's Delight,
+    ; section 9-5).
+    push eax
+    push edx
+    bsr ecx, edi
+    xor ecx, 31
+    mov ebx, edi
+    je .norm
+    shl ebx, cl
+    mov ebp, esi
+    neg ecx
+    shr ebp, cl
+    neg ecx
+    or ebx, ebp
+.norm:
+    mov ebp, edx
+    shl ebp, 31
+    shr edx, 1
+    shr eax, 1
+    or eax, ebp
+    div ebx
+    xor ecx, 31
+    shr eax, cl
+    ; q = q==0 ? 0 : q-1
+    sub eax, 1
+    adc eax, 0
+    mov ebp, eax
+    ; remainder = dividend - q*divisor
+    mov ecx, edi
+    imul ecx, eax
+    mul esi
+    add edx, ecx
+    pop ecx
+    pop ebx
+    sub ebx, eax
+    sbb ecx, edx
+    ; one correction step
+    cmp ecx, edi
+    jb .done
+    ja .adjust
+    cmp ebx, esi
+    jb .done
+.adjust:
+    sub ebx, esi
+    sbb ecx, edi
+    inc ebp
+.done:
+    mov eax, ebp
+    xor edx, edx
+    ret
+
+; long long __lux_udiv64(long long a, long long b);
+global __lux_udiv64:function
+__lux_udiv64:
+    push ebp
+    push edi
+    push esi
+    push ebx
+    mov eax, [esp+20]
+    mov edx, [esp+24]
+    mov esi, [esp+28]
+    mov edi, [esp+32]
+    call __udivmod64
+    pop ebx
+    pop esi
+    pop edi
+    pop ebp
+    ret
+
+; long long __lux_umod64(long long a, long long b);
+global __lux_umod64:function
+__lux_umod64:
+    push ebp
+    push edi
+    push esi
+    push ebx
+    mov eax, [esp+20]
+    mov edx, [esp+24]
+    mov esi, [esp+28]
+    mov edi, [esp+32]
+    call __udivmod64
+    mov eax, ebx
+    mov edx, ecx
+    pop ebx
+    pop esi
+    pop edi
+    pop ebp
+    ret
+
+; long long __lux_sdiv64(long long a, long long b);
+global __lux_sdiv64:function
+__lux_sdiv64:
+    push ebp
+    push edi
+    push esi
+    push ebx
+    mov eax, [esp+20]
+    mov edx, [esp+24]
+    mov esi, [esp+28]
+    mov edi, [esp+32]
+    ; the quotient is negative if the signs differ
+    mov ecx, edx
+    xor ecx, edi
+    push ecx
+    test edx, edx
+    jge .a_pos
+    neg edx
+    neg eax
+    sbb edx, 0
+.a_pos:
+    test edi, edi
+    jge .b_pos
+    neg edi
+    neg esi
+    sbb edi, 0
+.b_pos:
+    call __udivmod64
+    pop ecx
+    test ecx, ecx
+    jge .done
+    neg edx
+    neg eax
+    sbb edx, 0
+.done:
+    pop ebx
+    pop esi
+    pop edi
+    pop ebp
+    ret
+
+; long long __lux_smod64(long long a, long long b);
+global __lux_smod64:function
+__lux_smod64:
+    push ebp
+    push edi
+    push esi
+    push ebx
+    mov eax, [esp+20]
+    mov edx, [esp+24]
+    mov esi, [esp+28]
+    mov edi, [esp+32]
+    ; the remainder has the sign of the dividend
+    push edx
+    test edx, edx
+    jge .a_pos
+    neg edx
+    neg eax
+    sbb edx, 0
+.a_pos:
+    test edi, edi
+    jge .b_pos
+    neg edi
+    neg esi
+    sbb edi, 0
+.b_pos:
+    call __udivmod64
+    mov eax, ebx
+    mov edx, ecx
+    pop ecx
+    test ecx, ecx
+    jge .done
+    neg edx
+    neg eax
+    sbb edx, 0
+.done:
+    pop ebx
+    pop esi
+    pop edi
+    pop ebp
+    ret
+
+; long long __lux_shl64(long long a, int n);
+global __lux_shl64:function
+__lux_shl64:
+    mov eax, [esp+4]
+    mov edx, [esp+8]
+    mov ecx, [esp+12]
+    cmp ecx, 0
+    jle .done
+    cmp ecx, 32
+    jae .big
+    push ebx
+    mov ebx, eax
+    shl edx, cl
+    shl eax, cl
+    neg ecx
+    shr ebx, cl
+    or edx, ebx
+    pop ebx
+.done:
+    ret
+.big:
+    cmp ecx, 64
+    jae .zero
+    mov edx, eax
+    shl edx, cl
+    xor eax, eax
+    ret
+.zero:
+    xor eax, eax
+    xor edx, edx
+    ret
+
+; long long __lux_ushr64(long long a, int n);
+global __lux_ushr64:function
+__lux_ushr64:
+    mov eax, [esp+4]
+    mov edx, [esp+8]
+    mov ecx, [esp+12]
+    cmp ecx, 0
+    jle .done
+    cmp ecx, 32
+    jae .big
+    push ebx
+    mov ebx, edx
+    shr eax, cl
+    shr edx, cl
+    neg ecx
+    shl ebx, cl
+    or eax, ebx
+    pop ebx
+.done:
+    ret
+.big:
+    cmp ecx, 64
+    jae .zero
+    mov eax, edx
+    shr eax, cl
+    xor edx, edx
+    ret
+.zero:
+    xor eax, eax
+    xor edx, edx
+    ret
+
+; long long __lux_sshr64(long long a, int n);
+global __lux_sshr64:function
+__lux_sshr64:
+    mov eax, [esp+4]
+    mov edx, [esp+8]
+    mov ecx, [esp+12]
+    cmp ecx, 0
+    jle .done
+    cmp ecx, 32
+    jae .big
+    push ebx
+    mov ebx, edx
+    shr eax, cl
+    sar edx, cl
+    neg ecx
+    shl ebx, cl
+    or eax, ebx
+    pop ebx
+.done:
+    ret
+.big:
+    cmp ecx, 64
+    jb .shift
+    mov ecx, 31
+.shift:
+    mov eax, edx
+    sar eax, cl
+    sar edx, 31
+    ret
+
+; int __lux_ucmp64(long long a, long long b);
+global __lux_ucmp64:function
+__lux_ucmp64:
+    mov eax, [esp+8]
+    cmp eax, [esp+16]
+    ja .gt
+    jb .lt
+    mov eax, [esp+4]
+    cmp eax, [esp+12]
+    ja .gt
+    jb .lt
+    mov eax, 1
+    ret
+.gt:
+    mov eax, 2
+    ret
+.lt:
+    mov eax, 4
+    ret
+
+; int __lux_scmp64(long long a, long long b);
+global __lux_scmp64:function
+__lux_scmp64:
+    mov eax, [esp+8]
+    cmp eax, [esp+16]
+    jg .gt
+    jl .lt
+    mov eax, [esp+4]
+    cmp eax, [esp+12]
+    ja .gt
+    jb .lt
+    mov eax, 1
+    ret
+.gt:
+    mov eax, 2
+    ret
+.lt:
+    mov eax, 4
+    ret
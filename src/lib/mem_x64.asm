@@ -0,0 +1,96 @@
+section .text
+
+; The bulk of the copy/fill is done a qword at a time with
+; `rep movsq'/`rep stosq'; the remaining 0-7 bytes with the
+; byte variants. The string instructions take a while to start,
+; so very short copies/fills use a plain byte loop instead.
+; The direction flag is clear on entry and exit.
+
+; void *memcpy(void *s1, const void *s2, size_t n);
+global memcpy:function
+memcpy:
+    mov rax, rdi
+    cmp rdx, 16
+    jb .short
+    mov rcx, rdx
+    shr rcx, 3
+    rep movsq
+    mov rcx, rdx
+    and rcx, 7
+    rep movsb
+    ret
+.short:
+    test rdx, rdx
+    je .done
+.loop:
+    mov cl, [rsi]
+    mov [rdi], cl
+    inc rsi
+    inc rdi
+    dec rdx
+    jne .loop
+.done:
+    ret
+
+; void *memmove(void *s1, const void *s2, size_t n);
+global memmove:function
+memmove:
+    mov rax, rdi
+    ; copy forward unless s1 lies within [s2, s2+n)
+    cmp rdi, rsi
+    jbe .forward
+    lea rcx, [rsi+rdx]
+    cmp rdi, rcx
+    jae .forward
+    ; copy backward, first the trailing bytes, then the qwords
+    std
+    lea rsi, [rsi+rdx+-1]
+    lea rdi, [rdi+rdx+-1]
+    mov rcx, rdx
+    and rcx, 7
+    rep movsb
+    sub rsi, 7
+    sub rdi, 7
+    mov rcx, rdx
+    shr rcx, 3
+    rep movsq
+    cld
+    ret
+.forward:
+    mov rcx, rdx
+    shr rcx, 3
+    rep movsq
+    mov rcx, rdx
+    and rcx, 7
+    rep movsb
+    ret
+
+; void *memset(void *s, int c, size_t n);
+global memset:function
+memset:
+    mov r8, rdi
+    cmp rdx, 16
+    jb .short
+    ; replicate the byte across rax
+    movzx eax, sil
+    mov r9, 0x0101010101010101
+    imul rax, r9
+    mov rcx, rdx
+    shr rcx, 3
+    rep stosq
+    mov rcx, rdx
+    and rcx, 7
+    rep stosb
+    mov rax, r8
+    ret
+.short:
+    test rdx, rdx
+    je .done
+.loop:
+    mov [rdi], sil
+    inc rdi
+    dec rdx
+    jne .loop
+.done:
+    mov rax, r8
+    ret
@@ -0,0 +1,117 @@
+section .text
+
+; The bulk of the copy/fill is done a dword at a time with
+; `rep movsd'/`rep stosd'; the remaining 0-3 bytes with the
+; byte variants. The string instructions take a while to start,
+; so very short copies/fills use a plain byte loop instead.
+; The direction flag is clear on entry and exit.
+
+; void *memcpy(void *s1, const void *s2, size_t n);
+global memcpy:function
+memcpy:
+    push edi
+    push esi
+    mov edi, [esp+12]
+    mov esi, [esp+16]
+    mov edx, [esp+20]
+    mov eax, edi
+    cmp edx, 16
+    jb .short
+    mov ecx, edx
+    shr ecx, 2
+    rep movsd
+    mov ecx, edx
+    and ecx, 3
+    rep movsb
+    pop esi
+    pop edi
+    ret
+.short:
+    test edx, edx
+    je .done
+.loop:
+    mov cl, [esi]
+    mov [edi], cl
+    inc esi
+    inc edi
+    dec edx
+    jne .loop
+.done:
+    pop esi
+    pop edi
+    ret
+
+; void *memmove(void *s1, const void *s2, size_t n);
+global memmove:function
+memmove:
+    push edi
+    push esi
+    mov edi, [esp+12]
+    mov esi, [esp+16]
+    mov edx, [esp+20]
+    mov eax, edi
+    ; copy forward unless s1 lies within [s2, s2+n)
+    cmp edi, esi
+    jbe .forward
+    lea ecx, [esi+edx]
+    cmp edi, ecx
+    jae .forward
+    ; copy backward, first the trailing bytes, then the dwords
+    std
+    lea esi, [esi+edx+-1]
+    lea edi, [edi+edx+-1]
+    mov ecx, edx
+    and ecx, 3
+    rep movsb
+    sub esi, 3
+    sub edi, 3
+    mov ecx, edx
+    shr ecx, 2
+    rep movsd
+    cld
+    pop esi
+    pop edi
+    ret
+.forward:
+    mov ecx, edx
+    shr ecx, 2
+    rep movsd
+    mov ecx, edx
+    and ecx, 3
+    rep movsb
+    pop esi
+    pop edi
+    ret
+
+; void *memset(void *s, int c, size_t n);
+global memset:function
+memset:
+    push edi
+    mov edi, [esp+8]
+    ; replicate the byte across eax
+    movzx eax, byte [esp+12]
+    imul eax, 0x01010101
+    mov edx, [esp+16]
+    cmp edx, 16
+    jb .short
+    mov ecx, edx
+    shr ecx, 2
+    rep stosd
+    mov ecx, edx
+    and ecx, 3
+    rep stosb
+    mov eax, [esp+8]
+    pop edi
+    ret
+.short:
+    test edx, edx
+    je .done
+.loop:
+    mov [edi], al
+    inc edi
+    dec edx
+    jne .loop
+.done:
+    mov eax, [esp+8]
+    pop edi
+    ret
@@ -44,3 +44,16 @@ __raw_syscall_4:
     mov r10, r8
     syscall
     ret
+
+; long __raw_syscall_6(long, long, long, long, long, long, long);
+global __raw_syscall_6
+__raw_syscall_6:
+    mov rax, rdi
+    mov rdi, rsi
+    mov rsi, rdx
+    mov rdx, rcx
+    mov r10, r8
+    mov r8, r9
+    mov r9, [rsp+8]
+    syscall
+    ret
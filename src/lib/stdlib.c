@@ -7,28 +7,69 @@
 #include <ctype.h>
 #include <signal.h>
 #include <sys/wait.h>
+#include <sys/mman.h>
 
 #define ATEXIT_MAX 32   /* maximum # of function that can be registered with atexit() */
 
-typedef struct Header Header; /* this is the basic heap unit */
-
-#define IHEAP   8192    /* initial heap size (in units) */
-#define NALLOC  4096    /* minimum # of units the heap is incremented by */
-
-static struct Header {
-    Header *next;
-    size_t used_size;
-    size_t free_size;
-    /*size_t _pad;*/
-} *heap, *hptr;
+/*
+ * Memory allocator.
+ *
+ * Every block starts with a two word header: the size of the previous block
+ * in memory and the size of the block itself (header included), whose low
+ * bits are used for flags. Blocks are multiples of ALIGN bytes.
+ *
+ * Small requests (up to SMALL_MAX bytes) are rounded up to a multiple of
+ * ALIGN and served from one free list per size class. The lists are refilled
+ * by carving slabs out of the heap. Small blocks are never coalesced, so
+ * allocating and freeing them is O(1).
+ *
+ * Larger requests come from the heap. Free heap blocks are kept in bins by
+ * power of two and are coalesced with their free neighbors; the free space at
+ * the end of the heap is the `top' block, which is grown with sbrk(). Huge
+ * requests are mapped directly with mmap() when the target supports it.
+ */
+typedef struct Block Block;
+
+#define IHEAP           (64*1024)   /* initial heap size (in bytes) */
+#define NALLOC          (32*1024)   /* minimum # of bytes the heap is incremented by */
+#define NCLASSES        32          /* # of small size classes */
+#define SLAB_SIZE       4096        /* bytes carved at once for a small size class */
+#define MMAP_THRESHOLD  (256*1024)  /* requests from here on are mmap'ed */
+#define PAGE_SIZE       4096
+#define MAX_REQUEST     ((size_t)-1/2)
+
+#define IN_USE          1
+#define SMALL           2
+#define MAPPED          4
+#define FLAGS           7
+
+#define HDR_SIZE        (2*sizeof(size_t))
+#define ALIGN           HDR_SIZE
+#define MIN_BLOCK       sizeof(Block)
+#define SMALL_MAX       (NCLASSES*ALIGN)
+#define ROUND_UP(n, m)  (((n)+(m)-1) & ~((size_t)(m)-1))
+#define BSIZE(b)        ((b)->size & ~(size_t)FLAGS)
+#define NEXT_BLOCK(b)   ((Block *)((char *)(b)+BSIZE(b)))
+#define PREV_BLOCK(b)   ((Block *)((char *)(b)-(b)->prev_size))
+#define BLOCK2MEM(b)    ((void *)((char *)(b)+HDR_SIZE))
+#define MEM2BLOCK(p)    ((Block *)((char *)(p)-HDR_SIZE))
+
+static struct Block {
+    size_t prev_size;   /* size of the previous block in the heap (0 for the first one) */
+    size_t size;        /* size of this block | flags */
+    Block *next, *prev; /* free list links; only in free blocks */
+} *top;
+static void *heap;
+static Block *small_free[NCLASSES+1];   /* indexed by # of ALIGN units */
+static Block *bins[sizeof(size_t)*8];   /* indexed by floor(log2(size)) */
+static size_t binmap;                   /* bit i set <=> bins[i] not empty */
 
 void __set_up_heap(void)
 {
-    heap = sbrk(IHEAP*sizeof(Header));
-    hptr = heap;
-    hptr->next = heap;
-    hptr->used_size = 1;
-    hptr->free_size = IHEAP-1;
+    heap = sbrk(IHEAP);
+    top = (Block *)ROUND_UP((unsigned long)heap, ALIGN);
+    top->prev_size = 0;
+    top->size = (IHEAP-((char *)top-(char *)heap)) & ~(ALIGN-1);
 }
 
 void __heap_fini(void)
@@ -36,73 +77,213 @@ void __heap_fini(void)
     brk(heap);
 }
 
-static Header *_expand_heap(size_t nunits)
+static int bin_index(size_t size)
+{
+    int i;
+
+    for (i = 0; size >>= 1; i++)
+        ;
+    return i;
+}
+
+static void bin_insert(Block *b)
+{
+    int i;
+
+    i = bin_index(b->size);
+    b->prev = NULL;
+    if ((b->next=bins[i]) != NULL)
+        b->next->prev = b;
+    bins[i] = b;
+    binmap |= (size_t)1 << i;
+}
+
+static void bin_remove(Block *b)
+{
+    int i;
+
+    if (b->prev != NULL) {
+        b->prev->next = b->next;
+    } else {
+        i = bin_index(b->size);
+        if ((bins[i]=b->next) == NULL)
+            binmap &= ~((size_t)1 << i);
+    }
+    if (b->next != NULL)
+        b->next->prev = b->prev;
+}
+
+static int grow_heap(size_t n)
+{
+    if (n < NALLOC)
+        n = NALLOC;
+    n = ROUND_UP(n, ALIGN);
+    if (sbrk(n) == (void *)-1)
+        return 0;
+    top->size += n;
+    return 1;
+}
+
+/* return a heap block to the bins, coalescing it with its free neighbors */
+static void free_large(Block *b)
+{
+    Block *n, *p;
+
+    b->size = BSIZE(b);
+    if ((n=NEXT_BLOCK(b)) == top) {
+        b->size += top->size;
+        top = b;
+    } else if (!(n->size & IN_USE)) {
+        bin_remove(n);
+        b->size += n->size;
+    }
+    if (b->prev_size!=0 && !((p=PREV_BLOCK(b))->size&IN_USE)) {
+        bin_remove(p);
+        p->size += b->size;
+        if (b == top)
+            top = p;
+        b = p;
+    }
+    if (b != top) {
+        NEXT_BLOCK(b)->prev_size = b->size;
+        bin_insert(b);
+    }
+}
+
+/* give back the tail of in-use block b beyond size bytes */
+static void split(Block *b, size_t size)
+{
+    Block *r;
+
+    if (BSIZE(b)-size < MIN_BLOCK)
+        return;
+    r = (Block *)((char *)b+size);
+    r->prev_size = size;
+    r->size = BSIZE(b)-size;
+    b->size = size|(b->size&FLAGS);
+    free_large(r);
+}
+
+static Block *alloc_large(size_t size)
 {
-    Header *p;
+    int i;
+    Block *b;
+    size_t m;
 
     /*
-     * Expand the last block's free space
-     * by max(nunits, NALLOC) units.
+     * First fit in the bin of the size. If that fails, any block
+     * of a larger bin will do; the bitmap tells where to look.
      */
-    for (p = heap; p->next != heap; p = p->next)
-        ;
-    if (nunits < NALLOC)
-        nunits = NALLOC;
-    if (sbrk(nunits*sizeof(Header)) == (void *)-1)
+    i = bin_index(size);
+    for (b = bins[i]; b != NULL; b = b->next)
+        if (b->size >= size)
+            goto found;
+    if ((m=binmap&~(((size_t)2<<i)-1)) != 0) {
+        while (!(m & (size_t)1<<i))
+            ++i;
+        b = bins[i];
+        goto found;
+    }
+
+    /* carve it from the top */
+    if (top->size<size+MIN_BLOCK && !grow_heap(size+MIN_BLOCK-top->size))
         return NULL;
-    p->free_size += nunits;
-    return p;
+    b = top;
+    top = (Block *)((char *)b+size);
+    top->prev_size = size;
+    top->size = b->size-size;
+    b->size = size|IN_USE;
+    return b;
+found:
+    bin_remove(b);
+    b->size |= IN_USE;
+    split(b, size);
+    return b;
+}
+
+static Block *refill(int c)
+{
+    Block *slab, *b;
+    size_t csize, n;
+
+    if ((slab=alloc_large(SLAB_SIZE)) == NULL)
+        return NULL;
+    csize = HDR_SIZE+c*ALIGN;
+    /* push the blocks in reverse so that they are handed out in address order */
+    for (n = (BSIZE(slab)-HDR_SIZE)/csize; n-- > 0; ) {
+        b = (Block *)((char *)BLOCK2MEM(slab)+n*csize);
+        b->size = csize|SMALL|IN_USE;
+        b->next = small_free[c];
+        small_free[c] = b;
+    }
+    return small_free[c];
 }
 
 void *malloc(size_t size)
 {
-    Header *p, *newp;
-    size_t nunits;
+    Block *b;
+    size_t n;
 
     if (size == 0)
         return NULL;
-    nunits = (size+sizeof(Header)-1)/sizeof(Header)+1;
 
-    p = hptr;
-    while (p->next!=hptr && p->free_size<nunits)
-        p = p->next;
-    if (p->free_size<nunits && (p=_expand_heap(nunits))==NULL)
+    if (size <= SMALL_MAX) {
+        int c;
+
+        c = (size+ALIGN-1)/ALIGN;
+        if ((b=small_free[c])==NULL && (b=refill(c))==NULL)
+            return NULL;
+        small_free[c] = b->next;
+        return BLOCK2MEM(b);
+    }
+
+    if (size > MAX_REQUEST) {
+        errno = ENOMEM;
+        return NULL;
+    }
+    n = ROUND_UP(size+HDR_SIZE, ALIGN);
+    if (n >= MMAP_THRESHOLD) {
+        n = ROUND_UP(n, PAGE_SIZE);
+        b = mmap(NULL, n, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+        if (b != MAP_FAILED) {
+            b->prev_size = 0;
+            b->size = n|MAPPED|IN_USE;
+            return BLOCK2MEM(b);
+        }
+        /* no mmap(), use the heap */
+        n = ROUND_UP(size+HDR_SIZE, ALIGN);
+    }
+    if ((b=alloc_large(n)) == NULL)
         return NULL;
-    newp = p+p->used_size;
-    newp->used_size = nunits;
-    newp->free_size = p->free_size-nunits;
-    newp->next = p->next;
-    p->free_size = 0;
-    p->next = newp;
-    hptr = newp;
-    return (void *)(newp+1);
+    return BLOCK2MEM(b);
 }
 
 void free(void *ptr)
 {
-    Header *bp, *p, *prev;
+    Block *b;
 
     if (ptr == NULL)
         return;
 
-    bp = (Header *)ptr-1;
-    prev = hptr;
-    p = hptr->next;
-    while (p!=bp && p!=hptr) {
-        prev = p;
-        p = p->next;
+    b = MEM2BLOCK(ptr);
+    if (b->size & SMALL) {
+        int c;
+
+        c = (BSIZE(b)-HDR_SIZE)/ALIGN;
+        b->next = small_free[c];
+        small_free[c] = b;
+    } else if (b->size & MAPPED) {
+        munmap(b, BSIZE(b));
+    } else {
+        free_large(b);
     }
-    if (p != bp)
-        return; /* corrupted list, do nothing */
-    prev->free_size += p->used_size+p->free_size;
-    prev->next = p->next;
-    hptr = prev;
 }
 
 void *realloc(void *ptr, size_t size)
 {
-    Header *p;
-    size_t nunits, avail;
+    Block *b, *n;
+    size_t avail, need;
+    void *newptr;
 
     if (ptr == NULL) {
         return malloc(size);
@@ -111,26 +292,44 @@ void *realloc(void *ptr, size_t size)
         return NULL;
     }
 
-    nunits = (size+sizeof(Header)-1)/sizeof(Header)+1;
-    p = (Header *)ptr-1;
-    avail = p->used_size+p->free_size;
-    if (nunits <= avail) {
-        p->used_size = nunits;
-        p->free_size = avail-nunits;
-        return ptr;
-    } else {
-        void *newptr;
-
-        if ((newptr=malloc(size)) != NULL) {
-            size_t oldsiz;
+    b = MEM2BLOCK(ptr);
+    avail = BSIZE(b)-HDR_SIZE;
+    if (b->size&(SMALL|MAPPED) || size>MAX_REQUEST) {
+        if (size <= avail)
+            return ptr;
+        goto move;
+    }
 
-            oldsiz = p->used_size*sizeof(Header);
-            memcpy(newptr, ptr, (size<oldsiz)?size:oldsiz);
-            free(ptr);
-            return newptr;
+    /* heap block: shrink or grow in place if possible */
+    need = ROUND_UP(size+HDR_SIZE, ALIGN);
+    if (need <= BSIZE(b)) {
+        split(b, need);
+        return ptr;
+    }
+    if ((n=NEXT_BLOCK(b)) == top) {
+        if (top->size>=need-BSIZE(b)+MIN_BLOCK || grow_heap(need-BSIZE(b)+MIN_BLOCK-top->size)) {
+            size_t tsize;
+
+            tsize = top->size-(need-BSIZE(b));
+            top = (Block *)((char *)b+need);
+            top->prev_size = need;
+            top->size = tsize;
+            b->size = need|IN_USE;
+            return ptr;
         }
+    } else if (!(n->size&IN_USE) && BSIZE(b)+n->size>=need) {
+        bin_remove(n);
+        b->size += n->size;
+        NEXT_BLOCK(b)->prev_size = BSIZE(b);
+        split(b, need);
+        return ptr;
     }
-    return NULL;
+move:
+    if ((newptr=malloc(size)) != NULL) {
+        memcpy(newptr, ptr, (size<avail)?size:avail);
+        free(ptr);
+    }
+    return newptr;
 }
 
 void *calloc(size_t nmemb, size_t size)
@@ -138,16 +337,13 @@ void *calloc(size_t nmemb, size_t size)
     void *p;
     size_t nb;
 
+    if (nmemb!=0 && size>(size_t)-1/nmemb)
+        return NULL;
     if ((nb=nmemb*size) == 0)
         return NULL;
-    if ((p=malloc(nb)) != NULL) {
-        size_t i, lim;
-
-        /* the chunk allocated by malloc() is always a multiple of 4 */
-        lim = ((nb+3)&~3)/4;
-        for (i = 0; i < lim; i++)
-            ((int *)p)[i] = 0;
-    }
+    /* mmap'ed memory comes zeroed */
+    if ((p=malloc(nb))!=NULL && !(MEM2BLOCK(p)->size&MAPPED))
+        memset(p, 0, nb);
     return p;
 }
 
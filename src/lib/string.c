@@ -2,6 +2,19 @@
 #include <stdlib.h>
 #include <ctype.h>
 
+/*
+ * Helpers for the word-at-a-time routines. A word with a zero byte is
+ * detected with the usual (w-0x01..01) & ~w & 0x80..80 trick; reading
+ * a whole aligned word never crosses a page boundary, so it is safe to
+ * look at the bytes beyond the end of a string.
+ */
+typedef unsigned long word;
+#define WSIZE           sizeof(word)
+#define ONES            ((word)-1/0xFF)
+#define HIGHS           (ONES*0x80)
+#define HAS_ZERO(w)     (((w)-ONES) & ~(w) & HIGHS)
+#define ALIGNED(p)      (((word)(p) & (WSIZE-1)) == 0)
+
 static char *sys_errlist[] = {
     "No error",                                       // ENOERROR          0
     "Operation not permitted",                        // EPERM             1
@@ -150,12 +163,20 @@ char *strerror(int errnum)
     return sys_errlist[errnum];
 }
 
+/* x86 and x64 use the string instructions (mem_<platform>.asm) */
+#if !defined __i386__ && !defined __x86_64__
 void *memcpy(void *s1, const void *s2, size_t n)
 {
     unsigned char *t1, *t2;
 
     t1 = s1;
     t2 = (unsigned char *)s2;
+    if (((word)t1&(WSIZE-1)) == ((word)t2&(WSIZE-1))) {
+        for (; n!=0 && !ALIGNED(t1); n--)
+            *t1++ = *t2++;
+        for (; n >= WSIZE; n -= WSIZE, t1 += WSIZE, t2 += WSIZE)
+            *(word *)t1 = *(word *)t2;
+    }
     while (n--)
         *t1++ = *t2++;
     return s1;
@@ -167,18 +188,40 @@ void *memmove(void *s1, const void *s2, size_t n)
 
     t1 = s1;
     t2 = (unsigned char *)s2;
-    if (t1 <= t2) {
-        while (n--)
-            *t1++ = *t2++;
-    } else {
-        t1 += n;
-        t2 += n;
-        while (n--)
+    if (t1<=t2 || t1>=t2+n)
+        return memcpy(s1, s2, n);
+    t1 += n;
+    t2 += n;
+    if (((word)t1&(WSIZE-1)) == ((word)t2&(WSIZE-1))) {
+        for (; n!=0 && !ALIGNED(t1); n--)
             *--t1 = *--t2;
+        for (; n >= WSIZE; n -= WSIZE) {
+            t1 -= WSIZE, t2 -= WSIZE;
+            *(word *)t1 = *(word *)t2;
+        }
     }
+    while (n--)
+        *--t1 = *--t2;
     return s1;
 }
 
+void *memset(void *s, int c, size_t n)
+{
+    unsigned char *t;
+    word w;
+
+    t = s;
+    for (; n!=0 && !ALIGNED(t); n--)
+        *t++ = (unsigned char)c;
+    w = ONES*(unsigned char)c;
+    for (; n >= WSIZE; n -= WSIZE, t += WSIZE)
+        *(word *)t = w;
+    while (n--)
+        *t++ = (unsigned char)c;
+    return s;
+}
+#endif
+
 char *strcpy(char *s1, const char *s2)
 {
     char *t;
@@ -247,6 +290,20 @@ int strcmp(const char *s1, const char *s2)
 {
     int res;
 
+    /* if both strings have the same alignment, skip the common prefix a word at a time */
+    if (((word)s1&(WSIZE-1)) == ((word)s2&(WSIZE-1))) {
+        const word *w1, *w2;
+
+        for (; !ALIGNED(s1); s1++, s2++)
+            if ((res=*s1-*s2)!=0 || *s1=='\0')
+                return res;
+        w1 = (const word *)s1;
+        w2 = (const word *)s2;
+        while (*w1==*w2 && !HAS_ZERO(*w1))
+            ++w1, ++w2;
+        s1 = (const char *)w1;
+        s2 = (const char *)w2;
+    }
     while (1) {
         if ((res=*s1-*s2)!=0 || *s1=='\0')
             break;
@@ -294,13 +351,22 @@ int strncasecmp(const char *s1, const char *s2, size_t n)
 
 void *memchr(const void *s, int c, size_t n)
 {
-    while (n && (*(unsigned char *)s != (unsigned char)c)) {
-        s = (unsigned char *)s+1;
-        --n;
-    }
-    if (n == 0)
-        return NULL;
-    return (void *)s;
+    const unsigned char *p;
+    const word *w;
+    word cw;
+
+    c = (unsigned char)c;
+    for (p = s; n!=0 && !ALIGNED(p); p++, n--)
+        if (*p == c)
+            return (void *)p;
+    /* a word holding c has a zero byte after xor'ing it with c repeated */
+    cw = ONES*c;
+    for (w = (const word *)p; n>=WSIZE && !HAS_ZERO(*w^cw); w++)
+        n -= WSIZE;
+    for (p = (const unsigned char *)w; n != 0; p++, n--)
+        if (*p == c)
+            return (void *)p;
+    return NULL;
 }
 
 char *strchr(const char *s, int c)
@@ -408,24 +474,19 @@ char *strtok(char *s1, const char *s2)
     return sbegin;
 }
 
-void *memset(void *s, int c, size_t n)
-{
-    unsigned char *t;
-
-    t = s;
-    while (n-- != 0)
-        *t++ = (unsigned char)c;
-    return s;
-}
-
 size_t strlen(const char *s)
 {
-    size_t n;
+    const char *p;
+    const word *w;
 
-    n = 0;
-    while (*s++ != '\0')
-        ++n;
-    return n;
+    for (p = s; !ALIGNED(p); p++)
+        if (*p == '\0')
+            return p-s;
+    for (w = (const word *)p; !HAS_ZERO(*w); w++)
+        ;
+    for (p = (const char *)w; *p != '\0'; p++)
+        ;
+    return p-s;
 }
 
 char *strdup(const char *s)
@@ -9,6 +9,9 @@ long __raw_syscall_1(long, long);
 long __raw_syscall_2(long, long, long);
 long __raw_syscall_3(long, long, long, long);
 long __raw_syscall_4(long, long, long, long, long);
+#if defined __x86_64__
+long __raw_syscall_6(long, long, long, long, long, long, long);
+#endif
 
 #if defined __x86_64__ || defined __arm__
 /* Structure which says how much of each resource has been used.  */
@@ -81,6 +84,13 @@ long syscall(long number, ...)
         res = __raw_syscall_1(number, a1);
         neg_on_err = 0; /* brk() returns the old break on error */
         break;
+#if defined __i386__
+    case SYS_mmap:      /* void *old_mmap(struct mmap_arg_struct *args); */
+        a1 = va_arg(ap, long);
+        res = __raw_syscall_1(number, a1);
+        neg_on_err = 0; /* addresses may look negative; checked by mmap() */
+        break;
+#endif
     case SYS_exit:      /* void exit(int status); */
     case SYS_close:     /* int close(int fd); */
     case SYS_unlink:    /* int unlink(const char *pathname); */
@@ -98,6 +108,9 @@ long syscall(long number, ...)
     case SYS_kill:      /* int kill(pid_t pid, int sig); */
     case SYS_chmod:     /* int chmod(const char *path, mode_t mode); */
     case SYS_utimes:    /* int utimes(const char *filename, const struct timeval times[2]); */
+#ifdef SYS_munmap
+    case SYS_munmap:    /* int munmap(void *addr, size_t length); */
+#endif
 #ifndef __arm__
     case SYS_utime:     /* int utime(const char *filename, const struct utimbuf *times); */
 #endif
@@ -139,6 +152,25 @@ long syscall(long number, ...)
         break;
 #endif
 
+    /*
+     * syscalls with 6 args.
+     */
+#if defined __x86_64__
+    case SYS_mmap: {    /* void *mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset); */
+        long a4, a5, a6;
+
+        a1 = va_arg(ap, long);
+        a2 = va_arg(ap, long);
+        a3 = va_arg(ap, long);
+        a4 = va_arg(ap, long);
+        a5 = va_arg(ap, long);
+        a6 = va_arg(ap, long);
+        res = __raw_syscall_6(number, a1, a2, a3, a4, a5, a6);
+        neg_on_err = 0;
+    }
+        break;
+#endif
+
     default:
         /* FIXME */
         assert(0);
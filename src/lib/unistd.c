@@ -2,6 +2,8 @@
 #include <termios.h>
 #include <sys/syscall.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <errno.h>
 
 int close(int fd)
 {
@@ -55,6 +57,41 @@ void *sbrk(intptr_t increment)
     return pb;
 }
 
+void *mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset)
+{
+#if defined SYS_mmap
+    unsigned long res;
+#if defined __i386__
+    long args[6];
+
+    args[0] = (long)addr, args[1] = length, args[2] = prot;
+    args[3] = flags, args[4] = fd, args[5] = offset;
+    res = syscall(SYS_mmap, args);
+#else
+    res = syscall(SYS_mmap, addr, length, prot, flags, fd, offset);
+#endif
+    /* the last page of the address space holds the -errno values */
+    if (res > -4096UL) {
+        errno = -(long)res;
+        return MAP_FAILED;
+    }
+    return (void *)res;
+#else
+    errno = ENOSYS;
+    return MAP_FAILED;
+#endif
+}
+
+int munmap(void *addr, size_t length)
+{
+#if defined SYS_munmap
+    return syscall(SYS_munmap, addr, length);
+#else
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
 pid_t getpid(void)
 {
     return syscall(SYS_getpid);
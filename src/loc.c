@@ -4,11 +4,12 @@
 #include <stdlib.h>
 #include <assert.h>
 #include "util/util.h"
+#include "util/atom.h"
 #include "imp_lim.h"
 #include "util/arena.h"
 
 #define HASH_SIZE   1009
-#define HASH_VAL(s) (hash(s)%HASH_SIZE)
+#define HASH_VAL(s) (atom_hash(s)%HASH_SIZE) /* the identifiers are atoms */
 
 struct Location {
     char *id;
@@ -59,7 +60,7 @@ int location_get_offset(char *id)
     h = HASH_VAL(id);
     for (n = curr_scope; n >= 0; n--)
         for (np = location_table[n][h]; np != NULL; np = np->next)
-            if (equal(id, np->id))
+            if (id == np->id)
                 return np->offset;
     assert(0);
 }
@@ -0,0 +1,6 @@
+#ifndef LOOP_H_
+#define LOOP_H_
+
+void loop_main(void);
+
+#endif
@@ -1518,7 +1518,7 @@ int encode_immediate(unsigned n, int *iword, int ldr)
         0x00FF0000, 0x003FC000,
         0x000FF000, 0x0003FC00,
         0x0000FF00, 0x00003FC0,
-        0x00000FF0, 0x000003F0,
+        0x00000FF0, 0x000003FC,
     };
     int rot;
     unsigned imm;
@@ -1533,14 +1533,11 @@ int encode_immediate(unsigned n, int *iword, int ldr)
         imm = (imm<<2) | (imm>>30);
     }
     if (ldr) {
-        rot = 0;
-        if (n == (unsigned)-1) {
-            *iword |= I_MVN;
-            imm = 0;
-            goto done;
-        }
-        for (imm = a[rot]; rot < 16; rot++) {
-            if (n == ~a[rot]) {
+        /* try with the complement (mvn) */
+        n = ~n;
+        imm = n;
+        for (rot = 0; rot < 16; rot++) {
+            if (!(n & ~a[rot])) {
                 *iword |= I_MVN;
                 goto done;
             }
@@ -2214,12 +2211,12 @@ void err_no_input(void)
 int main(int argc, char *argv[])
 {
     int i;
-    char *outpath;
+    char *outpath, *name;
 
     prog_name = argv[0];
     if (argc == 1)
         err_no_input();
-    outpath = inpath = NULL;
+    outpath = inpath = name = NULL;
     for (i = 1; i < argc; i++) {
         if (argv[i][0]!='-' || argv[i][1]=='\0') {
             inpath = argv[i];
@@ -2234,10 +2231,19 @@ int main(int argc, char *argv[])
             else
                 outpath = argv[++i];
             break;
+        case 'f':
+            if (argv[i][2] != '\0')
+                name = argv[i]+2;
+            else if (argv[i+1] == NULL)
+                TERMINATE("%s: option `f' requires an argument\n", prog_name);
+            else
+                name = argv[++i];
+            break;
         case 'h':
             printf("usage: %s [ options ] <input-file>\n"
                    "  The available options are:\n"
                    "    -o<file>    write output to <file>\n"
+                   "    -f<name>    name the input <name> in diagnostics and in the object file\n"
                    "    -h          print this help\n", prog_name);
             exit(EXIT_SUCCESS);
             break;
@@ -2247,7 +2253,14 @@ int main(int argc, char *argv[])
     }
     if (inpath == NULL)
         err_no_input();
-    curr = buf = read_file(inpath);
+    if (equal(inpath, "-")) {
+        curr = buf = read_stream(stdin);
+        inpath = "stdin";
+    } else {
+        curr = buf = read_file(inpath);
+    }
+    if (name != NULL)
+        inpath = name;
     lit_pool.max = 32;
     lit_pool.buf = malloc(sizeof(uint32_t)*lit_pool.max);
     curr_tok = get_token();
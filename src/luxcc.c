@@ -4,6 +4,7 @@
 #include <stdlib.h>
 #include <assert.h>
 #include "parser.h"
+#include "pch.h"
 #include "ic.h"
 #include "vm32_cgen/vm32_cgen.h"
 #include "vm64_cgen/vm64_cgen.h"
@@ -12,6 +13,9 @@
 #include "mips_cgen/mips_cgen.h"
 #include "arm_cgen/arm_cgen.h"
 #include "util/util.h"
+#ifdef INTEGRATED_AS
+#include "luxx86/luxasx86.h"
+#endif
 
 unsigned warning_count, error_count;
 int disable_warnings;
@@ -24,6 +28,7 @@ char *ic_outpath, *ic_function_to_print;
 int include_liblux = TRUE;
 int include_libc = TRUE;
 int verbose_asm;
+int opt_level;
 
 unsigned stat_number_of_pre_tokens;
 unsigned stat_number_of_c_tokens;
@@ -54,6 +59,8 @@ enum {
     OPT_VM64_TARGET     = 0x200,
     OPT_MIPS_TARGET     = 0x400,
     OPT_ARM_TARGET      = 0x800,
+    OPT_EMIT_PCH        = 0x1000,
+    OPT_OBJECT          = 0x2000,
 };
 #define TARGET_MASK (OPT_X86_TARGET|\
                      OPT_X64_TARGET|\
@@ -62,14 +69,37 @@ enum {
                      OPT_MIPS_TARGET|\
                      OPT_ARM_TARGET)
 
+#ifdef INTEGRATED_AS
+/*
+ * Generate x86/x64 code and assemble it in memory with the integrated
+ * assembler, writing an object file instead of assembly text.
+ */
+static void emit_object(int x64, char *inpath, char *outpath)
+{
+    String *s;
+    char *objpath;
+
+    s = string_new(65536);
+    string_printf(s, "");
+    if (x64)
+        x64_cgen_str(s);
+    else
+        x86_cgen_str(s);
+    objpath = (outpath != NULL) ? outpath : replace_extension(inpath, ".o");
+    x86_assemble(string_buf(s), inpath, objpath, x64);
+    if (objpath != outpath)
+        free(objpath);
+    string_free(s);
+}
+#endif
+
 int main(int argc, char *argv[])
 {
     int i;
     FILE *fp = NULL;
     unsigned flags = 0;
-    char *outpath = NULL, *inpath = NULL;
-    PreTokenNode *pre;
-    TokenNode *tok;
+    char *outpath = NULL, *inpath = NULL, *pch_path = NULL;
+    TokenNode *tok, *pch_defs = NULL;
     PreTokenNode newline_node, one_node;
     newline_node.token = PRE_TOK_NL;
     newline_node.lexeme = "\n";
@@ -91,6 +121,13 @@ int main(int argc, char *argv[])
         case 'a':
             flags |= OPT_ANALYZE;
             break;
+        case 'c':
+#ifdef INTEGRATED_AS
+            flags |= OPT_OBJECT;
+            break;
+#else
+            goto unknown;
+#endif
         case 'D':
             if (argv[i][2] != '\0')
                 install_macro(SIMPLE_MACRO, argv[i]+2, &one_node, NULL);
@@ -99,6 +136,11 @@ int main(int argc, char *argv[])
             else
                 install_macro(SIMPLE_MACRO, argv[++i], &one_node, NULL);
             break;
+        case 'e':
+            if (!equal(argv[i], "-emit-pch"))
+                goto unknown;
+            flags |= OPT_EMIT_PCH;
+            break;
         case 'h':
             usage(stdout);
             printf("Run the driver with the `-h' option for more info\n");
@@ -112,7 +154,11 @@ int main(int argc, char *argv[])
                 add_angle_dir(argv[++i]);
             break;
         case 'i':
-            if (argv[i][2] != '\0')
+            if (equal(argv[i], "-include-pch")) {
+                if (argv[i+1] == NULL)
+                    missing_arg(argv[i]);
+                pch_path = argv[++i];
+            } else if (argv[i][2] != '\0')
                 add_quote_dir(argv[i]+2);
             else if (argv[i+1] == NULL)
                 missing_arg(argv[i]);
@@ -187,6 +233,12 @@ int main(int argc, char *argv[])
         case 'T':
             flags |= OPT_DUMP_TOKENS;
             break;
+        case 'O':
+            if (argv[i][2] != '\0')
+                opt_level = atoi(argv[i]+2);
+            else
+                opt_level = 1;
+            break;
         case 'v':
             verbose_asm = TRUE;
             break;
@@ -199,6 +251,7 @@ int main(int argc, char *argv[])
         case '\0': /* stray '-' */
             break;
         default:
+        unknown:
             fprintf(stderr, "%s: unknown option `%s'\n", program_name, argv[i]);
             exit(EXIT_FAILURE);
         }
@@ -240,34 +293,66 @@ int main(int argc, char *argv[])
         install_macro(SIMPLE_MACRO, "__i386__", &one_node, NULL);
         break;
     }
+    if ((flags & OPT_OBJECT) && !(flags & (OPT_X86_TARGET|OPT_X64_TARGET))) {
+        fprintf(stderr, "%s: -c is only supported for x86 and x64\n", program_name);
+        exit(EXIT_FAILURE);
+    }
     install_macro(SIMPLE_MACRO, "__unix__", &one_node, NULL);
     install_macro(SIMPLE_MACRO, "__linux__", &one_node, NULL);
     install_macro(SIMPLE_MACRO, "__gnu_linux__", &one_node, NULL);
 
-    pre = preprocess(inpath);
+    if (pch_path != NULL)
+        pch_defs = pch_read(pch_path);
+    preprocess(inpath);
     if (flags & OPT_PREPROCESS_ONLY) {
         PreTokenNode *p;
 
         fp = (outpath == NULL) ? stdout : fopen(outpath, "wb");
-        for (p = pre; p != NULL; p = p->next)
-            if (!p->deleted || p->token==PRE_TOK_NL)
-                fprintf(fp, "%s ", p->lexeme);
+        while ((p=get_pre_token())->token != PRE_TOK_EOF) {
+            fprintf(fp, "%s ", p->lexeme);
+            free_pre_token(p);
+        }
+        fprintf(fp, "%s ", p->lexeme);
         fprintf(fp, "\n");
         goto done;
     }
 
-    tok = tokenize(pre);
+    if (flags & OPT_EMIT_PCH) {
+        char *pch_outpath;
+
+        pch_defs = parse_header(get_c_token());
+        if (error_count != 0)
+            return 1;
+        pch_outpath = (outpath != NULL) ? outpath : replace_extension(inpath, ".pch");
+        pch_write(pch_outpath, pch_defs);
+        if (pch_outpath != outpath)
+            free(pch_outpath);
+        goto done;
+    }
+
+    /*
+     * The parser requests the tokens as it needs them. To dump them all
+     * beforehand, the complete sequence is built first and then parsed.
+     * The definitions of a precompiled header precede the file's tokens.
+     */
+    tok = (pch_defs != NULL) ? pch_defs : get_c_token();
     if (flags & OPT_DUMP_TOKENS) {
         TokenNode *p;
         char *tok_outpath;
 
         tok_outpath = replace_extension(inpath, ".tok");
         fp = fopen(tok_outpath, "wb");
-        for (p = tok; p != NULL; p = p->next)
+        for (p = tok; ; p = p->next) {
             fprintf(fp, "%s:%d:%-3d =>   token: %-15s lexeme: `%s'\n", p->src_file, p->src_line,
             p->src_column, token_table[p->token*2], p->lexeme);
+            if (p->token == TOK_EOF)
+                break;
+            if (p->next == NULL)
+                p->next = get_c_token();
+        }
         free(tok_outpath);
         fclose(fp);
+        fp = NULL;
     }
 
     /* parse & analyze */
@@ -284,7 +369,8 @@ int main(int argc, char *argv[])
         goto done;
 
     if (error_count == 0) {
-        fp = (outpath == NULL) ? stdout : fopen(outpath, "wb");
+        if (!(flags & OPT_OBJECT))
+            fp = (outpath == NULL) ? stdout : fopen(outpath, "wb");
         switch (flags & TARGET_MASK) {
         case OPT_X86_TARGET:
         case OPT_X64_TARGET:
@@ -294,6 +380,11 @@ int main(int argc, char *argv[])
             if (cfg_function_to_print != NULL) cfg_outpath = replace_extension(inpath, ".cfg.dot");
             if (flags & OPT_PRINT_CG)          cg_outpath = replace_extension(inpath, ".cg.dot");
 
+#ifdef INTEGRATED_AS
+            if (flags & OPT_OBJECT)
+                emit_object(flags & OPT_X64_TARGET, inpath, outpath);
+            else
+#endif
             switch (flags & TARGET_MASK) {
             case OPT_X86_TARGET:  x86_cgen(fp); break;
             case OPT_X64_TARGET:  x64_cgen(fp); break;
@@ -27,5 +27,6 @@ extern unsigned stat_number_of_pre_tokens;
 extern unsigned stat_number_of_c_tokens;
 extern unsigned stat_number_of_ast_nodes;
 extern int verbose_asm;
+extern int opt_level;
 
 #endif
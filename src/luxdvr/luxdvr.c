@@ -9,6 +9,9 @@
 #include <sys/wait.h>
 #include <assert.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <poll.h>
 #include <ctype.h>
 #include "../util/util.h"
 #include "../util/str.h"
@@ -25,12 +28,16 @@ char helpstr[] =
     "  -use-musl        Link against musl standard library\n"
     "  -use-glibc       Link against glibc standard library\n"
     "  -static          Link against a static version of libc\n"
+    "  -j<n>            Compile up to <n> files at the same time\n"
+    "  -integrated-as   Assemble within the compiler (x86 and x64 only)\n"
     "  -v               Show invoked commands\n"
     "  -h               Print this help\n"
     "\nCompiler options:\n"
     "  -q               Disable all warnings\n"
+    "  -O<n>            Set optimization level to <n> (-O alone means -O1)\n"
     "  -I<dir>          Add <dir> to the list of directories searched for #include <...>\n"
     "  -i<dir>          Add <dir> to the list of directories searched for #include \"...\"\n"
+    "  -include-pch <f> Use precompiled header <f> (made with luxcc -emit-pch)\n"
     "  -analyze         Perform static analysis only\n"
     "  -show-stats      Show compilation stats\n"
     "  -D<name>         Predefine <name> as a macro, with definition 1\n"
@@ -50,6 +57,7 @@ char helpstr[] =
 ;
 
 int verbose;
+int max_parallel = 1; /* -j */
 char *prog_name;
 
 enum {
@@ -61,6 +69,7 @@ enum {
     DVR_GLIBC           = 0x00020,
     DVR_MUSL            = 0x00040,
     DVR_STATIC          = 0x00080,
+    DVR_INTEGRATED_AS   = 0x00100,
     DVR_VM32_TARGET     = 0x01000,
     DVR_VM64_TARGET     = 0x02000,
     DVR_X86_TARGET      = 0x04000,
@@ -151,28 +160,337 @@ char *strbuf(String *s)
     return buf;
 }
 
-int exec_cmd(String *cmd)
+/*
+ * Commands are executed directly (without a shell). Because of this, the
+ * arguments of a command line are just split at the blanks.
+ */
+char **split_cmd(char *buf)
+{
+    int n;
+    char **argv, *p;
+
+    for (n = 0, p = buf; *p != '\0'; p++)
+        if (*p == ' ')
+            ++n;
+    argv = malloc(sizeof(char *)*(n+2));
+    n = 0;
+    for (p = strtok(buf, " "); p != NULL; p = strtok(NULL, " "))
+        argv[n++] = p;
+    argv[n] = NULL;
+    return argv;
+}
+
+/* start `cmd' with standard input/output redirected to in_fd/out_fd (if not -1) */
+pid_t spawn_cmd(char *cmd, int in_fd, int out_fd)
+{
+    pid_t pid;
+    char **argv;
+
+    fflush(NULL);
+    if ((pid=fork()) == -1)
+        TERMINATE("%s: error: cannot create process", prog_name);
+    if (pid == 0) {
+        if (in_fd != -1) {
+            dup2(in_fd, 0);
+            close(in_fd);
+        }
+        if (out_fd != -1) {
+            dup2(out_fd, 1);
+            close(out_fd);
+        }
+        argv = split_cmd(cmd);
+        execvp(argv[0], argv);
+        fprintf(stderr, "%s: error: cannot execute `%s'\n", prog_name, argv[0]);
+        _exit(127);
+    }
+    return pid;
+}
+
+/* wait for `pid' to finish and return its exit status (1 if it was killed) */
+int wait_cmd(pid_t pid)
 {
     int status;
+
+    while (waitpid(pid, &status, 0) == -1)
+        ;
+    if (!WIFEXITED(status))
+        return 1;
+    return WEXITSTATUS(status);
+}
+
+/*
+ * Run a pipeline of one or two commands (e.g. the compiler piping the
+ * assembly it generates into the assembler).
+ */
+int run_cmds(char **cmds, int ncmds)
+{
+    int fd[2], st1, st2;
+    pid_t p1, p2;
+    struct pollfd pfd;
+
+    if (verbose) {
+        if (ncmds == 1)
+            printf("%s\n", cmds[0]);
+        else
+            printf("%s | %s\n", cmds[0], cmds[1]);
+    }
+    if (ncmds == 1)
+        return wait_cmd(spawn_cmd(cmds[0], -1, -1));
+
+    if (pipe(fd) == -1)
+        TERMINATE("%s: error: cannot create pipe", prog_name);
+    fcntl(fd[0], F_SETFD, FD_CLOEXEC);
+    fcntl(fd[1], F_SETFD, FD_CLOEXEC);
+    p1 = spawn_cmd(cmds[0], -1, fd[1]);
+    close(fd[1]);
+
+    /*
+     * Do not start the second command until the first one writes something.
+     * A compiler that fails because of errors in the source produces no
+     * output at all, and there is no point in assembling that.
+     */
+    pfd.fd = fd[0];
+    pfd.events = POLLIN;
+    while (poll(&pfd, 1, -1) == -1)
+        ;
+    st1 = -1;
+    if (!(pfd.revents & POLLIN) && (st1=wait_cmd(p1))!=0) {
+        close(fd[0]);
+        return st1;
+    }
+    p2 = spawn_cmd(cmds[1], fd[0], -1);
+    close(fd[0]);
+    if (st1==-1 && (st1=wait_cmd(p1))!=0)
+        kill(p2, SIGTERM); /* do not assemble partial output */
+    st2 = wait_cmd(p2);
+    return st1 ? st1 : st2;
+}
+
+/*
+ * Like run_cmds(), but if the pipeline fails remove `out' (the file it
+ * writes, if not NULL): the assembler may have written part of an object
+ * file before the compiler failed.
+ */
+int run_pipeline(char **cmds, int ncmds, char *out)
+{
+    int st;
+
+    st = run_cmds(cmds, ncmds);
+    if (st && out!=NULL)
+        unlink(out);
+    return st;
+}
+
+int exec_cmd(String *cmd)
+{
     char *buf;
 
     buf = strbuf(cmd);
-    if (verbose)
-        printf("%s\n", buf);
+    return run_pipeline(&buf, 1, NULL);
+}
 
-    if ((status=system(buf)) == -1)
-        TERMINATE("%s: error: cannot execute `%s'", prog_name, buf);
-    if (!WIFEXITED(status))
-        exit(1);
-    return WEXITSTATUS(status);
+/*
+ * Temporary files (deleted before exit).
+ */
+char **tmp_files;
+int ntmp_files, max_tmp_files;
+
+char *add_tmp_file(char *path)
+{
+    if (ntmp_files >= max_tmp_files) {
+        max_tmp_files = (max_tmp_files == 0) ? 16 : max_tmp_files*2;
+        tmp_files = realloc(tmp_files, max_tmp_files*sizeof(char *));
+    }
+    tmp_files[ntmp_files++] = path;
+    return path;
 }
 
+char *new_tmp_file(char *ext)
+{
+    char *path;
+
+    path = malloc(strlen("/tmp/luxXXXXXX")+strlen(ext)+1);
+    sprintf(path, "/tmp/luxXXXXXX%s", ext);
+    if (mkstemps(path, strlen(ext)) == -1)
+        TERMINATE("%s: error: cannot create temporary file", prog_name);
+    return add_tmp_file(path);
+}
+
+/*
+ * Jobs.
+ * A job is a pipeline of commands (e.g. compile a file and assemble the
+ * output as it is generated, see run_pipeline()). Jobs are queued and then
+ * run with run_jobs(). With -j<n>, up to n jobs run at the same time;
+ * the output of each one is collected and printed when it finishes, so the
+ * diagnostics of different files do not get mixed up.
+ */
+typedef struct Job Job;
+struct Job {
+    char *cmds[2];
+    int ncmds;
+    char *out;  /* file written by the job (removed if the job fails) */
+    pid_t pid;
+    int out_fd, err_fd; /* collected stdout/stderr */
+};
+
+Job *jobs;
+int njobs, max_jobs;
+
+Job *new_job(void)
+{
+    if (njobs >= max_jobs) {
+        max_jobs = (max_jobs == 0) ? 16 : max_jobs*2;
+        jobs = realloc(jobs, max_jobs*sizeof(Job));
+    }
+    jobs[njobs].ncmds = 0;
+    jobs[njobs].out = NULL;
+    return &jobs[njobs++];
+}
+
+void job_add_cmd(Job *j, String *cmd)
+{
+    assert(j->ncmds < NELEMS(j->cmds));
+    j->cmds[j->ncmds++] = strdup(strbuf(cmd));
+}
+
+/* an unlinked temporary file (it goes away when closed) */
+int anon_tmp_file(void)
+{
+    int fd;
+    char path[] = "/tmp/luxXXXXXX";
+
+    if ((fd=mkstemp(path)) == -1)
+        TERMINATE("%s: error: cannot create temporary file", prog_name);
+    unlink(path);
+    return fd;
+}
+
+void start_job(Job *j)
+{
+    j->out_fd = anon_tmp_file();
+    j->err_fd = anon_tmp_file();
+    fflush(NULL);
+    if ((j->pid=fork()) == -1)
+        TERMINATE("%s: error: cannot create process", prog_name);
+    if (j->pid == 0) {
+        dup2(j->out_fd, 1);
+        dup2(j->err_fd, 2);
+        exit(!!run_pipeline(j->cmds, j->ncmds, j->out));
+    }
+}
+
+void copy_output(int fd, FILE *fp)
+{
+    char buf[4096];
+    ssize_t n;
+
+    lseek(fd, 0, SEEK_SET);
+    while ((n=read(fd, buf, sizeof(buf))) > 0)
+        fwrite(buf, 1, n, fp);
+    fflush(fp);
+    close(fd);
+}
+
+/* run the queued jobs; return non-zero if some of them failed */
+int run_jobs(void)
+{
+    int i, k, status, running, next, failed;
+    pid_t pid;
+
+    failed = FALSE;
+    if (max_parallel == 1) {
+        for (i = 0; i < njobs; i++)
+            if (run_pipeline(jobs[i].cmds, jobs[i].ncmds, jobs[i].out))
+                failed = TRUE;
+    } else {
+        running = next = 0;
+        while (next<njobs || running>0) {
+            if (next<njobs && running<max_parallel) {
+                start_job(&jobs[next++]);
+                ++running;
+                continue;
+            }
+            if ((pid=wait(&status)) == -1)
+                TERMINATE("%s: error: wait failed", prog_name);
+            for (i = 0; i<next && jobs[i].pid!=pid; i++)
+                ;
+            if (i == next)
+                continue;
+            --running;
+            copy_output(jobs[i].out_fd, stdout);
+            copy_output(jobs[i].err_fd, stderr);
+            if (!WIFEXITED(status) || WEXITSTATUS(status)!=0)
+                failed = TRUE;
+        }
+    }
+    for (i = 0; i < njobs; i++)
+        for (k = 0; k < jobs[i].ncmds; k++)
+            free(jobs[i].cmds[k]);
+    njobs = 0;
+    return failed;
+}
+
+/*
+ * The assembler takes -f<name>, so it can be told the name of the C file
+ * whose code it reads from the pipe (the object file would say `stdin'
+ * otherwise). The VM one doesn't record any file name.
+ */
+int as_takes_name;
+
+/*
+ * Queue the compilation of the C file `path' into the object file `obj'.
+ * With the integrated assembler the compiler writes the object file itself;
+ * otherwise its output is piped into the assembler, which is given `path'
+ * as the name of its input.
+ */
+void add_compile_job(String *cc_cmd, String *as_cmd, char *path, char *obj, int integrated_as)
+{
+    Job *j;
+    unsigned cpos, apos;
+
+    cpos = string_get_pos(cc_cmd);
+    apos = string_get_pos(as_cmd);
+    j = new_job();
+    j->out = obj;
+    if (integrated_as) {
+        string_printf(cc_cmd, " -c %s -o %s", path, obj);
+        job_add_cmd(j, cc_cmd);
+    } else {
+        string_printf(cc_cmd, " %s", path);
+        job_add_cmd(j, cc_cmd);
+        if (as_takes_name)
+            string_printf(as_cmd, " -f %s", path);
+        string_printf(as_cmd, " - -o %s", obj);
+        job_add_cmd(j, as_cmd);
+    }
+    string_set_pos(cc_cmd, cpos);
+    string_set_pos(as_cmd, apos);
+}
+
+/* is `exe' an executable file in one of the directories of PATH? */
 int is_in_path(char *exe)
 {
-    char cmd[64];
+    char *dirs, *dir, *end, path[256];
+    int n;
 
-    sprintf(cmd, "which %s >/dev/null", exe);
-    return (WEXITSTATUS(system(cmd)) == 0);
+    if ((dirs=getenv("PATH")) == NULL)
+        return FALSE;
+    for (;;) {
+        if ((end=strchr(dirs, ':')) == NULL)
+            end = dirs+strlen(dirs);
+        dir = dirs, n = (int)(end-dirs);
+        if (n == 0) /* an empty entry is the current directory */
+            dir = ".", n = 1;
+        if (n+strlen(exe)+2 <= sizeof(path)) {
+            sprintf(path, "%.*s/%s", n, dir, exe);
+            if (access(path, X_OK) == 0)
+                return TRUE;
+        }
+        if (*end == '\0')
+            break;
+        dirs = end+1;
+    }
+    return FALSE;
 }
 
 void delete_file(char *path)
@@ -182,6 +500,17 @@ void delete_file(char *path)
     unlink(path);
 }
 
+void delete_tmp_files(void)
+{
+    int i;
+
+    for (i = 0; i < ntmp_files; i++) {
+        delete_file(tmp_files[i]);
+        free(tmp_files[i]);
+    }
+    ntmp_files = 0;
+}
+
 /*
  * Syntax of a .conf file:
  *
@@ -300,13 +629,11 @@ void missing_arg(char *opt)
 
 int main(int argc, char *argv[])
 {
-    int i, exst;
+    int i, exst, integrated_as;
     unsigned driver_flags;
-    char *outpath, *alt_asm_tmp, *chp;
+    char *outpath, *chp;
     String *cc_cmd, *as_cmd, *ld_cmd;
     File *infiles;
-    char asm_tmp[] = "/tmp/luxXXXXXX.s";
-    char obj_tmp[] = "/tmp/luxXXXXXX.o";
 	int got_arch = FALSE;
 
     prog_name = argv[0];
@@ -321,7 +648,7 @@ int main(int argc, char *argv[])
 #else
     driver_flags = DVR_X86_TARGET;
 #endif
-    outpath = alt_asm_tmp = NULL;
+    outpath = NULL;
     cc_cmd = string_new(32); string_printf(cc_cmd, "");
     as_cmd = string_new(32); string_printf(as_cmd, "");
     ld_cmd = string_new(32); string_printf(ld_cmd, "");
@@ -358,19 +685,15 @@ int main(int argc, char *argv[])
                     driver_flags |= DVR_ANALYZE_ONLY;
                 } else if (strncmp(argv[i], "-alt-asm-tmp", 12) == 0) {
                     /*
-                     * This option is only used when self-compiling in targets
-                     * that use ELF as the object file format.
-                     * It is necessary because otherwise the temporary asm file
-                     * name that will be embedded into the object files will be
-                     * different from one invocation to the other and the comparison
-                     * of binaries will fail.
+                     * Obsolete (accepted for compatibility). The assembly
+                     * is now piped into the assembler, so there is no
+                     * temporary asm file whose name could end up embedded
+                     * into the object files.
                      */
                     if (argv[i][12] == '\0') {
                         if (argv[i+1] == NULL)
                             missing_arg(argv[i]);
-                        alt_asm_tmp = argv[++i];
-                    } else {
-                        alt_asm_tmp = argv[i]+12;
+                        ++i;
                     }
                 } else {
                     unknown_opt(argv[i]);
@@ -441,13 +764,28 @@ int main(int argc, char *argv[])
                 break;
             case 'I':
             case 'i':
+                if (equal(argv[i], "-integrated-as")) {
+                    driver_flags |= DVR_INTEGRATED_AS;
+                    break;
+                }
                 string_printf(cc_cmd, " %s", argv[i]);
-                if (argv[i][2] == '\0') {
+                if (argv[i][2]=='\0' || equal(argv[i], "-include-pch")) {
                     if (argv[i+1] == NULL)
                         missing_arg(argv[i]);
                     string_printf(cc_cmd, " %s", argv[++i]);
                 }
                 break;
+            case 'j':
+                if (argv[i][2] == '\0') {
+                    if (argv[i+1] == NULL)
+                        missing_arg(argv[i]);
+                    chp = argv[++i];
+                } else {
+                    chp = argv[i]+2;
+                }
+                if ((max_parallel=atoi(chp)) < 1)
+                    TERMINATE("%s: invalid number of jobs `%s'", prog_name, chp);
+                break;
             case 'm': {
                 char *m;
 
@@ -489,6 +827,7 @@ int main(int argc, char *argv[])
                 if (outpath == NULL)
                     missing_arg("-o");
                 break;
+            case 'O':
             case 'q':
                 string_printf(cc_cmd, " %s", argv[i]);
                 break;
@@ -795,6 +1134,8 @@ ok_1:
         string_printf(cc_cmd, " -D_GLIBC");
     else if (driver_flags & DVR_MUSL)
         string_printf(cc_cmd, " -D_MUSL");
+    integrated_as = (driver_flags&DVR_INTEGRATED_AS) && (driver_flags&(DVR_X86_TARGET|DVR_X64_TARGET));
+    as_takes_name = !(driver_flags&(DVR_VM32_TARGET|DVR_VM64_TARGET));
     if (driver_flags & DVR_ANALYZE_ONLY) {
         File *fp;
         unsigned pos;
@@ -806,10 +1147,10 @@ ok_1:
             if (fp->kind != C_Kind)
                 continue;
             string_printf(cc_cmd, " %s", fp->path);
-            if (exec_cmd(cc_cmd))
-                exst = 1;
+            job_add_cmd(new_job(), cc_cmd);
             string_set_pos(cc_cmd, pos);
         }
+        exst = run_jobs();
     } else if (driver_flags & (DVR_PREP_ONLY|DVR_COMP_ONLY)) {
         File *fp;
 
@@ -828,29 +1169,22 @@ ok_1:
                 if (fp->kind != C_Kind)
                     continue;
                 string_printf(cc_cmd, " %s", fp->path);
-                if (exec_cmd(cc_cmd))
-                    exst = 1;
+                job_add_cmd(new_job(), cc_cmd);
                 string_set_pos(cc_cmd, pos);
             }
+            exst = run_jobs();
         }
     } else if (driver_flags & DVR_NOLINK) {
         File *fp;
 
         if (ncfls==0 && nasmfls==0)
             goto done;
-        if (ncfls != 0)
-            mkstemps(asm_tmp, 2);
         if (outpath != NULL) { /* there is a single C/ASM input file */
             if (ncfls != 0) {
                 for (fp = infiles; fp->kind != C_Kind; fp = fp->next)
                     ;
-                string_printf(cc_cmd, " %s -o %s", fp->path, asm_tmp);
-                if (exec_cmd(cc_cmd) == 0) {
-                    string_printf(as_cmd, " %s -o %s", asm_tmp, outpath);
-                    exst = !!exec_cmd(as_cmd);
-                } else {
-                    exst = 1;
-                }
+                add_compile_job(cc_cmd, as_cmd, fp->path, outpath, integrated_as);
+                exst = run_jobs();
             } else {
                 for (fp = infiles; fp->kind != ASM_Kind; fp = fp->next)
                     ;
@@ -859,89 +1193,49 @@ ok_1:
             }
         } else {
             char *s;
-            unsigned cpos, apos;
+            unsigned apos;
 
-            cpos = string_get_pos(cc_cmd);
             apos = string_get_pos(as_cmd);
             for (fp = infiles; fp != NULL; fp = fp->next) {
                 if (fp->kind != C_Kind)
                     continue;
-                string_printf(cc_cmd, " %s -o %s", fp->path, asm_tmp);
-                if (exec_cmd(cc_cmd) == 0) {
-                    s = replace_extension(fp->path, ".o");
-                    string_printf(as_cmd, " %s -o %s", asm_tmp, s);
-                    free(s);
-                    if (exec_cmd(as_cmd))
-                        exst = 1;
-                    string_set_pos(as_cmd, apos);
-                } else {
-                    exst = 1;
-                }
-                string_set_pos(cc_cmd, cpos);
+                s = replace_extension(fp->path, ".o");
+                add_compile_job(cc_cmd, as_cmd, fp->path, s, integrated_as);
+                free(s);
             }
             for (fp = infiles; fp != NULL; fp = fp->next) {
                 if (fp->kind != ASM_Kind)
                     continue;
                 s = replace_extension(fp->path, ".o");
                 string_printf(as_cmd, " %s -o %s", fp->path, s);
+                job_add_cmd(new_job(), as_cmd);
                 free(s);
-                if (exec_cmd(as_cmd))
-                    exst = 1;
                 string_set_pos(as_cmd, apos);
             }
+            exst = run_jobs();
         }
-        if (ncfls != 0)
-            delete_file(asm_tmp);
     } else {
-        int ntmp;
-        char *obj_tmps[64];
-        unsigned cpos, apos;
-        char *asm_tmp_p;
+        unsigned apos;
         File *fp;
 
-        if (ncfls != 0) {
-            if (alt_asm_tmp != NULL) {
-                asm_tmp_p = alt_asm_tmp;
-            } else {
-                asm_tmp_p = asm_tmp;
-                mkstemps(asm_tmp_p, 2);
-            }
-        }
-        ntmp = 0;
-        cpos = string_get_pos(cc_cmd);
         apos = string_get_pos(as_cmd);
         for (fp = infiles; fp != NULL; fp = fp->next) {
             if (fp->kind != C_Kind)
                 continue;
-            string_printf(cc_cmd, " %s -o %s", fp->path, asm_tmp_p);
-            if (exec_cmd(cc_cmd) == 0) {
-                sprintf(obj_tmp, "/tmp/luxXXXXXX.o");
-                mkstemps(obj_tmp, 2);
-                obj_tmps[ntmp++] = strdup(obj_tmp);
-                string_printf(as_cmd, " %s -o %s", asm_tmp_p, obj_tmp);
-                fp->kind = OTHER_Kind;
-                fp->path = obj_tmps[ntmp-1];
-                if (exec_cmd(as_cmd))
-                    exst = 1;
-                string_set_pos(as_cmd, apos);
-            } else {
-                exst = 1;
-            }
-            string_set_pos(cc_cmd, cpos);
+            fp->kind = OTHER_Kind;
+            add_compile_job(cc_cmd, as_cmd, fp->path, new_tmp_file(".o"), integrated_as);
+            fp->path = tmp_files[ntmp_files-1];
         }
         for (fp = infiles; fp != NULL; fp = fp->next) {
             if (fp->kind != ASM_Kind)
                 continue;
-            sprintf(obj_tmp, "/tmp/luxXXXXXX.o");
-            mkstemps(obj_tmp, 2);
-            obj_tmps[ntmp++] = strdup(obj_tmp);
-            string_printf(as_cmd, " %s -o %s", fp->path, obj_tmps);
+            string_printf(as_cmd, " %s -o %s", fp->path, new_tmp_file(".o"));
             fp->kind = OTHER_Kind;
-            fp->path = obj_tmps[ntmp-1];
-            if (exec_cmd(as_cmd))
-                exst = 1;
+            fp->path = tmp_files[ntmp_files-1];
+            job_add_cmd(new_job(), as_cmd);
             string_set_pos(as_cmd, apos);
         }
+        exst = run_jobs();
         if (exst == 0) {
             for (fp = infiles; fp != NULL; fp = fp->next)
                 string_printf(ld_cmd, " %s", fp->path);
@@ -949,14 +1243,9 @@ ok_1:
                 string_printf(ld_cmd, " -o %s", outpath);
             exst = !!exec_cmd(ld_cmd);
         }
-        if (alt_asm_tmp==NULL && ncfls!=0)
-            delete_file(asm_tmp_p);
-        for (i = 0; i < ntmp; i++) {
-            delete_file(obj_tmps[i]);
-            free(obj_tmps[i]);
-        }
     }
 done:
+    delete_tmp_files();
     string_free(cc_cmd);
     string_free(as_cmd);
     string_free(ld_cmd);
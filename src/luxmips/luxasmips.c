@@ -1641,12 +1641,12 @@ void err_no_input(void)
 int main(int argc, char *argv[])
 {
     int i;
-    char *outpath;
+    char *outpath, *name;
 
     prog_name = argv[0];
     if (argc == 1)
         err_no_input();
-    outpath = inpath = NULL;
+    outpath = inpath = name = NULL;
     for (i = 1; i < argc; i++) {
         if (argv[i][0]!='-' || argv[i][1]=='\0') {
             inpath = argv[i];
@@ -1661,10 +1661,19 @@ int main(int argc, char *argv[])
             else
                 outpath = argv[++i];
             break;
+        case 'f':
+            if (argv[i][2] != '\0')
+                name = argv[i]+2;
+            else if (argv[i+1] == NULL)
+                TERMINATE("%s: option `f' requires an argument\n", prog_name);
+            else
+                name = argv[++i];
+            break;
         case 'h':
             printf("usage: %s [ options ] <input-file>\n"
                    "  The available options are:\n"
                    "    -o<file>    write output to <file>\n"
+                   "    -f<name>    name the input <name> in diagnostics and in the object file\n"
                    "    -h          print this help\n", prog_name);
             exit(EXIT_SUCCESS);
             break;
@@ -1674,7 +1683,14 @@ int main(int argc, char *argv[])
     }
     if (inpath == NULL)
         err_no_input();
-    curr = buf = read_file(inpath);
+    if (equal(inpath, "-")) {
+        curr = buf = read_stream(stdin);
+        inpath = "stdin";
+    } else {
+        curr = buf = read_file(inpath);
+    }
+    if (name != NULL)
+        inpath = name;
     curr_tok = get_token();
     program();
     resolve_expressions();
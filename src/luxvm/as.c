@@ -60,6 +60,7 @@ int lineno = 1;
 Token curr_tok;
 int targeting_vm64;
 int reading_from_stdin;
+int ncombined; /* number of superinstructions formed */
 
 #define ASSEMBLER_ERR(...)  fprintf(stderr, "%s: line %d: ", prog_name, lineno), TERMINATE(__VA_ARGS__)
 
@@ -68,6 +69,7 @@ void match(Token expected);
 void program(void);
 void statement(void);
 void instruction(char *operation);
+void flush_window(void);
 void label(char *id);
 void directive(void);
 int read_line(void);
@@ -428,6 +430,7 @@ int main(int argc, char *argv[])
         printf("Data size: %d\n", data_size);
         printf("Bss size: %d\n", bss_size);
         printf("Number of relocations: %d\n", nreloc);
+        printf("Combined instructions: %d\n", ncombined);
     }
 
     free(text_seg);
@@ -443,6 +446,7 @@ void program(void)
     statement();
     while (curr_tok != TOK_EOF)
         statement();
+    flush_window();
 }
 
 /* statement = instruction | label | directive */
@@ -467,31 +471,134 @@ void statement(void)
 /* label = id ":" */
 void label(char *id)
 {
+    flush_window();
     define_symbol(id, LOCAL_SYM, curr_segment, CURR_OFFS());
     match(TOK_COLON);
 }
 
+/*
+ * Superinstructions.
+ *
+ * Instructions are not written as soon as they are parsed; the last few are
+ * kept in a window where frequent sequences are replaced by the equivalent
+ * superinstruction (see vm.h). Labels and directives flush the window, so a
+ * sequence is never combined across a jump target.
+ */
+typedef struct Instr Instr;
+struct Instr {
+    int opcode;
+    int has_operand;
+    char *sym;      /* symbolic operand, or NULL */
+    long long val;  /* numeric operand */
+};
+#define WINDOW_SIZE 4
+Instr window[WINDOW_SIZE];
+int nwindow;
+
+void write_instr(Instr *p)
+{
+    write_byte(p->opcode);
+    if (!p->has_operand)
+        return;
+    if (p->sym != NULL) {
+        append_reloc(curr_segment, CURR_OFFS(), p->sym);
+        free(p->sym);
+        if (targeting_vm64)
+            write_qword(0);
+        else
+            write_dword(0);
+    } else if (p->opcode == OpLdIQW) {
+        write_qword(p->val);
+    } else {
+        write_dword((int)p->val);
+    }
+}
+
+void flush_window(void)
+{
+    int i;
+
+    for (i = 0; i < nwindow; i++)
+        write_instr(&window[i]);
+    nwindow = 0;
+}
+
+Instr *new_instr(int opcode, int has_operand)
+{
+    Instr *p;
+
+    if (nwindow == WINDOW_SIZE) {
+        write_instr(&window[0]);
+        memmove(&window[0], &window[1], (WINDOW_SIZE-1)*sizeof(Instr));
+        --nwindow;
+    }
+    p = &window[nwindow++];
+    p->opcode = opcode;
+    p->has_operand = has_operand;
+    p->sym = NULL;
+    p->val = 0;
+    return p;
+}
+
+/* window[nwindow-k] is the k-th instruction counting from the end of the window */
+#define LAST(k)         (&window[nwindow-(k)])
+#define NUM_OPND(p)     ((p)->has_operand && (p)->sym==NULL)
+
+void combine_instructions(void)
+{
+    Instr *a, *b;
+
+    for (;;) {
+        if (nwindow >= 4
+        && LAST(4)->opcode==OpLdLDW && LAST(3)->opcode==OpAddIDW
+        && LAST(2)->opcode==OpStLDW && LAST(1)->opcode==OpPop
+        && NUM_OPND(LAST(3)) && (LAST(3)->val==1 || LAST(3)->val==-1)
+        && LAST(4)->val==LAST(2)->val) {
+            LAST(4)->opcode = (LAST(3)->val == 1) ? OpIncLDW : OpDecLDW;
+            nwindow -= 3;
+        } else if (nwindow >= 2 && NUM_OPND(LAST(2))) {
+            a = LAST(2), b = LAST(1);
+            if (a->opcode == OpLdBP) {
+                switch (b->opcode) {
+                case OpLdDW: a->opcode = OpLdLDW; break;
+                case OpLdQW: a->opcode = OpLdLQW; break;
+                case OpStDW: a->opcode = OpStLDW; break;
+                case OpStQW: a->opcode = OpStLQW; break;
+                default: return;
+                }
+            } else if (a->opcode == OpLdIDW) {
+                if (b->opcode == OpAddDW)
+                    a->opcode = OpAddIDW;
+                else if (b->opcode == OpSubDW)
+                    a->opcode = OpAddIDW, a->val = -a->val;
+                else
+                    return;
+            } else {
+                return;
+            }
+            --nwindow;
+        } else {
+            return;
+        }
+        ++ncombined;
+    }
+}
+
 /* instruction = operation [ operand ] ";" */
 void instruction(char *operation)
 {
     Operation *op_entry;
+    Instr *p;
 
     if ((op_entry=lookup_operation(operation)) == NULL)
         ASSEMBLER_ERR("unknown operation `%s'", operation);
-    write_byte(op_entry->opcode);
+    p = new_instr(op_entry->opcode, op_entry->has_operand);
     if (op_entry->has_operand) {
         if (curr_tok == TOK_ID) {
-            append_reloc(curr_segment, CURR_OFFS(), lexeme);
+            p->sym = strdup(lexeme);
             match(TOK_ID);
-            if (targeting_vm64)
-                write_qword(0);
-            else
-                write_dword(0);
         } else if (curr_tok == TOK_NUM) {
-            if (op_entry->opcode == OpLdIQW)
-                write_qword(get_int(lexeme));
-            else
-                write_dword((int)get_int(lexeme));
+            p->val = get_int(lexeme);
             match(TOK_NUM);
         } else if (curr_tok == TOK_SEMI) {
             ASSEMBLER_ERR("operation `%s' requires an operand", operation);
@@ -500,6 +607,10 @@ void instruction(char *operation)
         }
     }
     match(TOK_SEMI);
+    if (curr_segment == TEXT_SEG)
+        combine_instructions();
+    else
+        flush_window();
 }
 
 void globalize_symbol(char *name)
@@ -532,6 +643,7 @@ void globalize_symbol(char *name)
  */
 void directive(void)
 {
+    flush_window();
     match(TOK_DOT);
     if (curr_tok != TOK_ID)
         ASSEMBLER_ERR("expecting directive (got `%s')", lexeme);
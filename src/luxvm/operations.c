@@ -86,6 +86,8 @@ static Operation operations[] = {
     { "swap2",      OpSwap2,    0 },
     { "switch",     OpSwitch,   0 },
     { "switch2",    OpSwitch2,  0 },
+    { "jmptab",     OpJmpTab,   0 },
+    { "jmptab2",    OpJmpTab2,  0 },
     { "pushsp",     OpPushSP,   0 },
     /* operations with operand */
     { "ldn",        OpLdN,      1 },
@@ -101,6 +103,18 @@ static Operation operations[] = {
     { "addsp",      OpAddSP,    1 },
     { "fill",       OpFill,     1 },
     { "libcall",    OpLibCall,  1 },
+    /* superinstructions */
+    { "ldldw",      OpLdLDW,    1 },
+    { "ldlqw",      OpLdLQW,    1 },
+    { "stldw",      OpStLDW,    1 },
+    { "stlqw",      OpStLQW,    1 },
+    { "addidw",     OpAddIDW,   1 },
+    { "incldw",     OpIncLDW,   1 },
+    { "decldw",     OpDecLDW,   1 },
+    { "ldxb",       OpLdXB,     1 },
+    { "ldxub",      OpLdXUB,    1 },
+    { "ldxdw",      OpLdXDW,    1 },
+    { "ldxqw",      OpLdXQW,    1 },
 };
 
 static int cmp_op(const void *p1, const void *p2)
@@ -126,3 +140,13 @@ Operation *lookup_operation(char *op_str)
 
     return res;
 }
+
+char *get_operation_name(int opcode)
+{
+    unsigned i;
+
+    for (i = 0; i < NELEMS(operations); i++)
+        if (operations[i].opcode == opcode)
+            return operations[i].str;
+    return "???";
+}
@@ -9,5 +9,6 @@ struct Operation {
 };
 
 Operation *lookup_operation(char *op_str);
+char *get_operation_name(int opcode);
 
 #endif
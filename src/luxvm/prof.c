@@ -0,0 +1,117 @@
+/*
+ * Opcode n-gram profiler.
+ *
+ * Counts how many times each opcode, pair and triple of opcodes is executed.
+ * Sequences never extend past an instruction that transfers control, so every
+ * n-gram counted is also a straight-line sequence of the program text (and a
+ * candidate for a superinstruction).
+ *
+ * If the environment variable LUXVM_PROFILE names a file, the counts are
+ * appended to it as lines of the form "<n> <count> <op1> ... <opn>", so the
+ * runs of several programs can be aggregated. Otherwise the most frequent
+ * n-grams are printed to stderr.
+ */
+#include "prof.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "vm.h"
+#include "operations.h"
+
+#define MAX_N       3
+#define NTOP        25
+
+static unsigned long long *counts[MAX_N+1]; /* counts[n] is indexed by a n-gram in base NUM_OPS */
+static unsigned history, nhistory;
+
+static void prof_dump(void);
+
+void prof_init(void)
+{
+    int n;
+    unsigned size;
+
+    for (n = 1, size = NUM_OPS; n <= MAX_N; n++, size *= NUM_OPS)
+        counts[n] = calloc(size, sizeof(unsigned long long));
+    atexit(prof_dump);
+}
+
+void prof_op(int op)
+{
+    unsigned n, m;
+
+    if (op >= NUM_OPS)
+        return;
+    /* history holds the last MAX_N-1 opcodes, the most recent one in the lowest digit */
+    history = history*NUM_OPS+(unsigned)op;
+    if (nhistory < MAX_N)
+        ++nhistory;
+    for (n = 1, m = NUM_OPS; n <= nhistory; n++, m *= NUM_OPS)
+        ++counts[n][history%m];
+    history %= NUM_OPS*NUM_OPS;
+
+    switch (op) {
+    case OpJmp: case OpJmpF: case OpJmpT:
+    case OpSwitch: case OpSwitch2:
+    case OpJmpTab: case OpJmpTab2:
+    case OpCall: case OpRet:
+        nhistory = 0;
+        break;
+    }
+}
+
+static void print_ngram(FILE *fp, int n, unsigned g)
+{
+    unsigned m;
+    int k;
+
+    for (k = n-1, m = 1; k > 0; k--)
+        m *= NUM_OPS;
+    for (; m; m /= NUM_OPS)
+        fprintf(fp, " %s", get_operation_name((int)((g/m)%NUM_OPS)));
+}
+
+void prof_dump(void)
+{
+    int n;
+    unsigned g, size;
+    char *path;
+    FILE *fp;
+
+    if ((path=getenv("LUXVM_PROFILE")) != NULL) {
+        if ((fp=fopen(path, "a")) == NULL) {
+            fprintf(stderr, "luxvm: cannot open `%s'\n", path);
+            return;
+        }
+        for (n = 1, size = NUM_OPS; n <= MAX_N; n++, size *= NUM_OPS) {
+            for (g = 0; g < size; g++) {
+                if (counts[n][g]) {
+                    fprintf(fp, "%d %llu", n, counts[n][g]);
+                    print_ngram(fp, n, g);
+                    fprintf(fp, "\n");
+                }
+            }
+        }
+        fclose(fp);
+        return;
+    }
+
+    for (n = 1, size = NUM_OPS; n <= MAX_N; n++, size *= NUM_OPS) {
+        int i;
+
+        fprintf(stderr, "== most frequent %d-grams ==\n", n);
+        for (i = 0; i < NTOP; i++) {
+            unsigned best;
+
+            best = 0;
+            for (g = 1; g < size; g++)
+                if (counts[n][g] > counts[n][best])
+                    best = g;
+            if (counts[n][best] == 0)
+                break;
+            fprintf(stderr, "%12llu ", counts[n][best]);
+            print_ngram(stderr, n, best);
+            fprintf(stderr, "\n");
+            counts[n][best] = 0;
+        }
+    }
+}
@@ -0,0 +1,10 @@
+#ifndef PROF_H_
+#define PROF_H_
+
+/*
+ * Opcode n-gram profiling (VMs built with -DVM_PROFILE).
+ */
+void prof_init(void);
+void prof_op(int op);
+
+#endif
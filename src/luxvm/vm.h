@@ -2,15 +2,19 @@
 #define VM_H_
 
 /*
-        Possible Extensions
+        Superinstructions
 
-    Note: X = B, UB, W, UW, DW.
+    The opcodes after OpNop replace frequent sequences (see prof.c).
+    The assembler forms the first group from plain instructions; the
+    code generators emit the second group directly.
 
-    LdAX = LdI addr;
-           LdX;
+    LdLDW off  = LdBP off; LdDW;        (and QW)
+    StLDW off  = LdBP off; StDW;        (and QW)
+    AddIDW k   = LdIDW k; AddDW;
+    IncLDW off = LdLDW off; AddIDW 1; StLDW off; Pop;
+    DecLDW off = LdLDW off; AddIDW -1; StLDW off; Pop;
 
-    StAX = LdI addr;
-           StX;
+    LdXDW k    = LdI k; Mul; Add; LdDW; (and B, UB, QW)
 */
 
 /*
@@ -117,6 +121,8 @@ enum {
     OpJmp,
     OpSwitch,
     OpSwitch2,
+    OpJmpTab,
+    OpJmpTab2,
     OpCall,
     OpRet,
     OpDup,
@@ -129,6 +135,18 @@ enum {
     OpLibCall,
     OpFill,
     OpNop,
+    OpLdLDW,
+    OpLdLQW,
+    OpStLDW,
+    OpStLQW,
+    OpAddIDW,
+    OpIncLDW,
+    OpDecLDW,
+    OpLdXB,
+    OpLdXUB,
+    OpLdXDW,
+    OpLdXQW,
+    NUM_OPS
 };
 
 #endif
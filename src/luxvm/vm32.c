@@ -17,10 +17,47 @@
 #include <errno.h>
 #include "as.h"
 #include "operations.h"
+#ifdef VM_PROFILE
+#include "prof.h"
+#endif
 #include "../util/util.h"
 
 #define DEFAULT_STACK_SIZE  32768
 
+/*
+ * Instruction dispatch.
+ *
+ * When the host compiler supports labels as values (gcc and compatibles),
+ * exec() jumps through a table of handler addresses indexed by opcode, and
+ * every handler ends with its own indirect jump to the next one. This avoids
+ * the range check of the switch and gives the branch predictor one jump site
+ * per handler instead of a single shared one. Compile with -DVM_SWITCH_DISPATCH
+ * to get the plain switch loop instead.
+ *
+ * With -DVM_PROFILE every instruction is reported to the n-gram profiler
+ * before it is dispatched (see prof.c).
+ */
+#ifdef VM_PROFILE
+#define PROFILE_OP(op)      prof_op(op)
+#else
+#define PROFILE_OP(op)
+#endif
+#if defined __GNUC__ && !defined VM_SWITCH_DISPATCH
+#define THREADED_DISPATCH 1
+#define DISPATCH_LOOP_BEGIN NEXT();
+#define DISPATCH_LOOP_END
+#define HANDLER(op)         H_##op
+#define HANDLER_DEFAULT     H_default
+#define NEXT()              do { PROFILE_OP(*ip); goto *dispatch_tab[*ip++]; } while (0)
+#else
+#define THREADED_DISPATCH 0
+#define DISPATCH_LOOP_BEGIN while (1) { PROFILE_OP(*ip); switch (*ip++) {
+#define DISPATCH_LOOP_END   } }
+#define HANDLER(op)         case op
+#define HANDLER_DEFAULT     default
+#define NEXT()              break
+#endif
+
 char *prog_name;
 int32_t *stack, *data, *bss;
 uint8_t *text;
@@ -29,34 +66,6 @@ int text_size, data_size, bss_size;
 int vm_argc;
 char **vm_argv;
 
-/* search function used with `switch' */
-int cmp_int(const void *p1, const void *p2)
-{
-    int32_t v1 = *(int32_t *)p1;
-    int32_t v2 = *(int32_t *)p2;
-
-    if (v1 < v2)
-        return -1;
-    else if (v1 == v2)
-        return 0;
-    else
-        return 1;
-}
-
-/* search function used with `switch2' */
-int cmp_int2(const void *p1, const void *p2)
-{
-    int64_t v1 = *(int64_t *)p1;
-    int64_t v2 = *(int64_t *)p2;
-
-    if (v1 < v2)
-        return -1;
-    else if (v1 == v2)
-        return 0;
-    else
-        return 1;
-}
-
 void do_libcall(int32_t *sp, int32_t *bp, int32_t c)
 {
     int32_t a;
@@ -154,36 +163,77 @@ int32_t *exec(void)
     uint8_t *ip, *ip1;
     int32_t *sp, *bp;
     int32_t a, b;
-    int opcode;
+#if THREADED_DISPATCH
+    static void *dispatch_tab[256];
+
+    if (dispatch_tab[OpHalt] == NULL) {
+        int i;
+
+        for (i = 0; i < 256; i++)
+            dispatch_tab[i] = &&H_default;
+#define SET_HANDLER(op) dispatch_tab[op] = &&H_##op
+        SET_HANDLER(OpLdB); SET_HANDLER(OpLdUB); SET_HANDLER(OpLdW); SET_HANDLER(OpLdUW);
+        SET_HANDLER(OpLdDW); SET_HANDLER(OpLdQW); SET_HANDLER(OpLdN); SET_HANDLER(OpStB);
+        SET_HANDLER(OpStW); SET_HANDLER(OpStDW); SET_HANDLER(OpStQW);
+        SET_HANDLER(OpMemCpy); SET_HANDLER(OpFill); SET_HANDLER(OpLdBP);
+        SET_HANDLER(OpLdIDW); SET_HANDLER(OpLdIQW); SET_HANDLER(OpAddDW);
+        SET_HANDLER(OpAddQW); SET_HANDLER(OpSubDW); SET_HANDLER(OpSubQW);
+        SET_HANDLER(OpMulDW); SET_HANDLER(OpMulQW); SET_HANDLER(OpSDivDW);
+        SET_HANDLER(OpSDivQW); SET_HANDLER(OpUDivDW); SET_HANDLER(OpUDivQW);
+        SET_HANDLER(OpSModDW); SET_HANDLER(OpSModQW); SET_HANDLER(OpUModDW);
+        SET_HANDLER(OpUModQW); SET_HANDLER(OpNegDW); SET_HANDLER(OpNegQW);
+        SET_HANDLER(OpNotDW); SET_HANDLER(OpNotQW); SET_HANDLER(OpSLTDW);
+        SET_HANDLER(OpSLTQW); SET_HANDLER(OpULTDW); SET_HANDLER(OpULTQW);
+        SET_HANDLER(OpSLETDW); SET_HANDLER(OpSLETQW); SET_HANDLER(OpULETDW);
+        SET_HANDLER(OpULETQW); SET_HANDLER(OpSGTDW); SET_HANDLER(OpSGTQW);
+        SET_HANDLER(OpUGTDW); SET_HANDLER(OpUGTQW); SET_HANDLER(OpSGETDW);
+        SET_HANDLER(OpSGETQW); SET_HANDLER(OpUGETDW); SET_HANDLER(OpUGETQW);
+        SET_HANDLER(OpEQDW); SET_HANDLER(OpEQQW); SET_HANDLER(OpNEQDW);
+        SET_HANDLER(OpNEQQW); SET_HANDLER(OpAndDW); SET_HANDLER(OpAndQW);
+        SET_HANDLER(OpOrDW); SET_HANDLER(OpOrQW); SET_HANDLER(OpXorDW);
+        SET_HANDLER(OpXorQW); SET_HANDLER(OpCmplDW); SET_HANDLER(OpCmplQW);
+        SET_HANDLER(OpSLLDW); SET_HANDLER(OpSLLQW); SET_HANDLER(OpSRLDW);
+        SET_HANDLER(OpSRLQW); SET_HANDLER(OpSRADW); SET_HANDLER(OpSRAQW);
+        SET_HANDLER(OpDW2B); SET_HANDLER(OpDW2UB); SET_HANDLER(OpDW2W);
+        SET_HANDLER(OpDW2UW); SET_HANDLER(OpDW2QW); SET_HANDLER(OpUDW2QW);
+        SET_HANDLER(OpCall); SET_HANDLER(OpRet); SET_HANDLER(OpJmp); SET_HANDLER(OpJmpF);
+        SET_HANDLER(OpJmpT); SET_HANDLER(OpSwitch); SET_HANDLER(OpSwitch2);
+        SET_HANDLER(OpJmpTab); SET_HANDLER(OpJmpTab2);
+        SET_HANDLER(OpLibCall); SET_HANDLER(OpAddSP); SET_HANDLER(OpDup);
+        SET_HANDLER(OpPop); SET_HANDLER(OpSwap); SET_HANDLER(OpPushSP); SET_HANDLER(OpNop);
+        SET_HANDLER(OpHalt); SET_HANDLER(OpLdLDW); SET_HANDLER(OpLdLQW); SET_HANDLER(OpStLDW);
+        SET_HANDLER(OpStLQW); SET_HANDLER(OpAddIDW); SET_HANDLER(OpIncLDW); SET_HANDLER(OpDecLDW);
+        SET_HANDLER(OpLdXB); SET_HANDLER(OpLdXUB); SET_HANDLER(OpLdXDW); SET_HANDLER(OpLdXQW);
+#undef SET_HANDLER
+    }
+#endif
 
     ip = text;
     sp = stack;
     bp = stack;
 
-    while (1) {
-        opcode = *ip++;
-        switch (opcode) {
+    DISPATCH_LOOP_BEGIN
                 /* memory read */
-            case OpLdB:
+            HANDLER(OpLdB):
                 sp[0] = *(int8_t *)sp[0];
-                break;
-            case OpLdUB:
+                NEXT();
+            HANDLER(OpLdUB):
                 sp[0] = *(uint8_t *)sp[0];
-                break;
-            case OpLdW:
+                NEXT();
+            HANDLER(OpLdW):
                 sp[0] = *(int16_t *)sp[0];
-                break;
-            case OpLdUW:
+                NEXT();
+            HANDLER(OpLdUW):
                 sp[0] = *(uint16_t *)sp[0];
-                break;
-            case OpLdDW:
+                NEXT();
+            HANDLER(OpLdDW):
                 sp[0] = *(int32_t *)sp[0];
-                break;
-            case OpLdQW:
+                NEXT();
+            HANDLER(OpLdQW):
                 *(int64_t *)sp = *(int64_t *)sp[0];
                 ++sp;
-                break;
-            case OpLdN: {
+                NEXT();
+            HANDLER(OpLdN): {
                 int32_t n;
                 uint8_t *src, *dest;
 
@@ -194,301 +244,301 @@ int32_t *exec(void)
                 sp = (int32_t *)((int32_t)sp+round_up(n, 4)-4);
                 while (n-- > 0)
                     *dest++ = *src++;
-                break;
+                NEXT();
             }
 
                 /* memory write */
-            case OpStB:
+            HANDLER(OpStB):
                 *(int8_t *)sp[0] = (int8_t)sp[-1];
                 --sp;
-                break;
-            case OpStW:
+                NEXT();
+            HANDLER(OpStW):
                 *(int16_t *)sp[0] = (int16_t)sp[-1];
                 --sp;
-                break;
-            case OpStDW:
+                NEXT();
+            HANDLER(OpStDW):
                 *(int32_t *)sp[0] = sp[-1];
                 --sp;
-                break;
-            case OpStQW:
+                NEXT();
+            HANDLER(OpStQW):
                 *(int64_t *)sp[0] = *(int64_t *)&sp[-2];
                 --sp;
-                break;
-            case OpMemCpy:
+                NEXT();
+            HANDLER(OpMemCpy):
                 memmove((void *)sp[-1], (const void *)sp[0], *(uint32_t *)ip);
                 ip += sizeof(uint32_t);
                 --sp;
-                break;
+                NEXT();
 
-            case OpFill:
+            HANDLER(OpFill):
                 memset((void *)sp[-1], sp[0], *(uint32_t *)ip);
                 ip += sizeof(uint32_t);
                 --sp;
-                break;
+                NEXT();
 
                 /* load immediate pointers */
-            case OpLdBP:
+            HANDLER(OpLdBP):
                 ++sp;
                 sp[0] = (int32_t)bp + *(int32_t *)ip;
                 ip += sizeof(int32_t);
-                break;
+                NEXT();
 
                 /* load immediate data */
-            case OpLdIDW:
+            HANDLER(OpLdIDW):
                 ++sp;
                 sp[0] = *(int32_t *)ip;
                 ip += sizeof(int32_t);
-                break;
-            case OpLdIQW:
+                NEXT();
+            HANDLER(OpLdIQW):
                 ++sp;
                 ((int64_t *)sp)[0] = *(int64_t *)ip;
                 ++sp;
                 ip += sizeof(int64_t);
-                break;
+                NEXT();
 
                 /* arithmetic */
-            case OpAddDW:
+            HANDLER(OpAddDW):
                 sp[-1] += sp[0];
                 --sp;
-                break;
-            case OpAddQW:
+                NEXT();
+            HANDLER(OpAddQW):
                 --sp;
                 ((int64_t *)sp)[-1] += ((int64_t *)sp)[0];
                 --sp;
-                break;
-            case OpSubDW:
+                NEXT();
+            HANDLER(OpSubDW):
                 sp[-1] -= sp[0];
                 --sp;
-                break;
-            case OpSubQW:
+                NEXT();
+            HANDLER(OpSubQW):
                 --sp;
                 ((int64_t *)sp)[-1] -= ((int64_t *)sp)[0];
                 --sp;
-                break;
-            case OpMulDW:
+                NEXT();
+            HANDLER(OpMulDW):
                 sp[-1] *= sp[0];
                 --sp;
-                break;
-            case OpMulQW:
+                NEXT();
+            HANDLER(OpMulQW):
                 --sp;
                 ((int64_t *)sp)[-1] *= ((int64_t *)sp)[0];
                 --sp;
-                break;
-            case OpSDivDW:
+                NEXT();
+            HANDLER(OpSDivDW):
                 sp[-1] /= sp[0];
                 --sp;
-                break;
-            case OpSDivQW:
+                NEXT();
+            HANDLER(OpSDivQW):
                 --sp;
                 ((int64_t *)sp)[-1] /= ((int64_t *)sp)[0];
                 --sp;
-                break;
-            case OpUDivDW:
+                NEXT();
+            HANDLER(OpUDivDW):
                 sp[-1] = (uint32_t)sp[-1]/(uint32_t)sp[0];
                 --sp;
-                break;
-            case OpUDivQW:
+                NEXT();
+            HANDLER(OpUDivQW):
                 --sp;
                 ((uint64_t *)sp)[-1] = ((uint64_t *)sp)[-1]/((uint64_t *)sp)[0];
                 --sp;
-                break;
-            case OpSModDW:
+                NEXT();
+            HANDLER(OpSModDW):
                 sp[-1] %= sp[0];
                 --sp;
-                break;
-            case OpSModQW:
+                NEXT();
+            HANDLER(OpSModQW):
                 --sp;
                 ((int64_t *)sp)[-1] %= ((int64_t *)sp)[0];
                 --sp;
-                break;
-            case OpUModDW:
+                NEXT();
+            HANDLER(OpUModDW):
                 sp[-1] = (uint32_t)sp[-1]%(uint32_t)sp[0];
                 --sp;
-                break;
-            case OpUModQW:
+                NEXT();
+            HANDLER(OpUModQW):
                 --sp;
                 ((uint64_t *)sp)[-1] = ((uint64_t *)sp)[-1]%((uint64_t *)sp)[0];
                 --sp;
-                break;
-            case OpNegDW:
+                NEXT();
+            HANDLER(OpNegDW):
                 sp[0] = -sp[0];
-                break;
-            case OpNegQW:
+                NEXT();
+            HANDLER(OpNegQW):
                 ((int64_t *)&sp[-1])[0] = -((int64_t *)&sp[-1])[0];
-                break;
-            case OpNotDW:
+                NEXT();
+            HANDLER(OpNotDW):
                 sp[0] = !sp[0];
-                break;
-            case OpNotQW:
+                NEXT();
+            HANDLER(OpNotQW):
                 --sp;
                 sp[0] = !((int64_t *)sp)[0];
-                break;
+                NEXT();
 
                 /* comparisons */
-            case OpSLTDW:
+            HANDLER(OpSLTDW):
                 sp[-1] = sp[-1]<sp[0];
                 --sp;
-                break;
-            case OpSLTQW:
+                NEXT();
+            HANDLER(OpSLTQW):
                 sp -= 3;
                 sp[0] = ((int64_t *)sp)[0]<((int64_t *)sp)[1];
-                break;
-            case OpULTDW:
+                NEXT();
+            HANDLER(OpULTDW):
                 sp[-1] = (uint32_t)sp[-1]<(uint32_t)sp[0];
                 --sp;
-                break;
-            case OpULTQW:
+                NEXT();
+            HANDLER(OpULTQW):
                 sp -= 3;
                 sp[0] = ((uint64_t *)sp)[0]<((uint64_t *)sp)[1];
-                break;
-            case OpSLETDW:
+                NEXT();
+            HANDLER(OpSLETDW):
                 sp[-1] = sp[-1]<=sp[0];
                 --sp;
-                break;
-            case OpSLETQW:
+                NEXT();
+            HANDLER(OpSLETQW):
                 sp -= 3;
                 sp[0] = ((int64_t *)sp)[0]<=((int64_t *)sp)[1];
-                break;
-            case OpULETDW:
+                NEXT();
+            HANDLER(OpULETDW):
                 sp[-1] = (uint32_t)sp[-1]<=(uint32_t)sp[0];
                 --sp;
-                break;
-            case OpULETQW:
+                NEXT();
+            HANDLER(OpULETQW):
                 sp -= 3;
                 sp[0] = ((uint64_t *)sp)[0]<=((uint64_t *)sp)[1];
-                break;
-            case OpSGTDW:
+                NEXT();
+            HANDLER(OpSGTDW):
                 sp[-1] = sp[-1]>sp[0];
                 --sp;
-                break;
-            case OpSGTQW:
+                NEXT();
+            HANDLER(OpSGTQW):
                 sp -= 3;
                 sp[0] = ((int64_t *)sp)[0]>((int64_t *)sp)[1];
-                break;
-            case OpUGTDW:
+                NEXT();
+            HANDLER(OpUGTDW):
                 sp[-1] = (uint32_t)sp[-1]>(uint32_t)sp[0];
                 --sp;
-                break;
-            case OpUGTQW:
+                NEXT();
+            HANDLER(OpUGTQW):
                 sp -= 3;
                 sp[0] = ((uint64_t *)sp)[0]>((uint64_t *)sp)[1];
-                break;
-            case OpSGETDW:
+                NEXT();
+            HANDLER(OpSGETDW):
                 sp[-1] = sp[-1]>=sp[0];
                 --sp;
-                break;
-            case OpSGETQW:
+                NEXT();
+            HANDLER(OpSGETQW):
                 sp -= 3;
                 sp[0] = ((int64_t *)sp)[0]>=((int64_t *)sp)[1];
-                break;
-            case OpUGETDW:
+                NEXT();
+            HANDLER(OpUGETDW):
                 sp[-1] = (uint32_t)sp[-1]>=(uint32_t)sp[0];
                 --sp;
-                break;
-            case OpUGETQW:
+                NEXT();
+            HANDLER(OpUGETQW):
                 sp -= 3;
                 sp[0] = ((uint64_t *)sp)[0]>=((uint64_t *)sp)[1];
-                break;
-            case OpEQDW:
+                NEXT();
+            HANDLER(OpEQDW):
                 sp[-1] = sp[-1]==sp[0];
                 --sp;
-                break;
-            case OpEQQW:
+                NEXT();
+            HANDLER(OpEQQW):
                 sp -= 3;
                 sp[0] = ((int64_t *)sp)[0]==((int64_t *)sp)[1];
-                break;
-            case OpNEQDW:
+                NEXT();
+            HANDLER(OpNEQDW):
                 sp[-1] = sp[-1]!=sp[0];
                 --sp;
-                break;
-            case OpNEQQW:
+                NEXT();
+            HANDLER(OpNEQQW):
                 sp -= 3;
                 sp[0] = ((int64_t *)sp)[0]!=((int64_t *)sp)[1];
-                break;
+                NEXT();
 
                 /* bitwise */
-            case OpAndDW:
+            HANDLER(OpAndDW):
                 sp[-1] &= sp[0];
                 --sp;
-                break;
-            case OpAndQW:
+                NEXT();
+            HANDLER(OpAndQW):
                 --sp;
                 ((int64_t *)sp)[-1] &= ((int64_t *)sp)[0];
                 --sp;
-                break;
-            case OpOrDW:
+                NEXT();
+            HANDLER(OpOrDW):
                 sp[-1] |= sp[0];
                 --sp;
-                break;
-            case OpOrQW:
+                NEXT();
+            HANDLER(OpOrQW):
                 --sp;
                 ((int64_t *)sp)[-1] |= ((int64_t *)sp)[0];
                 --sp;
-                break;
-            case OpXorDW:
+                NEXT();
+            HANDLER(OpXorDW):
                 sp[-1] ^= sp[0];
                 --sp;
-                break;
-            case OpXorQW:
+                NEXT();
+            HANDLER(OpXorQW):
                 --sp;
                 ((int64_t *)sp)[-1] ^= ((int64_t *)sp)[0];
                 --sp;
-                break;
-            case OpCmplDW:
+                NEXT();
+            HANDLER(OpCmplDW):
                 sp[0] = ~sp[0];
-                break;
-            case OpCmplQW:
+                NEXT();
+            HANDLER(OpCmplQW):
                 ((int64_t *)&sp[-1])[0] = ~((int64_t *)&sp[-1])[0];
-                break;
-            case OpSLLDW:
+                NEXT();
+            HANDLER(OpSLLDW):
                 sp[-1] <<= sp[0];
                 --sp;
-                break;
-            case OpSLLQW:
+                NEXT();
+            HANDLER(OpSLLQW):
                 ((int64_t *)sp)[-1] <<= sp[0];
                 --sp;
-                break;
-            case OpSRLDW:
+                NEXT();
+            HANDLER(OpSRLDW):
                 sp[-1] = (uint32_t)sp[-1] >> sp[0];
                 --sp;
-                break;
-            case OpSRLQW:
+                NEXT();
+            HANDLER(OpSRLQW):
                 ((uint64_t *)sp)[-1] >>= sp[0];
                 --sp;
-                break;
-            case OpSRADW:
+                NEXT();
+            HANDLER(OpSRADW):
                 sp[-1] >>= sp[0];
                 --sp;
-                break;
-            case OpSRAQW:
+                NEXT();
+            HANDLER(OpSRAQW):
                 ((int64_t *)sp)[-1] >>= sp[0];
                 --sp;
-                break;
+                NEXT();
 
                 /* conversions */
-            case OpDW2B:
+            HANDLER(OpDW2B):
                 sp[0] = (int8_t)sp[0];
-                break;
-            case OpDW2UB:
+                NEXT();
+            HANDLER(OpDW2UB):
                 sp[0] = (uint8_t)sp[0];
-                break;
-            case OpDW2W:
+                NEXT();
+            HANDLER(OpDW2W):
                 sp[0] = (int16_t)sp[0];
-                break;
-            case OpDW2UW:
+                NEXT();
+            HANDLER(OpDW2UW):
                 sp[0] = (uint16_t)sp[0];
-                break;
-            case OpDW2QW:
+                NEXT();
+            HANDLER(OpDW2QW):
                 ((int64_t *)sp)[0] = sp[0];
                 ++sp;
-                break;
-            case OpUDW2QW:
+                NEXT();
+            HANDLER(OpUDW2QW):
                 ((int64_t *)sp)[0] = (uint32_t)sp[0];
                 ++sp;
-                break;
+                NEXT();
 
                 /* subroutines */
-            case OpCall:
+            HANDLER(OpCall):
                 a = *(int32_t *)ip; /* size of param area */
                 ip += sizeof(int32_t);
                 ip1 = (uint8_t *)sp[0];
@@ -498,8 +548,8 @@ int32_t *exec(void)
                 sp += 2;
                 ip = ip1;
                 bp = sp;
-                break;
-            case OpRet:
+                NEXT();
+            HANDLER(OpRet):
                 a = sp[0]; /* return value */
                 sp = bp;
                 ip = (uint8_t *)sp[-2];
@@ -507,105 +557,183 @@ int32_t *exec(void)
                 b = sp[0]; /* size of param area */
                 sp = (int32_t *)((int32_t)sp-sizeof(int32_t)*2-b); /* sizeof(int32_t)*2: old bp + ret addr */
                 sp[0] = a;
-                break;
+                NEXT();
 
                 /* jumps */
-            case OpJmp:
+            HANDLER(OpJmp):
                 ip1 = (uint8_t *)*(int32_t *)ip;
                 ip = ip1;
-                break;
-            case OpJmpF:
+                NEXT();
+            HANDLER(OpJmpF):
                 ip1 = (uint8_t *)*(int32_t *)ip;
                 ip += sizeof(int32_t);
                 if (!sp[0])
                     ip = ip1;
                 --sp;
-                break;
-            case OpJmpT:
+                NEXT();
+            HANDLER(OpJmpT):
                 ip1 = (uint8_t *)*(int32_t *)ip;
                 ip += sizeof(int32_t);
                 if (sp[0])
                     ip = ip1;
                 --sp;
-                break;
+                NEXT();
 
-            case OpSwitch: {
+            HANDLER(OpSwitch): {
                 int32_t val, count;
-                int32_t *tab, *p, *p_end, *res;
+                int32_t *tab, *p, *p_end, h;
 
                 val = sp[-1];
                 tab = (int32_t *)sp[0];
                 sp -= 2;
 
-                p = tab;
-                count = *p++;
+                count = tab[0];
                 p_end = tab+count;
 
-                if ((res=bsearch(&val, p, count-1, sizeof(*p), cmp_int)) == NULL)
-                    ip = (uint8_t *)*p_end; /* default */
-                else
-                    ip = (uint8_t *)*(p_end+(res-tab));
-                break;
+                /* lower bound search over the (sorted) case values */
+                for (p = tab+1, count--; count > 1; count -= h) {
+                    h = count/2;
+                    p = (p[h] <= val) ? p+h : p;
+                }
+                ip = (uint8_t *)p_end[(count==1 && *p==val) ? p-tab : 0];
+                NEXT();
             }
-            case OpSwitch2: {
+            HANDLER(OpSwitch2): {
                 int64_t val, count;
-                int64_t *tab, *p, *res;
+                int64_t *tab, *p, h;
                 int32_t *p_end;
 
                 val = *(int64_t *)&sp[-2];
                 tab = (int64_t *)sp[0];
                 sp -= 3;
 
-                p = tab;
-                count = *p++;
+                count = tab[0];
                 p_end = (int32_t *)(tab+count);
 
-                if ((res=bsearch(&val, p, count-1, sizeof(*p), cmp_int2)) == NULL)
-                    ip = (uint8_t *)*p_end;
-                else
-                    ip = (uint8_t *)*(p_end+(res-tab));
+                for (p = tab+1, count--; count > 1; count -= h) {
+                    h = count/2;
+                    p = (p[h] <= val) ? p+h : p;
+                }
+                ip = (uint8_t *)p_end[(count==1 && *p==val) ? p-tab : 0];
+                NEXT();
+            }
+            HANDLER(OpJmpTab): {
+                uint32_t k;
+                int32_t *tab;
+
+                tab = (int32_t *)sp[0];
+                k = (uint32_t)sp[-1]-(uint32_t)tab[0];
+                sp -= 2;
+
+                /* tab: min, n, default label, n labels */
+                ip = (uint8_t *)tab[2+(k<(uint32_t)tab[1] ? k+1 : 0)];
+                NEXT();
+            }
+            HANDLER(OpJmpTab2): {
+                uint64_t k;
+                int32_t *tab;
+
+                tab = (int32_t *)sp[0];
+                k = *(uint64_t *)&sp[-2]-*(uint64_t *)tab;
+                sp -= 3;
+
+                /* tab: min (qword), n (padded to qword), default label, n labels */
+                ip = (uint8_t *)tab[4+(k<(uint32_t)tab[2] ? k+1 : 0)];
+                NEXT();
             }
-                break;
 
                 /* system library calls */
-            case OpLibCall:
+            HANDLER(OpLibCall):
                 a = *(int32_t *)ip;
                 ip += sizeof(int32_t);
                 ++sp;
                 do_libcall(sp, bp, a);
-                break;
+                NEXT();
 
                 /* stack management */
-            case OpAddSP:
+            HANDLER(OpAddSP):
                 a = *(int32_t *)ip;
                 ip += sizeof(int32_t);
                 sp = (int32_t *)((int32_t)sp+a);
-                break;
-            case OpDup:
+                NEXT();
+            HANDLER(OpDup):
                 ++sp;
                 sp[0] = sp[-1];
-                break;
-            case OpPop:
+                NEXT();
+            HANDLER(OpPop):
                 --sp;
-                break;
-            case OpSwap:
+                NEXT();
+            HANDLER(OpSwap):
                 sp[0]  ^= sp[-1];
                 sp[-1] ^= sp[0];
                 sp[0]  ^= sp[-1];
-                break;
-            case OpPushSP:
+                NEXT();
+            HANDLER(OpPushSP):
                 ++sp;
                 sp[0] = (int32_t)(sp-1);
-                break;
+                NEXT();
+
+                /* superinstructions */
+            HANDLER(OpLdLDW):
+                ++sp;
+                sp[0] = *(int32_t *)((int32_t)bp+*(int32_t *)ip);
+                ip += sizeof(int32_t);
+                NEXT();
+            HANDLER(OpLdLQW):
+                ++sp;
+                *(int64_t *)sp = *(int64_t *)((int32_t)bp+*(int32_t *)ip);
+                ++sp;
+                ip += sizeof(int32_t);
+                NEXT();
+            HANDLER(OpStLDW):
+                *(int32_t *)((int32_t)bp+*(int32_t *)ip) = sp[0];
+                ip += sizeof(int32_t);
+                NEXT();
+            HANDLER(OpStLQW):
+                *(int64_t *)((int32_t)bp+*(int32_t *)ip) = *(int64_t *)&sp[-1];
+                ip += sizeof(int32_t);
+                NEXT();
+            HANDLER(OpAddIDW):
+                sp[0] += *(int32_t *)ip;
+                ip += sizeof(int32_t);
+                NEXT();
+            HANDLER(OpIncLDW):
+                ++*(int32_t *)((int32_t)bp+*(int32_t *)ip);
+                ip += sizeof(int32_t);
+                NEXT();
+            HANDLER(OpDecLDW):
+                --*(int32_t *)((int32_t)bp+*(int32_t *)ip);
+                ip += sizeof(int32_t);
+                NEXT();
+            HANDLER(OpLdXB):
+                --sp;
+                sp[0] = *(int8_t *)(sp[0]+sp[1]**(int32_t *)ip);
+                ip += sizeof(int32_t);
+                NEXT();
+            HANDLER(OpLdXUB):
+                --sp;
+                sp[0] = *(uint8_t *)(sp[0]+sp[1]**(int32_t *)ip);
+                ip += sizeof(int32_t);
+                NEXT();
+            HANDLER(OpLdXDW):
+                --sp;
+                sp[0] = *(int32_t *)(sp[0]+sp[1]**(int32_t *)ip);
+                ip += sizeof(int32_t);
+                NEXT();
+            HANDLER(OpLdXQW):
+                --sp;
+                *(int64_t *)sp = *(int64_t *)(sp[0]+sp[1]**(int32_t *)ip);
+                ++sp;
+                ip += sizeof(int32_t);
+                NEXT();
 
             /* misc */
-            case OpNop:
-                break;
-            case OpHalt:    /* OK */
-            default:        /* error, unknown opcode */
+            HANDLER(OpNop):
+                NEXT();
+            HANDLER(OpHalt):    /* OK */
+            HANDLER_DEFAULT: /* error, unknown opcode */
                 return sp;
-        } /* switch (opcode) */
-    } /* while (1) */
+    DISPATCH_LOOP_END
 }
 
 void load_code(char *file_path)
@@ -734,6 +862,8 @@ void disassemble_text(uint8_t *text, int text_size)
         case OpSwitch:  printf("switch\n"); break;
         case OpPushSP:  printf("pushsp\n"); break;
         case OpSwitch2: printf("switch2\n");break;
+        case OpJmpTab:  printf("jmptab\n"); break;
+        case OpJmpTab2: printf("jmptab2\n");break;
         case OpDW2B:    printf("dw2b\n");   break;
         case OpDW2UB:   printf("dw2ub\n");  break;
         case OpDW2W:    printf("dw2w\n");   break;
@@ -753,6 +883,17 @@ void disassemble_text(uint8_t *text, int text_size)
         case OpMemCpy:  printf("memcpy ");  printf("%x\n", *(int32_t *)p);  p+=sizeof(int32_t); break;
         case OpAddSP:   printf("addsp ");   printf("%x\n", *(int32_t *)p);  p+=sizeof(int32_t); break;
         case OpLibCall: printf("libcall "); printf("%x\n", *(int32_t *)p);  p+=sizeof(int32_t); break;
+        case OpLdLDW:   printf("ldldw ");   printf("%x\n", *(int32_t *)p);  p+=sizeof(int32_t); break;
+        case OpLdLQW:   printf("ldlqw ");   printf("%x\n", *(int32_t *)p);  p+=sizeof(int32_t); break;
+        case OpStLDW:   printf("stldw ");   printf("%x\n", *(int32_t *)p);  p+=sizeof(int32_t); break;
+        case OpStLQW:   printf("stlqw ");   printf("%x\n", *(int32_t *)p);  p+=sizeof(int32_t); break;
+        case OpAddIDW:  printf("addidw ");  printf("%x\n", *(int32_t *)p);  p+=sizeof(int32_t); break;
+        case OpIncLDW:  printf("incldw ");  printf("%x\n", *(int32_t *)p);  p+=sizeof(int32_t); break;
+        case OpDecLDW:  printf("decldw ");  printf("%x\n", *(int32_t *)p);  p+=sizeof(int32_t); break;
+        case OpLdXB:    printf("ldxb ");    printf("%x\n", *(int32_t *)p);  p+=sizeof(int32_t); break;
+        case OpLdXUB:   printf("ldxub ");   printf("%x\n", *(int32_t *)p);  p+=sizeof(int32_t); break;
+        case OpLdXDW:   printf("ldxdw ");   printf("%x\n", *(int32_t *)p);  p+=sizeof(int32_t); break;
+        case OpLdXQW:   printf("ldxqw ");   printf("%x\n", *(int32_t *)p);  p+=sizeof(int32_t); break;
         default: assert(0);
         }
     }
@@ -854,6 +995,9 @@ int main(int argc,char *argv[])
         printf("Code: (%d bytes)\n", text_size);
         disassemble_text(text, text_size);
     }
+#ifdef VM_PROFILE
+    prof_init();
+#endif
     stack = malloc(stack_size*sizeof(long));
     vm_argc = argc-i;
     vm_argv = argv+i;
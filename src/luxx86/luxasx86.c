@@ -64,6 +64,7 @@
 #include "../util/ELF_util.h"
 #include "../util/util.h"
 #include "../util/arena.h"
+#include "luxasx86.h"
 
 #define bool int
 
@@ -190,7 +191,7 @@ typedef enum {
     TOK_R15,
 } Token;
 
-int regenctab[] = {
+static int regenctab[] = {
     0, 0, 0, 0,
     0, 0, 0, 0,
     1, 1, 1, 1,
@@ -220,7 +221,7 @@ int regenctab[] = {
  *  2: needs REX to be present
  *  -1: cannot be used with REX
  */
-int regrextab[] = {
+static int regrextab[] = {
     0, 1, 0, 1,
     0, 1, 0, 1,
     0, 1, 0, 1,
@@ -260,23 +261,23 @@ typedef struct Operand Operand;
 typedef struct UnrExpr UnrExpr;
 typedef struct UnrLab UnrLab;
 
-char *prog_name, *inpath;
-int line_number = 1;
-char *curr, *buf;
+static char *prog_name, *inpath;
+static int line_number = 1;
+static char *curr, *buf;
 #define MAX_LEXEME      512
-char lexeme_buf1[MAX_LEXEME];
-char lexeme_buf2[MAX_LEXEME];
-char *lexeme;
+static char lexeme_buf1[MAX_LEXEME];
+static char lexeme_buf2[MAX_LEXEME];
+static char *lexeme;
 #define MAX_LINE_BUF    4096
-char line_buf[MAX_LINE_BUF];
-bool reading_from_stdin;
-char *non_local_label;
-Arena *opnd_arena;
-jmp_buf env;
-FILE *output_file;
-bool targeting_x64;
-void err1(char *fmt, ...);
-void err2(Operand *op, char *fmt, ...);
+static char line_buf[MAX_LINE_BUF];
+static bool reading_from_stdin;
+static char *non_local_label;
+static Arena *opnd_arena;
+static jmp_buf env;
+static FILE *output_file;
+static bool targeting_x64;
+static void err1(char *fmt, ...);
+static void err2(Operand *op, char *fmt, ...);
 
 typedef enum {
     SectionKind,
@@ -289,7 +290,7 @@ typedef enum {
 } SymBind;
 #define HASH_SIZE   1009
 #define HASH(s)     (hash(s)%HASH_SIZE)
-struct Symbol {
+static struct Symbol {
     SymKind kind;
     SymBind bind;
     char *name;
@@ -300,7 +301,7 @@ struct Symbol {
     Symbol *next;
 } *symbols[HASH_SIZE];
 
-Symbol *define_symbol(SymKind kind, SymBind bind, char *name, uint64_t val, Section *sec)
+static Symbol *define_symbol(SymKind kind, SymBind bind, char *name, uint64_t val, Section *sec)
 {
     unsigned h;
     Symbol *np;
@@ -341,7 +342,7 @@ redef:
     err1("symbol `%s' redefined", name);
 }
 
-Symbol *lookup_symbol(char *name)
+static Symbol *lookup_symbol(char *name)
 {
     Symbol *np;
 
@@ -356,7 +357,7 @@ struct SBlock {
     SBlock *next;
 };
 
-struct Section {
+static struct Section {
     int LC;
     char *name;
     SBlock *first, *last;
@@ -380,7 +381,7 @@ struct Section {
 #define GET_POS()     (curr_section->last->avail)
 #define DEF_SEC       ".text" /* start to assemble in this section if none is specified */
 
-void set_curr_section(char *name)
+static void set_curr_section(char *name)
 {
     Section *s;
     static Elf32_Half shndx = 4; /* [0]=UND, [1]=.shstrtab, [2]=.symtab, [3]=.strtab */
@@ -418,7 +419,7 @@ void set_curr_section(char *name)
     curr_section = s;
 }
 
-void expand_curr_section(void)
+static void expand_curr_section(void)
 {
     SBlock *s;
     unsigned n;
@@ -432,7 +433,7 @@ void expand_curr_section(void)
     curr_section->last = s;
 }
 
-void write_byte(int b)
+static void write_byte(int b)
 {
     if (curr_section == NULL)
         set_curr_section(DEF_SEC);
@@ -443,7 +444,7 @@ void write_byte(int b)
     curr_section->LC += 1;
 }
 
-void write_word(int w)
+static void write_word(int w)
 {
     if (curr_section == NULL)
         set_curr_section(DEF_SEC);
@@ -454,7 +455,7 @@ void write_word(int w)
     curr_section->LC += 2;
 }
 
-void write_dword(int d)
+static void write_dword(int d)
 {
     if (curr_section == NULL)
         set_curr_section(DEF_SEC);
@@ -465,7 +466,7 @@ void write_dword(int d)
     curr_section->LC += 4;
 }
 
-void write_qword(long long q)
+static void write_qword(long long q)
 {
     if (curr_section == NULL)
         set_curr_section(DEF_SEC);
@@ -520,7 +521,8 @@ enum {
 /* instruction classes */
 typedef enum {
     op_adc,
-    op_add,     op_and,     op_call,    op_cdq,
+    op_add,     op_and,     op_bsr,     op_call,    op_cdq,
+    op_cld,
     op_cmp,     op_cqo, 	op_dec,     op_div,
     op_idiv,
     op_imul,    op_inc,     op_ja,      op_jae,
@@ -528,13 +530,14 @@ typedef enum {
     op_jge,     op_jl,      op_jle,     op_jmp,
     op_jne,     op_lea,     op_mov,     op_movsb,
     op_movsd,   op_movsq,   op_movsw,   op_movsx,
-    op_movzx,
+    op_movzx,   op_mul,
     op_neg,     op_nop,     op_not,     op_or,
     op_pop,     op_push,    op_ret,     op_sal,
     op_sar,     op_sbb,     op_seta,    op_setae,
     op_setb,    op_setbe,   op_sete,    op_setg,
     op_setge,   op_setl,    op_setle,   op_setne,
-    op_shl,     op_shr,     op_sub,     op_test,
+    op_shl,     op_shr,     op_std,     op_stosb,
+    op_stosd,   op_stosq,   op_stosw,   op_sub,     op_test,
     op_xchg,    op_xor,     op_int,     op_syscall,
 } InstrClass;
 
@@ -542,7 +545,7 @@ typedef enum {
  * Note: within each table entry, instruction
  * forms are tested for match from top to bottom.
  */
-struct {
+static struct {
     InstrClass iclass;
     bool esc_opc;           /* escape opcode byte (0x0F) */
     unsigned char opcode;
@@ -586,11 +589,15 @@ struct {
     { op_and,   0,  0x21,   -1,     rm|Word|Dword|Qword,        Reg_mode|Word|Dword|Qword,  I_MR },
     { op_and,   0,  0x22,   -1,     Reg_mode|Byte,              rm|Byte,                    I_RM },
     { op_and,   0,  0x23,   -1,     Reg_mode|Word|Dword|Qword,  rm|Word|Dword|Qword,        I_RM },
+    /* BSR */
+    { op_bsr,   1,  0xBD,   -1,     Reg_mode|Word|Dword|Qword,  rm|Word|Dword|Qword,        I_RM },
     /* CALL */
     { op_call,  0,  0xE8,   -1,     Imm_mode|Dword,             None_mode,                  I_REL32 },
     { op_call,  0,  0xFF,   0x02,   rm|Dword|Qword,             None_mode,                  I_M },
     /* CDQ */
     { op_cdq,   0,  0x99,   -1,     None_mode,                  None_mode,                  -1 },
+    /* CLD */
+    { op_cld,   0,  0xFC,   -1,     None_mode,                  None_mode,                  -1 },
     /* CMP */
     { op_cmp,   0,  0x83,   0x07,   rm|Word|Dword|Qword,        Imm_mode|Byte,              I_MI },
     { op_cmp,   0,  0x3C,   -1,     Acc_mode|Byte,              Imm_mode|Byte,              I_AI },
@@ -685,6 +692,9 @@ struct {
     /* MOVZX */
     { op_movzx, 1,  0xB6,   -1,     Reg_mode|Word|Dword|Qword,  rm|Byte,                    I_RM },
     { op_movzx, 1,  0xB7,   -1,     Reg_mode|Dword|Qword,       rm|Word,                    I_RM },
+    /* MUL */
+    { op_mul,   0,  0xF6,   0x04,   rm|Byte,                    None_mode,                  I_M },
+    { op_mul,   0,  0xF7,   0x04,   rm|Word|Dword|Qword,        None_mode,                  I_M },
     /* NEG */
     { op_neg,   0,  0xF6,   0x03,   rm|Byte,                    None_mode,                  I_M },
     { op_neg,   0,  0xF7,   0x03,   rm|Word|Dword|Qword,        None_mode,                  I_M },
@@ -768,6 +778,16 @@ struct {
     { op_shr,   0,  0xD1,   0x05,   rm|Word|Dword|Qword,        Imm_1_mode|Byte,            I_MX },
     { op_shr,   0,  0xD3,   0x05,   rm|Word|Dword|Qword,        Reg_CL_mode|Byte,           I_MX },
     { op_shr,   0,  0xC1,   0x05,   rm|Word|Dword|Qword,        Imm_mode|Byte,              I_MI },
+    /* STD */
+    { op_std,   0,  0xFD,   -1,     None_mode,                  None_mode,                  -1 },
+    /* STOSB */
+    { op_stosb, 0,  0xAA,   -1,     None_mode,                  None_mode,                  -1 },
+    /* STOSD */
+    { op_stosd, 0,  0xAB,   -1,     None_mode,                  None_mode,                  -1 },
+    /* STOSQ */
+    { op_stosq, 0,  0xAB,   -1,     None_mode,                  None_mode,                  -1 }, /* requires 0x48 prefix */
+    /* STOSW */
+    { op_stosw, 0,  0xAB,   -1,     None_mode,                  None_mode,                  -1 }, /* requires 0x66 prefix */
     /* SUB */
     { op_sub,   0,  0x83,   0x05,   rm|Word|Dword|Qword,        Imm_mode|Byte,              I_MI },
     { op_sub,   0,  0x2C,   -1,     Acc_mode|Byte,              Imm_mode|Byte,              I_AI },
@@ -815,15 +835,17 @@ struct {
 };
 
 /* map of mnemonics to opcode table entries */
-struct {
+static struct {
     char *mne;
     int ote;
-} mne2ote[] = { /* sorted for bsearch() */
+} mne2ote[] = { /* in opcode_table order */
     { "adc" },
     { "add" },
     { "and" },
+    { "bsr" },
     { "call" },
     { "cdq" },
+    { "cld" },
     { "cmp" },
     { "cqo" },
     { "dec" },
@@ -851,6 +873,7 @@ struct {
     { "movsw" },
     { "movsx" },
     { "movzx" },
+    { "mul" },
     { "neg" },
     { "nop" },
     { "not" },
@@ -873,6 +896,11 @@ struct {
     { "setne" },
     { "shl" },
     { "shr" },
+    { "std" },
+    { "stosb" },
+    { "stosd" },
+    { "stosq" },
+    { "stosw" },
     { "sub" },
     { "syscall" },
     { "test" },
@@ -880,10 +908,35 @@ struct {
     { "xor" },
 };
 
-void init_tables(void)
+/*
+ * Open-addressed hash tables for the mnemonics and the reserved words
+ * (see reserved_table below). Each slot holds an index+1 into the
+ * respective table (0 means the slot is empty). Both tables are less
+ * than half full, so a lookup rarely probes more than one slot.
+ */
+#define KW_HASH_SIZE    256 /* must be a power of two */
+#define KW_HASH(s)      (hash(s)&(KW_HASH_SIZE-1))
+static unsigned char mne_hash[KW_HASH_SIZE];
+static unsigned char rword_hash[KW_HASH_SIZE];
+
+static void kw_hash_insert(unsigned char *tab, char *s, int i)
+{
+    unsigned h;
+
+    for (h = KW_HASH(s); tab[h] != 0; h = (h+1)&(KW_HASH_SIZE-1))
+        ;
+    tab[h] = (unsigned char)(i+1);
+}
+
+static void init_rword_hash(void);
+
+static void init_tables(void)
 {
     int i, j, lim;
+    static bool done;
 
+    if (done)
+        return;
     j = 0;
     lim = NELEMS(mne2ote);
     for (i = 0; i < lim; i++) {
@@ -892,10 +945,13 @@ void init_tables(void)
         mne2ote[i].ote = j;
         for (cl = opcode_table[j].iclass; cl == opcode_table[j].iclass; j++)
             ;
+        kw_hash_insert(mne_hash, mne2ote[i].mne, i);
     }
+    init_rword_hash();
+    done = TRUE;
 }
 
-int regsiztab[] = {
+static int regsiztab[] = {
     Byte,   Byte,   Word,   Word,
     Dword,  Dword,  Qword,  Qword,
     Byte,   Byte,   Word,   Word,
@@ -944,7 +1000,7 @@ struct Operand {
 #define EXPRVAL(n)  ((n)->attr.val)
 #define EXPRKIND(n) ((n)->kind)
 
-Operand *new_opnd(Token op)
+static Operand *new_opnd(Token op)
 {
     Operand *n;
 
@@ -983,7 +1039,7 @@ struct Reloc {
     Reloc *next;
 };
 
-Reloc *new_reloc(unsigned attr, int offs, Symbol *sym)
+static Reloc *new_reloc(unsigned attr, int offs, Symbol *sym)
 {
     Reloc *n;
 
@@ -995,7 +1051,7 @@ Reloc *new_reloc(unsigned attr, int offs, Symbol *sym)
 }
 
 /* get symbol associated to relocatable expression */
-Symbol *get_rel_sym(Operand *e)
+static Symbol *get_rel_sym(Operand *e)
 {
     if (e->op == TOK_ID)
         return e->attr.lab.sym;
@@ -1007,12 +1063,12 @@ Symbol *get_rel_sym(Operand *e)
         return get_rel_sym(RCHILD(e));
 }
 
-void bad_expr(Operand *e)
+static void bad_expr(Operand *e)
 {
     err2(e, "invalid operand type");
 }
 
-long long eval_expr(Operand *e, bool pass2)
+static long long eval_expr(Operand *e, bool pass2)
 {
     long long res;
 
@@ -1157,7 +1213,7 @@ long long eval_expr(Operand *e, bool pass2)
     return res;
 }
 
-struct UnrExpr {
+static struct UnrExpr {
     Operand *expr;
     void *dest;
     int size;
@@ -1170,7 +1226,7 @@ struct UnrExpr {
     UnrExpr *next;
 } *unresolved_expressions_list;
 
-void new_unr_expr(Operand *expr, void *dest, int size, int offs, Section *sec, bool reldisp, bool signext)
+static void new_unr_expr(Operand *expr, void *dest, int size, int offs, Section *sec, bool reldisp, bool signext)
 {
     UnrExpr *n;
 
@@ -1186,7 +1242,7 @@ void new_unr_expr(Operand *expr, void *dest, int size, int offs, Section *sec, b
     unresolved_expressions_list = n;
 }
 
-void resolve_expressions(void)
+static void resolve_expressions(void)
 {
     UnrExpr *n, *tmp;
 
@@ -1315,16 +1371,61 @@ void dump_section(Section *s)
         printf("attr=0x%x, off=%d, sym=%s\n", r->attr, r->offs, r->sym->name);
 }
 
-int read_line(void);
-long long str2int(char *s);
-void init(char *file_path);
-Token curr_tok;
-Token get_token(void);
-void program(void);
-void write_ELF32_file(void);
-void write_ELF64_file(void);
+static int read_line(void);
+static long long str2int(char *s);
+static Token curr_tok;
+static Token get_token(void);
+static void program(void);
+static void write_ELF32_file(void);
+static void write_ELF64_file(void);
+
+/* assemble the program read by init() and write the object file to `outpath' */
+static void assemble(char *outpath)
+{
+    opnd_arena = arena_new(sizeof(Operand)*256, FALSE);
+    arena_set_nom_siz(opnd_arena, sizeof(Operand)*256);
+    init_tables();
+
+    lexeme = lexeme_buf1;
+    curr_tok = get_token();
+    program();
+    resolve_expressions();
+    // dump_section(curr_section);
+
+    if (outpath == NULL) {
+        outpath = replace_extension(inpath, ".o");
+        output_file = fopen(outpath, "wb");
+        free(outpath);
+    } else {
+        output_file = fopen(outpath, "wb");
+    }
+    if (targeting_x64)
+        write_ELF64_file();
+    else
+        write_ELF32_file();
+    fclose(output_file);
+
+    arena_destroy(opnd_arena);
+}
+
+#ifdef LUXAS_LIB
+/*
+ * Entry point of the integrated assembler (see luxasx86.h).
+ * Assemble the NUL-terminated program `src'; `name' is the name used
+ * in diagnostics and recorded as the object file's source file name.
+ */
+void x86_assemble(char *src, char *name, char *outpath, int x64)
+{
+    prog_name = "luxasx86";
+    inpath = name;
+    curr = buf = src;
+    targeting_x64 = x64;
+    assemble(outpath);
+}
+#else
+static void init(char *file_path);
 
-void err_no_input(void)
+static void err_no_input(void)
 {
     fprintf(stderr, "%s: no input file\n", prog_name);
     exit(1);
@@ -1333,12 +1434,12 @@ void err_no_input(void)
 int main(int argc, char *argv[])
 {
     int i;
-    char *outpath;
+    char *outpath, *name;
 
     prog_name = argv[0];
     if (argc == 1)
         err_no_input();
-    outpath = inpath = NULL;
+    outpath = inpath = name = NULL;
     for (i = 1; i < argc; i++) {
         if (argv[i][0]!='-' || argv[i][1]=='\0') {
             inpath = argv[i];
@@ -1355,6 +1456,16 @@ int main(int argc, char *argv[])
                 outpath = argv[++i];
             }
             break;
+        case 'f':
+            if (argv[i][2] != '\0') {
+                name = argv[i]+2;
+            } else if (argv[i+1] == NULL) {
+                fprintf(stderr, "%s: option `f' requires an argument\n", prog_name);
+                exit(1);
+            } else {
+                name = argv[++i];
+            }
+            break;
         case 'm':
             if (equal(argv[i], "-m32"))
                 ;
@@ -1369,6 +1480,7 @@ int main(int argc, char *argv[])
                    "    -o<file>    write output to <file>\n"
                    "    -m32        target x86-32 (default)\n"
                    "    -m64        target x86-64\n"
+                   "    -f<name>    name the input <name> in diagnostics and in the object file\n"
                    "    -h          print this help\n"
                    "\nnote: if the input file is - the program is read from the standard input\n", prog_name);
             exit(0);
@@ -1387,69 +1499,48 @@ int main(int argc, char *argv[])
     } else {
         init(inpath);
     }
-
-    opnd_arena = arena_new(sizeof(Operand)*256, FALSE);
-    arena_set_nom_siz(opnd_arena, sizeof(Operand)*256);
-    init_tables();
-
-    lexeme = lexeme_buf1;
-    curr_tok = get_token();
-    program();
-    resolve_expressions();
-    // dump_section(curr_section);
-
-    if (outpath == NULL) {
-        outpath = replace_extension(inpath, ".o");
-        output_file = fopen(outpath, "wb");
-        free(outpath);
-    } else {
-        output_file = fopen(outpath, "wb");
-    }
-    if (targeting_x64)
-        write_ELF64_file();
-    else
-        write_ELF32_file();
-    fclose(output_file);
-
-    arena_destroy(opnd_arena);
+    if (name != NULL)
+        inpath = name;
+    assemble(outpath);
     if (buf != NULL)
         free(buf);
 
     return 0;
 }
-
-void line(void);
-void directive(void);
-void source_line(void);
-void label(void);
-Operand *operand(bool reldisp);
-Operand *OR_expr(void);
-Operand *XOR_expr(void);
-Operand *AND_expr(void);
-Operand *SHIFT_expr(void);
-Operand *ADD_expr(void);
-Operand *MUL_expr(void);
-Operand *UNARY_expr(void);
-Operand *PRIMARY_expr(void);
-Operand *eff_addr(void);
-void match(Token expected);
-void encode_rm_opnd(char *mod_rm, char *rex, Operand *op, unsigned addr_mode);
-void encode_sib(int scale, Token index, Token base, char *rex);
-void encode_imm_opnd(Operand *e, unsigned size, unsigned op1_siz);
-void emit_i(int opc, Operand *op1, Operand *op2);
-
-int get_opcode_table_entry(char *s)
+#endif
+
+static void line(void);
+static void directive(void);
+static void source_line(void);
+static void label(void);
+static Operand *operand(bool reldisp);
+static Operand *OR_expr(void);
+static Operand *XOR_expr(void);
+static Operand *AND_expr(void);
+static Operand *SHIFT_expr(void);
+static Operand *ADD_expr(void);
+static Operand *MUL_expr(void);
+static Operand *UNARY_expr(void);
+static Operand *PRIMARY_expr(void);
+static Operand *eff_addr(void);
+static void match(Token expected);
+static void encode_rm_opnd(char *mod_rm, char *rex, Operand *op, unsigned addr_mode);
+static void encode_sib(int scale, Token index, Token base, char *rex);
+static void encode_imm_opnd(Operand *e, unsigned size, unsigned op1_siz);
+static void emit_i(int opc, Operand *op1, Operand *op2);
+
+static int get_opcode_table_entry(char *s)
 {
-    int i;
+    unsigned h;
 
-    for (i = 0; i < NELEMS(mne2ote); i++)
-        if (equal(mne2ote[i].mne, s))
-            return mne2ote[i].ote;
+    for (h = KW_HASH(s); mne_hash[h] != 0; h = (h+1)&(KW_HASH_SIZE-1))
+        if (equal(mne2ote[mne_hash[h]-1].mne, s))
+            return mne2ote[mne_hash[h]-1].ote;
     err1("unknown instruction `%s'", s);
 }
 
 /* encode immediate operand */
-void encode_imm_opnd(Operand *e, unsigned size, unsigned op1_siz)
+static void encode_imm_opnd(Operand *e, unsigned size, unsigned op1_siz)
 {
     switch (size) {
     case Byte:
@@ -1472,7 +1563,7 @@ void encode_imm_opnd(Operand *e, unsigned size, unsigned op1_siz)
 }
 
 /* encode the sib field of an operand */
-void encode_sib(int scale, Token index, Token base, char *rex)
+static void encode_sib(int scale, Token index, Token base, char *rex)
 {
     if (index==TOK_ESP || index==TOK_RSP)
         goto invsib;
@@ -1502,7 +1593,7 @@ invsib:
 }
 
 /* encode r/m operand */
-void encode_rm_opnd(char *mod_rm, char *rex, Operand *op, unsigned addr_mode)
+static void encode_rm_opnd(char *mod_rm, char *rex, Operand *op, unsigned addr_mode)
 {
     int renc;
     int scale;
@@ -1671,12 +1762,12 @@ void encode_rm_opnd(char *mod_rm, char *rex, Operand *op, unsigned addr_mode)
     }
 }
 
-void rex_err(void)
+static void rex_err(void)
 {
     err1("cannot use high register in rex instruction");
 }
 
-void emit_i(int ote, Operand *op1, Operand *op2)
+static void emit_i(int ote, Operand *op1, Operand *op2)
 {
     Token reg;
     InstrClass iclass;
@@ -1937,9 +2028,9 @@ void emit_i(int ote, Operand *op1, Operand *op2)
                 break;
         if (iclass != opcode_table[ote].iclass)
             err1("invalid combination of opcode and operands");
-        if (iclass == op_movsw)
+        if (iclass==op_movsw || iclass==op_stosw)
             write_byte(0x66);
-        else if (iclass==op_movsq || iclass==op_cqo)
+        else if (iclass==op_movsq || iclass==op_stosq || iclass==op_cqo)
             write_byte(0x48);
         else if (opcode_table[ote].esc_opc)
             write_byte(0x0F);
@@ -1950,7 +2041,7 @@ void emit_i(int ote, Operand *op1, Operand *op2)
 }
 
 /* program = line { line } EOF */
-void program(void)
+static void program(void)
 {
     line();
     while (curr_tok != TOK_EOF)
@@ -1961,7 +2052,7 @@ void program(void)
 }
 
 /* line = [ label ] [ ( source_line | directive ) ] EOL */
-void line(void)
+static void line(void)
 {
     if (curr_tok == TOK_ID) {
         char *curr_tmp;
@@ -1994,7 +2085,7 @@ done:
  *                  "align"  NUM |
  *                  "alignb" NUM
  */
-void directive(void)
+static void directive(void)
 {
     switch (curr_tok) {
     case TOK_SECTION:
@@ -2087,7 +2178,7 @@ void directive(void)
                         "dd" OR_expr { "," OR_expr } |
                         "dq" OR_expr { "," OR_expr }
  */
-void source_line(void)
+static void source_line(void)
 {
     int ntimes = 1;
     int line_tmp;
@@ -2249,13 +2340,13 @@ start:
     }
 }
 
-struct UnrLab {
+static struct UnrLab {
     char **dest;
     UnrLab *next;
 } *unresolved_labels_list;
 
 /* label = ID ":" */
-void label(void)
+static void label(void)
 {
     char *name;
 
@@ -2294,7 +2385,7 @@ void label(void)
 }
 
 /* reldisp can be 0 (the expression is not a relative displacement), 8, or 32 */
-Operand *asm_expr(int reldisp)
+static Operand *asm_expr(int reldisp)
 {
     Operand *e;
 
@@ -2354,7 +2445,7 @@ Operand *asm_expr(int reldisp)
     return e;
 }
 
-int addr_mode_needs_REX(Operand *op)
+static int addr_mode_needs_REX(Operand *op)
 {
     Token reg, base, index;
 
@@ -2410,7 +2501,7 @@ int addr_mode_needs_REX(Operand *op)
  * operand = [ size_specifier ] ( REG | "[" eff_addr "]" | OR_expr )
  * size_specifier = "byte" | "word" | "dword" | "qword"
  */
-Operand *operand(bool reldisp)
+static Operand *operand(bool reldisp)
 {
     Operand *op;
     unsigned siz;
@@ -2463,7 +2554,7 @@ Operand *operand(bool reldisp)
 }
 
 /* eff_addr = REG "+" REG [ "*" NUM ] "+" OR_expr */
-Operand *eff_addr(void)
+static Operand *eff_addr(void)
 {
     /*
      * All but one term can be missing.
@@ -2550,7 +2641,7 @@ Operand *eff_addr(void)
 }
 
 /* OR_expr = XOR_expr { "|" XOR_expr } */
-Operand *OR_expr(void)
+static Operand *OR_expr(void)
 {
     Operand *e, *tmp;
 
@@ -2566,7 +2657,7 @@ Operand *OR_expr(void)
 }
 
 /* XOR_expr = AND_expr { "^" AND_expr } */
-Operand *XOR_expr(void)
+static Operand *XOR_expr(void)
 {
     Operand *e, *tmp;
 
@@ -2582,7 +2673,7 @@ Operand *XOR_expr(void)
 }
 
 /* AND_expr = SHIFT_expr { "&" SHIFT_expr } */
-Operand *AND_expr(void)
+static Operand *AND_expr(void)
 {
     Operand *e, *tmp;
 
@@ -2598,7 +2689,7 @@ Operand *AND_expr(void)
 }
 
 /* SHIFT_expr = ADD_expr { ( "<<" | ">>" ) ADD_expr } */
-Operand *SHIFT_expr(void)
+static Operand *SHIFT_expr(void)
 {
     Operand *e, *tmp;
 
@@ -2614,7 +2705,7 @@ Operand *SHIFT_expr(void)
 }
 
 /* ADD_expr = MUL_expr { ( "+" | "-" ) MUL_expr } */
-Operand *ADD_expr(void)
+static Operand *ADD_expr(void)
 {
     Operand *e, *tmp;
 
@@ -2630,7 +2721,7 @@ Operand *ADD_expr(void)
 }
 
 /* MUL_expr = UNARY_expr { ( "*" | "/" | "//" | "%" | "%%" ) UNARY_expr } */
-Operand *MUL_expr(void)
+static Operand *MUL_expr(void)
 {
     Operand *e, *tmp;
 
@@ -2646,7 +2737,7 @@ Operand *MUL_expr(void)
 }
 
 /* UNARY_expr = ( "+" | "-" | "~" | "!" ) UNARY_expr | PRIMARY_expr */
-Operand *UNARY_expr(void)
+static Operand *UNARY_expr(void)
 {
     Operand *e;
 
@@ -2674,7 +2765,7 @@ Operand *UNARY_expr(void)
 }
 
 /* PRIMARY_expr = "(" OR_expr ")" | ID | NUM | "$" */
-Operand *PRIMARY_expr(void)
+static Operand *PRIMARY_expr(void)
 {
     Operand *e;
 
@@ -2738,7 +2829,7 @@ Operand *PRIMARY_expr(void)
     return e;
 }
 
-void match(Token expected)
+static void match(Token expected)
 {
     if (curr_tok != expected) {
         if (isprint(lexeme[0]))
@@ -2749,10 +2840,10 @@ void match(Token expected)
     curr_tok = get_token();
 }
 
-struct RWord {
+static struct RWord {
     char *str;
     Token tok;
-} reserved_table[] = { /* sorted for bsearch() */
+} reserved_table[] = {
     { "ah",     TOK_AH      },
     { "al",     TOK_AL      },
     { "align",  TOK_ALIGN   },
@@ -2847,27 +2938,25 @@ struct RWord {
     { "word",   TOK_WORD    }
 };
 
-int cmp_rword(const void *p1, const void *p2)
+static void init_rword_hash(void)
 {
-    struct RWord *x1 = (struct RWord *)p1;
-    struct RWord *x2 = (struct RWord *)p2;
+    int i;
 
-    return strcmp(x1->str, x2->str);
+    for (i = 0; i < NELEMS(reserved_table); i++)
+        kw_hash_insert(rword_hash, reserved_table[i].str, i);
 }
 
-Token reserved_lookup(char *s)
+static Token reserved_lookup(char *s)
 {
-    struct RWord key, *res;
+    unsigned h;
 
-    key.str = s;
-    res = bsearch(&key, reserved_table, NELEMS(reserved_table), sizeof(reserved_table[0]), cmp_rword);
-    if (res == NULL)
-        return TOK_ID;
-    else
-        return res->tok;
+    for (h = KW_HASH(s); rword_hash[h] != 0; h = (h+1)&(KW_HASH_SIZE-1))
+        if (equal(reserved_table[rword_hash[h]-1].str, s))
+            return reserved_table[rword_hash[h]-1].tok;
+    return TOK_ID;
 }
 
-Token get_token(void)
+static Token get_token(void)
 {
     enum {
         START,
@@ -3057,13 +3146,14 @@ Token get_token(void)
     return tok;
 }
 
-int read_line(void)
+static int read_line(void)
 {
     curr = line_buf;
     return (fgets(line_buf, MAX_LINE_BUF, stdin) != NULL);
 }
 
-void init(char *file_path)
+#ifndef LUXAS_LIB
+static void init(char *file_path)
 {
     if (file_path != NULL) {
         FILE *fp;
@@ -3082,8 +3172,9 @@ void init(char *file_path)
         read_line();
     }
 }
+#endif
 
-long long str2int(char *s)
+static long long str2int(char *s)
 {
     char *ep;
 
@@ -3091,7 +3182,7 @@ long long str2int(char *s)
 }
 
 /* report pass 1 errors */
-void err1(char *fmt, ...)
+static void err1(char *fmt, ...)
 {
     va_list args;
 
@@ -3104,7 +3195,7 @@ void err1(char *fmt, ...)
 }
 
 /* report pass 2 errors */
-void err2(Operand *op, char *fmt, ...)
+static void err2(Operand *op, char *fmt, ...)
 {
     va_list args;
 
@@ -3116,7 +3207,7 @@ void err2(Operand *op, char *fmt, ...)
     exit(EXIT_FAILURE);
 }
 
-void write_ELF64_file(void)
+static void write_ELF64_file(void)
 {
     int i;
     unsigned nsym;
@@ -3408,7 +3499,7 @@ unk_sec:    sec->h.hdr64.sh_type = SHT_PROGBITS;
 #undef ALIGN
 }
 
-void write_ELF32_file(void)
+static void write_ELF32_file(void)
 {
     int i;
     unsigned nsym;
@@ -1943,7 +1943,9 @@ static void mips_switch(int i, unsigned tar, unsigned arg1, unsigned arg2)
         i = case_start;
         interval_size = max-min+1;
         holes = interval_size-ncase;
-        if (holes <= JMP_TAB_MAX_HOLES)
+
+        /* max-min can overflow when the values are far apart */
+        if ((unsigned long long)max-min < (unsigned long long)ncase+JMP_TAB_MAX_HOLES)
             goto jump_table;
     }
     goto linear_search;
@@ -2101,6 +2103,7 @@ void mips_function_definition(TypeExp *decl_specs, TypeExp *header)
     curr_func = header->str;
     fn = new_cg_node(curr_func);
     size_of_local_area = round_up(cg_node(fn).size_of_local_area, 8);
+    compute_liveness_and_next_use(fn);
 
     ty.decl_specs = decl_specs;
     ty.idl = header->child->child;
@@ -2178,6 +2181,7 @@ void mips_function_definition(TypeExp *decl_specs, TypeExp *header)
     arg_offs = max_arg_offs = 0;
     /*memset(pinned, 0, sizeof(int)*MIPS_NREG);*/
     free_all_temps();
+    ic_free_function(fn);
 #if 1
     memset(addr_descr_tab, -1, nid_counter*sizeof(int));
     memset(reg_descr_tab, 0, sizeof(unsigned)*MIPS_NREG);
@@ -2473,7 +2477,6 @@ void mips_cgen(FILE *outf)
     mips_output_file = outf;
 
     ic_main(&func_def_list, &ext_sym_list);
-    compute_liveness_and_next_use();
 
     asm_decls = string_new(512);
     str_lits = string_new(512);
@@ -1,6 +1,9 @@
 #ifndef OPT_H_
 #define OPT_H_
 
+#include "decl.h" /* for ExternId */
+
+void opt_inline_functions(ExternId **func_def_list);
 void opt_main(void);
 
 #endif
@@ -30,6 +30,7 @@ TypeExp *new_type_exp_node(void)
 
     n = arena_alloc(parser_node_arena, sizeof(TypeExp));
     n->info = curr_tok;
+    curr_tok->in_ast = TRUE;
     ++stat_number_of_ast_nodes;
     return n;
 }
@@ -58,6 +59,7 @@ ExecNode *new_exec_node(void)
 
     n = arena_alloc(parser_node_arena, sizeof(ExecNode));
     n->info = curr_tok;
+    curr_tok->in_ast = TRUE;
     ++stat_number_of_ast_nodes;
     return n;
 }
@@ -102,13 +104,26 @@ static ExecNode *new_pri_exp_node(ExpKind kind)
     return n;
 }
 
+/*
+ * Return the token that follows `p'. The tokens are
+ * requested to the lexer as the lookahead needs them.
+ */
+static TokenNode *next_token(TokenNode *p)
+{
+    if (p->token == TOK_EOF)
+        return p;
+    if (p->next == NULL)
+        p->next = get_c_token();
+    return p->next;
+}
+
 static Token lookahead(int i)
 {
     TokenNode *p;
 
     p = curr_tok;
-    while (--i /*&& p->token!=TOK_EOF*/)
-        p = p->next;
+    while (--i)
+        p = next_token(p);
     return p->token;
 }
 
@@ -117,17 +132,29 @@ static char *get_lexeme(int i)
     TokenNode *p;
 
     p = curr_tok;
-    while (--i /*&& p->token!=TOK_EOF*/)
-        p = p->next;
+    while (--i)
+        p = next_token(p);
     return p->lexeme;
 }
 
+static int keep_tokens; /* don't recycle tokens (see parse_header()) */
+
+/*
+ * Consume the current token. Tokens not referenced
+ * by the AST are recycled as soon as they are matched.
+ */
 static void match(Token token)
 {
-    if (curr_tok->token == token)
-        curr_tok = curr_tok->next;
-    else
+    if (curr_tok->token == token) {
+        TokenNode *p;
+
+        p = curr_tok;
+        curr_tok = next_token(curr_tok);
+        if (p!=curr_tok && !p->in_ast && !keep_tokens)
+            free_c_token(p);
+    } else {
         ERROR("expecting `%s'; found `%s'", tok2lex(token), curr_tok->lexeme);
+    }
 }
 
 /*                                  */
@@ -181,6 +208,21 @@ static int in_first_specifier_qualifier_list(void)
     return (in_first_type_specifier() || in_first_type_qualifier());
 }
 
+/* test if lookahead(1) is a "(" that begins a parenthesized type name */
+static int in_first_parenthesized_type_name(void)
+{
+    int res;
+    TokenNode *temp;
+
+    if (lookahead(1) != TOK_LPAREN)
+        return FALSE;
+    temp = curr_tok; /* save */
+    curr_tok = next_token(curr_tok);
+    res = in_first_specifier_qualifier_list();
+    curr_tok = temp; /* restore */
+    return res;
+}
+
 static int in_first_declaration_specifiers(void)
 {
     return (in_first_storage_class_specifier()
@@ -509,6 +551,21 @@ TypeExp *type_specifier(void)
     return n;
 }
 
+/*
+ * Install the tag of a new struct/union/enum type. The address of the tag's
+ * name identifies the type it declares, so each new type gets a copy of the
+ * name (identifiers are atoms, the same spelling gives the same address).
+ */
+static void install_new_tag(TypeExp *n)
+{
+    char *s;
+
+    s = arena_alloc(parser_str_arena, strlen(n->str)+1);
+    strcpy(s, n->str);
+    n->str = s;
+    install_tag(n);
+}
+
 /*
  * struct_or_union_specifier = struct_or_union [ identifier ] "{" struct_declaration_list "}" |
  *                             struct_or_union identifier
@@ -538,14 +595,14 @@ TypeExp *struct_or_union_specifier(void)
                  * or
                  *      struct-or-union identifier "{" struct-declaration-list "}"
                  */
-                install_tag(n); /* new incomplete type */
+                install_new_tag(n); /* new incomplete type */
             } else {
                 if (n->op != all->type->op)
                     ERROR("use of `%s' with tag type that does not match previous declaration", n->str);
                 n->str = all->type->str; /* this allows to check for type compatibility through pointers comparison */
             }
         } else {
-            install_tag(n); /* new incomplete type */
+            install_new_tag(n); /* new incomplete type */
         }
         match(TOK_ID);
         if (lookahead(1) == TOK_LBRACE) {
@@ -721,14 +778,14 @@ TypeExp *enum_specifier(void)
                  * or
                  *      enum identifier "{" enumerator-list "}"
                  */
-                install_tag(n); /* new incomplete type */
+                install_new_tag(n); /* new incomplete type */
             } else {
                 if (n->op != all->type->op)
                     ERROR("use of `%s' with tag type that does not match previous declaration", n->str);
                 n->str = all->type->str;
             }
         } else {
-            install_tag(n); /* new incomplete type */
+            install_new_tag(n); /* new incomplete type */
         }
         match(TOK_ID);
         if (lookahead(1) == TOK_LBRACE) {
@@ -1153,10 +1210,10 @@ static void static_assert_statement(void)
     char *ep;
     ExecNode *e;
     Declaration *ty;
-    TokenNode *assert_tok;
+    TokenNode assert_tok;
     int is_modif_lvalue(ExecNode *e);
 
-    assert_tok = curr_tok;
+    assert_tok = *curr_tok; /* a copy, the token may be recycled */
     match(TOK_STATIC_ASSERT);
     match(TOK_LPAREN);
     c = strtol(get_lexeme(1), &ep, 0);
@@ -1169,14 +1226,14 @@ static void static_assert_statement(void)
         match(TOK_COMMA);
         ty = type_name();
         if (!are_compatible(e->type.decl_specs, e->type.idl, ty->decl_specs, ty->idl, TRUE, FALSE)) {
-            curr_tok = assert_tok;
+            curr_tok = &assert_tok;
             ERROR("static assertion failed: the types are different");
         }
         break;
     case _ASSERT_IMMUTABLE:
         e = assignment_expression();
         if (is_modif_lvalue(e)) {
-            curr_tok = assert_tok;
+            curr_tok = &assert_tok;
             ERROR("static assertion failed: the expression is not immutable");
         }
         break;
@@ -1212,14 +1269,14 @@ static ExecNode *asm_statement(void)
 static ExecNode *va_buitin_start_statement(void)
 {
     ExecNode *n;
-    TokenNode *va_start_tok;
+    TokenNode va_start_tok;
 
-    va_start_tok = curr_tok;
+    va_start_tok = *curr_tok; /* a copy, the token may be recycled */
     match(TOK_BUILTIN_VA_START);
     match(TOK_LPAREN);
     n = new_stmt_node(BuiltinVaStartStmt);
     if ((n->child[0]=assignment_expression())->kind.exp != IdExp) {
-        curr_tok = va_start_tok;
+        curr_tok = &va_start_tok;
         ERROR("__builtin_va_start: va_list object expected");
     }
     match(TOK_RPAREN);
@@ -1784,21 +1841,13 @@ ExecNode *cast_expression(void)
 {
     ExecNode *n;
 
-    if (lookahead(1) == TOK_LPAREN) {
-        TokenNode *temp;
-
-        temp = curr_tok; /* save */
+    if (in_first_parenthesized_type_name()) {
         match(TOK_LPAREN);
-        if (in_first_specifier_qualifier_list()) {
-            n = new_op_node(TOK_CAST);
-            n->child[1] = (ExecNode *)type_name();
-            match(TOK_RPAREN);
-            n->child[0] = cast_expression();
-            analyze_cast_expression(n);
-        } else {
-            curr_tok = temp; /* restore */
-            n = unary_expression();
-        }
+        n = new_op_node(TOK_CAST);
+        n->child[1] = (ExecNode *)type_name();
+        match(TOK_RPAREN);
+        n->child[0] = cast_expression();
+        analyze_cast_expression(n);
     } else {
         n = unary_expression();
     }
@@ -1837,19 +1886,11 @@ ExecNode *unary_expression(void)
     case TOK_SIZEOF: {
         n = new_op_node(lookahead(1));
         match(lookahead(1));
-        if (lookahead(1) == TOK_LPAREN) {
-            TokenNode *temp;
-
-            temp = curr_tok; /* save */
+        if (in_first_parenthesized_type_name()) {
             match(TOK_LPAREN);
-            if (in_first_specifier_qualifier_list()) {
-                n->child[1] = (ExecNode *)type_name();
-                match(TOK_RPAREN);
-            } else { /* sizeof applied to a parenthesized expression */
-                curr_tok = temp; /* restore */
-                n->child[0] = unary_expression();
-            }
-        } else {
+            n->child[1] = (ExecNode *)type_name();
+            match(TOK_RPAREN);
+        } else { /* sizeof applied to an expression */
             n->child[0] = unary_expression();
         }
         break;
@@ -2065,13 +2106,8 @@ ExecNode *argument_expression_list(void)
 static void print_ast(ExternDecl *n);
 static FILE *dotfile;
 
-/*
- * Main function of the parser.
- */
-ExternDecl *parse(TokenNode *tokens, char *ast_outpath)
+static void parser_init(TokenNode *tokens)
 {
-    ExternDecl *n;
-
     void_ty.decl_specs = get_type_node(TOK_VOID);
     void_param.decl = &void_ty;
     curr_tok = tokens;
@@ -2079,6 +2115,16 @@ ExternDecl *parse(TokenNode *tokens, char *ast_outpath)
     stmt_init();
     parser_node_arena = arena_new(4096, TRUE);
     parser_str_arena = arena_new(1024, FALSE);
+}
+
+/*
+ * Main function of the parser.
+ */
+ExternDecl *parse(TokenNode *tokens, char *ast_outpath)
+{
+    ExternDecl *n;
+
+    parser_init(tokens);
     n = translation_unit();
     stmt_done();
     if (ast_outpath != NULL) {
@@ -2089,6 +2135,54 @@ ExternDecl *parse(TokenNode *tokens, char *ast_outpath)
     return n;
 }
 
+static int is_definition(ExternDecl *e)
+{
+    TypeExp *p;
+
+    if (e->kind == FUNCTION_DEFINITION)
+        return TRUE;
+    for (p = e->d->idl; p != NULL; p = p->sibling)
+        if (p->attr.e != NULL)
+            return TRUE;
+    return FALSE;
+}
+
+/*
+ * Parse a header to be precompiled. Unlike a translation
+ * unit, a header can be empty and is not analyzed as a
+ * whole at the end (see analyze_translation_unit()).
+ *
+ * Function bodies and initializers are not saved in the
+ * precompiled header; instead, the tokens of the external
+ * declarations that contain them are returned so they can
+ * be parsed again by the translation units that use it.
+ */
+TokenNode *parse_header(TokenNode *tokens)
+{
+    ExternDecl *e;
+    TokenNode head, *last, *first, *p;
+
+    parser_init(tokens);
+    keep_tokens = TRUE;
+    last = &head;
+    while (lookahead(1) != TOK_EOF) {
+        first = curr_tok;
+        e = external_declaration();
+        if (!is_definition(e))
+            continue;
+        for (p = first; p != curr_tok; p = p->next) {
+            last->next = malloc(sizeof(TokenNode));
+            last = last->next;
+            *last = *p;
+            last->in_ast = FALSE;
+        }
+    }
+    last->next = NULL;
+    keep_tokens = FALSE;
+    stmt_done();
+    return head.next;
+}
+
 /*
  * AST printer.
  * Emit a DOT definition of an AST.
@@ -100,6 +100,7 @@ struct ExecNode {
 };
 
 ExternDecl *parse(TokenNode *tokens, char *ast_outpath);
+TokenNode *parse_header(TokenNode *tokens);
 
 TypeExp *new_type_exp_node(void);
 ExecNode *new_exec_node(void);
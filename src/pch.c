@@ -0,0 +1,430 @@
+#include "pch.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef _POSIX_MAPPED_FILES
+#include <sys/mman.h>
+#endif
+#include "util/util.h"
+#include "util/atom.h"
+#include "decl.h"
+#include "luxcc.h"
+
+#define PCH_MAGIC   "LUXPCH"
+#define PCH_VERSION 1
+/* changes if the layout of the nodes written changes */
+#define PCH_LAYOUT  (sizeof(TypeExp)+sizeof(ExecNode)*3+sizeof(TokenNode)*7+sizeof(Symbol)*11 \
+                    +sizeof(StructMember)*13+sizeof(ExternId)*17+sizeof(PreTokenNode)*19 \
+                    +sizeof(StructDescriptor)*23)
+
+typedef struct PchHeader PchHeader;
+struct PchHeader {
+    char magic[8];
+    unsigned version, layout, ptr_size, target_arch;
+    unsigned size;              /* of the whole image */
+    unsigned relocs, nrelocs;   /* offsets of the pointer fields */
+    unsigned atoms, natoms;     /* offsets of the fields that point to atoms */
+    unsigned roots[PCH_NROOTS];
+};
+
+/*
+ * Image being written.
+ */
+static char *image;
+static unsigned image_size, image_max;
+static unsigned *relocs, nrelocs, max_relocs;
+static unsigned *atom_fields, natom_fields, max_atom_fields;
+
+/* objects already written (pointer -> offset) */
+static struct Written {
+    void *p;
+    PchOff off;
+} *written;
+static unsigned nwritten, written_size; /* the size is a power of two */
+
+/*
+ * Image read.
+ */
+static char *base;
+
+static void grow_written(void)
+{
+    unsigned i, j, old_size;
+    struct Written *old;
+
+    old = written;
+    old_size = written_size;
+    written_size = (written_size == 0) ? 1024 : written_size*2;
+    written = calloc(written_size, sizeof(struct Written));
+    for (i = 0; i < old_size; i++) {
+        if (old[i].p == NULL)
+            continue;
+        for (j = hash2((unsigned long)old[i].p)&(written_size-1); written[j].p != NULL; j = (j+1)&(written_size-1))
+            ;
+        written[j] = old[i];
+    }
+    free(old);
+}
+
+/* offset of the copy of `p' if it has already been written, 0 otherwise */
+PchOff pch_lookup(void *p)
+{
+    unsigned i;
+
+    if (written_size == 0)
+        return 0;
+    for (i = hash2((unsigned long)p)&(written_size-1); written[i].p != NULL; i = (i+1)&(written_size-1))
+        if (written[i].p == p)
+            return written[i].off;
+    return 0;
+}
+
+/* reserve room for `size' bytes in the image */
+static PchOff image_alloc(unsigned size)
+{
+    PchOff off;
+
+    off = image_size;
+    image_size += round_up(size, sizeof(void *));
+    if (image_size > image_max) {
+        while (image_size > image_max)
+            image_max *= 2;
+        image = realloc(image, image_max);
+    }
+    return off;
+}
+
+/*
+ * Copy the `size' bytes at `p' into the image. The pointers the copy
+ * contains must be set afterwards with pch_set_ptr() or pch_set_str().
+ */
+PchOff pch_copy(void *p, unsigned size)
+{
+    unsigned i;
+    PchOff off;
+
+    off = image_alloc(size);
+    memcpy(image+off, p, size);
+
+    if (nwritten >= written_size/2)
+        grow_written();
+    for (i = hash2((unsigned long)p)&(written_size-1); written[i].p != NULL; i = (i+1)&(written_size-1))
+        ;
+    written[i].p = p;
+    written[i].off = off;
+    ++nwritten;
+    return off;
+}
+
+/* address of the copy at `off' (only valid until the next copy is made) */
+void *pch_ptr(PchOff off)
+{
+    return image+off;
+}
+
+static void add_offset(unsigned **v, unsigned *n, unsigned *max, unsigned off)
+{
+    if (*n >= *max) {
+        *max = (*max == 0) ? 256 : *max*2;
+        *v = realloc(*v, *max*sizeof(unsigned));
+    }
+    (*v)[(*n)++] = off;
+}
+
+/* make the pointer at offset `field' point to the object at `target' */
+void pch_set_ptr(PchOff field, PchOff target)
+{
+    *(char **)(image+field) = (char *)(unsigned long)target;
+    if (target != 0)
+        add_offset(&relocs, &nrelocs, &max_relocs, field);
+}
+
+/* same as above, but for strings; copies of atoms are interned again when read */
+void pch_set_str(PchOff field, char *s)
+{
+    PchOff off;
+
+    if (s == NULL) {
+        pch_set_ptr(field, 0);
+        return;
+    }
+    if ((off=pch_lookup(s)) == 0)
+        off = pch_copy(s, strlen(s)+1);
+    pch_set_ptr(field, off);
+    if (atom(s) == s)
+        add_offset(&atom_fields, &natom_fields, &max_atom_fields, field);
+}
+
+/* a vector is a count followed by that many pointers */
+PchOff pch_new_vector(unsigned n)
+{
+    PchOff off;
+
+    off = image_alloc((n+1)*sizeof(void *));
+    memset(image+off, 0, (n+1)*sizeof(void *));
+    *(void **)(image+off) = (void *)(unsigned long)n;
+    return off;
+}
+
+void pch_set_elem(PchOff vec, unsigned i, PchOff obj)
+{
+    pch_set_ptr(vec+(i+1)*sizeof(void *), obj);
+}
+
+void pch_set_root(int root, unsigned val)
+{
+    ((PchHeader *)image)->roots[root] = val;
+}
+
+static PchOff pch_token(TokenNode *t)
+{
+    PchOff off;
+
+    if (t == NULL)
+        return 0;
+    if ((off=pch_lookup(t)) != 0)
+        return off;
+    off = pch_copy(t, sizeof(TokenNode));
+    pch_set_str(off+offsetof(TokenNode, lexeme), t->lexeme);
+    pch_set_str(off+offsetof(TokenNode, src_file), t->src_file);
+    pch_set_ptr(off+offsetof(TokenNode, next), 0);
+    return off;
+}
+
+/*
+ * The only expressions a declaration can contain (initializers and
+ * function bodies are not saved) are array sizes and enumeration
+ * constant values. Their value is in the root of the expression, the
+ * rest of the tree is not needed anymore.
+ */
+static PchOff pch_constant(ExecNode *e)
+{
+    int i;
+    PchOff off;
+
+    if (e == NULL)
+        return 0;
+    if ((off=pch_lookup(e)) != 0)
+        return off;
+    off = pch_copy(e, sizeof(ExecNode));
+    for (i = 0; i < 4; i++)
+        pch_set_ptr(off+offsetof(ExecNode, child)+i*sizeof(ExecNode *), 0);
+    pch_set_ptr(off+offsetof(ExecNode, sibling), 0);
+    pch_set_ptr(off+offsetof(ExecNode, locals), 0);
+    pch_set_ptr(off+offsetof(ExecNode, type.decl_specs), pch_type_exp(e->type.decl_specs));
+    pch_set_ptr(off+offsetof(ExecNode, type.idl), pch_type_exp(e->type.idl));
+    pch_set_ptr(off+offsetof(ExecNode, info), pch_token(e->info));
+    return off;
+}
+
+static PchOff pch_decl_list(DeclList *d)
+{
+    PchOff off;
+
+    if (d == NULL)
+        return 0;
+    if ((off=pch_lookup(d)) != 0)
+        return off;
+    off = pch_copy(d, sizeof(DeclList));
+    pch_set_ptr(off+offsetof(DeclList, decl), pch_declaration(d->decl));
+    pch_set_ptr(off+offsetof(DeclList, next), pch_decl_list(d->next));
+    return off;
+}
+
+PchOff pch_declaration(Declaration *d)
+{
+    PchOff off;
+
+    if (d == NULL)
+        return 0;
+    if ((off=pch_lookup(d)) != 0)
+        return off;
+    off = pch_copy(d, sizeof(Declaration));
+    pch_set_ptr(off+offsetof(Declaration, decl_specs), pch_type_exp(d->decl_specs));
+    pch_set_ptr(off+offsetof(Declaration, idl), pch_type_exp(d->idl));
+    return off;
+}
+
+PchOff pch_type_exp(TypeExp *t)
+{
+    PchOff off, attr;
+
+    if (t == NULL)
+        return 0;
+    if ((off=pch_lookup(t)) != 0)
+        return off;
+    off = pch_copy(t, sizeof(TypeExp));
+    pch_set_str(off+offsetof(TypeExp, str), t->str);
+    attr = off+offsetof(TypeExp, attr);
+    switch (t->op) {
+    case TOK_STRUCT:
+    case TOK_UNION:
+    case TOK_FUNCTION:
+        pch_set_ptr(attr, pch_decl_list(t->attr.dl));
+        break;
+    case TOK_ENUM:
+    case TOK_STAR:
+        pch_set_ptr(attr, pch_type_exp(t->attr.el));
+        break;
+    case TOK_SUBSCRIPT:
+    case TOK_ENUM_CONST:
+        pch_set_ptr(attr, pch_constant(t->attr.e));
+        break;
+    default:
+        pch_set_ptr(attr, 0);
+        break;
+    }
+    pch_set_ptr(off+offsetof(TypeExp, child), pch_type_exp(t->child));
+    pch_set_ptr(off+offsetof(TypeExp, sibling), pch_type_exp(t->sibling));
+    pch_set_ptr(off+offsetof(TypeExp, info), pch_token(t->info));
+    return off;
+}
+
+/* a list of preprocessing tokens (a macro's replacement list or parameters) */
+PchOff pch_pre_tokens(PreTokenNode *p)
+{
+    PchOff first, prev, off;
+
+    first = prev = 0;
+    for (; p != NULL; p = p->next) {
+        off = pch_copy(p, sizeof(PreTokenNode));
+        pch_set_str(off+offsetof(PreTokenNode, lexeme), p->lexeme);
+        pch_set_str(off+offsetof(PreTokenNode, src_file), p->src_file);
+        pch_set_ptr(off+offsetof(PreTokenNode, next), 0);
+        if (prev == 0)
+            first = off;
+        else
+            pch_set_ptr(prev+offsetof(PreTokenNode, next), off);
+        prev = off;
+    }
+    return first;
+}
+
+/* a list of C tokens */
+static PchOff pch_tokens(TokenNode *t)
+{
+    PchOff first, prev, off;
+
+    first = prev = 0;
+    for (; t != NULL; t = t->next) {
+        off = pch_token(t);
+        if (prev == 0)
+            first = off;
+        else
+            pch_set_ptr(prev+offsetof(TokenNode, next), off);
+        prev = off;
+    }
+    return first;
+}
+
+/*
+ * Write the state reached after processing a header.
+ * `defs' are the tokens returned by parse_header().
+ */
+void pch_write(char *outpath, TokenNode *defs)
+{
+    FILE *fp;
+    PchHeader *h;
+    unsigned relocs_off, atoms_off;
+
+    image_max = 65536;
+    image = calloc(1, image_max);
+    image_size = round_up(sizeof(PchHeader), sizeof(void *));
+
+    pre_save_pch();
+    decl_save_pch();
+    pch_set_root(PCH_DEFINITIONS, pch_tokens(defs));
+
+    relocs_off = image_size;
+    atoms_off = relocs_off+nrelocs*sizeof(unsigned);
+    h = (PchHeader *)image;
+    strcpy(h->magic, PCH_MAGIC);
+    h->version = PCH_VERSION;
+    h->layout = (unsigned)PCH_LAYOUT;
+    h->ptr_size = sizeof(void *);
+    h->target_arch = (unsigned)target_arch;
+    h->size = atoms_off+natom_fields*sizeof(unsigned);
+    h->relocs = relocs_off;
+    h->nrelocs = nrelocs;
+    h->atoms = atoms_off;
+    h->natoms = natom_fields;
+
+    if ((fp=fopen(outpath, "wb")) == NULL)
+        TERMINATE("Error writing file `%s'", outpath);
+    fwrite(image, 1, image_size, fp);
+    fwrite(relocs, sizeof(unsigned), nrelocs, fp);
+    fwrite(atom_fields, sizeof(unsigned), natom_fields, fp);
+    fclose(fp);
+}
+
+/*
+ * Read a precompiled header and restore the state it contains.
+ * The image is mapped into memory and relocated in place (it is
+ * never released). The tokens of the definitions the header
+ * contains are returned; they must be parsed before the file.
+ */
+TokenNode *pch_read(char *path)
+{
+    int fd;
+    unsigned i;
+    long size, n, r;
+    char **p;
+    PchHeader *h;
+    unsigned *offs;
+
+    if ((fd=open(path, O_RDONLY, 0)) == -1)
+        TERMINATE("Error reading file `%s'", path);
+    size = lseek(fd, 0, SEEK_END);
+    if (size < (long)sizeof(PchHeader))
+        TERMINATE("`%s' is not a precompiled header", path);
+#ifdef _POSIX_MAPPED_FILES
+    if ((base=mmap(NULL, size, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0)) == MAP_FAILED)
+#endif
+    {
+        base = malloc(size);
+        lseek(fd, 0, SEEK_SET);
+        n = 0;
+        while (n<size && (r=read(fd, base+n, size-n))>0)
+            n += r;
+    }
+    close(fd);
+
+    h = (PchHeader *)base;
+    if (memcmp(h->magic, PCH_MAGIC, sizeof(PCH_MAGIC))!=0 || h->version!=PCH_VERSION
+    || h->layout!=(unsigned)PCH_LAYOUT || h->ptr_size!=sizeof(void *) || h->size!=(unsigned)size)
+        TERMINATE("`%s' is not a precompiled header or was made by a different compiler", path);
+    if (h->target_arch != (unsigned)target_arch)
+        TERMINATE("precompiled header `%s' was made for a different target", path);
+
+    offs = (unsigned *)(base+h->relocs);
+    for (i = 0; i < h->nrelocs; i++) {
+        p = (char **)(base+offs[i]);
+        *p = base+(unsigned long)*p;
+    }
+    offs = (unsigned *)(base+h->atoms);
+    for (i = 0; i < h->natoms; i++) {
+        p = (char **)(base+offs[i]);
+        *p = atom(*p);
+    }
+
+    pre_load_pch();
+    decl_load_pch();
+    return (TokenNode *)(h->roots[PCH_DEFINITIONS] ? base+h->roots[PCH_DEFINITIONS] : NULL);
+}
+
+void **pch_get_vector(int root, unsigned *n)
+{
+    void **v;
+
+    v = (void **)(base+((PchHeader *)base)->roots[root]);
+    *n = (unsigned)(unsigned long)v[0];
+    return v+1;
+}
+
+unsigned pch_get_root(int root)
+{
+    return ((PchHeader *)base)->roots[root];
+}
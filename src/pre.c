@@ -4,19 +4,29 @@
 #include <string.h>
 #include <ctype.h>
 #include <assert.h>
+#include <stddef.h>
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef _POSIX_MAPPED_FILES
+#include <sys/mman.h>
+#endif
 #include "util/util.h"
+#include "util/atom.h"
 #include "imp_lim.h"
 #include "error.h"
 #include "util/arena.h"
 #include "luxcc.h"
+#include "pch.h"
 
 #define SRC_FILE            curr_source_file
 #define SRC_LINE            curr_line
 #define SRC_COLUMN          src_column
 #define ERROR(...)          emit_error(TRUE, SRC_FILE, SRC_LINE, SRC_COLUMN, __VA_ARGS__)
 #define MACRO_TABLE_SIZE    4093
-#define HASH_VAL(s)         (hash(s)%MACRO_TABLE_SIZE)
+#define HASH_VAL(s)         (atom_hash(s)%MACRO_TABLE_SIZE)
+#define FILE_TABLE_SIZE     101
 #define ERR_BUF_SIZ         2048
+#define MIN_PAGE_SIZE       4096
 
 /* get_token()'s possible states */
 typedef enum {
@@ -36,6 +46,7 @@ typedef enum {
     VAR_LIST
 } ParaListKind;
 typedef struct Macro Macro;
+typedef struct FileInfo FileInfo;
 
 static char *default_angle_dirs[] = {
     "include/",
@@ -56,14 +67,78 @@ static struct Macro {
     Macro *next;
 } *macro_table[MACRO_TABLE_SIZE];
 
-static char *buf, *curr, *curr_source_file;
+/* include guard detection states */
+enum {
+    GUARD_START,    /* only new-lines read so far */
+    GUARD_OPEN,     /* inside the #ifndef that opened the file */
+    GUARD_CLOSED,   /* the #endif matching that #ifndef was read */
+    GUARD_NONE      /* the file is not wrapped in a guard */
+};
+
+/*
+ * Every file read is remembered (by path) until the end of the
+ * translation unit. Its contents are kept so later inclusions do
+ * not have to read it again, and, if the whole file was found to
+ * be wrapped in
+ *      #ifndef X
+ *      ...
+ *      #endif
+ * or it contained `#pragma once', later inclusions are skipped
+ * entirely while X remains defined (always for #pragma once).
+ */
+static struct FileInfo {
+    char *path;         /* atom */
+    char *contents;     /* '\0'-terminated */
+    char *guard;        /* X above */
+    int guard_state;
+    int guard_level;    /* if_nest_level at the guard's #ifndef */
+    char once;
+    FileInfo *next;
+} *file_table[FILE_TABLE_SIZE];
+
+static FileInfo *curr_file;
+static char *curr, *curr_source_file;
 static char token_string[MAX_LOG_LINE_LEN+1];
 static PreTokenNode *curr_tok;
 static int curr_line, curr_column;
 static int src_column; /* token's first char column # */
-static PreTokenNode *penultimate_node; /* used by #include's code */
+static int at_line_start; /* nothing has been read from the current line */
+static PreTokenNode *out_head; /* first token not yet handed to the lexer */
+static PreTokenNode *free_nodes; /* recycled nodes */
 static Arena *pre_str_arena;
-Arena *pre_node_arena;
+static Arena *pre_node_arena;
+
+/* files whose reading was suspended by an #include */
+static struct IncFile {
+    FileInfo *file;
+    char *curr;
+    int line, column;
+    struct IncFile *prev;
+} *inc_stack;
+
+/* state of the conditional inclusion directives being processed */
+static struct {
+    char outer_skip; /* the whole if-section is within a skipped group */
+    char taken;      /* some group of the if-section was already included */
+    char in_else;    /* #else was seen */
+    char skip;       /* the current group is being skipped */
+} if_stack[MAX_IF_NEST];
+static int if_nest_level;
+
+/* atoms of the spellings the preprocessor looks for */
+enum {
+    A_SHARP, A_IF, A_IFDEF, A_IFNDEF, A_ELIF, A_ELSE, A_ENDIF,
+    A_INCLUDE, A_DEFINE, A_UNDEF, A_ERROR, A_NEWLINE, A_LT, A_GT,
+    A_LPAREN, A_RPAREN, A_COMMA, A_ELLIPSIS, A_VA_ARGS, A_FILE, A_LINE,
+    A_PRAGMA, A_ONCE, NPRE_ATOMS
+};
+static char *pre_atom_spellings[NPRE_ATOMS] = {
+    "#", "if", "ifdef", "ifndef", "elif", "else", "endif",
+    "include", "define", "undef", "error", "\n", "<", ">",
+    "(", ")", ",", "...", "__VA_ARGS__", "__FILE__", "__LINE__",
+    "pragma", "once"
+};
+static char *pre_atoms[NPRE_ATOMS];
 
 static char *dup_lexeme(const char *s)
 {
@@ -78,15 +153,27 @@ static char *dup_lexeme(const char *s)
     return t;
 }
 
+/*
+ * Note: `lexeme' is not copied. The lexemes of all the tokens
+ * but string literals are atoms; string literals are duplicated
+ * once when they are read and shared by all the copies of the
+ * token (the lexer converts them without modifying them).
+ */
 static PreTokenNode *new_node(PreToken token, char *lexeme)
 {
     PreTokenNode *temp;
 
-    temp = arena_alloc(pre_node_arena, sizeof(PreTokenNode));
+    if (free_nodes != NULL) {
+        temp = free_nodes;
+        free_nodes = free_nodes->next;
+    } else {
+        temp = arena_alloc(pre_node_arena, sizeof(PreTokenNode));
+    }
     temp->token = token;
-    temp->lexeme = dup_lexeme(lexeme);
+    temp->lexeme = lexeme;
     temp->next = NULL;
     temp->deleted = FALSE;
+    temp->no_expand = FALSE;
     temp->src_line = curr_line;
     temp->src_column = src_column;
     temp->src_file = curr_source_file;
@@ -94,29 +181,131 @@ static PreTokenNode *new_node(PreToken token, char *lexeme)
     return temp;
 }
 
-static void init(char *file_path)
+/*
+ * Return a node to the free list. The node's
+ * lexeme is not released (other nodes or the
+ * C tokens may be sharing it).
+ */
+void free_pre_token(PreTokenNode *p)
 {
-    FILE *fp;
-    unsigned flen;
+    p->next = free_nodes;
+    free_nodes = p;
+}
 
-    fp = fopen(file_path, "rb");
-    if (fp == NULL)
-        TERMINATE("Error reading file `%s'", file_path);
+/* return the information about `path' (an atom), creating it if needed */
+static FileInfo *get_file_info(char *path)
+{
+    FileInfo *fi;
+    unsigned h;
 
-    fseek(fp, 0, SEEK_END);
-    flen = ftell(fp);
-    rewind(fp);
-    curr = buf = malloc(flen+2);
-    flen = fread(buf, sizeof(char), flen, fp);
-    buf[flen] = '\0';
-    fclose(fp);
+    h = atom_hash(path)%FILE_TABLE_SIZE;
+    for (fi = file_table[h]; fi != NULL; fi = fi->next)
+        if (fi->path == path)
+            return fi;
+    fi = malloc(sizeof(FileInfo));
+    fi->path = path;
+    fi->contents = NULL;
+    fi->guard = NULL;
+    fi->guard_state = GUARD_NONE;
+    fi->guard_level = 0;
+    fi->once = FALSE;
+    fi->next = file_table[h];
+    file_table[h] = fi;
+    return fi;
+}
 
+/*
+ * Read the contents of a file. The file is mapped into memory
+ * when there is room in its last page for the terminating '\0'
+ * (the part of the page past the end of the file reads as zeros);
+ * otherwise (or if the C library has no mmap()) it is read into
+ * a buffer. The contents are never released.
+ */
+static void read_contents(FileInfo *fi)
+{
+    int fd;
+    long flen, n, r;
+    char *p;
+
+    if ((fd=open(fi->path, O_RDONLY, 0)) == -1)
+        TERMINATE("Error reading file `%s'", fi->path);
+
+    flen = lseek(fd, 0, SEEK_END);
+#ifdef _POSIX_MAPPED_FILES
+    if (flen>0 && flen%MIN_PAGE_SIZE!=0
+    && (p=mmap(NULL, flen, PROT_READ, MAP_PRIVATE, fd, 0))!=MAP_FAILED) {
+        ;
+    } else
+#endif
+    {
+        if (flen < 0)
+            flen = 0;
+        p = malloc(flen+1);
+        lseek(fd, 0, SEEK_SET);
+        n = 0;
+        while (n<flen && (r=read(fd, p+n, flen-n))>0)
+            n += r;
+        p[n] = '\0';
+    }
+    close(fd);
+    fi->contents = p;
+}
+
+/*
+ * Start reading a file. The file currently being
+ * read (if any) is suspended until the end of the
+ * new one is reached.
+ */
+static void init(char *file_path)
+{
+    FileInfo *fi;
+
+    fi = get_file_info(atom(file_path));
+    if (fi->contents == NULL)
+        read_contents(fi);
+
+    if (curr_file != NULL) {
+        struct IncFile *f;
+
+        f = malloc(sizeof(struct IncFile));
+        f->file = curr_file;
+        f->curr = curr;
+        f->line = curr_line;
+        f->column = curr_column;
+        f->prev = inc_stack;
+        inc_stack = f;
+    }
+
+    curr_file = fi;
+    curr = fi->contents;
+    fi->guard_state = GUARD_START;
     /*
      * Set the current file global var. Each token has attached
      * the name of the file from where it was obtained. This is
      * used for diagnostic messages.
      */
-    curr_source_file = dup_lexeme(file_path);
+    curr_source_file = fi->path;
+    curr_line = 1, curr_column = 0;
+    at_line_start = TRUE;
+}
+
+/*
+ * The end of an included file was reached,
+ * resume reading the file that included it.
+ */
+static void resume_includer(void)
+{
+    struct IncFile *f;
+
+    f = inc_stack;
+    curr_file = f->file;
+    curr = f->curr;
+    curr_source_file = curr_file->path;
+    curr_line = f->line;
+    curr_column = f->column;
+    inc_stack = f->prev;
+    free(f);
+    at_line_start = TRUE;
 }
 
 static char *dupdir(char *dir)
@@ -226,13 +415,15 @@ static char *search_quote(char *inc_arg)
     return search_angle(inc_arg);
 }
 
+static PreTokenNode *next_node(PreTokenNode *p);
+
 static PreToken lookahead(int i)
 {
     PreTokenNode *p;
 
     p = curr_tok;
-    while (/*p!=NULL && */--i)
-        p = p->next;
+    while (--i)
+        p = next_node(p);
     return p->token;
 }
 
@@ -241,8 +432,8 @@ static char *get_lexeme(int i)
     PreTokenNode *p;
 
     p = curr_tok;
-    while (/*p!=NULL && */--i)
-        p = p->next;
+    while (--i)
+        p = next_node(p);
     return p->lexeme;
 }
 
@@ -536,7 +727,7 @@ static PreToken get_token(void)
                 REWIND();
                 state = STATE_START;
             } else if (c == '\0') {
-                REWIND();
+                /* get_next_char() doesn't go past the '\0' */
                 state = STATE_START;
             }
             break;
@@ -559,31 +750,52 @@ static PreToken get_token(void)
 }
 
 /*
- * Tokenize the buffer `buf' and return
- * the resulting chain of tokens.
+ * Tokenize the next line of the file being read and append
+ * the resulting tokens to `p'. The end of an included file
+ * doesn't produce an EOF token, the tokenization continues
+ * with the file that included it. If the last line of a file
+ * is not terminated by a new-line, one is supplied.
  */
-static PreTokenNode *tokenize(void)
+static void tokenize_line(PreTokenNode *p)
 {
     PreToken tok;
-    PreTokenNode *n, *p;
+    char *lexeme;
 
-    curr_line = 1; /* initialize line counter */
-    tok = get_token();
-    n = p = penultimate_node = new_node(tok, token_string);
-    p->next_char = *curr;
-
-    while (tok != PRE_TOK_EOF) {
+    for (;;) {
         tok = get_token();
-        p->next = new_node(tok, token_string);
+        if (tok == PRE_TOK_EOF) {
+            if (!at_line_start) {
+                tok = PRE_TOK_NL;
+                strcpy(token_string, "\n");
+            } else if (inc_stack != NULL) {
+                resume_includer();
+                continue;
+            }
+        }
+        if (tok == PRE_TOK_STRLIT)
+            lexeme = dup_lexeme(token_string);
+        else
+            lexeme = atom(token_string);
+        p->next = new_node(tok, lexeme);
         p->next->next_char = *curr;
-        penultimate_node = p;
         p = p->next;
+        at_line_start = (tok == PRE_TOK_NL);
+        if (tok==PRE_TOK_NL || tok==PRE_TOK_EOF)
+            break;
     }
+}
 
-    /* the file buffer is not needed anymore */
-    free(buf);
-
-    return n;
+/*
+ * Return the token that follows `p'. Lines
+ * are tokenized as they are needed.
+ */
+static PreTokenNode *next_node(PreTokenNode *p)
+{
+    if (p->token == PRE_TOK_EOF)
+        return p;
+    if (p->next == NULL)
+        tokenize_line(p);
+    return p->next;
 }
 
 #undef SRC_FILE
@@ -598,9 +810,10 @@ void install_macro(MacroKind kind, char *name, PreTokenNode *rep, PreTokenNode *
     Macro *np;
     unsigned h;
 
+    name = atom(name);
     h = HASH_VAL(name);
 	for(np = macro_table[h]; np != NULL; np = np->next)
-		if(np->enabled && equal(name, np->name))
+		if(np->enabled && name == np->name)
 			break;
 
     if (np == NULL) { /* not found */
@@ -624,7 +837,7 @@ static void uninstall_macro(char *name)
 
     h = HASH_VAL(name);
 	for(np=macro_table[h], prev=NULL;
-        np!=NULL && not_equal(name, np->name);
+        np!=NULL && name != np->name;
         prev=np, np=np->next);
 
 	if (np == NULL)
@@ -641,17 +854,33 @@ static Macro *lookup_macro(char *name)
 	Macro *np;
 
 	for(np = macro_table[HASH_VAL(name)]; np != NULL; np = np->next)
-		if(np->enabled && equal(name, np->name))
+		if(np->enabled && name == np->name)
 			return np;
 	return NULL;
 }
 
+/* like lookup_macro(), but a disabled macro is returned if there is no other */
+static Macro *find_macro(char *name)
+{
+    Macro *np, *disabled;
+
+    disabled = NULL;
+    for (np = macro_table[HASH_VAL(name)]; np != NULL; np = np->next) {
+        if (name == np->name) {
+            if (np->enabled)
+                return np;
+            disabled = np;
+        }
+    }
+    return disabled;
+}
+
 static void reenable_macro(char *name)
 {
     Macro *m;
 
     for(m = macro_table[HASH_VAL(name)]; m != NULL; m = m->next) {
-        if(equal(name, m->name)) {
+        if(name == m->name) {
             m->enabled = TRUE;
             break;
         }
@@ -668,7 +897,7 @@ static char *pre_token_table[] = {
 static void match(PreToken x)
 {
     if (curr_tok->token == x)
-        curr_tok = curr_tok->next;
+        curr_tok = next_node(curr_tok);
     else
         ERROR("expecting: `%s'; found: `%s'", pre_token_table[x], curr_tok->lexeme);
 }
@@ -678,35 +907,17 @@ static void match2(PreToken x)
 {
     if (curr_tok->token == x) {
         curr_tok->deleted = TRUE;
-        curr_tok = curr_tok->next;
+        curr_tok = next_node(curr_tok);
     } else {
         ERROR("expecting: `%s'; found: `%s'", pre_token_table[x], curr_tok->lexeme);
     }
 }
 
-static int is_group_part(void)
-{
-    /*
-     * group_part cannot begin with neither EOF
-     * nor #elif nor #else nor #endif.
-     */
-    if (lookahead(1) == PRE_TOK_EOF
-    || (equal(get_lexeme(1), "#")
-    && (equal(get_lexeme(2), "elif")
-    ||  equal(get_lexeme(2), "else")
-    ||  equal(get_lexeme(2), "endif"))))
-        return FALSE;
-    return TRUE;
-}
-
-/* recursive parser functions */
-static void group(int skip);
-static void group_part(int skip);
-static void if_section(int skip);
-static int if_group(int skip);
-static int elif_groups(int skip);
-static int elif_group(int skip);
-static void else_group(int skip);
+/* parser functions */
+static void group_part(void);
+static void if_group(int skip);
+static void elif_group(void);
+static void else_group(void);
 static void endif_line(void);
 static void control_line(int skip);
 static void pp_tokens(int skip);
@@ -728,37 +939,103 @@ static long long pre_eval_una_expr(void);
 static long long pre_eval_pri_expr(void);
 
 /*
+ * Return the next preprocessing token of the translation unit.
+ *
+ * The preprocessor works one line at a time and only when the lexer
+ * asks for more tokens. The nodes of the tokens deleted during
+ * preprocessing (directives, skipped groups, macro calls, etc.) are
+ * recycled here; the ones returned must be given back by the caller
+ * through free_pre_token(). New-line tokens are returned (marked as
+ * deleted) so that the -p option can reproduce the line structure.
+ *
  * preprocessing_file = [ group ] end_of_file
+ * group = group_part { group_part }
  */
-static void preprocessing_file(void)
+PreTokenNode *get_pre_token(void)
 {
-    if (lookahead(1) != PRE_TOK_EOF)
-        group(FALSE);
-    match(PRE_TOK_EOF);
+    PreTokenNode *p;
+
+    for (;;) {
+        while (out_head == curr_tok) {
+            if (curr_tok->token == PRE_TOK_EOF) {
+                if (if_nest_level > 0)
+                    ERROR("`#endif' expected");
+                return curr_tok;
+            }
+            group_part();
+        }
+        p = out_head;
+        out_head = out_head->next;
+        if (!p->deleted || p->token==PRE_TOK_NL)
+            return p;
+        free_pre_token(p);
+    }
 }
 
 /*
- * group = group_part { group_part }
+ * Follow the shape of file `fi' as its lines are processed:
+ * it has an include guard if, new-lines aside, it consists
+ * of a single #ifndef section (without #elif/#else).
  */
-void group(int skip)
+static void track_include_guard(FileInfo *fi)
 {
-    group_part(skip);
-    while (/*lookahead(1)!=PRE_TOK_EOF && */is_group_part())
-        group_part(skip);
+    char *dir;
+
+    if (fi->guard_state==GUARD_NONE || lookahead(1)==PRE_TOK_NL)
+        return;
+    dir = (get_lexeme(1) == pre_atoms[A_SHARP]) ? get_lexeme(2) : NULL;
+    switch (fi->guard_state) {
+    case GUARD_START:
+        if (dir==pre_atoms[A_IFNDEF] && lookahead(3)==PRE_TOK_ID && lookahead(4)==PRE_TOK_NL) {
+            fi->guard = get_lexeme(3);
+            fi->guard_level = if_nest_level;
+            fi->guard_state = GUARD_OPEN;
+        } else {
+            fi->guard_state = GUARD_NONE;
+        }
+        break;
+    case GUARD_OPEN:
+        if (if_nest_level == fi->guard_level+1) {
+            if (dir == pre_atoms[A_ENDIF])
+                fi->guard_state = GUARD_CLOSED;
+            else if (dir==pre_atoms[A_ELIF] || dir==pre_atoms[A_ELSE])
+                fi->guard_state = GUARD_NONE;
+        }
+        break;
+    case GUARD_CLOSED: /* something after the #endif */
+        fi->guard_state = GUARD_NONE;
+        break;
+    }
 }
 
 /*
  * group_part = [ pp_tokens ] new_line |
  *              if_section |
  *              control_line
+ *
+ * if_section = if_group [ elif_groups ] [ else_group ] endif_line
+ * elif_groups = elif_group { elif_group }
+ *
+ * The groups of the if-sections are not parsed recursively, instead
+ * the state of each unfinished if-section is kept in `if_stack[]'.
  */
-void group_part(int skip)
+void group_part(void)
 {
-    if (equal(get_lexeme(1), "#")) {
-        if (equal(get_lexeme(2), "if")
-        ||  equal(get_lexeme(2), "ifdef")
-        ||  equal(get_lexeme(2), "ifndef"))
-            if_section(skip);
+    int skip;
+
+    skip = (if_nest_level > 0) ? if_stack[if_nest_level-1].skip : FALSE;
+    track_include_guard(get_file_info(curr_tok->src_file));
+    if (get_lexeme(1) == pre_atoms[A_SHARP]) {
+        if (get_lexeme(2) == pre_atoms[A_IF]
+        ||  get_lexeme(2) == pre_atoms[A_IFDEF]
+        ||  get_lexeme(2) == pre_atoms[A_IFNDEF])
+            if_group(skip);
+        else if (get_lexeme(2) == pre_atoms[A_ELIF])
+            elif_group();
+        else if (get_lexeme(2) == pre_atoms[A_ELSE])
+            else_group();
+        else if (get_lexeme(2) == pre_atoms[A_ENDIF])
+            endif_line();
         else
             control_line(skip);
     } else {
@@ -768,38 +1045,26 @@ void group_part(int skip)
     }
 }
 
-/*
- * if_section = if_group [ elif_groups ] [ else_group ] endif_line
- */
-void if_section(int skip)
-{
-    int if_cond, elif_cond = 0;
-
-    if_cond = if_group(skip);
-    if (equal(get_lexeme(1), "#") && equal(get_lexeme(2), "elif"))
-        elif_cond = elif_groups(skip || if_cond);
-    if (equal(get_lexeme(1), "#") && equal(get_lexeme(2), "else"))
-        else_group(skip || if_cond || elif_cond);
-    endif_line();
-}
-
 /*
  * if_group = "#" "if" constant_expression new_line [ group ] |
  *            "#" "ifdef" identifier new_line [ group ] |
  *            "#" "ifndef" identifier new_line [ group ]
  */
-int if_group(int skip)
+void if_group(int skip)
 {
     long long cond_res;
 
+    if (if_nest_level >= MAX_IF_NEST)
+        ERROR("conditional inclusion directives nested too deeply");
+
     /*
      * group_part() confirmed either #if, #ifdef or #ifndef
      */
     match2(PRE_TOK_PUNCTUATOR); /* # */
-    if (equal(get_lexeme(1), "if")) {
+    if (get_lexeme(1) == pre_atoms[A_IF]) {
         match2(PRE_TOK_ID);
         cond_res = pre_eval_expr();
-    } else if (equal(get_lexeme(1), "ifdef")) {
+    } else if (get_lexeme(1) == pre_atoms[A_IFDEF]) {
         match2(PRE_TOK_ID);
         cond_res = (lookup_macro(get_lexeme(1)) != NULL);
         match2(PRE_TOK_ID);
@@ -809,67 +1074,63 @@ int if_group(int skip)
         match2(PRE_TOK_ID);
     }
     match2(PRE_TOK_NL);
+
     /*
      * Skip if the condition evaluated to false or if the
      * if/ifdef/ifndef already is within of a block being skipped.
      */
-    skip = (cond_res==0)?1:skip;
-    if (is_group_part())
-        group(skip);
-
-    return !!cond_res;
-}
-
-/*
- * elif_groups = elif_group { elif_group }
- */
-int elif_groups(int skip)
-{
-    int cond_res;
-
-    cond_res = elif_group(skip);
-    while (equal(get_lexeme(1), "#") && equal(get_lexeme(2), "elif"))
-        if (elif_group(skip || cond_res))
-            cond_res = TRUE;
-
-    return cond_res;
+    if_stack[if_nest_level].outer_skip = (char)skip;
+    if_stack[if_nest_level].taken = (cond_res != 0);
+    if_stack[if_nest_level].in_else = FALSE;
+    if_stack[if_nest_level].skip = (cond_res==0)?1:(char)skip;
+    ++if_nest_level;
 }
 
 /*
  * elif_group = "#" "elif" constant_expression new_line [ group ]
  */
-int elif_group(int skip)
+void elif_group(void)
 {
     long long cond_res;
 
+    if (if_nest_level == 0)
+        ERROR("`#elif' without `#if'");
+    if (if_stack[if_nest_level-1].in_else)
+        ERROR("`#endif' expected");
+
     /*
-     * if_section()/elif_groups() confirmed # and elif
+     * group_part() confirmed # and elif
      */
     match2(PRE_TOK_PUNCTUATOR);
     match2(PRE_TOK_ID);
     cond_res = pre_eval_expr();
     match2(PRE_TOK_NL);
 
-    skip = (cond_res==0)?1:skip;
-    if (is_group_part())
-        group(skip);
-
-    return !!cond_res;
+    if_stack[if_nest_level-1].skip = (cond_res==0)?1:(if_stack[if_nest_level-1].outer_skip
+                                                     || if_stack[if_nest_level-1].taken);
+    if (cond_res)
+        if_stack[if_nest_level-1].taken = TRUE;
 }
 
 /*
  * else_group = "#" "else" new_line [ group ]
  */
-void else_group(int skip)
+void else_group(void)
 {
+    if (if_nest_level == 0)
+        ERROR("`#else' without `#if'");
+    if (if_stack[if_nest_level-1].in_else)
+        ERROR("`#endif' expected");
+
     /*
-     * if_section() confirmed # and else
+     * group_part() confirmed # and else
      */
     match2(PRE_TOK_PUNCTUATOR); /* # */
     match2(PRE_TOK_ID); /* else */
     match2(PRE_TOK_NL);
-    if (is_group_part())
-        group(skip);
+
+    if_stack[if_nest_level-1].skip = if_stack[if_nest_level-1].outer_skip || if_stack[if_nest_level-1].taken;
+    if_stack[if_nest_level-1].in_else = TRUE;
 }
 
 /*
@@ -877,15 +1138,70 @@ void else_group(int skip)
  */
 void endif_line(void)
 {
-    if (equal(get_lexeme(1), "#"))
-        match2(PRE_TOK_PUNCTUATOR);
-    else
-        ERROR("`#endif' expected");
-    if (equal(get_lexeme(1), "endif"))
-        match2(PRE_TOK_ID);
-    else
-        ERROR("`#endif' expected");
+    if (if_nest_level == 0)
+        ERROR("`#endif' without `#if'");
+
+    /*
+     * group_part() confirmed # and endif
+     */
+    match2(PRE_TOK_PUNCTUATOR); /* # */
+    match2(PRE_TOK_ID); /* endif */
     match2(PRE_TOK_NL);
+    --if_nest_level;
+}
+
+/*
+ * Remove the `.' components, the repeated slashes and
+ * the `dir/..' pairs from `path' (in place), so that the
+ * different spellings of the path of a file (for example
+ * "sub/s.h" and "./sub/s.h") share the same FileInfo.
+ */
+static void simplify_path(char *path)
+{
+    char *s, *d, *root, *q;
+
+    s = d = path;
+    if (*s == '/')
+        *d++ = *s++;
+    root = d;
+    while (*s != '\0') {
+        if (*s == '/') {
+            ++s;
+        } else if (s[0]=='.' && (s[1]=='/' || s[1]=='\0')) {
+            ++s;
+        } else if (s[0]=='.' && s[1]=='.' && (s[2]=='/' || s[2]=='\0')
+        && d>root && !(d-root>=3 && d[-3]=='.' && d[-2]=='.' && (d-3==root || d[-4]=='/'))) {
+            /* drop the previous component (unless it is a `..' itself) */
+            for (q = d-1; q>root && q[-1]!='/'; q--)
+                ;
+            d = q;
+            s += 2;
+        } else {
+            while (*s!='\0' && *s!='/')
+                *d++ = *s++;
+            if (*s == '/')
+                *d++ = *s++;
+        }
+    }
+    if (d>root && d[-1]=='/')
+        --d;
+    *d = '\0';
+}
+
+/*
+ * #include the file at `path', unless that
+ * would not change the translation unit.
+ */
+static void include_file(char *path)
+{
+    FileInfo *fi;
+
+    simplify_path(path);
+    fi = get_file_info(atom(path));
+    if (fi->once
+    || (fi->guard_state==GUARD_CLOSED && lookup_macro(fi->guard)!=NULL))
+        return;
+    init(path);
 }
 
 static void simple_define(void);
@@ -912,9 +1228,8 @@ void control_line(int skip)
     /*
      * Identify and interpret directive.
      */
-    if (equal(get_lexeme(1), "include")) {
+    if (get_lexeme(1) == pre_atoms[A_INCLUDE]) {
         char inc_arg[256], *path;
-        PreTokenNode *tokenized_file;
 
         match2(PRE_TOK_ID);
         /*
@@ -928,12 +1243,12 @@ void control_line(int skip)
             inc_arg[strlen(inc_arg)-1] = '\0';
             if ((path=search_quote(inc_arg)) == NULL)
                 ERROR("include: cannot find file `%s'", inc_arg);
-            init(path);
+            include_file(path);
             free(path);
             match2(lookahead(1)); /* filename */
-        } else if (equal(get_lexeme(1), "<")) {
+        } else if (get_lexeme(1) == pre_atoms[A_LT]) {
             match2(PRE_TOK_PUNCTUATOR);
-            if (equal(get_lexeme(1), ">"))
+            if (get_lexeme(1) == pre_atoms[A_GT])
                 ERROR("include: empty `<>'");
             inc_arg[0] = '\0';
             do {
@@ -941,26 +1256,20 @@ void control_line(int skip)
                     ERROR("include: missing closing `>'");
                 strcat(inc_arg, get_lexeme(1));
                 match2(lookahead(1));
-            } while (not_equal(get_lexeme(1), ">"));
+            } while (get_lexeme(1) != pre_atoms[A_GT]);
             if ((path=search_angle(inc_arg)) == NULL)
                 ERROR("include: cannot find file `%s'", inc_arg);
-            init(path);
+            include_file(path);
             free(path);
             match2(PRE_TOK_PUNCTUATOR); /* > */
         } else {
             ERROR("include: \"file.h\" or <file.h> expected");
         }
-        /* now at new-line... */
-
         /*
-         * Tokenize the file's content and insert the
-         * result right after the #include directive.
+         * Now at new-line. The line that follows is
+         * going to be read from the included file.
          */
-        tokenized_file = tokenize();
-        /* skip included file's EOF token */
-        penultimate_node->next = curr_tok->next;
-        curr_tok->next = tokenized_file;
-    } else if (equal(get_lexeme(1), "define")) {
+    } else if (get_lexeme(1) == pre_atoms[A_DEFINE]) {
         match2(PRE_TOK_ID);
         if (lookahead(1) == PRE_TOK_ID) {
             if (curr_tok->next_char == '(')
@@ -970,13 +1279,13 @@ void control_line(int skip)
         } else {
             ERROR("define: name expected");
         }
-    } else if (equal(get_lexeme(1), "undef")) {
+    } else if (get_lexeme(1) == pre_atoms[A_UNDEF]) {
         match2(PRE_TOK_ID);
         if (lookahead(1) == PRE_TOK_ID)
             uninstall_macro(get_lexeme(1));
         else
             ERROR("undef: name expected");
-    } else if (equal(get_lexeme(1), "error")) {
+    } else if (get_lexeme(1) == pre_atoms[A_ERROR]) {
         char buf[ERR_BUF_SIZ], *cp;
 
         buf[0] = '\0';
@@ -993,7 +1302,12 @@ void control_line(int skip)
             }
         }
         ERROR("%s", buf);
-    } else if (equal(get_lexeme(1), "\n")) {
+    } else if (get_lexeme(1) == pre_atoms[A_PRAGMA]) {
+        match2(PRE_TOK_ID);
+        if (get_lexeme(1) == pre_atoms[A_ONCE])
+            get_file_info(curr_tok->src_file)->once = TRUE;
+        /* other pragmas are ignored */
+    } else if (get_lexeme(1) == pre_atoms[A_NEWLINE]) {
         ; /* NULL directive */
     /* --> add the remaining directives here <-- */
     } else {
@@ -1009,9 +1323,33 @@ bottom:
     match2(PRE_TOK_NL);
 }
 
+/*
+ * Make a copy of the rest of the current line (new-line included).
+ * The nodes of the line itself are going to be recycled.
+ */
+static PreTokenNode *copy_line(void)
+{
+    PreTokenNode *p, *copy, *temp;
+
+    p = curr_tok;
+    copy = temp = new_node(p->token, NULL);
+    *temp = *p;
+    while (p->token != PRE_TOK_NL) {
+        p = p->next;
+        temp->next = new_node(p->token, NULL);
+        temp = temp->next;
+        *temp = *p;
+    }
+    temp->next = NULL;
+    return copy;
+}
+
 void simple_define(void)
 {
-    install_macro(SIMPLE_MACRO, get_lexeme(1), curr_tok->next, NULL);
+    PreTokenNode *def;
+
+    def = copy_line();
+    install_macro(SIMPLE_MACRO, def->lexeme, def->next, NULL);
 }
 
 void parameterized_define(void)
@@ -1020,32 +1358,33 @@ void parameterized_define(void)
      * TODO: check for duplicate parameter names.
      */
 
-    PreTokenNode *rep;
+    PreTokenNode *def, *rep;
 
+    def = copy_line();
     /*
      * #define ABC( a1, a2 ... an   )
      *          ^                   ^
      *    we are here           and must go here
      */
-    for (rep = curr_tok->next->next; not_equal(rep->lexeme, ")"); ) {
-        if (equal(rep->lexeme, "...")) {
-            if (not_equal(rep->next->lexeme, ")"))
+    for (rep = def->next->next; rep->lexeme != pre_atoms[A_RPAREN]; ) {
+        if (rep->lexeme == pre_atoms[A_ELLIPSIS]) {
+            if (rep->next->lexeme != pre_atoms[A_RPAREN])
                 ERROR("`...' not at the end of the parameter list");
         } else if (rep->token != PRE_TOK_ID) {
             ERROR("expecting parameter name");
         }
 
         rep = rep->next;
-        if (equal(rep->lexeme, ",")) {
+        if (rep->lexeme == pre_atoms[A_COMMA]) {
             rep = rep->next;
-            if (equal(rep->lexeme, ")")) /* something like #define A(x,) */
+            if (rep->lexeme == pre_atoms[A_RPAREN]) /* something like #define A(x,) */
                 ERROR("missing parameter name");
-        } else if (not_equal(rep->lexeme, ")")) {
+        } else if (rep->lexeme != pre_atoms[A_RPAREN]) {
             /* otherwise (a,b...) would be considered valid */
             ERROR("expecting parameter name");
         }
     }
-    install_macro(PARAMETERIZED_MACRO, get_lexeme(1), rep->next, curr_tok->next->next);
+    install_macro(PARAMETERIZED_MACRO, def->lexeme, rep->next, def->next->next);
 }
 
 /*
@@ -1080,7 +1419,7 @@ void preprocessing_token(int skip)
     if (lookahead(1) == PRE_TOK_ID) {
         Macro *m;
 
-        if (equal(curr_tok->lexeme, "__FILE__")) {
+        if (curr_tok->lexeme == pre_atoms[A_FILE]) {
             /*
              * Note: __FILE__ depends on the compiler's working directory.
              * Example invocations and __FILE__'s value:
@@ -1098,16 +1437,24 @@ void preprocessing_token(int skip)
             curr_tok->lexeme[n+2] = '\0';
             curr_tok->token = PRE_TOK_STRLIT;
             match(lookahead(1));
-        } else if (equal(curr_tok->lexeme, "__LINE__")) {
+        } else if (curr_tok->lexeme == pre_atoms[A_LINE]) {
             char n[11];
 
             sprintf(n, "%d", curr_tok->src_line);
-            curr_tok->lexeme = dup_lexeme(n);
+            curr_tok->lexeme = atom(n);
             curr_tok->token = PRE_TOK_NUM;
             match(lookahead(1));
-        } else if ((m=lookup_macro(get_lexeme(1))) != NULL) {
+        } else if (!curr_tok->no_expand && (m=find_macro(get_lexeme(1))) != NULL) {
             DEBUG_PRINTF("found macro `%s'\n", get_lexeme(1));
-            if (m->kind == SIMPLE_MACRO)
+            if (!m->enabled) {
+                /*
+                 * The name of a macro found while replacing that macro is
+                 * not replaced, not even when it is rescanned later as part
+                 * of the argument of another macro.
+                 */
+                curr_tok->no_expand = TRUE;
+                match(lookahead(1));
+            } else if (m->kind == SIMPLE_MACRO)
                 expand_simple_macro(m);
             else
                 expand_parameterized_macro(m);
@@ -1183,22 +1530,26 @@ static PreTokenNode *copy_arg(PreTokenNode **a, ParaListKind kind)
     int pn; /* parenthesis nesting level counter */
     PreTokenNode *copy, *temp;
 
-    if ((*a)->token==PRE_TOK_PUNCTUATOR && (equal((*a)->lexeme, ",") || equal((*a)->lexeme, ")")))
+    if ((*a)->token==PRE_TOK_PUNCTUATOR && ((*a)->lexeme == pre_atoms[A_COMMA] || (*a)->lexeme == pre_atoms[A_RPAREN]))
         ERROR("empty macro argument");
 
     pn = 0;
-    if ((*a)->token==PRE_TOK_PUNCTUATOR && equal((*a)->lexeme, "("))
+    if ((*a)->token==PRE_TOK_PUNCTUATOR && (*a)->lexeme == pre_atoms[A_LPAREN])
         ++pn;
     copy = temp = new_node((*a)->token, (*a)->lexeme);
-    (*a) = (*a)->next;
+    copy_node_info(copy, *a);
+    copy->no_expand = (*a)->no_expand;
+    (*a) = next_node(*a);
 
-    while (pn>0 || ((kind==VAR_LIST||not_equal((*a)->lexeme, ",")) && not_equal((*a)->lexeme, ")"))) {
-        if ((*a)->token==PRE_TOK_PUNCTUATOR && equal((*a)->lexeme, "(")) pn++;
-        else if ((*a)->token==PRE_TOK_PUNCTUATOR && equal((*a)->lexeme, ")")) pn--;
+    while (pn>0 || ((kind==VAR_LIST||(*a)->lexeme != pre_atoms[A_COMMA]) && (*a)->lexeme != pre_atoms[A_RPAREN])) {
+        if ((*a)->token==PRE_TOK_PUNCTUATOR && (*a)->lexeme == pre_atoms[A_LPAREN]) pn++;
+        else if ((*a)->token==PRE_TOK_PUNCTUATOR && (*a)->lexeme == pre_atoms[A_RPAREN]) pn--;
         else if ((*a)->token == PRE_TOK_EOF) ERROR("missing `)' in macro call");
         temp->next = new_node((*a)->token, (*a)->lexeme);
+        copy_node_info(temp->next, *a);
+        temp->next->no_expand = (*a)->no_expand;
         temp = temp->next;
-        *a = (*a)->next;
+        *a = next_node(*a);
     }
     return copy;
 }
@@ -1212,16 +1563,61 @@ static PreTokenNode *copy_arg2(PreTokenNode *a, PreTokenNode **last)
     PreTokenNode *copy;
 
     copy = *last = new_node(a->token, a->lexeme);
+    copy_node_info(copy, a);
+    copy->no_expand = a->no_expand;
     a = a->next;
 
     while (a != NULL) {
         (*last)->next = new_node(a->token, a->lexeme);
         *last = (*last)->next;
+        copy_node_info(*last, a);
+        (*last)->no_expand = a->no_expand;
         a = a->next;
     }
     return copy;
 }
 
+/*
+ * Fully macro-replace an argument (a list made by copy_arg()) before
+ * it is substituted into the replacement list. The argument is
+ * scanned by itself, as if it were the rest of the file.
+ */
+static PreTokenNode *expand_arg(PreTokenNode *a)
+{
+    PreTokenNode *p, *q, *saved_curr, *res, *last;
+
+    if (a == NULL)
+        return NULL;
+    for (p = a; p->next != NULL; p = p->next)
+        ;
+    p->next = new_node(PRE_TOK_EOF, NULL);
+    copy_node_info(p->next, p);
+
+    saved_curr = curr_tok;
+    curr_tok = a;
+    while (curr_tok->token != PRE_TOK_EOF)
+        preprocessing_token(FALSE);
+    curr_tok = saved_curr;
+
+    /* keep what was not deleted */
+    res = last = NULL;
+    for (p = a; p->token != PRE_TOK_EOF; p = q) {
+        q = p->next;
+        if (p->deleted) {
+            free_pre_token(p);
+            continue;
+        }
+        p->next = NULL;
+        if (last == NULL)
+            res = p;
+        else
+            last->next = p;
+        last = p;
+    }
+    free_pre_token(p);
+    return res;
+}
+
 void expand_parameterized_macro(Macro *m)
 {
     PreTokenNode *r, *p, *prev, *param, *arg;
@@ -1232,9 +1628,9 @@ void expand_parameterized_macro(Macro *m)
      * The name of a function-like macro not followed by
      * left parenthesis is not an invocation to the macro.
      */
-    arg = curr_tok->next;
-    while (arg->token==PRE_TOK_NL || arg->token==PRE_TOK_MACRO_REENABLER) arg = arg->next;
-    if (not_equal(arg->lexeme, "(")) {
+    arg = next_node(curr_tok);
+    while (arg->token==PRE_TOK_NL || arg->token==PRE_TOK_MACRO_REENABLER) arg = next_node(arg);
+    if (arg->lexeme != pre_atoms[A_LPAREN]) {
         match(lookahead(1));
         return;
     }
@@ -1245,29 +1641,29 @@ void expand_parameterized_macro(Macro *m)
 
     param = m->params;
     // arg = curr_tok->next->next; /* ID -> "(" -> first-argument */
-    arg = arg->next; /* first-argument */
+    arg = next_node(arg); /* first-argument */
 
     /*
      * Associate actual argument token strings
      * with the corresponding formal parameter
      * names.
      */
-    while (not_equal(param->lexeme, ")") && not_equal(arg->lexeme, ")")) {
-        if (equal(param->lexeme, "...")) {
-            par_arg_tab[tab_size][0] = new_node(PRE_TOK_ID, "__VA_ARGS__");
-            par_arg_tab[tab_size][1] = copy_arg(&arg, VAR_LIST); /* arg is left pointing to ")" */
+    while (param->lexeme != pre_atoms[A_RPAREN] && arg->lexeme != pre_atoms[A_RPAREN]) {
+        if (param->lexeme == pre_atoms[A_ELLIPSIS]) {
+            par_arg_tab[tab_size][0] = new_node(PRE_TOK_ID, pre_atoms[A_VA_ARGS]);
+            par_arg_tab[tab_size][1] = expand_arg(copy_arg(&arg, VAR_LIST)); /* arg is left pointing to ")" */
             ++tab_size;
             param = param->next; /* advance to ")" */
             break;
         }
 
         par_arg_tab[tab_size][0] = param;
-        par_arg_tab[tab_size][1] = copy_arg(&arg, FIXED_LIST); /* arg is left pointing to "," or ")" */
+        par_arg_tab[tab_size][1] = expand_arg(copy_arg(&arg, FIXED_LIST)); /* arg is left pointing to "," or ")" */
         ++tab_size;
 
         param = param->next; /* advance to "," or ")" */
 
-        if (not_equal(param->lexeme, arg->lexeme)) {
+        if (param->lexeme != arg->lexeme) {
             /*
              * Check if it's the case where there are not
              * actual arguments corresponding to '...'.
@@ -1275,20 +1671,20 @@ void expand_parameterized_macro(Macro *m)
              *      #define ABC(a,...) a+__VA_ARGS__
              *      ABC(123)
              */
-            if (equal(param->lexeme, ",") && equal(param->next->lexeme, "...") /*&& equal(arg->lexeme, ")")*/)
+            if (param->lexeme == pre_atoms[A_COMMA] && param->next->lexeme == pre_atoms[A_ELLIPSIS] /*&& arg->lexeme == pre_atoms[A_RPAREN]*/)
                 param = param->next;
             else
                 ERROR("argument number mismatch in macro call");
-        } else if (not_equal(param->lexeme, ")")) {
-            param=param->next, arg=arg->next;
+        } else if (param->lexeme != pre_atoms[A_RPAREN]) {
+            param=param->next, arg=next_node(arg);
         }
     }
 
-    if (not_equal(param->lexeme, arg->lexeme)) { /* both should be equal to ")" */
-        if (not_equal(param->lexeme, "...")) { /* or '...' must not have matching arguments */
+    if (param->lexeme != arg->lexeme) { /* both should be equal to ")" */
+        if (param->lexeme != pre_atoms[A_ELLIPSIS]) { /* or '...' must not have matching arguments */
             ERROR("argument number mismatch in macro call");
         } else {
-            par_arg_tab[tab_size][0] = new_node(PRE_TOK_ID, "__VA_ARGS__");
+            par_arg_tab[tab_size][0] = new_node(PRE_TOK_ID, pre_atoms[A_VA_ARGS]);
             par_arg_tab[tab_size][1] = NULL;
             ++tab_size;
         }
@@ -1320,7 +1716,7 @@ void expand_parameterized_macro(Macro *m)
         }
 
         for (i = 0; i < tab_size; i++) {
-            if (equal(par_arg_tab[i][0]->lexeme, p->lexeme)) {
+            if (par_arg_tab[i][0]->lexeme == p->lexeme) {
                 // PreTokenNode *last;
 
                 if (par_arg_tab[i][1] != NULL) {
@@ -1333,7 +1729,7 @@ void expand_parameterized_macro(Macro *m)
                         /* <a -> x> -> b -> c -> NULL */
                         r = copy_arg2(par_arg_tab[i][1], &last);
                     last->next = p->next;
-                    /*free(p->lexeme), free(p);*/
+                    free_pre_token(p);
                     prev = last;
                     p = last->next;
                 } else {
@@ -1344,12 +1740,12 @@ void expand_parameterized_macro(Macro *m)
                     if (prev != NULL) {
                         /* a -> <b -> > -> c -> NULL */
                         prev->next = p->next;
-                        /*free(p->lexeme), free(p);*/
+                        free_pre_token(p);
                         p = prev->next;
                     } else {
                         /* <a -> > -> b -> c -> NULL */
                         r = p->next;
-                        /*free(p->lexeme), free(p);*/
+                        free_pre_token(p);
                         p = r;
                     }
                 }
@@ -1363,21 +1759,18 @@ void expand_parameterized_macro(Macro *m)
     /*
      * Delete the original copies of the arguments.
      */
-    /*for (i = 0; i < tab_size; i++) {
+    for (i = 0; i < tab_size; i++) {
         PreTokenNode *temp;
 
-        if (equal(par_arg_tab[i][0]->lexeme, "__VA_ARGS__")) {
-            free(par_arg_tab[i][0]->lexeme);
-            free(par_arg_tab[i][0]);
-        }
+        if (par_arg_tab[i][0]->lexeme == pre_atoms[A_VA_ARGS])
+            free_pre_token(par_arg_tab[i][0]);
 
         while (par_arg_tab[i][1] != NULL) {
             temp = par_arg_tab[i][1];
             par_arg_tab[i][1] = par_arg_tab[i][1]->next;
-            free(temp->lexeme);
-            free(temp);
+            free_pre_token(temp);
         }
-    }*/
+    }
     /*while (r != NULL) {
         printf("r=%s\n", r->lexeme);
         r = r->next;
@@ -1409,20 +1802,106 @@ void expand_parameterized_macro(Macro *m)
 }
 
 /*
- * Preprocess the source file and any file
- * included through #include, and return a
- * sequence of preprocessing tokens.
+ * Start preprocessing the source file. The
+ * resulting preprocessing tokens are obtained
+ * one by one through get_pre_token().
  */
-PreTokenNode *preprocess(char *source_file)
+void preprocess(char *source_file)
 {
-    PreTokenNode *token_list;
+    int i;
+    PreTokenNode head;
 
+    for (i = 0; i < NPRE_ATOMS; i++)
+        pre_atoms[i] = atom(pre_atom_spellings[i]);
     pre_node_arena = arena_new(sizeof(PreTokenNode)*128, FALSE);
     pre_str_arena = arena_new(1024, FALSE);
     init(source_file);
-    token_list = curr_tok = tokenize();
-    preprocessing_file();
-    return token_list;
+    tokenize_line(&head);
+    out_head = curr_tok = head.next;
+}
+
+/*
+ * Precompiled headers: the macros defined and the files
+ * known to be guarded (or #pragma once) are saved.
+ */
+void pre_save_pch(void)
+{
+    int i, n;
+    Macro *m;
+    FileInfo *fi;
+    PchOff vec, off;
+
+    for (i = n = 0; i < MACRO_TABLE_SIZE; i++)
+        for (m = macro_table[i]; m != NULL; m = m->next)
+            ++n;
+    vec = pch_new_vector(n);
+    for (i = n = 0; i < MACRO_TABLE_SIZE; i++) {
+        for (m = macro_table[i]; m != NULL; m = m->next) {
+            off = pch_copy(m, sizeof(Macro));
+            pch_set_str(off+offsetof(Macro, name), m->name);
+            pch_set_ptr(off+offsetof(Macro, rep), pch_pre_tokens(m->rep));
+            pch_set_ptr(off+offsetof(Macro, params), pch_pre_tokens(m->params));
+            pch_set_ptr(off+offsetof(Macro, next), 0);
+            pch_set_elem(vec, n++, off);
+        }
+    }
+    pch_set_root(PCH_MACROS, vec);
+
+    for (i = n = 0; i < FILE_TABLE_SIZE; i++)
+        for (fi = file_table[i]; fi != NULL; fi = fi->next)
+            if (fi->guard_state==GUARD_CLOSED || fi->once)
+                ++n;
+    vec = pch_new_vector(n);
+    for (i = n = 0; i < FILE_TABLE_SIZE; i++) {
+        for (fi = file_table[i]; fi != NULL; fi = fi->next) {
+            if (fi->guard_state!=GUARD_CLOSED && !fi->once)
+                continue;
+            off = pch_copy(fi, sizeof(FileInfo));
+            pch_set_str(off+offsetof(FileInfo, path), fi->path);
+            pch_set_ptr(off+offsetof(FileInfo, contents), 0);
+            pch_set_str(off+offsetof(FileInfo, guard), fi->guard);
+            pch_set_ptr(off+offsetof(FileInfo, next), 0);
+            pch_set_elem(vec, n++, off);
+        }
+    }
+    pch_set_root(PCH_FILES, vec);
+}
+
+/*
+ * Macros already defined (i.e. from the command line) take
+ * precedence over the ones in the precompiled header.
+ */
+void pre_load_pch(void)
+{
+    unsigned i, n, h;
+    Macro **mv, *m;
+    FileInfo **fv, *fi;
+
+    mv = (Macro **)pch_get_vector(PCH_MACROS, &n);
+    for (i = n; i-- > 0; ) {
+        if (lookup_macro(mv[i]->name) != NULL)
+            continue;
+        m = malloc(sizeof(Macro));
+        *m = *mv[i];
+        m->enabled = TRUE;
+        h = HASH_VAL(m->name);
+        m->next = macro_table[h];
+        macro_table[h] = m;
+    }
+
+    fv = (FileInfo **)pch_get_vector(PCH_FILES, &n);
+    for (i = n; i-- > 0; ) {
+        h = atom_hash(fv[i]->path)%FILE_TABLE_SIZE;
+        for (fi = file_table[h]; fi != NULL; fi = fi->next)
+            if (fi->path == fv[i]->path)
+                break;
+        if (fi != NULL)
+            continue;
+        fi = malloc(sizeof(FileInfo));
+        *fi = *fv[i];
+        fi->next = file_table[h];
+        file_table[h] = fi;
+    }
 }
 
 /*                                 */
@@ -21,6 +21,7 @@ struct PreTokenNode {
     char next_char; /* needed to distinguish between
                       "name(" and "name (" in #define */
     char deleted; /* TRUE/FALSE */
+    char no_expand; /* name of a macro found while the macro was disabled */
     PreTokenNode *next;
 };
 typedef enum {
@@ -28,9 +29,13 @@ typedef enum {
     PARAMETERIZED_MACRO
 } MacroKind;
 
-PreTokenNode *preprocess(char *source_file);
+void preprocess(char *source_file);
+PreTokenNode *get_pre_token(void);
+void free_pre_token(PreTokenNode *p);
 void install_macro(MacroKind kind, char *name, PreTokenNode *rep, PreTokenNode *params);
 void add_angle_dir(char *dir);
 void add_quote_dir(char *dir);
+void pre_save_pch(void);
+void pre_load_pch(void);
 
 #endif
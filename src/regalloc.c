@@ -0,0 +1,287 @@
+/*
+ * Linear scan register allocator (Poletto & Sarkar).
+ *
+ * Live intervals are built over the quads of a function in code order from
+ * the LiveOut sets computed by dflow_LiveOut(); an interval is the smallest
+ * range of quads that covers every point where the candidate is live, so
+ * two candidates whose intervals don't overlap can share a register. When
+ * there are more overlapping intervals than registers, the one with the
+ * lowest weight (accesses scaled by loop nesting depth) stays in memory.
+ */
+#include "regalloc.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "util/util.h"
+#include "util/bset.h"
+#include "ic.h"
+#include "dflow.h"
+
+#define RA_MIN_WEIGHT   3   /* don't bother with candidates accessed fewer times */
+#define RA_MAX_DEPTH    5   /* loop nesting depth beyond which weights stop growing */
+
+signed char *ra_reg_of_nid;
+RAInterval *ra_intervals;
+int ra_nintervals;
+static int ra_max_intervals;
+static int *interval_of_nid;
+static BSet *cross_block_temps;
+static BSet *addressed_variables;
+static int (*candidate)(unsigned a);
+
+void ra_init(void)
+{
+    ra_reg_of_nid = malloc(nid_counter);
+    memset(ra_reg_of_nid, -1, nid_counter);
+    interval_of_nid = malloc(nid_counter*sizeof(int));
+    memset(interval_of_nid, -1, nid_counter*sizeof(int));
+}
+
+/*
+ * Call f() for every variable operand of quad i, first for the one
+ * defined (is_def=TRUE), then for the ones used.
+ */
+static void visit_operands(int i, void (*f)(unsigned a, int i, int is_def))
+{
+    unsigned tar, arg1, arg2;
+
+    tar = instruction(i).tar;
+    arg1 = instruction(i).arg1;
+    arg2 = instruction(i).arg2;
+
+    switch (instruction(i).op) {
+    case OpAdd: case OpSub: case OpMul: case OpDiv:
+    case OpRem: case OpSHL: case OpSHR: case OpAnd:
+    case OpOr: case OpXor: case OpEQ: case OpNEQ:
+    case OpLT: case OpLET: case OpGT: case OpGET:
+        f(tar, i, TRUE);
+        if (!const_addr(arg1))
+            f(arg1, i, FALSE);
+        if (!const_addr(arg2))
+            f(arg2, i, FALSE);
+        break;
+    case OpNeg: case OpCmpl: case OpNot: case OpCh:
+    case OpAsn: case OpUCh: case OpSh: case OpUSh:
+    case OpLLSX: case OpLLZX: case OpInd:
+        f(tar, i, TRUE);
+        if (!const_addr(arg1))
+            f(arg1, i, FALSE);
+        break;
+    case OpAddrOf:
+        f(tar, i, TRUE);
+        break;
+    case OpArg: case OpRet: case OpSwitch: case OpCBr:
+        if (!const_addr(arg1))
+            f(arg1, i, FALSE);
+        break;
+    case OpIndAsn:
+        if (!const_addr(arg1))
+            f(arg1, i, FALSE);
+        if (!const_addr(arg2))
+            f(arg2, i, FALSE);
+        break;
+    case OpCall: case OpIndCall:
+        if (tar)
+            f(tar, i, TRUE);
+        if (instruction(i).op==OpIndCall && !const_addr(arg1))
+            f(arg1, i, FALSE);
+        break;
+    }
+}
+
+static void extend_interval(RAInterval *p, int i)
+{
+    if (i < p->start)
+        p->start = i;
+    if (i > p->end)
+        p->end = i;
+}
+
+static int access_weight;
+
+static void add_access(unsigned a, int i, int is_def)
+{
+    int k;
+    RAInterval *p;
+
+    if ((k=interval_of_nid[address_nid(a)]) == -1) {
+        /*
+         * Temporaries that don't cross block boundaries are better
+         * served by the local allocator of the code generator.
+         */
+        if (address(a).kind==TempKind && !bset_member(cross_block_temps, lnid(address_nid(a)))
+        || bset_member(addressed_variables, lnid(address_nid(a))) || !candidate(a))
+            return;
+        if (ra_nintervals >= ra_max_intervals) {
+            ra_max_intervals = ra_max_intervals ? ra_max_intervals*2 : 64;
+            ra_intervals = realloc(ra_intervals, ra_max_intervals*sizeof(RAInterval));
+        }
+        k = ra_nintervals++;
+        interval_of_nid[address_nid(a)] = k;
+        p = &ra_intervals[k];
+        p->addr = a;
+        p->start = p->end = i;
+        p->weight = 0;
+        p->reg = -1;
+    }
+    p = &ra_intervals[k];
+    extend_interval(p, i);
+    p->weight += access_weight;
+}
+
+static BSet *live;
+
+static void update_live(unsigned a, int i, int is_def)
+{
+    if (interval_of_nid[address_nid(a)] == -1)
+        return;
+    if (is_def)
+        bset_delete(live, lnid(address_nid(a)));
+    else
+        bset_insert(live, lnid(address_nid(a)));
+}
+
+/* order by start point; ties are broken by index so that the result doesn't depend on qsort() */
+static int cmp_start(const void *p1, const void *p2)
+{
+    int k1, k2, s1, s2;
+
+    k1 = *(int *)p1, k2 = *(int *)p2;
+    s1 = ra_intervals[k1].start;
+    s2 = ra_intervals[k2].start;
+    if (s1 != s2)
+        return (s1 > s2) - (s1 < s2);
+    return (k1 > k2) - (k1 < k2);
+}
+
+/*
+ * Allocate registers 0..nregs-1 among the candidates of function fn.
+ * Return a mask with the registers that were used.
+ */
+unsigned ra_allocate(unsigned fn, int nregs, int (*is_candidate)(unsigned a))
+{
+    int b, i, k, r;
+    unsigned entry_bb, exit_bb, used;
+    int *depth, *order, active[RA_MAX_REGS];
+
+    assert(nregs <= RA_MAX_REGS);
+
+    /* forget about the previous function */
+    for (k = 0; k < ra_nintervals; k++) {
+        ra_reg_of_nid[address_nid(ra_intervals[k].addr)] = -1;
+        interval_of_nid[address_nid(ra_intervals[k].addr)] = -1;
+    }
+    ra_nintervals = 0;
+
+    if (cg_node_is_empty(fn))
+        return 0;
+    entry_bb = cg_node(fn).bb_i;
+    exit_bb = cg_node(fn).bb_f;
+    candidate = is_candidate;
+    dflow_enter_function(fn);
+
+    /*
+     * Approximate the loop nesting depth of each block by counting
+     * the back edges (in code order) that jump over it.
+     */
+    depth = calloc(exit_bb-entry_bb+1, sizeof(int));
+    for (b = entry_bb; b <= exit_bb; b++) {
+        unsigned succ;
+
+        for (succ = edge_iterate(&cfg_node(b).out); succ != -1; succ = edge_iterate(NULL))
+            if (succ <= b)
+                for (k = succ; k <= b; k++)
+                    ++depth[k-entry_bb];
+    }
+
+    /*
+     * Find the candidates and their accesses. Variables that are the operand
+     * of an OpAddrOf are never candidates; not all of them are in
+     * address_taken_variables (automatic variables with an initializer are
+     * initialized through a pointer).
+     */
+    cross_block_temps = bset_new(cg_node(fn).nlnid);
+    addressed_variables = bset_new(cg_node(fn).nlnid);
+    for (b = entry_bb; b <= exit_bb; b++) {
+        bset_union(cross_block_temps, cfg_node(b).LiveOut);
+        for (i = cfg_node(b).leader; i <= (int)cfg_node(b).last; i++)
+            if (instruction(i).op == OpAddrOf)
+                bset_insert(addressed_variables, lnid(address_nid(instruction(i).arg1)));
+    }
+    for (b = entry_bb; b <= exit_bb; b++) {
+        int d;
+
+        if ((d=depth[b-entry_bb]) > RA_MAX_DEPTH)
+            d = RA_MAX_DEPTH;
+        access_weight = 1 << 3*d;
+        for (i = cfg_node(b).leader; i <= (int)cfg_node(b).last; i++)
+            visit_operands(i, add_access);
+    }
+    bset_free(cross_block_temps);
+    bset_free(addressed_variables);
+    free(depth);
+
+    /* stretch the intervals over the blocks the candidates are live through */
+    live = bset_new(cg_node(fn).nlnid);
+    for (b = entry_bb; b <= exit_bb; b++) {
+        bset_cpy(live, cfg_node(b).LiveOut);
+        for (k = 0; k < ra_nintervals; k++)
+            if (bset_member(live, lnid(address_nid(ra_intervals[k].addr))))
+                extend_interval(&ra_intervals[k], cfg_node(b).last);
+        for (i = cfg_node(b).last; i >= (int)cfg_node(b).leader; i--)
+            visit_operands(i, update_live);
+        for (k = 0; k < ra_nintervals; k++)
+            if (bset_member(live, lnid(address_nid(ra_intervals[k].addr))))
+                extend_interval(&ra_intervals[k], cfg_node(b).leader);
+    }
+    bset_free(live);
+
+    /* linear scan */
+    order = malloc(ra_nintervals*sizeof(int));
+    for (k = 0; k < ra_nintervals; k++)
+        order[k] = k;
+    qsort(order, ra_nintervals, sizeof(int), cmp_start);
+    for (r = 0; r < nregs; r++)
+        active[r] = -1;
+    for (k = 0; k < ra_nintervals; k++) {
+        RAInterval *p;
+        int victim;
+
+        p = &ra_intervals[order[k]];
+
+        /* expire old intervals */
+        for (r = 0; r < nregs; r++)
+            if (active[r]!=-1 && ra_intervals[active[r]].end<p->start)
+                active[r] = -1;
+
+        if (p->weight < RA_MIN_WEIGHT)
+            continue;
+
+        victim = -1;
+        for (r = 0; r < nregs; r++) {
+            if (active[r] == -1)
+                break;
+            if (victim==-1 || ra_intervals[active[r]].weight<ra_intervals[active[victim]].weight)
+                victim = r;
+        }
+        if (r == nregs) { /* no free register */
+            if (ra_intervals[active[victim]].weight >= p->weight)
+                continue;
+            ra_intervals[active[victim]].reg = -1;
+            r = victim;
+        }
+        p->reg = r;
+        active[r] = order[k];
+    }
+    free(order);
+
+    used = 0;
+    for (k = 0; k < ra_nintervals; k++) {
+        if ((r=ra_intervals[k].reg) != -1) {
+            ra_reg_of_nid[address_nid(ra_intervals[k].addr)] = (signed char)r;
+            used |= 1U << r;
+        }
+    }
+    return used;
+}
@@ -0,0 +1,33 @@
+#ifndef REGALLOC_H_
+#define REGALLOC_H_
+
+/*
+ * Global register allocation.
+ *
+ * Candidates (decided by the target) are given a function-wide live interval
+ * in code order and assigned by linear scan to one of a small set of registers
+ * (usually the callee-saved ones). A candidate that gets a register keeps it
+ * for the whole function: the register becomes its home location instead of
+ * its memory slot. Registers are numbered 0..nregs-1 and mapped to real
+ * registers by the target.
+ */
+
+#define RA_MAX_REGS 16
+
+typedef struct RAInterval RAInterval;
+struct RAInterval {
+    unsigned addr;      /* one of the addresses of the candidate */
+    int start, end;     /* first and last quad covered */
+    int weight;         /* estimated number of accesses */
+    int reg;            /* assigned register, or -1 */
+};
+
+extern signed char *ra_reg_of_nid;
+extern RAInterval *ra_intervals;
+extern int ra_nintervals;
+#define ra_reg(a)   (ra_reg_of_nid[address_nid(a)])
+
+void ra_init(void);
+unsigned ra_allocate(unsigned fn, int nregs, int (*is_candidate)(unsigned a));
+
+#endif
@@ -6,6 +6,7 @@
 #include <errno.h>
 #include <assert.h>
 #include "util/util.h"
+#include "util/atom.h"
 #include "decl.h"
 #include "expr.h"
 #include "error.h"
@@ -21,7 +22,7 @@
 #define WARNING(tok, ...) emit_warning((tok)->info->src_file, (tok)->info->src_line, (tok)->info->src_column, __VA_ARGS__)
 
 #define HASH_SIZE     4093
-#define HASH_VAL(s)   (hash(s)%HASH_SIZE)
+#define HASH_VAL(s)   (atom_hash(s)%HASH_SIZE)
 #define HASH_VAL2(x)  (hash2(x)%HASH_SIZE)
 
 typedef struct UnresolvedGoto UnresolvedGoto;
@@ -33,11 +34,18 @@ static struct UnresolvedGoto {
     UnresolvedGoto *next;
 } *unresolved_gotos_list;
 
+/*
+ * Each switch nesting level keeps the list of labels installed in
+ * it so that its table can be emptied without clearing every bucket.
+ * The same goes for the label names of a function.
+ */
 static struct SwitchLabel {
     long long val;
     int is_default;
     SwitchLabel *next;
+    SwitchLabel *next_in_switch;
 } *switch_labels[MAX_SWITCH_NEST][HASH_SIZE];
+static SwitchLabel *switch_labels_list[MAX_SWITCH_NEST];
 static int switch_nesting_level = -1;
 static int switch_case_counter[MAX_SWITCH_NEST];
 static Token switch_contr_expr_types[MAX_SWITCH_NEST];
@@ -47,7 +55,9 @@ static int install_switch_label(long long val, int is_default);
 static struct LabelName {
     char *name;
     LabelName *next;
+    LabelName *next_in_func;
 } *label_names[HASH_SIZE];
+static LabelName *label_names_list;
 static LabelName *lookup_label_name(char *name);
 static int install_label_name(char *name);
 static Arena *label_names_arena;
@@ -103,6 +113,8 @@ int install_switch_label(long long val, int is_default)
         np->is_default = is_default;
         np->next = switch_labels[switch_nesting_level][h];
         switch_labels[switch_nesting_level][h] = np;
+        np->next_in_switch = switch_labels_list[switch_nesting_level];
+        switch_labels_list[switch_nesting_level] = np;
         return TRUE; /* success */
     } else {
         return FALSE; /* failure */
@@ -120,8 +132,12 @@ void increase_switch_nesting_level(ExecNode *e)
 
 int decrease_switch_nesting_level(void)
 {
+    SwitchLabel *np;
+
     assert(switch_nesting_level >= 0);
-    memset(&switch_labels[switch_nesting_level][0], 0, sizeof(SwitchLabel *)*HASH_SIZE);
+    for (np = switch_labels_list[switch_nesting_level]; np != NULL; np = np->next_in_switch)
+        switch_labels[switch_nesting_level][np->is_default?0:HASH_VAL2((unsigned long)np->val)] = NULL;
+    switch_labels_list[switch_nesting_level] = NULL;
     arena_reset(switch_arena[switch_nesting_level]);
 
     return switch_case_counter[switch_nesting_level--];
@@ -132,7 +148,7 @@ LabelName *lookup_label_name(char *name)
     LabelName *np;
 
     for (np = label_names[HASH_VAL(name)]; np != NULL; np = np->next)
-        if (equal(name, np->name))
+        if (name == np->name)
             return np;
     return NULL; /* not found */
 }
@@ -144,7 +160,7 @@ int install_label_name(char *name)
 
     h = HASH_VAL(name);
     for (np = label_names[h]; np != NULL; np = np->next)
-        if (equal(name, np->name))
+        if (name == np->name)
             break;
 
     if (np == NULL) {
@@ -152,6 +168,8 @@ int install_label_name(char *name)
         np->name = name;
         np->next = label_names[h];
         label_names[h] = np;
+        np->next_in_func = label_names_list;
+        label_names_list = np;
         return TRUE; /* success */
     } else {
         return FALSE; /* failure */
@@ -160,7 +178,11 @@ int install_label_name(char *name)
 
 void empty_label_table(void)
 {
-    memset(label_names, 0, sizeof(LabelName *)*HASH_SIZE);
+    LabelName *np;
+
+    for (np = label_names_list; np != NULL; np = np->next_in_func)
+        label_names[HASH_VAL(np->name)] = NULL;
+    label_names_list = NULL;
     arena_reset(label_names_arena);
 }
 
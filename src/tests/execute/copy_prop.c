@@ -0,0 +1,63 @@
+#include <stdio.h>
+
+int f(int a)
+{
+    int x, y, z;
+
+    x = 4;
+    y = x*2+a;
+    z = y;
+    if (x > 3)
+        return z+1;
+    return 0;
+}
+
+unsigned g(void)
+{
+    unsigned u;
+    unsigned char c;
+    short s;
+
+    u = -1;
+    c = 300;
+    s = 40000;
+    return u+c+s;
+}
+
+int h(int n)
+{
+    int i, j, k;
+
+    k = 0;
+    j = 1;
+    for (i = 0; i < n; i++) {
+        k += j;
+        j = 2;
+    }
+    return k;
+}
+
+int main(void)
+{
+    int x, y;
+    unsigned ux;
+
+    printf("%d\n", f(1));
+    printf("%u\n", g());
+    printf("%d %d\n", h(0), h(5));
+
+    x = 0x7fffffff;
+    y = x+1;
+    printf("%d\n", y < 0);
+
+    ux = 0x80000000;
+    x = ux>>31;
+    y = -8>>1;
+    printf("%d %d\n", x, y);
+
+    x = -1;
+    ux = x;
+    printf("%d\n", ux > 0);
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include <stdio.h>
+
+int a[16];
+
+int f(int i, int k)
+{
+    int r;
+
+    r = a[i]+k;
+    switch (k) {
+    case 0:
+        r += a[i]*2;
+        break;
+    case 1:
+        r -= a[i];
+        break;
+    case 2:
+        if (i > 3)
+            r += i*k;
+        break;
+    default:
+        r += a[i]+k;
+        break;
+    }
+    return r+a[i]+i*k;
+}
+
+long g(long x, long y)
+{
+    long s, t;
+
+    s = x+y;
+    if (x > 0)
+        t = y+x;
+    else
+        t = x-y;
+    return s*t+(x+y);
+}
+
+int main(void)
+{
+    int i;
+
+    for (i = 0; i < 16; i++)
+        a[i] = i*i-7;
+    for (i = 0; i < 16; i++)
+        printf("%d ", f(i, i%5));
+    printf("\n");
+    printf("%ld %ld\n", g(3, 4), g(-3, 4));
+    return 0;
+}
@@ -0,0 +1,2 @@
+/* not guarded */
+++count;
@@ -0,0 +1,6 @@
+#ifndef ELSE_H
+#define ELSE_H
+++else_first;
+#else
+++else_again;
+#endif
@@ -0,0 +1,7 @@
+/* guarded */
+
+#ifndef GUARDED_H
+#define GUARDED_H
+++guarded;
+#endif
+
@@ -0,0 +1,64 @@
+#include <stdio.h>
+
+/*
+ * Repeated inclusion of headers with and without include guards
+ * and `#pragma once'. The preprocessor skips the headers it knows
+ * would expand to nothing; the results must be the same as if they
+ * were read every time.
+ */
+
+int main(void)
+{
+    int count = 0, guarded = 0, once = 0, nested = 0;
+    int else_first = 0, else_again = 0, trailing = 0;
+    int sub_once = 0, sub_guarded = 0;
+
+#include "count.h"
+#include "count.h"
+#include "count.h"
+    printf("count=%d\n", count);
+
+#include "guarded.h"
+#include "guarded.h"
+#include "guarded.h"
+    printf("guarded=%d\n", guarded);
+#undef GUARDED_H
+#include "guarded.h"
+#include "guarded.h"
+    printf("guarded=%d\n", guarded);
+
+#include "once.h"
+#include "once.h"
+#undef ONCE_H
+#include "once.h"
+    printf("once=%d\n", once);
+
+#include "nested.h"
+#include "nested.h"
+    printf("nested=%d\n", nested);
+
+#include "else.h"
+#include "else.h"
+#include "else.h"
+    printf("else_first=%d else_again=%d\n", else_first, else_again);
+
+#include "trailing.h"
+#include "trailing.h"
+#include "trailing.h"
+    printf("trailing=%d\n", trailing);
+
+    /* the same files reached through different paths */
+#include "sub/once.h"
+#include "./sub/once.h"
+#include "sub//once.h"
+#include "sub/../sub/once.h"
+    printf("sub_once=%d\n", sub_once);
+#include "sub/guarded.h"
+#include "./sub/guarded.h"
+#include "sub/./guarded.h"
+#undef SUB_GUARDED_H
+#include "./sub/guarded.h"
+    printf("sub_guarded=%d\n", sub_guarded);
+
+    return 0;
+}
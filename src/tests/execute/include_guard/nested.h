@@ -0,0 +1,8 @@
+#ifndef NESTED_H
+#define NESTED_H
+#if 1
+++nested;
+#else
+--nested;
+#endif
+#endif
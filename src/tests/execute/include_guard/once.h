@@ -0,0 +1,4 @@
+#pragma once
+#pragma unknown pragma
+#define ONCE_H
+++once;
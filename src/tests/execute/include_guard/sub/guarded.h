@@ -0,0 +1,4 @@
+#ifndef SUB_GUARDED_H
+#define SUB_GUARDED_H
+++sub_guarded;
+#endif
@@ -0,0 +1,4 @@
+#ifndef TRAILING_H
+#define TRAILING_H
+#endif
+++trailing;
@@ -0,0 +1,125 @@
+#include <stdio.h>
+
+struct node { int key; struct node *next; };
+
+static int sq(int x) { return x*x; }
+static int max(int a, int b) { if (a > b) return a; return b; }
+static unsigned char low(int x) { return x; }
+static signed char slow(int x) { return x; }
+static short half(long x) { return (short)(x/2); }
+static void inc(int *p) { ++*p; }
+static int unused(int a, int b, int c) { return b; }
+static int key(struct node *n) { return n->key; }
+
+static int cmp(const void *p1, const void *p2)
+{
+    int a = *(const int *)p1, b = *(const int *)p2;
+    return a < b ? -1 : a > b;
+}
+
+static int sum_sq(int n)
+{
+    int i, s;
+
+    for (s = i = 0; i < n; i++)
+        s += sq(i);
+    return s;
+}
+
+/* the ENTRY label is the target of the loop */
+static int count(struct node *n)
+{
+    int c = 0;
+
+    do
+        ++c;
+    while ((n=n->next) != NULL);
+    return c;
+}
+
+static int classify(int c)
+{
+    switch (c) {
+    case ' ': case '\t':
+        return 1;
+    case '0': case '1': case '2':
+        return 2;
+    default:
+        return c>='a' && c<='z' ? 3 : 0;
+    }
+}
+
+/* address-taken locals and arrays */
+static int indirect(int x)
+{
+    int a[4], *p;
+
+    a[0] = x, a[1] = x+1, a[2] = x+2, a[3] = x+3;
+    p = &a[1];
+    inc(p);
+    return a[0]+a[1]+a[2]+a[3];
+}
+
+static int many(int a, int b, int c, int d, int e, int f, int g, int h)
+{
+    return a-b+c-d+e-f+g-h;
+}
+
+/* not inlined: recursive */
+static int fact(int n) { return n <= 1 ? 1 : n*fact(n-1); }
+
+/* not inlined: static local */
+static int counter(void) { static int n; return ++n; }
+
+static int calls;
+static int side(int x) { ++calls; return x; }
+
+/* big, but called only once */
+static int once(int n)
+{
+    int i, j, r;
+
+    r = 0;
+    for (i = 0; i < n; i++) {
+        for (j = 0; j < i; j++) {
+            if ((i+j)%3 == 0)
+                r += i*j;
+            else if ((i+j)%3 == 1)
+                r -= j;
+            else
+                r ^= i;
+        }
+    }
+    return r;
+}
+
+static void nothing(void) { }
+
+int main(void)
+{
+    int i, t, a[5] = { 5, 3, 9, 1, 7 };
+    struct node n3 = { 3, NULL }, n2 = { 2, &n3 }, n1 = { 1, &n2 };
+
+    t = 0;
+    for (i = -5; i < 10; i++)
+        t += max(sq(i), i*7)+low(i*40)+slow(i*40)+half(i*1000);
+    printf("%d\n", t);
+    printf("%d %d\n", sum_sq(10), sum_sq(0));
+    printf("%d %d\n", count(&n1), count(&n3));
+    printf("%d %d %d\n", key(&n1)+key(n1.next), key(n1.next->next), unused(side(1), side(2), side(3)));
+    printf("%d\n", calls);
+    for (t = 0, i = 0; "ab 1\tz9"[i] != '\0'; i++)
+        t = t*4+classify("ab 1\tz9"[i]);
+    printf("%d\n", t);
+    printf("%d %d\n", indirect(10), indirect(-3));
+    printf("%d\n", many(1, 2, 3, 4, 5, 6, 7, 8)+many(sq(2), max(1, 2), 3, 4, 5, 6, 7, sq(3)));
+    counter();
+    printf("%d %d\n", fact(6), counter());
+    printf("%d\n", once(40));
+    printf("%d %d\n", cmp(&a[0], &a[1]), cmp(&a[3], &a[4]));
+    i = 0;
+    inc(&i), inc(&i);
+    nothing();
+    printf("%d\n", max(max(i, 1), max(sq(i), sq(-3))));
+    return 0;
+}
@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+ * Exercise 64-bit multiplication, division, remainder, shifts and
+ * comparisons (done by library calls on the 32-bit targets) over operands
+ * of many magnitudes and signs, printing a checksum per operation. With an
+ * argument (number of rounds) it times each operation instead
+ * (scripts/bench_liblux.sh).
+ */
+
+#define NVAL    96
+
+static unsigned long long val[NVAL];
+static unsigned long long seed = 88172645463325252ULL;
+
+static unsigned long long next(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return seed;
+}
+
+static void init(void)
+{
+    int i;
+
+    for (i = 0; i < NVAL; i++) {
+        switch (i % 8) {
+        case 0: val[i] = next(); break;                         /* full width */
+        case 1: val[i] = next() >> 32; break;                   /* 32 bits */
+        case 2: val[i] = next() >> 56; break;                   /* small */
+        case 3: val[i] = -(long long)(next() >> 40); break;     /* small negative */
+        case 4: val[i] = 1ULL << (next() % 64); break;          /* power of two */
+        case 5: val[i] = next() >> (next() % 64); break;        /* any width */
+        case 6: val[i] = ~0ULL - (next() >> 60); break;         /* near the top */
+        case 7: val[i] = (next() >> 33) + 0x100000000ULL; break;/* just over 32 bits */
+        }
+    }
+    val[0] = 0;
+    val[1] = 1;
+    val[2] = -1;
+    val[3] = 0x8000000000000000ULL;
+    val[4] = 0x7FFFFFFFFFFFFFFFULL;
+    val[5] = 0xFFFFFFFFULL;
+}
+
+static unsigned long long h;
+
+static void mix(unsigned long long x)
+{
+    h = (h ^ x) * 1099511628211ULL;
+}
+
+enum {
+    OpMul, OpUDiv, OpUMod, OpSDiv, OpSMod,
+    OpShl, OpUShr, OpSShr, OpCmp, NOPS
+};
+
+static char *op_names[] = {
+    "mul", "udiv", "umod", "sdiv", "smod",
+    "shl", "ushr", "sshr", "cmp"
+};
+
+static void run(int op)
+{
+    int i, j;
+    unsigned long long a, b;
+
+    for (i = 0; i < NVAL; i++) {
+        for (j = 0; j < NVAL; j++) {
+            a = val[i], b = val[j];
+            switch (op) {
+            case OpMul:
+                mix(a*b);
+                break;
+            case OpUDiv:
+                if (b != 0)
+                    mix(a/b);
+                break;
+            case OpUMod:
+                if (b != 0)
+                    mix(a%b);
+                break;
+            case OpSDiv:
+                if (b!=0 && !((long long)a==(long long)0x8000000000000000ULL && (long long)b==-1))
+                    mix((long long)a/(long long)b);
+                break;
+            case OpSMod:
+                if (b!=0 && !((long long)a==(long long)0x8000000000000000ULL && (long long)b==-1))
+                    mix((long long)a%(long long)b);
+                break;
+            case OpShl:
+                mix(a << (int)(b&63));
+                break;
+            case OpUShr:
+                mix(a >> (int)(b&63));
+                break;
+            case OpSShr:
+                mix((long long)a >> (int)(b&63));
+                break;
+            case OpCmp:
+                mix((a<b)+2*((long long)a<(long long)b)+4*(a>=b)+8*((long long)a>=(long long)b)+16*(a==b));
+                break;
+            }
+        }
+    }
+}
+
+#ifndef __LuxVM__
+static void bench(int rounds)
+{
+    int op, k;
+    clock_t t;
+
+    for (op = 0; op < NOPS; op++) {
+        t = clock();
+        for (k = 0; k < rounds; k++)
+            run(op);
+        printf("%-5s %8ld ms\n", op_names[op], (long)((clock()-t)/(CLOCKS_PER_SEC/1000)));
+    }
+}
+#else
+/* the VM libc has no clock() */
+static void bench(int rounds)
+{
+    printf("no benchmark under the VM\n");
+}
+#endif
+
+int main(int argc, char *argv[])
+{
+    int op;
+
+    init();
+    if (argc > 1) {
+        bench(atoi(argv[1]));
+        return 0;
+    }
+    for (op = 0; op < NOPS; op++) {
+        h = 14695981039346656037ULL;
+        run(op);
+        printf("%-5s %016llx\n", op_names[op], h);
+    }
+    return 0;
+}
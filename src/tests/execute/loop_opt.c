@@ -0,0 +1,188 @@
+#include <stdio.h>
+
+struct rec { char tag; short s; int v; long l; };
+
+int a[64], b[64];
+unsigned char bytes[300];
+struct rec recs[40];
+long la[16];
+
+static long dot(int n)
+{
+    int i;
+    long s;
+
+    s = 0;
+    for (i = 0; i < n; i++)
+        s += a[i]*b[i]+n*3;
+    return s;
+}
+
+static int fields(int n)
+{
+    int i, s;
+
+    s = 0;
+    for (i = 0; i < n; i++)
+        s += recs[i].tag+recs[i].s-recs[i].v+(int)recs[i].l;
+    return s;
+}
+
+/* steps other than 1 and the iv used with different scales */
+static long strides(int n)
+{
+    int i;
+    long s;
+
+    s = 0;
+    for (i = n-1; i >= 0; i -= 3)
+        s += a[i]+bytes[i]+la[i/4];
+    for (i = 0; i < n; i += 2)
+        s = (s*3+b[i]+b[i+1])%100003;
+    return s;
+}
+
+static unsigned uindex(unsigned n)
+{
+    unsigned i, s;
+
+    s = 0;
+    for (i = 0; i < n; i++)
+        s += bytes[i*7]+a[i];
+    return s;
+}
+
+/* the iv is also changed in the body: not an induction variable */
+static int not_iv(void)
+{
+    int i, s;
+
+    s = 0;
+    for (i = 0; i < 60; i++) {
+        s += a[i];
+        if (a[i]%5 == 0)
+            i += 2;
+    }
+    return s;
+}
+
+/* the base changes in the loop */
+static int moving_base(void)
+{
+    int i, s, *p;
+
+    s = 0;
+    p = a;
+    for (i = 0; i < 10; i++) {
+        s += p[i];
+        p = (i&1) ? b : a;
+    }
+    return s;
+}
+
+static int nested(int n)
+{
+    int i, j, s;
+
+    s = 0;
+    for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+            s += a[j]*b[i]-j;
+    return s;
+}
+
+/* small constant trip counts */
+static int small(void)
+{
+    int i, s;
+    short h;
+    unsigned char c;
+
+    s = 0;
+    for (i = 0; i < 4; i++)
+        s = s*10+a[i];
+    for (i = 0; i < 1; i++)
+        s += 100;
+    for (i = 0; i < 0; i++)
+        s += 1000;
+    for (i = 8; i > 0; i--)
+        s = s*2+i;
+    for (i = 0; i <= 8; i++)
+        s ^= b[i];
+    for (h = 0; h != 6; h += 2)
+        s += h;
+    for (c = 250; c != 2; c++)
+        s += c;
+    return s;
+}
+
+/* exits from the middle of the loop */
+static int search(int x)
+{
+    int i;
+
+    for (i = 0; i < 64; i++)
+        if (a[i] == x)
+            break;
+    return i;
+}
+
+static int dowhile(int n)
+{
+    int i, s;
+
+    i = s = 0;
+    do {
+        s += a[i]*2;
+        i++;
+    } while (i < n);
+    return s;
+}
+
+/* the invariant division is guarded by the loop condition */
+static int guarded(int n, int d)
+{
+    int i, s;
+
+    s = 0;
+    for (i = 0; i < n; i++)
+        s += a[i]/d;
+    return s;
+}
+
+static void fill(int *p, int n, int v)
+{
+    int i;
+
+    for (i = 0; i < n; i++)
+        p[i] = v+i;
+}
+
+int main(void)
+{
+    int i;
+
+    for (i = 0; i < 64; i++)
+        a[i] = i*3-20, b[i] = 64-i;
+    for (i = 0; i < 300; i++)
+        bytes[i] = (unsigned char)(i*13);
+    for (i = 0; i < 40; i++)
+        recs[i].tag = (char)i, recs[i].s = (short)(i*100), recs[i].v = i*i, recs[i].l = -i;
+    for (i = 0; i < 16; i++)
+        la[i] = 1000L*i;
+
+    printf("%ld %ld %ld\n", dot(64), dot(1), dot(0));
+    printf("%d %d\n", fields(40), fields(3));
+    printf("%ld %ld\n", strides(64), strides(7));
+    printf("%u %u\n", uindex(40), uindex(0));
+    printf("%d %d\n", not_iv(), moving_base());
+    printf("%d %d\n", nested(20), nested(1));
+    printf("%d\n", small());
+    printf("%d %d %d\n", search(13), search(-20), search(5));
+    printf("%d %d\n", dowhile(10), dowhile(0));
+    printf("%d %d\n", guarded(30, 7), guarded(0, 0));
+    fill(b, 64, 5);
+    fill(a+10, 5, -1);
+    printf("%ld %d %d\n", dot(64), a[9], a[14]);
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Allocator churn: keep a pool of live blocks of mixed sizes, replacing,
+ * growing and shrinking them at random, and check that no block is
+ * clobbered. With an argument it doubles as a benchmark (scripts/bench_malloc.sh).
+ */
+
+#define NSLOTS  4096
+/* only the first 64 bytes, the first byte of every page and the last byte are checked */
+#define NEXT_POS(k) ((k)<64 ? (k)+1 : ((k)|4095)+1)
+
+static unsigned long seed = 1;
+
+static unsigned rnd(void)
+{
+    seed = seed*1103515245+12345;
+    return (unsigned)(seed/65536)%32768;
+}
+
+static char *slot[NSLOTS];
+static unsigned len[NSLOTS];
+
+static unsigned pick_size(void)
+{
+    unsigned r;
+
+    r = rnd()%100;
+    if (r < 70)
+        return 1+rnd()%128;         /* small */
+    else if (r < 95)
+        return 129+rnd()%4000;      /* medium */
+    else if (r < 99)
+        return 4096+rnd()*4;        /* large */
+    else
+        return 300000+rnd()*8;      /* huge */
+}
+
+static int check(int i)
+{
+    unsigned k;
+
+    for (k = 0; k < len[i]; k = NEXT_POS(k))
+        if (slot[i][k] != (char)(i+k))
+            return 0;
+    return len[i]==0 || slot[i][len[i]-1]==(char)(i+len[i]-1);
+}
+
+static void fill(int i, unsigned from)
+{
+    unsigned k;
+
+    for (k = 0; k < from; k = NEXT_POS(k))
+        ;
+    for (; k < len[i]; k = NEXT_POS(k))
+        slot[i][k] = (char)(i+k);
+    if (len[i] != 0)
+        slot[i][len[i]-1] = (char)(i+len[i]-1);
+}
+
+int main(int argc, char *argv[])
+{
+    int i, n, round, nrounds, bad;
+    unsigned long total;
+    int *z;
+
+    nrounds = (argc > 1) ? atoi(argv[1]) : 20000;
+    bad = 0;
+    total = 0;
+    for (round = 0; round < nrounds; round++) {
+        i = rnd()%NSLOTS;
+        if (slot[i] != NULL && !check(i))
+            ++bad;
+        switch (rnd()%4) {
+        case 0:
+        case 1:
+            free(slot[i]);
+            len[i] = pick_size();
+            slot[i] = malloc(len[i]);
+            fill(i, 0);
+            break;
+        case 2:
+            n = pick_size();
+            slot[i] = realloc(slot[i], n);
+            if (n > len[i]) {
+                n ^= len[i], len[i] ^= n, n ^= len[i];
+                fill(i, n);
+            } else {
+                len[i] = n;
+                fill(i, n);
+            }
+            break;
+        case 3:
+            free(slot[i]);
+            slot[i] = NULL;
+            len[i] = 0;
+            break;
+        }
+        total += len[i];
+    }
+    for (i = 0; i < NSLOTS; i++) {
+        if (slot[i] != NULL && !check(i))
+            ++bad;
+        free(slot[i]);
+    }
+
+    /* calloc() must return zeroed memory, even if it's recycled */
+    for (n = 1; n < 1000000; n *= 7) {
+        z = malloc(n*sizeof(int));
+        memset(z, -1, n*sizeof(int));
+        free(z);
+        z = calloc(n, sizeof(int));
+        for (i = 0; i < n; i++)
+            if (z[i] != 0)
+                ++bad;
+        free(z);
+    }
+
+    printf("bad=%d total=%lu\n", bad, total);
+    return 0;
+}
@@ -0,0 +1,36 @@
+#include <stdio.h>
+
+/*
+ * The arguments of a function-like macro are macro-replaced before
+ * they are substituted, so a macro can be used in its own arguments.
+ */
+
+struct node { struct node *child[2]; int op; };
+
+#define LCHILD(n)   ((n)->child[0])
+#define RCHILD(n)   ((n)->child[1])
+#define INC(x)      ((x)+1)
+#define INC2(x)     INC(INC(x))
+#define APPLY(f, x) f(x)
+#define ID(x)       x
+#define EMPTY
+#define PRINT(...)  printf(__VA_ARGS__)
+
+int self_ref;
+#define self_ref    self_ref+1
+
+int main(void)
+{
+    struct node a, b, c;
+
+    a.child[0] = &b, a.child[1] = &c;
+    b.child[0] = &c, b.child[1] = &a;
+    c.child[0] = &a, c.child[1] = &b;
+    a.op = 1, b.op = 2, c.op = 3;
+
+    printf("%d %d\n", LCHILD(LCHILD(&a))->op, RCHILD(LCHILD(RCHILD(&a)))->op);
+    printf("%d %d %d\n", INC(INC(1)), INC2(INC2(2)), APPLY(INC, INC(3)));
+    printf("%d %d\n", ID(INC)(4), ID(ID(ID(5))));
+    PRINT("%d %d\n", INC(INC2(6)), ID(self_ref));
+    ID(EMPTY) return 0;
+}
@@ -2,7 +2,8 @@
 CC="src/luxdvr/luxdvr -q $1"
 TESTDIR=`dirname $0`
 
-$CC $CFLAGS $TESTDIR/c4.c -o $TESTDIR/c4 &>/dev/null
+# c4 keeps pointers in ints; make them as wide as pointers on x64
+$CC $CFLAGS -Dint=long $TESTDIR/c4.c -o $TESTDIR/c4 &>/dev/null
 rm -f $TESTDIR/c4.output
 $TESTDIR/c4 $TESTDIR/hello.c >$TESTDIR/c4.output
 rm -f $TESTDIR/c4
@@ -0,0 +1,81 @@
+#include <stdio.h>
+
+/*
+ * Preprocessor and parser corner cases that involve more than
+ * one line or token of lookahead: macro calls spanning lines,
+ * adjacent strings separated by new-lines and directives,
+ * conditionals within skipped groups, and "(" starting either
+ * a cast or a parenthesized expression.
+ */
+
+#define ADD(a, b)   ((a)+(b))
+#define STR(s)      s
+#define FN          ADD
+#define LIST(...)   __VA_ARGS__
+
+typedef int T;
+
+static int vals[] = { LIST(1,
+                           2,
+                           3) };
+
+int main(void)
+{
+    int x, T2;
+    char *s;
+
+    x = ADD(1,
+            2);
+    printf("%d\n", x);
+    x = FN
+        (10, 20);
+    printf("%d\n", x);
+    x = ADD(STR(1)+2,
+            STR(3 +
+                4));
+    printf("%d\n", x);
+    printf("%d %d %d\n", vals[0], vals[1], vals[2]);
+
+    s = "abc"
+        "def"
+#define UNUSED 1
+        STR("ghi")
+#if 0
+        "not this"
+#endif
+        "jkl";
+    printf("%s\n", s);
+
+#if 0
+#if 1
+    printf("wrong 1\n");
+#elif 1
+    printf("wrong 2\n");
+#else
+    printf("wrong 3\n");
+#endif
+#elif 0
+    printf("wrong 4\n");
+#elif 1
+#if 0
+    printf("wrong 5\n");
+#elif 1
+    printf("right 1\n");
+#else
+    printf("wrong 6\n");
+#endif
+#elif 1
+    printf("wrong 7\n");
+#else
+    printf("wrong 8\n");
+#endif
+
+    T2 = 5;
+    x = (T)3 + (T2) + sizeof(T) + sizeof (T2) + sizeof T2;
+    printf("%d\n", x - 3*(int)sizeof(int));
+    x = (T2)-(T)1;
+    printf("%d\n", x);
+    printf("%d\n", __LINE__);
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <stdio.h>
+
+struct s3 { char c[3]; };
+struct s6 { short s[3]; };
+struct s12 { int a, b, c; };
+struct s13 { char c[13]; };
+struct s16 { long a, b; };
+struct big { long a, b, c; };
+
+int perm(int a, int b, int c, int d, int e, int f)
+{
+    return a+2*b+3*c+4*d+5*e+6*f;
+}
+
+int shuffle(int a, int b, int c, int d, int e, int f)
+{
+    /* the arguments are already in the registers they are passed in */
+    return perm(b, a, d, e, f, c)*7+perm(f, e, d, c, b, a);
+}
+
+int structs(struct s3 x, struct s6 y, struct s12 z, struct s13 w, int n)
+{
+    return x.c[0]+x.c[2]+y.s[0]+y.s[2]+z.a+z.c+w.c[0]+w.c[12]+n;
+}
+
+long mixed(struct s16 a, struct big b, int c, struct s16 d, long e, long f, int g)
+{
+    return a.a+a.b+b.a+b.c+c+d.a+d.b+e+f+g;
+}
+
+struct big ret_big(int a, int b, int c, int d, int e, int f)
+{
+    struct big r;
+
+    r.a = a+b;
+    r.b = c+d;
+    r.c = e+f;
+    return r;
+}
+
+struct s16 mk16(long x)
+{
+    struct s16 r;
+
+    r.a = x;
+    r.b = x*10;
+    return r;
+}
+
+struct big mkbig(long x)
+{
+    struct big r;
+
+    r.a = x;
+    r.b = x*10;
+    r.c = x*100;
+    return r;
+}
+
+void pair16(struct s16 x, struct s16 y)
+{
+    printf("%ld %ld %ld %ld\n", x.a, x.b, y.a, y.b);
+}
+
+void pairbig(struct big x, struct big y)
+{
+    printf("%ld %ld %ld %ld\n", x.a, x.c, y.a, y.c);
+}
+
+int narrow(unsigned char uc, signed char sc, unsigned short us, short ss)
+{
+    return uc+sc+us+ss;
+}
+
+int (*fp)(int, int, int, int, int, int) = perm;
+
+int main(void)
+{
+    int i;
+    unsigned char uc;
+    signed char sc;
+    unsigned short us;
+    short ss;
+    struct s3 x = { { 1, 2, 3 } };
+    struct s6 y = { { 4, 5, 6 } };
+    struct s12 z = { 7, 8, 9 };
+    struct s13 w = { "abcdefghijkl" };
+    struct s16 a = { 10, 11 }, d = { 12, 13 };
+    struct big b = { 14, 15, 16 }, r;
+
+    for (i = 0; i < 3; i++)
+        printf("%d\n", shuffle(i, i+1, i+2, i+3, i+4, i+5));
+    printf("%d\n", structs(x, y, z, w, 100));
+    printf("%ld\n", mixed(a, b, 17, d, 18, 19, 20));
+    r = ret_big(1, 2, 3, 4, 5, 6);
+    printf("%ld %ld %ld\n", r.a, r.b, r.c);
+    /* struct arguments returned by other calls */
+    pair16(mk16(1), mk16(2));
+    pairbig(mkbig(1), mkbig(2));
+    printf("%d\n", fp(6, 5, 4, 3, 2, 1)+fp(perm(1, 1, 1, 1, 1, 1), 2, 3, 4, 5, 6));
+
+    /* values kept in registers across calls */
+    uc = 255, sc = 127, us = 65535, ss = 32767;
+    uc++, sc++, us++, ss++;
+    printf("%d\n", narrow(uc, sc, us, ss));
+    printf("%d %d %d %d\n", uc, sc, us, ss);
+    printf("%d %d %d %d %d %d %d %d\n", 1, 2, 3, 4, 5, uc, sc, us);
+    return 0;
+}
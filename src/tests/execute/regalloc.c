@@ -0,0 +1,41 @@
+#include <stdio.h>
+
+struct big { int a[8]; };
+
+int sum_big(struct big b, int n)
+{
+    int i, s;
+
+    s = 0;
+    for (i = 0; i < n; i++)
+        s += b.a[i];
+    return s;
+}
+
+long f(char c, unsigned char uc, short sh, unsigned short ush, int n)
+{
+    int i, j, k, l, m, o;
+    long acc;
+    struct big b;
+
+    acc = 0;
+    for (i = 0; i < 8; i++)
+        b.a[i] = i*c;
+    for (i = 0; i < n; i++) {
+        j = i*2;
+        k = j+c;
+        l = k-uc;
+        m = l^sh;
+        o = m+ush;
+        acc += sum_big(b, i%8)+o;
+        c++, uc--, sh -= 3, ush += 5;
+    }
+    return acc+c+uc+sh+ush;
+}
+
+int main(void)
+{
+    printf("%ld\n", f(-3, 250, -30000, 65530, 20));
+    printf("%ld\n", f(120, 3, 32000, 10, 50));
+    return 0;
+}
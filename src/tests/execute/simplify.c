@@ -0,0 +1,31 @@
+#include <stdio.h>
+
+/* the operands of x*0 and x%1 are also used by other quads */
+int a[13];
+
+void f(void)
+{
+    a[9] = 1+8*1+8*8*0;
+}
+
+int g(int *p, int n)
+{
+    return p[n]*0+p[n]%1+p[n];
+}
+
+int main(void)
+{
+    int i, x, y;
+
+    f();
+    a[3] = 7;
+    x = a[3];
+    y = x*0;
+    printf("%d %d %d\n", a[9], x, y);
+    y = x%1;
+    printf("%d %d %d\n", x, y, g(a, 3));
+    for (i = 0; i < 13; i++)
+        x += a[i]*0+a[i]%1+a[i];
+    printf("%d\n", x);
+    return 0;
+}
@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * Check the mem*() and str*() routines against byte-at-a-time references
+ * for all combinations of alignments and small lengths. With an argument
+ * (milliseconds per measurement) it measures their throughput across buffer
+ * sizes instead (scripts/bench_string.sh).
+ */
+
+#define MAXLEN  80
+#define MAXOFF  16
+
+static unsigned char buf1[MAXLEN+2*MAXOFF], buf2[MAXLEN+2*MAXOFF], ref[MAXLEN+2*MAXOFF];
+
+static void reset(void)
+{
+    int i;
+
+    for (i = 0; i < sizeof(buf1); i++) {
+        /* no zeros and no repeated values */
+        buf1[i] = (unsigned char)(i*7%255+1);
+        buf2[i] = ref[i] = (unsigned char)(i*13%255+1);
+    }
+}
+
+static int sign(int x)
+{
+    return (x > 0) - (x < 0);
+}
+
+static int check(void)
+{
+    return memcmp(buf2, ref, sizeof(ref)) == 0;
+}
+
+static void test(void)
+{
+    int o1, o2, n, i, bad[6];
+    unsigned char *p;
+
+    memset(bad, 0, sizeof(bad));
+    for (o1 = 0; o1 < MAXOFF; o1++) {
+        for (o2 = 0; o2 < MAXOFF; o2++) {
+            for (n = 0; n <= MAXLEN; n++) {
+                /* memcpy */
+                reset();
+                memcpy(buf2+o1, buf1+o2, n);
+                for (i = 0; i < n; i++)
+                    ref[o1+i] = buf1[o2+i];
+                bad[0] += !check();
+
+                /* memmove, both directions within the same buffer */
+                reset();
+                memmove(buf2+o1, buf2+o2, n);
+                for (i = 0; i < n; i++)
+                    buf1[i] = ref[o2+i];
+                for (i = 0; i < n; i++)
+                    ref[o1+i] = buf1[i];
+                bad[1] += !check();
+
+                /* memset */
+                reset();
+                memset(buf2+o1, o2*17, n);
+                for (i = 0; i < n; i++)
+                    ref[o1+i] = (unsigned char)(o2*17);
+                bad[2] += !check();
+
+                /* strlen & strcmp */
+                reset();
+                memcpy(buf1+o1, buf2+o2, n);
+                buf2[o2+n] = buf1[o1+n] = '\0';
+                bad[3] += strlen((char *)buf1+o1) != n;
+                bad[4] += strcmp((char *)buf1+o1, (char *)buf2+o2) != 0;
+                if (n > 0) {
+                    buf1[o1+n-1] = 'a', buf2[o2+n-1] = 'b';
+                    bad[4] += sign(strcmp((char *)buf1+o1, (char *)buf2+o2)) != -1;
+                    buf2[o2+n] = 'x';
+                    bad[4] += sign(strcmp((char *)buf2+o2, (char *)buf1+o1)) != 1;
+                }
+
+                /* memchr */
+                reset();
+                p = memchr(buf1+o1, buf1[o1+o2], n);
+                bad[5] += p != ((o2 < n) ? buf1+o1+o2 : NULL);
+                bad[5] += memchr(buf1+o1, 0, n) != NULL;
+            }
+        }
+    }
+    printf("memcpy=%d memmove=%d memset=%d strlen=%d strcmp=%d memchr=%d\n",
+    bad[0], bad[1], bad[2], bad[3], bad[4], bad[5]);
+}
+
+#ifndef __LuxVM__
+/* run each routine over each size for at least msecs milliseconds */
+static void bench(long msecs)
+{
+    static long sizes[] = { 8, 64, 512, 4096, 65536, 1048576 };
+    int i, k;
+    long n, r, batch, bytes;
+    char *a, *b;
+    clock_t t, el, lim;
+
+    a = malloc(sizes[5]+8);
+    b = malloc(sizes[5]+8);
+    memset(a, 'a', sizes[5]+8);
+    lim = msecs*(CLOCKS_PER_SEC/1000);
+    printf("%8s %10s %10s %10s %10s  (MB/s)\n", "size", "memcpy", "memset", "strlen", "memchr");
+    for (i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++) {
+        n = sizes[i];
+        batch = (n < 65536) ? 65536/n : 1;
+        a[n] = '\0';
+        printf("%8ld", n);
+        for (k = 0; k < 4; k++) {
+            bytes = 0;
+            t = clock();
+            do {
+                for (r = 0; r < batch; r++) {
+                    switch (k) {
+                    case 0: memcpy(b, a, n); break;
+                    case 1: memset(b, r, n); break;
+                    case 2: b[r&7] = (char)strlen(a); break;
+                    case 3: b[r&7] = memchr(a, 'z', n) == NULL; break;
+                    }
+                }
+                bytes += batch*n;
+            } while ((el=clock()-t) < lim);
+            /* clock() ticks in microseconds, so bytes/tick is MB/s */
+            printf(" %10ld", bytes/el);
+        }
+        printf("\n");
+        a[n] = 'a';
+    }
+}
+#else
+/* the VM libc has no clock() */
+static void bench(long total)
+{
+    printf("no benchmark under the VM\n");
+}
+#endif
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1)
+        bench(atoi(argv[1]));
+    else
+        test();
+    return 0;
+}
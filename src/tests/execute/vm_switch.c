@@ -0,0 +1,94 @@
+#include <stdio.h>
+
+int dense(int x)
+{
+    switch (x) {
+    case -2: return 10;
+    case -1: return 11;
+    case 0: return 12;
+    case 1: return 13;
+    case 3: return 15;
+    case 6: return 18;
+    default: return -1;
+    }
+}
+
+int dense_nodef(unsigned char c)
+{
+    int r;
+
+    r = 0;
+    switch (c) {
+    case 'a': r += 1;
+    case 'b': r += 2; break;
+    case 'c': r += 3; break;
+    case 'e': r += 5; break;
+    }
+    return r;
+}
+
+int sparse(int x)
+{
+    switch (x) {
+    case -100000: return 1;
+    case -7: return 2;
+    case 42: return 3;
+    case 1000: return 4;
+    case 65536: return 5;
+    case 2147483647: return 6;
+    default: return 0;
+    }
+}
+
+int single(int x)
+{
+    switch (x) {
+    case 5: return 1;
+    }
+    return 0;
+}
+
+long long dense64(long long x)
+{
+    switch (x) {
+    case 0x100000000LL: return 1;
+    case 0x100000001LL: return 2;
+    case 0x100000002LL: return 3;
+    case 0x100000004LL: return 4;
+    default: return 0;
+    }
+}
+
+long long sparse64(long long x)
+{
+    switch (x) {
+    case -0x7000000000LL: return 1;
+    case -1: return 2;
+    case 0x100000000LL: return 3;
+    case 0x7fffffffffffffffLL: return 4;
+    default: return 0;
+    }
+}
+
+int main(void)
+{
+    int i;
+    static int sv[] = { -100001, -100000, -7, 0, 42, 999, 1000, 65536, 2147483647 };
+    static long long lv[] = { -0x7000000000LL, -1, 0, 0xffffffffLL, 0x100000000LL,
+        0x100000001LL, 0x100000002LL, 0x100000003LL, 0x100000004LL, 0x7fffffffffffffffLL };
+
+    for (i = -4; i <= 8; i++)
+        printf("%d ", dense(i));
+    printf("\n");
+    for (i = 'a'-1; i <= 'f'; i++)
+        printf("%d ", dense_nodef(i));
+    printf("\n");
+    for (i = 0; i < sizeof(sv)/sizeof(sv[0]); i++)
+        printf("%d ", sparse(sv[i]));
+    printf("\n");
+    printf("%d %d\n", single(5), single(4));
+    for (i = 0; i < sizeof(lv)/sizeof(lv[0]); i++)
+        printf("%lld %lld ", dense64(lv[i]), sparse64(lv[i]));
+    printf("\n");
+    return 0;
+}
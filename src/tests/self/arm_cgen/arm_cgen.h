@@ -0,0 +1,8 @@
+#ifndef ARM_CGEN_H_
+#define ARM_CGEN_H_
+
+#include <stdio.h>
+
+void arm_cgen(FILE *outf);
+
+#endif
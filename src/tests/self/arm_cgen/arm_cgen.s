@@ -0,0 +1,30724 @@
+.extern fgets
+# ==== start of definition of function `arm_load' ====
+.text
+arm_load:
+addsp 24;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+# var: offs, offset: 4
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp -20;
+ldw;
+ldiqw @S0;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L2;
+@L1:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L3;
+ldbp -24;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldbp -20;
+ldw;
+ldiqw @S1;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L4;
+@L3:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L5;
+# var: e, offset: 8
+# var: ld_str, offset: 16
+# var: max_offs, offset: 24
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L6;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldw;
+eqdw;
+jmpf @L7;
+jmp @L8;
+@L7:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldw;
+ldiqw @S2;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L8:
+ldiqw 0;
+ret;
+@L6:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T9;
+switch;
+@L11:
+@L12:
+@L13:
+@L14:
+ldbp -24;
+lddw;
+ldbp -20;
+ldw;
+ldiqw arm_load_addr;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L15:
+ldiqw @S3;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 255;
+ldbp 24;
+stdw;
+pop;
+jmp @L10;
+@L16:
+ldiqw @S4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 255;
+ldbp 24;
+stdw;
+pop;
+jmp @L10;
+@L17:
+@L18:
+ldiqw @S5;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 255;
+ldbp 24;
+stdw;
+pop;
+jmp @L10;
+@L19:
+ldiqw @S6;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 4095;
+ldbp 24;
+stdw;
+pop;
+jmp @L10;
+@L20:
+ldiqw @S7;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 4095;
+ldbp 24;
+stdw;
+pop;
+jmp @L10;
+@L10:
+.data
+.align 8
+@T9:
+.dword 10
+.dword 49
+.dword 64
+.dword 68
+.dword 71
+.dword 97
+.dword 98
+.dword 106
+.dword 107
+.dword 108
+.qword @L20
+.qword @L17
+.qword @L15
+.qword @L11
+.qword @L12
+.qword @L13
+.qword @L14
+.qword @L18
+.qword @L19
+.qword @L16
+.text
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L21;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L22;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldbp -20;
+ldw;
+ldiqw @S8;
+ldidw 1;
+ldiqw emit_code;
+call 32;
+pop;
+pop;
+ldbp -20;
+ldw;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S9;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+jmp @L23;
+@L22:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -20;
+ldw;
+ldiqw @S10;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldbp -20;
+ldw;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S11;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+@L23:
+jmp @L24;
+@L21:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+ldidw 0;
+sltdw;
+jmpf @L25;
+ldbp 4;
+lddw;
+ldbp 24;
+lddw;
+negdw;
+sgetdw;
+jmpf @L26;
+ldbp 4;
+lddw;
+negdw;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S12;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L26:
+jmp @L27;
+@L25:
+ldbp 4;
+lddw;
+ldbp 24;
+lddw;
+sletdw;
+jmpf @L28;
+ldbp 4;
+lddw;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S13;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L28:
+@L27:
+ldbp 4;
+lddw;
+ldidw 12;
+ldiqw @S14;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S15;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+@L24:
+jmp @L29;
+@L5:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L30;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L31;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldw;
+eqdw;
+jmpf @L32;
+ldiqw 0;
+ret;
+jmp @L33;
+@L32:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldw;
+ldiqw @S16;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L33:
+jmp @L34;
+@L31:
+ldbp -24;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldbp 4;
+stdw;
+ldidw 4095;
+negdw;
+sgetdw;
+jmpf @L35;
+ldbp 4;
+lddw;
+negdw;
+ldbp -20;
+ldw;
+ldiqw @S17;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L36;
+@L35:
+ldbp 4;
+lddw;
+ldidw 12;
+ldiqw @S18;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldbp -20;
+ldw;
+ldiqw @S19;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L36:
+@L34:
+@L30:
+@L29:
+@L4:
+@L2:
+ldidw 0;
+ret;
+# ==== start of definition of function `arm_save_arg_regs' ====
+.text
+arm_save_arg_regs:
+addsp 0;         
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+sdivdw;
+ldiqw @T37;
+jmptab;
+@L39:
+jmp @L38;
+@L40:
+ldiqw @S20;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L38;
+@L41:
+ldiqw @S21;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L38;
+@L42:
+ldiqw @S22;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L38;
+@L43:
+ldiqw @S23;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L38;
+@L38:
+.data
+.align 8
+@T37:
+.dword 0
+.dword 4
+.qword @L43
+.qword @L39
+.qword @L40
+.qword @L41
+.qword @L42
+.text
+ldidw 0;
+ret;
+# ==== start of definition of function `arm_begarg' ====
+.text
+arm_begarg:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldidw 0;
+ret;
+.extern get_promoted_type
+# ==== start of definition of function `arm_lt' ====
+.text
+arm_lt:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L44;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L45;
+ldidw 14;
+jmp @L46;
+@L45:
+ldidw 10;
+@L46:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw arm_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L47;
+@L44:
+# var: res, offset: 16
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L50;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L52;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L52;
+ldidw 0;
+jmp @L53;
+@L52:
+ldidw 1;
+@L53:
+jmpt @L50;
+ldidw 0;
+jmp @L51;
+@L50:
+ldidw 1;
+@L51:
+jmpt @L48;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L48;
+ldidw 0;
+jmp @L49;
+@L48:
+ldidw 1;
+@L49:
+jmpf @L54;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+jmp @L55;
+@L54:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+stw;
+pop;
+@L55:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand;
+call 8;
+ldbp 16;
+ldw;
+ldiqw @S24;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L56;
+ldbp 16;
+ldw;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L57;
+ldiqw @S25;
+jmp @L58;
+@L57:
+ldiqw @S26;
+@L58:
+ldiqw @S27;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 16;
+ldw;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L59;
+ldiqw @S28;
+jmp @L60;
+@L59:
+ldiqw @S29;
+@L60:
+ldiqw @S30;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L61:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L62:
+ldidw 0;
+jmpf @L63;
+jmp @L61;
+@L63:
+jmp @L64;
+@L56:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L64:
+@L47:
+ldidw 0;
+ret;
+.extern analyze_bitwise_operator
+# ==== start of definition of function `arm_cbr' ====
+.text
+arm_cbr:
+addsp 12;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: r, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L65;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L65;
+ldidw 0;
+jmp @L66;
+@L65:
+ldidw 1;
+@L66:
+jmpf @L67;
+# var: r2, offset: 10
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 10;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 10;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+ldbp 10;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 10;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 10;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S31;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldbp 10;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+stw;
+pop;
+jmp @L68;
+@L67:
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+@L68:
+ldbp 8;
+ldw;
+ldiqw @S32;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L69;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw @S33;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L70;
+@L69:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw @S34;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L70:
+ldidw 0;
+ret;
+.extern verbose_asm
+.extern bset_iterate
+# ==== start of definition of function `arm_allocate_static_objects' ====
+.text
+arm_allocate_static_objects:
+addsp 52;        
+# var: np, offset: 8
+ldiqw static_objects_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L71:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L73;
+# var: al, offset: 16
+# var: ty, offset: 24
+# var: initzr, offset: 40
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L74;
+@L75:
+ldiqw curr_segment;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L78;
+ldiqw str_segment;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw @S35;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S36;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw curr_segment;
+stdw;
+pop;
+@L78:
+@L76:
+ldidw 0;
+jmpf @L77;
+jmp @L75;
+@L77:
+ldiqw d_mapsym_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S37;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S38;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 1;
+ugtdw;
+jmpf @L79;
+ldbp 16;
+lddw;
+ldiqw @S39;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S40;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L79:
+jmp @L80;
+@L74:
+@L81:
+ldiqw curr_segment;
+lddw;
+ldidw 2;
+neqdw;
+jmpf @L84;
+ldiqw str_segment;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw @S41;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S42;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 2;
+ldiqw curr_segment;
+stdw;
+pop;
+@L84:
+@L82:
+ldidw 0;
+jmpf @L83;
+jmp @L81;
+@L83:
+ldiqw d_mapsym_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S43;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S44;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 1;
+ugtdw;
+jmpf @L85;
+ldbp 16;
+lddw;
+ldiqw @S45;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S46;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L85:
+@L80:
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw enclosing_function;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L86;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw @S47;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S48;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L87;
+@L86:
+# var: scs, offset: 48
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 48;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L88;
+ldbp 48;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L88;
+ldidw 0;
+jmp @L89;
+@L88:
+ldidw 1;
+@L89:
+jmpf @L90;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S49;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S50;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L90:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S51;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S52;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L87:
+ldbp 40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L91;
+ldbp 40;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw arm_static_init;
+call 24;
+pop;
+pop;
+jmp @L92;
+@L91:
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S53;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S54;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L92:
+@L72:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L71;
+@L73:
+ldidw 0;
+ret;
+# ==== start of definition of function `arm_or' ====
+.text
+arm_or:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L93;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L93;
+ldidw 0;
+jmp @L94;
+@L93:
+ldidw 1;
+@L94:
+jmpf @L95;
+# var: op, offset: 8
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 16;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S55;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S56;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L96:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L97:
+ldidw 0;
+jmpf @L98;
+jmp @L96;
+@L98:
+jmp @L99;
+@L95:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S57;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L100:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L101:
+ldidw 0;
+jmpf @L102;
+jmp @L100;
+@L102:
+@L99:
+ldidw 0;
+ret;
+.extern edge_iterate
+.bss
+.align 4
+max_arg_offs:
+.res 4
+# ==== start of definition of function `arm_xor' ====
+.text
+arm_xor:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L103;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L103;
+ldidw 0;
+jmp @L104;
+@L103:
+ldidw 1;
+@L104:
+jmpf @L105;
+# var: op, offset: 8
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 16;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S58;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S59;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L106:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L107:
+ldidw 0;
+jmpf @L108;
+jmp @L106;
+@L108:
+jmp @L109;
+@L105:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S60;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L110:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L111:
+ldidw 0;
+jmpf @L112;
+jmp @L110;
+@L112:
+@L109:
+ldidw 0;
+ret;
+.extern static_objects_list
+# ==== start of definition of function `arm_restore_arg_regs' ====
+.text
+arm_restore_arg_regs:
+addsp 0;         
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+sdivdw;
+ldiqw @T113;
+jmptab;
+@L115:
+jmp @L114;
+@L116:
+ldiqw @S61;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L114;
+@L117:
+ldiqw @S62;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L114;
+@L118:
+ldiqw @S63;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L114;
+@L119:
+ldiqw @S64;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L114;
+@L114:
+.data
+.align 8
+@T113:
+.dword 0
+.dword 4
+.qword @L119
+.qword @L115
+.qword @L116
+.qword @L117
+.qword @L118
+.text
+ldidw 0;
+ret;
+.extern is_complete
+.extern ic_addresses
+.extern cfg_outpath
+# ==== start of definition of function `arm_sh' ====
+.text
+arm_sh:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldw;
+ldbp 4;
+ldw;
+ldiqw @S65;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L120:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L121:
+ldidw 0;
+jmpf @L122;
+jmp @L120;
+@L122:
+ldidw 0;
+ret;
+.bss
+.align 4
+size_of_local_area:
+.res 4
+.extern analyze_unary_expression
+.extern string_write
+.extern target_arch
+.extern emit_warning
+# ==== start of definition of function `arm_store' ====
+.text
+arm_store:
+addsp 24;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+# var: offs, offset: 4
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L123;
+# var: e, offset: 8
+# var: st_str, offset: 16
+# var: max_offs, offset: 24
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T124;
+switch;
+@L126:
+@L127:
+ldiqw @S66;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldidw 12;
+dw2w;
+ldiqw arm_load_addr;
+call 8;
+pop;
+pop;
+ldidw 12;
+ldiqw @S67;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp -20;
+ldw;
+ldiqw @S68;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldidw 12;
+ldiqw @S69;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldiqw @S70;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldiqw @S71;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L128:
+@L129:
+ldiqw @S72;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 255;
+ldbp 24;
+stdw;
+pop;
+jmp @L125;
+@L130:
+@L131:
+@L132:
+ldiqw @S73;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 4095;
+ldbp 24;
+stdw;
+pop;
+jmp @L125;
+@L133:
+ldiqw @S74;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 4095;
+ldbp 24;
+stdw;
+pop;
+jmp @L125;
+@L125:
+.data
+.align 8
+@T124:
+.dword 8
+.dword 49
+.dword 64
+.dword 68
+.dword 71
+.dword 106
+.dword 107
+.dword 108
+.qword @L133
+.qword @L130
+.qword @L128
+.qword @L126
+.qword @L127
+.qword @L131
+.qword @L132
+.qword @L129
+.text
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L134;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L135;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldidw 12;
+ldiqw @S75;
+ldidw 1;
+ldiqw emit_code;
+call 32;
+pop;
+pop;
+ldidw 12;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S76;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+jmp @L136;
+@L135:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 12;
+ldiqw @S77;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldidw 12;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S78;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+@L136:
+jmp @L137;
+@L134:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+ldidw 0;
+sltdw;
+jmpf @L138;
+ldbp 4;
+lddw;
+ldbp 24;
+lddw;
+negdw;
+sgetdw;
+jmpf @L139;
+ldbp 4;
+lddw;
+negdw;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S79;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L139:
+jmp @L140;
+@L138:
+ldbp 4;
+lddw;
+ldbp 24;
+lddw;
+sletdw;
+jmpf @L141;
+ldbp 4;
+lddw;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S80;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L141:
+@L140:
+ldbp 4;
+lddw;
+ldidw 12;
+ldiqw @S81;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S82;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+@L137:
+jmp @L142;
+@L123:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L143;
+ldbp -24;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldbp 4;
+stdw;
+ldidw 4095;
+negdw;
+sgetdw;
+jmpf @L144;
+ldbp 4;
+lddw;
+negdw;
+ldbp -20;
+ldw;
+ldiqw @S83;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L145;
+@L144:
+ldbp 4;
+lddw;
+ldidw 12;
+ldiqw @S84;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldbp -20;
+ldw;
+ldiqw @S85;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L145:
+@L143:
+@L142:
+ldidw 0;
+ret;
+.extern arena_destroy
+.extern liveness_and_next_use
+.extern is_struct_union_enum
+.extern get_sizeof
+.extern emit_error
+.bss
+.align 4
+d_mapsym_counter:
+.res 4
+.extern get_curr_scope_id
+.extern getenv
+.extern can_assign_to
+.extern atoi
+# ==== start of definition of function `arm_lab' ====
+.text
+arm_lab:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw @S86;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern bset_member
+.extern exit
+# ==== start of definition of function `arm_cmpl' ====
+.text
+arm_cmpl:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L146;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L146;
+ldidw 0;
+jmp @L147;
+@L146:
+ldidw 1;
+@L147:
+jmpf @L148;
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S87;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S88;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L149:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L150:
+ldidw 0;
+jmpf @L151;
+jmp @L149;
+@L151:
+jmp @L152;
+@L148:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S89;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L153:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L154:
+ldidw 0;
+jmpf @L155;
+jmp @L153;
+@L155:
+@L152:
+ldidw 0;
+ret;
+.extern stderr
+.extern opt_level
+.extern restore_scope
+.extern nid2lnid
+# ==== start of definition of function `arm_let' ====
+.text
+arm_let:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L156;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L157;
+ldidw 17;
+jmp @L158;
+@L157:
+ldidw 13;
+@L158:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw arm_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L159;
+@L156:
+# var: res, offset: 16
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L162;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L164;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L164;
+ldidw 0;
+jmp @L165;
+@L164:
+ldidw 1;
+@L165:
+jmpt @L162;
+ldidw 0;
+jmp @L163;
+@L162:
+ldidw 1;
+@L163:
+jmpt @L160;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L160;
+ldidw 0;
+jmp @L161;
+@L160:
+ldidw 1;
+@L161:
+jmpf @L166;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+jmp @L167;
+@L166:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+stw;
+pop;
+@L167:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand;
+call 8;
+ldbp 16;
+ldw;
+ldiqw @S90;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L168;
+ldbp 16;
+ldw;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L169;
+ldiqw @S91;
+jmp @L170;
+@L169:
+ldiqw @S92;
+@L170:
+ldiqw @S93;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 16;
+ldw;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L171;
+ldiqw @S94;
+jmp @L172;
+@L171:
+ldiqw @S95;
+@L172:
+ldiqw @S96;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L173:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L174:
+ldidw 0;
+jmpf @L175;
+jmp @L173;
+@L175:
+jmp @L176;
+@L168:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L176:
+@L159:
+ldidw 0;
+ret;
+.extern string_get_pos
+.bss
+.align 8
+temp_list:
+.res 8
+.extern rewind
+.extern get_type_node
+.extern analyze_logical_operator
+.extern realloc
+.extern lookup_ordinary_id
+.extern snprintf
+.bss
+.align 4
+retvals_to_fix:
+.res 256
+.extern strpbrk
+.extern pop_struct_descriptor
+.extern nid2sid_tab
+# ==== start of definition of function `dump_reg_descr_tab' ====
+.text
+dump_reg_descr_tab:
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L177:
+ldbp 4;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L179;
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L180;
+ldiqw nid2sid_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 4;
+lddw;
+ldiqw @S97;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+@L180:
+@L178:
+incldw 4;
+jmp @L177;
+@L179:
+ldidw 0;
+ret;
+.extern fseek
+.bss
+.align 4
+retvals_to_fix_counter:
+.res 4
+.extern string_set_pos
+.extern push_struct_descriptor
+# ==== start of definition of function `arm_uch' ====
+.text
+arm_uch:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldw;
+ldbp 4;
+ldw;
+ldiqw @S98;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L181:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L182:
+ldidw 0;
+jmpf @L183;
+jmp @L181;
+@L183:
+ldidw 0;
+ret;
+.bss
+.align 8
+func_epilog:
+.res 8
+.extern sscanf
+.extern fputc
+# ==== start of definition of function `emit_raw_string' ====
+.text
+emit_raw_string:
+addsp 8;         
+# param:`q', offset:-24
+# param:`s', offset:-32
+# var: len, offset: 4
+# var: i, offset: 8
+ldbp -32;
+ldqw;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+udivdw;
+ldbp 8;
+stdw;
+pop;
+@L184:
+ldbp 8;
+lddw;
+jmpf @L186;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxb 1;
+ldbp -32;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxb 1;
+ldbp -32;
+ldqw;
+ldidw 2;
+dw2qw;
+ldxb 1;
+ldbp -32;
+ldqw;
+ldidw 3;
+dw2qw;
+ldxb 1;
+ldiqw @S99;
+ldbp -24;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldidw 4;
+dw2qw;
+addqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L185:
+decldw 8;
+jmp @L184;
+@L186:
+ldbp 4;
+lddw;
+ldidw 4;
+umoddw;
+ldbp 8;
+stdw;
+pop;
+@L187:
+ldbp 8;
+lddw;
+jmpf @L189;
+ldbp -32;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldb;
+ldiqw @S100;
+ldbp -24;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+@L188:
+decldw 8;
+jmp @L187;
+@L189:
+ldidw 0;
+ret;
+.extern vsscanf
+.extern dflow_enter_function
+# ==== start of definition of function `emit_code' ====
+.text
+emit_code:
+addsp 12;        
+# param:`nl', offset:-20
+# param:`fmt', offset:-28
+# var: ap, offset: 8
+ldbp -28;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp -28;
+ldqw;
+ldiqw func_body;
+ldqw;
+ldiqw string_vprintf;
+call 24;
+pop;
+pop;
+ldbp -20;
+lddw;
+jmpf @L190;
+ldiqw @S101;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L190:
+ldiqw offs_to_lit_tab;
+lddw;
+ldidw 4;
+adddw;
+ldiqw offs_to_lit_tab;
+stdw;
+pop;
+ldiqw offs_to_lit_tab;
+lddw;
+ldidw 2048;
+sgetdw;
+jmpf @L191;
+ldiqw dump_and_link;
+call 0;
+pop;
+pop;
+@L191:
+ldidw 0;
+ret;
+# ==== start of definition of function `get_reg0' ====
+.text
+get_reg0:
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L192:
+ldbp 4;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L194;
+ldiqw pinned;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+notdw;
+jmpf @L195;
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+jmpf @L195;
+ldidw 1;
+jmp @L196;
+@L195:
+ldidw 0;
+@L196:
+jmpf @L197;
+ldidw 1;
+ldiqw modified;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L198:
+ldbp 4;
+lddw;
+ldidw 3;
+sgtdw;
+notdw;
+jmpf @L201;
+ldidw 269;
+ldiqw @S102;
+ldiqw @S103;
+ldiqw @S104;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L201:
+@L199:
+ldidw 0;
+jmpf @L200;
+jmp @L198;
+@L200:
+ldbp 4;
+lddw;
+dw2w;
+dw2qw;
+ret;
+@L197:
+@L193:
+incldw 4;
+jmp @L192;
+@L194:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L202:
+ldbp 4;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L204;
+ldiqw pinned;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+notdw;
+jmpf @L205;
+@L206:
+ldiqw modified;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+notdw;
+jmpf @L209;
+ldidw 276;
+ldiqw @S105;
+ldiqw @S106;
+ldiqw @S107;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L209:
+@L207:
+ldidw 0;
+jmpf @L208;
+jmp @L206;
+@L208:
+@L210:
+ldbp 4;
+lddw;
+ldidw 3;
+sgtdw;
+notdw;
+jmpf @L213;
+ldidw 277;
+ldiqw @S108;
+ldiqw @S109;
+ldiqw @S110;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L213:
+@L211:
+ldidw 0;
+jmpf @L212;
+jmp @L210;
+@L212:
+ldbp 4;
+lddw;
+dw2w;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldbp 4;
+lddw;
+dw2w;
+dw2qw;
+ret;
+@L205:
+@L203:
+incldw 4;
+jmp @L202;
+@L204:
+@L214:
+ldidw 0;
+notdw;
+jmpf @L217;
+ldidw 283;
+ldiqw @S111;
+ldiqw @S112;
+ldiqw @S113;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L217:
+@L215:
+ldidw 0;
+jmpf @L216;
+jmp @L214;
+@L216:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `get_reg2' ====
+.text
+get_reg2:
+addsp 12;        
+# param:`i', offset:-20
+# var: r, offset: 4
+# var: arg1, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L220;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L220;
+ldidw 0;
+jmp @L221;
+@L220:
+ldidw 1;
+@L221:
+notdw;
+jmpf @L218;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+notdw;
+jmpf @L218;
+ldidw 1;
+jmp @L219;
+@L218:
+ldidw 0;
+@L219:
+jmpf @L222;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L223;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+jmp @L224;
+@L223:
+ldiqw get_reg0;
+call 0;
+pop;
+@L224:
+dw2w;
+ldbp 4;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L225;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+jmp @L226;
+@L225:
+ldiqw get_reg0;
+call 0;
+pop;
+@L226:
+dw2w;
+ldbp 4;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L227;
+@L222:
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 4;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 4;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L227:
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+sgtdw;
+jmpf @L228;
+# var: tmp, offset: 12
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 12;
+stw;
+pop;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 4;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldbp 12;
+ldw;
+ldbp 4;
+ldiqw 2;
+addqw;
+stw;
+pop;
+@L228:
+ldbp 4;
+ldiqw __temp_struct;
+swap2;
+memcpy 4;
+ret;
+ldidw 0;
+ret;
+.extern fwrite
+# ==== start of definition of function `arm_call' ====
+.text
+arm_call:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S114;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldiqw arm_post_call;
+call 4;
+pop;
+pop;
+ldbp -24;
+lddw;
+jmpf @L229;
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L230;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L230;
+ldidw 0;
+jmp @L231;
+@L230:
+ldidw 1;
+@L231:
+jmpf @L232;
+# var: r, offset: 8
+ldidw 4;
+dw2w;
+ldbp 8;
+stw;
+pop;
+ldidw 5;
+dw2w;
+ldbp 10;
+stw;
+pop;
+ldiqw @S115;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S116;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+jmp @L233;
+@L232:
+ldiqw @S117;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldidw 4;
+dw2w;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L233:
+@L229:
+ldidw 0;
+ret;
+.extern is_pointer
+.extern colored_diagnostics
+.extern string_curr
+# ==== start of definition of function `arm_div' ====
+.text
+arm_div:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L234;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L234;
+ldidw 0;
+jmp @L235;
+@L234:
+ldidw 1;
+@L235:
+jmpf @L236;
+ldbp 4;
+lddw;
+ldiqw is_signed_int;
+call 4;
+pop;
+jmpf @L237;
+ldidw 1;
+jmp @L238;
+@L237:
+ldidw 2;
+@L238:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw arm_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L239;
+@L236:
+# var: res, offset: 8
+ldidw 4;
+dw2w;
+ldbp 8;
+stw;
+pop;
+ldiqw arm_save_arg_regs;
+call 0;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldidw 0;
+dw2w;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 1;
+dw2w;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L240;
+ldiqw @S118;
+jmp @L241;
+@L240:
+ldiqw @S119;
+@L241:
+ldiqw @S120;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldiqw @S121;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldiqw arm_restore_arg_regs;
+call 0;
+pop;
+pop;
+@L242:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L243:
+ldidw 0;
+jmpf @L244;
+jmp @L242;
+@L244:
+@L239:
+ldidw 0;
+ret;
+.extern read_stream
+# ==== start of definition of function `is_representable_in_imm12' ====
+.text
+is_representable_in_imm12:
+addsp 4;         
+# param:`n', offset:-20
+.data
+.align 4
+@is_representable_in_imm12_a:
+.align 4
+.dword 255
+.align 4
+.dword -1073741761
+.align 4
+.dword -268435441
+.align 4
+.dword -67108861
+.align 4
+.dword -16777216
+.align 4
+.dword 1069547520
+.align 4
+.dword 267386880
+.align 4
+.dword 66846720
+.align 4
+.dword 16711680
+.align 4
+.dword 4177920
+.align 4
+.dword 1044480
+.align 4
+.dword 261120
+.align 4
+.dword 65280
+.align 4
+.dword 16320
+.align 4
+.dword 4080
+.align 4
+.dword 1008
+.text
+# var: rot, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L245:
+ldbp 4;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L247;
+ldbp -20;
+lddw;
+ldiqw @is_representable_in_imm12_a;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+cmpldw;
+anddw;
+notdw;
+jmpf @L248;
+ldidw 1;
+dw2qw;
+ret;
+@L248:
+@L246:
+incldw 4;
+jmp @L245;
+@L247:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern strspn
+.bss
+.align 4
+calls_to_fix_counter:
+.res 4
+.extern reset_enum_val
+.extern strtoll
+.extern analyze_relational_equality_expression
+.extern get_var_nid
+# ==== start of definition of function `dump_addr_descr_tab' ====
+.text
+dump_addr_descr_tab:
+addsp 8;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L249:
+ldbp 4;
+lddw;
+ldiqw nid_counter;
+lddw;
+sltdw;
+jmpf @L251;
+# var: ad, offset: 8
+ldiqw addr_descr_tab;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L252;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L253;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw nid2sid_tab;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S122;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 32;
+pop;
+pop;
+jmp @L254;
+@L253:
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw nid2sid_tab;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S123;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+@L254:
+@L252:
+@L250:
+incldw 4;
+jmp @L249;
+@L251:
+ldidw 0;
+ret;
+.extern get_sto_class_spec
+.extern bset_cpy
+.extern string_free
+.extern fclose
+.extern preprocess
+# ==== start of definition of function `arm_case' ====
+.text
+arm_case:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldidw 0;
+ret;
+.extern analyze_decl_specs
+.extern strstr
+.extern calloc
+.extern pop_scope
+.extern memset
+.extern file_exists
+.extern include_libc
+.extern C_source
+.extern analyze_cast_expression
+.extern stringify_type_exp
+# ==== start of definition of function `arm_ush' ====
+.text
+arm_ush:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldw;
+ldbp 4;
+ldw;
+ldiqw @S124;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L255:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L256:
+ldidw 0;
+jmpf @L257;
+jmp @L255;
+@L257:
+ldidw 0;
+ret;
+.extern add_quote_dir
+.extern stat_number_of_ast_nodes
+.extern strtoul
+.extern fprintf
+.extern get_type_qual
+.extern read_file
+.extern address_taken_variables
+.extern is_signed_int
+.extern printf
+.extern get_c_token
+.extern lookup_tag
+.extern get_rank
+# ==== start of definition of function `update_arg_descriptors' ====
+.text
+update_arg_descriptors:
+addsp 0;         
+# param:`arg', offset:-20
+# param:`liveness', offset:-24
+# param:`next_use', offset:-28
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L260;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L260;
+ldidw 0;
+jmp @L261;
+@L260:
+ldidw 1;
+@L261:
+jmpt @L258;
+ldbp -28;
+lddw;
+jmpt @L258;
+ldidw 0;
+jmp @L259;
+@L258:
+ldidw 1;
+@L259:
+jmpf @L262;
+ldiqw 0;
+ret;
+@L262:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L263;
+ldbp -24;
+ldub;
+jmpf @L264;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L265;
+ldbp -20;
+lddw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldn 4;
+ldiqw arm_store2;
+call 8;
+pop;
+pop;
+jmp @L266;
+@L265:
+ldbp -20;
+lddw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw arm_store;
+call 8;
+pop;
+pop;
+@L266:
+jmp @L267;
+@L264:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L268;
+ldbp -20;
+lddw;
+ldiqw free_temp;
+call 4;
+pop;
+pop;
+@L268:
+@L267:
+ldidw 0;
+ldiqw reg_descr_tab;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L269;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L269:
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+stw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+jmp @L270;
+@L263:
+ldbp -24;
+ldub;
+jmpf @L271;
+jmp @L272;
+@L271:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L273;
+ldbp -20;
+lddw;
+ldiqw free_temp;
+call 4;
+pop;
+pop;
+@L273:
+@L272:
+@L270:
+ldidw 0;
+ret;
+# ==== start of definition of function `arm_post_call' ====
+.text
+arm_post_call:
+addsp 4;         
+# param:`i', offset:-20
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L276;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L276;
+ldidw 0;
+jmp @L277;
+@L276:
+ldidw 1;
+@L277:
+jmpf @L274;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldidw 4;
+uletdw;
+jmpf @L274;
+ldidw 1;
+jmp @L275;
+@L274:
+ldidw 0;
+@L275:
+jmpf @L278;
+ldiqw func_body;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldiqw retvals_to_fix;
+ldiqw retvals_to_fix_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw @S125;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+@L278:
+ldiqw arg_offs;
+lddw;
+ldiqw max_arg_offs;
+lddw;
+sgtdw;
+jmpf @L279;
+ldiqw arg_offs;
+lddw;
+ldiqw max_arg_offs;
+stdw;
+pop;
+@L279:
+ldidw 0;
+ldiqw arg_offs;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern is_external_id
+# ==== start of definition of function `arm_do_switch64' ====
+.text
+arm_do_switch64:
+addsp 12;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+.bss
+.align 4
+@arm_do_switch64_nlab:
+.res 4
+.text
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L280;
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 4;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+jmp @L281;
+@L280:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldbp 4;
+swap2;
+memcpy 4;
+pop;
+pop;
+@L281:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+incldw -20;
+@L282:
+# var: p, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ordw;
+jmpf @L285;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw @S126;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L284;
+@L285:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldidw 12;
+ldiqw @S127;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 12;
+ldiqw @S128;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldiqw @arm_do_switch64_nlab;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S129;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldidw 12;
+ldiqw @S130;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 12;
+ldiqw @S131;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw @S132;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldiqw @arm_do_switch64_nlab;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S133;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldiqw @arm_do_switch64_nlab;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+@L283:
+incldw -20;
+jmp @L282;
+@L284:
+ldidw 0;
+ret;
+.extern sprintf
+# ==== start of definition of function `arm_llsx' ====
+.text
+arm_llsx:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 4;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S134;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L286:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L287:
+ldidw 0;
+jmpf @L288;
+jmp @L286;
+@L288:
+ldidw 0;
+ret;
+.extern strcat
+# ==== start of definition of function `arm_function_definition' ====
+.text
+arm_function_definition:
+addsp 68;        
+# param:`decl_specs', offset:-24
+# param:`header', offset:-32
+# var: cat, offset: 4
+# var: i, offset: 8
+# var: last_i, offset: 12
+# var: fn, offset: 16
+# var: pos_tmp, offset: 20
+# var: scs, offset: 24
+# var: ty, offset: 32
+# var: rsa_size, offset: 48
+# var: rsa_start, offset: 52
+.data
+.align 4
+@arm_function_definition_first_func:
+.align 4
+.dword 1
+.text
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw curr_func;
+stqw;
+pop;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw new_cg_node;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldidw 8;
+ldiqw cg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 40;
+addqw;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldiqw compute_liveness_and_next_use;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 32;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 32;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L289;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L289;
+ldidw 0;
+jmp @L290;
+@L289:
+ldidw 1;
+@L290:
+jmpf @L291;
+ldidw 1;
+ldiqw struct_union_return;
+stdw;
+pop;
+jmp @L292;
+@L291:
+ldbp 4;
+lddw;
+ldidw 110;
+eqdw;
+jmpt @L293;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L293;
+ldidw 0;
+jmp @L294;
+@L293:
+ldidw 1;
+@L294:
+jmpf @L295;
+ldidw 1;
+ldiqw qword_return;
+stdw;
+pop;
+@L295:
+@L292:
+ldiqw @arm_function_definition_first_func;
+lddw;
+notdw;
+jmpf @L296;
+ldiqw @S135;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L296:
+ldiqw curr_func;
+ldqw;
+ldiqw @S136;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S137;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L297:
+ldiqw curr_segment;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L300;
+ldiqw str_segment;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S138;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S139;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw curr_segment;
+stdw;
+pop;
+@L300:
+@L298:
+ldidw 0;
+jmpf @L299;
+jmp @L297;
+@L299:
+ldiqw a_mapsym_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S140;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S141;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 24;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L301;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L301;
+ldidw 0;
+jmp @L302;
+@L301:
+ldidw 1;
+@L302:
+jmpf @L303;
+ldiqw curr_func;
+ldqw;
+ldiqw @S142;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S143;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L303:
+ldiqw curr_func;
+ldqw;
+ldiqw @S144;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S145;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldiqw func_last_quad;
+stdw;
+pop;
+@L304:
+ldbp 8;
+lddw;
+ldbp 12;
+lddw;
+sletdw;
+jmpf @L306;
+# var: tar, offset: 56
+# var: arg1, offset: 60
+# var: arg2, offset: 64
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 56;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 60;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 64;
+stdw;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L307;
+ldiqw C_source;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L307;
+ldidw 1;
+jmp @L308;
+@L307:
+ldidw 0;
+@L308:
+jmpf @L309;
+ldiqw C_source;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S146;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L309:
+ldbp 64;
+lddw;
+ldbp 60;
+lddw;
+ldbp 56;
+lddw;
+ldbp 8;
+lddw;
+ldiqw instruction_handlers;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+dw2qw;
+ldxqw 8;
+call 16;
+pop;
+pop;
+@L305:
+incldw 8;
+jmp @L304;
+@L306:
+ldiqw size_of_local_area;
+lddw;
+ldidw 8;
+ldiqw temp_struct_size;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+subdw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldbp 20;
+stdw;
+pop;
+@L310:
+ldiqw retvals_to_fix_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldidw 0;
+sgetdw;
+jmpf @L311;
+# var: n, offset: 56
+# var: s, offset: 64
+ldiqw retvals_to_fix;
+ldiqw retvals_to_fix_counter;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw func_body;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_curr;
+call 8;
+ldbp 64;
+stqw;
+pop;
+pop;
+ldiqw size_of_local_area;
+lddw;
+negdw;
+ldiqw is_representable_in_imm12;
+call 4;
+pop;
+jmpf @L312;
+ldiqw size_of_local_area;
+lddw;
+negdw;
+ldiqw size_of_local_area;
+lddw;
+negdw;
+ldiqw @S147;
+ldbp 64;
+ldqw;
+ldiqw sprintf;
+call 24;
+pop;
+ldbp 56;
+stdw;
+pop;
+jmp @L313;
+@L312:
+@L314:
+ldidw 0;
+notdw;
+jmpf @L317;
+ldidw 2449;
+ldiqw @S148;
+ldiqw @S149;
+ldiqw @S150;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L317:
+@L315:
+ldidw 0;
+jmpf @L316;
+jmp @L314;
+@L316:
+@L313:
+ldidw 32;
+dw2b;
+ldbp 64;
+ldqw;
+ldbp 56;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+@L318:
+ldbp 64;
+ldqw;
+ldbp 56;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 88;
+eqdw;
+jmpf @L320;
+ldidw 32;
+dw2b;
+ldbp 64;
+ldqw;
+ldbp 56;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L319:
+incldw 56;
+jmp @L318;
+@L320:
+jmp @L310;
+@L311:
+@L321:
+ldiqw calls_to_fix_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldidw 0;
+sgetdw;
+jmpf @L322;
+# var: n, offset: 56
+# var: s, offset: 64
+ldiqw calls_to_fix;
+ldiqw calls_to_fix_counter;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw func_body;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_curr;
+call 8;
+ldbp 64;
+stqw;
+pop;
+pop;
+ldiqw size_of_local_area;
+lddw;
+negdw;
+ldiqw is_representable_in_imm12;
+call 4;
+pop;
+jmpf @L323;
+ldiqw size_of_local_area;
+lddw;
+negdw;
+ldiqw @S151;
+ldbp 64;
+ldqw;
+ldiqw sprintf;
+call 20;
+pop;
+ldbp 56;
+stdw;
+pop;
+jmp @L324;
+@L323:
+ldidw 12;
+ldiqw size_of_local_area;
+lddw;
+negdw;
+ldidw 12;
+ldiqw @S152;
+ldbp 64;
+ldqw;
+ldiqw sprintf;
+call 28;
+pop;
+ldbp 56;
+stdw;
+pop;
+@L324:
+ldidw 32;
+dw2b;
+ldbp 64;
+ldqw;
+ldbp 56;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+@L325:
+ldbp 64;
+ldqw;
+ldbp 56;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 88;
+eqdw;
+jmpf @L327;
+ldidw 32;
+dw2b;
+ldbp 64;
+ldqw;
+ldbp 56;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L326:
+incldw 56;
+jmp @L325;
+@L327:
+jmp @L321;
+@L322:
+ldbp 20;
+lddw;
+ldiqw func_body;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp 48;
+stdw;
+pop;
+ldidw 4;
+ldbp 8;
+stdw;
+pop;
+@L328:
+ldbp 8;
+lddw;
+ldidw 11;
+sltdw;
+jmpf @L330;
+ldiqw modified;
+ldbp 8;
+lddw;
+dw2qw;
+ldxdw 4;
+notdw;
+jmpf @L331;
+jmp @L330;
+@L331:
+ldbp 48;
+lddw;
+ldidw 4;
+adddw;
+ldbp 48;
+stdw;
+pop;
+@L329:
+incldw 8;
+jmp @L328;
+@L330:
+ldiqw size_of_local_area;
+lddw;
+ldidw 8;
+ldbp 48;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+subdw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldbp 52;
+stdw;
+pop;
+ldiqw max_arg_offs;
+lddw;
+ldidw 16;
+sgtdw;
+jmpf @L332;
+ldiqw size_of_local_area;
+lddw;
+ldidw 8;
+ldiqw max_arg_offs;
+lddw;
+ldidw 16;
+subdw;
+ldiqw round_up;
+call 8;
+pop;
+subdw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+@L332:
+ldiqw @S153;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S154;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S155;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S156;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S157;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S158;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw size_of_local_area;
+lddw;
+jmpf @L333;
+ldiqw size_of_local_area;
+lddw;
+negdw;
+ldiqw is_representable_in_imm12;
+call 4;
+pop;
+jmpf @L334;
+ldiqw size_of_local_area;
+lddw;
+negdw;
+ldiqw @S159;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S160;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L335;
+@L334:
+ldiqw size_of_local_area;
+lddw;
+negdw;
+ldidw 12;
+ldiqw @S161;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S162;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 12;
+ldiqw @S163;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S164;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L335:
+@L333:
+ldbp 52;
+lddw;
+ldiqw arm_save_restore_var_regs;
+call 4;
+pop;
+pop;
+ldiqw @S165;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S166;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S167;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S168;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S169;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S170;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S171;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S172;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S173;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S174;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw arm_output_file;
+ldqw;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+ldiqw arm_output_file;
+ldqw;
+ldiqw func_body;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+ldiqw arm_output_file;
+ldqw;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldiqw temp_struct_size;
+stdw;
+pop;
+ldidw 0;
+ldiqw calls_to_fix_counter;
+stdw;
+pop;
+ldidw 0;
+ldiqw retvals_to_fix_counter;
+stdw;
+pop;
+ldidw 0;
+ldiqw max_arg_offs;
+stdw;
+ldiqw arg_offs;
+stdw;
+pop;
+ldidw 0;
+ldiqw offs_to_lit_tab;
+stdw;
+pop;
+ldiqw 4;
+ldidw 16;
+dw2qw;
+mulqw;
+ldidw 0;
+ldiqw modified;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldiqw free_all_temps;
+call 0;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldiqw ic_free_function;
+call 4;
+pop;
+pop;
+ldidw 0;
+ldiqw qword_return;
+stdw;
+ldiqw struct_union_return;
+stdw;
+pop;
+ldidw 0;
+ldiqw @arm_function_definition_first_func;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern are_compatible
+.extern error_count
+# ==== start of definition of function `arm_static_init' ====
+.text
+arm_static_init:
+addsp 68;        
+# param:`ds', offset:-24
+# param:`dct', offset:-32
+# param:`e', offset:-40
+# var: ts, offset: 8
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L336;
+# var: nelem, offset: 16
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L337;
+jmp @@arm_static_init_scalar;
+@L337:
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L338;
+# var: n, offset: 20
+ldidw 0;
+dw2b;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 16;
+lddw;
+ldidw 1;
+subdw;
+udw2qw;
+addqw;
+stb;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw asm_decls;
+ldqw;
+ldiqw emit_raw_string;
+call 16;
+pop;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldbp 20;
+stdw;
+ldbp 16;
+lddw;
+ultdw;
+jmpf @L339;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+subdw;
+ldiqw @S175;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S176;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L339:
+jmp @L340;
+@L338:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L341:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L343;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw arm_static_init;
+call 24;
+pop;
+pop;
+@L342:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 16;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+jmp @L341;
+@L343:
+ldbp 16;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L344;
+# var: ty, offset: 24
+ldbp -24;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw @S177;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S178;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+muldw;
+ldiqw @S179;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S180;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L344:
+@L340:
+jmp @L345;
+@L336:
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 68;
+eqdw;
+jmpf @L346;
+# var: d, offset: 16
+# var: full_init, offset: 24
+# var: ty, offset: 32
+# var: align, offset: 48
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 32;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 32;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 48;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L347;
+ldbp 48;
+lddw;
+ldiqw @S181;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S182;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L347:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L348:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L350;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L351:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L354;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L354;
+ldidw 1;
+jmp @L355;
+@L354:
+ldidw 0;
+@L355:
+jmpf @L353;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw arm_static_init;
+call 24;
+pop;
+pop;
+@L352:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L351;
+@L353:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L356;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L357;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L357;
+ldidw 1;
+jmp @L358;
+@L357:
+ldidw 0;
+@L358:
+jmpf @L359;
+ldidw 1;
+ldbp 24;
+stdw;
+pop;
+@L359:
+jmp @L350;
+@L356:
+@L349:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L348;
+@L350:
+ldbp 24;
+lddw;
+notdw;
+jmpf @L360;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L361;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L361:
+@L362:
+ldidw 1;
+jmpf @L363;
+@L364:
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L365;
+# var: ty, offset: 56
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 56;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw @S183;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S184;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 56;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S185;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S186;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L364;
+@L365:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L366;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L367;
+@L366:
+jmp @L363;
+@L367:
+jmp @L362;
+@L363:
+@L360:
+jmp @L368;
+@L346:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+jmpf @L369;
+# var: ty, offset: 16
+# var: align, offset: 32
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 32;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L370;
+ldbp 32;
+lddw;
+ldiqw @S187;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S188;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L370:
+ldbp -40;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw arm_static_init;
+call 24;
+pop;
+pop;
+jmp @L371;
+@L369:
+# var: dest_ty, offset: 16
+@@arm_static_init_scalar:
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L372;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+eqdw;
+jmpf @L372;
+ldidw 1;
+jmp @L373;
+@L372:
+ldidw 0;
+@L373:
+jmpf @L374;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L374:
+ldbp -24;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T375;
+switch;
+@L377:
+@L378:
+@L379:
+ldiqw @S189;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L376;
+@L380:
+@L381:
+ldiqw @S190;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S191;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S192;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L376;
+@L382:
+@L383:
+# var: v, offset: 32
+ldiqw @S193;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S194;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S195;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -40;
+ldqw;
+ldiqw arm_static_expr;
+call 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldiqw @S196;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S197;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S198;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldiqw @S199;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S200;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L384:
+ldiqw @S201;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S202;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S203;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L376;
+@L376:
+.data
+.align 8
+@T375:
+.dword 8
+.dword 49
+.dword 64
+.dword 106
+.dword 107
+.dword 108
+.dword 110
+.dword 111
+.qword @L384
+.qword @L377
+.qword @L380
+.qword @L378
+.qword @L379
+.qword @L381
+.qword @L382
+.qword @L383
+.text
+ldbp -40;
+ldqw;
+ldiqw arm_static_expr;
+call 8;
+pop;
+ldiqw @S204;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S205;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L371:
+@L368:
+@L345:
+ldidw 0;
+ret;
+.extern free_pre_token
+.extern cg_nodes_counter
+.extern round_up
+.extern analyze_declarator
+# ==== start of definition of function `free_all_temps' ====
+.text
+free_all_temps:
+addsp 20;        
+# var: p, offset: 8
+# var: q, offset: 16
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L385:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L386;
+ldbp 8;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+jmp @L385;
+@L386:
+ldidw 0;
+dw2qw;
+ldiqw temp_list;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+func_prolog:
+.res 8
+.extern include_liblux
+.extern stat_number_of_pre_tokens
+# ==== start of definition of function `arm_llzx' ====
+.text
+arm_llzx:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 4;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S206;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+@L387:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L388:
+ldidw 0;
+jmpf @L389;
+jmp @L387;
+@L389:
+ldidw 0;
+ret;
+.data
+.align 8
+libfuncs:
+.align 8
+.qword @S207+0
+.align 8
+.qword @S208+0
+.align 8
+.qword @S209+0
+.align 8
+.qword @S210+0
+.align 8
+.qword @S211+0
+.align 8
+.qword @S212+0
+.align 8
+.qword @S213+0
+.align 8
+.qword @S214+0
+.align 8
+.qword @S215+0
+.align 8
+.qword @S216+0
+.align 8
+.qword @S217+0
+.align 8
+.qword @S218+0
+.align 8
+.qword @S219+0
+.align 8
+.qword @S220+0
+.align 8
+.qword @S221+0
+.align 8
+.qword @S222+0
+.align 8
+.qword @S223+0
+.align 8
+.qword @S224+0
+.extern bset_eq
+.extern strchr
+.extern add_angle_dir
+.extern analyze_conditional_expression
+# ==== start of definition of function `arm_mul' ====
+.text
+arm_mul:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L390;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L390;
+ldidw 0;
+jmp @L391;
+@L390:
+ldidw 1;
+@L391:
+jmpf @L392;
+ldidw 0;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw arm_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L393;
+@L392:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S225;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L394:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L395:
+ldidw 0;
+jmpf @L396;
+jmp @L394;
+@L396:
+@L393:
+ldidw 0;
+ret;
+.extern ic_outpath
+.extern arena_alloc
+.bss
+.align 4
+calls_to_fix:
+.res 256
+# ==== start of definition of function `arm_ind' ====
+.text
+arm_ind:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw spill_aliased_objects;
+call 0;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L397;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L397;
+ldidw 0;
+jmp @L398;
+@L397:
+ldidw 1;
+@L398:
+jmpf @L399;
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S226;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L400:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L401:
+ldidw 0;
+jmpf @L402;
+jmp @L400;
+@L402:
+jmp @L403;
+@L399:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @T404;
+switch;
+@L406:
+@L407:
+jmp @L405;
+@L408:
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S227;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L405;
+@L409:
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S228;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L405;
+@L410:
+@L411:
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S229;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L405;
+@L412:
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S230;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L405;
+@L413:
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S231;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L405;
+@L405:
+.data
+.align 8
+@T404:
+.dword 8
+.dword 49
+.dword 64
+.dword 68
+.dword 71
+.dword 106
+.dword 107
+.dword 108
+.qword @L413
+.qword @L410
+.qword @L408
+.qword @L406
+.qword @L407
+.qword @L411
+.qword @L412
+.qword @L409
+.text
+@L414:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L415:
+ldidw 0;
+jmpf @L416;
+jmp @L414;
+@L416:
+@L403:
+ldidw 0;
+ret;
+.extern stdout
+.extern get_type_category
+.extern ilog2
+.extern strcmp
+.bss
+.align 8
+func_body:
+.res 8
+.extern bset_fill
+.extern strtok
+.extern strtol
+.extern parse_header
+.extern stdin
+.extern dflow_Dom
+.extern is_integer
+.extern analyze_postfix_expression
+.extern ftell
+.extern strcpy
+# ==== start of definition of function `arm_add' ====
+.text
+arm_add:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L417;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L417;
+ldidw 0;
+jmp @L418;
+@L417:
+ldidw 1;
+@L418:
+jmpf @L419;
+# var: op, offset: 8
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 16;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S232;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S233;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L420:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L421:
+ldidw 0;
+jmpf @L422;
+jmp @L420;
+@L422:
+jmp @L423;
+@L419:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S234;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L424:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L425:
+ldidw 0;
+jmpf @L426;
+jmp @L424;
+@L426:
+@L423:
+ldidw 0;
+ret;
+# ==== start of definition of function `arm_rem' ====
+.text
+arm_rem:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L427;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L427;
+ldidw 0;
+jmp @L428;
+@L427:
+ldidw 1;
+@L428:
+jmpf @L429;
+ldbp 4;
+lddw;
+ldiqw is_signed_int;
+call 4;
+pop;
+jmpf @L430;
+ldidw 3;
+jmp @L431;
+@L430:
+ldidw 4;
+@L431:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw arm_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L432;
+@L429:
+# var: res, offset: 8
+ldidw 4;
+dw2w;
+ldbp 8;
+stw;
+pop;
+ldiqw arm_save_arg_regs;
+call 0;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldidw 0;
+dw2w;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 1;
+dw2w;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L433;
+ldiqw @S235;
+jmp @L434;
+@L433:
+ldiqw @S236;
+@L434:
+ldiqw @S237;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldiqw @S238;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldiqw arm_restore_arg_regs;
+call 0;
+pop;
+pop;
+@L435:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L436:
+ldidw 0;
+jmpf @L437;
+jmp @L435;
+@L437:
+@L432:
+ldidw 0;
+ret;
+# ==== start of definition of function `arm_ret' ====
+.text
+arm_ret:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldiqw qword_return;
+lddw;
+jmpf @L438;
+# var: r, offset: 4
+ldidw 0;
+dw2w;
+ldbp 4;
+stw;
+pop;
+ldidw 1;
+dw2w;
+ldbp 6;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+jmp @L439;
+@L438:
+ldiqw struct_union_return;
+lddw;
+jmpf @L440;
+# var: siz, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 4;
+ugtdw;
+jmpf @L441;
+ldiqw @S239;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S240;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldidw 12;
+ldiqw @S241;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldidw 12;
+dw2w;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldidw 12;
+ldiqw @S242;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 12;
+ldiqw @S243;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldiqw @S244;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldiqw @S245;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L442;
+@L441:
+ldbp -28;
+lddw;
+ldidw 0;
+dw2w;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @T443;
+switch;
+@L445:
+ldiqw @S246;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L444;
+@L446:
+ldiqw @S247;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L444;
+@L447:
+ldiqw @S248;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L444;
+@L444:
+.data
+.align 8
+@T443:
+.dword 3
+.dword 1
+.dword 2
+.qword @L447
+.qword @L445
+.qword @L446
+.text
+@L442:
+jmp @L448;
+@L440:
+ldbp -28;
+lddw;
+ldidw 0;
+dw2w;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+@L448:
+@L439:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `arm_get_operand' ====
+.text
+arm_get_operand:
+addsp 4;         
+# param:`a', offset:-20
+# param:`imm', offset:-24
+# var: r, offset: 4
+.bss
+@arm_get_operand_op:
+.res 256
+.text
+ldbp -24;
+lddw;
+jmpf @L449;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L449;
+ldidw 1;
+jmp @L450;
+@L449:
+ldidw 0;
+@L450:
+jmpf @L451;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw is_representable_in_imm12;
+call 4;
+pop;
+jmpf @L452;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S249;
+ldiqw @arm_get_operand_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw @arm_get_operand_op;
+ret;
+@L452:
+jmp @L453;
+@L451:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L454;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L454;
+ldidw 0;
+jmp @L455;
+@L454:
+ldidw 1;
+@L455:
+jmpf @L456;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L457;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S250;
+ldiqw @arm_get_operand_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw @arm_get_operand_op;
+ret;
+@L457:
+@L456:
+@L453:
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 4;
+stw;
+pop;
+ldbp -20;
+lddw;
+ldbp 4;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldw;
+ldiqw @S251;
+ldiqw @arm_get_operand_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw @arm_get_operand_op;
+ret;
+ldidw 0;
+ret;
+.extern install_tag
+.bss
+.align 4
+a_mapsym_counter:
+.res 4
+# ==== start of definition of function `spill_aliased_objects' ====
+.text
+spill_aliased_objects:
+addsp 8;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L458:
+ldbp 4;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L460;
+# var: a, offset: 8
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+jmpf @L461;
+jmp @L459;
+@L461:
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L462;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw address_taken_variables;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L462;
+ldidw 1;
+jmp @L463;
+@L462:
+ldidw 0;
+@L463:
+jmpf @L464;
+ldbp 4;
+lddw;
+dw2w;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+@L464:
+@L459:
+incldw 4;
+jmp @L458;
+@L460:
+ldidw 0;
+ret;
+.extern ic_function_to_print
+.extern strtoull
+# ==== start of definition of function `arm_switch' ====
+.text
+arm_switch:
+addsp 316;       
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: res, offset: 8
+# var: def_val, offset: 12
+# var: lab_arena, offset: 16
+# var: jmp_tab, offset: 24
+# var: def_lab, offset: 32
+# var: ncase, offset: 288
+# var: min, offset: 292
+# var: max, offset: 296
+# var: interval_size, offset: 300
+# var: holes, offset: 304
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L465;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L465;
+ldidw 0;
+jmp @L466;
+@L465:
+ldidw 1;
+@L466:
+jmpf @L467;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw arm_do_switch64;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L467:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L468;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+jmp @L469;
+@L468:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+stw;
+pop;
+@L469:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+subqw;
+pop;
+ldbp 288;
+stdw;
+pop;
+incldw -20;
+ldbp 288;
+lddw;
+ldidw 3;
+sgetdw;
+jmpf @L470;
+# var: case_start, offset: 308
+ldbp -20;
+lddw;
+ldbp 308;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 296;
+stdw;
+ldbp 292;
+stdw;
+pop;
+incldw -20;
+@L471:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ordw;
+jmpf @L474;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 12;
+stdw;
+pop;
+jmp @L473;
+@L474:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 292;
+lddw;
+dw2qw;
+sltqw;
+jmpf @L475;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 292;
+stdw;
+pop;
+jmp @L476;
+@L475:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 296;
+lddw;
+dw2qw;
+sgtqw;
+jmpf @L477;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 296;
+stdw;
+pop;
+@L477:
+@L476:
+@L472:
+incldw -20;
+jmp @L471;
+@L473:
+ldbp 308;
+lddw;
+ldbp -20;
+stdw;
+pop;
+ldbp 296;
+lddw;
+ldbp 292;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+ldbp 300;
+stdw;
+pop;
+ldbp 300;
+lddw;
+ldbp 288;
+lddw;
+subdw;
+ldbp 304;
+stdw;
+pop;
+ldbp 304;
+lddw;
+ldidw 10;
+sletdw;
+jmpf @L478;
+jmp @@arm_switch_jump_table;
+@L478:
+@L470:
+jmp @@arm_switch_linear_search;
+@@arm_switch_jump_table:
+ldbp 296;
+lddw;
+ldiqw is_representable_in_imm12;
+call 4;
+pop;
+jmpf @L479;
+ldbp 296;
+lddw;
+ldbp 8;
+ldw;
+ldiqw @S252;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L480;
+@L479:
+ldbp 296;
+lddw;
+ldidw 12;
+ldiqw @S253;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldbp 8;
+ldw;
+ldiqw @S254;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L480:
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S255;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldbp 292;
+lddw;
+ldiqw is_representable_in_imm12;
+call 4;
+pop;
+jmpf @L481;
+ldbp 292;
+lddw;
+ldbp 8;
+ldw;
+ldiqw @S256;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S257;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldbp 292;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L482;
+ldbp 292;
+lddw;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S258;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L482:
+jmp @L483;
+@L481:
+ldbp 292;
+lddw;
+ldidw 12;
+ldiqw @S259;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldbp 8;
+ldw;
+ldiqw @S260;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S261;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldbp 292;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L484;
+ldidw 12;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S262;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L484:
+@L483:
+ldiqw jump_tables_counter;
+lddw;
+ldidw 12;
+ldiqw @S263;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldidw 12;
+ldiqw @S264;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldiqw 8;
+ldbp 300;
+lddw;
+dw2qw;
+ldiqw calloc;
+call 16;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 300;
+lddw;
+ldidw 256;
+muldw;
+ldiqw arena_new;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S265;
+ldbp 32;
+ldiqw sprintf;
+call 28;
+pop;
+pop;
+@L485:
+# var: s, offset: 312
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ordw;
+jmpf @L488;
+jmp @L487;
+@L488:
+ldidw 256;
+ldbp 16;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 312;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw @S266;
+ldbp 312;
+ldqw;
+ldiqw sprintf;
+call 28;
+pop;
+pop;
+ldbp 312;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 292;
+lddw;
+dw2qw;
+subqw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L486:
+incldw -20;
+jmp @L485;
+@L487:
+ldidw 0;
+ldbp -20;
+stdw;
+pop;
+@L489:
+ldbp 304;
+lddw;
+jmpf @L491;
+ldbp 24;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L492;
+ldbp 32;
+ldbp 24;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+decldw 304;
+@L492:
+@L490:
+incldw -20;
+jmp @L489;
+@L491:
+ldiqw @S267;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldiqw offs_to_lit_tab;
+stdw;
+pop;
+@L493:
+ldiqw curr_segment;
+lddw;
+ldidw 3;
+neqdw;
+jmpf @L496;
+ldiqw str_segment;
+ldidw 3;
+dw2qw;
+ldxqw 8;
+ldiqw @S268;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 3;
+ldiqw curr_segment;
+stdw;
+pop;
+@L496:
+@L494:
+ldidw 0;
+jmpf @L495;
+jmp @L493;
+@L495:
+ldiqw d_mapsym_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S269;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldiqw jump_tables_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S270;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp -20;
+stdw;
+pop;
+@L497:
+ldbp -20;
+lddw;
+ldbp 300;
+lddw;
+sltdw;
+jmpf @L499;
+ldbp 24;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S271;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L498:
+incldw -20;
+jmp @L497;
+@L499:
+@L500:
+ldiqw curr_segment;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L503;
+ldiqw str_segment;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S272;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 1;
+ldiqw curr_segment;
+stdw;
+pop;
+@L503:
+@L501:
+ldidw 0;
+jmpf @L502;
+jmp @L500;
+@L502:
+ldiqw a_mapsym_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S273;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw arena_destroy;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@@arm_switch_linear_search:
+@L504:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ordw;
+jmpf @L507;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw @S274;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L506;
+@L507:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw is_representable_in_imm12;
+call 4;
+pop;
+jmpf @L508;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 8;
+ldw;
+ldiqw @S275;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L509;
+@L508:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldidw 12;
+ldiqw @S276;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldbp 8;
+ldw;
+ldiqw @S277;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L509:
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw @S278;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L505:
+incldw -20;
+jmp @L504;
+@L506:
+ldidw 0;
+ret;
+# ==== start of definition of function `arm_get_operand2' ====
+.text
+arm_get_operand2:
+addsp 4;         
+# param:`a', offset:-20
+# var: r, offset: 4
+.bss
+@arm_get_operand2_op1:
+.res 256
+.bss
+@arm_get_operand2_op2:
+.res 256
+.text
+.data
+.align 8
+@arm_get_operand2_op:
+.align 8
+.qword @arm_get_operand2_op1+0
+.align 8
+.qword @arm_get_operand2_op2+0
+.text
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L512;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L512;
+ldidw 0;
+jmp @L513;
+@L512:
+ldidw 1;
+@L513:
+jmpf @L510;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L510;
+ldidw 1;
+jmp @L511;
+@L510:
+ldidw 0;
+@L511:
+jmpf @L514;
+@L515:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+notdw;
+jmpf @L518;
+ldidw 602;
+ldiqw @S279;
+ldiqw @S280;
+ldiqw @S281;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L518:
+@L516:
+ldidw 0;
+jmpf @L517;
+jmp @L515;
+@L517:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S282;
+ldiqw @arm_get_operand2_op1;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S283;
+ldiqw @arm_get_operand2_op2;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw @arm_get_operand2_op;
+ret;
+@L514:
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 4;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 4;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S284;
+ldiqw @arm_get_operand2_op1;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S285;
+ldiqw @arm_get_operand2_op2;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw @arm_get_operand2_op;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 4
+temp_struct_size:
+.res 4
+.extern strlen
+.extern token_table
+.bss
+.align 4
+code_cont_counter:
+.res 4
+.bss
+.align 4
+modified:
+.res 64
+.extern string_vprintf
+.extern bset_free
+.bss
+.align 4
+jump_tables_counter:
+.res 4
+.extern analyze_expression
+# ==== start of definition of function `free_temp' ====
+.text
+free_temp:
+addsp 12;        
+# param:`a', offset:-20
+# var: p, offset: 8
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L519:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L521;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+notdw;
+jmpf @L522;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpf @L522;
+ldidw 1;
+jmp @L523;
+@L522:
+ldidw 0;
+@L523:
+jmpf @L524;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+jmp @L521;
+@L524:
+@L520:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L519;
+@L521:
+ldidw 0;
+ret;
+.bss
+.align 8
+arm_output_file:
+.res 8
+.data
+.align 8
+str_segment:
+.align 8
+.qword @S286+0
+.align 8
+.qword @S287+0
+.align 8
+.qword @S288+0
+.align 8
+.qword @S289+0
+.bss
+.align 4
+reg_descr_tab:
+.res 64
+.extern cfg_nodes
+.extern memchr
+# ==== start of definition of function `arm_neg' ====
+.text
+arm_neg:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L525;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L525;
+ldidw 0;
+jmp @L526;
+@L525:
+ldidw 1;
+@L526:
+jmpf @L527;
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S290;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S291;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L528:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L529:
+ldidw 0;
+jmpf @L530;
+jmp @L528;
+@L530:
+jmp @L531;
+@L527:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S292;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L532:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L533:
+ldidw 0;
+jmpf @L534;
+jmp @L532;
+@L534:
+@L531:
+ldidw 0;
+ret;
+.extern new_type_exp_node
+.extern analyze_primary_expression
+.extern dup_decl_specs
+# ==== start of definition of function `arm_neq' ====
+.text
+arm_neq:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L535;
+ldidw 9;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw arm_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L536;
+@L535:
+# var: res, offset: 16
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L539;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L541;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L541;
+ldidw 0;
+jmp @L542;
+@L541:
+ldidw 1;
+@L542:
+jmpt @L539;
+ldidw 0;
+jmp @L540;
+@L539:
+ldidw 1;
+@L540:
+jmpt @L537;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L537;
+ldidw 0;
+jmp @L538;
+@L537:
+ldidw 1;
+@L538:
+jmpf @L543;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+jmp @L544;
+@L543:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+stw;
+pop;
+@L544:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand;
+call 8;
+ldbp 16;
+ldw;
+ldiqw @S293;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L545;
+ldbp 16;
+ldw;
+ldiqw @S294;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldw;
+ldiqw @S295;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+@L546:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L547:
+ldidw 0;
+jmpf @L548;
+jmp @L546;
+@L548:
+jmp @L549;
+@L545:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L549:
+@L536:
+ldidw 0;
+ret;
+.extern new_declaration_node
+.extern vfprintf
+.extern eval_const_expr
+# ==== start of definition of function `arm_save_restore_var_regs' ====
+.text
+arm_save_restore_var_regs:
+addsp 8;         
+# param:`rsa_start', offset:-20
+# var: i, offset: 4
+# var: rep, offset: 8
+ldiqw modified;
+ldidw 4;
+dw2qw;
+ldxdw 4;
+notdw;
+jmpf @L550;
+ldiqw 0;
+ret;
+@L550:
+ldiqw verbose_asm;
+lddw;
+jmpf @L551;
+ldiqw @S296;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S297;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L551:
+ldbp -20;
+lddw;
+negdw;
+ldiqw is_representable_in_imm12;
+call 4;
+pop;
+ldbp 8;
+stdw;
+jmpf @L552;
+ldbp -20;
+lddw;
+negdw;
+ldidw 12;
+ldiqw @S298;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S299;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L553;
+@L552:
+ldbp -20;
+lddw;
+negdw;
+ldidw 12;
+ldiqw @S300;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S301;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 12;
+ldidw 12;
+ldiqw @S302;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S303;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L553:
+ldidw 12;
+ldiqw @S304;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L554;
+ldiqw @S305;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S306;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L554:
+ldbp 8;
+lddw;
+jmpf @L555;
+ldbp -20;
+lddw;
+negdw;
+ldidw 12;
+ldiqw @S307;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S308;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L556;
+@L555:
+ldbp -20;
+lddw;
+negdw;
+ldidw 12;
+ldiqw @S309;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S310;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 12;
+ldidw 12;
+ldiqw @S311;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S312;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L556:
+ldidw 12;
+ldiqw @S313;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldidw 5;
+ldbp 4;
+stdw;
+pop;
+@L557:
+ldbp 4;
+lddw;
+ldidw 11;
+sltdw;
+jmpf @L559;
+ldiqw modified;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+jmpf @L560;
+ldbp 4;
+lddw;
+ldiqw @S314;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S315;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+jmp @L561;
+@L560:
+jmp @L559;
+@L561:
+@L558:
+incldw 4;
+jmp @L557;
+@L559:
+ldiqw @S316;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S317;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S318;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S319;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern hash
+# ==== start of definition of function `arm_and' ====
+.text
+arm_and:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L562;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L562;
+ldidw 0;
+jmp @L563;
+@L562:
+ldidw 1;
+@L563:
+jmpf @L564;
+# var: op, offset: 8
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 16;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S320;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S321;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L565:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L566:
+ldidw 0;
+jmpf @L567;
+jmp @L565;
+@L567:
+jmp @L568;
+@L564:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S322;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L569:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L570:
+ldidw 0;
+jmpf @L571;
+jmp @L569;
+@L571:
+@L568:
+ldidw 0;
+ret;
+.data
+.align 8
+instruction_handlers:
+.align 8
+.qword arm_add+0
+.align 8
+.qword arm_sub+0
+.align 8
+.qword arm_mul+0
+.align 8
+.qword arm_div+0
+.align 8
+.qword arm_rem+0
+.align 8
+.qword arm_shl+0
+.align 8
+.qword arm_shr+0
+.align 8
+.qword arm_and+0
+.align 8
+.qword arm_or+0
+.align 8
+.qword arm_xor+0
+.align 8
+.qword arm_eq+0
+.align 8
+.qword arm_neq+0
+.align 8
+.qword arm_lt+0
+.align 8
+.qword arm_let+0
+.align 8
+.qword arm_gt+0
+.align 8
+.qword arm_get+0
+.align 8
+.qword arm_neg+0
+.align 8
+.qword arm_cmpl+0
+.align 8
+.qword arm_not+0
+.align 8
+.qword arm_ch+0
+.align 8
+.qword arm_uch+0
+.align 8
+.qword arm_sh+0
+.align 8
+.qword arm_ush+0
+.align 8
+.qword arm_llsx+0
+.align 8
+.qword arm_llzx+0
+.align 8
+.qword arm_addr_of+0
+.align 8
+.qword arm_ind+0
+.align 8
+.qword arm_asn+0
+.align 8
+.qword arm_call+0
+.align 8
+.qword arm_indcall+0
+.align 8
+.qword arm_ind_asn+0
+.align 8
+.qword arm_lab+0
+.align 8
+.qword arm_jmp+0
+.align 8
+.qword arm_arg+0
+.align 8
+.qword arm_ret+0
+.align 8
+.qword arm_switch+0
+.align 8
+.qword arm_case+0
+.align 8
+.qword arm_cbr+0
+.align 8
+.qword arm_begarg+0
+.align 8
+.qword arm_nop+0
+.extern string_clear
+.bss
+.align 8
+asm_decls:
+.res 8
+.extern bsearch
+# ==== start of definition of function `arm_cgen' ====
+.text
+arm_cgen:
+.global arm_cgen
+addsp 40;        
+# param:`outf', offset:-24
+# var: i, offset: 4
+# var: j, offset: 8
+# var: ed, offset: 16
+# var: func_def_list, offset: 24
+# var: ext_sym_list, offset: 32
+ldbp -24;
+ldqw;
+ldiqw arm_output_file;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldbp 24;
+ldiqw ic_main;
+call 16;
+pop;
+pop;
+ldidw 512;
+ldiqw string_new;
+call 4;
+ldiqw asm_decls;
+stqw;
+pop;
+pop;
+ldidw 512;
+ldiqw string_new;
+call 4;
+ldiqw str_lits;
+stqw;
+pop;
+pop;
+ldidw 1024;
+ldiqw string_new;
+call 4;
+ldiqw func_body;
+stqw;
+pop;
+pop;
+ldidw 1024;
+ldiqw string_new;
+call 4;
+ldiqw func_prolog;
+stqw;
+pop;
+pop;
+ldidw 1024;
+ldiqw string_new;
+call 4;
+ldiqw func_epilog;
+stqw;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw addr_descr_tab;
+stqw;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L572:
+ldbp 24;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L574;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw arm_function_definition;
+call 16;
+pop;
+pop;
+@L573:
+incldw 4;
+jmp @L572;
+@L574:
+ldiqw func_body;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw @S323;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S324;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw arm_allocate_static_objects;
+call 0;
+pop;
+pop;
+ldiqw @S325;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S326;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+@L575:
+ldbp 32;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L577;
+# var: tmp, offset: 40
+ldiqw nid_counter;
+lddw;
+ldbp 40;
+stdw;
+pop;
+ldidw 0;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_var_nid;
+call 12;
+pop;
+pop;
+ldbp 40;
+lddw;
+ldiqw nid_counter;
+lddw;
+eqdw;
+jmpf @L578;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S327;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S328;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L578:
+@L576:
+incldw 8;
+jmp @L575;
+@L577:
+ldiqw include_libc;
+lddw;
+jmpf @L579;
+ldiqw @S329;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S330;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S331;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S332;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L579:
+ldiqw @S333;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S334;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw include_liblux;
+lddw;
+jmpf @L580;
+ldiqw @S335;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S336;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S337;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S338;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S339;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S340;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S341;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S342;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S343;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S344;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S345;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S346;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S347;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S348;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S349;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S350;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S351;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S352;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S353;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S354;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S355;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S356;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S357;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S358;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S359;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S360;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S361;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S362;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L580:
+ldiqw arm_output_file;
+ldqw;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw string_literals_counter;
+lddw;
+jmpf @L581;
+ldiqw @S363;
+ldiqw arm_output_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldiqw @S364;
+ldiqw arm_output_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldiqw d_mapsym_counter;
+lddw;
+ldiqw @S365;
+ldiqw arm_output_file;
+ldqw;
+ldiqw fprintf;
+call 20;
+pop;
+pop;
+ldiqw arm_output_file;
+ldqw;
+ldiqw str_lits;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+@L581:
+ldiqw str_lits;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern pre_save_pch
+.extern qsort
+.extern analyze_parameter_declaration
+.extern string_new
+.extern cg_outpath
+# ==== start of definition of function `dump_and_link' ====
+.text
+dump_and_link:
+addsp 0;         
+ldiqw code_cont_counter;
+lddw;
+ldiqw @S366;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S367;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw a_mapsym_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S368;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw code_cont_counter;
+lddw;
+ldiqw @S369;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldidw 0;
+ldiqw offs_to_lit_tab;
+stdw;
+pop;
+ldiqw code_cont_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+.extern memcmp
+.extern bset_insert
+.extern pre_load_pch
+.extern dflow_free_LiveOut
+.extern vsnprintf
+# ==== start of definition of function `arm_arg' ====
+.text
+arm_arg:
+addsp 36;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: ty, offset: 8
+ldbp -32;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L582;
+# var: siz, offset: 16
+ldidw 0;
+dw2w;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldiqw temp_struct_size;
+lddw;
+ugtdw;
+jmpf @L583;
+ldbp 16;
+lddw;
+ldiqw temp_struct_size;
+stdw;
+pop;
+@L583:
+ldiqw func_body;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldiqw calls_to_fix;
+ldiqw calls_to_fix_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw @S370;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+adddw;
+ldiqw arg_offs;
+stdw;
+pop;
+ldiqw 0;
+ret;
+@L582:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L584:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L587;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+neqdw;
+jmpt @L587;
+ldidw 0;
+jmp @L588;
+@L587:
+ldidw 1;
+@L588:
+notdw;
+jmpf @L589;
+ldidw 1959;
+ldiqw @S371;
+ldiqw @S372;
+ldiqw @S373;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L589:
+@L585:
+ldidw 0;
+jmpf @L586;
+jmp @L584;
+@L586:
+ldbp 8;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L590;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L590;
+ldidw 0;
+jmp @L591;
+@L590:
+ldidw 1;
+@L591:
+jmpf @L592;
+ldidw 8;
+ldiqw arg_offs;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldiqw arg_offs;
+stdw;
+pop;
+ldiqw arg_offs;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L593;
+# var: r, offset: 16
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+sdivdw;
+dw2w;
+ldbp 16;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+adddw;
+dw2w;
+ldbp 16;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+jmp @L594;
+@L593:
+# var: op, offset: 16
+# var: offs, offset: 24
+ldbp -28;
+lddw;
+ldiqw arm_get_operand2;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw arg_offs;
+lddw;
+ldidw 16;
+subdw;
+ldidw 4;
+adddw;
+ldbp 24;
+stdw;
+ldidw 4095;
+sgtdw;
+jmpf @L595;
+ldbp 24;
+lddw;
+ldidw 4;
+subdw;
+ldidw 12;
+ldiqw @S374;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw @S375;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldidw 12;
+ldidw 12;
+ldiqw @S376;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldbp 16;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S377;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L596;
+@L595:
+ldbp 24;
+lddw;
+ldidw 4;
+subdw;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw @S378;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldbp 16;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S379;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L596:
+@L594:
+ldiqw arg_offs;
+lddw;
+ldidw 8;
+adddw;
+ldiqw arg_offs;
+stdw;
+pop;
+jmp @L597;
+@L592:
+ldbp 4;
+lddw;
+ldidw 68;
+eqdw;
+jmpt @L598;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L598;
+ldidw 0;
+jmp @L599;
+@L598:
+ldidw 1;
+@L599:
+jmpf @L600;
+# var: siz, offset: 16
+# var: asiz, offset: 20
+ldbp 8;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldidw 4;
+ldbp 16;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw arg_offs;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldiqw arg_offs;
+stdw;
+pop;
+ldiqw arg_offs;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L601;
+# var: nr, offset: 24
+# var: ar, offset: 28
+# var: r, offset: 32
+ldbp 20;
+lddw;
+ldidw 4;
+udivdw;
+ldbp 24;
+stdw;
+pop;
+ldidw 4;
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+sdivdw;
+subdw;
+ldbp 28;
+stdw;
+pop;
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+sdivdw;
+dw2w;
+ldbp 32;
+stw;
+pop;
+ldbp 24;
+lddw;
+ldbp 28;
+lddw;
+sletdw;
+jmpf @L602;
+ldbp -28;
+lddw;
+ldidw 12;
+dw2w;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldiqw @T603;
+jmptab;
+@L605:
+ldidw 12;
+ldbp 32;
+ldw;
+ldiqw @S380;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L604;
+@L606:
+ldbp 32;
+ldw;
+ldidw 1;
+adddw;
+ldbp 32;
+ldw;
+ldidw 12;
+ldiqw @S381;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L604;
+@L607:
+ldbp 32;
+ldw;
+ldidw 2;
+adddw;
+ldbp 32;
+ldw;
+ldidw 1;
+adddw;
+ldbp 32;
+ldw;
+ldidw 12;
+ldiqw @S382;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+jmp @L604;
+@L608:
+ldbp 32;
+ldw;
+ldidw 3;
+adddw;
+ldbp 32;
+ldw;
+ldidw 2;
+adddw;
+ldbp 32;
+ldw;
+ldidw 1;
+adddw;
+ldbp 32;
+ldw;
+ldidw 12;
+ldiqw @S383;
+ldidw 1;
+ldiqw emit_code;
+call 32;
+pop;
+pop;
+jmp @L604;
+@L604:
+.data
+.align 8
+@T603:
+.dword 1
+.dword 4
+.qword @L604
+.qword @L605
+.qword @L606
+.qword @L607
+.qword @L608
+.text
+jmp @L609;
+@L602:
+# var: siz2, offset: 36
+ldbp -28;
+lddw;
+ldidw 12;
+dw2w;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp 28;
+lddw;
+ldiqw @T610;
+jmptab;
+@L612:
+ldidw 12;
+ldbp 32;
+ldw;
+ldiqw @S384;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 4;
+subdw;
+ldbp 36;
+stdw;
+pop;
+jmp @L611;
+@L613:
+ldbp 32;
+ldw;
+ldidw 1;
+adddw;
+ldbp 32;
+ldw;
+ldidw 12;
+ldiqw @S385;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 8;
+subdw;
+ldbp 36;
+stdw;
+pop;
+jmp @L611;
+@L614:
+ldbp 32;
+ldw;
+ldidw 2;
+adddw;
+ldbp 32;
+ldw;
+ldidw 1;
+adddw;
+ldbp 32;
+ldw;
+ldidw 12;
+ldiqw @S386;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 12;
+subdw;
+ldbp 36;
+stdw;
+pop;
+jmp @L611;
+@L611:
+.data
+.align 8
+@T610:
+.dword 1
+.dword 3
+.qword @L611
+.qword @L612
+.qword @L613
+.qword @L614
+.text
+ldiqw @S387;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 36;
+lddw;
+subdw;
+ldiqw is_representable_in_imm12;
+call 4;
+pop;
+jmpf @L615;
+ldbp 16;
+lddw;
+ldbp 36;
+lddw;
+subdw;
+ldidw 12;
+ldidw 12;
+ldiqw @S388;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L616;
+@L615:
+@L617:
+ldidw 0;
+notdw;
+jmpf @L620;
+ldidw 2041;
+ldiqw @S389;
+ldiqw @S390;
+ldiqw @S391;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L620:
+@L618:
+ldidw 0;
+jmpf @L619;
+jmp @L617;
+@L619:
+@L616:
+ldidw 12;
+ldiqw @S392;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldidw 12;
+ldidw 12;
+ldiqw @S393;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldiqw @S394;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp 36;
+lddw;
+ldidw 12;
+ldiqw @S395;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldiqw @S396;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldiqw @S397;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+@L609:
+jmp @L621;
+@L601:
+ldiqw @S398;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw arg_offs;
+lddw;
+ldidw 16;
+subdw;
+ldidw 12;
+adddw;
+ldiqw is_representable_in_imm12;
+call 4;
+pop;
+jmpf @L622;
+ldiqw arg_offs;
+lddw;
+ldidw 16;
+subdw;
+ldidw 12;
+adddw;
+ldidw 12;
+ldiqw @S399;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L623;
+@L622:
+ldiqw arg_offs;
+lddw;
+ldidw 16;
+subdw;
+ldidw 12;
+adddw;
+ldidw 12;
+ldiqw @S400;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldidw 12;
+ldiqw @S401;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L623:
+ldidw 12;
+ldiqw @S402;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldidw 12;
+dw2w;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldidw 12;
+ldiqw @S403;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 12;
+ldiqw @S404;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldiqw @S405;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldiqw @S406;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+@L621:
+ldiqw arg_offs;
+lddw;
+ldbp 20;
+lddw;
+adddw;
+ldiqw arg_offs;
+stdw;
+pop;
+jmp @L624;
+@L600:
+# var: r, offset: 16
+ldiqw arg_offs;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L625;
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+sdivdw;
+dw2w;
+ldbp 16;
+stw;
+pop;
+ldbp 16;
+ldw;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+jmp @L626;
+@L625:
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L629;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L629;
+ldidw 0;
+jmp @L630;
+@L629:
+ldidw 1;
+@L630:
+jmpt @L627;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+stw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L627;
+ldidw 0;
+jmp @L628;
+@L627:
+ldidw 1;
+@L628:
+jmpf @L631;
+ldidw 12;
+dw2w;
+ldbp 16;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+@L631:
+ldiqw arg_offs;
+lddw;
+ldidw 16;
+subdw;
+ldiqw is_representable_in_imm12;
+call 4;
+pop;
+jmpf @L632;
+ldiqw arg_offs;
+lddw;
+ldidw 16;
+subdw;
+ldbp 16;
+ldw;
+ldiqw @S407;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L633;
+@L632:
+@L634:
+ldidw 0;
+notdw;
+jmpf @L637;
+ldidw 2080;
+ldiqw @S408;
+ldiqw @S409;
+ldiqw @S410;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L637:
+@L635:
+ldidw 0;
+jmpf @L636;
+jmp @L634;
+@L636:
+@L633:
+@L626:
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+adddw;
+ldiqw arg_offs;
+stdw;
+pop;
+@L624:
+@L597:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern vsprintf
+.bss
+.align 8
+str_lits:
+.res 8
+.extern nid_counter
+.extern new_cg_node
+.extern warning_count
+# ==== start of definition of function `arm_asn' ====
+.text
+arm_asn:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L638;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L638;
+ldidw 0;
+jmp @L639;
+@L638:
+ldidw 1;
+@L639:
+jmpf @L640;
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+@L641:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L642:
+ldidw 0;
+jmpf @L643;
+jmp @L641;
+@L643:
+jmp @L644;
+@L640:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+@L645:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L646:
+ldidw 0;
+jmpf @L647;
+jmp @L645;
+@L647:
+@L644:
+ldidw 0;
+ret;
+.extern memcpy
+.bss
+.align 4
+func_last_quad:
+.res 4
+.extern fopen
+.extern be_atoi
+# ==== start of definition of function `arm_nop' ====
+.text
+arm_nop:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldidw 0;
+ret;
+# ==== start of definition of function `arm_not' ====
+.text
+arm_not:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L648;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L648;
+ldidw 0;
+jmp @L649;
+@L648:
+ldidw 1;
+@L649:
+jmpf @L650;
+ldidw 18;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw arm_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L651;
+@L650:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldiqw @S411;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldiqw @S412;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldiqw @S413;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+@L652:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L653:
+ldidw 0;
+jmpf @L654;
+jmp @L652;
+@L654:
+@L651:
+ldidw 0;
+ret;
+# ==== start of definition of function `arm_do_libcall' ====
+.text
+arm_do_libcall:
+addsp 12;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# param:`func', offset:-36
+# var: res, offset: 4
+ldidw 4;
+dw2w;
+ldbp 4;
+stw;
+pop;
+ldidw 5;
+dw2w;
+ldbp 6;
+stw;
+pop;
+# var: r1, offset: 8
+ldidw 0;
+dw2w;
+ldbp 8;
+stw;
+pop;
+ldidw 1;
+dw2w;
+ldbp 10;
+stw;
+pop;
+# var: r2, offset: 12
+ldidw 2;
+dw2w;
+ldbp 12;
+stw;
+pop;
+ldidw 3;
+dw2w;
+ldbp 14;
+stw;
+pop;
+ldbp -36;
+lddw;
+ldiqw @T655;
+jmptab;
+@L657:
+@L658:
+@L659:
+@L660:
+@L661:
+ldiqw arm_save_arg_regs;
+call 0;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldbp 12;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldiqw libfuncs;
+ldbp -36;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S414;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldiqw @S415;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S416;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw arm_restore_arg_regs;
+call 0;
+pop;
+pop;
+@L662:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L663:
+ldidw 0;
+jmpf @L664;
+jmp @L662;
+@L664:
+jmp @L656;
+@L665:
+@L666:
+@L667:
+ldiqw arm_save_arg_regs;
+call 0;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 2;
+dw2w;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldiqw libfuncs;
+ldbp -36;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S417;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldiqw @S418;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S419;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw arm_restore_arg_regs;
+call 0;
+pop;
+pop;
+@L668:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L669:
+ldidw 0;
+jmpf @L670;
+jmp @L668;
+@L670:
+jmp @L656;
+@L671:
+ldiqw arm_save_arg_regs;
+call 0;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldiqw @S420;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S421;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S422;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S423;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S424;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S425;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw arm_restore_arg_regs;
+call 0;
+pop;
+pop;
+@L672:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldidw 4;
+dw2w;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L673:
+ldidw 0;
+jmpf @L674;
+jmp @L672;
+@L674:
+jmp @L656;
+@L675:
+@L676:
+@L677:
+@L678:
+@L679:
+@L680:
+@L681:
+@L682:
+@L683:
+@L684:
+ldiqw arm_save_arg_regs;
+call 0;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldbp 12;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldiqw libfuncs;
+ldbp -36;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S426;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp -36;
+lddw;
+ldiqw @T685;
+jmptab;
+@L687:
+ldiqw @S427;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S428;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S429;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L686;
+@L688:
+ldiqw @S430;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S431;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S432;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L686;
+@L689:
+@L690:
+ldiqw @S433;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S434;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S435;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L686;
+@L691:
+@L692:
+ldiqw @S436;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S437;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S438;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L686;
+@L693:
+@L694:
+ldiqw @S439;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S440;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S441;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L686;
+@L695:
+@L696:
+ldiqw @S442;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S443;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S444;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @L686;
+@L686:
+.data
+.align 8
+@T685:
+.dword 8
+.dword 10
+.qword @L686
+.qword @L687
+.qword @L688
+.qword @L689
+.qword @L691
+.qword @L693
+.qword @L695
+.qword @L690
+.qword @L692
+.qword @L694
+.qword @L696
+.text
+ldiqw arm_restore_arg_regs;
+call 0;
+pop;
+pop;
+@L697:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldidw 4;
+dw2w;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L698:
+ldidw 0;
+jmpf @L699;
+jmp @L697;
+@L699:
+jmp @L656;
+@L656:
+.data
+.align 8
+@T655:
+.dword 0
+.dword 19
+.qword @L656
+.qword @L657
+.qword @L658
+.qword @L659
+.qword @L660
+.qword @L661
+.qword @L665
+.qword @L666
+.qword @L667
+.qword @L675
+.qword @L676
+.qword @L678
+.qword @L680
+.qword @L682
+.qword @L684
+.qword @L677
+.qword @L679
+.qword @L681
+.qword @L683
+.qword @L671
+.text
+ldidw 0;
+ret;
+.extern bset_delete
+# ==== start of definition of function `spill_reg' ====
+.text
+spill_reg:
+addsp 8;         
+# param:`r', offset:-20
+# var: a, offset: 4
+ldiqw reg_descr_tab;
+ldbp -20;
+ldw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+jmpf @L700;
+ldiqw 0;
+ret;
+@L700:
+ldiqw reg_descr_tab;
+ldbp -20;
+ldw;
+dw2qw;
+ldxdw 4;
+ldbp 4;
+stdw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L701;
+# var: rr, offset: 8
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw arm_store2;
+call 8;
+pop;
+pop;
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+stw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+ldiqw reg_descr_tab;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L702;
+@L701:
+ldbp 4;
+lddw;
+ldbp -20;
+ldw;
+ldiqw arm_store;
+call 8;
+pop;
+pop;
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L702:
+ldidw 0;
+ret;
+.extern push_scope
+.extern free_c_token
+.extern ic_main
+.extern new_address
+.extern parse
+.extern get_pre_token
+# ==== start of definition of function `arm_load_addr' ====
+.text
+arm_load_addr:
+addsp 16;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+# var: e, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L703;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L704;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldbp -20;
+ldw;
+ldiqw @S445;
+ldidw 1;
+ldiqw emit_code;
+call 32;
+pop;
+pop;
+jmp @L705;
+@L704:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -20;
+ldw;
+ldiqw @S446;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L705:
+jmp @L706;
+@L703:
+# var: offs, offset: 16
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldiqw is_representable_in_imm12;
+call 4;
+pop;
+jmpf @L707;
+ldbp 16;
+lddw;
+ldbp -20;
+ldw;
+ldiqw @S447;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L708;
+@L707:
+ldbp 16;
+lddw;
+ldidw 12;
+ldiqw @S448;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldbp -20;
+ldw;
+ldiqw @S449;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L708:
+@L706:
+ldidw 0;
+ret;
+# ==== start of definition of function `get_temp_offs' ====
+.text
+get_temp_offs:
+addsp 12;        
+# param:`a', offset:-20
+# var: p, offset: 8
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L709:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L711;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+notdw;
+jmpf @L712;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpf @L712;
+ldidw 1;
+jmp @L713;
+@L712:
+ldidw 0;
+@L713:
+jmpf @L714;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ret;
+@L714:
+@L710:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L709;
+@L711:
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L715:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L717;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+jmpf @L718;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ret;
+@L718:
+@L716:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L715;
+@L717:
+ldiqw 24;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldidw 8;
+subdw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw temp_list;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 4
+qword_return:
+.res 4
+.extern get_member_descriptor
+.extern decl_init
+# ==== start of definition of function `arm_static_expr' ====
+.text
+arm_static_expr:
+addsp 28;        
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T719;
+jmptab;
+@L721:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T722;
+switch;
+@L724:
+# var: pi, offset: 4
+# var: ii, offset: 8
+# var: ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L725;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+jmp @L726;
+@L725:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L726:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw arm_static_expr;
+call 8;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw arm_static_expr;
+call 8;
+mulqw;
+addqw;
+ret;
+@L727:
+@L728:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 71;
+neqdw;
+jmpf @L729;
+# var: m, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw get_member_descriptor;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw arm_static_expr;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+addqw;
+ret;
+jmp @L730;
+@L729:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw arm_static_expr;
+call 8;
+ret;
+@L730:
+@L731:
+@L732:
+@L733:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw arm_static_expr;
+call 8;
+ret;
+@L734:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L735;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw arm_static_expr;
+call 8;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw arm_static_expr;
+call 8;
+addqw;
+ret;
+jmp @L736;
+@L735:
+# var: pi, offset: 4
+# var: ii, offset: 8
+# var: ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L737;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+jmp @L738;
+@L737:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L738:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw arm_static_expr;
+call 8;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw arm_static_expr;
+call 8;
+mulqw;
+addqw;
+ret;
+@L736:
+@L739:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L740;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw arm_static_expr;
+call 8;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw arm_static_expr;
+call 8;
+subqw;
+ret;
+jmp @L741;
+@L740:
+# var: ty, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 8;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw arm_static_expr;
+call 8;
+ldbp 8;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw arm_static_expr;
+call 8;
+mulqw;
+subqw;
+ret;
+@L741:
+@L742:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ordw;
+jmpf @L743;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw arm_static_expr;
+call 8;
+ret;
+jmp @L744;
+@L743:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw arm_static_expr;
+call 8;
+ret;
+@L744:
+@L745:
+@L746:
+ldidw 0;
+notdw;
+jmpf @L749;
+ldidw 2601;
+ldiqw @S450;
+ldiqw @S451;
+ldiqw @S452;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L749:
+@L747:
+ldidw 0;
+jmpf @L748;
+jmp @L746;
+@L748:
+@L723:
+.data
+.align 8
+@T722:
+.dword 10
+.dword 6
+.dword 7
+.dword 12
+.dword 13
+.dword 30
+.dword 97
+.dword 101
+.dword 103
+.dword 105
+.qword @L745
+.qword @L727
+.qword @L728
+.qword @L734
+.qword @L739
+.qword @L742
+.qword @L724
+.qword @L732
+.qword @L731
+.qword @L733
+.text
+@L750:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ret;
+@L751:
+ldiqw string_literals_counter;
+lddw;
+ldiqw @S453;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S454;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw str_lits;
+ldqw;
+ldiqw emit_raw_string;
+call 16;
+pop;
+pop;
+ldiqw string_literals_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S455;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ret;
+@L752:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L753;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw enclosing_function;
+ldqw;
+ldiqw @S456;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+jmp @L754;
+@L753:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S457;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+@L754:
+ldidw 0;
+dw2qw;
+ret;
+@L720:
+.data
+.align 8
+@T719:
+.dword 0
+.dword 4
+.qword @L720
+.qword @L721
+.qword @L750
+.qword @L751
+.qword @L752
+.text
+@L755:
+ldidw 0;
+notdw;
+jmpf @L758;
+ldidw 2617;
+ldiqw @S458;
+ldiqw @S459;
+ldiqw @S460;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L758:
+@L756:
+ldidw 0;
+jmpf @L757;
+jmp @L755;
+@L757:
+ldidw 0;
+ret;
+.extern ic_free_function
+# ==== start of definition of function `arm_jmp' ====
+.text
+arm_jmp:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 31;
+eqdw;
+jmpf @L759;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L759;
+ldidw 1;
+jmp @L760;
+@L759:
+ldidw 0;
+@L760:
+jmpf @L761;
+ldiqw 0;
+ret;
+@L761:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw @S461;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern dup_declarator
+.extern cg_nodes
+.extern strncat
+.extern dflow_free_Dom
+.extern fileno
+# ==== start of definition of function `arm_ind_asn' ====
+.text
+arm_ind_asn:
+addsp 28;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: pr, offset: 8
+# var: st_str, offset: 16
+ldiqw spill_aliased_objects;
+call 0;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L762;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L762;
+ldidw 0;
+jmp @L763;
+@L762:
+ldidw 1;
+@L763:
+jmpf @L764;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L765;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L766;
+@L765:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+stw;
+pop;
+@L766:
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L767;
+# var: p, offset: 24
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldidw 12;
+ldiqw @S462;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldidw 12;
+ldiqw @S463;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldidw 12;
+ldiqw @S464;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldidw 12;
+ldiqw @S465;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L768;
+@L767:
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L769;
+ldbp -32;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldidw 12;
+ldiqw @S466;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldidw 12;
+ldiqw @S467;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldiqw @S468;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldidw 12;
+ldiqw @S469;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L770;
+@L769:
+# var: r, offset: 24
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L771;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 24;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 24;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 24;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 24;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldbp 24;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+jmp @L772;
+@L771:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 24;
+ldiqw 2;
+addqw;
+stw;
+pop;
+@L773:
+ldbp 24;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+notdw;
+jmpf @L776;
+ldidw 1854;
+ldiqw @S470;
+ldiqw @S471;
+ldiqw @S472;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L776:
+@L774:
+ldidw 0;
+jmpf @L775;
+jmp @L773;
+@L775:
+@L772:
+ldbp 24;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 24;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S473;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L770:
+@L768:
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @@arm_ind_asn_done;
+jmp @L777;
+@L764:
+ldbp 4;
+lddw;
+ldidw 68;
+eqdw;
+jmpt @L778;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L778;
+ldidw 0;
+jmp @L779;
+@L778:
+ldidw 1;
+@L779:
+jmpf @L780;
+ldiqw @S474;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldidw 12;
+dw2w;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldidw 12;
+ldiqw @S475;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 12;
+dw2w;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldidw 12;
+ldiqw @S476;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldidw 12;
+ldiqw @S477;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldiqw @S478;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldiqw @S479;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+jmp @@arm_ind_asn_done;
+@L780:
+@L777:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L781;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L782;
+@L781:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+stw;
+pop;
+@L782:
+ldbp 4;
+lddw;
+ldiqw @T783;
+switch;
+@L785:
+@L786:
+ldiqw @S480;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L784;
+@L787:
+@L788:
+@L789:
+ldiqw @S481;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L784;
+@L790:
+ldiqw @S482;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L784;
+@L784:
+.data
+.align 8
+@T783:
+.dword 6
+.dword 49
+.dword 64
+.dword 106
+.dword 107
+.dword 108
+.qword @L790
+.qword @L787
+.qword @L785
+.qword @L788
+.qword @L789
+.qword @L786
+.text
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L791;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldidw 12;
+ldiqw @S483;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldidw 12;
+ldbp 16;
+ldqw;
+ldiqw @S484;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+jmp @L792;
+@L791:
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L793;
+ldbp -32;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldidw 12;
+ldiqw @S485;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldidw 12;
+ldbp 16;
+ldqw;
+ldiqw @S486;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+jmp @L794;
+@L793:
+# var: r, offset: 24
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L795;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 24;
+stw;
+pop;
+ldbp -32;
+lddw;
+ldbp 24;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+jmp @L796;
+@L795:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 24;
+stw;
+pop;
+@L796:
+ldbp 8;
+ldw;
+ldbp 24;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S487;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+@L794:
+@L792:
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@@arm_ind_asn_done:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern bset_update
+# ==== start of definition of function `spill_all' ====
+.text
+spill_all:
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L797:
+ldbp 4;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L799;
+ldbp 4;
+lddw;
+dw2w;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+@L798:
+incldw 4;
+jmp @L797;
+@L799:
+ldidw 0;
+ret;
+.extern string_printf
+.extern dflow_LiveOut
+.extern lookup_external_id
+.bss
+.align 8
+addr_descr_tab:
+.res 8
+.extern hash2
+.extern analyze_type_name
+# ==== start of definition of function `update_tar_descriptors2' ====
+.text
+update_tar_descriptors2:
+addsp 0;         
+# param:`res', offset:-20
+# param:`tar', offset:-24
+# param:`liveness', offset:-28
+# param:`next_use', offset:-32
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldbp -24;
+lddw;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -24;
+lddw;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+notdw;
+jmpf @L800;
+ldbp -28;
+ldub;
+jmpf @L801;
+ldbp -24;
+lddw;
+ldbp -20;
+ldn 4;
+ldiqw arm_store2;
+call 8;
+pop;
+pop;
+@L801:
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L800:
+ldidw 0;
+ret;
+.bss
+.align 4
+arg_offs:
+.res 4
+.extern is_unsigned_int
+.extern memmove
+.extern replace_extension
+.extern analyze_struct_declarator
+.extern get_type_spec
+# ==== start of definition of function `arm_shl' ====
+.text
+arm_shl:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L802;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L802;
+ldidw 0;
+jmp @L803;
+@L802:
+ldidw 1;
+@L803:
+jmpf @L804;
+ldidw 5;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw arm_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L805;
+@L804:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S488;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L806:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L807:
+ldidw 0;
+jmpf @L808;
+jmp @L806;
+@L808:
+@L805:
+ldidw 0;
+ret;
+# ==== start of definition of function `arm_shr' ====
+.text
+arm_shr:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L809;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L809;
+ldidw 0;
+jmp @L810;
+@L809:
+ldidw 1;
+@L810:
+jmpf @L811;
+ldbp 4;
+lddw;
+ldiqw is_signed_int;
+call 4;
+pop;
+jmpf @L812;
+ldidw 6;
+jmp @L813;
+@L812:
+ldidw 7;
+@L813:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw arm_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L814;
+@L811:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand;
+call 8;
+ldbp 4;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L815;
+ldiqw @S489;
+jmp @L816;
+@L815:
+ldiqw @S490;
+@L816:
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S491;
+ldidw 1;
+ldiqw emit_code;
+call 32;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L817:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L818:
+ldidw 0;
+jmpf @L819;
+jmp @L817;
+@L819:
+@L814:
+ldidw 0;
+ret;
+.bss
+.align 4
+offs_to_lit_tab:
+.res 4
+.extern cfg_nodes_counter
+# ==== start of definition of function `arm_indcall' ====
+.text
+arm_indcall:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldidw 12;
+dw2w;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldidw 12;
+ldiqw @S492;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldiqw arm_post_call;
+call 4;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldbp -24;
+lddw;
+jmpf @L820;
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L821;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L821;
+ldidw 0;
+jmp @L822;
+@L821:
+ldidw 1;
+@L822:
+jmpf @L823;
+# var: r, offset: 8
+ldidw 4;
+dw2w;
+ldbp 8;
+stw;
+pop;
+ldidw 5;
+dw2w;
+ldbp 10;
+stw;
+pop;
+ldiqw @S493;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw @S494;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+jmp @L824;
+@L823:
+ldiqw @S495;
+ldidw 1;
+ldiqw emit_code;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldidw 4;
+dw2w;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L824:
+@L820:
+ldidw 0;
+ret;
+.bss
+.align 8
+enclosing_function:
+.res 8
+.extern analyze_function_definition
+.extern strdup
+.extern bset_new
+.extern arena_new
+.extern analyze_init_declarator
+# ==== start of definition of function `do_relop_jump' ====
+.text
+do_relop_jump:
+addsp 24;        
+# param:`i', offset:-20
+# param:`flags', offset:-28
+# param:`tar', offset:-32
+# param:`arg1', offset:-36
+# param:`arg2', offset:-40
+# var: nid, offset: 4
+# var: j, offset: 8
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -36;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -40;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldidw 1;
+adddw;
+ldbp 8;
+stdw;
+pop;
+@L825:
+# var: lab, offset: 12
+# var: tar_2, offset: 16
+# var: tar_3, offset: 20
+# var: arg2_2, offset: 24
+@L828:
+ldbp 8;
+lddw;
+ldiqw func_last_quad;
+lddw;
+sletdw;
+notdw;
+jmpf @L831;
+ldidw 1302;
+ldiqw @S496;
+ldiqw @S497;
+ldiqw @S498;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L831:
+@L829:
+ldidw 0;
+jmpf @L830;
+jmp @L828;
+@L830:
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 37;
+neqdw;
+jmpt @L832;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+lddw;
+neqdw;
+jmpt @L832;
+ldidw 0;
+jmp @L833;
+@L832:
+ldidw 1;
+@L833:
+jmpf @L834;
+jmp @L826;
+@L834:
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 20;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 24;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L835;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T836;
+jmptab;
+@L838:
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S499;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L837;
+@L839:
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S500;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L837;
+@L840:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L841;
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S501;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L842;
+@L841:
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S502;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L842:
+jmp @L837;
+@L843:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L844;
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S503;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L845;
+@L844:
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S504;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L845:
+jmp @L837;
+@L846:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L847;
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S505;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L848;
+@L847:
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S506;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L848:
+jmp @L837;
+@L849:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L850;
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S507;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L851;
+@L850:
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S508;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L851:
+jmp @L837;
+@L837:
+.data
+.align 8
+@T836:
+.dword 10
+.dword 6
+.qword @L837
+.qword @L838
+.qword @L839
+.qword @L840
+.qword @L843
+.qword @L846
+.qword @L849
+.text
+jmp @L852;
+@L835:
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T853;
+jmptab;
+@L855:
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S509;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L854;
+@L856:
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S510;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L854;
+@L857:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L858;
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S511;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L859;
+@L858:
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S512;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L859:
+jmp @L854;
+@L860:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L861;
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S513;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L862;
+@L861:
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S514;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L862:
+jmp @L854;
+@L863:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L864;
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S515;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L865;
+@L864:
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S516;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L865:
+jmp @L854;
+@L866:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L867;
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S517;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L868;
+@L867:
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S518;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L868:
+jmp @L854;
+@L854:
+.data
+.align 8
+@T853:
+.dword 10
+.dword 6
+.qword @L854
+.qword @L855
+.qword @L856
+.qword @L857
+.qword @L860
+.qword @L863
+.qword @L866
+.text
+@L852:
+ldidw 39;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L827;
+@L826:
+incldw 8;
+jmp @L825;
+@L827:
+ldidw 0;
+ret;
+.extern cfg_function_to_print
+.extern strncmp
+# ==== start of definition of function `arm_load2' ====
+.text
+arm_load2:
+addsp 20;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+# var: offs, offset: 4
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L869;
+# var: p, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S519;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S520;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L870;
+@L869:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L871;
+ldbp -24;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S521;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S522;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+jmp @L872;
+@L871:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L873;
+# var: cat, offset: 8
+# var: e, offset: 16
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L874;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+neqdw;
+jmpf @L875;
+@L876:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+neqdw;
+notdw;
+jmpf @L879;
+ldidw 493;
+ldiqw @S523;
+ldiqw @S524;
+ldiqw @S525;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L879:
+@L877:
+ldidw 0;
+jmpf @L878;
+jmp @L876;
+@L878:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S526;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S527;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L880;
+@L875:
+@L881:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+eqdw;
+notdw;
+jmpf @L884;
+ldidw 497;
+ldiqw @S528;
+ldiqw @S529;
+ldiqw @S530;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L884:
+@L882:
+ldidw 0;
+jmpf @L883;
+jmp @L881;
+@L883:
+@L880:
+ldiqw 0;
+ret;
+@L874:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+@L885:
+ldbp 8;
+lddw;
+ldidw 110;
+eqdw;
+jmpt @L888;
+ldbp 8;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L888;
+ldidw 0;
+jmp @L889;
+@L888:
+ldidw 1;
+@L889:
+notdw;
+jmpf @L890;
+ldidw 504;
+ldiqw @S531;
+ldiqw @S532;
+ldiqw @S533;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L890:
+@L886:
+ldidw 0;
+jmpf @L887;
+jmp @L885;
+@L887:
+ldbp 16;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L891;
+ldbp 16;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L892;
+ldbp 16;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldidw 12;
+ldiqw @S534;
+ldidw 1;
+ldiqw emit_code;
+call 32;
+pop;
+pop;
+jmp @L893;
+@L892:
+ldbp 16;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 12;
+ldiqw @S535;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L893:
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 12;
+ldiqw @S536;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L894;
+@L891:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+ldidw 0;
+sltdw;
+jmpf @L895;
+ldbp 4;
+lddw;
+ldidw 4095;
+negdw;
+sgetdw;
+jmpf @L896;
+ldbp 4;
+lddw;
+negdw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S537;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+adddw;
+negdw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S538;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L896:
+jmp @L897;
+@L895:
+ldbp 4;
+lddw;
+ldidw 4;
+adddw;
+ldidw 4095;
+sletdw;
+jmpf @L898;
+ldbp 4;
+lddw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S539;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+adddw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S540;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L898:
+@L897:
+jmp @@arm_load2_large_offset;
+@L894:
+jmp @L899;
+@L873:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L900;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L901;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+neqdw;
+jmpf @L902;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S541;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L902:
+@L903:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+notdw;
+jmpf @L906;
+ldidw 532;
+ldiqw @S542;
+ldiqw @S543;
+ldiqw @S544;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L906:
+@L904:
+ldidw 0;
+jmpf @L905;
+jmp @L903;
+@L905:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+neqdw;
+jmpf @L907;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S545;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L907:
+jmp @L908;
+@L901:
+# var: offs, offset: 8
+ldbp -24;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldbp 8;
+stdw;
+ldidw 4095;
+negdw;
+sgetdw;
+jmpf @L909;
+ldbp 8;
+lddw;
+negdw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S546;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldidw 4;
+adddw;
+negdw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S547;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L910;
+@L909:
+jmp @@arm_load2_large_offset;
+@L910:
+@L908:
+@L900:
+@L899:
+@L872:
+@L870:
+ldiqw 0;
+ret;
+@@arm_load2_large_offset:
+ldbp 4;
+lddw;
+ldidw 12;
+ldiqw @S548;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldidw 12;
+ldiqw @S549;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 12;
+ldiqw @S550;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern arena_set_nom_siz
+.extern bset_union_diff
+.bss
+.align 4
+string_literals_counter:
+.res 4
+.extern analyze_multiplicative_expression
+.extern analyze_additive_expression
+.extern stat_number_of_c_tokens
+.extern strncpy
+.extern bset_clear
+.extern decl_save_pch
+.extern bset_card
+.extern analyze_assignment_expression
+.extern ic_instructions
+.extern new_extern_id_node
+.extern decl_load_pch
+# ==== start of definition of function `arm_store2' ====
+.text
+arm_store2:
+addsp 12;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+# var: offs, offset: 4
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L911;
+# var: e, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L912;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L913;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldidw 12;
+ldiqw @S551;
+ldidw 1;
+ldiqw emit_code;
+call 32;
+pop;
+pop;
+jmp @L914;
+@L913:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 12;
+ldiqw @S552;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+@L914:
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 12;
+ldiqw @S553;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+jmp @L915;
+@L912:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+ldidw 0;
+sltdw;
+jmpf @L916;
+ldbp 4;
+lddw;
+ldidw 4095;
+negdw;
+sgetdw;
+jmpf @L917;
+ldbp 4;
+lddw;
+negdw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S554;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+adddw;
+negdw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S555;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L917:
+jmp @L918;
+@L916:
+ldbp 4;
+lddw;
+ldidw 4;
+adddw;
+ldidw 4095;
+sletdw;
+jmpf @L919;
+ldbp 4;
+lddw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S556;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+adddw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S557;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L919:
+@L918:
+jmp @@arm_store2_large_offset;
+@L915:
+jmp @L920;
+@L911:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L921;
+# var: offs, offset: 8
+ldbp -24;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldbp 8;
+stdw;
+ldidw 4095;
+negdw;
+sgetdw;
+jmpf @L922;
+ldbp 8;
+lddw;
+negdw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S558;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldidw 4;
+adddw;
+negdw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S559;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+jmp @L923;
+@L922:
+jmp @@arm_store2_large_offset;
+@L923:
+@L921:
+@L920:
+ldiqw 0;
+ret;
+@@arm_store2_large_offset:
+ldbp 4;
+lddw;
+ldidw 12;
+ldiqw @S560;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldidw 12;
+ldidw 12;
+ldiqw @S561;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 12;
+ldiqw @S562;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 4
+struct_union_return:
+.res 4
+.extern bset_union
+.extern analyze_translation_unit
+.extern strnlen
+.extern bset_new_in
+.extern analyze_enumerator
+.extern targeting_arch64
+.extern set_attributes
+.extern is_typedef_name
+.extern dflow_exit_function
+# ==== start of definition of function `arm_sub' ====
+.text
+arm_sub:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L924;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L924;
+ldidw 0;
+jmp @L925;
+@L924:
+ldidw 1;
+@L925:
+jmpf @L926;
+# var: op, offset: 8
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 16;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw arm_load2;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S563;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S564;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L927:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L928:
+ldidw 0;
+jmpf @L929;
+jmp @L927;
+@L929:
+jmp @L930;
+@L926:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S565;
+ldidw 1;
+ldiqw emit_code;
+call 28;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L931:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L932:
+ldidw 0;
+jmpf @L933;
+jmp @L931;
+@L933:
+@L930:
+ldidw 0;
+ret;
+.extern arena_reset
+.extern fread
+.extern strrchr
+# ==== start of definition of function `arm_addr_of' ====
+.text
+arm_addr_of:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 4;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldw;
+ldiqw arm_load_addr;
+call 8;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.data
+.align 4
+curr_segment:
+.align 4
+.dword -1
+.extern bset_next
+# ==== start of definition of function `update_tar_descriptors' ====
+.text
+update_tar_descriptors:
+addsp 0;         
+# param:`res', offset:-20
+# param:`tar', offset:-24
+# param:`liveness', offset:-28
+# param:`next_use', offset:-32
+ldbp -20;
+ldw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldbp -24;
+lddw;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+notdw;
+jmpf @L934;
+ldbp -28;
+ldub;
+jmpf @L935;
+ldbp -24;
+lddw;
+ldbp -20;
+ldw;
+ldiqw arm_store;
+call 8;
+pop;
+pop;
+@L935:
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L934:
+ldidw 0;
+ret;
+.extern disable_warnings
+.extern string_append
+.bss
+.align 8
+curr_func:
+.res 8
+.extern bset_diff
+.extern install_macro
+# ==== start of definition of function `get_reg' ====
+.text
+get_reg:
+addsp 4;         
+# param:`i', offset:-20
+# var: arg1, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L940;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L940;
+ldidw 0;
+jmp @L941;
+@L940:
+ldidw 1;
+@L941:
+notdw;
+jmpf @L938;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L938;
+ldidw 1;
+jmp @L939;
+@L938:
+ldidw 0;
+@L939:
+jmpf @L936;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+notdw;
+jmpf @L936;
+ldidw 1;
+jmp @L937;
+@L936:
+ldidw 0;
+@L937:
+jmpf @L942;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ret;
+@L942:
+ldiqw get_reg0;
+call 0;
+pop;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern bset_inters
+# ==== start of definition of function `arm_ch' ====
+.text
+arm_ch:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldw;
+ldbp 4;
+ldw;
+ldiqw @S566;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L943:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L944:
+ldidw 0;
+jmpf @L945;
+jmp @L943;
+@L945:
+ldidw 0;
+ret;
+.extern edge_add
+.extern string_buf
+.extern ferror
+.extern random
+# ==== start of definition of function `arm_eq' ====
+.text
+arm_eq:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L946;
+ldidw 8;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw arm_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L947;
+@L946:
+# var: res, offset: 16
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L950;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L952;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L952;
+ldidw 0;
+jmp @L953;
+@L952:
+ldidw 1;
+@L953:
+jmpt @L950;
+ldidw 0;
+jmp @L951;
+@L950:
+ldidw 1;
+@L951:
+jmpt @L948;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L948;
+ldidw 0;
+jmp @L949;
+@L948:
+ldidw 1;
+@L949:
+jmpf @L954;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+jmp @L955;
+@L954:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+stw;
+pop;
+@L955:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand;
+call 8;
+ldbp 16;
+ldw;
+ldiqw @S567;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L956;
+ldbp 16;
+ldw;
+ldiqw @S568;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldw;
+ldiqw @S569;
+ldidw 1;
+ldiqw emit_code;
+call 16;
+pop;
+pop;
+@L957:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L958:
+ldidw 0;
+jmpf @L959;
+jmp @L957;
+@L959:
+jmp @L960;
+@L956:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L960:
+@L947:
+ldidw 0;
+ret;
+# ==== start of definition of function `new_string_literal' ====
+.text
+new_string_literal:
+addsp 0;         
+# param:`a', offset:-20
+ldiqw string_literals_counter;
+lddw;
+ldiqw @S570;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S571;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw str_lits;
+ldqw;
+ldiqw emit_raw_string;
+call 16;
+pop;
+pop;
+ldiqw string_literals_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern ic_instructions_counter
+.extern free
+.extern malloc
+.extern get_external_declarations
+# ==== start of definition of function `arm_gt' ====
+.text
+arm_gt:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L961;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L962;
+ldidw 15;
+jmp @L963;
+@L962:
+ldidw 11;
+@L963:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw arm_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L964;
+@L961:
+# var: res, offset: 16
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L967;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L969;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L969;
+ldidw 0;
+jmp @L970;
+@L969:
+ldidw 1;
+@L970:
+jmpt @L967;
+ldidw 0;
+jmp @L968;
+@L967:
+ldidw 1;
+@L968:
+jmpt @L965;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L965;
+ldidw 0;
+jmp @L966;
+@L965:
+ldidw 1;
+@L966:
+jmpf @L971;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+jmp @L972;
+@L971:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+stw;
+pop;
+@L972:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand;
+call 8;
+ldbp 16;
+ldw;
+ldiqw @S572;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L973;
+ldbp 16;
+ldw;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L974;
+ldiqw @S573;
+jmp @L975;
+@L974:
+ldiqw @S574;
+@L975:
+ldiqw @S575;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 16;
+ldw;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L976;
+ldiqw @S576;
+jmp @L977;
+@L976:
+ldiqw @S577;
+@L977:
+ldiqw @S578;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L978:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L979:
+ldidw 0;
+jmpf @L980;
+jmp @L978;
+@L980:
+jmp @L981;
+@L973:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L981:
+@L964:
+ldidw 0;
+ret;
+.data
+.align 4
+pinned:
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 0
+.align 4
+.dword 0
+.align 4
+.dword 0
+.align 4
+.dword 0
+.align 4
+.dword 0
+.align 4
+.dword 0
+.align 4
+.dword 0
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 0
+.align 4
+.dword 1
+# ==== start of definition of function `arm_get' ====
+.text
+arm_get:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L982;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L983;
+ldidw 16;
+jmp @L984;
+@L983:
+ldidw 12;
+@L984:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw arm_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L985;
+@L982:
+# var: res, offset: 16
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L988;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L990;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L990;
+ldidw 0;
+jmp @L991;
+@L990:
+ldidw 1;
+@L991:
+jmpt @L988;
+ldidw 0;
+jmp @L989;
+@L988:
+ldidw 1;
+@L989:
+jmpt @L986;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L986;
+ldidw 0;
+jmp @L987;
+@L986:
+ldidw 1;
+@L987:
+jmpf @L992;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw arm_load;
+call 8;
+pop;
+pop;
+jmp @L993;
+@L992:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+stw;
+pop;
+@L993:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw arm_get_operand;
+call 8;
+ldbp 16;
+ldw;
+ldiqw @S579;
+ldidw 1;
+ldiqw emit_code;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L994;
+ldbp 16;
+ldw;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L995;
+ldiqw @S580;
+jmp @L996;
+@L995:
+ldiqw @S581;
+@L996:
+ldiqw @S582;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+ldbp 16;
+ldw;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L997;
+ldiqw @S583;
+jmp @L998;
+@L997:
+ldiqw @S584;
+@L998:
+ldiqw @S585;
+ldidw 1;
+ldiqw emit_code;
+call 20;
+pop;
+pop;
+@L999:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L1000:
+ldidw 0;
+jmpf @L1001;
+jmp @L999;
+@L1001:
+jmp @L1002;
+@L994:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L1002:
+@L985:
+ldidw 0;
+ret;
+.extern new_decl_list_node
+.extern compute_liveness_and_next_use
+.extern srandom
+.extern lookup_struct_descriptor
+.extern new_exec_node
+.extern get_alignment
+.extern fgetc
+.bss
+.align 8
+__temp_struct:
+.res 4
+.data
+@S0:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S1:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S2:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S3:
+.byte 108
+.byte 100
+.byte 114
+.byte 115
+.byte 104
+.byte 0
+@S4:
+.byte 108
+.byte 100
+.byte 114
+.byte 104
+.byte 0
+@S5:
+.byte 108
+.byte 100
+.byte 114
+.byte 115
+.byte 98
+.byte 0
+@S6:
+.byte 108
+.byte 100
+.byte 114
+.byte 98
+.byte 0
+@S7:
+.byte 108
+.byte 100
+.byte 114
+.byte 0
+@S8:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S9:
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S10:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 37
+.byte 115
+.byte 0
+@S11:
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S12:
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 45
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S13:
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S14:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S15:
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S16:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S17:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 45
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S18:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S19:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S20:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 45
+.byte 35
+.byte 52
+.byte 93
+.byte 33
+.byte 0
+@S21:
+.byte 115
+.byte 116
+.byte 109
+.byte 100
+.byte 98
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 33
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 125
+.byte 0
+@S22:
+.byte 115
+.byte 116
+.byte 109
+.byte 100
+.byte 98
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 33
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 50
+.byte 125
+.byte 0
+@S23:
+.byte 115
+.byte 116
+.byte 109
+.byte 100
+.byte 98
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 33
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 50
+.byte 44
+.byte 32
+.byte 114
+.byte 51
+.byte 125
+.byte 0
+@S24:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S25:
+.byte 108
+.byte 116
+.byte 0
+@S26:
+.byte 108
+.byte 111
+.byte 0
+@S27:
+.byte 109
+.byte 111
+.byte 118
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S28:
+.byte 103
+.byte 101
+.byte 0
+@S29:
+.byte 104
+.byte 115
+.byte 0
+@S30:
+.byte 109
+.byte 111
+.byte 118
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S31:
+.byte 111
+.byte 114
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S32:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S33:
+.byte 98
+.byte 101
+.byte 113
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S34:
+.byte 98
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S35:
+.byte 37
+.byte 115
+.byte 0
+@S36:
+.byte 10
+.byte 0
+@S37:
+.byte 36
+.byte 36
+.byte 100
+.byte 46
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S38:
+.byte 10
+.byte 0
+@S39:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S40:
+.byte 10
+.byte 0
+@S41:
+.byte 37
+.byte 115
+.byte 0
+@S42:
+.byte 10
+.byte 0
+@S43:
+.byte 36
+.byte 36
+.byte 100
+.byte 46
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S44:
+.byte 10
+.byte 0
+@S45:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 98
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S46:
+.byte 10
+.byte 0
+@S47:
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S48:
+.byte 10
+.byte 0
+@S49:
+.byte 46
+.byte 103
+.byte 108
+.byte 111
+.byte 98
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S50:
+.byte 10
+.byte 0
+@S51:
+.byte 36
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S52:
+.byte 10
+.byte 0
+@S53:
+.byte 46
+.byte 114
+.byte 101
+.byte 115
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S54:
+.byte 10
+.byte 0
+@S55:
+.byte 111
+.byte 114
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S56:
+.byte 111
+.byte 114
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S57:
+.byte 111
+.byte 114
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S58:
+.byte 101
+.byte 111
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S59:
+.byte 101
+.byte 111
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S60:
+.byte 101
+.byte 111
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S61:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 93
+.byte 44
+.byte 32
+.byte 35
+.byte 52
+.byte 0
+@S62:
+.byte 108
+.byte 100
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 33
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 125
+.byte 0
+@S63:
+.byte 108
+.byte 100
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 33
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 50
+.byte 125
+.byte 0
+@S64:
+.byte 108
+.byte 100
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 33
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 50
+.byte 44
+.byte 32
+.byte 114
+.byte 51
+.byte 125
+.byte 0
+@S65:
+.byte 115
+.byte 120
+.byte 116
+.byte 104
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S66:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 50
+.byte 0
+@S67:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 93
+.byte 0
+@S68:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 52
+.byte 93
+.byte 0
+@S69:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S70:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 56
+.byte 93
+.byte 0
+@S71:
+.byte 98
+.byte 108
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S72:
+.byte 115
+.byte 116
+.byte 114
+.byte 104
+.byte 0
+@S73:
+.byte 115
+.byte 116
+.byte 114
+.byte 98
+.byte 0
+@S74:
+.byte 115
+.byte 116
+.byte 114
+.byte 0
+@S75:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S76:
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S77:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 37
+.byte 115
+.byte 0
+@S78:
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S79:
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 45
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S80:
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S81:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S82:
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S83:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 45
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S84:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S85:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S86:
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S87:
+.byte 109
+.byte 118
+.byte 110
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S88:
+.byte 109
+.byte 118
+.byte 110
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S89:
+.byte 109
+.byte 118
+.byte 110
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S90:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S91:
+.byte 108
+.byte 101
+.byte 0
+@S92:
+.byte 108
+.byte 115
+.byte 0
+@S93:
+.byte 109
+.byte 111
+.byte 118
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S94:
+.byte 103
+.byte 116
+.byte 0
+@S95:
+.byte 104
+.byte 105
+.byte 0
+@S96:
+.byte 109
+.byte 111
+.byte 118
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S97:
+.byte 114
+.byte 37
+.byte 100
+.byte 32
+.byte 61
+.byte 62
+.byte 32
+.byte 37
+.byte 115
+.byte 10
+.byte 0
+@S98:
+.byte 117
+.byte 120
+.byte 116
+.byte 98
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S99:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 35
+.byte 48
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 10
+.byte 0
+@S100:
+.byte 46
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 35
+.byte 48
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 10
+.byte 0
+@S101:
+.byte 10
+.byte 0
+@S102:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 114
+.byte 101
+.byte 103
+.byte 48
+.byte 0
+@S103:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S104:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S105:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 114
+.byte 101
+.byte 103
+.byte 48
+.byte 0
+@S106:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S107:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S108:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 114
+.byte 101
+.byte 103
+.byte 48
+.byte 0
+@S109:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S110:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S111:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 114
+.byte 101
+.byte 103
+.byte 48
+.byte 0
+@S112:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S113:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S114:
+.byte 98
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S115:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 114
+.byte 48
+.byte 0
+@S116:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 53
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 0
+@S117:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 114
+.byte 48
+.byte 0
+@S118:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 100
+.byte 105
+.byte 118
+.byte 51
+.byte 50
+.byte 0
+@S119:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 100
+.byte 105
+.byte 118
+.byte 51
+.byte 50
+.byte 0
+@S120:
+.byte 98
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S121:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 48
+.byte 0
+@S122:
+.byte 37
+.byte 115
+.byte 32
+.byte 61
+.byte 62
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 58
+.byte 36
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S123:
+.byte 37
+.byte 115
+.byte 32
+.byte 61
+.byte 62
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S124:
+.byte 117
+.byte 120
+.byte 116
+.byte 104
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S125:
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 0
+@S126:
+.byte 98
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S127:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S128:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S129:
+.byte 98
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 115
+.byte 119
+.byte 54
+.byte 52
+.byte 76
+.byte 37
+.byte 117
+.byte 0
+@S130:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S131:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S132:
+.byte 98
+.byte 101
+.byte 113
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S133:
+.byte 37
+.byte 115
+.byte 64
+.byte 115
+.byte 119
+.byte 54
+.byte 52
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S134:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 65
+.byte 83
+.byte 82
+.byte 32
+.byte 35
+.byte 51
+.byte 49
+.byte 0
+@S135:
+.byte 10
+.byte 0
+@S136:
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 61
+.byte 61
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 114
+.byte 116
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 61
+.byte 61
+.byte 61
+.byte 61
+.byte 0
+@S137:
+.byte 10
+.byte 0
+@S138:
+.byte 37
+.byte 115
+.byte 0
+@S139:
+.byte 10
+.byte 0
+@S140:
+.byte 36
+.byte 36
+.byte 97
+.byte 46
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S141:
+.byte 10
+.byte 0
+@S142:
+.byte 46
+.byte 103
+.byte 108
+.byte 111
+.byte 98
+.byte 97
+.byte 108
+.byte 32
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S143:
+.byte 10
+.byte 0
+@S144:
+.byte 36
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S145:
+.byte 10
+.byte 0
+@S146:
+.byte 59
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S147:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 45
+.byte 35
+.byte 37
+.byte 117
+.byte 93
+.byte 10
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S148:
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 95
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S149:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S150:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S151:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S152:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 10
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S153:
+.byte 115
+.byte 116
+.byte 109
+.byte 100
+.byte 98
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 33
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 50
+.byte 44
+.byte 32
+.byte 114
+.byte 51
+.byte 125
+.byte 0
+@S154:
+.byte 10
+.byte 0
+@S155:
+.byte 115
+.byte 116
+.byte 109
+.byte 100
+.byte 98
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 33
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 52
+.byte 125
+.byte 0
+@S156:
+.byte 10
+.byte 0
+@S157:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 0
+@S158:
+.byte 10
+.byte 0
+@S159:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 0
+@S160:
+.byte 10
+.byte 0
+@S161:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S162:
+.byte 10
+.byte 0
+@S163:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S164:
+.byte 10
+.byte 0
+@S165:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 0
+@S166:
+.byte 10
+.byte 0
+@S167:
+.byte 108
+.byte 100
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 33
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 52
+.byte 125
+.byte 0
+@S168:
+.byte 10
+.byte 0
+@S169:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 54
+.byte 0
+@S170:
+.byte 10
+.byte 0
+@S171:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 49
+.byte 53
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 52
+.byte 0
+@S172:
+.byte 10
+.byte 0
+@S173:
+.byte 46
+.byte 108
+.byte 116
+.byte 111
+.byte 114
+.byte 103
+.byte 0
+@S174:
+.byte 10
+.byte 0
+@S175:
+.byte 46
+.byte 122
+.byte 101
+.byte 114
+.byte 111
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S176:
+.byte 10
+.byte 0
+@S177:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S178:
+.byte 10
+.byte 0
+@S179:
+.byte 46
+.byte 122
+.byte 101
+.byte 114
+.byte 111
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S180:
+.byte 10
+.byte 0
+@S181:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S182:
+.byte 10
+.byte 0
+@S183:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S184:
+.byte 10
+.byte 0
+@S185:
+.byte 46
+.byte 122
+.byte 101
+.byte 114
+.byte 111
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S186:
+.byte 10
+.byte 0
+@S187:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S188:
+.byte 10
+.byte 0
+@S189:
+.byte 46
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 0
+@S190:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 35
+.byte 50
+.byte 0
+@S191:
+.byte 10
+.byte 0
+@S192:
+.byte 46
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 0
+@S193:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 35
+.byte 56
+.byte 0
+@S194:
+.byte 10
+.byte 0
+@S195:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 0
+@S196:
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S197:
+.byte 10
+.byte 0
+@S198:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 0
+@S199:
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S200:
+.byte 10
+.byte 0
+@S201:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 35
+.byte 52
+.byte 0
+@S202:
+.byte 10
+.byte 0
+@S203:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 0
+@S204:
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S205:
+.byte 10
+.byte 0
+@S206:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S207:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 109
+.byte 117
+.byte 108
+.byte 54
+.byte 52
+.byte 0
+@S208:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 100
+.byte 105
+.byte 118
+.byte 54
+.byte 52
+.byte 0
+@S209:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 100
+.byte 105
+.byte 118
+.byte 54
+.byte 52
+.byte 0
+@S210:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 109
+.byte 111
+.byte 100
+.byte 54
+.byte 52
+.byte 0
+@S211:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 109
+.byte 111
+.byte 100
+.byte 54
+.byte 52
+.byte 0
+@S212:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 104
+.byte 108
+.byte 54
+.byte 52
+.byte 0
+@S213:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 115
+.byte 104
+.byte 114
+.byte 54
+.byte 52
+.byte 0
+@S214:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 115
+.byte 104
+.byte 114
+.byte 54
+.byte 52
+.byte 0
+@S215:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S216:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S217:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S218:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S219:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S220:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S221:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S222:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S223:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S224:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S225:
+.byte 109
+.byte 117
+.byte 108
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S226:
+.byte 108
+.byte 100
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 125
+.byte 0
+@S227:
+.byte 108
+.byte 100
+.byte 114
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S228:
+.byte 108
+.byte 100
+.byte 114
+.byte 104
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S229:
+.byte 108
+.byte 100
+.byte 114
+.byte 115
+.byte 98
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S230:
+.byte 108
+.byte 100
+.byte 114
+.byte 98
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S231:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S232:
+.byte 97
+.byte 100
+.byte 100
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S233:
+.byte 97
+.byte 100
+.byte 99
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S234:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S235:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 109
+.byte 111
+.byte 100
+.byte 51
+.byte 50
+.byte 0
+@S236:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 109
+.byte 111
+.byte 100
+.byte 51
+.byte 50
+.byte 0
+@S237:
+.byte 98
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S238:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 48
+.byte 0
+@S239:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 50
+.byte 0
+@S240:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 35
+.byte 56
+.byte 93
+.byte 0
+@S241:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 93
+.byte 0
+@S242:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 52
+.byte 93
+.byte 0
+@S243:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S244:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 56
+.byte 93
+.byte 0
+@S245:
+.byte 98
+.byte 108
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S246:
+.byte 108
+.byte 100
+.byte 114
+.byte 98
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 48
+.byte 93
+.byte 0
+@S247:
+.byte 108
+.byte 100
+.byte 114
+.byte 104
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 48
+.byte 93
+.byte 0
+@S248:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 48
+.byte 93
+.byte 0
+@S249:
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S250:
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S251:
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S252:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S253:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S254:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S255:
+.byte 98
+.byte 103
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S256:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S257:
+.byte 98
+.byte 108
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S258:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S259:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S260:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S261:
+.byte 98
+.byte 108
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S262:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S263:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 64
+.byte 106
+.byte 116
+.byte 37
+.byte 100
+.byte 0
+@S264:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 49
+.byte 53
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 76
+.byte 83
+.byte 76
+.byte 32
+.byte 35
+.byte 50
+.byte 93
+.byte 0
+@S265:
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S266:
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S267:
+.byte 46
+.byte 108
+.byte 116
+.byte 111
+.byte 114
+.byte 103
+.byte 0
+@S268:
+.byte 37
+.byte 115
+.byte 0
+@S269:
+.byte 36
+.byte 36
+.byte 100
+.byte 46
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S270:
+.byte 64
+.byte 106
+.byte 116
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S271:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S272:
+.byte 37
+.byte 115
+.byte 0
+@S273:
+.byte 36
+.byte 36
+.byte 97
+.byte 46
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S274:
+.byte 98
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S275:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S276:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S277:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S278:
+.byte 98
+.byte 101
+.byte 113
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S279:
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 50
+.byte 0
+@S280:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S281:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S282:
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S283:
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S284:
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S285:
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S286:
+.byte 46
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S287:
+.byte 46
+.byte 116
+.byte 101
+.byte 120
+.byte 116
+.byte 0
+@S288:
+.byte 46
+.byte 98
+.byte 115
+.byte 115
+.byte 0
+@S289:
+.byte 46
+.byte 114
+.byte 111
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S290:
+.byte 114
+.byte 115
+.byte 98
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S291:
+.byte 114
+.byte 115
+.byte 99
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S292:
+.byte 114
+.byte 115
+.byte 98
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S293:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S294:
+.byte 109
+.byte 111
+.byte 118
+.byte 110
+.byte 101
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S295:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 113
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S296:
+.byte 59
+.byte 32
+.byte 115
+.byte 97
+.byte 118
+.byte 101
+.byte 32
+.byte 114
+.byte 101
+.byte 103
+.byte 105
+.byte 115
+.byte 116
+.byte 101
+.byte 114
+.byte 115
+.byte 0
+@S297:
+.byte 10
+.byte 0
+@S298:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 0
+@S299:
+.byte 10
+.byte 0
+@S300:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S301:
+.byte 10
+.byte 0
+@S302:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S303:
+.byte 10
+.byte 0
+@S304:
+.byte 115
+.byte 116
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 52
+.byte 0
+@S305:
+.byte 59
+.byte 32
+.byte 114
+.byte 101
+.byte 115
+.byte 116
+.byte 111
+.byte 114
+.byte 101
+.byte 32
+.byte 114
+.byte 101
+.byte 103
+.byte 105
+.byte 115
+.byte 116
+.byte 101
+.byte 114
+.byte 115
+.byte 0
+@S306:
+.byte 10
+.byte 0
+@S307:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 0
+@S308:
+.byte 10
+.byte 0
+@S309:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S310:
+.byte 10
+.byte 0
+@S311:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S312:
+.byte 10
+.byte 0
+@S313:
+.byte 108
+.byte 100
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 52
+.byte 0
+@S314:
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S315:
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S316:
+.byte 125
+.byte 0
+@S317:
+.byte 10
+.byte 0
+@S318:
+.byte 125
+.byte 0
+@S319:
+.byte 10
+.byte 0
+@S320:
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S321:
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S322:
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S323:
+.byte 10
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 32
+.byte 111
+.byte 98
+.byte 106
+.byte 101
+.byte 99
+.byte 116
+.byte 115
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 32
+.byte 100
+.byte 117
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S324:
+.byte 10
+.byte 0
+@S325:
+.byte 10
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 32
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 115
+.byte 121
+.byte 109
+.byte 98
+.byte 111
+.byte 108
+.byte 115
+.byte 0
+@S326:
+.byte 10
+.byte 0
+@S327:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S328:
+.byte 10
+.byte 0
+@S329:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S330:
+.byte 10
+.byte 0
+@S331:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 109
+.byte 101
+.byte 109
+.byte 115
+.byte 101
+.byte 116
+.byte 0
+@S332:
+.byte 10
+.byte 0
+@S333:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S334:
+.byte 10
+.byte 0
+@S335:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 109
+.byte 117
+.byte 108
+.byte 54
+.byte 52
+.byte 0
+@S336:
+.byte 10
+.byte 0
+@S337:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 100
+.byte 105
+.byte 118
+.byte 54
+.byte 52
+.byte 0
+@S338:
+.byte 10
+.byte 0
+@S339:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 100
+.byte 105
+.byte 118
+.byte 54
+.byte 52
+.byte 0
+@S340:
+.byte 10
+.byte 0
+@S341:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 109
+.byte 111
+.byte 100
+.byte 54
+.byte 52
+.byte 0
+@S342:
+.byte 10
+.byte 0
+@S343:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 109
+.byte 111
+.byte 100
+.byte 54
+.byte 52
+.byte 0
+@S344:
+.byte 10
+.byte 0
+@S345:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 104
+.byte 108
+.byte 54
+.byte 52
+.byte 0
+@S346:
+.byte 10
+.byte 0
+@S347:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 115
+.byte 104
+.byte 114
+.byte 54
+.byte 52
+.byte 0
+@S348:
+.byte 10
+.byte 0
+@S349:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 115
+.byte 104
+.byte 114
+.byte 54
+.byte 52
+.byte 0
+@S350:
+.byte 10
+.byte 0
+@S351:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S352:
+.byte 10
+.byte 0
+@S353:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S354:
+.byte 10
+.byte 0
+@S355:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 100
+.byte 105
+.byte 118
+.byte 51
+.byte 50
+.byte 0
+@S356:
+.byte 10
+.byte 0
+@S357:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 100
+.byte 105
+.byte 118
+.byte 51
+.byte 50
+.byte 0
+@S358:
+.byte 10
+.byte 0
+@S359:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 109
+.byte 111
+.byte 100
+.byte 51
+.byte 50
+.byte 0
+@S360:
+.byte 10
+.byte 0
+@S361:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 109
+.byte 111
+.byte 100
+.byte 51
+.byte 50
+.byte 0
+@S362:
+.byte 10
+.byte 0
+@S363:
+.byte 10
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 108
+.byte 105
+.byte 116
+.byte 101
+.byte 114
+.byte 97
+.byte 108
+.byte 115
+.byte 10
+.byte 0
+@S364:
+.byte 46
+.byte 114
+.byte 111
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 10
+.byte 0
+@S365:
+.byte 36
+.byte 36
+.byte 100
+.byte 46
+.byte 37
+.byte 100
+.byte 58
+.byte 10
+.byte 0
+@S366:
+.byte 98
+.byte 32
+.byte 95
+.byte 95
+.byte 99
+.byte 111
+.byte 100
+.byte 101
+.byte 95
+.byte 99
+.byte 111
+.byte 110
+.byte 116
+.byte 64
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S367:
+.byte 46
+.byte 108
+.byte 116
+.byte 111
+.byte 114
+.byte 103
+.byte 10
+.byte 0
+@S368:
+.byte 36
+.byte 36
+.byte 97
+.byte 46
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S369:
+.byte 95
+.byte 95
+.byte 99
+.byte 111
+.byte 100
+.byte 101
+.byte 95
+.byte 99
+.byte 111
+.byte 110
+.byte 116
+.byte 64
+.byte 37
+.byte 100
+.byte 58
+.byte 10
+.byte 0
+@S370:
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 0
+@S371:
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 97
+.byte 114
+.byte 103
+.byte 0
+@S372:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S373:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S374:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S375:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S376:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 52
+.byte 0
+@S377:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S378:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S379:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S380:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S381:
+.byte 108
+.byte 100
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 125
+.byte 0
+@S382:
+.byte 108
+.byte 100
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 125
+.byte 0
+@S383:
+.byte 108
+.byte 100
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 125
+.byte 0
+@S384:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S385:
+.byte 108
+.byte 100
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 125
+.byte 0
+@S386:
+.byte 108
+.byte 100
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 125
+.byte 0
+@S387:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 50
+.byte 0
+@S388:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 0
+@S389:
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 97
+.byte 114
+.byte 103
+.byte 0
+@S390:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S391:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S392:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 52
+.byte 93
+.byte 0
+@S393:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 0
+@S394:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 93
+.byte 0
+@S395:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S396:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 56
+.byte 93
+.byte 0
+@S397:
+.byte 98
+.byte 108
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S398:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 50
+.byte 0
+@S399:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 0
+@S400:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S401:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S402:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 93
+.byte 0
+@S403:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 52
+.byte 93
+.byte 0
+@S404:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S405:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 56
+.byte 93
+.byte 0
+@S406:
+.byte 98
+.byte 108
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S407:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S408:
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 97
+.byte 114
+.byte 103
+.byte 0
+@S409:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S410:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S411:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S412:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 113
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S413:
+.byte 109
+.byte 111
+.byte 118
+.byte 110
+.byte 101
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S414:
+.byte 98
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S415:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 114
+.byte 48
+.byte 0
+@S416:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 53
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 0
+@S417:
+.byte 98
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S418:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 114
+.byte 48
+.byte 0
+@S419:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 53
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 0
+@S420:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 50
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S421:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S422:
+.byte 98
+.byte 108
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S423:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S424:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 113
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S425:
+.byte 109
+.byte 111
+.byte 118
+.byte 110
+.byte 101
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S426:
+.byte 98
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S427:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S428:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 113
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S429:
+.byte 109
+.byte 111
+.byte 118
+.byte 110
+.byte 101
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S430:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S431:
+.byte 109
+.byte 111
+.byte 118
+.byte 110
+.byte 101
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S432:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 113
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S433:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 35
+.byte 52
+.byte 0
+@S434:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 113
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S435:
+.byte 109
+.byte 111
+.byte 118
+.byte 110
+.byte 101
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S436:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 35
+.byte 50
+.byte 0
+@S437:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 113
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S438:
+.byte 109
+.byte 111
+.byte 118
+.byte 110
+.byte 101
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S439:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 35
+.byte 52
+.byte 0
+@S440:
+.byte 109
+.byte 111
+.byte 118
+.byte 110
+.byte 101
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S441:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 113
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S442:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 48
+.byte 44
+.byte 32
+.byte 35
+.byte 50
+.byte 0
+@S443:
+.byte 109
+.byte 111
+.byte 118
+.byte 110
+.byte 101
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S444:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 113
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S445:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S446:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 37
+.byte 115
+.byte 0
+@S447:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S448:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S449:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S450:
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 95
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 0
+@S451:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S452:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S453:
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S454:
+.byte 10
+.byte 0
+@S455:
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 43
+.byte 0
+@S456:
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 43
+.byte 0
+@S457:
+.byte 37
+.byte 115
+.byte 43
+.byte 0
+@S458:
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 95
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 0
+@S459:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S460:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S461:
+.byte 98
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S462:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S463:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S464:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S465:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 52
+.byte 93
+.byte 0
+@S466:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S467:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S468:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S469:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 52
+.byte 93
+.byte 0
+@S470:
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 105
+.byte 110
+.byte 100
+.byte 95
+.byte 97
+.byte 115
+.byte 110
+.byte 0
+@S471:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S472:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S473:
+.byte 115
+.byte 116
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 125
+.byte 0
+@S474:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 50
+.byte 0
+@S475:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 93
+.byte 0
+@S476:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 52
+.byte 93
+.byte 0
+@S477:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S478:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 51
+.byte 44
+.byte 32
+.byte 35
+.byte 56
+.byte 93
+.byte 0
+@S479:
+.byte 98
+.byte 108
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S480:
+.byte 115
+.byte 116
+.byte 114
+.byte 104
+.byte 0
+@S481:
+.byte 115
+.byte 116
+.byte 114
+.byte 98
+.byte 0
+@S482:
+.byte 115
+.byte 116
+.byte 114
+.byte 0
+@S483:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S484:
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S485:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S486:
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S487:
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S488:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 76
+.byte 83
+.byte 76
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S489:
+.byte 76
+.byte 83
+.byte 82
+.byte 0
+@S490:
+.byte 65
+.byte 83
+.byte 82
+.byte 0
+@S491:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S492:
+.byte 98
+.byte 108
+.byte 120
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S493:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 114
+.byte 48
+.byte 0
+@S494:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 53
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 0
+@S495:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 52
+.byte 44
+.byte 32
+.byte 114
+.byte 48
+.byte 0
+@S496:
+.byte 100
+.byte 111
+.byte 95
+.byte 114
+.byte 101
+.byte 108
+.byte 111
+.byte 112
+.byte 95
+.byte 106
+.byte 117
+.byte 109
+.byte 112
+.byte 0
+@S497:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S498:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S499:
+.byte 98
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S500:
+.byte 98
+.byte 101
+.byte 113
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S501:
+.byte 98
+.byte 103
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S502:
+.byte 98
+.byte 104
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S503:
+.byte 98
+.byte 103
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S504:
+.byte 98
+.byte 104
+.byte 105
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S505:
+.byte 98
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S506:
+.byte 98
+.byte 108
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S507:
+.byte 98
+.byte 108
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S508:
+.byte 98
+.byte 108
+.byte 111
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S509:
+.byte 98
+.byte 101
+.byte 113
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S510:
+.byte 98
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S511:
+.byte 98
+.byte 108
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S512:
+.byte 98
+.byte 108
+.byte 111
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S513:
+.byte 98
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S514:
+.byte 98
+.byte 108
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S515:
+.byte 98
+.byte 103
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S516:
+.byte 98
+.byte 104
+.byte 105
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S517:
+.byte 98
+.byte 103
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S518:
+.byte 98
+.byte 104
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S519:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S520:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S521:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S522:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S523:
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 108
+.byte 111
+.byte 97
+.byte 100
+.byte 50
+.byte 0
+@S524:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S525:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S526:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S527:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S528:
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 108
+.byte 111
+.byte 97
+.byte 100
+.byte 50
+.byte 0
+@S529:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S530:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S531:
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 108
+.byte 111
+.byte 97
+.byte 100
+.byte 50
+.byte 0
+@S532:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S533:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S534:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S535:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 37
+.byte 115
+.byte 0
+@S536:
+.byte 108
+.byte 100
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 125
+.byte 0
+@S537:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 45
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S538:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 45
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S539:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S540:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S541:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S542:
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 108
+.byte 111
+.byte 97
+.byte 100
+.byte 50
+.byte 0
+@S543:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S544:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S545:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S546:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 45
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S547:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 45
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S548:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S549:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 0
+@S550:
+.byte 108
+.byte 100
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 125
+.byte 0
+@S551:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S552:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 37
+.byte 115
+.byte 0
+@S553:
+.byte 115
+.byte 116
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 125
+.byte 0
+@S554:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 45
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S555:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 45
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S556:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S557:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S558:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 45
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S559:
+.byte 115
+.byte 116
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 45
+.byte 35
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S560:
+.byte 108
+.byte 100
+.byte 114
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 61
+.byte 35
+.byte 37
+.byte 117
+.byte 0
+@S561:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 0
+@S562:
+.byte 115
+.byte 116
+.byte 109
+.byte 105
+.byte 97
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 123
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 125
+.byte 0
+@S563:
+.byte 115
+.byte 117
+.byte 98
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S564:
+.byte 115
+.byte 98
+.byte 99
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S565:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S566:
+.byte 115
+.byte 120
+.byte 116
+.byte 98
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 0
+@S567:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S568:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 113
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S569:
+.byte 109
+.byte 111
+.byte 118
+.byte 110
+.byte 101
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S570:
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S571:
+.byte 10
+.byte 0
+@S572:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S573:
+.byte 103
+.byte 116
+.byte 0
+@S574:
+.byte 104
+.byte 105
+.byte 0
+@S575:
+.byte 109
+.byte 111
+.byte 118
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S576:
+.byte 108
+.byte 101
+.byte 0
+@S577:
+.byte 108
+.byte 115
+.byte 0
+@S578:
+.byte 109
+.byte 111
+.byte 118
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
+@S579:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S580:
+.byte 103
+.byte 101
+.byte 0
+@S581:
+.byte 104
+.byte 115
+.byte 0
+@S582:
+.byte 109
+.byte 111
+.byte 118
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 49
+.byte 0
+@S583:
+.byte 108
+.byte 116
+.byte 0
+@S584:
+.byte 108
+.byte 111
+.byte 0
+@S585:
+.byte 109
+.byte 111
+.byte 118
+.byte 37
+.byte 115
+.byte 32
+.byte 114
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 35
+.byte 48
+.byte 0
@@ -0,0 +1,22313 @@
+; ==== start of definition of function `arm_load' ====
+segment .text
+$arm_load:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+push rbx
+.L0:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+jne .L3
+.L2:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+movsx rax, word [rbp+-8]
+push rax
+mov rax, _@S0
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L4
+.L3:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 1
+jne .L6
+.L5:
+mov eax, dword [rbp+-16]
+push rax
+mov rdi, [rsp+0]
+call $new_string_literal
+add rsp, 8
+push rax
+movsx rax, word [rbp+-8]
+push rax
+mov rax, _@S1
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L7
+.L6:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 2
+jne .L9
+.L8:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L12
+.L11:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+movsx rbx, word [rbp+-8]
+cmp eax, ebx
+jne .L14
+.L13:
+jmp .L15
+.L14:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+push rax
+movsx rax, word [rbp+-8]
+push rax
+mov rax, _@S2
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L15:
+jmp .L1
+.L12:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+add rbx, 8
+mov rbx, qword [rbx]
+mov rax, rbx
+add rax, 72
+mov qword [rbp+-32], rbx
+push rax
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 107
+je .L21
+cmp eax, 49
+je .L20
+cmp eax, 106
+je .L20
+cmp eax, 108
+je .L19
+cmp eax, 64
+je .L18
+cmp eax, 68
+je .L17
+cmp eax, 71
+je .L17
+cmp eax, 97
+je .L17
+cmp eax, 98
+je .L17
+jmp .L22
+.L17:
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load_addr
+add rsp, 16
+jmp .L1
+.L18:
+mov rax, _@S3
+mov qword [rbp+-40], rax
+mov rax, 255
+mov dword [rbp+-44], eax
+jmp .L16
+.L19:
+mov rax, _@S4
+mov qword [rbp+-40], rax
+mov rax, 255
+mov dword [rbp+-44], eax
+jmp .L16
+.L20:
+mov rax, _@S5
+mov qword [rbp+-40], rax
+mov rax, 255
+mov dword [rbp+-44], eax
+jmp .L16
+.L21:
+mov rax, _@S6
+mov qword [rbp+-40], rax
+mov rax, 4095
+mov dword [rbp+-44], eax
+jmp .L16
+.L22:
+mov rax, _@S7
+mov qword [rbp+-40], rax
+mov rax, 4095
+mov dword [rbp+-44], eax
+.L16:
+mov rax, qword [rbp+-32]
+add rax, 56
+add rax, 13
+movsx rax, byte [rax]
+cmp eax, 1
+jne .L24
+.L23:
+mov rax, qword [rbp+-32]
+add rax, 56
+add rax, 12
+movsx rax, byte [rax]
+cmp eax, 2
+jne .L27
+.L26:
+mov rax, qword [rbp+-32]
+add rax, 56
+mov rax, qword [rax]
+push rax
+push qword [$curr_func]
+movsx rax, word [rbp+-8]
+push rax
+mov rax, _@S8
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+movsx rax, word [rbp+-8]
+push rax
+movsx rax, word [rbp+-8]
+push rax
+push qword [rbp+-40]
+mov rax, _@S9
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+jmp .L28
+.L27:
+mov rax, qword [rbp+-32]
+add rax, 56
+mov rax, qword [rax]
+push rax
+movsx rax, word [rbp+-8]
+push rax
+mov rax, _@S10
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, word [rbp+-8]
+push rax
+movsx rax, word [rbp+-8]
+push rax
+push qword [rbp+-40]
+mov rax, _@S11
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+.L28:
+jmp .L25
+.L24:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+add rbx, 16
+movsx rbx, dword [rbx]
+cmp ebx, 0
+mov dword [rbp+-20], ebx
+jge .L30
+.L29:
+movsx rax, dword [rbp+-44]
+neg eax
+movsx rbx, dword [rbp+-20]
+cmp ebx, eax
+jl .L33
+.L32:
+movsx rax, dword [rbp+-20]
+neg eax
+push rax
+movsx rax, word [rbp+-8]
+push rax
+push qword [rbp+-40]
+mov rax, _@S12
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+jmp .L1
+.L33:
+jmp .L31
+.L30:
+movsx rax, dword [rbp+-20]
+cmp eax, dword [rbp+-44]
+jg .L35
+.L34:
+movsx rax, dword [rbp+-20]
+push rax
+movsx rax, word [rbp+-8]
+push rax
+push qword [rbp+-40]
+mov rax, _@S13
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+jmp .L1
+.L35:
+.L31:
+movsx rax, dword [rbp+-20]
+push rax
+push 12
+mov rax, _@S14
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+movsx rax, word [rbp+-8]
+push rax
+push qword [rbp+-40]
+mov rax, _@S15
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+.L25:
+jmp .L10
+.L9:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 3
+jne .L37
+.L36:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L39
+.L38:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+movsx rbx, word [rbp+-8]
+cmp eax, ebx
+jne .L42
+.L41:
+jmp .L1
+jmp .L43
+.L42:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+push rax
+movsx rax, word [rbp+-8]
+push rax
+mov rax, _@S16
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L43:
+jmp .L40
+.L39:
+mov eax, dword [rbp+-16]
+push rax
+mov rdi, [rsp+0]
+call $get_temp_offs
+add rsp, 8
+mov rbx, -4095
+cmp eax, ebx
+mov dword [rbp+-20], eax
+jl .L45
+.L44:
+movsx rax, dword [rbp+-20]
+neg eax
+push rax
+movsx rax, word [rbp+-8]
+push rax
+mov rax, _@S17
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L46
+.L45:
+movsx rax, dword [rbp+-20]
+push rax
+push 12
+mov rax, _@S18
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+movsx rax, word [rbp+-8]
+push rax
+mov rax, _@S19
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L46:
+.L40:
+.L37:
+.L10:
+.L7:
+.L4:
+.L1:
+.L47:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_save_arg_regs' ====
+$arm_save_arg_regs:
+push rbp
+mov rbp, rsp
+push rbx
+.L0:
+movsx rax, dword [$arg_offs]
+cdq
+mov rbx, 4
+idiv ebx
+mov rbx, 0
+mov rcx, 3
+cmp rax, rbx
+jl .L7
+cmp rax, rcx
+jg .L7
+jmp [rax*8+.jt0]
+segment .rodata
+.jt0:
+dq .L3
+dq .L4
+dq .L5
+dq .L6
+segment .text
+.L3:
+jmp .L2
+.L4:
+mov rax, _@S20
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L2
+.L5:
+mov rax, _@S21
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L2
+.L6:
+mov rax, _@S22
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L2
+.L7:
+mov rax, _@S23
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+.L2:
+.L1:
+.L8:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_begarg' ====
+$arm_begarg:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+.L0:
+.L1:
+.L2:
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_lt' ====
+$arm_lt:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+mov rax, 2
+mov rcx, rbx
+and rcx, rax
+mov qword [rbp+-40], rbx
+cmp rcx, 0
+je .L3
+.L2:
+mov rax, 1
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L6
+.L5:
+mov rax, 14
+mov qword [rbp+-56], rax
+jmp .L7
+.L6:
+mov rax, 10
+mov qword [rbp+-56], rax
+.L7:
+push qword [rbp+-56]
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $arm_do_libcall
+add rsp, 40
+jmp .L4
+.L3:
+mov rax, 4
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+jne .L8
+.L12:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+je .L8
+.L13:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 1
+je .L8
+.L11:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+jne .L9
+.L8:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-42], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+jmp .L10
+.L9:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov word [rbp+-42], ax
+.L10:
+mov rax, $pinned
+movsx rbx, word [rbp+-42]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+push 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_get_operand
+add rsp, 16
+push rax
+movsx rax, word [rbp+-42]
+push rax
+mov rax, _@S24
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov rax, $pinned
+movsx rbx, word [rbp+-42]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+mov rax, 4
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L15
+.L14:
+movsx rax, word [rbp+-42]
+push rax
+mov rax, 1
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L18
+.L17:
+mov rax, _@S25
+mov qword [rbp+-56], rax
+jmp .L19
+.L18:
+mov rax, _@S26
+mov qword [rbp+-56], rax
+.L19:
+push qword [rbp+-56]
+mov rax, _@S27
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, word [rbp+-42]
+push rax
+mov rax, 1
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L21
+.L20:
+mov rax, _@S28
+mov qword [rbp+-56], rax
+jmp .L22
+.L21:
+mov rax, _@S29
+mov qword [rbp+-56], rax
+.L22:
+push qword [rbp+-56]
+mov rax, _@S30
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L25:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-42]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L23:
+.L24:
+jmp .L16
+.L15:
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+push qword [rbp+-40]
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $do_relop_jump
+add rsp, 40
+.L16:
+.L4:
+.L1:
+.L26:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_cbr' ====
+$arm_cbr:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg2
+add rsp, 8
+mov [rbp+-56], rax
+lea rax, [rbp+-56]                             
+mov ebx, dword [rbp+-24]
+push rbx
+sub rsp, 8
+mov rsi, rax
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rsi, rax
+lea rdi, [rbp+-42]
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+lea rax, [rbp+-42]
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-42]
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-42]
+movsx rax, word [rax]
+push rax
+mov rax, _@S31
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+lea rax, [rbp+-42]
+movsx rax, word [rax]
+mov word [rbp+-38], ax
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+.L4:
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S32
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+add eax, 1
+movsx rax, eax
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 16
+mov ebx, dword [rbx]
+mov ebx, ebx
+sal rbx, 5
+mov rax, qword [$ic_addresses]
+add rax, rbx
+add rax, 8
+mov rax, qword [rax]
+mov ebx, dword [rbp+-16]
+sal rbx, 5
+mov rcx, qword [$ic_addresses]
+add rcx, rbx
+add rcx, 8
+mov rcx, qword [rcx]
+cmp rcx, rax
+jne .L7
+.L6:
+mov eax, dword [rbp+-32]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+push qword [$curr_func]
+mov rax, _@S33
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L8
+.L7:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+push qword [$curr_func]
+mov rax, _@S34
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L8:
+.L1:
+.L9:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_allocate_static_objects' ====
+$arm_allocate_static_objects:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+push rbx
+.L0:
+mov rax, qword [$static_objects_list]
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-8], rax
+je .L4
+.L2:
+mov rax, qword [rbp+-8]
+mov rax, qword [rax]
+lea rbx, [rbp+-32]
+mov qword [rbx], rax
+mov rax, qword [rbp+-8]
+add rax, 8
+mov rax, qword [rax]
+add rax, 24
+mov rax, qword [rax]
+lea rbx, [rbp+-32]
+add rbx, 8
+mov qword [rbx], rax
+mov rax, qword [rbp+-8]
+add rax, 8
+mov rax, qword [rax]
+add rax, 16
+mov rax, qword [rax]
+lea rbx, [rbp+-32]
+push rbx
+mov qword [rbp+-40], rax
+mov rdi, [rsp+0]
+call $get_alignment
+add rsp, 8
+mov dword [rbp+-12], eax
+mov rax, 0
+mov rbx, qword [rbp+-40]
+cmp rbx, rax
+je .L6
+.L5:
+movsx rax, dword [$curr_segment]
+cmp eax, 0
+je .L11
+.L10:
+mov rax, 0
+mov rbx, $str_segment
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S35
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S36
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, 0
+mov dword [$curr_segment], eax
+.L11:
+.L8:
+.L9:
+movsx rax, dword [$d_mapsym_counter]
+mov rbx, rax
+add ebx, 1
+mov dword [$d_mapsym_counter], ebx
+push rax
+mov rax, _@S37
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S38
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov eax, dword [rbp+-12]
+cmp eax, 1
+jbe .L13
+.L12:
+mov eax, dword [rbp+-12]
+push rax
+mov rax, _@S39
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S40
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L13:
+jmp .L7
+.L6:
+movsx rax, dword [$curr_segment]
+cmp eax, 2
+je .L17
+.L16:
+mov rax, 2
+mov rbx, $str_segment
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S41
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S42
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, 2
+mov dword [$curr_segment], eax
+.L17:
+.L14:
+.L15:
+movsx rax, dword [$d_mapsym_counter]
+mov rbx, rax
+add ebx, 1
+mov dword [$d_mapsym_counter], ebx
+push rax
+mov rax, _@S43
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S44
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov eax, dword [rbp+-12]
+cmp eax, 1
+jbe .L19
+.L18:
+mov eax, dword [rbp+-12]
+push rax
+mov rax, _@S45
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S46
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L19:
+.L7:
+mov rax, qword [rbp+-8]
+add rax, 24
+mov rax, qword [rax]
+mov rbx, 0
+cmp rax, rbx
+mov qword [$enclosing_function], rax
+je .L21
+.L20:
+mov rax, qword [rbp+-8]
+add rax, 8
+mov rax, qword [rax]
+add rax, 8
+mov rax, qword [rax]
+push rax
+mov rax, qword [rbp+-8]
+add rax, 24
+mov rax, qword [rax]
+push rax
+mov rax, _@S47
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $string_printf
+add rsp, 32
+mov rax, _@S48
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+jmp .L22
+.L21:
+mov rax, qword [rbp+-8]
+mov rax, qword [rax]
+push rax
+mov rdi, [rsp+0]
+call $get_sto_class_spec
+add rsp, 8
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-48], rax
+je .L23
+.L25:
+mov rax, qword [rbp+-48]
+movsx rax, dword [rax]
+cmp eax, 67
+je .L24
+.L23:
+mov rax, qword [rbp+-8]
+add rax, 8
+mov rax, qword [rax]
+add rax, 8
+mov rax, qword [rax]
+push rax
+mov rax, _@S49
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S50
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L24:
+mov rax, qword [rbp+-8]
+add rax, 8
+mov rax, qword [rax]
+add rax, 8
+mov rax, qword [rax]
+push rax
+mov rax, _@S51
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S52
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L22:
+mov rax, 0
+mov rbx, qword [rbp+-40]
+cmp rbx, rax
+je .L27
+.L26:
+push qword [rbp+-40]
+lea rax, [rbp+-32]
+add rax, 8
+mov rax, qword [rax]
+push rax
+lea rax, [rbp+-32]
+mov rax, qword [rax]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $arm_static_init
+add rsp, 24
+jmp .L28
+.L27:
+lea rax, [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+call $get_sizeof
+add rsp, 8
+push rax
+mov rax, _@S53
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S54
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L28:
+.L3:
+mov rax, qword [rbp+-8]
+add rax, 32
+mov rax, qword [rax]
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-8], rax
+jne .L2
+.L4:
+.L1:
+.L29:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_or' ====
+$arm_or:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg2
+add rsp, 8
+mov [rbp+-64], rax
+lea rax, [rbp+-64]                             
+mov ebx, dword [rbp+-24]
+push rbx
+sub rsp, 8
+mov rsi, rax
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rsi, rax
+lea rdi, [rbp+-52]
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+lea rax, [rbp+-52]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 1
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+call $arm_get_operand2
+add rsp, 8
+mov rbx, 0
+sal rbx, 3
+mov rcx, rax
+add rcx, rbx
+mov rcx, qword [rcx]
+push rcx
+lea rbx, [rbp+-52]
+movsx rbx, word [rbx]
+push rbx
+lea rbx, [rbp+-52]
+movsx rbx, word [rbx]
+push rbx
+mov rbx, _@S55
+push rbx
+push 1
+mov qword [rbp+-48], rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+mov rax, 1
+sal rax, 3
+mov rbx, qword [rbp+-48]
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S56
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+lea rax, [rbp+-52]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+.L8:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-52]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors2
+add rsp, 32
+.L6:
+.L7:
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+push 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_get_operand
+add rsp, 16
+push rax
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S57
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+.L11:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L9:
+.L10:
+.L4:
+.L1:
+.L12:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_xor' ====
+$arm_xor:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg2
+add rsp, 8
+mov [rbp+-64], rax
+lea rax, [rbp+-64]                             
+mov ebx, dword [rbp+-24]
+push rbx
+sub rsp, 8
+mov rsi, rax
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rsi, rax
+lea rdi, [rbp+-52]
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+lea rax, [rbp+-52]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 1
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+call $arm_get_operand2
+add rsp, 8
+mov rbx, 0
+sal rbx, 3
+mov rcx, rax
+add rcx, rbx
+mov rcx, qword [rcx]
+push rcx
+lea rbx, [rbp+-52]
+movsx rbx, word [rbx]
+push rbx
+lea rbx, [rbp+-52]
+movsx rbx, word [rbx]
+push rbx
+mov rbx, _@S58
+push rbx
+push 1
+mov qword [rbp+-48], rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+mov rax, 1
+sal rax, 3
+mov rbx, qword [rbp+-48]
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S59
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+lea rax, [rbp+-52]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+.L8:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-52]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors2
+add rsp, 32
+.L6:
+.L7:
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+push 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_get_operand
+add rsp, 16
+push rax
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S60
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+.L11:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L9:
+.L10:
+.L4:
+.L1:
+.L12:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_restore_arg_regs' ====
+$arm_restore_arg_regs:
+push rbp
+mov rbp, rsp
+push rbx
+.L0:
+movsx rax, dword [$arg_offs]
+cdq
+mov rbx, 4
+idiv ebx
+mov rbx, 0
+mov rcx, 3
+cmp rax, rbx
+jl .L7
+cmp rax, rcx
+jg .L7
+jmp [rax*8+.jt1]
+segment .rodata
+.jt1:
+dq .L3
+dq .L4
+dq .L5
+dq .L6
+segment .text
+.L3:
+jmp .L2
+.L4:
+mov rax, _@S61
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L2
+.L5:
+mov rax, _@S62
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L2
+.L6:
+mov rax, _@S63
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L2
+.L7:
+mov rax, _@S64
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+.L2:
+.L1:
+.L8:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_sh' ====
+$arm_sh:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-34], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+movsx rax, word [rbp+-34]
+push rax
+movsx rax, word [rbp+-34]
+push rax
+mov rax, _@S65
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L4:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-34]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L2:
+.L3:
+.L1:
+.L5:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_store' ====
+$arm_store:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+push rbx
+.L0:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 2
+jne .L3
+.L2:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+add rbx, 8
+mov rbx, qword [rbx]
+mov rax, rbx
+add rax, 72
+mov qword [rbp+-32], rbx
+push rax
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 49
+je .L8
+cmp eax, 106
+je .L8
+cmp eax, 107
+je .L8
+cmp eax, 64
+je .L7
+cmp eax, 108
+je .L7
+cmp eax, 68
+je .L6
+cmp eax, 71
+je .L6
+jmp .L9
+.L6:
+mov rax, _@S66
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov eax, dword [rbp+-16]
+push rax
+mov rax, 12
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load_addr
+add rsp, 16
+push 12
+mov rax, _@S67
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+movsx rax, word [rbp+-8]
+push rax
+mov rax, _@S68
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov rax, qword [rbp+-32]
+add rax, 72
+push rax
+mov rdi, [rsp+0]
+call $get_sizeof
+add rsp, 8
+push rax
+push 12
+mov rax, _@S69
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+mov rax, _@S70
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov rax, _@S71
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L1
+.L7:
+mov rax, _@S72
+mov qword [rbp+-40], rax
+mov rax, 255
+mov dword [rbp+-44], eax
+jmp .L5
+.L8:
+mov rax, _@S73
+mov qword [rbp+-40], rax
+mov rax, 4095
+mov dword [rbp+-44], eax
+jmp .L5
+.L9:
+mov rax, _@S74
+mov qword [rbp+-40], rax
+mov rax, 4095
+mov dword [rbp+-44], eax
+.L5:
+mov rax, qword [rbp+-32]
+add rax, 56
+add rax, 13
+movsx rax, byte [rax]
+cmp eax, 1
+jne .L11
+.L10:
+mov rax, qword [rbp+-32]
+add rax, 56
+add rax, 12
+movsx rax, byte [rax]
+cmp eax, 2
+jne .L14
+.L13:
+mov rax, qword [rbp+-32]
+add rax, 56
+mov rax, qword [rax]
+push rax
+push qword [$curr_func]
+push 12
+mov rax, _@S75
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+push 12
+movsx rax, word [rbp+-8]
+push rax
+push qword [rbp+-40]
+mov rax, _@S76
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+jmp .L15
+.L14:
+mov rax, qword [rbp+-32]
+add rax, 56
+mov rax, qword [rax]
+push rax
+push 12
+mov rax, _@S77
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+movsx rax, word [rbp+-8]
+push rax
+push qword [rbp+-40]
+mov rax, _@S78
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+.L15:
+jmp .L12
+.L11:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+add rbx, 16
+movsx rbx, dword [rbx]
+cmp ebx, 0
+mov dword [rbp+-20], ebx
+jge .L17
+.L16:
+movsx rax, dword [rbp+-44]
+neg eax
+movsx rbx, dword [rbp+-20]
+cmp ebx, eax
+jl .L20
+.L19:
+movsx rax, dword [rbp+-20]
+neg eax
+push rax
+movsx rax, word [rbp+-8]
+push rax
+push qword [rbp+-40]
+mov rax, _@S79
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+jmp .L1
+.L20:
+jmp .L18
+.L17:
+movsx rax, dword [rbp+-20]
+cmp eax, dword [rbp+-44]
+jg .L22
+.L21:
+movsx rax, dword [rbp+-20]
+push rax
+movsx rax, word [rbp+-8]
+push rax
+push qword [rbp+-40]
+mov rax, _@S80
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+jmp .L1
+.L22:
+.L18:
+movsx rax, dword [rbp+-20]
+push rax
+push 12
+mov rax, _@S81
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+movsx rax, word [rbp+-8]
+push rax
+push qword [rbp+-40]
+mov rax, _@S82
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+.L12:
+jmp .L4
+.L3:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 3
+jne .L24
+.L23:
+mov eax, dword [rbp+-16]
+push rax
+mov rdi, [rsp+0]
+call $get_temp_offs
+add rsp, 8
+mov rbx, -4095
+cmp eax, ebx
+mov dword [rbp+-20], eax
+jl .L26
+.L25:
+movsx rax, dword [rbp+-20]
+neg eax
+push rax
+movsx rax, word [rbp+-8]
+push rax
+mov rax, _@S83
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L27
+.L26:
+movsx rax, dword [rbp+-20]
+push rax
+push 12
+mov rax, _@S84
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+movsx rax, word [rbp+-8]
+push rax
+mov rax, _@S85
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L27:
+.L24:
+.L4:
+.L1:
+.L28:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `__va_arg' ====
+$__va_arg:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+push rbx
+.L0:
+mov rax, qword [rbp+-16]
+add rax, 8
+mov rbx, 1
+sub rax, rbx
+mov rbx, 1
+mov rcx, 8
+sub rcx, rbx
+not rcx
+and rax, rcx
+mov rbx, 8
+xor edx, edx
+div rbx
+mov dword [rbp+-28], eax
+mov rax, 16
+mov rbx, qword [rbp+-16]
+cmp rbx, rax
+ja .L2
+.L5:
+mov rax, qword [rbp+-8]
+mov eax, dword [rax]
+movsx rbx, dword [rbp+-28]
+sal ebx, 3
+mov rcx, 48
+sub ecx, ebx
+cmp eax, ecx
+jbe .L3
+.L2:
+mov rax, qword [rbp+-8]
+add rax, 8
+mov rax, qword [rax]
+mov qword [rbp+-24], rax
+mov rax, qword [rbp+-16]
+add rax, 8
+mov rbx, 1
+sub rax, rbx
+mov rbx, 1
+mov rcx, 8
+sub rcx, rbx
+not rcx
+and rax, rcx
+mov rbx, qword [rbp+-8]
+add rbx, 8
+mov rbx, qword [rbx]
+add rbx, rax
+mov rax, qword [rbp+-8]
+add rax, 8
+mov qword [rax], rbx
+jmp .L4
+.L3:
+mov rax, qword [rbp+-8]
+mov eax, dword [rax]
+mov eax, eax
+mov rbx, qword [rbp+-8]
+add rbx, 16
+mov rbx, qword [rbx]
+add rbx, rax
+mov qword [rbp+-24], rbx
+mov rax, qword [rbp+-8]
+mov eax, dword [rax]
+movsx rbx, dword [rbp+-28]
+sal ebx, 3
+add eax, ebx
+mov rbx, qword [rbp+-8]
+mov dword [rbx], eax
+.L4:
+mov rax, qword [rbp+-24]
+.L1:
+.L6:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_lab' ====
+$arm_lab:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+push qword [$curr_func]
+mov rax, _@S86
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L1:
+.L2:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_cmpl' ====
+$arm_cmpl:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg2
+add rsp, 8
+mov [rbp+-48], rax
+lea rax, [rbp+-48]                             
+mov ebx, dword [rbp+-24]
+push rbx
+sub rsp, 8
+mov rsi, rax
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rsi, rax
+lea rdi, [rbp+-40]
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+lea rax, [rbp+-40]
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-40]
+movsx rax, word [rax]
+push rax
+mov rax, _@S87
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+lea rax, [rbp+-40]
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-40]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S88
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L8:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-40]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors2
+add rsp, 32
+.L6:
+.L7:
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S89
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L11:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L9:
+.L10:
+.L4:
+.L1:
+.L12:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_let' ====
+$arm_let:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+mov rax, 2
+mov rcx, rbx
+and rcx, rax
+mov qword [rbp+-40], rbx
+cmp rcx, 0
+je .L3
+.L2:
+mov rax, 1
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L6
+.L5:
+mov rax, 17
+mov qword [rbp+-56], rax
+jmp .L7
+.L6:
+mov rax, 13
+mov qword [rbp+-56], rax
+.L7:
+push qword [rbp+-56]
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $arm_do_libcall
+add rsp, 40
+jmp .L4
+.L3:
+mov rax, 4
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+jne .L8
+.L12:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+je .L8
+.L13:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 1
+je .L8
+.L11:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+jne .L9
+.L8:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-42], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+jmp .L10
+.L9:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov word [rbp+-42], ax
+.L10:
+mov rax, $pinned
+movsx rbx, word [rbp+-42]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+push 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_get_operand
+add rsp, 16
+push rax
+movsx rax, word [rbp+-42]
+push rax
+mov rax, _@S90
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov rax, $pinned
+movsx rbx, word [rbp+-42]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+mov rax, 4
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L15
+.L14:
+movsx rax, word [rbp+-42]
+push rax
+mov rax, 1
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L18
+.L17:
+mov rax, _@S91
+mov qword [rbp+-56], rax
+jmp .L19
+.L18:
+mov rax, _@S92
+mov qword [rbp+-56], rax
+.L19:
+push qword [rbp+-56]
+mov rax, _@S93
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, word [rbp+-42]
+push rax
+mov rax, 1
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L21
+.L20:
+mov rax, _@S94
+mov qword [rbp+-56], rax
+jmp .L22
+.L21:
+mov rax, _@S95
+mov qword [rbp+-56], rax
+.L22:
+push qword [rbp+-56]
+mov rax, _@S96
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L25:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-42]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L23:
+.L24:
+jmp .L16
+.L15:
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+push qword [rbp+-40]
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $do_relop_jump
+add rsp, 40
+.L16:
+.L4:
+.L1:
+.L26:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `dump_reg_descr_tab' ====
+$dump_reg_descr_tab:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+push rbx
+.L0:
+mov rax, 0
+cmp eax, 16
+mov dword [rbp+-4], eax
+jge .L4
+.L2:
+movsx rax, dword [rbp+-4]
+mov rbx, $reg_descr_tab
+sal rax, 2
+add rbx, rax
+mov ebx, dword [rbx]
+cmp ebx, 0
+sete bl
+movzx ebx, bl
+cmp ebx, 0
+sete bl
+movzx ebx, bl
+cmp rbx, 0
+je .L6
+.L5:
+movsx rax, dword [rbp+-4]
+mov rbx, $reg_descr_tab
+sal rax, 2
+add rbx, rax
+mov ebx, dword [rbx]
+mov ebx, ebx
+sal rbx, 5
+mov rax, qword [$ic_addresses]
+add rax, rbx
+add rax, 8
+movsx rax, dword [rax]
+movsx rax, eax
+sal rax, 3
+mov rbx, qword [$nid2sid_tab]
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+movsx rax, dword [rbp+-4]
+push rax
+mov rax, _@S97
+push rax
+push qword [$stderr]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $fprintf
+add rsp, 32
+.L6:
+.L3:
+movsx rax, dword [rbp+-4]
+add eax, 1
+cmp eax, 16
+mov dword [rbp+-4], eax
+jl .L2
+.L4:
+.L1:
+.L7:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_uch' ====
+$arm_uch:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-34], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+movsx rax, word [rbp+-34]
+push rax
+movsx rax, word [rbp+-34]
+push rax
+mov rax, _@S98
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L4:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-34]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L2:
+.L3:
+.L1:
+.L5:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `emit_raw_string' ====
+$emit_raw_string:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+push rbx
+.L0:
+push qword [rbp+-16]
+mov rdi, [rsp+0]
+call $strlen
+add rsp, 8
+mov rbx, 1
+add rax, rbx
+mov rbx, rax
+shr ebx, 2
+mov dword [rbp+-20], eax
+cmp rbx, 0
+mov dword [rbp+-24], ebx
+je .L4
+.L2:
+mov rax, 0
+mov rbx, qword [rbp+-16]
+add rbx, rax
+movsx rbx, byte [rbx]
+push rbx
+mov rax, 1
+mov rbx, qword [rbp+-16]
+add rbx, rax
+movsx rbx, byte [rbx]
+push rbx
+mov rax, 2
+mov rbx, qword [rbp+-16]
+add rbx, rax
+movsx rbx, byte [rbx]
+push rbx
+mov rax, 3
+mov rbx, qword [rbp+-16]
+add rbx, rax
+movsx rbx, byte [rbx]
+push rbx
+mov rax, _@S99
+push rax
+push qword [rbp+-8]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+mov r9, [rsp+40]
+xor eax, eax
+call $string_printf
+add rsp, 48
+mov rax, 4
+mov rbx, qword [rbp+-16]
+add rbx, rax
+mov qword [rbp+-16], rbx
+.L3:
+mov eax, dword [rbp+-24]
+sub eax, 1
+cmp rax, 0
+mov dword [rbp+-24], eax
+jne .L2
+.L4:
+mov eax, dword [rbp+-20]
+and eax, 3
+cmp rax, 0
+mov dword [rbp+-24], eax
+je .L7
+.L5:
+mov rax, qword [rbp+-16]
+mov rbx, rax
+add rbx, 1
+mov qword [rbp+-16], rbx
+movsx rax, byte [rax]
+push rax
+mov rax, _@S100
+push rax
+push qword [rbp+-8]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+.L6:
+mov eax, dword [rbp+-24]
+sub eax, 1
+cmp rax, 0
+mov dword [rbp+-24], eax
+jne .L5
+.L7:
+.L1:
+.L8:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `emit_code' ====
+$emit_code:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov [rbp+-8], r9
+mov [rbp+-16], r8
+mov [rbp+-24], rcx
+mov [rbp+-32], rdx
+mov [rbp+-40], rsi
+mov [rbp+-48], rdi
+push rbx
+.L0:
+lea rax, [rbp+0]
+lea rbx, [rbp+-72]
+mov dword [rbx], 16
+mov rcx, rbx
+add rcx, 8
+mov rdx, rax
+add rdx, 16
+mov qword [rcx], rdx
+add rbx, 16
+sub rax, 48
+mov qword [rbx], rax
+lea rax, [rbp+-72]
+push rax
+push qword [rbp+-40]
+push qword [$func_body]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $string_vprintf
+add rsp, 24
+cmp dword [rbp+-48], 0
+je .L3
+.L2:
+mov rax, _@S101
+push rax
+push qword [$func_body]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L3:
+movsx rax, dword [$offs_to_lit_tab]
+add eax, 4
+cmp eax, 2048
+mov dword [$offs_to_lit_tab], eax
+jl .L5
+.L4:
+call $dump_and_link
+.L5:
+.L1:
+.L6:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `get_reg0' ====
+$get_reg0:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+push rbx
+.L0:
+mov rax, 0
+cmp eax, 16
+mov dword [rbp+-4], eax
+jge .L4
+.L2:
+movsx rax, dword [rbp+-4]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+sete bl
+movzx ebx, bl
+cmp rbx, 0
+je .L6
+.L7:
+movsx rax, dword [rbp+-4]
+mov rbx, $reg_descr_tab
+sal rax, 2
+add rbx, rax
+mov ebx, dword [rbx]
+cmp ebx, 0
+jne .L6
+.L5:
+movsx rax, dword [rbp+-4]
+mov rbx, $modified
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 1
+movsx rax, dword [rbp+-4]
+cmp eax, 3
+jle .L9
+.L8:
+mov rax, 0
+jmp .L10
+.L9:
+push 269
+mov rax, _@S102
+push rax
+mov rax, _@S103
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L10:
+movsx rax, dword [rbp+-4]
+movsx rax, ax
+jmp .L1
+.L6:
+.L3:
+movsx rax, dword [rbp+-4]
+add eax, 1
+cmp eax, 16
+mov dword [rbp+-4], eax
+jl .L2
+.L4:
+mov rax, 0
+cmp eax, 16
+mov dword [rbp+-4], eax
+jge .L13
+.L11:
+movsx rax, dword [rbp+-4]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+sete bl
+movzx ebx, bl
+cmp rbx, 0
+je .L15
+.L14:
+movsx rax, dword [rbp+-4]
+mov rbx, $modified
+sal rax, 2
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp rbx, 0
+je .L17
+.L16:
+mov rax, 0
+jmp .L18
+.L17:
+push 276
+mov rax, _@S104
+push rax
+mov rax, _@S105
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L18:
+movsx rax, dword [rbp+-4]
+cmp eax, 3
+jle .L20
+.L19:
+mov rax, 0
+jmp .L21
+.L20:
+push 277
+mov rax, _@S106
+push rax
+mov rax, _@S107
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L21:
+movsx rax, dword [rbp+-4]
+movsx rax, ax
+push rax
+mov rdi, [rsp+0]
+call $spill_reg
+add rsp, 8
+movsx rax, dword [rbp+-4]
+movsx rax, ax
+jmp .L1
+.L15:
+.L12:
+movsx rax, dword [rbp+-4]
+add eax, 1
+cmp eax, 16
+mov dword [rbp+-4], eax
+jl .L11
+.L13:
+jmp .L23
+.L22:
+mov rax, 0
+jmp .L24
+.L23:
+push 283
+mov rax, _@S108
+push rax
+mov rax, _@S109
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L24:
+mov rax, 0
+.L1:
+.L25:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `get_reg2' ====
+$get_reg2:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp+-8], rdi
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 20
+mov ebx, dword [rbx]
+mov rax, rbx
+mov eax, eax
+mov dword [rbp+-16], ebx
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+je .L6
+.L7:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 1
+jne .L8
+.L6:
+mov rax, 1
+mov qword [rbp+-32], rax
+jmp .L9
+.L8:
+mov rax, 0
+mov qword [rbp+-32], rax
+.L9:
+mov rax, qword [rbp+-32]
+cmp eax, 0
+sete al
+movzx eax, al
+cmp rax, 0
+je .L3
+.L5:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+cmp ebx, 0
+sete bl
+movzx ebx, bl
+cmp rbx, 0
+je .L3
+.L2:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L11
+.L10:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov qword [rbp+-32], rax
+jmp .L12
+.L11:
+call $get_reg0
+mov qword [rbp+-32], rax
+.L12:
+mov rax, qword [rbp+-32]
+movsx rax, ax
+lea rbx, [rbp+-12]
+mov word [rbx], ax
+lea rax, [rbp+-12]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 1
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+add rax, 2
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L14
+.L13:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+add rax, 2
+movsx rax, word [rax]
+mov qword [rbp+-32], rax
+jmp .L15
+.L14:
+call $get_reg0
+mov qword [rbp+-32], rax
+.L15:
+mov rax, qword [rbp+-32]
+movsx rax, ax
+lea rbx, [rbp+-12]
+add rbx, 2
+mov word [rbx], ax
+lea rax, [rbp+-12]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+jmp .L4
+.L3:
+call $get_reg0
+lea rbx, [rbp+-12]
+mov word [rbx], ax
+lea rax, [rbp+-12]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 1
+call $get_reg0
+lea rbx, [rbp+-12]
+add rbx, 2
+mov word [rbx], ax
+lea rax, [rbp+-12]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+.L4:
+lea rax, [rbp+-12]
+movsx rax, word [rax]
+lea rbx, [rbp+-12]
+add rbx, 2
+movsx rbx, word [rbx]
+cmp eax, ebx
+jle .L17
+.L16:
+lea rax, [rbp+-12]
+movsx rax, word [rax]
+lea rbx, [rbp+-12]
+add rbx, 2
+movsx rbx, word [rbx]
+lea rcx, [rbp+-12]
+mov word [rcx], bx
+lea rbx, [rbp+-12]
+add rbx, 2
+mov word [rbx], ax
+.L17:
+lea rax, [rbp+-12]
+mov eax, dword [rax]
+.L1:
+.L18:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_call' ====
+$arm_call:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+call $spill_all
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+add rbx, 8
+mov rbx, qword [rbx]
+add rbx, 56
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S110
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $arm_post_call
+add rsp, 8
+cmp dword [rbp+-16], 0
+je .L3
+.L2:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L4
+.L7:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L5
+.L4:
+lea rax, [rbp+-40]
+mov rbx, 4
+mov word [rax], bx
+lea rax, [rbp+-40]
+add rax, 2
+mov rbx, 5
+mov word [rax], bx
+mov rax, _@S111
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S112
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-40]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors2
+add rsp, 32
+jmp .L6
+.L5:
+mov rax, _@S113
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+mov rax, 4
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L6:
+.L3:
+.L1:
+.L8:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_div' ====
+$arm_div:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+movsx rax, dword [rbp+-36]
+push rax
+mov rdi, [rsp+0]
+call $is_signed_int
+add rsp, 8
+cmp rax, 0
+je .L7
+.L6:
+mov rax, 1
+mov qword [rbp+-48], rax
+jmp .L8
+.L7:
+mov rax, 2
+mov qword [rbp+-48], rax
+.L8:
+push qword [rbp+-48]
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $arm_do_libcall
+add rsp, 40
+jmp .L4
+.L3:
+mov rax, 4
+mov word [rbp+-38], ax
+call $arm_save_arg_regs
+mov eax, dword [rbp+-24]
+push rax
+mov rax, 0
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+mov eax, dword [rbp+-32]
+push rax
+mov rax, 1
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+call $spill_all
+movsx rax, dword [rbp+-36]
+push rax
+mov rdi, [rsp+0]
+call $is_unsigned_int
+add rsp, 8
+cmp rax, 0
+je .L10
+.L9:
+mov rax, _@S114
+mov qword [rbp+-48], rax
+jmp .L11
+.L10:
+mov rax, _@S115
+mov qword [rbp+-48], rax
+.L11:
+push qword [rbp+-48]
+mov rax, _@S116
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S117
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+call $arm_restore_arg_regs
+.L14:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L12:
+.L13:
+.L4:
+.L1:
+.L15:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `is_representable_in_imm12' ====
+$is_representable_in_imm12:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp+-8], rdi
+push rbx
+.L0:
+mov rax, 0
+cmp eax, 16
+mov dword [rbp+-12], eax
+jge .L4
+.L2:
+movsx rax, dword [rbp+-12]
+mov rbx, $is_representable_in_imm12@a
+sal rax, 2
+add rbx, rax
+mov ebx, dword [rbx]
+not ebx
+mov eax, dword [rbp+-8]
+and eax, ebx
+cmp eax, 0
+sete al
+movzx eax, al
+cmp rax, 0
+je .L6
+.L5:
+mov rax, 1
+jmp .L1
+.L6:
+.L3:
+movsx rax, dword [rbp+-12]
+add eax, 1
+cmp eax, 16
+mov dword [rbp+-12], eax
+jl .L2
+.L4:
+mov rax, 0
+.L1:
+.L7:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `dump_addr_descr_tab' ====
+$dump_addr_descr_tab:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+push rbx
+.L0:
+mov rax, 0
+cmp eax, dword [$nid_counter]
+mov dword [rbp+-4], eax
+jge .L4
+.L2:
+movsx rax, dword [rbp+-4]
+sal rax, 2
+mov rbx, qword [$addr_descr_tab]
+add rbx, rax
+mov rsi, rbx
+lea rdi, [rbp+-8]
+mov ecx, 4
+rep movsb
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L6
+.L5:
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L8
+.L7:
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+movsx rax, dword [rbp+-4]
+sal rax, 3
+mov rbx, qword [$nid2sid_tab]
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S118
+push rax
+push qword [$stderr]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $fprintf
+add rsp, 40
+jmp .L9
+.L8:
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+movsx rax, dword [rbp+-4]
+sal rax, 3
+mov rbx, qword [$nid2sid_tab]
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S119
+push rax
+push qword [$stderr]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $fprintf
+add rsp, 32
+.L9:
+.L6:
+.L3:
+movsx rax, dword [rbp+-4]
+add eax, 1
+cmp eax, dword [$nid_counter]
+mov dword [rbp+-4], eax
+jl .L2
+.L4:
+.L1:
+.L10:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_case' ====
+$arm_case:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+.L0:
+.L1:
+.L2:
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_ush' ====
+$arm_ush:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-34], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+movsx rax, word [rbp+-34]
+push rax
+movsx rax, word [rbp+-34]
+push rax
+mov rax, _@S120
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L4:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-34]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L2:
+.L3:
+.L1:
+.L5:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `update_arg_descriptors' ====
+$update_arg_descriptors:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+push rbx
+.L0:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+je .L2
+.L5:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 1
+je .L2
+.L4:
+cmp dword [rbp+-24], 0
+je .L3
+.L2:
+jmp .L1
+.L3:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L7
+.L6:
+cmp byte [rbp+-16], 0
+je .L10
+.L9:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+add rax, 2
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L13
+.L12:
+mov eax, dword [rbp+-8]
+push rax
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+sub rsp, 8
+mov rsi, rax
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_store2
+add rsp, 16
+jmp .L14
+.L13:
+mov eax, dword [rbp+-8]
+push rax
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_store
+add rsp, 16
+.L14:
+jmp .L11
+.L10:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 3
+jne .L16
+.L15:
+mov eax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $free_temp
+add rsp, 8
+.L16:
+.L11:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, $reg_descr_tab
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+add rax, 2
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L18
+.L17:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+add rax, 2
+movsx rax, word [rax]
+mov rbx, $reg_descr_tab
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+.L18:
+mov rax, -1
+movsx rax, ax
+mov ebx, dword [rbp+-8]
+sal rbx, 5
+mov rcx, qword [$ic_addresses]
+add rcx, rbx
+add rcx, 8
+movsx rcx, dword [rcx]
+movsx rcx, ecx
+sal rcx, 2
+mov rbx, qword [$addr_descr_tab]
+add rbx, rcx
+add rbx, 2
+mov word [rbx], ax
+mov ebx, dword [rbp+-8]
+sal rbx, 5
+mov rcx, qword [$ic_addresses]
+add rcx, rbx
+add rcx, 8
+movsx rcx, dword [rcx]
+movsx rcx, ecx
+sal rcx, 2
+mov rbx, qword [$addr_descr_tab]
+add rbx, rcx
+mov word [rbx], ax
+jmp .L8
+.L7:
+cmp byte [rbp+-16], 0
+je .L20
+.L19:
+jmp .L21
+.L20:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 3
+jne .L23
+.L22:
+mov eax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $free_temp
+add rsp, 8
+.L23:
+.L21:
+.L8:
+.L1:
+.L24:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_post_call' ====
+$arm_post_call:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp+-8], rdi
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 68
+mov dword [rbp+-12], eax
+je .L4
+.L5:
+movsx rax, dword [rbp+-12]
+cmp eax, 71
+jne .L3
+.L4:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_sizeof
+add rsp, 8
+cmp eax, 4
+ja .L3
+.L2:
+push qword [$func_body]
+mov rdi, [rsp+0]
+call $string_get_pos
+add rsp, 8
+movsx rbx, dword [$retvals_to_fix_counter]
+mov rcx, rbx
+add ecx, 1
+mov dword [$retvals_to_fix_counter], ecx
+movsx rbx, ebx
+mov rcx, $retvals_to_fix
+sal rbx, 2
+add rcx, rbx
+mov dword [rcx], eax
+mov rax, _@S121
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+.L3:
+movsx rax, dword [$arg_offs]
+cmp eax, dword [$max_arg_offs]
+jle .L7
+.L6:
+movsx rax, dword [$arg_offs]
+mov dword [$max_arg_offs], eax
+.L7:
+mov rax, 0
+mov dword [$arg_offs], eax
+.L1:
+.L8:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_do_switch64' ====
+$arm_do_switch64:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+jne .L3
+.L2:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg2
+add rsp, 8
+mov [rbp+-56], rax
+lea rax, [rbp+-56]                             
+mov ebx, dword [rbp+-24]
+push rbx
+sub rsp, 8
+mov rsi, rax
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rsi, rax
+lea rdi, [rbp+-36]
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+jmp .L4
+.L3:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+mov rsi, rax
+lea rdi, [rbp+-36]
+mov ecx, 4
+rep movsb
+.L4:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+add eax, 1
+mov dword [rbp+-8], eax
+.L5:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 16
+mov ebx, dword [rbx]
+mov dword [rbp+-16], ebx
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 20
+mov ebx, dword [rbx]
+mov dword [rbp+-24], ebx
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 24
+mov ebx, dword [rbx]
+mov ebx, ebx
+sal rbx, 5
+mov rax, qword [$ic_addresses]
+add rax, rbx
+add rax, 8
+mov rax, qword [rax]
+cmp rax, 0
+je .L9
+.L8:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+push qword [$curr_func]
+mov rax, _@S122
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L7
+.L9:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rax, 0
+sal rax, 2
+mov rcx, rbx
+add rcx, rax
+mov ecx, dword [rcx]
+push rcx
+push 12
+mov rax, _@S123
+push rax
+push 1
+mov qword [rbp+-48], rbx
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+lea rax, [rbp+-36]
+movsx rax, word [rax]
+push rax
+push 12
+mov rax, _@S124
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov eax, dword [$arm_do_switch64@nlab]
+push rax
+push qword [$curr_func]
+mov rax, _@S125
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov rax, 1
+sal rax, 2
+mov rbx, qword [rbp+-48]
+add rbx, rax
+mov ebx, dword [rbx]
+push rbx
+push 12
+mov rax, _@S126
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+lea rax, [rbp+-36]
+add rax, 2
+movsx rax, word [rax]
+push rax
+push 12
+mov rax, _@S127
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+push qword [$curr_func]
+mov rax, _@S128
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov eax, dword [$arm_do_switch64@nlab]
+push rax
+push qword [$curr_func]
+mov rax, _@S129
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov eax, dword [$arm_do_switch64@nlab]
+add eax, 1
+mov dword [$arm_do_switch64@nlab], eax
+.L6:
+movsx rax, dword [rbp+-8]
+add eax, 1
+mov dword [rbp+-8], eax
+jmp .L5
+.L7:
+.L1:
+.L10:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_llsx' ====
+$arm_llsx:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg2
+add rsp, 8
+mov [rbp+-48], rax
+lea rax, [rbp+-48]                             
+mov ebx, dword [rbp+-24]
+push rbx
+lea rbx, [rbp+-36]
+mov rsi, rax
+lea rdi, [rbp+-36]
+mov ecx, 4
+rep movsb
+movsx rbx, word [rbx]
+push rbx
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+lea rax, [rbp+-36]
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-36]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S130
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L4:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-36]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors2
+add rsp, 32
+.L2:
+.L3:
+.L1:
+.L5:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_function_definition' ====
+$arm_function_definition:
+push rbp
+mov rbp, rsp
+sub rsp, 96
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+push rbx
+.L0:
+mov rax, qword [rbp+-16]
+add rax, 8
+mov rax, qword [rax]
+push rax
+mov qword [$curr_func], rax
+mov rdi, [rsp+0]
+call $new_cg_node
+add rsp, 8
+push 8
+mov rbx, rax
+mov ebx, ebx
+mov dword [rbp+-32], eax
+imul rbx, 72
+mov rax, qword [$cg_nodes]
+add rax, rbx
+add rax, 40
+mov eax, dword [rax]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $round_up
+add rsp, 16
+mov dword [$size_of_local_area], eax
+lea rax, [rbp+-64]
+mov rbx, qword [rbp+-8]
+mov qword [rax], rbx
+mov rax, qword [rbp+-16]
+add rax, 24
+mov rax, qword [rax]
+add rax, 24
+mov rax, qword [rax]
+lea rbx, [rbp+-64]
+add rbx, 8
+mov qword [rbx], rax
+lea rax, [rbp+-64]
+push rax
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 68
+mov dword [rbp+-20], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-20]
+cmp eax, 71
+jne .L3
+.L2:
+mov rax, 1
+mov dword [$struct_union_return], eax
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-20]
+cmp eax, 110
+je .L6
+.L8:
+movsx rax, dword [rbp+-20]
+cmp eax, 111
+jne .L7
+.L6:
+mov rax, 1
+mov dword [$qword_return], eax
+.L7:
+.L4:
+movsx rax, dword [$arm_function_definition@first_func]
+cmp eax, 0
+sete al
+movzx eax, al
+cmp rax, 0
+je .L10
+.L9:
+mov rax, _@S131
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L10:
+push qword [$curr_func]
+mov rax, _@S132
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S133
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L13:
+movsx rax, dword [$curr_segment]
+cmp eax, 1
+je .L15
+.L14:
+mov rax, 1
+mov rbx, $str_segment
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S134
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S135
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, 1
+mov dword [$curr_segment], eax
+.L15:
+.L11:
+.L12:
+movsx rax, dword [$a_mapsym_counter]
+mov rbx, rax
+add ebx, 1
+mov dword [$a_mapsym_counter], ebx
+push rax
+mov rax, _@S136
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S137
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+push qword [rbp+-8]
+mov rdi, [rsp+0]
+call $get_sto_class_spec
+add rsp, 8
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-48], rax
+je .L16
+.L18:
+mov rax, qword [rbp+-48]
+movsx rax, dword [rax]
+cmp eax, 67
+je .L17
+.L16:
+push qword [$curr_func]
+mov rax, _@S138
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S139
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L17:
+push qword [$curr_func]
+mov rax, _@S140
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S141
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov eax, dword [rbp+-32]
+imul rax, 72
+mov rbx, qword [$cg_nodes]
+add rbx, rax
+add rbx, 8
+mov ebx, dword [rbx]
+mov ebx, ebx
+imul rbx, 80
+mov rax, qword [$cfg_nodes]
+add rax, rbx
+mov eax, dword [rax]
+mov ebx, dword [rbp+-32]
+imul rbx, 72
+mov rcx, qword [$cg_nodes]
+add rcx, rbx
+add rcx, 12
+mov ecx, dword [rcx]
+mov ecx, ecx
+imul rcx, 80
+mov rbx, qword [$cfg_nodes]
+add rbx, rcx
+add rbx, 4
+mov ebx, dword [rbx]
+mov rcx, rbx
+mov dword [$func_last_quad], ecx
+cmp eax, ebx
+mov dword [rbp+-24], eax
+mov dword [rbp+-28], ebx
+jg .L21
+.L19:
+movsx rax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 16
+mov ebx, dword [rbx]
+mov dword [rbp+-76], ebx
+movsx rax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 20
+mov ebx, dword [rbx]
+mov dword [rbp+-80], ebx
+movsx rax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 24
+mov ebx, dword [rbx]
+mov dword [rbp+-84], ebx
+cmp dword [$verbose_asm], 0
+je .L23
+.L24:
+movsx rax, dword [rbp+-24]
+sal rax, 3
+mov rbx, qword [$C_source]
+add rbx, rax
+mov rbx, qword [rbx]
+mov rax, 0
+cmp rbx, rax
+je .L23
+.L22:
+movsx rax, dword [rbp+-24]
+sal rax, 3
+mov rbx, qword [$C_source]
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S142
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+.L23:
+mov eax, dword [rbp+-84]
+push rax
+mov eax, dword [rbp+-80]
+push rax
+mov eax, dword [rbp+-76]
+push rax
+movsx rax, dword [rbp+-24]
+push rax
+movsx rax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+mov rax, $instruction_handlers
+sal rbx, 3
+add rax, rbx
+mov rax, qword [rax]
+mov qword [rbp+-96], rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call qword [rbp+-96]
+add rsp, 32
+.L20:
+movsx rax, dword [rbp+-24]
+add eax, 1
+cmp eax, dword [rbp+-28]
+mov dword [rbp+-24], eax
+jle .L19
+.L21:
+push 8
+mov eax, dword [$temp_struct_size]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $round_up
+add rsp, 16
+movsx rbx, dword [$size_of_local_area]
+sub ebx, eax
+mov dword [$size_of_local_area], ebx
+push qword [$func_body]
+mov rdi, [rsp+0]
+call $string_get_pos
+add rsp, 8
+mov dword [rbp+-36], eax
+movsx rax, dword [$retvals_to_fix_counter]
+sub eax, 1
+cmp eax, 0
+mov dword [$retvals_to_fix_counter], eax
+jl .L27
+.L25:
+movsx rax, dword [$retvals_to_fix_counter]
+mov rbx, $retvals_to_fix
+sal rax, 2
+add rbx, rax
+mov ebx, dword [rbx]
+push rbx
+push qword [$func_body]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $string_set_pos
+add rsp, 16
+push qword [$func_body]
+mov rdi, [rsp+0]
+call $string_curr
+add rsp, 8
+mov qword [rbp+-88], rax
+movsx rax, dword [$size_of_local_area]
+neg eax
+push rax
+mov rdi, [rsp+0]
+call $is_representable_in_imm12
+add rsp, 8
+cmp rax, 0
+je .L29
+.L28:
+movsx rax, dword [$size_of_local_area]
+neg eax
+push rax
+movsx rax, dword [$size_of_local_area]
+neg eax
+push rax
+mov rax, _@S143
+push rax
+push qword [rbp+-88]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $sprintf
+add rsp, 32
+mov dword [rbp+-76], eax
+jmp .L30
+.L29:
+jmp .L32
+.L31:
+mov rax, 0
+jmp .L33
+.L32:
+push 2448
+mov rax, _@S144
+push rax
+mov rax, _@S145
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L33:
+.L30:
+mov rax, 32
+movsx rbx, dword [rbp+-76]
+mov rcx, rbx
+add ecx, 1
+movsx rbx, ebx
+mov rdx, qword [rbp+-88]
+add rdx, rbx
+mov byte [rdx], al
+mov rax, rcx
+movsx rax, eax
+mov dword [rbp+-76], ecx
+mov rbx, qword [rbp+-88]
+add rbx, rax
+movsx rbx, byte [rbx]
+cmp ebx, 88
+jne .L36
+.L34:
+mov rax, 32
+movsx rbx, dword [rbp+-76]
+mov rcx, qword [rbp+-88]
+add rcx, rbx
+mov byte [rcx], al
+.L35:
+movsx rax, dword [rbp+-76]
+add eax, 1
+mov rbx, rax
+movsx rbx, ebx
+mov dword [rbp+-76], eax
+mov rax, qword [rbp+-88]
+add rax, rbx
+movsx rax, byte [rax]
+cmp eax, 88
+je .L34
+.L36:
+.L26:
+movsx rax, dword [$retvals_to_fix_counter]
+sub eax, 1
+cmp eax, 0
+mov dword [$retvals_to_fix_counter], eax
+jge .L25
+.L27:
+movsx rax, dword [$calls_to_fix_counter]
+sub eax, 1
+cmp eax, 0
+mov dword [$calls_to_fix_counter], eax
+jl .L39
+.L37:
+movsx rax, dword [$calls_to_fix_counter]
+mov rbx, $calls_to_fix
+sal rax, 2
+add rbx, rax
+mov ebx, dword [rbx]
+push rbx
+push qword [$func_body]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $string_set_pos
+add rsp, 16
+push qword [$func_body]
+mov rdi, [rsp+0]
+call $string_curr
+add rsp, 8
+mov qword [rbp+-88], rax
+movsx rax, dword [$size_of_local_area]
+neg eax
+push rax
+mov rdi, [rsp+0]
+call $is_representable_in_imm12
+add rsp, 8
+cmp rax, 0
+je .L41
+.L40:
+movsx rax, dword [$size_of_local_area]
+neg eax
+push rax
+mov rax, _@S146
+push rax
+push qword [rbp+-88]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $sprintf
+add rsp, 24
+mov dword [rbp+-76], eax
+jmp .L42
+.L41:
+push 12
+movsx rax, dword [$size_of_local_area]
+neg eax
+push rax
+push 12
+mov rax, _@S147
+push rax
+push qword [rbp+-88]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $sprintf
+add rsp, 40
+mov dword [rbp+-76], eax
+.L42:
+mov rax, 32
+movsx rbx, dword [rbp+-76]
+mov rcx, rbx
+add ecx, 1
+movsx rbx, ebx
+mov rdx, qword [rbp+-88]
+add rdx, rbx
+mov byte [rdx], al
+mov rax, rcx
+movsx rax, eax
+mov dword [rbp+-76], ecx
+mov rbx, qword [rbp+-88]
+add rbx, rax
+movsx rbx, byte [rbx]
+cmp ebx, 88
+jne .L45
+.L43:
+mov rax, 32
+movsx rbx, dword [rbp+-76]
+mov rcx, qword [rbp+-88]
+add rcx, rbx
+mov byte [rcx], al
+.L44:
+movsx rax, dword [rbp+-76]
+add eax, 1
+mov rbx, rax
+movsx rbx, ebx
+mov dword [rbp+-76], eax
+mov rax, qword [rbp+-88]
+add rax, rbx
+movsx rax, byte [rax]
+cmp eax, 88
+je .L43
+.L45:
+.L38:
+movsx rax, dword [$calls_to_fix_counter]
+sub eax, 1
+cmp eax, 0
+mov dword [$calls_to_fix_counter], eax
+jge .L37
+.L39:
+mov eax, dword [rbp+-36]
+push rax
+push qword [$func_body]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $string_set_pos
+add rsp, 16
+mov rax, 0
+mov dword [rbp+-68], eax
+mov rax, 4
+cmp eax, 11
+mov dword [rbp+-24], eax
+jge .L48
+.L46:
+movsx rax, dword [rbp+-24]
+mov rbx, $modified
+sal rax, 2
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+sete bl
+movzx ebx, bl
+cmp rbx, 0
+je .L50
+.L49:
+jmp .L48
+.L50:
+movsx rax, dword [rbp+-68]
+add eax, 4
+mov dword [rbp+-68], eax
+.L47:
+movsx rax, dword [rbp+-24]
+add eax, 1
+cmp eax, 11
+mov dword [rbp+-24], eax
+jl .L46
+.L48:
+push 8
+movsx rax, dword [rbp+-68]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $round_up
+add rsp, 16
+movsx rbx, dword [$size_of_local_area]
+sub ebx, eax
+mov rax, rbx
+mov dword [$size_of_local_area], ebx
+mov dword [rbp+-72], eax
+movsx rax, dword [$max_arg_offs]
+cmp eax, 16
+jle .L52
+.L51:
+push 8
+movsx rax, dword [$max_arg_offs]
+sub eax, 16
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $round_up
+add rsp, 16
+movsx rbx, dword [$size_of_local_area]
+sub ebx, eax
+mov dword [$size_of_local_area], ebx
+.L52:
+mov rax, _@S148
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S149
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S150
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S151
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S152
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S153
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+cmp dword [$size_of_local_area], 0
+je .L54
+.L53:
+movsx rax, dword [$size_of_local_area]
+neg eax
+push rax
+mov rdi, [rsp+0]
+call $is_representable_in_imm12
+add rsp, 8
+cmp rax, 0
+je .L56
+.L55:
+movsx rax, dword [$size_of_local_area]
+neg eax
+push rax
+mov rax, _@S154
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S155
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+jmp .L57
+.L56:
+movsx rax, dword [$size_of_local_area]
+neg eax
+push rax
+push 12
+mov rax, _@S156
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $string_printf
+add rsp, 32
+mov rax, _@S157
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+push 12
+mov rax, _@S158
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S159
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L57:
+.L54:
+movsx rax, dword [rbp+-72]
+push rax
+mov rdi, [rsp+0]
+call $arm_save_restore_var_regs
+add rsp, 8
+mov rax, _@S160
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S161
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S162
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S163
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S164
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S165
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S166
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S167
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S168
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S169
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+push qword [$arm_output_file]
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $string_write
+add rsp, 16
+push qword [$arm_output_file]
+push qword [$func_body]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $string_write
+add rsp, 16
+push qword [$arm_output_file]
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $string_write
+add rsp, 16
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+call $string_clear
+add rsp, 8
+push qword [$func_body]
+mov rdi, [rsp+0]
+call $string_clear
+add rsp, 8
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+call $string_clear
+add rsp, 8
+mov rax, 0
+mov dword [$temp_struct_size], eax
+mov rax, 0
+mov dword [$calls_to_fix_counter], eax
+mov rax, 0
+mov dword [$retvals_to_fix_counter], eax
+mov rax, 0
+mov rbx, rax
+mov dword [$max_arg_offs], eax
+mov dword [$arg_offs], ebx
+mov rax, 0
+mov dword [$offs_to_lit_tab], eax
+mov rax, 16
+sal rax, 2
+push rax
+push 0
+mov rax, $modified
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $memset
+add rsp, 24
+call $free_all_temps
+mov rax, 0
+mov rbx, rax
+mov dword [$qword_return], eax
+mov dword [$struct_union_return], ebx
+mov rax, 0
+mov dword [$arm_function_definition@first_func], eax
+.L1:
+.L58:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_static_init' ====
+$arm_static_init:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+push rbx
+.L0:
+mov rax, 0
+mov rbx, qword [rbp+-16]
+cmp rbx, rax
+je .L3
+.L2:
+mov rax, qword [rbp+-16]
+movsx rax, dword [rax]
+cmp eax, 97
+je .L6
+.L5:
+jmp .L49
+.L6:
+mov rax, qword [rbp+-16]
+add rax, 16
+mov rax, qword [rax]
+add rax, 56
+mov rax, qword [rax]
+mov dword [rbp+-36], eax
+mov rax, qword [rbp+-24]
+add rax, 52
+movsx rax, dword [rax]
+cmp eax, 2
+jne .L8
+.L7:
+mov rax, 0
+mov rbx, qword [rbp+-24]
+add rbx, 56
+mov rbx, qword [rbx]
+mov ecx, dword [rbp+-36]
+sub ecx, 1
+mov ecx, ecx
+add rbx, rcx
+mov byte [rbx], al
+mov rax, qword [rbp+-24]
+add rax, 56
+mov rax, qword [rax]
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $emit_raw_string
+add rsp, 16
+mov rax, qword [rbp+-24]
+add rax, 56
+mov rax, qword [rax]
+push rax
+mov rdi, [rsp+0]
+call $strlen
+add rsp, 8
+mov rbx, 1
+add rax, rbx
+cmp eax, dword [rbp+-36]
+mov dword [rbp+-40], eax
+jae .L11
+.L10:
+mov eax, dword [rbp+-36]
+sub eax, dword [rbp+-40]
+push rax
+mov rax, _@S170
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S171
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L11:
+jmp .L9
+.L8:
+mov rax, 0
+mov rbx, qword [rbp+-24]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+mov rax, 0
+cmp rbx, rax
+mov qword [rbp+-24], rbx
+je .L14
+.L12:
+push qword [rbp+-24]
+mov rax, qword [rbp+-16]
+add rax, 24
+mov rax, qword [rax]
+push rax
+push qword [rbp+-8]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $arm_static_init
+add rsp, 24
+.L13:
+mov rax, qword [rbp+-24]
+add rax, 32
+mov rax, qword [rax]
+mov ebx, dword [rbp+-36]
+sub ebx, 1
+mov dword [rbp+-36], ebx
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-24], rax
+jne .L12
+.L14:
+mov eax, dword [rbp+-36]
+cmp eax, 0
+je .L16
+.L15:
+lea rax, [rbp+-56]
+mov rbx, qword [rbp+-8]
+mov qword [rax], rbx
+mov rax, qword [rbp+-16]
+add rax, 24
+mov rax, qword [rax]
+lea rbx, [rbp+-56]
+add rbx, 8
+mov qword [rbx], rax
+lea rax, [rbp+-56]
+push rax
+mov rdi, [rsp+0]
+call $get_alignment
+add rsp, 8
+push rax
+mov rax, _@S172
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S173
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+lea rax, [rbp+-56]
+push rax
+mov rdi, [rsp+0]
+call $get_sizeof
+add rsp, 8
+mov ebx, dword [rbp+-36]
+imul ebx, eax
+push rbx
+mov rax, _@S174
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S175
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L16:
+.L9:
+jmp .L4
+.L3:
+push qword [rbp+-8]
+mov rdi, [rsp+0]
+call $get_type_spec
+add rsp, 8
+mov rbx, rax
+mov qword [rbp+-32], rax
+movsx rbx, dword [rbx]
+cmp ebx, 68
+jne .L18
+.L17:
+mov rax, 0
+mov rbx, qword [rbp+-24]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+mov qword [rbp+-24], rbx
+lea rax, [rbp+-64]
+mov rbx, qword [rbp+-32]
+mov qword [rax], rbx
+mov rax, 0
+lea rbx, [rbp+-64]
+add rbx, 8
+mov qword [rbx], rax
+lea rax, [rbp+-64]
+push rax
+mov rdi, [rsp+0]
+call $get_alignment
+add rsp, 8
+cmp eax, 1
+mov dword [rbp+-68], eax
+jbe .L21
+.L20:
+mov eax, dword [rbp+-68]
+push rax
+mov rax, _@S176
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S177
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L21:
+mov rax, qword [rbp+-32]
+add rax, 16
+mov rax, qword [rax]
+mov rbx, 0
+mov dword [rbp+-44], ebx
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-40], rax
+je .L24
+.L22:
+mov rax, qword [rbp+-40]
+mov rax, qword [rax]
+add rax, 8
+mov rax, qword [rax]
+mov qword [rbp+-16], rax
+mov rax, 0
+mov rbx, qword [rbp+-24]
+cmp rbx, rax
+je .L27
+.L28:
+mov rax, 0
+mov rbx, qword [rbp+-16]
+cmp rbx, rax
+je .L27
+.L25:
+push qword [rbp+-24]
+mov rax, qword [rbp+-16]
+add rax, 24
+mov rax, qword [rax]
+push rax
+mov rax, qword [rbp+-40]
+mov rax, qword [rax]
+mov rax, qword [rax]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $arm_static_init
+add rsp, 24
+.L26:
+mov rax, qword [rbp+-24]
+add rax, 32
+mov rax, qword [rax]
+mov rbx, qword [rbp+-16]
+add rbx, 32
+mov rbx, qword [rbx]
+mov qword [rbp+-16], rbx
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-24], rax
+je .L27
+.L29:
+mov rax, 0
+mov rbx, qword [rbp+-16]
+cmp rbx, rax
+jne .L25
+.L27:
+mov rax, 0
+mov rbx, qword [rbp+-24]
+cmp rbx, rax
+jne .L31
+.L30:
+mov rax, 0
+mov rbx, qword [rbp+-16]
+cmp rbx, rax
+jne .L33
+.L34:
+mov rax, qword [rbp+-40]
+add rax, 8
+mov rax, qword [rax]
+mov rbx, 0
+cmp rax, rbx
+jne .L33
+.L32:
+mov rax, 1
+mov dword [rbp+-44], eax
+.L33:
+jmp .L24
+.L31:
+.L23:
+mov rax, qword [rbp+-40]
+add rax, 8
+mov rax, qword [rax]
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-40], rax
+jne .L22
+.L24:
+movsx rax, dword [rbp+-44]
+cmp eax, 0
+sete al
+movzx eax, al
+cmp rax, 0
+je .L36
+.L35:
+mov rax, 0
+mov rbx, qword [rbp+-16]
+cmp rbx, rax
+jne .L38
+.L37:
+mov rax, qword [rbp+-40]
+add rax, 8
+mov rax, qword [rax]
+mov rbx, rax
+mov qword [rbp+-40], rax
+mov rbx, qword [rbx]
+add rbx, 8
+mov rbx, qword [rbx]
+mov qword [rbp+-16], rbx
+.L38:
+.L39:
+mov rax, 0
+mov rbx, qword [rbp+-16]
+cmp rbx, rax
+je .L44
+.L42:
+mov rax, qword [rbp+-40]
+mov rax, qword [rax]
+mov rax, qword [rax]
+lea rbx, [rbp+-88]
+mov qword [rbx], rax
+mov rax, qword [rbp+-16]
+add rax, 24
+mov rax, qword [rax]
+lea rbx, [rbp+-88]
+add rbx, 8
+mov qword [rbx], rax
+lea rax, [rbp+-88]
+push rax
+mov rdi, [rsp+0]
+call $get_alignment
+add rsp, 8
+push rax
+mov rax, _@S178
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S179
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+lea rax, [rbp+-88]
+push rax
+mov rdi, [rsp+0]
+call $get_sizeof
+add rsp, 8
+push rax
+mov rax, _@S180
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S181
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, qword [rbp+-16]
+add rax, 32
+mov rax, qword [rax]
+.L43:
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-16], rax
+jne .L42
+.L44:
+mov rax, qword [rbp+-40]
+add rax, 8
+mov rax, qword [rax]
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-40], rax
+je .L46
+.L45:
+mov rax, qword [rbp+-40]
+mov rax, qword [rax]
+add rax, 8
+mov rax, qword [rax]
+mov qword [rbp+-16], rax
+jmp .L47
+.L46:
+jmp .L41
+.L47:
+.L40:
+jmp .L39
+.L41:
+.L36:
+jmp .L19
+.L18:
+mov rax, qword [rbp+-32]
+movsx rax, dword [rax]
+cmp eax, 71
+jne .L49
+.L48:
+mov rax, 0
+mov rbx, qword [rbp+-24]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+mov qword [rbp+-24], rbx
+lea rax, [rbp+-48]
+mov rbx, qword [rbp+-32]
+mov qword [rax], rbx
+mov rax, 0
+lea rbx, [rbp+-48]
+add rbx, 8
+mov qword [rbx], rax
+lea rax, [rbp+-48]
+push rax
+mov rdi, [rsp+0]
+call $get_alignment
+add rsp, 8
+cmp eax, 1
+mov dword [rbp+-52], eax
+jbe .L52
+.L51:
+mov eax, dword [rbp+-52]
+push rax
+mov rax, _@S182
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S183
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L52:
+push qword [rbp+-24]
+mov rax, qword [rbp+-32]
+add rax, 16
+mov rax, qword [rax]
+mov rax, qword [rax]
+add rax, 8
+mov rax, qword [rax]
+add rax, 24
+mov rax, qword [rax]
+push rax
+mov rax, qword [rbp+-32]
+add rax, 16
+mov rax, qword [rax]
+mov rax, qword [rax]
+mov rax, qword [rax]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $arm_static_init
+add rsp, 24
+jmp .L50
+.L49:
+mov rax, qword [rbp+-24]
+add rax, 52
+movsx rax, dword [rax]
+cmp eax, 0
+jne .L54
+.L55:
+mov rax, qword [rbp+-24]
+add rax, 56
+movsx rax, dword [rax]
+cmp eax, 114
+jne .L54
+.L53:
+mov rax, 0
+mov rbx, qword [rbp+-24]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+mov qword [rbp+-24], rbx
+.L54:
+lea rax, [rbp+-48]
+mov rbx, qword [rbp+-8]
+mov qword [rax], rbx
+lea rax, [rbp+-48]
+add rax, 8
+mov rbx, qword [rbp+-16]
+mov qword [rax], rbx
+lea rax, [rbp+-48]
+push rax
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+je .L59
+cmp eax, 111
+je .L59
+cmp eax, 64
+je .L58
+cmp eax, 108
+je .L58
+cmp eax, 49
+je .L57
+cmp eax, 106
+je .L57
+cmp eax, 107
+je .L57
+jmp .L60
+.L57:
+mov rax, _@S184
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+jmp .L56
+.L58:
+mov rax, _@S185
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S186
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S187
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+jmp .L56
+.L59:
+mov rax, _@S188
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S189
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S190
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+push qword [rbp+-24]
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+mov qword [rbp+-56], rax
+mov rax, 0
+lea rbx, [rbp+-56]
+sal rax, 2
+add rbx, rax
+mov ebx, dword [rbx]
+push rbx
+mov rax, _@S191
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S192
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S193
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, 1
+lea rbx, [rbp+-56]
+sal rax, 2
+add rbx, rax
+mov ebx, dword [rbx]
+push rbx
+mov rax, _@S194
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S195
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+jmp .L1
+.L60:
+mov rax, _@S196
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S197
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S198
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L56:
+push qword [rbp+-24]
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+push rax
+mov rax, _@S199
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S200
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L50:
+.L19:
+.L4:
+.L1:
+.L61:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `free_all_temps' ====
+$free_all_temps:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+push rbx
+.L0:
+mov rax, qword [$temp_list]
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-8], rax
+je .L4
+.L2:
+mov rax, qword [rbp+-8]
+mov rbx, qword [rbp+-8]
+add rbx, 16
+mov rbx, qword [rbx]
+push rax
+mov qword [rbp+-8], rbx
+mov rdi, [rsp+0]
+call $free
+add rsp, 8
+.L3:
+mov rax, 0
+mov rbx, qword [rbp+-8]
+cmp rbx, rax
+jne .L2
+.L4:
+mov rax, 0
+mov qword [$temp_list], rax
+.L1:
+.L5:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_llzx' ====
+$arm_llzx:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg2
+add rsp, 8
+mov [rbp+-48], rax
+lea rax, [rbp+-48]                             
+mov ebx, dword [rbp+-24]
+push rbx
+lea rbx, [rbp+-36]
+mov rsi, rax
+lea rdi, [rbp+-36]
+mov ecx, 4
+rep movsb
+movsx rbx, word [rbx]
+push rbx
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+lea rax, [rbp+-36]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S201
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+.L4:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-36]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors2
+add rsp, 32
+.L2:
+.L3:
+.L1:
+.L5:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_mul' ====
+$arm_mul:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+push 0
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $arm_do_libcall
+add rsp, 40
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+push 0
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_get_operand
+add rsp, 16
+push rax
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S202
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+.L8:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L6:
+.L7:
+.L4:
+.L1:
+.L9:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_ind' ====
+$arm_ind:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+call $spill_aliased_objects
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg2
+add rsp, 8
+mov [rbp+-48], rax
+lea rax, [rbp+-48]                             
+mov ebx, dword [rbp+-24]
+push rbx
+lea rbx, [rbp+-40]
+mov rsi, rax
+lea rdi, [rbp+-40]
+mov ecx, 4
+rep movsb
+movsx rbx, word [rbx]
+push rbx
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+lea rax, [rbp+-40]
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-40]
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-40]
+movsx rax, word [rax]
+push rax
+mov rax, _@S203
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+.L8:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-40]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors2
+add rsp, 32
+.L6:
+.L7:
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+movsx rax, dword [rbp+-36]
+cmp eax, 107
+je .L14
+cmp eax, 49
+je .L13
+cmp eax, 106
+je .L13
+cmp eax, 108
+je .L12
+cmp eax, 64
+je .L11
+cmp eax, 68
+je .L10
+cmp eax, 71
+je .L10
+jmp .L15
+.L10:
+jmp .L9
+.L11:
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S204
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L9
+.L12:
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S205
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L9
+.L13:
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S206
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L9
+.L14:
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S207
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L9
+.L15:
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S208
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L9:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L16:
+.L17:
+.L4:
+.L1:
+.L18:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_add' ====
+$arm_add:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg2
+add rsp, 8
+mov [rbp+-64], rax
+lea rax, [rbp+-64]                             
+mov ebx, dword [rbp+-24]
+push rbx
+sub rsp, 8
+mov rsi, rax
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rsi, rax
+lea rdi, [rbp+-52]
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+lea rax, [rbp+-52]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 1
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+call $arm_get_operand2
+add rsp, 8
+mov rbx, 0
+sal rbx, 3
+mov rcx, rax
+add rcx, rbx
+mov rcx, qword [rcx]
+push rcx
+lea rbx, [rbp+-52]
+movsx rbx, word [rbx]
+push rbx
+lea rbx, [rbp+-52]
+movsx rbx, word [rbx]
+push rbx
+mov rbx, _@S209
+push rbx
+push 1
+mov qword [rbp+-48], rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+mov rax, 1
+sal rax, 3
+mov rbx, qword [rbp+-48]
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S210
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+lea rax, [rbp+-52]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+.L8:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-52]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors2
+add rsp, 32
+.L6:
+.L7:
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+push 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_get_operand
+add rsp, 16
+push rax
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S211
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+.L11:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L9:
+.L10:
+.L4:
+.L1:
+.L12:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_rem' ====
+$arm_rem:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+movsx rax, dword [rbp+-36]
+push rax
+mov rdi, [rsp+0]
+call $is_signed_int
+add rsp, 8
+cmp rax, 0
+je .L7
+.L6:
+mov rax, 3
+mov qword [rbp+-48], rax
+jmp .L8
+.L7:
+mov rax, 4
+mov qword [rbp+-48], rax
+.L8:
+push qword [rbp+-48]
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $arm_do_libcall
+add rsp, 40
+jmp .L4
+.L3:
+mov rax, 4
+mov word [rbp+-38], ax
+call $arm_save_arg_regs
+mov eax, dword [rbp+-24]
+push rax
+mov rax, 0
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+mov eax, dword [rbp+-32]
+push rax
+mov rax, 1
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+call $spill_all
+movsx rax, dword [rbp+-36]
+push rax
+mov rdi, [rsp+0]
+call $is_unsigned_int
+add rsp, 8
+cmp rax, 0
+je .L10
+.L9:
+mov rax, _@S212
+mov qword [rbp+-48], rax
+jmp .L11
+.L10:
+mov rax, _@S213
+mov qword [rbp+-48], rax
+.L11:
+push qword [rbp+-48]
+mov rax, _@S214
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S215
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+call $arm_restore_arg_regs
+.L14:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L12:
+.L13:
+.L4:
+.L1:
+.L15:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_ret' ====
+$arm_ret:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+cmp dword [$qword_return], 0
+je .L3
+.L2:
+lea rax, [rbp+-36]
+mov rbx, 0
+mov word [rax], bx
+lea rax, [rbp+-36]
+add rax, 2
+mov rbx, 1
+mov word [rax], bx
+mov eax, dword [rbp+-24]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-36]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+jmp .L4
+.L3:
+cmp dword [$struct_union_return], 0
+je .L6
+.L5:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_sizeof
+add rsp, 8
+cmp eax, 4
+mov dword [rbp+-36], eax
+jbe .L9
+.L8:
+mov rax, _@S216
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S217
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+push 12
+mov rax, _@S218
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov eax, dword [rbp+-24]
+push rax
+mov rax, 12
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+push 12
+mov rax, _@S219
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov eax, dword [rbp+-36]
+push rax
+push 12
+mov rax, _@S220
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+mov rax, _@S221
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov rax, _@S222
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L10
+.L9:
+mov eax, dword [rbp+-24]
+push rax
+mov rax, 0
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+mov eax, dword [rbp+-36]
+cmp eax, 2
+je .L13
+cmp eax, 1
+je .L12
+jmp .L14
+.L12:
+mov rax, _@S223
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L11
+.L13:
+mov rax, _@S224
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L11
+.L14:
+mov rax, _@S225
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+.L11:
+.L10:
+jmp .L7
+.L6:
+mov eax, dword [rbp+-24]
+push rax
+mov rax, 0
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+.L7:
+.L4:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+.L1:
+.L15:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_get_operand' ====
+$arm_get_operand:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+push rbx
+.L0:
+cmp dword [rbp+-16], 0
+je .L3
+.L5:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+jne .L3
+.L2:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $is_representable_in_imm12
+add rsp, 8
+cmp rax, 0
+je .L7
+.L6:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S226
+push rax
+mov rax, $arm_get_operand@op
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $sprintf
+add rsp, 24
+mov rax, $arm_get_operand@op
+jmp .L1
+.L7:
+jmp .L4
+.L3:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 2
+je .L8
+.L10:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 3
+jne .L9
+.L8:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L12
+.L11:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+push rax
+mov rax, _@S227
+push rax
+mov rax, $arm_get_operand@op
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $sprintf
+add rsp, 24
+mov rax, $arm_get_operand@op
+jmp .L1
+.L12:
+.L9:
+.L4:
+call $get_reg0
+mov ebx, dword [rbp+-8]
+push rbx
+push rax
+mov word [rbp+-18], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+movsx rax, word [rbp+-18]
+push rax
+mov rax, _@S228
+push rax
+mov rax, $arm_get_operand@op
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $sprintf
+add rsp, 24
+mov rax, $arm_get_operand@op
+.L1:
+.L13:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `spill_aliased_objects' ====
+$spill_aliased_objects:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+push rbx
+.L0:
+mov rax, 0
+cmp eax, 16
+mov dword [rbp+-4], eax
+jge .L4
+.L2:
+movsx rax, dword [rbp+-4]
+mov rbx, $reg_descr_tab
+sal rax, 2
+add rbx, rax
+mov ebx, dword [rbx]
+cmp ebx, 0
+jne .L6
+.L5:
+jmp .L3
+.L6:
+movsx rax, dword [rbp+-4]
+mov rbx, $reg_descr_tab
+sal rax, 2
+add rbx, rax
+mov ebx, dword [rbx]
+mov rax, rbx
+mov eax, eax
+mov dword [rbp+-8], ebx
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 2
+jne .L8
+.L9:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+push rbx
+push qword [$address_taken_variables]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $bset_member
+add rsp, 16
+cmp rax, 0
+je .L8
+.L7:
+movsx rax, dword [rbp+-4]
+movsx rax, ax
+push rax
+mov rdi, [rsp+0]
+call $spill_reg
+add rsp, 8
+.L8:
+.L3:
+movsx rax, dword [rbp+-4]
+add eax, 1
+cmp eax, 16
+mov dword [rbp+-4], eax
+jl .L2
+.L4:
+.L1:
+.L10:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_switch' ====
+$arm_switch:
+push rbp
+mov rbp, rsp
+sub rsp, 352
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L4:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $arm_do_switch64
+add rsp, 32
+jmp .L1
+.L3:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+jne .L6
+.L5:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+jmp .L7
+.L6:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov word [rbp+-38], ax
+.L7:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+mov eax, dword [rbp+-32]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+mov rax, 1
+sub rbx, rax
+movsx rax, dword [rbp+-8]
+add eax, 1
+mov dword [rbp+-8], eax
+cmp ebx, 3
+mov dword [rbp+-324], ebx
+jl .L9
+.L8:
+movsx rax, dword [rbp+-8]
+mov dword [rbp+-344], eax
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 16
+mov ebx, dword [rbx]
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rcx, qword [$ic_instructions]
+add rcx, rax
+add rcx, 20
+mov ecx, dword [rcx]
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rcx, qword [$ic_instructions]
+add rcx, rax
+add rcx, 24
+mov ecx, dword [rcx]
+mov ebx, ebx
+sal rbx, 5
+mov rax, qword [$ic_addresses]
+add rax, rbx
+add rax, 8
+mov rax, qword [rax]
+mov rbx, rax
+mov dword [rbp+-332], eax
+mov dword [rbp+-328], ebx
+movsx rax, dword [rbp+-8]
+add eax, 1
+mov dword [rbp+-8], eax
+.L10:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 16
+mov ebx, dword [rbx]
+mov dword [rbp+-16], ebx
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 20
+mov ebx, dword [rbx]
+mov dword [rbp+-24], ebx
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 24
+mov ebx, dword [rbx]
+mov ebx, ebx
+sal rbx, 5
+mov rax, qword [$ic_addresses]
+add rax, rbx
+add rax, 8
+mov rax, qword [rax]
+cmp rax, 0
+je .L14
+.L13:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+mov dword [rbp+-44], ebx
+jmp .L12
+.L14:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+movsx rax, dword [rbp+-328]
+cmp rbx, rax
+jge .L16
+.L15:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+mov dword [rbp+-328], ebx
+jmp .L17
+.L16:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+movsx rax, dword [rbp+-332]
+cmp rbx, rax
+jle .L19
+.L18:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+mov dword [rbp+-332], ebx
+.L19:
+.L17:
+.L11:
+movsx rax, dword [rbp+-8]
+add eax, 1
+mov dword [rbp+-8], eax
+jmp .L10
+.L12:
+movsx rax, dword [rbp+-344]
+mov dword [rbp+-8], eax
+movsx rax, dword [rbp+-332]
+sub eax, dword [rbp+-328]
+add eax, 1
+mov rbx, rax
+sub ebx, dword [rbp+-324]
+mov dword [rbp+-336], eax
+cmp ebx, 10
+mov dword [rbp+-340], ebx
+jg .L21
+.L20:
+jmp .L22
+.L21:
+.L9:
+jmp .L55
+.L22:
+movsx rax, dword [rbp+-332]
+push rax
+mov rdi, [rsp+0]
+call $is_representable_in_imm12
+add rsp, 8
+cmp rax, 0
+je .L24
+.L23:
+movsx rax, dword [rbp+-332]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S229
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L25
+.L24:
+movsx rax, dword [rbp+-332]
+push rax
+push 12
+mov rax, _@S230
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S231
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L25:
+movsx rax, dword [rbp+-44]
+push rax
+push qword [$curr_func]
+mov rax, _@S232
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, dword [rbp+-328]
+push rax
+mov rdi, [rsp+0]
+call $is_representable_in_imm12
+add rsp, 8
+cmp rax, 0
+je .L27
+.L26:
+movsx rax, dword [rbp+-328]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S233
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, dword [rbp+-44]
+push rax
+push qword [$curr_func]
+mov rax, _@S234
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, dword [rbp+-328]
+cmp eax, 0
+je .L30
+.L29:
+movsx rax, dword [rbp+-328]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S235
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+.L30:
+jmp .L28
+.L27:
+movsx rax, dword [rbp+-328]
+push rax
+push 12
+mov rax, _@S236
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S237
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, dword [rbp+-44]
+push rax
+push qword [$curr_func]
+mov rax, _@S238
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, dword [rbp+-328]
+cmp eax, 0
+je .L32
+.L31:
+push 12
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S239
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+.L32:
+.L28:
+movsx rax, dword [$jump_tables_counter]
+push rax
+push 12
+mov rax, _@S240
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, word [rbp+-38]
+push rax
+push 12
+mov rax, _@S241
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 8
+movsx rax, dword [rbp+-336]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $calloc
+add rsp, 16
+mov qword [rbp+-64], rax
+push 0
+movsx rax, dword [rbp+-336]
+sal eax, 8
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arena_new
+add rsp, 16
+mov qword [rbp+-56], rax
+movsx rax, dword [rbp+-44]
+push rax
+push qword [$curr_func]
+mov rax, _@S242
+push rax
+lea rax, [rbp+-320]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $sprintf
+add rsp, 32
+.L33:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 16
+mov ebx, dword [rbx]
+mov dword [rbp+-16], ebx
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 20
+mov ebx, dword [rbx]
+mov dword [rbp+-24], ebx
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 24
+mov ebx, dword [rbx]
+mov ebx, ebx
+sal rbx, 5
+mov rax, qword [$ic_addresses]
+add rax, rbx
+add rax, 8
+mov rax, qword [rax]
+cmp rax, 0
+je .L37
+.L36:
+jmp .L35
+.L37:
+push 256
+push qword [rbp+-56]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arena_alloc
+add rsp, 16
+mov ebx, dword [rbp+-24]
+sal rbx, 5
+mov rcx, qword [$ic_addresses]
+add rcx, rbx
+add rcx, 8
+mov rcx, qword [rcx]
+push rcx
+push qword [$curr_func]
+mov rbx, _@S243
+push rbx
+push rax
+mov qword [rbp+-352], rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $sprintf
+add rsp, 32
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+movsx rax, dword [rbp+-328]
+sub rbx, rax
+sal rbx, 3
+mov rax, qword [rbp+-64]
+add rax, rbx
+mov rbx, qword [rbp+-352]
+mov qword [rax], rbx
+.L34:
+movsx rax, dword [rbp+-8]
+add eax, 1
+mov dword [rbp+-8], eax
+jmp .L33
+.L35:
+mov rax, 0
+mov dword [rbp+-8], eax
+cmp dword [rbp+-340], 0
+je .L40
+.L38:
+movsx rax, dword [rbp+-8]
+sal rax, 3
+mov rbx, qword [rbp+-64]
+add rbx, rax
+mov rbx, qword [rbx]
+mov rax, 0
+cmp rbx, rax
+jne .L42
+.L41:
+lea rax, [rbp+-320]
+movsx rbx, dword [rbp+-8]
+sal rbx, 3
+mov rcx, qword [rbp+-64]
+add rcx, rbx
+mov qword [rcx], rax
+movsx rax, dword [rbp+-340]
+sub eax, 1
+mov dword [rbp+-340], eax
+.L42:
+.L39:
+movsx rax, dword [rbp+-8]
+add eax, 1
+mov dword [rbp+-8], eax
+cmp dword [rbp+-340], 0
+jne .L38
+.L40:
+mov rax, _@S244
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, 0
+mov dword [$offs_to_lit_tab], eax
+.L45:
+movsx rax, dword [$curr_segment]
+cmp eax, 3
+je .L47
+.L46:
+mov rax, 3
+mov rbx, $str_segment
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S245
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov rax, 3
+mov dword [$curr_segment], eax
+.L47:
+.L43:
+.L44:
+movsx rax, dword [$d_mapsym_counter]
+mov rbx, rax
+add ebx, 1
+mov dword [$d_mapsym_counter], ebx
+push rax
+mov rax, _@S246
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+movsx rax, dword [$jump_tables_counter]
+mov rbx, rax
+add ebx, 1
+mov dword [$jump_tables_counter], ebx
+push rax
+mov rax, _@S247
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov rax, 0
+cmp eax, dword [rbp+-336]
+mov dword [rbp+-8], eax
+jge .L50
+.L48:
+movsx rax, dword [rbp+-8]
+sal rax, 3
+mov rbx, qword [rbp+-64]
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S248
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+.L49:
+movsx rax, dword [rbp+-8]
+add eax, 1
+cmp eax, dword [rbp+-336]
+mov dword [rbp+-8], eax
+jl .L48
+.L50:
+movsx rax, dword [$curr_segment]
+cmp eax, 1
+je .L54
+.L53:
+mov rax, 1
+mov rbx, $str_segment
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S249
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov rax, 1
+mov dword [$curr_segment], eax
+.L54:
+.L51:
+.L52:
+movsx rax, dword [$a_mapsym_counter]
+mov rbx, rax
+add ebx, 1
+mov dword [$a_mapsym_counter], ebx
+push rax
+mov rax, _@S250
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+push qword [rbp+-64]
+mov rdi, [rsp+0]
+call $free
+add rsp, 8
+push qword [rbp+-56]
+mov rdi, [rsp+0]
+call $arena_destroy
+add rsp, 8
+jmp .L1
+.L55:
+.L56:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 16
+mov ebx, dword [rbx]
+mov dword [rbp+-16], ebx
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 20
+mov ebx, dword [rbx]
+mov dword [rbp+-24], ebx
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 24
+mov ebx, dword [rbx]
+mov ebx, ebx
+sal rbx, 5
+mov rax, qword [$ic_addresses]
+add rax, rbx
+add rax, 8
+mov rax, qword [rax]
+cmp rax, 0
+je .L60
+.L59:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+push qword [$curr_func]
+mov rax, _@S251
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L58
+.L60:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $is_representable_in_imm12
+add rsp, 8
+cmp rax, 0
+je .L62
+.L61:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S252
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L63
+.L62:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+push 12
+mov rax, _@S253
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S254
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L63:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+push qword [$curr_func]
+mov rax, _@S255
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L57:
+movsx rax, dword [rbp+-8]
+add eax, 1
+mov dword [rbp+-8], eax
+jmp .L56
+.L58:
+.L1:
+.L64:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_get_operand2' ====
+$arm_get_operand2:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp+-8], rdi
+push rbx
+.L0:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 2
+je .L4
+.L5:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 3
+jne .L3
+.L4:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L3
+.L2:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+add rax, 2
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L7
+.L6:
+mov rax, 0
+jmp .L8
+.L7:
+push 602
+mov rax, _@S256
+push rax
+mov rax, _@S257
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L8:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+push rax
+mov rax, _@S258
+push rax
+mov rax, $arm_get_operand2@op1
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $sprintf
+add rsp, 24
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S259
+push rax
+mov rax, $arm_get_operand2@op2
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $sprintf
+add rsp, 24
+mov rax, $arm_get_operand2@op
+jmp .L1
+.L3:
+call $get_reg0
+lea rbx, [rbp+-12]
+mov word [rbx], ax
+lea rax, [rbp+-12]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 1
+call $get_reg0
+lea rbx, [rbp+-12]
+add rbx, 2
+mov word [rbx], ax
+lea rax, [rbp+-12]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+mov eax, dword [rbp+-8]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-12]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+lea rax, [rbp+-12]
+movsx rax, word [rax]
+push rax
+mov rax, _@S260
+push rax
+mov rax, $arm_get_operand2@op1
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $sprintf
+add rsp, 24
+lea rax, [rbp+-12]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S261
+push rax
+mov rax, $arm_get_operand2@op2
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $sprintf
+add rsp, 24
+mov rax, $arm_get_operand2@op
+.L1:
+.L9:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `free_temp' ====
+$free_temp:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp+-8], rdi
+push rbx
+.L0:
+mov rax, qword [$temp_list]
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-16], rax
+je .L4
+.L2:
+mov rax, qword [rbp+-16]
+add rax, 8
+movsx rax, dword [rax]
+cmp eax, 0
+sete al
+movzx eax, al
+cmp rax, 0
+je .L6
+.L7:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+mov rax, qword [rbp+-16]
+movsx rax, dword [rax]
+cmp eax, ebx
+jne .L6
+.L5:
+mov rax, qword [rbp+-16]
+add rax, 8
+mov dword [rax], 1
+jmp .L4
+.L6:
+.L3:
+mov rax, qword [rbp+-16]
+add rax, 16
+mov rax, qword [rax]
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-16], rax
+jne .L2
+.L4:
+.L1:
+.L8:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_neg' ====
+$arm_neg:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg2
+add rsp, 8
+mov [rbp+-48], rax
+lea rax, [rbp+-48]                             
+mov ebx, dword [rbp+-24]
+push rbx
+sub rsp, 8
+mov rsi, rax
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rsi, rax
+lea rdi, [rbp+-40]
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+lea rax, [rbp+-40]
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-40]
+movsx rax, word [rax]
+push rax
+mov rax, _@S262
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+lea rax, [rbp+-40]
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-40]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S263
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L8:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-40]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors2
+add rsp, 32
+.L6:
+.L7:
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S264
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L11:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L9:
+.L10:
+.L4:
+.L1:
+.L12:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_neq' ====
+$arm_neq:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+mov rax, 2
+mov rcx, rbx
+and rcx, rax
+mov qword [rbp+-40], rbx
+cmp rcx, 0
+je .L3
+.L2:
+push 9
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $arm_do_libcall
+add rsp, 40
+jmp .L4
+.L3:
+mov rax, 4
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+jne .L5
+.L9:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+je .L5
+.L10:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 1
+je .L5
+.L8:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+jne .L6
+.L5:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-42], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+jmp .L7
+.L6:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov word [rbp+-42], ax
+.L7:
+mov rax, $pinned
+movsx rbx, word [rbp+-42]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+push 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_get_operand
+add rsp, 16
+push rax
+movsx rax, word [rbp+-42]
+push rax
+mov rax, _@S265
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov rax, $pinned
+movsx rbx, word [rbp+-42]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+mov rax, 4
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L12
+.L11:
+movsx rax, word [rbp+-42]
+push rax
+mov rax, _@S266
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+movsx rax, word [rbp+-42]
+push rax
+mov rax, _@S267
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+.L16:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-42]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L14:
+.L15:
+jmp .L13
+.L12:
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+push qword [rbp+-40]
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $do_relop_jump
+add rsp, 40
+.L13:
+.L4:
+.L1:
+.L17:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_save_restore_var_regs' ====
+$arm_save_restore_var_regs:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp+-8], rdi
+push rbx
+.L0:
+mov rax, 4
+mov rbx, $modified
+sal rax, 2
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+sete bl
+movzx ebx, bl
+cmp rbx, 0
+je .L3
+.L2:
+jmp .L1
+.L3:
+cmp dword [$verbose_asm], 0
+je .L5
+.L4:
+mov rax, _@S268
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S269
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L5:
+movsx rax, dword [rbp+-8]
+neg eax
+push rax
+mov rdi, [rsp+0]
+call $is_representable_in_imm12
+add rsp, 8
+cmp rax, 0
+mov dword [rbp+-16], eax
+je .L7
+.L6:
+movsx rax, dword [rbp+-8]
+neg eax
+push rax
+push 12
+mov rax, _@S270
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $string_printf
+add rsp, 32
+mov rax, _@S271
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+jmp .L8
+.L7:
+movsx rax, dword [rbp+-8]
+neg eax
+push rax
+push 12
+mov rax, _@S272
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $string_printf
+add rsp, 32
+mov rax, _@S273
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+push 12
+push 12
+mov rax, _@S274
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $string_printf
+add rsp, 32
+mov rax, _@S275
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L8:
+push 12
+mov rax, _@S276
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+cmp dword [$verbose_asm], 0
+je .L10
+.L9:
+mov rax, _@S277
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S278
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L10:
+cmp dword [rbp+-16], 0
+je .L12
+.L11:
+movsx rax, dword [rbp+-8]
+neg eax
+push rax
+push 12
+mov rax, _@S279
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $string_printf
+add rsp, 32
+mov rax, _@S280
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+jmp .L13
+.L12:
+movsx rax, dword [rbp+-8]
+neg eax
+push rax
+push 12
+mov rax, _@S281
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $string_printf
+add rsp, 32
+mov rax, _@S282
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+push 12
+push 12
+mov rax, _@S283
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $string_printf
+add rsp, 32
+mov rax, _@S284
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L13:
+push 12
+mov rax, _@S285
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, 5
+cmp eax, 11
+mov dword [rbp+-12], eax
+jge .L16
+.L14:
+movsx rax, dword [rbp+-12]
+mov rbx, $modified
+sal rax, 2
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp rbx, 0
+je .L18
+.L17:
+movsx rax, dword [rbp+-12]
+push rax
+mov rax, _@S286
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+movsx rax, dword [rbp+-12]
+push rax
+mov rax, _@S287
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+jmp .L19
+.L18:
+jmp .L16
+.L19:
+.L15:
+movsx rax, dword [rbp+-12]
+add eax, 1
+cmp eax, 11
+mov dword [rbp+-12], eax
+jl .L14
+.L16:
+mov rax, _@S288
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S289
+push rax
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S290
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S291
+push rax
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L1:
+.L20:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_and' ====
+$arm_and:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg2
+add rsp, 8
+mov [rbp+-64], rax
+lea rax, [rbp+-64]                             
+mov ebx, dword [rbp+-24]
+push rbx
+sub rsp, 8
+mov rsi, rax
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rsi, rax
+lea rdi, [rbp+-52]
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+lea rax, [rbp+-52]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 1
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+call $arm_get_operand2
+add rsp, 8
+mov rbx, 0
+sal rbx, 3
+mov rcx, rax
+add rcx, rbx
+mov rcx, qword [rcx]
+push rcx
+lea rbx, [rbp+-52]
+movsx rbx, word [rbx]
+push rbx
+lea rbx, [rbp+-52]
+movsx rbx, word [rbx]
+push rbx
+mov rbx, _@S292
+push rbx
+push 1
+mov qword [rbp+-48], rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+mov rax, 1
+sal rax, 3
+mov rbx, qword [rbp+-48]
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S293
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+lea rax, [rbp+-52]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+.L8:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-52]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors2
+add rsp, 32
+.L6:
+.L7:
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+push 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_get_operand
+add rsp, 16
+push rax
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S294
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+.L11:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L9:
+.L10:
+.L4:
+.L1:
+.L12:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_cgen' ====
+global $arm_cgen
+$arm_cgen:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp+-8], rdi
+push rbx
+.L0:
+mov rax, qword [rbp+-8]
+mov qword [$arm_output_file], rax
+lea rax, [rbp+-40]
+push rax
+lea rax, [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $ic_main
+add rsp, 16
+call $compute_liveness_and_next_use
+push 512
+mov rdi, [rsp+0]
+call $string_new
+add rsp, 8
+mov qword [$asm_decls], rax
+push 512
+mov rdi, [rsp+0]
+call $string_new
+add rsp, 8
+mov qword [$str_lits], rax
+push 1024
+mov rdi, [rsp+0]
+call $string_new
+add rsp, 8
+mov qword [$func_body], rax
+push 1024
+mov rdi, [rsp+0]
+call $string_new
+add rsp, 8
+mov qword [$func_prolog], rax
+push 1024
+mov rdi, [rsp+0]
+call $string_new
+add rsp, 8
+mov qword [$func_epilog], rax
+movsx rax, dword [$nid_counter]
+sal rax, 2
+push rax
+mov rdi, [rsp+0]
+call $malloc
+add rsp, 8
+movsx rbx, dword [$nid_counter]
+sal rbx, 2
+push rbx
+mov rbx, -1
+push rbx
+push rax
+mov qword [$addr_descr_tab], rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $memset
+add rsp, 24
+mov rax, 0
+mov rbx, rax
+mov ebx, ebx
+mov dword [rbp+-12], eax
+sal rbx, 3
+mov rax, qword [rbp+-32]
+add rax, rbx
+mov rax, qword [rax]
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-24], rax
+je .L4
+.L2:
+mov rax, qword [rbp+-24]
+add rax, 8
+mov rax, qword [rax]
+push rax
+mov rax, qword [rbp+-24]
+mov rax, qword [rax]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_function_definition
+add rsp, 16
+.L3:
+mov eax, dword [rbp+-12]
+add eax, 1
+mov rbx, rax
+mov ebx, ebx
+mov dword [rbp+-12], eax
+sal rbx, 3
+mov rax, qword [rbp+-32]
+add rax, rbx
+mov rax, qword [rax]
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-24], rax
+jne .L2
+.L4:
+push qword [$func_body]
+mov rdi, [rsp+0]
+call $string_free
+add rsp, 8
+push qword [$func_prolog]
+mov rdi, [rsp+0]
+call $string_free
+add rsp, 8
+push qword [$func_epilog]
+mov rdi, [rsp+0]
+call $string_free
+add rsp, 8
+mov rax, _@S295
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S296
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+call $arm_allocate_static_objects
+mov rax, _@S297
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S298
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, 0
+mov rbx, rax
+mov ebx, ebx
+mov dword [rbp+-16], eax
+sal rbx, 3
+mov rax, qword [rbp+-40]
+add rax, rbx
+mov rax, qword [rax]
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-24], rax
+je .L7
+.L5:
+movsx rax, dword [$nid_counter]
+push 0
+mov rbx, qword [rbp+-24]
+add rbx, 8
+mov rbx, qword [rbx]
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov dword [rbp+-44], eax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $get_var_nid
+add rsp, 16
+movsx rax, dword [rbp+-44]
+cmp eax, dword [$nid_counter]
+jne .L9
+.L8:
+mov rax, qword [rbp+-24]
+add rax, 8
+mov rax, qword [rax]
+add rax, 8
+mov rax, qword [rax]
+push rax
+mov rax, _@S299
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S300
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L9:
+.L6:
+mov eax, dword [rbp+-16]
+add eax, 1
+mov rbx, rax
+mov ebx, ebx
+mov dword [rbp+-16], eax
+sal rbx, 3
+mov rax, qword [rbp+-40]
+add rax, rbx
+mov rax, qword [rax]
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-24], rax
+jne .L5
+.L7:
+cmp dword [$include_libc], 0
+je .L11
+.L10:
+mov rax, _@S301
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S302
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S303
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S304
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L11:
+mov rax, _@S305
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S306
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+cmp dword [$include_liblux], 0
+je .L13
+.L12:
+mov rax, _@S307
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S308
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S309
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S310
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S311
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S312
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S313
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S314
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S315
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S316
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S317
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S318
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S319
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S320
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S321
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S322
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S323
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S324
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S325
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S326
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S327
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S328
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S329
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S330
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S331
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S332
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S333
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, _@S334
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+.L13:
+push qword [$arm_output_file]
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $string_write
+add rsp, 16
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+call $string_free
+add rsp, 8
+cmp dword [$string_literals_counter], 0
+je .L15
+.L14:
+mov rax, _@S335
+push rax
+push qword [$arm_output_file]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $fprintf
+add rsp, 16
+mov rax, _@S336
+push rax
+push qword [$arm_output_file]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $fprintf
+add rsp, 16
+movsx rax, dword [$d_mapsym_counter]
+push rax
+mov rax, _@S337
+push rax
+push qword [$arm_output_file]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $fprintf
+add rsp, 24
+push qword [$arm_output_file]
+push qword [$str_lits]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $string_write
+add rsp, 16
+.L15:
+push qword [$str_lits]
+mov rdi, [rsp+0]
+call $string_free
+add rsp, 8
+.L1:
+.L16:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `dump_and_link' ====
+$dump_and_link:
+push rbp
+mov rbp, rsp
+push rbx
+.L0:
+movsx rax, dword [$code_cont_counter]
+push rax
+mov rax, _@S338
+push rax
+push qword [$func_body]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S339
+push rax
+push qword [$func_body]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+movsx rax, dword [$a_mapsym_counter]
+mov rbx, rax
+add ebx, 1
+mov dword [$a_mapsym_counter], ebx
+push rax
+mov rax, _@S340
+push rax
+push qword [$func_body]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+movsx rax, dword [$code_cont_counter]
+push rax
+mov rax, _@S341
+push rax
+push qword [$func_body]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, 0
+mov dword [$offs_to_lit_tab], eax
+movsx rax, dword [$code_cont_counter]
+add eax, 1
+mov dword [$code_cont_counter], eax
+.L1:
+.L2:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_arg' ====
+$arm_arg:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+mov eax, dword [rbp+-32]
+cmp eax, 0
+je .L3
+.L2:
+mov rax, 0
+push rax
+mov rdi, [rsp+0]
+call $spill_reg
+add rsp, 8
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_sizeof
+add rsp, 8
+cmp eax, dword [$temp_struct_size]
+mov dword [rbp+-52], eax
+jbe .L5
+.L4:
+mov eax, dword [rbp+-52]
+mov dword [$temp_struct_size], eax
+.L5:
+push qword [$func_body]
+mov rdi, [rsp+0]
+call $string_get_pos
+add rsp, 8
+movsx rbx, dword [$calls_to_fix_counter]
+mov rcx, rbx
+add ecx, 1
+mov dword [$calls_to_fix_counter], ecx
+movsx rbx, ebx
+mov rcx, $calls_to_fix
+sal rbx, 2
+add rcx, rbx
+mov dword [rcx], eax
+mov rax, _@S342
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+movsx rax, dword [$arg_offs]
+add eax, 4
+mov dword [$arg_offs], eax
+jmp .L1
+.L3:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+mov rax, rbx
+add rax, 8
+mov qword [rbp+-48], rbx
+mov rax, qword [rax]
+mov rbx, 0
+cmp rax, rbx
+je .L6
+.L9:
+mov rax, qword [rbp+-48]
+add rax, 8
+mov rax, qword [rax]
+movsx rax, dword [rax]
+cmp eax, 76
+je .L7
+.L6:
+mov rax, 0
+jmp .L8
+.L7:
+push 1959
+mov rax, _@S343
+push rax
+mov rax, _@S344
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L8:
+push qword [rbp+-48]
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L10
+.L13:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L11
+.L10:
+push 8
+movsx rax, dword [$arg_offs]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $round_up
+add rsp, 16
+cmp eax, 16
+mov dword [$arg_offs], eax
+jge .L15
+.L14:
+movsx rax, dword [$arg_offs]
+cdq
+mov rbx, 4
+idiv ebx
+movsx rax, ax
+lea rbx, [rbp+-52]
+mov word [rbx], ax
+lea rax, [rbp+-52]
+movsx rax, word [rax]
+add eax, 1
+movsx rax, ax
+lea rbx, [rbp+-52]
+add rbx, 2
+mov word [rbx], ax
+lea rax, [rbp+-52]
+movsx rax, word [rax]
+push rax
+mov rdi, [rsp+0]
+call $spill_reg
+add rsp, 8
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rdi, [rsp+0]
+call $spill_reg
+add rsp, 8
+mov eax, dword [rbp+-24]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-52]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+jmp .L16
+.L15:
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+call $arm_get_operand2
+add rsp, 8
+mov qword [rbp+-56], rax
+movsx rax, dword [$arg_offs]
+sub eax, 16
+add eax, 4
+cmp eax, 4095
+mov dword [rbp+-60], eax
+jle .L18
+.L17:
+movsx rax, dword [rbp+-60]
+sub eax, 4
+push rax
+push 12
+mov rax, _@S345
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+mov rax, 0
+sal rax, 3
+mov rbx, qword [rbp+-56]
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S346
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+push 12
+mov rax, _@S347
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+mov rax, 1
+sal rax, 3
+mov rbx, qword [rbp+-56]
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S348
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L19
+.L18:
+movsx rax, dword [rbp+-60]
+sub eax, 4
+push rax
+mov rax, 0
+sal rax, 3
+mov rbx, qword [rbp+-56]
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S349
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, dword [rbp+-60]
+push rax
+mov rax, 1
+sal rax, 3
+mov rbx, qword [rbp+-56]
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S350
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L19:
+.L16:
+movsx rax, dword [$arg_offs]
+add eax, 8
+mov dword [$arg_offs], eax
+jmp .L12
+.L11:
+movsx rax, dword [rbp+-36]
+cmp eax, 68
+je .L20
+.L23:
+movsx rax, dword [rbp+-36]
+cmp eax, 71
+jne .L21
+.L20:
+push qword [rbp+-48]
+mov rdi, [rsp+0]
+call $get_sizeof
+add rsp, 8
+push 4
+push rax
+mov dword [rbp+-52], eax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $round_up
+add rsp, 16
+mov dword [rbp+-56], eax
+push qword [rbp+-48]
+mov rdi, [rsp+0]
+call $get_alignment
+add rsp, 8
+push rax
+movsx rax, dword [$arg_offs]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $round_up
+add rsp, 16
+cmp eax, 16
+mov dword [$arg_offs], eax
+jge .L25
+.L24:
+mov eax, dword [rbp+-56]
+shr eax, 2
+mov dword [rbp+-60], eax
+movsx rax, dword [$arg_offs]
+cdq
+mov rbx, 4
+idiv ebx
+mov rbx, 4
+sub ebx, eax
+movsx rax, dword [$arg_offs]
+cdq
+mov rcx, 4
+idiv ecx
+movsx rax, ax
+mov word [rbp+-66], ax
+movsx rax, dword [rbp+-60]
+cmp eax, ebx
+mov dword [rbp+-64], ebx
+jg .L28
+.L27:
+mov eax, dword [rbp+-24]
+push rax
+mov rax, 12
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+movsx rax, dword [rbp+-60]
+mov rbx, 1
+mov rcx, 4
+cmp rax, rbx
+jl .L30
+cmp rax, rcx
+jg .L30
+sub rax, rbx
+jmp [rax*8+.jt2]
+segment .rodata
+.jt2:
+dq .L31
+dq .L32
+dq .L33
+dq .L34
+segment .text
+.L31:
+push 12
+movsx rax, word [rbp+-66]
+push rax
+mov rax, _@S351
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L30
+.L32:
+movsx rax, word [rbp+-66]
+add eax, 1
+push rax
+movsx rax, word [rbp+-66]
+push rax
+push 12
+mov rax, _@S352
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+jmp .L30
+.L33:
+movsx rax, word [rbp+-66]
+add eax, 2
+push rax
+movsx rax, word [rbp+-66]
+add eax, 1
+push rax
+movsx rax, word [rbp+-66]
+push rax
+push 12
+mov rax, _@S353
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+mov r9, [rsp+40]
+xor eax, eax
+call $emit_code
+add rsp, 48
+jmp .L30
+.L34:
+movsx rax, word [rbp+-66]
+add eax, 3
+push rax
+movsx rax, word [rbp+-66]
+add eax, 2
+push rax
+movsx rax, word [rbp+-66]
+add eax, 1
+push rax
+movsx rax, word [rbp+-66]
+push rax
+push 12
+mov rax, _@S354
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+mov r9, [rsp+40]
+push qword [rsp+48]
+xor eax, eax
+call $emit_code
+add rsp, 64
+.L30:
+jmp .L29
+.L28:
+mov eax, dword [rbp+-24]
+push rax
+mov rax, 12
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+movsx rax, dword [rbp+-64]
+mov rbx, 1
+mov rcx, 3
+cmp rax, rbx
+jl .L35
+cmp rax, rcx
+jg .L35
+sub rax, rbx
+jmp [rax*8+.jt3]
+segment .rodata
+.jt3:
+dq .L36
+dq .L37
+dq .L38
+segment .text
+.L36:
+push 12
+movsx rax, word [rbp+-66]
+push rax
+mov rax, _@S355
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov eax, dword [rbp+-52]
+sub eax, 4
+mov dword [rbp+-72], eax
+jmp .L35
+.L37:
+movsx rax, word [rbp+-66]
+add eax, 1
+push rax
+movsx rax, word [rbp+-66]
+push rax
+push 12
+mov rax, _@S356
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+mov eax, dword [rbp+-52]
+sub eax, 8
+mov dword [rbp+-72], eax
+jmp .L35
+.L38:
+movsx rax, word [rbp+-66]
+add eax, 2
+push rax
+movsx rax, word [rbp+-66]
+add eax, 1
+push rax
+movsx rax, word [rbp+-66]
+push rax
+push 12
+mov rax, _@S357
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+mov r9, [rsp+40]
+xor eax, eax
+call $emit_code
+add rsp, 48
+mov eax, dword [rbp+-52]
+sub eax, 12
+mov dword [rbp+-72], eax
+.L35:
+mov rax, _@S358
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov eax, dword [rbp+-52]
+sub eax, dword [rbp+-72]
+push rax
+mov rdi, [rsp+0]
+call $is_representable_in_imm12
+add rsp, 8
+cmp rax, 0
+je .L40
+.L39:
+mov eax, dword [rbp+-52]
+sub eax, dword [rbp+-72]
+push rax
+push 12
+push 12
+mov rax, _@S359
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+jmp .L41
+.L40:
+jmp .L43
+.L42:
+mov rax, 0
+jmp .L44
+.L43:
+push 2041
+mov rax, _@S360
+push rax
+mov rax, _@S361
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L44:
+.L41:
+push 12
+mov rax, _@S362
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+push 12
+push 12
+mov rax, _@S363
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+mov rax, _@S364
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov eax, dword [rbp+-72]
+push rax
+push 12
+mov rax, _@S365
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+mov rax, _@S366
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov rax, _@S367
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+.L29:
+jmp .L26
+.L25:
+mov rax, _@S368
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+movsx rax, dword [$arg_offs]
+sub eax, 16
+add eax, 12
+push rax
+mov rdi, [rsp+0]
+call $is_representable_in_imm12
+add rsp, 8
+cmp rax, 0
+je .L46
+.L45:
+movsx rax, dword [$arg_offs]
+sub eax, 16
+add eax, 12
+push rax
+push 12
+mov rax, _@S369
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L47
+.L46:
+movsx rax, dword [$arg_offs]
+sub eax, 16
+add eax, 12
+push rax
+push 12
+mov rax, _@S370
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+push 12
+mov rax, _@S371
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L47:
+push 12
+mov rax, _@S372
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov eax, dword [rbp+-24]
+push rax
+mov rax, 12
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+push 12
+mov rax, _@S373
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov eax, dword [rbp+-52]
+push rax
+push 12
+mov rax, _@S374
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+mov rax, _@S375
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov rax, _@S376
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+.L26:
+movsx rax, dword [$arg_offs]
+add eax, dword [rbp+-56]
+mov dword [$arg_offs], eax
+jmp .L22
+.L21:
+movsx rax, dword [$arg_offs]
+cmp eax, 16
+jge .L49
+.L48:
+movsx rax, dword [$arg_offs]
+cdq
+mov rbx, 4
+idiv ebx
+movsx rax, ax
+push rax
+mov word [rbp+-50], ax
+mov rdi, [rsp+0]
+call $spill_reg
+add rsp, 8
+mov eax, dword [rbp+-24]
+push rax
+movsx rax, word [rbp+-50]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+jmp .L50
+.L49:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+je .L51
+.L54:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 1
+je .L51
+.L53:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+mov word [rbp+-50], ax
+jne .L52
+.L51:
+mov rax, 12
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-50], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+.L52:
+movsx rax, dword [$arg_offs]
+sub eax, 16
+push rax
+mov rdi, [rsp+0]
+call $is_representable_in_imm12
+add rsp, 8
+cmp rax, 0
+je .L56
+.L55:
+movsx rax, dword [$arg_offs]
+sub eax, 16
+push rax
+movsx rax, word [rbp+-50]
+push rax
+mov rax, _@S377
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L57
+.L56:
+jmp .L59
+.L58:
+mov rax, 0
+jmp .L60
+.L59:
+push 2080
+mov rax, _@S378
+push rax
+mov rax, _@S379
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L60:
+.L57:
+.L50:
+movsx rax, dword [$arg_offs]
+add eax, 4
+mov dword [$arg_offs], eax
+.L22:
+.L12:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+.L1:
+.L61:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_asn' ====
+$arm_asn:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg2
+add rsp, 8
+mov [rbp+-48], rax
+lea rax, [rbp+-48]                             
+mov ebx, dword [rbp+-24]
+push rbx
+sub rsp, 8
+mov rsi, rax
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rsi, rax
+lea rdi, [rbp+-40]
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+.L8:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-40]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors2
+add rsp, 32
+.L6:
+.L7:
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+.L11:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L9:
+.L10:
+.L4:
+.L1:
+.L12:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_nop' ====
+$arm_nop:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+.L0:
+.L1:
+.L2:
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_not' ====
+$arm_not:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+push 18
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $arm_do_libcall
+add rsp, 40
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S380
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S381
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S382
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+.L8:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L6:
+.L7:
+.L4:
+.L1:
+.L9:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_do_libcall' ====
+$arm_do_libcall:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+mov [rbp+-40], r8
+push rbx
+.L0:
+lea rax, [rbp+-44]
+mov rbx, 4
+mov word [rax], bx
+lea rax, [rbp+-44]
+add rax, 2
+mov rbx, 5
+mov word [rax], bx
+lea rax, [rbp+-48]
+mov rbx, 0
+mov word [rax], bx
+lea rax, [rbp+-48]
+add rax, 2
+mov rbx, 1
+mov word [rax], bx
+lea rax, [rbp+-52]
+mov rbx, 2
+mov word [rax], bx
+lea rax, [rbp+-52]
+add rax, 2
+mov rbx, 3
+mov word [rax], bx
+movsx rax, dword [rbp+-40]
+mov rbx, 0
+mov rcx, 18
+cmp rax, rbx
+jl .L2
+cmp rax, rcx
+jg .L2
+jmp [rax*8+.jt4]
+segment .rodata
+.jt4:
+dq .L3
+dq .L3
+dq .L3
+dq .L3
+dq .L3
+dq .L7
+dq .L7
+dq .L7
+dq .L15
+dq .L15
+dq .L15
+dq .L15
+dq .L15
+dq .L15
+dq .L15
+dq .L15
+dq .L15
+dq .L15
+dq .L11
+segment .text
+.L3:
+call $arm_save_arg_regs
+mov eax, dword [rbp+-24]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-48]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+mov eax, dword [rbp+-32]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-52]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+call $spill_all
+movsx rax, dword [rbp+-40]
+mov rbx, $libfuncs
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S383
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov rax, _@S384
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S385
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+call $arm_restore_arg_regs
+.L6:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-44]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors2
+add rsp, 32
+.L4:
+.L5:
+jmp .L2
+.L7:
+call $arm_save_arg_regs
+mov eax, dword [rbp+-24]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-48]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+mov eax, dword [rbp+-32]
+push rax
+mov rax, 2
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+call $spill_all
+movsx rax, dword [rbp+-40]
+mov rbx, $libfuncs
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S386
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov rax, _@S387
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S388
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+call $arm_restore_arg_regs
+.L10:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-44]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors2
+add rsp, 32
+.L8:
+.L9:
+jmp .L2
+.L11:
+call $arm_save_arg_regs
+mov eax, dword [rbp+-24]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-48]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+call $spill_all
+mov rax, _@S389
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S390
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S391
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S392
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S393
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S394
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+call $arm_restore_arg_regs
+.L14:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+mov rax, 4
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L12:
+.L13:
+jmp .L2
+.L15:
+call $arm_save_arg_regs
+mov eax, dword [rbp+-24]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-48]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+mov eax, dword [rbp+-32]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-52]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+call $spill_all
+movsx rax, dword [rbp+-40]
+mov rbx, $libfuncs
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rax, _@S395
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+movsx rax, dword [rbp+-40]
+mov rbx, 8
+mov rcx, 17
+cmp rax, rbx
+jl .L16
+cmp rax, rcx
+jg .L16
+sub rax, rbx
+jmp [rax*8+.jt5]
+segment .rodata
+.jt5:
+dq .L17
+dq .L18
+dq .L19
+dq .L20
+dq .L21
+dq .L22
+dq .L19
+dq .L20
+dq .L21
+dq .L22
+segment .text
+.L17:
+mov rax, _@S396
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S397
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S398
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L16
+.L18:
+mov rax, _@S399
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S400
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S401
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L16
+.L19:
+mov rax, _@S402
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S403
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S404
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L16
+.L20:
+mov rax, _@S405
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S406
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S407
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L16
+.L21:
+mov rax, _@S408
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S409
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S410
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L16
+.L22:
+mov rax, _@S411
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S412
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S413
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+.L16:
+call $arm_restore_arg_regs
+.L25:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+mov rax, 4
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L23:
+.L24:
+.L2:
+.L1:
+.L26:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `spill_reg' ====
+$spill_reg:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp+-8], rdi
+push rbx
+.L0:
+mov rax, $reg_descr_tab
+movsx rbx, word [rbp+-8]
+sal rbx, 2
+add rax, rbx
+mov eax, dword [rax]
+cmp eax, 0
+jne .L3
+.L2:
+jmp .L1
+.L3:
+mov rax, $reg_descr_tab
+movsx rbx, word [rbp+-8]
+sal rbx, 2
+add rax, rbx
+mov eax, dword [rax]
+mov rbx, rax
+mov ebx, ebx
+mov dword [rbp+-12], eax
+sal rbx, 5
+mov rax, qword [$ic_addresses]
+add rax, rbx
+add rax, 8
+movsx rax, dword [rax]
+movsx rax, eax
+sal rax, 2
+mov rbx, qword [$addr_descr_tab]
+add rbx, rax
+add rbx, 2
+movsx rbx, word [rbx]
+mov rax, -1
+cmp ebx, eax
+je .L5
+.L4:
+mov eax, dword [rbp+-12]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+mov ebx, dword [rbp+-12]
+push rbx
+sub rsp, 8
+mov rsi, rax
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rsi, rax
+lea rdi, [rbp+-16]
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_store2
+add rsp, 16
+mov rax, -1
+movsx rax, ax
+mov ebx, dword [rbp+-12]
+sal rbx, 5
+mov rcx, qword [$ic_addresses]
+add rcx, rbx
+add rcx, 8
+movsx rcx, dword [rcx]
+movsx rcx, ecx
+sal rcx, 2
+mov rbx, qword [$addr_descr_tab]
+add rbx, rcx
+add rbx, 2
+mov word [rbx], ax
+mov ebx, dword [rbp+-12]
+sal rbx, 5
+mov rcx, qword [$ic_addresses]
+add rcx, rbx
+add rcx, 8
+movsx rcx, dword [rcx]
+movsx rcx, ecx
+sal rcx, 2
+mov rbx, qword [$addr_descr_tab]
+add rbx, rcx
+mov word [rbx], ax
+lea rax, [rbp+-16]
+add rax, 2
+movsx rax, word [rax]
+mov rbx, $reg_descr_tab
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+lea rax, [rbp+-16]
+movsx rax, word [rax]
+mov rbx, $reg_descr_tab
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+jmp .L6
+.L5:
+mov eax, dword [rbp+-12]
+push rax
+movsx rax, word [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_store
+add rsp, 16
+mov rax, -1
+movsx rax, ax
+mov ebx, dword [rbp+-12]
+sal rbx, 5
+mov rcx, qword [$ic_addresses]
+add rcx, rbx
+add rcx, 8
+movsx rcx, dword [rcx]
+movsx rcx, ecx
+sal rcx, 2
+mov rbx, qword [$addr_descr_tab]
+add rbx, rcx
+mov word [rbx], ax
+mov rax, $reg_descr_tab
+movsx rbx, word [rbp+-8]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+.L6:
+.L1:
+.L7:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_load_addr' ====
+$arm_load_addr:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+push rbx
+.L0:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+add rbx, 8
+mov rbx, qword [rbx]
+mov rax, rbx
+add rax, 56
+mov qword [rbp+-24], rbx
+add rax, 13
+movsx rax, byte [rax]
+cmp eax, 1
+jne .L3
+.L2:
+mov rax, qword [rbp+-24]
+add rax, 56
+add rax, 12
+movsx rax, byte [rax]
+cmp eax, 2
+jne .L6
+.L5:
+mov rax, qword [rbp+-24]
+add rax, 56
+mov rax, qword [rax]
+push rax
+push qword [$curr_func]
+movsx rax, word [rbp+-8]
+push rax
+mov rax, _@S414
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+jmp .L7
+.L6:
+mov rax, qword [rbp+-24]
+add rax, 56
+mov rax, qword [rax]
+push rax
+movsx rax, word [rbp+-8]
+push rax
+mov rax, _@S415
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L7:
+jmp .L4
+.L3:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+add rbx, 16
+movsx rbx, dword [rbx]
+push rbx
+mov dword [rbp+-28], ebx
+mov rdi, [rsp+0]
+call $is_representable_in_imm12
+add rsp, 8
+cmp rax, 0
+je .L9
+.L8:
+movsx rax, dword [rbp+-28]
+push rax
+movsx rax, word [rbp+-8]
+push rax
+mov rax, _@S416
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L10
+.L9:
+movsx rax, dword [rbp+-28]
+push rax
+push 12
+mov rax, _@S417
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+movsx rax, word [rbp+-8]
+push rax
+mov rax, _@S418
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L10:
+.L4:
+.L1:
+.L11:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `get_temp_offs' ====
+$get_temp_offs:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp+-8], rdi
+push rbx
+.L0:
+mov rax, qword [$temp_list]
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-16], rax
+je .L4
+.L2:
+mov rax, qword [rbp+-16]
+add rax, 8
+movsx rax, dword [rax]
+cmp eax, 0
+sete al
+movzx eax, al
+cmp rax, 0
+je .L6
+.L7:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+mov rax, qword [rbp+-16]
+movsx rax, dword [rax]
+cmp eax, ebx
+jne .L6
+.L5:
+mov rax, qword [rbp+-16]
+add rax, 4
+movsx rax, dword [rax]
+jmp .L1
+.L6:
+.L3:
+mov rax, qword [rbp+-16]
+add rax, 16
+mov rax, qword [rax]
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-16], rax
+jne .L2
+.L4:
+mov rax, qword [$temp_list]
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-16], rax
+je .L10
+.L8:
+mov rax, qword [rbp+-16]
+add rax, 8
+movsx rax, dword [rax]
+cmp rax, 0
+je .L12
+.L11:
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+mov rax, qword [rbp+-16]
+mov dword [rax], ebx
+mov rax, qword [rbp+-16]
+add rax, 8
+mov dword [rax], 0
+mov rax, qword [rbp+-16]
+add rax, 4
+movsx rax, dword [rax]
+jmp .L1
+.L12:
+.L9:
+mov rax, qword [rbp+-16]
+add rax, 16
+mov rax, qword [rax]
+mov rbx, 0
+cmp rax, rbx
+mov qword [rbp+-16], rax
+jne .L8
+.L10:
+push 24
+mov rdi, [rsp+0]
+call $malloc
+add rsp, 8
+mov ebx, dword [rbp+-8]
+sal rbx, 5
+mov rcx, qword [$ic_addresses]
+add rcx, rbx
+add rcx, 8
+movsx rcx, dword [rcx]
+mov rbx, rax
+mov dword [rbx], ecx
+movsx rbx, dword [$size_of_local_area]
+sub ebx, 8
+mov rcx, rax
+add rcx, 4
+mov dword [rcx], ebx
+mov dword [$size_of_local_area], ebx
+mov rbx, rax
+add rbx, 8
+mov dword [rbx], 0
+mov rbx, rax
+add rbx, 16
+mov rcx, qword [$temp_list]
+mov qword [rbx], rcx
+mov rbx, rax
+mov qword [$temp_list], rbx
+add rax, 4
+movsx rax, dword [rax]
+.L1:
+.L13:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_static_expr' ====
+$arm_static_expr:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp+-8], rdi
+push rbx
+.L0:
+mov rax, qword [rbp+-8]
+add rax, 52
+movsx rax, dword [rax]
+mov rbx, 0
+mov rcx, 3
+cmp rax, rbx
+jl .L2
+cmp rax, rcx
+jg .L2
+jmp [rax*8+.jt6]
+segment .rodata
+.jt6:
+dq .L3
+dq .L4
+dq .L29
+dq .L30
+segment .text
+.L3:
+mov rax, qword [rbp+-8]
+add rax, 56
+movsx rax, dword [rax]
+cmp eax, 30
+je .L22
+cmp eax, 13
+je .L16
+cmp eax, 12
+je .L13
+cmp eax, 103
+je .L12
+cmp eax, 101
+je .L12
+cmp eax, 105
+je .L12
+cmp eax, 6
+je .L9
+cmp eax, 7
+je .L9
+cmp eax, 97
+je .L5
+jmp .L25
+.L5:
+mov rax, 0
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+add rbx, 72
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+push rax
+mov rdi, [rsp+0]
+call $is_integer
+add rsp, 8
+cmp rax, 0
+je .L7
+.L6:
+mov rax, 1
+mov dword [rbp+-12], eax
+mov rax, 0
+mov dword [rbp+-16], eax
+jmp .L8
+.L7:
+mov rax, 0
+mov dword [rbp+-12], eax
+mov rax, 1
+mov dword [rbp+-16], eax
+.L8:
+movsx rax, dword [rbp+-12]
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+add rbx, 72
+mov rsi, rbx
+lea rdi, [rbp+-32]
+mov ecx, 16
+rep movsb
+lea rax, [rbp+-32]
+add rax, 8
+mov rax, qword [rax]
+add rax, 24
+mov rax, qword [rax]
+lea rbx, [rbp+-32]
+add rbx, 8
+mov qword [rbx], rax
+movsx rax, dword [rbp+-12]
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+lea rbx, [rbp+-32]
+push rbx
+mov qword [rbp+-40], rax
+mov rdi, [rsp+0]
+call $get_sizeof
+add rsp, 8
+mov eax, eax
+movsx rbx, dword [rbp+-16]
+mov rcx, qword [rbp+-8]
+sal rbx, 3
+add rcx, rbx
+mov rcx, qword [rcx]
+push rcx
+mov qword [rbp+-48], rax
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+mov rbx, qword [rbp+-48]
+imul rbx, rax
+mov rax, qword [rbp+-40]
+add rax, rbx
+jmp .L1
+.L9:
+mov rax, 0
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+add rbx, 72
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 71
+je .L11
+.L10:
+mov rax, 1
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+add rbx, 56
+mov rbx, qword [rbx]
+push rbx
+mov rax, 0
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+add rbx, 72
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_spec
+add rsp, 8
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $get_member_descriptor
+add rsp, 16
+mov rbx, 0
+mov rcx, qword [rbp+-8]
+sal rbx, 3
+add rcx, rbx
+mov rcx, qword [rcx]
+push rcx
+mov qword [rbp+-16], rax
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+mov rbx, qword [rbp+-16]
+add rbx, 12
+mov ebx, dword [rbx]
+mov ebx, ebx
+add rax, rbx
+jmp .L1
+jmp .L12
+.L11:
+mov rax, 0
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+jmp .L1
+.L12:
+mov rax, 0
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+jmp .L1
+.L13:
+mov rax, qword [rbp+-8]
+add rax, 72
+push rax
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+push rax
+mov rdi, [rsp+0]
+call $is_integer
+add rsp, 8
+cmp rax, 0
+je .L15
+.L14:
+mov rax, 0
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+mov rbx, 1
+mov rcx, qword [rbp+-8]
+sal rbx, 3
+add rcx, rbx
+mov rcx, qword [rcx]
+push rcx
+mov qword [rbp+-48], rax
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+mov rbx, qword [rbp+-48]
+add rbx, rax
+mov rax, rbx
+jmp .L1
+jmp .L16
+.L15:
+mov rax, 0
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+add rbx, 72
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+push rax
+mov rdi, [rsp+0]
+call $is_integer
+add rsp, 8
+cmp rax, 0
+je .L18
+.L17:
+mov rax, 1
+mov dword [rbp+-12], eax
+mov rax, 0
+mov dword [rbp+-16], eax
+jmp .L19
+.L18:
+mov rax, 0
+mov dword [rbp+-12], eax
+mov rax, 1
+mov dword [rbp+-16], eax
+.L19:
+movsx rax, dword [rbp+-12]
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+add rbx, 72
+mov rsi, rbx
+lea rdi, [rbp+-32]
+mov ecx, 16
+rep movsb
+lea rax, [rbp+-32]
+add rax, 8
+mov rax, qword [rax]
+add rax, 24
+mov rax, qword [rax]
+lea rbx, [rbp+-32]
+add rbx, 8
+mov qword [rbx], rax
+movsx rax, dword [rbp+-12]
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+lea rbx, [rbp+-32]
+push rbx
+mov qword [rbp+-48], rax
+mov rdi, [rsp+0]
+call $get_sizeof
+add rsp, 8
+mov eax, eax
+movsx rbx, dword [rbp+-16]
+mov rcx, qword [rbp+-8]
+sal rbx, 3
+add rcx, rbx
+mov rcx, qword [rcx]
+push rcx
+mov qword [rbp+-40], rax
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+mov rbx, qword [rbp+-40]
+imul rbx, rax
+mov rax, qword [rbp+-48]
+add rax, rbx
+jmp .L1
+.L16:
+mov rax, 0
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+add rbx, 72
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+push rax
+mov rdi, [rsp+0]
+call $is_integer
+add rsp, 8
+cmp rax, 0
+je .L21
+.L20:
+mov rax, 0
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+mov rbx, 1
+mov rcx, qword [rbp+-8]
+sal rbx, 3
+add rcx, rbx
+mov rcx, qword [rcx]
+push rcx
+mov qword [rbp+-48], rax
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+mov rbx, qword [rbp+-48]
+sub rbx, rax
+mov rax, rbx
+jmp .L1
+jmp .L22
+.L21:
+mov rax, 0
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+add rbx, 72
+mov rsi, rbx
+lea rdi, [rbp+-24]
+mov ecx, 16
+rep movsb
+lea rax, [rbp+-24]
+add rax, 8
+mov rax, qword [rax]
+add rax, 24
+mov rax, qword [rax]
+lea rbx, [rbp+-24]
+add rbx, 8
+mov qword [rbx], rax
+mov rax, 0
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+lea rbx, [rbp+-24]
+push rbx
+mov qword [rbp+-48], rax
+mov rdi, [rsp+0]
+call $get_sizeof
+add rsp, 8
+mov eax, eax
+mov rbx, 1
+mov rcx, qword [rbp+-8]
+sal rbx, 3
+add rcx, rbx
+mov rcx, qword [rcx]
+push rcx
+mov qword [rbp+-40], rax
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+mov rbx, qword [rbp+-40]
+imul rbx, rax
+mov rax, qword [rbp+-48]
+sub rax, rbx
+jmp .L1
+.L22:
+mov rax, qword [rbp+-8]
+mov rbx, 0
+sal rbx, 3
+add rax, rbx
+mov rax, qword [rax]
+add rax, 56
+mov rax, qword [rax]
+cmp rax, 0
+je .L24
+.L23:
+mov rax, 1
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+jmp .L1
+jmp .L25
+.L24:
+mov rax, 2
+mov rbx, qword [rbp+-8]
+sal rax, 3
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $arm_static_expr
+add rsp, 8
+jmp .L1
+.L25:
+jmp .L27
+.L26:
+mov rax, 0
+jmp .L28
+.L27:
+push 2599
+mov rax, _@S419
+push rax
+mov rax, _@S420
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L28:
+.L4:
+mov rax, qword [rbp+-8]
+add rax, 56
+mov rax, qword [rax]
+jmp .L1
+.L29:
+movsx rax, dword [$string_literals_counter]
+push rax
+mov rax, _@S421
+push rax
+push qword [$str_lits]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S422
+push rax
+push qword [$str_lits]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov rax, qword [rbp+-8]
+add rax, 56
+mov rax, qword [rax]
+push rax
+push qword [$str_lits]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $emit_raw_string
+add rsp, 16
+movsx rax, dword [$string_literals_counter]
+mov rbx, rax
+add ebx, 1
+mov dword [$string_literals_counter], ebx
+push rax
+mov rax, _@S423
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, 0
+jmp .L1
+.L30:
+mov rax, qword [rbp+-8]
+add rax, 56
+add rax, 12
+movsx rax, byte [rax]
+cmp eax, 2
+jne .L32
+.L31:
+mov rax, qword [rbp+-8]
+add rax, 56
+mov rax, qword [rax]
+push rax
+push qword [$enclosing_function]
+mov rax, _@S424
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $string_printf
+add rsp, 32
+jmp .L33
+.L32:
+mov rax, qword [rbp+-8]
+add rax, 56
+mov rax, qword [rax]
+push rax
+mov rax, _@S425
+push rax
+push qword [$asm_decls]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+.L33:
+mov rax, 0
+jmp .L1
+.L2:
+jmp .L35
+.L34:
+mov rax, 0
+jmp .L36
+.L35:
+push 2615
+mov rax, _@S426
+push rax
+mov rax, _@S427
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L36:
+.L1:
+.L37:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_jmp' ====
+$arm_jmp:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+add eax, 1
+movsx rax, eax
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 31
+jne .L3
+.L4:
+movsx rax, dword [rbp+-8]
+add eax, 1
+movsx rax, eax
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 16
+mov ebx, dword [rbx]
+mov ebx, ebx
+sal rbx, 5
+mov rax, qword [$ic_addresses]
+add rax, rbx
+add rax, 8
+mov rax, qword [rax]
+mov ebx, dword [rbp+-16]
+sal rbx, 5
+mov rcx, qword [$ic_addresses]
+add rcx, rbx
+add rcx, 8
+mov rcx, qword [rcx]
+cmp rax, rcx
+jne .L3
+.L2:
+jmp .L1
+.L3:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+push qword [$curr_func]
+mov rax, _@S428
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L1:
+.L5:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_ind_asn' ====
+$arm_ind_asn:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+call $spill_aliased_objects
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+jne .L7
+.L6:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+jmp .L8
+.L7:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov word [rbp+-38], ax
+.L8:
+mov eax, dword [rbp+-32]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+jne .L10
+.L9:
+mov eax, dword [rbp+-32]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rax, 0
+sal rax, 2
+mov rcx, rbx
+add rcx, rax
+mov ecx, dword [rcx]
+push rcx
+push 12
+mov rax, _@S429
+push rax
+push 1
+mov qword [rbp+-56], rbx
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, word [rbp+-38]
+push rax
+push 12
+mov rax, _@S430
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov rax, 1
+sal rax, 2
+mov rbx, qword [rbp+-56]
+add rbx, rax
+mov ebx, dword [rbx]
+push rbx
+push 12
+mov rax, _@S431
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, word [rbp+-38]
+push rax
+push 12
+mov rax, _@S432
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L11
+.L10:
+mov eax, dword [rbp+-32]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 1
+jne .L13
+.L12:
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+call $new_string_literal
+add rsp, 8
+push rax
+push 12
+mov rax, _@S433
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, word [rbp+-38]
+push rax
+push 12
+mov rax, _@S434
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov rax, _@S435
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+movsx rax, word [rbp+-38]
+push rax
+push 12
+mov rax, _@S436
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L14
+.L13:
+mov eax, dword [rbp+-32]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+jne .L16
+.L15:
+call $get_reg0
+lea rbx, [rbp+-52]
+mov word [rbx], ax
+lea rax, [rbp+-52]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 1
+call $get_reg0
+lea rbx, [rbp+-52]
+add rbx, 2
+mov word [rbx], ax
+lea rax, [rbp+-52]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+mov eax, dword [rbp+-32]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-52]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+jmp .L17
+.L16:
+mov eax, dword [rbp+-32]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+lea rbx, [rbp+-52]
+mov word [rbx], ax
+mov eax, dword [rbp+-32]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+add rax, 2
+movsx rax, word [rax]
+lea rbx, [rbp+-52]
+add rbx, 2
+mov word [rbx], ax
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L19
+.L18:
+mov rax, 0
+jmp .L20
+.L19:
+push 1854
+mov rax, _@S437
+push rax
+mov rax, _@S438
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L20:
+.L17:
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-52]
+movsx rax, word [rax]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S439
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+.L14:
+.L11:
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+jmp .L40
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-36]
+cmp eax, 68
+je .L21
+.L23:
+movsx rax, dword [rbp+-36]
+cmp eax, 71
+jne .L22
+.L21:
+mov rax, _@S440
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov eax, dword [rbp+-24]
+push rax
+mov rax, 12
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+push 12
+mov rax, _@S441
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov eax, dword [rbp+-32]
+push rax
+mov rax, 12
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+push 12
+mov rax, _@S442
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_sizeof
+add rsp, 8
+push rax
+push 12
+mov rax, _@S443
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+mov rax, _@S444
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+mov rax, _@S445
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+jmp .L40
+.L22:
+.L4:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+jne .L25
+.L24:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+jmp .L26
+.L25:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov word [rbp+-38], ax
+.L26:
+movsx rax, dword [rbp+-36]
+cmp eax, 49
+je .L29
+cmp eax, 106
+je .L29
+cmp eax, 107
+je .L29
+cmp eax, 64
+je .L28
+cmp eax, 108
+je .L28
+jmp .L30
+.L28:
+mov rax, _@S446
+mov qword [rbp+-48], rax
+jmp .L27
+.L29:
+mov rax, _@S447
+mov qword [rbp+-48], rax
+jmp .L27
+.L30:
+mov rax, _@S448
+mov qword [rbp+-48], rax
+.L27:
+mov eax, dword [rbp+-32]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+jne .L32
+.L31:
+mov eax, dword [rbp+-32]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+push 12
+mov rax, _@S449
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, word [rbp+-38]
+push rax
+push 12
+push qword [rbp+-48]
+mov rax, _@S450
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+jmp .L33
+.L32:
+mov eax, dword [rbp+-32]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 1
+jne .L35
+.L34:
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+call $new_string_literal
+add rsp, 8
+push rax
+push 12
+mov rax, _@S451
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, word [rbp+-38]
+push rax
+push 12
+push qword [rbp+-48]
+mov rax, _@S452
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+jmp .L36
+.L35:
+mov eax, dword [rbp+-32]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+jne .L38
+.L37:
+call $get_reg0
+mov ebx, dword [rbp+-32]
+push rbx
+push rax
+mov word [rbp+-50], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+jmp .L39
+.L38:
+mov eax, dword [rbp+-32]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov word [rbp+-50], ax
+.L39:
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-50]
+push rax
+push qword [rbp+-48]
+mov rax, _@S453
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+.L36:
+.L33:
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+.L40:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+.L1:
+.L41:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `spill_all' ====
+$spill_all:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+.L0:
+mov rax, 0
+cmp eax, 16
+mov dword [rbp+-4], eax
+jge .L4
+.L2:
+movsx rax, dword [rbp+-4]
+movsx rax, ax
+push rax
+mov rdi, [rsp+0]
+call $spill_reg
+add rsp, 8
+.L3:
+movsx rax, dword [rbp+-4]
+add eax, 1
+cmp eax, 16
+mov dword [rbp+-4], eax
+jl .L2
+.L4:
+.L1:
+.L5:
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `update_tar_descriptors2' ====
+$update_tar_descriptors2:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+mov ebx, dword [rbp+-16]
+sal rbx, 5
+mov rcx, qword [$ic_addresses]
+add rcx, rbx
+add rcx, 8
+movsx rcx, dword [rcx]
+movsx rcx, ecx
+sal rcx, 2
+mov rbx, qword [$addr_descr_tab]
+add rbx, rcx
+mov word [rbx], ax
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+mov ebx, dword [rbp+-16]
+sal rbx, 5
+mov rcx, qword [$ic_addresses]
+add rcx, rbx
+add rcx, 8
+movsx rcx, dword [rcx]
+movsx rcx, ecx
+sal rcx, 2
+mov rbx, qword [$addr_descr_tab]
+add rbx, rcx
+add rbx, 2
+mov word [rbx], ax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+mov rbx, $reg_descr_tab
+sal rax, 2
+add rbx, rax
+mov eax, dword [rbp+-16]
+mov dword [rbx], eax
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+mov rbx, $reg_descr_tab
+sal rax, 2
+add rbx, rax
+mov eax, dword [rbp+-16]
+mov dword [rbx], eax
+movsx rax, dword [rbp+-32]
+cmp eax, 0
+sete al
+movzx eax, al
+cmp rax, 0
+je .L3
+.L2:
+cmp byte [rbp+-24], 0
+je .L5
+.L4:
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-8]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_store2
+add rsp, 16
+.L5:
+mov rax, -1
+movsx rax, ax
+mov ebx, dword [rbp+-16]
+sal rbx, 5
+mov rcx, qword [$ic_addresses]
+add rcx, rbx
+add rcx, 8
+movsx rcx, dword [rcx]
+movsx rcx, ecx
+sal rcx, 2
+mov rbx, qword [$addr_descr_tab]
+add rbx, rcx
+mov word [rbx], ax
+mov rax, -1
+movsx rax, ax
+mov ebx, dword [rbp+-16]
+sal rbx, 5
+mov rcx, qword [$ic_addresses]
+add rcx, rbx
+add rcx, 8
+movsx rcx, dword [rcx]
+movsx rcx, ecx
+sal rcx, 2
+mov rbx, qword [$addr_descr_tab]
+add rbx, rcx
+add rbx, 2
+mov word [rbx], ax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+mov rbx, $reg_descr_tab
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+mov rbx, $reg_descr_tab
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+.L3:
+.L1:
+.L6:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_shl' ====
+$arm_shl:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+push 5
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $arm_do_libcall
+add rsp, 40
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+push 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_get_operand
+add rsp, 16
+push rax
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S454
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+.L8:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L6:
+.L7:
+.L4:
+.L1:
+.L9:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_shr' ====
+$arm_shr:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+movsx rax, dword [rbp+-36]
+push rax
+mov rdi, [rsp+0]
+call $is_signed_int
+add rsp, 8
+cmp rax, 0
+je .L7
+.L6:
+mov rax, 6
+mov qword [rbp+-48], rax
+jmp .L8
+.L7:
+mov rax, 7
+mov qword [rbp+-48], rax
+.L8:
+push qword [rbp+-48]
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $arm_do_libcall
+add rsp, 40
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+push 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_get_operand
+add rsp, 16
+push rax
+movsx rax, dword [rbp+-36]
+push rax
+mov rdi, [rsp+0]
+call $is_unsigned_int
+add rsp, 8
+cmp rax, 0
+je .L10
+.L9:
+mov rax, _@S455
+mov qword [rbp+-48], rax
+jmp .L11
+.L10:
+mov rax, _@S456
+mov qword [rbp+-48], rax
+.L11:
+push qword [rbp+-48]
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S457
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+mov r9, [rsp+40]
+xor eax, eax
+call $emit_code
+add rsp, 48
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+.L14:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L12:
+.L13:
+.L4:
+.L1:
+.L15:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_indcall' ====
+$arm_indcall:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+call $spill_all
+mov eax, dword [rbp+-24]
+push rax
+mov rax, 12
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+push 12
+mov rax, _@S458
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $arm_post_call
+add rsp, 8
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+cmp dword [rbp+-16], 0
+je .L3
+.L2:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L4
+.L7:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L5
+.L4:
+lea rax, [rbp+-40]
+mov rbx, 4
+mov word [rax], bx
+lea rax, [rbp+-40]
+add rax, 2
+mov rbx, 5
+mov word [rax], bx
+mov rax, _@S459
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+mov rax, _@S460
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-40]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors2
+add rsp, 32
+jmp .L6
+.L5:
+mov rax, _@S461
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $emit_code
+add rsp, 16
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+mov rax, 4
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L6:
+.L3:
+.L1:
+.L8:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `do_relop_jump' ====
+$do_relop_jump:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+mov [rbp+-40], r8
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-40]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+mov dword [rbp+-44], ebx
+movsx rax, dword [rbp+-8]
+add eax, 1
+mov dword [rbp+-48], eax
+.L2:
+movsx rax, dword [rbp+-48]
+cmp eax, dword [$func_last_quad]
+jg .L6
+.L5:
+mov rax, 0
+jmp .L7
+.L6:
+push 1302
+mov rax, _@S462
+push rax
+mov rax, _@S463
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L7:
+movsx rax, dword [rbp+-48]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 37
+jne .L8
+.L10:
+movsx rax, dword [rbp+-48]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 20
+mov ebx, dword [rbx]
+mov ebx, ebx
+sal rbx, 5
+mov rax, qword [$ic_addresses]
+add rax, rbx
+add rax, 8
+movsx rax, dword [rax]
+cmp eax, dword [rbp+-44]
+je .L9
+.L8:
+jmp .L3
+.L9:
+movsx rax, dword [rbp+-48]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 16
+mov ebx, dword [rbx]
+movsx rax, dword [rbp+-48]
+add eax, 1
+movsx rax, eax
+sal rax, 5
+mov rcx, qword [$ic_instructions]
+add rcx, rax
+add rcx, 16
+mov ecx, dword [rcx]
+movsx rax, dword [rbp+-48]
+sal rax, 5
+mov rdx, qword [$ic_instructions]
+add rdx, rax
+add rdx, 24
+mov edx, dword [rdx]
+mov dword [rbp+-64], edx
+mov rax, rbx
+mov eax, eax
+mov dword [rbp+-56], ebx
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+mov ecx, ecx
+sal rcx, 5
+mov rax, qword [$ic_addresses]
+add rax, rcx
+add rax, 8
+mov rax, qword [rax]
+cmp rbx, rax
+jne .L12
+.L11:
+mov eax, dword [rbp+-64]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+mov dword [rbp+-52], ebx
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+movsx rbx, dword [rbx]
+mov rax, 10
+mov rcx, 15
+cmp rbx, rax
+jl .L14
+cmp rbx, rcx
+jg .L14
+sub rbx, rax
+jmp [rbx*8+.jt7]
+segment .rodata
+.jt7:
+dq .L15
+dq .L16
+dq .L17
+dq .L21
+dq .L25
+dq .L29
+segment .text
+.L15:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S464
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L14
+.L16:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S465
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L14
+.L17:
+mov rax, 1
+mov rbx, qword [rbp+-16]
+and rbx, rax
+cmp rbx, 0
+je .L19
+.L18:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S466
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L20
+.L19:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S467
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L20:
+jmp .L14
+.L21:
+mov rax, 1
+mov rbx, qword [rbp+-16]
+and rbx, rax
+cmp rbx, 0
+je .L23
+.L22:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S468
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L24
+.L23:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S469
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L24:
+jmp .L14
+.L25:
+mov rax, 1
+mov rbx, qword [rbp+-16]
+and rbx, rax
+cmp rbx, 0
+je .L27
+.L26:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S470
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L28
+.L27:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S471
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L28:
+jmp .L14
+.L29:
+mov rax, 1
+mov rbx, qword [rbp+-16]
+and rbx, rax
+cmp rbx, 0
+je .L31
+.L30:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S472
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L32
+.L31:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S473
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L32:
+.L14:
+jmp .L13
+.L12:
+mov eax, dword [rbp+-56]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+mov dword [rbp+-52], ebx
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+movsx rbx, dword [rbx]
+mov rax, 10
+mov rcx, 15
+cmp rbx, rax
+jl .L33
+cmp rbx, rcx
+jg .L33
+sub rbx, rax
+jmp [rbx*8+.jt8]
+segment .rodata
+.jt8:
+dq .L34
+dq .L35
+dq .L36
+dq .L40
+dq .L44
+dq .L48
+segment .text
+.L34:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S474
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L33
+.L35:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S475
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L33
+.L36:
+mov rax, 1
+mov rbx, qword [rbp+-16]
+and rbx, rax
+cmp rbx, 0
+je .L38
+.L37:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S476
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L39
+.L38:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S477
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L39:
+jmp .L33
+.L40:
+mov rax, 1
+mov rbx, qword [rbp+-16]
+and rbx, rax
+cmp rbx, 0
+je .L42
+.L41:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S478
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L43
+.L42:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S479
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L43:
+jmp .L33
+.L44:
+mov rax, 1
+mov rbx, qword [rbp+-16]
+and rbx, rax
+cmp rbx, 0
+je .L46
+.L45:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S480
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L47
+.L46:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S481
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L47:
+jmp .L33
+.L48:
+mov rax, 1
+mov rbx, qword [rbp+-16]
+and rbx, rax
+cmp rbx, 0
+je .L50
+.L49:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S482
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L51
+.L50:
+movsx rax, dword [rbp+-52]
+push rax
+push qword [$curr_func]
+mov rax, _@S483
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L51:
+.L33:
+.L13:
+movsx rax, dword [rbp+-48]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+mov dword [rbx], 39
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-48]
+add eax, 1
+mov dword [rbp+-48], eax
+jmp .L2
+.L4:
+.L1:
+.L52:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_load2' ====
+$arm_load2:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+push rbx
+.L0:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+jne .L3
+.L2:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rax, 0
+sal rax, 2
+mov rcx, rbx
+add rcx, rax
+mov ecx, dword [rcx]
+push rcx
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+mov rax, _@S484
+push rax
+push 1
+mov qword [rbp+-32], rbx
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov rax, 1
+sal rax, 2
+mov rbx, qword [rbp+-32]
+add rbx, rax
+mov ebx, dword [rbx]
+push rbx
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S485
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L4
+.L3:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 1
+jne .L6
+.L5:
+mov eax, dword [rbp+-16]
+push rax
+mov rdi, [rsp+0]
+call $new_string_literal
+add rsp, 8
+push rax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+mov rax, _@S486
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S487
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+jmp .L7
+.L6:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 2
+jne .L9
+.L8:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L12
+.L11:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+lea rbx, [rbp+-8]
+movsx rbx, word [rbx]
+cmp eax, ebx
+je .L14
+.L13:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+add rax, 2
+movsx rax, word [rax]
+lea rbx, [rbp+-8]
+add rbx, 2
+movsx rbx, word [rbx]
+cmp eax, ebx
+je .L17
+.L16:
+mov rax, 0
+jmp .L18
+.L17:
+push 493
+mov rax, _@S488
+push rax
+mov rax, _@S489
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L18:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+mov rax, _@S490
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S491
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L15
+.L14:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+add rax, 2
+movsx rax, word [rax]
+lea rbx, [rbp+-8]
+add rbx, 2
+movsx rbx, word [rbx]
+cmp eax, ebx
+jne .L20
+.L19:
+mov rax, 0
+jmp .L21
+.L20:
+push 497
+mov rax, _@S492
+push rax
+mov rax, _@S493
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L21:
+.L15:
+jmp .L1
+.L12:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+add rbx, 8
+mov rbx, qword [rbx]
+mov rax, rbx
+add rax, 72
+mov qword [rbp+-32], rbx
+push rax
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-24], eax
+je .L22
+.L25:
+movsx rax, dword [rbp+-24]
+cmp eax, 111
+jne .L23
+.L22:
+mov rax, 0
+jmp .L24
+.L23:
+push 504
+mov rax, _@S494
+push rax
+mov rax, _@S495
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L24:
+mov rax, qword [rbp+-32]
+add rax, 56
+add rax, 13
+movsx rax, byte [rax]
+cmp eax, 1
+jne .L27
+.L26:
+mov rax, qword [rbp+-32]
+add rax, 56
+add rax, 12
+movsx rax, byte [rax]
+cmp eax, 2
+jne .L30
+.L29:
+mov rax, qword [rbp+-32]
+add rax, 56
+mov rax, qword [rax]
+push rax
+push qword [$curr_func]
+push 12
+mov rax, _@S496
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+jmp .L31
+.L30:
+mov rax, qword [rbp+-32]
+add rax, 56
+mov rax, qword [rax]
+push rax
+push 12
+mov rax, _@S497
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L31:
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+push 12
+mov rax, _@S498
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+jmp .L28
+.L27:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+add rbx, 16
+movsx rbx, dword [rbx]
+cmp ebx, 0
+mov dword [rbp+-20], ebx
+jge .L33
+.L32:
+mov rax, -4095
+movsx rbx, dword [rbp+-20]
+cmp ebx, eax
+jl .L36
+.L35:
+movsx rax, dword [rbp+-20]
+neg eax
+push rax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+mov rax, _@S499
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, dword [rbp+-20]
+add eax, 4
+neg eax
+push rax
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S500
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L1
+.L36:
+jmp .L34
+.L33:
+movsx rax, dword [rbp+-20]
+add eax, 4
+cmp eax, 4095
+jg .L38
+.L37:
+movsx rax, dword [rbp+-20]
+push rax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+mov rax, _@S501
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, dword [rbp+-20]
+add eax, 4
+push rax
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S502
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L1
+.L38:
+.L34:
+jmp .L54
+.L28:
+jmp .L10
+.L9:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 3
+jne .L40
+.L39:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L42
+.L41:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+lea rbx, [rbp+-8]
+movsx rbx, word [rbx]
+cmp eax, ebx
+je .L45
+.L44:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+mov rax, _@S503
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L45:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+add rax, 2
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L47
+.L46:
+mov rax, 0
+jmp .L48
+.L47:
+push 532
+mov rax, _@S504
+push rax
+mov rax, _@S505
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $__assert
+add rsp, 24
+.L48:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+add rax, 2
+movsx rax, word [rax]
+lea rbx, [rbp+-8]
+add rbx, 2
+movsx rbx, word [rbx]
+cmp eax, ebx
+je .L50
+.L49:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S506
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L50:
+jmp .L43
+.L42:
+mov eax, dword [rbp+-16]
+push rax
+mov rdi, [rsp+0]
+call $get_temp_offs
+add rsp, 8
+mov rbx, -4095
+cmp eax, ebx
+mov dword [rbp+-24], eax
+jl .L52
+.L51:
+movsx rax, dword [rbp+-24]
+neg eax
+push rax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+mov rax, _@S507
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, dword [rbp+-24]
+add eax, 4
+neg eax
+push rax
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S508
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L53
+.L52:
+jmp .L54
+.L53:
+.L43:
+.L40:
+.L10:
+.L7:
+.L4:
+jmp .L1
+.L54:
+movsx rax, dword [rbp+-20]
+push rax
+push 12
+mov rax, _@S509
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+push 12
+mov rax, _@S510
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+push 12
+mov rax, _@S511
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+.L1:
+.L55:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_store2' ====
+$arm_store2:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+push rbx
+.L0:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 2
+jne .L3
+.L2:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+add rbx, 8
+mov rbx, qword [rbx]
+mov rax, rbx
+add rax, 56
+mov qword [rbp+-32], rbx
+add rax, 13
+movsx rax, byte [rax]
+cmp eax, 1
+jne .L6
+.L5:
+mov rax, qword [rbp+-32]
+add rax, 56
+add rax, 12
+movsx rax, byte [rax]
+cmp eax, 2
+jne .L9
+.L8:
+mov rax, qword [rbp+-32]
+add rax, 56
+mov rax, qword [rax]
+push rax
+push qword [$curr_func]
+push 12
+mov rax, _@S512
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+jmp .L10
+.L9:
+mov rax, qword [rbp+-32]
+add rax, 56
+mov rax, qword [rax]
+push rax
+push 12
+mov rax, _@S513
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L10:
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+push 12
+mov rax, _@S514
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+jmp .L7
+.L6:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+add rbx, 16
+movsx rbx, dword [rbx]
+cmp ebx, 0
+mov dword [rbp+-20], ebx
+jge .L12
+.L11:
+mov rax, -4095
+movsx rbx, dword [rbp+-20]
+cmp ebx, eax
+jl .L15
+.L14:
+movsx rax, dword [rbp+-20]
+neg eax
+push rax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+mov rax, _@S515
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, dword [rbp+-20]
+add eax, 4
+neg eax
+push rax
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S516
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L1
+.L15:
+jmp .L13
+.L12:
+movsx rax, dword [rbp+-20]
+add eax, 4
+cmp eax, 4095
+jg .L17
+.L16:
+movsx rax, dword [rbp+-20]
+push rax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+mov rax, _@S517
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, dword [rbp+-20]
+add eax, 4
+push rax
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S518
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L1
+.L17:
+.L13:
+jmp .L23
+.L7:
+jmp .L4
+.L3:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 3
+jne .L19
+.L18:
+mov eax, dword [rbp+-16]
+push rax
+mov rdi, [rsp+0]
+call $get_temp_offs
+add rsp, 8
+mov rbx, -4095
+cmp eax, ebx
+mov dword [rbp+-24], eax
+jl .L21
+.L20:
+movsx rax, dword [rbp+-24]
+neg eax
+push rax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+mov rax, _@S519
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, dword [rbp+-24]
+add eax, 4
+neg eax
+push rax
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S520
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+jmp .L22
+.L21:
+jmp .L23
+.L22:
+.L19:
+.L4:
+jmp .L1
+.L23:
+movsx rax, dword [rbp+-20]
+push rax
+push 12
+mov rax, _@S521
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+push 12
+push 12
+mov rax, _@S522
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+lea rax, [rbp+-8]
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-8]
+movsx rax, word [rax]
+push rax
+push 12
+mov rax, _@S523
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+.L1:
+.L24:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_sub' ====
+$arm_sub:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+mov rdi, [rsp+0]
+call $get_type_category
+add rsp, 8
+cmp eax, 110
+mov dword [rbp+-36], eax
+je .L2
+.L5:
+movsx rax, dword [rbp+-36]
+cmp eax, 111
+jne .L3
+.L2:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg2
+add rsp, 8
+mov [rbp+-64], rax
+lea rax, [rbp+-64]                             
+mov ebx, dword [rbp+-24]
+push rbx
+sub rsp, 8
+mov rsi, rax
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rsi, rax
+lea rdi, [rbp+-52]
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load2
+add rsp, 16
+lea rax, [rbp+-52]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 1
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+call $arm_get_operand2
+add rsp, 8
+mov rbx, 0
+sal rbx, 3
+mov rcx, rax
+add rcx, rbx
+mov rcx, qword [rcx]
+push rcx
+lea rbx, [rbp+-52]
+movsx rbx, word [rbx]
+push rbx
+lea rbx, [rbp+-52]
+movsx rbx, word [rbx]
+push rbx
+mov rbx, _@S524
+push rbx
+push 1
+mov qword [rbp+-48], rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+mov rax, 1
+sal rax, 3
+mov rbx, qword [rbp+-48]
+add rbx, rax
+mov rbx, qword [rbx]
+push rbx
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+push rax
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+push rax
+mov rax, _@S525
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+lea rax, [rbp+-52]
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+lea rax, [rbp+-52]
+add rax, 2
+movsx rax, word [rax]
+mov rbx, $pinned
+sal rax, 2
+add rbx, rax
+mov dword [rbx], 0
+.L8:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+sub rsp, 8
+lea rsi, [rbp+-52]
+mov rdi, rsp
+mov ecx, 4
+rep movsb
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors2
+add rsp, 32
+.L6:
+.L7:
+jmp .L4
+.L3:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-38], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+push 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_get_operand
+add rsp, 16
+push rax
+movsx rax, word [rbp+-38]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rax, _@S526
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+xor eax, eax
+call $emit_code
+add rsp, 40
+mov rax, $pinned
+movsx rbx, word [rbp+-38]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+.L11:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-38]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L9:
+.L10:
+.L4:
+.L1:
+.L12:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_addr_of' ====
+$arm_addr_of:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+call $get_reg0
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-34], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load_addr
+add rsp, 16
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-34]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L1:
+.L2:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `update_tar_descriptors' ====
+$update_tar_descriptors:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+mov eax, dword [rbp+-16]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rbx, word [rbp+-8]
+mov word [rax], bx
+mov rax, $reg_descr_tab
+movsx rbx, word [rbp+-8]
+sal rbx, 2
+add rax, rbx
+mov ebx, dword [rbp+-16]
+mov dword [rax], ebx
+movsx rax, dword [rbp+-32]
+cmp eax, 0
+sete al
+movzx eax, al
+cmp rax, 0
+je .L3
+.L2:
+cmp byte [rbp+-24], 0
+je .L5
+.L4:
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_store
+add rsp, 16
+.L5:
+mov rax, -1
+movsx rax, ax
+mov ebx, dword [rbp+-16]
+sal rbx, 5
+mov rcx, qword [$ic_addresses]
+add rcx, rbx
+add rcx, 8
+movsx rcx, dword [rcx]
+movsx rcx, ecx
+sal rcx, 2
+mov rbx, qword [$addr_descr_tab]
+add rbx, rcx
+mov word [rbx], ax
+mov rax, $reg_descr_tab
+movsx rbx, word [rbp+-8]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+.L3:
+.L1:
+.L6:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `get_reg' ====
+$get_reg:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp+-8], rdi
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 20
+mov ebx, dword [rbx]
+mov rax, rbx
+mov eax, eax
+mov dword [rbp+-12], ebx
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+je .L6
+.L7:
+mov eax, dword [rbp+-12]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 1
+jne .L8
+.L6:
+mov rax, 1
+mov qword [rbp+-24], rax
+jmp .L9
+.L8:
+mov rax, 0
+mov qword [rbp+-24], rax
+.L9:
+mov rax, qword [rbp+-24]
+cmp eax, 0
+sete al
+movzx eax, al
+cmp rax, 0
+je .L3
+.L5:
+mov eax, dword [rbp+-12]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+je .L3
+.L4:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+cmp ebx, 0
+sete bl
+movzx ebx, bl
+cmp rbx, 0
+je .L3
+.L2:
+mov eax, dword [rbp+-12]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+jmp .L1
+.L3:
+call $get_reg0
+.L1:
+.L10:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_ch' ====
+$arm_ch:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-34], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+movsx rax, word [rbp+-34]
+push rax
+movsx rax, word [rbp+-34]
+push rax
+mov rax, _@S527
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L4:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-34]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L2:
+.L3:
+.L1:
+.L5:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_eq' ====
+$arm_eq:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+mov rax, 2
+mov rcx, rbx
+and rcx, rax
+mov qword [rbp+-40], rbx
+cmp rcx, 0
+je .L3
+.L2:
+push 8
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $arm_do_libcall
+add rsp, 40
+jmp .L4
+.L3:
+mov rax, 4
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+jne .L5
+.L9:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+je .L5
+.L10:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 1
+je .L5
+.L8:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+jne .L6
+.L5:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-42], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+jmp .L7
+.L6:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov word [rbp+-42], ax
+.L7:
+mov rax, $pinned
+movsx rbx, word [rbp+-42]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+push 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_get_operand
+add rsp, 16
+push rax
+movsx rax, word [rbp+-42]
+push rax
+mov rax, _@S528
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov rax, $pinned
+movsx rbx, word [rbp+-42]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+mov rax, 4
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L12
+.L11:
+movsx rax, word [rbp+-42]
+push rax
+mov rax, _@S529
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+movsx rax, word [rbp+-42]
+push rax
+mov rax, _@S530
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $emit_code
+add rsp, 24
+.L16:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-42]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L14:
+.L15:
+jmp .L13
+.L12:
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+push qword [rbp+-40]
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $do_relop_jump
+add rsp, 40
+.L13:
+.L4:
+.L1:
+.L17:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `new_string_literal' ====
+$new_string_literal:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp+-8], rdi
+push rbx
+.L0:
+movsx rax, dword [$string_literals_counter]
+push rax
+mov rax, _@S531
+push rax
+push qword [$str_lits]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+xor eax, eax
+call $string_printf
+add rsp, 24
+mov rax, _@S532
+push rax
+push qword [$str_lits]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+xor eax, eax
+call $string_printf
+add rsp, 16
+mov eax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+push rbx
+push qword [$str_lits]
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $emit_raw_string
+add rsp, 16
+movsx rax, dword [$string_literals_counter]
+mov rbx, rax
+add ebx, 1
+mov dword [$string_literals_counter], ebx
+.L1:
+.L2:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_gt' ====
+$arm_gt:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+mov rax, 2
+mov rcx, rbx
+and rcx, rax
+mov qword [rbp+-40], rbx
+cmp rcx, 0
+je .L3
+.L2:
+mov rax, 1
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L6
+.L5:
+mov rax, 15
+mov qword [rbp+-56], rax
+jmp .L7
+.L6:
+mov rax, 11
+mov qword [rbp+-56], rax
+.L7:
+push qword [rbp+-56]
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $arm_do_libcall
+add rsp, 40
+jmp .L4
+.L3:
+mov rax, 4
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+jne .L8
+.L12:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+je .L8
+.L13:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 1
+je .L8
+.L11:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+jne .L9
+.L8:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-42], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+jmp .L10
+.L9:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov word [rbp+-42], ax
+.L10:
+mov rax, $pinned
+movsx rbx, word [rbp+-42]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+push 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_get_operand
+add rsp, 16
+push rax
+movsx rax, word [rbp+-42]
+push rax
+mov rax, _@S533
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov rax, $pinned
+movsx rbx, word [rbp+-42]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+mov rax, 4
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L15
+.L14:
+movsx rax, word [rbp+-42]
+push rax
+mov rax, 1
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L18
+.L17:
+mov rax, _@S534
+mov qword [rbp+-56], rax
+jmp .L19
+.L18:
+mov rax, _@S535
+mov qword [rbp+-56], rax
+.L19:
+push qword [rbp+-56]
+mov rax, _@S536
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, word [rbp+-42]
+push rax
+mov rax, 1
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L21
+.L20:
+mov rax, _@S537
+mov qword [rbp+-56], rax
+jmp .L22
+.L21:
+mov rax, _@S538
+mov qword [rbp+-56], rax
+.L22:
+push qword [rbp+-56]
+mov rax, _@S539
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L25:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-42]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L23:
+.L24:
+jmp .L16
+.L15:
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+push qword [rbp+-40]
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $do_relop_jump
+add rsp, 40
+.L16:
+.L4:
+.L1:
+.L26:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; ==== start of definition of function `arm_get' ====
+$arm_get:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp+-8], rdi
+mov [rbp+-16], rsi
+mov [rbp+-24], rdx
+mov [rbp+-32], rcx
+push rbx
+.L0:
+movsx rax, dword [rbp+-8]
+sal rax, 5
+mov rbx, qword [$ic_instructions]
+add rbx, rax
+add rbx, 8
+mov rbx, qword [rbx]
+mov rax, 2
+mov rcx, rbx
+and rcx, rax
+mov qword [rbp+-40], rbx
+cmp rcx, 0
+je .L3
+.L2:
+mov rax, 1
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L6
+.L5:
+mov rax, 16
+mov qword [rbp+-56], rax
+jmp .L7
+.L6:
+mov rax, 12
+mov qword [rbp+-56], rax
+.L7:
+push qword [rbp+-56]
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $arm_do_libcall
+add rsp, 40
+jmp .L4
+.L3:
+mov rax, 4
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+jne .L8
+.L12:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 0
+je .L8
+.L13:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+movsx rbx, dword [rbx]
+cmp ebx, 1
+je .L8
+.L11:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov rbx, -1
+cmp eax, ebx
+jne .L9
+.L8:
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+call $get_reg
+add rsp, 8
+mov ebx, dword [rbp+-24]
+push rbx
+push rax
+mov word [rbp+-42], ax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_load
+add rsp, 16
+jmp .L10
+.L9:
+mov eax, dword [rbp+-24]
+sal rax, 5
+mov rbx, qword [$ic_addresses]
+add rbx, rax
+add rbx, 8
+movsx rbx, dword [rbx]
+movsx rbx, ebx
+sal rbx, 2
+mov rax, qword [$addr_descr_tab]
+add rax, rbx
+movsx rax, word [rax]
+mov word [rbp+-42], ax
+.L10:
+mov rax, $pinned
+movsx rbx, word [rbp+-42]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 1
+push 1
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+call $arm_get_operand
+add rsp, 16
+push rax
+movsx rax, word [rbp+-42]
+push rax
+mov rax, _@S540
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+mov rax, $pinned
+movsx rbx, word [rbp+-42]
+sal rbx, 2
+add rax, rbx
+mov dword [rax], 0
+mov rax, 4
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L15
+.L14:
+movsx rax, word [rbp+-42]
+push rax
+mov rax, 1
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L18
+.L17:
+mov rax, _@S541
+mov qword [rbp+-56], rax
+jmp .L19
+.L18:
+mov rax, _@S542
+mov qword [rbp+-56], rax
+.L19:
+push qword [rbp+-56]
+mov rax, _@S543
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+movsx rax, word [rbp+-42]
+push rax
+mov rax, 1
+mov rbx, qword [rbp+-40]
+and rbx, rax
+cmp rbx, 0
+je .L21
+.L20:
+mov rax, _@S544
+mov qword [rbp+-56], rax
+jmp .L22
+.L21:
+mov rax, _@S545
+mov qword [rbp+-56], rax
+.L22:
+push qword [rbp+-56]
+mov rax, _@S546
+push rax
+push 1
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+xor eax, eax
+call $emit_code
+add rsp, 32
+.L25:
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 16
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 2
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-24]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 32
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 4
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-32]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+call $update_arg_descriptors
+add rsp, 24
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 8
+push rbx
+movsx rax, dword [rbp+-8]
+mov rbx, qword [$liveness_and_next_use]
+add rbx, rax
+movzx rbx, byte [rbx]
+and ebx, 1
+movzx ebx, bl
+push rbx
+mov eax, dword [rbp+-16]
+push rax
+movsx rax, word [rbp+-42]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+call $update_tar_descriptors
+add rsp, 32
+.L23:
+.L24:
+jmp .L16
+.L15:
+mov eax, dword [rbp+-32]
+push rax
+mov eax, dword [rbp+-24]
+push rax
+mov eax, dword [rbp+-16]
+push rax
+push qword [rbp+-40]
+movsx rax, dword [rbp+-8]
+push rax
+mov rdi, [rsp+0]
+mov rsi, [rsp+8]
+mov rdx, [rsp+16]
+mov rcx, [rsp+24]
+mov r8, [rsp+32]
+call $do_relop_jump
+add rsp, 40
+.L16:
+.L4:
+.L1:
+.L26:
+pop rbx
+mov rsp, rbp
+pop rbp
+ret
+
+; == objects with static duration
+segment .data
+align 8
+$arm_get_operand2@op:
+align 8
+dq $arm_get_operand2@op1
+align 8
+dq $arm_get_operand2@op2
+segment .bss
+$arm_get_operand2@op2:
+resb 256
+$arm_get_operand2@op1:
+resb 256
+$arm_get_operand@op:
+resb 256
+segment .data
+align 4
+$arm_function_definition@first_func:
+align 4
+dd 1
+segment .bss
+alignb 4
+$arm_do_switch64@nlab:
+resb 4
+segment .data
+align 4
+$is_representable_in_imm12@a:
+align 4
+dd 255
+align 4
+dd 3221225535
+align 4
+dd 4026531855
+align 4
+dd 4227858435
+align 4
+dd 4278190080
+align 4
+dd 1069547520
+align 4
+dd 267386880
+align 4
+dd 66846720
+align 4
+dd 16711680
+align 4
+dd 4177920
+align 4
+dd 1044480
+align 4
+dd 261120
+align 4
+dd 65280
+align 4
+dd 16320
+align 4
+dd 4080
+align 4
+dd 1008
+align 4
+$pinned:
+align 4
+dd 1
+align 4
+dd 1
+align 4
+dd 1
+align 4
+dd 1
+align 4
+dd 0
+align 4
+dd 0
+align 4
+dd 0
+align 4
+dd 0
+align 4
+dd 0
+align 4
+dd 0
+align 4
+dd 0
+align 4
+dd 1
+align 4
+dd 1
+align 4
+dd 1
+align 4
+dd 0
+align 4
+dd 1
+segment .bss
+alignb 8
+$curr_func:
+resb 8
+segment .data
+align 4
+$curr_segment:
+align 4
+dd -1
+segment .bss
+alignb 4
+$struct_union_return:
+resb 4
+alignb 4
+$string_literals_counter:
+resb 4
+alignb 8
+$enclosing_function:
+resb 8
+alignb 4
+$offs_to_lit_tab:
+resb 4
+alignb 4
+$arg_offs:
+resb 4
+alignb 8
+$addr_descr_tab:
+resb 8
+alignb 4
+$qword_return:
+resb 4
+alignb 4
+$func_last_quad:
+resb 4
+alignb 8
+$str_lits:
+resb 8
+alignb 8
+$asm_decls:
+resb 8
+segment .data
+align 8
+$instruction_handlers:
+align 8
+dq $arm_add
+align 8
+dq $arm_sub
+align 8
+dq $arm_mul
+align 8
+dq $arm_div
+align 8
+dq $arm_rem
+align 8
+dq $arm_shl
+align 8
+dq $arm_shr
+align 8
+dq $arm_and
+align 8
+dq $arm_or
+align 8
+dq $arm_xor
+align 8
+dq $arm_eq
+align 8
+dq $arm_neq
+align 8
+dq $arm_lt
+align 8
+dq $arm_let
+align 8
+dq $arm_gt
+align 8
+dq $arm_get
+align 8
+dq $arm_neg
+align 8
+dq $arm_cmpl
+align 8
+dq $arm_not
+align 8
+dq $arm_ch
+align 8
+dq $arm_uch
+align 8
+dq $arm_sh
+align 8
+dq $arm_ush
+align 8
+dq $arm_llsx
+align 8
+dq $arm_llzx
+align 8
+dq $arm_addr_of
+align 8
+dq $arm_ind
+align 8
+dq $arm_asn
+align 8
+dq $arm_call
+align 8
+dq $arm_indcall
+align 8
+dq $arm_ind_asn
+align 8
+dq $arm_lab
+align 8
+dq $arm_jmp
+align 8
+dq $arm_arg
+align 8
+dq $arm_ret
+align 8
+dq $arm_switch
+align 8
+dq $arm_case
+align 8
+dq $arm_cbr
+align 8
+dq $arm_begarg
+align 8
+dq $arm_nop
+segment .bss
+alignb 4
+$reg_descr_tab:
+resb 64
+segment .data
+align 8
+$str_segment:
+align 8
+dq _@S547
+align 8
+dq _@S548
+align 8
+dq _@S549
+align 8
+dq _@S550
+segment .bss
+alignb 8
+$arm_output_file:
+resb 8
+alignb 4
+$jump_tables_counter:
+resb 4
+alignb 4
+$modified:
+resb 64
+alignb 4
+$code_cont_counter:
+resb 4
+alignb 4
+$temp_struct_size:
+resb 4
+alignb 4
+$a_mapsym_counter:
+resb 4
+alignb 8
+$func_body:
+resb 8
+alignb 4
+$calls_to_fix:
+resb 256
+segment .data
+align 8
+$libfuncs:
+align 8
+dq _@S551
+align 8
+dq _@S552
+align 8
+dq _@S553
+align 8
+dq _@S554
+align 8
+dq _@S555
+align 8
+dq _@S556
+align 8
+dq _@S557
+align 8
+dq _@S558
+align 8
+dq _@S559
+align 8
+dq _@S560
+align 8
+dq _@S561
+align 8
+dq _@S562
+align 8
+dq _@S563
+align 8
+dq _@S564
+align 8
+dq _@S565
+align 8
+dq _@S566
+align 8
+dq _@S567
+align 8
+dq _@S568
+segment .bss
+alignb 8
+$func_prolog:
+resb 8
+alignb 4
+$calls_to_fix_counter:
+resb 4
+alignb 8
+$func_epilog:
+resb 8
+alignb 4
+$retvals_to_fix_counter:
+resb 4
+alignb 4
+$retvals_to_fix:
+resb 256
+alignb 8
+$temp_list:
+resb 8
+alignb 4
+$d_mapsym_counter:
+resb 4
+alignb 4
+$size_of_local_area:
+resb 4
+alignb 4
+$max_arg_offs:
+resb 4
+
+; == extern symbols
+extern $verbose_asm
+extern $static_objects_list
+extern $ic_addresses
+extern $string_write
+extern $arena_destroy
+extern $liveness_and_next_use
+extern $get_sizeof
+extern $__assert
+extern $bset_member
+extern $stderr
+extern $string_get_pos
+extern $nid2sid_tab
+extern $string_set_pos
+extern $string_curr
+extern $get_var_nid
+extern $get_sto_class_spec
+extern $string_free
+extern $calloc
+extern $memset
+extern $include_libc
+extern $C_source
+extern $fprintf
+extern $address_taken_variables
+extern $is_signed_int
+extern $sprintf
+extern $round_up
+extern $include_liblux
+extern $arena_alloc
+extern $get_type_category
+extern $is_integer
+extern $strlen
+extern $string_vprintf
+extern $cfg_nodes
+extern $string_clear
+extern $string_new
+extern $nid_counter
+extern $new_cg_node
+extern $memcpy
+extern $ic_main
+extern $get_member_descriptor
+extern $cg_nodes
+extern $string_printf
+extern $is_unsigned_int
+extern $get_type_spec
+extern $arena_new
+extern $ic_instructions
+extern $free
+extern $malloc
+extern $compute_liveness_and_next_use
+extern $get_alignment
+extern $memcpy
+extern $memset
+
+; == string literals
+segment .rodata
+_@S0:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S1:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x405f3d20
+dd 0x00642553
+_@S2:
+dd 0x20766f6d
+dd 0x2c642572
+dd 0x64257220
+db 0x00
+_@S3:
+dd 0x7372646c
+db 0x68
+db 0x00
+_@S4:
+dd 0x6872646c
+db 0x00
+_@S5:
+dd 0x7372646c
+db 0x62
+db 0x00
+_@S6:
+dd 0x6272646c
+db 0x00
+_@S7:
+dd 0x0072646c
+_@S8:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x73253d20
+dd 0x00732540
+_@S9:
+dd 0x72207325
+dd 0x202c6425
+dd 0x6425725b
+db 0x5d
+db 0x00
+_@S10:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x73253d20
+db 0x00
+_@S11:
+dd 0x72207325
+dd 0x202c6425
+dd 0x6425725b
+db 0x5d
+db 0x00
+_@S12:
+dd 0x72207325
+dd 0x202c6425
+dd 0x3131725b
+dd 0x232d202c
+dd 0x005d6425
+_@S13:
+dd 0x72207325
+dd 0x202c6425
+dd 0x3131725b
+dd 0x2523202c
+db 0x64
+db 0x5d
+db 0x00
+_@S14:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S15:
+dd 0x72207325
+dd 0x202c6425
+dd 0x3131725b
+dd 0x2572202c
+db 0x64
+db 0x5d
+db 0x00
+_@S16:
+dd 0x20766f6d
+dd 0x2c642572
+dd 0x64257220
+db 0x00
+_@S17:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x31725b20
+dd 0x2d202c31
+dd 0x5d642523
+db 0x00
+_@S18:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S19:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x31725b20
+dd 0x72202c31
+dd 0x005d6425
+_@S20:
+dd 0x20727473
+dd 0x202c3072
+dd 0x3331725b
+dd 0x232d202c
+dd 0x00215d34
+_@S21:
+dd 0x646d7473
+dd 0x31722062
+dd 0x202c2133
+dd 0x2c30727b
+dd 0x7d317220
+db 0x00
+_@S22:
+dd 0x646d7473
+dd 0x31722062
+dd 0x202c2133
+dd 0x2c30727b
+dd 0x2c317220
+dd 0x7d327220
+db 0x00
+_@S23:
+dd 0x646d7473
+dd 0x31722062
+dd 0x202c2133
+dd 0x2c30727b
+dd 0x2c317220
+dd 0x2c327220
+dd 0x7d337220
+db 0x00
+_@S24:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x00732520
+_@S25:
+db 0x6c
+db 0x74
+db 0x00
+_@S26:
+db 0x6c
+db 0x6f
+db 0x00
+_@S27:
+dd 0x25766f6d
+dd 0x25722073
+dd 0x23202c64
+db 0x31
+db 0x00
+_@S28:
+db 0x67
+db 0x65
+db 0x00
+_@S29:
+db 0x68
+db 0x73
+db 0x00
+_@S30:
+dd 0x25766f6d
+dd 0x25722073
+dd 0x23202c64
+db 0x30
+db 0x00
+_@S31:
+dd 0x2072726f
+dd 0x2c642572
+dd 0x64257220
+dd 0x2572202c
+db 0x64
+db 0x00
+_@S32:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x00302320
+_@S33:
+dd 0x20716562
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S34:
+dd 0x20656e62
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S35:
+db 0x25
+db 0x73
+db 0x00
+_@S36:
+db 0x0a
+db 0x00
+_@S37:
+dd 0x2e642424
+dd 0x003a6425
+_@S38:
+db 0x0a
+db 0x00
+_@S39:
+dd 0x696c612e
+dd 0x23206e67
+db 0x25
+db 0x75
+db 0x00
+_@S40:
+db 0x0a
+db 0x00
+_@S41:
+db 0x25
+db 0x73
+db 0x00
+_@S42:
+db 0x0a
+db 0x00
+_@S43:
+dd 0x2e642424
+dd 0x003a6425
+_@S44:
+db 0x0a
+db 0x00
+_@S45:
+dd 0x696c612e
+dd 0x20626e67
+dd 0x00752523
+_@S46:
+db 0x0a
+db 0x00
+_@S47:
+dd 0x40732524
+dd 0x003a7325
+_@S48:
+db 0x0a
+db 0x00
+_@S49:
+dd 0x6f6c672e
+dd 0x206c6162
+db 0x25
+db 0x73
+db 0x00
+_@S50:
+db 0x0a
+db 0x00
+_@S51:
+dd 0x3a732524
+db 0x00
+_@S52:
+db 0x0a
+db 0x00
+_@S53:
+dd 0x7365722e
+dd 0x75252320
+db 0x00
+_@S54:
+db 0x0a
+db 0x00
+_@S55:
+dd 0x2072726f
+dd 0x2c642572
+dd 0x64257220
+dd 0x7325202c
+db 0x00
+_@S56:
+dd 0x2072726f
+dd 0x2c642572
+dd 0x64257220
+dd 0x7325202c
+db 0x00
+_@S57:
+dd 0x2072726f
+dd 0x2c642572
+dd 0x64257220
+dd 0x7325202c
+db 0x00
+_@S58:
+dd 0x20726f65
+dd 0x2c642572
+dd 0x64257220
+dd 0x7325202c
+db 0x00
+_@S59:
+dd 0x20726f65
+dd 0x2c642572
+dd 0x64257220
+dd 0x7325202c
+db 0x00
+_@S60:
+dd 0x20726f65
+dd 0x2c642572
+dd 0x64257220
+dd 0x7325202c
+db 0x00
+_@S61:
+dd 0x2072646c
+dd 0x202c3072
+dd 0x3331725b
+dd 0x23202c5d
+db 0x34
+db 0x00
+_@S62:
+dd 0x696d646c
+dd 0x31722061
+dd 0x202c2133
+dd 0x2c30727b
+dd 0x7d317220
+db 0x00
+_@S63:
+dd 0x696d646c
+dd 0x31722061
+dd 0x202c2133
+dd 0x2c30727b
+dd 0x2c317220
+dd 0x7d327220
+db 0x00
+_@S64:
+dd 0x696d646c
+dd 0x31722061
+dd 0x202c2133
+dd 0x2c30727b
+dd 0x2c317220
+dd 0x2c327220
+dd 0x7d337220
+db 0x00
+_@S65:
+dd 0x68747873
+dd 0x64257220
+dd 0x2572202c
+db 0x64
+db 0x00
+_@S66:
+dd 0x20627573
+dd 0x2c333172
+dd 0x33317220
+dd 0x3123202c
+db 0x32
+db 0x00
+_@S67:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+db 0x33
+db 0x5d
+db 0x00
+_@S68:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x23202c33
+db 0x34
+db 0x5d
+db 0x00
+_@S69:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S70:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x23202c33
+db 0x38
+db 0x5d
+db 0x00
+_@S71:
+dd 0x5f206c62
+dd 0x78756c5f
+dd 0x6d72615f
+dd 0x6d656d5f
+dd 0x00797063
+_@S72:
+dd 0x68727473
+db 0x00
+_@S73:
+dd 0x62727473
+db 0x00
+_@S74:
+dd 0x00727473
+_@S75:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x73253d20
+dd 0x00732540
+_@S76:
+dd 0x72207325
+dd 0x202c6425
+dd 0x6425725b
+db 0x5d
+db 0x00
+_@S77:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x73253d20
+db 0x00
+_@S78:
+dd 0x72207325
+dd 0x202c6425
+dd 0x6425725b
+db 0x5d
+db 0x00
+_@S79:
+dd 0x72207325
+dd 0x202c6425
+dd 0x3131725b
+dd 0x232d202c
+dd 0x005d6425
+_@S80:
+dd 0x72207325
+dd 0x202c6425
+dd 0x3131725b
+dd 0x2523202c
+db 0x64
+db 0x5d
+db 0x00
+_@S81:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S82:
+dd 0x72207325
+dd 0x202c6425
+dd 0x3131725b
+dd 0x2572202c
+db 0x64
+db 0x5d
+db 0x00
+_@S83:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x2d202c31
+dd 0x5d642523
+db 0x00
+_@S84:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S85:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x72202c31
+dd 0x005d6425
+_@S86:
+dd 0x4c407325
+dd 0x003a6425
+_@S87:
+dd 0x206e766d
+dd 0x2c642572
+dd 0x64257220
+db 0x00
+_@S88:
+dd 0x206e766d
+dd 0x2c642572
+dd 0x64257220
+db 0x00
+_@S89:
+dd 0x206e766d
+dd 0x2c642572
+dd 0x64257220
+db 0x00
+_@S90:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x00732520
+_@S91:
+db 0x6c
+db 0x65
+db 0x00
+_@S92:
+db 0x6c
+db 0x73
+db 0x00
+_@S93:
+dd 0x25766f6d
+dd 0x25722073
+dd 0x23202c64
+db 0x31
+db 0x00
+_@S94:
+db 0x67
+db 0x74
+db 0x00
+_@S95:
+db 0x68
+db 0x69
+db 0x00
+_@S96:
+dd 0x25766f6d
+dd 0x25722073
+dd 0x23202c64
+db 0x30
+db 0x00
+_@S97:
+dd 0x20642572
+dd 0x25203e3d
+db 0x73
+db 0x0a
+db 0x00
+_@S98:
+dd 0x62747875
+dd 0x64257220
+dd 0x2572202c
+db 0x64
+db 0x00
+_@S99:
+dd 0x6f77642e
+dd 0x23206472
+dd 0x30257830
+dd 0x30257832
+dd 0x30257832
+dd 0x30257832
+dd 0x000a7832
+_@S100:
+dd 0x7479622e
+dd 0x30232065
+dd 0x32302578
+db 0x78
+db 0x0a
+db 0x00
+_@S101:
+db 0x0a
+db 0x00
+_@S102:
+dd 0x5f746567
+dd 0x30676572
+db 0x00
+_@S103:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S104:
+dd 0x5f746567
+dd 0x30676572
+db 0x00
+_@S105:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S106:
+dd 0x5f746567
+dd 0x30676572
+db 0x00
+_@S107:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S108:
+dd 0x5f746567
+dd 0x30676572
+db 0x00
+_@S109:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S110:
+dd 0x25206c62
+db 0x73
+db 0x00
+_@S111:
+dd 0x20766f6d
+dd 0x202c3472
+db 0x72
+db 0x30
+db 0x00
+_@S112:
+dd 0x20766f6d
+dd 0x202c3572
+db 0x72
+db 0x31
+db 0x00
+_@S113:
+dd 0x20766f6d
+dd 0x202c3472
+db 0x72
+db 0x30
+db 0x00
+_@S114:
+dd 0x756c5f5f
+dd 0x64755f78
+dd 0x32337669
+db 0x00
+_@S115:
+dd 0x756c5f5f
+dd 0x64735f78
+dd 0x32337669
+db 0x00
+_@S116:
+dd 0x25206c62
+db 0x73
+db 0x00
+_@S117:
+dd 0x20766f6d
+dd 0x2c642572
+dd 0x00307220
+_@S118:
+dd 0x3d207325
+dd 0x2524203e
+dd 0x25243a64
+db 0x64
+db 0x0a
+db 0x00
+_@S119:
+dd 0x3d207325
+dd 0x2524203e
+db 0x64
+db 0x0a
+db 0x00
+_@S120:
+dd 0x68747875
+dd 0x64257220
+dd 0x2572202c
+db 0x64
+db 0x00
+_@S121:
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+db 0x58
+db 0x58
+db 0x00
+_@S122:
+dd 0x73252062
+dd 0x64254c40
+db 0x00
+_@S123:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S124:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x64257220
+db 0x00
+_@S125:
+dd 0x20656e62
+dd 0x73407325
+dd 0x4c343677
+db 0x25
+db 0x75
+db 0x00
+_@S126:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S127:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x64257220
+db 0x00
+_@S128:
+dd 0x20716562
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S129:
+dd 0x73407325
+dd 0x4c343677
+dd 0x003a7525
+_@S130:
+dd 0x20766f6d
+dd 0x2c642572
+dd 0x64257220
+dd 0x5341202c
+dd 0x33232052
+db 0x31
+db 0x00
+_@S131:
+db 0x0a
+db 0x00
+_@S132:
+dd 0x3d3d203b
+dd 0x73203d3d
+dd 0x74726174
+dd 0x20666f20
+dd 0x69666564
+dd 0x6974696e
+dd 0x6f206e6f
+dd 0x75662066
+dd 0x6974636e
+dd 0x60206e6f
+dd 0x20277325
+dd 0x3d3d3d3d
+db 0x00
+_@S133:
+db 0x0a
+db 0x00
+_@S134:
+db 0x25
+db 0x73
+db 0x00
+_@S135:
+db 0x0a
+db 0x00
+_@S136:
+dd 0x2e612424
+dd 0x003a6425
+_@S137:
+db 0x0a
+db 0x00
+_@S138:
+dd 0x6f6c672e
+dd 0x206c6162
+dd 0x00732524
+_@S139:
+db 0x0a
+db 0x00
+_@S140:
+dd 0x3a732524
+db 0x00
+_@S141:
+db 0x0a
+db 0x00
+_@S142:
+dd 0x7325203b
+db 0x00
+_@S143:
+dd 0x20727473
+dd 0x202c3072
+dd 0x3131725b
+dd 0x232d202c
+dd 0x0a5d7525
+dd 0x20627573
+dd 0x202c3072
+dd 0x2c313172
+dd 0x75252320
+db 0x00
+_@S144:
+dd 0x5f6d7261
+dd 0x636e7566
+dd 0x6e6f6974
+dd 0x6665645f
+dd 0x74696e69
+dd 0x006e6f69
+_@S145:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S146:
+dd 0x20627573
+dd 0x202c3072
+dd 0x2c313172
+dd 0x75252320
+db 0x00
+_@S147:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+dd 0x75730a75
+dd 0x30722062
+dd 0x3172202c
+dd 0x72202c31
+db 0x25
+db 0x64
+db 0x00
+_@S148:
+dd 0x646d7473
+dd 0x31722062
+dd 0x202c2133
+dd 0x2c30727b
+dd 0x2c317220
+dd 0x2c327220
+dd 0x7d337220
+db 0x00
+_@S149:
+db 0x0a
+db 0x00
+_@S150:
+dd 0x646d7473
+dd 0x31722062
+dd 0x202c2133
+dd 0x3131727b
+dd 0x3172202c
+db 0x34
+db 0x7d
+db 0x00
+_@S151:
+db 0x0a
+db 0x00
+_@S152:
+dd 0x20766f6d
+dd 0x2c313172
+dd 0x33317220
+db 0x00
+_@S153:
+db 0x0a
+db 0x00
+_@S154:
+dd 0x20627573
+dd 0x2c333172
+dd 0x33317220
+dd 0x2523202c
+db 0x64
+db 0x00
+_@S155:
+db 0x0a
+db 0x00
+_@S156:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S157:
+db 0x0a
+db 0x00
+_@S158:
+dd 0x20627573
+dd 0x2c333172
+dd 0x33317220
+dd 0x2572202c
+db 0x64
+db 0x00
+_@S159:
+db 0x0a
+db 0x00
+_@S160:
+dd 0x20766f6d
+dd 0x2c333172
+dd 0x31317220
+db 0x00
+_@S161:
+db 0x0a
+db 0x00
+_@S162:
+dd 0x696d646c
+dd 0x31722061
+dd 0x202c2133
+dd 0x3131727b
+dd 0x3172202c
+db 0x34
+db 0x7d
+db 0x00
+_@S163:
+db 0x0a
+db 0x00
+_@S164:
+dd 0x20646461
+dd 0x2c333172
+dd 0x33317220
+dd 0x3123202c
+db 0x36
+db 0x00
+_@S165:
+db 0x0a
+db 0x00
+_@S166:
+dd 0x20766f6d
+dd 0x2c353172
+dd 0x34317220
+db 0x00
+_@S167:
+db 0x0a
+db 0x00
+_@S168:
+dd 0x6f746c2e
+db 0x72
+db 0x67
+db 0x00
+_@S169:
+db 0x0a
+db 0x00
+_@S170:
+dd 0x72657a2e
+dd 0x2523206f
+db 0x75
+db 0x00
+_@S171:
+db 0x0a
+db 0x00
+_@S172:
+dd 0x696c612e
+dd 0x23206e67
+db 0x25
+db 0x75
+db 0x00
+_@S173:
+db 0x0a
+db 0x00
+_@S174:
+dd 0x72657a2e
+dd 0x2523206f
+db 0x75
+db 0x00
+_@S175:
+db 0x0a
+db 0x00
+_@S176:
+dd 0x696c612e
+dd 0x23206e67
+db 0x25
+db 0x75
+db 0x00
+_@S177:
+db 0x0a
+db 0x00
+_@S178:
+dd 0x696c612e
+dd 0x23206e67
+db 0x25
+db 0x75
+db 0x00
+_@S179:
+db 0x0a
+db 0x00
+_@S180:
+dd 0x72657a2e
+dd 0x2523206f
+db 0x75
+db 0x00
+_@S181:
+db 0x0a
+db 0x00
+_@S182:
+dd 0x696c612e
+dd 0x23206e67
+db 0x25
+db 0x75
+db 0x00
+_@S183:
+db 0x0a
+db 0x00
+_@S184:
+dd 0x7479622e
+db 0x65
+db 0x20
+db 0x00
+_@S185:
+dd 0x696c612e
+dd 0x23206e67
+db 0x32
+db 0x00
+_@S186:
+db 0x0a
+db 0x00
+_@S187:
+dd 0x726f772e
+db 0x64
+db 0x20
+db 0x00
+_@S188:
+dd 0x696c612e
+dd 0x23206e67
+db 0x38
+db 0x00
+_@S189:
+db 0x0a
+db 0x00
+_@S190:
+dd 0x6f77642e
+dd 0x00206472
+_@S191:
+dd 0x00752523
+_@S192:
+db 0x0a
+db 0x00
+_@S193:
+dd 0x6f77642e
+dd 0x00206472
+_@S194:
+dd 0x00752523
+_@S195:
+db 0x0a
+db 0x00
+_@S196:
+dd 0x696c612e
+dd 0x23206e67
+db 0x34
+db 0x00
+_@S197:
+db 0x0a
+db 0x00
+_@S198:
+dd 0x6f77642e
+dd 0x00206472
+_@S199:
+dd 0x00752523
+_@S200:
+db 0x0a
+db 0x00
+_@S201:
+dd 0x20766f6d
+dd 0x2c642572
+dd 0x00302320
+_@S202:
+dd 0x206c756d
+dd 0x2c642572
+dd 0x64257220
+dd 0x7325202c
+db 0x00
+_@S203:
+dd 0x696d646c
+dd 0x25722061
+dd 0x7b202c64
+dd 0x2c642572
+dd 0x64257220
+db 0x7d
+db 0x00
+_@S204:
+dd 0x7372646c
+dd 0x25722068
+dd 0x5b202c64
+dd 0x5d642572
+db 0x00
+_@S205:
+dd 0x6872646c
+dd 0x64257220
+dd 0x725b202c
+dd 0x005d6425
+_@S206:
+dd 0x7372646c
+dd 0x25722062
+dd 0x5b202c64
+dd 0x5d642572
+db 0x00
+_@S207:
+dd 0x6272646c
+dd 0x64257220
+dd 0x725b202c
+dd 0x005d6425
+_@S208:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25725b20
+db 0x64
+db 0x5d
+db 0x00
+_@S209:
+dd 0x73646461
+dd 0x64257220
+dd 0x2572202c
+dd 0x25202c64
+db 0x73
+db 0x00
+_@S210:
+dd 0x20636461
+dd 0x2c642572
+dd 0x64257220
+dd 0x7325202c
+db 0x00
+_@S211:
+dd 0x20646461
+dd 0x2c642572
+dd 0x64257220
+dd 0x7325202c
+db 0x00
+_@S212:
+dd 0x756c5f5f
+dd 0x6d755f78
+dd 0x3233646f
+db 0x00
+_@S213:
+dd 0x756c5f5f
+dd 0x6d735f78
+dd 0x3233646f
+db 0x00
+_@S214:
+dd 0x25206c62
+db 0x73
+db 0x00
+_@S215:
+dd 0x20766f6d
+dd 0x2c642572
+dd 0x00307220
+_@S216:
+dd 0x20627573
+dd 0x2c333172
+dd 0x33317220
+dd 0x3123202c
+db 0x32
+db 0x00
+_@S217:
+dd 0x2072646c
+dd 0x202c3072
+dd 0x3131725b
+dd 0x3823202c
+db 0x5d
+db 0x00
+_@S218:
+dd 0x20727473
+dd 0x202c3072
+dd 0x3331725b
+db 0x5d
+db 0x00
+_@S219:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x23202c33
+db 0x34
+db 0x5d
+db 0x00
+_@S220:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S221:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x23202c33
+db 0x38
+db 0x5d
+db 0x00
+_@S222:
+dd 0x5f206c62
+dd 0x78756c5f
+dd 0x6d72615f
+dd 0x6d656d5f
+dd 0x00797063
+_@S223:
+dd 0x6272646c
+dd 0x2c307220
+dd 0x30725b20
+db 0x5d
+db 0x00
+_@S224:
+dd 0x6872646c
+dd 0x2c307220
+dd 0x30725b20
+db 0x5d
+db 0x00
+_@S225:
+dd 0x2072646c
+dd 0x202c3072
+dd 0x5d30725b
+db 0x00
+_@S226:
+dd 0x00752523
+_@S227:
+dd 0x00642572
+_@S228:
+dd 0x00642572
+_@S229:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x75252320
+db 0x00
+_@S230:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S231:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x64257220
+db 0x00
+_@S232:
+dd 0x20746762
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S233:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x75252320
+db 0x00
+_@S234:
+dd 0x20746c62
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S235:
+dd 0x20627573
+dd 0x2c642572
+dd 0x64257220
+dd 0x2523202c
+db 0x75
+db 0x00
+_@S236:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S237:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x64257220
+db 0x00
+_@S238:
+dd 0x20746c62
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S239:
+dd 0x20627573
+dd 0x2c642572
+dd 0x64257220
+dd 0x2572202c
+db 0x64
+db 0x00
+_@S240:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x6a403d20
+dd 0x00642574
+_@S241:
+dd 0x2072646c
+dd 0x2c353172
+dd 0x25725b20
+dd 0x72202c64
+dd 0x202c6425
+dd 0x204c534c
+dd 0x005d3223
+_@S242:
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S243:
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S244:
+dd 0x6f746c2e
+db 0x72
+db 0x67
+db 0x00
+_@S245:
+db 0x25
+db 0x73
+db 0x00
+_@S246:
+dd 0x2e642424
+dd 0x003a6425
+_@S247:
+dd 0x25746a40
+db 0x64
+db 0x3a
+db 0x00
+_@S248:
+dd 0x6f77642e
+dd 0x25206472
+db 0x73
+db 0x00
+_@S249:
+db 0x25
+db 0x73
+db 0x00
+_@S250:
+dd 0x2e612424
+dd 0x003a6425
+_@S251:
+dd 0x73252062
+dd 0x64254c40
+db 0x00
+_@S252:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x75252320
+db 0x00
+_@S253:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S254:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x64257220
+db 0x00
+_@S255:
+dd 0x20716562
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S256:
+dd 0x5f6d7261
+dd 0x5f746567
+dd 0x7265706f
+dd 0x32646e61
+db 0x00
+_@S257:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S258:
+dd 0x00642572
+_@S259:
+dd 0x00642572
+_@S260:
+dd 0x00642572
+_@S261:
+dd 0x00642572
+_@S262:
+dd 0x73627372
+dd 0x64257220
+dd 0x2572202c
+dd 0x23202c64
+db 0x30
+db 0x00
+_@S263:
+dd 0x20637372
+dd 0x2c642572
+dd 0x64257220
+dd 0x3023202c
+db 0x00
+_@S264:
+dd 0x20627372
+dd 0x2c642572
+dd 0x64257220
+dd 0x3023202c
+db 0x00
+_@S265:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x00732520
+_@S266:
+dd 0x6e766f6d
+dd 0x25722065
+dd 0x23202c64
+db 0x31
+db 0x00
+_@S267:
+dd 0x65766f6d
+dd 0x25722071
+dd 0x23202c64
+db 0x30
+db 0x00
+_@S268:
+dd 0x6173203b
+dd 0x72206576
+dd 0x73696765
+dd 0x73726574
+db 0x00
+_@S269:
+db 0x0a
+db 0x00
+_@S270:
+dd 0x20627573
+dd 0x2c642572
+dd 0x31317220
+dd 0x2523202c
+db 0x64
+db 0x00
+_@S271:
+db 0x0a
+db 0x00
+_@S272:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S273:
+db 0x0a
+db 0x00
+_@S274:
+dd 0x20627573
+dd 0x2c642572
+dd 0x31317220
+dd 0x2572202c
+db 0x64
+db 0x00
+_@S275:
+db 0x0a
+db 0x00
+_@S276:
+dd 0x696d7473
+dd 0x25722061
+dd 0x7b202c64
+db 0x72
+db 0x34
+db 0x00
+_@S277:
+dd 0x6572203b
+dd 0x726f7473
+dd 0x65722065
+dd 0x74736967
+dd 0x00737265
+_@S278:
+db 0x0a
+db 0x00
+_@S279:
+dd 0x20627573
+dd 0x2c642572
+dd 0x31317220
+dd 0x2523202c
+db 0x64
+db 0x00
+_@S280:
+db 0x0a
+db 0x00
+_@S281:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S282:
+db 0x0a
+db 0x00
+_@S283:
+dd 0x20627573
+dd 0x2c642572
+dd 0x31317220
+dd 0x2572202c
+db 0x64
+db 0x00
+_@S284:
+db 0x0a
+db 0x00
+_@S285:
+dd 0x696d646c
+dd 0x25722061
+dd 0x7b202c64
+db 0x72
+db 0x34
+db 0x00
+_@S286:
+dd 0x2572202c
+db 0x64
+db 0x00
+_@S287:
+dd 0x2572202c
+db 0x64
+db 0x00
+_@S288:
+db 0x7d
+db 0x00
+_@S289:
+db 0x0a
+db 0x00
+_@S290:
+db 0x7d
+db 0x00
+_@S291:
+db 0x0a
+db 0x00
+_@S292:
+dd 0x20646e61
+dd 0x2c642572
+dd 0x64257220
+dd 0x7325202c
+db 0x00
+_@S293:
+dd 0x20646e61
+dd 0x2c642572
+dd 0x64257220
+dd 0x7325202c
+db 0x00
+_@S294:
+dd 0x20646e61
+dd 0x2c642572
+dd 0x64257220
+dd 0x7325202c
+db 0x00
+_@S295:
+dd 0x3d203b0a
+dd 0x626f203d
+dd 0x7463656a
+dd 0x69772073
+dd 0x73206874
+dd 0x69746174
+dd 0x75642063
+dd 0x69746172
+db 0x6f
+db 0x6e
+db 0x00
+_@S296:
+db 0x0a
+db 0x00
+_@S297:
+dd 0x3d203b0a
+dd 0x7865203d
+dd 0x6e726574
+dd 0x6d797320
+dd 0x736c6f62
+db 0x00
+_@S298:
+db 0x0a
+db 0x00
+_@S299:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x00732524
+_@S300:
+db 0x0a
+db 0x00
+_@S301:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6d656d24
+dd 0x00797063
+_@S302:
+db 0x0a
+db 0x00
+_@S303:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6d656d24
+dd 0x00746573
+_@S304:
+db 0x0a
+db 0x00
+_@S305:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6c5f5f24
+dd 0x615f7875
+dd 0x6d5f6d72
+dd 0x70636d65
+db 0x79
+db 0x00
+_@S306:
+db 0x0a
+db 0x00
+_@S307:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6c5f5f24
+dd 0x6d5f7875
+dd 0x34366c75
+db 0x00
+_@S308:
+db 0x0a
+db 0x00
+_@S309:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6c5f5f24
+dd 0x735f7875
+dd 0x36766964
+db 0x34
+db 0x00
+_@S310:
+db 0x0a
+db 0x00
+_@S311:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6c5f5f24
+dd 0x755f7875
+dd 0x36766964
+db 0x34
+db 0x00
+_@S312:
+db 0x0a
+db 0x00
+_@S313:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6c5f5f24
+dd 0x735f7875
+dd 0x36646f6d
+db 0x34
+db 0x00
+_@S314:
+db 0x0a
+db 0x00
+_@S315:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6c5f5f24
+dd 0x755f7875
+dd 0x36646f6d
+db 0x34
+db 0x00
+_@S316:
+db 0x0a
+db 0x00
+_@S317:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6c5f5f24
+dd 0x735f7875
+dd 0x34366c68
+db 0x00
+_@S318:
+db 0x0a
+db 0x00
+_@S319:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6c5f5f24
+dd 0x735f7875
+dd 0x36726873
+db 0x34
+db 0x00
+_@S320:
+db 0x0a
+db 0x00
+_@S321:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6c5f5f24
+dd 0x755f7875
+dd 0x36726873
+db 0x34
+db 0x00
+_@S322:
+db 0x0a
+db 0x00
+_@S323:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6c5f5f24
+dd 0x755f7875
+dd 0x36706d63
+db 0x34
+db 0x00
+_@S324:
+db 0x0a
+db 0x00
+_@S325:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6c5f5f24
+dd 0x735f7875
+dd 0x36706d63
+db 0x34
+db 0x00
+_@S326:
+db 0x0a
+db 0x00
+_@S327:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6c5f5f24
+dd 0x755f7875
+dd 0x33766964
+db 0x32
+db 0x00
+_@S328:
+db 0x0a
+db 0x00
+_@S329:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6c5f5f24
+dd 0x735f7875
+dd 0x33766964
+db 0x32
+db 0x00
+_@S330:
+db 0x0a
+db 0x00
+_@S331:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6c5f5f24
+dd 0x755f7875
+dd 0x33646f6d
+db 0x32
+db 0x00
+_@S332:
+db 0x0a
+db 0x00
+_@S333:
+dd 0x7478652e
+dd 0x206e7265
+dd 0x6c5f5f24
+dd 0x735f7875
+dd 0x33646f6d
+db 0x32
+db 0x00
+_@S334:
+db 0x0a
+db 0x00
+_@S335:
+dd 0x3d203b0a
+dd 0x7473203d
+dd 0x676e6972
+dd 0x74696c20
+dd 0x6c617265
+db 0x73
+db 0x0a
+db 0x00
+_@S336:
+dd 0x646f722e
+dd 0x0a617461
+db 0x00
+_@S337:
+dd 0x2e642424
+dd 0x0a3a6425
+db 0x00
+_@S338:
+dd 0x5f5f2062
+dd 0x65646f63
+dd 0x6e6f635f
+dd 0x64254074
+db 0x0a
+db 0x00
+_@S339:
+dd 0x6f746c2e
+dd 0x000a6772
+_@S340:
+dd 0x2e612424
+dd 0x003a6425
+_@S341:
+dd 0x6f635f5f
+dd 0x635f6564
+dd 0x40746e6f
+dd 0x0a3a6425
+db 0x00
+_@S342:
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+dd 0x58585858
+db 0x00
+_@S343:
+dd 0x5f6d7261
+dd 0x00677261
+_@S344:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S345:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S346:
+dd 0x20727473
+dd 0x202c7325
+dd 0x3331725b
+dd 0x2572202c
+db 0x64
+db 0x5d
+db 0x00
+_@S347:
+dd 0x20646461
+dd 0x2c642572
+dd 0x64257220
+dd 0x3423202c
+db 0x00
+_@S348:
+dd 0x20727473
+dd 0x202c7325
+dd 0x3331725b
+dd 0x2572202c
+db 0x64
+db 0x5d
+db 0x00
+_@S349:
+dd 0x20727473
+dd 0x202c7325
+dd 0x3331725b
+dd 0x2523202c
+db 0x64
+db 0x5d
+db 0x00
+_@S350:
+dd 0x20727473
+dd 0x202c7325
+dd 0x3331725b
+dd 0x2523202c
+db 0x64
+db 0x5d
+db 0x00
+_@S351:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25725b20
+db 0x64
+db 0x5d
+db 0x00
+_@S352:
+dd 0x696d646c
+dd 0x25722061
+dd 0x7b202c64
+dd 0x2c642572
+dd 0x64257220
+db 0x7d
+db 0x00
+_@S353:
+dd 0x696d646c
+dd 0x25722061
+dd 0x7b202c64
+dd 0x2c642572
+dd 0x64257220
+dd 0x2572202c
+db 0x64
+db 0x7d
+db 0x00
+_@S354:
+dd 0x696d646c
+dd 0x25722061
+dd 0x7b202c64
+dd 0x2c642572
+dd 0x64257220
+dd 0x2572202c
+dd 0x72202c64
+dd 0x007d6425
+_@S355:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25725b20
+db 0x64
+db 0x5d
+db 0x00
+_@S356:
+dd 0x696d646c
+dd 0x25722061
+dd 0x7b202c64
+dd 0x2c642572
+dd 0x64257220
+db 0x7d
+db 0x00
+_@S357:
+dd 0x696d646c
+dd 0x25722061
+dd 0x7b202c64
+dd 0x2c642572
+dd 0x64257220
+dd 0x2572202c
+db 0x64
+db 0x7d
+db 0x00
+_@S358:
+dd 0x20627573
+dd 0x2c333172
+dd 0x33317220
+dd 0x3123202c
+db 0x32
+db 0x00
+_@S359:
+dd 0x20646461
+dd 0x2c642572
+dd 0x64257220
+dd 0x2523202c
+db 0x64
+db 0x00
+_@S360:
+dd 0x5f6d7261
+dd 0x00677261
+_@S361:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S362:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x23202c33
+db 0x34
+db 0x5d
+db 0x00
+_@S363:
+dd 0x20646461
+dd 0x2c642572
+dd 0x33317220
+dd 0x2523202c
+db 0x64
+db 0x00
+_@S364:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+db 0x33
+db 0x5d
+db 0x00
+_@S365:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S366:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x23202c33
+db 0x38
+db 0x5d
+db 0x00
+_@S367:
+dd 0x5f206c62
+dd 0x78756c5f
+dd 0x6d72615f
+dd 0x6d656d5f
+dd 0x00797063
+_@S368:
+dd 0x20627573
+dd 0x2c333172
+dd 0x33317220
+dd 0x3123202c
+db 0x32
+db 0x00
+_@S369:
+dd 0x20646461
+dd 0x2c642572
+dd 0x33317220
+dd 0x2523202c
+db 0x64
+db 0x00
+_@S370:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S371:
+dd 0x20646461
+dd 0x2c642572
+dd 0x33317220
+dd 0x2572202c
+db 0x64
+db 0x00
+_@S372:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+db 0x33
+db 0x5d
+db 0x00
+_@S373:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x23202c33
+db 0x34
+db 0x5d
+db 0x00
+_@S374:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S375:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x23202c33
+db 0x38
+db 0x5d
+db 0x00
+_@S376:
+dd 0x5f206c62
+dd 0x78756c5f
+dd 0x6d72615f
+dd 0x6d656d5f
+dd 0x00797063
+_@S377:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x23202c33
+dd 0x005d6425
+_@S378:
+dd 0x5f6d7261
+dd 0x00677261
+_@S379:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S380:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x00302320
+_@S381:
+dd 0x65766f6d
+dd 0x25722071
+dd 0x23202c64
+db 0x31
+db 0x00
+_@S382:
+dd 0x6e766f6d
+dd 0x25722065
+dd 0x23202c64
+db 0x30
+db 0x00
+_@S383:
+dd 0x25206c62
+db 0x73
+db 0x00
+_@S384:
+dd 0x20766f6d
+dd 0x202c3472
+db 0x72
+db 0x30
+db 0x00
+_@S385:
+dd 0x20766f6d
+dd 0x202c3572
+db 0x72
+db 0x31
+db 0x00
+_@S386:
+dd 0x25206c62
+db 0x73
+db 0x00
+_@S387:
+dd 0x20766f6d
+dd 0x202c3472
+db 0x72
+db 0x30
+db 0x00
+_@S388:
+dd 0x20766f6d
+dd 0x202c3572
+db 0x72
+db 0x31
+db 0x00
+_@S389:
+dd 0x20766f6d
+dd 0x202c3272
+db 0x23
+db 0x30
+db 0x00
+_@S390:
+dd 0x20766f6d
+dd 0x202c3372
+db 0x23
+db 0x30
+db 0x00
+_@S391:
+dd 0x5f206c62
+dd 0x78756c5f
+dd 0x6d63755f
+dd 0x00343670
+_@S392:
+dd 0x20706d63
+dd 0x202c3072
+db 0x23
+db 0x31
+db 0x00
+_@S393:
+dd 0x65766f6d
+dd 0x34722071
+dd 0x3123202c
+db 0x00
+_@S394:
+dd 0x6e766f6d
+dd 0x34722065
+dd 0x3023202c
+db 0x00
+_@S395:
+dd 0x25206c62
+db 0x73
+db 0x00
+_@S396:
+dd 0x20706d63
+dd 0x202c3072
+db 0x23
+db 0x31
+db 0x00
+_@S397:
+dd 0x65766f6d
+dd 0x34722071
+dd 0x3123202c
+db 0x00
+_@S398:
+dd 0x6e766f6d
+dd 0x34722065
+dd 0x3023202c
+db 0x00
+_@S399:
+dd 0x20706d63
+dd 0x202c3072
+db 0x23
+db 0x31
+db 0x00
+_@S400:
+dd 0x6e766f6d
+dd 0x34722065
+dd 0x3123202c
+db 0x00
+_@S401:
+dd 0x65766f6d
+dd 0x34722071
+dd 0x3023202c
+db 0x00
+_@S402:
+dd 0x20706d63
+dd 0x202c3072
+db 0x23
+db 0x34
+db 0x00
+_@S403:
+dd 0x65766f6d
+dd 0x34722071
+dd 0x3123202c
+db 0x00
+_@S404:
+dd 0x6e766f6d
+dd 0x34722065
+dd 0x3023202c
+db 0x00
+_@S405:
+dd 0x20706d63
+dd 0x202c3072
+db 0x23
+db 0x32
+db 0x00
+_@S406:
+dd 0x65766f6d
+dd 0x34722071
+dd 0x3123202c
+db 0x00
+_@S407:
+dd 0x6e766f6d
+dd 0x34722065
+dd 0x3023202c
+db 0x00
+_@S408:
+dd 0x20706d63
+dd 0x202c3072
+db 0x23
+db 0x34
+db 0x00
+_@S409:
+dd 0x6e766f6d
+dd 0x34722065
+dd 0x3123202c
+db 0x00
+_@S410:
+dd 0x65766f6d
+dd 0x34722071
+dd 0x3023202c
+db 0x00
+_@S411:
+dd 0x20706d63
+dd 0x202c3072
+db 0x23
+db 0x32
+db 0x00
+_@S412:
+dd 0x6e766f6d
+dd 0x34722065
+dd 0x3123202c
+db 0x00
+_@S413:
+dd 0x65766f6d
+dd 0x34722071
+dd 0x3023202c
+db 0x00
+_@S414:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x73253d20
+dd 0x00732540
+_@S415:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x73253d20
+db 0x00
+_@S416:
+dd 0x20646461
+dd 0x2c642572
+dd 0x31317220
+dd 0x2523202c
+db 0x75
+db 0x00
+_@S417:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S418:
+dd 0x20646461
+dd 0x2c642572
+dd 0x31317220
+dd 0x2572202c
+db 0x64
+db 0x00
+_@S419:
+dd 0x5f6d7261
+dd 0x74617473
+dd 0x655f6369
+dd 0x00727078
+_@S420:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S421:
+dd 0x2553405f
+db 0x64
+db 0x3a
+db 0x00
+_@S422:
+db 0x0a
+db 0x00
+_@S423:
+dd 0x2553405f
+db 0x64
+db 0x2b
+db 0x00
+_@S424:
+dd 0x25407325
+db 0x73
+db 0x2b
+db 0x00
+_@S425:
+dd 0x002b7325
+_@S426:
+dd 0x5f6d7261
+dd 0x74617473
+dd 0x655f6369
+dd 0x00727078
+_@S427:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S428:
+dd 0x73252062
+dd 0x64254c40
+db 0x00
+_@S429:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S430:
+dd 0x20727473
+dd 0x2c642572
+dd 0x25725b20
+db 0x64
+db 0x5d
+db 0x00
+_@S431:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S432:
+dd 0x20727473
+dd 0x2c642572
+dd 0x25725b20
+dd 0x23202c64
+db 0x34
+db 0x5d
+db 0x00
+_@S433:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x405f3d20
+dd 0x00642553
+_@S434:
+dd 0x20727473
+dd 0x2c642572
+dd 0x25725b20
+db 0x64
+db 0x5d
+db 0x00
+_@S435:
+dd 0x20766f6d
+dd 0x2c642572
+dd 0x00302320
+_@S436:
+dd 0x20727473
+dd 0x2c642572
+dd 0x25725b20
+dd 0x23202c64
+db 0x34
+db 0x5d
+db 0x00
+_@S437:
+dd 0x5f6d7261
+dd 0x5f646e69
+dd 0x006e7361
+_@S438:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S439:
+dd 0x696d7473
+dd 0x25722061
+dd 0x7b202c64
+dd 0x2c642572
+dd 0x64257220
+db 0x7d
+db 0x00
+_@S440:
+dd 0x20627573
+dd 0x2c333172
+dd 0x33317220
+dd 0x3123202c
+db 0x32
+db 0x00
+_@S441:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+db 0x33
+db 0x5d
+db 0x00
+_@S442:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x23202c33
+db 0x34
+db 0x5d
+db 0x00
+_@S443:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S444:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x23202c33
+db 0x38
+db 0x5d
+db 0x00
+_@S445:
+dd 0x5f206c62
+dd 0x78756c5f
+dd 0x6d72615f
+dd 0x6d656d5f
+dd 0x00797063
+_@S446:
+dd 0x68727473
+db 0x00
+_@S447:
+dd 0x62727473
+db 0x00
+_@S448:
+dd 0x00727473
+_@S449:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S450:
+dd 0x72207325
+dd 0x202c6425
+dd 0x6425725b
+db 0x5d
+db 0x00
+_@S451:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x405f3d20
+dd 0x00642553
+_@S452:
+dd 0x72207325
+dd 0x202c6425
+dd 0x6425725b
+db 0x5d
+db 0x00
+_@S453:
+dd 0x72207325
+dd 0x202c6425
+dd 0x6425725b
+db 0x5d
+db 0x00
+_@S454:
+dd 0x20766f6d
+dd 0x2c642572
+dd 0x64257220
+dd 0x534c202c
+dd 0x7325204c
+db 0x00
+_@S455:
+dd 0x0052534c
+_@S456:
+dd 0x00525341
+_@S457:
+dd 0x20766f6d
+dd 0x2c642572
+dd 0x64257220
+dd 0x7325202c
+dd 0x00732520
+_@S458:
+dd 0x20786c62
+dd 0x00642572
+_@S459:
+dd 0x20766f6d
+dd 0x202c3472
+db 0x72
+db 0x30
+db 0x00
+_@S460:
+dd 0x20766f6d
+dd 0x202c3572
+db 0x72
+db 0x31
+db 0x00
+_@S461:
+dd 0x20766f6d
+dd 0x202c3472
+db 0x72
+db 0x30
+db 0x00
+_@S462:
+dd 0x725f6f64
+dd 0x706f6c65
+dd 0x6d756a5f
+db 0x70
+db 0x00
+_@S463:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S464:
+dd 0x20656e62
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S465:
+dd 0x20716562
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S466:
+dd 0x20656762
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S467:
+dd 0x20736862
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S468:
+dd 0x20746762
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S469:
+dd 0x20696862
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S470:
+dd 0x20656c62
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S471:
+dd 0x20736c62
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S472:
+dd 0x20746c62
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S473:
+dd 0x206f6c62
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S474:
+dd 0x20716562
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S475:
+dd 0x20656e62
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S476:
+dd 0x20746c62
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S477:
+dd 0x206f6c62
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S478:
+dd 0x20656c62
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S479:
+dd 0x20736c62
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S480:
+dd 0x20746762
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S481:
+dd 0x20696862
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S482:
+dd 0x20656762
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S483:
+dd 0x20736862
+dd 0x4c407325
+db 0x25
+db 0x64
+db 0x00
+_@S484:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S485:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S486:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x405f3d20
+dd 0x00642553
+_@S487:
+dd 0x20766f6d
+dd 0x2c642572
+dd 0x00302320
+_@S488:
+dd 0x5f6d7261
+dd 0x64616f6c
+db 0x32
+db 0x00
+_@S489:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S490:
+dd 0x20766f6d
+dd 0x2c642572
+dd 0x64257220
+db 0x00
+_@S491:
+dd 0x20766f6d
+dd 0x2c642572
+dd 0x64257220
+db 0x00
+_@S492:
+dd 0x5f6d7261
+dd 0x64616f6c
+db 0x32
+db 0x00
+_@S493:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S494:
+dd 0x5f6d7261
+dd 0x64616f6c
+db 0x32
+db 0x00
+_@S495:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S496:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x73253d20
+dd 0x00732540
+_@S497:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x73253d20
+db 0x00
+_@S498:
+dd 0x696d646c
+dd 0x25722061
+dd 0x7b202c64
+dd 0x2c642572
+dd 0x64257220
+db 0x7d
+db 0x00
+_@S499:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x31725b20
+dd 0x2d202c31
+dd 0x5d642523
+db 0x00
+_@S500:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x31725b20
+dd 0x2d202c31
+dd 0x5d642523
+db 0x00
+_@S501:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x31725b20
+dd 0x23202c31
+dd 0x005d6425
+_@S502:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x31725b20
+dd 0x23202c31
+dd 0x005d6425
+_@S503:
+dd 0x20766f6d
+dd 0x2c642572
+dd 0x64257220
+db 0x00
+_@S504:
+dd 0x5f6d7261
+dd 0x64616f6c
+db 0x32
+db 0x00
+_@S505:
+dd 0x2f637273
+dd 0x74736574
+dd 0x65732f73
+dd 0x612f666c
+dd 0x635f6d72
+dd 0x2f6e6567
+dd 0x5f6d7261
+dd 0x6e656763
+db 0x2e
+db 0x63
+db 0x00
+_@S506:
+dd 0x20766f6d
+dd 0x2c642572
+dd 0x64257220
+db 0x00
+_@S507:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x31725b20
+dd 0x2d202c31
+dd 0x5d642523
+db 0x00
+_@S508:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x31725b20
+dd 0x2d202c31
+dd 0x5d642523
+db 0x00
+_@S509:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S510:
+dd 0x20646461
+dd 0x2c642572
+dd 0x64257220
+dd 0x3172202c
+db 0x31
+db 0x00
+_@S511:
+dd 0x696d646c
+dd 0x25722061
+dd 0x7b202c64
+dd 0x2c642572
+dd 0x64257220
+db 0x7d
+db 0x00
+_@S512:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x73253d20
+dd 0x00732540
+_@S513:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x73253d20
+db 0x00
+_@S514:
+dd 0x696d7473
+dd 0x25722061
+dd 0x7b202c64
+dd 0x2c642572
+dd 0x64257220
+db 0x7d
+db 0x00
+_@S515:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x2d202c31
+dd 0x5d642523
+db 0x00
+_@S516:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x2d202c31
+dd 0x5d642523
+db 0x00
+_@S517:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x23202c31
+dd 0x005d6425
+_@S518:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x23202c31
+dd 0x005d6425
+_@S519:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x2d202c31
+dd 0x5d642523
+db 0x00
+_@S520:
+dd 0x20727473
+dd 0x2c642572
+dd 0x31725b20
+dd 0x2d202c31
+dd 0x5d642523
+db 0x00
+_@S521:
+dd 0x2072646c
+dd 0x2c642572
+dd 0x25233d20
+db 0x75
+db 0x00
+_@S522:
+dd 0x20646461
+dd 0x2c642572
+dd 0x64257220
+dd 0x3172202c
+db 0x31
+db 0x00
+_@S523:
+dd 0x696d7473
+dd 0x25722061
+dd 0x7b202c64
+dd 0x2c642572
+dd 0x64257220
+db 0x7d
+db 0x00
+_@S524:
+dd 0x73627573
+dd 0x64257220
+dd 0x2572202c
+dd 0x25202c64
+db 0x73
+db 0x00
+_@S525:
+dd 0x20636273
+dd 0x2c642572
+dd 0x64257220
+dd 0x7325202c
+db 0x00
+_@S526:
+dd 0x20627573
+dd 0x2c642572
+dd 0x64257220
+dd 0x7325202c
+db 0x00
+_@S527:
+dd 0x62747873
+dd 0x64257220
+dd 0x2572202c
+db 0x64
+db 0x00
+_@S528:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x00732520
+_@S529:
+dd 0x65766f6d
+dd 0x25722071
+dd 0x23202c64
+db 0x31
+db 0x00
+_@S530:
+dd 0x6e766f6d
+dd 0x25722065
+dd 0x23202c64
+db 0x30
+db 0x00
+_@S531:
+dd 0x2553405f
+db 0x64
+db 0x3a
+db 0x00
+_@S532:
+db 0x0a
+db 0x00
+_@S533:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x00732520
+_@S534:
+db 0x67
+db 0x74
+db 0x00
+_@S535:
+db 0x68
+db 0x69
+db 0x00
+_@S536:
+dd 0x25766f6d
+dd 0x25722073
+dd 0x23202c64
+db 0x31
+db 0x00
+_@S537:
+db 0x6c
+db 0x65
+db 0x00
+_@S538:
+db 0x6c
+db 0x73
+db 0x00
+_@S539:
+dd 0x25766f6d
+dd 0x25722073
+dd 0x23202c64
+db 0x30
+db 0x00
+_@S540:
+dd 0x20706d63
+dd 0x2c642572
+dd 0x00732520
+_@S541:
+db 0x67
+db 0x65
+db 0x00
+_@S542:
+db 0x68
+db 0x73
+db 0x00
+_@S543:
+dd 0x25766f6d
+dd 0x25722073
+dd 0x23202c64
+db 0x31
+db 0x00
+_@S544:
+db 0x6c
+db 0x74
+db 0x00
+_@S545:
+db 0x6c
+db 0x6f
+db 0x00
+_@S546:
+dd 0x25766f6d
+dd 0x25722073
+dd 0x23202c64
+db 0x30
+db 0x00
+_@S547:
+dd 0x7461642e
+db 0x61
+db 0x00
+_@S548:
+dd 0x7865742e
+db 0x74
+db 0x00
+_@S549:
+dd 0x7373622e
+db 0x00
+_@S550:
+dd 0x646f722e
+dd 0x00617461
+_@S551:
+dd 0x756c5f5f
+dd 0x756d5f78
+dd 0x0034366c
+_@S552:
+dd 0x756c5f5f
+dd 0x64735f78
+dd 0x34367669
+db 0x00
+_@S553:
+dd 0x756c5f5f
+dd 0x64755f78
+dd 0x34367669
+db 0x00
+_@S554:
+dd 0x756c5f5f
+dd 0x6d735f78
+dd 0x3436646f
+db 0x00
+_@S555:
+dd 0x756c5f5f
+dd 0x6d755f78
+dd 0x3436646f
+db 0x00
+_@S556:
+dd 0x756c5f5f
+dd 0x68735f78
+dd 0x0034366c
+_@S557:
+dd 0x756c5f5f
+dd 0x73735f78
+dd 0x34367268
+db 0x00
+_@S558:
+dd 0x756c5f5f
+dd 0x73755f78
+dd 0x34367268
+db 0x00
+_@S559:
+dd 0x756c5f5f
+dd 0x63755f78
+dd 0x3436706d
+db 0x00
+_@S560:
+dd 0x756c5f5f
+dd 0x63755f78
+dd 0x3436706d
+db 0x00
+_@S561:
+dd 0x756c5f5f
+dd 0x63755f78
+dd 0x3436706d
+db 0x00
+_@S562:
+dd 0x756c5f5f
+dd 0x63755f78
+dd 0x3436706d
+db 0x00
+_@S563:
+dd 0x756c5f5f
+dd 0x63755f78
+dd 0x3436706d
+db 0x00
+_@S564:
+dd 0x756c5f5f
+dd 0x63755f78
+dd 0x3436706d
+db 0x00
+_@S565:
+dd 0x756c5f5f
+dd 0x63735f78
+dd 0x3436706d
+db 0x00
+_@S566:
+dd 0x756c5f5f
+dd 0x63735f78
+dd 0x3436706d
+db 0x00
+_@S567:
+dd 0x756c5f5f
+dd 0x63735f78
+dd 0x3436706d
+db 0x00
+_@S568:
+dd 0x756c5f5f
+dd 0x63735f78
+dd 0x3436706d
+db 0x00
@@ -0,0 +1,8 @@
+#ifndef AST2C_H_
+#define AST2C_H_
+
+#include "parser.h"
+
+char *ast2c(ExecNode *n);
+
+#endif
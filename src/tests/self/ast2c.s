@@ -0,0 +1,1266 @@
+.extern fgets
+.extern is_complete
+.extern string_write
+.extern is_struct_union_enum
+.extern get_curr_scope_id
+.extern getenv
+.extern atoi
+.extern exit
+.bss
+.align 8
+c_src:
+.res 8
+.extern stderr
+.extern restore_scope
+.extern string_get_pos
+.extern rewind
+.extern realloc
+.extern lookup_ordinary_id
+.extern snprintf
+# ==== start of definition of function `ast2c' ====
+.text
+ast2c:
+.global ast2c
+addsp 12;        
+# param:`n', offset:-24
+# var: s, offset: 8
+ldiqw c_src;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1;
+ldidw 256;
+ldiqw string_new;
+call 4;
+ldiqw c_src;
+stqw;
+pop;
+pop;
+@L1:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw c_src;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldidw 1;
+adddw;
+udw2qw;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw c_src;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldiqw c_src;
+ldqw;
+ldiqw string_curr;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern strpbrk
+.extern pop_struct_descriptor
+.extern fseek
+.extern string_set_pos
+.extern push_struct_descriptor
+.extern sscanf
+.extern fputc
+.extern vsscanf
+.extern fwrite
+.extern string_curr
+.extern read_stream
+.extern strspn
+.extern reset_enum_val
+.extern strtoll
+.extern get_sto_class_spec
+.extern string_free
+.extern fclose
+.extern preprocess
+.extern analyze_decl_specs
+.extern strstr
+.extern calloc
+.extern pop_scope
+.extern memset
+.extern file_exists
+.extern stringify_type_exp
+.extern add_quote_dir
+.extern strtoul
+.extern fprintf
+.extern get_type_qual
+.extern read_file
+.extern printf
+.extern get_c_token
+.extern lookup_tag
+.extern is_external_id
+.extern sprintf
+.extern strcat
+.extern are_compatible
+.extern free_pre_token
+.extern round_up
+.extern analyze_declarator
+.extern strchr
+.extern add_angle_dir
+.extern stdout
+.extern ilog2
+.extern strcmp
+.extern strtok
+.extern strtol
+.extern parse_header
+.extern stdin
+.extern ftell
+.extern strcpy
+.extern install_tag
+.extern strtoull
+.extern strlen
+.extern token_table
+.extern string_vprintf
+.extern memchr
+.extern new_type_exp_node
+.extern dup_decl_specs
+.extern new_declaration_node
+.extern vfprintf
+.extern hash
+.extern string_clear
+.extern bsearch
+.extern pre_save_pch
+.extern qsort
+.extern analyze_parameter_declaration
+.extern string_new
+.extern memcmp
+.extern pre_load_pch
+.extern vsnprintf
+.extern vsprintf
+.extern memcpy
+.extern fopen
+.extern be_atoi
+.extern push_scope
+.extern free_c_token
+.extern parse
+.extern get_pre_token
+.extern get_member_descriptor
+.extern decl_init
+.extern dup_declarator
+.extern strncat
+.extern fileno
+.extern string_printf
+.extern lookup_external_id
+.extern hash2
+.extern analyze_type_name
+.extern memmove
+.extern replace_extension
+.extern analyze_struct_declarator
+.extern get_type_spec
+.extern analyze_function_definition
+.extern strdup
+.extern analyze_init_declarator
+.extern strncmp
+.extern strncpy
+.extern decl_save_pch
+.extern new_extern_id_node
+.extern decl_load_pch
+.extern analyze_translation_unit
+.extern strnlen
+.extern analyze_enumerator
+.extern set_attributes
+.extern is_typedef_name
+.extern fread
+.extern strrchr
+.extern string_append
+.extern install_macro
+.extern string_buf
+# ==== start of definition of function `conv2src' ====
+.text
+conv2src:
+addsp 12;        
+# param:`n', offset:-24
+# param:`paren', offset:-28
+ldbp -24;
+ldqw;
+ldiqw 48;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L2;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T3;
+jmptab;
+@L5:
+ldiqw @S0;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw @S1;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L6:
+ldiqw @S2;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw @S3;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L7:
+ldiqw @S4;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw @S5;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L8:
+ldiqw @S6;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw @S7;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L9:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw @S8;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L10:
+ldiqw @S9;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L11;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+@L11:
+ldiqw @S10;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L12:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S11;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L13:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S12;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L14:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S13;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L15:
+@L16:
+@L17:
+@L18:
+@L19:
+ldiqw 0;
+ret;
+@L4:
+.data
+.align 8
+@T3:
+.dword 0
+.dword 14
+.qword @L4
+.qword @L5
+.qword @L7
+.qword @L8
+.qword @L15
+.qword @L16
+.qword @L17
+.qword @L10
+.qword @L9
+.qword @L18
+.qword @L6
+.qword @L12
+.qword @L19
+.qword @L13
+.qword @L14
+.text
+jmp @L20;
+@L2:
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T21;
+jmptab;
+@L23:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T24;
+switch;
+@L26:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw @S14;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L27;
+# var: n2, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L28:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L30;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L31;
+ldiqw @S15;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L31:
+@L29:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L28;
+@L30:
+@L27:
+ldiqw @S16;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L32:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw @S17;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw @S18;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L33:
+@L34:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw token_table;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S19;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L35:
+@L36:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw token_table;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S20;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L37:
+@L38:
+@L39:
+@L40:
+@L41:
+@L42:
+@L43:
+@L44:
+ldbp -28;
+lddw;
+jmpf @L45;
+ldiqw @S21;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L45:
+ldiqw token_table;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S22;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldbp -28;
+lddw;
+jmpf @L46;
+ldiqw @S23;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L46:
+ldiqw 0;
+ret;
+@L47:
+# var: s, offset: 8
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw stringify_type_exp;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+jmpf @L48;
+ldiqw @S24;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L48:
+ldbp 8;
+ldqw;
+ldiqw @S25;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldbp -28;
+lddw;
+jmpf @L49;
+ldiqw @S26;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L49:
+ldbp 8;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L50:
+ldbp -28;
+lddw;
+jmpf @L51;
+ldiqw @S27;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L51:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw @S28;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw @S29;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldbp -28;
+lddw;
+jmpf @L52;
+ldiqw @S30;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L52:
+ldiqw 0;
+ret;
+@L53:
+ldbp -28;
+lddw;
+jmpf @L54;
+ldiqw @S31;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L54:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldiqw token_table;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S32;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw conv2src;
+call 12;
+pop;
+pop;
+ldbp -28;
+lddw;
+jmpf @L55;
+ldiqw @S33;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L55:
+ldiqw 0;
+ret;
+@L25:
+.data
+.align 8
+@T24:
+.dword 17
+.dword 6
+.dword 7
+.dword 14
+.dword 15
+.dword 30
+.dword 93
+.dword 94
+.dword 95
+.dword 96
+.dword 97
+.dword 98
+.dword 99
+.dword 100
+.dword 101
+.dword 103
+.dword 105
+.qword @L53
+.qword @L33
+.qword @L34
+.qword @L43
+.qword @L44
+.qword @L50
+.qword @L37
+.qword @L35
+.qword @L38
+.qword @L36
+.qword @L32
+.qword @L26
+.qword @L41
+.qword @L42
+.qword @L40
+.qword @L39
+.qword @L47
+.text
+@L56:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S34;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L57:
+ldiqw @S35;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L58:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S36;
+ldiqw c_src;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L22:
+.data
+.align 8
+@T21:
+.dword 0
+.dword 4
+.qword @L22
+.qword @L23
+.qword @L56
+.qword @L57
+.qword @L58
+.text
+@L20:
+ldidw 0;
+ret;
+.extern ferror
+.extern random
+.extern free
+.extern malloc
+.extern get_external_declarations
+.extern new_decl_list_node
+.extern srandom
+.extern lookup_struct_descriptor
+.extern new_exec_node
+.extern fgetc
+.data
+@S0:
+.byte 105
+.byte 102
+.byte 40
+.byte 0
+@S1:
+.byte 41
+.byte 0
+@S2:
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 40
+.byte 0
+@S3:
+.byte 41
+.byte 0
+@S4:
+.byte 119
+.byte 104
+.byte 105
+.byte 108
+.byte 101
+.byte 40
+.byte 0
+@S5:
+.byte 41
+.byte 0
+@S6:
+.byte 119
+.byte 104
+.byte 105
+.byte 108
+.byte 101
+.byte 40
+.byte 0
+@S7:
+.byte 41
+.byte 59
+.byte 0
+@S8:
+.byte 59
+.byte 0
+@S9:
+.byte 114
+.byte 101
+.byte 116
+.byte 117
+.byte 114
+.byte 110
+.byte 32
+.byte 0
+@S10:
+.byte 59
+.byte 0
+@S11:
+.byte 99
+.byte 97
+.byte 115
+.byte 101
+.byte 32
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 58
+.byte 0
+@S12:
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S13:
+.byte 103
+.byte 111
+.byte 116
+.byte 111
+.byte 32
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S14:
+.byte 40
+.byte 0
+@S15:
+.byte 44
+.byte 0
+@S16:
+.byte 41
+.byte 0
+@S17:
+.byte 91
+.byte 0
+@S18:
+.byte 93
+.byte 0
+@S19:
+.byte 37
+.byte 115
+.byte 0
+@S20:
+.byte 37
+.byte 115
+.byte 0
+@S21:
+.byte 40
+.byte 0
+@S22:
+.byte 37
+.byte 115
+.byte 0
+@S23:
+.byte 41
+.byte 0
+@S24:
+.byte 40
+.byte 0
+@S25:
+.byte 40
+.byte 37
+.byte 115
+.byte 41
+.byte 0
+@S26:
+.byte 41
+.byte 0
+@S27:
+.byte 40
+.byte 0
+@S28:
+.byte 63
+.byte 0
+@S29:
+.byte 58
+.byte 0
+@S30:
+.byte 41
+.byte 0
+@S31:
+.byte 40
+.byte 0
+@S32:
+.byte 37
+.byte 115
+.byte 0
+@S33:
+.byte 41
+.byte 0
+@S34:
+.byte 37
+.byte 108
+.byte 108
+.byte 117
+.byte 0
+@S35:
+.byte 60
+.byte 115
+.byte 116
+.byte 114
+.byte 105
+.byte 110
+.byte 103
+.byte 45
+.byte 108
+.byte 105
+.byte 116
+.byte 101
+.byte 114
+.byte 97
+.byte 108
+.byte 62
+.byte 0
+@S36:
+.byte 37
+.byte 115
+.byte 0
@@ -0,0 +1,16832 @@
+.extern fgets
+.extern get_promoted_type
+# ==== start of definition of function `enforce_type_compatibility' ====
+.text
+enforce_type_compatibility:
+addsp 36;        
+# param:`prev_ds', offset:-24
+# param:`prev_dct', offset:-32
+# param:`ds', offset:-40
+# param:`dct', offset:-48
+ldidw 1;
+ldidw 1;
+ldbp -48;
+ldqw;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw are_compatible;
+call 40;
+pop;
+notdw;
+jmpf @L1;
+# var: d1, offset: 8
+# var: d2, offset: 24
+ldbp -24;
+ldqw;
+ldbp 8;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 8;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -40;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -48;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 24;
+ldiqw stringify_type_exp;
+call 12;
+ldidw 0;
+ldbp 8;
+ldiqw stringify_type_exp;
+call 12;
+ldbp -48;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S0;
+ldbp -48;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -48;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -48;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 52;
+pop;
+pop;
+@L1:
+ldidw 0;
+ret;
+.extern analyze_bitwise_operator
+.bss
+.align 8
+scope_oids:
+.res 128
+.extern pch_get_root
+.extern atom_n
+.extern verbose_asm
+.data
+.align 4
+descr_stack_top:
+.align 4
+.dword -1
+# ==== start of definition of function `is_complete' ====
+.text
+is_complete:
+.global is_complete
+addsp 12;        
+# param:`tag', offset:-24
+# var: tp, offset: 8
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxb 1;
+ldidw 60;
+eqdw;
+jmpf @L2;
+ldidw 1;
+dw2qw;
+ret;
+@L2:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw lookup_tag;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L3:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+notdw;
+jmpf @L6;
+ldidw 865;
+ldiqw @S1;
+ldiqw @S2;
+ldiqw @S3;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L6:
+@L4:
+ldidw 0;
+jmpf @L5;
+jmp @L3;
+@L5:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 55;
+eqdw;
+jmpf @L7;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmp @L8;
+@L7:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+@L8:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern pch_pre_tokens
+.extern cfg_outpath
+.extern pch_type_exp
+.extern analyze_unary_expression
+.extern target_arch
+.extern emit_warning
+.extern arena_destroy
+# ==== start of definition of function `replace_typedef_name' ====
+.text
+replace_typedef_name:
+addsp 52;        
+# param:`decl', offset:-24
+# var: s, offset: 8
+# var: temp, offset: 16
+# var: tq, offset: 24
+# var: ts, offset: 32
+# var: decl_specs, offset: 40
+# var: declarator, offset: 48
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 48;
+stqw;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 32;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 92;
+neqdw;
+jmpf @L9;
+ldiqw 0;
+ret;
+@L9:
+ldidw 1;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_ordinary_id;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw typedef_name_info;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 32;
+ldqw;
+swap2;
+memcpy 48;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw typedef_name_info;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L10;
+ldbp 48;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L11;
+@L12:
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L13;
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 48;
+stqw;
+pop;
+pop;
+jmp @L12;
+@L13:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw dup_declarator;
+call 8;
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 48;
+stqw;
+pop;
+pop;
+jmp @L14;
+@L11:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw dup_declarator;
+call 8;
+ldbp 48;
+stqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L14:
+jmp @L15;
+@L10:
+ldbp 48;
+ldqw;
+ordw;
+jmpf @L16;
+ldidw 0;
+dw2qw;
+ldbp 48;
+stqw;
+pop;
+pop;
+@L16:
+@L15:
+ldbp 40;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L17;
+ldbp 48;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L17;
+ldidw 0;
+jmp @L18;
+@L17:
+ldidw 1;
+@L18:
+jmpf @L19;
+jmp @@replace_typedef_name_nothing;
+@L19:
+ldbp 48;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 11;
+eqdw;
+jmpt @L20;
+ldbp 48;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L20;
+ldidw 0;
+jmp @L21;
+@L20:
+ldidw 1;
+@L21:
+jmpf @L22;
+jmp @@replace_typedef_name_common;
+jmp @L23;
+@L22:
+ldbp 48;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L24;
+@L25:
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 48;
+stqw;
+pop;
+pop;
+@L26:
+ldbp 48;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L28;
+ldbp 48;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L28;
+ldidw 1;
+jmp @L29;
+@L28:
+ldidw 0;
+@L29:
+jmpf @L27;
+jmp @L25;
+@L27:
+ldbp 48;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L30;
+jmp @@replace_typedef_name_common;
+@L30:
+@L24:
+@L23:
+jmp @@replace_typedef_name_nothing;
+@@replace_typedef_name_common:
+ldbp 48;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L31;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S4;
+ldbp 48;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp 48;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 48;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 32;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @@replace_typedef_name_nothing;
+@L31:
+ldbp 48;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L32;
+ldiqw new_type_exp_node;
+call 0;
+ldbp 48;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 48;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L33;
+@L32:
+ldbp 48;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+neqdw;
+jmpf @L34;
+ldidw 112;
+ldbp 48;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L34:
+@L33:
+ldidw 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@@replace_typedef_name_nothing:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L35;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L36;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+notdw;
+jmpf @L37;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L38;
+@L37:
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+neqdw;
+jmpf @L39;
+ldidw 112;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L39:
+@L38:
+jmp @L40;
+@L36:
+ldbp 40;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L41:
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L42;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L41;
+@L42:
+ldiqw new_type_exp_node;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L40:
+@L35:
+ldidw 0;
+ret;
+# ==== start of definition of function `is_struct_union_enum' ====
+.text
+is_struct_union_enum:
+.global is_struct_union_enum
+addsp 0;         
+# param:`t', offset:-20
+ldbp -20;
+lddw;
+ldidw 68;
+eqdw;
+jmpt @L45;
+ldbp -20;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L45;
+ldidw 0;
+jmp @L46;
+@L45:
+ldidw 1;
+@L46:
+jmpt @L43;
+ldbp -20;
+lddw;
+ldidw 55;
+eqdw;
+jmpt @L43;
+ldidw 0;
+jmp @L44;
+@L43:
+ldidw 1;
+@L44:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern get_sizeof
+.extern emit_error
+# ==== start of definition of function `get_curr_scope_id' ====
+.text
+get_curr_scope_id:
+.global get_curr_scope_id
+addsp 0;         
+ldiqw scope_id;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern getenv
+.extern can_assign_to
+.extern atoi
+.extern atom
+.extern exit
+.extern stmt_done
+.extern stderr
+.extern opt_level
+# ==== start of definition of function `restore_scope' ====
+.text
+restore_scope:
+.global restore_scope
+addsp 0;         
+ldidw 0;
+ldiqw delayed_delete;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern tolower
+.extern rewind
+.extern get_type_node
+.extern analyze_logical_operator
+.extern realloc
+.extern pch_ptr
+# ==== start of definition of function `lookup_ordinary_id' ====
+.text
+lookup_ordinary_id:
+.global lookup_ordinary_id
+addsp 12;        
+# param:`id', offset:-24
+# param:`all', offset:-28
+# var: np, offset: 8
+ldiqw delayed_delete;
+lddw;
+jmpf @L47;
+ldiqw delete_scope;
+call 0;
+pop;
+pop;
+@L47:
+ldiqw ordinary_identifiers;
+ldbp -24;
+ldqw;
+ldiqw atom_hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L48:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L50;
+ldbp 8;
+ldqw;
+ldiqw 18;
+addqw;
+ldw;
+ldiqw nesting_level;
+lddw;
+sgtdw;
+jmpf @L51;
+jmp @L49;
+@L51:
+ldbp 8;
+ldqw;
+ldiqw 18;
+addqw;
+ldw;
+ldiqw nesting_level;
+lddw;
+sltdw;
+jmpf @L52;
+ldbp -28;
+lddw;
+notdw;
+jmpf @L52;
+ldidw 1;
+jmp @L53;
+@L52:
+ldidw 0;
+@L53:
+jmpf @L54;
+jmp @L50;
+@L54:
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L55;
+ldbp 8;
+ldqw;
+ret;
+@L55:
+@L49:
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L48;
+@L50:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern snprintf
+.extern strpbrk
+# ==== start of definition of function `pop_struct_descriptor' ====
+.text
+pop_struct_descriptor:
+.global pop_struct_descriptor
+addsp 36;        
+# var: tag, offset: 8
+# var: h, offset: 16
+# var: n, offset: 24
+ldiqw descriptor_stack;
+ldiqw descr_stack_top;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw descr_stack_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+jmpf @L56;
+# var: m, offset: 32
+ldidw 0;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L57:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L59;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ugtdw;
+jmpf @L60;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+@L60:
+@L58:
+ldbp 32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L57;
+@L59:
+@L56:
+ldbp 24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw hash2;
+call 8;
+ldidw 4093;
+dw2qw;
+umodqw;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldiqw struct_descriptor_table;
+ldbp 16;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 24;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw struct_descriptor_table;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw last_descriptor;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+oids_arena:
+.res 128
+.extern fseek
+.extern atom_tag
+.extern islower
+.bss
+.align 8
+struct_descriptor_table:
+.res 32744
+# ==== start of definition of function `push_struct_descriptor' ====
+.text
+push_struct_descriptor:
+.global push_struct_descriptor
+addsp 20;        
+# param:`ty', offset:-24
+# var: i, offset: 4
+# var: tag, offset: 8
+# var: n, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw descr_stack_top;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L61:
+ldbp 4;
+lddw;
+ldidw 0;
+sgetdw;
+jmpf @L63;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 60;
+neqdw;
+jmpf @L64;
+ldiqw descriptor_stack;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L64;
+ldidw 1;
+jmp @L65;
+@L64:
+ldidw 0;
+@L65:
+jmpf @L66;
+ldbp 8;
+ldqw;
+ldiqw token_table;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S5;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 44;
+pop;
+pop;
+@L66:
+@L62:
+decldw 4;
+jmp @L61;
+@L63:
+ldiqw 40;
+pop;
+ldiqw decl_node_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw descriptor_stack;
+ldiqw descr_stack_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern sscanf
+.extern fputc
+.extern stmt_init
+.extern pch_set_root
+.extern vsscanf
+.extern atom_set_tag
+.extern analyze_selection_statement
+.extern fwrite
+.extern is_pointer
+.extern colored_diagnostics
+.extern read_stream
+.extern strspn
+.extern ispunct
+# ==== start of definition of function `reset_enum_val' ====
+.text
+reset_enum_val:
+.global reset_enum_val
+addsp 0;         
+ldidw 1;
+negdw;
+ldiqw en_val;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern strtoll
+.extern analyze_relational_equality_expression
+# ==== start of definition of function `get_sto_class_spec' ====
+.text
+get_sto_class_spec:
+.global get_sto_class_spec
+addsp 0;         
+# param:`d', offset:-24
+@L67:
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L68;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_sto_class_spec;
+call 4;
+pop;
+jmpf @L69;
+jmp @L68;
+@L69:
+ldbp -24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+jmp @L67;
+@L68:
+ldbp -24;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `install_ordinary_id' ====
+.text
+install_ordinary_id:
+addsp 44;        
+# param:`decl_specs', offset:-24
+# param:`declarator', offset:-32
+# param:`is_param', offset:-36
+# var: np, offset: 8
+# var: pp, offset: 16
+# var: scs, offset: 24
+# var: curr_scs, offset: 32
+# var: prev_scs, offset: 36
+ldidw 0;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_ordinary_id;
+call 12;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L70;
+ldiqw 40;
+pop;
+ldiqw oids_arena;
+ldiqw nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -36;
+lddw;
+dw2w;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stw;
+pop;
+ldiqw nesting_level;
+lddw;
+dw2w;
+ldbp 8;
+ldqw;
+ldiqw 18;
+addqw;
+stw;
+pop;
+ldiqw scope_id;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+ldiqw ordinary_identifiers;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw atom_hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L71:
+ldbp 16;
+ldqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L73;
+ldbp 16;
+ldqw;
+ldqw;
+ldiqw 18;
+addqw;
+ldw;
+ldiqw nesting_level;
+lddw;
+sgtdw;
+jmpf @L73;
+ldidw 1;
+jmp @L74;
+@L73:
+ldidw 0;
+@L74:
+jmpf @L72;
+ldbp 16;
+ldqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L71;
+@L72:
+ldbp 16;
+ldqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+stqw;
+pop;
+pop;
+ldiqw scope_oids;
+ldiqw nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw scope_oids;
+ldiqw nesting_level;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L70:
+ldbp -24;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 24;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L75;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+jmp @L76;
+@L75:
+ldidw 0;
+@L76:
+ldbp 32;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 24;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L77;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+jmp @L78;
+@L77:
+ldidw 0;
+@L78:
+ldbp 36;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 113;
+eqdw;
+jmpt @L79;
+ldbp 32;
+lddw;
+ldidw 70;
+eqdw;
+jmpt @L79;
+ldidw 0;
+jmp @L80;
+@L79:
+ldidw 1;
+@L80:
+jmpf @L81;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 113;
+eqdw;
+jmpf @L82;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 113;
+eqdw;
+jmpf @L82;
+ldidw 1;
+jmp @L83;
+@L82:
+ldidw 0;
+@L83:
+jmpf @L84;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S6;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+jmp @L85;
+@L84:
+ldbp 32;
+lddw;
+ldidw 70;
+eqdw;
+jmpf @L86;
+ldbp 36;
+lddw;
+ldidw 70;
+eqdw;
+jmpf @L86;
+ldidw 1;
+jmp @L87;
+@L86:
+ldidw 0;
+@L87:
+jmpf @L88;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S7;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+jmp @L89;
+@L88:
+jmp @@install_ordinary_id_redecl_as_diff_kind;
+@L89:
+@L85:
+jmp @L90;
+@L81:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 113;
+eqdw;
+jmpt @L91;
+ldbp 36;
+lddw;
+ldidw 70;
+eqdw;
+jmpt @L91;
+ldidw 0;
+jmp @L92;
+@L91:
+ldidw 1;
+@L92:
+jmpf @L93;
+jmp @@install_ordinary_id_redecl_as_diff_kind;
+jmp @L94;
+@L93:
+ldiqw nesting_level;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L95;
+# var: curr_is_func, offset: 40
+# var: prev_is_func, offset: 44
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L96;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L96;
+ldidw 1;
+jmp @L97;
+@L96:
+ldidw 0;
+@L97:
+ldbp 40;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L98;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L98;
+ldidw 1;
+jmp @L99;
+@L98:
+ldidw 0;
+@L99:
+ldbp 44;
+stdw;
+pop;
+ldbp 40;
+lddw;
+jmpt @L100;
+ldbp 44;
+lddw;
+jmpt @L100;
+ldidw 0;
+jmp @L101;
+@L100:
+ldidw 1;
+@L101:
+jmpf @L102;
+ldbp 40;
+lddw;
+ldbp 44;
+lddw;
+neqdw;
+jmpf @L103;
+jmp @@install_ordinary_id_redecl_as_diff_kind;
+jmp @L104;
+@L103:
+ldiqw 0;
+ret;
+@L104:
+@L102:
+ldbp 32;
+lddw;
+notdw;
+jmpt @L105;
+ldbp 32;
+lddw;
+ldidw 56;
+neqdw;
+jmpt @L105;
+ldidw 0;
+jmp @L106;
+@L105:
+ldidw 1;
+@L106:
+jmpf @L107;
+ldbp 36;
+lddw;
+notdw;
+jmpt @L108;
+ldbp 36;
+lddw;
+ldidw 56;
+neqdw;
+jmpt @L108;
+ldidw 0;
+jmp @L109;
+@L108:
+ldidw 1;
+@L109:
+jmpf @L110;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S8;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+jmp @L111;
+@L110:
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S9;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L111:
+jmp @L112;
+@L107:
+ldbp 36;
+lddw;
+notdw;
+jmpt @L113;
+ldbp 36;
+lddw;
+ldidw 56;
+neqdw;
+jmpt @L113;
+ldidw 0;
+jmp @L114;
+@L113:
+ldidw 1;
+@L114:
+jmpf @L115;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S10;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L115:
+@L112:
+@L95:
+@L94:
+@L90:
+ldiqw 0;
+ret;
+@@install_ordinary_id_redecl_as_diff_kind:
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S11;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern analyze_jump_statement
+.extern fclose
+.extern preprocess
+# ==== start of definition of function `analyze_decl_specs' ====
+.text
+analyze_decl_specs:
+.global analyze_decl_specs
+addsp 28;        
+# param:`d', offset:-24
+# var: p, offset: 8
+# var: tymsk, offset: 16
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+# var: tyspe_node, offset: 24
+@L116:
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+notdw;
+jmpf @L119;
+ldidw 523;
+ldiqw @S12;
+ldiqw @S13;
+ldiqw @S14;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L119:
+@L117:
+ldidw 0;
+jmpf @L118;
+jmp @L116;
+@L118:
+ldidw 0;
+dw2qw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L120:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L122;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T123;
+switch;
+@L125:
+@L126:
+ldbp 16;
+lddw;
+ldidw 2;
+ldidw 1;
+adddw;
+ldidw 4;
+ldidw 8;
+adddw;
+ldidw 16;
+adddw;
+ldidw 32;
+adddw;
+ldidw 64;
+adddw;
+adddw;
+anddw;
+ldidw 0;
+neqdw;
+jmpf @L127;
+jmp @@analyze_decl_specs_too_many_tyspe;
+@L127:
+ldbp 16;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 49;
+eqdw;
+jmpf @L128;
+ldidw 1;
+jmp @L129;
+@L128:
+ldidw 2;
+@L129:
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L124;
+@L130:
+@L131:
+@L132:
+@L133:
+@L134:
+ldbp 16;
+lddw;
+ldidw 4;
+ldidw 8;
+adddw;
+ldidw 16;
+adddw;
+ldidw 32;
+adddw;
+ldidw 64;
+adddw;
+ldidw 1024;
+ldidw 2048;
+adddw;
+adddw;
+ldidw 128;
+ldidw 256;
+adddw;
+ldidw 512;
+adddw;
+adddw;
+ldidw 2;
+adddw;
+ldidw 1;
+adddw;
+anddw;
+ldidw 0;
+neqdw;
+jmpf @L135;
+jmp @@analyze_decl_specs_too_many_tyspe;
+@L135:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T136;
+switch;
+@L138:
+ldbp 16;
+lddw;
+ldidw 4;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L137;
+@L139:
+ldbp 16;
+lddw;
+ldidw 8;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L137;
+@L140:
+ldbp 16;
+lddw;
+ldidw 16;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L137;
+@L141:
+ldbp 16;
+lddw;
+ldidw 32;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L137;
+@L142:
+ldbp 16;
+lddw;
+ldidw 64;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L137;
+@L137:
+.data
+.align 8
+@T136:
+.dword 6
+.dword 55
+.dword 68
+.dword 71
+.dword 73
+.dword 92
+.qword @L137
+.qword @L141
+.qword @L139
+.qword @L140
+.qword @L138
+.qword @L142
+.text
+ldbp 8;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L124;
+@L143:
+ldbp 16;
+lddw;
+ldidw 128;
+ldidw 256;
+adddw;
+ldidw 512;
+adddw;
+ldidw 4;
+ldidw 8;
+adddw;
+ldidw 16;
+adddw;
+ldidw 32;
+adddw;
+ldidw 64;
+adddw;
+adddw;
+ldidw 1;
+adddw;
+anddw;
+ldidw 0;
+neqdw;
+jmpf @L144;
+jmp @@analyze_decl_specs_too_many_tyspe;
+@L144:
+ldbp 16;
+lddw;
+ldidw 128;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L124;
+@L145:
+ldbp 16;
+lddw;
+ldidw 512;
+ldidw 4;
+ldidw 8;
+adddw;
+ldidw 16;
+adddw;
+ldidw 32;
+adddw;
+ldidw 64;
+adddw;
+adddw;
+ldidw 1;
+adddw;
+anddw;
+ldidw 0;
+neqdw;
+jmpf @L146;
+jmp @@analyze_decl_specs_too_many_tyspe;
+jmp @L147;
+@L146:
+ldbp 16;
+lddw;
+ldidw 256;
+anddw;
+ldidw 0;
+neqdw;
+jmpf @L148;
+ldbp 16;
+lddw;
+ldidw 256;
+cmpldw;
+anddw;
+ldbp 16;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldidw 512;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L149;
+@L148:
+ldbp 16;
+lddw;
+ldidw 256;
+ordw;
+ldbp 16;
+stdw;
+pop;
+@L149:
+@L147:
+jmp @L124;
+@L150:
+@L151:
+ldbp 16;
+lddw;
+ldidw 1024;
+ldidw 2048;
+adddw;
+ldidw 4;
+ldidw 8;
+adddw;
+ldidw 16;
+adddw;
+ldidw 32;
+adddw;
+ldidw 64;
+adddw;
+adddw;
+anddw;
+ldidw 0;
+neqdw;
+jmpf @L152;
+jmp @@analyze_decl_specs_too_many_tyspe;
+@L152:
+ldbp 16;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 72;
+eqdw;
+jmpf @L153;
+ldidw 1024;
+jmp @L154;
+@L153:
+ldidw 2048;
+@L154:
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L124;
+@L155:
+ldbp 16;
+lddw;
+ldidw 4096;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L124;
+@L156:
+ldbp 16;
+lddw;
+ldidw 8192;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L124;
+@L157:
+@L158:
+@L159:
+@L160:
+@L161:
+ldbp 16;
+lddw;
+ldidw 16384;
+ldidw 32768;
+adddw;
+ldidw 65536;
+adddw;
+ldidw 131072;
+adddw;
+ldidw 262144;
+adddw;
+anddw;
+ldidw 0;
+neqdw;
+jmpf @L162;
+ldiqw @S15;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L162:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T163;
+switch;
+@L165:
+ldbp 16;
+lddw;
+ldidw 16384;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L164;
+@L166:
+ldbp 16;
+lddw;
+ldidw 32768;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L164;
+@L167:
+ldbp 16;
+lddw;
+ldidw 65536;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L164;
+@L168:
+ldbp 16;
+lddw;
+ldidw 131072;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L164;
+@L169:
+ldbp 16;
+lddw;
+ldidw 262144;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L164;
+@L164:
+.data
+.align 8
+@T163:
+.dword 6
+.dword 46
+.dword 56
+.dword 62
+.dword 67
+.dword 70
+.qword @L164
+.qword @L168
+.qword @L166
+.qword @L169
+.qword @L167
+.qword @L165
+.text
+jmp @L124;
+@L124:
+.data
+.align 8
+@T123:
+.dword 19
+.dword 46
+.dword 49
+.dword 50
+.dword 55
+.dword 56
+.dword 60
+.dword 61
+.dword 62
+.dword 64
+.dword 65
+.dword 67
+.dword 68
+.dword 70
+.dword 71
+.dword 72
+.dword 73
+.dword 74
+.dword 92
+.qword @L124
+.qword @L160
+.qword @L125
+.qword @L156
+.qword @L133
+.qword @L158
+.qword @L126
+.qword @L145
+.qword @L161
+.qword @L143
+.qword @L151
+.qword @L159
+.qword @L131
+.qword @L157
+.qword @L132
+.qword @L150
+.qword @L130
+.qword @L155
+.qword @L134
+.text
+@L121:
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L120;
+@L122:
+ldbp -24;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 16384;
+ldidw 32768;
+adddw;
+ldidw 65536;
+adddw;
+ldidw 131072;
+adddw;
+ldidw 262144;
+adddw;
+anddw;
+ldidw 0;
+neqdw;
+jmpf @L170;
+ldbp 8;
+ldqw;
+ldbp 24;
+ldqw;
+eqqw;
+jmpf @L171;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L171:
+ldbp -24;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L172;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L172:
+@L170:
+ldbp 16;
+lddw;
+ldidw 4096;
+ldidw 8192;
+adddw;
+anddw;
+ldiqw @T173;
+switch;
+@L175:
+ldbp 8;
+ldqw;
+ldbp 24;
+ldqw;
+eqqw;
+jmpf @L176;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 74;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L177;
+@L176:
+ldidw 74;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L178;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L178:
+@L177:
+jmp @L174;
+@L179:
+ldbp 8;
+ldqw;
+ldbp 24;
+ldqw;
+eqqw;
+jmpf @L180;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 50;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L181;
+@L180:
+ldidw 50;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L182;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L182:
+@L181:
+jmp @L174;
+@L183:
+ldbp 8;
+ldqw;
+ldbp 24;
+ldqw;
+eqqw;
+jmpf @L184;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 112;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L185;
+@L184:
+ldidw 112;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L186;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L186:
+@L185:
+jmp @L174;
+@L187:
+jmp @L174;
+@L174:
+.data
+.align 8
+@T173:
+.dword 4
+.dword 4096
+.dword 8192
+.dword 12288
+.qword @L187
+.qword @L175
+.qword @L179
+.qword @L183
+.text
+@L188:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+notdw;
+jmpf @L191;
+ldidw 641;
+ldiqw @S16;
+ldiqw @S17;
+ldiqw @S18;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L191:
+@L189:
+ldidw 0;
+jmpf @L190;
+jmp @L188;
+@L190:
+ldbp 16;
+lddw;
+ldidw 4;
+ldidw 8;
+adddw;
+ldidw 16;
+adddw;
+ldidw 32;
+adddw;
+ldidw 64;
+adddw;
+ldidw 1024;
+ldidw 2048;
+adddw;
+adddw;
+ldidw 128;
+ldidw 256;
+adddw;
+ldidw 512;
+adddw;
+adddw;
+ldidw 2;
+adddw;
+ldidw 1;
+adddw;
+anddw;
+ldiqw @T192;
+switch;
+@L194:
+@L195:
+ldidw 49;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L193;
+@L196:
+ldidw 107;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L193;
+@L197:
+@L198:
+@L199:
+@L200:
+ldidw 64;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L193;
+@L201:
+@L202:
+ldidw 108;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L193;
+@L203:
+@L204:
+ldidw 60;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L193;
+@L205:
+@L206:
+ldidw 72;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L193;
+@L207:
+@L208:
+@L209:
+@L210:
+ldidw 61;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L193;
+@L211:
+@L212:
+ldidw 109;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L193;
+@L213:
+@L214:
+@L215:
+@L216:
+ldidw 110;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L193;
+@L217:
+@L218:
+ldidw 111;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L193;
+@L219:
+ldidw 73;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L193;
+@L220:
+@L221:
+@L222:
+@L223:
+jmp @L193;
+@L224:
+ldiqw @S19;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L225:
+@L226:
+ldidw 0;
+notdw;
+jmpf @L229;
+ldidw 699;
+ldiqw @S20;
+ldiqw @S21;
+ldiqw @S22;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L229:
+@L227:
+ldidw 0;
+jmpf @L228;
+jmp @L226;
+@L228:
+@L193:
+.data
+.align 8
+@T192:
+.dword 32
+.dword 0
+.dword 1
+.dword 2
+.dword 4
+.dword 8
+.dword 16
+.dword 32
+.dword 64
+.dword 128
+.dword 130
+.dword 256
+.dword 258
+.dword 512
+.dword 514
+.dword 1024
+.dword 1025
+.dword 1026
+.dword 1152
+.dword 1154
+.dword 1280
+.dword 1282
+.dword 1536
+.dword 1538
+.dword 2049
+.dword 2050
+.dword 2176
+.dword 2178
+.dword 2304
+.dword 2306
+.dword 2560
+.dword 2562
+.qword @L225
+.qword @L224
+.qword @L194
+.qword @L203
+.qword @L219
+.qword @L220
+.qword @L221
+.qword @L222
+.qword @L223
+.qword @L197
+.qword @L198
+.qword @L207
+.qword @L208
+.qword @L213
+.qword @L214
+.qword @L205
+.qword @L196
+.qword @L206
+.qword @L201
+.qword @L202
+.qword @L211
+.qword @L212
+.qword @L217
+.qword @L218
+.qword @L195
+.qword @L204
+.qword @L199
+.qword @L200
+.qword @L209
+.qword @L210
+.qword @L215
+.qword @L216
+.text
+ldidw 0;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@@analyze_decl_specs_too_many_tyspe:
+ldiqw @S23;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern strstr
+.extern calloc
+# ==== start of definition of function `pop_scope' ====
+.text
+pop_scope:
+.global pop_scope
+addsp 0;         
+ldiqw delayed_delete;
+lddw;
+jmpf @L230;
+ldiqw delete_scope;
+call 0;
+pop;
+pop;
+@L230:
+ldidw 1;
+ldiqw delayed_delete;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern memset
+.extern file_exists
+.extern pch_declaration
+.extern include_libc
+.extern increase_switch_nesting_level
+.extern analyze_cast_expression
+# ==== start of definition of function `stringify_type_exp' ====
+.text
+stringify_type_exp:
+.global stringify_type_exp
+addsp 676;       
+# param:`d', offset:-24
+# param:`show_decayed', offset:-28
+# var: e, offset: 8
+# var: out, offset: 16
+# var: temp, offset: 272
+# var: ds, offset: 528
+# var: s, offset: 656
+ldidw 0;
+dw2b;
+ldbp 16;
+ldidw 0;
+dw2qw;
+addqw;
+stb;
+pop;
+ldidw 0;
+dw2b;
+ldbp 272;
+ldidw 0;
+dw2qw;
+addqw;
+stb;
+pop;
+ldidw 0;
+dw2b;
+ldbp 528;
+ldidw 0;
+dw2qw;
+addqw;
+stb;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L231:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L232;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+jmpf @L233;
+ldiqw token_table;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldbp 528;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_struct_union_enum;
+call 4;
+pop;
+jmpf @L234;
+ldiqw @S24;
+ldbp 528;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 528;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+@L234:
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L235;
+ldiqw @S25;
+ldbp 528;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+jmp @L236;
+@L235:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L237;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+eqdw;
+jmpf @L238;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L239;
+ldiqw @S26;
+ldbp 528;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+@L239:
+jmp @L240;
+@L238:
+ldiqw @S27;
+ldbp 528;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+@L240:
+@L237:
+@L236:
+@L233:
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L231;
+@L232:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L241:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L242;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L243;
+# var: p, offset: 664
+ldbp -28;
+lddw;
+jmpf @L244;
+ldiqw @S28;
+ldbp 16;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+jmp @L245;
+@L244:
+ldiqw @S29;
+ldbp 16;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+@L245:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 664;
+stqw;
+pop;
+pop;
+@L246:
+ldbp 664;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L247;
+# var: param, offset: 672
+ldidw 0;
+ldbp 664;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw stringify_type_exp;
+call 12;
+ldbp 672;
+stqw;
+pop;
+pop;
+ldbp 672;
+ldqw;
+ldbp 16;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+ldbp 672;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 664;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 664;
+stqw;
+pop;
+pop;
+ldbp 664;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L248;
+ldiqw @S30;
+ldbp 16;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+@L248:
+jmp @L246;
+@L247:
+ldiqw @S31;
+ldbp 16;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+jmp @L249;
+@L243:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L250;
+ldbp -28;
+lddw;
+jmpf @L251;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L252;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpt @L254;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L254;
+ldidw 0;
+jmp @L255;
+@L254:
+ldidw 1;
+@L255:
+jmpf @L252;
+ldidw 1;
+jmp @L253;
+@L252:
+ldidw 0;
+@L253:
+jmpf @L256;
+ldiqw @S32;
+ldbp 272;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+jmp @L257;
+@L256:
+ldiqw @S33;
+ldbp 272;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+@L257:
+jmp @L258;
+@L251:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L259;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S34;
+ldbp 272;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+jmp @L260;
+@L259:
+ldiqw @S35;
+ldbp 272;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+@L260:
+@L258:
+ldbp 272;
+ldbp 16;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+jmp @L261;
+@L250:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 11;
+eqdw;
+jmpf @L262;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L263;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpt @L265;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L265;
+ldidw 0;
+jmp @L266;
+@L265:
+ldidw 1;
+@L266:
+jmpf @L263;
+ldidw 1;
+jmp @L264;
+@L263:
+ldidw 0;
+@L264:
+jmpf @L267;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L268;
+ldbp 16;
+ldiqw token_table;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S36;
+ldbp 272;
+ldiqw sprintf;
+call 28;
+pop;
+pop;
+jmp @L269;
+@L268:
+ldbp 16;
+ldiqw @S37;
+ldbp 272;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+@L269:
+jmp @L270;
+@L267:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L271;
+ldbp 16;
+ldiqw token_table;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S38;
+ldbp 272;
+ldiqw sprintf;
+call 28;
+pop;
+pop;
+jmp @L272;
+@L271:
+ldbp 16;
+ldiqw @S39;
+ldbp 272;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+@L272:
+@L270:
+ldbp 272;
+ldbp 16;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+jmp @L273;
+@L262:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+eqdw;
+jmpf @L274;
+jmp @L275;
+@L274:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpf @L276;
+ldiqw @S40;
+ldbp 16;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+@L276:
+@L275:
+@L273:
+@L261:
+@L249:
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp -28;
+stdw;
+pop;
+jmp @L241;
+@L242:
+ldbp 528;
+ldiqw strlen;
+call 8;
+ldbp 16;
+ldiqw strlen;
+call 8;
+addqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldiqw malloc;
+call 8;
+ldbp 656;
+stqw;
+pop;
+pop;
+ldbp 528;
+ldbp 656;
+ldqw;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldbp 656;
+ldqw;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+ldbp 656;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern add_quote_dir
+.extern stat_number_of_ast_nodes
+.extern strtoul
+.extern isprint
+.extern set_return_type
+.extern fprintf
+# ==== start of definition of function `get_type_qual' ====
+.text
+get_type_qual:
+.global get_type_qual
+addsp 0;         
+# param:`d', offset:-24
+@L277:
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L278;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_type_qualifier;
+call 4;
+pop;
+jmpt @L279;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+eqdw;
+jmpt @L279;
+ldidw 0;
+jmp @L280;
+@L279:
+ldidw 1;
+@L280:
+jmpf @L281;
+jmp @L278;
+@L281:
+ldbp -24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+jmp @L277;
+@L278:
+ldbp -24;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern read_file
+.extern is_signed_int
+.extern printf
+.extern get_c_token
+# ==== start of definition of function `lookup_tag' ====
+.text
+lookup_tag:
+.global lookup_tag
+addsp 12;        
+# param:`id', offset:-24
+# param:`all', offset:-28
+# var: np, offset: 8
+ldiqw delayed_delete;
+lddw;
+jmpf @L282;
+ldiqw delete_scope;
+call 0;
+pop;
+pop;
+@L282:
+ldiqw tags;
+ldbp -24;
+ldqw;
+ldiqw hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L283:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L285;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw nesting_level;
+lddw;
+sgtdw;
+jmpf @L286;
+jmp @L284;
+@L286:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw nesting_level;
+lddw;
+sltdw;
+jmpf @L287;
+ldbp -28;
+lddw;
+notdw;
+jmpf @L287;
+ldidw 1;
+jmp @L288;
+@L287:
+ldidw 0;
+@L288:
+jmpf @L289;
+jmp @L285;
+@L289:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L290;
+ldbp 8;
+ldqw;
+ret;
+@L290:
+@L284:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L283;
+@L285:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.data
+.align 4
+nesting_level:
+.align 4
+.dword 0
+.extern get_rank
+# ==== start of definition of function `is_external_id' ====
+.text
+is_external_id:
+.global is_external_id
+addsp 0;         
+# param:`id', offset:-24
+ldbp -24;
+ldqw;
+ldiqw lookup_external_id;
+call 8;
+ldidw 0;
+dw2qw;
+neqqw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `compare_decl_specs' ====
+.text
+compare_decl_specs:
+.global compare_decl_specs
+addsp 20;        
+# param:`ds1', offset:-24
+# param:`ds2', offset:-32
+# param:`qualified', offset:-36
+# var: temp1, offset: 8
+# var: temp2, offset: 16
+ldbp -24;
+ldqw;
+ldbp -32;
+ldqw;
+eqqw;
+jmpf @L291;
+ldidw 1;
+dw2qw;
+ret;
+@L291:
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+neqdw;
+jmpt @L292;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_struct_union_enum;
+call 4;
+pop;
+jmpf @L294;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+neqqw;
+jmpf @L294;
+ldidw 1;
+jmp @L295;
+@L294:
+ldidw 0;
+@L295:
+jmpt @L292;
+ldidw 0;
+jmp @L293;
+@L292:
+ldidw 1;
+@L293:
+jmpf @L296;
+ldidw 0;
+dw2qw;
+ret;
+@L296:
+ldbp -36;
+lddw;
+jmpf @L297;
+ldbp -24;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L302;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L302;
+ldidw 1;
+jmp @L303;
+@L302:
+ldidw 0;
+@L303:
+jmpt @L300;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L304;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L304;
+ldidw 1;
+jmp @L305;
+@L304:
+ldidw 0;
+@L305:
+jmpt @L300;
+ldidw 0;
+jmp @L301;
+@L300:
+ldidw 1;
+@L301:
+jmpt @L298;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L306;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+neqdw;
+jmpf @L306;
+ldidw 1;
+jmp @L307;
+@L306:
+ldidw 0;
+@L307:
+jmpt @L298;
+ldidw 0;
+jmp @L299;
+@L298:
+ldidw 1;
+@L299:
+jmpf @L308;
+ldidw 0;
+dw2qw;
+ret;
+@L308:
+@L297:
+ldidw 1;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern isalnum
+.extern sprintf
+.extern isxdigit
+# ==== start of definition of function `analyze_initializer' ====
+.text
+analyze_initializer:
+addsp 32;        
+# param:`ds', offset:-24
+# param:`dct', offset:-32
+# param:`e', offset:-40
+# param:`is_const_expr', offset:-44
+# var: ts, offset: 8
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L309;
+# var: ty_spec, offset: 16
+# var: i, offset: 20
+# var: is_init_list, offset: 24
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L310;
+jmp @@analyze_initializer_scalar;
+@L310:
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L311;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+eqdw;
+jmpf @L311;
+ldidw 1;
+jmp @L312;
+@L311:
+ldidw 0;
+@L312:
+ldbp 24;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L319;
+ldbp 24;
+lddw;
+jmpf @L321;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L321;
+ldidw 1;
+jmp @L322;
+@L321:
+ldidw 0;
+@L322:
+jmpt @L319;
+ldidw 0;
+jmp @L320;
+@L319:
+ldidw 1;
+@L320:
+jmpf @L317;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L317;
+ldidw 1;
+jmp @L318;
+@L317:
+ldidw 0;
+@L318:
+jmpf @L315;
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L315;
+ldidw 1;
+jmp @L316;
+@L315:
+ldidw 0;
+@L316:
+jmpf @L313;
+ldbp 16;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 1;
+eqdw;
+jmpf @L313;
+ldidw 1;
+jmp @L314;
+@L313:
+ldidw 0;
+@L314:
+jmpf @L323;
+# var: size, offset: 28
+ldbp 24;
+lddw;
+jmpf @L324;
+ldidw 2;
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L324:
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw strlen;
+call 8;
+pop;
+ldbp 28;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L325;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 28;
+lddw;
+dw2qw;
+sltqw;
+jmpf @L326;
+ldiqw @S41;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+@L326:
+jmp @L327;
+@L325:
+ldiqw new_exec_node;
+call 0;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 28;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+@L327:
+jmp @L328;
+@L323:
+ldbp 24;
+lddw;
+notdw;
+jmpf @L329;
+ldiqw @S42;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L329:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L330;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+ldbp 20;
+stdw;
+pop;
+@L331:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L334;
+ldbp 20;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L334;
+ldidw 1;
+jmp @L335;
+@L334:
+ldidw 0;
+@L335:
+jmpf @L333;
+ldbp -44;
+lddw;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw analyze_initializer;
+call 28;
+pop;
+pop;
+@L332:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 20;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+jmp @L331;
+@L333:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L336;
+ldiqw @S43;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L336:
+jmp @L337;
+@L330:
+ldidw 0;
+ldbp 20;
+stdw;
+pop;
+@L338:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L340;
+ldbp -44;
+lddw;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw analyze_initializer;
+call 28;
+pop;
+pop;
+@L339:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 20;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+jmp @L338;
+@L340:
+ldiqw new_exec_node;
+call 0;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 20;
+lddw;
+dw2qw;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+@L337:
+@L328:
+jmp @L341;
+@L309:
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 68;
+eqdw;
+jmpf @L342;
+# var: d, offset: 16
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+neqdw;
+jmpt @L343;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+neqdw;
+jmpt @L343;
+ldidw 0;
+jmp @L344;
+@L343:
+ldidw 1;
+@L344:
+jmpf @L345;
+jmp @@analyze_initializer_scalar;
+@L345:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L346;
+# var: p, offset: 24
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_tag;
+call 12;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L347:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+notdw;
+jmpf @L350;
+ldidw 1347;
+ldiqw @S44;
+ldiqw @S45;
+ldiqw @S46;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L350:
+@L348:
+ldidw 0;
+jmpf @L349;
+jmp @L347;
+@L349:
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+@L346:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L351:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L353;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L354:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L357;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L357;
+ldidw 1;
+jmp @L358;
+@L357:
+ldidw 0;
+@L358:
+jmpf @L356;
+ldbp -44;
+lddw;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw analyze_initializer;
+call 28;
+pop;
+pop;
+@L355:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L354;
+@L356:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L359;
+jmp @L353;
+@L359:
+@L352:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L351;
+@L353:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L360;
+ldiqw @S47;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L360:
+jmp @L361;
+@L342:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+jmpf @L362;
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+neqdw;
+jmpt @L363;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+neqdw;
+jmpt @L363;
+ldidw 0;
+jmp @L364;
+@L363:
+ldidw 1;
+@L364:
+jmpf @L365;
+jmp @@analyze_initializer_scalar;
+@L365:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L366;
+# var: p, offset: 16
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_tag;
+call 12;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L367:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+notdw;
+jmpf @L370;
+ldidw 1377;
+ldiqw @S48;
+ldiqw @S49;
+ldiqw @S50;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L370:
+@L368:
+ldidw 0;
+jmpf @L369;
+jmp @L367;
+@L369:
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+@L366:
+ldbp -44;
+lddw;
+ldbp -40;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw analyze_initializer;
+call 28;
+pop;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L371;
+ldiqw @S51;
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L371:
+jmp @L372;
+@L362:
+# var: dest_ty, offset: 16
+@@analyze_initializer_scalar:
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L373;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+eqdw;
+jmpf @L373;
+ldidw 1;
+jmp @L374;
+@L373:
+ldidw 0;
+@L374:
+jmpf @L375;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 32;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L376;
+ldiqw @S52;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L376:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L375:
+ldbp -40;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 90;
+eqdw;
+jmpf @L377;
+ldiqw 0;
+ret;
+@L377:
+ldbp -24;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -44;
+lddw;
+jmpf @L378;
+# var: cat, offset: 32
+ldiqw targeting_arch64;
+lddw;
+notdw;
+jmpf @L379;
+ldbp 16;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 32;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L381;
+ldbp 32;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L381;
+ldidw 0;
+jmp @L382;
+@L381:
+ldidw 1;
+@L382:
+jmpf @L379;
+ldidw 1;
+jmp @L380;
+@L379:
+ldidw 0;
+@L380:
+jmpf @L383;
+ldidw 1;
+ldidw 0;
+ldbp -40;
+ldqw;
+ldiqw eval_const_expr;
+call 16;
+pop;
+jmp @L384;
+@L383:
+ldidw 0;
+ldidw 0;
+ldbp -40;
+ldqw;
+ldiqw eval_const_expr;
+call 16;
+pop;
+@L384:
+@L378:
+ldbp -40;
+ldqw;
+ldbp 16;
+ldiqw can_assign_to;
+call 16;
+pop;
+notdw;
+jmpf @L385;
+ldidw 0;
+ldbp -40;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw stringify_type_exp;
+call 12;
+ldidw 0;
+ldbp 16;
+ldiqw stringify_type_exp;
+call 12;
+ldiqw @S53;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -40;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 44;
+pop;
+pop;
+@L385:
+@L372:
+@L361:
+@L341:
+ldidw 0;
+ret;
+.extern strcat
+# ==== start of definition of function `are_compatible' ====
+.text
+are_compatible:
+.global are_compatible
+addsp 20;        
+# param:`ds1', offset:-24
+# param:`dct1', offset:-32
+# param:`ds2', offset:-40
+# param:`dct2', offset:-48
+# param:`qualified', offset:-52
+# param:`compose', offset:-56
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L386;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+eqdw;
+jmpf @L386;
+ldidw 1;
+jmp @L387;
+@L386:
+ldidw 0;
+@L387:
+jmpf @L388;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L388:
+ldbp -48;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L389;
+ldbp -48;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+eqdw;
+jmpf @L389;
+ldidw 1;
+jmp @L390;
+@L389:
+ldidw 0;
+@L390:
+jmpf @L391;
+ldbp -48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -48;
+stqw;
+pop;
+pop;
+@L391:
+ldbp -24;
+ldqw;
+ldbp -40;
+ldqw;
+eqqw;
+jmpf @L392;
+ldbp -32;
+ldqw;
+ldbp -48;
+ldqw;
+eqqw;
+jmpf @L392;
+ldidw 1;
+jmp @L393;
+@L392:
+ldidw 0;
+@L393:
+jmpf @L394;
+ldidw 1;
+dw2qw;
+ret;
+@L394:
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L395;
+ldbp -48;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L395;
+ldidw 0;
+jmp @L396;
+@L395:
+ldidw 1;
+@L396:
+jmpf @L397;
+ldbp -32;
+ldqw;
+ldbp -48;
+ldqw;
+neqqw;
+jmpf @L398;
+ldidw 0;
+dw2qw;
+ret;
+@L398:
+ldbp -52;
+lddw;
+ldbp -40;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw compare_decl_specs;
+call 20;
+pop;
+dw2qw;
+ret;
+@L397:
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -48;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+neqdw;
+jmpf @L399;
+ldidw 0;
+dw2qw;
+ret;
+@L399:
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T400;
+switch;
+@L402:
+ldidw 1;
+dw2qw;
+ret;
+@L403:
+ldbp -52;
+lddw;
+jmpf @L404;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L410;
+ldbp -48;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L410;
+ldidw 1;
+jmp @L411;
+@L410:
+ldidw 0;
+@L411:
+jmpt @L408;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L412;
+ldbp -48;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L412;
+ldidw 1;
+jmp @L413;
+@L412:
+ldidw 0;
+@L413:
+jmpt @L408;
+ldidw 0;
+jmp @L409;
+@L408:
+ldidw 1;
+@L409:
+jmpt @L406;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L414;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -48;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+neqdw;
+jmpf @L414;
+ldidw 1;
+jmp @L415;
+@L414:
+ldidw 0;
+@L415:
+jmpt @L406;
+ldidw 0;
+jmp @L407;
+@L406:
+ldidw 1;
+@L407:
+jmpf @L404;
+ldidw 1;
+jmp @L405;
+@L404:
+ldidw 0;
+@L405:
+jmpf @L416;
+ldidw 0;
+dw2qw;
+ret;
+@L416:
+jmp @L401;
+@L417:
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L418;
+ldbp -48;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L418;
+ldidw 1;
+jmp @L419;
+@L418:
+ldidw 0;
+@L419:
+jmpf @L420;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -48;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+neqqw;
+jmpf @L421;
+ldidw 0;
+dw2qw;
+ret;
+@L421:
+jmp @L422;
+@L420:
+ldbp -56;
+lddw;
+jmpf @L423;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L424;
+ldbp -48;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L424;
+ldidw 1;
+jmp @L425;
+@L424:
+ldidw 0;
+@L425:
+jmpf @L426;
+ldbp -48;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L427;
+@L426:
+ldbp -48;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L428;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L428;
+ldidw 1;
+jmp @L429;
+@L428:
+ldidw 0;
+@L429:
+jmpf @L430;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp -48;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+@L430:
+@L427:
+@L423:
+@L422:
+jmp @L401;
+@L431:
+# var: p1, offset: 8
+# var: p2, offset: 16
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -48;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L432:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L434;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L434;
+ldidw 1;
+jmp @L435;
+@L434:
+ldidw 0;
+@L435:
+jmpf @L433;
+ldbp -56;
+lddw;
+ldidw 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw are_compatible;
+call 40;
+pop;
+notdw;
+jmpf @L436;
+ldidw 0;
+dw2qw;
+ret;
+@L436:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L432;
+@L433:
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+neqqw;
+jmpf @L437;
+ldidw 0;
+dw2qw;
+ret;
+@L437:
+jmp @L401;
+@L401:
+.data
+.align 8
+@T400:
+.dword 5
+.dword 11
+.dword 33
+.dword 97
+.dword 98
+.qword @L401
+.qword @L403
+.qword @L402
+.qword @L417
+.qword @L431
+.text
+ldbp -56;
+lddw;
+ldidw 1;
+ldbp -48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw are_compatible;
+call 40;
+pop;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern resolve_gotos
+.extern error_count
+# ==== start of definition of function `delete_scope' ====
+.text
+delete_scope:
+addsp 20;        
+# var: h, offset: 4
+# var: sp, offset: 8
+# var: tp, offset: 16
+@L438:
+ldiqw nesting_level;
+lddw;
+ldidw 0;
+sgetdw;
+notdw;
+jmpf @L441;
+ldidw 210;
+ldiqw @S54;
+ldiqw @S55;
+ldiqw @S56;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L441:
+@L439:
+ldidw 0;
+jmpf @L440;
+jmp @L438;
+@L440:
+ldiqw scope_oids;
+ldiqw nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L442:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L444;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw atom_hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+ldbp 4;
+stdw;
+pop;
+@L445:
+ldiqw ordinary_identifiers;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L447;
+ldiqw ordinary_identifiers;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw 18;
+addqw;
+ldw;
+ldiqw nesting_level;
+lddw;
+eqdw;
+jmpf @L447;
+ldidw 1;
+jmp @L448;
+@L447:
+ldidw 0;
+@L448:
+jmpf @L446;
+ldiqw ordinary_identifiers;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw ordinary_identifiers;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L445;
+@L446:
+@L443:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L442;
+@L444:
+ldidw 0;
+dw2qw;
+ldiqw scope_oids;
+ldiqw nesting_level;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw oids_arena;
+ldiqw nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw arena_reset;
+call 8;
+pop;
+pop;
+ldiqw scope_tags;
+ldiqw nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L449:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L451;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+ldbp 4;
+stdw;
+pop;
+@L452:
+ldiqw tags;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L454;
+ldiqw tags;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw nesting_level;
+lddw;
+eqdw;
+jmpf @L454;
+ldidw 1;
+jmp @L455;
+@L454:
+ldidw 0;
+@L455:
+jmpf @L453;
+ldiqw tags;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw tags;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L452;
+@L453:
+@L450:
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L449;
+@L451:
+ldidw 0;
+dw2qw;
+ldiqw scope_tags;
+ldiqw nesting_level;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw tags_arena;
+ldiqw nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw arena_reset;
+call 8;
+pop;
+pop;
+ldiqw nesting_level;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ldiqw delayed_delete;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern free_pre_token
+.extern round_up
+# ==== start of definition of function `analyze_declarator' ====
+.text
+analyze_declarator:
+.global analyze_declarator
+addsp 20;        
+# param:`decl_specs', offset:-24
+# param:`declarator', offset:-32
+# param:`inst_sym', offset:-36
+# var: d, offset: 8
+ldbp -24;
+ldqw;
+ldbp 8;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 8;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldiqw replace_typedef_name;
+call 8;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw analyze_declarator2;
+call 16;
+pop;
+pop;
+ldbp -36;
+lddw;
+jmpf @L456;
+ldidw 0;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw install_ordinary_id;
+call 20;
+pop;
+pop;
+@L456:
+ldidw 0;
+ret;
+.extern include_liblux
+# ==== start of definition of function `install_external_id' ====
+.text
+install_external_id:
+addsp 16;        
+# param:`decl_specs', offset:-24
+# param:`declarator', offset:-32
+# param:`status', offset:-36
+# var: np, offset: 8
+# var: h, offset: 16
+ldiqw new_extern_id_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -36;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw atom_hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+ldbp 16;
+stdw;
+pop;
+ldiqw external_declarations;
+ldbp 16;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw external_declarations;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern stat_number_of_pre_tokens
+.extern strchr
+.extern toupper
+.extern add_angle_dir
+.extern analyze_conditional_expression
+.extern ic_outpath
+.extern arena_alloc
+.extern stdout
+.extern get_type_category
+# ==== start of definition of function `analyze_declarator2' ====
+.text
+analyze_declarator2:
+addsp 20;        
+# param:`decl_specs', offset:-24
+# param:`declarator', offset:-32
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L457;
+ldiqw 0;
+ret;
+@L457:
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T458;
+switch;
+@L460:
+@L461:
+jmp @L459;
+@L462:
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L463;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L464;
+ldiqw @S57;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+jmp @L465;
+@L464:
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L466;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L466;
+ldidw 1;
+jmp @L467;
+@L466:
+ldidw 0;
+@L467:
+jmpf @L468;
+ldiqw @S58;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L468:
+@L465:
+jmp @L469;
+@L463:
+# var: ts, offset: 8
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpt @L470;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_struct_union_enum;
+call 4;
+pop;
+jmpf @L472;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw is_complete;
+call 8;
+pop;
+notdw;
+jmpf @L472;
+ldidw 1;
+jmp @L473;
+@L472:
+ldidw 0;
+@L473:
+jmpt @L470;
+ldidw 0;
+jmp @L471;
+@L470:
+ldidw 1;
+@L471:
+jmpf @L474;
+ldiqw @S59;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L474:
+@L469:
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L475;
+# var: size, offset: 8
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpf @L476;
+ldiqw @S60;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L476:
+ldidw 1;
+ldidw 0;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+sletqw;
+jmpf @L477;
+ldiqw @S61;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L477:
+ldbp 8;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+@L475:
+jmp @L459;
+@L478:
+# var: p, offset: 8
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L479;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L480;
+ldiqw @S62;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+jmp @L481;
+@L480:
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L482;
+ldiqw @S63;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L482:
+@L481:
+@L479:
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L483:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L484;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L485;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpf @L485;
+ldidw 1;
+jmp @L486;
+@L485:
+ldidw 0;
+@L486:
+jmpf @L487;
+jmp @L484;
+@L487:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L488;
+# var: temp, offset: 16
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L489;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+eqdw;
+jmpf @L489;
+ldidw 1;
+jmp @L490;
+@L489:
+ldidw 0;
+@L490:
+jmpf @L491;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L492;
+@L491:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L492:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L493;
+ldbp 8;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+neqqw;
+jmpt @L495;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpt @L495;
+ldidw 0;
+jmp @L496;
+@L495:
+ldidw 1;
+@L496:
+jmpf @L493;
+ldidw 1;
+jmp @L494;
+@L493:
+ldidw 0;
+@L494:
+jmpf @L497;
+ldiqw @S64;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L497:
+@L488:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L483;
+@L484:
+jmp @L459;
+@L459:
+.data
+.align 8
+@T458:
+.dword 5
+.dword 11
+.dword 76
+.dword 97
+.dword 98
+.qword @L459
+.qword @L461
+.qword @L460
+.qword @L462
+.qword @L478
+.text
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw analyze_declarator2;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern ilog2
+.bss
+.align 4
+scope_id:
+.res 4
+.extern strcmp
+.extern strtok
+.data
+.align 4
+en_val:
+.align 4
+.dword -1
+.extern strtol
+.extern parse_header
+.extern stdin
+.bss
+.align 8
+current_function_name:
+.res 8
+.global current_function_name
+.extern is_integer
+.bss
+.align 8
+scope_tags:
+.res 128
+.extern pch_lookup
+.extern analyze_postfix_expression
+.extern ftell
+.extern strcpy
+.bss
+.align 8
+last_descriptor:
+.res 8
+# ==== start of definition of function `install_tag' ====
+.text
+install_tag:
+.global install_tag
+addsp 20;        
+# param:`ty', offset:-24
+# var: np, offset: 8
+# var: pp, offset: 16
+ldiqw delayed_delete;
+lddw;
+jmpf @L498;
+ldiqw delete_scope;
+call 0;
+pop;
+pop;
+@L498:
+ldiqw 32;
+pop;
+ldiqw tags_arena;
+ldiqw nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw nesting_level;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldiqw tags;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L499:
+ldbp 16;
+ldqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L502;
+ldbp 16;
+ldqw;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw nesting_level;
+lddw;
+sgtdw;
+jmpf @L502;
+ldidw 1;
+jmp @L503;
+@L502:
+ldidw 0;
+@L503:
+jmpf @L501;
+@L500:
+ldbp 16;
+ldqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L499;
+@L501:
+ldbp 16;
+ldqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+stqw;
+pop;
+pop;
+ldiqw scope_tags;
+ldiqw nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw scope_tags;
+ldiqw nesting_level;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern ic_function_to_print
+.extern isupper
+.extern strtoull
+.extern strlen
+.extern token_table
+# ==== start of definition of function `new_struct_member' ====
+.text
+new_struct_member:
+.global new_struct_member
+addsp 20;        
+# param:`decl_specs', offset:-24
+# param:`declarator', offset:-32
+# var: alignment, offset: 4
+# var: n, offset: 8
+# var: p, offset: 16
+ldiqw descriptor_stack;
+ldiqw descr_stack_top;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L504:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L506;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+eqqw;
+jmpf @L507;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S65;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L507:
+@L505:
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L504;
+@L506:
+ldiqw 40;
+pop;
+ldiqw decl_node_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw descriptor_stack;
+ldiqw descr_stack_top;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+adddw;
+ldiqw descriptor_stack;
+ldiqw descr_stack_top;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw descriptor_stack;
+ldiqw descr_stack_top;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 12;
+addqw;
+lddw;
+ugtdw;
+jmpf @L508;
+ldbp 4;
+lddw;
+ldiqw descriptor_stack;
+ldiqw descr_stack_top;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+@L508:
+ldiqw descriptor_stack;
+ldiqw descr_stack_top;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw descriptor_stack;
+ldiqw descr_stack_top;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern analyze_expression
+.bss
+.align 8
+typedef_name_info:
+.res 8
+# ==== start of definition of function `complete_tentative_definition' ====
+.text
+complete_tentative_definition:
+addsp 12;        
+# param:`decl_specs', offset:-24
+# param:`declarator', offset:-32
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L509;
+# var: ts, offset: 8
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L510;
+ldiqw @S66;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+jmp @L511;
+@L510:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_struct_union_enum;
+call 4;
+pop;
+jmpf @L512;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw is_complete;
+call 8;
+pop;
+notdw;
+jmpf @L512;
+ldidw 1;
+jmp @L513;
+@L512:
+ldidw 0;
+@L513:
+jmpf @L514;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw token_table;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S67;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 44;
+pop;
+pop;
+@L514:
+@L511:
+jmp @L515;
+@L509:
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L516;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L516;
+ldidw 1;
+jmp @L517;
+@L516:
+ldidw 0;
+@L517:
+jmpf @L518;
+ldiqw new_exec_node;
+call 0;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+dw2qw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+@L518:
+@L515:
+ldidw 0;
+ret;
+.extern memchr
+.extern new_type_exp_node
+.extern analyze_primary_expression
+# ==== start of definition of function `dup_decl_specs' ====
+.text
+dup_decl_specs:
+.global dup_decl_specs
+addsp 12;        
+# param:`ds', offset:-24
+# var: n, offset: 8
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L519;
+ldidw 0;
+dw2qw;
+ret;
+@L519:
+ldiqw new_type_exp_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+swap2;
+memcpy 48;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw dup_decl_specs;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 8
+decl_node_arena:
+.res 8
+.extern new_declaration_node
+.extern vfprintf
+.extern eval_const_expr
+.extern pch_read
+.extern hash
+# ==== start of definition of function `new_param_decl' ====
+.text
+new_param_decl:
+addsp 12;        
+# param:`decl_specs', offset:-24
+# param:`declarator', offset:-32
+# var: n, offset: 8
+ldiqw new_decl_list_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw new_declaration_node;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `is_sto_class_spec' ====
+.text
+is_sto_class_spec:
+addsp 0;         
+# param:`t', offset:-20
+ldbp -20;
+lddw;
+ldiqw @T520;
+switch;
+@L522:
+@L523:
+@L524:
+@L525:
+@L526:
+ldidw 1;
+dw2qw;
+ret;
+@L527:
+ldidw 0;
+dw2qw;
+ret;
+@L521:
+.data
+.align 8
+@T520:
+.dword 6
+.dword 46
+.dword 56
+.dword 62
+.dword 67
+.dword 70
+.qword @L527
+.qword @L525
+.qword @L523
+.qword @L526
+.qword @L524
+.qword @L522
+.text
+ldidw 0;
+ret;
+.extern iscntrl
+.extern bsearch
+.extern pre_save_pch
+.extern qsort
+# ==== start of definition of function `analyze_parameter_declaration' ====
+.text
+analyze_parameter_declaration:
+.global analyze_parameter_declaration
+addsp 28;        
+# param:`d', offset:-24
+# var: scs, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw analyze_decl_specs;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L528;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 62;
+neqdw;
+jmpf @L528;
+ldidw 1;
+jmp @L529;
+@L528:
+ldidw 0;
+@L529:
+jmpf @L530;
+ldiqw @S68;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L530:
+ldbp -24;
+ldqw;
+ldiqw replace_typedef_name;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L531;
+# var: p, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw analyze_declarator2;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+eqdw;
+jmpf @L532;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L533;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L533;
+ldidw 1;
+jmp @L534;
+@L533:
+ldidw 0;
+@L534:
+jmpf @L535;
+ldiqw @S69;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L535:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw install_ordinary_id;
+call 20;
+pop;
+pop;
+jmp @L536;
+@L532:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L536:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L537;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L538;
+ldidw 11;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L539;
+ldidw 0;
+dw2qw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+@L539:
+jmp @L540;
+@L538:
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L541;
+# var: temp, offset: 24
+ldiqw new_type_exp_node;
+call 0;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 24;
+ldqw;
+swap2;
+memcpy 48;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 11;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+@L541:
+@L540:
+@L537:
+@L531:
+ldidw 0;
+ret;
+.extern cg_outpath
+.extern pch_set_str
+.extern memcmp
+.extern pre_load_pch
+.extern vsnprintf
+.extern vsprintf
+.extern warning_count
+.extern memcpy
+.extern fopen
+.extern be_atoi
+.bss
+.align 8
+external_declarations:
+.res 32744
+.extern analyze_labeled_statement
+# ==== start of definition of function `push_scope' ====
+.text
+push_scope:
+.global push_scope
+addsp 0;         
+ldiqw delayed_delete;
+lddw;
+jmpf @L542;
+ldiqw delete_scope;
+call 0;
+pop;
+pop;
+@L542:
+ldiqw nesting_level;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldidw 16;
+sgetdw;
+jmpf @L543;
+ldidw 16;
+ldiqw @S70;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 20;
+pop;
+pop;
+ldiqw @S71;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L543:
+ldiqw scope_id;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+.extern free_c_token
+.extern parse
+.extern get_pre_token
+# ==== start of definition of function `get_member_descriptor' ====
+.text
+get_member_descriptor:
+.global get_member_descriptor
+addsp 12;        
+# param:`ty', offset:-24
+# param:`id', offset:-32
+# var: m, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_struct_descriptor;
+call 8;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L544:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L545;
+ldbp -32;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+eqqw;
+jmpf @L546;
+ldbp 8;
+ldqw;
+ret;
+@L546:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L544;
+@L545:
+@L547:
+ldidw 0;
+notdw;
+jmpf @L550;
+ldidw 1733;
+ldiqw @S72;
+ldiqw @S73;
+ldiqw @S74;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L550:
+@L548:
+ldidw 0;
+jmpf @L549;
+jmp @L547;
+@L549:
+ldidw 0;
+ret;
+.bss
+.align 4
+delayed_delete:
+.res 4
+# ==== start of definition of function `decl_init' ====
+.text
+decl_init:
+.global decl_init
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L551:
+ldbp 4;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L553;
+ldidw 0;
+ldiqw 40;
+ldidw 64;
+dw2qw;
+mulqw;
+pop;
+ldiqw arena_new;
+call 8;
+ldiqw oids_arena;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw 32;
+ldidw 32;
+dw2qw;
+mulqw;
+pop;
+ldiqw arena_new;
+call 8;
+ldiqw tags_arena;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L552:
+incldw 4;
+jmp @L551;
+@L553:
+ldidw 0;
+ldidw 2048;
+ldiqw arena_new;
+call 8;
+ldiqw decl_node_arena;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `dup_declarator' ====
+.text
+dup_declarator:
+.global dup_declarator
+addsp 28;        
+# param:`d', offset:-24
+# var: n, offset: 8
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L554;
+ldbp -24;
+ldqw;
+ret;
+@L554:
+ldiqw new_type_exp_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+swap2;
+memcpy 48;
+pop;
+pop;
+ldiqw typedef_name_info;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L555;
+# var: p, offset: 16
+# var: temp, offset: 24
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw dup_declarator;
+call 8;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw new_param_decl;
+call 16;
+ldbp 24;
+stqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L556:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L557;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw dup_declarator;
+call 8;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw new_param_decl;
+call 16;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L556;
+@L557:
+@L555:
+ldbp -24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw dup_declarator;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern strncat
+.extern fileno
+.extern isdigit
+.extern pch_new_vector
+# ==== start of definition of function `lookup_external_id' ====
+.text
+lookup_external_id:
+.global lookup_external_id
+addsp 12;        
+# param:`id', offset:-24
+# var: np, offset: 8
+ldiqw external_declarations;
+ldbp -24;
+ldqw;
+ldiqw atom_hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L558:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L560;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L561;
+ldbp 8;
+ldqw;
+ret;
+@L561:
+@L559:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L558;
+@L560:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern isspace
+.bss
+.align 8
+descriptor_stack:
+.res 512
+.extern hash2
+# ==== start of definition of function `analyze_type_name' ====
+.text
+analyze_type_name:
+.global analyze_type_name
+addsp 0;         
+# param:`tn', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw analyze_decl_specs;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw replace_typedef_name;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw analyze_declarator2;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern isalpha
+.extern is_unsigned_int
+.extern memmove
+.extern replace_extension
+# ==== start of definition of function `analyze_struct_declarator' ====
+.text
+analyze_struct_declarator:
+.global analyze_struct_declarator
+addsp 12;        
+# param:`sql', offset:-24
+# param:`declarator', offset:-32
+# var: inc_ty_err, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw analyze_declarator;
+call 20;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L562;
+# var: ts, offset: 8
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_struct_union_enum;
+call 4;
+pop;
+jmpf @L563;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw is_complete;
+call 8;
+pop;
+notdw;
+jmpf @L563;
+ldidw 1;
+jmp @L564;
+@L563:
+ldidw 0;
+@L564:
+jmpf @L565;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+@L565:
+jmp @L566;
+@L562:
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L567;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L568;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+@L568:
+jmp @L569;
+@L567:
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L570;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S75;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L570:
+@L569:
+@L566:
+ldbp 4;
+lddw;
+jmpf @L571;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S76;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L571:
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw new_struct_member;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `get_type_spec' ====
+.text
+get_type_spec:
+.global get_type_spec
+addsp 0;         
+# param:`d', offset:-24
+@L572:
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L573;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_type_spec;
+call 4;
+pop;
+jmpf @L574;
+jmp @L573;
+@L574:
+ldbp -24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+jmp @L572;
+@L573:
+@L575:
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+notdw;
+jmpf @L578;
+ldidw 189;
+ldiqw @S77;
+ldiqw @S78;
+ldiqw @S79;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L578:
+@L576:
+ldidw 0;
+jmpf @L577;
+jmp @L575;
+@L577:
+ldbp -24;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern isgraph
+.bss
+.align 8
+ordinary_identifiers:
+.res 32744
+# ==== start of definition of function `analyze_function_definition' ====
+.text
+analyze_function_definition:
+.global analyze_function_definition
+addsp 28;        
+# param:`f', offset:-24
+# var: p, offset: 8
+# var: spec, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L579;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+neqdw;
+jmpt @L579;
+ldidw 0;
+jmp @L580;
+@L579:
+ldidw 1;
+@L580:
+jmpf @L581;
+ldiqw @S80;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L581:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw current_function_name;
+stqw;
+pop;
+pop;
+@L582:
+ldiqw nesting_level;
+lddw;
+ldidw 0;
+ldidw 1;
+adddw;
+eqdw;
+notdw;
+jmpf @L585;
+ldidw 1189;
+ldiqw @S81;
+ldiqw @S82;
+ldiqw @S83;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L585:
+@L583:
+ldidw 0;
+jmpf @L584;
+jmp @L582;
+@L584:
+ldidw 0;
+ldiqw nesting_level;
+stdw;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw analyze_declarator;
+call 20;
+pop;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw analyze_init_declarator;
+call 20;
+pop;
+pop;
+ldidw 0;
+ldidw 1;
+adddw;
+ldiqw nesting_level;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L588;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 56;
+neqdw;
+jmpf @L588;
+ldidw 1;
+jmp @L589;
+@L588:
+ldidw 0;
+@L589:
+jmpf @L586;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpf @L586;
+ldidw 1;
+jmp @L587;
+@L586:
+ldidw 0;
+@L587:
+jmpf @L590;
+ldiqw token_table;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S84;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L590:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L591;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_struct_union_enum;
+call 4;
+pop;
+jmpf @L592;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw is_complete;
+call 8;
+pop;
+notdw;
+jmpf @L592;
+ldidw 1;
+jmp @L593;
+@L592:
+ldidw 0;
+@L593:
+jmpf @L594;
+ldiqw @S85;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L594:
+@L591:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+neqdw;
+jmpt @L595;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpt @L595;
+ldidw 0;
+jmp @L596;
+@L595:
+ldidw 1;
+@L596:
+jmpf @L597;
+@L598:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L601;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+neqdw;
+jmpt @L601;
+ldidw 0;
+jmp @L602;
+@L601:
+ldidw 1;
+@L602:
+jmpf @L603;
+ldiqw @S86;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+jmp @L604;
+@L603:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L605;
+# var: ts, offset: 24
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_struct_union_enum;
+call 4;
+pop;
+jmpf @L606;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw is_complete;
+call 8;
+pop;
+notdw;
+jmpf @L606;
+ldidw 1;
+jmp @L607;
+@L606:
+ldidw 0;
+@L607:
+jmpf @L608;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S87;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L608:
+@L605:
+@L604:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L599:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L609;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+neqdw;
+jmpf @L609;
+ldidw 1;
+jmp @L610;
+@L609:
+ldidw 0;
+@L610:
+jmpf @L600;
+jmp @L598;
+@L600:
+@L597:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw set_return_type;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern strdup
+.extern arena_new
+# ==== start of definition of function `analyze_init_declarator' ====
+.text
+analyze_init_declarator:
+.global analyze_init_declarator
+addsp 52;        
+# param:`decl_specs', offset:-24
+# param:`declarator', offset:-32
+# param:`is_func_def', offset:-36
+# var: scs, offset: 8
+# var: prev, offset: 16
+# var: has_func_typecat, offset: 24
+# var: is_initialized, offset: 28
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L611;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L611;
+ldidw 1;
+jmp @L612;
+@L611:
+ldidw 0;
+@L612:
+ldbp 24;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L613;
+ldbp -36;
+lddw;
+notdw;
+jmpf @L613;
+ldidw 1;
+jmp @L614;
+@L613:
+ldidw 0;
+@L614:
+ldbp 28;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 28;
+lddw;
+jmpf @L615;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L616;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 70;
+eqdw;
+jmpf @L616;
+ldidw 1;
+jmp @L617;
+@L616:
+ldidw 0;
+@L617:
+jmpf @L618;
+ldiqw @S88;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+jmp @L619;
+@L618:
+ldbp 24;
+lddw;
+jmpf @L620;
+ldiqw @S89;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+jmp @L621;
+@L620:
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L622;
+# var: ts, offset: 32
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpt @L623;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_struct_union_enum;
+call 4;
+pop;
+jmpf @L625;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw is_complete;
+call 8;
+pop;
+notdw;
+jmpf @L625;
+ldidw 1;
+jmp @L626;
+@L625:
+ldidw 0;
+@L626:
+jmpt @L623;
+ldidw 0;
+jmp @L624;
+@L623:
+ldidw 1;
+@L624:
+jmpf @L627;
+ldiqw @S90;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L627:
+@L622:
+@L621:
+@L619:
+@L615:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L628;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 70;
+eqdw;
+jmpf @L628;
+ldidw 1;
+jmp @L629;
+@L628:
+ldidw 0;
+@L629:
+jmpf @L630;
+ldiqw 0;
+ret;
+@L630:
+ldiqw nesting_level;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L631;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L632;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 46;
+eqdw;
+jmpt @L634;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 62;
+eqdw;
+jmpt @L634;
+ldidw 0;
+jmp @L635;
+@L634:
+ldidw 1;
+@L635:
+jmpf @L632;
+ldidw 1;
+jmp @L633;
+@L632:
+ldidw 0;
+@L633:
+jmpf @L636;
+ldiqw token_table;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S91;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 44;
+pop;
+pop;
+@L636:
+ldbp 28;
+lddw;
+jmpf @L637;
+ldidw 1;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw analyze_initializer;
+call 28;
+pop;
+pop;
+@L637:
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_external_id;
+call 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L638;
+ldbp 28;
+lddw;
+jmpt @L639;
+ldbp -36;
+lddw;
+jmpt @L639;
+ldidw 0;
+jmp @L640;
+@L639:
+ldidw 1;
+@L640:
+jmpf @L641;
+ldidw 0;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw install_external_id;
+call 20;
+pop;
+pop;
+jmp @L642;
+@L641:
+ldbp 24;
+lddw;
+jmpt @L643;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L645;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 56;
+eqdw;
+jmpf @L645;
+ldidw 1;
+jmp @L646;
+@L645:
+ldidw 0;
+@L646:
+jmpt @L643;
+ldidw 0;
+jmp @L644;
+@L643:
+ldidw 1;
+@L644:
+jmpf @L647;
+ldidw 1;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw install_external_id;
+call 20;
+pop;
+pop;
+jmp @L648;
+@L647:
+ldidw 2;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw install_external_id;
+call 20;
+pop;
+pop;
+@L648:
+@L642:
+jmp @L649;
+@L638:
+# var: link_err, offset: 32
+ldidw 0;
+ldbp 32;
+stdw;
+pop;
+# var: prev_scs, offset: 40
+ldbp 28;
+lddw;
+jmpt @L650;
+ldbp -36;
+lddw;
+jmpt @L650;
+ldidw 0;
+jmp @L651;
+@L650:
+ldidw 1;
+@L651:
+jmpf @L652;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L653;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S92;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L653:
+ldidw 0;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+@L652:
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L654;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L655;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+eqdw;
+jmpf @L655;
+ldidw 1;
+jmp @L656;
+@L655:
+ldidw 0;
+@L656:
+jmpf @L657;
+ldidw 1;
+ldbp 32;
+stdw;
+pop;
+@L657:
+jmp @L658;
+@L654:
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 56;
+eqdw;
+jmpf @L659;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L660;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+eqdw;
+jmpf @L661;
+ldidw 1;
+ldbp 32;
+stdw;
+pop;
+@L661:
+jmp @L662;
+@L660:
+ldbp 24;
+lddw;
+notdw;
+jmpf @L663;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L663;
+ldidw 1;
+jmp @L664;
+@L663:
+ldidw 0;
+@L664:
+jmpf @L665;
+ldidw 2;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+@L665:
+@L662:
+jmp @L666;
+@L659:
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+eqdw;
+jmpf @L667;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L668;
+ldbp 24;
+lddw;
+notdw;
+jmpf @L668;
+ldidw 1;
+jmp @L669;
+@L668:
+ldidw 0;
+@L669:
+jmpf @L670;
+ldidw 2;
+ldbp 32;
+stdw;
+pop;
+@L670:
+@L667:
+@L666:
+@L658:
+ldbp 32;
+lddw;
+notdw;
+jmpf @L671;
+jmp @L672;
+@L671:
+ldbp 32;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L673;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S93;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+jmp @L674;
+@L673:
+ldbp 32;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L675;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S94;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L675:
+@L674:
+@L672:
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw enforce_type_compatibility;
+call 32;
+pop;
+pop;
+ldbp 28;
+lddw;
+jmpt @L676;
+ldbp -36;
+lddw;
+jmpt @L676;
+ldidw 0;
+jmp @L677;
+@L676:
+ldidw 1;
+@L677:
+jmpf @L678;
+ldbp -32;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L678:
+ldbp 28;
+lddw;
+jmpf @L679;
+# var: pts, offset: 48
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L682;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 48;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 68;
+eqdw;
+jmpt @L684;
+ldbp 48;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L684;
+ldidw 0;
+jmp @L685;
+@L684:
+ldidw 1;
+@L685:
+jmpf @L682;
+ldidw 1;
+jmp @L683;
+@L682:
+ldidw 0;
+@L683:
+jmpf @L680;
+ldbp 48;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L680;
+ldidw 1;
+jmp @L681;
+@L680:
+ldidw 0;
+@L681:
+jmpf @L686;
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 48;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+@L686:
+@L679:
+@L649:
+jmp @L687;
+@L631:
+ldbp 24;
+lddw;
+jmpf @L692;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L692;
+ldidw 1;
+jmp @L693;
+@L692:
+ldidw 0;
+@L693:
+jmpf @L690;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 70;
+neqdw;
+jmpf @L690;
+ldidw 1;
+jmp @L691;
+@L690:
+ldidw 0;
+@L691:
+jmpf @L688;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 56;
+neqdw;
+jmpf @L688;
+ldidw 1;
+jmp @L689;
+@L688:
+ldidw 0;
+@L689:
+jmpf @L694;
+ldiqw token_table;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S95;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 44;
+pop;
+pop;
+@L694:
+ldbp 28;
+lddw;
+jmpf @L695;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L696;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 56;
+eqdw;
+jmpf @L696;
+ldidw 1;
+jmp @L697;
+@L696:
+ldidw 0;
+@L697:
+jmpf @L698;
+ldiqw @S96;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L698:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L701;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+eqdw;
+jmpf @L701;
+ldidw 1;
+jmp @L702;
+@L701:
+ldidw 0;
+@L702:
+jmpf @L699;
+ldidw 1;
+jmp @L700;
+@L699:
+ldidw 0;
+@L700:
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw analyze_initializer;
+call 28;
+pop;
+pop;
+@L695:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L705;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 56;
+eqdw;
+jmpf @L705;
+ldidw 1;
+jmp @L706;
+@L705:
+ldidw 0;
+@L706:
+jmpt @L703;
+ldbp 24;
+lddw;
+jmpt @L703;
+ldidw 0;
+jmp @L704;
+@L703:
+ldidw 1;
+@L704:
+jmpf @L707;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_external_id;
+call 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L708;
+ldidw 1;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw install_external_id;
+call 20;
+pop;
+pop;
+jmp @L709;
+@L708:
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw enforce_type_compatibility;
+call 32;
+pop;
+pop;
+@L709:
+jmp @L710;
+@L707:
+# var: link_ty_err, offset: 32
+ldidw 0;
+ldbp 32;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L711;
+# var: ts, offset: 40
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpt @L712;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_struct_union_enum;
+call 4;
+pop;
+jmpf @L714;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw is_complete;
+call 8;
+pop;
+notdw;
+jmpf @L714;
+ldidw 1;
+jmp @L715;
+@L714:
+ldidw 0;
+@L715:
+jmpt @L712;
+ldidw 0;
+jmp @L713;
+@L712:
+ldidw 1;
+@L713:
+jmpf @L716;
+ldidw 1;
+ldbp 32;
+stdw;
+pop;
+@L716:
+jmp @L717;
+@L711:
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L718;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L718;
+ldidw 1;
+jmp @L719;
+@L718:
+ldidw 0;
+@L719:
+jmpf @L720;
+ldidw 1;
+ldbp 32;
+stdw;
+pop;
+@L720:
+@L717:
+ldbp 32;
+lddw;
+jmpf @L721;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S97;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L721:
+@L710:
+@L687:
+ldidw 0;
+ret;
+.extern cfg_function_to_print
+.extern strncmp
+.extern arena_set_nom_siz
+.extern atom_hash
+.extern analyze_multiplicative_expression
+.extern analyze_additive_expression
+.extern pch_set_elem
+.extern pch_write
+.extern stat_number_of_c_tokens
+.extern strncpy
+# ==== start of definition of function `decl_save_pch' ====
+.text
+decl_save_pch:
+.global decl_save_pch
+addsp 76;        
+# var: i, offset: 4
+# var: n, offset: 8
+# var: sp, offset: 16
+# var: tp, offset: 24
+# var: sd, offset: 32
+# var: mp, offset: 40
+# var: ep, offset: 48
+# var: vec, offset: 56
+# var: off, offset: 60
+# var: prev, offset: 64
+# var: moff, offset: 68
+ldiqw delayed_delete;
+lddw;
+jmpf @L722;
+ldiqw delete_scope;
+call 0;
+pop;
+pop;
+@L722:
+ldidw 0;
+ldbp 8;
+stdw;
+ldbp 4;
+stdw;
+pop;
+@L723:
+ldbp 4;
+lddw;
+ldidw 4093;
+sltdw;
+jmpf @L725;
+ldiqw external_declarations;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 48;
+stqw;
+pop;
+pop;
+@L726:
+ldbp 48;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L728;
+incldw 8;
+@L727:
+ldbp 48;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 48;
+stqw;
+pop;
+pop;
+jmp @L726;
+@L728:
+@L724:
+incldw 4;
+jmp @L723;
+@L725:
+ldbp 8;
+lddw;
+ldiqw pch_new_vector;
+call 4;
+pop;
+ldbp 56;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+ldbp 4;
+stdw;
+pop;
+@L729:
+ldbp 4;
+lddw;
+ldidw 4093;
+sltdw;
+jmpf @L731;
+ldiqw external_declarations;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 48;
+stqw;
+pop;
+pop;
+@L732:
+ldbp 48;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L734;
+ldiqw 40;
+pop;
+ldbp 48;
+ldqw;
+ldiqw pch_copy;
+call 12;
+pop;
+ldbp 60;
+stdw;
+pop;
+ldbp 48;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L735;
+# var: st, offset: 72
+ldbp 60;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 16;
+addqw;
+addqw;
+pop;
+ldiqw pch_ptr;
+call 4;
+ldbp 72;
+stqw;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L736;
+ldbp 48;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L736;
+ldidw 1;
+jmp @L737;
+@L736:
+ldidw 0;
+@L737:
+jmpf @L738;
+ldidw 1;
+ldbp 72;
+ldqw;
+stdw;
+pop;
+jmp @L739;
+@L738:
+ldidw 2;
+ldbp 72;
+ldqw;
+stdw;
+pop;
+@L739:
+@L735:
+ldbp 48;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw pch_type_exp;
+call 8;
+pop;
+ldbp 60;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 0;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_ptr;
+call 8;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw pch_type_exp;
+call 8;
+pop;
+ldbp 60;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_ptr;
+call 8;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 60;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 24;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_str;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp 60;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 32;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_ptr;
+call 8;
+pop;
+pop;
+ldbp 60;
+lddw;
+ldbp 8;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldbp 56;
+lddw;
+ldiqw pch_set_elem;
+call 12;
+pop;
+pop;
+@L733:
+ldbp 48;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 48;
+stqw;
+pop;
+pop;
+jmp @L732;
+@L734:
+@L730:
+incldw 4;
+jmp @L729;
+@L731:
+ldbp 56;
+lddw;
+ldidw 5;
+ldiqw pch_set_root;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+ldbp 4;
+stdw;
+pop;
+@L740:
+ldbp 4;
+lddw;
+ldidw 4093;
+sltdw;
+jmpf @L742;
+ldiqw ordinary_identifiers;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L743:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L745;
+incldw 8;
+@L744:
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L743;
+@L745:
+@L741:
+incldw 4;
+jmp @L740;
+@L742:
+ldbp 8;
+lddw;
+ldiqw pch_new_vector;
+call 4;
+pop;
+ldbp 56;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+ldbp 4;
+stdw;
+pop;
+@L746:
+ldbp 4;
+lddw;
+ldidw 4093;
+sltdw;
+jmpf @L748;
+ldiqw ordinary_identifiers;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L749:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L751;
+ldiqw 40;
+pop;
+ldbp 16;
+ldqw;
+ldiqw pch_copy;
+call 12;
+pop;
+ldbp 60;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw pch_type_exp;
+call 8;
+pop;
+ldbp 60;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 0;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_ptr;
+call 8;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw pch_type_exp;
+call 8;
+pop;
+ldbp 60;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_ptr;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldbp 60;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 24;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_ptr;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldbp 60;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 32;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_ptr;
+call 8;
+pop;
+pop;
+ldbp 60;
+lddw;
+ldbp 8;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldbp 56;
+lddw;
+ldiqw pch_set_elem;
+call 12;
+pop;
+pop;
+@L750:
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L749;
+@L751:
+@L747:
+incldw 4;
+jmp @L746;
+@L748:
+ldbp 56;
+lddw;
+ldidw 2;
+ldiqw pch_set_root;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+ldbp 4;
+stdw;
+pop;
+@L752:
+ldbp 4;
+lddw;
+ldidw 4093;
+sltdw;
+jmpf @L754;
+ldiqw tags;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L755:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L757;
+incldw 8;
+@L756:
+ldbp 24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L755;
+@L757:
+@L753:
+incldw 4;
+jmp @L752;
+@L754:
+ldbp 8;
+lddw;
+ldiqw pch_new_vector;
+call 4;
+pop;
+ldbp 56;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+ldbp 4;
+stdw;
+pop;
+@L758:
+ldbp 4;
+lddw;
+ldidw 4093;
+sltdw;
+jmpf @L760;
+ldiqw tags;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L761:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L763;
+ldiqw 32;
+pop;
+ldbp 24;
+ldqw;
+ldiqw pch_copy;
+call 12;
+pop;
+ldbp 60;
+stdw;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw pch_type_exp;
+call 8;
+pop;
+ldbp 60;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 0;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_ptr;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldbp 60;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 16;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_ptr;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldbp 60;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 24;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_ptr;
+call 8;
+pop;
+pop;
+ldbp 60;
+lddw;
+ldbp 8;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldbp 56;
+lddw;
+ldiqw pch_set_elem;
+call 12;
+pop;
+pop;
+@L762:
+ldbp 24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L761;
+@L763:
+@L759:
+incldw 4;
+jmp @L758;
+@L760:
+ldbp 56;
+lddw;
+ldidw 3;
+ldiqw pch_set_root;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+ldbp 4;
+stdw;
+pop;
+@L764:
+ldbp 4;
+lddw;
+ldidw 4093;
+sltdw;
+jmpf @L766;
+ldiqw struct_descriptor_table;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L767:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L769;
+incldw 8;
+@L768:
+ldbp 32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L767;
+@L769:
+@L765:
+incldw 4;
+jmp @L764;
+@L766:
+ldbp 8;
+lddw;
+ldiqw pch_new_vector;
+call 4;
+pop;
+ldbp 56;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+ldbp 4;
+stdw;
+pop;
+@L770:
+ldbp 4;
+lddw;
+ldidw 4093;
+sltdw;
+jmpf @L772;
+ldiqw struct_descriptor_table;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L773:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L775;
+ldiqw 40;
+pop;
+ldbp 32;
+ldqw;
+ldiqw pch_copy;
+call 12;
+pop;
+ldbp 60;
+stdw;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 60;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 0;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_str;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp 60;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 32;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_ptr;
+call 8;
+pop;
+pop;
+ldbp 60;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 24;
+addqw;
+addqw;
+pop;
+ldbp 64;
+stdw;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+@L776:
+ldbp 40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L778;
+ldiqw 40;
+pop;
+ldbp 40;
+ldqw;
+ldiqw pch_copy;
+call 12;
+pop;
+ldbp 68;
+stdw;
+pop;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 68;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 0;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_str;
+call 12;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldiqw 16;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw pch_type_exp;
+call 8;
+pop;
+ldbp 68;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 16;
+addqw;
+ldiqw 0;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_ptr;
+call 8;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldiqw 16;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw pch_type_exp;
+call 8;
+pop;
+ldbp 68;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 16;
+addqw;
+ldiqw 8;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_ptr;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldbp 68;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 32;
+addqw;
+addqw;
+pop;
+ldiqw pch_set_ptr;
+call 8;
+pop;
+pop;
+ldbp 68;
+lddw;
+ldbp 64;
+lddw;
+ldiqw pch_set_ptr;
+call 8;
+pop;
+pop;
+ldbp 68;
+lddw;
+udw2qw;
+ldidw 0;
+dw2qw;
+ldiqw 32;
+addqw;
+addqw;
+pop;
+ldbp 64;
+stdw;
+pop;
+@L777:
+ldbp 40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L776;
+@L778:
+ldbp 60;
+lddw;
+ldbp 8;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldbp 56;
+lddw;
+ldiqw pch_set_elem;
+call 12;
+pop;
+pop;
+@L774:
+ldbp 32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L773;
+@L775:
+@L771:
+incldw 4;
+jmp @L770;
+@L772:
+ldbp 56;
+lddw;
+ldidw 4;
+ldiqw pch_set_root;
+call 8;
+pop;
+pop;
+ldiqw scope_id;
+lddw;
+ldidw 7;
+ldiqw pch_set_root;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern analyze_assignment_expression
+.bss
+.align 8
+external_declarations_list:
+.res 8
+# ==== start of definition of function `is_type_qualifier' ====
+.text
+is_type_qualifier:
+addsp 0;         
+# param:`t', offset:-20
+ldbp -20;
+lddw;
+ldidw 50;
+eqdw;
+jmpt @L779;
+ldbp -20;
+lddw;
+ldidw 74;
+eqdw;
+jmpt @L779;
+ldidw 0;
+jmp @L780;
+@L779:
+ldidw 1;
+@L780:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `new_extern_id_node' ====
+.text
+new_extern_id_node:
+.global new_extern_id_node
+addsp 0;         
+ldiqw 40;
+pop;
+ldiqw decl_node_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `decl_load_pch' ====
+.text
+decl_load_pch:
+.global decl_load_pch
+addsp 28;        
+# var: i, offset: 4
+# var: n, offset: 8
+# var: h, offset: 12
+# var: v, offset: 16
+ldbp 8;
+ldidw 5;
+ldiqw pch_get_vector;
+call 12;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L781:
+ldbp 4;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+subqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldidw 0;
+ugtdw;
+jmpf @L782;
+# var: ep, offset: 24
+ldbp 16;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw atom_hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+ldbp 12;
+stdw;
+pop;
+ldiqw external_declarations;
+ldbp 12;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 24;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw external_declarations;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L781;
+@L782:
+ldbp 8;
+ldidw 2;
+ldiqw pch_get_vector;
+call 12;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L783:
+ldbp 4;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+subqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldidw 0;
+ugtdw;
+jmpf @L784;
+# var: sp, offset: 24
+ldbp 16;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw atom_hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+ldbp 12;
+stdw;
+pop;
+ldiqw ordinary_identifiers;
+ldbp 12;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw ordinary_identifiers;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw scope_oids;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 24;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw scope_oids;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L783;
+@L784:
+ldbp 8;
+ldidw 3;
+ldiqw pch_get_vector;
+call 12;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L785:
+ldbp 4;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+subqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldidw 0;
+ugtdw;
+jmpf @L786;
+# var: tp, offset: 24
+ldbp 16;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+ldbp 12;
+stdw;
+pop;
+ldiqw tags;
+ldbp 12;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 24;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw tags;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw scope_tags;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw scope_tags;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L785;
+@L786:
+ldbp 8;
+ldidw 4;
+ldiqw pch_get_vector;
+call 12;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L787:
+ldbp 4;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+subqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldidw 0;
+ugtdw;
+jmpf @L788;
+# var: sd, offset: 24
+ldbp 16;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw hash2;
+call 8;
+ldidw 4093;
+dw2qw;
+umodqw;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldiqw struct_descriptor_table;
+ldbp 12;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 24;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw struct_descriptor_table;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L787;
+@L788:
+ldidw 7;
+ldiqw pch_get_root;
+call 4;
+pop;
+ldiqw scope_id;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern analyze_iteration_statement
+# ==== start of definition of function `analyze_translation_unit' ====
+.text
+analyze_translation_unit:
+.global analyze_translation_unit
+addsp 20;        
+# var: i, offset: 4
+# var: first, offset: 8
+# var: last, offset: 16
+ldidw 0;
+dw2qw;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L789:
+ldbp 4;
+lddw;
+ldidw 4093;
+sltdw;
+jmpf @L791;
+ldiqw external_declarations;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L792;
+ldiqw external_declarations;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L793:
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L795;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L796;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw complete_tentative_definition;
+call 16;
+pop;
+pop;
+@L796:
+@L794:
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L793;
+@L795:
+jmp @L791;
+@L792:
+@L790:
+incldw 4;
+jmp @L789;
+@L791:
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+stdw;
+pop;
+@L797:
+ldbp 4;
+lddw;
+ldidw 4093;
+sltdw;
+jmpf @L799;
+ldiqw external_declarations;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L800;
+@L801:
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L803;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L804;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw complete_tentative_definition;
+call 16;
+pop;
+pop;
+@L804:
+@L802:
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L801;
+@L803:
+@L800:
+@L798:
+incldw 4;
+jmp @L797;
+@L799:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L807;
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+neqqw;
+jmpf @L807;
+ldidw 1;
+jmp @L808;
+@L807:
+ldidw 0;
+@L808:
+jmpf @L805;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L805;
+ldidw 1;
+jmp @L806;
+@L805:
+ldidw 0;
+@L806:
+jmpf @L809;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw complete_tentative_definition;
+call 16;
+pop;
+pop;
+@L809:
+ldbp 8;
+ldqw;
+ldiqw external_declarations_list;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+tags:
+.res 32744
+.extern strnlen
+.extern empty_label_table
+# ==== start of definition of function `analyze_enumerator' ====
+.text
+analyze_enumerator:
+.global analyze_enumerator
+addsp 4;         
+# param:`e', offset:-24
+.data
+.align 8
+@analyze_enumerator_enum_ds:
+.align 8
+.align 4
+.dword 60
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.text
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L810;
+# var: ty, offset: 4
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpf @L811;
+ldiqw @S98;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L811:
+ldidw 1;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw eval_const_expr;
+call 16;
+pop;
+ldiqw en_val;
+stdw;
+pop;
+jmp @L812;
+@L810:
+ldiqw new_exec_node;
+call 0;
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw en_val;
+lddw;
+ldidw 1;
+adddw;
+ldiqw en_val;
+lddw;
+sltdw;
+jmpf @L813;
+ldiqw @S99;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+@L813:
+ldiqw en_val;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+@L812:
+ldiqw en_val;
+lddw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw @analyze_enumerator_enum_ds;
+ldiqw install_ordinary_id;
+call 20;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern targeting_arch64
+# ==== start of definition of function `set_attributes' ====
+.text
+set_attributes:
+.global set_attributes
+addsp 12;        
+# param:`e', offset:-24
+# param:`sym', offset:-32
+# var: cat, offset: 4
+# var: scs, offset: 8
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 113;
+neqdw;
+jmpf @L814;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+jmp @L815;
+@L814:
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+@L815:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 18;
+addqw;
+ldw;
+ldidw 0;
+neqdw;
+jmpf @L816;
+ldbp -32;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+jmp @L817;
+@L816:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+@L817:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 18;
+addqw;
+ldw;
+ldidw 0;
+eqdw;
+jmpt @L820;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L822;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 56;
+eqdw;
+jmpt @L824;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+eqdw;
+jmpt @L824;
+ldidw 0;
+jmp @L825;
+@L824:
+ldidw 1;
+@L825:
+jmpf @L822;
+ldidw 1;
+jmp @L823;
+@L822:
+ldidw 0;
+@L823:
+jmpt @L820;
+ldidw 0;
+jmp @L821;
+@L820:
+ldidw 1;
+@L821:
+jmpt @L818;
+ldbp 4;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L818;
+ldidw 0;
+jmp @L819;
+@L818:
+ldidw 1;
+@L819:
+jmpf @L826;
+ldidw 1;
+dw2b;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+stb;
+pop;
+jmp @L827;
+@L826:
+ldidw 0;
+dw2b;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+stb;
+pop;
+@L827:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L828;
+ldbp -32;
+ldqw;
+ldiqw 18;
+addqw;
+ldw;
+ldidw 0;
+eqdw;
+jmpt @L829;
+ldbp 4;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L829;
+ldidw 0;
+jmp @L830;
+@L829:
+ldidw 1;
+@L830:
+jmpf @L831;
+ldidw 3;
+dw2b;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+stb;
+pop;
+jmp @L832;
+@L831:
+ldidw 2;
+dw2b;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+stb;
+pop;
+@L832:
+jmp @L833;
+@L828:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 56;
+eqdw;
+jmpf @L834;
+ldidw 3;
+dw2b;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+stb;
+pop;
+jmp @L835;
+@L834:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+eqdw;
+jmpf @L836;
+ldbp -32;
+ldqw;
+ldiqw 18;
+addqw;
+ldw;
+ldidw 0;
+eqdw;
+jmpf @L836;
+ldidw 1;
+jmp @L837;
+@L836:
+ldidw 0;
+@L837:
+jmpf @L838;
+ldidw 4;
+dw2b;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+stb;
+pop;
+jmp @L839;
+@L838:
+ldidw 2;
+dw2b;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+stb;
+pop;
+@L839:
+@L835:
+@L833:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 3;
+eqdw;
+jmpf @L840;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+@L840:
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldw;
+dw2b;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 14;
+addqw;
+stb;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `is_typedef_name' ====
+.text
+is_typedef_name:
+.global is_typedef_name
+addsp 20;        
+# param:`id', offset:-24
+# var: np, offset: 8
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw lookup_ordinary_id;
+call 12;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L841;
+# var: scs, offset: 16
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L842;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 70;
+eqdw;
+jmpf @L842;
+ldidw 1;
+jmp @L843;
+@L842:
+ldidw 0;
+@L843:
+jmpf @L844;
+ldidw 1;
+dw2qw;
+ret;
+@L844:
+@L841:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern arena_reset
+.extern fread
+.extern strrchr
+.extern disable_warnings
+.extern pch_copy
+.bss
+.align 8
+tags_arena:
+.res 128
+# ==== start of definition of function `is_type_spec' ====
+.text
+is_type_spec:
+addsp 0;         
+# param:`t', offset:-20
+ldbp -20;
+lddw;
+ldiqw @T845;
+switch;
+@L847:
+@L848:
+@L849:
+@L850:
+@L851:
+@L852:
+@L853:
+@L854:
+@L855:
+@L856:
+@L857:
+@L858:
+@L859:
+@L860:
+@L861:
+@L862:
+@L863:
+ldidw 1;
+dw2qw;
+ret;
+@L864:
+ldidw 0;
+dw2qw;
+ret;
+@L846:
+.data
+.align 8
+@T845:
+.dword 18
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 68
+.dword 71
+.dword 72
+.dword 73
+.dword 90
+.dword 92
+.dword 106
+.dword 107
+.dword 108
+.dword 109
+.dword 110
+.dword 111
+.qword @L864
+.qword @L848
+.qword @L859
+.qword @L853
+.qword @L855
+.qword @L851
+.qword @L857
+.qword @L858
+.qword @L854
+.qword @L847
+.qword @L861
+.qword @L860
+.qword @L849
+.qword @L850
+.qword @L852
+.qword @L856
+.qword @L862
+.qword @L863
+.text
+ldidw 0;
+ret;
+.extern decrease_switch_nesting_level
+.extern install_macro
+.extern pch_set_ptr
+.extern ferror
+.extern random
+.extern isblank
+.extern free
+.extern malloc
+# ==== start of definition of function `get_external_declarations' ====
+.text
+get_external_declarations:
+.global get_external_declarations
+addsp 0;         
+ldiqw external_declarations_list;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern pch_get_vector
+.extern new_decl_list_node
+.extern srandom
+# ==== start of definition of function `lookup_struct_descriptor' ====
+.text
+lookup_struct_descriptor:
+.global lookup_struct_descriptor
+addsp 12;        
+# param:`tag', offset:-24
+# var: np, offset: 8
+ldiqw last_descriptor;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L865;
+ldiqw last_descriptor;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+eqqw;
+jmpf @L865;
+ldidw 1;
+jmp @L866;
+@L865:
+ldidw 0;
+@L866:
+jmpf @L867;
+ldiqw last_descriptor;
+ldqw;
+ret;
+@L867:
+ldiqw struct_descriptor_table;
+ldbp -24;
+ldqw;
+ldiqw hash2;
+call 8;
+ldidw 4093;
+dw2qw;
+umodqw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L868:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L870;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+eqqw;
+jmpf @L871;
+jmp @L870;
+@L871:
+@L869:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L868;
+@L870:
+@L872:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+notdw;
+jmpf @L875;
+ldidw 1719;
+ldiqw @S100;
+ldiqw @S101;
+ldiqw @S102;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L875:
+@L873:
+ldidw 0;
+jmpf @L874;
+jmp @L872;
+@L874:
+ldbp 8;
+ldqw;
+ldiqw last_descriptor;
+stqw;
+ret;
+ldidw 0;
+ret;
+.extern new_exec_node
+.extern get_alignment
+.extern fgetc
+.data
+@S0:
+.byte 99
+.byte 111
+.byte 110
+.byte 102
+.byte 108
+.byte 105
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 115
+.byte 32
+.byte 102
+.byte 111
+.byte 114
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 58
+.byte 32
+.byte 98
+.byte 101
+.byte 102
+.byte 111
+.byte 114
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 44
+.byte 32
+.byte 110
+.byte 111
+.byte 119
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S1:
+.byte 105
+.byte 115
+.byte 95
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 0
+@S2:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 46
+.byte 99
+.byte 0
+@S3:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S4:
+.byte 113
+.byte 117
+.byte 97
+.byte 108
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 32
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 117
+.byte 110
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 101
+.byte 100
+.byte 32
+.byte 98
+.byte 101
+.byte 104
+.byte 97
+.byte 118
+.byte 105
+.byte 111
+.byte 114
+.byte 0
+@S5:
+.byte 110
+.byte 101
+.byte 115
+.byte 116
+.byte 101
+.byte 100
+.byte 32
+.byte 114
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S6:
+.byte 114
+.byte 101
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 101
+.byte 110
+.byte 117
+.byte 109
+.byte 101
+.byte 114
+.byte 97
+.byte 116
+.byte 111
+.byte 114
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S7:
+.byte 114
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S8:
+.byte 114
+.byte 101
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 110
+.byte 111
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 107
+.byte 97
+.byte 103
+.byte 101
+.byte 0
+@S9:
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 110
+.byte 111
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 107
+.byte 97
+.byte 103
+.byte 101
+.byte 32
+.byte 102
+.byte 111
+.byte 108
+.byte 108
+.byte 111
+.byte 119
+.byte 115
+.byte 32
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S10:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 102
+.byte 111
+.byte 108
+.byte 108
+.byte 111
+.byte 119
+.byte 115
+.byte 32
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 110
+.byte 111
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 107
+.byte 97
+.byte 103
+.byte 101
+.byte 0
+@S11:
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 114
+.byte 101
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 101
+.byte 100
+.byte 32
+.byte 97
+.byte 115
+.byte 32
+.byte 100
+.byte 105
+.byte 102
+.byte 102
+.byte 101
+.byte 114
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 107
+.byte 105
+.byte 110
+.byte 100
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 115
+.byte 121
+.byte 109
+.byte 98
+.byte 111
+.byte 108
+.byte 0
+@S12:
+.byte 97
+.byte 110
+.byte 97
+.byte 108
+.byte 121
+.byte 122
+.byte 101
+.byte 95
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 95
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 115
+.byte 0
+@S13:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 46
+.byte 99
+.byte 0
+@S14:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S15:
+.byte 109
+.byte 111
+.byte 114
+.byte 101
+.byte 32
+.byte 116
+.byte 104
+.byte 97
+.byte 110
+.byte 32
+.byte 111
+.byte 110
+.byte 101
+.byte 32
+.byte 115
+.byte 116
+.byte 111
+.byte 114
+.byte 97
+.byte 103
+.byte 101
+.byte 32
+.byte 99
+.byte 108
+.byte 97
+.byte 115
+.byte 115
+.byte 32
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 0
+@S16:
+.byte 97
+.byte 110
+.byte 97
+.byte 108
+.byte 121
+.byte 122
+.byte 101
+.byte 95
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 95
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 115
+.byte 0
+@S17:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 46
+.byte 99
+.byte 0
+@S18:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S19:
+.byte 109
+.byte 105
+.byte 115
+.byte 115
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 0
+@S20:
+.byte 97
+.byte 110
+.byte 97
+.byte 108
+.byte 121
+.byte 122
+.byte 101
+.byte 95
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 95
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 115
+.byte 0
+@S21:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 46
+.byte 99
+.byte 0
+@S22:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S23:
+.byte 109
+.byte 111
+.byte 114
+.byte 101
+.byte 32
+.byte 116
+.byte 104
+.byte 97
+.byte 110
+.byte 32
+.byte 111
+.byte 110
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 0
+@S24:
+.byte 32
+.byte 0
+@S25:
+.byte 32
+.byte 0
+@S26:
+.byte 32
+.byte 0
+@S27:
+.byte 32
+.byte 0
+@S28:
+.byte 40
+.byte 42
+.byte 41
+.byte 40
+.byte 0
+@S29:
+.byte 40
+.byte 0
+@S30:
+.byte 44
+.byte 32
+.byte 0
+@S31:
+.byte 41
+.byte 0
+@S32:
+.byte 40
+.byte 42
+.byte 41
+.byte 0
+@S33:
+.byte 42
+.byte 0
+@S34:
+.byte 91
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 93
+.byte 0
+@S35:
+.byte 91
+.byte 93
+.byte 0
+@S36:
+.byte 40
+.byte 42
+.byte 37
+.byte 115
+.byte 37
+.byte 115
+.byte 41
+.byte 0
+@S37:
+.byte 40
+.byte 42
+.byte 37
+.byte 115
+.byte 41
+.byte 0
+@S38:
+.byte 42
+.byte 37
+.byte 115
+.byte 37
+.byte 115
+.byte 0
+@S39:
+.byte 42
+.byte 37
+.byte 115
+.byte 0
+@S40:
+.byte 46
+.byte 46
+.byte 46
+.byte 0
+@S41:
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 97
+.byte 108
+.byte 105
+.byte 122
+.byte 101
+.byte 114
+.byte 45
+.byte 115
+.byte 116
+.byte 114
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 102
+.byte 111
+.byte 114
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 97
+.byte 114
+.byte 114
+.byte 97
+.byte 121
+.byte 32
+.byte 105
+.byte 115
+.byte 32
+.byte 116
+.byte 111
+.byte 111
+.byte 32
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 0
+@S42:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 97
+.byte 114
+.byte 114
+.byte 97
+.byte 121
+.byte 32
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 97
+.byte 108
+.byte 105
+.byte 122
+.byte 101
+.byte 114
+.byte 0
+@S43:
+.byte 101
+.byte 120
+.byte 99
+.byte 101
+.byte 115
+.byte 115
+.byte 32
+.byte 101
+.byte 108
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 115
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 97
+.byte 114
+.byte 114
+.byte 97
+.byte 121
+.byte 32
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 97
+.byte 108
+.byte 105
+.byte 122
+.byte 101
+.byte 114
+.byte 0
+@S44:
+.byte 97
+.byte 110
+.byte 97
+.byte 108
+.byte 121
+.byte 122
+.byte 101
+.byte 95
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 97
+.byte 108
+.byte 105
+.byte 122
+.byte 101
+.byte 114
+.byte 0
+@S45:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 46
+.byte 99
+.byte 0
+@S46:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S47:
+.byte 101
+.byte 120
+.byte 99
+.byte 101
+.byte 115
+.byte 115
+.byte 32
+.byte 101
+.byte 108
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 115
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 97
+.byte 108
+.byte 105
+.byte 122
+.byte 101
+.byte 114
+.byte 0
+@S48:
+.byte 97
+.byte 110
+.byte 97
+.byte 108
+.byte 121
+.byte 122
+.byte 101
+.byte 95
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 97
+.byte 108
+.byte 105
+.byte 122
+.byte 101
+.byte 114
+.byte 0
+@S49:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 46
+.byte 99
+.byte 0
+@S50:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S51:
+.byte 101
+.byte 120
+.byte 99
+.byte 101
+.byte 115
+.byte 115
+.byte 32
+.byte 101
+.byte 108
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 115
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 117
+.byte 110
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 97
+.byte 108
+.byte 105
+.byte 122
+.byte 101
+.byte 114
+.byte 0
+@S52:
+.byte 101
+.byte 120
+.byte 99
+.byte 101
+.byte 115
+.byte 115
+.byte 32
+.byte 101
+.byte 108
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 115
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 115
+.byte 99
+.byte 97
+.byte 108
+.byte 97
+.byte 114
+.byte 32
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 97
+.byte 108
+.byte 105
+.byte 122
+.byte 101
+.byte 114
+.byte 0
+@S53:
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 97
+.byte 108
+.byte 105
+.byte 122
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 97
+.byte 110
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 97
+.byte 116
+.byte 105
+.byte 98
+.byte 108
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S54:
+.byte 100
+.byte 101
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 95
+.byte 115
+.byte 99
+.byte 111
+.byte 112
+.byte 101
+.byte 0
+@S55:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 46
+.byte 99
+.byte 0
+@S56:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S57:
+.byte 97
+.byte 114
+.byte 114
+.byte 97
+.byte 121
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 115
+.byte 0
+@S58:
+.byte 97
+.byte 114
+.byte 114
+.byte 97
+.byte 121
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 101
+.byte 108
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S59:
+.byte 97
+.byte 114
+.byte 114
+.byte 97
+.byte 121
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 101
+.byte 108
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S60:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 97
+.byte 114
+.byte 114
+.byte 97
+.byte 121
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 110
+.byte 45
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S61:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 97
+.byte 114
+.byte 114
+.byte 97
+.byte 121
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 103
+.byte 114
+.byte 101
+.byte 97
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 116
+.byte 104
+.byte 97
+.byte 110
+.byte 32
+.byte 122
+.byte 101
+.byte 114
+.byte 111
+.byte 0
+@S62:
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 114
+.byte 101
+.byte 116
+.byte 117
+.byte 114
+.byte 110
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 97
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S63:
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 114
+.byte 101
+.byte 116
+.byte 117
+.byte 114
+.byte 110
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 97
+.byte 110
+.byte 32
+.byte 97
+.byte 114
+.byte 114
+.byte 97
+.byte 121
+.byte 0
+@S64:
+.byte 96
+.byte 118
+.byte 111
+.byte 105
+.byte 100
+.byte 39
+.byte 32
+.byte 109
+.byte 117
+.byte 115
+.byte 116
+.byte 32
+.byte 98
+.byte 101
+.byte 32
+.byte 116
+.byte 104
+.byte 101
+.byte 32
+.byte 102
+.byte 105
+.byte 114
+.byte 115
+.byte 116
+.byte 32
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 111
+.byte 110
+.byte 108
+.byte 121
+.byte 32
+.byte 112
+.byte 97
+.byte 114
+.byte 97
+.byte 109
+.byte 101
+.byte 116
+.byte 101
+.byte 114
+.byte 0
+@S65:
+.byte 100
+.byte 117
+.byte 112
+.byte 108
+.byte 105
+.byte 99
+.byte 97
+.byte 116
+.byte 101
+.byte 32
+.byte 109
+.byte 101
+.byte 109
+.byte 98
+.byte 101
+.byte 114
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S66:
+.byte 118
+.byte 97
+.byte 114
+.byte 105
+.byte 97
+.byte 98
+.byte 108
+.byte 101
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 96
+.byte 118
+.byte 111
+.byte 105
+.byte 100
+.byte 39
+.byte 0
+@S67:
+.byte 116
+.byte 101
+.byte 110
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 118
+.byte 101
+.byte 32
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 116
+.byte 104
+.byte 97
+.byte 116
+.byte 32
+.byte 105
+.byte 115
+.byte 32
+.byte 110
+.byte 101
+.byte 118
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 100
+.byte 0
+@S68:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 115
+.byte 116
+.byte 111
+.byte 114
+.byte 97
+.byte 103
+.byte 101
+.byte 32
+.byte 99
+.byte 108
+.byte 97
+.byte 115
+.byte 115
+.byte 32
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 112
+.byte 97
+.byte 114
+.byte 97
+.byte 109
+.byte 101
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S69:
+.byte 112
+.byte 97
+.byte 114
+.byte 97
+.byte 109
+.byte 101
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 118
+.byte 111
+.byte 105
+.byte 100
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S70:
+.byte 101
+.byte 114
+.byte 114
+.byte 111
+.byte 114
+.byte 58
+.byte 32
+.byte 116
+.byte 111
+.byte 111
+.byte 32
+.byte 109
+.byte 97
+.byte 110
+.byte 121
+.byte 32
+.byte 110
+.byte 101
+.byte 115
+.byte 116
+.byte 101
+.byte 100
+.byte 32
+.byte 115
+.byte 99
+.byte 111
+.byte 112
+.byte 101
+.byte 115
+.byte 32
+.byte 40
+.byte 62
+.byte 61
+.byte 32
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S71:
+.byte 10
+.byte 0
+@S72:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 109
+.byte 101
+.byte 109
+.byte 98
+.byte 101
+.byte 114
+.byte 95
+.byte 100
+.byte 101
+.byte 115
+.byte 99
+.byte 114
+.byte 105
+.byte 112
+.byte 116
+.byte 111
+.byte 114
+.byte 0
+@S73:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 46
+.byte 99
+.byte 0
+@S74:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S75:
+.byte 109
+.byte 101
+.byte 109
+.byte 98
+.byte 101
+.byte 114
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 101
+.byte 100
+.byte 32
+.byte 97
+.byte 115
+.byte 32
+.byte 97
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S76:
+.byte 109
+.byte 101
+.byte 109
+.byte 98
+.byte 101
+.byte 114
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S77:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 95
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 0
+@S78:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 46
+.byte 99
+.byte 0
+@S79:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S80:
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 111
+.byte 114
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 100
+.byte 111
+.byte 101
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 105
+.byte 102
+.byte 121
+.byte 32
+.byte 97
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S81:
+.byte 97
+.byte 110
+.byte 97
+.byte 108
+.byte 121
+.byte 122
+.byte 101
+.byte 95
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 95
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S82:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 46
+.byte 99
+.byte 0
+@S83:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S84:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 115
+.byte 116
+.byte 111
+.byte 114
+.byte 97
+.byte 103
+.byte 101
+.byte 32
+.byte 99
+.byte 108
+.byte 97
+.byte 115
+.byte 115
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S85:
+.byte 114
+.byte 101
+.byte 116
+.byte 117
+.byte 114
+.byte 110
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 105
+.byte 115
+.byte 32
+.byte 97
+.byte 110
+.byte 32
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S86:
+.byte 109
+.byte 105
+.byte 115
+.byte 115
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 112
+.byte 97
+.byte 114
+.byte 97
+.byte 109
+.byte 101
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 110
+.byte 97
+.byte 109
+.byte 101
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S87:
+.byte 112
+.byte 97
+.byte 114
+.byte 97
+.byte 109
+.byte 101
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S88:
+.byte 116
+.byte 114
+.byte 121
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 97
+.byte 108
+.byte 105
+.byte 122
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 0
+@S89:
+.byte 116
+.byte 114
+.byte 121
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 97
+.byte 108
+.byte 105
+.byte 122
+.byte 101
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S90:
+.byte 116
+.byte 114
+.byte 121
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 97
+.byte 108
+.byte 105
+.byte 122
+.byte 101
+.byte 32
+.byte 118
+.byte 97
+.byte 114
+.byte 105
+.byte 97
+.byte 98
+.byte 108
+.byte 101
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 110
+.byte 111
+.byte 110
+.byte 45
+.byte 97
+.byte 114
+.byte 114
+.byte 97
+.byte 121
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S91:
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 45
+.byte 115
+.byte 99
+.byte 111
+.byte 112
+.byte 101
+.byte 32
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 115
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S92:
+.byte 114
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S93:
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 32
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 102
+.byte 111
+.byte 108
+.byte 108
+.byte 111
+.byte 119
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 110
+.byte 45
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 32
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S94:
+.byte 110
+.byte 111
+.byte 110
+.byte 45
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 32
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 102
+.byte 111
+.byte 108
+.byte 108
+.byte 111
+.byte 119
+.byte 115
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 32
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S95:
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 98
+.byte 108
+.byte 111
+.byte 99
+.byte 107
+.byte 32
+.byte 115
+.byte 99
+.byte 111
+.byte 112
+.byte 101
+.byte 32
+.byte 99
+.byte 97
+.byte 110
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 104
+.byte 97
+.byte 118
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 115
+.byte 116
+.byte 111
+.byte 114
+.byte 97
+.byte 103
+.byte 101
+.byte 32
+.byte 99
+.byte 108
+.byte 97
+.byte 115
+.byte 115
+.byte 0
+@S96:
+.byte 96
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 39
+.byte 32
+.byte 118
+.byte 97
+.byte 114
+.byte 105
+.byte 97
+.byte 98
+.byte 108
+.byte 101
+.byte 32
+.byte 99
+.byte 97
+.byte 110
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 104
+.byte 97
+.byte 118
+.byte 101
+.byte 32
+.byte 97
+.byte 110
+.byte 32
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 97
+.byte 108
+.byte 105
+.byte 122
+.byte 101
+.byte 114
+.byte 0
+@S97:
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 107
+.byte 97
+.byte 103
+.byte 101
+.byte 32
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S98:
+.byte 101
+.byte 110
+.byte 117
+.byte 109
+.byte 101
+.byte 114
+.byte 97
+.byte 116
+.byte 111
+.byte 114
+.byte 32
+.byte 118
+.byte 97
+.byte 108
+.byte 117
+.byte 101
+.byte 32
+.byte 105
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 97
+.byte 110
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S99:
+.byte 111
+.byte 118
+.byte 101
+.byte 114
+.byte 102
+.byte 108
+.byte 111
+.byte 119
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 101
+.byte 110
+.byte 117
+.byte 109
+.byte 101
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 118
+.byte 97
+.byte 108
+.byte 117
+.byte 101
+.byte 0
+@S100:
+.byte 108
+.byte 111
+.byte 111
+.byte 107
+.byte 117
+.byte 112
+.byte 95
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 95
+.byte 100
+.byte 101
+.byte 115
+.byte 99
+.byte 114
+.byte 105
+.byte 112
+.byte 116
+.byte 111
+.byte 114
+.byte 0
+@S101:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 46
+.byte 99
+.byte 0
+@S102:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
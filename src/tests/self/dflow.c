@@ -0,0 +1,1010 @@
+/*
+ * Iterative data-flow analyses.
+ */
+#define DEBUG 0
+#include "dflow.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "util/util.h"
+#include "ic.h"
+#include "expr.h"
+#include "util/bset.h"
+#include "util/arena.h"
+#include "luxcc.h"
+
+static int lnid_fn = -1;
+
+static
+void print_id_set(BSet *s)
+{
+    int i, c;
+
+    c = bset_card(s);
+    for (i = bset_iterate(s); i != -1; i = bset_iterate(NULL))
+        printf("%s%s", nid2sid_tab[cg_node(lnid_fn).lnid2nid[i]], (c--!=1)?", ":"");
+}
+
+// =======================================================================================
+// Local numbering of names.
+// =======================================================================================
+/*
+ * The sets of names used by the analyses are not indexed by nid, but by a dense
+ * renumbering of the nids that appear in the function being analyzed ("local
+ * nids"). This keeps the size of the sets independent of the number of names
+ * in the whole translation unit. Names that don't appear in a function can't
+ * affect the analyses of that function: the only names that can be referenced
+ * implicitly (address-taken variables and static objects) are also restricted
+ * to the ones the function mentions.
+ */
+int *nid2lnid;                  /* nid ==> local nid of the current function, or -1 */
+static BSet *lnid_atv;          /* address-taken variables of the current function */
+
+static void number_nids(unsigned fn)
+{
+    unsigned i, n, max;
+    int *lnids;
+
+    n = 0;
+    max = 64;
+    lnids = malloc(max*sizeof(int));
+    for (i = cfg_node(cg_node(fn).bb_i).leader; i <= cfg_node(cg_node(fn).bb_f).last; i++) {
+        unsigned k, a[3];
+
+        a[0] = instruction(i).tar;
+        a[1] = instruction(i).arg1;
+        a[2] = instruction(i).arg2;
+        for (k = 0; k < 3; k++) {
+            int nid;
+
+            if (address(a[k]).kind!=IdKind && address(a[k]).kind!=TempKind)
+                continue;
+            if (nid2lnid[nid=address_nid(a[k])] != -1)
+                continue;
+            if (n >= max) {
+                max *= 2;
+                lnids = realloc(lnids, max*sizeof(int));
+            }
+            nid2lnid[nid] = (int)n;
+            lnids[n++] = nid;
+        }
+    }
+    cg_node(fn).lnid2nid = lnids;
+    cg_node(fn).nlnid = n;
+}
+
+/*
+ * Make lnid() map the nids of function fn. The numbering is
+ * computed the first time the function is entered.
+ */
+void dflow_enter_function(unsigned fn)
+{
+    unsigned i;
+    int *lnids;
+
+    if (nid2lnid == NULL) {
+        nid2lnid = malloc(nid_counter*sizeof(int));
+        memset(nid2lnid, -1, nid_counter*sizeof(int));
+    }
+    if (lnid_fn == (int)fn)
+        return;
+
+    if (lnid_fn != -1)
+        for (i = 0, lnids = cg_node(lnid_fn).lnid2nid; i < cg_node(lnid_fn).nlnid; i++)
+            nid2lnid[lnids[i]] = -1;
+    lnid_fn = (int)fn;
+    if (cg_node(fn).lnid2nid == NULL)
+        number_nids(fn);
+    else
+        for (i = 0, lnids = cg_node(fn).lnid2nid; i < cg_node(fn).nlnid; i++)
+            nid2lnid[lnids[i]] = (int)i;
+
+    if (lnid_atv != NULL)
+        bset_free(lnid_atv);
+    lnid_atv = bset_new(cg_node(fn).nlnid);
+    for (i = 0, lnids = cg_node(fn).lnid2nid; i < cg_node(fn).nlnid; i++)
+        if (bset_member(address_taken_variables, lnids[i]))
+            bset_insert(lnid_atv, i);
+}
+
+/*
+ * Drop the local numbering of function fn (e.g. once the function
+ * has been emitted). It is computed again if fn is re-entered.
+ */
+void dflow_exit_function(unsigned fn)
+{
+    unsigned i;
+
+    if (lnid_fn == (int)fn) {
+        for (i = 0; i < cg_node(fn).nlnid; i++)
+            nid2lnid[cg_node(fn).lnid2nid[i]] = -1;
+        lnid_fn = -1;
+    }
+    free(cg_node(fn).lnid2nid);
+    cg_node(fn).lnid2nid = NULL;
+    cg_node(fn).nlnid = 0;
+}
+
+// =======================================================================================
+// Worklist solver
+// =======================================================================================
+/*
+ * Apply transfer() to the blocks of function fn until a fixed point is reached.
+ * transfer(b) recomputes the set of block b from the sets of its neighbours and
+ * returns TRUE if it changed; in that case the blocks that depend on b (the
+ * successors in a forward problem, the predecessors in a backward one) are put
+ * back in the worklist. The worklist is visited in reverse post-order (forward)
+ * or post-order (backward), wrapping around until it is empty.
+ */
+static void dflow_solve(unsigned fn, int forward, int (*transfer)(unsigned b))
+{
+    int k;
+    unsigned i, n, entry_bb;
+    unsigned *order, *pos;
+    BSet *pending;
+
+    entry_bb = cg_node(fn).bb_i;
+    n = cg_node(fn).bb_f-entry_bb+1;
+    order = malloc(n*sizeof(unsigned));
+    pos = malloc(n*sizeof(unsigned));
+    for (i = 0; i < n; i++) {
+        order[i] = forward ? cfg_node(entry_bb+i).RPO : cfg_node(entry_bb+i).PO;
+        assert(order[i]>=entry_bb && order[i]-entry_bb<n);
+        pos[order[i]-entry_bb] = i;
+    }
+    pending = bset_new(n);
+    bset_fill(pending, n);
+
+    for (k = 0; k != -1; ) {
+        unsigned b;
+        GraphEdge *dep;
+
+        bset_delete(pending, k);
+        b = order[k];
+        if (transfer(b)) {
+            dep = forward ? &cfg_node(b).out : &cfg_node(b).in;
+            for (i = 0; i < dep->n; i++)
+                bset_insert(pending, pos[dep->edges[i]-entry_bb]);
+        }
+        if ((k=bset_next(pending, k+1)) == -1)
+            k = bset_next(pending, 0);
+    }
+    bset_free(pending);
+    free(order), free(pos);
+}
+
+// =======================================================================================
+// Reaching definitions
+// =======================================================================================
+/*
+ * The definitions are the quads that assign a name. The DEDef, DefKill and
+ * ReachIn sets are indexed by the position of the quads in the function
+ * (its first quad is 0).
+ */
+static int *first_def;  /* local nid ==> last quad that assigns it, or -1 */
+static int *next_def;   /* quad ==> previous quad that assigns the same name, or -1 */
+
+static void reach_print_set(BSet *s, unsigned first);
+
+void reach_print_set(BSet *s, unsigned first)
+{
+    int i, c;
+
+    c = bset_card(s);
+    for (i = bset_iterate(s); i != -1; i = bset_iterate(NULL))
+        printf("%u%s", i+first, (c--!=1)?", ":"");
+}
+
+/* return the local nid of the name assigned by quad i, or -1 */
+static int reach_def(unsigned i)
+{
+    unsigned tar;
+
+    switch (instruction(i).op) {
+    case OpCall: case OpIndCall:
+    case OpAdd: case OpSub: case OpMul: case OpDiv:
+    case OpRem: case OpSHL: case OpSHR: case OpAnd:
+    case OpOr: case OpXor: case OpEQ: case OpNEQ:
+    case OpLT: case OpLET: case OpGT: case OpGET:
+    case OpNeg: case OpCmpl: case OpNot: case OpCh:
+    case OpUCh: case OpSh: case OpUSh: case OpAsn:
+    case OpAddrOf: case OpInd:
+        tar = instruction(i).tar;
+        if (tar==0 || address(tar).kind!=IdKind && address(tar).kind!=TempKind)
+            return -1;
+        return lnid(address_nid(tar));
+    default:
+        return -1;
+    }
+}
+
+static void reach_init_block(unsigned b, unsigned ninstr, unsigned first, BSet *defined_names)
+{
+    int i, l, d;
+    BSet *DEDef, *DefKill;
+
+    DEDef = bset_new(ninstr);
+    DefKill = bset_new(ninstr);
+    bset_clear(defined_names);
+    for (i = cfg_node(b).last; i >= (int)cfg_node(b).leader; i--) {
+        if ((l=reach_def(i))==-1 || bset_member(defined_names, l))
+            continue;
+        bset_insert(DEDef, i-first);
+        for (d = first_def[l]; d != -1; d = next_def[d])
+            if (d != i-first)
+                bset_insert(DefKill, d);
+        bset_insert(defined_names, l);
+    }
+    cfg_node(b).DEDef = DEDef;
+    cfg_node(b).DefKill = DefKill;
+}
+
+static int reach_transfer(unsigned b)
+{
+    int j, changed;
+    GraphEdge *in;
+
+    /* ReachIn(b) = the union over all predecessors p of DEDef(p) U (ReachIn(p) \ DefKill(p)) */
+    changed = FALSE;
+    in = &cfg_node(b).in;
+    for (j = 0; j < in->n; j++) {
+        unsigned p;
+
+        p = in->edges[j];
+        changed |= bset_union_diff(cfg_node(b).ReachIn, cfg_node(p).DEDef, cfg_node(p).ReachIn, cfg_node(p).DefKill);
+    }
+    return changed;
+}
+
+/*
+ * Compute the definitions that reach the start of every block of function fn.
+ * Nothing uses them at the moment.
+ */
+void dflow_ReachIn(unsigned fn)
+{
+    int l;
+    BSet *defined_names;
+    unsigned i, entry_bb, exit_bb, first, last, ninstr;
+
+    if (cg_node_is_empty(fn))
+        return;
+
+    dflow_enter_function(fn);
+    entry_bb = cg_node(fn).bb_i;
+    exit_bb = cg_node(fn).bb_f;
+    first = cfg_node(entry_bb).leader;
+    last = cfg_node(exit_bb).last;
+    ninstr = last-first+1;
+
+    /* chain the definitions of every name */
+    first_def = malloc(cg_node(fn).nlnid*sizeof(int)); /* not used if nlnid is 0 */
+    memset(first_def, -1, cg_node(fn).nlnid*sizeof(int));
+    next_def = malloc(ninstr*sizeof(int));
+    for (i = first; i <= last; i++) {
+        if ((l=reach_def(i)) != -1) {
+            next_def[i-first] = first_def[l];
+            first_def[l] = (int)(i-first);
+        }
+    }
+
+    defined_names = bset_new(cg_node(fn).nlnid);
+    for (i = entry_bb; i <= exit_bb; i++) {
+        reach_init_block(i, ninstr, first, defined_names);
+        /* all ReachIn sets are initially empty */
+        cfg_node(i).ReachIn = bset_new(ninstr);
+    }
+    bset_free(defined_names);
+    free(first_def), free(next_def);
+
+    dflow_solve(fn, TRUE, reach_transfer);
+
+#if DEBUG
+    printf("Reaching definitions, function: `%s'\n", cg_node(fn).func_id);
+    for (i = entry_bb; i <= exit_bb; i++) {
+        printf("DEDef[B%u]=", i);
+        reach_print_set(cfg_node(i).DEDef, first);
+        printf("\nDefKill[B%u]=", i);
+        reach_print_set(cfg_node(i).DefKill, first);
+        printf("\nReachIn[B%u]=", i);
+        reach_print_set(cfg_node(i).ReachIn, first);
+        printf("\n\n");
+    }
+#endif
+}
+
+void dflow_free_ReachIn(unsigned fn)
+{
+    unsigned i;
+
+    if (cg_node_is_empty(fn))
+        return;
+    for (i = cg_node(fn).bb_i; i <= cg_node(fn).bb_f; i++) {
+        bset_free(cfg_node(i).DEDef);
+        bset_free(cfg_node(i).DefKill);
+        bset_free(cfg_node(i).ReachIn);
+        cfg_node(i).DEDef = cfg_node(i).DefKill = cfg_node(i).ReachIn = NULL;
+    }
+}
+// =======================================================================================
+// Dominance
+// =======================================================================================
+static void dom_print_set(BSet *s);
+
+void dom_print_set(BSet *s)
+{
+    int i, c;
+
+    c = bset_card(s);
+    for (i = bset_iterate(s); i != -1; i = bset_iterate(NULL))
+        printf("%d%s", i, (c--!=1)?", ":"");
+}
+
+static BSet *dom_tmp;
+static unsigned dom_entry_bb;
+
+static int dom_transfer(unsigned b)
+{
+    int j;
+    GraphEdge *in;
+
+    /* with unreachable code the first node in RPO may not be n0 */
+    in = &cfg_node(b).in;
+    if (b==dom_entry_bb || in->n==0)
+        return FALSE;
+
+    /* Dom(n) = { n } U (the intersection of Dom(p) for all predecessors p of n) */
+    bset_cpy(dom_tmp, cfg_node(in->edges[0]).Dom);
+    for (j = 1; j < in->n; j++)
+        bset_inters(dom_tmp, cfg_node(in->edges[j]).Dom);
+    bset_insert(dom_tmp, b-dom_entry_bb);
+    return bset_update(cfg_node(b).Dom, dom_tmp);
+}
+
+/*
+ * Compute the dominators of every block of function fn. The
+ * blocks in the Dom sets are numbered from the function's first
+ * block (cg_node(fn).bb_i is 0).
+ */
+void dflow_Dom(unsigned fn)
+{
+    /*
+     * Unreachable nodes (e.g. the ones caused by 'return' statements)
+     * keep Dom(n) = N. They never execute, so they must not constrain
+     * the dominators of their successors.
+     */
+
+    int i;
+    unsigned entry_bb, exit_bb, n;
+
+    if (cg_node_is_empty(fn))
+        return;
+
+    entry_bb = cg_node(fn).bb_i;
+    exit_bb = cg_node(fn).bb_f;
+    n = exit_bb-entry_bb+1;
+
+    /* Dom(n0) = { n0 } */
+    cfg_node(entry_bb).Dom = bset_new(n);
+    bset_insert(cfg_node(entry_bb).Dom, 0);
+
+    /* for every n != n0, Dom(n) = N */
+    for (i = entry_bb+1; i <= exit_bb; i++) {
+        cfg_node(i).Dom = bset_new(n);
+        bset_fill(cfg_node(i).Dom, n);
+    }
+
+    /* solve equations */
+    dom_tmp = bset_new(n);
+    dom_entry_bb = entry_bb;
+    dflow_solve(fn, TRUE, dom_transfer);
+    bset_free(dom_tmp);
+
+#if DEBUG
+        printf("Dominance, function: `%s'\n", cg_node(fn).func_id);
+        for (i = cg_node(fn).bb_i; i <= cg_node(fn).bb_f; i++) {
+            printf("Dom(n%d) = { ", i);
+            dom_print_set(cfg_node(i).Dom);
+            printf(" }\n");
+        }
+#endif
+}
+
+void dflow_free_Dom(unsigned fn)
+{
+    unsigned i;
+
+    if (cg_node_is_empty(fn))
+        return;
+    for (i = cg_node(fn).bb_i; i <= cg_node(fn).bb_f; i++) {
+        bset_free(cfg_node(i).Dom);
+        cfg_node(i).Dom = NULL;
+    }
+}
+
+// =======================================================================================
+// Live analysis.
+// =======================================================================================
+static void live_init_block(unsigned b, int exit_bb);
+static BSet *live_tmp;
+static BSet *modified_static_objects;
+/*
+ * The sets of the live analysis are needed for one function at a
+ * time: they are allocated from this arena, which is recycled by
+ * dflow_free_LiveOut().
+ */
+static Arena *live_arena;
+
+/*
+ * Compute UEVar(b) and VarKill(b).
+ * Also keep track of variables' definition points for later use in Reaching Definitions.
+ */
+void live_init_block(unsigned b, int exit_bb)
+{
+    unsigned i;
+    BSet *UEVar, *VarKill;
+
+    /* sets initially empty */
+    UEVar = bset_new_in(live_arena, cg_node(lnid_fn).nlnid);
+    VarKill = bset_new_in(live_arena, cg_node(lnid_fn).nlnid);
+
+    if (exit_bb)
+        bset_cpy(UEVar, modified_static_objects);
+
+    for (i = cfg_node(b).leader; i <= cfg_node(b).last; i++) {
+        unsigned tar, arg1, arg2;
+
+        tar = instruction(i).tar;
+        arg1 = instruction(i).arg1;
+        arg2 = instruction(i).arg2;
+
+        switch (instruction(i).op) {
+#define add_UEVar(e)\
+    if (!bset_member(VarKill, lnid(address_nid(e))))\
+        bset_insert(UEVar, lnid(address_nid(e)))
+#define add_VarKill(e)\
+    bset_insert(VarKill, lnid(address_nid(e)))
+/*#define add_VarDefPoint(e)\
+    do {\
+        VarDefPoint **p;\
+\
+        p = &variable_definition_points[address_nid(e)];\
+        if (*p == NULL) {\
+            *p = arena_alloc(vdp_arena, sizeof(VarDefPoint));\
+            (*p)->dp = i;\
+            (*p)->next = NULL;\
+        } else {\
+            VarDefPoint *q;\
+\
+            q = arena_alloc(vdp_arena, sizeof(VarDefPoint));\
+            q->dp = i;\
+            q->next = *p;\
+            *p = q;\
+        }\
+    } while (0)*/
+
+        case OpAdd: case OpSub: case OpMul: case OpDiv:
+        case OpRem: case OpSHL: case OpSHR: case OpAnd:
+        case OpOr: case OpXor: case OpEQ: case OpNEQ:
+        case OpLT: case OpLET: case OpGT: case OpGET:
+            if (!const_addr(arg1))
+                add_UEVar(arg1);
+            if (!const_addr(arg2))
+                add_UEVar(arg2);
+            add_VarKill(tar);
+            // add_VarDefPoint(tar);
+            continue;
+
+        case OpAsn: /* keep track of static objects modified by this function */
+            if ((address(tar).kind == IdKind)
+            && (address(tar).cont.var.e->attr.var.duration == DURATION_STATIC))
+                bset_insert(modified_static_objects, lnid(address_nid(tar)));
+        case OpNeg: case OpCmpl: case OpNot: case OpCh:
+        case OpUCh: case OpSh: case OpUSh:  case OpLLSX:
+        case OpLLZX:
+            if (!const_addr(arg1))
+                add_UEVar(arg1);
+            add_VarKill(tar);
+            // add_VarDefPoint(tar);
+            continue;
+
+        case OpArg:
+        case OpRet:
+        case OpSwitch:
+        case OpCBr:
+            if (!const_addr(arg1))
+                add_UEVar(arg1);
+            continue;
+
+        case OpAddrOf:
+            add_VarKill(tar);
+            // add_VarDefPoint(tar);
+            continue;
+
+        case OpInd:
+            /*
+             * For safety, overestimate ambiguous indirect
+             * references (assume all address-taken variables
+             * are referenced).
+             */
+            bset_cpy(live_tmp, lnid_atv);
+            bset_diff(live_tmp, VarKill);
+            bset_union(UEVar, live_tmp);
+
+            add_UEVar(arg1);
+            add_VarKill(tar);
+            // add_VarDefPoint(tar);
+            continue;
+
+        case OpIndAsn:
+            /*
+             * Must-point-to information is required in order
+             * to include pointer targets in the VarKill set.
+             * For safety, underestimate ambiguous indirect
+             * assignments (assume no variables are modified).
+             */
+            if (!const_addr(arg2))
+                add_UEVar(arg2);
+            add_UEVar(arg1);
+            continue;
+
+        case OpCall:
+        case OpIndCall:
+            bset_cpy(live_tmp, lnid_atv);
+            bset_union(live_tmp, modified_static_objects);
+            bset_diff(live_tmp, VarKill);
+            bset_union(UEVar, live_tmp);
+
+            if (instruction(i).op==OpIndCall && !const_addr(arg1))
+                add_UEVar(arg1);
+            if (tar) {
+                add_VarKill(tar);
+                // add_VarDefPoint(tar);
+            }
+            continue;
+
+        default:
+            continue;
+        }
+    }
+    cfg_node(b).UEVar = UEVar;
+    cfg_node(b).VarKill = VarKill;
+}
+
+static int live_transfer(unsigned b)
+{
+    int changed;
+    unsigned succ;
+
+    /*
+     * LiveOut(b) = the union of all successors of b, where the contribution
+     *              of each successor m is       __________
+     *                  UEVar(m) U (LiveOut(m) ∩ VarKill(m))
+     */
+    changed = FALSE;
+    for (succ = edge_iterate(&cfg_node(b).out); succ != -1; succ = edge_iterate(NULL))
+        changed |= bset_union_diff(cfg_node(b).LiveOut, cfg_node(succ).UEVar,
+        cfg_node(succ).LiveOut, cfg_node(succ).VarKill);
+    return changed;
+}
+
+/* compute LiveOut for all the blocks of the CFG */
+void dflow_LiveOut(unsigned fn)
+{
+    unsigned i;
+    unsigned entry_bb, exit_bb;
+
+    if (cg_node_is_empty(fn))
+        return;
+
+    entry_bb = cg_node(fn).bb_i;
+    exit_bb = cg_node(fn).bb_f;
+    dflow_enter_function(fn);
+    // variable_definition_points = calloc(nid_counter, sizeof(VarDefPoint *));
+    // vdp_arena = arena_new(sizeof(VarDefPoint)*32);
+    if (live_arena == NULL)
+        live_arena = arena_new(4096, FALSE);
+    live_tmp = bset_new_in(live_arena, cg_node(fn).nlnid);
+    modified_static_objects = bset_new_in(live_arena, cg_node(fn).nlnid);
+
+    /* gather initial information */
+    for (i = entry_bb; i <= exit_bb; i++) {
+        live_init_block(i, i == exit_bb);
+
+#if DEBUG
+        printf("UEVar[%d]=", i);
+        print_id_set(cfg_node(i).UEVar);
+        printf("\n\n");
+
+        printf("VarKill[%d]=", i);
+        print_id_set(cfg_node(i).VarKill);
+        printf("\n\n");
+#endif
+
+        /* all LiveOut sets are initially empty */
+        cfg_node(i).LiveOut = bset_new_in(live_arena, cg_node(fn).nlnid);
+    }
+    cg_node(fn).modified_static_objects = modified_static_objects;
+
+    /* solve equations */
+    dflow_solve(fn, FALSE, live_transfer);
+
+#if DEBUG
+    for (i = entry_bb; i <= exit_bb; i++) {
+        printf("LiveOut[%d]=", i);
+        print_id_set(cfg_node(i).LiveOut);
+        printf("\n\n");
+    }
+#endif
+}
+
+void dflow_free_LiveOut(unsigned fn)
+{
+    unsigned b;
+
+    if (cg_node_is_empty(fn))
+        return;
+
+    for (b = cg_node(fn).bb_i; b <= cg_node(fn).bb_f; b++)
+        cfg_node(b).UEVar = cfg_node(b).VarKill = cfg_node(b).LiveOut = NULL;
+    cg_node(fn).modified_static_objects = NULL;
+    arena_reset(live_arena);
+}
+
+/*
+ * Liveness and next-use.
+ */
+
+unsigned char *liveness_and_next_use;
+static BSet *operand_liveness;
+static BSet *operand_next_use;
+
+#if DEBUG
+static void print_liveness_and_next_use(unsigned fn);
+#endif
+
+/*
+ * Initialize the operand table with the liveness
+ * and next use as of the end of the block.
+ * Liveness is determined using the LiveOut set.
+ */
+static void init_operand_table(BSet *block_LiveOut)
+{
+    bset_clear(operand_next_use);
+    bset_cpy(operand_liveness, block_LiveOut);
+}
+
+/*
+ * The code generators allocate stack slots for temporaries in code order and
+ * release a slot at the point where its temporary dies. That is only correct
+ * if the live range of every temporary is contiguous in code order, which is
+ * what the IC generator produces, but not necessarily what comes out of the
+ * optimizer (e.g. a GVN'd temp may be used in two unrelated case blocks of a
+ * switch). Temporaries live across block boundaries are therefore reported
+ * as live at every use, so their slots are never released.
+ */
+static void pin_cross_block_temps(unsigned fn)
+{
+    int b, i;
+
+    bset_clear(operand_liveness);
+    for (b = cg_node(fn).bb_i; b <= cg_node(fn).bb_f; b++)
+        bset_union(operand_liveness, cfg_node(b).LiveOut);
+
+    for (i = cfg_node(cg_node(fn).bb_i).leader; i <= cfg_node(cg_node(fn).bb_f).last; i++) {
+        unsigned tar, arg1, arg2;
+
+        tar = instruction(i).tar;
+        arg1 = instruction(i).arg1;
+        arg2 = instruction(i).arg2;
+#define cross_block(a)  (address(a).kind==TempKind && bset_member(operand_liveness, lnid(address_nid(a))))
+        switch (instruction(i).op) {
+        case OpAdd: case OpSub: case OpMul: case OpDiv:
+        case OpRem: case OpSHL: case OpSHR: case OpAnd:
+        case OpOr: case OpXor: case OpEQ: case OpNEQ:
+        case OpLT: case OpLET: case OpGT: case OpGET:
+            if (cross_block(arg2))
+                liveness_and_next_use[i] |= AR2_LIVE_MASK;
+            /* fall through */
+        case OpNeg: case OpCmpl: case OpNot: case OpCh:
+        case OpAsn: case OpUCh: case OpSh: case OpUSh:
+        case OpLLSX: case OpLLZX: case OpInd:
+            if (cross_block(arg1))
+                liveness_and_next_use[i] |= AR1_LIVE_MASK;
+            /* fall through */
+        case OpAddrOf:
+            if (cross_block(tar))
+                liveness_and_next_use[i] |= TAR_LIVE_MASK;
+            break;
+        case OpArg: case OpRet: case OpSwitch: case OpCBr:
+            if (cross_block(arg1))
+                liveness_and_next_use[i] |= AR1_LIVE_MASK;
+            break;
+        case OpIndAsn:
+            if (cross_block(arg1))
+                liveness_and_next_use[i] |= AR1_LIVE_MASK;
+            if (cross_block(arg2))
+                liveness_and_next_use[i] |= AR2_LIVE_MASK;
+            break;
+        case OpCall: case OpIndCall:
+            if (tar && cross_block(tar))
+                liveness_and_next_use[i] |= TAR_LIVE_MASK;
+            if (instruction(i).op==OpIndCall && cross_block(arg1))
+                liveness_and_next_use[i] |= AR1_LIVE_MASK;
+            break;
+        default:
+            break;
+        }
+#undef cross_block
+    }
+}
+
+static void compute_function_liveness_and_next_use(unsigned fn)
+{
+    int b;
+    unsigned entry_bb, last_bb;
+
+    if (cg_node_is_empty(fn))
+        return;
+
+    entry_bb = cg_node(fn).bb_i;
+    last_bb = cg_node(fn).bb_f;
+    dflow_enter_function(fn);
+    operand_liveness = bset_new(cg_node(fn).nlnid);
+    operand_next_use = bset_new(cg_node(fn).nlnid);
+
+    /* annotate the quads of every block with liveness and next-use information */
+    for (b = entry_bb; b <= last_bb; b++) {
+        int i;
+
+        init_operand_table(cfg_node(b).LiveOut);
+
+        /* scan backward through the block */
+        for (i = cfg_node(b).last; i >= (int)cfg_node(b).leader; i--) {
+            unsigned tar, arg1, arg2;
+
+            tar = instruction(i).tar;
+            arg1 = instruction(i).arg1;
+            arg2 = instruction(i).arg2;
+            switch (instruction(i).op) {
+#define update_tar()\
+        do {\
+            int tar_nid;\
+\
+            tar_nid = lnid(address_nid(tar));\
+            if (bset_member(operand_liveness, tar_nid)) {\
+                liveness_and_next_use[i] |= TAR_LIVE_MASK;\
+                bset_delete(operand_liveness, tar_nid);\
+            } else {\
+                /*liveness_and_next_use[i] &= ~TAR_LIVE_MASK;*/\
+            }\
+            if (bset_member(operand_next_use, tar_nid)) {\
+                liveness_and_next_use[i] |= TAR_NEXT_MASK;\
+                bset_delete(operand_next_use, tar_nid);\
+            } else {\
+                /*liveness_and_next_use[i] &= ~TAR_NEXT_MASK;*/\
+            }\
+        } while (0)
+#define update_arg1()\
+        do {\
+            int arg1_nid;\
+\
+            arg1_nid = lnid(address_nid(arg1));\
+            if (bset_member(operand_liveness, arg1_nid)) {\
+                liveness_and_next_use[i] |= AR1_LIVE_MASK;\
+            } else {\
+                /*liveness_and_next_use[i] &= ~AR1_LIVE_MASK;*/\
+                bset_insert(operand_liveness, arg1_nid);\
+            }\
+            if (bset_member(operand_next_use, arg1_nid)) {\
+                liveness_and_next_use[i] |= AR1_NEXT_MASK;\
+            } else {\
+                /*liveness_and_next_use[i] &= ~AR1_NEXT_MASK;*/\
+                bset_insert(operand_next_use, arg1_nid);\
+            }\
+        } while (0)
+#define update_arg2()\
+        do {\
+            int arg2_nid;\
+\
+            arg2_nid = lnid(address_nid(arg2));\
+            if (bset_member(operand_liveness, arg2_nid)) {\
+                liveness_and_next_use[i] |= AR2_LIVE_MASK;\
+            } else {\
+                /*liveness_and_next_use[i] &= ~AR2_LIVE_MASK;*/\
+                bset_insert(operand_liveness, arg2_nid);\
+            }\
+            if (bset_member(operand_next_use, arg2_nid)) {\
+                liveness_and_next_use[i] |= AR2_NEXT_MASK;\
+            } else {\
+                /*liveness_and_next_use[i] &= ~AR2_NEXT_MASK;*/\
+                bset_insert(operand_next_use, arg2_nid);\
+            }\
+        } while (0)
+
+            case OpAdd: case OpSub: case OpMul: case OpDiv:
+            case OpRem: case OpSHL: case OpSHR: case OpAnd:
+            case OpOr: case OpXor: case OpEQ: case OpNEQ:
+            case OpLT: case OpLET: case OpGT: case OpGET:
+                update_tar();
+                if (!const_addr(arg1))
+                    update_arg1();
+                if (!const_addr(arg2))
+                    update_arg2();
+                continue;
+
+            case OpNeg: case OpCmpl: case OpNot: case OpCh:
+            case OpAsn: case OpUCh: case OpSh: case OpUSh:
+            case OpLLSX: case OpLLZX:
+                update_tar();
+                if (!const_addr(arg1))
+                    update_arg1();
+                continue;
+
+            case OpArg:
+            case OpRet:
+            case OpSwitch:
+            case OpCBr:
+                if (!const_addr(arg1))
+                    update_arg1();
+                continue;
+
+            case OpAddrOf:
+                update_tar();
+                continue;
+
+            case OpInd:
+                update_tar();
+                update_arg1();
+                bset_union(operand_liveness, lnid_atv);
+                continue;
+
+            case OpIndAsn:
+                update_arg1();
+                if (!const_addr(arg2))
+                    update_arg2();
+                continue;
+
+            case OpCall:
+            case OpIndCall:
+                if (tar)
+                    update_tar();
+                if (instruction(i).op==OpIndCall && !const_addr(arg1))
+                    update_arg1();
+                bset_union(operand_liveness, cg_node(fn).modified_static_objects);
+                bset_union(operand_liveness, lnid_atv);
+                continue;
+
+            default: /* other */
+                continue;
+            } /* switch (instruction(i).op) */
+        } /* instructions */
+    } /* basic blocks */
+
+    if (opt_level)
+        pin_cross_block_temps(fn);
+    bset_free(operand_liveness);
+    bset_free(operand_next_use);
+
+#if DEBUG
+    print_liveness_and_next_use(fn);
+#endif
+}
+
+#if DEBUG
+void print_liveness_and_next_use(unsigned fn)
+{
+    int b;
+    unsigned entry_bb, last_bb;
+
+    entry_bb = cg_node(fn).bb_i;
+    last_bb = cg_node(fn).bb_f;
+
+    for (b = entry_bb; b <= last_bb; b++) {
+        int i;
+
+        printf("Block %d\n", b);
+
+        for (i = cfg_node(b).leader; i <= cfg_node(b).last; i++) {
+            unsigned tar, arg1, arg2;
+
+            tar = instruction(i).tar;
+            arg1 = instruction(i).arg1;
+            arg2 = instruction(i).arg2;
+            switch (instruction(i).op) {
+#define print_tar()\
+        printf("name=%s, ", address_sid(tar)),\
+        printf("status=%s, ", tar_liveness(i)?"LIVE":"DEAD"),\
+        printf("next use=%d", !!tar_next_use(i))
+#define print_arg1()\
+        printf("name=%s, ", address_sid(arg1)),\
+        printf("status=%s, ", arg1_liveness(i)?"LIVE":"DEAD"),\
+        printf("next use=%d", !!arg1_next_use(i))
+#define print_arg2()\
+        printf("name=%s, ", address_sid(arg2)),\
+        printf("status=%s, ", arg2_liveness(i)?"LIVE":"DEAD"),\
+        printf("next use=%d", !!arg2_next_use(i))
+
+            case OpAdd: case OpSub: case OpMul: case OpDiv:
+            case OpRem: case OpSHL: case OpSHR: case OpAnd:
+            case OpOr: case OpXor: case OpEQ: case OpNEQ:
+            case OpLT: case OpLET: case OpGT: case OpGET:
+                print_tar();
+                if (!const_addr(arg1)) {
+                    printf(" | ");
+                    print_arg1();
+                }
+                if (!const_addr(arg2)) {
+                    printf(" | ");
+                    print_arg2();
+                }
+                break;
+
+            case OpNeg: case OpCmpl: case OpNot: case OpCh:
+            case OpUCh: case OpSh: case OpUSh: case OpAsn:
+            case OpSXLL: case OpZXLL:
+                print_tar();
+                if (!const_addr(arg1)) {
+                    printf(" | ");
+                    print_arg1();
+                }
+                break;
+
+            case OpArg:
+            case OpRet:
+            case OpSwitch:
+            case OpCBr:
+                if (!const_addr(arg1)) {
+                    print_arg1();
+                }
+                break;
+
+            case OpAddrOf:
+                print_tar();
+                break;
+
+            case OpInd:
+                print_tar();
+                printf(" | ");
+                print_arg1();
+                break;
+
+            case OpIndAsn:
+                print_arg1();
+                if (!const_addr(arg2)) {
+                    printf(" | ");
+                    print_arg2();
+                }
+                break;
+
+            case OpCall:
+            case OpIndCall:
+                if (tar)
+                    print_tar();
+                if (!const_addr(arg1)) {
+                    printf(" | ");
+                    print_arg1();
+                }
+                break;
+
+            default:
+                continue;
+            } /* instructions */
+            printf("\n--------------\n");
+        } /* basic blocks */
+        printf("\n\n");
+    }
+}
+#endif
+
+/*
+ * Compute the LiveOut sets of function fn and annotate its quads.
+ * The sets remain available until dflow_free_LiveOut(fn).
+ */
+void compute_liveness_and_next_use(unsigned fn)
+{
+    if (liveness_and_next_use == NULL)
+        liveness_and_next_use = calloc(ic_instructions_counter, sizeof(unsigned char));
+    dflow_LiveOut(fn);
+    compute_function_liveness_and_next_use(fn);
+}
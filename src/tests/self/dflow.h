@@ -0,0 +1,33 @@
+#ifndef DFLOW_H_
+#define DFLOW_H_
+
+extern int *nid2lnid;
+#define lnid(nid)   (nid2lnid[nid])
+void dflow_enter_function(unsigned fn);
+void dflow_exit_function(unsigned fn);
+
+void dflow_Dom(unsigned fn);
+void dflow_free_Dom(unsigned fn);
+void dflow_LiveOut(unsigned fn);
+void dflow_free_LiveOut(unsigned fn);
+void dflow_ReachIn(unsigned fn);
+void dflow_free_ReachIn(unsigned fn);
+
+extern unsigned char *liveness_and_next_use;
+void compute_liveness_and_next_use(unsigned fn);
+
+#define TAR_LIVE_MASK   0x01
+#define AR1_LIVE_MASK   0x02
+#define AR2_LIVE_MASK   0x04
+#define TAR_NEXT_MASK   0x08
+#define AR1_NEXT_MASK   0x10
+#define AR2_NEXT_MASK   0x20
+
+#define tar_liveness(i)  (liveness_and_next_use[i] & TAR_LIVE_MASK)
+#define arg1_liveness(i) (liveness_and_next_use[i] & AR1_LIVE_MASK)
+#define arg2_liveness(i) (liveness_and_next_use[i] & AR2_LIVE_MASK)
+#define tar_next_use(i)  (liveness_and_next_use[i] & TAR_NEXT_MASK)
+#define arg1_next_use(i) (liveness_and_next_use[i] & AR1_NEXT_MASK)
+#define arg2_next_use(i) (liveness_and_next_use[i] & AR2_NEXT_MASK)
+
+#endif
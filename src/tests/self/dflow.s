@@ -0,0 +1,6227 @@
+.extern fgets
+.extern get_promoted_type
+.extern analyze_bitwise_operator
+.extern verbose_asm
+.extern bset_iterate
+.extern edge_iterate
+.extern static_objects_list
+.extern is_complete
+.extern ic_addresses
+.extern cfg_outpath
+.extern analyze_unary_expression
+.extern target_arch
+.extern arena_destroy
+.bss
+.align 8
+liveness_and_next_use:
+.res 8
+.global liveness_and_next_use
+.extern is_struct_union_enum
+# ==== start of definition of function `dom_transfer' ====
+.text
+dom_transfer:
+addsp 12;        
+# param:`b', offset:-20
+# var: j, offset: 4
+# var: in, offset: 8
+ldiqw cfg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldiqw dom_entry_bb;
+lddw;
+eqdw;
+jmpt @L1;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L1;
+ldidw 0;
+jmp @L2;
+@L1:
+ldidw 1;
+@L2:
+jmpf @L3;
+ldidw 0;
+dw2qw;
+ret;
+@L3:
+ldiqw cfg_nodes;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+ldqw;
+ldiqw dom_tmp;
+ldqw;
+ldiqw bset_cpy;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+@L4:
+ldbp 4;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ultdw;
+jmpf @L6;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+ldqw;
+ldiqw dom_tmp;
+ldqw;
+ldiqw bset_inters;
+call 16;
+pop;
+pop;
+@L5:
+incldw 4;
+jmp @L4;
+@L6:
+ldbp -20;
+lddw;
+ldiqw dom_entry_bb;
+lddw;
+subdw;
+ldiqw dom_tmp;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+ldiqw dom_tmp;
+ldqw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+ldqw;
+ldiqw bset_update;
+call 16;
+pop;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 8
+dom_tmp:
+.res 8
+.extern get_sizeof
+.extern get_curr_scope_id
+.extern getenv
+.extern can_assign_to
+.extern atoi
+.extern bset_member
+.extern exit
+.extern stderr
+.extern opt_level
+.extern restore_scope
+.bss
+.align 8
+nid2lnid:
+.res 8
+.global nid2lnid
+.extern rewind
+.extern get_type_node
+.extern analyze_logical_operator
+.extern realloc
+.extern lookup_ordinary_id
+.extern snprintf
+.extern strpbrk
+.extern pop_struct_descriptor
+.extern nid2sid_tab
+.extern fseek
+.extern push_struct_descriptor
+.extern sscanf
+.extern fputc
+.extern vsscanf
+# ==== start of definition of function `dflow_enter_function' ====
+.text
+dflow_enter_function:
+.global dflow_enter_function
+addsp 12;        
+# param:`fn', offset:-20
+# var: i, offset: 4
+# var: lnids, offset: 8
+ldiqw nid2lnid;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L7;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw nid2lnid;
+stqw;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldiqw nid2lnid;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+@L7:
+ldiqw lnid_fn;
+lddw;
+ldbp -20;
+lddw;
+eqdw;
+jmpf @L8;
+ldiqw 0;
+ret;
+@L8:
+ldiqw lnid_fn;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L9;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldiqw lnid_fn;
+lddw;
+dw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L10:
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw lnid_fn;
+lddw;
+dw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ultdw;
+jmpf @L12;
+ldidw 1;
+negdw;
+ldiqw nid2lnid;
+ldqw;
+ldbp 8;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L11:
+incldw 4;
+jmp @L10;
+@L12:
+@L9:
+ldbp -20;
+lddw;
+ldiqw lnid_fn;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L13;
+ldbp -20;
+lddw;
+ldiqw number_nids;
+call 4;
+pop;
+pop;
+jmp @L14;
+@L13:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L15:
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ultdw;
+jmpf @L17;
+ldbp 4;
+lddw;
+ldiqw nid2lnid;
+ldqw;
+ldbp 8;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L16:
+incldw 4;
+jmp @L15;
+@L17:
+@L14:
+ldiqw lnid_atv;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L18;
+ldiqw lnid_atv;
+ldqw;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+@L18:
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ldiqw bset_new;
+call 4;
+ldiqw lnid_atv;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L19:
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ultdw;
+jmpf @L21;
+ldbp 8;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxdw 4;
+ldiqw address_taken_variables;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L22;
+ldbp 4;
+lddw;
+ldiqw lnid_atv;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L22:
+@L20:
+incldw 4;
+jmp @L19;
+@L21:
+ldidw 0;
+ret;
+.extern fwrite
+.extern is_pointer
+.extern colored_diagnostics
+.extern read_stream
+.extern strspn
+.extern reset_enum_val
+.extern strtoll
+.data
+.align 4
+lnid_fn:
+.align 4
+.dword -1
+.extern analyze_relational_equality_expression
+.extern get_var_nid
+.extern get_sto_class_spec
+.extern bset_cpy
+.extern fclose
+.extern preprocess
+.extern analyze_decl_specs
+.extern strstr
+.extern calloc
+# ==== start of definition of function `init_operand_table' ====
+.text
+init_operand_table:
+addsp 0;         
+# param:`block_LiveOut', offset:-24
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_clear;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_cpy;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern pop_scope
+.extern memset
+.extern file_exists
+.extern include_libc
+.extern C_source
+.extern analyze_cast_expression
+.extern stringify_type_exp
+.extern add_quote_dir
+.extern stat_number_of_ast_nodes
+.extern strtoul
+.extern fprintf
+.extern get_type_qual
+.extern read_file
+.extern address_taken_variables
+.extern is_signed_int
+.extern printf
+.extern get_c_token
+.extern lookup_tag
+.extern get_rank
+.extern is_external_id
+.extern sprintf
+.bss
+.align 4
+dom_entry_bb:
+.res 4
+.extern strcat
+.extern are_compatible
+.bss
+.align 8
+live_tmp:
+.res 8
+.extern error_count
+.extern free_pre_token
+.extern cg_nodes_counter
+.extern round_up
+.extern analyze_declarator
+.extern include_liblux
+.extern stat_number_of_pre_tokens
+.extern bset_eq
+.extern strchr
+.extern add_angle_dir
+.extern analyze_conditional_expression
+.extern ic_outpath
+.extern arena_alloc
+# ==== start of definition of function `live_init_block' ====
+.text
+live_init_block:
+addsp 32;        
+# param:`b', offset:-20
+# param:`exit_bb', offset:-24
+# var: i, offset: 4
+# var: UEVar, offset: 8
+# var: VarKill, offset: 16
+ldiqw cg_nodes;
+ldqw;
+ldiqw lnid_fn;
+lddw;
+dw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ldiqw live_arena;
+ldqw;
+ldiqw bset_new_in;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldiqw lnid_fn;
+lddw;
+dw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ldiqw live_arena;
+ldqw;
+ldiqw bset_new_in;
+call 12;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+lddw;
+jmpf @L23;
+ldiqw modified_static_objects;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw bset_cpy;
+call 16;
+pop;
+pop;
+@L23:
+ldiqw cfg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L24:
+ldbp 4;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+uletdw;
+jmpf @L26;
+# var: tar, offset: 24
+# var: arg1, offset: 28
+# var: arg2, offset: 32
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 32;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T27;
+jmptab;
+@L29:
+@L30:
+@L31:
+@L32:
+@L33:
+@L34:
+@L35:
+@L36:
+@L37:
+@L38:
+@L39:
+@L40:
+@L41:
+@L42:
+@L43:
+@L44:
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L45;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L45;
+ldidw 0;
+jmp @L46;
+@L45:
+ldidw 1;
+@L46:
+notdw;
+jmpf @L47;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L48;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L48:
+@L47:
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L49;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L49;
+ldidw 0;
+jmp @L50;
+@L49:
+ldidw 1;
+@L50:
+notdw;
+jmpf @L51;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L52;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L52:
+@L51:
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+jmp @L25;
+@L53:
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L54;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L54;
+ldidw 1;
+jmp @L55;
+@L54:
+ldidw 0;
+@L55:
+jmpf @L56;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw modified_static_objects;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L56:
+@L57:
+@L58:
+@L59:
+@L60:
+@L61:
+@L62:
+@L63:
+@L64:
+@L65:
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L66;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L66;
+ldidw 0;
+jmp @L67;
+@L66:
+ldidw 1;
+@L67:
+notdw;
+jmpf @L68;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L69;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L69:
+@L68:
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+jmp @L25;
+@L70:
+@L71:
+@L72:
+@L73:
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L74;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L74;
+ldidw 0;
+jmp @L75;
+@L74:
+ldidw 1;
+@L75:
+notdw;
+jmpf @L76;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L77;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L77:
+@L76:
+jmp @L25;
+@L78:
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+jmp @L25;
+@L79:
+ldiqw lnid_atv;
+ldqw;
+ldiqw live_tmp;
+ldqw;
+ldiqw bset_cpy;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw live_tmp;
+ldqw;
+ldiqw bset_diff;
+call 16;
+pop;
+pop;
+ldiqw live_tmp;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw bset_union;
+call 16;
+pop;
+pop;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L80;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L80:
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+jmp @L25;
+@L81:
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L82;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L82;
+ldidw 0;
+jmp @L83;
+@L82:
+ldidw 1;
+@L83:
+notdw;
+jmpf @L84;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L85;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L85:
+@L84:
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L86;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L86:
+jmp @L25;
+@L87:
+@L88:
+ldiqw lnid_atv;
+ldqw;
+ldiqw live_tmp;
+ldqw;
+ldiqw bset_cpy;
+call 16;
+pop;
+pop;
+ldiqw modified_static_objects;
+ldqw;
+ldiqw live_tmp;
+ldqw;
+ldiqw bset_union;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw live_tmp;
+ldqw;
+ldiqw bset_diff;
+call 16;
+pop;
+pop;
+ldiqw live_tmp;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw bset_union;
+call 16;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 29;
+eqdw;
+jmpf @L89;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L91;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L91;
+ldidw 0;
+jmp @L92;
+@L91:
+ldidw 1;
+@L92:
+notdw;
+jmpf @L89;
+ldidw 1;
+jmp @L90;
+@L89:
+ldidw 0;
+@L90:
+jmpf @L93;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L94;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L94:
+@L93:
+ldbp 24;
+lddw;
+jmpf @L95;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L95:
+jmp @L25;
+@L96:
+jmp @L25;
+@L28:
+.data
+.align 8
+@T27:
+.dword 0
+.dword 38
+.qword @L96
+.qword @L29
+.qword @L30
+.qword @L31
+.qword @L32
+.qword @L33
+.qword @L34
+.qword @L35
+.qword @L36
+.qword @L37
+.qword @L38
+.qword @L39
+.qword @L40
+.qword @L41
+.qword @L42
+.qword @L43
+.qword @L44
+.qword @L57
+.qword @L58
+.qword @L59
+.qword @L60
+.qword @L61
+.qword @L62
+.qword @L63
+.qword @L64
+.qword @L65
+.qword @L78
+.qword @L79
+.qword @L53
+.qword @L87
+.qword @L88
+.qword @L81
+.qword @L96
+.qword @L96
+.qword @L70
+.qword @L71
+.qword @L72
+.qword @L96
+.qword @L73
+.text
+@L25:
+incldw 4;
+jmp @L24;
+@L26:
+ldbp 8;
+ldqw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 48;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern stdout
+.extern get_type_category
+.extern ilog2
+.bss
+.align 8
+live_arena:
+.res 8
+.extern strcmp
+.extern bset_fill
+.extern strtok
+.extern strtol
+.extern parse_header
+.extern stdin
+# ==== start of definition of function `dflow_Dom' ====
+.text
+dflow_Dom:
+.global dflow_Dom
+addsp 16;        
+# param:`fn', offset:-20
+# var: i, offset: 4
+# var: entry_bb, offset: 8
+# var: exit_bb, offset: 12
+# var: n, offset: 16
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L97;
+ldiqw 0;
+ret;
+@L97:
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldbp 8;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+ldbp 16;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldiqw bset_new;
+call 4;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+stdw;
+pop;
+@L98:
+ldbp 4;
+lddw;
+ldbp 12;
+lddw;
+uletdw;
+jmpf @L100;
+ldbp 16;
+lddw;
+ldiqw bset_new;
+call 4;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+ldqw;
+ldiqw bset_fill;
+call 12;
+pop;
+pop;
+@L99:
+incldw 4;
+jmp @L98;
+@L100:
+ldbp 16;
+lddw;
+ldiqw bset_new;
+call 4;
+ldiqw dom_tmp;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw dom_entry_bb;
+stdw;
+pop;
+ldiqw dom_transfer;
+ldidw 1;
+ldbp -20;
+lddw;
+ldiqw dflow_solve;
+call 16;
+pop;
+pop;
+ldiqw dom_tmp;
+ldqw;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern is_integer
+.extern analyze_postfix_expression
+.extern ftell
+.extern strcpy
+.extern install_tag
+.bss
+.align 8
+modified_static_objects:
+.res 8
+.extern ic_function_to_print
+.extern strtoull
+.extern strlen
+.extern token_table
+.extern bset_free
+.extern analyze_expression
+.extern cfg_nodes
+.extern memchr
+.extern new_type_exp_node
+.extern analyze_primary_expression
+.extern dup_decl_specs
+.extern new_declaration_node
+.extern vfprintf
+.extern eval_const_expr
+.extern hash
+# ==== start of definition of function `dom_print_set' ====
+.text
+dom_print_set:
+addsp 8;         
+# param:`s', offset:-24
+# var: i, offset: 4
+# var: c, offset: 8
+ldbp -24;
+ldqw;
+ldiqw bset_card;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw bset_iterate;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L101:
+ldbp 4;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L103;
+ldbp 8;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+subqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldidw 1;
+neqdw;
+jmpf @L104;
+ldiqw @S0;
+jmp @L105;
+@L104:
+ldiqw @S1;
+@L105:
+ldbp 4;
+lddw;
+ldiqw @S2;
+ldiqw printf;
+call 16;
+pop;
+pop;
+@L102:
+ldidw 0;
+dw2qw;
+ldiqw bset_iterate;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+jmp @L101;
+@L103:
+ldidw 0;
+ret;
+.bss
+.align 8
+operand_next_use:
+.res 8
+.extern bsearch
+.extern pre_save_pch
+.extern qsort
+.extern analyze_parameter_declaration
+.extern cg_outpath
+.extern memcmp
+.extern bset_insert
+.extern pre_load_pch
+# ==== start of definition of function `dflow_free_LiveOut' ====
+.text
+dflow_free_LiveOut:
+.global dflow_free_LiveOut
+addsp 4;         
+# param:`fn', offset:-20
+# var: b, offset: 4
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L106;
+ldiqw 0;
+ret;
+@L106:
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L107:
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+uletdw;
+jmpf @L109;
+ldidw 0;
+dw2qw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+stqw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 48;
+addqw;
+stqw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+@L108:
+incldw 4;
+jmp @L107;
+@L109:
+ldidw 0;
+dw2qw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw live_arena;
+ldqw;
+ldiqw arena_reset;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern vsnprintf
+.extern vsprintf
+.extern nid_counter
+# ==== start of definition of function `pin_cross_block_temps' ====
+.text
+pin_cross_block_temps:
+addsp 20;        
+# param:`fn', offset:-20
+# var: b, offset: 4
+# var: i, offset: 8
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_clear;
+call 8;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L110:
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+uletdw;
+jmpf @L112;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_union;
+call 16;
+pop;
+pop;
+@L111:
+incldw 4;
+jmp @L110;
+@L112:
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L113:
+ldbp 8;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+uletdw;
+jmpf @L115;
+# var: tar, offset: 12
+# var: arg1, offset: 16
+# var: arg2, offset: 20
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 20;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T116;
+jmptab;
+@L118:
+@L119:
+@L120:
+@L121:
+@L122:
+@L123:
+@L124:
+@L125:
+@L126:
+@L127:
+@L128:
+@L129:
+@L130:
+@L131:
+@L132:
+@L133:
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L134;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L134;
+ldidw 1;
+jmp @L135;
+@L134:
+ldidw 0;
+@L135:
+jmpf @L136;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L136:
+@L137:
+@L138:
+@L139:
+@L140:
+@L141:
+@L142:
+@L143:
+@L144:
+@L145:
+@L146:
+@L147:
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L148;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L148;
+ldidw 1;
+jmp @L149;
+@L148:
+ldidw 0;
+@L149:
+jmpf @L150;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L150:
+@L151:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L152;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L152;
+ldidw 1;
+jmp @L153;
+@L152:
+ldidw 0;
+@L153:
+jmpf @L154;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L154:
+jmp @L117;
+@L155:
+@L156:
+@L157:
+@L158:
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L159;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L159;
+ldidw 1;
+jmp @L160;
+@L159:
+ldidw 0;
+@L160:
+jmpf @L161;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L161:
+jmp @L117;
+@L162:
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L163;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L163;
+ldidw 1;
+jmp @L164;
+@L163:
+ldidw 0;
+@L164:
+jmpf @L165;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L165:
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L166;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L166;
+ldidw 1;
+jmp @L167;
+@L166:
+ldidw 0;
+@L167:
+jmpf @L168;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L168:
+jmp @L117;
+@L169:
+@L170:
+ldbp 12;
+lddw;
+jmpf @L171;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L173;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L173;
+ldidw 1;
+jmp @L174;
+@L173:
+ldidw 0;
+@L174:
+jmpf @L171;
+ldidw 1;
+jmp @L172;
+@L171:
+ldidw 0;
+@L172:
+jmpf @L175;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L175:
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 29;
+eqdw;
+jmpf @L176;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L178;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L178;
+ldidw 1;
+jmp @L179;
+@L178:
+ldidw 0;
+@L179:
+jmpf @L176;
+ldidw 1;
+jmp @L177;
+@L176:
+ldidw 0;
+@L177:
+jmpf @L180;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L180:
+jmp @L117;
+@L181:
+jmp @L117;
+@L117:
+.data
+.align 8
+@T116:
+.dword 0
+.dword 38
+.qword @L181
+.qword @L118
+.qword @L119
+.qword @L120
+.qword @L121
+.qword @L122
+.qword @L123
+.qword @L124
+.qword @L125
+.qword @L126
+.qword @L127
+.qword @L128
+.qword @L129
+.qword @L130
+.qword @L131
+.qword @L132
+.qword @L133
+.qword @L137
+.qword @L138
+.qword @L139
+.qword @L140
+.qword @L142
+.qword @L143
+.qword @L144
+.qword @L145
+.qword @L146
+.qword @L151
+.qword @L147
+.qword @L141
+.qword @L169
+.qword @L170
+.qword @L162
+.qword @L181
+.qword @L181
+.qword @L155
+.qword @L156
+.qword @L157
+.qword @L181
+.qword @L158
+.text
+@L114:
+incldw 8;
+jmp @L113;
+@L115:
+ldidw 0;
+ret;
+# ==== start of definition of function `number_nids' ====
+.text
+number_nids:
+addsp 40;        
+# param:`fn', offset:-20
+# var: i, offset: 4
+# var: n, offset: 8
+# var: max, offset: 12
+# var: lnids, offset: 16
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldidw 64;
+ldbp 12;
+stdw;
+pop;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L182:
+ldbp 4;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+uletdw;
+jmpf @L184;
+# var: k, offset: 24
+# var: a, offset: 28
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 28;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 28;
+ldidw 1;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 28;
+ldidw 2;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L185:
+ldbp 24;
+lddw;
+ldidw 3;
+ultdw;
+jmpf @L187;
+# var: nid, offset: 40
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+ldbp 24;
+lddw;
+udw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+neqdw;
+jmpf @L188;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+ldbp 24;
+lddw;
+udw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+neqdw;
+jmpf @L188;
+ldidw 1;
+jmp @L189;
+@L188:
+ldidw 0;
+@L189:
+jmpf @L190;
+jmp @L186;
+@L190:
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+ldbp 24;
+lddw;
+udw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 40;
+stdw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L191;
+jmp @L186;
+@L191:
+ldbp 8;
+lddw;
+ldbp 12;
+lddw;
+ugetdw;
+jmpf @L192;
+ldbp 12;
+lddw;
+ldidw 2;
+muldw;
+ldbp 12;
+stdw;
+pop;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldbp 16;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L192:
+ldbp 8;
+lddw;
+ldiqw nid2lnid;
+ldqw;
+ldbp 40;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 40;
+lddw;
+ldbp 16;
+ldqw;
+ldbp 8;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L186:
+incldw 24;
+jmp @L185;
+@L187:
+@L183:
+incldw 4;
+jmp @L182;
+@L184:
+ldbp 16;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern new_cg_node
+.extern warning_count
+.extern memcpy
+.extern fopen
+.extern be_atoi
+.extern bset_delete
+.extern push_scope
+.extern free_c_token
+.extern ic_main
+.extern new_address
+.extern parse
+.extern get_pre_token
+.extern get_member_descriptor
+.extern decl_init
+.extern ic_free_function
+.extern dup_declarator
+.extern cg_nodes
+.extern strncat
+# ==== start of definition of function `dflow_free_Dom' ====
+.text
+dflow_free_Dom:
+.global dflow_free_Dom
+addsp 4;         
+# param:`fn', offset:-20
+# var: i, offset: 4
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L193;
+ldiqw 0;
+ret;
+@L193:
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L194:
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+uletdw;
+jmpf @L196;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+ldqw;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+stqw;
+pop;
+pop;
+@L195:
+incldw 4;
+jmp @L194;
+@L196:
+ldidw 0;
+ret;
+.extern fileno
+.extern bset_update
+# ==== start of definition of function `dflow_LiveOut' ====
+.text
+dflow_LiveOut:
+.global dflow_LiveOut
+addsp 12;        
+# param:`fn', offset:-20
+# var: i, offset: 4
+# var: entry_bb, offset: 8
+# var: exit_bb, offset: 12
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L197;
+ldiqw 0;
+ret;
+@L197:
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldiqw dflow_enter_function;
+call 4;
+pop;
+pop;
+ldiqw live_arena;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L198;
+ldidw 0;
+ldidw 4096;
+ldiqw arena_new;
+call 8;
+ldiqw live_arena;
+stqw;
+pop;
+pop;
+@L198:
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ldiqw live_arena;
+ldqw;
+ldiqw bset_new_in;
+call 12;
+ldiqw live_tmp;
+stqw;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ldiqw live_arena;
+ldqw;
+ldiqw bset_new_in;
+call 12;
+ldiqw modified_static_objects;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L199:
+ldbp 4;
+lddw;
+ldbp 12;
+lddw;
+uletdw;
+jmpf @L201;
+ldbp 4;
+lddw;
+ldbp 12;
+lddw;
+eqdw;
+ldbp 4;
+lddw;
+ldiqw live_init_block;
+call 8;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ldiqw live_arena;
+ldqw;
+ldiqw bset_new_in;
+call 12;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+@L200:
+incldw 4;
+jmp @L199;
+@L201:
+ldiqw modified_static_objects;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw live_transfer;
+ldidw 0;
+ldbp -20;
+lddw;
+ldiqw dflow_solve;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern lookup_external_id
+.extern hash2
+.extern analyze_type_name
+.extern is_unsigned_int
+.extern memmove
+.extern replace_extension
+.extern analyze_struct_declarator
+.extern get_type_spec
+.extern cfg_nodes_counter
+# ==== start of definition of function `dflow_solve' ====
+.text
+dflow_solve:
+addsp 60;        
+# param:`fn', offset:-20
+# param:`forward', offset:-24
+# param:`transfer', offset:-32
+# var: k, offset: 4
+# var: i, offset: 8
+# var: n, offset: 12
+# var: entry_bb, offset: 16
+# var: order, offset: 24
+# var: pos, offset: 32
+# var: pending, offset: 40
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 16;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+ldbp 12;
+stdw;
+pop;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+@L202:
+ldbp 8;
+lddw;
+ldbp 12;
+lddw;
+ultdw;
+jmpf @L204;
+ldbp -24;
+lddw;
+jmpf @L205;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+ldbp 8;
+lddw;
+adddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 76;
+addqw;
+lddw;
+jmp @L206;
+@L205:
+ldiqw cfg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+ldbp 8;
+lddw;
+adddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 72;
+addqw;
+lddw;
+@L206:
+ldbp 24;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L207:
+ldbp 24;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 16;
+lddw;
+ugetdw;
+jmpf @L210;
+ldbp 24;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 16;
+lddw;
+subdw;
+ldbp 12;
+lddw;
+ultdw;
+jmpf @L210;
+ldidw 1;
+jmp @L211;
+@L210:
+ldidw 0;
+@L211:
+notdw;
+jmpf @L212;
+ldidw 153;
+ldiqw @S3;
+ldiqw @S4;
+ldiqw @S5;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L212:
+@L208:
+ldidw 0;
+jmpf @L209;
+jmp @L207;
+@L209:
+ldbp 8;
+lddw;
+ldbp 32;
+ldqw;
+ldbp 24;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 16;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L203:
+incldw 8;
+jmp @L202;
+@L204:
+ldbp 12;
+lddw;
+ldiqw bset_new;
+call 4;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldbp 40;
+ldqw;
+ldiqw bset_fill;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L213:
+ldbp 4;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L214;
+# var: b, offset: 48
+# var: dep, offset: 56
+ldbp 4;
+lddw;
+ldbp 40;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 48;
+stdw;
+pop;
+ldbp 48;
+lddw;
+ldbp -32;
+ldqw;
+call 4;
+pop;
+jmpf @L215;
+ldbp -24;
+lddw;
+jmpf @L216;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 48;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+jmp @L217;
+@L216:
+ldiqw cfg_nodes;
+ldqw;
+ldbp 48;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+@L217:
+ldbp 56;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+@L218:
+ldbp 8;
+lddw;
+ldbp 56;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ultdw;
+jmpf @L220;
+ldbp 32;
+ldqw;
+ldbp 56;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 16;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp 40;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L219:
+incldw 8;
+jmp @L218;
+@L220:
+@L215:
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+ldbp 40;
+ldqw;
+ldiqw bset_next;
+call 12;
+pop;
+ldbp 4;
+stdw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L221;
+ldidw 0;
+ldbp 40;
+ldqw;
+ldiqw bset_next;
+call 12;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L221:
+jmp @L213;
+@L214:
+ldbp 40;
+ldqw;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern analyze_function_definition
+.extern strdup
+.bss
+.align 8
+lnid_atv:
+.res 8
+.extern bset_new
+.extern arena_new
+.extern analyze_init_declarator
+.extern cfg_function_to_print
+.extern strncmp
+.extern arena_set_nom_siz
+.extern bset_union_diff
+.extern analyze_multiplicative_expression
+.extern analyze_additive_expression
+.extern stat_number_of_c_tokens
+.extern strncpy
+.extern bset_clear
+.extern decl_save_pch
+.extern bset_card
+# ==== start of definition of function `print_id_set' ====
+.text
+print_id_set:
+addsp 8;         
+# param:`s', offset:-24
+# var: i, offset: 4
+# var: c, offset: 8
+ldbp -24;
+ldqw;
+ldiqw bset_card;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw bset_iterate;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L222:
+ldbp 4;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L224;
+ldbp 8;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+subqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldidw 1;
+neqdw;
+jmpf @L225;
+ldiqw @S6;
+jmp @L226;
+@L225:
+ldiqw @S7;
+@L226:
+ldiqw nid2sid_tab;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw lnid_fn;
+lddw;
+dw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxqw 8;
+ldiqw @S8;
+ldiqw printf;
+call 20;
+pop;
+pop;
+@L223:
+ldidw 0;
+dw2qw;
+ldiqw bset_iterate;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+jmp @L222;
+@L224:
+ldidw 0;
+ret;
+.extern analyze_assignment_expression
+.extern ic_instructions
+.extern new_extern_id_node
+.extern decl_load_pch
+.extern bset_union
+.extern analyze_translation_unit
+.extern strnlen
+.extern bset_new_in
+.extern analyze_enumerator
+.extern targeting_arch64
+.extern set_attributes
+.extern is_typedef_name
+# ==== start of definition of function `dflow_exit_function' ====
+.text
+dflow_exit_function:
+.global dflow_exit_function
+addsp 4;         
+# param:`fn', offset:-20
+# var: i, offset: 4
+ldiqw lnid_fn;
+lddw;
+ldbp -20;
+lddw;
+eqdw;
+jmpf @L227;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L228:
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ultdw;
+jmpf @L230;
+ldidw 1;
+negdw;
+ldiqw nid2lnid;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L229:
+incldw 4;
+jmp @L228;
+@L230:
+ldidw 1;
+negdw;
+ldiqw lnid_fn;
+stdw;
+pop;
+@L227:
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern arena_reset
+.extern fread
+.extern strrchr
+.extern bset_next
+.extern disable_warnings
+# ==== start of definition of function `compute_function_liveness_and_next_use' ====
+.text
+compute_function_liveness_and_next_use:
+addsp 32;        
+# param:`fn', offset:-20
+# var: b, offset: 4
+# var: entry_bb, offset: 8
+# var: last_bb, offset: 12
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L231;
+ldiqw 0;
+ret;
+@L231:
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldiqw dflow_enter_function;
+call 4;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ldiqw bset_new;
+call 4;
+ldiqw operand_liveness;
+stqw;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ldiqw bset_new;
+call 4;
+ldiqw operand_next_use;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L232:
+ldbp 4;
+lddw;
+ldbp 12;
+lddw;
+uletdw;
+jmpf @L234;
+# var: i, offset: 16
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw init_operand_table;
+call 8;
+pop;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+@L235:
+ldbp 16;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+sgetdw;
+jmpf @L237;
+# var: tar, offset: 20
+# var: arg1, offset: 24
+# var: arg2, offset: 28
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 20;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T238;
+jmptab;
+@L240:
+@L241:
+@L242:
+@L243:
+@L244:
+@L245:
+@L246:
+@L247:
+@L248:
+@L249:
+@L250:
+@L251:
+@L252:
+@L253:
+@L254:
+@L255:
+@L256:
+# var: tar_nid, offset: 32
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L259;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+jmp @L260;
+@L259:
+@L260:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L261;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+jmp @L262;
+@L261:
+@L262:
+@L257:
+ldidw 0;
+jmpf @L258;
+jmp @L256;
+@L258:
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L263;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L263;
+ldidw 0;
+jmp @L264;
+@L263:
+ldidw 1;
+@L264:
+notdw;
+jmpf @L265;
+@L266:
+# var: arg1_nid, offset: 32
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L269;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L270;
+@L269:
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L270:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L271;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L272;
+@L271:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L272:
+@L267:
+ldidw 0;
+jmpf @L268;
+jmp @L266;
+@L268:
+@L265:
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L273;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L273;
+ldidw 0;
+jmp @L274;
+@L273:
+ldidw 1;
+@L274:
+notdw;
+jmpf @L275;
+@L276:
+# var: arg2_nid, offset: 32
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L279;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L280;
+@L279:
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L280:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L281;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L282;
+@L281:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L282:
+@L277:
+ldidw 0;
+jmpf @L278;
+jmp @L276;
+@L278:
+@L275:
+jmp @L236;
+@L283:
+@L284:
+@L285:
+@L286:
+@L287:
+@L288:
+@L289:
+@L290:
+@L291:
+@L292:
+@L293:
+# var: tar_nid, offset: 32
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L296;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+jmp @L297;
+@L296:
+@L297:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L298;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+jmp @L299;
+@L298:
+@L299:
+@L294:
+ldidw 0;
+jmpf @L295;
+jmp @L293;
+@L295:
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L300;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L300;
+ldidw 0;
+jmp @L301;
+@L300:
+ldidw 1;
+@L301:
+notdw;
+jmpf @L302;
+@L303:
+# var: arg1_nid, offset: 32
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L306;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L307;
+@L306:
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L307:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L308;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L309;
+@L308:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L309:
+@L304:
+ldidw 0;
+jmpf @L305;
+jmp @L303;
+@L305:
+@L302:
+jmp @L236;
+@L310:
+@L311:
+@L312:
+@L313:
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L314;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L314;
+ldidw 0;
+jmp @L315;
+@L314:
+ldidw 1;
+@L315:
+notdw;
+jmpf @L316;
+@L317:
+# var: arg1_nid, offset: 32
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L320;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L321;
+@L320:
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L321:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L322;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L323;
+@L322:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L323:
+@L318:
+ldidw 0;
+jmpf @L319;
+jmp @L317;
+@L319:
+@L316:
+jmp @L236;
+@L324:
+@L325:
+# var: tar_nid, offset: 32
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L328;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+jmp @L329;
+@L328:
+@L329:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L330;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+jmp @L331;
+@L330:
+@L331:
+@L326:
+ldidw 0;
+jmpf @L327;
+jmp @L325;
+@L327:
+jmp @L236;
+@L332:
+@L333:
+# var: tar_nid, offset: 32
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L336;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+jmp @L337;
+@L336:
+@L337:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L338;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+jmp @L339;
+@L338:
+@L339:
+@L334:
+ldidw 0;
+jmpf @L335;
+jmp @L333;
+@L335:
+@L340:
+# var: arg1_nid, offset: 32
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L343;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L344;
+@L343:
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L344:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L345;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L346;
+@L345:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L346:
+@L341:
+ldidw 0;
+jmpf @L342;
+jmp @L340;
+@L342:
+ldiqw lnid_atv;
+ldqw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_union;
+call 16;
+pop;
+pop;
+jmp @L236;
+@L347:
+@L348:
+# var: arg1_nid, offset: 32
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L351;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L352;
+@L351:
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L352:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L353;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L354;
+@L353:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L354:
+@L349:
+ldidw 0;
+jmpf @L350;
+jmp @L348;
+@L350:
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L355;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L355;
+ldidw 0;
+jmp @L356;
+@L355:
+ldidw 1;
+@L356:
+notdw;
+jmpf @L357;
+@L358:
+# var: arg2_nid, offset: 32
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L361;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L362;
+@L361:
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L362:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L363;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L364;
+@L363:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L364:
+@L359:
+ldidw 0;
+jmpf @L360;
+jmp @L358;
+@L360:
+@L357:
+jmp @L236;
+@L365:
+@L366:
+ldbp 20;
+lddw;
+jmpf @L367;
+@L368:
+# var: tar_nid, offset: 32
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L371;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+jmp @L372;
+@L371:
+@L372:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L373;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+jmp @L374;
+@L373:
+@L374:
+@L369:
+ldidw 0;
+jmpf @L370;
+jmp @L368;
+@L370:
+@L367:
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 29;
+eqdw;
+jmpf @L375;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L377;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L377;
+ldidw 0;
+jmp @L378;
+@L377:
+ldidw 1;
+@L378:
+notdw;
+jmpf @L375;
+ldidw 1;
+jmp @L376;
+@L375:
+ldidw 0;
+@L376:
+jmpf @L379;
+@L380:
+# var: arg1_nid, offset: 32
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L383;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L384;
+@L383:
+ldbp 32;
+lddw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L384:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L385;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+ordw;
+dw2ub;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+jmp @L386;
+@L385:
+ldbp 32;
+lddw;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L386:
+@L381:
+ldidw 0;
+jmpf @L382;
+jmp @L380;
+@L382:
+@L379:
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_union;
+call 16;
+pop;
+pop;
+ldiqw lnid_atv;
+ldqw;
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_union;
+call 16;
+pop;
+pop;
+jmp @L236;
+@L387:
+jmp @L236;
+@L239:
+.data
+.align 8
+@T238:
+.dword 0
+.dword 38
+.qword @L387
+.qword @L240
+.qword @L241
+.qword @L242
+.qword @L243
+.qword @L244
+.qword @L245
+.qword @L246
+.qword @L247
+.qword @L248
+.qword @L249
+.qword @L250
+.qword @L251
+.qword @L252
+.qword @L253
+.qword @L254
+.qword @L255
+.qword @L283
+.qword @L284
+.qword @L285
+.qword @L286
+.qword @L288
+.qword @L289
+.qword @L290
+.qword @L291
+.qword @L292
+.qword @L324
+.qword @L332
+.qword @L287
+.qword @L365
+.qword @L366
+.qword @L347
+.qword @L387
+.qword @L387
+.qword @L310
+.qword @L311
+.qword @L312
+.qword @L387
+.qword @L313
+.text
+@L236:
+decldw 16;
+jmp @L235;
+@L237:
+@L233:
+incldw 4;
+jmp @L232;
+@L234:
+ldiqw opt_level;
+lddw;
+jmpf @L388;
+ldbp -20;
+lddw;
+ldiqw pin_cross_block_temps;
+call 4;
+pop;
+pop;
+@L388:
+ldiqw operand_liveness;
+ldqw;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+ldiqw operand_next_use;
+ldqw;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern bset_diff
+.extern install_macro
+.extern bset_inters
+.extern edge_add
+.extern ferror
+.extern random
+.bss
+.align 8
+operand_liveness:
+.res 8
+.extern ic_instructions_counter
+.extern free
+.extern malloc
+.extern get_external_declarations
+.extern new_decl_list_node
+# ==== start of definition of function `compute_liveness_and_next_use' ====
+.text
+compute_liveness_and_next_use:
+.global compute_liveness_and_next_use
+addsp 0;         
+# param:`fn', offset:-20
+ldiqw liveness_and_next_use;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L389;
+ldiqw 1;
+ldiqw ic_instructions_counter;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldiqw liveness_and_next_use;
+stqw;
+pop;
+pop;
+@L389:
+ldbp -20;
+lddw;
+ldiqw dflow_LiveOut;
+call 4;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldiqw compute_function_liveness_and_next_use;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern srandom
+.extern lookup_struct_descriptor
+# ==== start of definition of function `live_transfer' ====
+.text
+live_transfer:
+addsp 8;         
+# param:`b', offset:-20
+# var: changed, offset: 4
+# var: succ, offset: 8
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw edge_iterate;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+@L390:
+ldbp 8;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L392;
+ldbp 4;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 48;
+addqw;
+ldqw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw bset_union_diff;
+call 32;
+pop;
+ordw;
+ldbp 4;
+stdw;
+pop;
+@L391:
+ldidw 0;
+dw2qw;
+ldiqw edge_iterate;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+jmp @L390;
+@L392:
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern new_exec_node
+.extern get_alignment
+.extern fgetc
+.data
+@S0:
+.byte 44
+.byte 32
+.byte 0
+@S1:
+.byte 0
+@S2:
+.byte 37
+.byte 100
+.byte 37
+.byte 115
+.byte 0
+@S3:
+.byte 100
+.byte 102
+.byte 108
+.byte 111
+.byte 119
+.byte 95
+.byte 115
+.byte 111
+.byte 108
+.byte 118
+.byte 101
+.byte 0
+@S4:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 100
+.byte 102
+.byte 108
+.byte 111
+.byte 119
+.byte 46
+.byte 99
+.byte 0
+@S5:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S6:
+.byte 44
+.byte 32
+.byte 0
+@S7:
+.byte 0
+@S8:
+.byte 37
+.byte 115
+.byte 37
+.byte 115
+.byte 0
@@ -0,0 +1,372 @@
+.extern fgets
+.extern verbose_asm
+.extern cfg_outpath
+.extern target_arch
+# ==== start of definition of function `emit_warning' ====
+.text
+emit_warning:
+.global emit_warning
+addsp 12;        
+# param:`file', offset:-24
+# param:`line', offset:-28
+# param:`column', offset:-32
+# param:`fmt', offset:-40
+# var: args, offset: 8
+ldiqw disable_warnings;
+lddw;
+jmpf @L1;
+ldiqw 0;
+ret;
+@L1:
+ldiqw colored_diagnostics;
+lddw;
+jmpf @L2;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw @S0;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 32;
+pop;
+pop;
+jmp @L3;
+@L2:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw @S1;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 32;
+pop;
+pop;
+@L3:
+ldbp -40;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp -40;
+ldqw;
+ldiqw stderr;
+ldqw;
+ldiqw vfprintf;
+call 24;
+pop;
+pop;
+ldiqw @S2;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldiqw warning_count;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `emit_error' ====
+.text
+emit_error:
+.global emit_error
+addsp 12;        
+# param:`fatal', offset:-20
+# param:`file', offset:-28
+# param:`line', offset:-32
+# param:`column', offset:-36
+# param:`fmt', offset:-44
+# var: args, offset: 8
+ldiqw colored_diagnostics;
+lddw;
+notdw;
+jmpt @L4;
+ldiqw stderr;
+ldqw;
+ldiqw fileno;
+call 8;
+pop;
+ldiqw isatty;
+call 4;
+pop;
+notdw;
+jmpt @L4;
+ldidw 0;
+jmp @L5;
+@L4:
+ldidw 1;
+@L5:
+jmpf @L6;
+ldbp -36;
+lddw;
+ldbp -32;
+lddw;
+ldbp -28;
+ldqw;
+ldiqw @S3;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 32;
+pop;
+pop;
+jmp @L7;
+@L6:
+ldbp -36;
+lddw;
+ldbp -32;
+lddw;
+ldbp -28;
+ldqw;
+ldiqw @S4;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 32;
+pop;
+pop;
+@L7:
+ldbp -44;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp -44;
+ldqw;
+ldiqw stderr;
+ldqw;
+ldiqw vfprintf;
+call 24;
+pop;
+pop;
+ldiqw @S5;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldbp -20;
+lddw;
+jmpf @L8;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L8:
+ldiqw error_count;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+.extern getenv
+.extern atoi
+.extern exit
+.extern stderr
+.extern opt_level
+.extern rewind
+.extern realloc
+.extern snprintf
+.extern fseek
+.extern sscanf
+.extern fputc
+.extern vsscanf
+.extern fwrite
+.extern colored_diagnostics
+.extern strtoll
+.extern fclose
+.extern calloc
+.extern include_libc
+.extern stat_number_of_ast_nodes
+.extern strtoul
+.extern fprintf
+.extern printf
+.extern sprintf
+.extern error_count
+.extern include_liblux
+.extern stat_number_of_pre_tokens
+.extern ic_outpath
+.extern stdout
+.extern strtol
+.extern stdin
+.extern ftell
+.extern ic_function_to_print
+.extern strtoull
+.extern isatty
+.extern vfprintf
+.extern bsearch
+.extern qsort
+.extern cg_outpath
+.extern vsnprintf
+.extern vsprintf
+.extern warning_count
+.extern fopen
+.extern fileno
+.extern cfg_function_to_print
+.extern stat_number_of_c_tokens
+.extern targeting_arch64
+.extern fread
+.extern disable_warnings
+.extern ferror
+.extern random
+.extern free
+.extern malloc
+.extern srandom
+.extern fgetc
+.data
+@S0:
+.byte 27
+.byte 91
+.byte 49
+.byte 59
+.byte 51
+.byte 55
+.byte 109
+.byte 37
+.byte 115
+.byte 58
+.byte 37
+.byte 100
+.byte 58
+.byte 37
+.byte 100
+.byte 58
+.byte 32
+.byte 27
+.byte 91
+.byte 49
+.byte 59
+.byte 51
+.byte 51
+.byte 109
+.byte 119
+.byte 97
+.byte 114
+.byte 110
+.byte 105
+.byte 110
+.byte 103
+.byte 58
+.byte 32
+.byte 27
+.byte 91
+.byte 48
+.byte 109
+.byte 0
+@S1:
+.byte 37
+.byte 115
+.byte 58
+.byte 37
+.byte 100
+.byte 58
+.byte 37
+.byte 100
+.byte 58
+.byte 32
+.byte 119
+.byte 97
+.byte 114
+.byte 110
+.byte 105
+.byte 110
+.byte 103
+.byte 58
+.byte 32
+.byte 0
+@S2:
+.byte 10
+.byte 0
+@S3:
+.byte 37
+.byte 115
+.byte 58
+.byte 37
+.byte 100
+.byte 58
+.byte 37
+.byte 100
+.byte 58
+.byte 32
+.byte 101
+.byte 114
+.byte 114
+.byte 111
+.byte 114
+.byte 58
+.byte 32
+.byte 0
+@S4:
+.byte 27
+.byte 91
+.byte 49
+.byte 59
+.byte 51
+.byte 55
+.byte 109
+.byte 37
+.byte 115
+.byte 58
+.byte 37
+.byte 100
+.byte 58
+.byte 37
+.byte 100
+.byte 58
+.byte 32
+.byte 27
+.byte 91
+.byte 49
+.byte 59
+.byte 51
+.byte 49
+.byte 109
+.byte 101
+.byte 114
+.byte 114
+.byte 111
+.byte 114
+.byte 58
+.byte 32
+.byte 27
+.byte 91
+.byte 48
+.byte 109
+.byte 0
+@S5:
+.byte 10
+.byte 0
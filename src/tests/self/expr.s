@@ -0,0 +1,20612 @@
+.extern fgets
+# ==== start of definition of function `analyze_iconst' ====
+.text
+analyze_iconst:
+addsp 36;        
+# param:`e', offset:-24
+# var: ty, offset: 4
+# var: kind, offset: 8
+# var: ep, offset: 16
+# var: ic, offset: 24
+# var: val, offset: 32
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @T1;
+jmptab;
+@L3:
+@L4:
+@L5:
+ldidw 0;
+ldiqw errno;
+ldqw;
+stdw;
+pop;
+ldidw 10;
+ldbp 16;
+ldbp 24;
+ldqw;
+ldiqw strtoll;
+call 20;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldiqw errno;
+ldqw;
+lddw;
+ldidw 34;
+eqdw;
+jmpf @L6;
+ldidw 110;
+ldbp 4;
+stdw;
+pop;
+jmp @L2;
+@L6:
+ldbp 32;
+ldqw;
+ldidw 2147483647;
+dw2qw;
+sletqw;
+jmpf @L7;
+ldbp 8;
+lddw;
+ldidw 78;
+eqdw;
+jmpf @L8;
+ldidw 60;
+jmp @L9;
+@L8:
+ldbp 8;
+lddw;
+ldidw 79;
+eqdw;
+jmpf @L10;
+ldidw 61;
+jmp @L11;
+@L10:
+ldidw 110;
+@L11:
+@L9:
+ldbp 4;
+stdw;
+pop;
+jmp @L12;
+@L7:
+ldiqw targeting_arch64;
+lddw;
+jmpf @L13;
+ldidw 61;
+ldbp 4;
+stdw;
+pop;
+jmp @L14;
+@L13:
+ldidw 110;
+ldbp 4;
+stdw;
+pop;
+@L14:
+@L12:
+jmp @L2;
+@L15:
+@L16:
+@L17:
+ldidw 0;
+ldiqw errno;
+ldqw;
+stdw;
+pop;
+ldidw 10;
+ldbp 16;
+ldbp 24;
+ldqw;
+ldiqw strtoull;
+call 20;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldiqw errno;
+ldqw;
+lddw;
+ldidw 34;
+eqdw;
+jmpf @L18;
+ldidw 111;
+ldbp 4;
+stdw;
+pop;
+jmp @L2;
+@L18:
+ldbp 32;
+ldqw;
+ldidw -1;
+udw2qw;
+uletqw;
+jmpf @L19;
+ldbp 8;
+lddw;
+ldidw 81;
+eqdw;
+jmpf @L20;
+ldidw 72;
+jmp @L21;
+@L20:
+ldbp 8;
+lddw;
+ldidw 82;
+eqdw;
+jmpf @L22;
+ldidw 109;
+jmp @L23;
+@L22:
+ldidw 111;
+@L23:
+@L21:
+ldbp 4;
+stdw;
+pop;
+jmp @L24;
+@L19:
+ldiqw targeting_arch64;
+lddw;
+jmpf @L25;
+ldidw 109;
+ldbp 4;
+stdw;
+pop;
+jmp @L26;
+@L25:
+ldidw 111;
+ldbp 4;
+stdw;
+pop;
+@L26:
+@L24:
+jmp @L2;
+@L27:
+@L28:
+@L29:
+ldidw 0;
+ldiqw errno;
+ldqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 16;
+ldbp 24;
+ldqw;
+ldiqw strtoll;
+call 20;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldiqw errno;
+ldqw;
+lddw;
+ldidw 34;
+eqdw;
+jmpf @L30;
+jmp @L31;
+@L30:
+ldbp 32;
+ldqw;
+ldidw 2147483647;
+dw2qw;
+sletqw;
+jmpf @L32;
+ldbp 8;
+lddw;
+ldidw 84;
+eqdw;
+jmpf @L33;
+ldidw 60;
+jmp @L34;
+@L33:
+ldbp 8;
+lddw;
+ldidw 85;
+eqdw;
+jmpf @L35;
+ldidw 61;
+jmp @L36;
+@L35:
+ldidw 110;
+@L36:
+@L34:
+ldbp 4;
+stdw;
+pop;
+jmp @L37;
+@L32:
+ldbp 32;
+ldqw;
+ldidw -1;
+udw2qw;
+uletqw;
+jmpf @L38;
+ldbp 8;
+lddw;
+ldidw 84;
+eqdw;
+jmpf @L39;
+ldidw 72;
+jmp @L40;
+@L39:
+ldbp 8;
+lddw;
+ldidw 85;
+eqdw;
+jmpf @L41;
+ldidw 109;
+jmp @L42;
+@L41:
+ldidw 111;
+@L42:
+@L40:
+ldbp 4;
+stdw;
+pop;
+jmp @L43;
+@L38:
+ldiqw targeting_arch64;
+lddw;
+jmpf @L44;
+ldidw 61;
+ldbp 4;
+stdw;
+pop;
+jmp @L45;
+@L44:
+ldidw 110;
+ldbp 4;
+stdw;
+pop;
+@L45:
+@L43:
+@L37:
+jmp @L2;
+@L31:
+@L46:
+@L47:
+@L48:
+ldidw 0;
+ldiqw errno;
+ldqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 16;
+ldbp 24;
+ldqw;
+ldiqw strtoull;
+call 20;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldiqw errno;
+ldqw;
+lddw;
+ldidw 34;
+eqdw;
+jmpf @L49;
+ldidw 111;
+ldbp 4;
+stdw;
+pop;
+jmp @L2;
+jmp @L50;
+@L49:
+ldbp 32;
+ldqw;
+ldidw -1;
+udw2qw;
+uletqw;
+jmpf @L51;
+ldbp 8;
+lddw;
+ldidw 87;
+eqdw;
+jmpf @L52;
+ldidw 72;
+jmp @L53;
+@L52:
+ldbp 8;
+lddw;
+ldidw 88;
+eqdw;
+jmpf @L54;
+ldidw 109;
+jmp @L55;
+@L54:
+ldidw 111;
+@L55:
+@L53:
+ldbp 4;
+stdw;
+pop;
+jmp @L56;
+@L51:
+ldiqw targeting_arch64;
+lddw;
+jmpf @L57;
+ldidw 109;
+ldbp 4;
+stdw;
+pop;
+jmp @L58;
+@L57:
+ldidw 111;
+ldbp 4;
+stdw;
+pop;
+@L58:
+@L56:
+@L50:
+jmp @L2;
+@L2:
+.data
+.align 8
+@T1:
+.dword 78
+.dword 12
+.qword @L2
+.qword @L3
+.qword @L4
+.qword @L5
+.qword @L15
+.qword @L16
+.qword @L17
+.qword @L27
+.qword @L28
+.qword @L29
+.qword @L46
+.qword @L47
+.qword @L48
+.text
+ldiqw errno;
+ldqw;
+lddw;
+ldidw 34;
+eqdw;
+jmpf @L59;
+ldiqw @S0;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+@L59:
+ldbp 32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `get_promoted_type' ====
+.text
+get_promoted_type:
+.global get_promoted_type
+addsp 0;         
+# param:`int_ty', offset:-20
+ldbp -20;
+lddw;
+ldiqw @T60;
+switch;
+@L62:
+@L63:
+@L64:
+@L65:
+@L66:
+ldidw 60;
+dw2qw;
+ret;
+@L67:
+ldbp -20;
+lddw;
+dw2qw;
+ret;
+@L61:
+.data
+.align 8
+@T60:
+.dword 6
+.dword 49
+.dword 64
+.dword 106
+.dword 107
+.dword 108
+.qword @L67
+.qword @L62
+.qword @L65
+.qword @L64
+.qword @L63
+.qword @L66
+.text
+ldidw 0;
+ret;
+# ==== start of definition of function `analyze_bitwise_operator' ====
+.text
+analyze_bitwise_operator:
+.global analyze_bitwise_operator
+addsp 8;         
+# param:`e', offset:-24
+# var: ty1, offset: 4
+# var: ty2, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 90;
+eqdw;
+jmpt @L68;
+ldbp 8;
+lddw;
+ldidw 90;
+eqdw;
+jmpt @L68;
+ldidw 0;
+jmp @L69;
+@L68:
+ldidw 1;
+@L69:
+jmpf @L70;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L70:
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpt @L71;
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpt @L71;
+ldidw 0;
+jmp @L72;
+@L71:
+ldidw 1;
+@L72:
+jmpf @L73;
+ldbp -24;
+ldqw;
+ldiqw binary_op_error;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L73:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 18;
+eqdw;
+jmpt @L74;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 19;
+eqdw;
+jmpt @L74;
+ldidw 0;
+jmp @L75;
+@L74:
+ldidw 1;
+@L75:
+jmpf @L76;
+ldbp 4;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L77;
+@L76:
+ldbp 8;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldbp 4;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldiqw get_result_type;
+call 8;
+pop;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L77:
+ldidw 0;
+ret;
+.extern verbose_asm
+.extern is_complete
+.extern cfg_outpath
+# ==== start of definition of function `analyze_unary_expression' ====
+.text
+analyze_unary_expression:
+.global analyze_unary_expression
+addsp 36;        
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T78;
+switch;
+@L80:
+@L81:
+ldbp -24;
+ldqw;
+ldiqw analyze_inc_dec_operator;
+call 8;
+pop;
+pop;
+jmp @L79;
+@L82:
+@L83:
+# var: op, offset: 8
+# var: cat, offset: 16
+# var: ty, offset: 24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L84;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L85;
+@L84:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L85:
+ldbp 24;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldidw 90;
+eqdw;
+jmpf @L86;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L86:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 66;
+eqdw;
+jmpf @L87;
+ldiqw @S1;
+jmp @L88;
+@L87:
+ldiqw @S2;
+@L88:
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L89;
+@L90:
+@L93:
+ldbp 8;
+ldqw;
+ldiqw @S3;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L94:
+ldidw 0;
+jmpf @L95;
+jmp @L93;
+@L95:
+ldiqw 0;
+ret;
+@L91:
+ldidw 0;
+jmpf @L92;
+jmp @L90;
+@L92:
+jmp @L96;
+@L89:
+ldbp 16;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L99;
+ldbp 24;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L99;
+ldidw 1;
+jmp @L100;
+@L99:
+ldidw 0;
+@L100:
+jmpt @L97;
+ldbp 16;
+lddw;
+ldiqw is_struct_union_enum;
+call 4;
+pop;
+jmpf @L101;
+ldbp 24;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw is_complete;
+call 8;
+pop;
+notdw;
+jmpf @L101;
+ldidw 1;
+jmp @L102;
+@L101:
+ldidw 0;
+@L102:
+jmpt @L97;
+ldidw 0;
+jmp @L98;
+@L97:
+ldidw 1;
+@L98:
+jmpf @L103;
+@L104:
+@L107:
+ldbp 8;
+ldqw;
+ldiqw @S4;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L108:
+ldidw 0;
+jmpf @L109;
+jmp @L107;
+@L109:
+ldiqw 0;
+ret;
+@L105:
+ldidw 0;
+jmpf @L106;
+jmp @L104;
+@L106:
+@L103:
+@L96:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldidw 109;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 66;
+eqdw;
+jmpf @L110;
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+jmp @L111;
+@L110:
+ldbp 24;
+ldiqw get_alignment;
+call 8;
+pop;
+@L111:
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L79;
+@L112:
+# var: ty, offset: 4
+# var: temp, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 90;
+eqdw;
+jmpf @L113;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L113:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw is_lvalue;
+call 8;
+pop;
+notdw;
+jmpf @L114;
+ldbp 4;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L114;
+ldidw 1;
+jmp @L115;
+@L114:
+ldidw 0;
+@L115:
+jmpf @L116;
+@L117:
+@L120:
+ldiqw @S5;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L121:
+ldidw 0;
+jmpf @L122;
+jmp @L120;
+@L122:
+ldiqw 0;
+ret;
+@L118:
+ldidw 0;
+jmpf @L119;
+jmp @L117;
+@L119:
+@L116:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L123;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 62;
+eqdw;
+jmpf @L123;
+ldidw 1;
+jmp @L124;
+@L123:
+ldidw 0;
+@L124:
+jmpf @L125;
+@L126:
+@L129:
+ldiqw @S6;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L130:
+ldidw 0;
+jmpf @L131;
+jmp @L129;
+@L131:
+ldiqw 0;
+ret;
+@L127:
+ldidw 0;
+jmpf @L128;
+jmp @L126;
+@L128:
+@L125:
+ldiqw new_type_exp_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 11;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L79;
+@L132:
+# var: ty, offset: 4
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 90;
+eqdw;
+jmpf @L133;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L133:
+ldbp 4;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+notdw;
+jmpf @L134;
+ldbp 4;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L134;
+ldidw 1;
+jmp @L135;
+@L134:
+ldidw 0;
+@L135:
+jmpf @L136;
+@L137:
+@L140:
+ldiqw @S7;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L141:
+ldidw 0;
+jmpf @L142;
+jmp @L140;
+@L142:
+ldiqw 0;
+ret;
+@L138:
+ldidw 0;
+jmpf @L139;
+jmp @L137;
+@L139:
+@L136:
+ldbp 4;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L143;
+# var: ts, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_struct_union_enum;
+call 4;
+pop;
+jmpf @L144;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw is_complete;
+call 8;
+pop;
+notdw;
+jmpf @L144;
+ldidw 1;
+jmp @L145;
+@L144:
+ldidw 0;
+@L145:
+jmpf @L146;
+@L147:
+@L150:
+ldiqw @S8;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L151:
+ldidw 0;
+jmpf @L152;
+jmp @L150;
+@L152:
+ldiqw 0;
+ret;
+@L148:
+ldidw 0;
+jmpf @L149;
+jmp @L147;
+@L149:
+@L146:
+@L143:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L153;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+jmp @L154;
+@L153:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+@L154:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L79;
+@L155:
+@L156:
+@L157:
+# var: ty, offset: 4
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 90;
+eqdw;
+jmpf @L158;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L158:
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpf @L159;
+@L160:
+@L163:
+ldiqw token_table;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S9;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L164:
+ldidw 0;
+jmpf @L165;
+jmp @L163;
+@L165:
+ldiqw 0;
+ret;
+@L161:
+ldidw 0;
+jmpf @L162;
+jmp @L160;
+@L162:
+@L159:
+ldbp 4;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L79;
+@L166:
+# var: ty, offset: 4
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 90;
+eqdw;
+jmpf @L167;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L167:
+ldbp 4;
+lddw;
+ldiqw is_scalar;
+call 4;
+pop;
+notdw;
+jmpf @L170;
+ldbp 4;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L170;
+ldidw 1;
+jmp @L171;
+@L170:
+ldidw 0;
+@L171:
+jmpf @L168;
+ldbp 4;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L168;
+ldidw 1;
+jmp @L169;
+@L168:
+ldidw 0;
+@L169:
+jmpf @L172;
+@L173:
+@L176:
+ldiqw @S10;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L177:
+ldidw 0;
+jmpf @L178;
+jmp @L176;
+@L178:
+ldiqw 0;
+ret;
+@L174:
+ldidw 0;
+jmpf @L175;
+jmp @L173;
+@L175:
+@L172:
+ldidw 60;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L79;
+@L79:
+.data
+.align 8
+@T78:
+.dword 11
+.dword 14
+.dword 15
+.dword 66
+.dword 93
+.dword 95
+.dword 99
+.dword 100
+.dword 101
+.dword 103
+.dword 119
+.qword @L79
+.qword @L157
+.qword @L166
+.qword @L83
+.qword @L80
+.qword @L81
+.qword @L155
+.qword @L156
+.qword @L132
+.qword @L112
+.qword @L82
+.text
+ldidw 0;
+ret;
+.extern target_arch
+.extern emit_warning
+.extern is_struct_union_enum
+# ==== start of definition of function `get_sizeof' ====
+.text
+get_sizeof:
+.global get_sizeof
+addsp 28;        
+# param:`ty', offset:-24
+# var: cat, offset: 4
+# var: size, offset: 8
+# var: nelem, offset: 12
+# var: new_ty, offset: 16
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+ldbp 12;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L179;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L180:
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L183;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L183;
+ldidw 1;
+jmp @L184;
+@L183:
+ldidw 0;
+@L184:
+jmpf @L182;
+ldbp 12;
+lddw;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+muldw;
+ldbp 12;
+stdw;
+pop;
+@L181:
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L180;
+@L182:
+ldbp 16;
+ldbp -24;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L179:
+ldbp 4;
+lddw;
+ldiqw @T185;
+switch;
+@L187:
+@L188:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_struct_descriptor;
+call 8;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+jmp @L186;
+@L189:
+@L190:
+ldidw 8;
+ldbp 8;
+stdw;
+pop;
+jmp @L186;
+@L191:
+@L192:
+@L193:
+ldiqw targeting_arch64;
+lddw;
+jmpf @L194;
+ldidw 8;
+jmp @L195;
+@L194:
+ldidw 4;
+@L195:
+ldbp 8;
+stdw;
+pop;
+jmp @L186;
+@L196:
+@L197:
+@L198:
+ldidw 4;
+ldbp 8;
+stdw;
+pop;
+jmp @L186;
+@L199:
+@L200:
+ldidw 2;
+ldbp 8;
+stdw;
+pop;
+jmp @L186;
+@L201:
+@L202:
+@L203:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L186;
+@L204:
+@L205:
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+jmp @L186;
+@L186:
+.data
+.align 8
+@T185:
+.dword 18
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 68
+.dword 71
+.dword 72
+.dword 73
+.dword 90
+.dword 106
+.dword 107
+.dword 108
+.dword 109
+.dword 110
+.dword 111
+.qword @L186
+.qword @L191
+.qword @L201
+.qword @L196
+.qword @L197
+.qword @L192
+.qword @L199
+.qword @L187
+.qword @L188
+.qword @L198
+.qword @L204
+.qword @L205
+.qword @L202
+.qword @L203
+.qword @L200
+.qword @L193
+.qword @L189
+.qword @L190
+.text
+ldbp 12;
+lddw;
+ldbp 8;
+lddw;
+muldw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern emit_error
+.extern get_curr_scope_id
+.extern getenv
+# ==== start of definition of function `can_assign_to' ====
+.text
+can_assign_to:
+.global can_assign_to
+addsp 44;        
+# param:`dest_ty', offset:-24
+# param:`e', offset:-32
+# var: cat_d, offset: 4
+# var: cat_s, offset: 8
+# var: src_ty, offset: 16
+ldbp -32;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L206;
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L207;
+# var: rank_d, offset: 24
+# var: rank_s, offset: 28
+ldbp -32;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L208;
+# var: val, offset: 32
+# var: final_val, offset: 40
+ldbp -32;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @T209;
+switch;
+@L211:
+@L212:
+ldidw 1;
+dw2qw;
+ret;
+@L213:
+ldiqw targeting_arch64;
+lddw;
+jmpf @L214;
+ldidw 1;
+dw2qw;
+ret;
+@L214:
+@L215:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+sltqw;
+jmpt @L216;
+ldbp 32;
+ldqw;
+ldidw -1;
+udw2qw;
+ugtqw;
+jmpt @L216;
+ldidw 0;
+jmp @L217;
+@L216:
+ldidw 1;
+@L217:
+jmpf @L218;
+ldbp -32;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+udw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L210;
+@L218:
+ldidw 1;
+dw2qw;
+ret;
+@L219:
+ldiqw targeting_arch64;
+lddw;
+jmpf @L220;
+ldidw 1;
+dw2qw;
+ret;
+@L220:
+@L221:
+@L222:
+ldbp 32;
+ldqw;
+ldiqw 2147483648;
+negqw;
+sltqw;
+jmpt @L223;
+ldbp 32;
+ldqw;
+ldidw 2147483647;
+dw2qw;
+sgtqw;
+jmpt @L223;
+ldidw 0;
+jmp @L224;
+@L223:
+ldidw 1;
+@L224:
+jmpf @L225;
+ldbp -32;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+dw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L210;
+@L225:
+ldidw 1;
+dw2qw;
+ret;
+@L226:
+ldbp 32;
+ldqw;
+ldidw 32768;
+negdw;
+dw2qw;
+sltqw;
+jmpt @L227;
+ldbp 32;
+ldqw;
+ldidw 32767;
+dw2qw;
+sgtqw;
+jmpt @L227;
+ldidw 0;
+jmp @L228;
+@L227:
+ldidw 1;
+@L228:
+jmpf @L229;
+ldbp -32;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+dw2w;
+dw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L210;
+@L229:
+ldidw 1;
+dw2qw;
+ret;
+@L230:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+sltqw;
+jmpt @L231;
+ldbp 32;
+ldqw;
+ldidw 65535;
+dw2qw;
+sgtqw;
+jmpt @L231;
+ldidw 0;
+jmp @L232;
+@L231:
+ldidw 1;
+@L232:
+jmpf @L233;
+ldbp -32;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+dw2uw;
+udw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L210;
+@L233:
+ldidw 1;
+dw2qw;
+ret;
+@L234:
+@L235:
+ldbp 32;
+ldqw;
+ldidw 128;
+negdw;
+dw2qw;
+sltqw;
+jmpt @L236;
+ldbp 32;
+ldqw;
+ldidw 127;
+dw2qw;
+sgtqw;
+jmpt @L236;
+ldidw 0;
+jmp @L237;
+@L236:
+ldidw 1;
+@L237:
+jmpf @L238;
+ldbp -32;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+dw2b;
+dw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L210;
+@L238:
+ldidw 1;
+dw2qw;
+ret;
+@L239:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+sltqw;
+jmpt @L240;
+ldbp 32;
+ldqw;
+ldidw 255;
+dw2qw;
+sgtqw;
+jmpt @L240;
+ldidw 0;
+jmp @L241;
+@L240:
+ldidw 1;
+@L241:
+jmpf @L242;
+ldbp -32;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+dw2ub;
+udw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L210;
+@L242:
+ldidw 1;
+dw2qw;
+ret;
+@L243:
+@L244:
+ldidw 0;
+notdw;
+jmpf @L247;
+ldidw 538;
+ldiqw @S11;
+ldiqw @S12;
+ldiqw @S13;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L247:
+@L245:
+ldidw 0;
+jmpf @L246;
+jmp @L244;
+@L246:
+@L210:
+.data
+.align 8
+@T209:
+.dword 13
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.dword 109
+.dword 110
+.dword 111
+.qword @L243
+.qword @L234
+.qword @L222
+.qword @L221
+.qword @L219
+.qword @L226
+.qword @L215
+.qword @L235
+.qword @L239
+.qword @L230
+.qword @L213
+.qword @L212
+.qword @L211
+.text
+ldbp 8;
+lddw;
+ldiqw is_signed_int;
+call 4;
+pop;
+jmpf @L248;
+ldbp 40;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw @S14;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 40;
+pop;
+pop;
+jmp @L249;
+@L248:
+ldbp 40;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw @S15;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 40;
+pop;
+pop;
+@L249:
+ldidw 1;
+dw2qw;
+ret;
+@L208:
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldbp 28;
+stdw;
+pop;
+ldiqw targeting_arch64;
+lddw;
+jmpf @L250;
+ldbp 24;
+lddw;
+ldidw 5;
+eqdw;
+jmpf @L251;
+ldidw 4;
+jmp @L252;
+@L251:
+ldbp 24;
+lddw;
+@L252:
+ldbp 24;
+stdw;
+pop;
+ldbp 28;
+lddw;
+ldidw 5;
+eqdw;
+jmpf @L253;
+ldidw 4;
+jmp @L254;
+@L253:
+ldbp 28;
+lddw;
+@L254:
+ldbp 28;
+stdw;
+pop;
+jmp @L255;
+@L250:
+ldbp 24;
+lddw;
+ldidw 4;
+eqdw;
+jmpf @L256;
+ldidw 3;
+jmp @L257;
+@L256:
+ldbp 24;
+lddw;
+@L257:
+ldbp 24;
+stdw;
+pop;
+ldbp 28;
+lddw;
+ldidw 4;
+eqdw;
+jmpf @L258;
+ldidw 3;
+jmp @L259;
+@L258:
+ldbp 28;
+lddw;
+@L259:
+ldbp 28;
+stdw;
+pop;
+@L255:
+ldbp 28;
+lddw;
+ldbp 24;
+lddw;
+sgtdw;
+jmpf @L260;
+ldiqw token_table;
+ldbp 4;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw token_table;
+ldbp 8;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S16;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 40;
+pop;
+pop;
+jmp @L261;
+@L260:
+ldbp 24;
+lddw;
+ldbp 28;
+lddw;
+eqdw;
+jmpf @L262;
+ldbp 4;
+lddw;
+ldiqw is_signed_int;
+call 4;
+pop;
+ldbp 8;
+lddw;
+ldiqw is_signed_int;
+call 4;
+pop;
+neqdw;
+jmpf @L262;
+ldidw 1;
+jmp @L263;
+@L262:
+ldidw 0;
+@L263:
+jmpf @L264;
+ldiqw token_table;
+ldbp 4;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw token_table;
+ldbp 8;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S17;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 40;
+pop;
+pop;
+@L264:
+@L261:
+jmp @L265;
+@L207:
+ldbp 8;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpt @L266;
+ldbp 8;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L266;
+ldidw 0;
+jmp @L267;
+@L266:
+ldidw 1;
+@L267:
+jmpf @L268;
+ldiqw @S18;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+jmp @L269;
+@L268:
+ldidw 0;
+dw2qw;
+ret;
+@L269:
+@L265:
+jmp @L270;
+@L206:
+ldbp 4;
+lddw;
+ldidw 68;
+eqdw;
+jmpt @L271;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L271;
+ldidw 0;
+jmp @L272;
+@L271:
+ldidw 1;
+@L272:
+jmpf @L273;
+# var: ts_d, offset: 24
+# var: ts_s, offset: 32
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+neqdw;
+jmpf @L274;
+ldidw 0;
+dw2qw;
+ret;
+@L274:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+neqqw;
+jmpf @L275;
+ldidw 0;
+dw2qw;
+ret;
+@L275:
+jmp @L276;
+@L273:
+ldbp 4;
+lddw;
+ldidw 11;
+eqdw;
+jmpf @L277;
+ldbp 8;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpt @L278;
+ldbp 8;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L278;
+ldidw 0;
+jmp @L279;
+@L278:
+ldidw 1;
+@L279:
+jmpf @L280;
+# var: ts_d, offset: 24
+# var: ts_s, offset: 32
+ldidw 0;
+ldidw 0;
+ldbp 8;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L281;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+jmp @L282;
+@L281:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+@L282:
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L283;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+jmp @L284;
+@L283:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+@L284:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw are_compatible;
+call 40;
+pop;
+notdw;
+jmpf @L285;
+ldbp 4;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L288;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L288;
+ldidw 1;
+jmp @L289;
+@L288:
+ldidw 0;
+@L289:
+jmpf @L286;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L286;
+ldidw 1;
+jmp @L287;
+@L286:
+ldidw 0;
+@L287:
+jmpf @L290;
+ldbp 8;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L291;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L293;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L293;
+ldidw 1;
+jmp @L294;
+@L293:
+ldidw 0;
+@L294:
+jmpt @L291;
+ldidw 0;
+jmp @L292;
+@L291:
+ldidw 1;
+@L292:
+jmpf @L295;
+ldiqw @S19;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+ldidw 1;
+dw2qw;
+ret;
+@L295:
+jmp @L296;
+@L290:
+ldbp 8;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L299;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L299;
+ldidw 1;
+jmp @L300;
+@L299:
+ldidw 0;
+@L300:
+jmpf @L297;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L297;
+ldidw 1;
+jmp @L298;
+@L297:
+ldidw 0;
+@L298:
+jmpf @L301;
+ldbp 4;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L302;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L304;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L304;
+ldidw 1;
+jmp @L305;
+@L304:
+ldidw 0;
+@L305:
+jmpt @L302;
+ldidw 0;
+jmp @L303;
+@L302:
+ldidw 1;
+@L303:
+jmpf @L306;
+ldbp -32;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L311;
+ldbp -32;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 105;
+eqdw;
+jmpf @L311;
+ldidw 1;
+jmp @L312;
+@L311:
+ldidw 0;
+@L312:
+jmpf @L309;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L309;
+ldidw 1;
+jmp @L310;
+@L309:
+ldidw 0;
+@L310:
+jmpf @L307;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L307;
+ldidw 1;
+jmp @L308;
+@L307:
+ldidw 0;
+@L308:
+jmpf @L313;
+ldidw 1;
+dw2qw;
+ret;
+@L313:
+ldiqw @S20;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+ldidw 1;
+dw2qw;
+ret;
+@L306:
+jmp @L314;
+@L301:
+ldiqw @S21;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+ldidw 1;
+dw2qw;
+ret;
+@L314:
+@L296:
+@L285:
+ldidw 0;
+dw2qw;
+ldbp 32;
+stqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L315;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L316;
+@L315:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 11;
+eqdw;
+jmpf @L317;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L317:
+@L316:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L318;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L319;
+@L318:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 11;
+eqdw;
+jmpf @L320;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L320:
+@L319:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L321;
+# var: discarded, offset: 40
+ldidw 0;
+dw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+eqdw;
+jmpf @L322;
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L323;
+ldiqw @S22;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L324;
+@L323:
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 50;
+eqdw;
+jmpf @L325;
+ldiqw @S23;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L326;
+@L325:
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 74;
+eqdw;
+jmpf @L327;
+ldiqw @S24;
+ldbp 40;
+stqw;
+pop;
+pop;
+@L327:
+@L326:
+@L324:
+jmp @L328;
+@L322:
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 50;
+eqdw;
+jmpf @L329;
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L330;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 74;
+eqdw;
+jmpt @L330;
+ldidw 0;
+jmp @L331;
+@L330:
+ldidw 1;
+@L331:
+jmpf @L332;
+ldiqw @S25;
+ldbp 40;
+stqw;
+pop;
+pop;
+@L332:
+jmp @L333;
+@L329:
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 74;
+eqdw;
+jmpf @L334;
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L335;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 50;
+eqdw;
+jmpt @L335;
+ldidw 0;
+jmp @L336;
+@L335:
+ldidw 1;
+@L336:
+jmpf @L337;
+ldiqw @S26;
+ldbp 40;
+stqw;
+pop;
+pop;
+@L337:
+@L334:
+@L333:
+@L328:
+ldbp 40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L338;
+ldbp 40;
+ldqw;
+ldiqw @S27;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 32;
+pop;
+pop;
+@L338:
+@L321:
+jmp @L339;
+@L280:
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L340;
+ldbp -32;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L341;
+ldbp -32;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpt @L341;
+ldidw 0;
+jmp @L342;
+@L341:
+ldidw 1;
+@L342:
+jmpf @L343;
+ldiqw @S28;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+@L343:
+jmp @L344;
+@L340:
+ldidw 0;
+dw2qw;
+ret;
+@L344:
+@L339:
+@L277:
+@L276:
+@L270:
+ldidw 1;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern atoi
+# ==== start of definition of function `binary_op_error' ====
+.text
+binary_op_error:
+.global binary_op_error
+addsp 20;        
+# param:`op', offset:-24
+# var: ty1, offset: 8
+# var: ty2, offset: 16
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw stringify_type_exp;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw stringify_type_exp;
+call 12;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L345:
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw token_table;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S29;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 52;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L346:
+ldidw 0;
+jmpf @L347;
+jmp @L345;
+@L347:
+ldbp 8;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern exit
+.extern stderr
+.extern opt_level
+.extern restore_scope
+.extern tolower
+.extern rewind
+# ==== start of definition of function `get_type_node' ====
+.text
+get_type_node:
+.global get_type_node
+addsp 0;         
+# param:`ty', offset:-20
+.data
+.align 8
+@get_type_node_ty_char:
+.align 8
+.align 4
+.dword 49
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.text
+.data
+.align 8
+@get_type_node_ty_int:
+.align 8
+.align 4
+.dword 60
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.text
+.data
+.align 8
+@get_type_node_ty_unsigned:
+.align 8
+.align 4
+.dword 72
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.text
+.data
+.align 8
+@get_type_node_ty_long:
+.align 8
+.align 4
+.dword 61
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.text
+.data
+.align 8
+@get_type_node_ty_unsigned_long:
+.align 8
+.align 4
+.dword 109
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.text
+.data
+.align 8
+@get_type_node_ty_long_long:
+.align 8
+.align 4
+.dword 110
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.text
+.data
+.align 8
+@get_type_node_ty_unsigned_long_long:
+.align 8
+.align 4
+.dword 111
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.text
+.data
+.align 8
+@get_type_node_ty_error:
+.align 8
+.align 4
+.dword 90
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.text
+.data
+.align 8
+@get_type_node_ty_void:
+.align 8
+.align 4
+.dword 73
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.text
+ldbp -20;
+lddw;
+ldiqw @T348;
+switch;
+@L350:
+ldiqw @get_type_node_ty_char;
+ret;
+@L351:
+@L352:
+ldiqw @get_type_node_ty_int;
+ret;
+@L353:
+ldiqw @get_type_node_ty_unsigned;
+ret;
+@L354:
+ldiqw @get_type_node_ty_long;
+ret;
+@L355:
+ldiqw @get_type_node_ty_unsigned_long;
+ret;
+@L356:
+ldiqw @get_type_node_ty_long_long;
+ret;
+@L357:
+ldiqw @get_type_node_ty_unsigned_long_long;
+ret;
+@L358:
+ldiqw @get_type_node_ty_error;
+ret;
+@L359:
+ldiqw @get_type_node_ty_void;
+ret;
+@L349:
+.data
+.align 8
+@T348:
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 72
+.dword 73
+.dword 90
+.dword 109
+.dword 110
+.dword 111
+.qword @L349
+.qword @L350
+.qword @L352
+.qword @L351
+.qword @L354
+.qword @L353
+.qword @L359
+.qword @L358
+.qword @L355
+.qword @L356
+.qword @L357
+.text
+@L360:
+ldidw 0;
+notdw;
+jmpf @L363;
+ldidw 409;
+ldiqw @S30;
+ldiqw @S31;
+ldiqw @S32;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L363:
+@L361:
+ldidw 0;
+jmpf @L362;
+jmp @L360;
+@L362:
+ldidw 0;
+ret;
+# ==== start of definition of function `analyze_logical_operator' ====
+.text
+analyze_logical_operator:
+.global analyze_logical_operator
+addsp 8;         
+# param:`e', offset:-24
+# var: ty1, offset: 4
+# var: ty2, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 90;
+eqdw;
+jmpt @L364;
+ldbp 8;
+lddw;
+ldidw 90;
+eqdw;
+jmpt @L364;
+ldidw 0;
+jmp @L365;
+@L364:
+ldidw 1;
+@L365:
+jmpf @L366;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L366:
+ldbp 4;
+lddw;
+ldiqw is_scalar;
+call 4;
+pop;
+notdw;
+jmpf @L371;
+ldbp 4;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L371;
+ldidw 1;
+jmp @L372;
+@L371:
+ldidw 0;
+@L372:
+jmpf @L369;
+ldbp 4;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L369;
+ldidw 1;
+jmp @L370;
+@L369:
+ldidw 0;
+@L370:
+jmpt @L367;
+ldbp 8;
+lddw;
+ldiqw is_scalar;
+call 4;
+pop;
+notdw;
+jmpf @L375;
+ldbp 8;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L375;
+ldidw 1;
+jmp @L376;
+@L375:
+ldidw 0;
+@L376:
+jmpf @L373;
+ldbp 8;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L373;
+ldidw 1;
+jmp @L374;
+@L373:
+ldidw 0;
+@L374:
+jmpt @L367;
+ldidw 0;
+jmp @L368;
+@L367:
+ldidw 1;
+@L368:
+jmpf @L377;
+ldbp -24;
+ldqw;
+ldiqw binary_op_error;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L377:
+ldidw 60;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern realloc
+.extern lookup_ordinary_id
+.extern snprintf
+.extern strpbrk
+.extern pop_struct_descriptor
+.extern fseek
+.extern islower
+.extern push_struct_descriptor
+.extern sscanf
+.extern fputc
+.extern vsscanf
+.extern fwrite
+# ==== start of definition of function `is_pointer' ====
+.text
+is_pointer:
+.global is_pointer
+addsp 0;         
+# param:`op', offset:-20
+ldbp -20;
+lddw;
+ldidw 11;
+eqdw;
+jmpt @L378;
+ldbp -20;
+lddw;
+ldidw 97;
+eqdw;
+jmpt @L378;
+ldidw 0;
+jmp @L379;
+@L378:
+ldidw 1;
+@L379:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern colored_diagnostics
+.extern read_stream
+.extern strspn
+.extern ispunct
+.extern reset_enum_val
+.extern strtoll
+# ==== start of definition of function `analyze_relational_equality_expression' ====
+.text
+analyze_relational_equality_expression:
+.global analyze_relational_equality_expression
+addsp 28;        
+# param:`e', offset:-24
+# var: ty1, offset: 4
+# var: ty2, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 90;
+eqdw;
+jmpt @L380;
+ldbp 8;
+lddw;
+ldidw 90;
+eqdw;
+jmpt @L380;
+ldidw 0;
+jmp @L381;
+@L380:
+ldidw 1;
+@L381:
+jmpf @L382;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L382:
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L383;
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L384;
+jmp @L385;
+@L384:
+ldbp 8;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpt @L386;
+ldbp 8;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L386;
+ldidw 0;
+jmp @L387;
+@L386:
+ldidw 1;
+@L387:
+jmpf @L388;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 24;
+eqdw;
+jmpt @L393;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 25;
+eqdw;
+jmpt @L393;
+ldidw 0;
+jmp @L394;
+@L393:
+ldidw 1;
+@L394:
+notdw;
+jmpt @L391;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L391;
+ldidw 0;
+jmp @L392;
+@L391:
+ldidw 1;
+@L392:
+jmpt @L389;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpt @L389;
+ldidw 0;
+jmp @L390;
+@L389:
+ldidw 1;
+@L390:
+jmpf @L395;
+ldiqw @S33;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+@L395:
+jmp @L396;
+@L388:
+ldbp -24;
+ldqw;
+ldiqw binary_op_error;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L396:
+@L385:
+jmp @L397;
+@L383:
+ldbp 4;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpt @L398;
+ldbp 4;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L398;
+ldidw 0;
+jmp @L399;
+@L398:
+ldidw 1;
+@L399:
+jmpf @L400;
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L401;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 24;
+eqdw;
+jmpt @L406;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 25;
+eqdw;
+jmpt @L406;
+ldidw 0;
+jmp @L407;
+@L406:
+ldidw 1;
+@L407:
+notdw;
+jmpt @L404;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L404;
+ldidw 0;
+jmp @L405;
+@L404:
+ldidw 1;
+@L405:
+jmpt @L402;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpt @L402;
+ldidw 0;
+jmp @L403;
+@L402:
+ldidw 1;
+@L403:
+jmpf @L408;
+ldiqw @S34;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+@L408:
+jmp @L409;
+@L401:
+ldbp 8;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpt @L410;
+ldbp 8;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L410;
+ldidw 0;
+jmp @L411;
+@L410:
+ldidw 1;
+@L411:
+jmpf @L412;
+# var: p1, offset: 16
+# var: p2, offset: 24
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 24;
+eqdw;
+jmpt @L413;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 25;
+eqdw;
+jmpt @L413;
+ldidw 0;
+jmp @L414;
+@L413:
+ldidw 1;
+@L414:
+jmpf @L415;
+ldbp 4;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L418;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L418;
+ldidw 1;
+jmp @L419;
+@L418:
+ldidw 0;
+@L419:
+jmpf @L416;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L416;
+ldidw 1;
+jmp @L417;
+@L416:
+ldidw 0;
+@L417:
+jmpf @L420;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L425;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 105;
+eqdw;
+jmpf @L425;
+ldidw 1;
+jmp @L426;
+@L425:
+ldidw 0;
+@L426:
+jmpf @L423;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L423;
+ldidw 1;
+jmp @L424;
+@L423:
+ldidw 0;
+@L424:
+jmpf @L421;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L421;
+ldidw 1;
+jmp @L422;
+@L421:
+ldidw 0;
+@L422:
+jmpf @L427;
+jmp @@analyze_relational_equality_expression_done;
+@L427:
+ldbp 8;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L428;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L430;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L430;
+ldidw 1;
+jmp @L431;
+@L430:
+ldidw 0;
+@L431:
+jmpt @L428;
+ldidw 0;
+jmp @L429;
+@L428:
+ldidw 1;
+@L429:
+jmpf @L432;
+ldiqw @S35;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+@L432:
+jmp @@analyze_relational_equality_expression_done;
+jmp @L433;
+@L420:
+ldbp 8;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L436;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L436;
+ldidw 1;
+jmp @L437;
+@L436:
+ldidw 0;
+@L437:
+jmpf @L434;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L434;
+ldidw 1;
+jmp @L435;
+@L434:
+ldidw 0;
+@L435:
+jmpf @L438;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L443;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 105;
+eqdw;
+jmpf @L443;
+ldidw 1;
+jmp @L444;
+@L443:
+ldidw 0;
+@L444:
+jmpf @L441;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L441;
+ldidw 1;
+jmp @L442;
+@L441:
+ldidw 0;
+@L442:
+jmpf @L439;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L439;
+ldidw 1;
+jmp @L440;
+@L439:
+ldidw 0;
+@L440:
+jmpf @L445;
+jmp @@analyze_relational_equality_expression_done;
+@L445:
+ldbp 4;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L446;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L448;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L448;
+ldidw 1;
+jmp @L449;
+@L448:
+ldidw 0;
+@L449:
+jmpt @L446;
+ldidw 0;
+jmp @L447;
+@L446:
+ldidw 1;
+@L447:
+jmpf @L450;
+ldiqw @S36;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+@L450:
+jmp @@analyze_relational_equality_expression_done;
+@L438:
+@L433:
+@L415:
+ldbp 4;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L451;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+jmp @L452;
+@L451:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+@L452:
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L453;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+jmp @L454;
+@L453:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+@L454:
+ldbp 24;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldidw 0;
+ldbp 24;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw are_compatible;
+call 40;
+pop;
+notdw;
+jmpf @L455;
+ldiqw @S37;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+jmp @L456;
+@L455:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 24;
+eqdw;
+jmpt @L461;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 25;
+eqdw;
+jmpt @L461;
+ldidw 0;
+jmp @L462;
+@L461:
+ldidw 1;
+@L462:
+notdw;
+jmpf @L459;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L459;
+ldidw 1;
+jmp @L460;
+@L459:
+ldidw 0;
+@L460:
+jmpf @L457;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L457;
+ldidw 1;
+jmp @L458;
+@L457:
+ldidw 0;
+@L458:
+jmpf @L463;
+ldiqw @S38;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+@L463:
+@L456:
+jmp @L464;
+@L412:
+ldbp -24;
+ldqw;
+ldiqw binary_op_error;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L464:
+@L409:
+jmp @L465;
+@L400:
+ldbp -24;
+ldqw;
+ldiqw binary_op_error;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L465:
+@L397:
+@@analyze_relational_equality_expression_done:
+ldidw 60;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern get_sto_class_spec
+.extern fclose
+.extern preprocess
+.extern analyze_decl_specs
+.extern strstr
+.extern calloc
+.extern pop_scope
+.extern memset
+.extern file_exists
+.extern include_libc
+# ==== start of definition of function `analyze_cast_expression' ====
+.text
+analyze_cast_expression:
+.global analyze_cast_expression
+addsp 8;         
+# param:`e', offset:-24
+# var: ty_src, offset: 4
+# var: ty_tgt, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 90;
+eqdw;
+jmpf @L466;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L466:
+ldbp 4;
+lddw;
+ldiqw is_scalar;
+call 4;
+pop;
+notdw;
+jmpf @L471;
+ldbp 4;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L471;
+ldidw 1;
+jmp @L472;
+@L471:
+ldidw 0;
+@L472:
+jmpf @L469;
+ldbp 4;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L469;
+ldidw 1;
+jmp @L470;
+@L469:
+ldidw 0;
+@L470:
+jmpf @L467;
+ldbp 4;
+lddw;
+ldidw 73;
+neqdw;
+jmpf @L467;
+ldidw 1;
+jmp @L468;
+@L467:
+ldidw 0;
+@L468:
+jmpf @L473;
+@L474:
+@L477:
+ldiqw @S39;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L478:
+ldidw 0;
+jmpf @L479;
+jmp @L477;
+@L479:
+ldiqw 0;
+ret;
+@L475:
+ldidw 0;
+jmpf @L476;
+jmp @L474;
+@L476:
+@L473:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldidw 90;
+eqdw;
+jmpf @L480;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L480:
+ldbp 8;
+lddw;
+ldiqw is_scalar;
+call 4;
+pop;
+notdw;
+jmpf @L481;
+ldbp 8;
+lddw;
+ldidw 73;
+neqdw;
+jmpf @L481;
+ldidw 1;
+jmp @L482;
+@L481:
+ldidw 0;
+@L482:
+jmpf @L483;
+@L484:
+@L487:
+ldiqw @S40;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L488:
+ldidw 0;
+jmpf @L489;
+jmp @L487;
+@L489:
+ldiqw 0;
+ret;
+@L485:
+ldidw 0;
+jmpf @L486;
+jmp @L484;
+@L486:
+@L483:
+ldbp 4;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L490;
+ldbp 8;
+lddw;
+ldidw 73;
+neqdw;
+jmpf @L490;
+ldidw 1;
+jmp @L491;
+@L490:
+ldidw 0;
+@L491:
+jmpf @L492;
+@L493:
+@L496:
+ldiqw @S41;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L497:
+ldidw 0;
+jmpf @L498;
+jmp @L496;
+@L498:
+ldiqw 0;
+ret;
+@L494:
+ldidw 0;
+jmpf @L495;
+jmp @L493;
+@L495:
+@L492:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern stringify_type_exp
+.extern add_quote_dir
+.extern stat_number_of_ast_nodes
+.extern strtoul
+.extern isprint
+.extern fprintf
+.extern get_type_qual
+.extern read_file
+# ==== start of definition of function `is_ptr2obj' ====
+.text
+is_ptr2obj:
+.global is_ptr2obj
+addsp 12;        
+# param:`p', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L499;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L500;
+ldidw 0;
+dw2qw;
+ret;
+@L500:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L501;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L501;
+ldidw 1;
+jmp @L502;
+@L501:
+ldidw 0;
+@L502:
+jmpf @L503;
+ldidw 0;
+dw2qw;
+ret;
+@L503:
+jmp @L504;
+@L499:
+# var: ts, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_struct_union_enum;
+call 4;
+pop;
+jmpf @L507;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw is_complete;
+call 8;
+pop;
+notdw;
+jmpf @L507;
+ldidw 1;
+jmp @L508;
+@L507:
+ldidw 0;
+@L508:
+jmpt @L505;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpt @L505;
+ldidw 0;
+jmp @L506;
+@L505:
+ldidw 1;
+@L506:
+jmpf @L509;
+ldidw 0;
+dw2qw;
+ret;
+@L509:
+@L504:
+ldidw 1;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `is_signed_int' ====
+.text
+is_signed_int:
+.global is_signed_int
+addsp 0;         
+# param:`ty', offset:-20
+ldbp -20;
+lddw;
+ldiqw @T510;
+switch;
+@L512:
+@L513:
+@L514:
+@L515:
+@L516:
+@L517:
+@L518:
+ldidw 1;
+dw2qw;
+ret;
+@L519:
+ldidw 0;
+dw2qw;
+ret;
+@L511:
+.data
+.align 8
+@T510:
+.dword 8
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 106
+.dword 110
+.qword @L519
+.qword @L512
+.qword @L518
+.qword @L515
+.qword @L516
+.qword @L514
+.qword @L513
+.qword @L517
+.text
+ldidw 0;
+ret;
+.extern printf
+.extern get_c_token
+.extern lookup_tag
+# ==== start of definition of function `is_modif_struct_union' ====
+.text
+is_modif_struct_union:
+addsp 44;        
+# param:`type', offset:-24
+# var: d, offset: 8
+# var: dct, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L520:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L522;
+# var: ts, offset: 24
+# var: tq, offset: 32
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L523:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L525;
+# var: p, offset: 40
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L526;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L526;
+ldidw 1;
+jmp @L527;
+@L526:
+ldidw 0;
+@L527:
+jmpf @L528;
+@L529:
+ldbp 40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L532;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L532;
+ldidw 1;
+jmp @L533;
+@L532:
+ldidw 0;
+@L533:
+jmpf @L531;
+@L530:
+ldbp 40;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L529;
+@L531:
+@L528:
+ldbp 40;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L534;
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L535;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 50;
+eqdw;
+jmpt @L537;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+eqdw;
+jmpt @L537;
+ldidw 0;
+jmp @L538;
+@L537:
+ldidw 1;
+@L538:
+jmpf @L535;
+ldidw 1;
+jmp @L536;
+@L535:
+ldidw 0;
+@L536:
+jmpf @L539;
+ldidw 0;
+dw2qw;
+ret;
+jmp @L540;
+@L539:
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 68;
+eqdw;
+jmpt @L541;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L541;
+ldidw 0;
+jmp @L542;
+@L541:
+ldidw 1;
+@L542:
+jmpf @L543;
+ldbp 24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L544;
+ldidw 1;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_tag;
+call 12;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L544:
+ldbp 24;
+ldqw;
+ldiqw is_modif_struct_union;
+call 8;
+pop;
+notdw;
+jmpf @L545;
+ldidw 0;
+dw2qw;
+ret;
+@L545:
+@L543:
+@L540:
+jmp @L546;
+@L534:
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 11;
+eqdw;
+jmpf @L547;
+ldbp 40;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L548;
+ldbp 40;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 50;
+eqdw;
+jmpt @L550;
+ldbp 40;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+eqdw;
+jmpt @L550;
+ldidw 0;
+jmp @L551;
+@L550:
+ldidw 1;
+@L551:
+jmpf @L548;
+ldidw 1;
+jmp @L549;
+@L548:
+ldidw 0;
+@L549:
+jmpf @L552;
+ldidw 0;
+dw2qw;
+ret;
+@L552:
+@L547:
+@L546:
+@L524:
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L523;
+@L525:
+@L521:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L520;
+@L522:
+ldidw 1;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `get_rank' ====
+.text
+get_rank:
+.global get_rank
+addsp 0;         
+# param:`ty', offset:-20
+ldbp -20;
+lddw;
+ldiqw @T553;
+switch;
+@L555:
+@L556:
+ldidw 5;
+dw2qw;
+ret;
+@L557:
+@L558:
+ldidw 4;
+dw2qw;
+ret;
+@L559:
+@L560:
+@L561:
+ldidw 3;
+dw2qw;
+ret;
+@L562:
+@L563:
+ldidw 2;
+dw2qw;
+ret;
+@L564:
+@L565:
+@L566:
+ldidw 1;
+dw2qw;
+ret;
+@L554:
+.data
+.align 8
+@T553:
+.dword 13
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.dword 109
+.dword 110
+.dword 111
+.qword @L554
+.qword @L564
+.qword @L561
+.qword @L559
+.qword @L557
+.qword @L562
+.qword @L560
+.qword @L565
+.qword @L566
+.qword @L563
+.qword @L558
+.qword @L555
+.qword @L556
+.text
+@L567:
+ldidw 0;
+notdw;
+jmpf @L570;
+ldidw 269;
+ldiqw @S42;
+ldiqw @S43;
+ldiqw @S44;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L570:
+@L568:
+ldidw 0;
+jmpf @L569;
+jmp @L567;
+@L569:
+ldidw 0;
+ret;
+# ==== start of definition of function `analyze_inc_dec_operator' ====
+.text
+analyze_inc_dec_operator:
+addsp 4;         
+# param:`e', offset:-24
+# var: ty, offset: 4
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 90;
+eqdw;
+jmpf @L571;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L571:
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpf @L572;
+ldbp 4;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+notdw;
+jmpf @L572;
+ldidw 1;
+jmp @L573;
+@L572:
+ldidw 0;
+@L573:
+jmpf @L574;
+@L575:
+@L578:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 94;
+eqdw;
+jmpt @L583;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 93;
+eqdw;
+jmpt @L583;
+ldidw 0;
+jmp @L584;
+@L583:
+ldidw 1;
+@L584:
+jmpf @L581;
+ldiqw @S45;
+jmp @L582;
+@L581:
+ldiqw @S46;
+@L582:
+ldiqw @S47;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 32;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L579:
+ldidw 0;
+jmpf @L580;
+jmp @L578;
+@L580:
+ldiqw 0;
+ret;
+@L576:
+ldidw 0;
+jmpf @L577;
+jmp @L575;
+@L577:
+@L574:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw is_modif_lvalue;
+call 8;
+pop;
+notdw;
+jmpf @L585;
+@L586:
+@L589:
+ldiqw @S48;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L590:
+ldidw 0;
+jmpf @L591;
+jmp @L589;
+@L591:
+ldiqw 0;
+ret;
+@L587:
+ldidw 0;
+jmpf @L588;
+jmp @L586;
+@L588:
+@L585:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern is_external_id
+.extern isalnum
+.extern sprintf
+.extern errno
+# ==== start of definition of function `is_lvalue' ====
+.text
+is_lvalue:
+addsp 0;         
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L592;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L593;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L593;
+ldidw 1;
+jmp @L594;
+@L593:
+ldidw 0;
+@L594:
+jmpf @L595;
+ldidw 0;
+dw2qw;
+ret;
+@L595:
+ldidw 1;
+dw2qw;
+ret;
+jmp @L596;
+@L592:
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L597;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T598;
+switch;
+@L600:
+@L601:
+@L602:
+ldidw 1;
+dw2qw;
+ret;
+@L603:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw is_lvalue;
+call 8;
+pop;
+dw2qw;
+ret;
+@L604:
+ldidw 0;
+dw2qw;
+ret;
+@L599:
+.data
+.align 8
+@T598:
+.dword 5
+.dword 6
+.dword 7
+.dword 97
+.dword 101
+.qword @L604
+.qword @L603
+.qword @L601
+.qword @L600
+.qword @L602
+.text
+jmp @L605;
+@L597:
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L606;
+ldidw 1;
+dw2qw;
+ret;
+jmp @L607;
+@L606:
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L608;
+ldidw 0;
+dw2qw;
+ret;
+@L608:
+@L607:
+@L605:
+@L596:
+@L609:
+ldidw 0;
+notdw;
+jmpf @L612;
+ldidw 138;
+ldiqw @S49;
+ldiqw @S50;
+ldiqw @S51;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L612:
+@L610:
+ldidw 0;
+jmpf @L611;
+jmp @L609;
+@L611:
+ldidw 0;
+ret;
+.extern isxdigit
+.extern strcat
+.extern are_compatible
+.extern error_count
+.extern free_pre_token
+.extern round_up
+.extern analyze_declarator
+.extern include_liblux
+.extern stat_number_of_pre_tokens
+.extern strchr
+.extern toupper
+.extern add_angle_dir
+# ==== start of definition of function `analyze_conditional_expression' ====
+.text
+analyze_conditional_expression:
+.global analyze_conditional_expression
+addsp 36;        
+# param:`e', offset:-24
+# var: ty1, offset: 4
+# var: ty2, offset: 8
+# var: ty3, offset: 12
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 90;
+eqdw;
+jmpf @L613;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L613:
+ldbp 4;
+lddw;
+ldiqw is_scalar;
+call 4;
+pop;
+notdw;
+jmpf @L616;
+ldbp 4;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L616;
+ldidw 1;
+jmp @L617;
+@L616:
+ldidw 0;
+@L617:
+jmpf @L614;
+ldbp 4;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L614;
+ldidw 1;
+jmp @L615;
+@L614:
+ldidw 0;
+@L615:
+jmpf @L618;
+@L619:
+@L622:
+ldiqw @S52;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L623:
+ldidw 0;
+jmpf @L624;
+jmp @L622;
+@L624:
+ldiqw 0;
+ret;
+@L620:
+ldidw 0;
+jmpf @L621;
+jmp @L619;
+@L621:
+@L618:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldidw 90;
+eqdw;
+jmpt @L625;
+ldbp 12;
+lddw;
+ldidw 90;
+eqdw;
+jmpt @L625;
+ldidw 0;
+jmp @L626;
+@L625:
+ldidw 1;
+@L626:
+jmpf @L627;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L627:
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L628;
+ldbp 12;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L629;
+ldbp 12;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldbp 8;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldiqw get_result_type;
+call 8;
+pop;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L630;
+@L629:
+ldbp 12;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpt @L631;
+ldbp 12;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L631;
+ldidw 0;
+jmp @L632;
+@L631:
+ldidw 1;
+@L632:
+jmpf @L633;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L634;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpt @L634;
+ldidw 0;
+jmp @L635;
+@L634:
+ldidw 1;
+@L635:
+jmpf @L636;
+ldiqw @S53;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+@L636:
+jmp @L637;
+@L633:
+jmp @@analyze_conditional_expression_type_mismatch;
+@L637:
+@L630:
+jmp @L638;
+@L628:
+ldbp 8;
+lddw;
+ldidw 68;
+eqdw;
+jmpt @L639;
+ldbp 8;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L639;
+ldidw 0;
+jmp @L640;
+@L639:
+ldidw 1;
+@L640:
+jmpf @L641;
+# var: ts2, offset: 16
+# var: ts3, offset: 24
+ldbp 12;
+lddw;
+ldbp 8;
+lddw;
+neqdw;
+jmpf @L642;
+jmp @@analyze_conditional_expression_type_mismatch;
+@L642:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+neqqw;
+jmpf @L643;
+jmp @@analyze_conditional_expression_type_mismatch;
+@L643:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @L644;
+@L641:
+ldbp 8;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpt @L645;
+ldbp 8;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L645;
+ldidw 0;
+jmp @L646;
+@L645:
+ldidw 1;
+@L646:
+jmpf @L647;
+ldbp 12;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L648;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L649;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpt @L649;
+ldidw 0;
+jmp @L650;
+@L649:
+ldidw 1;
+@L650:
+jmpf @L651;
+ldiqw @S54;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+@L651:
+jmp @L652;
+@L648:
+ldbp 12;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpt @L653;
+ldbp 12;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L653;
+ldidw 0;
+jmp @L654;
+@L653:
+ldidw 1;
+@L654:
+jmpf @L655;
+ldidw 0;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw are_compatible;
+call 40;
+pop;
+notdw;
+jmpf @L656;
+# var: iv, offset: 16
+# var: inv, offset: 20
+# var: tq1, offset: 24
+# var: tq2, offset: 32
+ldbp 8;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L659;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L659;
+ldidw 1;
+jmp @L660;
+@L659:
+ldidw 0;
+@L660:
+jmpf @L657;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L657;
+ldidw 1;
+jmp @L658;
+@L657:
+ldidw 0;
+@L658:
+jmpf @L661;
+ldbp 12;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L662;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L664;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L664;
+ldidw 1;
+jmp @L665;
+@L664:
+ldidw 0;
+@L665:
+jmpt @L662;
+ldidw 0;
+jmp @L663;
+@L662:
+ldidw 1;
+@L663:
+jmpf @L666;
+ldiqw @S55;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @@analyze_conditional_expression_done;
+jmp @L667;
+@L666:
+ldidw 1;
+ldbp 16;
+stdw;
+pop;
+ldidw 2;
+ldbp 20;
+stdw;
+pop;
+@L667:
+jmp @L668;
+@L661:
+ldbp 12;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L671;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L671;
+ldidw 1;
+jmp @L672;
+@L671:
+ldidw 0;
+@L672:
+jmpf @L669;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L669;
+ldidw 1;
+jmp @L670;
+@L669:
+ldidw 0;
+@L670:
+jmpf @L673;
+ldbp 8;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L674;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L676;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L676;
+ldidw 1;
+jmp @L677;
+@L676:
+ldidw 0;
+@L677:
+jmpt @L674;
+ldidw 0;
+jmp @L675;
+@L674:
+ldidw 1;
+@L675:
+jmpf @L678;
+ldiqw @S56;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @@analyze_conditional_expression_done;
+jmp @L679;
+@L678:
+ldidw 2;
+ldbp 16;
+stdw;
+pop;
+ldidw 1;
+ldbp 20;
+stdw;
+pop;
+@L679:
+jmp @L680;
+@L673:
+ldiqw @S57;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 24;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @@analyze_conditional_expression_done;
+@L680:
+@L668:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L681;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 11;
+eqdw;
+jmpt @L681;
+ldidw 0;
+jmp @L682;
+@L681:
+ldidw 1;
+@L682:
+jmpf @L683;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L684;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L685;
+@L684:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L685:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L686;
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L687;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @L688;
+@L687:
+ldiqw new_type_exp_node;
+call 0;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L688:
+jmp @L689;
+@L686:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L690;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @L691;
+@L690:
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+eqdw;
+jmpt @L692;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+eqdw;
+jmpt @L692;
+ldidw 0;
+jmp @L693;
+@L692:
+ldidw 1;
+@L693:
+jmpf @L694;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @L695;
+@L694:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw dup_decl_specs;
+call 8;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 112;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L695:
+@L691:
+@L689:
+jmp @L696;
+@L683:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+@L696:
+jmp @L697;
+@L656:
+# var: tq1, offset: 16
+# var: tq2, offset: 24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L698;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L699;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @L700;
+@L699:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L701;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @L702;
+@L701:
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+eqdw;
+jmpt @L703;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+eqdw;
+jmpt @L703;
+ldidw 0;
+jmp @L704;
+@L703:
+ldidw 1;
+@L704:
+jmpf @L705;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @L706;
+@L705:
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+eqdw;
+jmpf @L707;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @L708;
+@L707:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw dup_decl_specs;
+call 8;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 112;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L708:
+@L706:
+@L702:
+@L700:
+jmp @L709;
+@L698:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 11;
+eqdw;
+jmpf @L710;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L711;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @L712;
+@L711:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L713;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @L714;
+@L713:
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+eqdw;
+jmpt @L715;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+eqdw;
+jmpt @L715;
+ldidw 0;
+jmp @L716;
+@L715:
+ldidw 1;
+@L716:
+jmpf @L717;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @L718;
+@L717:
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+eqdw;
+jmpf @L719;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @L720;
+@L719:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw dup_declarator;
+call 8;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw new_type_exp_node;
+call 0;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 112;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L720:
+@L718:
+@L714:
+@L712:
+jmp @L721;
+@L710:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+@L721:
+@L709:
+@L697:
+jmp @L722;
+@L655:
+jmp @@analyze_conditional_expression_type_mismatch;
+@L722:
+@L652:
+jmp @L723;
+@L647:
+ldbp 8;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L724;
+ldbp 12;
+lddw;
+ldidw 73;
+neqdw;
+jmpf @L725;
+jmp @@analyze_conditional_expression_type_mismatch;
+@L725:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+@L724:
+@L723:
+@L644:
+@L638:
+@@analyze_conditional_expression_done:
+ldiqw 0;
+ret;
+@@analyze_conditional_expression_type_mismatch:
+# var: ty1, offset: 16
+# var: ty2, offset: 24
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw stringify_type_exp;
+call 12;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw stringify_type_exp;
+call 12;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L726:
+ldbp 24;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw @S58;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 44;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L727:
+ldidw 0;
+jmpf @L728;
+jmp @L726;
+@L728:
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern ic_outpath
+.extern stdout
+# ==== start of definition of function `get_type_category' ====
+.text
+get_type_category:
+.global get_type_category
+addsp 0;         
+# param:`d', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 90;
+eqdw;
+jmpf @L729;
+ldidw 90;
+dw2qw;
+ret;
+@L729:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L730;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+dw2qw;
+ret;
+jmp @L731;
+@L730:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+dw2qw;
+ret;
+@L731:
+ldidw 0;
+ret;
+.extern ilog2
+.extern strcmp
+.extern strtok
+.extern strtol
+.extern parse_header
+# ==== start of definition of function `is_modif_lvalue' ====
+.text
+is_modif_lvalue:
+.global is_modif_lvalue
+addsp 20;        
+# param:`e', offset:-24
+# var: ty, offset: 4
+ldbp -24;
+ldqw;
+ldiqw is_lvalue;
+call 8;
+pop;
+notdw;
+jmpf @L732;
+ldidw 0;
+dw2qw;
+ret;
+@L732:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L733;
+ldidw 0;
+dw2qw;
+ret;
+jmp @L734;
+@L733:
+ldbp 4;
+lddw;
+ldidw 11;
+eqdw;
+jmpf @L735;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L736;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 50;
+eqdw;
+jmpt @L738;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+eqdw;
+jmpt @L738;
+ldidw 0;
+jmp @L739;
+@L738:
+ldidw 1;
+@L739:
+jmpf @L736;
+ldidw 1;
+jmp @L737;
+@L736:
+ldidw 0;
+@L737:
+jmpf @L740;
+ldidw 0;
+dw2qw;
+ret;
+@L740:
+jmp @L741;
+@L735:
+ldbp 4;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L742;
+ldidw 0;
+dw2qw;
+ret;
+jmp @L743;
+@L742:
+# var: tq, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L744;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 50;
+eqdw;
+jmpt @L746;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+eqdw;
+jmpt @L746;
+ldidw 0;
+jmp @L747;
+@L746:
+ldidw 1;
+@L747:
+jmpf @L744;
+ldidw 1;
+jmp @L745;
+@L744:
+ldidw 0;
+@L745:
+jmpf @L748;
+ldidw 0;
+dw2qw;
+ret;
+@L748:
+ldbp 4;
+lddw;
+ldidw 68;
+eqdw;
+jmpt @L751;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L751;
+ldidw 0;
+jmp @L752;
+@L751:
+ldidw 1;
+@L752:
+jmpt @L749;
+ldbp 4;
+lddw;
+ldidw 55;
+eqdw;
+jmpt @L749;
+ldidw 0;
+jmp @L750;
+@L749:
+ldidw 1;
+@L750:
+jmpf @L753;
+# var: ts, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw is_complete;
+call 8;
+pop;
+notdw;
+jmpf @L754;
+ldidw 0;
+dw2qw;
+ret;
+@L754:
+ldbp 4;
+lddw;
+ldidw 55;
+neqdw;
+jmpf @L755;
+ldbp 16;
+ldqw;
+ldiqw is_modif_struct_union;
+call 8;
+pop;
+notdw;
+jmpf @L755;
+ldidw 1;
+jmp @L756;
+@L755:
+ldidw 0;
+@L756:
+jmpf @L757;
+ldidw 0;
+dw2qw;
+ret;
+@L757:
+@L753:
+@L743:
+@L741:
+@L734:
+ldidw 1;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern stdin
+# ==== start of definition of function `is_integer' ====
+.text
+is_integer:
+.global is_integer
+addsp 0;         
+# param:`ty', offset:-20
+ldbp -20;
+lddw;
+ldiqw @T758;
+switch;
+@L760:
+@L761:
+@L762:
+@L763:
+@L764:
+@L765:
+@L766:
+@L767:
+@L768:
+@L769:
+@L770:
+@L771:
+ldidw 1;
+dw2qw;
+ret;
+@L772:
+ldidw 0;
+dw2qw;
+ret;
+@L759:
+.data
+.align 8
+@T758:
+.dword 13
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.dword 109
+.dword 110
+.dword 111
+.qword @L772
+.qword @L768
+.qword @L771
+.qword @L764
+.qword @L762
+.qword @L766
+.qword @L765
+.qword @L769
+.qword @L770
+.qword @L767
+.qword @L763
+.qword @L760
+.qword @L761
+.text
+ldidw 0;
+ret;
+# ==== start of definition of function `analyze_postfix_expression' ====
+.text
+analyze_postfix_expression:
+.global analyze_postfix_expression
+addsp 76;        
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T773;
+switch;
+@L775:
+# var: ch_idx, offset: 4
+# var: ty1, offset: 8
+# var: ty2, offset: 12
+# var: ptr_operand, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldidw 90;
+eqdw;
+jmpf @L776;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L776:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldidw 90;
+eqdw;
+jmpf @L777;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L777:
+ldbp 8;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpf @L778;
+ldbp 12;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpf @L779;
+jmp @@analyze_postfix_expression_non_int_sub;
+@L779:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+jmp @L780;
+@L778:
+ldbp 12;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpf @L781;
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpf @L782;
+jmp @@analyze_postfix_expression_non_int_sub;
+@L782:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+jmp @L783;
+@L781:
+@L784:
+@L787:
+ldiqw @S59;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L788:
+ldidw 0;
+jmpf @L789;
+jmp @L787;
+@L789:
+ldiqw 0;
+ret;
+@L785:
+ldidw 0;
+jmpf @L786;
+jmp @L784;
+@L786:
+@L783:
+@L780:
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L790;
+# var: ts, offset: 24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_struct_union_enum;
+call 4;
+pop;
+jmpf @L791;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw is_complete;
+call 8;
+pop;
+notdw;
+jmpf @L791;
+ldidw 1;
+jmp @L792;
+@L791:
+ldidw 0;
+@L792:
+jmpf @L793;
+jmp @@analyze_postfix_expression_subs_incomp;
+@L793:
+jmp @L794;
+@L790:
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L795;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L795;
+ldidw 1;
+jmp @L796;
+@L795:
+ldidw 0;
+@L796:
+jmpf @L797;
+jmp @@analyze_postfix_expression_subs_incomp;
+jmp @L798;
+@L797:
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L799;
+@L800:
+@L803:
+ldiqw @S60;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L804:
+ldidw 0;
+jmpf @L805;
+jmp @L803;
+@L805:
+ldiqw 0;
+ret;
+@L801:
+ldidw 0;
+jmpf @L802;
+jmp @L800;
+@L802:
+@L799:
+@L798:
+@L794:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L774;
+@@analyze_postfix_expression_non_int_sub:
+@L806:
+@L809:
+ldiqw @S61;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L810:
+ldidw 0;
+jmpf @L811;
+jmp @L809;
+@L811:
+ldiqw 0;
+ret;
+@L807:
+ldidw 0;
+jmpf @L808;
+jmp @L806;
+@L808:
+@@analyze_postfix_expression_subs_incomp:
+@L812:
+@L815:
+ldiqw @S62;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L816:
+ldidw 0;
+jmpf @L817;
+jmp @L815;
+@L817:
+ldiqw 0;
+ret;
+@L813:
+ldidw 0;
+jmpf @L814;
+jmp @L812;
+@L814:
+@L818:
+# var: n, offset: 4
+# var: p, offset: 8
+# var: a, offset: 16
+# var: ty, offset: 24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 90;
+eqdw;
+jmpf @L819;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L819:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L820;
+jmp @@analyze_postfix_expression_non_callable;
+jmp @L821;
+@L820:
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L822;
+jmp @L823;
+@L822:
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 11;
+eqdw;
+jmpf @L826;
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L826;
+ldidw 1;
+jmp @L827;
+@L826:
+ldidw 0;
+@L827:
+jmpf @L824;
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L824;
+ldidw 1;
+jmp @L825;
+@L824:
+ldidw 0;
+@L825:
+jmpf @L828;
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L829;
+@L828:
+jmp @@analyze_postfix_expression_non_callable;
+@L829:
+@L823:
+@L821:
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L830;
+# var: ts, offset: 32
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_struct_union_enum;
+call 4;
+pop;
+jmpf @L831;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw is_complete;
+call 8;
+pop;
+notdw;
+jmpf @L831;
+ldidw 1;
+jmp @L832;
+@L831:
+ldidw 0;
+@L832:
+jmpf @L833;
+@L834:
+@L837:
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw token_table;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S63;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 44;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L838:
+ldidw 0;
+jmpf @L839;
+jmp @L837;
+@L839:
+ldiqw 0;
+ret;
+@L835:
+ldidw 0;
+jmpf @L836;
+jmp @L834;
+@L836:
+@L833:
+@L830:
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L840;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L840;
+ldidw 1;
+jmp @L841;
+@L840:
+ldidw 0;
+@L841:
+jmpf @L842;
+ldidw 0;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L842:
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L843:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L845;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L845;
+ldidw 1;
+jmp @L846;
+@L845:
+ldidw 0;
+@L846:
+jmpf @L844;
+# var: p_ty, offset: 32
+ldbp 16;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 90;
+eqdw;
+jmpf @L847;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L847:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L848;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpf @L848;
+ldidw 1;
+jmp @L849;
+@L848:
+ldidw 0;
+@L849:
+jmpf @L850;
+jmp @L844;
+@L850:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 32;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L853;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+eqdw;
+jmpf @L853;
+ldidw 1;
+jmp @L854;
+@L853:
+ldidw 0;
+@L854:
+jmpf @L851;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+jmp @L852;
+@L851:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+@L852:
+ldbp 32;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 32;
+ldiqw can_assign_to;
+call 16;
+pop;
+notdw;
+jmpf @L855;
+# var: ty1, offset: 48
+# var: ty2, offset: 56
+ldidw 1;
+ldbp 32;
+ldiqw stringify_type_exp;
+call 12;
+ldbp 48;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp 16;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw stringify_type_exp;
+call 12;
+ldbp 56;
+stqw;
+pop;
+pop;
+ldbp 56;
+ldqw;
+ldbp 48;
+ldqw;
+ldbp 4;
+lddw;
+ldiqw @S64;
+ldbp 16;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 48;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 56;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+@L855:
+incldw 4;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L843;
+@L844:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpt @L856;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpt @L856;
+ldidw 0;
+jmp @L857;
+@L856:
+ldidw 1;
+@L857:
+jmpf @L858;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L861;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L861;
+ldidw 1;
+jmp @L862;
+@L861:
+ldidw 0;
+@L862:
+jmpf @L859;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpf @L859;
+ldidw 1;
+jmp @L860;
+@L859:
+ldidw 0;
+@L860:
+jmpf @L863;
+jmp @L864;
+@L863:
+@L865:
+@L868:
+ldiqw @S65;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L869:
+ldidw 0;
+jmpf @L870;
+jmp @L868;
+@L870:
+ldiqw 0;
+ret;
+@L866:
+ldidw 0;
+jmpf @L867;
+jmp @L865;
+@L867:
+@L864:
+@L858:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L774;
+@@analyze_postfix_expression_non_callable:
+@L871:
+@L874:
+ldiqw @S66;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L875:
+ldidw 0;
+jmpf @L876;
+jmp @L874;
+@L876:
+ldiqw 0;
+ret;
+@L872:
+ldidw 0;
+jmpf @L873;
+jmp @L871;
+@L873:
+@L877:
+@L878:
+# var: id, offset: 8
+# var: d, offset: 16
+# var: ts, offset: 24
+# var: tq_l, offset: 32
+# var: tq_r, offset: 40
+# var: dct, offset: 48
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 90;
+eqdw;
+jmpf @L879;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L879:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 68;
+neqdw;
+jmpf @L880;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+neqdw;
+jmpf @L880;
+ldidw 1;
+jmp @L881;
+@L880:
+ldidw 0;
+@L881:
+jmpf @L882;
+@L883:
+@L886:
+ldiqw token_table;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S67;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L887:
+ldidw 0;
+jmpf @L888;
+jmp @L886;
+@L888:
+ldiqw 0;
+ret;
+@L884:
+ldidw 0;
+jmpf @L885;
+jmp @L883;
+@L885:
+@L882:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 6;
+eqdw;
+jmpf @L889;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L890;
+@L891:
+@L894:
+ldiqw @S68;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L895:
+ldidw 0;
+jmpf @L896;
+jmp @L894;
+@L896:
+ldiqw 0;
+ret;
+@L892:
+ldidw 0;
+jmpf @L893;
+jmp @L891;
+@L893:
+@L890:
+jmp @L897;
+@L889:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L898;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+notdw;
+jmpt @L898;
+ldidw 0;
+jmp @L899;
+@L898:
+ldidw 1;
+@L899:
+jmpf @L900;
+@L901:
+@L904:
+ldiqw @S69;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L905:
+ldidw 0;
+jmpf @L906;
+jmp @L904;
+@L906:
+ldiqw 0;
+ret;
+@L902:
+ldidw 0;
+jmpf @L903;
+jmp @L901;
+@L903:
+@L900:
+@L897:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L907;
+# var: np, offset: 56
+ldidw 1;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_tag;
+call 12;
+ldbp 56;
+stqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L908;
+@L909:
+@L912:
+ldiqw token_table;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S70;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L913:
+ldidw 0;
+jmpf @L914;
+jmp @L912;
+@L914:
+ldiqw 0;
+ret;
+@L910:
+ldidw 0;
+jmpf @L911;
+jmp @L909;
+@L911:
+@L908:
+ldbp 56;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+@L907:
+ldbp 24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L915:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L917;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 48;
+stqw;
+pop;
+pop;
+@L918:
+ldbp 48;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L920;
+ldbp 48;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L921;
+jmp @@analyze_postfix_expression_mem_found;
+@L921:
+@L919:
+ldbp 48;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 48;
+stqw;
+pop;
+pop;
+jmp @L918;
+@L920:
+@L916:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L915;
+@L917:
+@L922:
+@L925:
+ldbp 8;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw token_table;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S71;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 52;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L926:
+ldidw 0;
+jmpf @L927;
+jmp @L925;
+@L927:
+ldiqw 0;
+ret;
+@L923:
+ldidw 0;
+jmpf @L924;
+jmp @L922;
+@L924:
+@@analyze_postfix_expression_mem_found:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldbp 32;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L928;
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L929;
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 11;
+eqdw;
+jmpf @L930;
+# var: new_ptr_node, offset: 56
+ldiqw new_type_exp_node;
+call 0;
+ldbp 56;
+stqw;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 56;
+ldqw;
+swap2;
+memcpy 48;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L931;
+ldbp 32;
+ldqw;
+ldbp 56;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L932;
+@L931:
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+neqdw;
+jmpf @L933;
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+neqdw;
+jmpf @L933;
+ldidw 1;
+jmp @L934;
+@L933:
+ldidw 0;
+@L934:
+jmpf @L935;
+ldiqw new_type_exp_node;
+call 0;
+ldbp 56;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 112;
+ldbp 56;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L935:
+@L932:
+ldbp 56;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L936;
+@L930:
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L937;
+# var: n, offset: 56
+# var: p, offset: 64
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 56;
+stdw;
+pop;
+@L938:
+ldbp 64;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L941;
+ldbp 64;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L941;
+ldidw 1;
+jmp @L942;
+@L941:
+ldidw 0;
+@L942:
+jmpf @L940;
+@L939:
+ldbp 64;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+ldbp 56;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+pop;
+jmp @L938;
+@L940:
+ldbp 64;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L943;
+# var: new_dct_list, offset: 72
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw dup_declarator;
+call 8;
+ldbp 72;
+stqw;
+pop;
+pop;
+ldbp 64;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L944;
+ldbp 72;
+ldqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+@L945:
+ldbp 56;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L947;
+@L946:
+ldbp 64;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+ldbp 56;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+jmp @L945;
+@L947:
+ldbp 32;
+ldqw;
+ldbp 64;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L948;
+@L944:
+ldbp 64;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+neqdw;
+jmpf @L949;
+ldbp 64;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+neqdw;
+jmpf @L949;
+ldidw 1;
+jmp @L950;
+@L949:
+ldidw 0;
+@L950:
+jmpf @L951;
+ldbp 72;
+ldqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+@L952:
+ldbp 56;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L954;
+@L953:
+ldbp 64;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+ldbp 56;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+jmp @L952;
+@L954:
+ldiqw new_type_exp_node;
+call 0;
+ldbp 64;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 112;
+ldbp 64;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L951:
+@L948:
+ldbp 72;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L955;
+@L943:
+jmp @@analyze_postfix_expression_decl_specs_qualif;
+@L955:
+@L937:
+@L936:
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L956;
+@L929:
+@@analyze_postfix_expression_decl_specs_qualif:
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldbp 40;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L957;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+neqdw;
+jmpf @L958;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+neqdw;
+jmpf @L958;
+ldidw 1;
+jmp @L959;
+@L958:
+ldidw 0;
+@L959:
+jmpf @L960;
+ldiqw new_type_exp_node;
+call 0;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldidw 112;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw new_type_exp_node;
+call 0;
+ldbp 40;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 40;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+swap2;
+memcpy 48;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 40;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+@L960:
+jmp @L961;
+@L957:
+ldiqw new_type_exp_node;
+call 0;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 40;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+@L961:
+ldbp 40;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L956:
+jmp @L962;
+@L928:
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L962:
+jmp @L774;
+@L963:
+@L964:
+ldbp -24;
+ldqw;
+ldiqw analyze_inc_dec_operator;
+call 8;
+pop;
+pop;
+jmp @L774;
+@L774:
+.data
+.align 8
+@T773:
+.dword 7
+.dword 6
+.dword 7
+.dword 94
+.dword 96
+.dword 97
+.dword 98
+.qword @L774
+.qword @L877
+.qword @L878
+.qword @L963
+.qword @L964
+.qword @L775
+.qword @L818
+.text
+ldidw 0;
+ret;
+.extern ftell
+.extern strcpy
+.extern install_tag
+.extern ic_function_to_print
+.extern isupper
+.extern strtoull
+.extern strlen
+.extern token_table
+# ==== start of definition of function `analyze_expression' ====
+.text
+analyze_expression:
+.global analyze_expression
+addsp 0;         
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 90;
+eqdw;
+jmpt @L965;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 90;
+eqdw;
+jmpt @L965;
+ldidw 0;
+jmp @L966;
+@L965:
+ldidw 1;
+@L966:
+jmpf @L967;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L967:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern memchr
+.extern new_type_exp_node
+# ==== start of definition of function `analyze_primary_expression' ====
+.text
+analyze_primary_expression:
+.global analyze_primary_expression
+addsp 0;         
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T968;
+jmptab;
+@L970:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L971;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 113;
+eqdw;
+jmpf @L971;
+ldidw 1;
+jmp @L972;
+@L971:
+ldidw 0;
+@L972:
+jmpf @L973;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L973:
+jmp @L969;
+@L974:
+ldbp -24;
+ldqw;
+ldiqw analyze_iconst;
+call 8;
+pop;
+pop;
+jmp @L969;
+@L975:
+ldidw 49;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw new_type_exp_node;
+call 0;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 97;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw new_exec_node;
+call 0;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L969;
+@L969:
+.data
+.align 8
+@T968:
+.dword 1
+.dword 3
+.qword @L969
+.qword @L974
+.qword @L975
+.qword @L970
+.text
+ldidw 0;
+ret;
+.extern dup_decl_specs
+.extern new_declaration_node
+.extern vfprintf
+# ==== start of definition of function `eval_const_expr' ====
+.text
+eval_const_expr:
+.global eval_const_expr
+addsp 60;        
+# param:`e', offset:-24
+# param:`is_addr', offset:-28
+# param:`is_iconst', offset:-32
+# var: resL, offset: 8
+# var: resR, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T976;
+jmptab;
+@L978:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T979;
+switch;
+@L981:
+# var: pi, offset: 24
+# var: ii, offset: 28
+# var: indx, offset: 32
+# var: ptr, offset: 40
+ldbp -32;
+lddw;
+jmpf @L982;
+jmp @L980;
+@L982:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L983;
+ldidw 1;
+ldbp 24;
+stdw;
+pop;
+ldidw 0;
+ldbp 28;
+stdw;
+pop;
+jmp @L984;
+@L983:
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+ldidw 1;
+ldbp 28;
+stdw;
+pop;
+@L984:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 28;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 28;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L985;
+jmp @L980;
+@L985:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L986;
+# var: ty, offset: 48
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 48;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 48;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldbp 32;
+ldqw;
+ldbp 48;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+mulqw;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L987;
+@L986:
+ldbp 40;
+ldqw;
+ret;
+@L987:
+@L988:
+@L989:
+ldbp -32;
+lddw;
+jmpf @L990;
+jmp @L980;
+@L990:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L991;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 71;
+neqdw;
+jmpf @L992;
+# var: m, offset: 24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw get_member_descriptor;
+call 16;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L993;
+@L992:
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L993:
+jmp @L994;
+@L991:
+ldbp 8;
+ldqw;
+ret;
+@L994:
+@L995:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L996;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L997;
+@L996:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L997:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L998:
+ldbp -32;
+lddw;
+jmpf @L999;
+jmp @L980;
+@L999:
+ldbp -32;
+lddw;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1000;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1001;
+@L1000:
+ldbp 8;
+ldqw;
+ret;
+@L1001:
+@L1002:
+ldbp -32;
+lddw;
+jmpf @L1003;
+jmp @L980;
+@L1003:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1004;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1005;
+@L1004:
+ldbp 8;
+ldqw;
+ret;
+@L1005:
+@L1006:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L1007;
+jmp @L980;
+@L1007:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1008:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L1009;
+jmp @L980;
+@L1009:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+negqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1010:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L1011;
+jmp @L980;
+@L1011:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+cmplqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1012:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L1013;
+jmp @L980;
+@L1013:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+notqw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1014:
+# var: dest_ty, offset: 24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp -32;
+lddw;
+jmpf @L1015;
+ldbp 24;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpf @L1015;
+ldidw 1;
+jmp @L1016;
+@L1015:
+ldidw 0;
+@L1016:
+jmpf @L1017;
+jmp @L980;
+@L1017:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1018;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldiqw @T1019;
+switch;
+@L1021:
+ldbp 8;
+ldqw;
+pop;
+dw2w;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1022:
+ldbp 8;
+ldqw;
+pop;
+dw2uw;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1023:
+@L1024:
+ldbp 8;
+ldqw;
+pop;
+dw2b;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1025:
+ldbp 8;
+ldqw;
+pop;
+dw2ub;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1026:
+@L1027:
+ldbp 8;
+ldqw;
+pop;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1028:
+@L1029:
+ldbp 8;
+ldqw;
+pop;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1030:
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1020:
+.data
+.align 8
+@T1019:
+.dword 10
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 64
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.qword @L1030
+.qword @L1029
+.qword @L1023
+.qword @L1027
+.qword @L1026
+.qword @L1021
+.qword @L1028
+.qword @L1024
+.qword @L1025
+.qword @L1022
+.text
+jmp @L1031;
+@L1018:
+ldbp 24;
+lddw;
+ldiqw @T1032;
+switch;
+@L1034:
+@L1035:
+@L1036:
+@L1037:
+@L1038:
+jmp @@eval_const_expr_err;
+@L1039:
+@L1040:
+ldiqw targeting_arch64;
+lddw;
+jmpf @L1041;
+jmp @@eval_const_expr_err;
+@L1041:
+jmp @L1033;
+@L1033:
+.data
+.align 8
+@T1032:
+.dword 8
+.dword 49
+.dword 60
+.dword 64
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.qword @L1033
+.qword @L1036
+.qword @L1039
+.qword @L1034
+.qword @L1040
+.qword @L1037
+.qword @L1038
+.qword @L1035
+.text
+ldbp 8;
+ldqw;
+ret;
+@@eval_const_expr_err:
+jmp @L980;
+@L1031:
+@L1042:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1043;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1043;
+ldidw 0;
+jmp @L1044;
+@L1043:
+ldidw 1;
+@L1044:
+jmpf @L1045;
+jmp @L980;
+@L1045:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+mulqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1046:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1047;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1047;
+ldidw 0;
+jmp @L1048;
+@L1047:
+ldidw 1;
+@L1048:
+jmpf @L1049;
+jmp @L980;
+@L1049:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L1050;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+udivqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1051;
+@L1050:
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+sdivqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1051:
+@L1052:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1053;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1053;
+ldidw 0;
+jmp @L1054;
+@L1053:
+ldidw 1;
+@L1054:
+jmpf @L1055;
+jmp @L980;
+@L1055:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L1056;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+umodqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1057;
+@L1056:
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+smodqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1057:
+@L1058:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L1059;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1060;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1060;
+ldidw 1;
+jmp @L1061;
+@L1060:
+ldidw 0;
+@L1061:
+jmpf @L1062;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1063;
+@L1062:
+ldidw 43981;
+dw2qw;
+ret;
+@L1063:
+jmp @L1064;
+@L1059:
+# var: pi, offset: 24
+# var: ii, offset: 28
+ldbp -32;
+lddw;
+jmpf @L1065;
+jmp @L980;
+@L1065:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L1066;
+ldidw 1;
+ldbp 24;
+stdw;
+pop;
+ldidw 0;
+ldbp 28;
+stdw;
+pop;
+jmp @L1067;
+@L1066:
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+ldidw 1;
+ldbp 28;
+stdw;
+pop;
+@L1067:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 28;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L1068;
+jmp @L980;
+@L1068:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1069;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 28;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1069;
+ldidw 1;
+jmp @L1070;
+@L1069:
+ldidw 0;
+@L1070:
+jmpf @L1071;
+# var: ty, offset: 32
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 32;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 32;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 32;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1072;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldbp 32;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+mulqw;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1073;
+@L1072:
+ldbp 8;
+ldqw;
+ldbp 32;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+mulqw;
+ldbp 16;
+ldqw;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1073:
+jmp @L1074;
+@L1071:
+ldidw 43981;
+dw2qw;
+ret;
+@L1074:
+@L1064:
+@L1075:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L1076;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L1077;
+jmp @L980;
+@L1077:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1078;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+subqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1079;
+@L1078:
+ldidw 43981;
+dw2qw;
+ret;
+@L1079:
+jmp @L1080;
+@L1076:
+ldbp -32;
+lddw;
+jmpf @L1081;
+jmp @L980;
+@L1081:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L1082;
+jmp @L980;
+@L1082:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1083;
+# var: ty, offset: 24
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 24;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 24;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L1084;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+mulqw;
+subqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1085;
+@L1084:
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+subqw;
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+sdivqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1085:
+jmp @L1086;
+@L1083:
+ldidw 43981;
+dw2qw;
+ret;
+@L1086:
+@L1080:
+@L1087:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1088;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1088;
+ldidw 0;
+jmp @L1089;
+@L1088:
+ldidw 1;
+@L1089:
+jmpf @L1090;
+jmp @L980;
+@L1090:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+pop;
+sllqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1091:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1092;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1092;
+ldidw 0;
+jmp @L1093;
+@L1092:
+ldidw 1;
+@L1093:
+jmpf @L1094;
+jmp @L980;
+@L1094:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L1095;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+pop;
+srlqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1096;
+@L1095:
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+pop;
+sraqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1096:
+@L1097:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1098;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1098;
+ldidw 0;
+jmp @L1099;
+@L1098:
+ldidw 1;
+@L1099:
+jmpf @L1100;
+jmp @L980;
+@L1100:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L1101;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ultqw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1102;
+@L1101:
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+sltqw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1102:
+@L1103:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1104;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1104;
+ldidw 0;
+jmp @L1105;
+@L1104:
+ldidw 1;
+@L1105:
+jmpf @L1106;
+jmp @L980;
+@L1106:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L1107;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ugtqw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1108;
+@L1107:
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+sgtqw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1108:
+@L1109:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1110;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1110;
+ldidw 0;
+jmp @L1111;
+@L1110:
+ldidw 1;
+@L1111:
+jmpf @L1112;
+jmp @L980;
+@L1112:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L1113;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+uletqw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1114;
+@L1113:
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+sletqw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1114:
+@L1115:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1116;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1116;
+ldidw 0;
+jmp @L1117;
+@L1116:
+ldidw 1;
+@L1117:
+jmpf @L1118;
+jmp @L980;
+@L1118:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L1119;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ugetqw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1120;
+@L1119:
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+sgetqw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1120:
+@L1121:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1122;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1122;
+ldidw 0;
+jmp @L1123;
+@L1122:
+ldidw 1;
+@L1123:
+jmpf @L1124;
+jmp @L980;
+@L1124:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+eqqw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1125:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1126;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1126;
+ldidw 0;
+jmp @L1127;
+@L1126:
+ldidw 1;
+@L1127:
+jmpf @L1128;
+jmp @L980;
+@L1128:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+neqqw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1129:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1130;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1130;
+ldidw 0;
+jmp @L1131;
+@L1130:
+ldidw 1;
+@L1131:
+jmpf @L1132;
+jmp @L980;
+@L1132:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+andqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1133:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1134;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1134;
+ldidw 0;
+jmp @L1135;
+@L1134:
+ldidw 1;
+@L1135:
+jmpf @L1136;
+jmp @L980;
+@L1136:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+xorqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1137:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1138;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L1138;
+ldidw 0;
+jmp @L1139;
+@L1138:
+ldidw 1;
+@L1139:
+jmpf @L1140;
+jmp @L980;
+@L1140:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+orqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1141:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L1142;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1142;
+ldidw 1;
+jmp @L1143;
+@L1142:
+ldidw 0;
+@L1143:
+jmpf @L1144;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L1147;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1147;
+ldidw 1;
+jmp @L1148;
+@L1147:
+ldidw 0;
+@L1148:
+jmpt @L1145;
+ldbp 16;
+ldqw;
+ordw;
+jmpt @L1145;
+ldidw 0;
+jmp @L1146;
+@L1145:
+ldidw 1;
+@L1146:
+jmpf @L1149;
+jmp @L980;
+@L1149:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1150;
+@L1144:
+ldbp 8;
+ldqw;
+notqw;
+jmpf @L1151;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1151:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L1152;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1152;
+ldidw 1;
+jmp @L1153;
+@L1152:
+ldidw 0;
+@L1153:
+jmpf @L1154;
+jmp @L980;
+@L1154:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+notqw;
+notdw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1150:
+@L1155:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L1156;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1156;
+ldidw 1;
+jmp @L1157;
+@L1156:
+ldidw 0;
+@L1157:
+jmpf @L1158;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L1161;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1161;
+ldidw 1;
+jmp @L1162;
+@L1161:
+ldidw 0;
+@L1162:
+jmpt @L1159;
+ldbp 16;
+ldqw;
+notqw;
+jmpt @L1159;
+ldidw 0;
+jmp @L1160;
+@L1159:
+ldidw 1;
+@L1160:
+jmpf @L1163;
+jmp @L980;
+@L1163:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldidw 1;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1164;
+@L1158:
+ldbp 8;
+ldqw;
+ordw;
+jmpf @L1165;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldidw 1;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1165:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L1166;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1166;
+ldidw 1;
+jmp @L1167;
+@L1166:
+ldidw 0;
+@L1167:
+jmpf @L1168;
+jmp @L980;
+@L1168:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+notqw;
+notdw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+@L1164:
+@L1169:
+# var: cond, offset: 24
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1170;
+jmp @L1171;
+@L1170:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1172;
+jmp @L980;
+jmp @L1173;
+@L1172:
+ldbp 24;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+@L1173:
+@L1171:
+ldbp 24;
+ldqw;
+ordw;
+jmpf @L1174;
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1175;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1176;
+@L1175:
+ldbp 8;
+ldqw;
+ret;
+@L1176:
+jmp @L1177;
+@L1174:
+ldbp -32;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1178;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+ret;
+jmp @L1179;
+@L1178:
+ldbp 16;
+ldqw;
+ret;
+@L1179:
+@L1177:
+@L980:
+.data
+.align 8
+@T979:
+.dword 31
+.dword 6
+.dword 7
+.dword 12
+.dword 13
+.dword 14
+.dword 15
+.dword 16
+.dword 17
+.dword 18
+.dword 19
+.dword 20
+.dword 21
+.dword 22
+.dword 23
+.dword 24
+.dword 25
+.dword 26
+.dword 27
+.dword 28
+.dword 29
+.dword 30
+.dword 66
+.dword 97
+.dword 99
+.dword 100
+.dword 101
+.dword 102
+.dword 103
+.dword 104
+.dword 105
+.qword @L980
+.qword @L988
+.qword @L989
+.qword @L1058
+.qword @L1075
+.qword @L1010
+.qword @L1012
+.qword @L1046
+.qword @L1052
+.qword @L1087
+.qword @L1091
+.qword @L1097
+.qword @L1103
+.qword @L1109
+.qword @L1115
+.qword @L1121
+.qword @L1125
+.qword @L1133
+.qword @L1137
+.qword @L1141
+.qword @L1155
+.qword @L1169
+.qword @L995
+.qword @L981
+.qword @L1006
+.qword @L1008
+.qword @L1002
+.qword @L1042
+.qword @L998
+.qword @L1129
+.qword @L1014
+.text
+jmp @L977;
+@L1180:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ret;
+@L1181:
+ldbp -32;
+lddw;
+jmpf @L1182;
+jmp @L977;
+@L1182:
+ldidw 1;
+dw2qw;
+ret;
+@L1183:
+ldbp -32;
+lddw;
+jmpf @L1184;
+jmp @L977;
+@L1184:
+ldbp -28;
+lddw;
+notdw;
+jmpf @L1185;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L1187;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+neqdw;
+jmpf @L1189;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L1189;
+ldidw 1;
+jmp @L1190;
+@L1189:
+ldidw 0;
+@L1190:
+jmpt @L1187;
+ldidw 0;
+jmp @L1188;
+@L1187:
+ldidw 1;
+@L1188:
+jmpf @L1185;
+ldidw 1;
+jmp @L1186;
+@L1185:
+ldidw 0;
+@L1186:
+jmpf @L1191;
+jmp @L977;
+@L1191:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw is_external_id;
+call 8;
+pop;
+notdw;
+jmpf @L1192;
+# var: scs, offset: 24
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L1193;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpf @L1195;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 56;
+neqdw;
+jmpf @L1195;
+ldidw 1;
+jmp @L1196;
+@L1195:
+ldidw 0;
+@L1196:
+jmpt @L1193;
+ldidw 0;
+jmp @L1194;
+@L1193:
+ldidw 1;
+@L1194:
+jmpf @L1197;
+jmp @L977;
+@L1197:
+@L1192:
+ldidw 1;
+dw2qw;
+ret;
+@L977:
+.data
+.align 8
+@T976:
+.dword 0
+.dword 4
+.qword @L977
+.qword @L978
+.qword @L1180
+.qword @L1181
+.qword @L1183
+.text
+ldiqw @S72;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern hash
+.extern iscntrl
+.extern bsearch
+.extern pre_save_pch
+# ==== start of definition of function `get_result_type' ====
+.text
+get_result_type:
+.global get_result_type
+addsp 16;        
+# param:`ty1', offset:-20
+# param:`ty2', offset:-24
+# var: rank1, offset: 4
+# var: rank2, offset: 8
+# var: sign1, offset: 12
+# var: sign2, offset: 16
+ldbp -20;
+lddw;
+ldbp -24;
+lddw;
+eqdw;
+jmpf @L1198;
+ldbp -20;
+lddw;
+dw2qw;
+ret;
+@L1198:
+ldbp -20;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldiqw is_signed_int;
+call 4;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp -24;
+lddw;
+ldiqw is_signed_int;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldbp 16;
+lddw;
+eqdw;
+jmpf @L1199;
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+sgtdw;
+jmpf @L1200;
+ldbp -20;
+lddw;
+jmp @L1201;
+@L1200:
+ldbp -24;
+lddw;
+@L1201:
+dw2qw;
+ret;
+@L1199:
+ldbp 12;
+lddw;
+notdw;
+jmpf @L1202;
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+sgetdw;
+jmpf @L1202;
+ldidw 1;
+jmp @L1203;
+@L1202:
+ldidw 0;
+@L1203:
+jmpf @L1204;
+ldbp -20;
+lddw;
+dw2qw;
+ret;
+@L1204:
+ldbp 16;
+lddw;
+notdw;
+jmpf @L1205;
+ldbp 8;
+lddw;
+ldbp 4;
+lddw;
+sgetdw;
+jmpf @L1205;
+ldidw 1;
+jmp @L1206;
+@L1205:
+ldidw 0;
+@L1206:
+jmpf @L1207;
+ldbp -24;
+lddw;
+dw2qw;
+ret;
+@L1207:
+ldiqw targeting_arch64;
+lddw;
+jmpf @L1208;
+ldbp 12;
+lddw;
+jmpf @L1209;
+ldbp -24;
+lddw;
+ldidw 109;
+neqdw;
+jmpf @L1210;
+ldbp -20;
+lddw;
+dw2qw;
+ret;
+@L1210:
+jmp @L1211;
+@L1209:
+ldbp -20;
+lddw;
+ldidw 109;
+neqdw;
+jmpf @L1212;
+ldbp -24;
+lddw;
+dw2qw;
+ret;
+@L1212:
+@L1211:
+jmp @L1213;
+@L1208:
+ldbp 12;
+lddw;
+jmpf @L1214;
+ldbp -20;
+lddw;
+ldidw 110;
+eqdw;
+jmpf @L1215;
+ldbp -20;
+lddw;
+dw2qw;
+ret;
+@L1215:
+jmp @L1216;
+@L1214:
+ldbp -24;
+lddw;
+ldidw 110;
+eqdw;
+jmpf @L1217;
+ldbp -24;
+lddw;
+dw2qw;
+ret;
+@L1217:
+@L1216:
+@L1213:
+ldbp 12;
+lddw;
+jmpf @L1218;
+ldbp -20;
+lddw;
+ldidw 61;
+eqdw;
+jmpf @L1219;
+ldidw 109;
+jmp @L1220;
+@L1219:
+ldidw 111;
+@L1220:
+dw2qw;
+ret;
+jmp @L1221;
+@L1218:
+ldbp -24;
+lddw;
+ldidw 61;
+eqdw;
+jmpf @L1222;
+ldidw 109;
+jmp @L1223;
+@L1222:
+ldidw 111;
+@L1223:
+dw2qw;
+ret;
+@L1221:
+ldidw 0;
+ret;
+.extern qsort
+.extern analyze_parameter_declaration
+.extern cg_outpath
+.extern memcmp
+.extern pre_load_pch
+.extern vsnprintf
+.extern vsprintf
+.extern warning_count
+.extern memcpy
+.extern fopen
+.extern be_atoi
+.extern push_scope
+.extern free_c_token
+.extern parse
+.extern get_pre_token
+.extern get_member_descriptor
+.extern decl_init
+.extern dup_declarator
+.extern strncat
+.extern fileno
+.extern isdigit
+.extern lookup_external_id
+.extern isspace
+.extern hash2
+.extern analyze_type_name
+.extern isalpha
+.extern memmove
+# ==== start of definition of function `is_unsigned_int' ====
+.text
+is_unsigned_int:
+.global is_unsigned_int
+addsp 0;         
+# param:`ty', offset:-20
+ldbp -20;
+lddw;
+ldiqw @T1224;
+switch;
+@L1226:
+@L1227:
+@L1228:
+@L1229:
+@L1230:
+ldidw 1;
+dw2qw;
+ret;
+@L1231:
+ldidw 0;
+dw2qw;
+ret;
+@L1225:
+.data
+.align 8
+@T1224:
+.dword 6
+.dword 72
+.dword 107
+.dword 108
+.dword 109
+.dword 111
+.qword @L1231
+.qword @L1228
+.qword @L1226
+.qword @L1227
+.qword @L1229
+.qword @L1230
+.text
+ldidw 0;
+ret;
+.extern replace_extension
+.extern analyze_struct_declarator
+.extern get_type_spec
+.extern isgraph
+.extern analyze_function_definition
+.extern strdup
+.extern analyze_init_declarator
+.extern cfg_function_to_print
+.extern strncmp
+# ==== start of definition of function `analyze_multiplicative_expression' ====
+.text
+analyze_multiplicative_expression:
+.global analyze_multiplicative_expression
+addsp 8;         
+# param:`e', offset:-24
+# var: ty1, offset: 4
+# var: ty2, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 90;
+eqdw;
+jmpt @L1232;
+ldbp 8;
+lddw;
+ldidw 90;
+eqdw;
+jmpt @L1232;
+ldidw 0;
+jmp @L1233;
+@L1232:
+ldidw 1;
+@L1233:
+jmpf @L1234;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1234:
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpt @L1235;
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpt @L1235;
+ldidw 0;
+jmp @L1236;
+@L1235:
+ldidw 1;
+@L1236:
+jmpf @L1237;
+ldbp -24;
+ldqw;
+ldiqw binary_op_error;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1237:
+ldbp 8;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldbp 4;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldiqw get_result_type;
+call 8;
+pop;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `analyze_additive_expression' ====
+.text
+analyze_additive_expression:
+.global analyze_additive_expression
+addsp 8;         
+# param:`e', offset:-24
+# var: ty_l, offset: 4
+# var: ty_r, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 90;
+eqdw;
+jmpt @L1238;
+ldbp 8;
+lddw;
+ldidw 90;
+eqdw;
+jmpt @L1238;
+ldidw 0;
+jmp @L1239;
+@L1238:
+ldidw 1;
+@L1239:
+jmpf @L1240;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1240:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 12;
+eqdw;
+jmpf @L1241;
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L1242;
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L1243;
+ldbp 8;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldbp 4;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldiqw get_result_type;
+call 8;
+pop;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1244;
+@L1243:
+ldbp 8;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpf @L1245;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw is_ptr2obj;
+call 8;
+pop;
+notdw;
+jmpf @L1246;
+ldbp -24;
+ldqw;
+ldiqw binary_op_error;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1246:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @L1247;
+@L1245:
+ldbp -24;
+ldqw;
+ldiqw binary_op_error;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1247:
+@L1244:
+jmp @L1248;
+@L1242:
+ldbp 4;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpf @L1249;
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpt @L1250;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw is_ptr2obj;
+call 8;
+pop;
+notdw;
+jmpt @L1250;
+ldidw 0;
+jmp @L1251;
+@L1250:
+ldidw 1;
+@L1251:
+jmpf @L1252;
+ldbp -24;
+ldqw;
+ldiqw binary_op_error;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1252:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @L1253;
+@L1249:
+ldbp -24;
+ldqw;
+ldiqw binary_op_error;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1253:
+@L1248:
+jmp @L1254;
+@L1241:
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L1255;
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L1256;
+ldbp 8;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldbp 4;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldiqw get_result_type;
+call 8;
+pop;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1257;
+@L1256:
+ldbp -24;
+ldqw;
+ldiqw binary_op_error;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1257:
+jmp @L1258;
+@L1255:
+ldbp 4;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpf @L1259;
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L1260;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw is_ptr2obj;
+call 8;
+pop;
+notdw;
+jmpf @L1261;
+ldbp -24;
+ldqw;
+ldiqw binary_op_error;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1261:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+jmp @L1262;
+@L1260:
+ldbp 8;
+lddw;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpf @L1263;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw is_ptr2obj;
+call 8;
+pop;
+notdw;
+jmpt @L1266;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw is_ptr2obj;
+call 8;
+pop;
+notdw;
+jmpt @L1266;
+ldidw 0;
+jmp @L1267;
+@L1266:
+ldidw 1;
+@L1267:
+jmpt @L1264;
+ldidw 0;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw are_compatible;
+call 40;
+pop;
+notdw;
+jmpt @L1264;
+ldidw 0;
+jmp @L1265;
+@L1264:
+ldidw 1;
+@L1265:
+jmpf @L1268;
+ldbp -24;
+ldqw;
+ldiqw binary_op_error;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1268:
+ldidw 61;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1269;
+@L1263:
+ldbp -24;
+ldqw;
+ldiqw binary_op_error;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1269:
+@L1262:
+jmp @L1270;
+@L1259:
+ldbp -24;
+ldqw;
+ldiqw binary_op_error;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1270:
+@L1258:
+@L1254:
+ldidw 0;
+ret;
+.extern stat_number_of_c_tokens
+.extern strncpy
+.extern decl_save_pch
+# ==== start of definition of function `is_scalar' ====
+.text
+is_scalar:
+addsp 0;         
+# param:`op', offset:-20
+ldbp -20;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpt @L1271;
+ldbp -20;
+lddw;
+ldidw 11;
+eqdw;
+jmpt @L1271;
+ldidw 0;
+jmp @L1272;
+@L1271:
+ldidw 1;
+@L1272:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `analyze_assignment_expression' ====
+.text
+analyze_assignment_expression:
+.global analyze_assignment_expression
+addsp 124;       
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 90;
+eqdw;
+jmpt @L1273;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 90;
+eqdw;
+jmpt @L1273;
+ldidw 0;
+jmp @L1274;
+@L1273:
+ldidw 1;
+@L1274:
+jmpf @L1275;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1275:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw is_modif_lvalue;
+call 8;
+pop;
+notdw;
+jmpf @L1276;
+@L1277:
+@L1280:
+ldiqw @S73;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L1281:
+ldidw 0;
+jmpf @L1282;
+jmp @L1280;
+@L1282:
+ldiqw 0;
+ret;
+@L1278:
+ldidw 0;
+jmpf @L1279;
+jmp @L1277;
+@L1279:
+@L1276:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 35;
+eqdw;
+jmpf @L1283;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw can_assign_to;
+call 16;
+pop;
+notdw;
+jmpf @L1284;
+# var: ty1, offset: 8
+# var: ty2, offset: 16
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw stringify_type_exp;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw stringify_type_exp;
+call 12;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L1285:
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S74;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 44;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L1286:
+ldidw 0;
+jmpf @L1287;
+jmp @L1285;
+@L1287:
+ldbp 8;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1284:
+jmp @L1288;
+@L1283:
+# var: temp, offset: 8
+ldbp -24;
+ldqw;
+ldbp 8;
+swap2;
+memcpy 104;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T1289;
+jmptab;
+@L1291:
+ldidw 102;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldiqw analyze_multiplicative_expression;
+call 8;
+pop;
+pop;
+jmp @L1290;
+@L1292:
+ldidw 16;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldiqw analyze_multiplicative_expression;
+call 8;
+pop;
+pop;
+jmp @L1290;
+@L1293:
+ldidw 17;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldiqw analyze_multiplicative_expression;
+call 8;
+pop;
+pop;
+jmp @L1290;
+@L1294:
+ldidw 12;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldiqw analyze_additive_expression;
+call 8;
+pop;
+pop;
+jmp @L1290;
+@L1295:
+ldidw 13;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldiqw analyze_additive_expression;
+call 8;
+pop;
+pop;
+jmp @L1290;
+@L1296:
+ldidw 18;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldiqw analyze_bitwise_operator;
+call 8;
+pop;
+pop;
+jmp @L1290;
+@L1297:
+ldidw 19;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldiqw analyze_bitwise_operator;
+call 8;
+pop;
+pop;
+jmp @L1290;
+@L1298:
+ldidw 104;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldiqw analyze_bitwise_operator;
+call 8;
+pop;
+pop;
+jmp @L1290;
+@L1299:
+ldidw 26;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldiqw analyze_bitwise_operator;
+call 8;
+pop;
+pop;
+jmp @L1290;
+@L1300:
+ldidw 27;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldiqw analyze_bitwise_operator;
+call 8;
+pop;
+pop;
+jmp @L1290;
+@L1290:
+.data
+.align 8
+@T1289:
+.dword 36
+.dword 10
+.qword @L1290
+.qword @L1291
+.qword @L1292
+.qword @L1293
+.qword @L1294
+.qword @L1295
+.qword @L1296
+.qword @L1297
+.qword @L1298
+.qword @L1299
+.qword @L1300
+.text
+ldbp 8;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw can_assign_to;
+call 16;
+pop;
+notdw;
+jmpf @L1301;
+# var: ty1, offset: 112
+# var: ty2, offset: 120
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw stringify_type_exp;
+call 12;
+ldbp 112;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp 8;
+ldiqw 72;
+addqw;
+ldiqw stringify_type_exp;
+call 12;
+ldbp 120;
+stqw;
+pop;
+pop;
+@L1302:
+ldbp 120;
+ldqw;
+ldbp 112;
+ldqw;
+ldiqw @S75;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 44;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L1303:
+ldidw 0;
+jmpf @L1304;
+jmp @L1302;
+@L1304:
+ldbp 112;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 120;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1301:
+ldbp 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 3;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L1288:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern new_extern_id_node
+.extern decl_load_pch
+.extern analyze_translation_unit
+.extern strnlen
+.extern analyze_enumerator
+.extern targeting_arch64
+.extern set_attributes
+.extern is_typedef_name
+.extern fread
+.extern strrchr
+.extern disable_warnings
+.extern install_macro
+.extern ferror
+.extern random
+.extern isblank
+.extern free
+.extern malloc
+.extern get_external_declarations
+.extern new_decl_list_node
+.extern srandom
+.extern lookup_struct_descriptor
+.extern new_exec_node
+# ==== start of definition of function `get_alignment' ====
+.text
+get_alignment:
+.global get_alignment
+addsp 28;        
+# param:`ty', offset:-24
+# var: cat, offset: 4
+# var: alignment, offset: 8
+# var: new_ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L1305;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1306:
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1309;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpf @L1309;
+ldidw 1;
+jmp @L1310;
+@L1309:
+ldidw 0;
+@L1310:
+jmpf @L1308;
+@L1307:
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1306;
+@L1308:
+ldbp 16;
+ldbp -24;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L1305:
+ldbp 4;
+lddw;
+ldiqw @T1311;
+switch;
+@L1313:
+@L1314:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_struct_descriptor;
+call 8;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+jmp @L1312;
+@L1315:
+@L1316:
+ldiqw target_arch;
+lddw;
+ldiqw @T1317;
+jmptab;
+@L1319:
+@L1320:
+@L1321:
+@L1322:
+ldidw 8;
+ldbp 8;
+stdw;
+pop;
+jmp @L1318;
+@L1323:
+ldidw 4;
+ldbp 8;
+stdw;
+pop;
+jmp @L1318;
+@L1318:
+.data
+.align 8
+@T1317:
+.dword 1
+.dword 5
+.qword @L1323
+.qword @L1319
+.qword @L1323
+.qword @L1320
+.qword @L1321
+.qword @L1322
+.text
+jmp @L1312;
+@L1324:
+@L1325:
+@L1326:
+ldiqw targeting_arch64;
+lddw;
+jmpf @L1327;
+ldidw 8;
+jmp @L1328;
+@L1327:
+ldidw 4;
+@L1328:
+ldbp 8;
+stdw;
+pop;
+jmp @L1312;
+@L1329:
+@L1330:
+@L1331:
+ldidw 4;
+ldbp 8;
+stdw;
+pop;
+jmp @L1312;
+@L1332:
+@L1333:
+ldidw 2;
+ldbp 8;
+stdw;
+pop;
+jmp @L1312;
+@L1334:
+@L1335:
+@L1336:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L1312;
+@L1337:
+@L1338:
+ldidw 0;
+notdw;
+jmpf @L1341;
+ldidw 1989;
+ldiqw @S76;
+ldiqw @S77;
+ldiqw @S78;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L1341:
+@L1339:
+ldidw 0;
+jmpf @L1340;
+jmp @L1338;
+@L1340:
+@L1312:
+.data
+.align 8
+@T1311:
+.dword 16
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 68
+.dword 71
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.dword 109
+.dword 110
+.dword 111
+.qword @L1337
+.qword @L1324
+.qword @L1334
+.qword @L1329
+.qword @L1330
+.qword @L1325
+.qword @L1332
+.qword @L1313
+.qword @L1314
+.qword @L1331
+.qword @L1335
+.qword @L1336
+.qword @L1333
+.qword @L1326
+.qword @L1315
+.qword @L1316
+.text
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern fgetc
+.data
+@S0:
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 32
+.byte 105
+.byte 115
+.byte 32
+.byte 116
+.byte 111
+.byte 111
+.byte 32
+.byte 108
+.byte 97
+.byte 114
+.byte 103
+.byte 101
+.byte 32
+.byte 102
+.byte 111
+.byte 114
+.byte 32
+.byte 105
+.byte 116
+.byte 115
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S1:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 0
+@S2:
+.byte 95
+.byte 95
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 111
+.byte 102
+.byte 95
+.byte 95
+.byte 0
+@S3:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 97
+.byte 112
+.byte 112
+.byte 108
+.byte 105
+.byte 99
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 97
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S4:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 97
+.byte 112
+.byte 112
+.byte 108
+.byte 105
+.byte 99
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S5:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 38
+.byte 0
+@S6:
+.byte 97
+.byte 100
+.byte 100
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 114
+.byte 101
+.byte 103
+.byte 105
+.byte 115
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 118
+.byte 97
+.byte 114
+.byte 105
+.byte 97
+.byte 98
+.byte 108
+.byte 101
+.byte 32
+.byte 114
+.byte 101
+.byte 113
+.byte 117
+.byte 101
+.byte 115
+.byte 116
+.byte 101
+.byte 100
+.byte 0
+@S7:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 42
+.byte 0
+@S8:
+.byte 100
+.byte 101
+.byte 114
+.byte 101
+.byte 102
+.byte 101
+.byte 114
+.byte 101
+.byte 110
+.byte 99
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S9:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S10:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 33
+.byte 0
+@S11:
+.byte 99
+.byte 97
+.byte 110
+.byte 95
+.byte 97
+.byte 115
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 95
+.byte 116
+.byte 111
+.byte 0
+@S12:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 46
+.byte 99
+.byte 0
+@S13:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S14:
+.byte 105
+.byte 109
+.byte 112
+.byte 108
+.byte 105
+.byte 99
+.byte 105
+.byte 116
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 118
+.byte 101
+.byte 114
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 110
+.byte 103
+.byte 101
+.byte 115
+.byte 32
+.byte 118
+.byte 97
+.byte 108
+.byte 117
+.byte 101
+.byte 32
+.byte 102
+.byte 114
+.byte 111
+.byte 109
+.byte 32
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 0
+@S15:
+.byte 105
+.byte 109
+.byte 112
+.byte 108
+.byte 105
+.byte 99
+.byte 105
+.byte 116
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 118
+.byte 101
+.byte 114
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 110
+.byte 103
+.byte 101
+.byte 115
+.byte 32
+.byte 118
+.byte 97
+.byte 108
+.byte 117
+.byte 101
+.byte 32
+.byte 102
+.byte 114
+.byte 111
+.byte 109
+.byte 32
+.byte 37
+.byte 108
+.byte 108
+.byte 117
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 0
+@S16:
+.byte 105
+.byte 109
+.byte 112
+.byte 108
+.byte 105
+.byte 99
+.byte 105
+.byte 116
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 118
+.byte 101
+.byte 114
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 108
+.byte 111
+.byte 115
+.byte 101
+.byte 115
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 112
+.byte 114
+.byte 101
+.byte 99
+.byte 105
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 58
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S17:
+.byte 105
+.byte 109
+.byte 112
+.byte 108
+.byte 105
+.byte 99
+.byte 105
+.byte 116
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 118
+.byte 101
+.byte 114
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 110
+.byte 103
+.byte 101
+.byte 115
+.byte 32
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 101
+.byte 100
+.byte 110
+.byte 101
+.byte 115
+.byte 115
+.byte 58
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S18:
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 118
+.byte 101
+.byte 114
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 111
+.byte 117
+.byte 116
+.byte 32
+.byte 97
+.byte 32
+.byte 99
+.byte 97
+.byte 115
+.byte 116
+.byte 0
+@S19:
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 105
+.byte 109
+.byte 112
+.byte 108
+.byte 105
+.byte 99
+.byte 105
+.byte 116
+.byte 108
+.byte 121
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 118
+.byte 101
+.byte 114
+.byte 116
+.byte 101
+.byte 100
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 118
+.byte 111
+.byte 105
+.byte 100
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 0
+@S20:
+.byte 118
+.byte 111
+.byte 105
+.byte 100
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 105
+.byte 109
+.byte 112
+.byte 108
+.byte 105
+.byte 99
+.byte 105
+.byte 116
+.byte 108
+.byte 121
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 118
+.byte 101
+.byte 114
+.byte 116
+.byte 101
+.byte 100
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 0
+@S21:
+.byte 97
+.byte 115
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 102
+.byte 114
+.byte 111
+.byte 109
+.byte 32
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 97
+.byte 116
+.byte 105
+.byte 98
+.byte 108
+.byte 101
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S22:
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 32
+.byte 118
+.byte 111
+.byte 108
+.byte 97
+.byte 116
+.byte 105
+.byte 108
+.byte 101
+.byte 0
+@S23:
+.byte 118
+.byte 111
+.byte 108
+.byte 97
+.byte 116
+.byte 105
+.byte 108
+.byte 101
+.byte 0
+@S24:
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 0
+@S25:
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 0
+@S26:
+.byte 118
+.byte 111
+.byte 108
+.byte 97
+.byte 116
+.byte 105
+.byte 108
+.byte 101
+.byte 0
+@S27:
+.byte 97
+.byte 115
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 100
+.byte 105
+.byte 115
+.byte 99
+.byte 97
+.byte 114
+.byte 100
+.byte 115
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 113
+.byte 117
+.byte 97
+.byte 108
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 32
+.byte 102
+.byte 114
+.byte 111
+.byte 109
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 116
+.byte 97
+.byte 114
+.byte 103
+.byte 101
+.byte 116
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S28:
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 118
+.byte 101
+.byte 114
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 111
+.byte 117
+.byte 116
+.byte 32
+.byte 97
+.byte 32
+.byte 99
+.byte 97
+.byte 115
+.byte 116
+.byte 0
+@S29:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 115
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 98
+.byte 105
+.byte 110
+.byte 97
+.byte 114
+.byte 121
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 40
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 41
+.byte 0
+@S30:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 95
+.byte 110
+.byte 111
+.byte 100
+.byte 101
+.byte 0
+@S31:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 46
+.byte 99
+.byte 0
+@S32:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S33:
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 97
+.byte 114
+.byte 105
+.byte 115
+.byte 111
+.byte 110
+.byte 32
+.byte 98
+.byte 101
+.byte 116
+.byte 119
+.byte 101
+.byte 101
+.byte 110
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 0
+@S34:
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 97
+.byte 114
+.byte 105
+.byte 115
+.byte 111
+.byte 110
+.byte 32
+.byte 98
+.byte 101
+.byte 116
+.byte 119
+.byte 101
+.byte 101
+.byte 110
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 0
+@S35:
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 97
+.byte 114
+.byte 105
+.byte 115
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 118
+.byte 111
+.byte 105
+.byte 100
+.byte 32
+.byte 42
+.byte 39
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 0
+@S36:
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 97
+.byte 114
+.byte 105
+.byte 115
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 118
+.byte 111
+.byte 105
+.byte 100
+.byte 32
+.byte 42
+.byte 39
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 0
+@S37:
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 97
+.byte 114
+.byte 105
+.byte 115
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 100
+.byte 105
+.byte 115
+.byte 116
+.byte 105
+.byte 110
+.byte 99
+.byte 116
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 115
+.byte 0
+@S38:
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 97
+.byte 114
+.byte 105
+.byte 115
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 115
+.byte 0
+@S39:
+.byte 99
+.byte 97
+.byte 115
+.byte 116
+.byte 32
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 100
+.byte 111
+.byte 101
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 104
+.byte 97
+.byte 118
+.byte 101
+.byte 32
+.byte 115
+.byte 99
+.byte 97
+.byte 108
+.byte 97
+.byte 114
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S40:
+.byte 99
+.byte 97
+.byte 115
+.byte 116
+.byte 32
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 115
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 118
+.byte 101
+.byte 114
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 110
+.byte 111
+.byte 110
+.byte 45
+.byte 115
+.byte 99
+.byte 97
+.byte 108
+.byte 97
+.byte 114
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S41:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 99
+.byte 97
+.byte 115
+.byte 116
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 118
+.byte 111
+.byte 105
+.byte 100
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 110
+.byte 111
+.byte 110
+.byte 45
+.byte 118
+.byte 111
+.byte 105
+.byte 100
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S42:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 114
+.byte 97
+.byte 110
+.byte 107
+.byte 0
+@S43:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 46
+.byte 99
+.byte 0
+@S44:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S45:
+.byte 105
+.byte 110
+.byte 99
+.byte 114
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 0
+@S46:
+.byte 100
+.byte 101
+.byte 99
+.byte 114
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 0
+@S47:
+.byte 119
+.byte 114
+.byte 111
+.byte 110
+.byte 103
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 97
+.byte 114
+.byte 103
+.byte 117
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S48:
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 105
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 109
+.byte 111
+.byte 100
+.byte 105
+.byte 102
+.byte 105
+.byte 97
+.byte 98
+.byte 108
+.byte 101
+.byte 0
+@S49:
+.byte 105
+.byte 115
+.byte 95
+.byte 108
+.byte 118
+.byte 97
+.byte 108
+.byte 117
+.byte 101
+.byte 0
+@S50:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 46
+.byte 99
+.byte 0
+@S51:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S52:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 102
+.byte 105
+.byte 114
+.byte 115
+.byte 116
+.byte 32
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 102
+.byte 111
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 100
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 97
+.byte 108
+.byte 32
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 116
+.byte 111
+.byte 114
+.byte 0
+@S53:
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 47
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 109
+.byte 105
+.byte 115
+.byte 109
+.byte 97
+.byte 116
+.byte 99
+.byte 104
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 100
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 97
+.byte 108
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S54:
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 47
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 109
+.byte 105
+.byte 115
+.byte 109
+.byte 97
+.byte 116
+.byte 99
+.byte 104
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 100
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 97
+.byte 108
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S55:
+.byte 99
+.byte 111
+.byte 110
+.byte 100
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 97
+.byte 108
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 98
+.byte 101
+.byte 116
+.byte 119
+.byte 101
+.byte 101
+.byte 110
+.byte 32
+.byte 96
+.byte 118
+.byte 111
+.byte 105
+.byte 100
+.byte 32
+.byte 42
+.byte 39
+.byte 32
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 0
+@S56:
+.byte 99
+.byte 111
+.byte 110
+.byte 100
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 97
+.byte 108
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 98
+.byte 101
+.byte 116
+.byte 119
+.byte 101
+.byte 101
+.byte 110
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 96
+.byte 118
+.byte 111
+.byte 105
+.byte 100
+.byte 32
+.byte 42
+.byte 39
+.byte 0
+@S57:
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 109
+.byte 105
+.byte 115
+.byte 109
+.byte 97
+.byte 116
+.byte 99
+.byte 104
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 100
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 97
+.byte 108
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S58:
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 109
+.byte 105
+.byte 115
+.byte 109
+.byte 97
+.byte 116
+.byte 99
+.byte 104
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 100
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 97
+.byte 108
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 40
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 41
+.byte 0
+@S59:
+.byte 115
+.byte 117
+.byte 98
+.byte 115
+.byte 99
+.byte 114
+.byte 105
+.byte 112
+.byte 116
+.byte 101
+.byte 100
+.byte 32
+.byte 118
+.byte 97
+.byte 108
+.byte 117
+.byte 101
+.byte 32
+.byte 105
+.byte 115
+.byte 32
+.byte 110
+.byte 101
+.byte 105
+.byte 116
+.byte 104
+.byte 101
+.byte 114
+.byte 32
+.byte 97
+.byte 114
+.byte 114
+.byte 97
+.byte 121
+.byte 32
+.byte 110
+.byte 111
+.byte 114
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 0
+@S60:
+.byte 115
+.byte 117
+.byte 98
+.byte 115
+.byte 99
+.byte 114
+.byte 105
+.byte 112
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S61:
+.byte 97
+.byte 114
+.byte 114
+.byte 97
+.byte 121
+.byte 32
+.byte 115
+.byte 117
+.byte 98
+.byte 115
+.byte 99
+.byte 114
+.byte 105
+.byte 112
+.byte 116
+.byte 32
+.byte 105
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 97
+.byte 110
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 0
+@S62:
+.byte 115
+.byte 117
+.byte 98
+.byte 115
+.byte 99
+.byte 114
+.byte 105
+.byte 112
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 112
+.byte 111
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S63:
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 114
+.byte 101
+.byte 116
+.byte 117
+.byte 114
+.byte 110
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S64:
+.byte 112
+.byte 97
+.byte 114
+.byte 97
+.byte 109
+.byte 101
+.byte 116
+.byte 101
+.byte 114
+.byte 47
+.byte 97
+.byte 114
+.byte 103
+.byte 117
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 109
+.byte 105
+.byte 115
+.byte 109
+.byte 97
+.byte 116
+.byte 99
+.byte 104
+.byte 32
+.byte 40
+.byte 112
+.byte 97
+.byte 114
+.byte 97
+.byte 109
+.byte 101
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 35
+.byte 37
+.byte 100
+.byte 59
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 101
+.byte 100
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 44
+.byte 32
+.byte 103
+.byte 105
+.byte 118
+.byte 101
+.byte 110
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 41
+.byte 0
+@S65:
+.byte 112
+.byte 97
+.byte 114
+.byte 97
+.byte 109
+.byte 101
+.byte 116
+.byte 101
+.byte 114
+.byte 47
+.byte 97
+.byte 114
+.byte 103
+.byte 117
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 110
+.byte 117
+.byte 109
+.byte 98
+.byte 101
+.byte 114
+.byte 32
+.byte 109
+.byte 105
+.byte 115
+.byte 109
+.byte 97
+.byte 116
+.byte 99
+.byte 104
+.byte 0
+@S66:
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 111
+.byte 98
+.byte 106
+.byte 101
+.byte 99
+.byte 116
+.byte 32
+.byte 105
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 97
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S67:
+.byte 108
+.byte 101
+.byte 102
+.byte 116
+.byte 32
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 110
+.byte 101
+.byte 105
+.byte 116
+.byte 104
+.byte 101
+.byte 114
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 117
+.byte 114
+.byte 101
+.byte 32
+.byte 110
+.byte 111
+.byte 114
+.byte 32
+.byte 117
+.byte 110
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S68:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 46
+.byte 0
+@S69:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 45
+.byte 62
+.byte 0
+@S70:
+.byte 108
+.byte 101
+.byte 102
+.byte 116
+.byte 32
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S71:
+.byte 96
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 32
+.byte 109
+.byte 101
+.byte 109
+.byte 98
+.byte 101
+.byte 114
+.byte 32
+.byte 110
+.byte 97
+.byte 109
+.byte 101
+.byte 100
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S72:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S73:
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 105
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 97
+.byte 115
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 97
+.byte 98
+.byte 108
+.byte 101
+.byte 0
+@S74:
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 97
+.byte 116
+.byte 105
+.byte 98
+.byte 108
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 115
+.byte 32
+.byte 119
+.byte 104
+.byte 101
+.byte 110
+.byte 32
+.byte 97
+.byte 115
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 102
+.byte 114
+.byte 111
+.byte 109
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S75:
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 97
+.byte 116
+.byte 105
+.byte 98
+.byte 108
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 115
+.byte 32
+.byte 119
+.byte 104
+.byte 101
+.byte 110
+.byte 32
+.byte 97
+.byte 115
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 102
+.byte 114
+.byte 111
+.byte 109
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S76:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 0
+@S77:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 46
+.byte 99
+.byte 0
+@S78:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
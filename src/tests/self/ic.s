@@ -0,0 +1,42677 @@
+.extern fgets
+.bss
+.align 8
+inl_def:
+.res 8
+# ==== start of definition of function `edge_init' ====
+.text
+edge_init:
+addsp 0;         
+# param:`p', offset:-24
+# param:`max', offset:-28
+ldiqw 4;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern get_promoted_type
+.extern analyze_bitwise_operator
+# ==== start of definition of function `ic_break_statement' ====
+.text
+ic_break_statement:
+addsp 0;         
+ldiqw verbose_asm;
+lddw;
+jmpf @L1;
+ldiqw @S0;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L1:
+ldidw 0;
+ldidw 0;
+ldiqw btarget_stack;
+ldiqw bt_stack_top;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+dw2qw;
+ldidw 32;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 4
+memset_addr:
+.res 4
+.extern verbose_asm
+.extern bset_iterate
+.bss
+.align 8
+inl_cg_tab:
+.res 8
+# ==== start of definition of function `edge_iterate' ====
+.text
+edge_iterate:
+.global edge_iterate
+addsp 0;         
+# param:`p', offset:-24
+.bss
+.align 4
+@edge_iterate_n:
+.res 4
+.bss
+.align 8
+@edge_iterate_curr:
+.res 8
+.text
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L2;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw @edge_iterate_n;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw @edge_iterate_curr;
+stqw;
+pop;
+pop;
+@L2:
+ldiqw @edge_iterate_n;
+lddw;
+jmpf @L3;
+ldiqw @edge_iterate_n;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldiqw @edge_iterate_curr;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 4;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+lddw;
+udw2qw;
+ret;
+@L3:
+ldidw 1;
+negdw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `ic_find_atv_in_expr' ====
+.text
+ic_find_atv_in_expr:
+addsp 0;         
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L4;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T5;
+switch;
+@L7:
+@L8:
+@L9:
+@L10:
+@L11:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_find_atv_in_expr;
+call 8;
+pop;
+pop;
+jmp @L6;
+@L12:
+@L13:
+@L14:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_find_atv_in_expr;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_find_atv_in_expr;
+call 8;
+pop;
+pop;
+jmp @L6;
+@L15:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ordw;
+jmpf @L16;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_find_atv_in_expr;
+call 8;
+pop;
+pop;
+jmp @L17;
+@L16:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw ic_find_atv_in_expr;
+call 8;
+pop;
+pop;
+@L17:
+jmp @L6;
+@L18:
+@L19:
+ldidw 0;
+notdw;
+jmpf @L22;
+ldidw 498;
+ldiqw @S1;
+ldiqw @S2;
+ldiqw @S3;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L22:
+@L20:
+ldidw 0;
+jmpf @L21;
+jmp @L19;
+@L21:
+@L6:
+.data
+.align 8
+@T5:
+.dword 10
+.dword 6
+.dword 7
+.dword 12
+.dword 13
+.dword 30
+.dword 97
+.dword 101
+.dword 103
+.dword 105
+.qword @L18
+.qword @L7
+.qword @L8
+.qword @L13
+.qword @L14
+.qword @L15
+.qword @L12
+.qword @L10
+.qword @L9
+.qword @L11
+.text
+jmp @L23;
+@L4:
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L24;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw get_var_nid;
+call 12;
+pop;
+ldiqw new_atv;
+call 4;
+pop;
+pop;
+@L24:
+@L23:
+ldidw 0;
+ret;
+.bss
+.align 8
+static_objects_list:
+.res 8
+.global static_objects_list
+.bss
+.align 4
+ic_addresses_max:
+.res 4
+.global ic_addresses_max
+.extern is_complete
+# ==== start of definition of function `ic_inline_functions' ====
+.text
+ic_inline_functions:
+addsp 36;        
+# param:`func_def_list', offset:-24
+# var: recursive, offset: 8
+# var: seen, offset: 16
+# var: i, offset: 24
+# var: k, offset: 28
+ldiqw 8;
+ldiqw cg_nodes_counter;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldiqw inl_def;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L25:
+ldbp -24;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L27;
+ldbp -24;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw inl_def;
+ldqw;
+ldbp -24;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw new_cg_node;
+call 8;
+pop;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L26:
+incldw 24;
+jmp @L25;
+@L27:
+ldiqw cg_nodes_counter;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw inl_size;
+stqw;
+pop;
+pop;
+ldiqw 4;
+ldiqw cg_nodes_counter;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldiqw inl_ncalls;
+stqw;
+pop;
+pop;
+ldiqw 8;
+ldiqw cg_nodes_counter;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldiqw inl_param_nid;
+stqw;
+pop;
+pop;
+ldiqw cg_nodes_counter;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw cg_nodes_counter;
+lddw;
+udw2qw;
+ldiqw malloc;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw inl_cg_tab_size;
+stdw;
+pop;
+@L28:
+ldiqw inl_cg_tab_size;
+lddw;
+ldiqw cg_nodes_counter;
+lddw;
+ldidw 2;
+muldw;
+ultdw;
+jmpf @L30;
+@L29:
+ldiqw inl_cg_tab_size;
+lddw;
+ldidw 2;
+muldw;
+ldiqw inl_cg_tab_size;
+stdw;
+pop;
+jmp @L28;
+@L30:
+ldiqw 4;
+ldiqw inl_cg_tab_size;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldiqw inl_cg_tab;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L31:
+ldbp 24;
+lddw;
+ldiqw cg_nodes_counter;
+lddw;
+ultdw;
+jmpf @L33;
+# var: h, offset: 32
+ldiqw cg_nodes;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw hash;
+call 8;
+pop;
+ldiqw inl_cg_tab_size;
+lddw;
+ldidw 1;
+subdw;
+anddw;
+ldbp 32;
+stdw;
+pop;
+@L34:
+ldiqw inl_cg_tab;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldxdw 4;
+jmpf @L36;
+@L35:
+ldbp 32;
+lddw;
+ldidw 1;
+adddw;
+ldiqw inl_cg_tab_size;
+lddw;
+ldidw 1;
+subdw;
+anddw;
+ldbp 32;
+stdw;
+pop;
+jmp @L34;
+@L36:
+ldbp 24;
+lddw;
+ldidw 1;
+adddw;
+ldiqw inl_cg_tab;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L32:
+incldw 24;
+jmp @L31;
+@L33:
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L37:
+ldbp 24;
+lddw;
+ldiqw cg_nodes_counter;
+lddw;
+ultdw;
+jmpf @L39;
+ldidw 1;
+negdw;
+ldiqw inl_size;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw cg_nodes_counter;
+lddw;
+udw2qw;
+ldidw 0;
+ldbp 16;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 24;
+lddw;
+ldbp 24;
+lddw;
+ldiqw inline_reaches;
+call 16;
+pop;
+ldbp 8;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L40;
+# var: j, offset: 32
+# var: g, offset: 36
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 32;
+stdw;
+pop;
+@L41:
+ldbp 32;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+uletdw;
+jmpf @L43;
+ldbp 32;
+lddw;
+ldiqw inline_call_target;
+call 4;
+pop;
+ldbp 36;
+stdw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L44;
+ldiqw inl_ncalls;
+ldqw;
+ldbp 36;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+@L44:
+@L42:
+incldw 32;
+jmp @L41;
+@L43:
+@L40:
+@L38:
+incldw 24;
+jmp @L37;
+@L39:
+ldiqw number_CG;
+call 0;
+pop;
+pop;
+ldidw 0;
+ldbp 28;
+stdw;
+pop;
+@L45:
+ldbp 28;
+lddw;
+ldiqw cg_nodes_counter;
+lddw;
+ultdw;
+jmpf @L47;
+ldiqw cg_nodes;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 44;
+addqw;
+lddw;
+ldbp 24;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L48;
+jmp @L46;
+@L48:
+ldbp 24;
+lddw;
+ldiqw inline_calls;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldxdw 4;
+notdw;
+jmpf @L49;
+ldbp 24;
+lddw;
+ldiqw inline_body_size;
+call 4;
+pop;
+ldiqw inl_size;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L49:
+@L46:
+incldw 28;
+jmp @L45;
+@L47:
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L50:
+ldbp 24;
+lddw;
+ldiqw cg_nodes_counter;
+lddw;
+ultdw;
+jmpf @L52;
+ldiqw inl_param_nid;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw free;
+call 8;
+pop;
+pop;
+@L51:
+incldw 24;
+jmp @L50;
+@L52:
+ldiqw inl_param_nid;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw inl_def;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw inl_size;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw inl_ncalls;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw inl_cg_tab;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw free_nid_map;
+call 0;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+ic_addresses:
+.res 8
+.global ic_addresses
+.bss
+.align 8
+lp_ivar:
+.res 8
+.extern cfg_outpath
+.data
+.align 4
+size_of_local_area:
+.align 4
+.dword 0
+.global size_of_local_area
+.extern analyze_unary_expression
+.extern target_arch
+# ==== start of definition of function `edge_free' ====
+.text
+edge_free:
+addsp 0;         
+# param:`p', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `number_expression_tree' ====
+.text
+number_expression_tree:
+addsp 8;         
+# param:`e', offset:-24
+@L53:
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+notdw;
+jmpf @L56;
+ldidw 3973;
+ldiqw @S4;
+ldiqw @S5;
+ldiqw @S6;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L56:
+@L54:
+ldidw 0;
+jmpf @L55;
+jmp @L53;
+@L55:
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T57;
+jmptab;
+@L59:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T60;
+switch;
+@L62:
+@L63:
+@L64:
+@L65:
+@L66:
+@L67:
+@L68:
+@L69:
+@L70:
+@L71:
+@L72:
+@L73:
+@L74:
+@L75:
+@L76:
+@L77:
+@L78:
+@L79:
+@L80:
+# var: nl, offset: 4
+# var: nr, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw number_expression_tree;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw number_expression_tree;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+eqdw;
+jmpf @L81;
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+ldbp -24;
+ldqw;
+ldiqw 88;
+addqw;
+stdw;
+pop;
+jmp @L82;
+@L81:
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+sgtdw;
+jmpf @L83;
+ldbp 4;
+lddw;
+jmp @L84;
+@L83:
+ldbp 8;
+lddw;
+@L84:
+ldbp -24;
+ldqw;
+ldiqw 88;
+addqw;
+stdw;
+pop;
+@L82:
+jmp @L61;
+@L85:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw number_expression_tree;
+call 8;
+pop;
+ldidw 1;
+adddw;
+ldbp -24;
+ldqw;
+ldiqw 88;
+addqw;
+stdw;
+pop;
+jmp @L61;
+@L61:
+.data
+.align 8
+@T60:
+.dword 20
+.dword 12
+.dword 13
+.dword 16
+.dword 17
+.dword 18
+.dword 19
+.dword 20
+.dword 21
+.dword 22
+.dword 23
+.dword 24
+.dword 25
+.dword 26
+.dword 27
+.dword 28
+.dword 29
+.dword 97
+.dword 102
+.dword 104
+.qword @L85
+.qword @L75
+.qword @L76
+.qword @L78
+.qword @L79
+.qword @L73
+.qword @L74
+.qword @L69
+.qword @L70
+.qword @L71
+.qword @L72
+.qword @L67
+.qword @L68
+.qword @L65
+.qword @L64
+.qword @L63
+.qword @L62
+.qword @L80
+.qword @L77
+.qword @L66
+.text
+jmp @L58;
+@L86:
+@L87:
+@L88:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 88;
+addqw;
+stdw;
+pop;
+jmp @L58;
+@L58:
+.data
+.align 8
+@T57:
+.dword 0
+.dword 4
+.qword @L58
+.qword @L59
+.qword @L86
+.qword @L87
+.qword @L88
+.text
+ldbp -24;
+ldqw;
+ldiqw 88;
+addqw;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern arena_destroy
+.extern liveness_and_next_use
+# ==== start of definition of function `fix_gotos' ====
+.text
+fix_gotos:
+addsp 24;        
+# var: np, offset: 8
+# var: temp, offset: 16
+@L89:
+ldiqw gotos_to_fix_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldidw 0;
+sgetdw;
+jmpf @L90;
+# var: i, offset: 24
+ldiqw gotos_to_fix;
+ldiqw gotos_to_fix_counter;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 24;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_label_address;
+call 8;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 24;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+jmp @L89;
+@L90:
+ldidw 0;
+ldiqw gotos_to_fix_counter;
+stdw;
+pop;
+ldiqw ic_labels;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L91:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L92;
+ldbp 8;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+jmp @L91;
+@L92:
+ldidw 0;
+dw2qw;
+ldiqw ic_labels;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern is_struct_union_enum
+.extern get_sizeof
+# ==== start of definition of function `build_CFG' ====
+.text
+build_CFG:
+addsp 32;        
+# var: i, offset: 4
+# var: leader, offset: 8
+# var: func_ninstr, offset: 12
+# var: leader2node, offset: 16
+ldiqw ic_instructions_counter;
+lddw;
+ldiqw ic_func_first_instr;
+lddw;
+subdw;
+ldbp 12;
+stdw;
+pop;
+ldiqw 4;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw cfg_nodes_counter;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldiqw cfg_nodes_counter;
+lddw;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_func_first_instr;
+lddw;
+ldiqw new_cfg_node;
+call 4;
+pop;
+pop;
+ldiqw cfg_nodes_counter;
+lddw;
+ldbp 16;
+ldqw;
+ldidw 1;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_func_first_instr;
+lddw;
+ldidw 1;
+adddw;
+ldiqw new_cfg_node;
+call 4;
+pop;
+pop;
+ldiqw ic_func_first_instr;
+lddw;
+ldidw 2;
+adddw;
+ldbp 4;
+stdw;
+pop;
+@L93:
+ldbp 4;
+lddw;
+ldiqw ic_instructions_counter;
+lddw;
+ultdw;
+jmpf @L95;
+# var: p, offset: 24
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T96;
+jmptab;
+@L98:
+ldiqw lab2instr;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw ic_func_first_instr;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldbp 24;
+stqw;
+lddw;
+notdw;
+jmpf @L99;
+ldiqw cfg_nodes_counter;
+lddw;
+ldbp 24;
+ldqw;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw new_cfg_node;
+call 4;
+pop;
+pop;
+@L99:
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+ldbp 8;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw ic_func_first_instr;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldbp 24;
+stqw;
+lddw;
+notdw;
+jmpf @L100;
+ldiqw cfg_nodes_counter;
+lddw;
+ldbp 24;
+ldqw;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw new_cfg_node;
+call 4;
+pop;
+pop;
+@L100:
+jmp @L97;
+@L101:
+ldiqw lab2instr;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw ic_func_first_instr;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldbp 24;
+stqw;
+lddw;
+notdw;
+jmpf @L102;
+ldiqw cfg_nodes_counter;
+lddw;
+ldbp 24;
+ldqw;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw new_cfg_node;
+call 4;
+pop;
+pop;
+@L102:
+ldiqw lab2instr;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw ic_func_first_instr;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldbp 24;
+stqw;
+lddw;
+notdw;
+jmpf @L103;
+ldiqw cfg_nodes_counter;
+lddw;
+ldbp 24;
+ldqw;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw new_cfg_node;
+call 4;
+pop;
+pop;
+@L103:
+jmp @L97;
+@L104:
+# var: j, offset: 32
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+ldbp 32;
+stdw;
+pop;
+@L105:
+ldiqw ic_instructions;
+ldqw;
+ldbp 32;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 36;
+eqdw;
+jmpf @L107;
+ldiqw lab2instr;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 32;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw ic_func_first_instr;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldbp 24;
+stqw;
+lddw;
+notdw;
+jmpf @L108;
+ldiqw cfg_nodes_counter;
+lddw;
+ldbp 24;
+ldqw;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw new_cfg_node;
+call 4;
+pop;
+pop;
+@L108:
+@L106:
+incldw 32;
+jmp @L105;
+@L107:
+jmp @L97;
+@L97:
+.data
+.align 8
+@T96:
+.dword 32
+.dword 6
+.qword @L97
+.qword @L98
+.qword @L97
+.qword @L97
+.qword @L104
+.qword @L97
+.qword @L101
+.text
+@L94:
+incldw 4;
+jmp @L93;
+@L95:
+ldiqw cfg_nodes_counter;
+lddw;
+ldidw 1;
+subdw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L109:
+ldbp 4;
+lddw;
+ldiqw cfg_nodes_counter;
+lddw;
+ultdw;
+jmpf @L111;
+# var: last, offset: 24
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+adddw;
+ldbp 24;
+stdw;
+pop;
+@L112:
+ldbp 24;
+lddw;
+ldiqw ic_instructions_counter;
+lddw;
+ultdw;
+jmpf @L114;
+ldbp 16;
+ldqw;
+ldbp 24;
+lddw;
+ldiqw ic_func_first_instr;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+notdw;
+jmpf @L114;
+ldidw 1;
+jmp @L115;
+@L114:
+ldidw 0;
+@L115:
+jmpf @L113;
+incldw 24;
+jmp @L112;
+@L113:
+ldbp 24;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T116;
+jmptab;
+@L118:
+# var: succ1, offset: 28
+# var: succ2, offset: 32
+ldiqw lab2instr;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw ic_func_first_instr;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp 28;
+stdw;
+pop;
+ldiqw lab2instr;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw ic_func_first_instr;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+ldbp 28;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw edge_add;
+call 12;
+pop;
+pop;
+ldbp 32;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw edge_add;
+call 12;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw edge_add;
+call 12;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw edge_add;
+call 12;
+pop;
+pop;
+jmp @L117;
+@L119:
+# var: succ, offset: 28
+ldiqw lab2instr;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw ic_func_first_instr;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp 28;
+stdw;
+pop;
+@L120:
+ldbp 28;
+lddw;
+ldidw 0;
+neqdw;
+notdw;
+jmpf @L123;
+ldidw 1335;
+ldiqw @S7;
+ldiqw @S8;
+ldiqw @S9;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L123:
+@L121:
+ldidw 0;
+jmpf @L122;
+jmp @L120;
+@L122:
+ldbp 28;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw edge_add;
+call 12;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw edge_add;
+call 12;
+pop;
+pop;
+jmp @L117;
+@L124:
+# var: succ, offset: 28
+@L125:
+ldiqw lab2instr;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw ic_func_first_instr;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp 28;
+stdw;
+pop;
+@L128:
+ldbp 28;
+lddw;
+ldidw 0;
+neqdw;
+notdw;
+jmpf @L131;
+ldidw 1348;
+ldiqw @S10;
+ldiqw @S11;
+ldiqw @S12;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L131:
+@L129:
+ldidw 0;
+jmpf @L130;
+jmp @L128;
+@L130:
+ldbp 28;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw edge_add;
+call 12;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw edge_add;
+call 12;
+pop;
+pop;
+decldw 24;
+@L126:
+ldiqw ic_instructions;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 36;
+eqdw;
+jmpf @L127;
+jmp @L125;
+@L127:
+jmp @L117;
+@L132:
+ldbp 24;
+lddw;
+ldiqw ic_instructions_counter;
+lddw;
+ldidw 1;
+subdw;
+neqdw;
+jmpf @L133;
+# var: succ, offset: 28
+@L134:
+ldiqw ic_instructions;
+ldqw;
+ldbp 24;
+lddw;
+ldidw 1;
+adddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 31;
+eqdw;
+notdw;
+jmpf @L137;
+ldidw 1361;
+ldiqw @S13;
+ldiqw @S14;
+ldiqw @S15;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L137:
+@L135:
+ldidw 0;
+jmpf @L136;
+jmp @L134;
+@L136:
+ldiqw lab2instr;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 24;
+lddw;
+ldidw 1;
+adddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw ic_func_first_instr;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp 28;
+stdw;
+pop;
+@L138:
+ldbp 28;
+lddw;
+ldidw 0;
+neqdw;
+notdw;
+jmpf @L141;
+ldidw 1365;
+ldiqw @S16;
+ldiqw @S17;
+ldiqw @S18;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L141:
+@L139:
+ldidw 0;
+jmpf @L140;
+jmp @L138;
+@L140:
+ldbp 28;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw edge_add;
+call 12;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw edge_add;
+call 12;
+pop;
+pop;
+@L133:
+jmp @L117;
+@L117:
+.data
+.align 8
+@T116:
+.dword 32
+.dword 6
+.qword @L132
+.qword @L119
+.qword @L132
+.qword @L132
+.qword @L132
+.qword @L124
+.qword @L118
+.text
+@L110:
+incldw 4;
+jmp @L109;
+@L111:
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw number_CFG;
+call 0;
+pop;
+pop;
+ldidw 0;
+ret;
+.data
+.align 8
+long_ty:
+.align 8
+.align 8
+.qword long_expr+0
+.align 8
+.zero 8
+# ==== start of definition of function `ic_label_statement' ====
+.text
+ic_label_statement:
+addsp 8;         
+# param:`s', offset:-24
+# var: iprev, offset: 4
+ldiqw verbose_asm;
+lddw;
+jmpf @L142;
+ldbp -24;
+ldqw;
+ldiqw ast2c;
+call 8;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L142:
+ldiqw ic_instructions_counter;
+lddw;
+ldidw 1;
+subdw;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 31;
+neqdw;
+jmpf @L143;
+# var: L, offset: 8
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw register_label;
+call 12;
+pop;
+pop;
+jmp @L144;
+@L143:
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw register_label;
+call 12;
+pop;
+pop;
+@L144:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_statement;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 4
+lp_last:
+.res 4
+.extern get_curr_scope_id
+.bss
+.align 8
+lp_hoist:
+.res 8
+.extern getenv
+.extern can_assign_to
+# ==== start of definition of function `lp_is_tracked' ====
+.text
+lp_is_tracked:
+addsp 20;        
+# param:`a', offset:-20
+# var: cat, offset: 4
+# var: e, offset: 8
+# var: tq, offset: 16
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L145;
+ldidw 1;
+dw2qw;
+ret;
+@L145:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 0;
+neqdw;
+jmpt @L146;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw is_atv;
+call 4;
+pop;
+jmpt @L146;
+ldidw 0;
+jmp @L147;
+@L146:
+ldidw 1;
+@L147:
+jmpf @L148;
+ldidw 0;
+dw2qw;
+ret;
+@L148:
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpf @L149;
+ldbp 4;
+lddw;
+ldidw 11;
+neqdw;
+jmpf @L149;
+ldidw 1;
+jmp @L150;
+@L149:
+ldidw 0;
+@L150:
+jmpf @L151;
+ldidw 0;
+dw2qw;
+ret;
+@L151:
+ldbp 4;
+lddw;
+ldidw 11;
+eqdw;
+jmpf @L152;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+jmp @L153;
+@L152:
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+@L153:
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L154;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 74;
+neqdw;
+jmpf @L156;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+neqdw;
+jmpf @L156;
+ldidw 1;
+jmp @L157;
+@L156:
+ldidw 0;
+@L157:
+jmpt @L154;
+ldidw 0;
+jmp @L155;
+@L154:
+ldidw 1;
+@L155:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern atoi
+.bss
+.align 4
+curr_cg_node:
+.res 4
+.extern bset_member
+.extern exit
+# ==== start of definition of function `function_argument2' ====
+.text
+function_argument2:
+addsp 20;        
+# param:`arg', offset:-24
+# param:`param', offset:-32
+# var: n, offset: 4
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L158;
+ldidw 0;
+dw2qw;
+ret;
+@L158:
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L159;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+neqdw;
+jmpt @L159;
+ldidw 0;
+jmp @L160;
+@L159:
+ldidw 1;
+@L160:
+jmpf @L161;
+# var: ty, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L162;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L163;
+@L162:
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L164;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+eqdw;
+jmpf @L164;
+ldidw 1;
+jmp @L165;
+@L164:
+ldidw 0;
+@L165:
+jmpf @L166;
+ldiqw new_declaration_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L166:
+@L163:
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L167;
+# var: old_info, offset: 16
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L168;
+@L167:
+ldidw 0;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L168:
+ldbp 4;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldiqw function_argument2;
+call 16;
+pop;
+adddw;
+ldbp 4;
+stdw;
+pop;
+jmp @L169;
+@L161:
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L170;
+# var: old_info, offset: 8
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L171;
+@L170:
+ldidw 0;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw ic_expression;
+call 20;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L171:
+ldbp 4;
+lddw;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldiqw function_argument2;
+call 16;
+pop;
+adddw;
+ldbp 4;
+stdw;
+pop;
+@L169:
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 4
+gotos_to_fix:
+.res 256
+# ==== start of definition of function `print_addr' ====
+.text
+print_addr:
+addsp 0;         
+# param:`addr', offset:-20
+ldbp -20;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L172;
+ldiqw 0;
+ret;
+@L172:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T173;
+jmptab;
+@L175:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S19;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+jmp @L174;
+@L176:
+@L177:
+ldiqw nid2sid_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S20;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+jmp @L174;
+@L178:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S21;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+jmp @L174;
+@L174:
+.data
+.align 8
+@T173:
+.dword 0
+.dword 4
+.qword @L174
+.qword @L175
+.qword @L178
+.qword @L177
+.qword @L176
+.text
+ldidw 0;
+ret;
+.bss
+.align 8
+var_tracked:
+.res 8
+.bss
+.align 4
+ic_addresses_counter:
+.res 4
+.global ic_addresses_counter
+# ==== start of definition of function `loop_unroll' ====
+.text
+loop_unroll:
+addsp 60;        
+# param:`L', offset:-20
+# param:`r0', offset:-24
+# param:`nlab', offset:-28
+# var: r1, offset: 4
+# var: i, offset: 8
+# var: k, offset: 12
+# var: exit_lab, offset: 16
+# var: lab_map, offset: 24
+# var: c, offset: 32
+# var: trips, offset: 36
+ldiqw loops;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 40;
+addqw;
+lddw;
+ldbp 36;
+stdw;
+pop;
+ldiqw loops;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 44;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L179;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+jmp @L180;
+@L179:
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+@L180:
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+@L181:
+ldbp 8;
+lddw;
+ldbp -28;
+lddw;
+ultdw;
+jmpf @L183;
+ldbp 8;
+lddw;
+ldbp 24;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L182:
+incldw 8;
+jmp @L181;
+@L183:
+ldidw 0;
+ldbp 32;
+stdw;
+pop;
+@L184:
+ldbp 32;
+lddw;
+ldbp 36;
+lddw;
+sltdw;
+jmpf @L186;
+ldbp 32;
+lddw;
+ldidw 0;
+sgtdw;
+jmpf @L187;
+ldbp -24;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L188:
+ldbp 8;
+lddw;
+ldbp 4;
+lddw;
+uletdw;
+jmpf @L190;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 31;
+eqdw;
+jmpf @L191;
+ldbp -28;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L191:
+@L189:
+incldw 8;
+jmp @L188;
+@L190:
+ldiqw new_nid_map;
+call 0;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L192:
+ldbp 8;
+lddw;
+ldbp 4;
+lddw;
+uletdw;
+jmpf @L194;
+ldbp 8;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+jmpf @L199;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L201;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L201;
+ldidw 0;
+jmp @L202;
+@L201:
+ldidw 1;
+@L202:
+jmpf @L199;
+ldidw 1;
+jmp @L200;
+@L199:
+ldidw 0;
+@L200:
+jmpf @L197;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L197;
+ldidw 1;
+jmp @L198;
+@L197:
+ldidw 0;
+@L198:
+jmpf @L195;
+ldiqw nid_map_stamp;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw nid_map_curr;
+lddw;
+neqdw;
+jmpf @L195;
+ldidw 1;
+jmp @L196;
+@L195:
+ldidw 0;
+@L196:
+jmpf @L203;
+ldiqw nid_map_curr;
+lddw;
+ldiqw nid_map_stamp;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L203:
+@L193:
+incldw 8;
+jmp @L192;
+@L194:
+@L187:
+ldbp -24;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L204:
+ldbp 8;
+lddw;
+ldbp 4;
+lddw;
+ultdw;
+jmpf @L206;
+# var: a, offset: 40
+# var: q, offset: 56
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldbp 56;
+stqw;
+pop;
+pop;
+ldbp 56;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 40;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 56;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 40;
+ldidw 1;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 56;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 40;
+ldidw 2;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+@L207:
+ldbp 32;
+lddw;
+ldidw 0;
+sgtdw;
+jmpf @L210;
+ldbp 12;
+lddw;
+ldidw 3;
+ultdw;
+jmpf @L210;
+ldidw 1;
+jmp @L211;
+@L210:
+ldidw 0;
+@L211:
+jmpf @L209;
+ldbp 12;
+lddw;
+ldbp 56;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_label_operand;
+call 8;
+pop;
+jmpf @L212;
+ldbp 24;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 40;
+ldbp 12;
+lddw;
+udw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldxdw 4;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 40;
+ldbp 12;
+lddw;
+udw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+neqqw;
+jmpf @L213;
+ldbp 24;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 40;
+ldbp 12;
+lddw;
+udw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldxdw 4;
+udw2qw;
+ldiqw new_label_addr;
+call 8;
+pop;
+ldbp 40;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L213:
+jmp @L214;
+@L212:
+ldbp 40;
+ldbp 12;
+lddw;
+udw2qw;
+ldxdw 4;
+jmpf @L217;
+ldiqw ic_addresses;
+ldqw;
+ldbp 40;
+ldbp 12;
+lddw;
+udw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L217;
+ldidw 1;
+jmp @L218;
+@L217:
+ldidw 0;
+@L218:
+jmpf @L215;
+ldiqw nid_map_stamp;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 40;
+ldbp 12;
+lddw;
+udw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw nid_map_curr;
+lddw;
+eqdw;
+jmpf @L215;
+ldidw 1;
+jmp @L216;
+@L215:
+ldidw 0;
+@L216:
+jmpf @L219;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 40;
+ldbp 12;
+lddw;
+udw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 40;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L219:
+@L214:
+@L208:
+incldw 12;
+jmp @L207;
+@L209:
+ldbp 40;
+ldidw 2;
+dw2qw;
+ldxdw 4;
+ldbp 40;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldbp 40;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldbp 56;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 56;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L220;
+ldiqw C_source;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw C_source;
+ldqw;
+ldiqw ic_instructions_counter;
+lddw;
+ldidw 1;
+subdw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L220:
+@L205:
+incldw 8;
+jmp @L204;
+@L206:
+ldbp 32;
+lddw;
+ldbp 36;
+lddw;
+ldidw 1;
+subdw;
+eqdw;
+jmpf @L221;
+ldidw 0;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw new_label_addr;
+call 8;
+pop;
+ldidw 0;
+dw2qw;
+ldidw 32;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L221:
+@L185:
+incldw 32;
+jmp @L184;
+@L186:
+ldbp 24;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp -28;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern stderr
+# ==== start of definition of function `is_wideval' ====
+.text
+is_wideval:
+addsp 0;         
+# param:`cat', offset:-20
+ldiqw targeting_arch64;
+lddw;
+jmpf @L222;
+ldbp -20;
+lddw;
+ldiqw @T223;
+switch;
+@L225:
+@L226:
+@L227:
+@L228:
+@L229:
+@L230:
+@L231:
+ldidw 1;
+dw2qw;
+ret;
+@L232:
+ldidw 0;
+dw2qw;
+ret;
+@L224:
+.data
+.align 8
+@T223:
+.dword 8
+.dword 11
+.dword 61
+.dword 97
+.dword 98
+.dword 109
+.dword 110
+.dword 111
+.qword @L232
+.qword @L225
+.qword @L228
+.qword @L226
+.qword @L227
+.qword @L229
+.qword @L230
+.qword @L231
+.text
+jmp @L233;
+@L222:
+ldbp -20;
+lddw;
+ldidw 110;
+eqdw;
+jmpt @L234;
+ldbp -20;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L234;
+ldidw 0;
+jmp @L235;
+@L234:
+ldidw 1;
+@L235:
+dw2qw;
+ret;
+@L233:
+ldidw 0;
+ret;
+.extern opt_level
+.extern restore_scope
+.bss
+.align 8
+cg_dotfile:
+.res 8
+.bss
+.align 8
+id_table:
+.res 8072
+.extern nid2lnid
+.bss
+.align 4
+false_addr:
+.res 4
+# ==== start of definition of function `ic_switch_statement' ====
+.text
+ic_switch_statement:
+addsp 36;        
+# param:`s', offset:-24
+# var: EXIT, offset: 4
+# var: i, offset: 8
+# var: a, offset: 12
+# var: n, offset: 16
+# var: np, offset: 24
+# var: temp, offset: 32
+ldiqw ic_switch_nesting_level;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L236;
+ldbp -24;
+ldqw;
+ldiqw ast2c;
+call 8;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L236:
+ldiqw new_label;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw push_break_target;
+call 4;
+pop;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression2;
+call 16;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldidw 35;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw ic_instructions_counter;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw ic_instructions_counter;
+lddw;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+addqw;
+pop;
+ldbp 16;
+stdw;
+pop;
+@L237:
+ldiqw ic_instructions_counter;
+lddw;
+ldbp 16;
+lddw;
+ultdw;
+jmpf @L238;
+ldidw 0;
+ldidw 0;
+ldidw 0;
+ldidw 0;
+dw2qw;
+ldidw 36;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L237;
+@L238:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_statement;
+call 8;
+pop;
+pop;
+ldiqw pop_break_target;
+call 0;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldiqw ic_case_labels;
+ldiqw ic_switch_nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L239:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L240;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+ldiqw false_addr;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+stdw;
+pop;
+incldw 8;
+ldbp 24;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+jmp @L239;
+@L240:
+ldidw 0;
+dw2qw;
+ldiqw ic_case_labels;
+ldiqw ic_switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw ic_default_labels;
+ldiqw ic_switch_nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw ic_default_labels;
+ldiqw ic_switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw false_addr;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L241;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+ldbp 24;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+jmp @L242;
+@L241:
+ldbp 4;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+@L242:
+ldiqw true_addr;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+stdw;
+pop;
+ldiqw ic_switch_nesting_level;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 4
+nloops:
+.res 4
+.bss
+.align 8
+base_node:
+.res 8
+# ==== start of definition of function `inline_args_match' ====
+.text
+inline_args_match:
+addsp 48;        
+# param:`c', offset:-20
+# param:`fn', offset:-24
+# param:`first', offset:-28
+# param:`link', offset:-36
+# var: na, offset: 4
+# var: np, offset: 8
+# var: j, offset: 12
+# var: p, offset: 16
+# var: i, offset: 24
+# var: ty, offset: 32
+ldiqw target_arch;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L243;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+ldidw 1;
+subdw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 39;
+eqdw;
+jmpf @L243;
+ldidw 1;
+jmp @L244;
+@L243:
+ldidw 0;
+@L244:
+jmpf @L245;
+ldidw 0;
+dw2qw;
+ret;
+@L245:
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+lddw;
+ldiqw inline_params;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L246:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L248;
+incldw 8;
+@L247:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L246;
+@L248:
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+neqqw;
+jmpf @L249;
+ldidw 0;
+dw2qw;
+ret;
+@L249:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldbp -36;
+ldqw;
+ldbp -20;
+lddw;
+ldbp -28;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp -28;
+lddw;
+adddw;
+ldidw 1;
+adddw;
+ldbp 24;
+stdw;
+pop;
+@L250:
+ldbp 24;
+lddw;
+ldbp -20;
+lddw;
+ultdw;
+jmpf @L252;
+ldiqw ic_instructions;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpf @L253;
+ldbp -36;
+ldqw;
+ldbp 24;
+lddw;
+ldbp -28;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp -36;
+ldqw;
+ldbp -20;
+lddw;
+ldbp -28;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+eqdw;
+jmpf @L253;
+ldidw 1;
+jmp @L254;
+@L253:
+ldidw 0;
+@L254:
+jmpf @L255;
+incldw 4;
+@L255:
+@L251:
+incldw 24;
+jmp @L250;
+@L252:
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+neqdw;
+jmpf @L256;
+ldidw 0;
+dw2qw;
+ret;
+@L256:
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+ldbp -36;
+ldqw;
+ldbp -20;
+lddw;
+ldbp -28;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp -28;
+lddw;
+adddw;
+ldidw 1;
+adddw;
+ldbp 24;
+stdw;
+pop;
+@L257:
+ldbp 24;
+lddw;
+ldbp -20;
+lddw;
+ultdw;
+jmpf @L259;
+# var: k, offset: 48
+ldiqw ic_instructions;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+neqdw;
+jmpt @L260;
+ldbp -36;
+ldqw;
+ldbp 24;
+lddw;
+ldbp -28;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp -36;
+ldqw;
+ldbp -20;
+lddw;
+ldbp -28;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+neqdw;
+jmpt @L260;
+ldidw 0;
+jmp @L261;
+@L260:
+ldidw 1;
+@L261:
+jmpf @L262;
+jmp @L258;
+@L262:
+ldiqw target_arch;
+lddw;
+ldidw 4;
+eqdw;
+jmpt @L265;
+ldiqw target_arch;
+lddw;
+ldidw 5;
+eqdw;
+jmpt @L265;
+ldidw 0;
+jmp @L266;
+@L265:
+ldidw 1;
+@L266:
+jmpf @L263;
+ldbp 12;
+lddw;
+jmp @L264;
+@L263:
+ldbp 8;
+lddw;
+ldidw 1;
+subdw;
+ldbp 12;
+lddw;
+subdw;
+@L264:
+ldbp 48;
+stdw;
+pop;
+ldbp -24;
+lddw;
+ldiqw inline_params;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L267:
+ldbp 48;
+lddw;
+ldidw 0;
+sgtdw;
+jmpf @L269;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L268:
+decldw 48;
+jmp @L267;
+@L269:
+ldbp 32;
+ldbp 16;
+ldqw;
+ldiqw is_scalar_param;
+call 16;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 32;
+ldiqw get_type_category;
+call 8;
+pop;
+neqdw;
+jmpt @L270;
+ldiqw ic_instructions;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 32;
+ldiqw get_sizeof;
+call 8;
+pop;
+neqdw;
+jmpt @L270;
+ldidw 0;
+jmp @L271;
+@L270:
+ldidw 1;
+@L271:
+jmpf @L272;
+ldidw 0;
+dw2qw;
+ret;
+@L272:
+incldw 12;
+@L258:
+incldw 24;
+jmp @L257;
+@L259:
+ldidw 1;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern rewind
+# ==== start of definition of function `free_nid_map' ====
+.text
+free_nid_map:
+addsp 0;         
+ldiqw nid_map;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw nid_map_stamp;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw nid_map_stamp;
+stqw;
+ldiqw nid_map;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw nid_map_max;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern get_type_node
+.extern analyze_logical_operator
+.extern realloc
+# ==== start of definition of function `register_label' ====
+.text
+register_label:
+addsp 12;        
+# param:`str', offset:-24
+# param:`addr', offset:-28
+# var: np, offset: 8
+ldiqw 24;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldiqw ic_labels;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw ic_labels;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern lookup_ordinary_id
+.extern ast2c
+.extern snprintf
+.bss
+.align 8
+var_ndefs:
+.res 8
+# ==== start of definition of function `inline_operand' ====
+.text
+inline_operand:
+addsp 8;         
+# param:`a', offset:-20
+# param:`is_label', offset:-24
+# param:`label_base', offset:-28
+# var: na, offset: 4
+# var: nid, offset: 8
+ldbp -20;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L273;
+ldidw 0;
+dw2qw;
+ret;
+@L273:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T274;
+jmptab;
+@L276:
+@L277:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+swap2;
+memcpy 24;
+pop;
+pop;
+ldbp -24;
+lddw;
+jmpf @L278;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+addqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L278:
+ldbp 4;
+lddw;
+udw2qw;
+ret;
+@L279:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 0;
+neqdw;
+jmpf @L280;
+ldbp -20;
+lddw;
+udw2qw;
+ret;
+@L280:
+@L281:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw nid_map_stamp;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw nid_map_curr;
+lddw;
+neqdw;
+jmpf @L282;
+ldiqw nid_map_curr;
+lddw;
+ldiqw nid_map_stamp;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L283;
+ldiqw new_temp_addr;
+call 0;
+pop;
+jmp @L284;
+@L283:
+ldidw 0;
+dw2qw;
+ldbp -20;
+lddw;
+ldiqw new_frame_var;
+call 12;
+pop;
+@L284:
+ldiqw nid_map;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L282:
+ldiqw nid_map;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ret;
+@L275:
+.data
+.align 8
+@T274:
+.dword 0
+.dword 4
+.qword @L275
+.qword @L276
+.qword @L277
+.qword @L279
+.qword @L281
+.text
+@L285:
+ldidw 0;
+notdw;
+jmpf @L288;
+ldidw 1693;
+ldiqw @S22;
+ldiqw @S23;
+ldiqw @S24;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L288:
+@L286:
+ldidw 0;
+jmpf @L287;
+jmp @L285;
+@L287:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern strpbrk
+.extern pop_struct_descriptor
+# ==== start of definition of function `emit_i' ====
+.text
+emit_i:
+addsp 16;        
+# param:`op', offset:-20
+# param:`type', offset:-28
+# param:`tar', offset:-32
+# param:`arg1', offset:-36
+# param:`arg2', offset:-40
+ldiqw ic_instructions_counter;
+lddw;
+ldiqw ic_instructions_max;
+lddw;
+ugetdw;
+jmpf @L289;
+# var: p, offset: 8
+# var: old_max, offset: 16
+ldiqw ic_instructions_max;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldiqw ic_instructions_max;
+lddw;
+ldidw 2;
+muldw;
+ldiqw ic_instructions_max;
+stdw;
+pop;
+ldiqw ic_instructions_max;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+ldiqw ic_instructions;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L290;
+ldiqw @S25;
+ldiqw ic_out_of_memory;
+call 8;
+pop;
+pop;
+@L290:
+ldbp 8;
+ldqw;
+ldiqw ic_instructions;
+stqw;
+pop;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L291;
+ldiqw ic_instructions_max;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+ldiqw C_source;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L292;
+ldiqw @S26;
+ldiqw ic_out_of_memory;
+call 8;
+pop;
+pop;
+@L292:
+ldbp 8;
+ldqw;
+ldiqw C_source;
+stqw;
+pop;
+pop;
+ldiqw 8;
+ldiqw ic_instructions_max;
+lddw;
+ldbp 16;
+lddw;
+subdw;
+udw2qw;
+mulqw;
+ldidw 0;
+ldiqw C_source;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+@L291:
+@L289:
+ldbp -20;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldiqw ic_instructions_counter;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp -28;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldiqw ic_instructions_counter;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldiqw ic_instructions_counter;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldbp -36;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldiqw ic_instructions_counter;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+ldbp -40;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldiqw ic_instructions_counter;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+nid2sid_tab:
+.res 8
+.global nid2sid_tab
+.bss
+.align 4
+nivs:
+.res 4
+# ==== start of definition of function `ic_while_statement' ====
+.text
+ic_while_statement:
+addsp 24;        
+# param:`s', offset:-24
+# var: ce, offset: 8
+# var: L1, offset: 16
+# var: L2, offset: 20
+# var: L3, offset: 24
+ldiqw new_label;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L293;
+ldbp -24;
+ldqw;
+ldiqw ast2c;
+call 8;
+ldbp 8;
+stqw;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L293:
+ldbp 24;
+lddw;
+ldbp 16;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_controlling_expression;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldiqw push_break_target;
+call 4;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldiqw push_continue_target;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_statement;
+call 8;
+pop;
+pop;
+ldiqw pop_break_target;
+call 0;
+pop;
+pop;
+ldiqw pop_continue_target;
+call 0;
+pop;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L294;
+ldbp 8;
+ldqw;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L294:
+ldbp 20;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldbp 16;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_controlling_expression;
+call 16;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+memset_node:
+.res 104
+.extern fseek
+.extern opt_main
+.extern push_struct_descriptor
+# ==== start of definition of function `loop_contains' ====
+.text
+loop_contains:
+addsp 0;         
+# param:`outer', offset:-20
+# param:`L', offset:-24
+@L295:
+ldbp -24;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L297;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+eqdw;
+jmpf @L298;
+ldidw 1;
+dw2qw;
+ret;
+@L298:
+@L296:
+ldiqw loops;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+jmp @L295;
+@L297:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `new_label' ====
+.text
+new_label:
+addsp 12;        
+# var: L, offset: 4
+ldiqw label_counter;
+lddw;
+ldiqw label_max;
+lddw;
+sgetdw;
+jmpf @L299;
+# var: p, offset: 8
+ldiqw label_max;
+lddw;
+ldidw 2;
+muldw;
+ldiqw label_max;
+stdw;
+pop;
+ldiqw label_max;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw lab2instr;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L300;
+ldiqw @S27;
+ldiqw ic_out_of_memory;
+call 8;
+pop;
+pop;
+@L300:
+ldbp 8;
+ldqw;
+ldiqw lab2instr;
+stqw;
+pop;
+pop;
+@L299:
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw label_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 8
+var_def:
+.res 8
+.extern sscanf
+.extern fputc
+# ==== start of definition of function `compute_arguments' ====
+.text
+compute_arguments:
+addsp 12;        
+# param:`arg', offset:-24
+# param:`param', offset:-32
+# param:`ca', offset:-40
+# var: n, offset: 4
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L301;
+ldidw 0;
+dw2qw;
+ret;
+@L301:
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L302;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+neqdw;
+jmpt @L302;
+ldidw 0;
+jmp @L303;
+@L302:
+ldidw 1;
+@L303:
+jmpf @L304;
+# var: ty, offset: 8
+ldbp 4;
+lddw;
+ldbp -40;
+ldqw;
+ldidw 1;
+dw2qw;
+ldiqw 24;
+mulqw;
+addqw;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldiqw compute_arguments;
+call 24;
+pop;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L305;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+eqdw;
+jmpf @L305;
+ldidw 1;
+jmp @L306;
+@L305:
+ldidw 0;
+@L306:
+jmpf @L307;
+ldiqw new_declaration_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L307:
+ldbp 8;
+ldqw;
+ldbp -40;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L308;
+@L304:
+ldbp 4;
+lddw;
+ldbp -40;
+ldqw;
+ldidw 1;
+dw2qw;
+ldiqw 24;
+mulqw;
+addqw;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldiqw compute_arguments;
+call 24;
+pop;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -40;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L308:
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 8
+temp_names_arena:
+.res 8
+# ==== start of definition of function `function_argument' ====
+.text
+function_argument:
+addsp 12;        
+# param:`arg', offset:-24
+# param:`param', offset:-32
+# var: n, offset: 4
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L309;
+ldidw 0;
+dw2qw;
+ret;
+@L309:
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L310;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+neqdw;
+jmpt @L310;
+ldidw 0;
+jmp @L311;
+@L310:
+ldidw 1;
+@L311:
+jmpf @L312;
+# var: ty, offset: 8
+ldbp 4;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldiqw function_argument;
+call 16;
+pop;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L313;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+eqdw;
+jmpf @L313;
+ldidw 1;
+jmp @L314;
+@L313:
+ldidw 0;
+@L314:
+jmpf @L315;
+ldiqw new_declaration_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L315:
+ldidw 0;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L316;
+@L312:
+ldbp 4;
+lddw;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldiqw function_argument;
+call 16;
+pop;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw ic_expression;
+call 20;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L316:
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `inline_body_size' ====
+.text
+inline_body_size:
+addsp 76;        
+# param:`fn', offset:-20
+# var: n, offset: 4
+# var: cat, offset: 8
+# var: p, offset: 16
+# var: ty, offset: 24
+# var: i, offset: 40
+# var: first, offset: 44
+# var: last, offset: 48
+ldiqw inl_def;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L317;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L317;
+ldidw 0;
+jmp @L318;
+@L317:
+ldidw 1;
+@L318:
+jmpf @L319;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L319:
+ldiqw inl_def;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw inl_def;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+ldidw 73;
+neqdw;
+jmpf @L322;
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpf @L322;
+ldidw 1;
+jmp @L323;
+@L322:
+ldidw 0;
+@L323:
+jmpf @L320;
+ldbp 8;
+lddw;
+ldidw 11;
+neqdw;
+jmpf @L320;
+ldidw 1;
+jmp @L321;
+@L320:
+ldidw 0;
+@L321:
+jmpf @L324;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L324:
+ldbp -20;
+lddw;
+ldiqw inline_params;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L325:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L327;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L330;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpt @L330;
+ldidw 0;
+jmp @L331;
+@L330:
+ldidw 1;
+@L331:
+jmpt @L328;
+ldbp 24;
+ldbp 16;
+ldqw;
+ldiqw is_scalar_param;
+call 16;
+pop;
+notdw;
+jmpt @L328;
+ldidw 0;
+jmp @L329;
+@L328:
+ldidw 1;
+@L329:
+jmpf @L332;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L332:
+@L326:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L325;
+@L327:
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 44;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 48;
+stdw;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldbp 44;
+lddw;
+ldidw 2;
+adddw;
+ldbp 40;
+stdw;
+pop;
+@L333:
+ldbp 40;
+lddw;
+ldbp 48;
+lddw;
+ldidw 2;
+subdw;
+ultdw;
+jmpf @L335;
+# var: a, offset: 52
+# var: j, offset: 64
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 39;
+eqdw;
+jmpt @L336;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 31;
+eqdw;
+jmpt @L336;
+ldidw 0;
+jmp @L337;
+@L336:
+ldidw 1;
+@L337:
+jmpf @L338;
+jmp @L334;
+@L338:
+incldw 4;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 52;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 52;
+ldidw 1;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 52;
+ldidw 2;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 64;
+stdw;
+pop;
+@L339:
+ldbp 64;
+lddw;
+ldidw 3;
+sltdw;
+jmpf @L341;
+# var: e, offset: 72
+ldbp 52;
+ldbp 64;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+jmpt @L342;
+ldiqw ic_addresses;
+ldqw;
+ldbp 52;
+ldbp 64;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+neqdw;
+jmpt @L342;
+ldidw 0;
+jmp @L343;
+@L342:
+ldidw 1;
+@L343:
+jmpf @L344;
+jmp @L340;
+@L344:
+ldiqw ic_addresses;
+ldqw;
+ldbp 52;
+ldbp 64;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 72;
+stqw;
+pop;
+pop;
+ldbp 72;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L345;
+ldbp 72;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L345;
+ldidw 1;
+jmp @L346;
+@L345:
+ldidw 0;
+@L346:
+jmpf @L347;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L347:
+@L340:
+incldw 64;
+jmp @L339;
+@L341:
+@L334:
+incldw 40;
+jmp @L333;
+@L335:
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern vsscanf
+.extern dflow_enter_function
+# ==== start of definition of function `inline_call_target' ====
+.text
+inline_call_target:
+addsp 4;         
+# param:`i', offset:-20
+# var: a, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 28;
+neqdw;
+jmpt @L350;
+ldbp 4;
+lddw;
+ldiqw memset_addr;
+lddw;
+eqdw;
+jmpt @L350;
+ldidw 0;
+jmp @L351;
+@L350:
+ldidw 1;
+@L351:
+jmpt @L348;
+ldbp 4;
+lddw;
+ldiqw memcpy_addr;
+lddw;
+eqdw;
+jmpt @L348;
+ldidw 0;
+jmp @L349;
+@L348:
+ldidw 1;
+@L349:
+jmpf @L352;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L352:
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw inline_find_cg_node;
+call 8;
+pop;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 4
+lp_first:
+.res 4
+.bss
+.align 4
+gotos_to_fix_counter:
+.res 4
+.extern fwrite
+.data
+.align 4
+ic_switch_nesting_level:
+.align 4
+.dword -1
+.extern is_pointer
+# ==== start of definition of function `get_step_size' ====
+.text
+get_step_size:
+addsp 20;        
+# param:`e', offset:-24
+# var: a, offset: 4
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L353;
+ldidw 1;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L354;
+@L353:
+# var: ty, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 8;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L354:
+ldbp 4;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern colored_diagnostics
+.extern read_stream
+# ==== start of definition of function `number_CG' ====
+.text
+number_CG:
+addsp 8;         
+# var: n, offset: 4
+# var: n2, offset: 8
+ldiqw 4;
+ldiqw cg_nodes_counter;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldiqw visited;
+stqw;
+pop;
+pop;
+ldiqw cg_nodes_counter;
+lddw;
+ldiqw nunvisited;
+stdw;
+pop;
+ldidw 0;
+ldiqw pocount;
+stdw;
+pop;
+@L355:
+ldiqw nunvisited;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L356;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L357:
+ldbp 4;
+lddw;
+ldiqw cg_nodes_counter;
+lddw;
+ultdw;
+jmpf @L359;
+ldiqw visited;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxdw 4;
+notdw;
+jmpf @L360;
+jmp @L359;
+@L360:
+@L358:
+incldw 4;
+jmp @L357;
+@L359:
+ldbp 4;
+lddw;
+ldiqw number_subCG;
+call 4;
+pop;
+pop;
+jmp @L355;
+@L356:
+ldiqw cg_nodes_counter;
+lddw;
+ldidw 1;
+subdw;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L361:
+ldbp 4;
+lddw;
+ldiqw cg_nodes_counter;
+lddw;
+ultdw;
+jmpf @L363;
+ldiqw cg_nodes;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 44;
+addqw;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 48;
+addqw;
+stdw;
+pop;
+@L362:
+decldw 8;
+ldbp 4;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+pop;
+jmp @L361;
+@L363:
+ldiqw visited;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern strspn
+.extern location_pop_scope
+# ==== start of definition of function `pop_continue_target' ====
+.text
+pop_continue_target:
+addsp 0;         
+ldiqw ct_stack_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+ic_labels:
+.res 8
+.extern reset_enum_val
+.extern strtoll
+.extern analyze_relational_equality_expression
+# ==== start of definition of function `get_var_nid' ====
+.text
+get_var_nid:
+.global get_var_nid
+addsp 16;        
+# param:`sid', offset:-24
+# param:`scope', offset:-28
+# var: np, offset: 8
+# var: h, offset: 16
+ldbp -24;
+ldqw;
+ldiqw hash;
+call 8;
+pop;
+ldidw 1009;
+umoddw;
+ldbp 16;
+stdw;
+pop;
+ldiqw id_table;
+ldbp 16;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L364:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L366;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L367;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp -28;
+lddw;
+eqdw;
+jmpf @L367;
+ldidw 1;
+jmp @L368;
+@L367:
+ldidw 0;
+@L368:
+jmpf @L369;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ret;
+@L369:
+@L365:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L364;
+@L366:
+ldiqw 24;
+pop;
+ldiqw id_table_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldiqw nid_counter;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldiqw id_table;
+ldbp 16;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw id_table;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw new_nid;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `pop_break_target' ====
+.text
+pop_break_target:
+addsp 0;         
+ldiqw bt_stack_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+.extern get_sto_class_spec
+.extern bset_cpy
+# ==== start of definition of function `inline_reaches' ====
+.text
+inline_reaches:
+addsp 8;         
+# param:`from', offset:-20
+# param:`to', offset:-24
+# param:`seen', offset:-32
+# var: i, offset: 4
+ldidw 1;
+dw2b;
+ldbp -32;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+addqw;
+stb;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L370:
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ultdw;
+jmpf @L372;
+# var: succ, offset: 8
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldbp -24;
+lddw;
+eqdw;
+jmpt @L373;
+ldbp -32;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldxb 1;
+notdw;
+jmpf @L375;
+ldbp -32;
+ldqw;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw inline_reaches;
+call 16;
+pop;
+jmpf @L375;
+ldidw 1;
+jmp @L376;
+@L375:
+ldidw 0;
+@L376:
+jmpt @L373;
+ldidw 0;
+jmp @L374;
+@L373:
+ldidw 1;
+@L374:
+jmpf @L377;
+ldidw 1;
+dw2qw;
+ret;
+@L377:
+@L371:
+incldw 4;
+jmp @L370;
+@L372:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `ic_zero' ====
+.text
+ic_zero:
+addsp 16;        
+# param:`id', offset:-20
+# param:`offset', offset:-24
+# param:`nb', offset:-28
+# var: a1, offset: 4
+ldiqw target_arch;
+lddw;
+ldidw 4;
+eqdw;
+jmpt @L378;
+ldiqw target_arch;
+lddw;
+ldidw 5;
+eqdw;
+jmpt @L378;
+ldidw 0;
+jmp @L379;
+@L378:
+ldidw 1;
+@L379:
+jmpf @L380;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp -20;
+lddw;
+ldbp 4;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 25;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldidw 0;
+ugtdw;
+jmpf @L381;
+# var: a2, offset: 8
+# var: a3, offset: 12
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+lddw;
+ldbp 12;
+lddw;
+ldiqw long_ty;
+ldidw 0;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L381:
+ldidw 0;
+ldbp 4;
+lddw;
+ldidw 0;
+ldiqw int_ty;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+lddw;
+ldidw 0;
+ldiqw int_ty;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+lddw;
+ldidw 0;
+ldiqw unsigned_ty;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L382;
+@L380:
+# var: a4, offset: 8
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp -20;
+lddw;
+ldbp 8;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 25;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldidw 0;
+ugtdw;
+jmpf @L383;
+# var: a2, offset: 12
+# var: a3, offset: 16
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldbp 8;
+lddw;
+ldbp 16;
+lddw;
+ldiqw long_ty;
+ldidw 0;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L383:
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+lddw;
+ldidw 0;
+ldiqw unsigned_ty;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+lddw;
+ldidw 0;
+ldiqw int_ty;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+lddw;
+ldidw 0;
+ldiqw int_ty;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L382:
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldidw 3;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw memset_addr;
+lddw;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldiqw int_ty;
+ldidw 28;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern fclose
+# ==== start of definition of function `aligned_function_argument' ====
+.text
+aligned_function_argument:
+addsp 44;        
+# param:`arg', offset:-24
+# param:`param', offset:-32
+# var: tp, offset: 8
+# var: ta, offset: 16
+# var: ty, offset: 24
+# var: arg_addr, offset: 32
+# var: ca, offset: 40
+ldbp -24;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L384:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L385;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L386;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+neqdw;
+jmpt @L386;
+ldidw 0;
+jmp @L387;
+@L386:
+ldidw 1;
+@L387:
+jmpf @L388;
+ldbp 16;
+ldqw;
+ldiqw contains_function_call;
+call 8;
+pop;
+notdw;
+jmpf @L389;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @@aligned_function_argument_next;
+@L389:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L390;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+eqdw;
+jmpf @L390;
+ldidw 1;
+jmp @L391;
+@L390:
+ldidw 0;
+@L391:
+jmpf @L392;
+ldiqw new_declaration_node;
+call 0;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L392:
+ldbp 24;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L393;
+@L388:
+ldbp 16;
+ldqw;
+ldiqw contains_function_call;
+call 8;
+pop;
+notdw;
+jmpf @L394;
+jmp @@aligned_function_argument_next;
+@L394:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp 16;
+ldqw;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L393:
+ldiqw 24;
+ldiqw malloc;
+call 8;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+lddw;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldbp 40;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 96;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+negdw;
+ldbp 16;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+@@aligned_function_argument_next:
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L384;
+@L385:
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw function_argument2;
+call 16;
+pop;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `ic_do_statement' ====
+.text
+ic_do_statement:
+addsp 16;        
+# param:`s', offset:-24
+# var: iprev, offset: 4
+# var: L1, offset: 8
+# var: L2, offset: 12
+# var: L3, offset: 16
+ldiqw new_label;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldiqw ic_instructions_counter;
+lddw;
+ldidw 1;
+subdw;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 31;
+neqdw;
+jmpf @L395;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+jmp @L396;
+@L395:
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L396:
+ldbp 16;
+lddw;
+ldiqw push_break_target;
+call 4;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw push_continue_target;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_statement;
+call 8;
+pop;
+pop;
+ldiqw pop_break_target;
+call 0;
+pop;
+pop;
+ldiqw pop_continue_target;
+call 0;
+pop;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L397;
+ldbp -24;
+ldqw;
+ldiqw ast2c;
+call 8;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L397:
+ldbp 12;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 8;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_controlling_expression;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern preprocess
+.extern analyze_decl_specs
+.extern strstr
+.extern calloc
+.extern pop_scope
+.bss
+.align 8
+loops:
+.res 8
+.extern memset
+# ==== start of definition of function `count_labels' ====
+.text
+count_labels:
+addsp 8;         
+# param:`first', offset:-20
+# param:`last', offset:-24
+# var: i, offset: 4
+# var: n, offset: 8
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L398:
+ldbp 4;
+lddw;
+ldbp -24;
+lddw;
+uletdw;
+jmpf @L400;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 31;
+eqdw;
+jmpf @L401;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ugetqw;
+jmpf @L401;
+ldidw 1;
+jmp @L402;
+@L401:
+ldidw 0;
+@L402:
+jmpf @L403;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldidw 1;
+adddw;
+ldbp 8;
+stdw;
+pop;
+@L403:
+@L399:
+incldw 4;
+jmp @L398;
+@L400:
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 4
+nid_map_curr:
+.res 4
+.extern file_exists
+.extern include_libc
+.bss
+.align 8
+C_source:
+.res 8
+.global C_source
+.extern analyze_cast_expression
+.extern location_push_scope
+.bss
+.align 4
+ctarget_stack:
+.res 512
+.extern stringify_type_exp
+.extern add_quote_dir
+.bss
+.align 8
+ic_default_labels:
+.res 128
+.global ic_default_labels
+# ==== start of definition of function `emit_copy' ====
+.text
+emit_copy:
+addsp 0;         
+# param:`i', offset:-20
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L404;
+ldiqw C_source;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw C_source;
+ldqw;
+ldiqw ic_instructions_counter;
+lddw;
+ldidw 1;
+subdw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L404:
+ldidw 0;
+ret;
+# ==== start of definition of function `loop_invariant' ====
+.text
+loop_invariant:
+addsp 8;         
+# param:`a', offset:-20
+# param:`L', offset:-24
+# var: v, offset: 4
+# var: d, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L405;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L405;
+ldidw 0;
+jmp @L406;
+@L405:
+ldidw 1;
+@L406:
+jmpf @L407;
+ldidw 1;
+dw2qw;
+ret;
+@L407:
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L408;
+ldiqw var_ndefs;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+neqdw;
+jmpf @L409;
+ldidw 0;
+dw2qw;
+ret;
+@L409:
+ldiqw var_def;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldiqw lp_blk;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldiqw loops;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpt @L410;
+ldiqw lp_hoist;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L412;
+ldbp -24;
+lddw;
+ldiqw lp_hoist;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldiqw loop_contains;
+call 8;
+pop;
+jmpf @L412;
+ldidw 1;
+jmp @L413;
+@L412:
+ldidw 0;
+@L413:
+jmpt @L410;
+ldidw 0;
+jmp @L411;
+@L410:
+ldidw 1;
+@L411:
+dw2qw;
+ret;
+@L408:
+ldiqw var_tracked;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxb 1;
+jmpf @L414;
+ldbp 4;
+lddw;
+ldiqw loops;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L414;
+ldidw 1;
+jmp @L415;
+@L414:
+ldidw 0;
+@L415:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern stat_number_of_ast_nodes
+.extern strtoul
+.bss
+.align 4
+atv_max:
+.res 4
+.extern fprintf
+.extern get_type_qual
+.extern read_file
+.bss
+.align 8
+address_taken_variables:
+.res 8
+.global address_taken_variables
+.extern is_signed_int
+.extern printf
+.extern get_c_token
+# ==== start of definition of function `ic_auto_init' ====
+.text
+ic_auto_init:
+addsp 44;        
+# param:`ds', offset:-24
+# param:`dct', offset:-32
+# param:`e', offset:-40
+# param:`id', offset:-44
+# param:`offset', offset:-48
+# var: ts, offset: 8
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L416;
+# var: nelem, offset: 16
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L417;
+jmp @@ic_auto_init_scalar;
+@L417:
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L418;
+# var: a1, offset: 20
+# var: n, offset: 24
+# var: nfill, offset: 28
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldidw 0;
+ldbp 28;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldbp 24;
+lddw;
+eqdw;
+jmpf @L419;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L420;
+@L419:
+ldbp 16;
+lddw;
+ldbp 24;
+lddw;
+ultdw;
+jmpf @L421;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L422;
+@L421:
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 24;
+lddw;
+subdw;
+ldbp 28;
+stdw;
+pop;
+@L422:
+@L420:
+ldiqw target_arch;
+lddw;
+ldidw 4;
+eqdw;
+jmpt @L423;
+ldiqw target_arch;
+lddw;
+ldidw 5;
+eqdw;
+jmpt @L423;
+ldidw 0;
+jmp @L424;
+@L423:
+ldidw 1;
+@L424:
+jmpf @L425;
+# var: a2, offset: 32
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldidw 0;
+ldbp -44;
+lddw;
+ldbp 32;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 25;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp -48;
+lddw;
+ldidw 0;
+ugtdw;
+jmpf @L426;
+# var: a3, offset: 36
+# var: a4, offset: 40
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 36;
+stdw;
+pop;
+ldbp -48;
+lddw;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 40;
+stdw;
+pop;
+ldbp 36;
+lddw;
+ldbp 32;
+lddw;
+ldbp 40;
+lddw;
+ldiqw long_ty;
+ldidw 0;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 40;
+lddw;
+ldbp 32;
+stdw;
+pop;
+@L426:
+ldidw 0;
+ldbp 32;
+lddw;
+ldidw 0;
+ldiqw int_ty;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 1;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 32;
+lddw;
+ldidw 0;
+ldiqw int_ty;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldbp 20;
+lddw;
+ldidw 0;
+ldiqw int_ty;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L427;
+@L425:
+# var: a2, offset: 32
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldidw 0;
+ldbp -44;
+lddw;
+ldbp 32;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 25;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp -48;
+lddw;
+ldidw 0;
+ugtdw;
+jmpf @L428;
+# var: a3, offset: 36
+# var: a4, offset: 40
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 36;
+stdw;
+pop;
+ldbp -48;
+lddw;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 40;
+stdw;
+pop;
+ldbp 36;
+lddw;
+ldbp 32;
+lddw;
+ldbp 40;
+lddw;
+ldiqw long_ty;
+ldidw 0;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 40;
+lddw;
+ldbp 32;
+stdw;
+pop;
+@L428:
+ldidw 0;
+ldbp 20;
+lddw;
+ldidw 0;
+ldiqw int_ty;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 1;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 20;
+lddw;
+ldidw 0;
+ldiqw int_ty;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldbp 32;
+lddw;
+ldidw 0;
+ldiqw int_ty;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L427:
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldidw 3;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldiqw memcpy_addr;
+lddw;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldiqw int_ty;
+ldidw 28;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 28;
+lddw;
+ldidw 0;
+ugtdw;
+jmpf @L429;
+ldbp 28;
+lddw;
+ldbp -48;
+lddw;
+ldbp 24;
+lddw;
+adddw;
+ldbp -44;
+lddw;
+ldiqw ic_zero;
+call 12;
+pop;
+pop;
+@L429:
+ldidw 0;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+jmp @L430;
+@L418:
+# var: elem_size, offset: 20
+# var: ty, offset: 24
+ldbp -24;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L431:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L434;
+ldbp 16;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L434;
+ldidw 1;
+jmp @L435;
+@L434:
+ldidw 0;
+@L435:
+jmpf @L433;
+ldbp -48;
+lddw;
+ldbp -44;
+lddw;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw ic_auto_init;
+call 32;
+pop;
+pop;
+ldbp -48;
+lddw;
+ldbp 20;
+lddw;
+adddw;
+ldbp -48;
+stdw;
+pop;
+@L432:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 16;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+jmp @L431;
+@L433:
+ldbp 16;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L436;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+muldw;
+ldbp -48;
+lddw;
+ldbp -44;
+lddw;
+ldiqw ic_zero;
+call 12;
+pop;
+pop;
+@L436:
+@L430:
+jmp @L437;
+@L416:
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 68;
+eqdw;
+jmpf @L438;
+# var: d, offset: 16
+# var: full_init, offset: 24
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+neqdw;
+jmpf @L439;
+jmp @@ic_auto_init_scalar;
+@L439:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L440:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L442;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L443:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L446;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L446;
+ldidw 1;
+jmp @L447;
+@L446:
+ldidw 0;
+@L447:
+jmpf @L445;
+# var: mem_offs, offset: 28
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw get_member_descriptor;
+call 16;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 28;
+stdw;
+pop;
+ldbp -48;
+lddw;
+ldbp 28;
+lddw;
+adddw;
+ldbp -44;
+lddw;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw ic_auto_init;
+call 32;
+pop;
+pop;
+@L444:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L443;
+@L445:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L448;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L449;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L449;
+ldidw 1;
+jmp @L450;
+@L449:
+ldidw 0;
+@L450:
+jmpf @L451;
+ldidw 1;
+ldbp 24;
+stdw;
+pop;
+@L451:
+jmp @L442;
+@L448:
+@L441:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L440;
+@L442:
+ldbp 24;
+lddw;
+notdw;
+jmpf @L452;
+# var: p1, offset: 28
+# var: p2, offset: 32
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L453;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L453:
+ldidw 1;
+negdw;
+ldbp 28;
+stdw;
+pop;
+@L454:
+ldidw 1;
+jmpf @L455;
+@L456:
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L457;
+# var: md, offset: 40
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw get_member_descriptor;
+call 16;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 28;
+lddw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L458;
+ldbp -48;
+lddw;
+ldbp 40;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+adddw;
+ldbp 28;
+stdw;
+pop;
+ldbp 28;
+lddw;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+adddw;
+ldbp 32;
+stdw;
+pop;
+jmp @L459;
+@L458:
+ldbp -48;
+lddw;
+ldbp 40;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+adddw;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+adddw;
+ldbp 32;
+stdw;
+pop;
+@L459:
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L456;
+@L457:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L460;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L461;
+@L460:
+jmp @L455;
+@L461:
+jmp @L454;
+@L455:
+ldbp 32;
+lddw;
+ldbp 28;
+lddw;
+subdw;
+ldbp 28;
+lddw;
+ldbp -44;
+lddw;
+ldiqw ic_zero;
+call 12;
+pop;
+pop;
+@L452:
+jmp @L462;
+@L438:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+jmpf @L463;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+neqdw;
+jmpf @L464;
+jmp @@ic_auto_init_scalar;
+@L464:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -48;
+lddw;
+ldbp -44;
+lddw;
+ldbp -40;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw ic_auto_init;
+call 32;
+pop;
+pop;
+jmp @L465;
+@L463:
+# var: a1, offset: 16
+# var: ty, offset: 24
+@@ic_auto_init_scalar:
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L466;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+eqdw;
+jmpf @L466;
+ldidw 1;
+jmp @L467;
+@L466:
+ldidw 0;
+@L467:
+jmpf @L468;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L468:
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldidw 0;
+ldbp -44;
+lddw;
+ldbp 16;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 25;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp -48;
+lddw;
+ldidw 0;
+ugtdw;
+jmpf @L469;
+# var: a2, offset: 32
+# var: a3, offset: 36
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldbp -48;
+lddw;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 36;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldbp 16;
+lddw;
+ldbp 36;
+lddw;
+ldiqw long_ty;
+ldidw 0;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 36;
+lddw;
+ldbp 16;
+stdw;
+pop;
+@L469:
+ldiqw new_declaration_node;
+call 0;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldbp -40;
+ldqw;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 16;
+lddw;
+ldidw 0;
+ldbp 24;
+ldqw;
+ldidw 30;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L465:
+@L462:
+@L437:
+ldidw 0;
+ret;
+.extern lookup_tag
+# ==== start of definition of function `quad_def' ====
+.text
+quad_def:
+addsp 0;         
+# param:`i', offset:-20
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T470;
+jmptab;
+@L472:
+@L473:
+@L474:
+@L475:
+@L476:
+@L477:
+@L478:
+@L479:
+@L480:
+@L481:
+@L482:
+@L483:
+@L484:
+@L485:
+@L486:
+@L487:
+@L488:
+@L489:
+@L490:
+@L491:
+@L492:
+@L493:
+@L494:
+@L495:
+@L496:
+@L497:
+@L498:
+@L499:
+@L500:
+@L501:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ret;
+@L502:
+ldidw 0;
+dw2qw;
+ret;
+@L471:
+.data
+.align 8
+@T470:
+.dword 0
+.dword 30
+.qword @L502
+.qword @L472
+.qword @L473
+.qword @L474
+.qword @L475
+.qword @L476
+.qword @L477
+.qword @L478
+.qword @L479
+.qword @L480
+.qword @L481
+.qword @L482
+.qword @L483
+.qword @L484
+.qword @L485
+.qword @L486
+.qword @L487
+.qword @L488
+.qword @L489
+.qword @L490
+.qword @L491
+.qword @L492
+.qword @L493
+.qword @L494
+.qword @L495
+.qword @L496
+.qword @L497
+.qword @L498
+.qword @L499
+.qword @L500
+.qword @L501
+.text
+ldidw 0;
+ret;
+# ==== start of definition of function `ic_reset' ====
+.text
+ic_reset:
+addsp 0;         
+ldidw 0;
+ldiqw label_counter;
+stdw;
+pop;
+ldidw 0;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldidw 0;
+ldiqw local_offset;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw base_node;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `ic_find_atv' ====
+.text
+ic_find_atv:
+addsp 12;        
+# var: np, offset: 8
+ldiqw static_objects_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L503:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L505;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L506;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw ic_find_atv_in_init;
+call 24;
+pop;
+pop;
+@L506:
+@L504:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L503;
+@L505:
+ldidw 0;
+ret;
+.extern get_rank
+# ==== start of definition of function `replace_function_body' ====
+.text
+replace_function_body:
+addsp 12;        
+# param:`fn', offset:-20
+# param:`new_first', offset:-24
+# param:`nlabels', offset:-28
+# var: i, offset: 4
+ldbp -28;
+lddw;
+ldiqw label_max;
+lddw;
+ugtdw;
+jmpf @L507;
+# var: p, offset: 8
+ldbp -28;
+lddw;
+ldiqw label_max;
+stdw;
+pop;
+ldiqw label_max;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw lab2instr;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L508;
+ldiqw @S28;
+ldiqw ic_out_of_memory;
+call 8;
+pop;
+pop;
+@L508:
+ldbp 8;
+ldqw;
+ldiqw lab2instr;
+stqw;
+pop;
+pop;
+@L507:
+ldbp -24;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L509:
+ldbp 4;
+lddw;
+ldiqw ic_instructions_counter;
+lddw;
+ultdw;
+jmpf @L511;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 31;
+eqdw;
+jmpf @L512;
+ldbp 4;
+lddw;
+ldiqw lab2instr;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L512:
+@L510:
+incldw 4;
+jmp @L509;
+@L511:
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L513:
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+uletdw;
+jmpf @L515;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw edge_free;
+call 8;
+pop;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw edge_free;
+call 8;
+pop;
+pop;
+@L514:
+incldw 4;
+jmp @L513;
+@L515:
+ldbp -24;
+lddw;
+ldiqw ic_func_first_instr;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldiqw curr_cg_node;
+stdw;
+pop;
+ldiqw build_CFG;
+call 0;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `number_subCFG' ====
+.text
+number_subCFG:
+addsp 8;         
+# param:`n', offset:-20
+# var: i, offset: 4
+ldidw 1;
+ldiqw visited;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw nunvisited;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L516:
+ldbp 4;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ultdw;
+jmpf @L518;
+# var: succ, offset: 8
+ldiqw cfg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldiqw visited;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+notdw;
+jmpf @L519;
+ldbp 8;
+lddw;
+ldiqw number_subCFG;
+call 4;
+pop;
+pop;
+@L519:
+@L517:
+incldw 4;
+jmp @L516;
+@L518:
+ldbp -20;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw pocount;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 72;
+addqw;
+stdw;
+pop;
+ldiqw pocount;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+.extern is_external_id
+.data
+.align 4
+bt_stack_top:
+.align 4
+.dword -1
+# ==== start of definition of function `new_nid' ====
+.text
+new_nid:
+addsp 12;        
+# param:`sid', offset:-24
+ldiqw nid_counter;
+lddw;
+ldiqw nid_max;
+lddw;
+sgetdw;
+jmpf @L520;
+# var: p, offset: 8
+ldiqw nid_max;
+lddw;
+ldidw 2;
+muldw;
+ldiqw nid_max;
+stdw;
+pop;
+ldiqw nid_max;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+ldiqw nid2sid_tab;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L521;
+ldiqw @S29;
+ldiqw ic_out_of_memory;
+call 8;
+pop;
+pop;
+@L521:
+ldbp 8;
+ldqw;
+ldiqw nid2sid_tab;
+stqw;
+pop;
+pop;
+@L520:
+ldbp -24;
+ldqw;
+ldiqw nid2sid_tab;
+ldqw;
+ldiqw nid_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern sprintf
+.bss
+.align 4
+nid_map_max:
+.res 4
+# ==== start of definition of function `inline_get_param_nids' ====
+.text
+inline_get_param_nids:
+addsp 68;        
+# param:`fn', offset:-20
+# var: k, offset: 4
+# var: np, offset: 8
+# var: pnid, offset: 16
+# var: p, offset: 24
+# var: i, offset: 32
+# var: first, offset: 36
+# var: last, offset: 40
+ldiqw inl_param_nid;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L522;
+ldiqw inl_param_nid;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldxqw 8;
+ret;
+@L522:
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldiqw inline_params;
+call 4;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L523:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L525;
+incldw 8;
+@L524:
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L523;
+@L525:
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldiqw malloc;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L526:
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+sltdw;
+jmpf @L528;
+ldidw 1;
+negdw;
+ldbp 16;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L527:
+incldw 4;
+jmp @L526;
+@L528:
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 36;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 40;
+stdw;
+pop;
+ldbp 36;
+lddw;
+ldbp 32;
+stdw;
+pop;
+@L529:
+ldbp 32;
+lddw;
+ldbp 40;
+lddw;
+uletdw;
+jmpf @L531;
+# var: a, offset: 44
+# var: j, offset: 56
+ldiqw ic_instructions;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 44;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 44;
+ldidw 1;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 44;
+ldidw 2;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 56;
+stdw;
+pop;
+@L532:
+ldbp 56;
+lddw;
+ldidw 3;
+sltdw;
+jmpf @L534;
+# var: e, offset: 64
+ldbp 44;
+ldbp 56;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+jmpt @L535;
+ldiqw ic_addresses;
+ldqw;
+ldbp 44;
+ldbp 56;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+neqdw;
+jmpt @L535;
+ldidw 0;
+jmp @L536;
+@L535:
+ldidw 1;
+@L536:
+jmpf @L537;
+jmp @L533;
+@L537:
+ldiqw ic_addresses;
+ldqw;
+ldbp 44;
+ldbp 56;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+ldbp 64;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 14;
+addqw;
+ldb;
+notdw;
+jmpf @L538;
+jmp @L533;
+@L538:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldiqw inline_params;
+call 4;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L539:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L541;
+ldbp 64;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L542;
+ldiqw ic_addresses;
+ldqw;
+ldbp 44;
+ldbp 56;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L542:
+@L540:
+incldw 4;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L539;
+@L541:
+@L533:
+incldw 56;
+jmp @L532;
+@L534:
+@L530:
+incldw 32;
+jmp @L529;
+@L531:
+ldbp 16;
+ldqw;
+ldiqw inl_param_nid;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `do_expr_convert32' ====
+.text
+do_expr_convert32:
+addsp 20;        
+# param:`e', offset:-24
+# param:`dest', offset:-32
+# var: op, offset: 4
+# var: a1, offset: 8
+# var: a2, offset: 12
+# var: cat_dest, offset: 16
+# var: cat_src, offset: 20
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldiqw @T543;
+switch;
+@L545:
+@L546:
+ldbp 20;
+lddw;
+ldidw 49;
+neqdw;
+jmpf @L547;
+ldbp 20;
+lddw;
+ldidw 106;
+neqdw;
+jmpf @L547;
+ldidw 1;
+jmp @L548;
+@L547:
+ldidw 0;
+@L548:
+jmpf @L549;
+ldidw 19;
+ldbp 4;
+stdw;
+pop;
+jmp @L544;
+@L549:
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L550:
+ldbp 20;
+lddw;
+ldidw 107;
+neqdw;
+jmpf @L551;
+ldidw 20;
+ldbp 4;
+stdw;
+pop;
+jmp @L544;
+@L551:
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L552:
+ldbp 20;
+lddw;
+ldiqw @T553;
+switch;
+@L555:
+@L556:
+@L557:
+@L558:
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L559:
+ldidw 21;
+ldbp 4;
+stdw;
+pop;
+jmp @L554;
+@L554:
+.data
+.align 8
+@T553:
+.dword 5
+.dword 49
+.dword 64
+.dword 106
+.dword 107
+.qword @L559
+.qword @L555
+.qword @L558
+.qword @L556
+.qword @L557
+.text
+jmp @L544;
+@L560:
+ldbp 20;
+lddw;
+ldidw 107;
+neqdw;
+jmpf @L561;
+ldbp 20;
+lddw;
+ldidw 108;
+neqdw;
+jmpf @L561;
+ldidw 1;
+jmp @L562;
+@L561:
+ldidw 0;
+@L562:
+jmpf @L563;
+ldidw 22;
+ldbp 4;
+stdw;
+pop;
+jmp @L544;
+@L563:
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L564:
+@L565:
+ldbp 20;
+lddw;
+ldidw 110;
+neqdw;
+jmpf @L566;
+ldbp 20;
+lddw;
+ldidw 111;
+neqdw;
+jmpf @L566;
+ldidw 1;
+jmp @L567;
+@L566:
+ldidw 0;
+@L567:
+jmpf @L568;
+ldbp 20;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L569;
+ldidw 24;
+ldbp 4;
+stdw;
+pop;
+jmp @L570;
+@L569:
+ldidw 23;
+ldbp 4;
+stdw;
+pop;
+@L570:
+jmp @L544;
+@L568:
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L571:
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L544:
+.data
+.align 8
+@T543:
+.dword 8
+.dword 49
+.dword 64
+.dword 106
+.dword 107
+.dword 108
+.dword 110
+.dword 111
+.qword @L571
+.qword @L545
+.qword @L552
+.qword @L546
+.qword @L550
+.qword @L560
+.qword @L564
+.qword @L565
+.text
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+lddw;
+ldbp 12;
+lddw;
+ldbp -32;
+ldqw;
+ldbp 4;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 12;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern strcat
+.extern are_compatible
+# ==== start of definition of function `is_cheap' ====
+.text
+is_cheap:
+addsp 0;         
+# param:`op', offset:-20
+ldbp -20;
+lddw;
+ldiqw @T572;
+jmptab;
+@L574:
+@L575:
+@L576:
+@L577:
+@L578:
+@L579:
+@L580:
+@L581:
+@L582:
+@L583:
+@L584:
+@L585:
+@L586:
+@L587:
+@L588:
+@L589:
+@L590:
+ldidw 1;
+dw2qw;
+ret;
+@L591:
+ldidw 0;
+dw2qw;
+ret;
+@L573:
+.data
+.align 8
+@T572:
+.dword 10
+.dword 18
+.qword @L591
+.qword @L585
+.qword @L586
+.qword @L587
+.qword @L588
+.qword @L589
+.qword @L590
+.qword @L582
+.qword @L583
+.qword @L584
+.qword @L576
+.qword @L577
+.qword @L578
+.qword @L579
+.qword @L580
+.qword @L581
+.qword @L575
+.qword @L591
+.qword @L574
+.text
+ldidw 0;
+ret;
+.extern error_count
+# ==== start of definition of function `push_break_target' ====
+.text
+push_break_target:
+addsp 0;         
+# param:`lab', offset:-20
+ldbp -20;
+lddw;
+ldiqw btarget_stack;
+ldiqw bt_stack_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `do_expr_convert64' ====
+.text
+do_expr_convert64:
+addsp 20;        
+# param:`e', offset:-24
+# param:`dest', offset:-32
+# var: op, offset: 4
+# var: a1, offset: 8
+# var: a2, offset: 12
+# var: cat_dest, offset: 16
+# var: cat_src, offset: 20
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldiqw @T592;
+switch;
+@L594:
+@L595:
+ldbp 20;
+lddw;
+ldidw 49;
+neqdw;
+jmpf @L596;
+ldbp 20;
+lddw;
+ldidw 106;
+neqdw;
+jmpf @L596;
+ldidw 1;
+jmp @L597;
+@L596:
+ldidw 0;
+@L597:
+jmpf @L598;
+ldidw 19;
+ldbp 4;
+stdw;
+pop;
+jmp @L593;
+@L598:
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L599:
+ldbp 20;
+lddw;
+ldidw 107;
+neqdw;
+jmpf @L600;
+ldidw 20;
+ldbp 4;
+stdw;
+pop;
+jmp @L593;
+@L600:
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L601:
+ldbp 20;
+lddw;
+ldiqw @T602;
+switch;
+@L604:
+@L605:
+@L606:
+@L607:
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L608:
+ldidw 21;
+ldbp 4;
+stdw;
+pop;
+jmp @L603;
+@L603:
+.data
+.align 8
+@T602:
+.dword 5
+.dword 49
+.dword 64
+.dword 106
+.dword 107
+.qword @L608
+.qword @L604
+.qword @L607
+.qword @L605
+.qword @L606
+.text
+jmp @L593;
+@L609:
+ldbp 20;
+lddw;
+ldidw 107;
+neqdw;
+jmpf @L610;
+ldbp 20;
+lddw;
+ldidw 108;
+neqdw;
+jmpf @L610;
+ldidw 1;
+jmp @L611;
+@L610:
+ldidw 0;
+@L611:
+jmpf @L612;
+ldidw 22;
+ldbp 4;
+stdw;
+pop;
+jmp @L593;
+@L612:
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L613:
+@L614:
+@L615:
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L616:
+ldbp 20;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L617;
+ldbp 20;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 3;
+eqdw;
+jmpf @L617;
+ldidw 1;
+jmp @L618;
+@L617:
+ldidw 0;
+@L618:
+jmpf @L619;
+ldbp 20;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L620;
+ldidw 24;
+ldbp 4;
+stdw;
+pop;
+jmp @L621;
+@L620:
+ldidw 23;
+ldbp 4;
+stdw;
+pop;
+@L621:
+jmp @L593;
+@L619:
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L593:
+.data
+.align 8
+@T592:
+.dword 9
+.dword 49
+.dword 55
+.dword 60
+.dword 64
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.qword @L616
+.qword @L594
+.qword @L614
+.qword @L613
+.qword @L601
+.qword @L615
+.qword @L595
+.qword @L599
+.qword @L609
+.text
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+lddw;
+ldbp 12;
+lddw;
+ldbp -32;
+ldqw;
+ldbp 4;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 12;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 8
+nid_map_stamp:
+.res 8
+.bss
+.align 4
+true_addr:
+.res 4
+.data
+.align 8
+long_expr:
+.align 8
+.align 4
+.dword 61
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.extern free_pre_token
+.bss
+.align 4
+cg_nodes_counter:
+.res 4
+.global cg_nodes_counter
+# ==== start of definition of function `new_atv' ====
+.text
+new_atv:
+addsp 12;        
+# param:`vnid', offset:-20
+ldiqw atv_counter;
+lddw;
+ldiqw atv_max;
+lddw;
+sgetdw;
+jmpf @L622;
+# var: p, offset: 8
+ldiqw atv_max;
+lddw;
+ldidw 2;
+muldw;
+ldiqw atv_max;
+stdw;
+pop;
+ldiqw atv_max;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw atv_table;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L623;
+ldiqw @S30;
+ldiqw ic_out_of_memory;
+call 8;
+pop;
+pop;
+@L623:
+ldbp 8;
+ldqw;
+ldiqw atv_table;
+stqw;
+pop;
+pop;
+@L622:
+ldbp -20;
+lddw;
+ldiqw atv_table;
+ldqw;
+ldiqw atv_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 4
+btarget_stack:
+.res 512
+.extern round_up
+.extern analyze_declarator
+.bss
+.align 4
+label_max:
+.res 4
+.extern location_init
+# ==== start of definition of function `loop_number_vars' ====
+.text
+loop_number_vars:
+addsp 24;        
+# var: i, offset: 4
+# var: a, offset: 8
+# var: k, offset: 20
+# var: v, offset: 24
+ldiqw new_nid_map;
+call 0;
+pop;
+pop;
+ldidw 0;
+ldiqw lp_nvars;
+stdw;
+pop;
+ldiqw lp_first;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L624:
+ldbp 4;
+lddw;
+ldiqw lp_last;
+lddw;
+uletdw;
+jmpf @L626;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 8;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 8;
+ldidw 1;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 8;
+ldidw 2;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 20;
+stdw;
+pop;
+@L627:
+ldbp 20;
+lddw;
+ldidw 3;
+sltdw;
+jmpf @L629;
+ldbp 8;
+ldbp 20;
+lddw;
+dw2qw;
+ldxdw 4;
+jmpf @L632;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldbp 20;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L634;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldbp 20;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L634;
+ldidw 0;
+jmp @L635;
+@L634:
+ldidw 1;
+@L635:
+jmpf @L632;
+ldidw 1;
+jmp @L633;
+@L632:
+ldidw 0;
+@L633:
+notdw;
+jmpt @L630;
+ldiqw nid_map_stamp;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldbp 20;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw nid_map_curr;
+lddw;
+eqdw;
+jmpt @L630;
+ldidw 0;
+jmp @L631;
+@L630:
+ldidw 1;
+@L631:
+jmpf @L636;
+jmp @L628;
+@L636:
+ldiqw nid_map_curr;
+lddw;
+ldiqw nid_map_stamp;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldbp 20;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw lp_nvars;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldbp 20;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L628:
+incldw 20;
+jmp @L627;
+@L629:
+@L625:
+incldw 4;
+jmp @L624;
+@L626:
+ldiqw 4;
+ldiqw lp_nvars;
+lddw;
+dw2qw;
+ldiqw calloc;
+call 16;
+ldiqw var_ndefs;
+stqw;
+pop;
+pop;
+ldiqw 4;
+ldiqw lp_nvars;
+lddw;
+dw2qw;
+ldiqw calloc;
+call 16;
+ldiqw var_def;
+stqw;
+pop;
+pop;
+ldiqw lp_nvars;
+lddw;
+dw2qw;
+ldiqw malloc;
+call 8;
+ldiqw var_tracked;
+stqw;
+pop;
+pop;
+ldiqw lp_nvars;
+lddw;
+dw2qw;
+ldidw 1;
+negdw;
+ldiqw var_tracked;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldiqw lp_first;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L637:
+ldbp 4;
+lddw;
+ldiqw lp_last;
+lddw;
+uletdw;
+jmpf @L639;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 8;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 8;
+ldidw 1;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 8;
+ldidw 2;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 25;
+eqdw;
+jmpt @L642;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 28;
+eqdw;
+jmpt @L642;
+ldidw 0;
+jmp @L643;
+@L642:
+ldidw 1;
+@L643:
+jmpf @L640;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L640;
+ldidw 1;
+jmp @L641;
+@L640:
+ldidw 0;
+@L641:
+jmpf @L644;
+ldidw 0;
+dw2b;
+ldiqw var_tracked;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+addqw;
+stb;
+pop;
+@L644:
+ldidw 0;
+ldbp 20;
+stdw;
+pop;
+@L645:
+ldbp 20;
+lddw;
+ldidw 3;
+sltdw;
+jmpf @L647;
+ldbp 8;
+ldbp 20;
+lddw;
+dw2qw;
+ldxdw 4;
+jmpf @L650;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldbp 20;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L652;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldbp 20;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L652;
+ldidw 0;
+jmp @L653;
+@L652:
+ldidw 1;
+@L653:
+jmpf @L650;
+ldidw 1;
+jmp @L651;
+@L650:
+ldidw 0;
+@L651:
+jmpf @L648;
+ldiqw var_tracked;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldbp 20;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 24;
+stdw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L648;
+ldidw 1;
+jmp @L649;
+@L648:
+ldidw 0;
+@L649:
+jmpf @L654;
+ldbp 8;
+ldbp 20;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw lp_is_tracked;
+call 4;
+pop;
+dw2b;
+ldiqw var_tracked;
+ldqw;
+ldbp 24;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L654:
+@L646:
+incldw 20;
+jmp @L645;
+@L647:
+ldbp 8;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+jmpf @L657;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L659;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L659;
+ldidw 0;
+jmp @L660;
+@L659:
+ldidw 1;
+@L660:
+jmpf @L657;
+ldidw 1;
+jmp @L658;
+@L657:
+ldidw 0;
+@L658:
+jmpf @L655;
+ldbp 4;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+jmpf @L655;
+ldidw 1;
+jmp @L656;
+@L655:
+ldidw 0;
+@L656:
+jmpf @L661;
+ldiqw var_ndefs;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 24;
+stdw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldbp 4;
+lddw;
+ldiqw var_def;
+ldqw;
+ldbp 24;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L661:
+@L638:
+incldw 4;
+jmp @L637;
+@L639:
+ldidw 0;
+ret;
+# ==== start of definition of function `ic_expression_statement' ====
+.text
+ic_expression_statement:
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L662;
+ldiqw verbose_asm;
+lddw;
+jmpf @L663;
+ldbp -24;
+ldqw;
+ldiqw ast2c;
+call 8;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L663:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression2;
+call 16;
+pop;
+pop;
+@L662:
+ldidw 0;
+ret;
+.bss
+.align 8
+ic_case_labels:
+.res 128
+.global ic_case_labels
+.extern include_liblux
+.bss
+.align 4
+cfg_nodes_max:
+.res 4
+.global cfg_nodes_max
+.extern stat_number_of_pre_tokens
+.extern bset_eq
+# ==== start of definition of function `is_scalar_param' ====
+.text
+is_scalar_param:
+addsp 4;         
+# param:`p', offset:-24
+# param:`ty', offset:-32
+# var: cat, offset: 4
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpt @L664;
+ldbp 4;
+lddw;
+ldidw 11;
+eqdw;
+jmpt @L664;
+ldidw 0;
+jmp @L665;
+@L664:
+ldidw 1;
+@L665:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern strchr
+.extern add_angle_dir
+# ==== start of definition of function `loop_unroll_all' ====
+.text
+loop_unroll_all:
+addsp 28;        
+# param:`fn', offset:-20
+# var: L, offset: 4
+# var: start, offset: 8
+# var: done, offset: 16
+# var: i, offset: 20
+# var: nlab, offset: 24
+# var: new_first, offset: 28
+ldbp -20;
+lddw;
+ldiqw loop_find;
+call 4;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L666;
+ldbp -20;
+lddw;
+ldiqw loop_free;
+call 4;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ret;
+@L666:
+ldiqw lp_last;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw lp_last;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldbp 8;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L667:
+ldbp 4;
+lddw;
+ldiqw nloops;
+lddw;
+sltdw;
+jmpf @L669;
+ldbp 4;
+lddw;
+ldiqw loop_trip_count;
+call 4;
+pop;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 40;
+addqw;
+stdw;
+ldidw 0;
+neqdw;
+jmpf @L670;
+ldbp 4;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp 16;
+stdw;
+pop;
+@L670:
+@L668:
+incldw 4;
+jmp @L667;
+@L669:
+ldbp 16;
+lddw;
+jmpf @L671;
+ldiqw lp_last;
+lddw;
+ldiqw lp_first;
+lddw;
+ldiqw count_labels;
+call 8;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldiqw ic_instructions_counter;
+lddw;
+ldbp 28;
+stdw;
+pop;
+ldiqw lp_first;
+lddw;
+ldbp 20;
+stdw;
+pop;
+@L672:
+ldbp 20;
+lddw;
+ldiqw lp_last;
+lddw;
+uletdw;
+jmpf @L674;
+ldbp 8;
+ldqw;
+ldbp 20;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp 4;
+stdw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L675;
+ldbp 24;
+lddw;
+ldbp 20;
+lddw;
+ldbp 4;
+lddw;
+ldiqw loop_unroll;
+call 12;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 44;
+addqw;
+lddw;
+ldbp 20;
+stdw;
+pop;
+jmp @L673;
+@L675:
+ldbp 20;
+lddw;
+ldiqw emit_copy;
+call 4;
+pop;
+pop;
+@L673:
+incldw 20;
+jmp @L672;
+@L674:
+ldbp -20;
+lddw;
+ldiqw loop_free;
+call 4;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldbp 28;
+lddw;
+ldbp -20;
+lddw;
+ldiqw replace_function_body;
+call 12;
+pop;
+pop;
+jmp @L676;
+@L671:
+ldbp -20;
+lddw;
+ldiqw loop_free;
+call 4;
+pop;
+pop;
+@L676:
+ldbp 8;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 16;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern analyze_conditional_expression
+# ==== start of definition of function `new_nid_map' ====
+.text
+new_nid_map:
+addsp 4;         
+ldiqw nid_counter;
+lddw;
+ldiqw nid_map_max;
+lddw;
+sgtdw;
+jmpf @L677;
+# var: n, offset: 4
+ldiqw nid_map_max;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw nid_counter;
+lddw;
+ldidw 2;
+muldw;
+ldiqw nid_map_max;
+stdw;
+pop;
+ldiqw nid_map_max;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw nid_map;
+ldqw;
+ldiqw realloc;
+call 16;
+ldiqw nid_map;
+stqw;
+pop;
+pop;
+ldiqw nid_map_max;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw nid_map_stamp;
+ldqw;
+ldiqw realloc;
+call 16;
+ldiqw nid_map_stamp;
+stqw;
+pop;
+pop;
+ldiqw nid_map;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L678;
+ldiqw nid_map_stamp;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L678;
+ldidw 0;
+jmp @L679;
+@L678:
+ldidw 1;
+@L679:
+jmpf @L680;
+ldiqw @S31;
+ldiqw ic_out_of_memory;
+call 8;
+pop;
+pop;
+@L680:
+ldiqw nid_map_max;
+lddw;
+ldbp 4;
+lddw;
+subdw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldidw 0;
+ldiqw nid_map_stamp;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+@L677:
+ldiqw nid_map_curr;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+.extern ic_outpath
+.extern arena_alloc
+.bss
+.align 4
+label_counter:
+.res 4
+# ==== start of definition of function `new_frame_var' ====
+.text
+new_frame_var:
+addsp 20;        
+# param:`a', offset:-20
+# param:`ty', offset:-28
+# var: nid, offset: 4
+# var: na, offset: 8
+# var: e, offset: 16
+ldiqw new_exec_node;
+call 0;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+swap2;
+memcpy 104;
+pop;
+pop;
+ldidw 0;
+dw2b;
+ldbp 16;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 14;
+addqw;
+stb;
+pop;
+ldbp -28;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L681;
+ldbp -28;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+@L681:
+ldbp 16;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw frame_area;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+subdw;
+ldiqw round_up;
+call 8;
+pop;
+ldiqw frame_area;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldidw 2;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw frame_area;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldiqw nid_counter;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_atv;
+call 4;
+pop;
+jmpf @L682;
+ldiqw nid_counter;
+lddw;
+ldiqw new_atv;
+call 4;
+pop;
+pop;
+@L682:
+ldiqw nid2sid_tab;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw new_nid;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern stdout
+.extern get_type_category
+# ==== start of definition of function `loop_basic_iv' ====
+.text
+loop_basic_iv:
+addsp 40;        
+# param:`a', offset:-20
+# param:`L', offset:-24
+# param:`step', offset:-32
+# var: i, offset: 4
+# var: u, offset: 8
+# var: t, offset: 12
+# var: y, offset: 16
+# var: siz, offset: 20
+# var: v, offset: 24
+# var: n, offset: 28
+# var: q, offset: 32
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+neqdw;
+jmpt @L685;
+ldiqw var_tracked;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 24;
+stdw;
+dw2qw;
+ldxb 1;
+notdw;
+jmpt @L685;
+ldidw 0;
+jmp @L686;
+@L685:
+ldidw 1;
+@L686:
+jmpt @L683;
+ldbp 24;
+lddw;
+ldiqw loops;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpt @L683;
+ldidw 0;
+jmp @L684;
+@L683:
+ldidw 1;
+@L684:
+jmpf @L687;
+ldidw 0;
+dw2qw;
+ret;
+@L687:
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp 28;
+stdw;
+pop;
+ldiqw lp_first;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L688:
+ldbp 4;
+lddw;
+ldiqw lp_last;
+lddw;
+uletdw;
+jmpf @L690;
+ldiqw lp_blk;
+ldqw;
+ldbp 4;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldiqw loops;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L693;
+ldbp 4;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+jmpf @L695;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L697;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L697;
+ldidw 0;
+jmp @L698;
+@L697:
+ldidw 1;
+@L698:
+jmpf @L695;
+ldidw 1;
+jmp @L696;
+@L695:
+ldidw 0;
+@L696:
+jmpf @L693;
+ldidw 1;
+jmp @L694;
+@L693:
+ldidw 0;
+@L694:
+jmpf @L691;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpf @L691;
+ldidw 1;
+jmp @L692;
+@L691:
+ldidw 0;
+@L692:
+jmpf @L699;
+ldbp 4;
+lddw;
+ldbp 8;
+stdw;
+pop;
+incldw 28;
+@L699:
+@L689:
+incldw 4;
+jmp @L688;
+@L690:
+ldbp 28;
+lddw;
+ldidw 1;
+neqdw;
+jmpt @L704;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 27;
+neqdw;
+jmpt @L704;
+ldidw 0;
+jmp @L705;
+@L704:
+ldidw 1;
+@L705:
+jmpt @L702;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+neqdw;
+jmpt @L702;
+ldidw 0;
+jmp @L703;
+@L702:
+ldidw 1;
+@L703:
+jmpt @L700;
+ldiqw var_ndefs;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+neqdw;
+jmpt @L700;
+ldidw 0;
+jmp @L701;
+@L700:
+ldidw 1;
+@L701:
+jmpf @L706;
+ldidw 0;
+dw2qw;
+ret;
+@L706:
+ldiqw ic_instructions;
+ldqw;
+ldiqw var_def;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldiqw lp_blk;
+ldqw;
+ldiqw var_def;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldiqw lp_blk;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+neqdw;
+jmpt @L707;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 20;
+lddw;
+neqdw;
+jmpt @L707;
+ldidw 0;
+jmp @L708;
+@L707:
+ldidw 1;
+@L708:
+jmpf @L709;
+ldidw 0;
+dw2qw;
+ret;
+@L709:
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L710;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L710;
+ldidw 1;
+jmp @L711;
+@L710:
+ldidw 0;
+@L711:
+jmpf @L712;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+ldqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+jmp @L713;
+@L712:
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L716;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L716;
+ldidw 0;
+jmp @L717;
+@L716:
+ldidw 1;
+@L717:
+jmpf @L714;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L714;
+ldidw 1;
+jmp @L715;
+@L714:
+ldidw 0;
+@L715:
+jmpf @L718;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L719;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+jmp @L720;
+@L719:
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+negqw;
+@L720:
+ldbp -32;
+ldqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+jmp @L721;
+@L718:
+ldidw 0;
+dw2qw;
+ret;
+@L721:
+@L713:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_signed_int;
+call 4;
+pop;
+ldbp 20;
+lddw;
+ldbp -32;
+ldqw;
+ldqw;
+ldiqw loop_truncate;
+call 16;
+ldbp -32;
+ldqw;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L722;
+# var: yd, offset: 40
+ldiqw var_ndefs;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+neqdw;
+jmpf @L723;
+ldidw 0;
+dw2qw;
+ret;
+@L723:
+ldiqw var_def;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldbp 40;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 27;
+neqdw;
+jmpt @L730;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+jmpf @L732;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L734;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L734;
+ldidw 0;
+jmp @L735;
+@L734:
+ldidw 1;
+@L735:
+jmpf @L732;
+ldidw 1;
+jmp @L733;
+@L732:
+ldidw 0;
+@L733:
+notdw;
+jmpt @L730;
+ldidw 0;
+jmp @L731;
+@L730:
+ldidw 1;
+@L731:
+jmpt @L728;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+neqdw;
+jmpt @L728;
+ldidw 0;
+jmp @L729;
+@L728:
+ldidw 1;
+@L729:
+jmpt @L726;
+ldiqw lp_blk;
+ldqw;
+ldbp 40;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldiqw lp_blk;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+neqdw;
+jmpt @L726;
+ldidw 0;
+jmp @L727;
+@L726:
+ldidw 1;
+@L727:
+jmpt @L724;
+ldbp 40;
+lddw;
+ldbp 8;
+lddw;
+ugtdw;
+jmpt @L724;
+ldidw 0;
+jmp @L725;
+@L724:
+ldidw 1;
+@L725:
+jmpf @L736;
+ldidw 0;
+dw2qw;
+ret;
+@L736:
+jmp @L737;
+@L722:
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+neqdw;
+jmpt @L738;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+neqdw;
+jmpt @L738;
+ldidw 0;
+jmp @L739;
+@L738:
+ldidw 1;
+@L739:
+jmpf @L740;
+ldidw 0;
+dw2qw;
+ret;
+@L740:
+@L737:
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `print_unaop' ====
+.text
+print_unaop:
+addsp 0;         
+# param:`i', offset:-24
+# param:`op', offset:-32
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw @S32;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+.data
+.align 8
+int_expr:
+.align 8
+.align 4
+.dword 60
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.extern ilog2
+.bss
+.align 4
+memcpy_addr:
+.res 4
+.bss
+.align 8
+lp_inner:
+.res 8
+# ==== start of definition of function `print_CFG' ====
+.text
+print_CFG:
+addsp 8;         
+# param:`fn', offset:-20
+# var: i, offset: 4
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L741;
+ldiqw 0;
+ret;
+@L741:
+ldiqw @S33;
+ldiqw cfg_dotfile;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L742:
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+uletdw;
+jmpf @L744;
+# var: j, offset: 8
+ldbp 4;
+lddw;
+ldbp 4;
+lddw;
+ldiqw @S34;
+ldiqw cfg_dotfile;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L745:
+ldbp 8;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+uletdw;
+jmpf @L747;
+ldbp 8;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+neqdw;
+jmpf @L748;
+ldiqw @S35;
+jmp @L749;
+@L748:
+ldiqw @S36;
+@L749:
+ldbp 8;
+lddw;
+ldiqw @S37;
+ldiqw cfg_dotfile;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+@L746:
+incldw 8;
+jmp @L745;
+@L747:
+ldiqw @S38;
+ldiqw cfg_dotfile;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+@L750:
+ldbp 8;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ultdw;
+jmpf @L752;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 4;
+lddw;
+ldiqw @S39;
+ldiqw cfg_dotfile;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+@L751:
+incldw 8;
+jmp @L750;
+@L752:
+@L743:
+incldw 4;
+jmp @L742;
+@L744:
+ldiqw @S40;
+ldiqw cfg_dotfile;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern strcmp
+# ==== start of definition of function `ic_controlling_expression' ====
+.text
+ic_controlling_expression:
+addsp 0;         
+# param:`e', offset:-24
+# param:`true_lab', offset:-28
+# param:`false_lab', offset:-32
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L753;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 29;
+eqdw;
+jmpt @L755;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 28;
+eqdw;
+jmpt @L755;
+ldidw 0;
+jmp @L756;
+@L755:
+ldidw 1;
+@L756:
+jmpf @L753;
+ldidw 1;
+jmp @L754;
+@L753:
+ldidw 0;
+@L754:
+jmpf @L757;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw ic_expression2;
+call 16;
+pop;
+pop;
+jmp @L758;
+@L757:
+ldbp -32;
+lddw;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw ic_expression2;
+call 16;
+pop;
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 37;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L758:
+ldidw 0;
+ret;
+.extern bset_fill
+.bss
+.align 8
+lab2instr:
+.res 8
+.extern strtok
+.extern strtol
+.bss
+.align 4
+pocount:
+.res 4
+.extern parse_header
+.bss
+.align 8
+inl_ncalls:
+.res 8
+.extern stdin
+.extern dflow_Dom
+.bss
+.align 8
+cfg_dotfile:
+.res 8
+.extern is_integer
+.extern analyze_postfix_expression
+.extern ftell
+.extern strcpy
+# ==== start of definition of function `ic_optimize_loops' ====
+.text
+ic_optimize_loops:
+addsp 8;         
+# var: fn, offset: 4
+# var: k, offset: 8
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L759:
+ldbp 4;
+lddw;
+ldiqw cg_nodes_counter;
+lddw;
+ultdw;
+jmpf @L761;
+ldiqw cg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L762;
+jmp @L760;
+@L762:
+ldbp 4;
+lddw;
+ldiqw loop_unroll_all;
+call 4;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+@L763:
+ldbp 8;
+lddw;
+ldidw 2;
+sltdw;
+jmpf @L765;
+ldbp 4;
+lddw;
+ldiqw loop_motion;
+call 4;
+pop;
+notdw;
+jmpf @L766;
+jmp @L765;
+@L766:
+@L764:
+incldw 8;
+jmp @L763;
+@L765:
+@L760:
+incldw 4;
+jmp @L759;
+@L761:
+ldiqw ivs;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw ivs;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw ivs_max;
+stdw;
+pop;
+ldiqw free_nid_map;
+call 0;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern install_tag
+.extern location_new
+.bss
+.align 8
+ivs:
+.res 8
+# ==== start of definition of function `is_atv' ====
+.text
+is_atv:
+addsp 4;         
+# param:`nid', offset:-20
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L767:
+ldbp 4;
+lddw;
+ldiqw atv_counter;
+lddw;
+sltdw;
+jmpf @L769;
+ldiqw atv_table;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp -20;
+lddw;
+eqdw;
+jmpf @L770;
+ldidw 1;
+dw2qw;
+ret;
+@L770:
+@L768:
+incldw 4;
+jmp @L767;
+@L769:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `number_CFG' ====
+.text
+number_CFG:
+addsp 8;         
+# var: n, offset: 4
+# var: n2, offset: 8
+ldiqw 4;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldiqw visited;
+stqw;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw pocount;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+ldiqw nunvisited;
+stdw;
+pop;
+@L771:
+ldiqw nunvisited;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L772;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L773:
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+uletdw;
+jmpf @L775;
+ldiqw visited;
+ldqw;
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+notdw;
+jmpf @L776;
+jmp @L775;
+@L776:
+@L774:
+incldw 4;
+jmp @L773;
+@L775:
+ldbp 4;
+lddw;
+ldiqw number_subCFG;
+call 4;
+pop;
+pop;
+jmp @L771;
+@L772:
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L777:
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+uletdw;
+jmpf @L778;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 72;
+addqw;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 76;
+addqw;
+stdw;
+pop;
+decldw 8;
+ldbp 4;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+jmp @L777;
+@L778:
+ldiqw visited;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern ic_function_to_print
+.extern strtoull
+# ==== start of definition of function `inline_params' ====
+.text
+inline_params:
+addsp 12;        
+# param:`fn', offset:-20
+# var: p, offset: 8
+ldiqw inl_def;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L779;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L779;
+ldidw 1;
+jmp @L780;
+@L779:
+ldidw 0;
+@L780:
+jmpf @L781;
+ldidw 0;
+dw2qw;
+ret;
+@L781:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern strlen
+.extern token_table
+# ==== start of definition of function `same_base' ====
+.text
+same_base:
+addsp 8;         
+# param:`a1', offset:-20
+# param:`a2', offset:-24
+# var: d1, offset: 4
+# var: d2, offset: 8
+ldbp -20;
+lddw;
+ldbp -24;
+lddw;
+eqdw;
+jmpf @L782;
+ldidw 1;
+dw2qw;
+ret;
+@L782:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L785;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L785;
+ldidw 0;
+jmp @L786;
+@L785:
+ldidw 1;
+@L786:
+jmpt @L783;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L787;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L787;
+ldidw 0;
+jmp @L788;
+@L787:
+ldidw 1;
+@L788:
+jmpt @L783;
+ldidw 0;
+jmp @L784;
+@L783:
+ldidw 1;
+@L784:
+jmpf @L789;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L792;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L792;
+ldidw 1;
+jmp @L793;
+@L792:
+ldidw 0;
+@L793:
+jmpf @L790;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L790;
+ldidw 1;
+jmp @L791;
+@L790:
+ldidw 0;
+@L791:
+dw2qw;
+ret;
+@L789:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+neqdw;
+jmpt @L794;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+neqdw;
+jmpt @L794;
+ldidw 0;
+jmp @L795;
+@L794:
+ldidw 1;
+@L795:
+jmpf @L796;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+dw2qw;
+ret;
+@L796:
+ldiqw var_def;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldbp 4;
+stdw;
+pop;
+ldiqw var_def;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 25;
+eqdw;
+jmpf @L799;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 25;
+eqdw;
+jmpf @L799;
+ldidw 1;
+jmp @L800;
+@L799:
+ldidw 0;
+@L800:
+jmpf @L797;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpf @L797;
+ldidw 1;
+jmp @L798;
+@L797:
+ldidw 0;
+@L798:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `ic_goto_statement' ====
+.text
+ic_goto_statement:
+addsp 0;         
+# param:`s', offset:-24
+ldiqw verbose_asm;
+lddw;
+jmpf @L801;
+ldbp -24;
+ldqw;
+ldiqw ast2c;
+call 8;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L801:
+ldiqw ic_instructions_counter;
+lddw;
+ldiqw gotos_to_fix;
+ldiqw gotos_to_fix_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldidw 0;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 32;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern bset_free
+.extern analyze_expression
+.bss
+.align 4
+nunvisited:
+.res 4
+# ==== start of definition of function `is_label_operand' ====
+.text
+is_label_operand:
+addsp 0;         
+# param:`op', offset:-20
+# param:`which', offset:-24
+ldbp -20;
+lddw;
+ldiqw @T802;
+jmptab;
+@L804:
+@L805:
+ldbp -24;
+lddw;
+ldidw 0;
+eqdw;
+dw2qw;
+ret;
+@L806:
+ldbp -24;
+lddw;
+ldidw 1;
+neqdw;
+dw2qw;
+ret;
+@L807:
+ldbp -24;
+lddw;
+ldidw 1;
+eqdw;
+dw2qw;
+ret;
+@L808:
+ldidw 0;
+dw2qw;
+ret;
+@L803:
+.data
+.align 8
+@T802:
+.dword 31
+.dword 7
+.qword @L808
+.qword @L804
+.qword @L805
+.qword @L808
+.qword @L808
+.qword @L808
+.qword @L807
+.qword @L806
+.text
+ldidw 0;
+ret;
+.bss
+.align 8
+cfg_nodes:
+.res 8
+.global cfg_nodes
+.extern memchr
+.extern new_type_exp_node
+.extern analyze_primary_expression
+.extern dup_decl_specs
+.extern new_declaration_node
+.extern vfprintf
+.extern eval_const_expr
+.bss
+.align 4
+ic_func_first_instr:
+.res 4
+# ==== start of definition of function `new_temp_addr' ====
+.text
+new_temp_addr:
+addsp 28;        
+# var: n, offset: 4
+# var: s, offset: 8
+# var: p, offset: 24
+.data
+.align 4
+@new_temp_addr_t_counter:
+.align 4
+.dword 1
+.text
+ldidw 3;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw @new_temp_addr_t_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S41;
+ldbp 8;
+ldiqw sprintf;
+call 20;
+pop;
+ldidw 1;
+adddw;
+ldiqw temp_names_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldbp 24;
+ldqw;
+ldiqw strcpy;
+call 16;
+ldiqw new_nid;
+call 8;
+pop;
+pop;
+ldbp 4;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern hash
+# ==== start of definition of function `inline_body' ====
+.text
+inline_body:
+addsp 76;        
+# param:`fn', offset:-20
+# param:`tar', offset:-24
+# param:`params', offset:-32
+# param:`label_base', offset:-36
+# var: k, offset: 4
+# var: pnid, offset: 8
+# var: g, offset: 16
+# var: p, offset: 24
+# var: i, offset: 32
+# var: first, offset: 36
+# var: last, offset: 40
+# var: nlab, offset: 44
+ldiqw new_nid_map;
+call 0;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldiqw inline_get_param_nids;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldiqw inline_params;
+call 4;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L809:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L811;
+ldbp 8;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L812;
+ldiqw nid_map_curr;
+lddw;
+ldiqw nid_map_stamp;
+ldqw;
+ldbp 8;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw nid_map;
+ldqw;
+ldbp 8;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L812:
+@L810:
+incldw 4;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L809;
+@L811:
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 36;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 40;
+stdw;
+pop;
+ldidw 0;
+ldbp 44;
+stdw;
+pop;
+ldbp 36;
+lddw;
+ldidw 1;
+adddw;
+ldbp 32;
+stdw;
+pop;
+@L813:
+ldbp 32;
+lddw;
+ldbp 40;
+lddw;
+ldidw 2;
+subdw;
+uletdw;
+jmpf @L815;
+# var: q, offset: 48
+ldiqw ic_instructions;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldbp 48;
+swap2;
+memcpy 32;
+pop;
+pop;
+ldbp 48;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T816;
+jmptab;
+@L818:
+ldiqw ic_addresses;
+ldqw;
+ldbp 48;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 44;
+lddw;
+udw2qw;
+ugetqw;
+jmpf @L819;
+ldiqw ic_addresses;
+ldqw;
+ldbp 48;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldidw 1;
+adddw;
+ldbp 44;
+stdw;
+pop;
+@L819:
+@L820:
+ldidw 0;
+ldidw 0;
+ldbp -36;
+lddw;
+ldidw 1;
+ldbp 48;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw inline_operand;
+call 12;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 48;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L817;
+@L821:
+ldbp -36;
+lddw;
+ldidw 1;
+ldbp 48;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw inline_operand;
+call 12;
+pop;
+ldidw 0;
+ldidw 0;
+ldbp 48;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw inline_operand;
+call 12;
+pop;
+ldbp -36;
+lddw;
+ldidw 1;
+ldbp 48;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw inline_operand;
+call 12;
+pop;
+ldbp 48;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L817;
+@L822:
+ldidw 0;
+ldidw 0;
+ldbp 48;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw inline_operand;
+call 12;
+pop;
+ldbp -36;
+lddw;
+ldidw 1;
+ldbp 48;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw inline_operand;
+call 12;
+pop;
+ldidw 0;
+ldidw 0;
+ldbp 48;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw inline_operand;
+call 12;
+pop;
+ldbp 48;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L817;
+@L823:
+ldbp -24;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L824;
+jmp @L814;
+@L824:
+ldidw 0;
+ldidw 0;
+ldidw 0;
+ldbp 48;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw inline_operand;
+call 12;
+pop;
+ldbp -24;
+lddw;
+ldbp 48;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L817;
+@L825:
+ldbp 32;
+lddw;
+ldiqw inline_call_target;
+call 4;
+pop;
+ldbp 16;
+stdw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L826;
+ldiqw inl_ncalls;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+@L826:
+ldidw 0;
+ldidw 0;
+ldbp 48;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw inline_operand;
+call 12;
+pop;
+ldbp 48;
+ldiqw 20;
+addqw;
+lddw;
+ldidw 0;
+ldidw 0;
+ldbp 48;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw inline_operand;
+call 12;
+pop;
+ldbp 48;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L817;
+@L827:
+ldidw 0;
+ldidw 0;
+ldbp 48;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw inline_operand;
+call 12;
+pop;
+ldidw 0;
+ldidw 0;
+ldbp 48;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw inline_operand;
+call 12;
+pop;
+ldidw 0;
+ldidw 0;
+ldbp 48;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw inline_operand;
+call 12;
+pop;
+ldbp 48;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L817;
+@L817:
+.data
+.align 8
+@T816:
+.dword 28
+.dword 10
+.qword @L827
+.qword @L825
+.qword @L827
+.qword @L827
+.qword @L818
+.qword @L820
+.qword @L827
+.qword @L823
+.qword @L827
+.qword @L822
+.qword @L821
+.text
+ldiqw verbose_asm;
+lddw;
+jmpf @L828;
+ldiqw C_source;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw C_source;
+ldqw;
+ldiqw ic_instructions_counter;
+lddw;
+ldidw 1;
+subdw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L828:
+@L814:
+incldw 32;
+jmp @L813;
+@L815:
+ldbp 44;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 8
+atv_table:
+.res 8
+.bss
+.align 4
+ic_instructions_max:
+.res 4
+.global ic_instructions_max
+.extern bsearch
+# ==== start of definition of function `ic_init' ====
+.text
+ic_init:
+addsp 0;         
+ldiqw location_init;
+call 0;
+pop;
+pop;
+ldidw 1024;
+dw2qw;
+ldiqw 32;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw ic_instructions;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L829;
+jmp @@ic_init_out_mem;
+@L829:
+ldidw 1024;
+ldiqw ic_instructions_max;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_instructions_counter;
+stdw;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L830;
+ldiqw ic_instructions_max;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+ldidw 1;
+dw2qw;
+ldiqw calloc;
+call 16;
+ldiqw C_source;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L830;
+ldidw 1;
+jmp @L831;
+@L830:
+ldidw 0;
+@L831:
+jmpf @L832;
+jmp @@ic_init_out_mem;
+@L832:
+ldidw 1024;
+ldidw 3;
+muldw;
+dw2qw;
+ldiqw 32;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw ic_addresses;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L833;
+jmp @@ic_init_out_mem;
+@L833:
+ldidw 1024;
+ldidw 3;
+muldw;
+ldiqw ic_addresses_max;
+stdw;
+pop;
+ldidw 1;
+ldiqw ic_addresses_counter;
+stdw;
+pop;
+ldidw 128;
+dw2qw;
+ldiqw 80;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw cfg_nodes;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L834;
+jmp @@ic_init_out_mem;
+@L834:
+ldidw 128;
+ldiqw cfg_nodes_max;
+stdw;
+pop;
+ldidw 1;
+ldiqw cfg_nodes_counter;
+stdw;
+pop;
+ldidw 32;
+dw2qw;
+ldiqw 72;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw cg_nodes;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L835;
+jmp @@ic_init_out_mem;
+@L835:
+ldidw 32;
+ldiqw cg_nodes_max;
+stdw;
+pop;
+ldidw 0;
+ldiqw cg_nodes_counter;
+stdw;
+pop;
+ldidw 128;
+dw2qw;
+ldiqw 8;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw nid2sid_tab;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L836;
+jmp @@ic_init_out_mem;
+@L836:
+ldidw 128;
+ldiqw nid_max;
+stdw;
+pop;
+ldidw 0;
+ldiqw nid_counter;
+stdw;
+pop;
+ldidw 0;
+ldidw 256;
+ldiqw arena_new;
+call 8;
+ldiqw id_table_arena;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldidw 256;
+ldiqw arena_new;
+call 8;
+ldiqw temp_names_arena;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldiqw true_addr;
+stdw;
+pop;
+ldidw 1;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw true_addr;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldiqw false_addr;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw false_addr;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw @S42;
+ldiqw memset_node;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 2;
+ldiqw new_address;
+call 4;
+pop;
+ldiqw memset_addr;
+stdw;
+pop;
+ldidw 0;
+ldiqw @S43;
+ldiqw get_var_nid;
+call 12;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldiqw memset_addr;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldiqw memset_node;
+ldiqw ic_addresses;
+ldqw;
+ldiqw memset_addr;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw @S44;
+ldiqw memcpy_node;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 2;
+ldiqw new_address;
+call 4;
+pop;
+ldiqw memcpy_addr;
+stdw;
+pop;
+ldidw 0;
+ldiqw @S45;
+ldiqw get_var_nid;
+call 12;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldiqw memcpy_addr;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldiqw memcpy_node;
+ldiqw ic_addresses;
+ldqw;
+ldiqw memcpy_addr;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 64;
+ldiqw label_max;
+stdw;
+pop;
+ldiqw label_max;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw lab2instr;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L837;
+jmp @@ic_init_out_mem;
+@L837:
+ldidw 32;
+ldiqw atv_max;
+stdw;
+pop;
+ldiqw atv_max;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw atv_table;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L838;
+jmp @@ic_init_out_mem;
+@L838:
+ldidw 0;
+ldiqw atv_counter;
+stdw;
+pop;
+ldiqw 0;
+ret;
+@@ic_init_out_mem:
+ldiqw @S46;
+ldiqw ic_out_of_memory;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern pre_save_pch
+.extern qsort
+.extern analyze_parameter_declaration
+# ==== start of definition of function `loop_motion' ====
+.text
+loop_motion:
+addsp 84;        
+# param:`fn', offset:-20
+# var: L, offset: 4
+# var: n, offset: 8
+# var: j, offset: 12
+# var: done, offset: 16
+# var: hdr, offset: 24
+# var: lab_loop, offset: 32
+# var: i, offset: 40
+# var: k, offset: 44
+# var: nlab, offset: 48
+# var: new_first, offset: 52
+ldbp -20;
+lddw;
+ldiqw loop_find;
+call 4;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L839;
+ldbp -20;
+lddw;
+ldiqw loop_free;
+call 4;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ret;
+@L839:
+ldiqw lp_last;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+ldbp 8;
+stdw;
+pop;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw lp_hoist;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw lp_ivar;
+stqw;
+pop;
+pop;
+ldidw 1;
+dw2qw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw calloc;
+call 16;
+ldiqw lp_needed;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldiqw lp_hoist;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldiqw lp_ivar;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldidw 0;
+ldiqw nivs;
+stdw;
+pop;
+ldiqw lp_first;
+lddw;
+ldbp 40;
+stdw;
+pop;
+@L840:
+ldbp 40;
+lddw;
+ldiqw lp_last;
+lddw;
+uletdw;
+jmpf @L842;
+ldbp 40;
+lddw;
+ldiqw loop_hoist_target;
+call 4;
+pop;
+ldiqw lp_hoist;
+ldqw;
+ldbp 40;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L843;
+ldbp 40;
+lddw;
+ldiqw loop_strength_reduce;
+call 4;
+pop;
+ldiqw lp_ivar;
+ldqw;
+ldbp 40;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L843:
+@L841:
+incldw 40;
+jmp @L840;
+@L842:
+ldbp 8;
+lddw;
+ldidw 1;
+subdw;
+ldbp 12;
+stdw;
+pop;
+@L844:
+ldbp 12;
+lddw;
+ldidw 0;
+sgetdw;
+jmpf @L846;
+# var: h, offset: 56
+# var: a, offset: 64
+ldiqw lp_first;
+lddw;
+ldbp 12;
+lddw;
+adddw;
+ldbp 40;
+stdw;
+pop;
+ldiqw lp_hoist;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldbp 56;
+stqw;
+lddw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L847;
+jmp @L845;
+@L847:
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_cheap;
+call 4;
+pop;
+jmpf @L848;
+ldiqw lp_needed;
+ldqw;
+ldbp 40;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxb 1;
+notdw;
+jmpf @L848;
+ldidw 1;
+jmp @L849;
+@L848:
+ldidw 0;
+@L849:
+jmpf @L850;
+ldidw 1;
+negdw;
+ldbp 56;
+ldqw;
+stdw;
+pop;
+jmp @L845;
+@L850:
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 64;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 64;
+ldidw 1;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 44;
+stdw;
+pop;
+@L851:
+ldbp 44;
+lddw;
+ldidw 2;
+ultdw;
+jmpf @L853;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 25;
+neqdw;
+jmpf @L856;
+ldbp 64;
+ldbp 44;
+lddw;
+udw2qw;
+ldxdw 4;
+jmpf @L856;
+ldidw 1;
+jmp @L857;
+@L856:
+ldidw 0;
+@L857:
+jmpf @L854;
+ldiqw ic_addresses;
+ldqw;
+ldbp 64;
+ldbp 44;
+lddw;
+udw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L854;
+ldidw 1;
+jmp @L855;
+@L854:
+ldidw 0;
+@L855:
+jmpf @L858;
+ldidw 1;
+dw2b;
+ldiqw lp_needed;
+ldqw;
+ldiqw var_def;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 64;
+ldbp 44;
+lddw;
+udw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+addqw;
+stb;
+pop;
+@L858:
+@L852:
+incldw 44;
+jmp @L851;
+@L853:
+@L845:
+decldw 12;
+jmp @L844;
+@L846:
+ldiqw lp_last;
+lddw;
+ldiqw lp_first;
+lddw;
+ldiqw count_labels;
+call 8;
+pop;
+ldbp 48;
+stdw;
+pop;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 48;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldbp 24;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldbp 48;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldbp 32;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldiqw lp_first;
+lddw;
+ldbp 40;
+stdw;
+pop;
+@L859:
+ldbp 40;
+lddw;
+ldiqw lp_last;
+lddw;
+uletdw;
+jmpf @L861;
+ldiqw lp_hoist;
+ldqw;
+ldbp 40;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L862;
+ldidw 1;
+ldiqw loops;
+ldqw;
+ldiqw lp_hoist;
+ldqw;
+ldbp 40;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 36;
+addqw;
+stdw;
+pop;
+@L862:
+@L860:
+incldw 40;
+jmp @L859;
+@L861:
+ldidw 0;
+ldbp 44;
+stdw;
+pop;
+@L863:
+ldbp 44;
+lddw;
+ldiqw nivs;
+lddw;
+ultdw;
+jmpf @L865;
+ldidw 1;
+ldiqw loops;
+ldqw;
+ldiqw ivs;
+ldqw;
+ldbp 44;
+lddw;
+udw2qw;
+ldiqw 56;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 36;
+addqw;
+stdw;
+pop;
+@L864:
+incldw 44;
+jmp @L863;
+@L865:
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L866:
+ldbp 4;
+lddw;
+ldiqw nloops;
+lddw;
+sltdw;
+jmpf @L868;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 36;
+addqw;
+lddw;
+jmpf @L869;
+ldbp 48;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 36;
+addqw;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldbp 24;
+ldqw;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp 16;
+stdw;
+pop;
+@L869:
+@L867:
+incldw 4;
+jmp @L866;
+@L868:
+ldbp 16;
+lddw;
+jmpf @L870;
+ldiqw ic_instructions_counter;
+lddw;
+ldbp 52;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 40;
+addqw;
+lddw;
+ldiqw frame_area;
+stdw;
+pop;
+ldiqw lp_first;
+lddw;
+ldbp 40;
+stdw;
+pop;
+@L871:
+ldbp 40;
+lddw;
+ldiqw lp_last;
+lddw;
+uletdw;
+jmpf @L873;
+# var: a, offset: 56
+# var: q, offset: 72
+ldbp 24;
+ldqw;
+ldbp 40;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp 4;
+stdw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L874;
+ldbp 40;
+lddw;
+ldbp 4;
+lddw;
+ldiqw loop_emit_preheader;
+call 8;
+pop;
+pop;
+@L874:
+ldiqw lp_hoist;
+ldqw;
+ldbp 40;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L875;
+jmp @L872;
+@L875:
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldbp 72;
+stqw;
+pop;
+pop;
+ldiqw lp_ivar;
+ldqw;
+ldbp 40;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L876;
+ldidw 0;
+ldiqw ivs;
+ldqw;
+ldiqw lp_ivar;
+ldqw;
+ldbp 40;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 56;
+mulqw;
+addqw;
+ldiqw 48;
+addqw;
+lddw;
+ldbp 72;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 72;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L877;
+ldiqw C_source;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw C_source;
+ldqw;
+ldiqw ic_instructions_counter;
+lddw;
+ldidw 1;
+subdw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L877:
+jmp @L872;
+@L876:
+ldbp 72;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 56;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 72;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 56;
+ldidw 1;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 72;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 56;
+ldidw 2;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 44;
+stdw;
+pop;
+@L878:
+ldbp 44;
+lddw;
+ldidw 3;
+ultdw;
+jmpf @L880;
+ldbp 72;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 31;
+neqdw;
+jmpf @L885;
+ldbp 44;
+lddw;
+ldbp 72;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_label_operand;
+call 8;
+pop;
+jmpf @L885;
+ldidw 1;
+jmp @L886;
+@L885:
+ldidw 0;
+@L886:
+jmpf @L883;
+ldbp 32;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 56;
+ldbp 44;
+lddw;
+udw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldxdw 4;
+ldbp 4;
+stdw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L883;
+ldidw 1;
+jmp @L884;
+@L883:
+ldidw 0;
+@L884:
+jmpf @L881;
+ldiqw lp_blk;
+ldqw;
+ldbp 40;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L881;
+ldidw 1;
+jmp @L882;
+@L881:
+ldidw 0;
+@L882:
+jmpf @L887;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 36;
+addqw;
+lddw;
+udw2qw;
+ldiqw new_label_addr;
+call 8;
+pop;
+ldbp 56;
+ldbp 44;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L887:
+@L879:
+incldw 44;
+jmp @L878;
+@L880:
+ldbp 56;
+ldidw 2;
+dw2qw;
+ldxdw 4;
+ldbp 56;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldbp 56;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldbp 72;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 72;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L888;
+ldiqw C_source;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw C_source;
+ldqw;
+ldiqw ic_instructions_counter;
+lddw;
+ldidw 1;
+subdw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L888:
+ldidw 0;
+ldbp 44;
+stdw;
+pop;
+@L889:
+ldbp 44;
+lddw;
+ldiqw nivs;
+lddw;
+ultdw;
+jmpf @L891;
+# var: t, offset: 80
+# var: c, offset: 84
+ldiqw ivs;
+ldqw;
+ldbp 44;
+lddw;
+udw2qw;
+ldiqw 56;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 40;
+lddw;
+neqdw;
+jmpf @L892;
+jmp @L890;
+@L892:
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 80;
+stdw;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 84;
+stdw;
+pop;
+ldiqw ivs;
+ldqw;
+ldbp 44;
+lddw;
+udw2qw;
+ldiqw 56;
+mulqw;
+addqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 84;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 84;
+lddw;
+ldiqw ivs;
+ldqw;
+ldbp 44;
+lddw;
+udw2qw;
+ldiqw 56;
+mulqw;
+addqw;
+ldiqw 48;
+addqw;
+lddw;
+ldbp 80;
+lddw;
+ldiqw ivs;
+ldqw;
+ldbp 44;
+lddw;
+udw2qw;
+ldiqw 56;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldbp 80;
+lddw;
+ldiqw ivs;
+ldqw;
+ldbp 44;
+lddw;
+udw2qw;
+ldiqw 56;
+mulqw;
+addqw;
+ldiqw 48;
+addqw;
+lddw;
+ldiqw ivs;
+ldqw;
+ldbp 44;
+lddw;
+udw2qw;
+ldiqw 56;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L890:
+incldw 44;
+jmp @L889;
+@L891:
+@L872:
+incldw 40;
+jmp @L871;
+@L873:
+ldbp -20;
+lddw;
+ldiqw loop_free;
+call 4;
+pop;
+pop;
+ldbp 48;
+lddw;
+ldbp 52;
+lddw;
+ldbp -20;
+lddw;
+ldiqw replace_function_body;
+call 12;
+pop;
+pop;
+ldiqw frame_area;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 40;
+addqw;
+stdw;
+pop;
+jmp @L893;
+@L870:
+ldbp -20;
+lddw;
+ldiqw loop_free;
+call 4;
+pop;
+pop;
+@L893:
+ldbp 24;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw lp_hoist;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw lp_ivar;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw lp_needed;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 16;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern cg_outpath
+# ==== start of definition of function `emit_src' ====
+.text
+emit_src:
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw C_source;
+ldqw;
+ldiqw ic_instructions_counter;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern memcmp
+.bss
+.align 8
+ic_file:
+.res 8
+# ==== start of definition of function `ic_expression' ====
+.text
+ic_expression:
+addsp 48;        
+# param:`e', offset:-24
+# param:`is_addr', offset:-28
+# param:`true_lab', offset:-32
+# param:`false_lab', offset:-36
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T894;
+jmptab;
+@L896:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T897;
+switch;
+@L899:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+pop;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+udw2qw;
+ret;
+@L900:
+# var: a1, offset: 4
+# var: a2, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L901;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+lddw;
+ldbp 4;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 4;
+lddw;
+udw2qw;
+ret;
+jmp @L902;
+@L901:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 8;
+lddw;
+ldbp 4;
+lddw;
+ldiqw ic_indirect_assignment;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L902:
+@L903:
+@L904:
+@L905:
+@L906:
+@L907:
+@L908:
+@L909:
+@L910:
+@L911:
+@L912:
+# var: new_e, offset: 8
+# var: a1, offset: 16
+# var: a2, offset: 20
+ldiqw new_exec_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+swap2;
+memcpy 104;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T913;
+jmptab;
+@L915:
+ldidw 102;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L914;
+@L916:
+ldidw 16;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L914;
+@L917:
+ldidw 17;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L914;
+@L918:
+ldidw 12;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L914;
+@L919:
+ldidw 13;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L914;
+@L920:
+ldidw 18;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L914;
+@L921:
+ldidw 19;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L914;
+@L922:
+ldidw 104;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L914;
+@L923:
+ldidw 26;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L914;
+@L924:
+ldidw 27;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L914;
+@L914:
+.data
+.align 8
+@T913:
+.dword 36
+.dword 10
+.qword @L914
+.qword @L915
+.qword @L916
+.qword @L917
+.qword @L918
+.qword @L919
+.qword @L920
+.qword @L921
+.qword @L922
+.qword @L923
+.qword @L924
+.text
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 3;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 8;
+ldqw;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L925;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldidw 0;
+ldbp 20;
+lddw;
+ldbp 16;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 16;
+lddw;
+udw2qw;
+ret;
+jmp @L926;
+@L925:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 20;
+lddw;
+ldbp 16;
+lddw;
+ldiqw ic_indirect_assignment;
+call 16;
+pop;
+pop;
+ldbp 20;
+lddw;
+udw2qw;
+ret;
+@L926:
+@L927:
+# var: L1, offset: 4
+# var: L2, offset: 8
+# var: L3, offset: 12
+ldiqw new_label;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_controlling_expression;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 73;
+neqdw;
+jmpf @L928;
+# var: a, offset: 16
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 16;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldidw 0;
+ldbp 12;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 32;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 16;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp 16;
+lddw;
+udw2qw;
+ret;
+jmp @L929;
+@L928:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+pop;
+ldidw 0;
+ldidw 0;
+ldbp 12;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 32;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ret;
+@L929:
+@L930:
+# var: a, offset: 4
+# var: L1, offset: 8
+# var: L2, offset: 12
+# var: L3, offset: 16
+# var: L4, offset: 20
+ldbp -32;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L931;
+@L932:
+ldbp -36;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+notdw;
+jmpf @L935;
+ldidw 4584;
+ldiqw @S47;
+ldiqw @S48;
+ldiqw @S49;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L935:
+@L933:
+ldidw 0;
+jmpf @L934;
+jmp @L932;
+@L934:
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldbp -32;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_controlling_expression;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp -36;
+lddw;
+ldbp -32;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_controlling_expression;
+call 16;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ret;
+jmp @L936;
+@L931:
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldbp 8;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_controlling_expression;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 8;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_controlling_expression;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldidw 0;
+ldiqw true_addr;
+lddw;
+ldbp 4;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldidw 0;
+ldbp 20;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 32;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldidw 0;
+ldiqw false_addr;
+lddw;
+ldbp 4;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp 4;
+lddw;
+udw2qw;
+ret;
+@L936:
+@L937:
+# var: a, offset: 4
+# var: L1, offset: 8
+# var: L2, offset: 12
+# var: L3, offset: 16
+# var: L4, offset: 20
+ldbp -32;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L938;
+@L939:
+ldbp -36;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+notdw;
+jmpf @L942;
+ldidw 4616;
+ldiqw @S50;
+ldiqw @S51;
+ldiqw @S52;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L942:
+@L940:
+ldidw 0;
+jmpf @L941;
+jmp @L939;
+@L941:
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -36;
+lddw;
+ldbp 8;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_controlling_expression;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp -36;
+lddw;
+ldbp -32;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_controlling_expression;
+call 16;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ret;
+jmp @L943;
+@L938:
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldbp 8;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_controlling_expression;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 12;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_controlling_expression;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldidw 0;
+ldiqw true_addr;
+lddw;
+ldbp 4;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldidw 0;
+ldbp 20;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 32;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldidw 0;
+ldiqw false_addr;
+lddw;
+ldbp 4;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp 4;
+lddw;
+udw2qw;
+ret;
+@L943:
+@L944:
+@L945:
+@L946:
+@L947:
+@L948:
+@L949:
+# var: op, offset: 4
+# var: flags, offset: 8
+# var: ty, offset: 16
+# var: cat1, offset: 24
+# var: cat2, offset: 28
+# var: a1, offset: 32
+# var: a2, offset: 36
+# var: a3, offset: 40
+ldidw 0;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 28;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldiqw is_wideval;
+call 4;
+pop;
+jmpf @L950;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+orqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L951;
+@L950:
+ldbp 28;
+lddw;
+ldiqw is_wideval;
+call 4;
+pop;
+jmpf @L952;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+orqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L953;
+@L952:
+ldiqw int_ty;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L953:
+@L951:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+sgetdw;
+jmpf @L954;
+ldbp 16;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 36;
+stdw;
+pop;
+jmp @L955;
+@L954:
+ldbp 16;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 36;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 32;
+stdw;
+pop;
+@L955:
+ldbp 24;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L960;
+ldbp 28;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L960;
+ldidw 1;
+jmp @L961;
+@L960:
+ldidw 0;
+@L961:
+jmpf @L958;
+ldbp 24;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldiqw is_signed_int;
+call 4;
+pop;
+jmpf @L958;
+ldidw 1;
+jmp @L959;
+@L958:
+ldidw 0;
+@L959:
+jmpf @L956;
+ldbp 28;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldiqw is_signed_int;
+call 4;
+pop;
+jmpf @L956;
+ldidw 1;
+jmp @L957;
+@L956:
+ldidw 0;
+@L957:
+jmpf @L962;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+orqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L962:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T963;
+jmptab;
+@L965:
+ldidw 10;
+ldbp 4;
+stdw;
+pop;
+jmp @L964;
+@L966:
+ldidw 11;
+ldbp 4;
+stdw;
+pop;
+jmp @L964;
+@L967:
+ldidw 12;
+ldbp 4;
+stdw;
+pop;
+jmp @L964;
+@L968:
+ldidw 14;
+ldbp 4;
+stdw;
+pop;
+jmp @L964;
+@L969:
+ldidw 13;
+ldbp 4;
+stdw;
+pop;
+jmp @L964;
+@L970:
+ldidw 15;
+ldbp 4;
+stdw;
+pop;
+jmp @L964;
+@L964:
+.data
+.align 8
+@T963:
+.dword 20
+.dword 6
+.qword @L964
+.qword @L967
+.qword @L968
+.qword @L969
+.qword @L970
+.qword @L965
+.qword @L966
+.text
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 40;
+stdw;
+pop;
+ldbp -36;
+lddw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L971;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+orqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L971:
+ldbp 36;
+lddw;
+ldbp 32;
+lddw;
+ldbp 40;
+lddw;
+ldbp 8;
+ldqw;
+ldbp 4;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 40;
+lddw;
+udw2qw;
+ret;
+@L972:
+# var: a1, offset: 4
+# var: a2, offset: 8
+# var: a3, offset: 12
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L973;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+sgetdw;
+jmpf @L974;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 8;
+stdw;
+pop;
+jmp @L975;
+@L974:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L975:
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+lddw;
+ldbp 12;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 0;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 12;
+lddw;
+udw2qw;
+ret;
+jmp @L976;
+@L973:
+# var: ii, offset: 16
+# var: pi, offset: 20
+# var: ty, offset: 24
+# var: a4, offset: 40
+# var: a5, offset: 44
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L977;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldidw 1;
+ldbp 20;
+stdw;
+pop;
+jmp @L978;
+@L977:
+ldidw 1;
+ldbp 16;
+stdw;
+pop;
+ldidw 0;
+ldbp 20;
+stdw;
+pop;
+@L978:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+sgetdw;
+jmpf @L979;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 8;
+stdw;
+pop;
+jmp @L980;
+@L979:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L980:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 24;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 24;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 40;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldbp 4;
+lddw;
+ldbp 40;
+lddw;
+ldiqw long_ty;
+ldidw 2;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 44;
+stdw;
+pop;
+ldbp 40;
+lddw;
+ldbp 8;
+lddw;
+ldbp 44;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 0;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 44;
+lddw;
+udw2qw;
+ret;
+@L976:
+@L981:
+# var: a1, offset: 4
+# var: a2, offset: 8
+# var: a3, offset: 12
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L982;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+sgetdw;
+jmpf @L983;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 8;
+stdw;
+pop;
+jmp @L984;
+@L983:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L984:
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+lddw;
+ldbp 12;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 1;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 12;
+lddw;
+udw2qw;
+ret;
+jmp @L985;
+@L982:
+# var: ty, offset: 16
+# var: a4, offset: 32
+# var: a5, offset: 36
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+sgetdw;
+jmpf @L986;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 8;
+stdw;
+pop;
+jmp @L987;
+@L986:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L987:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L988;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldbp 8;
+lddw;
+ldbp 32;
+lddw;
+ldiqw long_ty;
+ldidw 2;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 36;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldbp 4;
+lddw;
+ldbp 36;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 1;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L989;
+@L988:
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+lddw;
+ldbp 32;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 1;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 36;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldbp 32;
+lddw;
+ldbp 36;
+lddw;
+ldiqw long_ty;
+ldidw 3;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L989:
+ldbp 36;
+lddw;
+udw2qw;
+ret;
+@L985:
+@L990:
+@L991:
+# var: a1, offset: 4
+# var: a2, offset: 8
+# var: a3, offset: 12
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+sgetdw;
+jmpf @L992;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 8;
+stdw;
+pop;
+jmp @L993;
+@L992:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L993:
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+lddw;
+ldbp 12;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 18;
+eqdw;
+jmpf @L994;
+ldidw 5;
+jmp @L995;
+@L994:
+ldidw 6;
+@L995:
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 12;
+lddw;
+udw2qw;
+ret;
+@L996:
+@L997:
+@L998:
+@L999:
+@L1000:
+@L1001:
+# var: op, offset: 4
+# var: a1, offset: 8
+# var: a2, offset: 12
+# var: a3, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+sgetdw;
+jmpf @L1002;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 12;
+stdw;
+pop;
+jmp @L1003;
+@L1002:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 8;
+stdw;
+pop;
+@L1003:
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T1004;
+switch;
+@L1006:
+ldidw 8;
+ldbp 4;
+stdw;
+pop;
+jmp @L1005;
+@L1007:
+ldidw 9;
+ldbp 4;
+stdw;
+pop;
+jmp @L1005;
+@L1008:
+ldidw 7;
+ldbp 4;
+stdw;
+pop;
+jmp @L1005;
+@L1009:
+ldidw 2;
+ldbp 4;
+stdw;
+pop;
+jmp @L1005;
+@L1010:
+ldidw 3;
+ldbp 4;
+stdw;
+pop;
+jmp @L1005;
+@L1011:
+ldidw 4;
+ldbp 4;
+stdw;
+pop;
+jmp @L1005;
+@L1005:
+.data
+.align 8
+@T1004:
+.dword 7
+.dword 16
+.dword 17
+.dword 26
+.dword 27
+.dword 102
+.dword 104
+.qword @L1005
+.qword @L1010
+.qword @L1011
+.qword @L1007
+.qword @L1006
+.qword @L1009
+.qword @L1008
+.text
+ldbp 12;
+lddw;
+ldbp 8;
+lddw;
+ldbp 16;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 4;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 16;
+lddw;
+udw2qw;
+ret;
+@L1012:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+udw2qw;
+ret;
+@L1013:
+@L1014:
+# var: cat, offset: 4
+# var: a1, offset: 8
+# var: a2, offset: 12
+# var: a3, offset: 16
+# var: a4, offset: 20
+# var: a5, offset: 24
+ldbp -24;
+ldqw;
+ldiqw get_step_size;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L1015;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldbp 12;
+lddw;
+ldbp 16;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 93;
+eqdw;
+jmpf @L1016;
+ldidw 0;
+jmp @L1017;
+@L1016:
+ldidw 1;
+@L1017:
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 49;
+eqdw;
+jmpt @L1018;
+ldbp 4;
+lddw;
+ldidw 107;
+eqdw;
+jmpt @L1018;
+ldidw 0;
+jmp @L1019;
+@L1018:
+ldidw 1;
+@L1019:
+jmpf @L1020;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldidw 0;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+ldidw 0;
+dw2qw;
+ldbp 4;
+lddw;
+ldidw 49;
+eqdw;
+jmpf @L1021;
+ldidw 19;
+jmp @L1022;
+@L1021:
+ldidw 20;
+@L1022:
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L1023;
+@L1020:
+ldbp 4;
+lddw;
+ldidw 64;
+eqdw;
+jmpt @L1024;
+ldbp 4;
+lddw;
+ldidw 108;
+eqdw;
+jmpt @L1024;
+ldidw 0;
+jmp @L1025;
+@L1024:
+ldidw 1;
+@L1025:
+jmpf @L1026;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldidw 0;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+ldidw 0;
+dw2qw;
+ldbp 4;
+lddw;
+ldidw 64;
+eqdw;
+jmpf @L1027;
+ldidw 21;
+jmp @L1028;
+@L1027:
+ldidw 22;
+@L1028:
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L1029;
+@L1026:
+ldbp 16;
+lddw;
+ldbp 20;
+stdw;
+pop;
+@L1029:
+@L1023:
+ldidw 0;
+ldbp 20;
+lddw;
+ldbp 12;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 12;
+lddw;
+udw2qw;
+ret;
+jmp @L1030;
+@L1015:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldbp 12;
+lddw;
+ldbp 16;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 93;
+eqdw;
+jmpf @L1031;
+ldidw 0;
+jmp @L1032;
+@L1031:
+ldidw 1;
+@L1032:
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 49;
+eqdw;
+jmpt @L1033;
+ldbp 4;
+lddw;
+ldidw 107;
+eqdw;
+jmpt @L1033;
+ldidw 0;
+jmp @L1034;
+@L1033:
+ldidw 1;
+@L1034:
+jmpf @L1035;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldidw 0;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+ldidw 0;
+dw2qw;
+ldbp 4;
+lddw;
+ldidw 49;
+eqdw;
+jmpf @L1036;
+ldidw 19;
+jmp @L1037;
+@L1036:
+ldidw 20;
+@L1037:
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L1038;
+@L1035:
+ldbp 4;
+lddw;
+ldidw 64;
+eqdw;
+jmpt @L1039;
+ldbp 4;
+lddw;
+ldidw 108;
+eqdw;
+jmpt @L1039;
+ldidw 0;
+jmp @L1040;
+@L1039:
+ldidw 1;
+@L1040:
+jmpf @L1041;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldidw 0;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+ldidw 0;
+dw2qw;
+ldbp 4;
+lddw;
+ldidw 64;
+eqdw;
+jmpf @L1042;
+ldidw 21;
+jmp @L1043;
+@L1042:
+ldidw 22;
+@L1043:
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L1044;
+@L1041:
+ldbp 16;
+lddw;
+ldbp 20;
+stdw;
+pop;
+@L1044:
+@L1038:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 20;
+lddw;
+ldbp 24;
+lddw;
+ldiqw ic_indirect_assignment;
+call 16;
+pop;
+pop;
+ldbp 20;
+lddw;
+udw2qw;
+ret;
+@L1030:
+@L1045:
+@L1046:
+# var: a1, offset: 4
+# var: a2, offset: 8
+# var: a3, offset: 12
+# var: a4, offset: 16
+ldbp -24;
+ldqw;
+ldiqw get_step_size;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L1047;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+lddw;
+ldbp 12;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldbp 12;
+lddw;
+ldbp 16;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 94;
+eqdw;
+jmpf @L1048;
+ldidw 0;
+jmp @L1049;
+@L1048:
+ldidw 1;
+@L1049:
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+lddw;
+ldbp 8;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 12;
+lddw;
+udw2qw;
+ret;
+jmp @L1050;
+@L1047:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+ldbp 12;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 94;
+eqdw;
+jmpf @L1051;
+ldidw 0;
+jmp @L1052;
+@L1051:
+ldidw 1;
+@L1052:
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 12;
+lddw;
+ldbp 16;
+lddw;
+ldiqw ic_indirect_assignment;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L1050:
+@L1053:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+udw2qw;
+ret;
+@L1054:
+ldbp -28;
+lddw;
+jmpf @L1055;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+udw2qw;
+ret;
+jmp @L1056;
+@L1055:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldiqw ic_dereference;
+call 12;
+pop;
+udw2qw;
+ret;
+@L1056:
+@L1057:
+# var: a1, offset: 4
+# var: a2, offset: 8
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldidw 18;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L1058:
+@L1059:
+# var: a1, offset: 4
+# var: a2, offset: 8
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 14;
+eqdw;
+jmpf @L1060;
+ldidw 17;
+jmp @L1061;
+@L1060:
+ldidw 16;
+@L1061:
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L1062:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+udw2qw;
+ret;
+@L1063:
+# var: ii, offset: 4
+# var: pi, offset: 8
+# var: ty, offset: 16
+# var: a1, offset: 32
+# var: a2, offset: 36
+# var: a3, offset: 40
+# var: a4, offset: 44
+# var: a5, offset: 48
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L1064;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L1065;
+@L1064:
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+@L1065:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 88;
+addqw;
+lddw;
+sgetdw;
+jmpf @L1066;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 36;
+stdw;
+pop;
+jmp @L1067;
+@L1066:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 36;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldbp 32;
+stdw;
+pop;
+@L1067:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 40;
+stdw;
+pop;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 44;
+stdw;
+pop;
+ldbp 40;
+lddw;
+ldbp 32;
+lddw;
+ldbp 44;
+lddw;
+ldiqw long_ty;
+ldidw 2;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 48;
+stdw;
+pop;
+ldbp 44;
+lddw;
+ldbp 36;
+lddw;
+ldbp 48;
+lddw;
+ldiqw long_ty;
+ldidw 0;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp -28;
+lddw;
+jmpf @L1068;
+ldbp 48;
+lddw;
+udw2qw;
+ret;
+jmp @L1069;
+@L1068:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 48;
+lddw;
+ldiqw ic_dereference;
+call 12;
+pop;
+udw2qw;
+ret;
+@L1069:
+@L1070:
+# var: na, offset: 4
+# var: k, offset: 8
+# var: op, offset: 12
+# var: tmp, offset: 16
+# var: a1, offset: 24
+# var: a2, offset: 28
+# var: p, offset: 32
+# var: ca, offset: 40
+ldidw 0;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldidw 0;
+ldidw 0;
+ldidw 0;
+dw2qw;
+ldidw 38;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 28;
+stdw;
+pop;
+ldiqw target_arch;
+lddw;
+ldidw 4;
+eqdw;
+jmpt @L1071;
+ldiqw target_arch;
+lddw;
+ldidw 5;
+eqdw;
+jmpt @L1071;
+ldidw 0;
+jmp @L1072;
+@L1071:
+ldidw 1;
+@L1072:
+jmpf @L1073;
+# var: cat, offset: 48
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 48;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L1074;
+ldbp 48;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L1074;
+ldidw 0;
+jmp @L1075;
+@L1074:
+ldidw 1;
+@L1075:
+jmpf @L1076;
+ldiqw target_arch;
+lddw;
+ldidw 4;
+eqdw;
+jmpt @L1077;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldidw 4;
+ugtdw;
+jmpt @L1077;
+ldidw 0;
+jmp @L1078;
+@L1077:
+ldidw 1;
+@L1078:
+jmpf @L1079;
+ldidw 1;
+ldiqw false_addr;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+incldw 4;
+@L1079:
+@L1076:
+ldbp 4;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw aligned_function_argument;
+call 16;
+pop;
+adddw;
+ldbp 4;
+stdw;
+pop;
+jmp @L1080;
+@L1073:
+ldiqw target_arch;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1081;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L1082:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1084;
+incldw 4;
+@L1083:
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L1082;
+@L1084:
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 24;
+mulqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldiqw malloc;
+call 8;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw compute_arguments;
+call 24;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw is_direct_call;
+call 8;
+pop;
+notdw;
+jmpf @L1085;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L1085:
+ldbp 4;
+lddw;
+ldidw 1;
+subdw;
+ldbp 8;
+stdw;
+pop;
+@L1086:
+ldbp 8;
+lddw;
+ldidw 0;
+sgetdw;
+jmpf @L1088;
+ldidw 0;
+ldbp 40;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 24;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+ldbp 40;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 24;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 33;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L1087:
+decldw 8;
+jmp @L1086;
+@L1088:
+ldbp 40;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+jmp @L1089;
+@L1081:
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw function_argument;
+call 16;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L1089:
+@L1080:
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw target_arch;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1090;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L1091:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1093;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1094;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpf @L1094;
+ldidw 1;
+jmp @L1095;
+@L1094:
+ldidw 0;
+@L1095:
+jmpf @L1096;
+ldidw 0;
+ldidw 0;
+ldidw 0;
+ldidw 0;
+dw2qw;
+ldidw 39;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L1093;
+@L1096:
+@L1092:
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L1091;
+@L1093:
+@L1090:
+ldbp -24;
+ldqw;
+ldiqw is_direct_call;
+call 8;
+pop;
+jmpf @L1097;
+# var: tar_fn, offset: 48
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L1098:
+ldbp 16;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1099;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L1098;
+@L1099:
+ldidw 28;
+ldbp 12;
+stdw;
+pop;
+ldidw 2;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw get_var_nid;
+call 12;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw new_cg_node;
+call 8;
+pop;
+ldbp 48;
+stdw;
+pop;
+ldbp 48;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+ldiqw edge_add;
+call 12;
+pop;
+pop;
+jmp @L1100;
+@L1097:
+ldidw 29;
+ldbp 12;
+stdw;
+pop;
+ldiqw target_arch;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L1101;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L1101:
+@L1100:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 73;
+neqdw;
+jmpf @L1102;
+# var: a3, offset: 48
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 48;
+stdw;
+pop;
+ldbp 28;
+lddw;
+ldbp 24;
+lddw;
+ldbp 48;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 12;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 48;
+lddw;
+udw2qw;
+ret;
+jmp @L1103;
+@L1102:
+ldbp 28;
+lddw;
+ldbp 24;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 12;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ret;
+@L1103:
+@L1104:
+@L1105:
+# var: is_union, offset: 4
+# var: a1, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 6;
+eqdw;
+jmpf @L1106;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 71;
+eqdw;
+ldbp 4;
+stdw;
+pop;
+jmp @L1107;
+@L1106:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+ldbp 4;
+stdw;
+pop;
+@L1107:
+ldbp 4;
+lddw;
+notdw;
+jmpf @L1108;
+# var: m, offset: 16
+# var: a2, offset: 24
+# var: a3, offset: 28
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw get_member_descriptor;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 28;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldbp 8;
+lddw;
+ldbp 28;
+lddw;
+ldiqw long_ty;
+ldidw 0;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 28;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L1108:
+ldbp -28;
+lddw;
+jmpf @L1109;
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+jmp @L1110;
+@L1109:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 8;
+lddw;
+ldiqw ic_dereference;
+call 12;
+pop;
+udw2qw;
+ret;
+@L1110:
+@L898:
+.data
+.align 8
+@T897:
+.dword 47
+.dword 6
+.dword 7
+.dword 12
+.dword 13
+.dword 14
+.dword 15
+.dword 16
+.dword 17
+.dword 18
+.dword 19
+.dword 20
+.dword 21
+.dword 22
+.dword 23
+.dword 24
+.dword 25
+.dword 26
+.dword 27
+.dword 28
+.dword 29
+.dword 30
+.dword 34
+.dword 35
+.dword 36
+.dword 37
+.dword 38
+.dword 39
+.dword 40
+.dword 41
+.dword 42
+.dword 43
+.dword 44
+.dword 45
+.dword 93
+.dword 94
+.dword 95
+.dword 96
+.dword 97
+.dword 98
+.dword 99
+.dword 100
+.dword 101
+.dword 102
+.dword 103
+.dword 104
+.dword 105
+.qword @L898
+.qword @L1104
+.qword @L1105
+.qword @L972
+.qword @L981
+.qword @L1058
+.qword @L1057
+.qword @L1000
+.qword @L1001
+.qword @L990
+.qword @L991
+.qword @L946
+.qword @L947
+.qword @L948
+.qword @L949
+.qword @L944
+.qword @L945
+.qword @L997
+.qword @L996
+.qword @L937
+.qword @L930
+.qword @L927
+.qword @L899
+.qword @L900
+.qword @L903
+.qword @L904
+.qword @L905
+.qword @L906
+.qword @L907
+.qword @L908
+.qword @L909
+.qword @L910
+.qword @L911
+.qword @L912
+.qword @L1013
+.qword @L1045
+.qword @L1014
+.qword @L1046
+.qword @L1063
+.qword @L1070
+.qword @L1062
+.qword @L1059
+.qword @L1054
+.qword @L999
+.qword @L1053
+.qword @L998
+.qword @L1012
+.text
+jmp @L895;
+@L1111:
+# var: a, offset: 4
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+udw2qw;
+ret;
+@L1112:
+# var: a, offset: 4
+ldidw 1;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+udw2qw;
+ret;
+@L1113:
+# var: cat, offset: 4
+# var: a1, offset: 8
+ldidw 2;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw get_var_nid;
+call 12;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 0;
+eqdw;
+jmpf @L1114;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw location_get_offset;
+call 8;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+@L1114:
+ldbp -28;
+lddw;
+jmpt @L1117;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 97;
+eqdw;
+jmpt @L1117;
+ldidw 0;
+jmp @L1118;
+@L1117:
+ldidw 1;
+@L1118:
+jmpt @L1115;
+ldbp 4;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L1115;
+ldidw 0;
+jmp @L1116;
+@L1115:
+ldidw 1;
+@L1116:
+jmpf @L1119;
+# var: a2, offset: 12
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+lddw;
+ldbp 12;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 25;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw new_atv;
+call 4;
+pop;
+pop;
+ldbp 12;
+lddw;
+udw2qw;
+ret;
+jmp @L1120;
+@L1119:
+ldbp 8;
+lddw;
+udw2qw;
+ret;
+@L1120:
+@L895:
+.data
+.align 8
+@T894:
+.dword 0
+.dword 4
+.qword @L895
+.qword @L896
+.qword @L1111
+.qword @L1112
+.qword @L1113
+.text
+@L1121:
+ldidw 0;
+notdw;
+jmpf @L1124;
+ldidw 5102;
+ldiqw @S53;
+ldiqw @S54;
+ldiqw @S55;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L1124:
+@L1122:
+ldidw 0;
+jmpf @L1123;
+jmp @L1121;
+@L1123:
+ldidw 0;
+ret;
+.extern bset_insert
+.extern pre_load_pch
+# ==== start of definition of function `inline_calls' ====
+.text
+inline_calls:
+addsp 156;       
+# param:`fn', offset:-20
+# var: link, offset: 8
+# var: callee, offset: 16
+# var: argno, offset: 24
+# var: stack, offset: 32
+# var: top, offset: 40
+# var: growth, offset: 44
+# var: g, offset: 48
+# var: nsel, offset: 52
+# var: i, offset: 56
+# var: first, offset: 60
+# var: last, offset: 64
+# var: n, offset: 68
+# var: new_first, offset: 72
+# var: label_base, offset: 76
+# var: params, offset: 80
+# var: scs, offset: 88
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 60;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 64;
+stdw;
+pop;
+ldbp 64;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+ldbp 68;
+stdw;
+pop;
+ldbp 68;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 68;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 68;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 40;
+stdw;
+pop;
+ldbp 60;
+lddw;
+ldbp 56;
+stdw;
+pop;
+@L1125:
+ldbp 56;
+lddw;
+ldbp 64;
+lddw;
+uletdw;
+jmpf @L1127;
+ldidw 1;
+negdw;
+ldbp 16;
+ldqw;
+ldbp 56;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+ldbp 8;
+ldqw;
+ldbp 56;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T1128;
+jmptab;
+@L1130:
+ldbp 56;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+ldbp 32;
+ldqw;
+ldbp 40;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L1129;
+@L1131:
+ldbp 40;
+lddw;
+jmpf @L1132;
+ldbp 32;
+ldqw;
+ldbp 40;
+lddw;
+ldidw 1;
+subdw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+ldqw;
+ldbp 56;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L1132:
+jmp @L1129;
+@L1133:
+@L1134:
+ldiqw ic_instructions;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw memset_addr;
+lddw;
+eqdw;
+jmpt @L1135;
+ldiqw ic_instructions;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw memcpy_addr;
+lddw;
+eqdw;
+jmpt @L1135;
+ldidw 0;
+jmp @L1136;
+@L1135:
+ldidw 1;
+@L1136:
+jmpf @L1137;
+jmp @L1129;
+@L1137:
+@L1138:
+ldbp 40;
+lddw;
+ldidw 0;
+sgtdw;
+notdw;
+jmpf @L1141;
+ldidw 1837;
+ldiqw @S56;
+ldiqw @S57;
+ldiqw @S58;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L1141:
+@L1139:
+ldidw 0;
+jmpf @L1140;
+jmp @L1138;
+@L1140:
+ldbp 32;
+ldqw;
+ldbp 40;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+ldqw;
+ldbp 56;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 56;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+ldbp 8;
+ldqw;
+ldbp 8;
+ldqw;
+ldbp 56;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L1129;
+@L1142:
+jmp @L1129;
+@L1129:
+.data
+.align 8
+@T1128:
+.dword 28
+.dword 11
+.qword @L1142
+.qword @L1133
+.qword @L1134
+.qword @L1142
+.qword @L1142
+.qword @L1142
+.qword @L1131
+.qword @L1142
+.qword @L1142
+.qword @L1142
+.qword @L1142
+.qword @L1130
+.text
+@L1126:
+incldw 56;
+jmp @L1125;
+@L1127:
+ldbp 32;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldbp 52;
+stdw;
+ldbp 44;
+stdw;
+pop;
+ldbp 60;
+lddw;
+ldbp 56;
+stdw;
+pop;
+@L1143:
+ldbp 56;
+lddw;
+ldbp 64;
+lddw;
+uletdw;
+jmpf @L1145;
+# var: siz, offset: 96
+ldbp 56;
+lddw;
+ldiqw inline_call_target;
+call 4;
+pop;
+ldbp 48;
+stdw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L1148;
+ldbp 48;
+lddw;
+ldbp -20;
+lddw;
+eqdw;
+jmpt @L1148;
+ldidw 0;
+jmp @L1149;
+@L1148:
+ldidw 1;
+@L1149:
+jmpt @L1146;
+ldiqw inl_size;
+ldqw;
+ldbp 48;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 96;
+stdw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L1146;
+ldidw 0;
+jmp @L1147;
+@L1146:
+ldidw 1;
+@L1147:
+jmpf @L1150;
+jmp @L1144;
+@L1150:
+ldbp 96;
+lddw;
+ldidw 24;
+sgtdw;
+jmpf @L1151;
+ldbp 96;
+lddw;
+ldidw 400;
+sgtdw;
+jmpt @L1156;
+ldiqw inl_ncalls;
+ldqw;
+ldbp 48;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+neqdw;
+jmpt @L1156;
+ldidw 0;
+jmp @L1157;
+@L1156:
+ldidw 1;
+@L1157:
+jmpt @L1154;
+ldiqw inl_def;
+ldqw;
+ldbp 48;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 88;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L1154;
+ldidw 0;
+jmp @L1155;
+@L1154:
+ldidw 1;
+@L1155:
+jmpt @L1152;
+ldbp 88;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L1152;
+ldidw 0;
+jmp @L1153;
+@L1152:
+ldidw 1;
+@L1153:
+jmpf @L1158;
+jmp @L1144;
+@L1158:
+@L1151:
+ldbp 44;
+lddw;
+ldbp 96;
+lddw;
+adddw;
+ldidw 600;
+sgtdw;
+jmpt @L1159;
+ldbp 8;
+ldqw;
+ldbp 60;
+lddw;
+ldbp 48;
+lddw;
+ldbp 56;
+lddw;
+ldiqw inline_args_match;
+call 20;
+pop;
+notdw;
+jmpt @L1159;
+ldidw 0;
+jmp @L1160;
+@L1159:
+ldidw 1;
+@L1160:
+jmpf @L1161;
+jmp @L1144;
+@L1161:
+ldbp 48;
+lddw;
+ldbp 16;
+ldqw;
+ldbp 56;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 44;
+lddw;
+ldbp 96;
+lddw;
+adddw;
+ldbp 44;
+stdw;
+pop;
+incldw 52;
+ldiqw inl_ncalls;
+ldqw;
+ldbp 48;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+@L1144:
+incldw 56;
+jmp @L1143;
+@L1145:
+ldbp 52;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1162;
+ldbp 8;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1162:
+ldbp 64;
+lddw;
+ldbp 60;
+lddw;
+ldiqw count_labels;
+call 8;
+pop;
+ldbp 76;
+stdw;
+pop;
+ldiqw 4;
+ldbp 68;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw 8;
+ldbp 68;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldbp 80;
+stqw;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 40;
+addqw;
+lddw;
+ldiqw frame_area;
+stdw;
+pop;
+ldiqw ic_instructions_counter;
+lddw;
+ldbp 72;
+stdw;
+pop;
+ldbp 60;
+lddw;
+ldbp 56;
+stdw;
+pop;
+@L1163:
+ldbp 56;
+lddw;
+ldbp 64;
+lddw;
+uletdw;
+jmpf @L1165;
+# var: q, offset: 96
+# var: c, offset: 128
+# var: k, offset: 132
+# var: np, offset: 136
+# var: pnid, offset: 144
+ldiqw ic_instructions;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldbp 96;
+swap2;
+memcpy 32;
+pop;
+pop;
+ldbp 96;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T1166;
+jmptab;
+@L1168:
+ldbp 8;
+ldqw;
+ldbp 56;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L1169;
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldbp 56;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L1169;
+ldidw 1;
+jmp @L1170;
+@L1169:
+ldidw 0;
+@L1170:
+jmpf @L1171;
+jmp @L1164;
+@L1171:
+jmp @L1167;
+@L1172:
+ldbp 8;
+ldqw;
+ldbp 56;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L1173;
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldbp 8;
+ldqw;
+ldbp 56;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldbp 128;
+stdw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L1173;
+ldidw 0;
+jmp @L1174;
+@L1173:
+ldidw 1;
+@L1174:
+jmpf @L1175;
+jmp @L1167;
+@L1175:
+ldbp 16;
+ldqw;
+ldbp 128;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 48;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 128;
+lddw;
+ldbp 60;
+lddw;
+adddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 136;
+stdw;
+pop;
+ldbp 48;
+lddw;
+ldiqw inline_get_param_nids;
+call 4;
+ldbp 144;
+stqw;
+pop;
+pop;
+ldbp 80;
+ldqw;
+ldbp 128;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1176;
+ldiqw 4;
+ldbp 136;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw calloc;
+call 16;
+ldbp 80;
+ldqw;
+ldbp 128;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 132;
+stdw;
+pop;
+@L1177:
+ldbp 132;
+lddw;
+ldbp 136;
+lddw;
+sltdw;
+jmpf @L1179;
+# var: j, offset: 152
+# var: a, offset: 156
+ldbp 144;
+ldqw;
+ldbp 132;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L1180;
+jmp @L1178;
+@L1180:
+ldidw 0;
+ldbp 156;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 48;
+lddw;
+dw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 152;
+stdw;
+pop;
+@L1181:
+ldbp 156;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1183;
+ldiqw ic_instructions;
+ldqw;
+ldbp 152;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+jmpf @L1186;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 152;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L1186;
+ldidw 1;
+jmp @L1187;
+@L1186:
+ldidw 0;
+@L1187:
+jmpf @L1184;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 152;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 144;
+ldqw;
+ldbp 132;
+lddw;
+dw2qw;
+ldxdw 4;
+eqdw;
+jmpf @L1184;
+ldidw 1;
+jmp @L1185;
+@L1184:
+ldidw 0;
+@L1185:
+jmpf @L1188;
+ldiqw ic_instructions;
+ldqw;
+ldbp 152;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 156;
+stdw;
+pop;
+jmp @L1189;
+@L1188:
+ldiqw ic_instructions;
+ldqw;
+ldbp 152;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+jmpf @L1192;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 152;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L1192;
+ldidw 1;
+jmp @L1193;
+@L1192:
+ldidw 0;
+@L1193:
+jmpf @L1190;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 152;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 144;
+ldqw;
+ldbp 132;
+lddw;
+dw2qw;
+ldxdw 4;
+eqdw;
+jmpf @L1190;
+ldidw 1;
+jmp @L1191;
+@L1190:
+ldidw 0;
+@L1191:
+jmpf @L1194;
+ldiqw ic_instructions;
+ldqw;
+ldbp 152;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 156;
+stdw;
+pop;
+jmp @L1195;
+@L1194:
+ldiqw ic_instructions;
+ldqw;
+ldbp 152;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+jmpf @L1198;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 152;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L1198;
+ldidw 1;
+jmp @L1199;
+@L1198:
+ldidw 0;
+@L1199:
+jmpf @L1196;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 152;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 144;
+ldqw;
+ldbp 132;
+lddw;
+dw2qw;
+ldxdw 4;
+eqdw;
+jmpf @L1196;
+ldidw 1;
+jmp @L1197;
+@L1196:
+ldidw 0;
+@L1197:
+jmpf @L1200;
+ldiqw ic_instructions;
+ldqw;
+ldbp 152;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 156;
+stdw;
+pop;
+@L1200:
+@L1195:
+@L1189:
+@L1182:
+incldw 152;
+jmp @L1181;
+@L1183:
+ldidw 0;
+dw2qw;
+ldbp 156;
+lddw;
+ldiqw new_frame_var;
+call 12;
+pop;
+ldbp 80;
+ldqw;
+ldbp 128;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 132;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L1178:
+incldw 132;
+jmp @L1177;
+@L1179:
+@L1176:
+ldbp 24;
+ldqw;
+ldbp 128;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldbp 132;
+stdw;
+pop;
+ldiqw target_arch;
+lddw;
+ldidw 4;
+neqdw;
+jmpf @L1201;
+ldiqw target_arch;
+lddw;
+ldidw 5;
+neqdw;
+jmpf @L1201;
+ldidw 1;
+jmp @L1202;
+@L1201:
+ldidw 0;
+@L1202:
+jmpf @L1203;
+ldbp 136;
+lddw;
+ldidw 1;
+subdw;
+ldbp 132;
+lddw;
+subdw;
+ldbp 132;
+stdw;
+pop;
+@L1203:
+ldbp 80;
+ldqw;
+ldbp 128;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 132;
+lddw;
+dw2qw;
+ldxdw 4;
+jmpf @L1204;
+ldidw 0;
+ldbp 96;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 80;
+ldqw;
+ldbp 128;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 132;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 96;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L1204:
+jmp @L1164;
+@L1205:
+ldbp 16;
+ldqw;
+ldbp 56;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L1206;
+jmp @L1167;
+@L1206:
+ldbp 76;
+lddw;
+ldbp 76;
+lddw;
+ldbp 80;
+ldqw;
+ldbp 56;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+udw2qw;
+ldxqw 8;
+ldbp 96;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldbp 56;
+lddw;
+ldbp 60;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldiqw inline_body;
+call 20;
+pop;
+adddw;
+ldbp 76;
+stdw;
+pop;
+jmp @L1164;
+@L1207:
+jmp @L1167;
+@L1167:
+.data
+.align 8
+@T1166:
+.dword 28
+.dword 11
+.qword @L1207
+.qword @L1205
+.qword @L1207
+.qword @L1207
+.qword @L1207
+.qword @L1207
+.qword @L1172
+.qword @L1207
+.qword @L1207
+.qword @L1207
+.qword @L1207
+.qword @L1168
+.text
+ldbp 96;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 96;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 96;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 96;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 96;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L1208;
+ldiqw C_source;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw C_source;
+ldqw;
+ldiqw ic_instructions_counter;
+lddw;
+ldidw 1;
+subdw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L1208:
+@L1164:
+incldw 56;
+jmp @L1163;
+@L1165:
+ldidw 0;
+ldbp 56;
+stdw;
+pop;
+@L1209:
+ldbp 56;
+lddw;
+ldbp 68;
+lddw;
+ultdw;
+jmpf @L1211;
+ldbp 80;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw free;
+call 8;
+pop;
+pop;
+@L1210:
+incldw 56;
+jmp @L1209;
+@L1211:
+ldbp 80;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 76;
+lddw;
+ldbp 72;
+lddw;
+ldbp -20;
+lddw;
+ldiqw replace_function_body;
+call 12;
+pop;
+pop;
+ldiqw frame_area;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 40;
+addqw;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+ldiqw edge_free;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+ldiqw edge_init;
+call 12;
+pop;
+pop;
+ldidw 1;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 72;
+lddw;
+ldbp 56;
+stdw;
+pop;
+@L1212:
+ldbp 56;
+lddw;
+ldiqw ic_instructions_counter;
+lddw;
+ultdw;
+jmpf @L1214;
+ldiqw ic_instructions;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 28;
+eqdw;
+jmpt @L1215;
+ldiqw ic_instructions;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 29;
+eqdw;
+jmpt @L1215;
+ldidw 0;
+jmp @L1216;
+@L1215:
+ldidw 1;
+@L1216:
+jmpf @L1217;
+ldidw 0;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 56;
+lddw;
+ldiqw inline_call_target;
+call 4;
+pop;
+ldbp 48;
+stdw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L1218;
+ldbp 48;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+ldiqw edge_add;
+call 12;
+pop;
+pop;
+@L1218:
+@L1217:
+@L1213:
+incldw 56;
+jmp @L1212;
+@L1214:
+ldidw 0;
+ret;
+.extern dflow_free_LiveOut
+.extern vsnprintf
+.extern vsprintf
+.bss
+.align 4
+nid_counter:
+.res 4
+.global nid_counter
+# ==== start of definition of function `loop_find' ====
+.text
+loop_find:
+addsp 104;       
+# param:`fn', offset:-20
+# var: hdr_loop, offset: 8
+# var: L, offset: 16
+# var: M, offset: 20
+# var: reached, offset: 24
+# var: b, offset: 32
+# var: i, offset: 36
+# var: nb, offset: 40
+# var: stack, offset: 48
+# var: top, offset: 56
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw lp_entry_bb;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw lp_entry_bb;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+ldbp 40;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw lp_entry_bb;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw lp_first;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldiqw lp_last;
+stdw;
+pop;
+ldiqw lp_last;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw lp_blk;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 32;
+stdw;
+pop;
+@L1219:
+ldbp 32;
+lddw;
+ldbp 40;
+lddw;
+ultdw;
+jmpf @L1221;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 32;
+lddw;
+ldiqw lp_entry_bb;
+lddw;
+adddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 36;
+stdw;
+pop;
+@L1222:
+ldbp 36;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 32;
+lddw;
+ldiqw lp_entry_bb;
+lddw;
+adddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+uletdw;
+jmpf @L1224;
+ldbp 32;
+lddw;
+ldiqw lp_blk;
+ldqw;
+ldbp 36;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L1223:
+incldw 36;
+jmp @L1222;
+@L1224:
+@L1220:
+incldw 32;
+jmp @L1219;
+@L1221:
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 48;
+stqw;
+pop;
+pop;
+ldidw 1;
+dw2qw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldidw 1;
+dw2b;
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+addqw;
+stb;
+pop;
+ldidw 0;
+ldbp 48;
+ldqw;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp 56;
+stdw;
+pop;
+@L1225:
+ldbp 56;
+lddw;
+jmpf @L1226;
+# var: out, offset: 64
+ldiqw cfg_nodes;
+ldqw;
+ldbp 48;
+ldqw;
+ldbp 56;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+udw2qw;
+ldxdw 4;
+ldiqw lp_entry_bb;
+lddw;
+adddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 36;
+stdw;
+pop;
+@L1227:
+ldbp 36;
+lddw;
+ldbp 64;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ultdw;
+jmpf @L1229;
+ldbp 24;
+ldqw;
+ldbp 64;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldxdw 4;
+ldiqw lp_entry_bb;
+lddw;
+subdw;
+ldbp 32;
+stdw;
+udw2qw;
+ldxb 1;
+notdw;
+jmpf @L1230;
+ldidw 1;
+dw2b;
+ldbp 24;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+addqw;
+stb;
+pop;
+ldbp 32;
+lddw;
+ldbp 48;
+ldqw;
+ldbp 56;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L1230:
+@L1228:
+incldw 36;
+jmp @L1227;
+@L1229:
+jmp @L1225;
+@L1226:
+ldbp -20;
+lddw;
+ldiqw dflow_Dom;
+call 4;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw loops;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw nloops;
+stdw;
+pop;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldbp 8;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldidw 0;
+ldbp 32;
+stdw;
+pop;
+@L1231:
+ldbp 32;
+lddw;
+ldbp 40;
+lddw;
+ultdw;
+jmpf @L1233;
+# var: out, offset: 64
+ldbp 24;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldxb 1;
+notdw;
+jmpf @L1234;
+jmp @L1232;
+@L1234:
+ldiqw cfg_nodes;
+ldqw;
+ldbp 32;
+lddw;
+ldiqw lp_entry_bb;
+lddw;
+adddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 36;
+stdw;
+pop;
+@L1235:
+ldbp 36;
+lddw;
+ldbp 64;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ultdw;
+jmpf @L1237;
+# var: h, offset: 72
+# var: lp, offset: 80
+ldbp 64;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldxdw 4;
+ldiqw lp_entry_bb;
+lddw;
+subdw;
+ldbp 72;
+stdw;
+pop;
+ldbp 72;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 32;
+lddw;
+ldiqw lp_entry_bb;
+lddw;
+adddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L1238;
+jmp @L1236;
+@L1238:
+ldbp 8;
+ldqw;
+ldbp 72;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 16;
+stdw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L1239;
+ldiqw nloops;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+ldiqw loops;
+ldqw;
+ldiqw realloc;
+call 16;
+ldiqw loops;
+stqw;
+pop;
+pop;
+ldiqw nloops;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 72;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+ldbp 16;
+stdw;
+pop;
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldbp 80;
+stqw;
+pop;
+pop;
+ldbp 72;
+lddw;
+ldiqw lp_entry_bb;
+lddw;
+adddw;
+ldbp 80;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 40;
+lddw;
+ldiqw bset_new;
+call 4;
+ldbp 80;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 72;
+lddw;
+ldbp 80;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+ldidw 1;
+negdw;
+ldbp 80;
+ldqw;
+ldiqw 28;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 80;
+ldqw;
+ldiqw 32;
+addqw;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 80;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 80;
+ldqw;
+ldiqw 36;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 80;
+ldqw;
+ldiqw 40;
+addqw;
+stdw;
+pop;
+@L1239:
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldbp 80;
+stqw;
+pop;
+pop;
+ldbp 32;
+lddw;
+ldbp 80;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L1240;
+jmp @L1236;
+@L1240:
+ldbp 32;
+lddw;
+ldbp 80;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+ldbp 32;
+lddw;
+ldbp 48;
+ldqw;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp 56;
+stdw;
+pop;
+@L1241:
+ldbp 56;
+lddw;
+jmpf @L1242;
+# var: k, offset: 88
+# var: in, offset: 96
+ldiqw cfg_nodes;
+ldqw;
+ldbp 48;
+ldqw;
+ldbp 56;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+udw2qw;
+ldxdw 4;
+ldiqw lp_entry_bb;
+lddw;
+adddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldbp 96;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 88;
+stdw;
+pop;
+@L1243:
+ldbp 88;
+lddw;
+ldbp 96;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ultdw;
+jmpf @L1245;
+# var: p, offset: 104
+ldbp 96;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 88;
+lddw;
+udw2qw;
+ldxdw 4;
+ldiqw lp_entry_bb;
+lddw;
+subdw;
+ldbp 104;
+stdw;
+pop;
+ldbp 24;
+ldqw;
+ldbp 104;
+lddw;
+udw2qw;
+ldxb 1;
+jmpf @L1246;
+ldbp 104;
+lddw;
+ldbp 80;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L1246;
+ldidw 1;
+jmp @L1247;
+@L1246:
+ldidw 0;
+@L1247:
+jmpf @L1248;
+ldbp 104;
+lddw;
+ldbp 80;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+ldbp 104;
+lddw;
+ldbp 48;
+ldqw;
+ldbp 56;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L1248:
+@L1244:
+incldw 88;
+jmp @L1243;
+@L1245:
+jmp @L1241;
+@L1242:
+@L1236:
+incldw 36;
+jmp @L1235;
+@L1237:
+@L1232:
+incldw 32;
+jmp @L1231;
+@L1233:
+ldbp 48;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw lp_inner;
+stqw;
+pop;
+pop;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldiqw lp_inner;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L1249:
+ldbp 16;
+lddw;
+ldiqw nloops;
+lddw;
+sltdw;
+jmpf @L1251;
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_card;
+call 8;
+pop;
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+stdw;
+pop;
+@L1250:
+incldw 16;
+jmp @L1249;
+@L1251:
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L1252:
+ldbp 16;
+lddw;
+ldiqw nloops;
+lddw;
+sltdw;
+jmpf @L1254;
+ldidw 0;
+ldbp 20;
+stdw;
+pop;
+@L1255:
+ldbp 20;
+lddw;
+ldiqw nloops;
+lddw;
+sltdw;
+jmpf @L1257;
+ldiqw loops;
+ldqw;
+ldbp 20;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+sgtdw;
+jmpf @L1260;
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw lp_entry_bb;
+lddw;
+subdw;
+ldiqw loops;
+ldqw;
+ldbp 20;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L1260;
+ldidw 1;
+jmp @L1261;
+@L1260:
+ldidw 0;
+@L1261:
+jmpf @L1258;
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 28;
+addqw;
+lddw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L1262;
+ldiqw loops;
+ldqw;
+ldbp 20;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw loops;
+ldqw;
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 28;
+addqw;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+sltdw;
+jmpt @L1262;
+ldidw 0;
+jmp @L1263;
+@L1262:
+ldidw 1;
+@L1263:
+jmpf @L1258;
+ldidw 1;
+jmp @L1259;
+@L1258:
+ldidw 0;
+@L1259:
+jmpf @L1264;
+ldbp 20;
+lddw;
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 28;
+addqw;
+stdw;
+pop;
+@L1264:
+@L1256:
+incldw 20;
+jmp @L1255;
+@L1257:
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 28;
+addqw;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L1265;
+ldidw 1;
+ldiqw loops;
+ldqw;
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 28;
+addqw;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 32;
+addqw;
+stdw;
+pop;
+@L1265:
+ldidw 0;
+ldbp 32;
+stdw;
+pop;
+@L1266:
+ldbp 32;
+lddw;
+ldbp 40;
+lddw;
+ultdw;
+jmpf @L1268;
+ldbp 32;
+lddw;
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L1269;
+ldiqw lp_inner;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L1271;
+ldiqw loops;
+ldqw;
+ldiqw lp_inner;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+sgtdw;
+jmpt @L1271;
+ldidw 0;
+jmp @L1272;
+@L1271:
+ldidw 1;
+@L1272:
+jmpf @L1269;
+ldidw 1;
+jmp @L1270;
+@L1269:
+ldidw 0;
+@L1270:
+jmpf @L1273;
+ldbp 16;
+lddw;
+ldiqw lp_inner;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L1273:
+@L1267:
+incldw 32;
+jmp @L1266;
+@L1268:
+@L1253:
+incldw 16;
+jmp @L1252;
+@L1254:
+ldiqw nloops;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1274;
+ldidw 0;
+dw2qw;
+ret;
+@L1274:
+ldiqw loop_number_vars;
+call 0;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L1275:
+ldbp 16;
+lddw;
+ldiqw nloops;
+lddw;
+sltdw;
+jmpf @L1277;
+ldiqw lp_nvars;
+lddw;
+ldiqw bset_new;
+call 4;
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw lp_first;
+lddw;
+ldbp 36;
+stdw;
+pop;
+@L1278:
+ldbp 36;
+lddw;
+ldiqw lp_last;
+lddw;
+uletdw;
+jmpf @L1280;
+ldiqw lp_blk;
+ldqw;
+ldbp 36;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L1281;
+ldbp 36;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+jmpf @L1283;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L1285;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L1285;
+ldidw 0;
+jmp @L1286;
+@L1285:
+ldidw 1;
+@L1286:
+jmpf @L1283;
+ldidw 1;
+jmp @L1284;
+@L1283:
+ldidw 0;
+@L1284:
+jmpf @L1281;
+ldidw 1;
+jmp @L1282;
+@L1281:
+ldidw 0;
+@L1282:
+jmpf @L1287;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw loops;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L1287:
+@L1279:
+incldw 36;
+jmp @L1278;
+@L1280:
+@L1276:
+incldw 16;
+jmp @L1275;
+@L1277:
+ldiqw nloops;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `new_cg_node' ====
+.text
+new_cg_node:
+.global new_cg_node
+addsp 12;        
+# param:`func_id', offset:-24
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L1288:
+ldbp 4;
+lddw;
+ldiqw cg_nodes_counter;
+lddw;
+ultdw;
+jmpf @L1290;
+ldbp -24;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L1291;
+ldbp 4;
+lddw;
+udw2qw;
+ret;
+@L1291:
+@L1289:
+incldw 4;
+jmp @L1288;
+@L1290:
+ldiqw cg_nodes_counter;
+lddw;
+ldiqw cg_nodes_max;
+lddw;
+ugetdw;
+jmpf @L1292;
+# var: p, offset: 8
+ldiqw cg_nodes_max;
+lddw;
+ldidw 2;
+muldw;
+ldiqw cg_nodes_max;
+stdw;
+pop;
+ldiqw cg_nodes_max;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1293;
+ldiqw @S59;
+ldiqw ic_out_of_memory;
+call 8;
+pop;
+pop;
+@L1293:
+ldbp 8;
+ldqw;
+ldiqw cg_nodes;
+stqw;
+pop;
+pop;
+@L1292:
+ldiqw 72;
+ldidw 0;
+ldiqw cg_nodes;
+ldqw;
+ldiqw cg_nodes_counter;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw cg_nodes_counter;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw cg_nodes;
+ldqw;
+ldiqw cg_nodes_counter;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+ldiqw edge_init;
+call 12;
+pop;
+pop;
+ldiqw cg_nodes_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `new_cfg_node' ====
+.text
+new_cfg_node:
+addsp 12;        
+# param:`leader', offset:-20
+ldiqw cfg_nodes_counter;
+lddw;
+ldiqw cfg_nodes_max;
+lddw;
+ugetdw;
+jmpf @L1294;
+# var: p, offset: 8
+ldiqw cfg_nodes_max;
+lddw;
+ldidw 2;
+muldw;
+ldiqw cfg_nodes_max;
+stdw;
+pop;
+ldiqw cfg_nodes_max;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1295;
+ldiqw @S60;
+ldiqw ic_out_of_memory;
+call 8;
+pop;
+pop;
+@L1295:
+ldbp 8;
+ldqw;
+ldiqw cfg_nodes;
+stqw;
+pop;
+pop;
+@L1294:
+ldbp -20;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cfg_nodes_counter;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 2;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cfg_nodes_counter;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw edge_init;
+call 12;
+pop;
+pop;
+ldidw 5;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cfg_nodes_counter;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw edge_init;
+call 12;
+pop;
+pop;
+ldiqw cfg_nodes_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+.extern warning_count
+# ==== start of definition of function `ic_simplify' ====
+.text
+ic_simplify:
+addsp 12;        
+# var: i, offset: 4
+ldiqw ic_func_first_instr;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L1296:
+ldbp 4;
+lddw;
+ldiqw ic_instructions_counter;
+lddw;
+ultdw;
+jmpf @L1298;
+# var: arg1, offset: 8
+# var: arg2, offset: 12
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T1299;
+switch;
+@L1301:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1302;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1303;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+addqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1304;
+@L1303:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1305;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+@L1305:
+@L1304:
+jmp @L1306;
+@L1302:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1307;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1307;
+ldidw 1;
+jmp @L1308;
+@L1307:
+ldidw 0;
+@L1308:
+jmpf @L1309;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L1309:
+@L1306:
+jmp @L1300;
+@L1310:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1311;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1312;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+subqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1313;
+@L1312:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1314;
+ldidw 16;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+@L1314:
+@L1313:
+jmp @L1315;
+@L1311:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1316;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1316;
+ldidw 1;
+jmp @L1317;
+@L1316:
+ldidw 0;
+@L1317:
+jmpf @L1318;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L1318:
+@L1315:
+jmp @L1300;
+@L1319:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1320;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1321;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+mulqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1322;
+@L1321:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1323;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L1324;
+@L1323:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+eqqw;
+jmpf @L1325;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+jmp @L1326;
+@L1325:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+negdw;
+dw2qw;
+eqqw;
+jmpf @L1327;
+ldidw 16;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+jmp @L1328;
+@L1327:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1329;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+subqw;
+andqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1329;
+ldidw 1;
+jmp @L1330;
+@L1329:
+ldidw 0;
+@L1330:
+jmpf @L1331;
+ldidw 5;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw ilog2;
+call 4;
+pop;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+stdw;
+pop;
+@L1331:
+@L1328:
+@L1326:
+@L1324:
+@L1322:
+jmp @L1332;
+@L1320:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1333;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1334;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+jmp @L1335;
+@L1334:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+eqqw;
+jmpf @L1336;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L1337;
+@L1336:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+negdw;
+dw2qw;
+eqqw;
+jmpf @L1338;
+ldidw 16;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L1339;
+@L1338:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1340;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+subqw;
+andqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1340;
+ldidw 1;
+jmp @L1341;
+@L1340:
+ldidw 0;
+@L1341:
+jmpf @L1342;
+ldidw 5;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw ilog2;
+call 4;
+pop;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1342:
+@L1339:
+@L1337:
+@L1335:
+@L1333:
+@L1332:
+jmp @L1300;
+@L1343:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1344;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1345;
+@L1346:
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L1349;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+udivqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1350;
+@L1349:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+sdivqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1350:
+@L1347:
+ldidw 0;
+jmpf @L1348;
+jmp @L1346;
+@L1348:
+jmp @L1351;
+@L1345:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1352;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L1352:
+@L1351:
+jmp @L1353;
+@L1344:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1354;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+eqqw;
+jmpf @L1355;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L1356;
+@L1355:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1359;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+subqw;
+andqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1359;
+ldidw 1;
+jmp @L1360;
+@L1359:
+ldidw 0;
+@L1360:
+jmpf @L1357;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L1357;
+ldidw 1;
+jmp @L1358;
+@L1357:
+ldidw 0;
+@L1358:
+jmpf @L1361;
+ldidw 6;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw ilog2;
+call 4;
+pop;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1361:
+@L1356:
+@L1354:
+@L1353:
+jmp @L1300;
+@L1362:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1363;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1364;
+@L1365:
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L1368;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+umodqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1369;
+@L1368:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+smodqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1369:
+@L1366:
+ldidw 0;
+jmpf @L1367;
+jmp @L1365;
+@L1367:
+jmp @L1370;
+@L1364:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1371;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L1371:
+@L1370:
+jmp @L1372;
+@L1363:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1373;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+eqqw;
+jmpf @L1374;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1375;
+@L1374:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1378;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+subqw;
+andqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1378;
+ldidw 1;
+jmp @L1379;
+@L1378:
+ldidw 0;
+@L1379:
+jmpf @L1376;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L1376;
+ldidw 1;
+jmp @L1377;
+@L1376:
+ldidw 0;
+@L1377:
+jmpf @L1380;
+ldidw 7;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+subqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1380:
+@L1375:
+@L1373:
+@L1372:
+jmp @L1300;
+@L1381:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1382;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1383;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+sllqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1384;
+@L1383:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1385;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L1385:
+@L1384:
+jmp @L1386;
+@L1382:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1387;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1387;
+ldidw 1;
+jmp @L1388;
+@L1387:
+ldidw 0;
+@L1388:
+jmpf @L1389;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L1389:
+@L1386:
+jmp @L1300;
+@L1390:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1391;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1392;
+@L1393:
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L1396;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+srlqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1397;
+@L1396:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+sraqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1397:
+@L1394:
+ldidw 0;
+jmpf @L1395;
+jmp @L1393;
+@L1395:
+jmp @L1398;
+@L1392:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1399;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L1399:
+@L1398:
+jmp @L1400;
+@L1391:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1401;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1401;
+ldidw 1;
+jmp @L1402;
+@L1401:
+ldidw 0;
+@L1402:
+jmpf @L1403;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L1403:
+@L1400:
+jmp @L1300;
+@L1404:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1405;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1406;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+andqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1407;
+@L1406:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1408;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L1408:
+@L1407:
+jmp @L1409;
+@L1405:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1410;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1410;
+ldidw 1;
+jmp @L1411;
+@L1410:
+ldidw 0;
+@L1411:
+jmpf @L1412;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+@L1412:
+@L1409:
+jmp @L1300;
+@L1413:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1414;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1415;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+orqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1416;
+@L1415:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1417;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+@L1417:
+@L1416:
+jmp @L1418;
+@L1414:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1419;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1419;
+ldidw 1;
+jmp @L1420;
+@L1419:
+ldidw 0;
+@L1420:
+jmpf @L1421;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L1421:
+@L1418:
+jmp @L1300;
+@L1422:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1423;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1424;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+xorqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1425;
+@L1424:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1426;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+@L1426:
+@L1425:
+jmp @L1427;
+@L1423:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1428;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1428;
+ldidw 1;
+jmp @L1429;
+@L1428:
+ldidw 0;
+@L1429:
+jmpf @L1430;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L1430:
+@L1427:
+jmp @L1300;
+@L1431:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1432;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1432;
+ldidw 1;
+jmp @L1433;
+@L1432:
+ldidw 0;
+@L1433:
+jmpf @L1434;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw int_ty;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1434:
+jmp @L1300;
+@L1435:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1436;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1436;
+ldidw 1;
+jmp @L1437;
+@L1436:
+ldidw 0;
+@L1437:
+jmpf @L1438;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+neqqw;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw int_ty;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1438:
+jmp @L1300;
+@L1439:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1440;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1440;
+ldidw 1;
+jmp @L1441;
+@L1440:
+ldidw 0;
+@L1441:
+jmpf @L1442;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L1443;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+sltqw;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1444;
+@L1443:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ultqw;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1444:
+ldiqw int_ty;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1442:
+jmp @L1300;
+@L1445:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1446;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1446;
+ldidw 1;
+jmp @L1447;
+@L1446:
+ldidw 0;
+@L1447:
+jmpf @L1448;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L1449;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+sletqw;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1450;
+@L1449:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+uletqw;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1450:
+ldiqw int_ty;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1448:
+jmp @L1300;
+@L1451:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1452;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1452;
+ldidw 1;
+jmp @L1453;
+@L1452:
+ldidw 0;
+@L1453:
+jmpf @L1454;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L1455;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+sgtqw;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1456;
+@L1455:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ugtqw;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1456:
+ldiqw int_ty;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1454:
+jmp @L1300;
+@L1457:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1458;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1458;
+ldidw 1;
+jmp @L1459;
+@L1458:
+ldidw 0;
+@L1459:
+jmpf @L1460;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L1461;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+sgetqw;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1462;
+@L1461:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ugetqw;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1462:
+ldiqw int_ty;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1460:
+jmp @L1300;
+@L1463:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1464;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+negqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1464:
+jmp @L1300;
+@L1465:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1466;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+cmplqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1466:
+jmp @L1300;
+@L1467:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1468;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+notqw;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1468:
+jmp @L1300;
+@L1469:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1470;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+dw2b;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1470:
+jmp @L1300;
+@L1471:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1472;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+dw2ub;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1472:
+jmp @L1300;
+@L1473:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1474;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+dw2w;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1474:
+jmp @L1300;
+@L1475:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1476;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+dw2uw;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1476:
+jmp @L1300;
+@L1477:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1478;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1478:
+jmp @L1300;
+@L1479:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1480;
+ldidw 27;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1480:
+jmp @L1300;
+@L1481:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1482;
+ldidw 32;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+notqw;
+jmpf @L1483;
+ldbp 12;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+@L1483:
+@L1482:
+jmp @L1300;
+@L1300:
+.data
+.align 8
+@T1299:
+.dword 27
+.dword 0
+.dword 1
+.dword 2
+.dword 3
+.dword 4
+.dword 5
+.dword 6
+.dword 7
+.dword 8
+.dword 9
+.dword 10
+.dword 11
+.dword 12
+.dword 13
+.dword 14
+.dword 15
+.dword 16
+.dword 17
+.dword 18
+.dword 19
+.dword 20
+.dword 21
+.dword 22
+.dword 23
+.dword 24
+.dword 37
+.qword @L1300
+.qword @L1301
+.qword @L1310
+.qword @L1319
+.qword @L1343
+.qword @L1362
+.qword @L1381
+.qword @L1390
+.qword @L1404
+.qword @L1413
+.qword @L1422
+.qword @L1431
+.qword @L1435
+.qword @L1439
+.qword @L1445
+.qword @L1451
+.qword @L1457
+.qword @L1463
+.qword @L1465
+.qword @L1467
+.qword @L1469
+.qword @L1471
+.qword @L1473
+.qword @L1475
+.qword @L1477
+.qword @L1479
+.qword @L1481
+.text
+@L1297:
+incldw 4;
+jmp @L1296;
+@L1298:
+ldidw 0;
+ret;
+.extern memcpy
+.bss
+.align 8
+inl_size:
+.res 8
+.data
+.align 8
+unsigned_ty:
+.align 8
+.align 8
+.qword unsigned_expr+0
+.align 8
+.zero 8
+# ==== start of definition of function `print_binop' ====
+.text
+print_binop:
+addsp 0;         
+# param:`i', offset:-24
+# param:`op', offset:-32
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+ldiqw @S61;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw @S62;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern fopen
+.extern be_atoi
+.extern bset_delete
+# ==== start of definition of function `get_label_address' ====
+.text
+get_label_address:
+addsp 12;        
+# param:`str', offset:-24
+# var: np, offset: 8
+ldiqw ic_labels;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L1484:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1486;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L1487;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ret;
+@L1487:
+@L1485:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L1484;
+@L1486:
+@L1488:
+ldidw 0;
+notdw;
+jmpf @L1491;
+ldidw 3677;
+ldiqw @S63;
+ldiqw @S64;
+ldiqw @S65;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L1491:
+@L1489:
+ldidw 0;
+jmpf @L1490;
+jmp @L1488;
+@L1490:
+ldidw 0;
+ret;
+.extern push_scope
+.extern free_c_token
+# ==== start of definition of function `ic_main' ====
+.text
+ic_main:
+.global ic_main
+addsp 36;        
+# param:`func_def_list', offset:-24
+# param:`ext_sym_list', offset:-32
+# var: ed, offset: 8
+# var: i, offset: 16
+# var: j, offset: 20
+ldiqw get_external_declarations;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp 20;
+stdw;
+ldbp 16;
+stdw;
+pop;
+@L1492:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1494;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1495;
+incldw 20;
+jmp @L1496;
+@L1495:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1497;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L1497;
+ldidw 1;
+jmp @L1498;
+@L1497:
+ldidw 0;
+@L1498:
+jmpf @L1499;
+incldw 16;
+@L1499:
+@L1496:
+@L1493:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L1492;
+@L1494:
+ldiqw 8;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldbp -24;
+ldqw;
+stqw;
+pop;
+pop;
+ldiqw 8;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldbp -32;
+ldqw;
+stqw;
+pop;
+pop;
+ldiqw get_external_declarations;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 20;
+stdw;
+ldbp 16;
+stdw;
+pop;
+@L1500:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1502;
+# var: scs, offset: 24
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1503;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 24;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L1504;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L1504;
+ldidw 0;
+jmp @L1505;
+@L1504:
+ldidw 1;
+@L1505:
+jmpf @L1506;
+ldbp 8;
+ldqw;
+ldbp -32;
+ldqw;
+ldqw;
+ldbp 20;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L1506:
+jmp @L1507;
+@L1503:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1508;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L1508;
+ldidw 1;
+jmp @L1509;
+@L1508:
+ldidw 0;
+@L1509:
+jmpf @L1510;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldqw;
+ldbp 16;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L1511;
+@L1510:
+# var: np, offset: 32
+ldiqw 40;
+ldiqw malloc;
+call 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 32;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw static_objects_list;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw static_objects_list;
+stqw;
+pop;
+pop;
+@L1511:
+@L1507:
+@L1501:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L1500;
+@L1502:
+ldiqw ic_init;
+call 0;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L1512:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1514;
+ldiqw ic_instructions_counter;
+lddw;
+ldiqw ic_func_first_instr;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw new_cg_node;
+call 8;
+pop;
+ldiqw curr_cg_node;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw ic_function_definition;
+call 16;
+pop;
+pop;
+ldiqw ic_simplify;
+call 0;
+pop;
+pop;
+ldiqw build_CFG;
+call 0;
+pop;
+pop;
+ldiqw ic_reset;
+call 0;
+pop;
+pop;
+@L1513:
+incldw 16;
+ldbp -24;
+ldqw;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L1512;
+@L1514:
+ldbp 16;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1515;
+ldiqw 0;
+ret;
+@L1515:
+ldiqw ic_find_atv;
+call 0;
+pop;
+pop;
+ldiqw opt_level;
+lddw;
+ldidw 3;
+sgetdw;
+jmpf @L1516;
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw ic_inline_functions;
+call 8;
+pop;
+pop;
+ldiqw ic_optimize_loops;
+call 0;
+pop;
+pop;
+@L1516:
+ldiqw nid_counter;
+lddw;
+ldiqw bset_new;
+call 4;
+ldiqw address_taken_variables;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L1517:
+ldbp 16;
+lddw;
+ldiqw atv_counter;
+lddw;
+ultdw;
+jmpf @L1519;
+ldiqw atv_table;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldxdw 4;
+ldiqw address_taken_variables;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L1518:
+incldw 16;
+jmp @L1517;
+@L1519:
+ldiqw atv_table;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw number_CG;
+call 0;
+pop;
+pop;
+ldiqw opt_level;
+lddw;
+jmpf @L1520;
+ldiqw opt_main;
+call 0;
+pop;
+pop;
+@L1520:
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L1521:
+ldbp 16;
+lddw;
+ldiqw cg_nodes_counter;
+lddw;
+ultdw;
+jmpf @L1523;
+ldiqw ic_outpath;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1524;
+ldiqw ic_function_to_print;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L1524;
+ldidw 1;
+jmp @L1525;
+@L1524:
+ldidw 0;
+@L1525:
+jmpf @L1526;
+ldiqw @S66;
+ldiqw ic_outpath;
+ldqw;
+ldiqw fopen;
+call 16;
+ldiqw ic_file;
+stqw;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldiqw dump_ic;
+call 4;
+pop;
+pop;
+ldiqw ic_file;
+ldqw;
+ldiqw fclose;
+call 8;
+pop;
+pop;
+@L1526:
+ldiqw cfg_outpath;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1527;
+ldiqw cfg_function_to_print;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L1527;
+ldidw 1;
+jmp @L1528;
+@L1527:
+ldidw 0;
+@L1528:
+jmpf @L1529;
+ldiqw @S67;
+ldiqw cfg_outpath;
+ldqw;
+ldiqw fopen;
+call 16;
+ldiqw cfg_dotfile;
+stqw;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldiqw print_CFG;
+call 4;
+pop;
+pop;
+ldiqw cfg_dotfile;
+ldqw;
+ldiqw fclose;
+call 8;
+pop;
+pop;
+@L1529:
+@L1522:
+incldw 16;
+jmp @L1521;
+@L1523:
+ldiqw cg_outpath;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1530;
+ldiqw @S68;
+ldiqw cg_outpath;
+ldqw;
+ldiqw fopen;
+call 16;
+ldiqw cg_dotfile;
+stqw;
+pop;
+pop;
+ldiqw print_CG;
+call 0;
+pop;
+pop;
+ldiqw cg_dotfile;
+ldqw;
+ldiqw fclose;
+call 8;
+pop;
+pop;
+@L1530:
+ldidw 0;
+ret;
+# ==== start of definition of function `new_address' ====
+.text
+new_address:
+.global new_address
+addsp 12;        
+# param:`kind', offset:-20
+ldiqw ic_addresses_counter;
+lddw;
+ldiqw ic_addresses_max;
+lddw;
+ugetdw;
+jmpf @L1531;
+# var: p, offset: 8
+ldiqw ic_addresses_max;
+lddw;
+ldidw 2;
+muldw;
+ldiqw ic_addresses_max;
+stdw;
+pop;
+ldiqw ic_addresses_max;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1532;
+ldiqw @S69;
+ldiqw ic_out_of_memory;
+call 8;
+pop;
+pop;
+@L1532:
+ldbp 8;
+ldqw;
+ldiqw ic_addresses;
+stqw;
+pop;
+pop;
+@L1531:
+ldiqw 32;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_addresses_counter;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_addresses_counter;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.data
+.align 8
+unsigned_expr:
+.align 8
+.align 4
+.dword 72
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+# ==== start of definition of function `ic_if_statement' ====
+.text
+ic_if_statement:
+addsp 16;        
+# param:`s', offset:-24
+# var: else_part, offset: 4
+# var: L1, offset: 8
+# var: L2, offset: 12
+# var: L3, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+ldbp 4;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 4;
+lddw;
+jmpf @L1533;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+@L1533:
+ldiqw verbose_asm;
+lddw;
+jmpf @L1534;
+ldbp -24;
+ldqw;
+ldiqw ast2c;
+call 8;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L1534:
+ldbp 12;
+lddw;
+ldbp 8;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_controlling_expression;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_statement;
+call 8;
+pop;
+pop;
+ldbp 4;
+lddw;
+jmpf @L1535;
+ldidw 0;
+ldidw 0;
+ldbp 16;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 32;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L1536;
+ldiqw @S70;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L1536:
+@L1535:
+ldbp 12;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp 4;
+lddw;
+jmpf @L1537;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw ic_statement;
+call 8;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+@L1537:
+ldidw 0;
+ret;
+.bss
+.align 8
+lp_needed:
+.res 8
+.extern parse
+.extern get_pre_token
+# ==== start of definition of function `is_direct_call' ====
+.text
+is_direct_call:
+addsp 12;        
+# param:`e', offset:-24
+# var: tmp, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L1538:
+ldbp 8;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1539;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L1538;
+@L1539:
+ldbp 8;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L1540;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 98;
+eqdw;
+jmpf @L1540;
+ldidw 1;
+jmp @L1541;
+@L1540:
+ldidw 0;
+@L1541:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `loop_free' ====
+.text
+loop_free:
+addsp 4;         
+# param:`fn', offset:-20
+# var: L, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L1542:
+ldbp 4;
+lddw;
+ldiqw nloops;
+lddw;
+sltdw;
+jmpf @L1544;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1545;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+@L1545:
+@L1543:
+incldw 4;
+jmp @L1542;
+@L1544:
+ldiqw loops;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw nloops;
+lddw;
+jmpf @L1546;
+ldiqw var_ndefs;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw var_def;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw var_tracked;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+@L1546:
+ldidw 0;
+ldiqw lp_nvars;
+stdw;
+ldiqw nloops;
+stdw;
+pop;
+ldiqw lp_blk;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw lp_inner;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldiqw dflow_free_Dom;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+visited:
+.res 8
+.bss
+.align 8
+id_table_arena:
+.res 8
+# ==== start of definition of function `ic_dereference' ====
+.text
+ic_dereference:
+addsp 8;         
+# param:`ptr', offset:-20
+# param:`ty', offset:-28
+# var: dst, offset: 4
+ldbp -28;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T1547;
+switch;
+@L1549:
+@L1550:
+ldbp -20;
+lddw;
+udw2qw;
+ret;
+@L1548:
+.data
+.align 8
+@T1547:
+.dword 3
+.dword 97
+.dword 98
+.qword @L1548
+.qword @L1549
+.qword @L1550
+.text
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L1551;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L1551;
+ldidw 0;
+jmp @L1552;
+@L1551:
+ldidw 1;
+@L1552:
+jmpf @L1553;
+# var: tmp, offset: 8
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp -20;
+lddw;
+ldbp 8;
+lddw;
+ldiqw long_ty;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldbp -20;
+stdw;
+pop;
+@L1553:
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp -20;
+lddw;
+ldbp 4;
+lddw;
+ldbp -28;
+ldqw;
+ldidw 26;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 4;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 8
+memcpy_node:
+.res 104
+.bss
+.align 8
+nid_map:
+.res 8
+.extern get_member_descriptor
+.bss
+.align 4
+nid_max:
+.res 4
+.extern decl_init
+# ==== start of definition of function `ic_free_function' ====
+.text
+ic_free_function:
+.global ic_free_function
+addsp 4;         
+# param:`fn', offset:-20
+# var: b, offset: 4
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1554;
+ldiqw 0;
+ret;
+@L1554:
+ldbp -20;
+lddw;
+ldiqw dflow_free_LiveOut;
+call 4;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldiqw dflow_exit_function;
+call 4;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L1555:
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+uletdw;
+jmpf @L1557;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw edge_free;
+call 8;
+pop;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw edge_free;
+call 8;
+pop;
+pop;
+ldiqw 16;
+ldidw 0;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldiqw 16;
+ldidw 0;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+@L1556:
+incldw 4;
+jmp @L1555;
+@L1557:
+ldidw 0;
+ret;
+.extern dup_declarator
+.bss
+.align 8
+cg_nodes:
+.res 8
+.global cg_nodes
+.extern strncat
+.bss
+.align 4
+exit_label:
+.res 4
+# ==== start of definition of function `ic_find_atv_in_init' ====
+.text
+ic_find_atv_in_init:
+addsp 20;        
+# param:`ds', offset:-24
+# param:`dct', offset:-32
+# param:`e', offset:-40
+# var: ts, offset: 8
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1558;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L1559;
+jmp @@ic_find_atv_in_init_scalar;
+@L1559:
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L1560;
+ldiqw 0;
+ret;
+@L1560:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L1561:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1563;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw ic_find_atv_in_init;
+call 24;
+pop;
+pop;
+@L1562:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+jmp @L1561;
+@L1563:
+jmp @L1564;
+@L1558:
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 68;
+eqdw;
+jmpf @L1565;
+# var: d, offset: 16
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L1566:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1568;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L1569:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1572;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1572;
+ldidw 1;
+jmp @L1573;
+@L1572:
+ldidw 0;
+@L1573:
+jmpf @L1571;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw ic_find_atv_in_init;
+call 24;
+pop;
+pop;
+@L1570:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L1569;
+@L1571:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1574;
+jmp @L1568;
+@L1574:
+@L1567:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L1566;
+@L1568:
+jmp @L1575;
+@L1565:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+jmpf @L1576;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -40;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw ic_find_atv_in_init;
+call 24;
+pop;
+pop;
+jmp @L1577;
+@L1576:
+@@ic_find_atv_in_init_scalar:
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1578;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+eqdw;
+jmpf @L1578;
+ldidw 1;
+jmp @L1579;
+@L1578:
+ldidw 0;
+@L1579:
+jmpf @L1580;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L1580:
+ldbp -40;
+ldqw;
+ldiqw ic_find_atv_in_expr;
+call 8;
+pop;
+pop;
+@L1577:
+@L1575:
+@L1564:
+ldidw 0;
+ret;
+# ==== start of definition of function `loop_trip_count' ====
+.text
+loop_trip_count:
+addsp 116;       
+# param:`L', offset:-20
+# var: lp, offset: 8
+# var: h, offset: 16
+# var: B, offset: 20
+# var: P, offset: 24
+# var: r0, offset: 28
+# var: r1, offset: 32
+# var: i, offset: 36
+# var: cd, offset: 40
+# var: u, offset: 44
+# var: iv, offset: 48
+# var: nb, offset: 52
+# var: ivop, offset: 56
+# var: n, offset: 60
+# var: cont, offset: 64
+# var: step, offset: 72
+# var: val, offset: 80
+# var: c, offset: 88
+# var: in_range, offset: 96
+# var: e, offset: 104
+ldiqw loops;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+lddw;
+jmpt @L1583;
+ldiqw loops;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw lp_entry_bb;
+lddw;
+ldidw 1;
+adddw;
+neqdw;
+jmpf @L1585;
+ldiqw ic_instructions;
+ldqw;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw loops;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 31;
+eqdw;
+jmpf @L1585;
+ldidw 1;
+jmp @L1586;
+@L1585:
+ldidw 0;
+@L1586:
+notdw;
+jmpt @L1583;
+ldidw 0;
+jmp @L1584;
+@L1583:
+ldidw 1;
+@L1584:
+jmpt @L1581;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldidw 2;
+neqdw;
+jmpt @L1581;
+ldidw 0;
+jmp @L1582;
+@L1581:
+ldidw 1;
+@L1582:
+jmpf @L1587;
+ldidw 0;
+dw2qw;
+ret;
+@L1587:
+ldiqw cfg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldiqw lp_entry_bb;
+lddw;
+subdw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L1588;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldbp 20;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldbp 24;
+stdw;
+pop;
+jmp @L1589;
+@L1588:
+ldiqw cfg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldbp 20;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldbp 24;
+stdw;
+pop;
+@L1589:
+ldbp 24;
+lddw;
+ldiqw lp_entry_bb;
+lddw;
+subdw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpt @L1590;
+ldbp 20;
+lddw;
+ldiqw lp_entry_bb;
+lddw;
+subdw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpt @L1590;
+ldidw 0;
+jmp @L1591;
+@L1590:
+ldidw 1;
+@L1591:
+jmpf @L1592;
+ldidw 0;
+dw2qw;
+ret;
+@L1592:
+ldiqw cfg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 28;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 32;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldbp 28;
+lddw;
+ultdw;
+jmpt @L1593;
+ldiqw ic_instructions;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 37;
+neqdw;
+jmpt @L1593;
+ldidw 0;
+jmp @L1594;
+@L1593:
+ldidw 1;
+@L1594:
+jmpf @L1595;
+ldidw 0;
+dw2qw;
+ret;
+@L1595:
+ldidw 0;
+ldbp 52;
+stdw;
+pop;
+ldbp 28;
+lddw;
+ldbp 36;
+stdw;
+pop;
+@L1596:
+ldbp 36;
+lddw;
+ldbp 32;
+lddw;
+uletdw;
+jmpf @L1598;
+# var: b, offset: 112
+# var: k, offset: 116
+ldiqw lp_blk;
+ldqw;
+ldbp 36;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldiqw loops;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L1599;
+ldidw 0;
+dw2qw;
+ret;
+@L1599:
+ldiqw lp_blk;
+ldqw;
+ldbp 36;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldiqw lp_entry_bb;
+lddw;
+adddw;
+ldbp 112;
+stdw;
+pop;
+ldbp 36;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 112;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+neqdw;
+jmpf @L1600;
+jmp @L1597;
+@L1600:
+incldw 52;
+ldidw 0;
+ldbp 116;
+stdw;
+pop;
+@L1601:
+ldbp 116;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 112;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ultdw;
+jmpf @L1603;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 112;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 116;
+lddw;
+udw2qw;
+ldxdw 4;
+ldiqw lp_entry_bb;
+lddw;
+subdw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L1604;
+ldbp 112;
+lddw;
+ldbp 20;
+lddw;
+neqdw;
+jmpf @L1604;
+ldidw 1;
+jmp @L1605;
+@L1604:
+ldidw 0;
+@L1605:
+jmpf @L1606;
+ldidw 0;
+dw2qw;
+ret;
+@L1606:
+@L1602:
+incldw 116;
+jmp @L1601;
+@L1603:
+@L1597:
+incldw 36;
+jmp @L1596;
+@L1598:
+ldbp 52;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+neqdw;
+jmpf @L1607;
+ldidw 0;
+dw2qw;
+ret;
+@L1607:
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+neqdw;
+jmpt @L1608;
+ldiqw var_ndefs;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+neqdw;
+jmpt @L1608;
+ldidw 0;
+jmp @L1609;
+@L1608:
+ldidw 1;
+@L1609:
+jmpf @L1610;
+ldidw 0;
+dw2qw;
+ret;
+@L1610:
+ldiqw var_def;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldbp 40;
+stdw;
+pop;
+ldbp 40;
+lddw;
+ldbp 28;
+lddw;
+ultdw;
+jmpt @L1615;
+ldbp 40;
+lddw;
+ldbp 32;
+lddw;
+ugtdw;
+jmpt @L1615;
+ldidw 0;
+jmp @L1616;
+@L1615:
+ldidw 1;
+@L1616:
+jmpt @L1613;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 10;
+sltdw;
+jmpt @L1613;
+ldidw 0;
+jmp @L1614;
+@L1613:
+ldidw 1;
+@L1614:
+jmpt @L1611;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 15;
+sgtdw;
+jmpt @L1611;
+ldidw 0;
+jmp @L1612;
+@L1611:
+ldidw 1;
+@L1612:
+jmpf @L1617;
+ldidw 0;
+dw2qw;
+ret;
+@L1617:
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1618;
+ldidw 1;
+ldbp 56;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 48;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 88;
+stqw;
+pop;
+pop;
+jmp @L1619;
+@L1618:
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1620;
+ldidw 2;
+ldbp 56;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 48;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 88;
+stqw;
+pop;
+pop;
+jmp @L1621;
+@L1620:
+ldidw 0;
+dw2qw;
+ret;
+@L1621:
+@L1619:
+ldbp 72;
+ldbp -20;
+lddw;
+ldbp 48;
+lddw;
+ldiqw loop_basic_iv;
+call 16;
+pop;
+ldbp 44;
+stdw;
+ldidw 0;
+eqdw;
+jmpt @L1624;
+ldiqw lp_blk;
+ldqw;
+ldbp 44;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp 20;
+lddw;
+ldiqw lp_entry_bb;
+lddw;
+subdw;
+neqdw;
+jmpt @L1624;
+ldidw 0;
+jmp @L1625;
+@L1624:
+ldidw 1;
+@L1625:
+jmpt @L1622;
+ldbp 44;
+lddw;
+ldbp 40;
+lddw;
+ugtdw;
+jmpt @L1622;
+ldidw 0;
+jmp @L1623;
+@L1622:
+ldidw 1;
+@L1623:
+jmpf @L1626;
+ldidw 0;
+dw2qw;
+ret;
+@L1626:
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+ldbp 64;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 36;
+stdw;
+pop;
+@L1627:
+ldbp 36;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+jmpf @L1632;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L1634;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L1634;
+ldidw 0;
+jmp @L1635;
+@L1634:
+ldidw 1;
+@L1635:
+jmpf @L1632;
+ldidw 1;
+jmp @L1633;
+@L1632:
+ldidw 0;
+@L1633:
+jmpf @L1630;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 48;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpf @L1630;
+ldidw 1;
+jmp @L1631;
+@L1630:
+ldidw 0;
+@L1631:
+jmpf @L1636;
+jmp @L1629;
+@L1636:
+ldbp 36;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+eqdw;
+jmpf @L1637;
+ldidw 0;
+dw2qw;
+ret;
+@L1637:
+@L1628:
+decldw 36;
+jmp @L1627;
+@L1629:
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 27;
+neqdw;
+jmpt @L1638;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+neqdw;
+jmpt @L1638;
+ldidw 0;
+jmp @L1639;
+@L1638:
+ldidw 1;
+@L1639:
+jmpf @L1640;
+ldidw 0;
+dw2qw;
+ret;
+@L1640:
+ldiqw ic_addresses;
+ldqw;
+ldbp 48;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 104;
+stqw;
+pop;
+pop;
+ldbp 104;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_signed_int;
+call 4;
+pop;
+ldbp 104;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw loop_truncate;
+call 16;
+ldbp 80;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp 60;
+stdw;
+pop;
+@L1641:
+# var: r, offset: 112
+ldbp 104;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_signed_int;
+call 4;
+pop;
+ldbp 104;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 80;
+ldqw;
+ldbp 72;
+ldqw;
+addqw;
+ldiqw loop_truncate;
+call 16;
+ldbp 80;
+stqw;
+pop;
+pop;
+ldbp 88;
+ldqw;
+ldbp 80;
+ldqw;
+ldbp 56;
+lddw;
+ldbp 40;
+lddw;
+ldiqw loop_compare;
+call 24;
+pop;
+ldbp 112;
+stdw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L1644;
+ldidw 0;
+dw2qw;
+ret;
+@L1644:
+ldbp 112;
+lddw;
+ldbp 64;
+lddw;
+neqdw;
+jmpf @L1645;
+jmp @L1643;
+@L1645:
+ldbp 60;
+lddw;
+ldidw 8;
+eqdw;
+jmpf @L1646;
+ldidw 0;
+dw2qw;
+ret;
+@L1646:
+@L1642:
+incldw 60;
+jmp @L1641;
+@L1643:
+ldbp 60;
+lddw;
+ldbp 32;
+lddw;
+ldbp 28;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+muldw;
+ldidw 96;
+sgtdw;
+jmpf @L1647;
+ldidw 0;
+dw2qw;
+ret;
+@L1647:
+ldidw 1;
+dw2qw;
+ldiqw lp_nvars;
+lddw;
+dw2qw;
+ldiqw calloc;
+call 16;
+ldbp 96;
+stqw;
+pop;
+pop;
+ldbp 28;
+lddw;
+ldbp 36;
+stdw;
+pop;
+@L1648:
+ldbp 36;
+lddw;
+ldbp 32;
+lddw;
+uletdw;
+jmpf @L1650;
+ldbp 36;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+jmpf @L1653;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L1655;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+ldiqw quad_def;
+call 4;
+pop;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L1655;
+ldidw 0;
+jmp @L1656;
+@L1655:
+ldidw 1;
+@L1656:
+jmpf @L1653;
+ldidw 1;
+jmp @L1654;
+@L1653:
+ldidw 0;
+@L1654:
+jmpf @L1651;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L1651;
+ldidw 1;
+jmp @L1652;
+@L1651:
+ldidw 0;
+@L1652:
+jmpf @L1657;
+ldidw 1;
+dw2b;
+ldbp 96;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+addqw;
+stb;
+pop;
+@L1657:
+@L1649:
+incldw 36;
+jmp @L1648;
+@L1650:
+ldiqw lp_first;
+lddw;
+ldbp 36;
+stdw;
+pop;
+@L1658:
+ldbp 36;
+lddw;
+ldiqw lp_last;
+lddw;
+uletdw;
+jmpf @L1660;
+ldbp 36;
+lddw;
+ldbp 28;
+lddw;
+ugetdw;
+jmpf @L1661;
+ldbp 36;
+lddw;
+ldbp 32;
+lddw;
+uletdw;
+jmpf @L1661;
+ldidw 1;
+jmp @L1662;
+@L1661:
+ldidw 0;
+@L1662:
+jmpf @L1663;
+jmp @L1659;
+@L1663:
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+jmpf @L1670;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L1672;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L1672;
+ldidw 0;
+jmp @L1673;
+@L1672:
+ldidw 1;
+@L1673:
+jmpf @L1670;
+ldidw 1;
+jmp @L1671;
+@L1670:
+ldidw 0;
+@L1671:
+jmpf @L1668;
+ldbp 96;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxb 1;
+jmpf @L1668;
+ldidw 1;
+jmp @L1669;
+@L1668:
+ldidw 0;
+@L1669:
+jmpt @L1666;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+jmpf @L1676;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L1678;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L1678;
+ldidw 0;
+jmp @L1679;
+@L1678:
+ldidw 1;
+@L1679:
+jmpf @L1676;
+ldidw 1;
+jmp @L1677;
+@L1676:
+ldidw 0;
+@L1677:
+jmpf @L1674;
+ldbp 96;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxb 1;
+jmpf @L1674;
+ldidw 1;
+jmp @L1675;
+@L1674:
+ldidw 0;
+@L1675:
+jmpt @L1666;
+ldidw 0;
+jmp @L1667;
+@L1666:
+ldidw 1;
+@L1667:
+jmpt @L1664;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+jmpf @L1682;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L1684;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L1684;
+ldidw 0;
+jmp @L1685;
+@L1684:
+ldidw 1;
+@L1685:
+jmpf @L1682;
+ldidw 1;
+jmp @L1683;
+@L1682:
+ldidw 0;
+@L1683:
+jmpf @L1680;
+ldbp 96;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxb 1;
+jmpf @L1680;
+ldidw 1;
+jmp @L1681;
+@L1680:
+ldidw 0;
+@L1681:
+jmpt @L1664;
+ldidw 0;
+jmp @L1665;
+@L1664:
+ldidw 1;
+@L1665:
+jmpf @L1686;
+jmp @L1660;
+@L1686:
+@L1659:
+incldw 36;
+jmp @L1658;
+@L1660:
+ldbp 96;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 36;
+lddw;
+ldiqw lp_last;
+lddw;
+uletdw;
+jmpf @L1687;
+ldidw 0;
+dw2qw;
+ret;
+@L1687:
+ldbp 32;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 44;
+addqw;
+stdw;
+pop;
+ldbp 60;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern dflow_free_Dom
+# ==== start of definition of function `ic_indirect_assignment' ====
+.text
+ic_indirect_assignment:
+addsp 4;         
+# param:`ptr', offset:-20
+# param:`expr', offset:-24
+# param:`ty', offset:-32
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L1688;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L1688;
+ldidw 0;
+jmp @L1689;
+@L1688:
+ldidw 1;
+@L1689:
+jmpf @L1690;
+# var: tmp, offset: 4
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp -20;
+lddw;
+ldbp 4;
+lddw;
+ldiqw long_ty;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldbp -20;
+stdw;
+pop;
+@L1690:
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldidw 0;
+ldbp -32;
+ldqw;
+ldidw 30;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern fileno
+.extern bset_update
+.extern dflow_LiveOut
+.extern lookup_external_id
+.extern hash2
+.extern analyze_type_name
+.data
+.align 8
+int_ty:
+.align 8
+.align 8
+.qword int_expr+0
+.align 8
+.zero 8
+.bss
+.align 4
+atv_counter:
+.res 4
+# ==== start of definition of function `ic_default_statement' ====
+.text
+ic_default_statement:
+addsp 20;        
+# param:`s', offset:-24
+# var: iprev, offset: 4
+# var: prev_op, offset: 8
+# var: np, offset: 16
+ldiqw verbose_asm;
+lddw;
+jmpf @L1691;
+ldiqw @S71;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L1691:
+ldiqw ic_instructions_counter;
+lddw;
+ldidw 1;
+subdw;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw 24;
+ldiqw malloc;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldidw 31;
+eqdw;
+jmpf @L1692;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L1693;
+@L1692:
+ldiqw new_label;
+call 0;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+@L1693:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_statement;
+call 8;
+pop;
+pop;
+ldiqw ic_default_labels;
+ldiqw ic_switch_nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw ic_default_labels;
+ldiqw ic_switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `ic_for_statement' ====
+.text
+ic_for_statement:
+addsp 24;        
+# param:`s', offset:-24
+# var: ce, offset: 8
+# var: L1, offset: 16
+# var: L2, offset: 20
+# var: L3, offset: 24
+ldiqw new_label;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1694;
+ldiqw verbose_asm;
+lddw;
+jmpf @L1695;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ast2c;
+call 8;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L1695:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression2;
+call 16;
+pop;
+pop;
+@L1694:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1696;
+ldiqw verbose_asm;
+lddw;
+jmpf @L1697;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ast2c;
+call 8;
+ldbp 8;
+stqw;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L1697:
+ldbp 24;
+lddw;
+ldbp 16;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_controlling_expression;
+call 16;
+pop;
+pop;
+@L1696:
+ldbp 16;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldiqw push_break_target;
+call 4;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldiqw push_continue_target;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 3;
+dw2qw;
+ldxqw 8;
+ldiqw ic_statement;
+call 8;
+pop;
+pop;
+ldiqw pop_break_target;
+call 0;
+pop;
+pop;
+ldiqw pop_continue_target;
+call 0;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1698;
+ldiqw verbose_asm;
+lddw;
+jmpf @L1699;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw ast2c;
+call 8;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L1699:
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression2;
+call 16;
+pop;
+pop;
+@L1698:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1700;
+ldiqw verbose_asm;
+lddw;
+jmpf @L1701;
+ldbp 8;
+ldqw;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L1701:
+ldbp 24;
+lddw;
+ldbp 16;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_controlling_expression;
+call 16;
+pop;
+pop;
+jmp @L1702;
+@L1700:
+ldidw 0;
+ldidw 0;
+ldbp 16;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 32;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L1702:
+ldbp 24;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 4
+cg_nodes_max:
+.res 4
+.global cg_nodes_max
+# ==== start of definition of function `print_CG' ====
+.text
+print_CG:
+addsp 8;         
+# var: i, offset: 4
+ldiqw @S72;
+ldiqw cg_dotfile;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L1703:
+ldbp 4;
+lddw;
+ldiqw cg_nodes_counter;
+lddw;
+ultdw;
+jmpf @L1705;
+# var: j, offset: 8
+ldiqw cg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+ldbp 4;
+lddw;
+ldiqw @S73;
+ldiqw cg_dotfile;
+ldqw;
+ldiqw fprintf;
+call 32;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw @S74;
+ldiqw cg_dotfile;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+ldiqw edge_iterate;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+@L1706:
+ldbp 8;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L1708;
+ldbp 8;
+lddw;
+ldbp 4;
+lddw;
+ldiqw @S75;
+ldiqw cg_dotfile;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+@L1707:
+ldidw 0;
+dw2qw;
+ldiqw edge_iterate;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+jmp @L1706;
+@L1708:
+@L1704:
+incldw 4;
+jmp @L1703;
+@L1705:
+ldiqw @S76;
+ldiqw cg_dotfile;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern is_unsigned_int
+.extern memmove
+.bss
+.align 4
+lp_ivar_counter:
+.res 4
+.extern replace_extension
+.extern analyze_struct_declarator
+# ==== start of definition of function `push_continue_target' ====
+.text
+push_continue_target:
+addsp 0;         
+# param:`lab', offset:-20
+ldbp -20;
+lddw;
+ldiqw ctarget_stack;
+ldiqw ct_stack_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern get_type_spec
+.bss
+.align 4
+frame_area:
+.res 4
+# ==== start of definition of function `ic_expression2' ====
+.text
+ic_expression2:
+addsp 0;         
+# param:`e', offset:-24
+# param:`true_lab', offset:-28
+# param:`false_lab', offset:-32
+ldbp -24;
+ldqw;
+ldiqw number_expression_tree;
+call 8;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw ic_expression;
+call 20;
+pop;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 4
+cfg_nodes_counter:
+.res 4
+.global cfg_nodes_counter
+# ==== start of definition of function `loop_truncate' ====
+.text
+loop_truncate:
+addsp 0;         
+# param:`v', offset:-24
+# param:`siz', offset:-28
+# param:`is_signed', offset:-32
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 8;
+ugetqw;
+jmpf @L1709;
+ldbp -24;
+ldqw;
+ret;
+@L1709:
+ldbp -24;
+ldqw;
+ldiqw 1;
+ldbp -28;
+lddw;
+ldidw 8;
+muldw;
+sllqw;
+ldidw 1;
+dw2qw;
+subqw;
+andqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+jmpf @L1710;
+ldbp -24;
+ldqw;
+ldiqw 1;
+ldbp -28;
+lddw;
+ldidw 8;
+muldw;
+ldidw 1;
+subdw;
+sllqw;
+andqw;
+ordw;
+jmpf @L1710;
+ldidw 1;
+jmp @L1711;
+@L1710:
+ldidw 0;
+@L1711:
+jmpf @L1712;
+ldbp -24;
+ldqw;
+ldiqw 1;
+ldbp -28;
+lddw;
+ldidw 8;
+muldw;
+sllqw;
+ldidw 1;
+dw2qw;
+subqw;
+cmplqw;
+orqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+@L1712:
+ldbp -24;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern analyze_function_definition
+# ==== start of definition of function `ic_expr_convert' ====
+.text
+ic_expr_convert:
+addsp 0;         
+# param:`e', offset:-24
+# param:`dest', offset:-32
+ldiqw targeting_arch64;
+lddw;
+jmpf @L1713;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw do_expr_convert64;
+call 16;
+pop;
+udw2qw;
+ret;
+jmp @L1714;
+@L1713:
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw do_expr_convert32;
+call 16;
+pop;
+udw2qw;
+ret;
+@L1714:
+ldidw 0;
+ret;
+.bss
+.align 4
+ivs_max:
+.res 4
+.bss
+.align 8
+lp_blk:
+.res 8
+.extern strdup
+# ==== start of definition of function `inline_find_cg_node' ====
+.text
+inline_find_cg_node:
+addsp 4;         
+# param:`func_id', offset:-24
+# var: h, offset: 4
+ldbp -24;
+ldqw;
+ldiqw hash;
+call 8;
+pop;
+ldiqw inl_cg_tab_size;
+lddw;
+ldidw 1;
+subdw;
+anddw;
+ldbp 4;
+stdw;
+pop;
+@L1715:
+ldiqw inl_cg_tab;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxdw 4;
+jmpf @L1717;
+ldbp -24;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw inl_cg_tab;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxdw 4;
+ldidw 1;
+subdw;
+dw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L1718;
+ldiqw inl_cg_tab;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxdw 4;
+ldidw 1;
+subdw;
+dw2qw;
+ret;
+@L1718:
+@L1716:
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+ldiqw inl_cg_tab_size;
+lddw;
+ldidw 1;
+subdw;
+anddw;
+ldbp 4;
+stdw;
+pop;
+jmp @L1715;
+@L1717:
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern bset_new
+.extern arena_new
+# ==== start of definition of function `number_subCG' ====
+.text
+number_subCG:
+addsp 8;         
+# param:`n', offset:-20
+# var: i, offset: 4
+ldidw 1;
+ldiqw visited;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw nunvisited;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L1719;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L1720:
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ultdw;
+jmpf @L1722;
+# var: succ, offset: 8
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldiqw visited;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldxdw 4;
+notdw;
+jmpf @L1723;
+ldbp 8;
+lddw;
+ldiqw number_subCG;
+call 4;
+pop;
+pop;
+@L1723:
+@L1721:
+incldw 4;
+jmp @L1720;
+@L1722:
+@L1719:
+ldbp -20;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw pocount;
+lddw;
+dw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 44;
+addqw;
+stdw;
+pop;
+ldiqw pocount;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `dump_ic' ====
+.text
+dump_ic:
+addsp 20;        
+# param:`fn', offset:-20
+# var: i, offset: 4
+# var: first, offset: 8
+# var: last, offset: 12
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1724;
+ldiqw 0;
+ret;
+@L1724:
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L1725:
+ldbp 4;
+lddw;
+ldbp 12;
+lddw;
+uletdw;
+jmpf @L1727;
+# var: p, offset: 16
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S77;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 20;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T1728;
+jmptab;
+@L1730:
+ldiqw @S78;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1731:
+ldiqw @S79;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1732:
+ldiqw @S80;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1733:
+ldiqw @S81;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1734:
+ldiqw @S82;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1735:
+ldiqw @S83;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1736:
+ldiqw @S84;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1737:
+ldiqw @S85;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1738:
+ldiqw @S86;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1739:
+ldiqw @S87;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1740:
+ldiqw @S88;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1741:
+ldiqw @S89;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1742:
+ldiqw @S90;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1743:
+ldiqw @S91;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1744:
+ldiqw @S92;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1745:
+ldiqw @S93;
+ldbp 16;
+ldqw;
+ldiqw print_binop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1746:
+ldiqw @S94;
+ldbp 16;
+ldqw;
+ldiqw print_unaop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1747:
+ldiqw @S95;
+ldbp 16;
+ldqw;
+ldiqw print_unaop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1748:
+ldiqw @S96;
+ldbp 16;
+ldqw;
+ldiqw print_unaop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1749:
+ldiqw @S97;
+ldbp 16;
+ldqw;
+ldiqw print_unaop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1750:
+ldiqw @S98;
+ldbp 16;
+ldqw;
+ldiqw print_unaop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1751:
+ldiqw @S99;
+ldbp 16;
+ldqw;
+ldiqw print_unaop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1752:
+ldiqw @S100;
+ldbp 16;
+ldqw;
+ldiqw print_unaop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1753:
+ldiqw @S101;
+ldbp 16;
+ldqw;
+ldiqw print_unaop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1754:
+ldiqw @S102;
+ldbp 16;
+ldqw;
+ldiqw print_unaop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1755:
+ldiqw @S103;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+ldiqw @S104;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+jmp @L1729;
+@L1756:
+ldiqw @S105;
+ldbp 16;
+ldqw;
+ldiqw print_unaop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1757:
+ldiqw @S106;
+ldbp 16;
+ldqw;
+ldiqw print_unaop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1758:
+ldiqw @S107;
+ldbp 16;
+ldqw;
+ldiqw print_unaop;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1759:
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S108;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+jmp @L1729;
+@L1760:
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S109;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+jmp @L1729;
+@L1761:
+ldiqw @S110;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+ldiqw @S111;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+ldiqw @S112;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1762:
+ldiqw @S113;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S114;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 32;
+pop;
+pop;
+jmp @L1729;
+@L1763:
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S115;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S116;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+jmp @L1729;
+@L1764:
+ldiqw @S117;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1765:
+ldiqw @S118;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+jmp @L1729;
+@L1766:
+@L1767:
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+jmpf @L1768;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+ldiqw @S119;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+@L1768:
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 28;
+eqdw;
+jmpf @L1769;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+jmp @L1770;
+@L1769:
+ldiqw @S120;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+ldiqw @S121;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+@L1770:
+ldiqw @S122;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+ldiqw @S123;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+jmp @L1729;
+@L1771:
+ldiqw @S124;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw print_addr;
+call 4;
+pop;
+pop;
+jmp @L1729;
+@L1729:
+.data
+.align 8
+@T1728:
+.dword 0
+.dword 39
+.qword @L1729
+.qword @L1730
+.qword @L1731
+.qword @L1732
+.qword @L1733
+.qword @L1734
+.qword @L1735
+.qword @L1736
+.qword @L1737
+.qword @L1738
+.qword @L1739
+.qword @L1740
+.qword @L1741
+.qword @L1742
+.qword @L1743
+.qword @L1744
+.qword @L1745
+.qword @L1746
+.qword @L1747
+.qword @L1748
+.qword @L1749
+.qword @L1750
+.qword @L1751
+.qword @L1752
+.qword @L1753
+.qword @L1754
+.qword @L1757
+.qword @L1758
+.qword @L1756
+.qword @L1766
+.qword @L1767
+.qword @L1755
+.qword @L1759
+.qword @L1760
+.qword @L1765
+.qword @L1771
+.qword @L1761
+.qword @L1762
+.qword @L1763
+.qword @L1764
+.text
+ldiqw @S125;
+ldiqw ic_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+@L1726:
+incldw 4;
+jmp @L1725;
+@L1727:
+ldidw 0;
+ret;
+.extern analyze_init_declarator
+.extern cfg_function_to_print
+.extern strncmp
+.extern arena_set_nom_siz
+.extern bset_union_diff
+# ==== start of definition of function `loop_emit_preheader' ====
+.text
+loop_emit_preheader:
+addsp 44;        
+# param:`L', offset:-20
+# param:`i', offset:-24
+# var: n, offset: 4
+# var: j, offset: 8
+# var: op, offset: 12
+ldiqw ic_instructions;
+ldqw;
+ldbp -24;
+lddw;
+ldidw 1;
+subdw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldidw 32;
+neqdw;
+jmpf @L1776;
+ldbp 12;
+lddw;
+ldidw 37;
+neqdw;
+jmpf @L1776;
+ldidw 1;
+jmp @L1777;
+@L1776:
+ldidw 0;
+@L1777:
+jmpf @L1774;
+ldbp 12;
+lddw;
+ldidw 36;
+neqdw;
+jmpf @L1774;
+ldidw 1;
+jmp @L1775;
+@L1774:
+ldidw 0;
+@L1775:
+jmpf @L1772;
+ldiqw lp_blk;
+ldqw;
+ldbp -24;
+lddw;
+ldidw 1;
+subdw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldiqw loops;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L1772;
+ldidw 1;
+jmp @L1773;
+@L1772:
+ldidw 0;
+@L1773:
+jmpf @L1778;
+ldidw 0;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw new_label_addr;
+call 8;
+pop;
+ldidw 0;
+dw2qw;
+ldidw 32;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L1778:
+ldidw 0;
+ldidw 0;
+ldiqw loops;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 36;
+addqw;
+lddw;
+udw2qw;
+ldiqw new_label_addr;
+call 8;
+pop;
+ldidw 0;
+dw2qw;
+ldidw 31;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw lp_first;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L1779:
+ldbp 8;
+lddw;
+ldiqw lp_last;
+lddw;
+uletdw;
+jmpf @L1781;
+ldiqw lp_hoist;
+ldqw;
+ldbp 8;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp -20;
+lddw;
+eqdw;
+jmpf @L1782;
+ldbp 8;
+lddw;
+ldiqw emit_copy;
+call 4;
+pop;
+pop;
+@L1782:
+@L1780:
+incldw 8;
+jmp @L1779;
+@L1781:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L1783:
+ldbp 4;
+lddw;
+ldiqw nivs;
+lddw;
+sltdw;
+jmpf @L1785;
+# var: p, offset: 16
+# var: x, offset: 24
+# var: t, offset: 28
+# var: iv, offset: 32
+# var: name, offset: 40
+ldiqw ivs;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 56;
+mulqw;
+addqw;
+ldbp 16;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -20;
+lddw;
+neqdw;
+jmpf @L1786;
+jmp @L1784;
+@L1786:
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 32;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 32;
+lddw;
+ldiqw new_frame_var;
+call 12;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 48;
+addqw;
+stdw;
+pop;
+ldiqw nid2sid_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw strlen;
+call 8;
+ldidw 16;
+dw2qw;
+addqw;
+ldiqw malloc;
+call 8;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldiqw lp_ivar_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldiqw nid2sid_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S126;
+ldbp 40;
+ldqw;
+ldiqw sprintf;
+call 28;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldiqw nid2sid_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 48;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+lddw;
+ldbp 24;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+jmpf @L1787;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldidw 0;
+ldbp 32;
+lddw;
+ldbp 24;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 23;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L1787:
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 28;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L1788;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L1788;
+ldidw 0;
+jmp @L1789;
+@L1788:
+ldidw 1;
+@L1789:
+jmpf @L1790;
+ldbp 24;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw copy_const;
+call 4;
+pop;
+ldbp 28;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+jmp @L1791;
+@L1790:
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw copy_const;
+call 4;
+pop;
+ldbp 24;
+lddw;
+ldbp 28;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L1791:
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp 28;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L1794;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L1794;
+ldidw 0;
+jmp @L1795;
+@L1794:
+ldidw 1;
+@L1795:
+jmpf @L1792;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw copy_const;
+call 4;
+pop;
+jmp @L1793;
+@L1792:
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+@L1793:
+ldbp 24;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ldbp 24;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 48;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 27;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L1784:
+incldw 4;
+jmp @L1783;
+@L1785:
+ldidw 0;
+ret;
+.extern location_get_offset
+.extern analyze_multiplicative_expression
+# ==== start of definition of function `ic_statement' ====
+.text
+ic_statement:
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T1796;
+jmptab;
+@L1798:
+ldbp -24;
+ldqw;
+ldiqw ic_builtin_va_start_statement;
+call 8;
+pop;
+pop;
+jmp @L1797;
+@L1799:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw ic_compound_statement;
+call 12;
+pop;
+pop;
+jmp @L1797;
+@L1800:
+ldbp -24;
+ldqw;
+ldiqw ic_if_statement;
+call 8;
+pop;
+pop;
+jmp @L1797;
+@L1801:
+ldbp -24;
+ldqw;
+ldiqw ic_switch_statement;
+call 8;
+pop;
+pop;
+jmp @L1797;
+@L1802:
+ldbp -24;
+ldqw;
+ldiqw ic_while_statement;
+call 8;
+pop;
+pop;
+jmp @L1797;
+@L1803:
+ldbp -24;
+ldqw;
+ldiqw ic_do_statement;
+call 8;
+pop;
+pop;
+jmp @L1797;
+@L1804:
+ldbp -24;
+ldqw;
+ldiqw ic_for_statement;
+call 8;
+pop;
+pop;
+jmp @L1797;
+@L1805:
+ldbp -24;
+ldqw;
+ldiqw ic_goto_statement;
+call 8;
+pop;
+pop;
+jmp @L1797;
+@L1806:
+ldiqw ic_continue_statement;
+call 0;
+pop;
+pop;
+jmp @L1797;
+@L1807:
+ldiqw ic_break_statement;
+call 0;
+pop;
+pop;
+jmp @L1797;
+@L1808:
+ldbp -24;
+ldqw;
+ldiqw ic_return_statement;
+call 8;
+pop;
+pop;
+jmp @L1797;
+@L1809:
+ldbp -24;
+ldqw;
+ldiqw ic_case_statement;
+call 8;
+pop;
+pop;
+jmp @L1797;
+@L1810:
+ldbp -24;
+ldqw;
+ldiqw ic_default_statement;
+call 8;
+pop;
+pop;
+jmp @L1797;
+@L1811:
+ldbp -24;
+ldqw;
+ldiqw ic_expression_statement;
+call 8;
+pop;
+pop;
+jmp @L1797;
+@L1812:
+ldbp -24;
+ldqw;
+ldiqw ic_label_statement;
+call 8;
+pop;
+pop;
+jmp @L1797;
+@L1797:
+.data
+.align 8
+@T1796:
+.dword 0
+.dword 16
+.qword @L1797
+.qword @L1800
+.qword @L1802
+.qword @L1803
+.qword @L1804
+.qword @L1807
+.qword @L1806
+.qword @L1808
+.qword @L1811
+.qword @L1799
+.qword @L1801
+.qword @L1809
+.qword @L1810
+.qword @L1812
+.qword @L1805
+.qword @L1797
+.qword @L1798
+.text
+ldidw 0;
+ret;
+.extern analyze_additive_expression
+.data
+.align 4
+ct_stack_top:
+.align 4
+.dword -1
+.extern stat_number_of_c_tokens
+.extern strncpy
+.extern bset_clear
+.extern decl_save_pch
+.extern bset_card
+.extern analyze_assignment_expression
+# ==== start of definition of function `ic_out_of_memory' ====
+.text
+ic_out_of_memory:
+addsp 0;         
+# param:`func', offset:-24
+ldbp -24;
+ldqw;
+ldiqw @S127;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+ldiqw @S128;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+ic_instructions:
+.res 8
+.global ic_instructions
+.extern new_extern_id_node
+.extern decl_load_pch
+# ==== start of definition of function `copy_const' ====
+.text
+copy_const:
+addsp 4;         
+# param:`a', offset:-20
+# var: na, offset: 4
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+swap2;
+memcpy 24;
+pop;
+pop;
+ldbp 4;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 4
+local_offset:
+.res 4
+.extern bset_union
+.bss
+.align 4
+va_arg_data:
+.res 12
+.extern analyze_translation_unit
+# ==== start of definition of function `ic_builtin_va_start_statement' ====
+.text
+ic_builtin_va_start_statement:
+addsp 44;        
+# param:`s', offset:-24
+# var: t1, offset: 4
+# var: t2, offset: 8
+# var: t3, offset: 12
+# var: t4, offset: 16
+# var: t5, offset: 20
+# var: t6, offset: 24
+# var: gp_offset_addr, offset: 28
+# var: overflow_arg_area_addr, offset: 32
+# var: reg_save_area_addr, offset: 36
+.data
+.align 4
+@ic_builtin_va_start_statement_mem_offs1:
+.align 4
+.dword 0
+.data
+.align 4
+@ic_builtin_va_start_statement_mem_offs2:
+.align 4
+.dword 0
+.text
+.bss
+.align 4
+@ic_builtin_va_start_statement_base_counter:
+.res 4
+.text
+.bss
+.align 4
+@ic_builtin_va_start_statement_base_addr:
+.res 4
+.text
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldiqw new_temp_addr;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 28;
+stdw;
+pop;
+ldiqw va_arg_data;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldiqw va_arg_data;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 36;
+stdw;
+pop;
+ldiqw va_arg_data;
+ldiqw 4;
+addqw;
+lddw;
+negdw;
+udw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw @ic_builtin_va_start_statement_mem_offs1;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1813;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldiqw @ic_builtin_va_start_statement_mem_offs1;
+stdw;
+pop;
+ldidw 8;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw @ic_builtin_va_start_statement_mem_offs1;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldiqw @ic_builtin_va_start_statement_mem_offs2;
+stdw;
+pop;
+ldidw 16;
+dw2qw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw @ic_builtin_va_start_statement_mem_offs2;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L1813:
+ldiqw base_node;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1814;
+# var: base_name, offset: 40
+ldidw 16;
+dw2qw;
+ldiqw malloc;
+call 8;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldiqw @ic_builtin_va_start_statement_base_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S129;
+ldbp 40;
+ldqw;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw new_exec_node;
+call 0;
+ldiqw base_node;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw base_node;
+ldqw;
+ldiqw 48;
+addqw;
+stdw;
+pop;
+ldidw 3;
+ldiqw base_node;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 40;
+ldqw;
+ldiqw base_node;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw base_node;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldidw 2;
+dw2b;
+ldiqw base_node;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+stb;
+pop;
+ldidw 0;
+dw2b;
+ldiqw base_node;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+stb;
+pop;
+ldidw 2;
+ldiqw new_address;
+call 4;
+pop;
+ldiqw @ic_builtin_va_start_statement_base_addr;
+stdw;
+pop;
+ldiqw base_node;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw @ic_builtin_va_start_statement_base_addr;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 40;
+ldqw;
+ldiqw get_var_nid;
+call 12;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldiqw @ic_builtin_va_start_statement_base_addr;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldiqw @ic_builtin_va_start_statement_base_addr;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+@L1814:
+ldidw 0;
+ldiqw @ic_builtin_va_start_statement_base_addr;
+lddw;
+ldbp 4;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 25;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 1;
+negdw;
+ldidw 1;
+negdw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expression;
+call 20;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 28;
+lddw;
+ldbp 8;
+lddw;
+ldidw 0;
+ldiqw int_ty;
+ldidw 30;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw @ic_builtin_va_start_statement_mem_offs1;
+lddw;
+ldbp 8;
+lddw;
+ldbp 12;
+lddw;
+ldiqw long_ty;
+ldidw 0;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 32;
+lddw;
+ldbp 4;
+lddw;
+ldbp 16;
+lddw;
+ldiqw long_ty;
+ldidw 0;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 12;
+lddw;
+ldidw 0;
+ldiqw long_ty;
+ldidw 30;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw @ic_builtin_va_start_statement_mem_offs2;
+lddw;
+ldbp 8;
+lddw;
+ldbp 20;
+lddw;
+ldiqw long_ty;
+ldidw 0;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 36;
+lddw;
+ldbp 4;
+lddw;
+ldbp 24;
+lddw;
+ldiqw long_ty;
+ldidw 1;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldbp 20;
+lddw;
+ldidw 0;
+ldiqw long_ty;
+ldidw 30;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern strnlen
+# ==== start of definition of function `ic_function_definition' ====
+.text
+ic_function_definition:
+addsp 60;        
+# param:`decl_specs', offset:-24
+# param:`header', offset:-32
+# var: cat, offset: 4
+# var: p, offset: 8
+# var: ty, offset: 16
+# var: param_offs, offset: 32
+# var: reg_param_offs, offset: 36
+# var: nfree_reg, offset: 40
+# var: entry_label, offset: 44
+ldidw 6;
+ldbp 40;
+stdw;
+pop;
+ldidw 0;
+ldbp 32;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L1815;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L1815;
+ldidw 0;
+jmp @L1816;
+@L1815:
+ldidw 1;
+@L1816:
+jmpf @L1817;
+ldiqw target_arch;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1818;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldidw 16;
+ugtdw;
+jmpf @L1819;
+ldiqw local_offset;
+lddw;
+ldidw 8;
+subdw;
+ldiqw local_offset;
+stdw;
+pop;
+decldw 40;
+@L1819:
+jmp @L1820;
+@L1818:
+ldiqw target_arch;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1821;
+ldiqw local_offset;
+lddw;
+ldidw 4;
+subdw;
+ldiqw local_offset;
+stdw;
+pop;
+jmp @L1822;
+@L1821:
+ldiqw target_arch;
+lddw;
+ldidw 4;
+eqdw;
+jmpt @L1823;
+ldiqw target_arch;
+lddw;
+ldidw 5;
+eqdw;
+jmpf @L1825;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldidw 4;
+ugtdw;
+jmpf @L1825;
+ldidw 1;
+jmp @L1826;
+@L1825:
+ldidw 0;
+@L1826:
+jmpt @L1823;
+ldidw 0;
+jmp @L1824;
+@L1823:
+ldidw 1;
+@L1824:
+jmpf @L1827;
+ldbp 32;
+lddw;
+ldidw 4;
+adddw;
+ldbp 32;
+stdw;
+pop;
+@L1827:
+@L1822:
+@L1820:
+@L1817:
+ldiqw location_push_scope;
+call 0;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L1828;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1828;
+ldidw 1;
+jmp @L1829;
+@L1828:
+ldidw 0;
+@L1829:
+jmpf @L1830;
+ldidw 0;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L1830:
+ldiqw target_arch;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1831;
+# var: tmp, offset: 48
+# var: is_vararg, offset: 56
+ldidw 0;
+ldbp 56;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp 48;
+stqw;
+pop;
+pop;
+@L1832:
+ldbp 48;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1834;
+ldbp 48;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1835;
+ldbp 48;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpf @L1835;
+ldidw 1;
+jmp @L1836;
+@L1835:
+ldidw 0;
+@L1836:
+jmpf @L1837;
+ldidw 1;
+ldbp 56;
+stdw;
+pop;
+@L1837:
+@L1833:
+ldbp 48;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 48;
+stqw;
+pop;
+pop;
+jmp @L1832;
+@L1834:
+ldbp 32;
+lddw;
+ldidw 16;
+adddw;
+ldbp 32;
+stdw;
+pop;
+ldbp 56;
+lddw;
+jmpf @L1838;
+ldidw 48;
+negdw;
+jmp @L1839;
+@L1838:
+ldiqw local_offset;
+lddw;
+ldidw 8;
+subdw;
+@L1839:
+ldbp 36;
+stdw;
+pop;
+@L1840:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1841;
+# var: siz, offset: 60
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1842;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpf @L1842;
+ldidw 1;
+jmp @L1843;
+@L1842:
+ldidw 0;
+@L1843:
+jmpf @L1844;
+jmp @L1841;
+@L1844:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 60;
+stdw;
+ldidw 16;
+ugtdw;
+jmpt @L1845;
+ldbp 60;
+lddw;
+ldbp 40;
+lddw;
+ldidw 8;
+muldw;
+ugtdw;
+jmpt @L1845;
+ldidw 0;
+jmp @L1846;
+@L1845:
+ldidw 1;
+@L1846:
+jmpf @L1847;
+ldbp 32;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw location_new;
+call 12;
+pop;
+pop;
+ldbp 32;
+lddw;
+ldidw 8;
+ldbp 60;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+adddw;
+ldbp 32;
+stdw;
+pop;
+jmp @L1848;
+@L1847:
+ldbp 56;
+lddw;
+jmpf @L1849;
+ldbp 36;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw location_new;
+call 12;
+pop;
+pop;
+ldbp 36;
+lddw;
+ldidw 8;
+adddw;
+ldbp 36;
+stdw;
+pop;
+decldw 40;
+ldbp 60;
+lddw;
+ldidw 8;
+ugtdw;
+jmpf @L1850;
+ldbp 36;
+lddw;
+ldidw 8;
+adddw;
+ldbp 36;
+stdw;
+pop;
+decldw 40;
+@L1850:
+jmp @L1851;
+@L1849:
+ldbp 60;
+lddw;
+ldidw 8;
+ugtdw;
+jmpf @L1852;
+ldbp 36;
+lddw;
+ldidw 8;
+subdw;
+ldbp 36;
+stdw;
+pop;
+decldw 40;
+@L1852:
+ldbp 36;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw location_new;
+call 12;
+pop;
+pop;
+ldbp 36;
+lddw;
+ldidw 8;
+subdw;
+ldbp 36;
+stdw;
+pop;
+decldw 40;
+@L1851:
+@L1848:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L1840;
+@L1841:
+ldbp 56;
+lddw;
+jmpf @L1853;
+ldiqw local_offset;
+lddw;
+ldidw 48;
+subdw;
+ldiqw va_arg_data;
+ldiqw 4;
+addqw;
+stdw;
+pop;
+ldidw 48;
+ldbp 40;
+lddw;
+ldidw 8;
+muldw;
+subdw;
+ldiqw va_arg_data;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw va_arg_data;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldiqw local_offset;
+lddw;
+ldidw 48;
+subdw;
+ldiqw local_offset;
+stdw;
+pop;
+jmp @L1854;
+@L1853:
+ldbp 36;
+lddw;
+ldidw 8;
+adddw;
+ldiqw local_offset;
+stdw;
+pop;
+@L1854:
+jmp @L1855;
+@L1831:
+ldiqw target_arch;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1856;
+ldbp 32;
+lddw;
+ldidw 8;
+adddw;
+ldbp 32;
+stdw;
+pop;
+@L1857:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1858;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1859;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpf @L1859;
+ldidw 1;
+jmp @L1860;
+@L1859:
+ldidw 0;
+@L1860:
+jmpf @L1861;
+jmp @L1858;
+@L1861:
+ldbp 32;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw location_new;
+call 12;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+lddw;
+ldidw 4;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw round_up;
+call 8;
+pop;
+adddw;
+ldbp 32;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L1857;
+@L1858:
+jmp @L1862;
+@L1856:
+ldiqw target_arch;
+lddw;
+ldidw 4;
+eqdw;
+jmpt @L1863;
+ldiqw target_arch;
+lddw;
+ldidw 5;
+eqdw;
+jmpt @L1863;
+ldidw 0;
+jmp @L1864;
+@L1863:
+ldidw 1;
+@L1864:
+jmpf @L1865;
+ldbp 32;
+lddw;
+ldidw 8;
+adddw;
+ldbp 32;
+stdw;
+pop;
+@L1866:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1867;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1868;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpf @L1868;
+ldidw 1;
+jmp @L1869;
+@L1868:
+ldidw 0;
+@L1869:
+jmpf @L1870;
+jmp @L1867;
+@L1870:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 32;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw location_new;
+call 12;
+pop;
+pop;
+ldbp 32;
+lddw;
+ldidw 4;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw round_up;
+call 8;
+pop;
+adddw;
+ldbp 32;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L1866;
+@L1867:
+@L1865:
+@L1862:
+@L1855:
+ldiqw new_label;
+call 0;
+pop;
+ldbp 44;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldiqw exit_label;
+stdw;
+pop;
+ldidw 0;
+ldidw 0;
+ldbp 44;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 32;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldbp 44;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw ic_compound_statement;
+call 12;
+pop;
+pop;
+ldiqw exit_label;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldiqw exit_label;
+stdw;
+pop;
+ldidw 0;
+ldidw 0;
+ldiqw exit_label;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 32;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldiqw exit_label;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+ldiqw location_pop_scope;
+call 0;
+pop;
+pop;
+ldiqw fix_gotos;
+call 0;
+pop;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 40;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern bset_new_in
+.extern analyze_enumerator
+.extern targeting_arch64
+# ==== start of definition of function `loop_strength_reduce' ====
+.text
+loop_strength_reduce:
+addsp 76;        
+# param:`i', offset:-20
+# var: L, offset: 4
+# var: k, offset: 8
+# var: n, offset: 12
+# var: m, offset: 16
+# var: md, offset: 20
+# var: x, offset: 24
+# var: xd, offset: 28
+# var: base, offset: 32
+# var: u, offset: 36
+# var: first, offset: 40
+# var: step, offset: 48
+# var: scale, offset: 56
+# var: q, offset: 64
+# var: p, offset: 72
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+ldbp 64;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+neqdw;
+jmpt @L1873;
+ldiqw lp_inner;
+ldqw;
+ldiqw lp_blk;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+udw2qw;
+ldxdw 4;
+ldbp 4;
+stdw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L1873;
+ldidw 0;
+jmp @L1874;
+@L1873:
+ldidw 1;
+@L1874:
+jmpt @L1871;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw lp_entry_bb;
+lddw;
+ldidw 1;
+adddw;
+neqdw;
+jmpf @L1875;
+ldiqw ic_instructions;
+ldqw;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 31;
+eqdw;
+jmpf @L1875;
+ldidw 1;
+jmp @L1876;
+@L1875:
+ldidw 0;
+@L1876:
+notdw;
+jmpt @L1871;
+ldidw 0;
+jmp @L1872;
+@L1871:
+ldidw 1;
+@L1872:
+jmpf @L1877;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L1877:
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+@L1878:
+ldbp 8;
+lddw;
+ldidw 2;
+sltdw;
+jmpf @L1880;
+ldbp 8;
+lddw;
+jmpf @L1881;
+ldbp 64;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+jmp @L1882;
+@L1881:
+ldbp 64;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+@L1882:
+ldbp 32;
+stdw;
+pop;
+ldbp 8;
+lddw;
+jmpf @L1883;
+ldbp 64;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+jmp @L1884;
+@L1883:
+ldbp 64;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+@L1884:
+ldbp 16;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+neqdw;
+jmpt @L1887;
+ldiqw var_ndefs;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+neqdw;
+jmpt @L1887;
+ldidw 0;
+jmp @L1888;
+@L1887:
+ldidw 1;
+@L1888:
+jmpt @L1885;
+ldbp 4;
+lddw;
+ldbp 32;
+lddw;
+ldiqw loop_invariant;
+call 8;
+pop;
+notdw;
+jmpt @L1885;
+ldidw 0;
+jmp @L1886;
+@L1885:
+ldidw 1;
+@L1886:
+jmpf @L1889;
+jmp @L1879;
+@L1889:
+ldiqw var_def;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldbp 20;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 5;
+eqdw;
+jmpf @L1894;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1894;
+ldidw 1;
+jmp @L1895;
+@L1894:
+ldidw 0;
+@L1895:
+jmpf @L1892;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+sgetqw;
+jmpf @L1892;
+ldidw 1;
+jmp @L1893;
+@L1892:
+ldidw 0;
+@L1893:
+jmpf @L1890;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 32;
+dw2qw;
+sltqw;
+jmpf @L1890;
+ldidw 1;
+jmp @L1891;
+@L1890:
+ldidw 0;
+@L1891:
+jmpf @L1896;
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 24;
+stdw;
+pop;
+ldiqw 1;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+sllqw;
+ldbp 56;
+stqw;
+pop;
+pop;
+jmp @L1897;
+@L1896:
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L1898;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1898;
+ldidw 1;
+jmp @L1899;
+@L1898:
+ldidw 0;
+@L1899:
+jmpf @L1900;
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 24;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 56;
+stqw;
+pop;
+pop;
+jmp @L1901;
+@L1900:
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L1902;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1902;
+ldidw 1;
+jmp @L1903;
+@L1902:
+ldidw 0;
+@L1903:
+jmpf @L1904;
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 24;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 56;
+stqw;
+pop;
+pop;
+jmp @L1905;
+@L1904:
+jmp @L1879;
+@L1905:
+@L1901:
+@L1897:
+ldiqw lp_blk;
+ldqw;
+ldbp 20;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldiqw lp_blk;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+neqdw;
+jmpf @L1906;
+jmp @L1879;
+@L1906:
+ldbp 20;
+lddw;
+ldbp 40;
+stdw;
+pop;
+ldidw 0;
+ldbp 28;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L1907;
+ldiqw var_ndefs;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+neqdw;
+jmpf @L1908;
+jmp @L1879;
+@L1908:
+ldiqw var_def;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldbp 28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 23;
+neqdw;
+jmpt @L1909;
+ldiqw lp_blk;
+ldqw;
+ldbp 28;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldiqw lp_blk;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+neqdw;
+jmpt @L1909;
+ldidw 0;
+jmp @L1910;
+@L1909:
+ldidw 1;
+@L1910:
+jmpf @L1911;
+jmp @L1879;
+@L1911:
+ldiqw ic_instructions;
+ldqw;
+ldbp 28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 24;
+stdw;
+pop;
+ldbp 28;
+lddw;
+ldbp 40;
+stdw;
+pop;
+@L1907:
+ldbp 24;
+lddw;
+jmpf @L1914;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L1916;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L1916;
+ldidw 0;
+jmp @L1917;
+@L1916:
+ldidw 1;
+@L1917:
+jmpf @L1914;
+ldidw 1;
+jmp @L1915;
+@L1914:
+ldidw 0;
+@L1915:
+notdw;
+jmpt @L1912;
+ldbp 48;
+ldbp 4;
+lddw;
+ldbp 24;
+lddw;
+ldiqw loop_basic_iv;
+call 16;
+pop;
+ldbp 36;
+stdw;
+ldidw 0;
+eqdw;
+jmpt @L1912;
+ldidw 0;
+jmp @L1913;
+@L1912:
+ldidw 1;
+@L1913:
+jmpf @L1918;
+jmp @L1879;
+@L1918:
+ldbp 28;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1919;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+neqdw;
+jmpf @L1919;
+ldidw 1;
+jmp @L1920;
+@L1919:
+ldidw 0;
+@L1920:
+jmpf @L1921;
+jmp @L1879;
+@L1921:
+ldiqw lp_blk;
+ldqw;
+ldbp 36;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldiqw lp_blk;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+eqdw;
+jmpf @L1924;
+ldbp 36;
+lddw;
+ldbp 40;
+lddw;
+ugtdw;
+jmpf @L1924;
+ldidw 1;
+jmp @L1925;
+@L1924:
+ldidw 0;
+@L1925:
+jmpf @L1922;
+ldbp 36;
+lddw;
+ldbp -20;
+lddw;
+ultdw;
+jmpf @L1922;
+ldidw 1;
+jmp @L1923;
+@L1922:
+ldidw 0;
+@L1923:
+jmpf @L1926;
+jmp @L1879;
+@L1926:
+jmp @L1880;
+@L1879:
+incldw 8;
+jmp @L1878;
+@L1880:
+ldbp 8;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L1927;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L1927:
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L1928;
+ldidw 1;
+dw2b;
+ldiqw lp_needed;
+ldqw;
+ldiqw var_def;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+addqw;
+stb;
+pop;
+@L1928:
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+@L1929:
+ldbp 12;
+lddw;
+ldiqw nivs;
+lddw;
+sltdw;
+jmpf @L1931;
+ldiqw ivs;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 56;
+mulqw;
+addqw;
+ldbp 72;
+stqw;
+pop;
+pop;
+ldbp 72;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 4;
+lddw;
+eqdw;
+jmpf @L1942;
+ldbp 72;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 36;
+lddw;
+eqdw;
+jmpf @L1942;
+ldidw 1;
+jmp @L1943;
+@L1942:
+ldidw 0;
+@L1943:
+jmpf @L1940;
+ldbp 72;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+notdw;
+ldbp 28;
+lddw;
+notdw;
+eqdw;
+jmpf @L1940;
+ldidw 1;
+jmp @L1941;
+@L1940:
+ldidw 0;
+@L1941:
+jmpf @L1938;
+ldbp 72;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 56;
+ldqw;
+eqqw;
+jmpf @L1938;
+ldidw 1;
+jmp @L1939;
+@L1938:
+ldidw 0;
+@L1939:
+jmpf @L1936;
+ldiqw ic_instructions;
+ldqw;
+ldbp 72;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+eqdw;
+jmpf @L1936;
+ldidw 1;
+jmp @L1937;
+@L1936:
+ldidw 0;
+@L1937:
+jmpf @L1934;
+ldbp 72;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 64;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+eqdw;
+jmpf @L1934;
+ldidw 1;
+jmp @L1935;
+@L1934:
+ldidw 0;
+@L1935:
+jmpf @L1932;
+ldbp 32;
+lddw;
+ldbp 72;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw same_base;
+call 8;
+pop;
+jmpf @L1932;
+ldidw 1;
+jmp @L1933;
+@L1932:
+ldidw 0;
+@L1933:
+jmpf @L1944;
+ldbp 12;
+lddw;
+dw2qw;
+ret;
+@L1944:
+@L1930:
+incldw 12;
+jmp @L1929;
+@L1931:
+ldiqw nivs;
+lddw;
+ldiqw ivs_max;
+lddw;
+sgetdw;
+jmpf @L1945;
+ldiqw ivs_max;
+lddw;
+jmpf @L1946;
+ldiqw ivs_max;
+lddw;
+ldidw 2;
+muldw;
+jmp @L1947;
+@L1946:
+ldidw 16;
+@L1947:
+ldiqw ivs_max;
+stdw;
+pop;
+ldiqw ivs_max;
+lddw;
+dw2qw;
+ldiqw 56;
+mulqw;
+ldiqw ivs;
+ldqw;
+ldiqw realloc;
+call 16;
+ldiqw ivs;
+stqw;
+pop;
+pop;
+@L1945:
+ldiqw ivs;
+ldqw;
+ldiqw nivs;
+lddw;
+dw2qw;
+ldiqw 56;
+mulqw;
+addqw;
+ldbp 72;
+stqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldbp 72;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 72;
+ldqw;
+ldiqw 4;
+addqw;
+stdw;
+pop;
+ldbp 36;
+lddw;
+ldbp 72;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp 28;
+lddw;
+ldbp 72;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldbp 20;
+lddw;
+ldbp 72;
+ldqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldbp 72;
+ldqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+ldbp 64;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 72;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 56;
+ldqw;
+ldbp 72;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldbp 56;
+ldqw;
+mulqw;
+ldbp 72;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 72;
+ldqw;
+ldiqw 48;
+addqw;
+stdw;
+pop;
+ldiqw nivs;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern set_attributes
+.extern is_typedef_name
+# ==== start of definition of function `loop_compare' ====
+.text
+loop_compare:
+addsp 44;        
+# param:`i', offset:-20
+# param:`ivop', offset:-24
+# param:`val', offset:-32
+# param:`c', offset:-40
+# var: flags, offset: 8
+# var: x, offset: 16
+# var: y, offset: 24
+# var: ux, offset: 32
+# var: uy, offset: 40
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1948;
+ldbp -32;
+ldqw;
+jmp @L1949;
+@L1948:
+ldbp -40;
+ldqw;
+@L1949:
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1950;
+ldbp -40;
+ldqw;
+jmp @L1951;
+@L1950:
+ldbp -32;
+ldqw;
+@L1951:
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+notqw;
+jmpf @L1952;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L1953;
+ldbp 16;
+ldqw;
+pop;
+dw2qw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+pop;
+dw2qw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L1954;
+@L1953:
+ldbp 16;
+ldqw;
+pop;
+udw2qw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+pop;
+udw2qw;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L1954:
+@L1952:
+ldbp 16;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T1955;
+jmptab;
+@L1957:
+ldbp 16;
+ldqw;
+ldbp 24;
+ldqw;
+eqqw;
+dw2qw;
+ret;
+@L1958:
+ldbp 16;
+ldqw;
+ldbp 24;
+ldqw;
+neqqw;
+dw2qw;
+ret;
+@L1959:
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L1960;
+ldbp 16;
+ldqw;
+ldbp 24;
+ldqw;
+sltqw;
+jmp @L1961;
+@L1960:
+ldbp 32;
+ldqw;
+ldbp 40;
+ldqw;
+ultqw;
+@L1961:
+dw2qw;
+ret;
+@L1962:
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L1963;
+ldbp 16;
+ldqw;
+ldbp 24;
+ldqw;
+sletqw;
+jmp @L1964;
+@L1963:
+ldbp 32;
+ldqw;
+ldbp 40;
+ldqw;
+uletqw;
+@L1964:
+dw2qw;
+ret;
+@L1965:
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L1966;
+ldbp 16;
+ldqw;
+ldbp 24;
+ldqw;
+sgtqw;
+jmp @L1967;
+@L1966:
+ldbp 32;
+ldqw;
+ldbp 40;
+ldqw;
+ugtqw;
+@L1967:
+dw2qw;
+ret;
+@L1968:
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L1969;
+ldbp 16;
+ldqw;
+ldbp 24;
+ldqw;
+sgetqw;
+jmp @L1970;
+@L1969:
+ldbp 32;
+ldqw;
+ldbp 40;
+ldqw;
+ugetqw;
+@L1970:
+dw2qw;
+ret;
+@L1971:
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L1956:
+.data
+.align 8
+@T1955:
+.dword 10
+.dword 6
+.qword @L1971
+.qword @L1957
+.qword @L1958
+.qword @L1959
+.qword @L1962
+.qword @L1965
+.qword @L1968
+.text
+ldidw 0;
+ret;
+.extern dflow_exit_function
+.extern arena_reset
+.extern fread
+.extern strrchr
+.extern bset_next
+.extern disable_warnings
+# ==== start of definition of function `contains_function_call' ====
+.text
+contains_function_call:
+addsp 0;         
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T1972;
+jmptab;
+@L1974:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T1975;
+switch;
+@L1977:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw contains_function_call;
+call 8;
+pop;
+jmpt @L1980;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw contains_function_call;
+call 8;
+pop;
+jmpt @L1980;
+ldidw 0;
+jmp @L1981;
+@L1980:
+ldidw 1;
+@L1981:
+jmpt @L1978;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw contains_function_call;
+call 8;
+pop;
+jmpt @L1978;
+ldidw 0;
+jmp @L1979;
+@L1978:
+ldidw 1;
+@L1979:
+dw2qw;
+ret;
+@L1982:
+@L1983:
+@L1984:
+@L1985:
+@L1986:
+@L1987:
+@L1988:
+@L1989:
+@L1990:
+@L1991:
+@L1992:
+@L1993:
+@L1994:
+@L1995:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw contains_function_call;
+call 8;
+pop;
+dw2qw;
+ret;
+@L1996:
+ldidw 1;
+dw2qw;
+ret;
+@L1997:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw contains_function_call;
+call 8;
+pop;
+jmpt @L1998;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw contains_function_call;
+call 8;
+pop;
+jmpt @L1998;
+ldidw 0;
+jmp @L1999;
+@L1998:
+ldidw 1;
+@L1999:
+dw2qw;
+ret;
+@L1976:
+.data
+.align 8
+@T1975:
+.dword 17
+.dword 6
+.dword 7
+.dword 14
+.dword 15
+.dword 30
+.dword 93
+.dword 94
+.dword 95
+.dword 96
+.dword 97
+.dword 98
+.dword 99
+.dword 100
+.dword 101
+.dword 103
+.dword 105
+.qword @L1997
+.qword @L1994
+.qword @L1995
+.qword @L1990
+.qword @L1989
+.qword @L1977
+.qword @L1983
+.qword @L1985
+.qword @L1984
+.qword @L1986
+.qword @L1993
+.qword @L1996
+.qword @L1992
+.qword @L1991
+.qword @L1988
+.qword @L1987
+.qword @L1982
+.text
+jmp @L1973;
+@L2000:
+@L2001:
+@L2002:
+ldidw 0;
+dw2qw;
+ret;
+@L1973:
+.data
+.align 8
+@T1972:
+.dword 0
+.dword 4
+.qword @L1973
+.qword @L1974
+.qword @L2000
+.qword @L2001
+.qword @L2002
+.text
+@L2003:
+ldidw 0;
+notdw;
+jmpf @L2006;
+ldidw 4173;
+ldiqw @S130;
+ldiqw @S131;
+ldiqw @S132;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L2006:
+@L2004:
+ldidw 0;
+jmpf @L2005;
+jmp @L2003;
+@L2005:
+ldidw 0;
+ret;
+# ==== start of definition of function `ic_return_statement' ====
+.text
+ic_return_statement:
+addsp 12;        
+# param:`s', offset:-24
+ldiqw verbose_asm;
+lddw;
+jmpf @L2007;
+ldbp -24;
+ldqw;
+ldiqw ast2c;
+call 8;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L2007:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L2008;
+# var: ty, offset: 8
+ldiqw new_declaration_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ic_expr_convert;
+call 16;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldidw 34;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+@L2008:
+ldidw 0;
+ldidw 0;
+ldiqw exit_label;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 32;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern bset_diff
+.extern install_macro
+.extern bset_inters
+# ==== start of definition of function `loop_hoist_target' ====
+.text
+loop_hoist_target:
+addsp 20;        
+# param:`i', offset:-20
+# var: L, offset: 4
+# var: target, offset: 8
+# var: q, offset: 16
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T2009;
+jmptab;
+@L2011:
+@L2012:
+@L2013:
+@L2014:
+@L2015:
+@L2016:
+@L2017:
+@L2018:
+@L2019:
+@L2020:
+@L2021:
+@L2022:
+@L2023:
+@L2024:
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L2027;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L2027;
+ldidw 0;
+jmp @L2028;
+@L2027:
+ldidw 1;
+@L2028:
+jmpf @L2025;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L2029;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L2029;
+ldidw 0;
+jmp @L2030;
+@L2029:
+ldidw 1;
+@L2030:
+jmpf @L2025;
+ldidw 1;
+jmp @L2026;
+@L2025:
+ldidw 0;
+@L2026:
+jmpf @L2031;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L2031:
+jmp @L2010;
+@L2032:
+@L2033:
+@L2034:
+@L2035:
+@L2036:
+@L2037:
+@L2038:
+@L2039:
+@L2040:
+@L2041:
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L2042;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L2042;
+ldidw 0;
+jmp @L2043;
+@L2042:
+ldidw 1;
+@L2043:
+jmpf @L2044;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L2044:
+jmp @L2010;
+@L2045:
+jmp @L2010;
+@L2046:
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L2010:
+.data
+.align 8
+@T2009:
+.dword 0
+.dword 28
+.qword @L2046
+.qword @L2011
+.qword @L2012
+.qword @L2013
+.qword @L2046
+.qword @L2046
+.qword @L2014
+.qword @L2015
+.qword @L2016
+.qword @L2017
+.qword @L2018
+.qword @L2019
+.qword @L2020
+.qword @L2021
+.qword @L2022
+.qword @L2023
+.qword @L2024
+.qword @L2032
+.qword @L2033
+.qword @L2034
+.qword @L2035
+.qword @L2036
+.qword @L2037
+.qword @L2038
+.qword @L2039
+.qword @L2040
+.qword @L2045
+.qword @L2046
+.qword @L2041
+.text
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+neqdw;
+jmpt @L2047;
+ldiqw var_ndefs;
+ldqw;
+ldiqw nid_map;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+neqdw;
+jmpt @L2047;
+ldidw 0;
+jmp @L2048;
+@L2047:
+ldidw 1;
+@L2048:
+jmpf @L2049;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L2049:
+ldidw 1;
+negdw;
+ldbp 8;
+stdw;
+pop;
+ldiqw lp_inner;
+ldqw;
+ldiqw lp_blk;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw lp_first;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+udw2qw;
+ldxdw 4;
+ldbp 4;
+stdw;
+pop;
+@L2050:
+ldbp 4;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L2053;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw lp_entry_bb;
+lddw;
+ldidw 1;
+adddw;
+neqdw;
+jmpf @L2055;
+ldiqw ic_instructions;
+ldqw;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 31;
+eqdw;
+jmpf @L2055;
+ldidw 1;
+jmp @L2056;
+@L2055:
+ldidw 0;
+@L2056:
+jmpf @L2053;
+ldidw 1;
+jmp @L2054;
+@L2053:
+ldidw 0;
+@L2054:
+jmpf @L2052;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 25;
+neqdw;
+jmpf @L2057;
+ldbp 4;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw loop_invariant;
+call 8;
+pop;
+notdw;
+jmpt @L2058;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+jmpf @L2060;
+ldbp 4;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw loop_invariant;
+call 8;
+pop;
+notdw;
+jmpf @L2060;
+ldidw 1;
+jmp @L2061;
+@L2060:
+ldidw 0;
+@L2061:
+jmpt @L2058;
+ldidw 0;
+jmp @L2059;
+@L2058:
+ldidw 1;
+@L2059:
+jmpf @L2062;
+jmp @L2052;
+@L2062:
+@L2057:
+ldbp 4;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L2051:
+ldiqw loops;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 48;
+mulqw;
+addqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+jmp @L2050;
+@L2052:
+ldbp 8;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `edge_add' ====
+.text
+edge_add:
+.global edge_add
+addsp 12;        
+# param:`p', offset:-24
+# param:`e', offset:-28
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L2063:
+ldbp 4;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ultdw;
+jmpf @L2065;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp -28;
+lddw;
+eqdw;
+jmpf @L2066;
+ldiqw 0;
+ret;
+@L2066:
+@L2064:
+incldw 4;
+jmp @L2063;
+@L2065:
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ugetdw;
+jmpf @L2067;
+# var: new_edges, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L2068;
+ldiqw @S133;
+ldiqw ic_out_of_memory;
+call 8;
+pop;
+pop;
+@L2068:
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L2067:
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern ferror
+# ==== start of definition of function `ic_continue_statement' ====
+.text
+ic_continue_statement:
+addsp 0;         
+ldiqw verbose_asm;
+lddw;
+jmpf @L2069;
+ldiqw @S134;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L2069:
+ldidw 0;
+ldidw 0;
+ldiqw ctarget_stack;
+ldiqw ct_stack_top;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+dw2qw;
+ldidw 32;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern random
+.bss
+.align 4
+inl_cg_tab_size:
+.res 4
+.bss
+.align 4
+ic_instructions_counter:
+.res 4
+.global ic_instructions_counter
+.extern free
+.extern malloc
+.extern get_external_declarations
+# ==== start of definition of function `ic_compound_statement' ====
+.text
+ic_compound_statement:
+addsp 76;        
+# param:`s', offset:-24
+# param:`push_scope', offset:-28
+# var: sl, offset: 8
+# var: old_local_offset, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L2070;
+# var: dl, offset: 24
+ldiqw local_offset;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+jmpf @L2071;
+ldiqw location_push_scope;
+call 0;
+pop;
+pop;
+@L2071:
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L2072:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L2074;
+# var: dct, offset: 32
+# var: scs, offset: 40
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 40;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L2075;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+eqdw;
+jmpf @L2076;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L2077:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L2079;
+# var: np, offset: 48
+ldiqw new_extern_id_node;
+call 0;
+ldbp 48;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 48;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldbp 48;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldiqw curr_cg_node;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 48;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw static_objects_list;
+ldqw;
+ldbp 48;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldiqw static_objects_list;
+stqw;
+pop;
+pop;
+@L2078:
+ldbp 32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L2077;
+@L2079:
+jmp @L2073;
+jmp @L2080;
+@L2076:
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 56;
+eqdw;
+jmpt @L2081;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 70;
+eqdw;
+jmpt @L2081;
+ldidw 0;
+jmp @L2082;
+@L2081:
+ldidw 1;
+@L2082:
+jmpf @L2083;
+jmp @L2073;
+@L2083:
+@L2080:
+@L2075:
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L2084:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L2086;
+# var: lty, offset: 48
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 48;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 98;
+eqdw;
+jmpf @L2087;
+jmp @L2085;
+@L2087:
+ldbp 48;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw local_offset;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldiqw local_offset;
+stdw;
+pop;
+ldiqw local_offset;
+lddw;
+ldbp 48;
+ldiqw get_sizeof;
+call 8;
+pop;
+subdw;
+ldiqw local_offset;
+stdw;
+pop;
+ldiqw local_offset;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw location_new;
+call 12;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L2088;
+# var: a, offset: 64
+# var: id_node, offset: 72
+ldiqw new_exec_node;
+call 0;
+ldbp 72;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp 72;
+ldqw;
+ldiqw 48;
+addqw;
+stdw;
+pop;
+ldidw 3;
+ldbp 72;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 72;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 72;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldidw 2;
+dw2b;
+ldbp 72;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+stb;
+pop;
+ldidw 0;
+dw2b;
+ldbp 72;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+stb;
+pop;
+ldidw 0;
+dw2b;
+ldbp 72;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 14;
+addqw;
+stb;
+pop;
+ldbp 48;
+ldbp 72;
+ldqw;
+ldiqw 72;
+addqw;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldidw 2;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 64;
+stdw;
+pop;
+ldbp 72;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 64;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_var_nid;
+call 12;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 64;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldiqw local_offset;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 64;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 64;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw ic_auto_init;
+call 32;
+pop;
+pop;
+@L2088:
+@L2085:
+ldbp 32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L2084;
+@L2086:
+@L2073:
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L2072;
+@L2074:
+@L2070:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L2089:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L2091;
+ldbp 8;
+ldqw;
+ldiqw ic_statement;
+call 8;
+pop;
+pop;
+@L2090:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L2089;
+@L2091:
+ldiqw local_offset;
+lddw;
+ldiqw size_of_local_area;
+lddw;
+sltdw;
+jmpf @L2092;
+ldiqw local_offset;
+lddw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+@L2092:
+ldbp -28;
+lddw;
+jmpf @L2093;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L2093;
+ldidw 1;
+jmp @L2094;
+@L2093:
+ldidw 0;
+@L2094:
+jmpf @L2095;
+ldbp 16;
+lddw;
+ldiqw local_offset;
+stdw;
+pop;
+ldiqw location_pop_scope;
+call 0;
+pop;
+pop;
+@L2095:
+ldidw 0;
+ret;
+# ==== start of definition of function `emit_label' ====
+.text
+emit_label:
+addsp 0;         
+# param:`L', offset:-20
+ldiqw ic_instructions_counter;
+lddw;
+ldiqw lab2instr;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldidw 0;
+ldbp -20;
+lddw;
+ldidw 0;
+dw2qw;
+ldidw 31;
+ldiqw emit_i;
+call 24;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+inl_param_nid:
+.res 8
+.bss
+.align 4
+lp_nvars:
+.res 4
+.extern new_decl_list_node
+.extern compute_liveness_and_next_use
+.extern srandom
+# ==== start of definition of function `ic_case_statement' ====
+.text
+ic_case_statement:
+addsp 20;        
+# param:`s', offset:-24
+# var: iprev, offset: 4
+# var: prev_op, offset: 8
+# var: np, offset: 16
+ldiqw verbose_asm;
+lddw;
+jmpf @L2096;
+ldbp -24;
+ldqw;
+ldiqw ast2c;
+call 8;
+ldiqw emit_src;
+call 8;
+pop;
+pop;
+@L2096:
+ldiqw ic_instructions_counter;
+lddw;
+ldidw 1;
+subdw;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw 24;
+ldiqw malloc;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldidw 31;
+eqdw;
+jmpf @L2097;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L2098;
+@L2097:
+ldiqw new_label;
+call 0;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw emit_label;
+call 4;
+pop;
+pop;
+@L2098:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw ic_statement;
+call 8;
+pop;
+pop;
+ldiqw ic_case_labels;
+ldiqw ic_switch_nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw ic_case_labels;
+ldiqw ic_switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern lookup_struct_descriptor
+.extern new_exec_node
+.extern get_alignment
+.bss
+.align 4
+lp_entry_bb:
+.res 4
+# ==== start of definition of function `new_label_addr' ====
+.text
+new_label_addr:
+addsp 4;         
+# param:`val', offset:-24
+# var: L, offset: 4
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern fgetc
+.data
+@S0:
+.byte 98
+.byte 114
+.byte 101
+.byte 97
+.byte 107
+.byte 59
+.byte 0
+@S1:
+.byte 105
+.byte 99
+.byte 95
+.byte 102
+.byte 105
+.byte 110
+.byte 100
+.byte 95
+.byte 97
+.byte 116
+.byte 118
+.byte 95
+.byte 105
+.byte 110
+.byte 95
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 0
+@S2:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 105
+.byte 99
+.byte 46
+.byte 99
+.byte 0
+@S3:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S4:
+.byte 110
+.byte 117
+.byte 109
+.byte 98
+.byte 101
+.byte 114
+.byte 95
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 95
+.byte 116
+.byte 114
+.byte 101
+.byte 101
+.byte 0
+@S5:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 105
+.byte 99
+.byte 46
+.byte 99
+.byte 0
+@S6:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S7:
+.byte 98
+.byte 117
+.byte 105
+.byte 108
+.byte 100
+.byte 95
+.byte 67
+.byte 70
+.byte 71
+.byte 0
+@S8:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 105
+.byte 99
+.byte 46
+.byte 99
+.byte 0
+@S9:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S10:
+.byte 98
+.byte 117
+.byte 105
+.byte 108
+.byte 100
+.byte 95
+.byte 67
+.byte 70
+.byte 71
+.byte 0
+@S11:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 105
+.byte 99
+.byte 46
+.byte 99
+.byte 0
+@S12:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S13:
+.byte 98
+.byte 117
+.byte 105
+.byte 108
+.byte 100
+.byte 95
+.byte 67
+.byte 70
+.byte 71
+.byte 0
+@S14:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 105
+.byte 99
+.byte 46
+.byte 99
+.byte 0
+@S15:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S16:
+.byte 98
+.byte 117
+.byte 105
+.byte 108
+.byte 100
+.byte 95
+.byte 67
+.byte 70
+.byte 71
+.byte 0
+@S17:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 105
+.byte 99
+.byte 46
+.byte 99
+.byte 0
+@S18:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S19:
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 0
+@S20:
+.byte 37
+.byte 115
+.byte 0
+@S21:
+.byte 34
+.byte 37
+.byte 115
+.byte 34
+.byte 0
+@S22:
+.byte 105
+.byte 110
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 95
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 0
+@S23:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 105
+.byte 99
+.byte 46
+.byte 99
+.byte 0
+@S24:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S25:
+.byte 101
+.byte 109
+.byte 105
+.byte 116
+.byte 95
+.byte 105
+.byte 0
+@S26:
+.byte 101
+.byte 109
+.byte 105
+.byte 116
+.byte 95
+.byte 105
+.byte 0
+@S27:
+.byte 110
+.byte 101
+.byte 119
+.byte 95
+.byte 108
+.byte 97
+.byte 98
+.byte 101
+.byte 108
+.byte 0
+@S28:
+.byte 114
+.byte 101
+.byte 112
+.byte 108
+.byte 97
+.byte 99
+.byte 101
+.byte 95
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 95
+.byte 98
+.byte 111
+.byte 100
+.byte 121
+.byte 0
+@S29:
+.byte 110
+.byte 101
+.byte 119
+.byte 95
+.byte 110
+.byte 105
+.byte 100
+.byte 0
+@S30:
+.byte 110
+.byte 101
+.byte 119
+.byte 95
+.byte 97
+.byte 116
+.byte 118
+.byte 0
+@S31:
+.byte 110
+.byte 101
+.byte 119
+.byte 95
+.byte 110
+.byte 105
+.byte 100
+.byte 95
+.byte 109
+.byte 97
+.byte 112
+.byte 0
+@S32:
+.byte 32
+.byte 61
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S33:
+.byte 100
+.byte 105
+.byte 103
+.byte 114
+.byte 97
+.byte 112
+.byte 104
+.byte 32
+.byte 123
+.byte 10
+.byte 0
+@S34:
+.byte 86
+.byte 37
+.byte 117
+.byte 91
+.byte 108
+.byte 97
+.byte 98
+.byte 101
+.byte 108
+.byte 61
+.byte 34
+.byte 66
+.byte 37
+.byte 117
+.byte 32
+.byte 0
+@S35:
+.byte 44
+.byte 32
+.byte 0
+@S36:
+.byte 0
+@S37:
+.byte 40
+.byte 37
+.byte 117
+.byte 41
+.byte 37
+.byte 115
+.byte 0
+@S38:
+.byte 34
+.byte 93
+.byte 59
+.byte 10
+.byte 0
+@S39:
+.byte 86
+.byte 37
+.byte 117
+.byte 32
+.byte 45
+.byte 62
+.byte 32
+.byte 86
+.byte 37
+.byte 117
+.byte 59
+.byte 10
+.byte 0
+@S40:
+.byte 125
+.byte 10
+.byte 0
+@S41:
+.byte 116
+.byte 37
+.byte 117
+.byte 0
+@S42:
+.byte 109
+.byte 101
+.byte 109
+.byte 115
+.byte 101
+.byte 116
+.byte 0
+@S43:
+.byte 109
+.byte 101
+.byte 109
+.byte 115
+.byte 101
+.byte 116
+.byte 0
+@S44:
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S45:
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S46:
+.byte 105
+.byte 99
+.byte 95
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 0
+@S47:
+.byte 105
+.byte 99
+.byte 95
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S48:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 105
+.byte 99
+.byte 46
+.byte 99
+.byte 0
+@S49:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S50:
+.byte 105
+.byte 99
+.byte 95
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S51:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 105
+.byte 99
+.byte 46
+.byte 99
+.byte 0
+@S52:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S53:
+.byte 105
+.byte 99
+.byte 95
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S54:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 105
+.byte 99
+.byte 46
+.byte 99
+.byte 0
+@S55:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S56:
+.byte 105
+.byte 110
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 95
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 115
+.byte 0
+@S57:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 105
+.byte 99
+.byte 46
+.byte 99
+.byte 0
+@S58:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S59:
+.byte 110
+.byte 101
+.byte 119
+.byte 95
+.byte 99
+.byte 103
+.byte 95
+.byte 110
+.byte 111
+.byte 100
+.byte 101
+.byte 0
+@S60:
+.byte 110
+.byte 101
+.byte 119
+.byte 95
+.byte 99
+.byte 102
+.byte 103
+.byte 95
+.byte 110
+.byte 111
+.byte 100
+.byte 101
+.byte 0
+@S61:
+.byte 32
+.byte 61
+.byte 32
+.byte 0
+@S62:
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 0
+@S63:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 108
+.byte 97
+.byte 98
+.byte 101
+.byte 108
+.byte 95
+.byte 97
+.byte 100
+.byte 100
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 0
+@S64:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 105
+.byte 99
+.byte 46
+.byte 99
+.byte 0
+@S65:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S66:
+.byte 119
+.byte 98
+.byte 0
+@S67:
+.byte 119
+.byte 98
+.byte 0
+@S68:
+.byte 119
+.byte 98
+.byte 0
+@S69:
+.byte 110
+.byte 101
+.byte 119
+.byte 95
+.byte 97
+.byte 100
+.byte 100
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 0
+@S70:
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 0
+@S71:
+.byte 100
+.byte 101
+.byte 102
+.byte 97
+.byte 117
+.byte 108
+.byte 116
+.byte 58
+.byte 0
+@S72:
+.byte 100
+.byte 105
+.byte 103
+.byte 114
+.byte 97
+.byte 112
+.byte 104
+.byte 32
+.byte 123
+.byte 10
+.byte 0
+@S73:
+.byte 86
+.byte 37
+.byte 117
+.byte 91
+.byte 108
+.byte 97
+.byte 98
+.byte 101
+.byte 108
+.byte 61
+.byte 34
+.byte 70
+.byte 37
+.byte 117
+.byte 32
+.byte 37
+.byte 115
+.byte 92
+.byte 110
+.byte 0
+@S74:
+.byte 91
+.byte 37
+.byte 117
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 93
+.byte 34
+.byte 93
+.byte 59
+.byte 10
+.byte 0
+@S75:
+.byte 86
+.byte 37
+.byte 117
+.byte 32
+.byte 45
+.byte 62
+.byte 32
+.byte 86
+.byte 37
+.byte 117
+.byte 59
+.byte 10
+.byte 0
+@S76:
+.byte 125
+.byte 10
+.byte 0
+@S77:
+.byte 40
+.byte 37
+.byte 100
+.byte 41
+.byte 32
+.byte 0
+@S78:
+.byte 43
+.byte 0
+@S79:
+.byte 45
+.byte 0
+@S80:
+.byte 42
+.byte 0
+@S81:
+.byte 47
+.byte 0
+@S82:
+.byte 37
+.byte 0
+@S83:
+.byte 60
+.byte 60
+.byte 0
+@S84:
+.byte 62
+.byte 62
+.byte 0
+@S85:
+.byte 38
+.byte 0
+@S86:
+.byte 124
+.byte 0
+@S87:
+.byte 94
+.byte 0
+@S88:
+.byte 61
+.byte 61
+.byte 0
+@S89:
+.byte 33
+.byte 61
+.byte 0
+@S90:
+.byte 60
+.byte 0
+@S91:
+.byte 60
+.byte 61
+.byte 0
+@S92:
+.byte 62
+.byte 0
+@S93:
+.byte 62
+.byte 61
+.byte 0
+@S94:
+.byte 45
+.byte 0
+@S95:
+.byte 126
+.byte 0
+@S96:
+.byte 33
+.byte 0
+@S97:
+.byte 40
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 41
+.byte 0
+@S98:
+.byte 40
+.byte 117
+.byte 110
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 101
+.byte 100
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 41
+.byte 0
+@S99:
+.byte 40
+.byte 115
+.byte 104
+.byte 111
+.byte 114
+.byte 116
+.byte 41
+.byte 0
+@S100:
+.byte 40
+.byte 117
+.byte 110
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 101
+.byte 100
+.byte 32
+.byte 115
+.byte 104
+.byte 111
+.byte 114
+.byte 116
+.byte 41
+.byte 0
+@S101:
+.byte 40
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 45
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 110
+.byte 100
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 76
+.byte 76
+.byte 41
+.byte 0
+@S102:
+.byte 40
+.byte 122
+.byte 101
+.byte 114
+.byte 111
+.byte 45
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 110
+.byte 100
+.byte 32
+.byte 116
+.byte 111
+.byte 32
+.byte 76
+.byte 76
+.byte 41
+.byte 0
+@S103:
+.byte 42
+.byte 0
+@S104:
+.byte 32
+.byte 61
+.byte 32
+.byte 0
+@S105:
+.byte 0
+@S106:
+.byte 38
+.byte 0
+@S107:
+.byte 42
+.byte 0
+@S108:
+.byte 76
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 58
+.byte 0
+@S109:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 76
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 0
+@S110:
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 32
+.byte 0
+@S111:
+.byte 32
+.byte 91
+.byte 0
+@S112:
+.byte 32
+.byte 108
+.byte 97
+.byte 98
+.byte 101
+.byte 108
+.byte 115
+.byte 93
+.byte 0
+@S113:
+.byte 99
+.byte 97
+.byte 115
+.byte 101
+.byte 32
+.byte 0
+@S114:
+.byte 44
+.byte 32
+.byte 76
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 0
+@S115:
+.byte 99
+.byte 98
+.byte 114
+.byte 32
+.byte 76
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 44
+.byte 32
+.byte 0
+@S116:
+.byte 44
+.byte 32
+.byte 76
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 0
+@S117:
+.byte 98
+.byte 101
+.byte 103
+.byte 97
+.byte 114
+.byte 103
+.byte 0
+@S118:
+.byte 97
+.byte 114
+.byte 103
+.byte 32
+.byte 0
+@S119:
+.byte 32
+.byte 61
+.byte 32
+.byte 0
+@S120:
+.byte 40
+.byte 42
+.byte 0
+@S121:
+.byte 41
+.byte 0
+@S122:
+.byte 40
+.byte 41
+.byte 32
+.byte 91
+.byte 0
+@S123:
+.byte 32
+.byte 97
+.byte 114
+.byte 103
+.byte 93
+.byte 0
+@S124:
+.byte 114
+.byte 101
+.byte 116
+.byte 32
+.byte 0
+@S125:
+.byte 10
+.byte 0
+@S126:
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 117
+.byte 0
+@S127:
+.byte 101
+.byte 114
+.byte 114
+.byte 111
+.byte 114
+.byte 58
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 58
+.byte 32
+.byte 111
+.byte 117
+.byte 116
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 109
+.byte 101
+.byte 109
+.byte 111
+.byte 114
+.byte 121
+.byte 0
+@S128:
+.byte 10
+.byte 0
+@S129:
+.byte 98
+.byte 97
+.byte 115
+.byte 101
+.byte 64
+.byte 37
+.byte 100
+.byte 0
+@S130:
+.byte 99
+.byte 111
+.byte 110
+.byte 116
+.byte 97
+.byte 105
+.byte 110
+.byte 115
+.byte 95
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 95
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 0
+@S131:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 105
+.byte 99
+.byte 46
+.byte 99
+.byte 0
+@S132:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S133:
+.byte 101
+.byte 100
+.byte 103
+.byte 101
+.byte 95
+.byte 97
+.byte 100
+.byte 100
+.byte 0
+@S134:
+.byte 99
+.byte 111
+.byte 110
+.byte 116
+.byte 105
+.byte 110
+.byte 117
+.byte 101
+.byte 59
+.byte 0
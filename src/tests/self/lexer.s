@@ -0,0 +1,5987 @@
+.extern fgets
+.extern atom_n
+.extern verbose_asm
+.extern cfg_outpath
+.data
+.align 8
+punctuators_table:
+.align 8
+.align 8
+.qword @S0+0
+.align 4
+.dword 15
+.align 8
+.align 8
+.qword @S1+0
+.align 4
+.dword 25
+.align 8
+.align 8
+.qword @S2+0
+.align 4
+.dword 17
+.align 8
+.align 8
+.qword @S3+0
+.align 4
+.dword 38
+.align 8
+.align 8
+.qword @S4+0
+.align 4
+.dword 10
+.align 8
+.align 8
+.qword @S5+0
+.align 4
+.dword 28
+.align 8
+.align 8
+.qword @S6+0
+.align 4
+.dword 43
+.align 8
+.align 8
+.qword @S7+0
+.align 4
+.dword 2
+.align 8
+.align 8
+.qword @S8+0
+.align 4
+.dword 3
+.align 8
+.align 8
+.qword @S9+0
+.align 4
+.dword 11
+.align 8
+.align 8
+.qword @S10+0
+.align 4
+.dword 36
+.align 8
+.align 8
+.qword @S11+0
+.align 4
+.dword 12
+.align 8
+.align 8
+.qword @S12+0
+.align 4
+.dword 8
+.align 8
+.align 8
+.qword @S13+0
+.align 4
+.dword 39
+.align 8
+.align 8
+.qword @S14+0
+.align 4
+.dword 34
+.align 8
+.align 8
+.qword @S15+0
+.align 4
+.dword 13
+.align 8
+.align 8
+.qword @S16+0
+.align 4
+.dword 9
+.align 8
+.align 8
+.qword @S17+0
+.align 4
+.dword 40
+.align 8
+.align 8
+.qword @S18+0
+.align 4
+.dword 7
+.align 8
+.align 8
+.qword @S19+0
+.align 4
+.dword 6
+.align 8
+.align 8
+.qword @S20+0
+.align 4
+.dword 33
+.align 8
+.align 8
+.qword @S21+0
+.align 4
+.dword 16
+.align 8
+.align 8
+.qword @S22+0
+.align 4
+.dword 37
+.align 8
+.align 8
+.qword @S23+0
+.align 4
+.dword 31
+.align 8
+.align 8
+.qword @S24+0
+.align 4
+.dword 32
+.align 8
+.align 8
+.qword @S25+0
+.align 4
+.dword 20
+.align 8
+.align 8
+.qword @S26+0
+.align 4
+.dword 18
+.align 8
+.align 8
+.qword @S27+0
+.align 4
+.dword 41
+.align 8
+.align 8
+.qword @S28+0
+.align 4
+.dword 22
+.align 8
+.align 8
+.qword @S29+0
+.align 4
+.dword 35
+.align 8
+.align 8
+.qword @S30+0
+.align 4
+.dword 24
+.align 8
+.align 8
+.qword @S31+0
+.align 4
+.dword 21
+.align 8
+.align 8
+.qword @S32+0
+.align 4
+.dword 23
+.align 8
+.align 8
+.qword @S33+0
+.align 4
+.dword 19
+.align 8
+.align 8
+.qword @S34+0
+.align 4
+.dword 42
+.align 8
+.align 8
+.qword @S35+0
+.align 4
+.dword 30
+.align 8
+.align 8
+.qword @S36+0
+.align 4
+.dword 0
+.align 8
+.align 8
+.qword @S37+0
+.align 4
+.dword 1
+.align 8
+.align 8
+.qword @S38+0
+.align 4
+.dword 26
+.align 8
+.align 8
+.qword @S39+0
+.align 4
+.dword 44
+.align 8
+.align 8
+.qword @S40+0
+.align 4
+.dword 4
+.align 8
+.align 8
+.qword @S41+0
+.align 4
+.dword 27
+.align 8
+.align 8
+.qword @S42+0
+.align 4
+.dword 45
+.align 8
+.align 8
+.qword @S43+0
+.align 4
+.dword 29
+.align 8
+.align 8
+.qword @S44+0
+.align 4
+.dword 5
+.align 8
+.align 8
+.qword @S45+0
+.align 4
+.dword 14
+.extern target_arch
+.extern emit_warning
+.extern arena_destroy
+.bss
+.align 8
+pre_tok_ahead:
+.res 8
+.extern emit_error
+.bss
+.align 8
+pre_tok:
+.res 8
+.extern getenv
+.extern atoi
+.extern atom
+.extern exit
+.extern stderr
+.extern opt_level
+.extern tolower
+.extern rewind
+.extern realloc
+.extern snprintf
+.extern strpbrk
+.extern fseek
+.extern atom_tag
+.extern islower
+.extern sscanf
+.extern fputc
+.extern vsscanf
+.extern atom_set_tag
+.extern fwrite
+.extern colored_diagnostics
+.extern read_stream
+.extern strspn
+.extern ispunct
+.extern strtoll
+# ==== start of definition of function `new_token' ====
+.text
+new_token:
+addsp 12;        
+# param:`token', offset:-20
+# param:`ptok', offset:-28
+# var: temp, offset: 8
+ldiqw free_tokens;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1;
+ldiqw free_tokens;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw free_tokens;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw free_tokens;
+stqw;
+pop;
+pop;
+jmp @L2;
+@L1:
+ldiqw 48;
+pop;
+ldiqw lexer_node_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L2:
+ldbp -20;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp -28;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -28;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stdw;
+pop;
+ldbp -28;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 28;
+addqw;
+stdw;
+pop;
+ldbp -28;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2b;
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+stb;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw stat_number_of_c_tokens;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern fclose
+.extern preprocess
+.extern strstr
+.extern calloc
+.extern memset
+.extern file_exists
+.extern include_libc
+.extern add_quote_dir
+.extern stat_number_of_ast_nodes
+.extern strtoul
+.extern isprint
+.extern fprintf
+.extern read_file
+# ==== start of definition of function `lookup_token' ====
+.text
+lookup_token:
+addsp 4;         
+# param:`s', offset:-24
+# var: tag, offset: 4
+ldbp -24;
+ldqw;
+ldiqw atom_tag;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 0;
+neqdw;
+jmpf @L3;
+ldbp 4;
+lddw;
+ldidw 1;
+subdw;
+jmp @L4;
+@L3:
+ldidw 76;
+@L4:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern printf
+# ==== start of definition of function `get_c_token' ====
+.text
+get_c_token:
+.global get_c_token
+addsp 36;        
+# var: tok, offset: 8
+ldiqw lexer_node_arena;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L5;
+ldidw 0;
+ldiqw 48;
+ldidw 128;
+dw2qw;
+mulqw;
+pop;
+ldiqw arena_new;
+call 8;
+ldiqw lexer_node_arena;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldidw 1024;
+ldiqw arena_new;
+call 8;
+ldiqw lexer_str_arena;
+stqw;
+pop;
+pop;
+ldiqw tag_atoms;
+call 0;
+pop;
+pop;
+@L5:
+@L6:
+ldiqw next_pre_token;
+call 0;
+ldiqw pre_tok;
+stqw;
+pop;
+pop;
+ldiqw pre_tok;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T8;
+jmptab;
+@L10:
+ldiqw pre_tok;
+ldqw;
+ldidw 91;
+ldiqw new_token;
+call 12;
+ret;
+@L11:
+@L12:
+ldiqw pre_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw atom_tag;
+call 8;
+pop;
+ldidw 0;
+neqdw;
+notdw;
+jmpf @L15;
+ldidw 581;
+ldiqw @S46;
+ldiqw @S47;
+ldiqw @S48;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L15:
+@L13:
+ldidw 0;
+jmpf @L14;
+jmp @L12;
+@L14:
+ldiqw pre_tok;
+ldqw;
+ldiqw pre_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_token;
+call 8;
+pop;
+ldiqw new_token;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L9;
+@L16:
+ldiqw pre_tok;
+ldqw;
+ldiqw pre_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_iconst_kind;
+call 8;
+pop;
+ldiqw new_token;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L9;
+@L17:
+ldiqw pre_tok;
+ldqw;
+ldidw 76;
+ldiqw new_token;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw pre_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_token;
+call 8;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L9;
+@L18:
+# var: buf, offset: 16
+# var: p, offset: 32
+ldiqw pre_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L19:
+ldbp 32;
+ldqw;
+ldb;
+ldidw 0;
+neqdw;
+jmpf @L20;
+ldbp 32;
+ldqw;
+ldb;
+ldidw 92;
+eqdw;
+jmpf @L21;
+ldbp 32;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+ldbp 32;
+ldiqw get_esc_seq_val;
+call 8;
+pop;
+ldiqw @S49;
+ldbp 16;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+jmp @L22;
+@L21:
+ldbp 32;
+ldqw;
+ldb;
+ldiqw @S50;
+ldbp 16;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldbp 32;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+@L22:
+jmp @L19;
+@L20:
+ldiqw pre_tok;
+ldqw;
+ldidw 78;
+ldiqw new_token;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldiqw lexer_str_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+jmp @L9;
+@L23:
+# var: len, offset: 16
+# var: p, offset: 24
+ldiqw pre_tok;
+ldqw;
+ldidw 77;
+ldiqw new_token;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw pre_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw convert_string;
+call 12;
+pop;
+ldbp 16;
+stdw;
+pop;
+@L24:
+ldiqw next_pre_token;
+call 0;
+ldbp 24;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 5;
+eqdw;
+jmpf @L25;
+ldiqw pre_tok;
+ldqw;
+ldiqw free_pre_token;
+call 8;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw pre_tok;
+stqw;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw convert_string;
+call 12;
+pop;
+ldbp 16;
+stdw;
+pop;
+jmp @L24;
+@L25:
+ldbp 16;
+lddw;
+ldidw 1;
+adddw;
+ldiqw lexer_str_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 1;
+adddw;
+udw2qw;
+ldiqw str_buf;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw memcpy;
+call 24;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw pre_tok_ahead;
+stqw;
+pop;
+pop;
+jmp @L9;
+@L26:
+@L27:
+ldidw 0;
+notdw;
+jmpf @L30;
+ldidw 637;
+ldiqw @S51;
+ldiqw @S52;
+ldiqw @S53;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L30:
+@L28:
+ldidw 0;
+jmpf @L29;
+jmp @L27;
+@L29:
+jmp @L9;
+@L31:
+ldiqw pre_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldb;
+ldiqw isprint;
+call 4;
+pop;
+jmpf @L32;
+ldiqw pre_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldb;
+ldiqw @S54;
+ldiqw pre_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw pre_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw pre_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 28;
+pop;
+pop;
+jmp @L33;
+@L32:
+ldiqw pre_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldb;
+ldiqw @S55;
+ldiqw pre_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw pre_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw pre_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw emit_warning;
+call 28;
+pop;
+pop;
+@L33:
+ldiqw pre_tok;
+ldqw;
+ldiqw free_pre_token;
+call 8;
+pop;
+pop;
+jmp @L6;
+@L9:
+.data
+.align 8
+@T8:
+.dword 0
+.dword 8
+.qword @L9
+.qword @L10
+.qword @L11
+.qword @L16
+.qword @L17
+.qword @L18
+.qword @L23
+.qword @L26
+.qword @L31
+.text
+ldiqw pre_tok;
+ldqw;
+ldiqw free_pre_token;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+jmp @L6;
+@L7:
+ldidw 0;
+ret;
+.extern isalnum
+.extern sprintf
+.extern isxdigit
+.extern strcat
+.extern error_count
+.bss
+.align 8
+lexer_node_arena:
+.res 8
+.global lexer_node_arena
+.extern free_pre_token
+.extern round_up
+.extern include_liblux
+# ==== start of definition of function `isodigit' ====
+.text
+isodigit:
+addsp 0;         
+# param:`c', offset:-20
+ldbp -20;
+lddw;
+ldidw 56;
+neqdw;
+jmpf @L36;
+ldbp -20;
+lddw;
+ldidw 57;
+neqdw;
+jmpf @L36;
+ldidw 1;
+jmp @L37;
+@L36:
+ldidw 0;
+@L37:
+jmpf @L34;
+ldbp -20;
+lddw;
+ldiqw isdigit;
+call 4;
+pop;
+jmpf @L34;
+ldidw 1;
+jmp @L35;
+@L34:
+ldidw 0;
+@L35:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 8
+str_buf:
+.res 8
+.extern stat_number_of_pre_tokens
+.extern strchr
+.extern toupper
+.extern add_angle_dir
+.extern ic_outpath
+.extern arena_alloc
+.extern stdout
+.extern ilog2
+.extern strcmp
+.extern strtok
+.extern strtol
+.extern stdin
+.extern ftell
+.extern strcpy
+.extern ic_function_to_print
+.extern isupper
+.extern strtoull
+.extern strlen
+.data
+.align 8
+token_table:
+.align 8
+.qword @S56+0
+.align 8
+.qword @S57+0
+.align 8
+.qword @S58+0
+.align 8
+.qword @S59+0
+.align 8
+.qword @S60+0
+.align 8
+.qword @S61+0
+.align 8
+.qword @S62+0
+.align 8
+.qword @S63+0
+.align 8
+.qword @S64+0
+.align 8
+.qword @S65+0
+.align 8
+.qword @S66+0
+.align 8
+.qword @S67+0
+.align 8
+.qword @S68+0
+.align 8
+.qword @S69+0
+.align 8
+.qword @S70+0
+.align 8
+.qword @S71+0
+.align 8
+.qword @S72+0
+.align 8
+.qword @S73+0
+.align 8
+.qword @S74+0
+.align 8
+.qword @S75+0
+.align 8
+.qword @S76+0
+.align 8
+.qword @S77+0
+.align 8
+.qword @S78+0
+.align 8
+.qword @S79+0
+.align 8
+.qword @S80+0
+.align 8
+.qword @S81+0
+.align 8
+.qword @S82+0
+.align 8
+.qword @S83+0
+.align 8
+.qword @S84+0
+.align 8
+.qword @S85+0
+.align 8
+.qword @S86+0
+.align 8
+.qword @S87+0
+.align 8
+.qword @S88+0
+.align 8
+.qword @S89+0
+.align 8
+.qword @S90+0
+.align 8
+.qword @S91+0
+.align 8
+.qword @S92+0
+.align 8
+.qword @S93+0
+.align 8
+.qword @S94+0
+.align 8
+.qword @S95+0
+.align 8
+.qword @S96+0
+.align 8
+.qword @S97+0
+.align 8
+.qword @S98+0
+.align 8
+.qword @S99+0
+.align 8
+.qword @S100+0
+.align 8
+.qword @S101+0
+.align 8
+.qword @S102+0
+.align 8
+.qword @S103+0
+.align 8
+.qword @S104+0
+.align 8
+.qword @S105+0
+.align 8
+.qword @S106+0
+.align 8
+.qword @S107+0
+.align 8
+.qword @S108+0
+.align 8
+.qword @S109+0
+.align 8
+.qword @S110+0
+.align 8
+.qword @S111+0
+.align 8
+.qword @S112+0
+.align 8
+.qword @S113+0
+.align 8
+.qword @S114+0
+.align 8
+.qword @S115+0
+.align 8
+.qword @S116+0
+.align 8
+.qword @S117+0
+.align 8
+.qword @S118+0
+.align 8
+.qword @S119+0
+.align 8
+.qword @S120+0
+.align 8
+.qword @S121+0
+.align 8
+.qword @S122+0
+.align 8
+.qword @S123+0
+.align 8
+.qword @S124+0
+.align 8
+.qword @S125+0
+.align 8
+.qword @S126+0
+.align 8
+.qword @S127+0
+.align 8
+.qword @S128+0
+.align 8
+.qword @S129+0
+.align 8
+.qword @S130+0
+.align 8
+.qword @S131+0
+.align 8
+.qword @S132+0
+.align 8
+.qword @S133+0
+.align 8
+.qword @S134+0
+.align 8
+.qword @S135+0
+.align 8
+.qword @S136+0
+.align 8
+.qword @S137+0
+.align 8
+.qword @S138+0
+.align 8
+.qword @S139+0
+.align 8
+.qword @S140+0
+.align 8
+.qword @S141+0
+.align 8
+.qword @S142+0
+.align 8
+.qword @S143+0
+.align 8
+.qword @S144+0
+.align 8
+.qword @S145+0
+.align 8
+.qword @S146+0
+.align 8
+.qword @S147+0
+.align 8
+.qword @S148+0
+.align 8
+.qword @S149+0
+.align 8
+.qword @S150+0
+.align 8
+.qword @S151+0
+.align 8
+.qword @S152+0
+.align 8
+.qword @S153+0
+.align 8
+.qword @S154+0
+.align 8
+.qword @S155+0
+.align 8
+.qword @S156+0
+.align 8
+.qword @S157+0
+.align 8
+.qword @S158+0
+.align 8
+.qword @S159+0
+.align 8
+.qword @S160+0
+.align 8
+.qword @S161+0
+.align 8
+.qword @S162+0
+.align 8
+.qword @S163+0
+.align 8
+.qword @S164+0
+.align 8
+.qword @S165+0
+.align 8
+.qword @S166+0
+.align 8
+.qword @S167+0
+.align 8
+.qword @S168+0
+.align 8
+.qword @S169+0
+.align 8
+.qword @S170+0
+.align 8
+.qword @S171+0
+.align 8
+.qword @S172+0
+.align 8
+.qword @S173+0
+.align 8
+.qword @S174+0
+.align 8
+.qword @S175+0
+.align 8
+.qword @S176+0
+.align 8
+.qword @S177+0
+.align 8
+.qword @S178+0
+.align 8
+.qword @S179+0
+.align 8
+.qword @S180+0
+.align 8
+.qword @S181+0
+.align 8
+.qword @S182+0
+.align 8
+.qword @S183+0
+.align 8
+.qword @S184+0
+.align 8
+.qword @S185+0
+.align 8
+.qword @S186+0
+.align 8
+.qword @S187+0
+.align 8
+.qword @S188+0
+.align 8
+.qword @S189+0
+.align 8
+.qword @S190+0
+.align 8
+.qword @S191+0
+.align 8
+.qword @S192+0
+.align 8
+.qword @S193+0
+.align 8
+.qword @S194+0
+.align 8
+.qword @S195+0
+.align 8
+.qword @S196+0
+.align 8
+.qword @S197+0
+.align 8
+.qword @S198+0
+.align 8
+.qword @S199+0
+.align 8
+.qword @S200+0
+.align 8
+.qword @S201+0
+.align 8
+.qword @S202+0
+.align 8
+.qword @S203+0
+.align 8
+.qword @S204+0
+.align 8
+.qword @S205+0
+.align 8
+.qword @S206+0
+.align 8
+.qword @S207+0
+.align 8
+.qword @S208+0
+.align 8
+.qword @S209+0
+.align 8
+.qword @S210+0
+.align 8
+.qword @S211+0
+.align 8
+.qword @S212+0
+.align 8
+.qword @S213+0
+.align 8
+.qword @S214+0
+.align 8
+.qword @S215+0
+.align 8
+.qword @S216+0
+.align 8
+.qword @S217+0
+.align 8
+.qword @S218+0
+.align 8
+.qword @S219+0
+.align 8
+.qword @S220+0
+.align 8
+.qword @S221+0
+.align 8
+.qword @S222+0
+.align 8
+.qword @S223+0
+.align 8
+.qword @S224+0
+.align 8
+.qword @S225+0
+.align 8
+.qword @S226+0
+.align 8
+.qword @S227+0
+.align 8
+.qword @S228+0
+.align 8
+.qword @S229+0
+.align 8
+.qword @S230+0
+.align 8
+.qword @S231+0
+.align 8
+.qword @S232+0
+.align 8
+.qword @S233+0
+.align 8
+.qword @S234+0
+.align 8
+.qword @S235+0
+.align 8
+.qword @S236+0
+.align 8
+.qword @S237+0
+.align 8
+.qword @S238+0
+.align 8
+.qword @S239+0
+.align 8
+.qword @S240+0
+.align 8
+.qword @S241+0
+.align 8
+.qword @S242+0
+.align 8
+.qword @S243+0
+.align 8
+.qword @S244+0
+.align 8
+.qword @S245+0
+.align 8
+.qword @S246+0
+.align 8
+.qword @S247+0
+.align 8
+.qword @S248+0
+.align 8
+.qword @S249+0
+.align 8
+.qword @S250+0
+.align 8
+.qword @S251+0
+.align 8
+.qword @S252+0
+.align 8
+.qword @S253+0
+.align 8
+.qword @S254+0
+.align 8
+.qword @S255+0
+.align 8
+.qword @S256+0
+.align 8
+.qword @S257+0
+.align 8
+.qword @S258+0
+.align 8
+.qword @S259+0
+.align 8
+.qword @S260+0
+.align 8
+.qword @S261+0
+.align 8
+.qword @S262+0
+.align 8
+.qword @S263+0
+.align 8
+.qword @S264+0
+.align 8
+.qword @S265+0
+.align 8
+.qword @S266+0
+.align 8
+.qword @S267+0
+.align 8
+.qword @S268+0
+.align 8
+.qword @S269+0
+.align 8
+.qword @S270+0
+.align 8
+.qword @S271+0
+.align 8
+.qword @S272+0
+.align 8
+.qword @S273+0
+.align 8
+.qword @S274+0
+.align 8
+.qword @S275+0
+.align 8
+.qword @S276+0
+.align 8
+.qword @S277+0
+.align 8
+.qword @S278+0
+.align 8
+.qword @S279+0
+.align 8
+.qword @S280+0
+.align 8
+.qword @S281+0
+.align 8
+.qword @S282+0
+.align 8
+.qword @S283+0
+.align 8
+.qword @S284+0
+.align 8
+.qword @S285+0
+.align 8
+.qword @S286+0
+.align 8
+.qword @S287+0
+.align 8
+.qword @S288+0
+.align 8
+.qword @S289+0
+.align 8
+.qword @S290+0
+.align 8
+.qword @S291+0
+.align 8
+.qword @S292+0
+.align 8
+.qword @S293+0
+.align 8
+.qword @S294+0
+.align 8
+.qword @S295+0
+.global token_table
+# ==== start of definition of function `convert_string' ====
+.text
+convert_string:
+addsp 28;        
+# param:`s', offset:-24
+# param:`pos', offset:-28
+# var: slen, offset: 4
+# var: src, offset: 8
+# var: end, offset: 16
+# var: dest, offset: 24
+ldbp -24;
+ldqw;
+ldiqw strlen;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+adddw;
+ldiqw str_buf_size;
+lddw;
+ugtdw;
+jmpf @L38;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+adddw;
+ldidw 2;
+muldw;
+ldiqw str_buf_size;
+stdw;
+pop;
+ldiqw str_buf_size;
+lddw;
+udw2qw;
+ldiqw str_buf;
+ldqw;
+ldiqw realloc;
+call 16;
+ldiqw str_buf;
+stqw;
+pop;
+pop;
+@L38:
+ldbp -24;
+ldqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+addqw;
+ldidw 1;
+dw2qw;
+subqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw str_buf;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+addqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L39:
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ultqw;
+jmpf @L40;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 92;
+eqdw;
+jmpf @L41;
+ldbp 8;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+ldbp 8;
+ldiqw get_esc_seq_val;
+call 8;
+pop;
+dw2b;
+ldbp 24;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+stb;
+pop;
+jmp @L42;
+@L41:
+ldbp 8;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldb;
+ldbp 24;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+stb;
+pop;
+@L42:
+jmp @L39;
+@L40:
+ldidw 0;
+dw2b;
+ldbp 24;
+ldqw;
+stb;
+pop;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw str_buf;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+addqw;
+ldiqw strlen;
+call 8;
+addqw;
+ret;
+ldidw 0;
+ret;
+.extern memchr
+.extern vfprintf
+.extern hash
+.extern iscntrl
+.extern bsearch
+.extern pre_save_pch
+.extern qsort
+.extern cg_outpath
+.extern memcmp
+.extern pre_load_pch
+# ==== start of definition of function `tag_atoms' ====
+.text
+tag_atoms:
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L43:
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 560;
+ldiqw 16;
+udivqw;
+ultqw;
+jmpf @L45;
+ldiqw keywords_table;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 1;
+adddw;
+ldiqw keywords_table;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw atom;
+call 8;
+ldiqw atom_set_tag;
+call 12;
+pop;
+pop;
+@L44:
+incldw 4;
+jmp @L43;
+@L45:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L46:
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 736;
+ldiqw 16;
+udivqw;
+ultqw;
+jmpf @L48;
+ldiqw punctuators_table;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 1;
+adddw;
+ldiqw punctuators_table;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw atom;
+call 8;
+ldiqw atom_set_tag;
+call 12;
+pop;
+pop;
+@L47:
+incldw 4;
+jmp @L46;
+@L48:
+ldidw 0;
+ret;
+.extern vsnprintf
+.extern vsprintf
+# ==== start of definition of function `next_pre_token' ====
+.text
+next_pre_token:
+addsp 12;        
+# var: p, offset: 8
+ldiqw pre_tok_ahead;
+ldqw;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L49;
+ldidw 0;
+dw2qw;
+ldiqw pre_tok_ahead;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+@L49:
+@L50:
+ldiqw get_pre_token;
+call 0;
+ldbp 8;
+stqw;
+ldiqw 33;
+addqw;
+ldb;
+jmpf @L51;
+ldbp 8;
+ldqw;
+ldiqw free_pre_token;
+call 8;
+pop;
+pop;
+jmp @L50;
+@L51:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `get_iconst_kind' ====
+.text
+get_iconst_kind:
+addsp 20;        
+# param:`ic', offset:-24
+# var: c, offset: 8
+# var: state, offset: 16
+# var: tok, offset: 20
+ldbp -24;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L52:
+ldidw 1;
+jmpf @L53;
+ldbp 16;
+lddw;
+ldiqw @T54;
+jmptab;
+@L56:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 48;
+neqdw;
+jmpf @L57;
+ldidw 1;
+jmp @L58;
+@L57:
+ldidw 2;
+@L58:
+ldbp 16;
+stdw;
+pop;
+jmp @L55;
+@L59:
+ldidw 78;
+ldbp 20;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldb;
+ldiqw isdigit;
+call 4;
+pop;
+jmpf @L60;
+jmp @L61;
+@L60:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 108;
+eqdw;
+jmpt @L62;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 76;
+eqdw;
+jmpt @L62;
+ldidw 0;
+jmp @L63;
+@L62:
+ldidw 1;
+@L63:
+jmpf @L64;
+ldidw 6;
+ldbp 16;
+stdw;
+pop;
+jmp @L65;
+@L64:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 117;
+eqdw;
+jmpt @L66;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 85;
+eqdw;
+jmpt @L66;
+ldidw 0;
+jmp @L67;
+@L66:
+ldidw 1;
+@L67:
+jmpf @L68;
+ldidw 9;
+ldbp 16;
+stdw;
+pop;
+jmp @L69;
+@L68:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 0;
+eqdw;
+jmpf @L70;
+ldbp 20;
+lddw;
+dw2qw;
+ret;
+jmp @L71;
+@L70:
+ldidw 13;
+ldbp 16;
+stdw;
+pop;
+@L71:
+@L69:
+@L65:
+@L61:
+jmp @L55;
+@L72:
+ldbp 8;
+ldqw;
+ldb;
+ldiqw isodigit;
+call 4;
+pop;
+jmpf @L73;
+ldidw 5;
+ldbp 16;
+stdw;
+pop;
+jmp @L74;
+@L73:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 120;
+eqdw;
+jmpt @L75;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 88;
+eqdw;
+jmpt @L75;
+ldidw 0;
+jmp @L76;
+@L75:
+ldidw 1;
+@L76:
+jmpf @L77;
+ldidw 3;
+ldbp 16;
+stdw;
+pop;
+jmp @L78;
+@L77:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 108;
+eqdw;
+jmpt @L79;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 76;
+eqdw;
+jmpt @L79;
+ldidw 0;
+jmp @L80;
+@L79:
+ldidw 1;
+@L80:
+jmpf @L81;
+ldidw 6;
+ldbp 16;
+stdw;
+pop;
+jmp @L82;
+@L81:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 117;
+eqdw;
+jmpt @L83;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 85;
+eqdw;
+jmpt @L83;
+ldidw 0;
+jmp @L84;
+@L83:
+ldidw 1;
+@L84:
+jmpf @L85;
+ldidw 9;
+ldbp 16;
+stdw;
+pop;
+jmp @L86;
+@L85:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 0;
+eqdw;
+jmpf @L87;
+ldidw 78;
+dw2qw;
+ret;
+jmp @L88;
+@L87:
+ldidw 13;
+ldbp 16;
+stdw;
+pop;
+@L88:
+@L86:
+@L82:
+@L78:
+@L74:
+jmp @L55;
+@L89:
+ldidw 84;
+ldbp 20;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldb;
+ldiqw isxdigit;
+call 4;
+pop;
+jmpf @L90;
+ldidw 4;
+ldbp 16;
+stdw;
+pop;
+jmp @L91;
+@L90:
+ldidw 13;
+ldbp 16;
+stdw;
+pop;
+@L91:
+jmp @L55;
+@L92:
+ldbp 8;
+ldqw;
+ldb;
+ldiqw isxdigit;
+call 4;
+pop;
+jmpf @L93;
+jmp @L94;
+@L93:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 108;
+eqdw;
+jmpt @L95;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 76;
+eqdw;
+jmpt @L95;
+ldidw 0;
+jmp @L96;
+@L95:
+ldidw 1;
+@L96:
+jmpf @L97;
+ldidw 6;
+ldbp 16;
+stdw;
+pop;
+jmp @L98;
+@L97:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 117;
+eqdw;
+jmpt @L99;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 85;
+eqdw;
+jmpt @L99;
+ldidw 0;
+jmp @L100;
+@L99:
+ldidw 1;
+@L100:
+jmpf @L101;
+ldidw 9;
+ldbp 16;
+stdw;
+pop;
+jmp @L102;
+@L101:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 0;
+eqdw;
+jmpf @L103;
+ldbp 20;
+lddw;
+dw2qw;
+ret;
+jmp @L104;
+@L103:
+ldidw 13;
+ldbp 16;
+stdw;
+pop;
+@L104:
+@L102:
+@L98:
+@L94:
+jmp @L55;
+@L105:
+ldidw 84;
+ldbp 20;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldb;
+ldiqw isodigit;
+call 4;
+pop;
+jmpf @L106;
+jmp @L107;
+@L106:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 108;
+eqdw;
+jmpt @L108;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 76;
+eqdw;
+jmpt @L108;
+ldidw 0;
+jmp @L109;
+@L108:
+ldidw 1;
+@L109:
+jmpf @L110;
+ldidw 6;
+ldbp 16;
+stdw;
+pop;
+jmp @L111;
+@L110:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 117;
+eqdw;
+jmpt @L112;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 85;
+eqdw;
+jmpt @L112;
+ldidw 0;
+jmp @L113;
+@L112:
+ldidw 1;
+@L113:
+jmpf @L114;
+ldidw 9;
+ldbp 16;
+stdw;
+pop;
+jmp @L115;
+@L114:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 0;
+eqdw;
+jmpf @L116;
+ldbp 20;
+lddw;
+dw2qw;
+ret;
+jmp @L117;
+@L116:
+ldidw 13;
+ldbp 16;
+stdw;
+pop;
+@L117:
+@L115:
+@L111:
+@L107:
+jmp @L55;
+@L118:
+ldbp 20;
+lddw;
+ldidw 78;
+eqdw;
+jmpf @L119;
+ldidw 79;
+jmp @L120;
+@L119:
+ldidw 85;
+@L120:
+ldbp 20;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 117;
+eqdw;
+jmpt @L121;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 85;
+eqdw;
+jmpt @L121;
+ldidw 0;
+jmp @L122;
+@L121:
+ldidw 1;
+@L122:
+jmpf @L123;
+ldidw 10;
+ldbp 16;
+stdw;
+pop;
+jmp @L124;
+@L123:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 108;
+eqdw;
+jmpt @L125;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 76;
+eqdw;
+jmpt @L125;
+ldidw 0;
+jmp @L126;
+@L125:
+ldidw 1;
+@L126:
+jmpf @L127;
+ldidw 7;
+ldbp 16;
+stdw;
+pop;
+jmp @L128;
+@L127:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 0;
+eqdw;
+jmpf @L129;
+ldbp 20;
+lddw;
+dw2qw;
+ret;
+jmp @L130;
+@L129:
+ldidw 13;
+ldbp 16;
+stdw;
+pop;
+@L130:
+@L128:
+@L124:
+jmp @L55;
+@L131:
+ldbp 20;
+lddw;
+ldidw 79;
+eqdw;
+jmpf @L132;
+ldidw 80;
+jmp @L133;
+@L132:
+ldidw 86;
+@L133:
+ldbp 20;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 117;
+eqdw;
+jmpt @L134;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 85;
+eqdw;
+jmpt @L134;
+ldidw 0;
+jmp @L135;
+@L134:
+ldidw 1;
+@L135:
+jmpf @L136;
+ldidw 8;
+ldbp 16;
+stdw;
+pop;
+jmp @L137;
+@L136:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 0;
+eqdw;
+jmpf @L138;
+ldbp 20;
+lddw;
+dw2qw;
+ret;
+jmp @L139;
+@L138:
+ldidw 13;
+ldbp 16;
+stdw;
+pop;
+@L139:
+@L137:
+jmp @L55;
+@L140:
+ldbp 20;
+lddw;
+ldidw 78;
+eqdw;
+jmpf @L141;
+ldidw 81;
+jmp @L142;
+@L141:
+ldidw 87;
+@L142:
+ldbp 20;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 108;
+eqdw;
+jmpt @L143;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 76;
+eqdw;
+jmpt @L143;
+ldidw 0;
+jmp @L144;
+@L143:
+ldidw 1;
+@L144:
+jmpf @L145;
+ldidw 11;
+ldbp 16;
+stdw;
+pop;
+jmp @L146;
+@L145:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 0;
+eqdw;
+jmpf @L147;
+ldbp 20;
+lddw;
+dw2qw;
+ret;
+jmp @L148;
+@L147:
+ldidw 13;
+ldbp 16;
+stdw;
+pop;
+@L148:
+@L146:
+jmp @L55;
+@L149:
+ldbp 20;
+lddw;
+ldidw 81;
+eqdw;
+jmpf @L150;
+ldidw 82;
+jmp @L151;
+@L150:
+ldidw 88;
+@L151:
+ldbp 20;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 108;
+eqdw;
+jmpt @L152;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 76;
+eqdw;
+jmpt @L152;
+ldidw 0;
+jmp @L153;
+@L152:
+ldidw 1;
+@L153:
+jmpf @L154;
+ldidw 12;
+ldbp 16;
+stdw;
+pop;
+jmp @L155;
+@L154:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 0;
+eqdw;
+jmpf @L156;
+ldbp 20;
+lddw;
+dw2qw;
+ret;
+jmp @L157;
+@L156:
+ldidw 13;
+ldbp 16;
+stdw;
+pop;
+@L157:
+@L155:
+jmp @L55;
+@L158:
+@L159:
+@L160:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 0;
+neqdw;
+jmpf @L161;
+ldidw 13;
+ldbp 16;
+stdw;
+pop;
+jmp @L162;
+@L161:
+ldbp 16;
+lddw;
+ldidw 10;
+eqdw;
+jmpf @L163;
+ldbp 20;
+lddw;
+ldidw 79;
+eqdw;
+jmpf @L164;
+ldidw 82;
+jmp @L165;
+@L164:
+ldidw 88;
+@L165:
+dw2qw;
+ret;
+jmp @L166;
+@L163:
+ldbp 20;
+lddw;
+ldidw 80;
+eqdw;
+jmpt @L169;
+ldbp 20;
+lddw;
+ldidw 82;
+eqdw;
+jmpt @L169;
+ldidw 0;
+jmp @L170;
+@L169:
+ldidw 1;
+@L170:
+jmpf @L167;
+ldidw 83;
+jmp @L168;
+@L167:
+ldidw 89;
+@L168:
+dw2qw;
+ret;
+@L166:
+@L162:
+jmp @L55;
+@L171:
+ldbp -24;
+ldqw;
+ldiqw @S296;
+ldiqw pre_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw pre_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw pre_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+jmp @L55;
+@L55:
+.data
+.align 8
+@T54:
+.dword 0
+.dword 14
+.qword @L55
+.qword @L56
+.qword @L59
+.qword @L72
+.qword @L89
+.qword @L92
+.qword @L105
+.qword @L118
+.qword @L131
+.qword @L159
+.qword @L140
+.qword @L158
+.qword @L149
+.qword @L160
+.qword @L171
+.text
+ldbp 8;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+pop;
+pop;
+jmp @L52;
+@L53:
+ldidw 0;
+ret;
+.extern warning_count
+# ==== start of definition of function `get_esc_seq_val' ====
+.text
+get_esc_seq_val:
+addsp 32;        
+# param:`c', offset:-24
+ldbp -24;
+ldqw;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldb;
+ldiqw @T172;
+switch;
+@L174:
+ldidw 10;
+dw2qw;
+ret;
+@L175:
+ldidw 9;
+dw2qw;
+ret;
+@L176:
+ldidw 11;
+dw2qw;
+ret;
+@L177:
+ldidw 8;
+dw2qw;
+ret;
+@L178:
+ldidw 13;
+dw2qw;
+ret;
+@L179:
+ldidw 12;
+dw2qw;
+ret;
+@L180:
+ldidw 7;
+dw2qw;
+ret;
+@L181:
+ldidw 92;
+dw2qw;
+ret;
+@L182:
+ldidw 63;
+dw2qw;
+ret;
+@L183:
+ldidw 39;
+dw2qw;
+ret;
+@L184:
+ldidw 34;
+dw2qw;
+ret;
+@L185:
+# var: buf, offset: 4
+# var: p, offset: 24
+ldbp 4;
+ldbp 24;
+stqw;
+pop;
+pop;
+# var: val, offset: 32
+ldbp -24;
+ldqw;
+ldqw;
+ldb;
+ldiqw isxdigit;
+call 4;
+pop;
+jmpf @L186;
+@L187:
+ldbp -24;
+ldqw;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldb;
+ldbp 24;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+stb;
+pop;
+@L188:
+ldbp -24;
+ldqw;
+ldqw;
+ldb;
+ldiqw isxdigit;
+call 4;
+pop;
+jmpf @L189;
+jmp @L187;
+@L189:
+ldidw 0;
+dw2b;
+ldbp 24;
+ldqw;
+stb;
+pop;
+ldbp 32;
+ldiqw @S297;
+ldbp 4;
+ldiqw sscanf;
+call 24;
+pop;
+pop;
+ldbp 32;
+lddw;
+dw2b;
+dw2qw;
+ret;
+jmp @L190;
+@L186:
+ldiqw @S298;
+ldiqw pre_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw pre_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw pre_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L190:
+@L191:
+ldbp -24;
+ldqw;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+subqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldqw;
+ldb;
+ldiqw isodigit;
+call 4;
+pop;
+jmpf @L192;
+# var: buf, offset: 4
+# var: p, offset: 24
+ldbp 4;
+ldbp 24;
+stqw;
+pop;
+pop;
+# var: val, offset: 32
+@L193:
+ldbp -24;
+ldqw;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldb;
+ldbp 24;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+stb;
+pop;
+@L194:
+ldbp -24;
+ldqw;
+ldqw;
+ldb;
+ldiqw isodigit;
+call 4;
+pop;
+jmpf @L195;
+jmp @L193;
+@L195:
+ldidw 0;
+dw2b;
+ldbp 24;
+ldqw;
+stb;
+pop;
+ldbp 32;
+ldiqw @S299;
+ldbp 4;
+ldiqw sscanf;
+call 24;
+pop;
+pop;
+ldbp 32;
+lddw;
+dw2b;
+dw2qw;
+ret;
+jmp @L196;
+@L192:
+ldbp -24;
+ldqw;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldb;
+dw2qw;
+ret;
+@L196:
+@L173:
+.data
+.align 8
+@T172:
+.dword 13
+.dword 34
+.dword 39
+.dword 63
+.dword 92
+.dword 97
+.dword 98
+.dword 102
+.dword 110
+.dword 114
+.dword 116
+.dword 118
+.dword 120
+.qword @L191
+.qword @L184
+.qword @L183
+.qword @L182
+.qword @L181
+.qword @L180
+.qword @L177
+.qword @L179
+.qword @L174
+.qword @L178
+.qword @L175
+.qword @L176
+.qword @L185
+.text
+ldidw 0;
+ret;
+.extern memcpy
+.extern fopen
+.extern be_atoi
+# ==== start of definition of function `free_c_token' ====
+.text
+free_c_token:
+.global free_c_token
+addsp 0;         
+# param:`t', offset:-24
+ldiqw free_tokens;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw free_tokens;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern get_pre_token
+.data
+.align 8
+keywords_table:
+.align 8
+.align 8
+.qword @S300+0
+.align 4
+.dword 119
+.align 8
+.align 8
+.qword @S301+0
+.align 4
+.dword 117
+.align 8
+.align 8
+.qword @S302+0
+.align 4
+.dword 118
+.align 8
+.align 8
+.qword @S303+0
+.align 4
+.dword 115
+.align 8
+.align 8
+.qword @S304+0
+.align 4
+.dword 116
+.align 8
+.align 8
+.qword @S305+0
+.align 4
+.dword 46
+.align 8
+.align 8
+.qword @S306+0
+.align 4
+.dword 47
+.align 8
+.align 8
+.qword @S307+0
+.align 4
+.dword 48
+.align 8
+.align 8
+.qword @S308+0
+.align 4
+.dword 49
+.align 8
+.align 8
+.qword @S309+0
+.align 4
+.dword 50
+.align 8
+.align 8
+.qword @S310+0
+.align 4
+.dword 51
+.align 8
+.align 8
+.qword @S311+0
+.align 4
+.dword 52
+.align 8
+.align 8
+.qword @S312+0
+.align 4
+.dword 53
+.align 8
+.align 8
+.qword @S313+0
+.align 4
+.dword 54
+.align 8
+.align 8
+.qword @S314+0
+.align 4
+.dword 55
+.align 8
+.align 8
+.qword @S315+0
+.align 4
+.dword 56
+.align 8
+.align 8
+.qword @S316+0
+.align 4
+.dword 57
+.align 8
+.align 8
+.qword @S317+0
+.align 4
+.dword 58
+.align 8
+.align 8
+.qword @S318+0
+.align 4
+.dword 59
+.align 8
+.align 8
+.qword @S319+0
+.align 4
+.dword 60
+.align 8
+.align 8
+.qword @S320+0
+.align 4
+.dword 61
+.align 8
+.align 8
+.qword @S321+0
+.align 4
+.dword 62
+.align 8
+.align 8
+.qword @S322+0
+.align 4
+.dword 63
+.align 8
+.align 8
+.qword @S323+0
+.align 4
+.dword 64
+.align 8
+.align 8
+.qword @S324+0
+.align 4
+.dword 65
+.align 8
+.align 8
+.qword @S325+0
+.align 4
+.dword 66
+.align 8
+.align 8
+.qword @S326+0
+.align 4
+.dword 67
+.align 8
+.align 8
+.qword @S327+0
+.align 4
+.dword 68
+.align 8
+.align 8
+.qword @S328+0
+.align 4
+.dword 69
+.align 8
+.align 8
+.qword @S329+0
+.align 4
+.dword 70
+.align 8
+.align 8
+.qword @S330+0
+.align 4
+.dword 71
+.align 8
+.align 8
+.qword @S331+0
+.align 4
+.dword 72
+.align 8
+.align 8
+.qword @S332+0
+.align 4
+.dword 73
+.align 8
+.align 8
+.qword @S333+0
+.align 4
+.dword 74
+.align 8
+.align 8
+.qword @S334+0
+.align 4
+.dword 75
+.bss
+.align 8
+free_tokens:
+.res 8
+.extern strncat
+.extern fileno
+.extern isdigit
+.extern isspace
+.extern hash2
+.extern isalpha
+.extern memmove
+.extern replace_extension
+.extern isgraph
+.extern strdup
+.extern arena_new
+.extern cfg_function_to_print
+.extern strncmp
+.extern arena_set_nom_siz
+.bss
+.align 4
+str_buf_size:
+.res 4
+.extern atom_hash
+.extern stat_number_of_c_tokens
+.extern strncpy
+.extern strnlen
+.bss
+.align 8
+lexer_str_arena:
+.res 8
+.extern targeting_arch64
+.extern arena_reset
+.extern fread
+.extern strrchr
+.extern disable_warnings
+.extern install_macro
+.extern ferror
+.extern random
+.extern isblank
+.extern free
+.extern malloc
+.extern srandom
+.extern fgetc
+.data
+@S0:
+.byte 33
+.byte 0
+@S1:
+.byte 33
+.byte 61
+.byte 0
+@S2:
+.byte 37
+.byte 0
+@S3:
+.byte 37
+.byte 61
+.byte 0
+@S4:
+.byte 38
+.byte 0
+@S5:
+.byte 38
+.byte 38
+.byte 0
+@S6:
+.byte 38
+.byte 61
+.byte 0
+@S7:
+.byte 40
+.byte 0
+@S8:
+.byte 41
+.byte 0
+@S9:
+.byte 42
+.byte 0
+@S10:
+.byte 42
+.byte 61
+.byte 0
+@S11:
+.byte 43
+.byte 0
+@S12:
+.byte 43
+.byte 43
+.byte 0
+@S13:
+.byte 43
+.byte 61
+.byte 0
+@S14:
+.byte 44
+.byte 0
+@S15:
+.byte 45
+.byte 0
+@S16:
+.byte 45
+.byte 45
+.byte 0
+@S17:
+.byte 45
+.byte 61
+.byte 0
+@S18:
+.byte 45
+.byte 62
+.byte 0
+@S19:
+.byte 46
+.byte 0
+@S20:
+.byte 46
+.byte 46
+.byte 46
+.byte 0
+@S21:
+.byte 47
+.byte 0
+@S22:
+.byte 47
+.byte 61
+.byte 0
+@S23:
+.byte 58
+.byte 0
+@S24:
+.byte 59
+.byte 0
+@S25:
+.byte 60
+.byte 0
+@S26:
+.byte 60
+.byte 60
+.byte 0
+@S27:
+.byte 60
+.byte 60
+.byte 61
+.byte 0
+@S28:
+.byte 60
+.byte 61
+.byte 0
+@S29:
+.byte 61
+.byte 0
+@S30:
+.byte 61
+.byte 61
+.byte 0
+@S31:
+.byte 62
+.byte 0
+@S32:
+.byte 62
+.byte 61
+.byte 0
+@S33:
+.byte 62
+.byte 62
+.byte 0
+@S34:
+.byte 62
+.byte 62
+.byte 61
+.byte 0
+@S35:
+.byte 63
+.byte 0
+@S36:
+.byte 91
+.byte 0
+@S37:
+.byte 93
+.byte 0
+@S38:
+.byte 94
+.byte 0
+@S39:
+.byte 94
+.byte 61
+.byte 0
+@S40:
+.byte 123
+.byte 0
+@S41:
+.byte 124
+.byte 0
+@S42:
+.byte 124
+.byte 61
+.byte 0
+@S43:
+.byte 124
+.byte 124
+.byte 0
+@S44:
+.byte 125
+.byte 0
+@S45:
+.byte 126
+.byte 0
+@S46:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 99
+.byte 95
+.byte 116
+.byte 111
+.byte 107
+.byte 101
+.byte 110
+.byte 0
+@S47:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 108
+.byte 101
+.byte 120
+.byte 101
+.byte 114
+.byte 46
+.byte 99
+.byte 0
+@S48:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S49:
+.byte 37
+.byte 100
+.byte 0
+@S50:
+.byte 37
+.byte 100
+.byte 0
+@S51:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 99
+.byte 95
+.byte 116
+.byte 111
+.byte 107
+.byte 101
+.byte 110
+.byte 0
+@S52:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 108
+.byte 101
+.byte 120
+.byte 101
+.byte 114
+.byte 46
+.byte 99
+.byte 0
+@S53:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S54:
+.byte 115
+.byte 116
+.byte 114
+.byte 97
+.byte 121
+.byte 32
+.byte 96
+.byte 37
+.byte 99
+.byte 39
+.byte 32
+.byte 102
+.byte 111
+.byte 117
+.byte 110
+.byte 100
+.byte 59
+.byte 32
+.byte 105
+.byte 103
+.byte 110
+.byte 111
+.byte 114
+.byte 105
+.byte 110
+.byte 103
+.byte 46
+.byte 46
+.byte 46
+.byte 0
+@S55:
+.byte 115
+.byte 116
+.byte 114
+.byte 97
+.byte 121
+.byte 32
+.byte 96
+.byte 48
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 39
+.byte 32
+.byte 102
+.byte 111
+.byte 117
+.byte 110
+.byte 100
+.byte 59
+.byte 32
+.byte 105
+.byte 103
+.byte 110
+.byte 111
+.byte 114
+.byte 105
+.byte 110
+.byte 103
+.byte 46
+.byte 46
+.byte 46
+.byte 0
+@S56:
+.byte 76
+.byte 66
+.byte 82
+.byte 65
+.byte 67
+.byte 75
+.byte 69
+.byte 84
+.byte 0
+@S57:
+.byte 91
+.byte 0
+@S58:
+.byte 82
+.byte 66
+.byte 82
+.byte 65
+.byte 67
+.byte 75
+.byte 69
+.byte 84
+.byte 0
+@S59:
+.byte 93
+.byte 0
+@S60:
+.byte 76
+.byte 80
+.byte 65
+.byte 82
+.byte 69
+.byte 78
+.byte 0
+@S61:
+.byte 40
+.byte 0
+@S62:
+.byte 82
+.byte 80
+.byte 65
+.byte 82
+.byte 69
+.byte 78
+.byte 0
+@S63:
+.byte 41
+.byte 0
+@S64:
+.byte 76
+.byte 66
+.byte 82
+.byte 65
+.byte 67
+.byte 69
+.byte 0
+@S65:
+.byte 123
+.byte 0
+@S66:
+.byte 82
+.byte 66
+.byte 82
+.byte 65
+.byte 67
+.byte 69
+.byte 0
+@S67:
+.byte 125
+.byte 0
+@S68:
+.byte 68
+.byte 79
+.byte 84
+.byte 0
+@S69:
+.byte 46
+.byte 0
+@S70:
+.byte 65
+.byte 82
+.byte 82
+.byte 79
+.byte 87
+.byte 0
+@S71:
+.byte 45
+.byte 62
+.byte 0
+@S72:
+.byte 73
+.byte 78
+.byte 67
+.byte 0
+@S73:
+.byte 43
+.byte 43
+.byte 0
+@S74:
+.byte 68
+.byte 69
+.byte 67
+.byte 0
+@S75:
+.byte 45
+.byte 45
+.byte 0
+@S76:
+.byte 65
+.byte 77
+.byte 80
+.byte 69
+.byte 82
+.byte 83
+.byte 65
+.byte 78
+.byte 68
+.byte 0
+@S77:
+.byte 38
+.byte 0
+@S78:
+.byte 83
+.byte 84
+.byte 65
+.byte 82
+.byte 0
+@S79:
+.byte 42
+.byte 0
+@S80:
+.byte 80
+.byte 76
+.byte 85
+.byte 83
+.byte 0
+@S81:
+.byte 43
+.byte 0
+@S82:
+.byte 77
+.byte 73
+.byte 78
+.byte 85
+.byte 83
+.byte 0
+@S83:
+.byte 45
+.byte 0
+@S84:
+.byte 67
+.byte 79
+.byte 77
+.byte 80
+.byte 76
+.byte 69
+.byte 77
+.byte 69
+.byte 78
+.byte 84
+.byte 0
+@S85:
+.byte 126
+.byte 0
+@S86:
+.byte 78
+.byte 69
+.byte 71
+.byte 65
+.byte 84
+.byte 73
+.byte 79
+.byte 78
+.byte 0
+@S87:
+.byte 33
+.byte 0
+@S88:
+.byte 68
+.byte 73
+.byte 86
+.byte 0
+@S89:
+.byte 47
+.byte 0
+@S90:
+.byte 77
+.byte 79
+.byte 68
+.byte 0
+@S91:
+.byte 37
+.byte 0
+@S92:
+.byte 76
+.byte 83
+.byte 72
+.byte 73
+.byte 70
+.byte 84
+.byte 0
+@S93:
+.byte 60
+.byte 60
+.byte 0
+@S94:
+.byte 82
+.byte 83
+.byte 72
+.byte 73
+.byte 70
+.byte 84
+.byte 0
+@S95:
+.byte 62
+.byte 62
+.byte 0
+@S96:
+.byte 76
+.byte 84
+.byte 0
+@S97:
+.byte 60
+.byte 0
+@S98:
+.byte 71
+.byte 84
+.byte 0
+@S99:
+.byte 62
+.byte 0
+@S100:
+.byte 76
+.byte 69
+.byte 84
+.byte 0
+@S101:
+.byte 60
+.byte 61
+.byte 0
+@S102:
+.byte 71
+.byte 69
+.byte 84
+.byte 0
+@S103:
+.byte 62
+.byte 61
+.byte 0
+@S104:
+.byte 69
+.byte 81
+.byte 0
+@S105:
+.byte 61
+.byte 61
+.byte 0
+@S106:
+.byte 78
+.byte 69
+.byte 81
+.byte 0
+@S107:
+.byte 33
+.byte 61
+.byte 0
+@S108:
+.byte 66
+.byte 87
+.byte 95
+.byte 88
+.byte 79
+.byte 82
+.byte 0
+@S109:
+.byte 94
+.byte 0
+@S110:
+.byte 66
+.byte 87
+.byte 95
+.byte 79
+.byte 82
+.byte 0
+@S111:
+.byte 124
+.byte 0
+@S112:
+.byte 65
+.byte 78
+.byte 68
+.byte 0
+@S113:
+.byte 38
+.byte 38
+.byte 0
+@S114:
+.byte 79
+.byte 82
+.byte 0
+@S115:
+.byte 124
+.byte 124
+.byte 0
+@S116:
+.byte 67
+.byte 79
+.byte 78
+.byte 68
+.byte 73
+.byte 84
+.byte 73
+.byte 79
+.byte 78
+.byte 65
+.byte 76
+.byte 0
+@S117:
+.byte 63
+.byte 58
+.byte 0
+@S118:
+.byte 67
+.byte 79
+.byte 76
+.byte 79
+.byte 78
+.byte 0
+@S119:
+.byte 58
+.byte 0
+@S120:
+.byte 83
+.byte 69
+.byte 77
+.byte 73
+.byte 67
+.byte 79
+.byte 76
+.byte 79
+.byte 78
+.byte 0
+@S121:
+.byte 59
+.byte 0
+@S122:
+.byte 69
+.byte 76
+.byte 76
+.byte 73
+.byte 80
+.byte 83
+.byte 73
+.byte 83
+.byte 0
+@S123:
+.byte 46
+.byte 46
+.byte 46
+.byte 0
+@S124:
+.byte 67
+.byte 79
+.byte 77
+.byte 77
+.byte 65
+.byte 0
+@S125:
+.byte 44
+.byte 0
+@S126:
+.byte 65
+.byte 83
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 0
+@S127:
+.byte 61
+.byte 0
+@S128:
+.byte 77
+.byte 85
+.byte 76
+.byte 95
+.byte 65
+.byte 83
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 0
+@S129:
+.byte 42
+.byte 61
+.byte 0
+@S130:
+.byte 68
+.byte 73
+.byte 86
+.byte 95
+.byte 65
+.byte 83
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 0
+@S131:
+.byte 47
+.byte 61
+.byte 0
+@S132:
+.byte 77
+.byte 79
+.byte 68
+.byte 95
+.byte 65
+.byte 83
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 0
+@S133:
+.byte 37
+.byte 61
+.byte 0
+@S134:
+.byte 80
+.byte 76
+.byte 85
+.byte 83
+.byte 95
+.byte 65
+.byte 83
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 0
+@S135:
+.byte 43
+.byte 61
+.byte 0
+@S136:
+.byte 77
+.byte 73
+.byte 78
+.byte 85
+.byte 83
+.byte 95
+.byte 65
+.byte 83
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 0
+@S137:
+.byte 45
+.byte 61
+.byte 0
+@S138:
+.byte 76
+.byte 83
+.byte 72
+.byte 73
+.byte 70
+.byte 84
+.byte 95
+.byte 65
+.byte 83
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 0
+@S139:
+.byte 60
+.byte 60
+.byte 61
+.byte 0
+@S140:
+.byte 82
+.byte 83
+.byte 72
+.byte 73
+.byte 70
+.byte 84
+.byte 95
+.byte 65
+.byte 83
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 0
+@S141:
+.byte 62
+.byte 62
+.byte 61
+.byte 0
+@S142:
+.byte 66
+.byte 87
+.byte 95
+.byte 65
+.byte 78
+.byte 68
+.byte 95
+.byte 65
+.byte 83
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 0
+@S143:
+.byte 38
+.byte 61
+.byte 0
+@S144:
+.byte 66
+.byte 87
+.byte 95
+.byte 88
+.byte 79
+.byte 82
+.byte 95
+.byte 65
+.byte 83
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 0
+@S145:
+.byte 94
+.byte 61
+.byte 0
+@S146:
+.byte 66
+.byte 87
+.byte 95
+.byte 79
+.byte 82
+.byte 95
+.byte 65
+.byte 83
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 0
+@S147:
+.byte 124
+.byte 61
+.byte 0
+@S148:
+.byte 65
+.byte 85
+.byte 84
+.byte 79
+.byte 0
+@S149:
+.byte 97
+.byte 117
+.byte 116
+.byte 111
+.byte 0
+@S150:
+.byte 66
+.byte 82
+.byte 69
+.byte 65
+.byte 75
+.byte 0
+@S151:
+.byte 98
+.byte 114
+.byte 101
+.byte 97
+.byte 107
+.byte 0
+@S152:
+.byte 67
+.byte 65
+.byte 83
+.byte 69
+.byte 0
+@S153:
+.byte 99
+.byte 97
+.byte 115
+.byte 101
+.byte 0
+@S154:
+.byte 67
+.byte 72
+.byte 65
+.byte 82
+.byte 0
+@S155:
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 0
+@S156:
+.byte 67
+.byte 79
+.byte 78
+.byte 83
+.byte 84
+.byte 0
+@S157:
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 0
+@S158:
+.byte 67
+.byte 79
+.byte 78
+.byte 84
+.byte 73
+.byte 78
+.byte 85
+.byte 69
+.byte 0
+@S159:
+.byte 99
+.byte 111
+.byte 110
+.byte 116
+.byte 105
+.byte 110
+.byte 117
+.byte 101
+.byte 0
+@S160:
+.byte 68
+.byte 69
+.byte 70
+.byte 65
+.byte 85
+.byte 76
+.byte 84
+.byte 0
+@S161:
+.byte 100
+.byte 101
+.byte 102
+.byte 97
+.byte 117
+.byte 108
+.byte 116
+.byte 0
+@S162:
+.byte 68
+.byte 79
+.byte 0
+@S163:
+.byte 100
+.byte 111
+.byte 0
+@S164:
+.byte 69
+.byte 76
+.byte 83
+.byte 69
+.byte 0
+@S165:
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 0
+@S166:
+.byte 69
+.byte 78
+.byte 85
+.byte 77
+.byte 0
+@S167:
+.byte 101
+.byte 110
+.byte 117
+.byte 109
+.byte 0
+@S168:
+.byte 69
+.byte 88
+.byte 84
+.byte 69
+.byte 82
+.byte 78
+.byte 0
+@S169:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 0
+@S170:
+.byte 70
+.byte 79
+.byte 82
+.byte 0
+@S171:
+.byte 102
+.byte 111
+.byte 114
+.byte 0
+@S172:
+.byte 71
+.byte 79
+.byte 84
+.byte 79
+.byte 0
+@S173:
+.byte 103
+.byte 111
+.byte 116
+.byte 111
+.byte 0
+@S174:
+.byte 73
+.byte 70
+.byte 0
+@S175:
+.byte 105
+.byte 102
+.byte 0
+@S176:
+.byte 73
+.byte 78
+.byte 84
+.byte 0
+@S177:
+.byte 105
+.byte 110
+.byte 116
+.byte 0
+@S178:
+.byte 76
+.byte 79
+.byte 78
+.byte 71
+.byte 0
+@S179:
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 0
+@S180:
+.byte 82
+.byte 69
+.byte 71
+.byte 73
+.byte 83
+.byte 84
+.byte 69
+.byte 82
+.byte 0
+@S181:
+.byte 114
+.byte 101
+.byte 103
+.byte 105
+.byte 115
+.byte 116
+.byte 101
+.byte 114
+.byte 0
+@S182:
+.byte 82
+.byte 69
+.byte 84
+.byte 85
+.byte 82
+.byte 78
+.byte 0
+@S183:
+.byte 114
+.byte 101
+.byte 116
+.byte 117
+.byte 114
+.byte 110
+.byte 0
+@S184:
+.byte 83
+.byte 72
+.byte 79
+.byte 82
+.byte 84
+.byte 0
+@S185:
+.byte 115
+.byte 104
+.byte 111
+.byte 114
+.byte 116
+.byte 0
+@S186:
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 69
+.byte 68
+.byte 0
+@S187:
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 101
+.byte 100
+.byte 0
+@S188:
+.byte 83
+.byte 73
+.byte 90
+.byte 69
+.byte 79
+.byte 70
+.byte 0
+@S189:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 0
+@S190:
+.byte 83
+.byte 84
+.byte 65
+.byte 84
+.byte 73
+.byte 67
+.byte 0
+@S191:
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 0
+@S192:
+.byte 83
+.byte 84
+.byte 82
+.byte 85
+.byte 67
+.byte 84
+.byte 0
+@S193:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 0
+@S194:
+.byte 83
+.byte 87
+.byte 73
+.byte 84
+.byte 67
+.byte 72
+.byte 0
+@S195:
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 0
+@S196:
+.byte 84
+.byte 89
+.byte 80
+.byte 69
+.byte 68
+.byte 69
+.byte 70
+.byte 0
+@S197:
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 0
+@S198:
+.byte 85
+.byte 78
+.byte 73
+.byte 79
+.byte 78
+.byte 0
+@S199:
+.byte 117
+.byte 110
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S200:
+.byte 85
+.byte 78
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 69
+.byte 68
+.byte 0
+@S201:
+.byte 117
+.byte 110
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 101
+.byte 100
+.byte 0
+@S202:
+.byte 86
+.byte 79
+.byte 73
+.byte 68
+.byte 0
+@S203:
+.byte 118
+.byte 111
+.byte 105
+.byte 100
+.byte 0
+@S204:
+.byte 86
+.byte 79
+.byte 76
+.byte 65
+.byte 84
+.byte 73
+.byte 76
+.byte 69
+.byte 0
+@S205:
+.byte 118
+.byte 111
+.byte 108
+.byte 97
+.byte 116
+.byte 105
+.byte 108
+.byte 101
+.byte 0
+@S206:
+.byte 87
+.byte 72
+.byte 73
+.byte 76
+.byte 69
+.byte 0
+@S207:
+.byte 119
+.byte 104
+.byte 105
+.byte 108
+.byte 101
+.byte 0
+@S208:
+.byte 73
+.byte 68
+.byte 0
+@S209:
+.byte 105
+.byte 100
+.byte 101
+.byte 110
+.byte 116
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 0
+@S210:
+.byte 83
+.byte 84
+.byte 82
+.byte 76
+.byte 73
+.byte 84
+.byte 0
+@S211:
+.byte 115
+.byte 116
+.byte 114
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 108
+.byte 105
+.byte 116
+.byte 101
+.byte 114
+.byte 97
+.byte 108
+.byte 0
+@S212:
+.byte 73
+.byte 67
+.byte 79
+.byte 78
+.byte 83
+.byte 84
+.byte 95
+.byte 68
+.byte 0
+@S213:
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S214:
+.byte 73
+.byte 67
+.byte 79
+.byte 78
+.byte 83
+.byte 84
+.byte 95
+.byte 68
+.byte 76
+.byte 0
+@S215:
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S216:
+.byte 73
+.byte 67
+.byte 79
+.byte 78
+.byte 83
+.byte 84
+.byte 95
+.byte 68
+.byte 76
+.byte 76
+.byte 0
+@S217:
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S218:
+.byte 73
+.byte 67
+.byte 79
+.byte 78
+.byte 83
+.byte 84
+.byte 95
+.byte 68
+.byte 85
+.byte 0
+@S219:
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S220:
+.byte 73
+.byte 67
+.byte 79
+.byte 78
+.byte 83
+.byte 84
+.byte 95
+.byte 68
+.byte 85
+.byte 76
+.byte 0
+@S221:
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S222:
+.byte 73
+.byte 67
+.byte 79
+.byte 78
+.byte 83
+.byte 84
+.byte 95
+.byte 68
+.byte 85
+.byte 76
+.byte 76
+.byte 0
+@S223:
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S224:
+.byte 73
+.byte 67
+.byte 79
+.byte 78
+.byte 83
+.byte 84
+.byte 95
+.byte 79
+.byte 72
+.byte 0
+@S225:
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S226:
+.byte 73
+.byte 67
+.byte 79
+.byte 78
+.byte 83
+.byte 84
+.byte 95
+.byte 79
+.byte 72
+.byte 76
+.byte 0
+@S227:
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S228:
+.byte 73
+.byte 67
+.byte 79
+.byte 78
+.byte 83
+.byte 84
+.byte 95
+.byte 79
+.byte 72
+.byte 76
+.byte 76
+.byte 0
+@S229:
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S230:
+.byte 73
+.byte 67
+.byte 79
+.byte 78
+.byte 83
+.byte 84
+.byte 95
+.byte 79
+.byte 72
+.byte 85
+.byte 0
+@S231:
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S232:
+.byte 73
+.byte 67
+.byte 79
+.byte 78
+.byte 83
+.byte 84
+.byte 95
+.byte 79
+.byte 72
+.byte 85
+.byte 76
+.byte 0
+@S233:
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S234:
+.byte 73
+.byte 67
+.byte 79
+.byte 78
+.byte 83
+.byte 84
+.byte 95
+.byte 79
+.byte 72
+.byte 85
+.byte 76
+.byte 76
+.byte 0
+@S235:
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S236:
+.byte 69
+.byte 82
+.byte 82
+.byte 79
+.byte 82
+.byte 0
+@S237:
+.byte 101
+.byte 114
+.byte 114
+.byte 111
+.byte 114
+.byte 0
+@S238:
+.byte 69
+.byte 79
+.byte 70
+.byte 0
+@S239:
+.byte 101
+.byte 110
+.byte 100
+.byte 45
+.byte 111
+.byte 102
+.byte 45
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 0
+@S240:
+.byte 84
+.byte 89
+.byte 80
+.byte 69
+.byte 68
+.byte 69
+.byte 70
+.byte 78
+.byte 65
+.byte 77
+.byte 69
+.byte 0
+@S241:
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 45
+.byte 110
+.byte 97
+.byte 109
+.byte 101
+.byte 0
+@S242:
+.byte 80
+.byte 82
+.byte 69
+.byte 95
+.byte 73
+.byte 78
+.byte 67
+.byte 0
+@S243:
+.byte 43
+.byte 43
+.byte 0
+@S244:
+.byte 80
+.byte 79
+.byte 83
+.byte 95
+.byte 73
+.byte 78
+.byte 67
+.byte 0
+@S245:
+.byte 43
+.byte 43
+.byte 0
+@S246:
+.byte 80
+.byte 82
+.byte 69
+.byte 95
+.byte 68
+.byte 69
+.byte 67
+.byte 0
+@S247:
+.byte 45
+.byte 45
+.byte 0
+@S248:
+.byte 80
+.byte 79
+.byte 83
+.byte 95
+.byte 68
+.byte 69
+.byte 67
+.byte 0
+@S249:
+.byte 45
+.byte 45
+.byte 0
+@S250:
+.byte 83
+.byte 85
+.byte 66
+.byte 83
+.byte 67
+.byte 82
+.byte 73
+.byte 80
+.byte 84
+.byte 0
+@S251:
+.byte 91
+.byte 93
+.byte 0
+@S252:
+.byte 70
+.byte 85
+.byte 78
+.byte 67
+.byte 84
+.byte 73
+.byte 79
+.byte 78
+.byte 0
+@S253:
+.byte 40
+.byte 41
+.byte 0
+@S254:
+.byte 85
+.byte 78
+.byte 65
+.byte 82
+.byte 89
+.byte 95
+.byte 80
+.byte 76
+.byte 85
+.byte 83
+.byte 0
+@S255:
+.byte 43
+.byte 0
+@S256:
+.byte 85
+.byte 78
+.byte 65
+.byte 82
+.byte 89
+.byte 95
+.byte 77
+.byte 73
+.byte 78
+.byte 85
+.byte 83
+.byte 0
+@S257:
+.byte 45
+.byte 0
+@S258:
+.byte 73
+.byte 78
+.byte 68
+.byte 73
+.byte 82
+.byte 69
+.byte 67
+.byte 84
+.byte 73
+.byte 79
+.byte 78
+.byte 0
+@S259:
+.byte 42
+.byte 0
+@S260:
+.byte 77
+.byte 85
+.byte 76
+.byte 0
+@S261:
+.byte 42
+.byte 0
+@S262:
+.byte 65
+.byte 68
+.byte 68
+.byte 82
+.byte 69
+.byte 83
+.byte 83
+.byte 95
+.byte 79
+.byte 70
+.byte 0
+@S263:
+.byte 38
+.byte 0
+@S264:
+.byte 66
+.byte 87
+.byte 95
+.byte 65
+.byte 78
+.byte 68
+.byte 0
+@S265:
+.byte 38
+.byte 0
+@S266:
+.byte 67
+.byte 65
+.byte 83
+.byte 84
+.byte 0
+@S267:
+.byte 40
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 45
+.byte 110
+.byte 97
+.byte 109
+.byte 101
+.byte 41
+.byte 0
+@S268:
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 69
+.byte 68
+.byte 95
+.byte 67
+.byte 72
+.byte 65
+.byte 82
+.byte 0
+@S269:
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 101
+.byte 100
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 0
+@S270:
+.byte 85
+.byte 78
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 69
+.byte 68
+.byte 95
+.byte 67
+.byte 72
+.byte 65
+.byte 82
+.byte 0
+@S271:
+.byte 117
+.byte 110
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 101
+.byte 100
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 0
+@S272:
+.byte 85
+.byte 78
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 69
+.byte 68
+.byte 95
+.byte 83
+.byte 72
+.byte 79
+.byte 82
+.byte 84
+.byte 0
+@S273:
+.byte 117
+.byte 110
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 101
+.byte 100
+.byte 32
+.byte 115
+.byte 104
+.byte 111
+.byte 114
+.byte 116
+.byte 0
+@S274:
+.byte 85
+.byte 78
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 69
+.byte 68
+.byte 95
+.byte 76
+.byte 79
+.byte 78
+.byte 71
+.byte 0
+@S275:
+.byte 117
+.byte 110
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 101
+.byte 100
+.byte 32
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 0
+@S276:
+.byte 76
+.byte 79
+.byte 78
+.byte 71
+.byte 95
+.byte 76
+.byte 79
+.byte 78
+.byte 71
+.byte 0
+@S277:
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 32
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 0
+@S278:
+.byte 85
+.byte 78
+.byte 83
+.byte 73
+.byte 71
+.byte 78
+.byte 69
+.byte 68
+.byte 95
+.byte 76
+.byte 79
+.byte 78
+.byte 71
+.byte 95
+.byte 76
+.byte 79
+.byte 78
+.byte 71
+.byte 0
+@S279:
+.byte 117
+.byte 110
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 101
+.byte 100
+.byte 32
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 32
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 0
+@S280:
+.byte 67
+.byte 79
+.byte 78
+.byte 83
+.byte 84
+.byte 95
+.byte 86
+.byte 79
+.byte 76
+.byte 65
+.byte 84
+.byte 73
+.byte 76
+.byte 69
+.byte 0
+@S281:
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 32
+.byte 118
+.byte 111
+.byte 108
+.byte 97
+.byte 116
+.byte 105
+.byte 108
+.byte 101
+.byte 0
+@S282:
+.byte 69
+.byte 78
+.byte 85
+.byte 77
+.byte 95
+.byte 67
+.byte 79
+.byte 78
+.byte 83
+.byte 84
+.byte 0
+@S283:
+.byte 101
+.byte 110
+.byte 117
+.byte 109
+.byte 101
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S284:
+.byte 73
+.byte 78
+.byte 73
+.byte 84
+.byte 95
+.byte 76
+.byte 73
+.byte 83
+.byte 84
+.byte 0
+@S285:
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 97
+.byte 108
+.byte 105
+.byte 122
+.byte 101
+.byte 114
+.byte 32
+.byte 108
+.byte 105
+.byte 115
+.byte 116
+.byte 0
+@S286:
+.byte 70
+.byte 85
+.byte 78
+.byte 67
+.byte 95
+.byte 78
+.byte 65
+.byte 77
+.byte 69
+.byte 0
+@S287:
+.byte 95
+.byte 95
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 95
+.byte 95
+.byte 0
+@S288:
+.byte 83
+.byte 84
+.byte 65
+.byte 84
+.byte 73
+.byte 67
+.byte 95
+.byte 65
+.byte 83
+.byte 83
+.byte 69
+.byte 82
+.byte 84
+.byte 0
+@S289:
+.byte 95
+.byte 95
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 95
+.byte 97
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 0
+@S290:
+.byte 65
+.byte 83
+.byte 77
+.byte 0
+@S291:
+.byte 95
+.byte 95
+.byte 97
+.byte 115
+.byte 109
+.byte 0
+@S292:
+.byte 66
+.byte 85
+.byte 73
+.byte 76
+.byte 84
+.byte 73
+.byte 78
+.byte 95
+.byte 86
+.byte 65
+.byte 95
+.byte 83
+.byte 84
+.byte 65
+.byte 82
+.byte 84
+.byte 0
+@S293:
+.byte 95
+.byte 95
+.byte 98
+.byte 117
+.byte 105
+.byte 108
+.byte 116
+.byte 105
+.byte 110
+.byte 95
+.byte 118
+.byte 97
+.byte 95
+.byte 115
+.byte 116
+.byte 97
+.byte 114
+.byte 116
+.byte 0
+@S294:
+.byte 65
+.byte 76
+.byte 73
+.byte 71
+.byte 78
+.byte 79
+.byte 70
+.byte 0
+@S295:
+.byte 95
+.byte 95
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 111
+.byte 102
+.byte 95
+.byte 95
+.byte 0
+@S296:
+.byte 105
+.byte 110
+.byte 118
+.byte 97
+.byte 108
+.byte 105
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S297:
+.byte 37
+.byte 120
+.byte 0
+@S298:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 104
+.byte 101
+.byte 120
+.byte 97
+.byte 100
+.byte 101
+.byte 99
+.byte 105
+.byte 109
+.byte 97
+.byte 108
+.byte 32
+.byte 100
+.byte 105
+.byte 103
+.byte 105
+.byte 116
+.byte 115
+.byte 32
+.byte 97
+.byte 102
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 92
+.byte 120
+.byte 0
+@S299:
+.byte 37
+.byte 111
+.byte 0
+@S300:
+.byte 95
+.byte 95
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 111
+.byte 102
+.byte 95
+.byte 95
+.byte 0
+@S301:
+.byte 95
+.byte 95
+.byte 97
+.byte 115
+.byte 109
+.byte 0
+@S302:
+.byte 95
+.byte 95
+.byte 98
+.byte 117
+.byte 105
+.byte 108
+.byte 116
+.byte 105
+.byte 110
+.byte 95
+.byte 118
+.byte 97
+.byte 95
+.byte 115
+.byte 116
+.byte 97
+.byte 114
+.byte 116
+.byte 0
+@S303:
+.byte 95
+.byte 95
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 95
+.byte 95
+.byte 0
+@S304:
+.byte 95
+.byte 95
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 95
+.byte 97
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 0
+@S305:
+.byte 97
+.byte 117
+.byte 116
+.byte 111
+.byte 0
+@S306:
+.byte 98
+.byte 114
+.byte 101
+.byte 97
+.byte 107
+.byte 0
+@S307:
+.byte 99
+.byte 97
+.byte 115
+.byte 101
+.byte 0
+@S308:
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 0
+@S309:
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 0
+@S310:
+.byte 99
+.byte 111
+.byte 110
+.byte 116
+.byte 105
+.byte 110
+.byte 117
+.byte 101
+.byte 0
+@S311:
+.byte 100
+.byte 101
+.byte 102
+.byte 97
+.byte 117
+.byte 108
+.byte 116
+.byte 0
+@S312:
+.byte 100
+.byte 111
+.byte 0
+@S313:
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 0
+@S314:
+.byte 101
+.byte 110
+.byte 117
+.byte 109
+.byte 0
+@S315:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 0
+@S316:
+.byte 102
+.byte 111
+.byte 114
+.byte 0
+@S317:
+.byte 103
+.byte 111
+.byte 116
+.byte 111
+.byte 0
+@S318:
+.byte 105
+.byte 102
+.byte 0
+@S319:
+.byte 105
+.byte 110
+.byte 116
+.byte 0
+@S320:
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 0
+@S321:
+.byte 114
+.byte 101
+.byte 103
+.byte 105
+.byte 115
+.byte 116
+.byte 101
+.byte 114
+.byte 0
+@S322:
+.byte 114
+.byte 101
+.byte 116
+.byte 117
+.byte 114
+.byte 110
+.byte 0
+@S323:
+.byte 115
+.byte 104
+.byte 111
+.byte 114
+.byte 116
+.byte 0
+@S324:
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 101
+.byte 100
+.byte 0
+@S325:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 0
+@S326:
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 0
+@S327:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 0
+@S328:
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 0
+@S329:
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 0
+@S330:
+.byte 117
+.byte 110
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S331:
+.byte 117
+.byte 110
+.byte 115
+.byte 105
+.byte 103
+.byte 110
+.byte 101
+.byte 100
+.byte 0
+@S332:
+.byte 118
+.byte 111
+.byte 105
+.byte 100
+.byte 0
+@S333:
+.byte 118
+.byte 111
+.byte 108
+.byte 97
+.byte 116
+.byte 105
+.byte 108
+.byte 101
+.byte 0
+@S334:
+.byte 119
+.byte 104
+.byte 105
+.byte 108
+.byte 101
+.byte 0
@@ -0,0 +1,550 @@
+.extern fgets
+.extern atom_n
+.extern arena_destroy
+.extern getenv
+.extern atoi
+.extern atom
+.extern exit
+.bss
+.align 8
+location_table:
+.res 129152
+.extern stderr
+.extern rewind
+.extern realloc
+.extern snprintf
+.extern strpbrk
+.extern fseek
+.extern atom_tag
+.extern sscanf
+.extern fputc
+.extern vsscanf
+.extern atom_set_tag
+.extern fwrite
+.extern read_stream
+.extern strspn
+# ==== start of definition of function `location_pop_scope' ====
+.text
+location_pop_scope:
+.global location_pop_scope
+addsp 0;         
+ldiqw 8;
+ldidw 1009;
+dw2qw;
+mulqw;
+ldidw 0;
+ldiqw location_table;
+ldiqw curr_scope;
+lddw;
+dw2qw;
+ldiqw 8072;
+mulqw;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldiqw location_arena;
+ldiqw curr_scope;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw arena_reset;
+call 8;
+pop;
+pop;
+ldiqw curr_scope;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+.extern strtoll
+.data
+.align 4
+curr_scope:
+.align 4
+.dword 0
+.extern fclose
+.extern strstr
+.extern calloc
+.extern memset
+.extern file_exists
+# ==== start of definition of function `location_push_scope' ====
+.text
+location_push_scope:
+.global location_push_scope
+addsp 0;         
+ldiqw curr_scope;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+.extern strtoul
+.extern fprintf
+.extern read_file
+.extern printf
+.extern sprintf
+.extern strcat
+.extern round_up
+# ==== start of definition of function `location_init' ====
+.text
+location_init:
+.global location_init
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L1:
+ldbp 4;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L3;
+ldidw 0;
+ldidw 128;
+ldiqw arena_new;
+call 8;
+ldiqw location_arena;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L2:
+incldw 4;
+jmp @L1;
+@L3:
+ldidw 0;
+ret;
+.extern strchr
+.extern arena_alloc
+.extern stdout
+.extern ilog2
+.extern strcmp
+.bss
+.align 8
+location_arena:
+.res 128
+.extern strtok
+.extern strtol
+.extern stdin
+.extern ftell
+.extern strcpy
+# ==== start of definition of function `location_new' ====
+.text
+location_new:
+.global location_new
+addsp 12;        
+# param:`id', offset:-24
+# param:`offset', offset:-28
+# var: h, offset: 4
+# var: np, offset: 8
+ldbp -24;
+ldqw;
+ldiqw atom_hash;
+call 8;
+pop;
+ldidw 1009;
+umoddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw alloc_location;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldiqw location_table;
+ldiqw curr_scope;
+lddw;
+dw2qw;
+ldiqw 8072;
+mulqw;
+addqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw location_table;
+ldiqw curr_scope;
+lddw;
+dw2qw;
+ldiqw 8072;
+mulqw;
+addqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern strtoull
+.extern strlen
+.extern memchr
+.extern vfprintf
+.extern hash
+.extern bsearch
+.extern qsort
+.extern memcmp
+.extern vsnprintf
+.extern vsprintf
+.extern memcpy
+.extern fopen
+.extern be_atoi
+# ==== start of definition of function `alloc_location' ====
+.text
+alloc_location:
+addsp 12;        
+# var: p, offset: 8
+ldiqw 24;
+pop;
+ldiqw location_arena;
+ldiqw curr_scope;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L4;
+ldiqw @S0;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldiqw @S1;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L4:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern strncat
+.extern fileno
+.extern hash2
+.extern memmove
+.extern replace_extension
+.extern strdup
+.extern arena_new
+.extern strncmp
+.extern arena_set_nom_siz
+# ==== start of definition of function `location_get_offset' ====
+.text
+location_get_offset:
+.global location_get_offset
+addsp 20;        
+# param:`id', offset:-24
+# var: n, offset: 4
+# var: h, offset: 8
+# var: np, offset: 16
+ldbp -24;
+ldqw;
+ldiqw atom_hash;
+call 8;
+pop;
+ldidw 1009;
+umoddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw curr_scope;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L5:
+ldbp 4;
+lddw;
+ldidw 0;
+sgetdw;
+jmpf @L7;
+ldiqw location_table;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 8072;
+mulqw;
+addqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L8:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L10;
+ldbp -24;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+eqqw;
+jmpf @L11;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ret;
+@L11:
+@L9:
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L8;
+@L10:
+@L6:
+decldw 4;
+jmp @L5;
+@L7:
+@L12:
+ldidw 0;
+notdw;
+jmpf @L15;
+ldidw 65;
+ldiqw @S2;
+ldiqw @S3;
+ldiqw @S4;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L15:
+@L13:
+ldidw 0;
+jmpf @L14;
+jmp @L12;
+@L14:
+ldidw 0;
+ret;
+.extern atom_hash
+.extern strncpy
+.extern strnlen
+.extern arena_reset
+.extern fread
+.extern strrchr
+.extern ferror
+.extern random
+.extern free
+.extern malloc
+.extern srandom
+.extern fgetc
+.data
+@S0:
+.byte 79
+.byte 117
+.byte 116
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 109
+.byte 101
+.byte 109
+.byte 111
+.byte 114
+.byte 121
+.byte 0
+@S1:
+.byte 10
+.byte 0
+@S2:
+.byte 108
+.byte 111
+.byte 99
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 95
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 111
+.byte 102
+.byte 102
+.byte 115
+.byte 101
+.byte 116
+.byte 0
+@S3:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 108
+.byte 111
+.byte 99
+.byte 46
+.byte 99
+.byte 0
+@S4:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
@@ -0,0 +1,1054 @@
+/*
+ * Loop optimizations (done at -O3, after inlining).
+ *
+ * The natural loops of a function are found from its back edges (edges whose
+ * head dominates their tail); the loops of back edges with the same header are
+ * merged into one. Then, in this order:
+ *  - innermost loops with a small constant trip count are fully unrolled;
+ *  - computations that are invariant in a loop are moved to a preheader, a new
+ *    block put in front of the header through which the loop is entered;
+ *  - sums base+iv*size, where iv is a basic induction variable of the loop (one
+ *    that is only changed by adding a constant to it), are replaced by a new
+ *    variable set in the preheader and incremented right after iv is.
+ * The code motion is done twice so that the invariants moved out of an inner
+ * loop can be moved out of the enclosing one (or strength reduced there).
+ *
+ * Only "tracked" variables are considered: automatic, scalar, non-volatile
+ * variables whose address is never taken. These can only be changed by the
+ * quads that name them. Every transformation emits a new version of the
+ * function (see replace_function_body()); the code that becomes dead (e.g.
+ * the multiplications replaced by an add) is deleted later by the optimizer.
+ */
+#include "loop.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "util/util.h"
+#include "ic.h"
+#include "expr.h"
+#include "decl.h"
+#include "dflow.h"
+#include "util/bset.h"
+#include "luxcc.h"
+
+#define LOOP_MAX_TRIPS      8   /* max trip count of a loop to unroll */
+#define LOOP_MAX_UNROLLED   96  /* max number of quads of the unrolled loop */
+#define LOOP_MOTION_ROUNDS  2
+
+typedef struct Loop Loop;
+typedef struct IndVar IndVar;
+
+static struct Loop {
+    unsigned header;    /* cfg node */
+    BSet *body;         /* the blocks of the loop (numbered from bb_i) */
+    BSet *defs;         /* the variables assigned in the loop */
+    int nblocks;
+    int parent;         /* innermost enclosing loop, or -1 */
+    int has_inner;
+    unsigned preheader; /* label of the preheader, or 0 */
+    int trips;          /* unroll the loop this number of times, or 0 */
+    unsigned end;       /* last quad of an unrolled loop */
+} *loops;
+static int nloops;
+
+/*
+ * A variable d = base + iv*scale, maintained by adding step*scale to d after
+ * every update of iv.
+ */
+static struct IndVar {
+    int loop;
+    int iv;             /* the basic induction variable */
+    unsigned upd;       /* the (only) quad that updates iv in the loop */
+    unsigned ext, mul;  /* quads that sign-extend iv (or 0) and scale it */
+    unsigned base;
+    Declaration *type;
+    long long scale, step;
+    unsigned d;         /* the new variable */
+} *ivs;
+static int nivs, ivs_max;
+static unsigned lp_ivar_counter; /* to name the new variables */
+
+static unsigned lp_first, lp_last, lp_entry_bb;
+static unsigned *lp_blk;    /* quad -> block (numbered from bb_i) */
+static int *lp_inner;       /* block -> innermost loop that contains it, or -1 */
+static int *lp_hoist;       /* quad -> loop to whose preheader the quad is moved, or -1 */
+static int *lp_ivar;        /* quad -> IndVar that replaces the quad, or -1 */
+static char *lp_needed;     /* quad -> moved quad used by another moved quad or an IndVar */
+
+/* variables, numbered through lp_map */
+static int lp_nvars;
+static int *var_ndefs;      /* var -> number of quads that assign it */
+static unsigned *var_def;   /* var -> the last quad that assigns it */
+static char *var_tracked;
+
+#define lp_var(a)       (lp_map[address_nid(a)])
+#define in_loop(i, L)   (bset_member(loops[L].body, (int)lp_blk[(i)-lp_first]))
+#define is_var(a)       ((a) && (address(a).kind==IdKind || address(a).kind==TempKind))
+
+static int *lp_map, *lp_map_stamp;       /* nid -> variable or address (valid if the stamp is the current one) */
+static int lp_map_curr, lp_map_max;
+
+/* start a new, empty, nid mapping */
+static void new_lp_map(void)
+{
+    if (nid_counter > lp_map_max) {
+        int n;
+
+        n = lp_map_max;
+        lp_map_max = nid_counter*2;
+        lp_map = realloc(lp_map, lp_map_max*sizeof(int));
+        lp_map_stamp = realloc(lp_map_stamp, lp_map_max*sizeof(int));
+        if (lp_map==NULL || lp_map_stamp==NULL)
+            TERMINATE("error: new_lp_map(): out of memory");
+        memset(lp_map_stamp+n, 0, (lp_map_max-n)*sizeof(int));
+    }
+    ++lp_map_curr;
+}
+
+static void free_lp_map(void)
+{
+    free(lp_map);
+    free(lp_map_stamp);
+    lp_map = lp_map_stamp = NULL;
+    lp_map_max = 0;
+}
+
+/* return the address assigned by quad 'i', or 0 */
+static unsigned quad_def(unsigned i)
+{
+    switch (instruction(i).op) {
+    case OpAdd: case OpSub: case OpMul: case OpDiv:
+    case OpRem: case OpSHL: case OpSHR: case OpAnd:
+    case OpOr: case OpXor: case OpEQ: case OpNEQ:
+    case OpLT: case OpLET: case OpGT: case OpGET:
+    case OpNeg: case OpCmpl: case OpNot: case OpCh:
+    case OpUCh: case OpSh: case OpUSh: case OpLLSX:
+    case OpLLZX: case OpAddrOf: case OpInd: case OpAsn:
+    case OpCall: case OpIndCall:
+        return instruction(i).tar;
+    default:
+        return 0;
+    }
+}
+
+/* does 'which' (0 = tar, 1 = arg1, 2 = arg2) hold a label in a quad with operator 'op'? */
+static int is_label_operand(OpKind op, int which)
+{
+    switch (op) {
+    case OpLab:
+    case OpJmp:
+        return which == 0;
+    case OpCBr:
+        return which != 1;
+    case OpCase:
+        return which == 1;
+    default:
+        return FALSE;
+    }
+}
+
+static unsigned new_label_addr(long long val)
+{
+    unsigned L;
+
+    L = new_address(IConstKind);
+    address(L).cont.val = val;
+    return L;
+}
+
+static unsigned copy_const(unsigned a)
+{
+    unsigned na;
+
+    na = new_address(address(a).kind);
+    address(na).cont = address(a).cont;
+    return na;
+}
+
+static int lp_is_tracked(unsigned a)
+{
+    Token cat;
+    ExecNode *e;
+    TypeExp *tq;
+
+    if (address(a).kind == TempKind)
+        return TRUE;
+    e = address(a).cont.var.e;
+    if (e->attr.var.duration!=DURATION_AUTO || is_atv(address_nid(a)))
+        return FALSE;
+    if (!is_integer(cat=get_type_category(&e->type)) && cat!=TOK_STAR)
+        return FALSE;
+    tq = (cat == TOK_STAR) ? e->type.idl->attr.el : get_type_qual(e->type.decl_specs);
+    return (tq==NULL || tq->op!=TOK_VOLATILE && tq->op!=TOK_CONST_VOLATILE);
+}
+
+static void emit_copy(unsigned i)
+{
+    emit_i(instruction(i).op, instruction(i).type, instruction(i).tar,
+    instruction(i).arg1, instruction(i).arg2);
+    if (verbose_asm)
+        C_source[ic_instructions_counter-1] = C_source[i];
+}
+
+static int loop_contains(int outer, int L)
+{
+    for (; L != -1; L = loops[L].parent)
+        if (L == outer)
+            return TRUE;
+    return FALSE;
+}
+
+/* number the variables of the function and find their definitions */
+static void loop_number_vars(void)
+{
+    unsigned i, a[3];
+    int k, v;
+
+    new_lp_map();
+    lp_nvars = 0;
+    for (i = lp_first; i <= lp_last; i++) {
+        a[0] = instruction(i).tar, a[1] = instruction(i).arg1, a[2] = instruction(i).arg2;
+        for (k = 0; k < 3; k++) {
+            if (!is_var(a[k]) || lp_map_stamp[address_nid(a[k])]==lp_map_curr)
+                continue;
+            lp_map_stamp[address_nid(a[k])] = lp_map_curr;
+            lp_map[address_nid(a[k])] = lp_nvars++;
+        }
+    }
+    var_ndefs = calloc(lp_nvars, sizeof(int));
+    var_def = calloc(lp_nvars, sizeof(unsigned));
+    var_tracked = malloc(lp_nvars);
+    memset(var_tracked, -1, lp_nvars);
+    for (i = lp_first; i <= lp_last; i++) {
+        a[0] = instruction(i).tar, a[1] = instruction(i).arg1, a[2] = instruction(i).arg2;
+        if ((instruction(i).op==OpAddrOf || instruction(i).op==OpCall) && address(a[1]).kind==IdKind)
+            var_tracked[lp_var(a[1])] = FALSE; /* (memset/memcpy have no type) */
+        for (k = 0; k < 3; k++)
+            if (is_var(a[k]) && var_tracked[v=lp_var(a[k])]==-1)
+                var_tracked[v] = (char)lp_is_tracked(a[k]);
+        if (is_var(a[0]) && quad_def(i)) {
+            ++var_ndefs[v=lp_var(a[0])];
+            var_def[v] = i;
+        }
+    }
+}
+
+/* find the natural loops of function 'fn'; return their number */
+static int loop_find(unsigned fn)
+{
+    int *hdr_loop, L, M;
+    char *reached;
+    unsigned b, i, nb, *stack, top;
+
+    lp_entry_bb = cg_node(fn).bb_i;
+    nb = cg_node(fn).bb_f-lp_entry_bb+1;
+    lp_first = cfg_node(lp_entry_bb).leader;
+    lp_last = cfg_node(cg_node(fn).bb_f).last;
+    lp_blk = malloc((lp_last-lp_first+1)*sizeof(unsigned));
+    for (b = 0; b < nb; b++)
+        for (i = cfg_node(b+lp_entry_bb).leader; i <= cfg_node(b+lp_entry_bb).last; i++)
+            lp_blk[i-lp_first] = b;
+
+    /* unreachable blocks keep Dom(n) = N, don't let them make back edges */
+    stack = malloc(nb*sizeof(unsigned));
+    reached = calloc(nb, 1);
+    reached[0] = TRUE;
+    stack[0] = 0, top = 1;
+    while (top) {
+        GraphEdge *out;
+
+        out = &cfg_node(stack[--top]+lp_entry_bb).out;
+        for (i = 0; i < out->n; i++) {
+            if (!reached[b=out->edges[i]-lp_entry_bb]) {
+                reached[b] = TRUE;
+                stack[top++] = b;
+            }
+        }
+    }
+
+    dflow_Dom(fn);
+    loops = NULL;
+    nloops = 0;
+    hdr_loop = malloc(nb*sizeof(int));
+    memset(hdr_loop, -1, nb*sizeof(int));
+    for (b = 0; b < nb; b++) {
+        GraphEdge *out;
+
+        if (!reached[b])
+            continue;
+        out = &cfg_node(b+lp_entry_bb).out;
+        for (i = 0; i < out->n; i++) {
+            unsigned h;
+            Loop *lp;
+
+            h = out->edges[i]-lp_entry_bb;
+            if (!bset_member(cfg_node(b+lp_entry_bb).Dom, (int)h))
+                continue;
+            if ((L=hdr_loop[h]) == -1) {
+                loops = realloc(loops, (nloops+1)*sizeof(Loop));
+                L = hdr_loop[h] = nloops++;
+                lp = &loops[L];
+                lp->header = h+lp_entry_bb;
+                lp->body = bset_new((int)nb);
+                bset_insert(lp->body, (int)h);
+                lp->parent = -1;
+                lp->has_inner = FALSE;
+                lp->defs = NULL;
+                lp->preheader = 0;
+                lp->trips = 0;
+            }
+            lp = &loops[L];
+            /* add the blocks that reach the tail of the back edge without going through the header */
+            if (bset_member(lp->body, (int)b))
+                continue;
+            bset_insert(lp->body, (int)b);
+            stack[0] = b, top = 1;
+            while (top) {
+                unsigned k;
+                GraphEdge *in;
+
+                in = &cfg_node(stack[--top]+lp_entry_bb).in;
+                for (k = 0; k < in->n; k++) {
+                    unsigned p;
+
+                    p = in->edges[k]-lp_entry_bb;
+                    if (reached[p] && !bset_member(lp->body, (int)p)) {
+                        bset_insert(lp->body, (int)p);
+                        stack[top++] = p;
+                    }
+                }
+            }
+        }
+    }
+    free(stack);
+    free(reached);
+    free(hdr_loop);
+
+    /* two natural loops with different headers are either disjoint or nested */
+    lp_inner = malloc(nb*sizeof(int));
+    memset(lp_inner, -1, nb*sizeof(int));
+    for (L = 0; L < nloops; L++)
+        loops[L].nblocks = bset_card(loops[L].body);
+    for (L = 0; L < nloops; L++) {
+        for (M = 0; M < nloops; M++) {
+            if (loops[M].nblocks > loops[L].nblocks
+            && bset_member(loops[M].body, (int)(loops[L].header-lp_entry_bb))
+            && (loops[L].parent==-1 || loops[M].nblocks<loops[loops[L].parent].nblocks))
+                loops[L].parent = M;
+        }
+        if (loops[L].parent != -1)
+            loops[loops[L].parent].has_inner = TRUE;
+        for (b = 0; b < nb; b++)
+            if (bset_member(loops[L].body, (int)b)
+            && (lp_inner[b]==-1 || loops[lp_inner[b]].nblocks>loops[L].nblocks))
+                lp_inner[b] = L;
+    }
+    if (nloops == 0)
+        return 0;
+
+    loop_number_vars();
+    for (L = 0; L < nloops; L++) {
+        loops[L].defs = bset_new(lp_nvars);
+        for (i = lp_first; i <= lp_last; i++)
+            if (in_loop(i, L) && is_var(quad_def(i)))
+                bset_insert(loops[L].defs, lp_var(instruction(i).tar));
+    }
+    return nloops;
+}
+
+static void loop_free(unsigned fn)
+{
+    int L;
+
+    for (L = 0; L < nloops; L++) {
+        bset_free(loops[L].body);
+        if (loops[L].defs != NULL)
+            bset_free(loops[L].defs);
+    }
+    free(loops);
+    if (nloops) {
+        free(var_ndefs);
+        free(var_def);
+        free(var_tracked);
+    }
+    nloops = lp_nvars = 0;
+    free(lp_blk);
+    free(lp_inner);
+    dflow_free_Dom(fn);
+}
+
+/* can the loop get a preheader? (the ENTRY label must stay right after the first jump) */
+#define can_have_preheader(L)   (loops[L].header!=lp_entry_bb+1 && instruction(cfg_node(loops[L].header).leader).op==OpLab)
+
+/* is the value of 'a' the same in every iteration of loop L? */
+static int loop_invariant(unsigned a, int L)
+{
+    int v;
+    unsigned d;
+
+    if (const_addr(a))
+        return TRUE;
+    v = lp_var(a);
+    if (address(a).kind == TempKind) {
+        if (var_ndefs[v] != 1)
+            return FALSE;
+        d = var_def[v];
+        return (!in_loop(d, L) || lp_hoist[d-lp_first]!=-1 && loop_contains(lp_hoist[d-lp_first], L));
+    }
+    return (var_tracked[v] && !bset_member(loops[L].defs, v));
+}
+
+static long long loop_truncate(long long v, unsigned siz, int is_signed)
+{
+    if (siz >= sizeof(long long))
+        return v;
+    v = (long long)((unsigned long long)v & ((1ULL<<siz*8)-1));
+    if (is_signed && v&(1LL<<(siz*8-1)))
+        v = (long long)((unsigned long long)v | ~((1ULL<<siz*8)-1));
+    return v;
+}
+
+/*
+ * If 'a' is a basic induction variable of loop L, return the quad that
+ * updates it and set *step; otherwise return 0. The update must be the
+ * only assignment of 'a' in the loop and have the shape of 'a++':
+ *      t1 = a          (optional)
+ *      t2 = t1 + c     (or t1 - c)
+ *      a = t2
+ */
+static unsigned loop_basic_iv(unsigned a, int L, long long *step)
+{
+    unsigned i, u, t, y, siz;
+    int v, n;
+    Quad *q;
+
+    if (address(a).kind!=IdKind || !var_tracked[v=lp_var(a)] || !bset_member(loops[L].defs, v))
+        return 0;
+    for (u = 0, n = 0, i = lp_first; i <= lp_last; i++) {
+        if (in_loop(i, L) && is_var(quad_def(i)) && address_nid(instruction(i).tar)==address_nid(a)) {
+            u = i;
+            ++n;
+        }
+    }
+    if (n!=1 || instruction(u).op!=OpAsn || address(t=instruction(u).arg1).kind!=TempKind
+    || var_ndefs[lp_var(t)]!=1)
+        return 0;
+    q = &instruction(var_def[lp_var(t)]);
+    siz = get_sizeof(&address(a).cont.var.e->type);
+    if (lp_blk[var_def[lp_var(t)]-lp_first]!=lp_blk[u-lp_first] || get_sizeof(q->type)!=siz)
+        return 0;
+    if (q->op==OpAdd && address(q->arg1).kind==IConstKind) {
+        *step = address(q->arg1).cont.val;
+        y = q->arg2;
+    } else if ((q->op==OpAdd || q->op==OpSub) && address(q->arg2).kind==IConstKind) {
+        *step = (q->op == OpAdd) ? address(q->arg2).cont.val : -address(q->arg2).cont.val;
+        y = q->arg1;
+    } else {
+        return 0;
+    }
+    *step = loop_truncate(*step, siz, is_signed_int(get_type_category(&address(a).cont.var.e->type)));
+    if (address(y).kind == TempKind) {
+        unsigned yd;
+
+        if (var_ndefs[lp_var(y)] != 1)
+            return 0;
+        yd = var_def[lp_var(y)];
+        if (instruction(yd).op!=OpAsn || !is_var(instruction(yd).arg1)
+        || address_nid(instruction(yd).arg1)!=address_nid(a)
+        || lp_blk[yd-lp_first]!=lp_blk[u-lp_first] || yd>u)
+            return 0;
+    } else if (address(y).kind!=IdKind || address_nid(y)!=address_nid(a)) {
+        return 0;
+    }
+    return u;
+}
+
+// ---------------------------------------------------------------------------
+// Unrolling
+// ---------------------------------------------------------------------------
+
+/* evaluate the relational quad 'i' (with the induction variable as operand 'ivop') */
+static int loop_compare(unsigned i, int ivop, long long val, long long c)
+{
+    long flags;
+    long long x, y;
+    unsigned long long ux, uy;
+
+    flags = (long)instruction(i).type;
+    x = (ivop == 1) ? val : c;
+    y = (ivop == 1) ? c : val;
+    if (!(flags & IC_WIDE)) {
+        if (flags & IC_SIGNED)
+            x = (int)x, y = (int)y;
+        else
+            x = (unsigned)x, y = (unsigned)y;
+    }
+    ux = (unsigned long long)x;
+    uy = (unsigned long long)y;
+    switch (instruction(i).op) {
+    case OpEQ:  return x == y;
+    case OpNEQ: return x != y;
+    case OpLT:  return (flags & IC_SIGNED) ? x<y  : ux<uy;
+    case OpLET: return (flags & IC_SIGNED) ? x<=y : ux<=uy;
+    case OpGT:  return (flags & IC_SIGNED) ? x>y  : ux>uy;
+    case OpGET: return (flags & IC_SIGNED) ? x>=y : ux>=uy;
+    default:    return -1;
+    }
+}
+
+/*
+ * Return the number of iterations of loop L if it can be unrolled, 0 otherwise.
+ * The loop must occupy a contiguous range of quads starting with the header and
+ * ending with the only exit:
+ *      L1:
+ *          ...
+ *          i = t2      (the update of the induction variable)
+ *          t3 = i < c
+ *          cbr L1, t3, L2
+ * and must be entered from a block that sets 'i' to a constant.
+ */
+static int loop_trip_count(int L)
+{
+    Loop *lp;
+    unsigned h, B, P, r0, r1, i, cd, u, iv;
+    int nb, ivop, n, cont;
+    long long step, val, c;
+    char *in_range;
+    ExecNode *e;
+
+    lp = &loops[L];
+    h = lp->header;
+    if (lp->has_inner || !can_have_preheader(L) || cfg_node(h).in.n!=2)
+        return 0;
+    if (bset_member(lp->body, (int)(cfg_node(h).in.edges[0]-lp_entry_bb)))
+        B = cfg_node(h).in.edges[0], P = cfg_node(h).in.edges[1];
+    else
+        B = cfg_node(h).in.edges[1], P = cfg_node(h).in.edges[0];
+    if (bset_member(lp->body, (int)(P-lp_entry_bb)) || !bset_member(lp->body, (int)(B-lp_entry_bb)))
+        return 0;
+
+    /* a contiguous range with a single exit */
+    r0 = cfg_node(h).leader;
+    r1 = cfg_node(B).last;
+    if (r1<r0 || instruction(r1).op!=OpCBr)
+        return 0;
+    for (nb = 0, i = r0; i <= r1; i++) {
+        unsigned b, k;
+
+        if (!in_loop(i, L))
+            return 0;
+        b = lp_blk[i-lp_first]+lp_entry_bb;
+        if (i != cfg_node(b).leader)
+            continue;
+        ++nb;
+        for (k = 0; k < cfg_node(b).out.n; k++)
+            if (!bset_member(lp->body, (int)(cfg_node(b).out.edges[k]-lp_entry_bb)) && b!=B)
+                return 0;
+    }
+    if (nb != lp->nblocks)
+        return 0;
+
+    /* the exit condition */
+    if (address(instruction(r1).arg1).kind!=TempKind || var_ndefs[lp_var(instruction(r1).arg1)]!=1)
+        return 0;
+    cd = var_def[lp_var(instruction(r1).arg1)];
+    if (cd<r0 || cd>r1 || instruction(cd).op<OpEQ || instruction(cd).op>OpGET)
+        return 0;
+    if (address(instruction(cd).arg2).kind == IConstKind)
+        ivop = 1, iv = instruction(cd).arg1, c = address(instruction(cd).arg2).cont.val;
+    else if (address(instruction(cd).arg1).kind == IConstKind)
+        ivop = 2, iv = instruction(cd).arg2, c = address(instruction(cd).arg1).cont.val;
+    else
+        return 0;
+    if ((u=loop_basic_iv(iv, L, &step))==0 || lp_blk[u-lp_first]!=B-lp_entry_bb || u>cd)
+        return 0;
+    cont = address(instruction(r1).tar).cont.val == address(instruction(r0).tar).cont.val;
+
+    /* the initial value */
+    for (i = cfg_node(P).last; ; i--) {
+        if (is_var(quad_def(i)) && address_nid(instruction(i).tar)==address_nid(iv))
+            break;
+        if (i == cfg_node(P).leader)
+            return 0;
+    }
+    if (instruction(i).op!=OpAsn || address(instruction(i).arg1).kind!=IConstKind)
+        return 0;
+    e = address(iv).cont.var.e;
+    val = loop_truncate(address(instruction(i).arg1).cont.val, get_sizeof(&e->type),
+    is_signed_int(get_type_category(&e->type)));
+    for (n = 1; ; n++) {
+        int r;
+
+        val = loop_truncate((long long)((unsigned long long)val+(unsigned long long)step),
+        get_sizeof(&e->type), is_signed_int(get_type_category(&e->type)));
+        if ((r=loop_compare(cd, ivop, val, c)) == -1)
+            return 0;
+        if (r != cont)
+            break;
+        if (n == LOOP_MAX_TRIPS)
+            return 0;
+    }
+    if (n*(int)(r1-r0+1) > LOOP_MAX_UNROLLED)
+        return 0;
+
+    /* the temporaries of the loop must not be used after it */
+    in_range = calloc(lp_nvars, 1);
+    for (i = r0; i <= r1; i++)
+        if (is_var(quad_def(i)) && address(instruction(i).tar).kind==TempKind)
+            in_range[lp_var(instruction(i).tar)] = TRUE;
+    for (i = lp_first; i <= lp_last; i++) {
+        if (i>=r0 && i<=r1)
+            continue;
+        if (is_var(instruction(i).tar) && in_range[lp_var(instruction(i).tar)]
+        || is_var(instruction(i).arg1) && in_range[lp_var(instruction(i).arg1)]
+        || is_var(instruction(i).arg2) && in_range[lp_var(instruction(i).arg2)])
+            break;
+    }
+    free(in_range);
+    if (i <= lp_last)
+        return 0;
+    lp->end = r1;
+    return n;
+}
+
+/* emit 'trips' copies of the loop that starts at quad r0; return the number of labels used */
+static unsigned loop_unroll(int L, unsigned r0, unsigned nlab)
+{
+    unsigned r1, i, k, exit_lab, *lab_map;
+    int c, trips;
+
+    trips = loops[L].trips;
+    r1 = loops[L].end;
+    if (address(instruction(r1).tar).cont.val == address(instruction(r0).tar).cont.val)
+        exit_lab = instruction(r1).arg2;
+    else
+        exit_lab = instruction(r1).tar;
+
+    lab_map = malloc(nlab*sizeof(unsigned));
+    for (i = 0; i < nlab; i++)
+        lab_map[i] = i;
+    for (c = 0; c < trips; c++) {
+        if (c > 0) {
+            /* new labels and temporaries for the copy */
+            for (i = r0; i <= r1; i++)
+                if (instruction(i).op == OpLab)
+                    lab_map[address(instruction(i).tar).cont.val] = nlab++;
+            new_lp_map();
+            for (i = r0; i <= r1; i++) {
+                if (is_var(quad_def(i)) && address(instruction(i).tar).kind==TempKind
+                && lp_map_stamp[address_nid(instruction(i).tar)]!=lp_map_curr) {
+                    lp_map_stamp[address_nid(instruction(i).tar)] = lp_map_curr;
+                    lp_map[address_nid(instruction(i).tar)] = new_temp_addr();
+                }
+            }
+        }
+        for (i = r0; i < r1; i++) {
+            unsigned a[3];
+            Quad *q;
+
+            q = &instruction(i);
+            a[0] = q->tar, a[1] = q->arg1, a[2] = q->arg2;
+            for (k = 0; c>0 && k<3; k++) {
+                if (is_label_operand(q->op, k)) {
+                    if (lab_map[address(a[k]).cont.val] != address(a[k]).cont.val)
+                        a[k] = new_label_addr(lab_map[address(a[k]).cont.val]);
+                } else if (a[k] && address(a[k]).kind==TempKind
+                && lp_map_stamp[address_nid(a[k])]==lp_map_curr) {
+                    a[k] = lp_map[address_nid(a[k])];
+                }
+            }
+            emit_i(q->op, q->type, a[0], a[1], a[2]);
+            if (verbose_asm)
+                C_source[ic_instructions_counter-1] = C_source[i];
+        }
+        /* the last copy leaves the loop; the others fall through into the next one */
+        if (c == trips-1)
+            emit_i(OpJmp, NULL, new_label_addr(address(exit_lab).cont.val), 0, 0);
+    }
+    free(lab_map);
+    return nlab;
+}
+
+/* unroll the loops of 'fn' with a small trip count; return TRUE if any was */
+static int loop_unroll_all(unsigned fn)
+{
+    int L, *start, done;
+    unsigned i, nlab, new_first;
+
+    if (loop_find(fn) == 0) {
+        loop_free(fn);
+        return FALSE;
+    }
+    start = malloc((lp_last-lp_first+1)*sizeof(int));
+    memset(start, -1, (lp_last-lp_first+1)*sizeof(int));
+    for (done = FALSE, L = 0; L < nloops; L++) {
+        if ((loops[L].trips=loop_trip_count(L)) != 0) {
+            start[cfg_node(loops[L].header).leader-lp_first] = L;
+            done = TRUE;
+        }
+    }
+    if (done) {
+        nlab = count_labels(lp_first, lp_last);
+        new_first = ic_instructions_counter;
+        for (i = lp_first; i <= lp_last; i++) {
+            if ((L=start[i-lp_first]) != -1) {
+                nlab = loop_unroll(L, i, nlab);
+                i = loops[L].end;
+                continue;
+            }
+            emit_copy(i);
+        }
+        loop_free(fn);
+        replace_function_body(fn, new_first, nlab);
+    } else {
+        loop_free(fn);
+    }
+    free(start);
+    return done;
+}
+
+// ---------------------------------------------------------------------------
+// Code motion and strength reduction
+// ---------------------------------------------------------------------------
+
+/* operators whose quads are worth moving only as part of a bigger computation */
+static int is_cheap(OpKind op)
+{
+    switch (op) {
+    case OpAsn: case OpAddrOf: case OpCh: case OpUCh:
+    case OpSh: case OpUSh: case OpLLSX: case OpLLZX:
+    case OpNeg: case OpCmpl: case OpNot: case OpEQ:
+    case OpNEQ: case OpLT: case OpLET: case OpGT:
+    case OpGET:
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+/* return the loop to whose preheader quad 'i' can be moved, or -1 */
+static int loop_hoist_target(unsigned i)
+{
+    int L, target;
+    Quad *q;
+
+    q = &instruction(i);
+    switch (q->op) {
+    case OpAdd: case OpSub: case OpMul: case OpSHL:
+    case OpSHR: case OpAnd: case OpOr: case OpXor:
+    case OpEQ: case OpNEQ: case OpLT: case OpLET:
+    case OpGT: case OpGET:
+        if (const_addr(q->arg1) && const_addr(q->arg2))
+            return -1;
+        break;
+    case OpNeg: case OpCmpl: case OpNot: case OpCh:
+    case OpUCh: case OpSh: case OpUSh: case OpLLSX:
+    case OpLLZX: case OpAsn:
+        if (const_addr(q->arg1))
+            return -1;
+        break;
+    case OpAddrOf:
+        break;
+    default:
+        return -1;
+    }
+    if (address(q->tar).kind!=TempKind || var_ndefs[lp_var(q->tar)]!=1)
+        return -1;
+
+    /* go outwards while the quad is still invariant */
+    target = -1;
+    for (L = lp_inner[lp_blk[i-lp_first]]; L!=-1 && can_have_preheader(L); L = loops[L].parent) {
+        if (q->op != OpAddrOf) {
+            if (!loop_invariant(q->arg1, L) || q->arg2 && !loop_invariant(q->arg2, L))
+                break;
+        }
+        target = L;
+    }
+    return target;
+}
+
+/* do the invariants 'a1' and 'a2' have the same value? */
+static int same_base(unsigned a1, unsigned a2)
+{
+    unsigned d1, d2;
+
+    if (a1 == a2)
+        return TRUE;
+    if (const_addr(a1) || const_addr(a2))
+        return (address(a1).kind==IConstKind && address(a2).kind==IConstKind
+        && address(a1).cont.val==address(a2).cont.val);
+    if (address(a1).kind!=TempKind || address(a2).kind!=TempKind)
+        return address_nid(a1) == address_nid(a2);
+    d1 = var_def[lp_var(a1)];
+    d2 = var_def[lp_var(a2)];
+    return (instruction(d1).op==OpAddrOf && instruction(d2).op==OpAddrOf
+    && address_nid(instruction(d1).arg1)==address_nid(instruction(d2).arg1));
+}
+
+/*
+ * Return the IndVar that can replace quad 'i', or -1. The quad must be the
+ * last one of
+ *      t1 = (sign-extend)iv    (optional)
+ *      t2 = t1 << k            (or t1 * c)
+ *      t3 = base + t2
+ * where iv is a basic induction variable of the innermost loop containing
+ * the quad, and base is invariant in that loop.
+ */
+static int loop_strength_reduce(unsigned i)
+{
+    int L, k, n;
+    unsigned m, md, x, xd, base, u, first;
+    long long step, scale;
+    Quad *q;
+    IndVar *p;
+
+    q = &instruction(i);
+    if (q->op!=OpAdd || (L=lp_inner[lp_blk[i-lp_first]])==-1 || !can_have_preheader(L))
+        return -1;
+    for (k = 0; k < 2; k++) {
+        base = k ? q->arg2 : q->arg1;
+        m = k ? q->arg1 : q->arg2;
+        if (address(m).kind!=TempKind || var_ndefs[lp_var(m)]!=1 || !loop_invariant(base, L))
+            continue;
+        md = var_def[lp_var(m)];
+        if (instruction(md).op==OpSHL && address(instruction(md).arg2).kind==IConstKind
+        && address(instruction(md).arg2).cont.val>=0 && address(instruction(md).arg2).cont.val<32) {
+            x = instruction(md).arg1;
+            scale = 1LL << address(instruction(md).arg2).cont.val;
+        } else if (instruction(md).op==OpMul && address(instruction(md).arg2).kind==IConstKind) {
+            x = instruction(md).arg1;
+            scale = address(instruction(md).arg2).cont.val;
+        } else if (instruction(md).op==OpMul && address(instruction(md).arg1).kind==IConstKind) {
+            x = instruction(md).arg2;
+            scale = address(instruction(md).arg1).cont.val;
+        } else {
+            continue;
+        }
+        if (lp_blk[md-lp_first] != lp_blk[i-lp_first])
+            continue;
+        first = md;
+        xd = 0;
+        if (address(x).kind == TempKind) {
+            /* a sign extension is exact while iv doesn't overflow (undefined behavior) */
+            if (var_ndefs[lp_var(x)] != 1)
+                continue;
+            xd = var_def[lp_var(x)];
+            if (instruction(xd).op!=OpLLSX || lp_blk[xd-lp_first]!=lp_blk[i-lp_first])
+                continue;
+            x = instruction(xd).arg1;
+            first = xd;
+        }
+        if (!is_var(x) || (u=loop_basic_iv(x, L, &step))==0)
+            continue;
+        if (xd == 0 && get_sizeof(&address(x).cont.var.e->type)!=get_sizeof(instruction(md).type))
+            continue;
+        /* iv must not change between its use and quad i */
+        if (lp_blk[u-lp_first]==lp_blk[i-lp_first] && u>first && u<i)
+            continue;
+        break;
+    }
+    if (k == 2)
+        return -1;
+    if (address(base).kind == TempKind)
+        lp_needed[var_def[lp_var(base)]-lp_first] = TRUE;
+
+    /* reuse an IndVar with the same value */
+    for (n = 0; n < nivs; n++) {
+        p = &ivs[n];
+        if (p->loop==L && p->upd==u && !p->ext==!xd && p->scale==scale
+        && instruction(p->mul).op==instruction(md).op && get_sizeof(p->type)==get_sizeof(q->type)
+        && same_base(p->base, base))
+            return n;
+    }
+    if (nivs >= ivs_max) {
+        ivs_max = ivs_max ? ivs_max*2 : 16;
+        ivs = realloc(ivs, ivs_max*sizeof(IndVar));
+    }
+    p = &ivs[nivs];
+    p->loop = L;
+    p->iv = lp_var(x);
+    p->upd = u;
+    p->ext = xd;
+    p->mul = md;
+    p->base = base;
+    p->type = q->type;
+    p->scale = scale;
+    p->step = (long long)((unsigned long long)step*(unsigned long long)scale);
+    p->d = 0;
+    return nivs++;
+}
+
+/* emit the preheader of loop L (the header starts at quad 'i') */
+static void loop_emit_preheader(int L, unsigned i)
+{
+    int n;
+    unsigned j, op;
+
+    op = instruction(i-1).op;
+    if (op!=OpJmp && op!=OpCBr && op!=OpCase && in_loop(i-1, L))
+        emit_i(OpJmp, NULL, new_label_addr(address(instruction(i).tar).cont.val), 0, 0);
+    emit_i(OpLab, NULL, new_label_addr(loops[L].preheader), 0, 0);
+    for (j = lp_first; j <= lp_last; j++)
+        if (lp_hoist[j-lp_first] == L)
+            emit_copy(j);
+    for (n = 0; n < nivs; n++) {
+        IndVar *p;
+        unsigned x, t, iv;
+        char *name;
+
+        if ((p=&ivs[n])->loop != L)
+            continue;
+        iv = instruction(p->upd).tar;
+        p->d = new_frame_var(iv, p->type);
+        name = malloc(strlen(address_sid(iv))+16);
+        sprintf(name, "%s@%u", address_sid(iv), ++lp_ivar_counter);
+        nid2sid_tab[address_nid(p->d)] = name;
+        x = iv;
+        if (p->ext) {
+            x = new_temp_addr();
+            emit_i(OpLLSX, instruction(p->ext).type, x, iv, 0);
+        }
+        t = new_temp_addr();
+        if (const_addr(instruction(p->mul).arg1))
+            emit_i(instruction(p->mul).op, instruction(p->mul).type, t, copy_const(instruction(p->mul).arg1), x);
+        else
+            emit_i(instruction(p->mul).op, instruction(p->mul).type, t, x, copy_const(instruction(p->mul).arg2));
+        x = new_temp_addr();
+        emit_i(OpAdd, p->type, x, const_addr(p->base)?copy_const(p->base):p->base, t);
+        emit_i(OpAsn, p->type, p->d, x, 0);
+    }
+}
+
+/* move invariants out of the loops of 'fn' and reduce the strength of address computations */
+static int loop_motion(unsigned fn)
+{
+    int L, n, j, done, *hdr, *lab_loop;
+    unsigned i, k, nlab, new_first;
+
+    if (loop_find(fn) == 0) {
+        loop_free(fn);
+        return FALSE;
+    }
+    n = (int)(lp_last-lp_first+1);
+    lp_hoist = malloc(n*sizeof(int));
+    lp_ivar = malloc(n*sizeof(int));
+    lp_needed = calloc(n, 1);
+    memset(lp_hoist, -1, n*sizeof(int));
+    memset(lp_ivar, -1, n*sizeof(int));
+    nivs = 0;
+
+    /* decide in code order: the operands of a quad are defined before it */
+    for (i = lp_first; i <= lp_last; i++)
+        if ((lp_hoist[i-lp_first]=loop_hoist_target(i)) == -1)
+            lp_ivar[i-lp_first] = loop_strength_reduce(i);
+
+    /* don't move cheap quads unless they feed a moved quad or an IndVar */
+    for (j = n-1; j >= 0; j--) {
+        int *h;
+        unsigned a[2];
+
+        i = lp_first+(unsigned)j;
+        if (*(h=&lp_hoist[j]) == -1)
+            continue;
+        if (is_cheap(instruction(i).op) && !lp_needed[i-lp_first]) {
+            *h = -1;
+            continue;
+        }
+        a[0] = instruction(i).arg1, a[1] = instruction(i).arg2;
+        for (k = 0; k < 2; k++)
+            if (instruction(i).op!=OpAddrOf && a[k] && address(a[k]).kind==TempKind)
+                lp_needed[var_def[lp_var(a[k])]-lp_first] = TRUE;
+    }
+
+    nlab = count_labels(lp_first, lp_last);
+    hdr = malloc(n*sizeof(int));
+    lab_loop = malloc(nlab*sizeof(int));
+    memset(hdr, -1, n*sizeof(int));
+    memset(lab_loop, -1, nlab*sizeof(int));
+    for (i = lp_first; i <= lp_last; i++)
+        if (lp_hoist[i-lp_first] != -1)
+            loops[lp_hoist[i-lp_first]].preheader = 1;
+    for (k = 0; k < nivs; k++)
+        loops[ivs[k].loop].preheader = 1;
+    for (done = FALSE, L = 0; L < nloops; L++) {
+        if (loops[L].preheader) {
+            loops[L].preheader = nlab++;
+            hdr[cfg_node(loops[L].header).leader-lp_first] = L;
+            lab_loop[address(instruction(cfg_node(loops[L].header).leader).tar).cont.val] = L;
+            done = TRUE;
+        }
+    }
+    if (done) {
+        new_first = ic_instructions_counter;
+        frame_area = (int)cg_node(fn).size_of_local_area;
+        for (i = lp_first; i <= lp_last; i++) {
+            unsigned a[3];
+            Quad *q;
+
+            if ((L=hdr[i-lp_first]) != -1)
+                loop_emit_preheader(L, i);
+            if (lp_hoist[i-lp_first] != -1)
+                continue;
+            q = &instruction(i);
+            if (lp_ivar[i-lp_first] != -1) {
+                emit_i(OpAsn, q->type, q->tar, ivs[lp_ivar[i-lp_first]].d, 0);
+                if (verbose_asm)
+                    C_source[ic_instructions_counter-1] = C_source[i];
+                continue;
+            }
+
+            /* jumps to a header from outside the loop go to the preheader */
+            a[0] = q->tar, a[1] = q->arg1, a[2] = q->arg2;
+            for (k = 0; k < 3; k++) {
+                if (q->op!=OpLab && is_label_operand(q->op, k)
+                && (L=lab_loop[address(a[k]).cont.val])!=-1 && !in_loop(i, L))
+                    a[k] = new_label_addr(loops[L].preheader);
+            }
+            emit_i(q->op, q->type, a[0], a[1], a[2]);
+            if (verbose_asm)
+                C_source[ic_instructions_counter-1] = C_source[i];
+
+            for (k = 0; k < nivs; k++) {
+                unsigned t, c;
+
+                if (ivs[k].upd != i)
+                    continue;
+                t = new_temp_addr();
+                c = new_address(IConstKind);
+                address(c).cont.val = ivs[k].step;
+                emit_i(OpAdd, ivs[k].type, t, ivs[k].d, c);
+                emit_i(OpAsn, ivs[k].type, ivs[k].d, t, 0);
+            }
+        }
+        loop_free(fn);
+        replace_function_body(fn, new_first, nlab);
+        cg_node(fn).size_of_local_area = frame_area;
+    } else {
+        loop_free(fn);
+    }
+    free(hdr);
+    free(lab_loop);
+    free(lp_hoist);
+    free(lp_ivar);
+    free(lp_needed);
+    return done;
+}
+
+void loop_main(void)
+{
+    unsigned fn;
+    int k;
+
+    for (fn = 0; fn < cg_nodes_counter; fn++) {
+        if (cg_node_is_empty(fn))
+            continue;
+        loop_unroll_all(fn);
+        for (k = 0; k < LOOP_MOTION_ROUNDS; k++)
+            if (!loop_motion(fn))
+                break;
+    }
+    free(ivs);
+    ivs = NULL;
+    ivs_max = 0;
+    free_lp_map();
+}
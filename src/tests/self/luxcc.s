@@ -0,0 +1,2963 @@
+.extern fgets
+.extern pch_get_root
+.extern vm32_cgen
+.bss
+.align 4
+verbose_asm:
+.res 4
+.global verbose_asm
+.extern bset_iterate
+.extern edge_iterate
+.extern static_objects_list
+.extern x64_cgen_str
+.extern is_complete
+.extern ic_addresses
+.extern pch_pre_tokens
+.bss
+.align 8
+cfg_outpath:
+.res 8
+.global cfg_outpath
+.extern pch_type_exp
+.extern string_write
+.bss
+.align 4
+target_arch:
+.res 4
+.global target_arch
+.extern arena_destroy
+.extern is_struct_union_enum
+.extern get_curr_scope_id
+.extern getenv
+.extern atoi
+.extern bset_member
+.extern exit
+.extern stderr
+.bss
+.align 4
+opt_level:
+.res 4
+.global opt_level
+.extern restore_scope
+.extern string_get_pos
+.extern rewind
+.extern realloc
+.extern pch_ptr
+.extern lookup_ordinary_id
+.extern snprintf
+.extern strpbrk
+.extern pop_struct_descriptor
+.extern nid2sid_tab
+.extern fseek
+.extern string_set_pos
+.extern push_struct_descriptor
+.extern sscanf
+.extern fputc
+.extern pch_set_root
+.bss
+.align 8
+program_name:
+.res 8
+.extern vsscanf
+.extern fwrite
+.data
+.align 4
+colored_diagnostics:
+.align 4
+.dword 1
+.global colored_diagnostics
+.extern string_curr
+.extern read_stream
+.extern strspn
+.extern reset_enum_val
+.extern strtoll
+.extern get_var_nid
+.extern get_sto_class_spec
+.extern bset_cpy
+.extern string_free
+.extern vm64_cgen
+.extern fclose
+.extern preprocess
+.extern analyze_decl_specs
+.extern strstr
+.extern calloc
+.extern pop_scope
+.extern memset
+.extern x86_cgen
+.extern file_exists
+.extern pch_declaration
+.data
+.align 4
+include_libc:
+.align 4
+.dword 1
+.global include_libc
+.extern C_source
+.extern stringify_type_exp
+.extern add_quote_dir
+.bss
+.align 4
+stat_number_of_ast_nodes:
+.res 4
+.global stat_number_of_ast_nodes
+.extern strtoul
+.extern fprintf
+.extern get_type_qual
+.extern read_file
+.extern address_taken_variables
+.extern printf
+.extern get_c_token
+.extern lookup_tag
+.extern is_external_id
+.extern sprintf
+.extern strcat
+.extern are_compatible
+.bss
+.align 4
+error_count:
+.res 4
+.global error_count
+.extern free_pre_token
+.extern cg_nodes_counter
+.extern round_up
+.extern analyze_declarator
+.data
+.align 4
+include_liblux:
+.align 4
+.dword 1
+.global include_liblux
+.bss
+.align 4
+stat_number_of_pre_tokens:
+.res 4
+.global stat_number_of_pre_tokens
+.extern bset_eq
+.extern strchr
+.extern add_angle_dir
+.bss
+.align 8
+ic_outpath:
+.res 8
+.global ic_outpath
+.extern arena_alloc
+.extern stdout
+.extern ilog2
+.extern strcmp
+.extern bset_fill
+.extern strtok
+.extern strtol
+.extern parse_header
+.extern stdin
+.extern pch_lookup
+.extern ftell
+.extern strcpy
+.extern install_tag
+.bss
+.align 8
+ic_function_to_print:
+.res 8
+.global ic_function_to_print
+.extern strtoull
+.extern strlen
+.extern token_table
+.extern string_vprintf
+.extern bset_free
+.extern cfg_nodes
+.extern memchr
+.extern new_type_exp_node
+.extern dup_decl_specs
+.extern new_declaration_node
+.extern vfprintf
+.extern pch_read
+.extern hash
+.extern string_clear
+.extern bsearch
+.extern arm_cgen
+.extern pre_save_pch
+.extern qsort
+.extern analyze_parameter_declaration
+.extern string_new
+.bss
+.align 8
+cg_outpath:
+.res 8
+.global cg_outpath
+.extern pch_set_str
+.extern x86_cgen_str
+.extern memcmp
+.extern bset_insert
+.extern pre_load_pch
+.extern vsnprintf
+.extern vsprintf
+.extern nid_counter
+.extern new_cg_node
+.bss
+.align 4
+warning_count:
+.res 4
+.global warning_count
+.extern memcpy
+.extern fopen
+.extern be_atoi
+.extern bset_delete
+.extern push_scope
+.extern free_c_token
+.extern ic_main
+.extern new_address
+.extern parse
+.extern get_pre_token
+.extern get_member_descriptor
+.extern decl_init
+.extern ic_free_function
+.extern dup_declarator
+.extern cg_nodes
+.extern strncat
+.extern fileno
+.extern bset_update
+.extern pch_new_vector
+.extern string_printf
+.extern lookup_external_id
+.extern hash2
+.extern analyze_type_name
+# ==== start of definition of function `missing_arg' ====
+.text
+missing_arg:
+addsp 0;         
+# param:`opt', offset:-24
+ldbp -24;
+ldqw;
+ldiqw program_name;
+ldqw;
+ldiqw @S0;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 32;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern memmove
+.extern replace_extension
+.extern analyze_struct_declarator
+.extern get_type_spec
+# ==== start of definition of function `usage' ====
+.text
+usage:
+addsp 0;         
+# param:`fp', offset:-24
+ldiqw program_name;
+ldqw;
+ldiqw @S1;
+ldbp -24;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern cfg_nodes_counter
+.extern analyze_function_definition
+.extern strdup
+.extern bset_new
+.extern arena_new
+.extern analyze_init_declarator
+.bss
+.align 8
+cfg_function_to_print:
+.res 8
+.global cfg_function_to_print
+.extern strncmp
+.extern arena_set_nom_siz
+.extern bset_union_diff
+.extern pch_set_elem
+.extern pch_write
+.bss
+.align 4
+stat_number_of_c_tokens:
+.res 4
+.global stat_number_of_c_tokens
+.extern strncpy
+.extern bset_clear
+.extern decl_save_pch
+.extern bset_card
+.extern ic_instructions
+.extern new_extern_id_node
+.extern decl_load_pch
+.extern bset_union
+.extern analyze_translation_unit
+.extern strnlen
+.extern bset_new_in
+.extern analyze_enumerator
+.bss
+.align 4
+targeting_arch64:
+.res 4
+.global targeting_arch64
+.extern set_attributes
+.extern is_typedef_name
+.extern arena_reset
+.extern fread
+.extern strrchr
+.extern bset_next
+.bss
+.align 4
+disable_warnings:
+.res 4
+.global disable_warnings
+.extern pch_copy
+.extern string_append
+.extern bset_diff
+.extern install_macro
+.extern bset_inters
+.extern pch_set_ptr
+.extern edge_add
+.extern string_buf
+# ==== start of definition of function `main' ====
+.text
+main:
+.global main
+addsp 172;       
+# param:`argc', offset:-20
+# param:`argv', offset:-28
+# var: i, offset: 4
+# var: fp, offset: 8
+ldidw 0;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+# var: flags, offset: 16
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+# var: outpath, offset: 24
+ldidw 0;
+dw2qw;
+ldbp 24;
+stqw;
+pop;
+pop;
+# var: inpath, offset: 32
+ldidw 0;
+dw2qw;
+ldbp 32;
+stqw;
+pop;
+pop;
+# var: pch_path, offset: 40
+ldidw 0;
+dw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+# var: tok, offset: 48
+# var: pch_defs, offset: 56
+ldidw 0;
+dw2qw;
+ldbp 56;
+stqw;
+pop;
+pop;
+# var: newline_node, offset: 64
+# var: one_node, offset: 112
+ldidw 6;
+ldbp 64;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw @S2;
+ldbp 64;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 2;
+ldbp 112;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw @S3;
+ldbp 112;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 64;
+ldbp 112;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -28;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw program_name;
+stqw;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L1;
+ldiqw stderr;
+ldqw;
+ldiqw usage;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L1:
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+@L2:
+ldbp 4;
+lddw;
+ldbp -20;
+lddw;
+sltdw;
+jmpf @L4;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+ldxb 1;
+ldidw 45;
+neqdw;
+jmpf @L5;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L3;
+@L5:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 1;
+dw2qw;
+ldxb 1;
+ldiqw @T6;
+switch;
+@L8:
+ldbp 16;
+lddw;
+ldidw 4;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L7;
+@L9:
+jmp @@main_unknown;
+@L10:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+ldxb 1;
+ldidw 0;
+neqdw;
+jmpf @L11;
+ldidw 0;
+dw2qw;
+ldbp 112;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+addqw;
+ldidw 0;
+ldiqw install_macro;
+call 28;
+pop;
+pop;
+jmp @L12;
+@L11:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L13;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw missing_arg;
+call 8;
+pop;
+pop;
+jmp @L14;
+@L13:
+ldidw 0;
+dw2qw;
+ldbp 112;
+ldbp -28;
+ldqw;
+ldbp 4;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+ldiqw install_macro;
+call 28;
+pop;
+pop;
+@L14:
+@L12:
+jmp @L7;
+@L15:
+ldiqw @S4;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L16;
+jmp @@main_unknown;
+@L16:
+ldbp 16;
+lddw;
+ldidw 4096;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L7;
+@L17:
+ldiqw stdout;
+ldqw;
+ldiqw usage;
+call 8;
+pop;
+pop;
+ldiqw @S5;
+ldiqw printf;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L18:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+ldxb 1;
+ldidw 0;
+neqdw;
+jmpf @L19;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+addqw;
+ldiqw add_angle_dir;
+call 8;
+pop;
+pop;
+jmp @L20;
+@L19:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L21;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw missing_arg;
+call 8;
+pop;
+pop;
+jmp @L22;
+@L21:
+ldbp -28;
+ldqw;
+ldbp 4;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw add_angle_dir;
+call 8;
+pop;
+pop;
+@L22:
+@L20:
+jmp @L7;
+@L23:
+ldiqw @S6;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L24;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L25;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw missing_arg;
+call 8;
+pop;
+pop;
+@L25:
+ldbp -28;
+ldqw;
+ldbp 4;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L26;
+@L24:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+ldxb 1;
+ldidw 0;
+neqdw;
+jmpf @L27;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+addqw;
+ldiqw add_quote_dir;
+call 8;
+pop;
+pop;
+jmp @L28;
+@L27:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L29;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw missing_arg;
+call 8;
+pop;
+pop;
+jmp @L30;
+@L29:
+ldbp -28;
+ldqw;
+ldbp 4;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw add_quote_dir;
+call 8;
+pop;
+pop;
+@L30:
+@L28:
+@L26:
+jmp @L7;
+@L31:
+# var: targ, offset: 160
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+ldxb 1;
+ldidw 0;
+neqdw;
+jmpf @L32;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+addqw;
+ldbp 160;
+stqw;
+pop;
+pop;
+jmp @L33;
+@L32:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L34;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw missing_arg;
+call 8;
+pop;
+pop;
+jmp @L35;
+@L34:
+ldbp -28;
+ldqw;
+ldbp 4;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 160;
+stqw;
+pop;
+pop;
+@L35:
+@L33:
+ldiqw @S7;
+ldbp 160;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L36;
+ldbp 16;
+lddw;
+ldidw 64;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L37;
+@L36:
+ldiqw @S8;
+ldbp 160;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L38;
+ldbp 16;
+lddw;
+ldidw 128;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L39;
+@L38:
+ldiqw @S9;
+ldbp 160;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L40;
+ldbp 16;
+lddw;
+ldidw 256;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L41;
+@L40:
+ldiqw @S10;
+ldbp 160;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L42;
+ldbp 16;
+lddw;
+ldidw 512;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L43;
+@L42:
+ldiqw @S11;
+ldbp 160;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L44;
+ldbp 16;
+lddw;
+ldidw 1024;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L45;
+@L44:
+ldiqw @S12;
+ldbp 160;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L46;
+ldbp 16;
+lddw;
+ldidw 2048;
+ordw;
+ldbp 16;
+stdw;
+pop;
+@L46:
+@L45:
+@L43:
+@L41:
+@L39:
+@L37:
+jmp @L7;
+@L47:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+ldxb 1;
+ldidw 0;
+neqdw;
+jmpf @L48;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+addqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L49;
+@L48:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L50;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw missing_arg;
+call 8;
+pop;
+pop;
+jmp @L51;
+@L50:
+ldbp -28;
+ldqw;
+ldbp 4;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L51:
+@L49:
+jmp @L7;
+@L52:
+ldbp 16;
+lddw;
+ldidw 1;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L7;
+@L53:
+ldidw 1;
+ldiqw disable_warnings;
+stdw;
+pop;
+jmp @L7;
+@L54:
+ldbp 16;
+lddw;
+ldidw 8;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L7;
+@L55:
+ldidw 0;
+ldiqw colored_diagnostics;
+stdw;
+pop;
+jmp @L7;
+@L56:
+ldbp 16;
+lddw;
+ldidw 16;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L7;
+@L57:
+ldbp 16;
+lddw;
+ldidw 32;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L7;
+@L58:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+ldxb 1;
+ldidw 0;
+neqdw;
+jmpf @L59;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+addqw;
+ldiqw cfg_function_to_print;
+stqw;
+pop;
+pop;
+jmp @L60;
+@L59:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L61;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw missing_arg;
+call 8;
+pop;
+pop;
+jmp @L62;
+@L61:
+ldbp -28;
+ldqw;
+ldbp 4;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw cfg_function_to_print;
+stqw;
+pop;
+pop;
+@L62:
+@L60:
+jmp @L7;
+@L63:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+ldxb 1;
+ldidw 0;
+neqdw;
+jmpf @L64;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+addqw;
+ldiqw ic_function_to_print;
+stqw;
+pop;
+pop;
+jmp @L65;
+@L64:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L66;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw missing_arg;
+call 8;
+pop;
+pop;
+jmp @L67;
+@L66:
+ldbp -28;
+ldqw;
+ldbp 4;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw ic_function_to_print;
+stqw;
+pop;
+pop;
+@L67:
+@L65:
+jmp @L7;
+@L68:
+ldbp 16;
+lddw;
+ldidw 2;
+ordw;
+ldbp 16;
+stdw;
+pop;
+jmp @L7;
+@L69:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+ldxb 1;
+ldidw 0;
+neqdw;
+jmpf @L70;
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 2;
+dw2qw;
+addqw;
+ldiqw atoi;
+call 8;
+pop;
+ldiqw opt_level;
+stdw;
+pop;
+jmp @L71;
+@L70:
+ldidw 1;
+ldiqw opt_level;
+stdw;
+pop;
+@L71:
+jmp @L7;
+@L72:
+ldidw 1;
+ldiqw verbose_asm;
+stdw;
+pop;
+jmp @L7;
+@L73:
+ldidw 0;
+ldiqw include_liblux;
+stdw;
+pop;
+jmp @L7;
+@L74:
+ldidw 0;
+ldiqw include_libc;
+stdw;
+pop;
+jmp @L7;
+@L75:
+jmp @L7;
+@L76:
+@@main_unknown:
+ldbp -28;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw program_name;
+ldqw;
+ldiqw @S13;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 32;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L7:
+.data
+.align 8
+@T6:
+.dword 24
+.dword 0
+.dword 65
+.dword 67
+.dword 68
+.dword 71
+.dword 73
+.dword 78
+.dword 79
+.dword 84
+.dword 90
+.dword 97
+.dword 99
+.dword 101
+.dword 104
+.dword 105
+.dword 109
+.dword 111
+.dword 112
+.dword 113
+.dword 115
+.dword 117
+.dword 118
+.dword 122
+.qword @L76
+.qword @L75
+.qword @L56
+.qword @L57
+.qword @L10
+.qword @L58
+.qword @L18
+.qword @L63
+.qword @L69
+.qword @L68
+.qword @L74
+.qword @L8
+.qword @L9
+.qword @L15
+.qword @L17
+.qword @L23
+.qword @L31
+.qword @L47
+.qword @L52
+.qword @L53
+.qword @L54
+.qword @L55
+.qword @L72
+.qword @L73
+.text
+@L3:
+incldw 4;
+jmp @L2;
+@L4:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L77;
+ldiqw stderr;
+ldqw;
+ldiqw usage;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L77:
+ldbp 16;
+lddw;
+ldidw 64;
+ldidw 128;
+ordw;
+ldidw 256;
+ordw;
+ldidw 512;
+ordw;
+ldidw 1024;
+ordw;
+ldidw 2048;
+ordw;
+anddw;
+ldiqw @T78;
+switch;
+@L80:
+ldidw 2;
+ldiqw target_arch;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 112;
+ldiqw @S14;
+ldidw 0;
+ldiqw install_macro;
+call 28;
+pop;
+pop;
+jmp @L79;
+@L81:
+ldidw 3;
+ldiqw target_arch;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 112;
+ldiqw @S15;
+ldidw 0;
+ldiqw install_macro;
+call 28;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 112;
+ldiqw @S16;
+ldidw 0;
+ldiqw install_macro;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw targeting_arch64;
+stdw;
+pop;
+jmp @L79;
+@L82:
+ldidw 1;
+ldiqw target_arch;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 112;
+ldiqw @S17;
+ldidw 0;
+ldiqw install_macro;
+call 28;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 112;
+ldiqw @S18;
+ldidw 0;
+ldiqw install_macro;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw targeting_arch64;
+stdw;
+pop;
+jmp @L79;
+@L83:
+ldidw 4;
+ldiqw target_arch;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 112;
+ldiqw @S19;
+ldidw 0;
+ldiqw install_macro;
+call 28;
+pop;
+pop;
+jmp @L79;
+@L84:
+ldidw 5;
+ldiqw target_arch;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 112;
+ldiqw @S20;
+ldidw 0;
+ldiqw install_macro;
+call 28;
+pop;
+pop;
+jmp @L79;
+@L85:
+ldidw 0;
+ldiqw target_arch;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldidw 64;
+ordw;
+ldbp 16;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 112;
+ldiqw @S21;
+ldidw 0;
+ldiqw install_macro;
+call 28;
+pop;
+pop;
+jmp @L79;
+@L79:
+.data
+.align 8
+@T78:
+.dword 6
+.dword 128
+.dword 256
+.dword 512
+.dword 1024
+.dword 2048
+.qword @L85
+.qword @L82
+.qword @L80
+.qword @L81
+.qword @L83
+.qword @L84
+.text
+ldbp 16;
+lddw;
+ldidw 8192;
+anddw;
+jmpf @L86;
+ldbp 16;
+lddw;
+ldidw 64;
+ldidw 128;
+ordw;
+anddw;
+notdw;
+jmpf @L86;
+ldidw 1;
+jmp @L87;
+@L86:
+ldidw 0;
+@L87:
+jmpf @L88;
+ldiqw program_name;
+ldqw;
+ldiqw @S22;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L88:
+ldidw 0;
+dw2qw;
+ldbp 112;
+ldiqw @S23;
+ldidw 0;
+ldiqw install_macro;
+call 28;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 112;
+ldiqw @S24;
+ldidw 0;
+ldiqw install_macro;
+call 28;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 112;
+ldiqw @S25;
+ldidw 0;
+ldiqw install_macro;
+call 28;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L89;
+ldbp 40;
+ldqw;
+ldiqw pch_read;
+call 8;
+ldbp 56;
+stqw;
+pop;
+pop;
+@L89:
+ldbp 32;
+ldqw;
+ldiqw preprocess;
+call 8;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 1;
+anddw;
+jmpf @L90;
+# var: p, offset: 160
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L91;
+ldiqw stdout;
+ldqw;
+jmp @L92;
+@L91:
+ldiqw @S26;
+ldbp 24;
+ldqw;
+ldiqw fopen;
+call 16;
+@L92:
+ldbp 8;
+stqw;
+pop;
+pop;
+@L93:
+ldiqw get_pre_token;
+call 0;
+ldbp 160;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L94;
+ldbp 160;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S27;
+ldbp 8;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+ldbp 160;
+ldqw;
+ldiqw free_pre_token;
+call 8;
+pop;
+pop;
+jmp @L93;
+@L94:
+ldbp 160;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S28;
+ldbp 8;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+ldiqw @S29;
+ldbp 8;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+jmp @@main_done;
+@L90:
+ldbp 16;
+lddw;
+ldidw 4096;
+anddw;
+jmpf @L95;
+# var: pch_outpath, offset: 160
+ldiqw get_c_token;
+call 0;
+ldiqw parse_header;
+call 8;
+ldbp 56;
+stqw;
+pop;
+pop;
+ldiqw error_count;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L96;
+ldidw 1;
+dw2qw;
+ret;
+@L96:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L97;
+ldbp 24;
+ldqw;
+jmp @L98;
+@L97:
+ldiqw @S30;
+ldbp 32;
+ldqw;
+ldiqw replace_extension;
+call 16;
+@L98:
+ldbp 160;
+stqw;
+pop;
+pop;
+ldbp 56;
+ldqw;
+ldbp 160;
+ldqw;
+ldiqw pch_write;
+call 16;
+pop;
+pop;
+ldbp 160;
+ldqw;
+ldbp 24;
+ldqw;
+neqqw;
+jmpf @L99;
+ldbp 160;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+@L99:
+jmp @@main_done;
+@L95:
+ldbp 56;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L100;
+ldbp 56;
+ldqw;
+jmp @L101;
+@L100:
+ldiqw get_c_token;
+call 0;
+@L101:
+ldbp 48;
+stqw;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 2;
+anddw;
+jmpf @L102;
+# var: p, offset: 160
+# var: tok_outpath, offset: 168
+ldiqw @S31;
+ldbp 32;
+ldqw;
+ldiqw replace_extension;
+call 16;
+ldbp 168;
+stqw;
+pop;
+pop;
+ldiqw @S32;
+ldbp 168;
+ldqw;
+ldiqw fopen;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldbp 160;
+stqw;
+pop;
+pop;
+@L103:
+ldbp 160;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw token_table;
+ldbp 160;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+dw2qw;
+ldxqw 8;
+ldbp 160;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp 160;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 160;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw @S33;
+ldbp 8;
+ldqw;
+ldiqw fprintf;
+call 48;
+pop;
+pop;
+ldbp 160;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 91;
+eqdw;
+jmpf @L106;
+jmp @L105;
+@L106:
+ldbp 160;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L107;
+ldiqw get_c_token;
+call 0;
+ldbp 160;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+@L107:
+@L104:
+ldbp 160;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 160;
+stqw;
+pop;
+pop;
+jmp @L103;
+@L105:
+ldbp 168;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw fclose;
+call 8;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L102:
+ldbp 16;
+lddw;
+ldidw 16;
+anddw;
+jmpf @L108;
+# var: ast_outpath, offset: 160
+ldiqw @S34;
+ldbp 32;
+ldqw;
+ldiqw replace_extension;
+call 16;
+ldbp 160;
+stqw;
+pop;
+pop;
+ldbp 160;
+ldqw;
+ldbp 48;
+ldqw;
+ldiqw parse;
+call 16;
+pop;
+pop;
+ldbp 160;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+jmp @L109;
+@L108:
+ldidw 0;
+dw2qw;
+ldbp 48;
+ldqw;
+ldiqw parse;
+call 16;
+pop;
+pop;
+@L109:
+ldbp 16;
+lddw;
+ldidw 4;
+anddw;
+jmpf @L110;
+jmp @@main_done;
+@L110:
+ldiqw error_count;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L111;
+ldbp 16;
+lddw;
+ldidw 8192;
+anddw;
+notdw;
+jmpf @L112;
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L113;
+ldiqw stdout;
+ldqw;
+jmp @L114;
+@L113:
+ldiqw @S35;
+ldbp 24;
+ldqw;
+ldiqw fopen;
+call 16;
+@L114:
+ldbp 8;
+stqw;
+pop;
+pop;
+@L112:
+ldbp 16;
+lddw;
+ldidw 64;
+ldidw 128;
+ordw;
+ldidw 256;
+ordw;
+ldidw 512;
+ordw;
+ldidw 1024;
+ordw;
+ldidw 2048;
+ordw;
+anddw;
+ldiqw @T115;
+switch;
+@L117:
+@L118:
+@L119:
+@L120:
+ldiqw ic_function_to_print;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L121;
+ldiqw @S36;
+ldbp 32;
+ldqw;
+ldiqw replace_extension;
+call 16;
+ldiqw ic_outpath;
+stqw;
+pop;
+pop;
+@L121:
+ldiqw cfg_function_to_print;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L122;
+ldiqw @S37;
+ldbp 32;
+ldqw;
+ldiqw replace_extension;
+call 16;
+ldiqw cfg_outpath;
+stqw;
+pop;
+pop;
+@L122:
+ldbp 16;
+lddw;
+ldidw 32;
+anddw;
+jmpf @L123;
+ldiqw @S38;
+ldbp 32;
+ldqw;
+ldiqw replace_extension;
+call 16;
+ldiqw cg_outpath;
+stqw;
+pop;
+pop;
+@L123:
+ldbp 16;
+lddw;
+ldidw 64;
+ldidw 128;
+ordw;
+ldidw 256;
+ordw;
+ldidw 512;
+ordw;
+ldidw 1024;
+ordw;
+ldidw 2048;
+ordw;
+anddw;
+ldiqw @T124;
+switch;
+@L126:
+ldbp 8;
+ldqw;
+ldiqw x86_cgen;
+call 8;
+pop;
+pop;
+jmp @L125;
+@L127:
+ldbp 8;
+ldqw;
+ldiqw x64_cgen;
+call 8;
+pop;
+pop;
+jmp @L125;
+@L128:
+ldbp 8;
+ldqw;
+ldiqw mips_cgen;
+call 8;
+pop;
+pop;
+jmp @L125;
+@L129:
+ldbp 8;
+ldqw;
+ldiqw arm_cgen;
+call 8;
+pop;
+pop;
+jmp @L125;
+@L125:
+.data
+.align 8
+@T124:
+.dword 5
+.dword 64
+.dword 128
+.dword 1024
+.dword 2048
+.qword @L125
+.qword @L126
+.qword @L127
+.qword @L128
+.qword @L129
+.text
+ldiqw ic_function_to_print;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L130;
+ldiqw ic_outpath;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+@L130:
+ldiqw cfg_outpath;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L131;
+ldiqw cfg_outpath;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+@L131:
+ldiqw cg_outpath;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L132;
+ldiqw cg_outpath;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+@L132:
+jmp @L116;
+@L133:
+ldbp 8;
+ldqw;
+ldiqw vm32_cgen;
+call 8;
+pop;
+pop;
+jmp @L116;
+@L134:
+ldbp 8;
+ldqw;
+ldiqw vm64_cgen;
+call 8;
+pop;
+pop;
+jmp @L116;
+@L116:
+.data
+.align 8
+@T115:
+.dword 7
+.dword 64
+.dword 128
+.dword 256
+.dword 512
+.dword 1024
+.dword 2048
+.qword @L116
+.qword @L117
+.qword @L118
+.qword @L133
+.qword @L134
+.qword @L119
+.qword @L120
+.text
+jmp @L135;
+@L111:
+ldidw 1;
+dw2qw;
+ret;
+@L135:
+@@main_done:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L136;
+ldbp 8;
+ldqw;
+ldiqw stdout;
+ldqw;
+neqqw;
+jmpf @L136;
+ldidw 1;
+jmp @L137;
+@L136:
+ldidw 0;
+@L137:
+jmpf @L138;
+ldbp 8;
+ldqw;
+ldiqw fclose;
+call 8;
+pop;
+pop;
+@L138:
+ldbp 16;
+lddw;
+ldidw 8;
+anddw;
+jmpf @L139;
+ldiqw stat_number_of_pre_tokens;
+lddw;
+ldiqw @S39;
+ldiqw printf;
+call 12;
+pop;
+pop;
+ldiqw stat_number_of_c_tokens;
+lddw;
+ldiqw @S40;
+ldiqw printf;
+call 12;
+pop;
+pop;
+ldiqw stat_number_of_ast_nodes;
+lddw;
+ldiqw @S41;
+ldiqw printf;
+call 12;
+pop;
+pop;
+@L139:
+ldiqw error_count;
+lddw;
+notdw;
+notdw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern ferror
+.extern random
+.extern ic_instructions_counter
+.extern free
+.extern malloc
+.extern get_external_declarations
+.extern mips_cgen
+.extern pch_get_vector
+.extern new_decl_list_node
+.extern srandom
+.extern lookup_struct_descriptor
+.extern new_exec_node
+.extern x64_cgen
+.extern fgetc
+.data
+@S0:
+.byte 37
+.byte 115
+.byte 58
+.byte 32
+.byte 111
+.byte 112
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 114
+.byte 101
+.byte 113
+.byte 117
+.byte 105
+.byte 114
+.byte 101
+.byte 115
+.byte 32
+.byte 97
+.byte 110
+.byte 32
+.byte 97
+.byte 114
+.byte 103
+.byte 117
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 10
+.byte 0
+@S1:
+.byte 85
+.byte 83
+.byte 65
+.byte 71
+.byte 69
+.byte 58
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 32
+.byte 79
+.byte 80
+.byte 84
+.byte 73
+.byte 79
+.byte 78
+.byte 83
+.byte 32
+.byte 93
+.byte 32
+.byte 60
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 62
+.byte 10
+.byte 0
+@S2:
+.byte 10
+.byte 0
+@S3:
+.byte 49
+.byte 0
+@S4:
+.byte 45
+.byte 101
+.byte 109
+.byte 105
+.byte 116
+.byte 45
+.byte 112
+.byte 99
+.byte 104
+.byte 0
+@S5:
+.byte 82
+.byte 117
+.byte 110
+.byte 32
+.byte 116
+.byte 104
+.byte 101
+.byte 32
+.byte 100
+.byte 114
+.byte 105
+.byte 118
+.byte 101
+.byte 114
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 116
+.byte 104
+.byte 101
+.byte 32
+.byte 96
+.byte 45
+.byte 104
+.byte 39
+.byte 32
+.byte 111
+.byte 112
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 111
+.byte 114
+.byte 32
+.byte 109
+.byte 111
+.byte 114
+.byte 101
+.byte 32
+.byte 105
+.byte 110
+.byte 102
+.byte 111
+.byte 10
+.byte 0
+@S6:
+.byte 45
+.byte 105
+.byte 110
+.byte 99
+.byte 108
+.byte 117
+.byte 100
+.byte 101
+.byte 45
+.byte 112
+.byte 99
+.byte 104
+.byte 0
+@S7:
+.byte 120
+.byte 56
+.byte 54
+.byte 0
+@S8:
+.byte 120
+.byte 54
+.byte 52
+.byte 0
+@S9:
+.byte 118
+.byte 109
+.byte 51
+.byte 50
+.byte 0
+@S10:
+.byte 118
+.byte 109
+.byte 54
+.byte 52
+.byte 0
+@S11:
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 0
+@S12:
+.byte 97
+.byte 114
+.byte 109
+.byte 0
+@S13:
+.byte 37
+.byte 115
+.byte 58
+.byte 32
+.byte 117
+.byte 110
+.byte 107
+.byte 110
+.byte 111
+.byte 119
+.byte 110
+.byte 32
+.byte 111
+.byte 112
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 10
+.byte 0
+@S14:
+.byte 95
+.byte 95
+.byte 76
+.byte 117
+.byte 120
+.byte 86
+.byte 77
+.byte 95
+.byte 95
+.byte 0
+@S15:
+.byte 95
+.byte 95
+.byte 76
+.byte 117
+.byte 120
+.byte 86
+.byte 77
+.byte 95
+.byte 95
+.byte 0
+@S16:
+.byte 95
+.byte 95
+.byte 76
+.byte 80
+.byte 54
+.byte 52
+.byte 95
+.byte 95
+.byte 0
+@S17:
+.byte 95
+.byte 95
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 54
+.byte 52
+.byte 95
+.byte 95
+.byte 0
+@S18:
+.byte 95
+.byte 95
+.byte 76
+.byte 80
+.byte 54
+.byte 52
+.byte 95
+.byte 95
+.byte 0
+@S19:
+.byte 95
+.byte 95
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 95
+.byte 0
+@S20:
+.byte 95
+.byte 95
+.byte 97
+.byte 114
+.byte 109
+.byte 95
+.byte 95
+.byte 0
+@S21:
+.byte 95
+.byte 95
+.byte 105
+.byte 51
+.byte 56
+.byte 54
+.byte 95
+.byte 95
+.byte 0
+@S22:
+.byte 37
+.byte 115
+.byte 58
+.byte 32
+.byte 45
+.byte 99
+.byte 32
+.byte 105
+.byte 115
+.byte 32
+.byte 111
+.byte 110
+.byte 108
+.byte 121
+.byte 32
+.byte 115
+.byte 117
+.byte 112
+.byte 112
+.byte 111
+.byte 114
+.byte 116
+.byte 101
+.byte 100
+.byte 32
+.byte 102
+.byte 111
+.byte 114
+.byte 32
+.byte 120
+.byte 56
+.byte 54
+.byte 32
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 120
+.byte 54
+.byte 52
+.byte 10
+.byte 0
+@S23:
+.byte 95
+.byte 95
+.byte 117
+.byte 110
+.byte 105
+.byte 120
+.byte 95
+.byte 95
+.byte 0
+@S24:
+.byte 95
+.byte 95
+.byte 108
+.byte 105
+.byte 110
+.byte 117
+.byte 120
+.byte 95
+.byte 95
+.byte 0
+@S25:
+.byte 95
+.byte 95
+.byte 103
+.byte 110
+.byte 117
+.byte 95
+.byte 108
+.byte 105
+.byte 110
+.byte 117
+.byte 120
+.byte 95
+.byte 95
+.byte 0
+@S26:
+.byte 119
+.byte 98
+.byte 0
+@S27:
+.byte 37
+.byte 115
+.byte 32
+.byte 0
+@S28:
+.byte 37
+.byte 115
+.byte 32
+.byte 0
+@S29:
+.byte 10
+.byte 0
+@S30:
+.byte 46
+.byte 112
+.byte 99
+.byte 104
+.byte 0
+@S31:
+.byte 46
+.byte 116
+.byte 111
+.byte 107
+.byte 0
+@S32:
+.byte 119
+.byte 98
+.byte 0
+@S33:
+.byte 37
+.byte 115
+.byte 58
+.byte 37
+.byte 100
+.byte 58
+.byte 37
+.byte 45
+.byte 51
+.byte 100
+.byte 32
+.byte 61
+.byte 62
+.byte 32
+.byte 32
+.byte 32
+.byte 116
+.byte 111
+.byte 107
+.byte 101
+.byte 110
+.byte 58
+.byte 32
+.byte 37
+.byte 45
+.byte 49
+.byte 53
+.byte 115
+.byte 32
+.byte 108
+.byte 101
+.byte 120
+.byte 101
+.byte 109
+.byte 101
+.byte 58
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 10
+.byte 0
+@S34:
+.byte 46
+.byte 97
+.byte 115
+.byte 116
+.byte 46
+.byte 100
+.byte 111
+.byte 116
+.byte 0
+@S35:
+.byte 119
+.byte 98
+.byte 0
+@S36:
+.byte 46
+.byte 105
+.byte 99
+.byte 0
+@S37:
+.byte 46
+.byte 99
+.byte 102
+.byte 103
+.byte 46
+.byte 100
+.byte 111
+.byte 116
+.byte 0
+@S38:
+.byte 46
+.byte 99
+.byte 103
+.byte 46
+.byte 100
+.byte 111
+.byte 116
+.byte 0
+@S39:
+.byte 10
+.byte 61
+.byte 62
+.byte 32
+.byte 39
+.byte 37
+.byte 117
+.byte 39
+.byte 32
+.byte 112
+.byte 114
+.byte 101
+.byte 112
+.byte 114
+.byte 111
+.byte 99
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 116
+.byte 111
+.byte 107
+.byte 101
+.byte 110
+.byte 115
+.byte 32
+.byte 119
+.byte 101
+.byte 114
+.byte 101
+.byte 32
+.byte 99
+.byte 114
+.byte 101
+.byte 97
+.byte 116
+.byte 101
+.byte 100
+.byte 32
+.byte 40
+.byte 97
+.byte 112
+.byte 114
+.byte 111
+.byte 120
+.byte 41
+.byte 10
+.byte 0
+@S40:
+.byte 61
+.byte 62
+.byte 32
+.byte 39
+.byte 37
+.byte 117
+.byte 39
+.byte 32
+.byte 67
+.byte 32
+.byte 116
+.byte 111
+.byte 107
+.byte 101
+.byte 110
+.byte 115
+.byte 32
+.byte 119
+.byte 101
+.byte 114
+.byte 101
+.byte 32
+.byte 99
+.byte 114
+.byte 101
+.byte 97
+.byte 116
+.byte 101
+.byte 100
+.byte 32
+.byte 40
+.byte 97
+.byte 112
+.byte 114
+.byte 111
+.byte 120
+.byte 41
+.byte 10
+.byte 0
+@S41:
+.byte 61
+.byte 62
+.byte 32
+.byte 39
+.byte 37
+.byte 117
+.byte 39
+.byte 32
+.byte 65
+.byte 83
+.byte 84
+.byte 32
+.byte 110
+.byte 111
+.byte 100
+.byte 101
+.byte 115
+.byte 32
+.byte 119
+.byte 101
+.byte 114
+.byte 101
+.byte 32
+.byte 99
+.byte 114
+.byte 101
+.byte 97
+.byte 116
+.byte 101
+.byte 100
+.byte 32
+.byte 40
+.byte 97
+.byte 112
+.byte 114
+.byte 111
+.byte 120
+.byte 41
+.byte 10
+.byte 0
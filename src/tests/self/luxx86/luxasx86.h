@@ -0,0 +1,10 @@
+#ifndef LUXASX86_H_
+#define LUXASX86_H_
+
+/*
+ * Integrated assembler.
+ * Available when luxasx86.c is compiled with LUXAS_LIB defined.
+ */
+void x86_assemble(char *src, char *name, char *outpath, int x64);
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef MIPS_CGEN_H_
+#define MIPS_CGEN_H_
+
+#include <stdio.h>
+
+void mips_cgen(FILE *outf);
+
+#endif
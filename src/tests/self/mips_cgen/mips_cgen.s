@@ -0,0 +1,29040 @@
+.extern fgets
+# ==== start of definition of function `mips_indcall' ====
+.text
+mips_indcall:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldidw 0;
+ldbp -28;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldiqw @S0;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S1;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S2;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S3;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw mips_post_call;
+call 0;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldbp -24;
+lddw;
+jmpf @L1;
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L2;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L2;
+ldidw 0;
+jmp @L3;
+@L2:
+ldidw 1;
+@L3:
+jmpf @L4;
+# var: r, offset: 8
+ldidw 2;
+dw2w;
+ldbp 8;
+stw;
+pop;
+ldidw 3;
+dw2w;
+ldbp 10;
+stw;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+jmp @L5;
+@L4:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldidw 2;
+dw2w;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L5:
+@L1:
+ldidw 0;
+ret;
+# ==== start of definition of function `mips_store' ====
+.text
+mips_store:
+addsp 20;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L6;
+# var: e, offset: 8
+# var: st_str, offset: 16
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T7;
+switch;
+@L9:
+@L10:
+ldiqw @S4;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S5;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldidw 25;
+dw2w;
+ldiqw mips_load_addr;
+call 8;
+pop;
+pop;
+ldiqw @S6;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S7;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -20;
+ldw;
+ldiqw @S8;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S9;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S10;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S11;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S12;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S13;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S14;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S15;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S16;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S17;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L11:
+@L12:
+ldiqw @S18;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L8;
+@L13:
+@L14:
+@L15:
+ldiqw @S19;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L8;
+@L16:
+ldiqw @S20;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L8;
+@L8:
+.data
+.align 8
+@T7:
+.dword 8
+.dword 49
+.dword 64
+.dword 68
+.dword 71
+.dword 106
+.dword 107
+.dword 108
+.qword @L16
+.qword @L13
+.qword @L11
+.qword @L9
+.qword @L10
+.qword @L14
+.qword @L15
+.qword @L12
+.text
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L17;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L18;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S21;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 44;
+pop;
+pop;
+ldiqw @S22;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L19;
+@L18:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S23;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S24;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L19:
+jmp @L20;
+@L17:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S25;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S26;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L20:
+jmp @L21;
+@L6:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L22;
+ldbp -24;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldbp -20;
+ldw;
+ldiqw @S27;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S28;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L22:
+@L21:
+ldidw 0;
+ret;
+.extern get_promoted_type
+.extern analyze_bitwise_operator
+.extern verbose_asm
+.extern bset_iterate
+.extern edge_iterate
+.bss
+.align 4
+max_arg_offs:
+.res 4
+.extern static_objects_list
+.extern is_complete
+# ==== start of definition of function `mips_lab' ====
+.text
+mips_lab:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw @S29;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S30;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern ic_addresses
+.extern cfg_outpath
+.bss
+.align 4
+size_of_local_area:
+.res 4
+.extern analyze_unary_expression
+.extern string_write
+.extern target_arch
+.extern emit_warning
+.extern arena_destroy
+.extern liveness_and_next_use
+# ==== start of definition of function `mips_let' ====
+.text
+mips_let:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L23;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L24;
+ldidw 17;
+jmp @L25;
+@L24:
+ldidw 13;
+@L25:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw mips_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L26;
+@L23:
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 16;
+ldw;
+ldbp 16;
+ldw;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L27;
+ldiqw @S31;
+jmp @L28;
+@L27:
+ldiqw @S32;
+@L28:
+ldiqw @S33;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S34;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L29:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L30:
+ldidw 0;
+jmpf @L31;
+jmp @L29;
+@L31:
+@L26:
+ldidw 0;
+ret;
+.extern is_struct_union_enum
+.extern get_sizeof
+.extern emit_error
+.extern get_curr_scope_id
+# ==== start of definition of function `mips_post_call' ====
+.text
+mips_post_call:
+addsp 0;         
+ldiqw arg_offs;
+lddw;
+ldiqw max_arg_offs;
+lddw;
+sgtdw;
+jmpf @L32;
+ldiqw arg_offs;
+lddw;
+ldiqw max_arg_offs;
+stdw;
+pop;
+@L32:
+ldidw 0;
+ldiqw arg_offs;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern getenv
+.extern can_assign_to
+.extern atoi
+# ==== start of definition of function `mips_ch' ====
+.text
+mips_ch:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldw;
+ldbp 4;
+ldw;
+ldiqw @S35;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S36;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L33:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L34:
+ldidw 0;
+jmpf @L35;
+jmp @L33;
+@L35:
+ldidw 0;
+ret;
+.extern bset_member
+.extern exit
+# ==== start of definition of function `mips_eq' ====
+.text
+mips_eq:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L36;
+ldidw 8;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw mips_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L37;
+@L36:
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 2;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 16;
+ldw;
+ldbp 16;
+ldw;
+ldiqw @S37;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S38;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L38:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L39:
+ldidw 0;
+jmpf @L40;
+jmp @L38;
+@L40:
+@L37:
+ldidw 0;
+ret;
+.extern stderr
+.extern opt_level
+.extern restore_scope
+# ==== start of definition of function `mips_get_operand' ====
+.text
+mips_get_operand:
+addsp 8;         
+# param:`a', offset:-20
+# param:`imm', offset:-24
+# var: r, offset: 4
+.bss
+@mips_get_operand_op:
+.res 256
+.text
+ldbp -24;
+lddw;
+jmpf @L41;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L41;
+ldidw 1;
+jmp @L42;
+@L41:
+ldidw 0;
+@L42:
+jmpf @L43;
+# var: val, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L44;
+ldbp 8;
+lddw;
+ldidw 32768;
+negdw;
+sgetdw;
+jmpf @L45;
+ldbp 8;
+lddw;
+ldidw 32767;
+sletdw;
+jmpf @L45;
+ldidw 1;
+jmp @L46;
+@L45:
+ldidw 0;
+@L46:
+jmpf @L47;
+ldbp 8;
+lddw;
+ldiqw @S39;
+ldiqw @mips_get_operand_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw @mips_get_operand_op;
+ret;
+@L47:
+jmp @L48;
+@L44:
+ldbp 8;
+lddw;
+ldidw 0;
+sgetdw;
+jmpf @L49;
+ldbp 8;
+lddw;
+ldidw 65535;
+sletdw;
+jmpf @L49;
+ldidw 1;
+jmp @L50;
+@L49:
+ldidw 0;
+@L50:
+jmpf @L51;
+ldbp 8;
+lddw;
+ldiqw @S40;
+ldiqw @mips_get_operand_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw @mips_get_operand_op;
+ret;
+@L51:
+@L48:
+jmp @L52;
+@L43:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L53;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L53;
+ldidw 0;
+jmp @L54;
+@L53:
+ldidw 1;
+@L54:
+jmpf @L55;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L56;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S41;
+ldiqw @mips_get_operand_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw @mips_get_operand_op;
+ret;
+@L56:
+@L55:
+@L52:
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 4;
+stw;
+pop;
+ldbp -20;
+lddw;
+ldbp 4;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldw;
+ldiqw @S42;
+ldiqw @mips_get_operand_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw @mips_get_operand_op;
+ret;
+ldidw 0;
+ret;
+.extern nid2lnid
+.extern string_get_pos
+# ==== start of definition of function `mips_gt' ====
+.text
+mips_gt:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L57;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L58;
+ldidw 15;
+jmp @L59;
+@L58:
+ldidw 11;
+@L59:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw mips_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L60;
+@L57:
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 16;
+ldw;
+ldbp 16;
+ldw;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L61;
+ldiqw @S43;
+jmp @L62;
+@L61:
+ldiqw @S44;
+@L62:
+ldiqw @S45;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S46;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L63:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L64:
+ldidw 0;
+jmpf @L65;
+jmp @L63;
+@L65:
+@L60:
+ldidw 0;
+ret;
+.bss
+.align 8
+temp_list:
+.res 8
+.extern rewind
+.extern get_type_node
+.extern analyze_logical_operator
+.extern realloc
+# ==== start of definition of function `mips_uch' ====
+.text
+mips_uch:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldw;
+ldbp 4;
+ldw;
+ldiqw @S47;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S48;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L66:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L67:
+ldidw 0;
+jmpf @L68;
+jmp @L66;
+@L68:
+ldidw 0;
+ret;
+.extern lookup_ordinary_id
+.extern snprintf
+# ==== start of definition of function `mips_lt' ====
+.text
+mips_lt:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L69;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L70;
+ldidw 14;
+jmp @L71;
+@L70:
+ldidw 10;
+@L71:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw mips_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L72;
+@L69:
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 16;
+ldw;
+ldbp 16;
+ldw;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L73;
+ldiqw @S49;
+jmp @L74;
+@L73:
+ldiqw @S50;
+@L74:
+ldiqw @S51;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S52;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L75:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L76:
+ldidw 0;
+jmpf @L77;
+jmp @L75;
+@L77:
+@L72:
+ldidw 0;
+ret;
+.bss
+.align 8
+mips_output_file:
+.res 8
+.extern strpbrk
+.extern pop_struct_descriptor
+.extern nid2sid_tab
+# ==== start of definition of function `mips_or' ====
+.text
+mips_or:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L78;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L78;
+ldidw 0;
+jmp @L79;
+@L78:
+ldidw 1;
+@L79:
+jmpf @L80;
+# var: op, offset: 8
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 16;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S53;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S54;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S55;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S56;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L81:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L82:
+ldidw 0;
+jmpf @L83;
+jmp @L81;
+@L83:
+jmp @L84;
+@L80:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 2;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S57;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S58;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L85:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L86:
+ldidw 0;
+jmpf @L87;
+jmp @L85;
+@L87:
+@L84:
+ldidw 0;
+ret;
+# ==== start of definition of function `dump_reg_descr_tab' ====
+.text
+dump_reg_descr_tab:
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L88:
+ldbp 4;
+lddw;
+ldidw 32;
+sltdw;
+jmpf @L90;
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L91;
+ldiqw nid2sid_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 4;
+lddw;
+ldiqw @S59;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+@L91:
+@L89:
+incldw 4;
+jmp @L88;
+@L90:
+ldidw 0;
+ret;
+.extern fseek
+.extern string_set_pos
+.extern push_struct_descriptor
+# ==== start of definition of function `mips_div' ====
+.text
+mips_div:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L92;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L92;
+ldidw 0;
+jmp @L93;
+@L92:
+ldidw 1;
+@L93:
+jmpf @L94;
+ldbp 4;
+lddw;
+ldiqw is_signed_int;
+call 4;
+pop;
+jmpf @L95;
+ldidw 1;
+jmp @L96;
+@L95:
+ldidw 2;
+@L96:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw mips_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L97;
+@L94:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldbp 4;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L98;
+ldiqw @S60;
+jmp @L99;
+@L98:
+ldiqw @S61;
+@L99:
+ldiqw @S62;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S63;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L100:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L101:
+ldidw 0;
+jmpf @L102;
+jmp @L100;
+@L102:
+@L97:
+ldidw 0;
+ret;
+# ==== start of definition of function `mips_sh' ====
+.text
+mips_sh:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldw;
+ldbp 4;
+ldw;
+ldiqw @S64;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S65;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L103:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L104:
+ldidw 0;
+jmpf @L105;
+jmp @L103;
+@L105:
+ldidw 0;
+ret;
+# ==== start of definition of function `mips_allocate_static_objects' ====
+.text
+mips_allocate_static_objects:
+addsp 52;        
+# var: np, offset: 8
+ldiqw static_objects_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L106:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L108;
+# var: al, offset: 16
+# var: ty, offset: 24
+# var: initzr, offset: 40
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L109;
+@L110:
+ldiqw curr_segment;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L113;
+ldiqw str_segment;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw @S66;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S67;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw curr_segment;
+stdw;
+pop;
+@L113:
+@L111:
+ldidw 0;
+jmpf @L112;
+jmp @L110;
+@L112:
+ldbp 16;
+lddw;
+ldidw 1;
+ugtdw;
+jmpf @L114;
+ldbp 16;
+lddw;
+ldiqw @S68;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S69;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L114:
+jmp @L115;
+@L109:
+@L116:
+ldiqw curr_segment;
+lddw;
+ldidw 2;
+neqdw;
+jmpf @L119;
+ldiqw str_segment;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw @S70;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S71;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 2;
+ldiqw curr_segment;
+stdw;
+pop;
+@L119:
+@L117:
+ldidw 0;
+jmpf @L118;
+jmp @L116;
+@L118:
+ldbp 16;
+lddw;
+ldidw 1;
+ugtdw;
+jmpf @L120;
+ldbp 16;
+lddw;
+ldiqw @S72;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S73;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L120:
+@L115:
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw enclosing_function;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L121;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw @S74;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S75;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L122;
+@L121:
+# var: scs, offset: 48
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 48;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L123;
+ldbp 48;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L123;
+ldidw 0;
+jmp @L124;
+@L123:
+ldidw 1;
+@L124:
+jmpf @L125;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S76;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S77;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L125:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S78;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S79;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L122:
+ldbp 40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L126;
+ldbp 40;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw mips_static_init;
+call 24;
+pop;
+pop;
+jmp @L127;
+@L126:
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S80;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S81;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L127:
+@L107:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L106;
+@L108:
+ldidw 0;
+ret;
+.bss
+.align 8
+func_epilog:
+.res 8
+.extern sscanf
+.extern fputc
+# ==== start of definition of function `mips_switch' ====
+.text
+mips_switch:
+addsp 316;       
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: res, offset: 8
+# var: def_val, offset: 12
+# var: lab_arena, offset: 16
+# var: jmp_tab, offset: 24
+# var: def_lab, offset: 32
+# var: ncase, offset: 288
+# var: min, offset: 292
+# var: max, offset: 296
+# var: interval_size, offset: 300
+# var: holes, offset: 304
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L128;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L128;
+ldidw 0;
+jmp @L129;
+@L128:
+ldidw 1;
+@L129:
+jmpf @L130;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw mips_do_switch64;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L130:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L131;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+jmp @L132;
+@L131:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+stw;
+pop;
+@L132:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+subqw;
+pop;
+ldbp 288;
+stdw;
+pop;
+incldw -20;
+ldbp 288;
+lddw;
+ldidw 3;
+sgetdw;
+jmpf @L133;
+# var: case_start, offset: 308
+ldbp -20;
+lddw;
+ldbp 308;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 296;
+stdw;
+ldbp 292;
+stdw;
+pop;
+incldw -20;
+@L134:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ordw;
+jmpf @L137;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 12;
+stdw;
+pop;
+jmp @L136;
+@L137:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 292;
+lddw;
+dw2qw;
+sltqw;
+jmpf @L138;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 292;
+stdw;
+pop;
+jmp @L139;
+@L138:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 296;
+lddw;
+dw2qw;
+sgtqw;
+jmpf @L140;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 296;
+stdw;
+pop;
+@L140:
+@L139:
+@L135:
+incldw -20;
+jmp @L134;
+@L136:
+ldbp 308;
+lddw;
+ldbp -20;
+stdw;
+pop;
+ldbp 296;
+lddw;
+ldbp 292;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+ldbp 300;
+stdw;
+pop;
+ldbp 300;
+lddw;
+ldbp 288;
+lddw;
+subdw;
+ldbp 304;
+stdw;
+pop;
+ldbp 304;
+lddw;
+ldidw 10;
+sletdw;
+jmpf @L141;
+jmp @@mips_switch_jump_table;
+@L141:
+@L133:
+jmp @@mips_switch_linear_search;
+@@mips_switch_jump_table:
+ldbp 296;
+lddw;
+ldiqw @S82;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S83;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldidw 25;
+ldbp 8;
+ldw;
+ldiqw @S84;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S85;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S86;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S87;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 292;
+lddw;
+ldiqw @S88;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S89;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldidw 25;
+ldbp 8;
+ldw;
+ldiqw @S90;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S91;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S92;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S93;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 292;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L142;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S94;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S95;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L142:
+ldiqw jump_tables_counter;
+lddw;
+ldiqw @S96;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S97;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S98;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S99;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S100;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S101;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S102;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S103;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldiqw @S104;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S105;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S106;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S107;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 8;
+ldbp 300;
+lddw;
+dw2qw;
+ldiqw calloc;
+call 16;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 300;
+lddw;
+ldidw 256;
+muldw;
+ldiqw arena_new;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S108;
+ldbp 32;
+ldiqw sprintf;
+call 28;
+pop;
+pop;
+@L143:
+# var: s, offset: 312
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ordw;
+jmpf @L146;
+jmp @L145;
+@L146:
+ldidw 256;
+ldbp 16;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 312;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw @S109;
+ldbp 312;
+ldqw;
+ldiqw sprintf;
+call 28;
+pop;
+pop;
+ldbp 312;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 292;
+lddw;
+dw2qw;
+subqw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L144:
+incldw -20;
+jmp @L143;
+@L145:
+ldidw 0;
+ldbp -20;
+stdw;
+pop;
+@L147:
+ldbp 304;
+lddw;
+jmpf @L149;
+ldbp 24;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L150;
+ldbp 32;
+ldbp 24;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+decldw 304;
+@L150:
+@L148:
+incldw -20;
+jmp @L147;
+@L149:
+@L151:
+ldiqw curr_segment;
+lddw;
+ldidw 3;
+neqdw;
+jmpf @L154;
+ldiqw str_segment;
+ldidw 3;
+dw2qw;
+ldxqw 8;
+ldiqw @S110;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S111;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 3;
+ldiqw curr_segment;
+stdw;
+pop;
+@L154:
+@L152:
+ldidw 0;
+jmpf @L153;
+jmp @L151;
+@L153:
+ldiqw jump_tables_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S112;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S113;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp -20;
+stdw;
+pop;
+@L155:
+ldbp -20;
+lddw;
+ldbp 300;
+lddw;
+sltdw;
+jmpf @L157;
+ldbp 24;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S114;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S115;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L156:
+incldw -20;
+jmp @L155;
+@L157:
+@L158:
+ldiqw curr_segment;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L161;
+ldiqw str_segment;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S116;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S117;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw curr_segment;
+stdw;
+pop;
+@L161:
+@L159:
+ldidw 0;
+jmpf @L160;
+jmp @L158;
+@L160:
+ldbp 24;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw arena_destroy;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@@mips_switch_linear_search:
+@L162:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ordw;
+jmpf @L165;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw @S118;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S119;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S120;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S121;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L164;
+@L165:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S122;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S123;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldidw 25;
+ldbp 8;
+ldw;
+ldiqw @S124;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S125;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S126;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S127;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L163:
+incldw -20;
+jmp @L162;
+@L164:
+ldidw 0;
+ret;
+# ==== start of definition of function `emit_raw_string' ====
+.text
+emit_raw_string:
+addsp 8;         
+# param:`q', offset:-24
+# param:`s', offset:-32
+# var: len, offset: 4
+# var: i, offset: 8
+ldbp -32;
+ldqw;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+udivdw;
+ldbp 8;
+stdw;
+pop;
+@L166:
+ldbp 8;
+lddw;
+jmpf @L168;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxb 1;
+ldbp -32;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxb 1;
+ldbp -32;
+ldqw;
+ldidw 2;
+dw2qw;
+ldxb 1;
+ldbp -32;
+ldqw;
+ldidw 3;
+dw2qw;
+ldxb 1;
+ldiqw @S128;
+ldbp -24;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldidw 4;
+dw2qw;
+addqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L167:
+decldw 8;
+jmp @L166;
+@L168:
+ldbp 4;
+lddw;
+ldidw 4;
+umoddw;
+ldbp 8;
+stdw;
+pop;
+@L169:
+ldbp 8;
+lddw;
+jmpf @L171;
+ldbp -32;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldb;
+ldiqw @S129;
+ldbp -24;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+@L170:
+decldw 8;
+jmp @L169;
+@L171:
+ldidw 0;
+ret;
+.extern vsscanf
+.extern dflow_enter_function
+# ==== start of definition of function `get_reg0' ====
+.text
+get_reg0:
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L172:
+ldbp 4;
+lddw;
+ldidw 32;
+sltdw;
+jmpf @L174;
+ldiqw pinned;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+notdw;
+jmpf @L175;
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+jmpf @L175;
+ldidw 1;
+jmp @L176;
+@L175:
+ldidw 0;
+@L176:
+jmpf @L177;
+ldbp 4;
+lddw;
+dw2w;
+dw2qw;
+ret;
+@L177:
+@L173:
+incldw 4;
+jmp @L172;
+@L174:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L178:
+ldbp 4;
+lddw;
+ldidw 32;
+sltdw;
+jmpf @L180;
+ldiqw pinned;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+notdw;
+jmpf @L181;
+ldbp 4;
+lddw;
+dw2w;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldbp 4;
+lddw;
+dw2w;
+dw2qw;
+ret;
+@L181:
+@L179:
+incldw 4;
+jmp @L178;
+@L180:
+@L182:
+ldidw 0;
+notdw;
+jmpf @L185;
+ldidw 239;
+ldiqw @S130;
+ldiqw @S131;
+ldiqw @S132;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L185:
+@L183:
+ldidw 0;
+jmpf @L184;
+jmp @L182;
+@L184:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `get_reg2' ====
+.text
+get_reg2:
+addsp 8;         
+# param:`i', offset:-20
+# var: r, offset: 4
+# var: arg1, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L188;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L188;
+ldidw 0;
+jmp @L189;
+@L188:
+ldidw 1;
+@L189:
+notdw;
+jmpf @L186;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+notdw;
+jmpf @L186;
+ldidw 1;
+jmp @L187;
+@L186:
+ldidw 0;
+@L187:
+jmpf @L190;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L191;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+jmp @L192;
+@L191:
+ldiqw get_reg0;
+call 0;
+pop;
+@L192:
+dw2w;
+ldbp 4;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L193;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+jmp @L194;
+@L193:
+ldiqw get_reg0;
+call 0;
+pop;
+@L194:
+dw2w;
+ldbp 4;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L195;
+@L190:
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 4;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 4;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L195:
+ldbp 4;
+ldiqw __temp_struct;
+swap2;
+memcpy 4;
+ret;
+ldidw 0;
+ret;
+.extern fwrite
+.extern is_pointer
+.extern colored_diagnostics
+.extern string_curr
+.extern read_stream
+# ==== start of definition of function `mips_ush' ====
+.text
+mips_ush:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldw;
+ldbp 4;
+ldw;
+ldiqw @S133;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S134;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L196:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L197:
+ldidw 0;
+jmpf @L198;
+jmp @L196;
+@L198:
+ldidw 0;
+ret;
+.extern strspn
+.bss
+.align 4
+calls_to_fix_counter:
+.res 4
+.extern reset_enum_val
+.extern strtoll
+# ==== start of definition of function `mips_load' ====
+.text
+mips_load:
+addsp 20;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L199;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp -20;
+ldw;
+ldiqw @S135;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S136;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L200;
+@L199:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L201;
+ldbp -24;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldbp -20;
+ldw;
+ldiqw @S137;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S138;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L202;
+@L201:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L203;
+# var: e, offset: 8
+# var: ld_str, offset: 16
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L204;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldw;
+eqdw;
+jmpf @L205;
+jmp @L206;
+@L205:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldw;
+ldiqw @S139;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S140;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L206:
+ldiqw 0;
+ret;
+@L204:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T207;
+switch;
+@L209:
+@L210:
+@L211:
+@L212:
+ldbp -24;
+lddw;
+ldbp -20;
+ldw;
+ldiqw mips_load_addr;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L213:
+ldiqw @S141;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L208;
+@L214:
+ldiqw @S142;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L208;
+@L215:
+@L216:
+ldiqw @S143;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L208;
+@L217:
+ldiqw @S144;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L208;
+@L218:
+ldiqw @S145;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L208;
+@L208:
+.data
+.align 8
+@T207:
+.dword 10
+.dword 49
+.dword 64
+.dword 68
+.dword 71
+.dword 97
+.dword 98
+.dword 106
+.dword 107
+.dword 108
+.qword @L218
+.qword @L215
+.qword @L213
+.qword @L209
+.qword @L210
+.qword @L211
+.qword @L212
+.qword @L216
+.qword @L217
+.qword @L214
+.text
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L219;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L220;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S146;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 44;
+pop;
+pop;
+ldiqw @S147;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L221;
+@L220:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S148;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S149;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L221:
+jmp @L222;
+@L219:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -20;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S150;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S151;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L222:
+jmp @L223;
+@L203:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L224;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L225;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldw;
+eqdw;
+jmpf @L226;
+ldiqw 0;
+ret;
+jmp @L227;
+@L226:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldw;
+ldiqw @S152;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S153;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L227:
+jmp @L228;
+@L225:
+ldbp -24;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldbp -20;
+ldw;
+ldiqw @S154;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S155;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L228:
+@L224:
+@L223:
+@L202:
+@L200:
+ldidw 0;
+ret;
+.extern analyze_relational_equality_expression
+.extern get_var_nid
+# ==== start of definition of function `dump_addr_descr_tab' ====
+.text
+dump_addr_descr_tab:
+addsp 8;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L229:
+ldbp 4;
+lddw;
+ldiqw nid_counter;
+lddw;
+sltdw;
+jmpf @L231;
+# var: ad, offset: 8
+ldiqw addr_descr_tab;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L232;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L233;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw nid2sid_tab;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S156;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 32;
+pop;
+pop;
+jmp @L234;
+@L233:
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw nid2sid_tab;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S157;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+@L234:
+@L232:
+@L230:
+incldw 4;
+jmp @L229;
+@L231:
+ldidw 0;
+ret;
+.extern get_sto_class_spec
+.extern bset_cpy
+.extern string_free
+.extern fclose
+.extern preprocess
+# ==== start of definition of function `mips_get_operand2' ====
+.text
+mips_get_operand2:
+addsp 4;         
+# param:`a', offset:-20
+# var: r, offset: 4
+.bss
+@mips_get_operand2_op1:
+.res 256
+.bss
+@mips_get_operand2_op2:
+.res 256
+.text
+.data
+.align 8
+@mips_get_operand2_op:
+.align 8
+.qword @mips_get_operand2_op1+0
+.align 8
+.qword @mips_get_operand2_op2+0
+.text
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L237;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L237;
+ldidw 0;
+jmp @L238;
+@L237:
+ldidw 1;
+@L238:
+jmpf @L235;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L235;
+ldidw 1;
+jmp @L236;
+@L235:
+ldidw 0;
+@L236:
+jmpf @L239;
+@L240:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+notdw;
+jmpf @L243;
+ldidw 545;
+ldiqw @S158;
+ldiqw @S159;
+ldiqw @S160;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L243:
+@L241:
+ldidw 0;
+jmpf @L242;
+jmp @L240;
+@L242:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S161;
+ldiqw @mips_get_operand2_op1;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S162;
+ldiqw @mips_get_operand2_op2;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw @mips_get_operand2_op;
+ret;
+@L239:
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 4;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 4;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S163;
+ldiqw @mips_get_operand2_op1;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S164;
+ldiqw @mips_get_operand2_op2;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw @mips_get_operand2_op;
+ret;
+ldidw 0;
+ret;
+.extern analyze_decl_specs
+.extern strstr
+.extern calloc
+.extern pop_scope
+.extern memset
+.extern file_exists
+.extern include_libc
+.extern C_source
+.extern analyze_cast_expression
+.extern stringify_type_exp
+.extern add_quote_dir
+.extern stat_number_of_ast_nodes
+.extern strtoul
+.extern fprintf
+.extern get_type_qual
+.extern read_file
+# ==== start of definition of function `mips_load_addr' ====
+.text
+mips_load_addr:
+addsp 12;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+# var: e, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L244;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L245;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldbp -20;
+ldw;
+ldiqw @S165;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S166;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L246;
+@L245:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -20;
+ldw;
+ldiqw @S167;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S168;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L246:
+jmp @L247;
+@L244:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -20;
+ldw;
+ldiqw @S169;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S170;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L247:
+ldidw 0;
+ret;
+.extern address_taken_variables
+.extern is_signed_int
+.extern printf
+.extern get_c_token
+.extern lookup_tag
+.extern get_rank
+# ==== start of definition of function `update_arg_descriptors' ====
+.text
+update_arg_descriptors:
+addsp 0;         
+# param:`arg', offset:-20
+# param:`liveness', offset:-24
+# param:`next_use', offset:-28
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L250;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L250;
+ldidw 0;
+jmp @L251;
+@L250:
+ldidw 1;
+@L251:
+jmpt @L248;
+ldbp -28;
+lddw;
+jmpt @L248;
+ldidw 0;
+jmp @L249;
+@L248:
+ldidw 1;
+@L249:
+jmpf @L252;
+ldiqw 0;
+ret;
+@L252:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L253;
+ldbp -24;
+ldub;
+jmpf @L254;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L255;
+ldbp -20;
+lddw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldn 4;
+ldiqw mips_store2;
+call 8;
+pop;
+pop;
+jmp @L256;
+@L255:
+ldbp -20;
+lddw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw mips_store;
+call 8;
+pop;
+pop;
+@L256:
+jmp @L257;
+@L254:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L258;
+ldbp -20;
+lddw;
+ldiqw free_temp;
+call 4;
+pop;
+pop;
+@L258:
+@L257:
+ldidw 0;
+ldiqw reg_descr_tab;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L259;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L259:
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+stw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+jmp @L260;
+@L253:
+ldbp -24;
+ldub;
+jmpf @L261;
+jmp @L262;
+@L261:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L263;
+ldbp -20;
+lddw;
+ldiqw free_temp;
+call 4;
+pop;
+pop;
+@L263:
+@L262:
+@L260:
+ldidw 0;
+ret;
+.extern is_external_id
+.extern sprintf
+.extern strcat
+# ==== start of definition of function `mips_mul' ====
+.text
+mips_mul:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L264;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L264;
+ldidw 0;
+jmp @L265;
+@L264:
+ldidw 1;
+@L265:
+jmpf @L266;
+ldidw 0;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw mips_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L267;
+@L266:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S171;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S172;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L268:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L269:
+ldidw 0;
+jmpf @L270;
+jmp @L268;
+@L270:
+@L267:
+ldidw 0;
+ret;
+.extern are_compatible
+# ==== start of definition of function `mips_ind' ====
+.text
+mips_ind:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw spill_aliased_objects;
+call 0;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L271;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L271;
+ldidw 0;
+jmp @L272;
+@L271:
+ldidw 1;
+@L272:
+jmpf @L273;
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S173;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S174;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S175;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S176;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L274:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L275:
+ldidw 0;
+jmpf @L276;
+jmp @L274;
+@L276:
+jmp @L277;
+@L273:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @T278;
+switch;
+@L280:
+@L281:
+jmp @L279;
+@L282:
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S177;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S178;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L279;
+@L283:
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S179;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S180;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L279;
+@L284:
+@L285:
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S181;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S182;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L279;
+@L286:
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S183;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S184;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L279;
+@L287:
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S185;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S186;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L279;
+@L279:
+.data
+.align 8
+@T278:
+.dword 8
+.dword 49
+.dword 64
+.dword 68
+.dword 71
+.dword 106
+.dword 107
+.dword 108
+.qword @L287
+.qword @L284
+.qword @L282
+.qword @L280
+.qword @L281
+.qword @L285
+.qword @L286
+.qword @L283
+.text
+@L288:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L289:
+ldidw 0;
+jmpf @L290;
+jmp @L288;
+@L290:
+@L277:
+ldidw 0;
+ret;
+.extern error_count
+# ==== start of definition of function `mips_cmpl' ====
+.text
+mips_cmpl:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L291;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L291;
+ldidw 0;
+jmp @L292;
+@L291:
+ldidw 1;
+@L292:
+jmpf @L293;
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S187;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S188;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S189;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S190;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L294:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L295:
+ldidw 0;
+jmpf @L296;
+jmp @L294;
+@L296:
+jmp @L297;
+@L293:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S191;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S192;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L298:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L299:
+ldidw 0;
+jmpf @L300;
+jmp @L298;
+@L300:
+@L297:
+ldidw 0;
+ret;
+.extern free_pre_token
+.extern cg_nodes_counter
+.extern round_up
+# ==== start of definition of function `mips_restore_arg_regs' ====
+.text
+mips_restore_arg_regs:
+addsp 0;         
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+sdivdw;
+ldiqw @T301;
+jmptab;
+@L303:
+jmp @L302;
+@L304:
+ldiqw @S193;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S194;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S195;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S196;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L302;
+@L305:
+ldiqw @S197;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S198;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S199;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S200;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S201;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S202;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L302;
+@L306:
+ldiqw @S203;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S204;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S205;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S206;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S207;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S208;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S209;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S210;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L302;
+@L307:
+ldiqw @S211;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S212;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S213;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S214;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S215;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S216;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S217;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S218;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S219;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S220;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L302;
+@L302:
+.data
+.align 8
+@T301:
+.dword 0
+.dword 4
+.qword @L307
+.qword @L303
+.qword @L304
+.qword @L305
+.qword @L306
+.text
+ldidw 0;
+ret;
+.extern analyze_declarator
+# ==== start of definition of function `free_all_temps' ====
+.text
+free_all_temps:
+addsp 20;        
+# var: p, offset: 8
+# var: q, offset: 16
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L308:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L309;
+ldbp 8;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+jmp @L308;
+@L309:
+ldidw 0;
+dw2qw;
+ldiqw temp_list;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+func_prolog:
+.res 8
+.extern include_liblux
+.extern stat_number_of_pre_tokens
+.data
+.align 8
+libfuncs:
+.align 8
+.qword @S221+0
+.align 8
+.qword @S222+0
+.align 8
+.qword @S223+0
+.align 8
+.qword @S224+0
+.align 8
+.qword @S225+0
+.align 8
+.qword @S226+0
+.align 8
+.qword @S227+0
+.align 8
+.qword @S228+0
+.align 8
+.qword @S229+0
+.align 8
+.qword @S230+0
+.align 8
+.qword @S231+0
+.align 8
+.qword @S232+0
+.align 8
+.qword @S233+0
+.align 8
+.qword @S234+0
+.align 8
+.qword @S235+0
+.align 8
+.qword @S236+0
+.align 8
+.qword @S237+0
+.align 8
+.qword @S238+0
+.extern bset_eq
+.extern strchr
+# ==== start of definition of function `mips_add' ====
+.text
+mips_add:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L310;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L310;
+ldidw 0;
+jmp @L311;
+@L310:
+ldidw 1;
+@L311:
+jmpf @L312;
+# var: op, offset: 8
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 16;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S239;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S240;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S241;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S242;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S243;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S244;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S245;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S246;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L313:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L314:
+ldidw 0;
+jmpf @L315;
+jmp @L313;
+@L315:
+jmp @L316;
+@L312:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S247;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S248;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L317:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L318:
+ldidw 0;
+jmpf @L319;
+jmp @L317;
+@L319:
+@L316:
+ldidw 0;
+ret;
+# ==== start of definition of function `mips_rem' ====
+.text
+mips_rem:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L320;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L320;
+ldidw 0;
+jmp @L321;
+@L320:
+ldidw 1;
+@L321:
+jmpf @L322;
+ldbp 4;
+lddw;
+ldiqw is_signed_int;
+call 4;
+pop;
+jmpf @L323;
+ldidw 3;
+jmp @L324;
+@L323:
+ldidw 4;
+@L324:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw mips_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L325;
+@L322:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldbp 4;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L326;
+ldiqw @S249;
+jmp @L327;
+@L326:
+ldiqw @S250;
+@L327:
+ldiqw @S251;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S252;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L328:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L329:
+ldidw 0;
+jmpf @L330;
+jmp @L328;
+@L330:
+@L325:
+ldidw 0;
+ret;
+# ==== start of definition of function `mips_ret' ====
+.text
+mips_ret:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldiqw qword_return;
+lddw;
+jmpf @L331;
+# var: r, offset: 4
+ldidw 2;
+dw2w;
+ldbp 4;
+stw;
+pop;
+ldidw 3;
+dw2w;
+ldbp 6;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+jmp @L332;
+@L331:
+ldiqw big_return;
+lddw;
+jmpf @L333;
+ldiqw @S253;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S254;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S255;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S256;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S257;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S258;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldidw 25;
+dw2w;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldiqw @S259;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S260;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S261;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S262;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S263;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S264;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S265;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S266;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S267;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S268;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S269;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S270;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L334;
+@L333:
+ldbp -28;
+lddw;
+ldidw 2;
+dw2w;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+@L334:
+@L332:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern add_angle_dir
+.extern analyze_conditional_expression
+.extern ic_outpath
+.extern arena_alloc
+.bss
+.align 4
+calls_to_fix:
+.res 256
+.extern stdout
+.extern get_type_category
+.extern ilog2
+.extern strcmp
+# ==== start of definition of function `mips_addr_of' ====
+.text
+mips_addr_of:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 4;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldw;
+ldiqw mips_load_addr;
+call 8;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+func_body:
+.res 8
+.extern bset_fill
+.extern strtok
+.extern strtol
+.extern parse_header
+.extern stdin
+.extern dflow_Dom
+.extern is_integer
+# ==== start of definition of function `mips_neg' ====
+.text
+mips_neg:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L335;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L335;
+ldidw 0;
+jmp @L336;
+@L335:
+ldidw 1;
+@L336:
+jmpf @L337;
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S271;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S272;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S273;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S274;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S275;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S276;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S277;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S278;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L338:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L339:
+ldidw 0;
+jmpf @L340;
+jmp @L338;
+@L340:
+jmp @L341;
+@L337:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S279;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S280;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L342:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L343:
+ldidw 0;
+jmpf @L344;
+jmp @L342;
+@L344:
+@L341:
+ldidw 0;
+ret;
+.extern analyze_postfix_expression
+.extern ftell
+.extern strcpy
+# ==== start of definition of function `mips_neq' ====
+.text
+mips_neq:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L345;
+ldidw 9;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw mips_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L346;
+@L345:
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 2;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 16;
+ldw;
+ldbp 16;
+ldw;
+ldiqw @S281;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S282;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L347:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L348:
+ldidw 0;
+jmpf @L349;
+jmp @L347;
+@L349:
+@L346:
+ldidw 0;
+ret;
+.extern install_tag
+# ==== start of definition of function `mips_store2' ====
+.text
+mips_store2:
+addsp 12;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L350;
+# var: e, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L351;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L352;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S283;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S284;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S285;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S286;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L353;
+@L352:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S287;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S288;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S289;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S290;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L353:
+jmp @L354;
+@L351:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S291;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S292;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 4;
+adddw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S293;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S294;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L354:
+jmp @L355;
+@L350:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L356;
+# var: offs, offset: 4
+ldbp -24;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S295;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S296;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+adddw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S297;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S298;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L356:
+@L355:
+ldidw 0;
+ret;
+# ==== start of definition of function `spill_aliased_objects' ====
+.text
+spill_aliased_objects:
+addsp 8;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L357:
+ldbp 4;
+lddw;
+ldidw 32;
+sltdw;
+jmpf @L359;
+# var: a, offset: 8
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+jmpf @L360;
+jmp @L358;
+@L360:
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L361;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw address_taken_variables;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L361;
+ldidw 1;
+jmp @L362;
+@L361:
+ldidw 0;
+@L362:
+jmpf @L363;
+ldbp 4;
+lddw;
+dw2w;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+@L363:
+@L358:
+incldw 4;
+jmp @L357;
+@L359:
+ldidw 0;
+ret;
+# ==== start of definition of function `mips_and' ====
+.text
+mips_and:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L364;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L364;
+ldidw 0;
+jmp @L365;
+@L364:
+ldidw 1;
+@L365:
+jmpf @L366;
+# var: op, offset: 8
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 16;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S299;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S300;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S301;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S302;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L367:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L368:
+ldidw 0;
+jmpf @L369;
+jmp @L367;
+@L369:
+jmp @L370;
+@L366:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 2;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S303;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S304;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L371:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L372:
+ldidw 0;
+jmpf @L373;
+jmp @L371;
+@L373:
+@L370:
+ldidw 0;
+ret;
+# ==== start of definition of function `mips_do_switch64' ====
+.text
+mips_do_switch64:
+addsp 12;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+.bss
+.align 4
+@mips_do_switch64_nlab:
+.res 4
+.text
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L374;
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 4;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+jmp @L375;
+@L374:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldbp 4;
+swap2;
+memcpy 4;
+pop;
+pop;
+@L375:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+incldw -20;
+@L376:
+# var: p, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ordw;
+jmpf @L379;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw @S305;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S306;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L378;
+@L379:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldiqw @S307;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S308;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @mips_do_switch64_nlab;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S309;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S310;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S311;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S312;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldiqw @S313;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S314;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldidw 25;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S315;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S316;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S317;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S318;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @mips_do_switch64_nlab;
+lddw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S319;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S320;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @mips_do_switch64_nlab;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+@L377:
+incldw -20;
+jmp @L376;
+@L378:
+ldidw 0;
+ret;
+.extern ic_function_to_print
+.extern strtoull
+.bss
+.align 4
+temp_struct_size:
+.res 4
+.extern strlen
+.extern token_table
+.extern string_vprintf
+# ==== start of definition of function `mips_save_arg_regs' ====
+.text
+mips_save_arg_regs:
+addsp 0;         
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+sdivdw;
+ldiqw @T380;
+jmptab;
+@L382:
+jmp @L381;
+@L383:
+ldiqw @S321;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S322;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S323;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S324;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L381;
+@L384:
+ldiqw @S325;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S326;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S327;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S328;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S329;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S330;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L381;
+@L385:
+ldiqw @S331;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S332;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S333;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S334;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S335;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S336;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S337;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S338;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L381;
+@L386:
+ldiqw @S339;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S340;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S341;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S342;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S343;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S344;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S345;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S346;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S347;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S348;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L381;
+@L381:
+.data
+.align 8
+@T380:
+.dword 0
+.dword 4
+.qword @L386
+.qword @L382
+.qword @L383
+.qword @L384
+.qword @L385
+.text
+ldidw 0;
+ret;
+.extern bset_free
+.bss
+.align 4
+jump_tables_counter:
+.res 4
+.extern analyze_expression
+# ==== start of definition of function `mips_static_init' ====
+.text
+mips_static_init:
+addsp 68;        
+# param:`ds', offset:-24
+# param:`dct', offset:-32
+# param:`e', offset:-40
+# var: ts, offset: 8
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L387;
+# var: nelem, offset: 16
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L388;
+jmp @@mips_static_init_scalar;
+@L388:
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L389;
+# var: n, offset: 20
+ldidw 0;
+dw2b;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 16;
+lddw;
+ldidw 1;
+subdw;
+udw2qw;
+addqw;
+stb;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw asm_decls;
+ldqw;
+ldiqw emit_raw_string;
+call 16;
+pop;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldbp 20;
+stdw;
+ldbp 16;
+lddw;
+ultdw;
+jmpf @L390;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+subdw;
+ldiqw @S349;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S350;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L390:
+jmp @L391;
+@L389:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L392:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L394;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw mips_static_init;
+call 24;
+pop;
+pop;
+@L393:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 16;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+jmp @L392;
+@L394:
+ldbp 16;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L395;
+# var: ty, offset: 24
+ldbp -24;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw @S351;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S352;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+muldw;
+ldiqw @S353;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S354;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L395:
+@L391:
+jmp @L396;
+@L387:
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 68;
+eqdw;
+jmpf @L397;
+# var: d, offset: 16
+# var: full_init, offset: 24
+# var: ty, offset: 32
+# var: align, offset: 48
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 32;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 32;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 48;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L398;
+ldbp 48;
+lddw;
+ldiqw @S355;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S356;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L398:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L399:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L401;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L402:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L405;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L405;
+ldidw 1;
+jmp @L406;
+@L405:
+ldidw 0;
+@L406:
+jmpf @L404;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw mips_static_init;
+call 24;
+pop;
+pop;
+@L403:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L402;
+@L404:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L407;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L408;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L408;
+ldidw 1;
+jmp @L409;
+@L408:
+ldidw 0;
+@L409:
+jmpf @L410;
+ldidw 1;
+ldbp 24;
+stdw;
+pop;
+@L410:
+jmp @L401;
+@L407:
+@L400:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L399;
+@L401:
+ldbp 24;
+lddw;
+notdw;
+jmpf @L411;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L412;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L412:
+@L413:
+ldidw 1;
+jmpf @L414;
+@L415:
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L416;
+# var: ty, offset: 56
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 56;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw @S357;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S358;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 56;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S359;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S360;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L415;
+@L416:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L417;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L418;
+@L417:
+jmp @L414;
+@L418:
+jmp @L413;
+@L414:
+@L411:
+jmp @L419;
+@L397:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+jmpf @L420;
+# var: ty, offset: 16
+# var: align, offset: 32
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 32;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L421;
+ldbp 32;
+lddw;
+ldiqw @S361;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S362;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L421:
+ldbp -40;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw mips_static_init;
+call 24;
+pop;
+pop;
+jmp @L422;
+@L420:
+# var: dest_ty, offset: 16
+@@mips_static_init_scalar:
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L423;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+eqdw;
+jmpf @L423;
+ldidw 1;
+jmp @L424;
+@L423:
+ldidw 0;
+@L424:
+jmpf @L425;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L425:
+ldbp -24;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T426;
+switch;
+@L428:
+@L429:
+@L430:
+ldiqw @S363;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L427;
+@L431:
+@L432:
+ldiqw @S364;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S365;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S366;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L427;
+@L433:
+@L434:
+# var: v, offset: 32
+ldiqw @S367;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S368;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S369;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -40;
+ldqw;
+ldiqw mips_static_expr;
+call 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldiqw @S370;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S371;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S372;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldiqw @S373;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S374;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L435:
+ldiqw @S375;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S376;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S377;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L427;
+@L427:
+.data
+.align 8
+@T426:
+.dword 8
+.dword 49
+.dword 64
+.dword 106
+.dword 107
+.dword 108
+.dword 110
+.dword 111
+.qword @L435
+.qword @L428
+.qword @L431
+.qword @L429
+.qword @L430
+.qword @L432
+.qword @L433
+.qword @L434
+.text
+ldbp -40;
+ldqw;
+ldiqw mips_static_expr;
+call 8;
+pop;
+ldiqw @S378;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S379;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L422:
+@L419:
+@L396:
+ldidw 0;
+ret;
+# ==== start of definition of function `mips_arg' ====
+.text
+mips_arg:
+addsp 36;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: ty, offset: 8
+ldbp -32;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L436;
+# var: siz, offset: 16
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldiqw temp_struct_size;
+lddw;
+ugtdw;
+jmpf @L437;
+ldbp 16;
+lddw;
+ldiqw temp_struct_size;
+stdw;
+pop;
+@L437:
+ldiqw func_body;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldiqw calls_to_fix;
+ldiqw calls_to_fix_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw @S380;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S381;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+adddw;
+ldiqw arg_offs;
+stdw;
+pop;
+ldiqw 0;
+ret;
+@L436:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L438:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L441;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+neqdw;
+jmpt @L441;
+ldidw 0;
+jmp @L442;
+@L441:
+ldidw 1;
+@L442:
+notdw;
+jmpf @L443;
+ldidw 1691;
+ldiqw @S382;
+ldiqw @S383;
+ldiqw @S384;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L443:
+@L439:
+ldidw 0;
+jmpf @L440;
+jmp @L438;
+@L440:
+ldbp 8;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L444;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L444;
+ldidw 0;
+jmp @L445;
+@L444:
+ldidw 1;
+@L445:
+jmpf @L446;
+ldidw 8;
+ldiqw arg_offs;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldiqw arg_offs;
+stdw;
+pop;
+ldiqw arg_offs;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L447;
+# var: r, offset: 16
+ldidw 4;
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+sdivdw;
+adddw;
+dw2w;
+ldbp 16;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+adddw;
+dw2w;
+ldbp 16;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+jmp @L448;
+@L447:
+# var: op, offset: 16
+ldbp -28;
+lddw;
+ldiqw mips_get_operand2;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw arg_offs;
+lddw;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw @S385;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S386;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+adddw;
+ldbp 16;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S387;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S388;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L448:
+ldiqw arg_offs;
+lddw;
+ldidw 8;
+adddw;
+ldiqw arg_offs;
+stdw;
+pop;
+jmp @L449;
+@L446:
+ldbp 4;
+lddw;
+ldidw 68;
+eqdw;
+jmpt @L450;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L450;
+ldidw 0;
+jmp @L451;
+@L450:
+ldidw 1;
+@L451:
+jmpf @L452;
+# var: siz, offset: 16
+# var: asiz, offset: 20
+ldbp 8;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldidw 4;
+ldbp 16;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw arg_offs;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldiqw arg_offs;
+stdw;
+pop;
+ldiqw arg_offs;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L453;
+# var: nr, offset: 24
+# var: ar, offset: 28
+# var: r, offset: 32
+ldbp 20;
+lddw;
+ldidw 4;
+udivdw;
+ldbp 24;
+stdw;
+pop;
+ldidw 4;
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+sdivdw;
+subdw;
+ldbp 28;
+stdw;
+pop;
+ldidw 4;
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+sdivdw;
+adddw;
+dw2w;
+ldbp 32;
+stw;
+pop;
+ldbp 24;
+lddw;
+ldbp 28;
+lddw;
+sletdw;
+jmpf @L454;
+ldbp -28;
+lddw;
+ldidw 25;
+dw2w;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldiqw @T455;
+jmptab;
+@L457:
+ldbp 32;
+ldw;
+ldiqw @S389;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S390;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L456;
+@L458:
+ldbp 32;
+ldw;
+ldiqw @S391;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S392;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldw;
+ldidw 1;
+adddw;
+ldiqw @S393;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S394;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L456;
+@L459:
+ldbp 32;
+ldw;
+ldiqw @S395;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S396;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldw;
+ldidw 1;
+adddw;
+ldiqw @S397;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S398;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldw;
+ldidw 2;
+adddw;
+ldiqw @S399;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S400;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L456;
+@L460:
+ldbp 32;
+ldw;
+ldiqw @S401;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S402;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldw;
+ldidw 1;
+adddw;
+ldiqw @S403;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S404;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldw;
+ldidw 2;
+adddw;
+ldiqw @S405;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S406;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldw;
+ldidw 3;
+adddw;
+ldiqw @S407;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S408;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L456;
+@L456:
+.data
+.align 8
+@T455:
+.dword 1
+.dword 4
+.qword @L456
+.qword @L457
+.qword @L458
+.qword @L459
+.qword @L460
+.text
+jmp @L461;
+@L454:
+# var: siz2, offset: 36
+ldbp -28;
+lddw;
+ldidw 25;
+dw2w;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldbp 28;
+lddw;
+ldiqw @T462;
+jmptab;
+@L464:
+ldbp 32;
+ldw;
+ldiqw @S409;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S410;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 4;
+subdw;
+ldbp 36;
+stdw;
+pop;
+jmp @L463;
+@L465:
+ldbp 32;
+ldw;
+ldiqw @S411;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S412;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldw;
+ldidw 1;
+adddw;
+ldiqw @S413;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S414;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 8;
+subdw;
+ldbp 36;
+stdw;
+pop;
+jmp @L463;
+@L466:
+ldbp 32;
+ldw;
+ldiqw @S415;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S416;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldw;
+ldidw 1;
+adddw;
+ldiqw @S417;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S418;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldw;
+ldidw 2;
+adddw;
+ldiqw @S419;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S420;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 12;
+subdw;
+ldbp 36;
+stdw;
+pop;
+jmp @L463;
+@L463:
+.data
+.align 8
+@T462:
+.dword 1
+.dword 3
+.qword @L463
+.qword @L464
+.qword @L465
+.qword @L466
+.text
+ldiqw @S421;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S422;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 36;
+lddw;
+subdw;
+ldiqw @S423;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S424;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S425;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S426;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 16;
+ldidw 12;
+adddw;
+ldiqw @S427;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S428;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S429;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S430;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 36;
+lddw;
+ldiqw @S431;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S432;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S433;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S434;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S435;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S436;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S437;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S438;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L461:
+jmp @L467;
+@L453:
+ldiqw @S439;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S440;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw arg_offs;
+lddw;
+ldidw 12;
+adddw;
+ldiqw @S441;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S442;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S443;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S444;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldidw 25;
+dw2w;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldiqw @S445;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S446;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldiqw @S447;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S448;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S449;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S450;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S451;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S452;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S453;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S454;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L467:
+ldiqw arg_offs;
+lddw;
+ldbp 20;
+lddw;
+adddw;
+ldiqw arg_offs;
+stdw;
+pop;
+jmp @L468;
+@L452:
+# var: r, offset: 16
+ldiqw arg_offs;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L469;
+ldbp -28;
+lddw;
+ldidw 4;
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+sdivdw;
+adddw;
+dw2w;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+jmp @L470;
+@L469:
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L473;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L473;
+ldidw 0;
+jmp @L474;
+@L473:
+ldidw 1;
+@L474:
+jmpt @L471;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+stw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L471;
+ldidw 0;
+jmp @L472;
+@L471:
+ldidw 1;
+@L472:
+jmpf @L475;
+ldidw 25;
+dw2w;
+ldbp 16;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+@L475:
+ldiqw arg_offs;
+lddw;
+ldbp 16;
+ldw;
+ldiqw @S455;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S456;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L470:
+ldiqw arg_offs;
+lddw;
+ldidw 4;
+adddw;
+ldiqw arg_offs;
+stdw;
+pop;
+@L468:
+@L449:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `free_temp' ====
+.text
+free_temp:
+addsp 12;        
+# param:`a', offset:-20
+# var: p, offset: 8
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L476:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L478;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+notdw;
+jmpf @L479;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpf @L479;
+ldidw 1;
+jmp @L480;
+@L479:
+ldidw 0;
+@L480:
+jmpf @L481;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+jmp @L478;
+@L481:
+@L477:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L476;
+@L478:
+ldidw 0;
+ret;
+# ==== start of definition of function `mips_call' ====
+.text
+mips_call:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S457;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S458;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S459;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S460;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw mips_post_call;
+call 0;
+pop;
+pop;
+ldbp -24;
+lddw;
+jmpf @L482;
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L483;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L483;
+ldidw 0;
+jmp @L484;
+@L483:
+ldidw 1;
+@L484:
+jmpf @L485;
+# var: r, offset: 8
+ldidw 2;
+dw2w;
+ldbp 8;
+stw;
+pop;
+ldidw 3;
+dw2w;
+ldbp 10;
+stw;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+jmp @L486;
+@L485:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldidw 2;
+dw2w;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L486:
+@L482:
+ldidw 0;
+ret;
+# ==== start of definition of function `mips_asn' ====
+.text
+mips_asn:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L487;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L487;
+ldidw 0;
+jmp @L488;
+@L487:
+ldidw 1;
+@L488:
+jmpf @L489;
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+@L490:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L491:
+ldidw 0;
+jmpf @L492;
+jmp @L490;
+@L492:
+jmp @L493;
+@L489:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+@L494:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L495:
+ldidw 0;
+jmpf @L496;
+jmp @L494;
+@L496:
+@L493:
+ldidw 0;
+ret;
+.data
+.align 8
+str_segment:
+.align 8
+.qword @S461+0
+.align 8
+.qword @S462+0
+.align 8
+.qword @S463+0
+.align 8
+.qword @S464+0
+.bss
+.align 4
+reg_descr_tab:
+.res 128
+.extern cfg_nodes
+.extern memchr
+.extern new_type_exp_node
+.extern analyze_primary_expression
+.extern dup_decl_specs
+.extern new_declaration_node
+.extern vfprintf
+.extern eval_const_expr
+.extern hash
+# ==== start of definition of function `mips_nop' ====
+.text
+mips_nop:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldidw 0;
+ret;
+# ==== start of definition of function `mips_not' ====
+.text
+mips_not:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L497;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L497;
+ldidw 0;
+jmp @L498;
+@L497:
+ldidw 1;
+@L498:
+jmpf @L499;
+ldidw 18;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw mips_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L500;
+@L499:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S465;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S466;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L501:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L502:
+ldidw 0;
+jmpf @L503;
+jmp @L501;
+@L503:
+@L500:
+ldidw 0;
+ret;
+.data
+.align 8
+instruction_handlers:
+.align 8
+.qword mips_add+0
+.align 8
+.qword mips_sub+0
+.align 8
+.qword mips_mul+0
+.align 8
+.qword mips_div+0
+.align 8
+.qword mips_rem+0
+.align 8
+.qword mips_shl+0
+.align 8
+.qword mips_shr+0
+.align 8
+.qword mips_and+0
+.align 8
+.qword mips_or+0
+.align 8
+.qword mips_xor+0
+.align 8
+.qword mips_eq+0
+.align 8
+.qword mips_neq+0
+.align 8
+.qword mips_lt+0
+.align 8
+.qword mips_let+0
+.align 8
+.qword mips_gt+0
+.align 8
+.qword mips_get+0
+.align 8
+.qword mips_neg+0
+.align 8
+.qword mips_cmpl+0
+.align 8
+.qword mips_not+0
+.align 8
+.qword mips_ch+0
+.align 8
+.qword mips_uch+0
+.align 8
+.qword mips_sh+0
+.align 8
+.qword mips_ush+0
+.align 8
+.qword mips_llsx+0
+.align 8
+.qword mips_llzx+0
+.align 8
+.qword mips_addr_of+0
+.align 8
+.qword mips_ind+0
+.align 8
+.qword mips_asn+0
+.align 8
+.qword mips_call+0
+.align 8
+.qword mips_indcall+0
+.align 8
+.qword mips_ind_asn+0
+.align 8
+.qword mips_lab+0
+.align 8
+.qword mips_jmp+0
+.align 8
+.qword mips_arg+0
+.align 8
+.qword mips_ret+0
+.align 8
+.qword mips_switch+0
+.align 8
+.qword mips_case+0
+.align 8
+.qword mips_cbr+0
+.align 8
+.qword mips_begarg+0
+.align 8
+.qword mips_nop+0
+.extern string_clear
+.bss
+.align 8
+asm_decls:
+.res 8
+.extern bsearch
+.extern pre_save_pch
+.extern qsort
+.extern analyze_parameter_declaration
+.extern string_new
+.extern cg_outpath
+.extern memcmp
+.extern bset_insert
+.extern pre_load_pch
+# ==== start of definition of function `mips_case' ====
+.text
+mips_case:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldidw 0;
+ret;
+.extern dflow_free_LiveOut
+.extern vsnprintf
+.extern vsprintf
+.bss
+.align 8
+str_lits:
+.res 8
+.extern nid_counter
+.extern new_cg_node
+.extern warning_count
+.extern memcpy
+# ==== start of definition of function `mips_jmp' ====
+.text
+mips_jmp:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 31;
+eqdw;
+jmpf @L504;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L504;
+ldidw 1;
+jmp @L505;
+@L504:
+ldidw 0;
+@L505:
+jmpf @L506;
+ldiqw 0;
+ret;
+@L506:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw @S467;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S468;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S469;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S470;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `mips_begarg' ====
+.text
+mips_begarg:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldidw 0;
+ret;
+.extern fopen
+.extern be_atoi
+.bss
+.align 4
+big_return:
+.res 4
+.extern bset_delete
+# ==== start of definition of function `spill_reg' ====
+.text
+spill_reg:
+addsp 8;         
+# param:`r', offset:-20
+# var: a, offset: 4
+ldiqw reg_descr_tab;
+ldbp -20;
+ldw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+jmpf @L507;
+ldiqw 0;
+ret;
+@L507:
+ldiqw reg_descr_tab;
+ldbp -20;
+ldw;
+dw2qw;
+ldxdw 4;
+ldbp 4;
+stdw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L508;
+# var: rr, offset: 8
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw mips_store2;
+call 8;
+pop;
+pop;
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+stw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+ldiqw reg_descr_tab;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L509;
+@L508:
+ldbp 4;
+lddw;
+ldbp -20;
+ldw;
+ldiqw mips_store;
+call 8;
+pop;
+pop;
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L509:
+ldidw 0;
+ret;
+.extern push_scope
+.extern free_c_token
+.extern ic_main
+.extern new_address
+.extern parse
+.extern get_pre_token
+# ==== start of definition of function `get_temp_offs' ====
+.text
+get_temp_offs:
+addsp 12;        
+# param:`a', offset:-20
+# var: p, offset: 8
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L510:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L512;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+notdw;
+jmpf @L513;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpf @L513;
+ldidw 1;
+jmp @L514;
+@L513:
+ldidw 0;
+@L514:
+jmpf @L515;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ret;
+@L515:
+@L511:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L510;
+@L512:
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L516:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L518;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+jmpf @L519;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ret;
+@L519:
+@L517:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L516;
+@L518:
+ldiqw 24;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldidw 8;
+subdw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw temp_list;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 4
+qword_return:
+.res 4
+.extern get_member_descriptor
+.extern decl_init
+.extern ic_free_function
+.extern dup_declarator
+.extern cg_nodes
+.extern strncat
+# ==== start of definition of function `mips_shl' ====
+.text
+mips_shl:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L520;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L520;
+ldidw 0;
+jmp @L521;
+@L520:
+ldidw 1;
+@L521:
+jmpf @L522;
+ldidw 5;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw mips_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L523;
+@L522:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 2;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S471;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S472;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L524:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L525:
+ldidw 0;
+jmpf @L526;
+jmp @L524;
+@L526:
+@L523:
+ldidw 0;
+ret;
+# ==== start of definition of function `mips_shr' ====
+.text
+mips_shr:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L527;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L527;
+ldidw 0;
+jmp @L528;
+@L527:
+ldidw 1;
+@L528:
+jmpf @L529;
+ldbp 4;
+lddw;
+ldiqw is_signed_int;
+call 4;
+pop;
+jmpf @L530;
+ldidw 6;
+jmp @L531;
+@L530:
+ldidw 7;
+@L531:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw mips_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L532;
+@L529:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 2;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldbp 4;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L533;
+ldiqw @S473;
+jmp @L534;
+@L533:
+ldiqw @S474;
+@L534:
+ldiqw @S475;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S476;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L535:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L536:
+ldidw 0;
+jmpf @L537;
+jmp @L535;
+@L537:
+@L532:
+ldidw 0;
+ret;
+# ==== start of definition of function `mips_llsx' ====
+.text
+mips_llsx:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 4;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S477;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S478;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S479;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S480;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L538:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L539:
+ldidw 0;
+jmpf @L540;
+jmp @L538;
+@L540:
+ldidw 0;
+ret;
+.extern dflow_free_Dom
+.extern fileno
+.extern bset_update
+# ==== start of definition of function `spill_all' ====
+.text
+spill_all:
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L541:
+ldbp 4;
+lddw;
+ldidw 32;
+sltdw;
+jmpf @L543;
+ldbp 4;
+lddw;
+dw2w;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+@L542:
+incldw 4;
+jmp @L541;
+@L543:
+ldidw 0;
+ret;
+.extern string_printf
+.extern dflow_LiveOut
+.extern lookup_external_id
+# ==== start of definition of function `mips_load2' ====
+.text
+mips_load2:
+addsp 12;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L544;
+# var: p, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S481;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S482;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S483;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S484;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L545;
+@L544:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L546;
+ldbp -24;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S485;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S486;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S487;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S488;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L547;
+@L546:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L548;
+# var: cat, offset: 4
+# var: e, offset: 8
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L549;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+neqdw;
+jmpf @L550;
+@L551:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+neqdw;
+notdw;
+jmpf @L554;
+ldidw 453;
+ldiqw @S489;
+ldiqw @S490;
+ldiqw @S491;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L554:
+@L552:
+ldidw 0;
+jmpf @L553;
+jmp @L551;
+@L553:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S492;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S493;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S494;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S495;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L555;
+@L550:
+@L556:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+eqdw;
+notdw;
+jmpf @L559;
+ldidw 457;
+ldiqw @S496;
+ldiqw @S497;
+ldiqw @S498;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L559:
+@L557:
+ldidw 0;
+jmpf @L558;
+jmp @L556;
+@L558:
+@L555:
+ldiqw 0;
+ret;
+@L549:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L560:
+ldbp 4;
+lddw;
+ldidw 110;
+eqdw;
+jmpt @L563;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L563;
+ldidw 0;
+jmp @L564;
+@L563:
+ldidw 1;
+@L564:
+notdw;
+jmpf @L565;
+ldidw 464;
+ldiqw @S499;
+ldiqw @S500;
+ldiqw @S501;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L565:
+@L561:
+ldidw 0;
+jmpf @L562;
+jmp @L560;
+@L562:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L566;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L567;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S502;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S503;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S504;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S505;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L568;
+@L567:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S506;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S507;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S508;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S509;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L568:
+jmp @L569;
+@L566:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S510;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S511;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 4;
+adddw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S512;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S513;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L569:
+jmp @L570;
+@L548:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L571;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L572;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+neqdw;
+jmpf @L573;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S514;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S515;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L573:
+@L574:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+notdw;
+jmpf @L577;
+ldidw 482;
+ldiqw @S516;
+ldiqw @S517;
+ldiqw @S518;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L577:
+@L575:
+ldidw 0;
+jmpf @L576;
+jmp @L574;
+@L576:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+neqdw;
+jmpf @L578;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S519;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S520;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L578:
+jmp @L579;
+@L572:
+# var: offs, offset: 4
+ldbp -24;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S521;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S522;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+adddw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S523;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S524;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L579:
+@L571:
+@L570:
+@L547:
+@L545:
+ldidw 0;
+ret;
+.bss
+.align 8
+addr_descr_tab:
+.res 8
+.extern hash2
+.extern analyze_type_name
+# ==== start of definition of function `update_tar_descriptors2' ====
+.text
+update_tar_descriptors2:
+addsp 0;         
+# param:`res', offset:-20
+# param:`tar', offset:-24
+# param:`liveness', offset:-28
+# param:`next_use', offset:-32
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldbp -24;
+lddw;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -24;
+lddw;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+notdw;
+jmpf @L580;
+ldbp -28;
+ldub;
+jmpf @L581;
+ldbp -24;
+lddw;
+ldbp -20;
+ldn 4;
+ldiqw mips_store2;
+call 8;
+pop;
+pop;
+@L581:
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L580:
+ldidw 0;
+ret;
+# ==== start of definition of function `mips_spill_reg_args' ====
+.text
+mips_spill_reg_args:
+addsp 28;        
+# param:`p', offset:-24
+# var: arg_nb, offset: 4
+# var: tmp, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L582;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L582;
+ldidw 1;
+jmp @L583;
+@L582:
+ldidw 0;
+@L583:
+jmpf @L584;
+ldiqw big_return;
+lddw;
+jmpf @L585;
+ldiqw @S525;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S526;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L585:
+ldiqw 0;
+ret;
+@L584:
+ldbp -24;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L586:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L588;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L589;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpf @L589;
+ldidw 1;
+jmp @L590;
+@L589:
+ldidw 0;
+@L590:
+jmpf @L591;
+jmp @@mips_spill_reg_args_spill_all;
+@L591:
+@L587:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L586;
+@L588:
+ldiqw big_return;
+lddw;
+jmpf @L592;
+ldidw 4;
+jmp @L593;
+@L592:
+ldidw 0;
+@L593:
+ldbp 4;
+stdw;
+pop;
+@L594:
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L595;
+# var: ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 4;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw round_up;
+call 8;
+pop;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 16;
+sgetdw;
+jmpf @L596;
+ldidw 16;
+ldbp 4;
+stdw;
+pop;
+jmp @L595;
+@L596:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+jmp @L594;
+@L595:
+ldbp 4;
+lddw;
+ldiqw @T597;
+jmptab;
+@L599:
+ldiqw @S527;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S528;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L598;
+@L600:
+ldiqw @S529;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S530;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S531;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S532;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L598;
+@L601:
+ldiqw @S533;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S534;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S535;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S536;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S537;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S538;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L598;
+@L602:
+@@mips_spill_reg_args_spill_all:
+ldiqw @S539;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S540;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S541;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S542;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S543;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S544;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S545;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S546;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L598;
+@L598:
+.data
+.align 8
+@T597:
+.dword 4
+.dword 13
+.qword @L598
+.qword @L599
+.qword @L598
+.qword @L598
+.qword @L598
+.qword @L600
+.qword @L598
+.qword @L598
+.qword @L598
+.qword @L601
+.qword @L598
+.qword @L598
+.qword @L598
+.qword @L602
+.text
+ldidw 0;
+ret;
+.bss
+.align 4
+arg_offs:
+.res 4
+.extern is_unsigned_int
+.extern memmove
+.extern replace_extension
+.extern analyze_struct_declarator
+.extern get_type_spec
+# ==== start of definition of function `mips_llzx' ====
+.text
+mips_llzx:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 4;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S547;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S548;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L603:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L604:
+ldidw 0;
+jmpf @L605;
+jmp @L603;
+@L605:
+ldidw 0;
+ret;
+.extern cfg_nodes_counter
+.bss
+.align 8
+enclosing_function:
+.res 8
+.extern analyze_function_definition
+.extern strdup
+.extern bset_new
+.extern arena_new
+.extern analyze_init_declarator
+.extern cfg_function_to_print
+.extern strncmp
+.extern arena_set_nom_siz
+.extern bset_union_diff
+# ==== start of definition of function `mips_do_libcall' ====
+.text
+mips_do_libcall:
+addsp 12;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# param:`func', offset:-36
+# var: res, offset: 4
+ldidw 2;
+dw2w;
+ldbp 4;
+stw;
+pop;
+ldidw 3;
+dw2w;
+ldbp 6;
+stw;
+pop;
+# var: r1, offset: 8
+ldidw 4;
+dw2w;
+ldbp 8;
+stw;
+pop;
+ldidw 5;
+dw2w;
+ldbp 10;
+stw;
+pop;
+# var: r2, offset: 12
+ldidw 6;
+dw2w;
+ldbp 12;
+stw;
+pop;
+ldidw 7;
+dw2w;
+ldbp 14;
+stw;
+pop;
+ldbp -36;
+lddw;
+ldiqw @T606;
+jmptab;
+@L608:
+@L609:
+@L610:
+@L611:
+@L612:
+ldiqw mips_save_arg_regs;
+call 0;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldbp 12;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+ldiqw @S549;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S550;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldiqw libfuncs;
+ldbp -36;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S551;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S552;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S553;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S554;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S555;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S556;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw mips_restore_arg_regs;
+call 0;
+pop;
+pop;
+@L613:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L614:
+ldidw 0;
+jmpf @L615;
+jmp @L613;
+@L615:
+jmp @L607;
+@L616:
+@L617:
+@L618:
+ldiqw mips_save_arg_regs;
+call 0;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 6;
+dw2w;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldiqw @S557;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S558;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldiqw libfuncs;
+ldbp -36;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S559;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S560;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S561;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S562;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S563;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S564;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw mips_restore_arg_regs;
+call 0;
+pop;
+pop;
+@L619:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L620:
+ldidw 0;
+jmpf @L621;
+jmp @L619;
+@L621:
+jmp @L607;
+@L622:
+ldiqw mips_save_arg_regs;
+call 0;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+ldiqw @S565;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S566;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S567;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S568;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S569;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S570;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldiqw @S571;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S572;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S573;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S574;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S575;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S576;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S577;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S578;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw mips_restore_arg_regs;
+call 0;
+pop;
+pop;
+@L623:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldidw 2;
+dw2w;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L624:
+ldidw 0;
+jmpf @L625;
+jmp @L623;
+@L625:
+jmp @L607;
+@L626:
+@L627:
+@L628:
+@L629:
+@L630:
+@L631:
+@L632:
+@L633:
+@L634:
+@L635:
+ldiqw mips_save_arg_regs;
+call 0;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldbp 12;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+ldiqw @S579;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S580;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldiqw libfuncs;
+ldbp -36;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S581;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S582;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S583;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S584;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S585;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S586;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw mips_restore_arg_regs;
+call 0;
+pop;
+pop;
+ldbp -36;
+lddw;
+ldiqw @T636;
+jmptab;
+@L638:
+ldiqw @S587;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S588;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L637;
+@L639:
+ldiqw @S589;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S590;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L637;
+@L640:
+@L641:
+ldiqw @S591;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S592;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L637;
+@L642:
+@L643:
+ldiqw @S593;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S594;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L637;
+@L644:
+@L645:
+ldiqw @S595;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S596;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L637;
+@L646:
+@L647:
+ldiqw @S597;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S598;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L637;
+@L637:
+.data
+.align 8
+@T636:
+.dword 8
+.dword 10
+.qword @L637
+.qword @L638
+.qword @L639
+.qword @L640
+.qword @L642
+.qword @L644
+.qword @L646
+.qword @L641
+.qword @L643
+.qword @L645
+.qword @L647
+.text
+@L648:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldidw 2;
+dw2w;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L649:
+ldidw 0;
+jmpf @L650;
+jmp @L648;
+@L650:
+jmp @L607;
+@L607:
+.data
+.align 8
+@T606:
+.dword 0
+.dword 19
+.qword @L607
+.qword @L608
+.qword @L609
+.qword @L610
+.qword @L611
+.qword @L612
+.qword @L616
+.qword @L617
+.qword @L618
+.qword @L626
+.qword @L627
+.qword @L629
+.qword @L631
+.qword @L633
+.qword @L635
+.qword @L628
+.qword @L630
+.qword @L632
+.qword @L634
+.qword @L622
+.text
+ldidw 0;
+ret;
+.bss
+.align 4
+string_literals_counter:
+.res 4
+# ==== start of definition of function `mips_sub' ====
+.text
+mips_sub:
+addsp 20;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L651;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L651;
+ldidw 0;
+jmp @L652;
+@L651:
+ldidw 1;
+@L652:
+jmpf @L653;
+# var: op, offset: 8
+# var: res, offset: 16
+# var: br, offset: 20
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 16;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 20;
+stw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 20;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S599;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S600;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 20;
+ldw;
+ldiqw @S601;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S602;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S603;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S604;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S605;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S606;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 20;
+ldw;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S607;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S608;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 20;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L654:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L655:
+ldidw 0;
+jmpf @L656;
+jmp @L654;
+@L656:
+jmp @L657;
+@L653:
+# var: op, offset: 8
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+ldxb 1;
+ldidw 36;
+eqdw;
+jmpf @L658;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldw;
+ldbp 16;
+ldw;
+ldiqw @S609;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S610;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L659;
+@L658:
+ldbp 8;
+ldqw;
+ldbp 16;
+ldw;
+ldbp 16;
+ldw;
+ldiqw @S611;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S612;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L659:
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L660:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L661:
+ldidw 0;
+jmpf @L662;
+jmp @L660;
+@L662:
+@L657:
+ldidw 0;
+ret;
+.extern analyze_multiplicative_expression
+.extern analyze_additive_expression
+# ==== start of definition of function `mips_function_definition' ====
+.text
+mips_function_definition:
+addsp 60;        
+# param:`decl_specs', offset:-24
+# param:`header', offset:-32
+# var: cat, offset: 4
+# var: i, offset: 8
+# var: last_i, offset: 12
+# var: fn, offset: 16
+# var: pos_tmp, offset: 20
+# var: scs, offset: 24
+# var: ty, offset: 32
+.data
+.align 4
+@mips_function_definition_first_func:
+.align 4
+.dword 1
+.text
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw curr_func;
+stqw;
+pop;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw new_cg_node;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldidw 8;
+ldiqw cg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 40;
+addqw;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldiqw compute_liveness_and_next_use;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 32;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 32;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L663;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L663;
+ldidw 0;
+jmp @L664;
+@L663:
+ldidw 1;
+@L664:
+jmpf @L665;
+ldidw 1;
+ldiqw big_return;
+stdw;
+pop;
+jmp @L666;
+@L665:
+ldbp 4;
+lddw;
+ldidw 110;
+eqdw;
+jmpt @L667;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L667;
+ldidw 0;
+jmp @L668;
+@L667:
+ldidw 1;
+@L668:
+jmpf @L669;
+ldidw 1;
+ldiqw qword_return;
+stdw;
+pop;
+@L669:
+@L666:
+ldiqw @mips_function_definition_first_func;
+lddw;
+notdw;
+jmpf @L670;
+ldiqw @S613;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L670:
+ldiqw curr_func;
+ldqw;
+ldiqw @S614;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S615;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L671:
+ldiqw curr_segment;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L674;
+ldiqw str_segment;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S616;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S617;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw curr_segment;
+stdw;
+pop;
+@L674:
+@L672:
+ldidw 0;
+jmpf @L673;
+jmp @L671;
+@L673:
+ldbp -24;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 24;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L675;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L675;
+ldidw 0;
+jmp @L676;
+@L675:
+ldidw 1;
+@L676:
+jmpf @L677;
+ldiqw curr_func;
+ldqw;
+ldiqw @S618;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S619;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L677:
+ldiqw curr_func;
+ldqw;
+ldiqw @S620;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S621;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+@L678:
+ldbp 8;
+lddw;
+ldbp 12;
+lddw;
+sletdw;
+jmpf @L680;
+# var: tar, offset: 48
+# var: arg1, offset: 52
+# var: arg2, offset: 56
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 48;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 52;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 56;
+stdw;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L681;
+ldiqw C_source;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L681;
+ldidw 1;
+jmp @L682;
+@L681:
+ldidw 0;
+@L682:
+jmpf @L683;
+ldiqw C_source;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S622;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S623;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L683:
+ldbp 56;
+lddw;
+ldbp 52;
+lddw;
+ldbp 48;
+lddw;
+ldbp 8;
+lddw;
+ldiqw instruction_handlers;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+dw2qw;
+ldxqw 8;
+call 16;
+pop;
+pop;
+@L679:
+incldw 8;
+jmp @L678;
+@L680:
+ldiqw size_of_local_area;
+lddw;
+ldidw 8;
+ldiqw temp_struct_size;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+subdw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldbp 20;
+stdw;
+pop;
+@L684:
+ldiqw calls_to_fix_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldidw 0;
+sgetdw;
+jmpf @L685;
+# var: n, offset: 48
+# var: s, offset: 56
+ldiqw calls_to_fix;
+ldiqw calls_to_fix_counter;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw func_body;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_curr;
+call 8;
+ldbp 56;
+stqw;
+pop;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldiqw @S624;
+ldbp 56;
+ldqw;
+ldiqw sprintf;
+call 20;
+pop;
+ldbp 48;
+stdw;
+pop;
+ldidw 32;
+dw2b;
+ldbp 56;
+ldqw;
+ldbp 48;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+@L686:
+ldbp 56;
+ldqw;
+ldbp 48;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 88;
+eqdw;
+jmpf @L688;
+ldidw 32;
+dw2b;
+ldbp 56;
+ldqw;
+ldbp 48;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L687:
+incldw 48;
+jmp @L686;
+@L688:
+jmp @L684;
+@L685:
+ldbp 20;
+lddw;
+ldiqw func_body;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldidw 8;
+subdw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 52;
+addqw;
+lddw;
+notdw;
+jmpf @L689;
+ldiqw max_arg_offs;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L690;
+ldiqw size_of_local_area;
+lddw;
+ldidw 16;
+subdw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+jmp @L691;
+@L690:
+ldiqw size_of_local_area;
+lddw;
+ldidw 8;
+ldiqw max_arg_offs;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+subdw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+@L691:
+@L689:
+ldiqw size_of_local_area;
+lddw;
+ldiqw @S625;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S626;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw size_of_local_area;
+lddw;
+negdw;
+ldidw 4;
+subdw;
+ldiqw @S627;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S628;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw size_of_local_area;
+lddw;
+negdw;
+ldidw 8;
+subdw;
+ldiqw @S629;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S630;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw size_of_local_area;
+lddw;
+negdw;
+ldidw 8;
+subdw;
+ldiqw @S631;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S632;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw mips_spill_reg_args;
+call 8;
+pop;
+pop;
+ldiqw @S633;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S634;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S635;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S636;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S637;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S638;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S639;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S640;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S641;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S642;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S643;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S644;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw mips_output_file;
+ldqw;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+ldiqw mips_output_file;
+ldqw;
+ldiqw func_body;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+ldiqw mips_output_file;
+ldqw;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldiqw temp_struct_size;
+stdw;
+pop;
+ldidw 0;
+ldiqw calls_to_fix_counter;
+stdw;
+pop;
+ldidw 0;
+ldiqw max_arg_offs;
+stdw;
+ldiqw arg_offs;
+stdw;
+pop;
+ldiqw free_all_temps;
+call 0;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldiqw ic_free_function;
+call 4;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldiqw 4;
+ldidw 32;
+dw2qw;
+mulqw;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldidw 0;
+ldiqw qword_return;
+stdw;
+ldiqw big_return;
+stdw;
+pop;
+ldiqw dump_addr_descr_tab;
+call 0;
+pop;
+pop;
+ldiqw dump_reg_descr_tab;
+call 0;
+pop;
+pop;
+ldidw 0;
+ldiqw @mips_function_definition_first_func;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern stat_number_of_c_tokens
+.extern strncpy
+.extern bset_clear
+.extern decl_save_pch
+.extern bset_card
+.extern analyze_assignment_expression
+.extern ic_instructions
+.extern new_extern_id_node
+.extern decl_load_pch
+.extern bset_union
+.extern analyze_translation_unit
+# ==== start of definition of function `mips_static_expr' ====
+.text
+mips_static_expr:
+addsp 28;        
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T692;
+jmptab;
+@L694:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T695;
+switch;
+@L697:
+# var: pi, offset: 4
+# var: ii, offset: 8
+# var: ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L698;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+jmp @L699;
+@L698:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L699:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw mips_static_expr;
+call 8;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw mips_static_expr;
+call 8;
+mulqw;
+addqw;
+ret;
+@L700:
+@L701:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 71;
+neqdw;
+jmpf @L702;
+# var: m, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw get_member_descriptor;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw mips_static_expr;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+addqw;
+ret;
+jmp @L703;
+@L702:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw mips_static_expr;
+call 8;
+ret;
+@L703:
+@L704:
+@L705:
+@L706:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw mips_static_expr;
+call 8;
+ret;
+@L707:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L708;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw mips_static_expr;
+call 8;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw mips_static_expr;
+call 8;
+addqw;
+ret;
+jmp @L709;
+@L708:
+# var: pi, offset: 4
+# var: ii, offset: 8
+# var: ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L710;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+jmp @L711;
+@L710:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L711:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw mips_static_expr;
+call 8;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw mips_static_expr;
+call 8;
+mulqw;
+addqw;
+ret;
+@L709:
+@L712:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L713;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw mips_static_expr;
+call 8;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw mips_static_expr;
+call 8;
+subqw;
+ret;
+jmp @L714;
+@L713:
+# var: ty, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 8;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw mips_static_expr;
+call 8;
+ldbp 8;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw mips_static_expr;
+call 8;
+mulqw;
+subqw;
+ret;
+@L714:
+@L715:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ordw;
+jmpf @L716;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw mips_static_expr;
+call 8;
+ret;
+jmp @L717;
+@L716:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw mips_static_expr;
+call 8;
+ret;
+@L717:
+@L718:
+@L719:
+ldidw 0;
+notdw;
+jmpf @L722;
+ldidw 2261;
+ldiqw @S645;
+ldiqw @S646;
+ldiqw @S647;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L722:
+@L720:
+ldidw 0;
+jmpf @L721;
+jmp @L719;
+@L721:
+@L696:
+.data
+.align 8
+@T695:
+.dword 10
+.dword 6
+.dword 7
+.dword 12
+.dword 13
+.dword 30
+.dword 97
+.dword 101
+.dword 103
+.dword 105
+.qword @L718
+.qword @L700
+.qword @L701
+.qword @L707
+.qword @L712
+.qword @L715
+.qword @L697
+.qword @L705
+.qword @L704
+.qword @L706
+.text
+@L723:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ret;
+@L724:
+ldiqw string_literals_counter;
+lddw;
+ldiqw @S648;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S649;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw str_lits;
+ldqw;
+ldiqw emit_raw_string;
+call 16;
+pop;
+pop;
+ldiqw string_literals_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S650;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ret;
+@L725:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L726;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw enclosing_function;
+ldqw;
+ldiqw @S651;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+jmp @L727;
+@L726:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S652;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+@L727:
+ldidw 0;
+dw2qw;
+ret;
+@L693:
+.data
+.align 8
+@T692:
+.dword 0
+.dword 4
+.qword @L693
+.qword @L694
+.qword @L723
+.qword @L724
+.qword @L725
+.text
+@L728:
+ldidw 0;
+notdw;
+jmpf @L731;
+ldidw 2277;
+ldiqw @S653;
+ldiqw @S654;
+ldiqw @S655;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L731:
+@L729:
+ldidw 0;
+jmpf @L730;
+jmp @L728;
+@L730:
+ldidw 0;
+ret;
+.extern strnlen
+.extern bset_new_in
+.extern analyze_enumerator
+.extern targeting_arch64
+.extern set_attributes
+.extern is_typedef_name
+.extern dflow_exit_function
+.extern arena_reset
+.extern fread
+.extern strrchr
+# ==== start of definition of function `mips_get' ====
+.text
+mips_get:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L732;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L733;
+ldidw 16;
+jmp @L734;
+@L733:
+ldidw 12;
+@L734:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw mips_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L735;
+@L732:
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 16;
+ldw;
+ldbp 16;
+ldw;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L736;
+ldiqw @S656;
+jmp @L737;
+@L736:
+ldiqw @S657;
+@L737:
+ldiqw @S658;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S659;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L738:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L739:
+ldidw 0;
+jmpf @L740;
+jmp @L738;
+@L740:
+@L735:
+ldidw 0;
+ret;
+.data
+.align 4
+curr_segment:
+.align 4
+.dword -1
+.extern bset_next
+# ==== start of definition of function `update_tar_descriptors' ====
+.text
+update_tar_descriptors:
+addsp 0;         
+# param:`res', offset:-20
+# param:`tar', offset:-24
+# param:`liveness', offset:-28
+# param:`next_use', offset:-32
+ldbp -20;
+ldw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldbp -24;
+lddw;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+notdw;
+jmpf @L741;
+ldbp -28;
+ldub;
+jmpf @L742;
+ldbp -24;
+lddw;
+ldbp -20;
+ldw;
+ldiqw mips_store;
+call 8;
+pop;
+pop;
+@L742:
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L741:
+ldidw 0;
+ret;
+.extern disable_warnings
+.extern string_append
+.bss
+.align 8
+curr_func:
+.res 8
+.extern bset_diff
+.extern install_macro
+# ==== start of definition of function `get_reg' ====
+.text
+get_reg:
+addsp 4;         
+# param:`i', offset:-20
+# var: arg1, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L747;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L747;
+ldidw 0;
+jmp @L748;
+@L747:
+ldidw 1;
+@L748:
+notdw;
+jmpf @L745;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L745;
+ldidw 1;
+jmp @L746;
+@L745:
+ldidw 0;
+@L746:
+jmpf @L743;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+notdw;
+jmpf @L743;
+ldidw 1;
+jmp @L744;
+@L743:
+ldidw 0;
+@L744:
+jmpf @L749;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ret;
+@L749:
+ldiqw get_reg0;
+call 0;
+pop;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern bset_inters
+# ==== start of definition of function `mips_ind_asn' ====
+.text
+mips_ind_asn:
+addsp 28;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: pr, offset: 8
+# var: st_str, offset: 16
+ldiqw spill_aliased_objects;
+call 0;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L750;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L750;
+ldidw 0;
+jmp @L751;
+@L750:
+ldidw 1;
+@L751:
+jmpf @L752;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L753;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L754;
+@L753:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+stw;
+pop;
+@L754:
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L755;
+# var: p, offset: 24
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldiqw @S660;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S661;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldiqw @S662;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S663;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldiqw @S664;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S665;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldiqw @S666;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S667;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L756;
+@L755:
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L757;
+ldbp -32;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldiqw @S668;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S669;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldiqw @S670;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S671;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldiqw @S672;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S673;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L758;
+@L757:
+# var: r, offset: 24
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L759;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 24;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 24;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 24;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 24;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldbp 24;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+jmp @L760;
+@L759:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 24;
+ldiqw 2;
+addqw;
+stw;
+pop;
+@L761:
+ldbp 24;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+notdw;
+jmpf @L764;
+ldidw 1584;
+ldiqw @S674;
+ldiqw @S675;
+ldiqw @S676;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L764:
+@L762:
+ldidw 0;
+jmpf @L763;
+jmp @L761;
+@L763:
+@L760:
+ldbp 8;
+ldw;
+ldbp 24;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S677;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S678;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldbp 24;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S679;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S680;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L758:
+@L756:
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @@mips_ind_asn_done;
+jmp @L765;
+@L752:
+ldbp 4;
+lddw;
+ldidw 68;
+eqdw;
+jmpt @L766;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L766;
+ldidw 0;
+jmp @L767;
+@L766:
+ldidw 1;
+@L767:
+jmpf @L768;
+ldiqw @S681;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S682;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldidw 25;
+dw2w;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldiqw @S683;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S684;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 25;
+dw2w;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldiqw @S685;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S686;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S687;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S688;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S689;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S690;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S691;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S692;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S693;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S694;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @@mips_ind_asn_done;
+@L768:
+@L765:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L769;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L770;
+@L769:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+stw;
+pop;
+@L770:
+ldbp 4;
+lddw;
+ldiqw @T771;
+switch;
+@L773:
+@L774:
+ldiqw @S695;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L772;
+@L775:
+@L776:
+@L777:
+ldiqw @S696;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L772;
+@L778:
+ldiqw @S697;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L772;
+@L772:
+.data
+.align 8
+@T771:
+.dword 6
+.dword 49
+.dword 64
+.dword 106
+.dword 107
+.dword 108
+.qword @L778
+.qword @L775
+.qword @L773
+.qword @L776
+.qword @L777
+.qword @L774
+.text
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L779;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S698;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S699;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S700;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S701;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L780;
+@L779:
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L781;
+ldbp -32;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldiqw @S702;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S703;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S704;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S705;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L782;
+@L781:
+# var: r, offset: 24
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L783;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 24;
+stw;
+pop;
+ldbp -32;
+lddw;
+ldbp 24;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+jmp @L784;
+@L783:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 24;
+stw;
+pop;
+@L784:
+ldbp 8;
+ldw;
+ldbp 24;
+ldw;
+ldbp 16;
+ldqw;
+ldiqw @S706;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S707;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L782:
+@L780:
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@@mips_ind_asn_done:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern edge_add
+.extern string_buf
+.extern ferror
+# ==== start of definition of function `mips_cbr' ====
+.text
+mips_cbr:
+addsp 12;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: r, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L785;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L785;
+ldidw 0;
+jmp @L786;
+@L785:
+ldidw 1;
+@L786:
+jmpf @L787;
+# var: r2, offset: 10
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 10;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 10;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+ldbp 10;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 10;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 10;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S708;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S709;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 10;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+stw;
+pop;
+jmp @L788;
+@L787:
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+@L788:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L789;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldbp 8;
+ldw;
+ldiqw @S710;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S711;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L790;
+@L789:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw curr_func;
+ldqw;
+ldbp 8;
+ldw;
+ldiqw @S712;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S713;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L790:
+ldiqw @S714;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S715;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern random
+# ==== start of definition of function `new_string_literal' ====
+.text
+new_string_literal:
+addsp 0;         
+# param:`a', offset:-20
+ldiqw string_literals_counter;
+lddw;
+ldiqw @S716;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S717;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw str_lits;
+ldqw;
+ldiqw emit_raw_string;
+call 16;
+pop;
+pop;
+ldiqw string_literals_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern ic_instructions_counter
+.extern free
+.extern malloc
+.extern get_external_declarations
+# ==== start of definition of function `mips_cgen' ====
+.text
+mips_cgen:
+.global mips_cgen
+addsp 40;        
+# param:`outf', offset:-24
+# var: i, offset: 4
+# var: j, offset: 8
+# var: ed, offset: 16
+# var: func_def_list, offset: 24
+# var: ext_sym_list, offset: 32
+ldbp -24;
+ldqw;
+ldiqw mips_output_file;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldbp 24;
+ldiqw ic_main;
+call 16;
+pop;
+pop;
+ldidw 512;
+ldiqw string_new;
+call 4;
+ldiqw asm_decls;
+stqw;
+pop;
+pop;
+ldidw 512;
+ldiqw string_new;
+call 4;
+ldiqw str_lits;
+stqw;
+pop;
+pop;
+ldidw 1024;
+ldiqw string_new;
+call 4;
+ldiqw func_body;
+stqw;
+pop;
+pop;
+ldidw 1024;
+ldiqw string_new;
+call 4;
+ldiqw func_prolog;
+stqw;
+pop;
+pop;
+ldidw 1024;
+ldiqw string_new;
+call 4;
+ldiqw func_epilog;
+stqw;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw addr_descr_tab;
+stqw;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L791:
+ldbp 24;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L793;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw mips_function_definition;
+call 16;
+pop;
+pop;
+@L792:
+incldw 4;
+jmp @L791;
+@L793:
+ldiqw func_body;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw @S718;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S719;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw mips_allocate_static_objects;
+call 0;
+pop;
+pop;
+ldiqw @S720;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S721;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+@L794:
+ldbp 32;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L796;
+# var: tmp, offset: 40
+ldiqw nid_counter;
+lddw;
+ldbp 40;
+stdw;
+pop;
+ldidw 0;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_var_nid;
+call 12;
+pop;
+pop;
+ldbp 40;
+lddw;
+ldiqw nid_counter;
+lddw;
+eqdw;
+jmpf @L797;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S722;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S723;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L797:
+@L795:
+incldw 8;
+jmp @L794;
+@L796:
+ldiqw include_libc;
+lddw;
+jmpf @L798;
+ldiqw @S724;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S725;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S726;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S727;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L798:
+ldiqw @S728;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S729;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw include_liblux;
+lddw;
+jmpf @L799;
+ldiqw @S730;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S731;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S732;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S733;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S734;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S735;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S736;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S737;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S738;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S739;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S740;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S741;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S742;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S743;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S744;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S745;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S746;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S747;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S748;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S749;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L799:
+ldiqw mips_output_file;
+ldqw;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw string_literals_counter;
+lddw;
+jmpf @L800;
+ldiqw @S750;
+ldiqw mips_output_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldiqw @S751;
+ldiqw mips_output_file;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldiqw mips_output_file;
+ldqw;
+ldiqw str_lits;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+@L800:
+ldiqw str_lits;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.data
+.align 4
+pinned:
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 0
+.align 4
+.dword 0
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 0
+.align 4
+.dword 0
+.align 4
+.dword 0
+.align 4
+.dword 0
+.align 4
+.dword 0
+.align 4
+.dword 0
+.align 4
+.dword 0
+.align 4
+.dword 0
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 0
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.align 4
+.dword 1
+.extern new_decl_list_node
+.extern compute_liveness_and_next_use
+.extern srandom
+# ==== start of definition of function `mips_xor' ====
+.text
+mips_xor:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L801;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L801;
+ldidw 0;
+jmp @L802;
+@L801:
+ldidw 1;
+@L802:
+jmpf @L803;
+# var: op, offset: 8
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 16;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw mips_load2;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw @S752;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S753;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw @S754;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S755;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L804:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L805:
+ldidw 0;
+jmpf @L806;
+jmp @L804;
+@L806:
+jmp @L807;
+@L803:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldw;
+ldiqw mips_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 2;
+ldbp -32;
+lddw;
+ldiqw mips_get_operand;
+call 8;
+ldbp 8;
+ldw;
+ldbp 8;
+ldw;
+ldiqw @S756;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S757;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L808:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L809:
+ldidw 0;
+jmpf @L810;
+jmp @L808;
+@L810:
+@L807:
+ldidw 0;
+ret;
+.extern lookup_struct_descriptor
+.extern new_exec_node
+.extern get_alignment
+.extern fgetc
+.bss
+.align 8
+__temp_struct:
+.res 4
+.data
+@S0:
+.byte 106
+.byte 97
+.byte 108
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S1:
+.byte 10
+.byte 0
+@S2:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S3:
+.byte 10
+.byte 0
+@S4:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 45
+.byte 49
+.byte 50
+.byte 0
+@S5:
+.byte 10
+.byte 0
+@S6:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S7:
+.byte 10
+.byte 0
+@S8:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S9:
+.byte 10
+.byte 0
+@S10:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S11:
+.byte 10
+.byte 0
+@S12:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S13:
+.byte 10
+.byte 0
+@S14:
+.byte 106
+.byte 97
+.byte 108
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S15:
+.byte 10
+.byte 0
+@S16:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S17:
+.byte 10
+.byte 0
+@S18:
+.byte 115
+.byte 104
+.byte 0
+@S19:
+.byte 115
+.byte 98
+.byte 0
+@S20:
+.byte 115
+.byte 119
+.byte 0
+@S21:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S22:
+.byte 10
+.byte 0
+@S23:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S24:
+.byte 10
+.byte 0
+@S25:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S26:
+.byte 10
+.byte 0
+@S27:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S28:
+.byte 10
+.byte 0
+@S29:
+.byte 37
+.byte 115
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S30:
+.byte 10
+.byte 0
+@S31:
+.byte 115
+.byte 108
+.byte 101
+.byte 0
+@S32:
+.byte 115
+.byte 108
+.byte 101
+.byte 117
+.byte 0
+@S33:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S34:
+.byte 10
+.byte 0
+@S35:
+.byte 115
+.byte 101
+.byte 98
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S36:
+.byte 10
+.byte 0
+@S37:
+.byte 115
+.byte 101
+.byte 113
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S38:
+.byte 10
+.byte 0
+@S39:
+.byte 37
+.byte 117
+.byte 0
+@S40:
+.byte 37
+.byte 117
+.byte 0
+@S41:
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S42:
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S43:
+.byte 115
+.byte 103
+.byte 116
+.byte 0
+@S44:
+.byte 115
+.byte 103
+.byte 116
+.byte 117
+.byte 0
+@S45:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S46:
+.byte 10
+.byte 0
+@S47:
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 50
+.byte 53
+.byte 53
+.byte 0
+@S48:
+.byte 10
+.byte 0
+@S49:
+.byte 115
+.byte 108
+.byte 116
+.byte 0
+@S50:
+.byte 115
+.byte 108
+.byte 116
+.byte 117
+.byte 0
+@S51:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S52:
+.byte 10
+.byte 0
+@S53:
+.byte 111
+.byte 114
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S54:
+.byte 10
+.byte 0
+@S55:
+.byte 111
+.byte 114
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S56:
+.byte 10
+.byte 0
+@S57:
+.byte 111
+.byte 114
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S58:
+.byte 10
+.byte 0
+@S59:
+.byte 36
+.byte 37
+.byte 100
+.byte 32
+.byte 61
+.byte 62
+.byte 32
+.byte 37
+.byte 115
+.byte 10
+.byte 0
+@S60:
+.byte 100
+.byte 105
+.byte 118
+.byte 100
+.byte 117
+.byte 0
+@S61:
+.byte 100
+.byte 105
+.byte 118
+.byte 100
+.byte 0
+@S62:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S63:
+.byte 10
+.byte 0
+@S64:
+.byte 115
+.byte 101
+.byte 104
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S65:
+.byte 10
+.byte 0
+@S66:
+.byte 37
+.byte 37
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S67:
+.byte 10
+.byte 0
+@S68:
+.byte 37
+.byte 37
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S69:
+.byte 10
+.byte 0
+@S70:
+.byte 37
+.byte 37
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S71:
+.byte 10
+.byte 0
+@S72:
+.byte 37
+.byte 37
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 98
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S73:
+.byte 10
+.byte 0
+@S74:
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S75:
+.byte 10
+.byte 0
+@S76:
+.byte 37
+.byte 37
+.byte 103
+.byte 108
+.byte 111
+.byte 98
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S77:
+.byte 10
+.byte 0
+@S78:
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S79:
+.byte 10
+.byte 0
+@S80:
+.byte 37
+.byte 37
+.byte 114
+.byte 101
+.byte 115
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S81:
+.byte 10
+.byte 0
+@S82:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S83:
+.byte 10
+.byte 0
+@S84:
+.byte 98
+.byte 103
+.byte 116
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S85:
+.byte 10
+.byte 0
+@S86:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S87:
+.byte 10
+.byte 0
+@S88:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S89:
+.byte 10
+.byte 0
+@S90:
+.byte 98
+.byte 108
+.byte 116
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S91:
+.byte 10
+.byte 0
+@S92:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S93:
+.byte 10
+.byte 0
+@S94:
+.byte 115
+.byte 117
+.byte 98
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 0
+@S95:
+.byte 10
+.byte 0
+@S96:
+.byte 108
+.byte 97
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 64
+.byte 106
+.byte 116
+.byte 37
+.byte 100
+.byte 0
+@S97:
+.byte 10
+.byte 0
+@S98:
+.byte 115
+.byte 108
+.byte 108
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 50
+.byte 0
+@S99:
+.byte 10
+.byte 0
+@S100:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 0
+@S101:
+.byte 10
+.byte 0
+@S102:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S103:
+.byte 10
+.byte 0
+@S104:
+.byte 106
+.byte 97
+.byte 108
+.byte 114
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S105:
+.byte 10
+.byte 0
+@S106:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S107:
+.byte 10
+.byte 0
+@S108:
+.byte 37
+.byte 115
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S109:
+.byte 37
+.byte 115
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S110:
+.byte 37
+.byte 37
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S111:
+.byte 10
+.byte 0
+@S112:
+.byte 64
+.byte 106
+.byte 116
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S113:
+.byte 10
+.byte 0
+@S114:
+.byte 37
+.byte 37
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S115:
+.byte 10
+.byte 0
+@S116:
+.byte 37
+.byte 37
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S117:
+.byte 10
+.byte 0
+@S118:
+.byte 98
+.byte 32
+.byte 37
+.byte 115
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S119:
+.byte 10
+.byte 0
+@S120:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S121:
+.byte 10
+.byte 0
+@S122:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S123:
+.byte 10
+.byte 0
+@S124:
+.byte 98
+.byte 101
+.byte 113
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S125:
+.byte 10
+.byte 0
+@S126:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S127:
+.byte 10
+.byte 0
+@S128:
+.byte 37
+.byte 37
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 48
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 10
+.byte 0
+@S129:
+.byte 37
+.byte 37
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 48
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 10
+.byte 0
+@S130:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 114
+.byte 101
+.byte 103
+.byte 48
+.byte 0
+@S131:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S132:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S133:
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 54
+.byte 53
+.byte 53
+.byte 51
+.byte 53
+.byte 0
+@S134:
+.byte 10
+.byte 0
+@S135:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S136:
+.byte 10
+.byte 0
+@S137:
+.byte 108
+.byte 97
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S138:
+.byte 10
+.byte 0
+@S139:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S140:
+.byte 10
+.byte 0
+@S141:
+.byte 108
+.byte 104
+.byte 0
+@S142:
+.byte 108
+.byte 104
+.byte 117
+.byte 0
+@S143:
+.byte 108
+.byte 98
+.byte 0
+@S144:
+.byte 108
+.byte 98
+.byte 117
+.byte 0
+@S145:
+.byte 108
+.byte 119
+.byte 0
+@S146:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S147:
+.byte 10
+.byte 0
+@S148:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S149:
+.byte 10
+.byte 0
+@S150:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S151:
+.byte 10
+.byte 0
+@S152:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S153:
+.byte 10
+.byte 0
+@S154:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S155:
+.byte 10
+.byte 0
+@S156:
+.byte 37
+.byte 115
+.byte 32
+.byte 61
+.byte 62
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 58
+.byte 36
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S157:
+.byte 37
+.byte 115
+.byte 32
+.byte 61
+.byte 62
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S158:
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 50
+.byte 0
+@S159:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S160:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S161:
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S162:
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S163:
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S164:
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S165:
+.byte 108
+.byte 97
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S166:
+.byte 10
+.byte 0
+@S167:
+.byte 108
+.byte 97
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S168:
+.byte 10
+.byte 0
+@S169:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 51
+.byte 48
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S170:
+.byte 10
+.byte 0
+@S171:
+.byte 109
+.byte 117
+.byte 108
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S172:
+.byte 10
+.byte 0
+@S173:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S174:
+.byte 10
+.byte 0
+@S175:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S176:
+.byte 10
+.byte 0
+@S177:
+.byte 108
+.byte 104
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S178:
+.byte 10
+.byte 0
+@S179:
+.byte 108
+.byte 104
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S180:
+.byte 10
+.byte 0
+@S181:
+.byte 108
+.byte 98
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S182:
+.byte 10
+.byte 0
+@S183:
+.byte 108
+.byte 98
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S184:
+.byte 10
+.byte 0
+@S185:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S186:
+.byte 10
+.byte 0
+@S187:
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S188:
+.byte 10
+.byte 0
+@S189:
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S190:
+.byte 10
+.byte 0
+@S191:
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S192:
+.byte 10
+.byte 0
+@S193:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 52
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S194:
+.byte 10
+.byte 0
+@S195:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 52
+.byte 0
+@S196:
+.byte 10
+.byte 0
+@S197:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 52
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S198:
+.byte 10
+.byte 0
+@S199:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 53
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S200:
+.byte 10
+.byte 0
+@S201:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 56
+.byte 0
+@S202:
+.byte 10
+.byte 0
+@S203:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 52
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S204:
+.byte 10
+.byte 0
+@S205:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 53
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S206:
+.byte 10
+.byte 0
+@S207:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 54
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S208:
+.byte 10
+.byte 0
+@S209:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 49
+.byte 50
+.byte 0
+@S210:
+.byte 10
+.byte 0
+@S211:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 52
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S212:
+.byte 10
+.byte 0
+@S213:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 53
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S214:
+.byte 10
+.byte 0
+@S215:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 54
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S216:
+.byte 10
+.byte 0
+@S217:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 55
+.byte 44
+.byte 32
+.byte 49
+.byte 50
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S218:
+.byte 10
+.byte 0
+@S219:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 49
+.byte 54
+.byte 0
+@S220:
+.byte 10
+.byte 0
+@S221:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 109
+.byte 117
+.byte 108
+.byte 54
+.byte 52
+.byte 0
+@S222:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 100
+.byte 105
+.byte 118
+.byte 54
+.byte 52
+.byte 0
+@S223:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 100
+.byte 105
+.byte 118
+.byte 54
+.byte 52
+.byte 0
+@S224:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 109
+.byte 111
+.byte 100
+.byte 54
+.byte 52
+.byte 0
+@S225:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 109
+.byte 111
+.byte 100
+.byte 54
+.byte 52
+.byte 0
+@S226:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 104
+.byte 108
+.byte 54
+.byte 52
+.byte 0
+@S227:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 115
+.byte 104
+.byte 114
+.byte 54
+.byte 52
+.byte 0
+@S228:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 115
+.byte 104
+.byte 114
+.byte 54
+.byte 52
+.byte 0
+@S229:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S230:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S231:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S232:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S233:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S234:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S235:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S236:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S237:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S238:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S239:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S240:
+.byte 10
+.byte 0
+@S241:
+.byte 115
+.byte 108
+.byte 116
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S242:
+.byte 10
+.byte 0
+@S243:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S244:
+.byte 10
+.byte 0
+@S245:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 0
+@S246:
+.byte 10
+.byte 0
+@S247:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S248:
+.byte 10
+.byte 0
+@S249:
+.byte 114
+.byte 101
+.byte 109
+.byte 117
+.byte 0
+@S250:
+.byte 114
+.byte 101
+.byte 109
+.byte 0
+@S251:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S252:
+.byte 10
+.byte 0
+@S253:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 45
+.byte 49
+.byte 50
+.byte 0
+@S254:
+.byte 10
+.byte 0
+@S255:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S256:
+.byte 10
+.byte 0
+@S257:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S258:
+.byte 10
+.byte 0
+@S259:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S260:
+.byte 10
+.byte 0
+@S261:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S262:
+.byte 10
+.byte 0
+@S263:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S264:
+.byte 10
+.byte 0
+@S265:
+.byte 106
+.byte 97
+.byte 108
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S266:
+.byte 10
+.byte 0
+@S267:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S268:
+.byte 10
+.byte 0
+@S269:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S270:
+.byte 10
+.byte 0
+@S271:
+.byte 115
+.byte 117
+.byte 98
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 48
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S272:
+.byte 10
+.byte 0
+@S273:
+.byte 115
+.byte 108
+.byte 116
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 36
+.byte 48
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S274:
+.byte 10
+.byte 0
+@S275:
+.byte 115
+.byte 117
+.byte 98
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 48
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S276:
+.byte 10
+.byte 0
+@S277:
+.byte 115
+.byte 117
+.byte 98
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 0
+@S278:
+.byte 10
+.byte 0
+@S279:
+.byte 110
+.byte 101
+.byte 103
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S280:
+.byte 10
+.byte 0
+@S281:
+.byte 115
+.byte 110
+.byte 101
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S282:
+.byte 10
+.byte 0
+@S283:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S284:
+.byte 10
+.byte 0
+@S285:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 43
+.byte 52
+.byte 0
+@S286:
+.byte 10
+.byte 0
+@S287:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S288:
+.byte 10
+.byte 0
+@S289:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 43
+.byte 52
+.byte 0
+@S290:
+.byte 10
+.byte 0
+@S291:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S292:
+.byte 10
+.byte 0
+@S293:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S294:
+.byte 10
+.byte 0
+@S295:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S296:
+.byte 10
+.byte 0
+@S297:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S298:
+.byte 10
+.byte 0
+@S299:
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S300:
+.byte 10
+.byte 0
+@S301:
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S302:
+.byte 10
+.byte 0
+@S303:
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S304:
+.byte 10
+.byte 0
+@S305:
+.byte 98
+.byte 32
+.byte 37
+.byte 115
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S306:
+.byte 10
+.byte 0
+@S307:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S308:
+.byte 10
+.byte 0
+@S309:
+.byte 98
+.byte 110
+.byte 101
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 46
+.byte 115
+.byte 119
+.byte 54
+.byte 52
+.byte 76
+.byte 37
+.byte 117
+.byte 0
+@S310:
+.byte 10
+.byte 0
+@S311:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S312:
+.byte 10
+.byte 0
+@S313:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S314:
+.byte 10
+.byte 0
+@S315:
+.byte 98
+.byte 101
+.byte 113
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S316:
+.byte 10
+.byte 0
+@S317:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S318:
+.byte 10
+.byte 0
+@S319:
+.byte 37
+.byte 115
+.byte 46
+.byte 115
+.byte 119
+.byte 54
+.byte 52
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S320:
+.byte 10
+.byte 0
+@S321:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 45
+.byte 52
+.byte 0
+@S322:
+.byte 10
+.byte 0
+@S323:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 52
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S324:
+.byte 10
+.byte 0
+@S325:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 45
+.byte 56
+.byte 0
+@S326:
+.byte 10
+.byte 0
+@S327:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 52
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S328:
+.byte 10
+.byte 0
+@S329:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 53
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S330:
+.byte 10
+.byte 0
+@S331:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 45
+.byte 49
+.byte 50
+.byte 0
+@S332:
+.byte 10
+.byte 0
+@S333:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 52
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S334:
+.byte 10
+.byte 0
+@S335:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 53
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S336:
+.byte 10
+.byte 0
+@S337:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 54
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S338:
+.byte 10
+.byte 0
+@S339:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 45
+.byte 49
+.byte 54
+.byte 0
+@S340:
+.byte 10
+.byte 0
+@S341:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 52
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S342:
+.byte 10
+.byte 0
+@S343:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 53
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S344:
+.byte 10
+.byte 0
+@S345:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 54
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S346:
+.byte 10
+.byte 0
+@S347:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 55
+.byte 44
+.byte 32
+.byte 49
+.byte 50
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S348:
+.byte 10
+.byte 0
+@S349:
+.byte 37
+.byte 37
+.byte 122
+.byte 101
+.byte 114
+.byte 111
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S350:
+.byte 10
+.byte 0
+@S351:
+.byte 37
+.byte 37
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S352:
+.byte 10
+.byte 0
+@S353:
+.byte 37
+.byte 37
+.byte 122
+.byte 101
+.byte 114
+.byte 111
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S354:
+.byte 10
+.byte 0
+@S355:
+.byte 37
+.byte 37
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S356:
+.byte 10
+.byte 0
+@S357:
+.byte 37
+.byte 37
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S358:
+.byte 10
+.byte 0
+@S359:
+.byte 37
+.byte 37
+.byte 122
+.byte 101
+.byte 114
+.byte 111
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S360:
+.byte 10
+.byte 0
+@S361:
+.byte 37
+.byte 37
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S362:
+.byte 10
+.byte 0
+@S363:
+.byte 37
+.byte 37
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 0
+@S364:
+.byte 37
+.byte 37
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 50
+.byte 0
+@S365:
+.byte 10
+.byte 0
+@S366:
+.byte 37
+.byte 37
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 0
+@S367:
+.byte 37
+.byte 37
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 56
+.byte 0
+@S368:
+.byte 10
+.byte 0
+@S369:
+.byte 37
+.byte 37
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 0
+@S370:
+.byte 37
+.byte 117
+.byte 0
+@S371:
+.byte 10
+.byte 0
+@S372:
+.byte 37
+.byte 37
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 0
+@S373:
+.byte 37
+.byte 117
+.byte 0
+@S374:
+.byte 10
+.byte 0
+@S375:
+.byte 37
+.byte 37
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 52
+.byte 0
+@S376:
+.byte 10
+.byte 0
+@S377:
+.byte 37
+.byte 37
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 0
+@S378:
+.byte 37
+.byte 117
+.byte 0
+@S379:
+.byte 10
+.byte 0
+@S380:
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 0
+@S381:
+.byte 10
+.byte 0
+@S382:
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 97
+.byte 114
+.byte 103
+.byte 0
+@S383:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S384:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S385:
+.byte 115
+.byte 119
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S386:
+.byte 10
+.byte 0
+@S387:
+.byte 115
+.byte 119
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S388:
+.byte 10
+.byte 0
+@S389:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S390:
+.byte 10
+.byte 0
+@S391:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S392:
+.byte 10
+.byte 0
+@S393:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S394:
+.byte 10
+.byte 0
+@S395:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S396:
+.byte 10
+.byte 0
+@S397:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S398:
+.byte 10
+.byte 0
+@S399:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S400:
+.byte 10
+.byte 0
+@S401:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S402:
+.byte 10
+.byte 0
+@S403:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S404:
+.byte 10
+.byte 0
+@S405:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S406:
+.byte 10
+.byte 0
+@S407:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 49
+.byte 50
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S408:
+.byte 10
+.byte 0
+@S409:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S410:
+.byte 10
+.byte 0
+@S411:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S412:
+.byte 10
+.byte 0
+@S413:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S414:
+.byte 10
+.byte 0
+@S415:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S416:
+.byte 10
+.byte 0
+@S417:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S418:
+.byte 10
+.byte 0
+@S419:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 50
+.byte 53
+.byte 41
+.byte 0
+@S420:
+.byte 10
+.byte 0
+@S421:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 45
+.byte 49
+.byte 50
+.byte 0
+@S422:
+.byte 10
+.byte 0
+@S423:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S424:
+.byte 10
+.byte 0
+@S425:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S426:
+.byte 10
+.byte 0
+@S427:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S428:
+.byte 10
+.byte 0
+@S429:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S430:
+.byte 10
+.byte 0
+@S431:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S432:
+.byte 10
+.byte 0
+@S433:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S434:
+.byte 10
+.byte 0
+@S435:
+.byte 106
+.byte 97
+.byte 108
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S436:
+.byte 10
+.byte 0
+@S437:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S438:
+.byte 10
+.byte 0
+@S439:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 45
+.byte 49
+.byte 50
+.byte 0
+@S440:
+.byte 10
+.byte 0
+@S441:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S442:
+.byte 10
+.byte 0
+@S443:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S444:
+.byte 10
+.byte 0
+@S445:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S446:
+.byte 10
+.byte 0
+@S447:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S448:
+.byte 10
+.byte 0
+@S449:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S450:
+.byte 10
+.byte 0
+@S451:
+.byte 106
+.byte 97
+.byte 108
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S452:
+.byte 10
+.byte 0
+@S453:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S454:
+.byte 10
+.byte 0
+@S455:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S456:
+.byte 10
+.byte 0
+@S457:
+.byte 106
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S458:
+.byte 10
+.byte 0
+@S459:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S460:
+.byte 10
+.byte 0
+@S461:
+.byte 46
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S462:
+.byte 46
+.byte 116
+.byte 101
+.byte 120
+.byte 116
+.byte 0
+@S463:
+.byte 46
+.byte 98
+.byte 115
+.byte 115
+.byte 0
+@S464:
+.byte 46
+.byte 114
+.byte 111
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S465:
+.byte 115
+.byte 101
+.byte 113
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 48
+.byte 0
+@S466:
+.byte 10
+.byte 0
+@S467:
+.byte 98
+.byte 32
+.byte 37
+.byte 115
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S468:
+.byte 10
+.byte 0
+@S469:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S470:
+.byte 10
+.byte 0
+@S471:
+.byte 115
+.byte 108
+.byte 108
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S472:
+.byte 10
+.byte 0
+@S473:
+.byte 115
+.byte 114
+.byte 108
+.byte 0
+@S474:
+.byte 115
+.byte 114
+.byte 97
+.byte 0
+@S475:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S476:
+.byte 10
+.byte 0
+@S477:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S478:
+.byte 10
+.byte 0
+@S479:
+.byte 115
+.byte 114
+.byte 97
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 51
+.byte 49
+.byte 0
+@S480:
+.byte 10
+.byte 0
+@S481:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S482:
+.byte 10
+.byte 0
+@S483:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S484:
+.byte 10
+.byte 0
+@S485:
+.byte 108
+.byte 97
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S486:
+.byte 10
+.byte 0
+@S487:
+.byte 99
+.byte 108
+.byte 101
+.byte 97
+.byte 114
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S488:
+.byte 10
+.byte 0
+@S489:
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 108
+.byte 111
+.byte 97
+.byte 100
+.byte 50
+.byte 0
+@S490:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S491:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S492:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S493:
+.byte 10
+.byte 0
+@S494:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S495:
+.byte 10
+.byte 0
+@S496:
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 108
+.byte 111
+.byte 97
+.byte 100
+.byte 50
+.byte 0
+@S497:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S498:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S499:
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 108
+.byte 111
+.byte 97
+.byte 100
+.byte 50
+.byte 0
+@S500:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S501:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S502:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S503:
+.byte 10
+.byte 0
+@S504:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 43
+.byte 52
+.byte 0
+@S505:
+.byte 10
+.byte 0
+@S506:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S507:
+.byte 10
+.byte 0
+@S508:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 43
+.byte 52
+.byte 0
+@S509:
+.byte 10
+.byte 0
+@S510:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S511:
+.byte 10
+.byte 0
+@S512:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S513:
+.byte 10
+.byte 0
+@S514:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S515:
+.byte 10
+.byte 0
+@S516:
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 108
+.byte 111
+.byte 97
+.byte 100
+.byte 50
+.byte 0
+@S517:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S518:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S519:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S520:
+.byte 10
+.byte 0
+@S521:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S522:
+.byte 10
+.byte 0
+@S523:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S524:
+.byte 10
+.byte 0
+@S525:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 52
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S526:
+.byte 10
+.byte 0
+@S527:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 52
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S528:
+.byte 10
+.byte 0
+@S529:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 52
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S530:
+.byte 10
+.byte 0
+@S531:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 53
+.byte 44
+.byte 32
+.byte 49
+.byte 50
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S532:
+.byte 10
+.byte 0
+@S533:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 52
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S534:
+.byte 10
+.byte 0
+@S535:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 53
+.byte 44
+.byte 32
+.byte 49
+.byte 50
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S536:
+.byte 10
+.byte 0
+@S537:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 54
+.byte 44
+.byte 32
+.byte 49
+.byte 54
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S538:
+.byte 10
+.byte 0
+@S539:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 52
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S540:
+.byte 10
+.byte 0
+@S541:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 53
+.byte 44
+.byte 32
+.byte 49
+.byte 50
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S542:
+.byte 10
+.byte 0
+@S543:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 54
+.byte 44
+.byte 32
+.byte 49
+.byte 54
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S544:
+.byte 10
+.byte 0
+@S545:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 55
+.byte 44
+.byte 32
+.byte 50
+.byte 48
+.byte 40
+.byte 36
+.byte 51
+.byte 48
+.byte 41
+.byte 0
+@S546:
+.byte 10
+.byte 0
+@S547:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 48
+.byte 0
+@S548:
+.byte 10
+.byte 0
+@S549:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 45
+.byte 49
+.byte 54
+.byte 0
+@S550:
+.byte 10
+.byte 0
+@S551:
+.byte 106
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S552:
+.byte 10
+.byte 0
+@S553:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S554:
+.byte 10
+.byte 0
+@S555:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 49
+.byte 54
+.byte 0
+@S556:
+.byte 10
+.byte 0
+@S557:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 45
+.byte 49
+.byte 54
+.byte 0
+@S558:
+.byte 10
+.byte 0
+@S559:
+.byte 106
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S560:
+.byte 10
+.byte 0
+@S561:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S562:
+.byte 10
+.byte 0
+@S563:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 49
+.byte 54
+.byte 0
+@S564:
+.byte 10
+.byte 0
+@S565:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 54
+.byte 44
+.byte 32
+.byte 48
+.byte 0
+@S566:
+.byte 10
+.byte 0
+@S567:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 55
+.byte 44
+.byte 32
+.byte 48
+.byte 0
+@S568:
+.byte 10
+.byte 0
+@S569:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 45
+.byte 49
+.byte 54
+.byte 0
+@S570:
+.byte 10
+.byte 0
+@S571:
+.byte 106
+.byte 97
+.byte 108
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S572:
+.byte 10
+.byte 0
+@S573:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S574:
+.byte 10
+.byte 0
+@S575:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 49
+.byte 54
+.byte 0
+@S576:
+.byte 10
+.byte 0
+@S577:
+.byte 115
+.byte 101
+.byte 113
+.byte 32
+.byte 36
+.byte 50
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 44
+.byte 32
+.byte 49
+.byte 0
+@S578:
+.byte 10
+.byte 0
+@S579:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 45
+.byte 49
+.byte 54
+.byte 0
+@S580:
+.byte 10
+.byte 0
+@S581:
+.byte 106
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S582:
+.byte 10
+.byte 0
+@S583:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S584:
+.byte 10
+.byte 0
+@S585:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 49
+.byte 54
+.byte 0
+@S586:
+.byte 10
+.byte 0
+@S587:
+.byte 115
+.byte 101
+.byte 113
+.byte 32
+.byte 36
+.byte 50
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 44
+.byte 32
+.byte 49
+.byte 0
+@S588:
+.byte 10
+.byte 0
+@S589:
+.byte 115
+.byte 110
+.byte 101
+.byte 32
+.byte 36
+.byte 50
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 44
+.byte 32
+.byte 49
+.byte 0
+@S590:
+.byte 10
+.byte 0
+@S591:
+.byte 115
+.byte 101
+.byte 113
+.byte 32
+.byte 36
+.byte 50
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 44
+.byte 32
+.byte 52
+.byte 0
+@S592:
+.byte 10
+.byte 0
+@S593:
+.byte 115
+.byte 101
+.byte 113
+.byte 32
+.byte 36
+.byte 50
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 44
+.byte 32
+.byte 50
+.byte 0
+@S594:
+.byte 10
+.byte 0
+@S595:
+.byte 115
+.byte 110
+.byte 101
+.byte 32
+.byte 36
+.byte 50
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 44
+.byte 32
+.byte 52
+.byte 0
+@S596:
+.byte 10
+.byte 0
+@S597:
+.byte 115
+.byte 110
+.byte 101
+.byte 32
+.byte 36
+.byte 50
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 44
+.byte 32
+.byte 50
+.byte 0
+@S598:
+.byte 10
+.byte 0
+@S599:
+.byte 115
+.byte 117
+.byte 98
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S600:
+.byte 10
+.byte 0
+@S601:
+.byte 115
+.byte 108
+.byte 116
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 0
+@S602:
+.byte 10
+.byte 0
+@S603:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 0
+@S604:
+.byte 10
+.byte 0
+@S605:
+.byte 115
+.byte 117
+.byte 98
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S606:
+.byte 10
+.byte 0
+@S607:
+.byte 115
+.byte 117
+.byte 98
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S608:
+.byte 10
+.byte 0
+@S609:
+.byte 115
+.byte 117
+.byte 98
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S610:
+.byte 10
+.byte 0
+@S611:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 45
+.byte 37
+.byte 115
+.byte 0
+@S612:
+.byte 10
+.byte 0
+@S613:
+.byte 10
+.byte 0
+@S614:
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 61
+.byte 61
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 114
+.byte 116
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 61
+.byte 61
+.byte 61
+.byte 61
+.byte 0
+@S615:
+.byte 10
+.byte 0
+@S616:
+.byte 37
+.byte 37
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S617:
+.byte 10
+.byte 0
+@S618:
+.byte 37
+.byte 37
+.byte 103
+.byte 108
+.byte 111
+.byte 98
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S619:
+.byte 10
+.byte 0
+@S620:
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S621:
+.byte 10
+.byte 0
+@S622:
+.byte 59
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S623:
+.byte 10
+.byte 0
+@S624:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 52
+.byte 44
+.byte 32
+.byte 36
+.byte 51
+.byte 48
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S625:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S626:
+.byte 10
+.byte 0
+@S627:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 51
+.byte 49
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S628:
+.byte 10
+.byte 0
+@S629:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 51
+.byte 48
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S630:
+.byte 10
+.byte 0
+@S631:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 51
+.byte 48
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S632:
+.byte 10
+.byte 0
+@S633:
+.byte 109
+.byte 111
+.byte 118
+.byte 101
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 51
+.byte 48
+.byte 0
+@S634:
+.byte 10
+.byte 0
+@S635:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 51
+.byte 48
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S636:
+.byte 10
+.byte 0
+@S637:
+.byte 108
+.byte 119
+.byte 32
+.byte 36
+.byte 51
+.byte 49
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S638:
+.byte 10
+.byte 0
+@S639:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 56
+.byte 0
+@S640:
+.byte 10
+.byte 0
+@S641:
+.byte 106
+.byte 114
+.byte 32
+.byte 36
+.byte 51
+.byte 49
+.byte 0
+@S642:
+.byte 10
+.byte 0
+@S643:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S644:
+.byte 10
+.byte 0
+@S645:
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 95
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 0
+@S646:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S647:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S648:
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S649:
+.byte 10
+.byte 0
+@S650:
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 43
+.byte 0
+@S651:
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 43
+.byte 0
+@S652:
+.byte 37
+.byte 115
+.byte 43
+.byte 0
+@S653:
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 95
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 0
+@S654:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S655:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S656:
+.byte 115
+.byte 103
+.byte 101
+.byte 0
+@S657:
+.byte 115
+.byte 103
+.byte 101
+.byte 117
+.byte 0
+@S658:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S659:
+.byte 10
+.byte 0
+@S660:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S661:
+.byte 10
+.byte 0
+@S662:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S663:
+.byte 10
+.byte 0
+@S664:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S665:
+.byte 10
+.byte 0
+@S666:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S667:
+.byte 10
+.byte 0
+@S668:
+.byte 108
+.byte 97
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S669:
+.byte 10
+.byte 0
+@S670:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S671:
+.byte 10
+.byte 0
+@S672:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 48
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S673:
+.byte 10
+.byte 0
+@S674:
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 105
+.byte 110
+.byte 100
+.byte 95
+.byte 97
+.byte 115
+.byte 110
+.byte 0
+@S675:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S676:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S677:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S678:
+.byte 10
+.byte 0
+@S679:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S680:
+.byte 10
+.byte 0
+@S681:
+.byte 97
+.byte 100
+.byte 100
+.byte 117
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 36
+.byte 50
+.byte 57
+.byte 44
+.byte 32
+.byte 45
+.byte 49
+.byte 50
+.byte 0
+@S682:
+.byte 10
+.byte 0
+@S683:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S684:
+.byte 10
+.byte 0
+@S685:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 52
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S686:
+.byte 10
+.byte 0
+@S687:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S688:
+.byte 10
+.byte 0
+@S689:
+.byte 115
+.byte 119
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 56
+.byte 40
+.byte 36
+.byte 50
+.byte 57
+.byte 41
+.byte 0
+@S690:
+.byte 10
+.byte 0
+@S691:
+.byte 106
+.byte 97
+.byte 108
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S692:
+.byte 10
+.byte 0
+@S693:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S694:
+.byte 10
+.byte 0
+@S695:
+.byte 115
+.byte 104
+.byte 0
+@S696:
+.byte 115
+.byte 98
+.byte 0
+@S697:
+.byte 115
+.byte 119
+.byte 0
+@S698:
+.byte 108
+.byte 105
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S699:
+.byte 10
+.byte 0
+@S700:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S701:
+.byte 10
+.byte 0
+@S702:
+.byte 108
+.byte 97
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S703:
+.byte 10
+.byte 0
+@S704:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 50
+.byte 53
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S705:
+.byte 10
+.byte 0
+@S706:
+.byte 37
+.byte 115
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 48
+.byte 40
+.byte 36
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S707:
+.byte 10
+.byte 0
+@S708:
+.byte 111
+.byte 114
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 0
+@S709:
+.byte 10
+.byte 0
+@S710:
+.byte 98
+.byte 101
+.byte 113
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 48
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S711:
+.byte 10
+.byte 0
+@S712:
+.byte 98
+.byte 110
+.byte 101
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 48
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S713:
+.byte 10
+.byte 0
+@S714:
+.byte 110
+.byte 111
+.byte 112
+.byte 0
+@S715:
+.byte 10
+.byte 0
+@S716:
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S717:
+.byte 10
+.byte 0
+@S718:
+.byte 10
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 32
+.byte 111
+.byte 98
+.byte 106
+.byte 101
+.byte 99
+.byte 116
+.byte 115
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 32
+.byte 100
+.byte 117
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S719:
+.byte 10
+.byte 0
+@S720:
+.byte 10
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 32
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 115
+.byte 121
+.byte 109
+.byte 98
+.byte 111
+.byte 108
+.byte 115
+.byte 0
+@S721:
+.byte 10
+.byte 0
+@S722:
+.byte 37
+.byte 37
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S723:
+.byte 10
+.byte 0
+@S724:
+.byte 37
+.byte 37
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S725:
+.byte 10
+.byte 0
+@S726:
+.byte 37
+.byte 37
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 109
+.byte 101
+.byte 109
+.byte 115
+.byte 101
+.byte 116
+.byte 0
+@S727:
+.byte 10
+.byte 0
+@S728:
+.byte 37
+.byte 37
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 109
+.byte 105
+.byte 112
+.byte 115
+.byte 95
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S729:
+.byte 10
+.byte 0
+@S730:
+.byte 37
+.byte 37
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 109
+.byte 117
+.byte 108
+.byte 54
+.byte 52
+.byte 0
+@S731:
+.byte 10
+.byte 0
+@S732:
+.byte 37
+.byte 37
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 100
+.byte 105
+.byte 118
+.byte 54
+.byte 52
+.byte 0
+@S733:
+.byte 10
+.byte 0
+@S734:
+.byte 37
+.byte 37
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 100
+.byte 105
+.byte 118
+.byte 54
+.byte 52
+.byte 0
+@S735:
+.byte 10
+.byte 0
+@S736:
+.byte 37
+.byte 37
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 109
+.byte 111
+.byte 100
+.byte 54
+.byte 52
+.byte 0
+@S737:
+.byte 10
+.byte 0
+@S738:
+.byte 37
+.byte 37
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 109
+.byte 111
+.byte 100
+.byte 54
+.byte 52
+.byte 0
+@S739:
+.byte 10
+.byte 0
+@S740:
+.byte 37
+.byte 37
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 104
+.byte 108
+.byte 54
+.byte 52
+.byte 0
+@S741:
+.byte 10
+.byte 0
+@S742:
+.byte 37
+.byte 37
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 115
+.byte 104
+.byte 114
+.byte 54
+.byte 52
+.byte 0
+@S743:
+.byte 10
+.byte 0
+@S744:
+.byte 37
+.byte 37
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 115
+.byte 104
+.byte 114
+.byte 54
+.byte 52
+.byte 0
+@S745:
+.byte 10
+.byte 0
+@S746:
+.byte 37
+.byte 37
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S747:
+.byte 10
+.byte 0
+@S748:
+.byte 37
+.byte 37
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S749:
+.byte 10
+.byte 0
+@S750:
+.byte 10
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 108
+.byte 105
+.byte 116
+.byte 101
+.byte 114
+.byte 97
+.byte 108
+.byte 115
+.byte 10
+.byte 0
+@S751:
+.byte 37
+.byte 37
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 46
+.byte 114
+.byte 111
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 10
+.byte 0
+@S752:
+.byte 120
+.byte 111
+.byte 114
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S753:
+.byte 10
+.byte 0
+@S754:
+.byte 120
+.byte 111
+.byte 114
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S755:
+.byte 10
+.byte 0
+@S756:
+.byte 120
+.byte 111
+.byte 114
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 100
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S757:
+.byte 10
+.byte 0
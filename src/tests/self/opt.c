@@ -0,0 +1,1808 @@
+/*
+ * Machine-independent optimizations.
+ *
+ * The transformations of opt_main() are done in place over the quads of
+ * every function. Because the CFG and the nid counter must stay unchanged
+ * from this point on, instructions are never inserted nor moved; at most
+ * they are rewritten or turned into OpNOp.
+ *
+ * The inliner runs before that, while the functions can still be rewritten
+ * (see replace_function_body()).
+ */
+#define DEBUG 0
+#include "opt.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "util/util.h"
+#include "ic.h"
+#include "expr.h"
+#include "decl.h"
+#include "dflow.h"
+#include "util/bset.h"
+#include "util/arena.h"
+#include "luxcc.h"
+
+#define MAX_OPT_ROUNDS  8
+
+static TypeExp int_expr = { TOK_INT };
+static Declaration int_ty = { &int_expr };
+static TypeExp long_long_expr = { TOK_LONG_LONG };
+static Declaration long_long_ty = { &long_long_expr };
+
+static int is_volatile(ExecNode *e)
+{
+    TypeExp *tq;
+
+    if (get_type_category(&e->type) == TOK_STAR)
+        tq = e->type.idl->attr.el;
+    else
+        tq = get_type_qual(e->type.decl_specs);
+    return (tq!=NULL && (tq->op==TOK_VOLATILE||tq->op==TOK_CONST_VOLATILE));
+}
+
+static int is_scalar_type(Declaration *ty)
+{
+    Token cat;
+
+    cat = get_type_category(ty);
+    return (is_integer(cat) || cat==TOK_STAR);
+}
+
+/*
+ * Variables of the current function that are the operand of an OpAddrOf.
+ * Besides the address-taken ones, these include the automatic variables
+ * with an initializer, which are initialized through a pointer.
+ */
+static BSet *addressed_variables;
+
+/*
+ * Return TRUE if the object designated by address 'a' can only be accessed
+ * through its name. These are non-volatile scalar automatic variables whose
+ * address is never taken (plus temporaries, which trivially qualify).
+ */
+static int is_tracked(unsigned a)
+{
+    ExecNode *e;
+
+    if (address(a).kind == TempKind)
+        return TRUE;
+    if (address(a).kind != IdKind)
+        return FALSE;
+    e = address(a).cont.var.e;
+    return (e->attr.var.duration == DURATION_AUTO
+    && !bset_member(address_taken_variables, address_nid(a))
+    && !bset_member(addressed_variables, address_nid(a))
+    && is_scalar_type(&e->type)
+    && !is_volatile(e));
+}
+
+/* reduce 'v' to the range of values representable by 'ty' */
+static long long truncate_const(long long v, Declaration *ty)
+{
+    unsigned siz;
+    unsigned long long m;
+
+    if ((siz=get_sizeof(ty)) >= sizeof(long long))
+        return v;
+    m = (1ULL<<siz*8)-1;
+    v = (long long)((unsigned long long)v & m);
+    if (is_signed_int(get_type_category(ty)) && (v & (1LL<<(siz*8-1))))
+        v = (long long)((unsigned long long)v | ~m);
+    return v;
+}
+
+static unsigned new_const_addr(long long val)
+{
+    unsigned a;
+
+    a = new_address(IConstKind);
+    address(a).cont.val = val;
+    return a;
+}
+
+// =======================================================================================
+// Constant folding
+// =======================================================================================
+/*
+ * Fold quad 'i' if all its operands are integer constants.
+ * Return TRUE if the quad was changed.
+ *
+ * Unlike ic_simplify(), the result is computed with the width and
+ * signedness of the quad's type, and the address of the result is
+ * always a new one (constant addresses are never shared).
+ */
+static int fold_quad(unsigned i)
+{
+    Quad *q;
+    Token cat;
+    long long x, y, r;
+    unsigned long long ux, uy;
+
+    q = &instruction(i);
+    switch (q->op) {
+    case OpAdd: case OpSub: case OpMul: case OpDiv:
+    case OpRem: case OpSHL: case OpSHR: case OpAnd:
+    case OpOr: case OpXor:
+        if (address(q->arg1).kind!=IConstKind || address(q->arg2).kind!=IConstKind)
+            return FALSE;
+        cat = get_type_category(q->type);
+        x = truncate_const(address(q->arg1).cont.val, q->type);
+        y = truncate_const(address(q->arg2).cont.val, q->type);
+        ux = (unsigned long long)x;
+        uy = (unsigned long long)y;
+        switch (q->op) {
+        case OpAdd: r = (long long)(ux+uy); break;
+        case OpSub: r = (long long)(ux-uy); break;
+        case OpMul: r = (long long)(ux*uy); break;
+        case OpDiv:
+        case OpRem:
+            if (y == 0)
+                return FALSE;
+            if (is_signed_int(cat)) {
+                if (y==-1 && x==(long long)(1ULL<<63))
+                    return FALSE;
+                r = (q->op == OpDiv) ? x/y : x%y;
+            } else {
+                if (get_sizeof(q->type) < sizeof(long long)) {
+                    ux &= (1ULL<<get_sizeof(q->type)*8)-1;
+                    uy &= (1ULL<<get_sizeof(q->type)*8)-1;
+                }
+                r = (long long)((q->op == OpDiv) ? ux/uy : ux%uy);
+            }
+            break;
+        case OpSHL:
+        case OpSHR:
+            if (y<0 || y>=get_sizeof(q->type)*8)
+                return FALSE;
+            if (q->op == OpSHL)
+                r = (long long)(ux<<y);
+            else if (is_signed_int(cat))
+                r = x>>y;
+            else if (get_sizeof(q->type) < sizeof(long long))
+                r = (long long)((ux&((1ULL<<get_sizeof(q->type)*8)-1))>>y);
+            else
+                r = (long long)(ux>>y);
+            break;
+        case OpAnd: r = x&y; break;
+        case OpOr:  r = x|y; break;
+        case OpXor: r = x^y; break;
+        default: assert(0); return FALSE;
+        }
+        q->op = OpAsn;
+        q->arg1 = new_const_addr(truncate_const(r, q->type));
+        q->arg2 = 0;
+        return TRUE;
+
+    case OpEQ: case OpNEQ:
+    case OpLT: case OpLET:
+    case OpGT: case OpGET: {
+        long flags;
+
+        if (address(q->arg1).kind!=IConstKind || address(q->arg2).kind!=IConstKind)
+            return FALSE;
+        flags = (long)q->type;
+        x = address(q->arg1).cont.val;
+        y = address(q->arg2).cont.val;
+        if (!(flags & IC_WIDE)) {
+            if (flags & IC_SIGNED)
+                x = (int)x, y = (int)y;
+            else
+                x = (unsigned)x, y = (unsigned)y;
+        }
+        ux = (unsigned long long)x;
+        uy = (unsigned long long)y;
+        switch (q->op) {
+        case OpEQ:  r = x == y; break;
+        case OpNEQ: r = x != y; break;
+        case OpLT:  r = (flags & IC_SIGNED) ? x<y  : ux<uy;  break;
+        case OpLET: r = (flags & IC_SIGNED) ? x<=y : ux<=uy; break;
+        case OpGT:  r = (flags & IC_SIGNED) ? x>y  : ux>uy;  break;
+        case OpGET: r = (flags & IC_SIGNED) ? x>=y : ux>=uy; break;
+        default: assert(0); return FALSE;
+        }
+        q->op = OpAsn;
+        q->type = &int_ty;
+        q->arg1 = new_const_addr(r);
+        q->arg2 = 0;
+        return TRUE;
+    }
+
+    case OpNeg: case OpCmpl: case OpNot:
+    case OpCh: case OpUCh: case OpSh:
+    case OpUSh: case OpLLSX: case OpLLZX:
+        if (address(q->arg1).kind != IConstKind)
+            return FALSE;
+        x = address(q->arg1).cont.val;
+        switch (q->op) {
+        case OpNeg:  r = (long long)(0ULL-(unsigned long long)x); break;
+        case OpCmpl: r = ~x; break;
+        case OpNot:  r = !x; q->type = &int_ty; break;
+        case OpCh:   r = (signed char)x; break;
+        case OpUCh:  r = (unsigned char)x; break;
+        case OpSh:   r = (short)x; break;
+        case OpUSh:  r = (unsigned short)x; break;
+        case OpLLSX: r = (int)x; q->type = &long_long_ty; break;
+        case OpLLZX: r = (unsigned)x; q->type = &long_long_ty; break;
+        default: assert(0); return FALSE;
+        }
+        if (q->type == NULL)
+            q->type = &int_ty;
+        q->op = OpAsn;
+        q->arg1 = new_const_addr(truncate_const(r, q->type));
+        return TRUE;
+
+    case OpCBr:
+        if (address(q->arg1).kind != IConstKind)
+            return FALSE;
+        q->op = OpJmp;
+        if (!address(q->arg1).cont.val)
+            q->tar = q->arg2;
+        /*
+         * The CFG edge to the block no longer reachable through this
+         * quad is left in place. The analyses will just be a little
+         * more conservative than they could be.
+         */
+        return TRUE;
+
+    default:
+        return FALSE;
+    }
+}
+
+// =======================================================================================
+// Copy and constant propagation
+// =======================================================================================
+/*
+ * A copy is a quad 'd = s' where 'd' is a tracked name and 's' is either
+ * an integer constant or a tracked name. A copy is available at a point p
+ * if along every path from the entry to p the copy is executed and neither
+ * 'd' nor 's' are redefined between the copy and p. Uses of 'd' at p can
+ * then be replaced with 's'.
+ */
+typedef struct CopyNode CopyNode;
+static struct CopyNode {
+    unsigned c;
+    CopyNode *next;
+} **copies_of_nid; /* copies where a nid appears (either as destination or source) */
+static Arena *copies_arena;
+
+static struct Copy {
+    unsigned dst_nid;
+    unsigned src;       /* address of the source (as it was when the copy was recorded) */
+    long long val;      /* value to propagate when the source is a constant */
+} *copies;
+static unsigned ncopies, copies_max;
+static int *quad2copy;
+static BSet *avail_tmp;
+
+static int is_copy_candidate(unsigned i)
+{
+    unsigned tar, arg1;
+
+    if (instruction(i).op != OpAsn)
+        return FALSE;
+    tar = instruction(i).tar;
+    arg1 = instruction(i).arg1;
+    if (!is_tracked(tar) || !is_scalar_type(instruction(i).type))
+        return FALSE;
+
+    switch (address(arg1).kind) {
+    case IConstKind:
+        return TRUE;
+    case IdKind:
+        if (!is_tracked(arg1) || address_nid(arg1)==address_nid(tar))
+            return FALSE;
+        /*
+         * The value of a variable depends on its type (stores truncate,
+         * loads extend). Only propagate between variables whose values
+         * are always represented the same way.
+         */
+        return (address(tar).kind==TempKind
+        || get_type_category(&address(tar).cont.var.e->type)
+        == get_type_category(&address(arg1).cont.var.e->type));
+    case TempKind:
+        return (address(tar).kind==TempKind && address_nid(arg1)!=address_nid(tar));
+    default:
+        return FALSE;
+    }
+}
+
+static void add_copy_node(int nid, unsigned c)
+{
+    CopyNode *p;
+
+    p = arena_alloc(copies_arena, sizeof(CopyNode));
+    p->c = c;
+    p->next = copies_of_nid[nid];
+    copies_of_nid[nid] = p;
+}
+
+static void collect_copies(unsigned fn)
+{
+    unsigned i, first, last;
+
+    first = cfg_node(cg_node(fn).bb_i).leader;
+    last = cfg_node(cg_node(fn).bb_f).last;
+    ncopies = 0;
+    for (i = first; i <= last; i++) {
+        unsigned tar, arg1;
+
+        quad2copy[i-first] = -1;
+        if (!is_copy_candidate(i))
+            continue;
+
+        if (ncopies >= copies_max) {
+            copies_max *= 2;
+            copies = realloc(copies, copies_max*sizeof(struct Copy));
+        }
+        tar = instruction(i).tar;
+        arg1 = instruction(i).arg1;
+        copies[ncopies].dst_nid = address_nid(tar);
+        copies[ncopies].src = arg1;
+        if (address(arg1).kind == IConstKind) {
+            copies[ncopies].val = address(arg1).cont.val;
+            if (address(tar).kind == IdKind)
+                /* what will be read back from the variable */
+                copies[ncopies].val = truncate_const(copies[ncopies].val,
+                &address(tar).cont.var.e->type);
+        } else {
+            add_copy_node(address_nid(arg1), ncopies);
+        }
+        add_copy_node(address_nid(tar), ncopies);
+        quad2copy[i-first] = ncopies++;
+    }
+}
+
+static void reset_copies(void)
+{
+    unsigned c;
+
+    for (c = 0; c < ncopies; c++) {
+        copies_of_nid[copies[c].dst_nid] = NULL;
+        if (address(copies[c].src).kind != IConstKind)
+            copies_of_nid[address_nid(copies[c].src)] = NULL;
+    }
+    arena_reset(copies_arena);
+}
+
+/* return the nid defined by quad 'i', or -1 if the quad doesn't define anything */
+static int defined_nid(unsigned i)
+{
+    switch (instruction(i).op) {
+    case OpAdd: case OpSub: case OpMul: case OpDiv:
+    case OpRem: case OpSHL: case OpSHR: case OpAnd:
+    case OpOr: case OpXor: case OpEQ: case OpNEQ:
+    case OpLT: case OpLET: case OpGT: case OpGET:
+    case OpNeg: case OpCmpl: case OpNot: case OpCh:
+    case OpUCh: case OpSh: case OpUSh: case OpLLSX:
+    case OpLLZX: case OpAddrOf: case OpInd: case OpAsn:
+        return address_nid(instruction(i).tar);
+    case OpCall:
+    case OpIndCall:
+        return instruction(i).tar ? address_nid(instruction(i).tar) : -1;
+    default:
+        return -1;
+    }
+}
+
+/* apply the effect of quad 'i' to the set of available copies 's' */
+static void avail_transfer(BSet *s, BSet *kill, unsigned i, unsigned first)
+{
+    int nid;
+    CopyNode *p;
+
+    if ((nid=defined_nid(i)) == -1)
+        return;
+    for (p = copies_of_nid[nid]; p != NULL; p = p->next) {
+        bset_delete(s, p->c);
+        if (kill != NULL)
+            bset_insert(kill, p->c);
+    }
+    if (quad2copy[i-first] != -1)
+        bset_insert(s, quad2copy[i-first]);
+}
+
+/* find the copy 'd = s' available in 's' for the operand at address 'a' */
+static int find_avail_copy(BSet *s, unsigned a)
+{
+    CopyNode *p;
+
+    if (address(a).kind!=TempKind && address(a).kind!=IdKind)
+        return -1;
+    for (p = copies_of_nid[address_nid(a)]; p != NULL; p = p->next)
+        if (copies[p->c].dst_nid==address_nid(a) && bset_member(s, p->c))
+            return p->c;
+    return -1;
+}
+
+/*
+ * Replace the operand pointed to by 'pa' by the source of
+ * its available copy (if any). Constants are only allowed
+ * where 'allow_const' is TRUE.
+ */
+static int propagate_operand(BSet *s, unsigned *pa, int allow_const)
+{
+    int c;
+    unsigned src;
+
+    if ((c=find_avail_copy(s, *pa)) == -1)
+        return FALSE;
+    src = copies[c].src;
+    if (address(src).kind == IConstKind) {
+        if (!allow_const)
+            return FALSE;
+        *pa = new_const_addr(copies[c].val);
+    } else {
+        *pa = new_address(address(src).kind);
+        address(*pa) = address(src);
+    }
+    return TRUE;
+}
+
+static int propagate_quad(BSet *s, unsigned i)
+{
+    Quad *q;
+    int changed;
+
+    changed = FALSE;
+    q = &instruction(i);
+    switch (q->op) {
+    case OpAdd: case OpSub: case OpMul: case OpDiv:
+    case OpRem: case OpSHL: case OpSHR: case OpAnd:
+    case OpOr: case OpXor: case OpEQ: case OpNEQ:
+    case OpLT: case OpLET: case OpGT: case OpGET:
+        if (!const_addr(q->arg1))
+            changed |= propagate_operand(s, &q->arg1, TRUE);
+        if (!const_addr(q->arg2))
+            changed |= propagate_operand(s, &q->arg2, TRUE);
+        if (address(q->arg1).kind==IConstKind && address(q->arg2).kind==IConstKind) {
+            /* the quad must be foldable, otherwise keep a non-constant operand */
+            Quad sav;
+
+            sav = *q;
+            if (!fold_quad(i)) {
+                *q = sav;
+                return FALSE;
+            }
+            changed = TRUE;
+        }
+        break;
+
+    case OpNeg: case OpCmpl: case OpNot: case OpCh:
+    case OpUCh: case OpSh: case OpUSh: case OpLLSX:
+    case OpLLZX: case OpAsn:
+    case OpArg: case OpRet: case OpCBr:
+        if (!const_addr(q->arg1))
+            changed |= propagate_operand(s, &q->arg1, TRUE);
+        break;
+
+    case OpIndAsn:
+        if (!const_addr(q->arg2))
+            changed |= propagate_operand(s, &q->arg2, TRUE);
+        /* fall through */
+    case OpInd:
+    case OpIndCall:
+    case OpSwitch:
+        if (!const_addr(q->arg1))
+            changed |= propagate_operand(s, &q->arg1, FALSE);
+        break;
+
+    default:
+        break;
+    }
+    return changed;
+}
+
+static int copy_propagation(unsigned fn)
+{
+    int i, changed;
+    unsigned b, entry_bb, exit_bb, nbb, first;
+    BSet **gen, **kill, **in, **out;
+
+    entry_bb = cg_node(fn).bb_i;
+    exit_bb = cg_node(fn).bb_f;
+    nbb = cg_node_nbb(fn);
+    first = cfg_node(entry_bb).leader;
+
+    collect_copies(fn);
+    if (ncopies == 0)
+        return FALSE;
+
+    gen = malloc(nbb*sizeof(BSet *));
+    kill = malloc(nbb*sizeof(BSet *));
+    in = malloc(nbb*sizeof(BSet *));
+    out = malloc(nbb*sizeof(BSet *));
+    avail_tmp = bset_new(ncopies);
+
+    /* gather initial information */
+    for (b = entry_bb; b <= exit_bb; b++) {
+        unsigned k;
+
+        k = b-entry_bb;
+        gen[k] = bset_new(ncopies);
+        kill[k] = bset_new(ncopies);
+        in[k] = bset_new(ncopies);
+        out[k] = bset_new(ncopies);
+        for (i = cfg_node(b).leader; i <= cfg_node(b).last; i++)
+            avail_transfer(gen[k], kill[k], i, first);
+        /* optimistic start for every block but the entry */
+        if (b != entry_bb)
+            bset_fill(out[k], ncopies);
+        else
+            bset_cpy(out[k], gen[k]);
+    }
+
+    /* solve equations */
+    changed = TRUE;
+    while (changed) {
+        DEBUG_PRINTF("==> AvailCopies solver iteration\n");
+        changed = FALSE;
+        for (i = entry_bb; i <= exit_bb; i++) {
+            unsigned j, k;
+
+            /* note: with unreachable code the first node in RPO may not be the entry */
+            if ((b=cfg_node(i).RPO) == entry_bb)
+                continue;
+            k = b-entry_bb;
+            /*
+             * In(b) = the intersection of Out(p) for all predecessors p of b.
+             * Out(b) = Gen(b) U (In(b) - Kill(b)).
+             */
+            if (cfg_node(b).in.n == 0) {
+                bset_clear(in[k]);
+            } else {
+                bset_cpy(in[k], out[cfg_node(b).in.edges[0]-entry_bb]);
+                for (j = 1; j < cfg_node(b).in.n; j++)
+                    bset_inters(in[k], out[cfg_node(b).in.edges[j]-entry_bb]);
+            }
+            bset_cpy(avail_tmp, in[k]);
+            bset_diff(avail_tmp, kill[k]);
+            bset_union(avail_tmp, gen[k]);
+            if (!bset_eq(avail_tmp, out[k])) {
+                bset_cpy(out[k], avail_tmp);
+                changed = TRUE;
+            }
+        }
+    }
+
+    /* rewrite */
+    changed = FALSE;
+    for (b = entry_bb; b <= exit_bb; b++) {
+        bset_cpy(avail_tmp, in[b-entry_bb]);
+        for (i = cfg_node(b).leader; i <= cfg_node(b).last; i++) {
+            changed |= propagate_quad(avail_tmp, i);
+            avail_transfer(avail_tmp, NULL, i, first);
+        }
+    }
+
+    for (b = 0; b < nbb; b++) {
+        bset_free(gen[b]), bset_free(kill[b]);
+        bset_free(in[b]), bset_free(out[b]);
+    }
+    free(gen), free(kill), free(in), free(out);
+    bset_free(avail_tmp);
+    reset_copies();
+
+    return changed;
+}
+
+// =======================================================================================
+// Dead code elimination
+// =======================================================================================
+static BSet *dce_live;
+
+#define dce_use(a) (!const_addr(a) ? bset_insert(dce_live, lnid(address_nid(a))) : (void)0)
+
+/*
+ * Remove (turn into OpNOp) quads whose only effect is to define
+ * a tracked name that is not live after the quad.
+ * Must be called right after dflow_LiveOut().
+ */
+static int dead_code_elimination(unsigned fn)
+{
+    int changed;
+    unsigned b;
+
+    changed = FALSE;
+    dce_live = bset_new(cg_node(fn).nlnid);
+    for (b = cg_node(fn).bb_i; b <= cg_node(fn).bb_f; b++) {
+        int i;
+
+        bset_cpy(dce_live, cfg_node(b).LiveOut);
+
+        /* scan backward through the block */
+        for (i = cfg_node(b).last; i >= (int)cfg_node(b).leader; i--) {
+            unsigned tar, arg1, arg2;
+
+            tar = instruction(i).tar;
+            arg1 = instruction(i).arg1;
+            arg2 = instruction(i).arg2;
+
+            switch (instruction(i).op) {
+            case OpAdd: case OpSub: case OpMul: case OpDiv:
+            case OpRem: case OpSHL: case OpSHR: case OpAnd:
+            case OpOr: case OpXor: case OpEQ: case OpNEQ:
+            case OpLT: case OpLET: case OpGT: case OpGET:
+            case OpNeg: case OpCmpl: case OpNot: case OpCh:
+            case OpUCh: case OpSh: case OpUSh: case OpLLSX:
+            case OpLLZX: case OpAsn: case OpAddrOf:
+                if (!bset_member(dce_live, lnid(address_nid(tar))) && is_tracked(tar)) {
+                    instruction(i).op = OpNOp;
+                    changed = TRUE;
+                    continue;
+                }
+                bset_delete(dce_live, lnid(address_nid(tar)));
+                if (instruction(i).op == OpAddrOf)
+                    continue;
+                dce_use(arg1);
+                if (instruction(i).op < OpNeg)
+                    dce_use(arg2);
+                continue;
+
+            case OpInd:
+                bset_delete(dce_live, lnid(address_nid(tar)));
+                dce_use(arg1);
+                continue;
+
+            case OpCall:
+            case OpIndCall:
+                if (tar)
+                    bset_delete(dce_live, lnid(address_nid(tar)));
+                if (instruction(i).op == OpIndCall)
+                    dce_use(arg1);
+                continue;
+
+            case OpIndAsn:
+                dce_use(arg1);
+                dce_use(arg2);
+                continue;
+
+            case OpArg:
+            case OpRet:
+            case OpSwitch:
+            case OpCBr:
+                dce_use(arg1);
+                continue;
+
+            default:
+                continue;
+            }
+        }
+    }
+    bset_free(dce_live);
+
+    return changed;
+}
+
+// =======================================================================================
+// Global value numbering
+// =======================================================================================
+/*
+ * Dominator-based value numbering over an SSA view of the function.
+ *
+ * SSA form is not materialized in the quads. Instead, every definition
+ * of a tracked name (and every phi-function, placed at the iterated
+ * dominance frontier of the name's definitions) creates a new value
+ * number, and the dominator tree is walked keeping the current value
+ * number of every name (this is the renaming step of SSA construction).
+ * Because the names in the quads are never renamed, translating out of
+ * SSA is trivial: nothing has to be done.
+ *
+ * A quad that computes an expression already computed in a dominating
+ * block is replaced by a copy from the name that holds the value, but
+ * only if that name still holds it (its current value number is still
+ * the expression's). The copies are later cleaned up by copy propagation
+ * and dead code elimination.
+ */
+typedef struct BlockNode BlockNode;
+static struct BlockNode {
+    unsigned b;
+    BlockNode *next;
+} **dom_children, **dom_frontier, **def_blocks;
+typedef struct NameNode NameNode;
+static struct NameNode {
+    unsigned nid;
+    NameNode *next;
+} **phi_names;
+static Arena *ssa_arena;
+static unsigned *idom;
+static char *reachable;
+static unsigned gvn_entry_bb;
+
+#define VN_HASH_SIZE 1009
+typedef struct VNEntry VNEntry;
+static struct VNEntry {
+    OpKind op;
+    Token cat;
+    unsigned vn1, vn2;
+    long long val;      /* for constants (op==OpNOp) */
+    unsigned vn;        /* value number of the expression */
+    unsigned holder;    /* address of the name holding the value */
+    VNEntry *next;
+} *vn_table[VN_HASH_SIZE];
+static Arena *vn_arena;
+static unsigned *vn_of_nid, vn_counter;
+
+/* undo log used to restore the state when the walk leaves a subtree */
+static struct {
+    int nid;            /* -1 for hash table entries */
+    unsigned val;       /* old value number or bucket */
+} *vn_undo;
+static unsigned vn_undo_top, vn_undo_max;
+
+static void add_block_node(BlockNode **list, unsigned b)
+{
+    BlockNode *p;
+
+    p = arena_alloc(ssa_arena, sizeof(BlockNode));
+    p->b = b;
+    p->next = *list;
+    *list = p;
+}
+
+static void push_undo(int nid, unsigned val)
+{
+    if (vn_undo_top >= vn_undo_max) {
+        vn_undo_max *= 2;
+        vn_undo = realloc(vn_undo, vn_undo_max*sizeof(vn_undo[0]));
+    }
+    vn_undo[vn_undo_top].nid = nid;
+    vn_undo[vn_undo_top].val = val;
+    ++vn_undo_top;
+}
+
+static void set_vn(unsigned nid, unsigned vn)
+{
+    push_undo((int)nid, vn_of_nid[nid]);
+    vn_of_nid[nid] = vn;
+}
+
+static unsigned vn_hash(OpKind op, Token cat, unsigned vn1, unsigned vn2, long long val)
+{
+    return ((unsigned)op*31+(unsigned)cat*17+vn1*7+vn2+(unsigned)val)%VN_HASH_SIZE;
+}
+
+static VNEntry *lookup_vn(OpKind op, Token cat, unsigned vn1, unsigned vn2, long long val)
+{
+    VNEntry *p;
+
+    for (p = vn_table[vn_hash(op, cat, vn1, vn2, val)]; p != NULL; p = p->next)
+        if (p->op==op && p->cat==cat && p->vn1==vn1 && p->vn2==vn2 && p->val==val)
+            return p;
+    return NULL;
+}
+
+static VNEntry *install_vn(OpKind op, Token cat, unsigned vn1, unsigned vn2, long long val, int scoped)
+{
+    unsigned h;
+    VNEntry *p;
+
+    h = vn_hash(op, cat, vn1, vn2, val);
+    p = arena_alloc(vn_arena, sizeof(VNEntry));
+    p->op = op;
+    p->cat = cat;
+    p->vn1 = vn1;
+    p->vn2 = vn2;
+    p->val = val;
+    p->vn = ++vn_counter;
+    p->holder = 0;
+    p->next = vn_table[h];
+    vn_table[h] = p;
+    if (scoped)
+        push_undo(-1, h);
+    return p;
+}
+
+static unsigned operand_vn(unsigned a)
+{
+    switch (address(a).kind) {
+    case IConstKind: {
+        VNEntry *p;
+
+        /* constants are valid everywhere, so they are not scoped */
+        if ((p=lookup_vn(OpNOp, 0, 0, 0, address(a).cont.val)) == NULL)
+            p = install_vn(OpNOp, 0, 0, 0, address(a).cont.val, FALSE);
+        return p->vn;
+    }
+    case TempKind:
+    case IdKind:
+        if (is_tracked(a))
+            return vn_of_nid[address_nid(a)];
+        /* fall through */
+    default:
+        return ++vn_counter; /* unknown value */
+    }
+}
+
+static int is_commutative(OpKind op)
+{
+    return (op==OpAdd || op==OpMul || op==OpAnd || op==OpOr || op==OpXor);
+}
+
+/* value number the expression computed by quad 'i' and try to replace it */
+static int gvn_expression(unsigned i)
+{
+    Quad *q;
+    Token cat;
+    VNEntry *p;
+    unsigned vn1, vn2, tar;
+
+    q = &instruction(i);
+    tar = q->tar;
+    cat = (q->type != NULL) ? get_type_category(q->type) : 0;
+    if (q->op == OpAddrOf) {
+        /* the address of an object doesn't change during the function */
+        vn1 = address_nid(q->arg1)+1;
+        vn2 = 0;
+    } else {
+        vn1 = operand_vn(q->arg1);
+        vn2 = (q->op < OpNeg) ? operand_vn(q->arg2) : 0;
+        if (is_commutative(q->op) && vn1>vn2) {
+            unsigned t;
+
+            t = vn1, vn1 = vn2, vn2 = t;
+        }
+    }
+
+    if ((p=lookup_vn(q->op, cat, vn1, vn2, 0)) != NULL) {
+        unsigned h;
+
+        h = p->holder;
+        if (is_tracked(tar))
+            set_vn(address_nid(tar), p->vn);
+        /*
+         * Recomputing an address is cheaper than reloading it
+         * from wherever the holder lives.
+         */
+        if (q->op==OpAddrOf || h==0 || vn_of_nid[address_nid(h)]!=p->vn)
+            return FALSE;
+        if (address_nid(h) == address_nid(tar)) {
+            q->op = OpNOp; /* the name already holds the value */
+        } else {
+            if (q->op == OpNot)
+                q->type = &int_ty;
+            q->op = OpAsn;
+            q->arg1 = new_address(address(h).kind);
+            address(q->arg1) = address(h);
+            q->arg2 = 0;
+        }
+        return TRUE;
+    }
+
+    p = install_vn(q->op, cat, vn1, vn2, 0, TRUE);
+    if (is_tracked(tar)) {
+        set_vn(address_nid(tar), p->vn);
+        if (address(tar).kind==TempKind || get_type_category(&address(tar).cont.var.e->type)==cat)
+            p->holder = tar;
+    }
+    return FALSE;
+}
+
+static int gvn_block(unsigned b)
+{
+    int changed;
+    unsigned i, undo_mark;
+    NameNode *n;
+    BlockNode *c;
+
+    changed = FALSE;
+    undo_mark = vn_undo_top;
+
+    /* phi-functions */
+    for (n = phi_names[b-gvn_entry_bb]; n != NULL; n = n->next)
+        set_vn(n->nid, ++vn_counter);
+
+    for (i = cfg_node(b).leader; i <= cfg_node(b).last; i++) {
+        unsigned tar, arg1;
+
+        tar = instruction(i).tar;
+        arg1 = instruction(i).arg1;
+        switch (instruction(i).op) {
+        case OpAdd: case OpSub: case OpMul: case OpDiv:
+        case OpRem: case OpSHL: case OpSHR: case OpAnd:
+        case OpOr: case OpXor:
+        case OpNeg: case OpCmpl: case OpNot: case OpCh:
+        case OpUCh: case OpSh: case OpUSh: case OpLLSX:
+        case OpLLZX: case OpAddrOf:
+            changed |= gvn_expression(i);
+            break;
+
+        case OpAsn:
+            if (!is_tracked(tar))
+                break;
+            /* keep the value number only when the copy preserves the value */
+            if (address(tar).kind==TempKind
+            || (address(arg1).kind==IdKind && is_tracked(arg1)
+            && get_type_category(&address(tar).cont.var.e->type)
+            == get_type_category(&address(arg1).cont.var.e->type)))
+                set_vn(address_nid(tar), operand_vn(arg1));
+            else
+                set_vn(address_nid(tar), ++vn_counter);
+            break;
+
+        default: {
+            int nid;
+
+            if ((nid=defined_nid(i))!=-1 && is_tracked(tar))
+                set_vn((unsigned)nid, ++vn_counter);
+        }
+            break;
+        }
+    }
+
+    for (c = dom_children[b-gvn_entry_bb]; c != NULL; c = c->next)
+        changed |= gvn_block(c->b);
+
+    /* restore the state */
+    while (vn_undo_top > undo_mark) {
+        --vn_undo_top;
+        if (vn_undo[vn_undo_top].nid == -1)
+            vn_table[vn_undo[vn_undo_top].val] = vn_table[vn_undo[vn_undo_top].val]->next;
+        else
+            vn_of_nid[vn_undo[vn_undo_top].nid] = vn_undo[vn_undo_top].val;
+    }
+
+    return changed;
+}
+
+static void mark_reachable(unsigned fn)
+{
+    unsigned *stack, top;
+
+    stack = malloc(cg_node_nbb(fn)*sizeof(unsigned));
+    top = 0;
+    stack[top++] = cg_node(fn).bb_i;
+    reachable[0] = TRUE;
+    while (top) {
+        unsigned b, j;
+
+        b = stack[--top];
+        for (j = 0; j < cfg_node(b).out.n; j++) {
+            unsigned s;
+
+            s = cfg_node(b).out.edges[j];
+            if (!reachable[s-gvn_entry_bb]) {
+                reachable[s-gvn_entry_bb] = TRUE;
+                stack[top++] = s;
+            }
+        }
+    }
+    free(stack);
+}
+
+/* compute the dominator tree and the dominance frontiers of the reachable blocks */
+static void compute_dominance(unsigned fn)
+{
+    unsigned b, entry_bb, exit_bb, *domcard;
+
+    entry_bb = cg_node(fn).bb_i;
+    exit_bb = cg_node(fn).bb_f;
+    dflow_Dom(fn);
+
+    domcard = malloc(cg_node_nbb(fn)*sizeof(unsigned));
+    for (b = entry_bb; b <= exit_bb; b++)
+        domcard[b-entry_bb] = bset_card(cfg_node(b).Dom);
+
+    /*
+     * The dominators of a block form a chain, so the immediate
+     * dominator is the strict dominator with the most dominators.
+     */
+    for (b = entry_bb+1; b <= exit_bb; b++) {
+        int d;
+        unsigned best;
+
+        if (!reachable[b-entry_bb])
+            continue;
+        best = 0;
+        for (d = bset_iterate(cfg_node(b).Dom); d != -1; d = bset_iterate(NULL)) {
+            if ((unsigned)d == b-entry_bb)
+                continue;
+            if (best==0 || domcard[d]>domcard[best-entry_bb])
+                best = (unsigned)d+entry_bb;
+        }
+        assert(best != 0);
+        idom[b-entry_bb] = best;
+        add_block_node(&dom_children[best-entry_bb], b);
+    }
+    free(domcard);
+
+    for (b = entry_bb; b <= exit_bb; b++) {
+        unsigned j, npreds;
+
+        if (!reachable[b-entry_bb])
+            continue;
+        npreds = 0;
+        for (j = 0; j < cfg_node(b).in.n; j++)
+            if (reachable[cfg_node(b).in.edges[j]-entry_bb])
+                ++npreds;
+        if (npreds < 2)
+            continue;
+        for (j = 0; j < cfg_node(b).in.n; j++) {
+            unsigned runner;
+
+            runner = cfg_node(b).in.edges[j];
+            if (!reachable[runner-entry_bb])
+                continue;
+            while (runner != idom[b-entry_bb]) {
+                BlockNode **df;
+
+                df = &dom_frontier[runner-entry_bb];
+                if (*df==NULL || (*df)->b!=b)
+                    add_block_node(df, b);
+                runner = idom[runner-entry_bb];
+            }
+        }
+    }
+
+    dflow_free_Dom(fn);
+}
+
+/* place phi-functions for the tracked names at the iterated dominance frontiers */
+static void place_phi_functions(unsigned fn)
+{
+    unsigned b, nbb, nnames, *names, *work, wtop;
+    int *has_phi, *in_work;
+
+    nbb = cg_node_nbb(fn);
+    nnames = 0;
+    names = NULL;
+    for (b = gvn_entry_bb; b <= cg_node(fn).bb_f; b++) {
+        unsigned i;
+
+        if (!reachable[b-gvn_entry_bb])
+            continue;
+        for (i = cfg_node(b).leader; i <= cfg_node(b).last; i++) {
+            int nid;
+
+            if ((nid=defined_nid(i))==-1 || !is_tracked(instruction(i).tar))
+                continue;
+            if (def_blocks[nid] == NULL) {
+                if ((nnames & (nnames-1)) == 0)
+                    names = realloc(names, (nnames ? nnames*2 : 1)*sizeof(unsigned));
+                names[nnames++] = (unsigned)nid;
+            } else if (def_blocks[nid]->b == b) {
+                continue;
+            }
+            add_block_node(&def_blocks[nid], b);
+        }
+    }
+
+    has_phi = calloc(nbb, sizeof(int));
+    in_work = calloc(nbb, sizeof(int));
+    work = malloc(nbb*sizeof(unsigned));
+    while (nnames) {
+        unsigned n;
+        BlockNode *p;
+
+        n = names[--nnames];
+        wtop = 0;
+        for (p = def_blocks[n]; p != NULL; p = p->next) {
+            in_work[p->b-gvn_entry_bb] = n+1;
+            work[wtop++] = p->b;
+        }
+        def_blocks[n] = NULL;
+        while (wtop) {
+            unsigned d;
+
+            d = work[--wtop];
+            for (p = dom_frontier[d-gvn_entry_bb]; p != NULL; p = p->next) {
+                unsigned k;
+
+                k = p->b-gvn_entry_bb;
+                if (has_phi[k] != n+1) {
+                    NameNode *np;
+
+                    np = arena_alloc(ssa_arena, sizeof(NameNode));
+                    np->nid = n;
+                    np->next = phi_names[k];
+                    phi_names[k] = np;
+                    has_phi[k] = n+1;
+                }
+                if (in_work[k] != n+1) {
+                    in_work[k] = n+1;
+                    work[wtop++] = p->b;
+                }
+            }
+        }
+    }
+    free(names), free(has_phi), free(in_work), free(work);
+}
+
+static int global_value_numbering(unsigned fn)
+{
+    int changed;
+    unsigned nbb;
+
+    gvn_entry_bb = cg_node(fn).bb_i;
+    nbb = cg_node_nbb(fn);
+    reachable = calloc(nbb, sizeof(char));
+    idom = calloc(nbb, sizeof(unsigned));
+    dom_children = calloc(nbb, sizeof(BlockNode *));
+    dom_frontier = calloc(nbb, sizeof(BlockNode *));
+    phi_names = calloc(nbb, sizeof(NameNode *));
+
+    mark_reachable(fn);
+    compute_dominance(fn);
+    place_phi_functions(fn);
+
+    vn_counter = (unsigned)nid_counter;
+    memset(vn_table, 0, sizeof(vn_table));
+    changed = gvn_block(gvn_entry_bb);
+    assert(vn_undo_top == 0);
+
+    free(reachable), free(idom);
+    free(dom_children), free(dom_frontier), free(phi_names);
+    arena_reset(ssa_arena);
+    arena_reset(vn_arena);
+
+    return changed;
+}
+
+// =======================================================================================
+// Inlining
+// =======================================================================================
+static int *nid_map, *nid_map_stamp;     /* nid -> address (valid if the stamp is the current one) */
+static int nid_map_curr, nid_map_max;
+
+/* start a new, empty, nid -> address mapping */
+static void new_nid_map(void)
+{
+    if (nid_counter > nid_map_max) {
+        int n;
+
+        n = nid_map_max;
+        nid_map_max = nid_counter*2;
+        nid_map = realloc(nid_map, nid_map_max*sizeof(int));
+        nid_map_stamp = realloc(nid_map_stamp, nid_map_max*sizeof(int));
+        if (nid_map==NULL || nid_map_stamp==NULL)
+            TERMINATE("error: new_nid_map(): out of memory");
+        memset(nid_map_stamp+n, 0, (nid_map_max-n)*sizeof(int));
+    }
+    ++nid_map_curr;
+}
+
+static void free_nid_map(void)
+{
+    free(nid_map);
+    free(nid_map_stamp);
+    nid_map = nid_map_stamp = NULL;
+    nid_map_max = 0;
+}
+
+/*
+ * Bottom-up inlining of small functions (done at -O3).
+ *
+ * The callers are visited in post-order of the call graph, so the body
+ * of a callee already contains whatever was inlined into it. A caller
+ * with calls to inline gets a new copy of its quads appended to the
+ * instruction buffer (the calls replaced by the bodies of the callees)
+ * and its CFG is rebuilt over the new range. The old quads and CFG nodes
+ * are not referenced anymore.
+ *
+ * The OpArgs of an inlined call become assignments to fresh copies of the
+ * callee's parameters, done right where the OpArgs were. The OpRets become
+ * assignments to the call's target, followed (as before) by the jump to
+ * the callee's return label.
+ */
+#define INLINE_MAX_SIZE         24  /* callees up to this size are always candidates */
+#define INLINE_MAX_SIZE_ONCE    400 /* size limit for static callees with a single call site */
+#define INLINE_CALLER_BUDGET    600 /* max number of quads a caller can grow by */
+
+static ExternId **inl_def;      /* cg node -> function definition */
+static int *inl_size;           /* cg node -> size of the body, or -1 if not inlinable */
+static int *inl_ncalls;         /* cg node -> number of direct calls to the function */
+static int **inl_param_nid;     /* cg node -> nids of the parameters */
+static int *inl_cg_tab;         /* func_id -> cg node (index+1, 0 = empty) */
+static unsigned inl_cg_tab_size;
+
+static int inline_find_cg_node(char *func_id)
+{
+    unsigned h;
+
+    for (h = hash(func_id)&(inl_cg_tab_size-1); inl_cg_tab[h]; h = (h+1)&(inl_cg_tab_size-1))
+        if (equal(cg_node(inl_cg_tab[h]-1).func_id, func_id))
+            return inl_cg_tab[h]-1;
+    return -1;
+}
+
+/* return the cg node of the function called directly by OpCall 'i', or -1 */
+static int inline_call_target(unsigned i)
+{
+    unsigned a;
+
+    a = instruction(i).arg1;
+    if (instruction(i).op!=OpCall || a==memset_addr || a==memcpy_addr)
+        return -1;
+    return inline_find_cg_node(address(a).cont.var.e->attr.str);
+}
+
+static int inline_reaches(unsigned from, unsigned to, char *seen)
+{
+    unsigned i;
+
+    seen[from] = TRUE;
+    for (i = 0; i < cg_node(from).out.n; i++) {
+        unsigned succ;
+
+        succ = cg_node(from).out.edges[i];
+        if (succ==to || (!seen[succ] && inline_reaches(succ, to, seen)))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static DeclList *inline_params(unsigned fn)
+{
+    DeclList *p;
+
+    p = inl_def[fn]->declarator->child->attr.dl;
+    if (get_type_spec(p->decl->decl_specs)->op==TOK_VOID && p->decl->idl==NULL)
+        return NULL; /* function with no parameters */
+    return p;
+}
+
+static int is_scalar_param(DeclList *p, Declaration *ty)
+{
+    Token cat;
+
+    ty->decl_specs = p->decl->decl_specs;
+    ty->idl = p->decl->idl->child;
+    cat = get_type_category(ty);
+    return (is_integer(cat) || cat==TOK_STAR);
+}
+
+/*
+ * Return the number of quads in the body of 'fn' if the function can
+ * be inlined, or -1 otherwise. Only functions with scalar parameters
+ * and a scalar (or void) result, and that do not have static locals,
+ * are considered.
+ */
+static int inline_body_size(unsigned fn)
+{
+    int n;
+    Token cat;
+    DeclList *p;
+    Declaration ty;
+    unsigned i, first, last;
+
+    if (inl_def[fn]==NULL || cg_node_is_empty(fn))
+        return -1;
+    ty.decl_specs = inl_def[fn]->decl_specs;
+    ty.idl = inl_def[fn]->declarator->child->child;
+    if ((cat=get_type_category(&ty))!=TOK_VOID && !is_integer(cat) && cat!=TOK_STAR)
+        return -1;
+    for (p = inline_params(fn); p != NULL; p = p->next)
+        if (p->decl->idl==NULL || p->decl->idl->op==TOK_ELLIPSIS || !is_scalar_param(p, &ty))
+            return -1;
+
+    first = cfg_node(cg_node(fn).bb_i).leader;
+    last = cfg_node(cg_node(fn).bb_f).last;
+    for (n = 0, i = first+2; i < last-2; i++) {
+        unsigned a[3];
+        int j;
+
+        if (instruction(i).op==OpNOp || instruction(i).op==OpLab)
+            continue;
+        ++n;
+        a[0] = instruction(i).tar, a[1] = instruction(i).arg1, a[2] = instruction(i).arg2;
+        for (j = 0; j < 3; j++) {
+            ExecNode *e;
+
+            if (a[j]==0 || address(a[j]).kind!=IdKind)
+                continue;
+            e = address(a[j]).cont.var.e;
+            if (e->attr.var.duration==DURATION_STATIC && e->attr.var.linkage==LINKAGE_NONE)
+                return -1; /* the static local is named after the function */
+        }
+    }
+    return n;
+}
+
+/* find the nids of the parameters of 'fn' (-1 if a parameter is not used) */
+static int *inline_get_param_nids(unsigned fn)
+{
+    int k, np, *pnid;
+    DeclList *p;
+    unsigned i, first, last;
+
+    if (inl_param_nid[fn] != NULL)
+        return inl_param_nid[fn];
+    for (np = 0, p = inline_params(fn); p != NULL; p = p->next)
+        ++np;
+    if (np == 0)
+        return inl_param_nid[fn] = NULL;
+    pnid = malloc(np*sizeof(int));
+    for (k = 0; k < np; k++)
+        pnid[k] = -1;
+    first = cfg_node(cg_node(fn).bb_i).leader;
+    last = cfg_node(cg_node(fn).bb_f).last;
+    for (i = first; i <= last; i++) {
+        unsigned a[3];
+        int j;
+
+        a[0] = instruction(i).tar, a[1] = instruction(i).arg1, a[2] = instruction(i).arg2;
+        for (j = 0; j < 3; j++) {
+            ExecNode *e;
+
+            if (a[j]==0 || address(a[j]).kind!=IdKind)
+                continue;
+            e = address(a[j]).cont.var.e;
+            if (!e->attr.var.is_param)
+                continue;
+            for (k = 0, p = inline_params(fn); p != NULL; k++, p = p->next)
+                if (equal(p->decl->idl->str, e->attr.str))
+                    pnid[k] = address_nid(a[j]);
+        }
+    }
+    return inl_param_nid[fn] = pnid;
+}
+
+/* return the address to use in place of the callee's address 'a' */
+static unsigned inline_operand(unsigned a, int is_label, unsigned label_base)
+{
+    unsigned na;
+    int nid;
+
+    if (a == 0)
+        return 0;
+    switch (address(a).kind) {
+    case IConstKind:
+    case StrLitKind:
+        na = new_address(address(a).kind);
+        address(na).cont = address(a).cont;
+        if (is_label)
+            address(na).cont.val += label_base;
+        return na;
+    case IdKind:
+        if (address(a).cont.var.e->attr.var.duration != DURATION_AUTO)
+            return a;
+        /* fall through */
+    case TempKind:
+        nid = address_nid(a);
+        if (nid_map_stamp[nid] != nid_map_curr) {
+            nid_map_stamp[nid] = nid_map_curr;
+            nid_map[nid] = (address(a).kind == TempKind) ? new_temp_addr() : new_frame_var(a, NULL);
+        }
+        return nid_map[nid];
+    }
+    assert(0);
+    return 0;
+}
+
+/*
+ * Emit the body of 'fn' in place of a call whose result goes to 'tar'.
+ * 'params' are the caller's copies of the parameters. Return the number
+ * of labels used by the body.
+ */
+static unsigned inline_body(unsigned fn, unsigned tar, unsigned *params, unsigned label_base)
+{
+    int k, *pnid, g;
+    DeclList *p;
+    unsigned i, first, last, nlab;
+
+    new_nid_map();
+    pnid = inline_get_param_nids(fn);
+    for (k = 0, p = inline_params(fn); p != NULL; k++, p = p->next) {
+        if (pnid[k] != -1) {
+            nid_map_stamp[pnid[k]] = nid_map_curr;
+            nid_map[pnid[k]] = params[k];
+        }
+    }
+
+    first = cfg_node(cg_node(fn).bb_i).leader;
+    last = cfg_node(cg_node(fn).bb_f).last;
+    nlab = 0;
+    /*
+     * Skip the jump of the ENTRY node (its label can be the target of a loop)
+     * and the EXIT node, which comes after the return label (last-2).
+     */
+    for (i = first+1; i <= last-2; i++) {
+        Quad q;
+
+        q = instruction(i);
+        switch (q.op) {
+        case OpLab:
+            if (address(q.tar).cont.val >= nlab)
+                nlab = (unsigned)address(q.tar).cont.val+1;
+            /* fall through */
+        case OpJmp:
+            emit_i(q.op, NULL, inline_operand(q.tar, TRUE, label_base), 0, 0);
+            break;
+        case OpCBr:
+            emit_i(q.op, q.type, inline_operand(q.tar, TRUE, label_base),
+            inline_operand(q.arg1, FALSE, 0), inline_operand(q.arg2, TRUE, label_base));
+            break;
+        case OpCase:
+            emit_i(q.op, q.type, inline_operand(q.tar, FALSE, 0),
+            inline_operand(q.arg1, TRUE, label_base), inline_operand(q.arg2, FALSE, 0));
+            break;
+        case OpRet:
+            if (tar == 0)
+                continue;
+            emit_i(OpAsn, q.type, tar, inline_operand(q.arg1, FALSE, 0), 0);
+            break;
+        case OpCall:
+            if ((g=inline_call_target(i)) != -1)
+                ++inl_ncalls[g];
+            emit_i(q.op, q.type, inline_operand(q.tar, FALSE, 0), q.arg1, inline_operand(q.arg2, FALSE, 0));
+            break;
+        default:
+            emit_i(q.op, q.type, inline_operand(q.tar, FALSE, 0),
+            inline_operand(q.arg1, FALSE, 0), inline_operand(q.arg2, FALSE, 0));
+            break;
+        }
+        if (verbose_asm)
+            C_source[ic_instructions_counter-1] = C_source[i];
+    }
+    return nlab;
+}
+
+/* return TRUE if call 'c' is done through a prototype with `...' */
+static int inline_call_is_variadic(unsigned c)
+{
+    DeclList *p;
+    TypeExp *dct;
+
+    dct = address(instruction(c).arg1).cont.var.e->type.idl;
+    if (dct==NULL || dct->op!=TOK_FUNCTION)
+        return FALSE;
+    for (p = dct->attr.dl; p != NULL; p = p->next)
+        if (p->decl->idl!=NULL && p->decl->idl->op==TOK_ELLIPSIS)
+            return TRUE;
+    return FALSE;
+}
+
+/*
+ * Return TRUE if the OpArgs of call 'c' match the parameters of 'fn'.
+ * 'link' maps each OpArg to its OpBegArg and each OpBegArg to its call.
+ */
+static int inline_args_match(unsigned c, unsigned fn, unsigned first, int *link)
+{
+    int na, np, j;
+    DeclList *p;
+    unsigned i;
+    Declaration ty;
+
+    if (inline_call_is_variadic(c))
+        return FALSE;
+    for (np = 0, p = inline_params(fn); p != NULL; p = p->next)
+        ++np;
+    if (address(instruction(c).arg2).cont.val != np)
+        return FALSE;
+    for (na = 0, i = link[c-first]+first+1; i < c; i++)
+        if (instruction(i).op==OpArg && link[i-first]==link[c-first])
+            ++na;
+    if (na != np)
+        return FALSE;
+    for (j = 0, i = link[c-first]+first+1; i < c; i++) {
+        int k;
+
+        if (instruction(i).op!=OpArg || link[i-first]!=link[c-first])
+            continue;
+        k = (target_arch==ARCH_MIPS || target_arch==ARCH_ARM) ? j : np-1-j;
+        for (p = inline_params(fn); k > 0; k--)
+            p = p->next;
+        is_scalar_param(p, &ty);
+        if (get_type_category(instruction(i).type) != get_type_category(&ty)
+        || get_sizeof(instruction(i).type) != get_sizeof(&ty))
+            return FALSE;
+        ++j;
+    }
+    return TRUE;
+}
+
+static void inline_calls(unsigned fn)
+{
+    int *link, *callee, *argno, *stack, top, growth, g, nsel;
+    unsigned i, first, last, n, new_first, label_base, **params;
+    TypeExp *scs;
+
+    first = cfg_node(cg_node(fn).bb_i).leader;
+    last = cfg_node(cg_node(fn).bb_f).last;
+    n = last-first+1;
+    link = malloc(n*sizeof(int));
+    callee = malloc(n*sizeof(int));
+    stack = malloc(n*sizeof(int));
+
+    /*
+     * Match the OpArgs with their call. The calls to memset/memcpy that
+     * initialize locals have no OpBegArg, but they never occur in the
+     * middle of the arguments of another call.
+     */
+    top = 0;
+    for (i = first; i <= last; i++) {
+        link[i-first] = callee[i-first] = -1;
+        switch (instruction(i).op) {
+        case OpBegArg:
+            stack[top++] = i-first;
+            break;
+        case OpArg:
+            if (top)
+                link[i-first] = stack[top-1];
+            break;
+        case OpCall:
+        case OpIndCall:
+            if (instruction(i).arg1==memset_addr || instruction(i).arg1==memcpy_addr)
+                break;
+            assert(top > 0);
+            link[i-first] = stack[--top];
+            link[link[i-first]] = i-first;
+            break;
+        default:
+            break;
+        }
+    }
+    free(stack);
+
+    /* choose the calls to inline */
+    growth = nsel = 0;
+    for (i = first; i <= last; i++) {
+        int siz;
+
+        if ((g=inline_call_target(i))==-1 || g==fn || (siz=inl_size[g])==-1)
+            continue;
+        if (siz > INLINE_MAX_SIZE) {
+            if (siz>INLINE_MAX_SIZE_ONCE || inl_ncalls[g]!=1
+            || (scs=get_sto_class_spec(inl_def[g]->decl_specs))==NULL || scs->op!=TOK_STATIC)
+                continue;
+        }
+        if (growth+siz>INLINE_CALLER_BUDGET || !inline_args_match(i, g, first, link))
+            continue;
+        callee[i-first] = g;
+        growth += siz;
+        ++nsel;
+        --inl_ncalls[g];
+    }
+    if (nsel == 0) {
+        free(link);
+        free(callee);
+        return;
+    }
+
+    /* emit the new version of the function */
+    label_base = count_labels(first, last);
+    argno = calloc(n, sizeof(int));
+    params = calloc(n, sizeof(unsigned *));
+    frame_area = (int)cg_node(fn).size_of_local_area;
+    new_first = ic_instructions_counter;
+    for (i = first; i <= last; i++) {
+        Quad q;
+        int c, k, np, *pnid;
+
+        q = instruction(i);
+        switch (q.op) {
+        case OpBegArg:
+            if (link[i-first]!=-1 && callee[link[i-first]]!=-1)
+                continue;
+            break;
+        case OpArg:
+            if (link[i-first]==-1 || callee[c=link[link[i-first]]]==-1)
+                break;
+            g = callee[c];
+            np = (int)address(instruction(c+first).arg2).cont.val;
+            pnid = inline_get_param_nids(g);
+            if (params[c] == NULL) {
+                params[c] = calloc(np, sizeof(unsigned));
+                for (k = 0; k < np; k++) {
+                    unsigned j, a;
+
+                    if (pnid[k] == -1)
+                        continue;
+                    /* find an address of the parameter to copy */
+                    for (a = 0, j = cfg_node(cg_node(g).bb_i).leader; a == 0; j++) {
+                        if (instruction(j).arg1 && address(instruction(j).arg1).kind==IdKind
+                        && address_nid(instruction(j).arg1)==pnid[k])
+                            a = instruction(j).arg1;
+                        else if (instruction(j).tar && address(instruction(j).tar).kind==IdKind
+                        && address_nid(instruction(j).tar)==pnid[k])
+                            a = instruction(j).tar;
+                        else if (instruction(j).arg2 && address(instruction(j).arg2).kind==IdKind
+                        && address_nid(instruction(j).arg2)==pnid[k])
+                            a = instruction(j).arg2;
+                    }
+                    params[c][k] = new_frame_var(a, NULL);
+                }
+            }
+            k = argno[c]++;
+            if (target_arch!=ARCH_MIPS && target_arch!=ARCH_ARM)
+                k = np-1-k;
+            if (params[c][k])
+                emit_i(OpAsn, q.type, params[c][k], q.arg1, 0);
+            continue;
+        case OpCall:
+            if (callee[i-first] == -1)
+                break;
+            label_base += inline_body(callee[i-first], q.tar, params[i-first], label_base);
+            continue;
+        default:
+            break;
+        }
+        emit_i(q.op, q.type, q.tar, q.arg1, q.arg2);
+        if (verbose_asm)
+            C_source[ic_instructions_counter-1] = C_source[i];
+    }
+    for (i = 0; i < n; i++)
+        free(params[i]);
+    free(params);
+    free(argno);
+    free(link);
+    free(callee);
+
+    replace_function_body(fn, new_first, label_base);
+    cg_node(fn).size_of_local_area = frame_area;
+
+    /* update the call graph */
+    edge_free(&cg_node(fn).out);
+    edge_init(&cg_node(fn).out, 1);
+    cg_node(fn).is_leaf = TRUE;
+    for (i = new_first; i < ic_instructions_counter; i++) {
+        if (instruction(i).op==OpCall || instruction(i).op==OpIndCall) {
+            cg_node(fn).is_leaf = FALSE;
+            if ((g=inline_call_target(i)) != -1)
+                edge_add(&cg_node(fn).out, g);
+        }
+    }
+}
+
+void opt_inline_functions(ExternId **func_def_list)
+{
+    int *recursive;
+    char *seen;
+    unsigned i, k;
+
+    inl_def = calloc(cg_nodes_counter, sizeof(ExternId *));
+    for (i = 0; func_def_list[i] != NULL; i++)
+        inl_def[new_cg_node(func_def_list[i]->declarator->str)] = func_def_list[i];
+    inl_size = malloc(cg_nodes_counter*sizeof(int));
+    inl_ncalls = calloc(cg_nodes_counter, sizeof(int));
+    inl_param_nid = calloc(cg_nodes_counter, sizeof(int *));
+    recursive = malloc(cg_nodes_counter*sizeof(int));
+    seen = malloc(cg_nodes_counter);
+
+    for (inl_cg_tab_size = 1; inl_cg_tab_size < cg_nodes_counter*2; inl_cg_tab_size *= 2)
+        ;
+    inl_cg_tab = calloc(inl_cg_tab_size, sizeof(int));
+    for (i = 0; i < cg_nodes_counter; i++) {
+        unsigned h;
+
+        for (h = hash(cg_node(i).func_id)&(inl_cg_tab_size-1); inl_cg_tab[h]; h = (h+1)&(inl_cg_tab_size-1))
+            ;
+        inl_cg_tab[h] = i+1;
+    }
+
+    for (i = 0; i < cg_nodes_counter; i++) {
+        inl_size[i] = -1;
+        memset(seen, 0, cg_nodes_counter);
+        recursive[i] = inline_reaches(i, i, seen);
+        if (!cg_node_is_empty(i)) {
+            unsigned j;
+            int g;
+
+            for (j = cfg_node(cg_node(i).bb_i).leader; j <= cfg_node(cg_node(i).bb_f).last; j++)
+                if ((g=inline_call_target(j)) != -1)
+                    ++inl_ncalls[g];
+        }
+    }
+
+    number_CG();
+    for (k = 0; k < cg_nodes_counter; k++) {
+        i = cg_node(k).PO;
+        if (cg_node_is_empty(i))
+            continue;
+        inline_calls(i);
+        if (!recursive[i])
+            inl_size[i] = inline_body_size(i);
+    }
+
+    for (i = 0; i < cg_nodes_counter; i++)
+        free(inl_param_nid[i]);
+    free(inl_param_nid);
+    free(inl_def);
+    free(inl_size);
+    free(inl_ncalls);
+    free(inl_cg_tab);
+    free_nid_map();
+    free(recursive);
+    free(seen);
+}
+
+// =======================================================================================
+// Driver
+// =======================================================================================
+static void fold_constants(unsigned fn)
+{
+    unsigned i, first, last;
+
+    first = cfg_node(cg_node(fn).bb_i).leader;
+    last = cfg_node(cg_node(fn).bb_f).last;
+    for (i = first; i <= last; i++)
+        fold_quad(i);
+}
+
+/*
+ * Optimize every function of the program.
+ * Each round does global value numbering (-O2), copy/constant
+ * propagation, constant folding and dead code elimination, until
+ * nothing changes.
+ */
+void opt_main(void)
+{
+    unsigned fn, max_ninstr;
+
+    max_ninstr = 0;
+    for (fn = 0; fn < cg_nodes_counter; fn++) {
+        unsigned n;
+
+        if (cg_node_is_empty(fn))
+            continue;
+        n = cfg_node(cg_node(fn).bb_f).last-cfg_node(cg_node(fn).bb_i).leader+1;
+        max_ninstr = MAX(max_ninstr, n);
+    }
+    if (max_ninstr == 0)
+        return;
+
+    copies_of_nid = calloc(nid_counter, sizeof(CopyNode *));
+    copies_arena = arena_new(sizeof(CopyNode)*256, FALSE);
+    copies_max = 64;
+    copies = malloc(copies_max*sizeof(struct Copy));
+    quad2copy = malloc(max_ninstr*sizeof(int));
+    addressed_variables = bset_new(nid_counter);
+    if (opt_level >= 2) {
+        int nid;
+
+        def_blocks = calloc(nid_counter, sizeof(BlockNode *));
+        vn_of_nid = malloc(nid_counter*sizeof(unsigned));
+        /*
+         * Every name starts with a value number of its own. gvn_block()
+         * undoes its assignments on the way out, so this holds again
+         * for the next function.
+         */
+        for (nid = 0; nid < nid_counter; nid++)
+            vn_of_nid[nid] = (unsigned)nid+1;
+        ssa_arena = arena_new(sizeof(BlockNode)*256, FALSE);
+        vn_arena = arena_new(sizeof(VNEntry)*256, FALSE);
+        vn_undo_max = 256;
+        vn_undo = malloc(vn_undo_max*sizeof(vn_undo[0]));
+    }
+
+    for (fn = 0; fn < cg_nodes_counter; fn++) {
+        int n, changed;
+
+        if (cg_node_is_empty(fn))
+            continue;
+
+        bset_clear(addressed_variables);
+        for (n = cfg_node(cg_node(fn).bb_i).leader; n <= (int)cfg_node(cg_node(fn).bb_f).last; n++)
+            if (instruction(n).op == OpAddrOf)
+                bset_insert(addressed_variables, address_nid(instruction(n).arg1));
+
+        fold_constants(fn);
+        changed = TRUE;
+        for (n = 0; changed && n<MAX_OPT_ROUNDS; n++) {
+            DEBUG_PRINTF("==> opt round %d, function `%s'\n", n, cg_node(fn).func_id);
+            changed = FALSE;
+            if (opt_level >= 2)
+                changed |= global_value_numbering(fn);
+            changed |= copy_propagation(fn);
+            fold_constants(fn);
+            dflow_LiveOut(fn);
+            changed |= dead_code_elimination(fn);
+            dflow_free_LiveOut(fn);
+        }
+    }
+
+    free(copies_of_nid);
+    arena_destroy(copies_arena);
+    free(copies);
+    free(quad2copy);
+    bset_free(addressed_variables);
+    if (opt_level >= 2) {
+        free(def_blocks);
+        free(vn_of_nid);
+        arena_destroy(ssa_arena);
+        arena_destroy(vn_arena);
+        free(vn_undo);
+    }
+}
@@ -0,0 +1,9944 @@
+.bss
+.align 8
+phi_names:
+.res 8
+.extern fgets
+.extern get_promoted_type
+.extern analyze_bitwise_operator
+.extern verbose_asm
+# ==== start of definition of function `find_avail_copy' ====
+.text
+find_avail_copy:
+addsp 12;        
+# param:`s', offset:-24
+# param:`a', offset:-28
+# var: p, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+neqdw;
+jmpf @L1;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+neqdw;
+jmpf @L1;
+ldidw 1;
+jmp @L2;
+@L1:
+ldidw 0;
+@L2:
+jmpf @L3;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L3:
+ldiqw copies_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L4:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L6;
+ldiqw copies;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpf @L7;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L7;
+ldidw 1;
+jmp @L8;
+@L7:
+ldidw 0;
+@L8:
+jmpf @L9;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ret;
+@L9:
+@L5:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L4;
+@L6:
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern bset_iterate
+.extern edge_iterate
+# ==== start of definition of function `copy_propagation' ====
+.text
+copy_propagation:
+addsp 68;        
+# param:`fn', offset:-20
+# var: i, offset: 4
+# var: changed, offset: 8
+# var: b, offset: 12
+# var: entry_bb, offset: 16
+# var: exit_bb, offset: 20
+# var: nbb, offset: 24
+# var: first, offset: 28
+# var: gen, offset: 32
+# var: kill, offset: 40
+# var: in, offset: 48
+# var: out, offset: 56
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 20;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+ldbp 24;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 28;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldiqw collect_copies;
+call 4;
+pop;
+pop;
+ldiqw ncopies;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L10;
+ldidw 0;
+dw2qw;
+ret;
+@L10:
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 48;
+stqw;
+pop;
+pop;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 56;
+stqw;
+pop;
+pop;
+ldiqw ncopies;
+lddw;
+ldiqw bset_new;
+call 4;
+ldiqw avail_tmp;
+stqw;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 12;
+stdw;
+pop;
+@L11:
+ldbp 12;
+lddw;
+ldbp 20;
+lddw;
+uletdw;
+jmpf @L13;
+# var: k, offset: 64
+ldbp 12;
+lddw;
+ldbp 16;
+lddw;
+subdw;
+ldbp 64;
+stdw;
+pop;
+ldiqw ncopies;
+lddw;
+ldiqw bset_new;
+call 4;
+ldbp 32;
+ldqw;
+ldbp 64;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw ncopies;
+lddw;
+ldiqw bset_new;
+call 4;
+ldbp 40;
+ldqw;
+ldbp 64;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw ncopies;
+lddw;
+ldiqw bset_new;
+call 4;
+ldbp 48;
+ldqw;
+ldbp 64;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw ncopies;
+lddw;
+ldiqw bset_new;
+call 4;
+ldbp 56;
+ldqw;
+ldbp 64;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L14:
+ldbp 4;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+uletdw;
+jmpf @L16;
+ldbp 28;
+lddw;
+ldbp 4;
+lddw;
+ldbp 40;
+ldqw;
+ldbp 64;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 32;
+ldqw;
+ldbp 64;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw avail_transfer;
+call 24;
+pop;
+pop;
+@L15:
+incldw 4;
+jmp @L14;
+@L16:
+ldbp 12;
+lddw;
+ldbp 16;
+lddw;
+neqdw;
+jmpf @L17;
+ldiqw ncopies;
+lddw;
+ldbp 56;
+ldqw;
+ldbp 64;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw bset_fill;
+call 12;
+pop;
+pop;
+jmp @L18;
+@L17:
+ldbp 32;
+ldqw;
+ldbp 64;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 56;
+ldqw;
+ldbp 64;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw bset_cpy;
+call 16;
+pop;
+pop;
+@L18:
+@L12:
+incldw 12;
+jmp @L11;
+@L13:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L19:
+ldbp 8;
+lddw;
+jmpf @L20;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L21:
+ldbp 4;
+lddw;
+ldbp 20;
+lddw;
+uletdw;
+jmpf @L23;
+# var: j, offset: 64
+# var: k, offset: 68
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 76;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+ldbp 16;
+lddw;
+eqdw;
+jmpf @L24;
+jmp @L22;
+@L24:
+ldbp 12;
+lddw;
+ldbp 16;
+lddw;
+subdw;
+ldbp 68;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L25;
+ldbp 48;
+ldqw;
+ldbp 68;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw bset_clear;
+call 8;
+pop;
+pop;
+jmp @L26;
+@L25:
+ldbp 56;
+ldqw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+lddw;
+subdw;
+udw2qw;
+ldxqw 8;
+ldbp 48;
+ldqw;
+ldbp 68;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw bset_cpy;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldbp 64;
+stdw;
+pop;
+@L27:
+ldbp 64;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ultdw;
+jmpf @L29;
+ldbp 56;
+ldqw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 64;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 16;
+lddw;
+subdw;
+udw2qw;
+ldxqw 8;
+ldbp 48;
+ldqw;
+ldbp 68;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw bset_inters;
+call 16;
+pop;
+pop;
+@L28:
+incldw 64;
+jmp @L27;
+@L29:
+@L26:
+ldbp 48;
+ldqw;
+ldbp 68;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw avail_tmp;
+ldqw;
+ldiqw bset_cpy;
+call 16;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldbp 68;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw avail_tmp;
+ldqw;
+ldiqw bset_diff;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldbp 68;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw avail_tmp;
+ldqw;
+ldiqw bset_union;
+call 16;
+pop;
+pop;
+ldbp 56;
+ldqw;
+ldbp 68;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw avail_tmp;
+ldqw;
+ldiqw bset_eq;
+call 16;
+pop;
+notdw;
+jmpf @L30;
+ldiqw avail_tmp;
+ldqw;
+ldbp 56;
+ldqw;
+ldbp 68;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw bset_cpy;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L30:
+@L22:
+incldw 4;
+jmp @L21;
+@L23:
+jmp @L19;
+@L20:
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldbp 12;
+stdw;
+pop;
+@L31:
+ldbp 12;
+lddw;
+ldbp 20;
+lddw;
+uletdw;
+jmpf @L33;
+ldbp 48;
+ldqw;
+ldbp 12;
+lddw;
+ldbp 16;
+lddw;
+subdw;
+udw2qw;
+ldxqw 8;
+ldiqw avail_tmp;
+ldqw;
+ldiqw bset_cpy;
+call 16;
+pop;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L34:
+ldbp 4;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+uletdw;
+jmpf @L36;
+ldbp 8;
+lddw;
+ldbp 4;
+lddw;
+ldiqw avail_tmp;
+ldqw;
+ldiqw propagate_quad;
+call 12;
+pop;
+ordw;
+ldbp 8;
+stdw;
+pop;
+ldbp 28;
+lddw;
+ldbp 4;
+lddw;
+ldidw 0;
+dw2qw;
+ldiqw avail_tmp;
+ldqw;
+ldiqw avail_transfer;
+call 24;
+pop;
+pop;
+@L35:
+incldw 4;
+jmp @L34;
+@L36:
+@L32:
+incldw 12;
+jmp @L31;
+@L33:
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+@L37:
+ldbp 12;
+lddw;
+ldbp 24;
+lddw;
+ultdw;
+jmpf @L39;
+ldbp 32;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+ldbp 56;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+@L38:
+incldw 12;
+jmp @L37;
+@L39:
+ldbp 32;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 56;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw avail_tmp;
+ldqw;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+ldiqw reset_copies;
+call 0;
+pop;
+pop;
+ldbp 8;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `is_scalar_type' ====
+.text
+is_scalar_type:
+addsp 4;         
+# param:`ty', offset:-24
+# var: cat, offset: 4
+ldbp -24;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpt @L40;
+ldbp 4;
+lddw;
+ldidw 11;
+eqdw;
+jmpt @L40;
+ldidw 0;
+jmp @L41;
+@L40:
+ldidw 1;
+@L41:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern static_objects_list
+.extern is_complete
+.extern ic_addresses
+.extern cfg_outpath
+.extern analyze_unary_expression
+.extern target_arch
+.extern arena_destroy
+.extern liveness_and_next_use
+.extern is_struct_union_enum
+.data
+.align 8
+long_long_expr:
+.align 8
+.align 4
+.dword 110
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.extern get_sizeof
+.extern get_curr_scope_id
+.extern getenv
+.extern can_assign_to
+.extern atoi
+.extern bset_member
+.extern exit
+.extern stderr
+.extern opt_level
+.extern restore_scope
+.extern nid2lnid
+.extern rewind
+# ==== start of definition of function `truncate_const' ====
+.text
+truncate_const:
+addsp 12;        
+# param:`v', offset:-24
+# param:`ty', offset:-32
+# var: siz, offset: 4
+# var: m, offset: 8
+ldbp -32;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 4;
+stdw;
+udw2qw;
+ldiqw 8;
+ugetqw;
+jmpf @L42;
+ldbp -24;
+ldqw;
+ret;
+@L42:
+ldiqw 1;
+ldbp 4;
+lddw;
+ldidw 8;
+muldw;
+sllqw;
+ldidw 1;
+dw2qw;
+subqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+andqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_signed_int;
+call 4;
+pop;
+jmpf @L43;
+ldbp -24;
+ldqw;
+ldiqw 1;
+ldbp 4;
+lddw;
+ldidw 8;
+muldw;
+ldidw 1;
+subdw;
+sllqw;
+andqw;
+ordw;
+jmpf @L43;
+ldidw 1;
+jmp @L44;
+@L43:
+ldidw 0;
+@L44:
+jmpf @L45;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+cmplqw;
+orqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+@L45:
+ldbp -24;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern get_type_node
+.extern analyze_logical_operator
+.extern realloc
+.extern lookup_ordinary_id
+.extern snprintf
+.extern strpbrk
+.extern pop_struct_descriptor
+# ==== start of definition of function `push_undo' ====
+.text
+push_undo:
+addsp 0;         
+# param:`nid', offset:-20
+# param:`val', offset:-24
+ldiqw vn_undo_top;
+lddw;
+ldiqw vn_undo_max;
+lddw;
+ugetdw;
+jmpf @L46;
+ldiqw vn_undo_max;
+lddw;
+ldidw 2;
+muldw;
+ldiqw vn_undo_max;
+stdw;
+pop;
+ldiqw vn_undo_max;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+ldiqw vn_undo;
+ldqw;
+ldiqw realloc;
+call 16;
+ldiqw vn_undo;
+stqw;
+pop;
+pop;
+@L46:
+ldbp -20;
+lddw;
+ldiqw vn_undo;
+ldqw;
+ldiqw vn_undo_top;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp -24;
+lddw;
+ldiqw vn_undo;
+ldqw;
+ldiqw vn_undo_top;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+stdw;
+pop;
+ldiqw vn_undo_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+.extern nid2sid_tab
+.bss
+.align 8
+vn_of_nid:
+.res 8
+.extern fseek
+.bss
+.align 8
+dom_children:
+.res 8
+# ==== start of definition of function `opt_main' ====
+.text
+opt_main:
+.global opt_main
+addsp 16;        
+# var: fn, offset: 4
+# var: max_ninstr, offset: 8
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L47:
+ldbp 4;
+lddw;
+ldiqw cg_nodes_counter;
+lddw;
+ultdw;
+jmpf @L49;
+# var: n, offset: 12
+ldiqw cg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L50;
+jmp @L48;
+@L50:
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+ldbp 12;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldbp 12;
+lddw;
+ugtdw;
+jmpf @L51;
+ldbp 8;
+lddw;
+jmp @L52;
+@L51:
+ldbp 12;
+lddw;
+@L52:
+ldbp 8;
+stdw;
+pop;
+@L48:
+incldw 4;
+jmp @L47;
+@L49:
+ldbp 8;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L53;
+ldiqw 0;
+ret;
+@L53:
+ldiqw 8;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw calloc;
+call 16;
+ldiqw copies_of_nid;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw 16;
+ldidw 256;
+dw2qw;
+mulqw;
+pop;
+ldiqw arena_new;
+call 8;
+ldiqw copies_arena;
+stqw;
+pop;
+pop;
+ldidw 64;
+ldiqw copies_max;
+stdw;
+pop;
+ldiqw copies_max;
+lddw;
+udw2qw;
+ldiqw 16;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw copies;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw quad2copy;
+stqw;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+ldiqw bset_new;
+call 4;
+ldiqw addressed_variables;
+stqw;
+pop;
+pop;
+ldiqw opt_level;
+lddw;
+ldidw 2;
+sgetdw;
+jmpf @L54;
+# var: nid, offset: 12
+ldiqw 8;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw calloc;
+call 16;
+ldiqw def_blocks;
+stqw;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw vn_of_nid;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+@L55:
+ldbp 12;
+lddw;
+ldiqw nid_counter;
+lddw;
+sltdw;
+jmpf @L57;
+ldbp 12;
+lddw;
+ldidw 1;
+adddw;
+ldiqw vn_of_nid;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L56:
+incldw 12;
+jmp @L55;
+@L57:
+ldidw 0;
+ldiqw 16;
+ldidw 256;
+dw2qw;
+mulqw;
+pop;
+ldiqw arena_new;
+call 8;
+ldiqw ssa_arena;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw 40;
+ldidw 256;
+dw2qw;
+mulqw;
+pop;
+ldiqw arena_new;
+call 8;
+ldiqw vn_arena;
+stqw;
+pop;
+pop;
+ldidw 256;
+ldiqw vn_undo_max;
+stdw;
+pop;
+ldiqw vn_undo_max;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw vn_undo;
+stqw;
+pop;
+pop;
+@L54:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L58:
+ldbp 4;
+lddw;
+ldiqw cg_nodes_counter;
+lddw;
+ultdw;
+jmpf @L60;
+# var: n, offset: 12
+# var: changed, offset: 16
+ldiqw cg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L61;
+jmp @L59;
+@L61:
+ldiqw addressed_variables;
+ldqw;
+ldiqw bset_clear;
+call 8;
+pop;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+@L62:
+ldbp 12;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+sletdw;
+jmpf @L64;
+ldiqw ic_instructions;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 25;
+eqdw;
+jmpf @L65;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw addressed_variables;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L65:
+@L63:
+incldw 12;
+jmp @L62;
+@L64:
+ldbp 4;
+lddw;
+ldiqw fold_constants;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldbp 16;
+stdw;
+pop;
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+@L66:
+ldbp 16;
+lddw;
+jmpf @L69;
+ldbp 12;
+lddw;
+ldidw 8;
+sltdw;
+jmpf @L69;
+ldidw 1;
+jmp @L70;
+@L69:
+ldidw 0;
+@L70:
+jmpf @L68;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldiqw opt_level;
+lddw;
+ldidw 2;
+sgetdw;
+jmpf @L71;
+ldbp 16;
+lddw;
+ldbp 4;
+lddw;
+ldiqw global_value_numbering;
+call 4;
+pop;
+ordw;
+ldbp 16;
+stdw;
+pop;
+@L71:
+ldbp 16;
+lddw;
+ldbp 4;
+lddw;
+ldiqw copy_propagation;
+call 4;
+pop;
+ordw;
+ldbp 16;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw fold_constants;
+call 4;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw dflow_LiveOut;
+call 4;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 4;
+lddw;
+ldiqw dead_code_elimination;
+call 4;
+pop;
+ordw;
+ldbp 16;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw dflow_free_LiveOut;
+call 4;
+pop;
+pop;
+@L67:
+incldw 12;
+jmp @L66;
+@L68:
+@L59:
+incldw 4;
+jmp @L58;
+@L60:
+ldiqw copies_of_nid;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw copies_arena;
+ldqw;
+ldiqw arena_destroy;
+call 8;
+pop;
+pop;
+ldiqw copies;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw quad2copy;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw addressed_variables;
+ldqw;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+ldiqw opt_level;
+lddw;
+ldidw 2;
+sgetdw;
+jmpf @L72;
+ldiqw def_blocks;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw vn_of_nid;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw ssa_arena;
+ldqw;
+ldiqw arena_destroy;
+call 8;
+pop;
+pop;
+ldiqw vn_arena;
+ldqw;
+ldiqw arena_destroy;
+call 8;
+pop;
+pop;
+ldiqw vn_undo;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+@L72:
+ldidw 0;
+ret;
+.extern push_struct_descriptor
+# ==== start of definition of function `is_volatile' ====
+.text
+is_volatile:
+addsp 12;        
+# param:`e', offset:-24
+# var: tq, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 11;
+eqdw;
+jmpf @L73;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L74;
+@L73:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L74:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L75;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 74;
+eqdw;
+jmpt @L77;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+eqdw;
+jmpt @L77;
+ldidw 0;
+jmp @L78;
+@L77:
+ldidw 1;
+@L78:
+jmpf @L75;
+ldidw 1;
+jmp @L76;
+@L75:
+ldidw 0;
+@L76:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern sscanf
+.extern fputc
+.bss
+.align 4
+vn_undo_top:
+.res 4
+.bss
+.align 8
+vn_undo:
+.res 8
+.extern vsscanf
+.extern dflow_enter_function
+.extern fwrite
+.extern is_pointer
+.extern colored_diagnostics
+.extern read_stream
+.extern strspn
+# ==== start of definition of function `gvn_expression' ====
+.text
+gvn_expression:
+addsp 44;        
+# param:`i', offset:-20
+# var: q, offset: 8
+# var: cat, offset: 16
+# var: p, offset: 24
+# var: vn1, offset: 32
+# var: vn2, offset: 36
+# var: tar, offset: 40
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 40;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L79;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+jmp @L80;
+@L79:
+ldidw 0;
+@L80:
+ldbp 16;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 25;
+eqdw;
+jmpf @L81;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 1;
+adddw;
+ldbp 32;
+stdw;
+pop;
+ldidw 0;
+ldbp 36;
+stdw;
+pop;
+jmp @L82;
+@L81:
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+ldiqw operand_vn;
+call 4;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L83;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw operand_vn;
+call 4;
+pop;
+jmp @L84;
+@L83:
+ldidw 0;
+@L84:
+ldbp 36;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw is_commutative;
+call 4;
+pop;
+jmpf @L85;
+ldbp 32;
+lddw;
+ldbp 36;
+lddw;
+ugtdw;
+jmpf @L85;
+ldidw 1;
+jmp @L86;
+@L85:
+ldidw 0;
+@L86:
+jmpf @L87;
+# var: t, offset: 44
+ldbp 32;
+lddw;
+ldbp 44;
+stdw;
+pop;
+ldbp 36;
+lddw;
+ldbp 32;
+stdw;
+pop;
+ldbp 44;
+lddw;
+ldbp 36;
+stdw;
+pop;
+@L87:
+@L82:
+ldidw 0;
+dw2qw;
+ldbp 36;
+lddw;
+ldbp 32;
+lddw;
+ldbp 16;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw lookup_vn;
+call 24;
+ldbp 24;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L88;
+# var: h, offset: 44
+ldbp 24;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp 44;
+stdw;
+pop;
+ldbp 40;
+lddw;
+ldiqw is_tracked;
+call 4;
+pop;
+jmpf @L89;
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw set_vn;
+call 8;
+pop;
+pop;
+@L89:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 25;
+eqdw;
+jmpt @L92;
+ldbp 44;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L92;
+ldidw 0;
+jmp @L93;
+@L92:
+ldidw 1;
+@L93:
+jmpt @L90;
+ldiqw vn_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 44;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+neqdw;
+jmpt @L90;
+ldidw 0;
+jmp @L91;
+@L90:
+ldidw 1;
+@L91:
+jmpf @L94;
+ldidw 0;
+dw2qw;
+ret;
+@L94:
+ldiqw ic_addresses;
+ldqw;
+ldbp 44;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpf @L95;
+ldidw 39;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L96;
+@L95:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 18;
+eqdw;
+jmpf @L97;
+ldiqw int_ty;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L97:
+ldidw 27;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 44;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 44;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+swap2;
+memcpy 32;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stdw;
+pop;
+@L96:
+ldidw 1;
+dw2qw;
+ret;
+@L88:
+ldidw 1;
+ldidw 0;
+dw2qw;
+ldbp 36;
+lddw;
+ldbp 32;
+lddw;
+ldbp 16;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw install_vn;
+call 28;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 40;
+lddw;
+ldiqw is_tracked;
+call 4;
+pop;
+jmpf @L98;
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw set_vn;
+call 8;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L99;
+ldiqw ic_addresses;
+ldqw;
+ldbp 40;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 16;
+lddw;
+eqdw;
+jmpt @L99;
+ldidw 0;
+jmp @L100;
+@L99:
+ldidw 1;
+@L100:
+jmpf @L101;
+ldbp 40;
+lddw;
+ldbp 24;
+ldqw;
+ldiqw 28;
+addqw;
+stdw;
+pop;
+@L101:
+@L98:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern reset_enum_val
+.extern strtoll
+.extern analyze_relational_equality_expression
+.extern get_var_nid
+.extern get_sto_class_spec
+.extern bset_cpy
+.extern fclose
+# ==== start of definition of function `global_value_numbering' ====
+.text
+global_value_numbering:
+addsp 8;         
+# param:`fn', offset:-20
+# var: changed, offset: 4
+# var: nbb, offset: 8
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw gvn_entry_bb;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw 1;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldiqw reachable;
+stqw;
+pop;
+pop;
+ldiqw 4;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldiqw idom;
+stqw;
+pop;
+pop;
+ldiqw 8;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldiqw dom_children;
+stqw;
+pop;
+pop;
+ldiqw 8;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldiqw dom_frontier;
+stqw;
+pop;
+pop;
+ldiqw 8;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldiqw phi_names;
+stqw;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldiqw mark_reachable;
+call 4;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldiqw compute_dominance;
+call 4;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldiqw place_phi_functions;
+call 4;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+ldiqw vn_counter;
+stdw;
+pop;
+ldiqw 8072;
+ldidw 0;
+ldiqw vn_table;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldiqw gvn_entry_bb;
+lddw;
+ldiqw gvn_block;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L102:
+ldiqw vn_undo_top;
+lddw;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L105;
+ldidw 1130;
+ldiqw @S0;
+ldiqw @S1;
+ldiqw @S2;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L105:
+@L103:
+ldidw 0;
+jmpf @L104;
+jmp @L102;
+@L104:
+ldiqw reachable;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw idom;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw dom_children;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw dom_frontier;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw phi_names;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw ssa_arena;
+ldqw;
+ldiqw arena_reset;
+call 8;
+pop;
+pop;
+ldiqw vn_arena;
+ldqw;
+ldiqw arena_reset;
+call 8;
+pop;
+pop;
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern preprocess
+.extern analyze_decl_specs
+.extern strstr
+.extern calloc
+# ==== start of definition of function `is_copy_candidate' ====
+.text
+is_copy_candidate:
+addsp 8;         
+# param:`i', offset:-20
+# var: tar, offset: 4
+# var: arg1, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 27;
+neqdw;
+jmpf @L106;
+ldidw 0;
+dw2qw;
+ret;
+@L106:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_tracked;
+call 4;
+pop;
+notdw;
+jmpt @L107;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw is_scalar_type;
+call 8;
+pop;
+notdw;
+jmpt @L107;
+ldidw 0;
+jmp @L108;
+@L107:
+ldidw 1;
+@L108:
+jmpf @L109;
+ldidw 0;
+dw2qw;
+ret;
+@L109:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T110;
+jmptab;
+@L112:
+ldidw 1;
+dw2qw;
+ret;
+@L113:
+ldbp 8;
+lddw;
+ldiqw is_tracked;
+call 4;
+pop;
+notdw;
+jmpt @L114;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpt @L114;
+ldidw 0;
+jmp @L115;
+@L114:
+ldidw 1;
+@L115:
+jmpf @L116;
+ldidw 0;
+dw2qw;
+ret;
+@L116:
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L117;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+eqdw;
+jmpt @L117;
+ldidw 0;
+jmp @L118;
+@L117:
+ldidw 1;
+@L118:
+dw2qw;
+ret;
+@L119:
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L120;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+neqdw;
+jmpf @L120;
+ldidw 1;
+jmp @L121;
+@L120:
+ldidw 0;
+@L121:
+dw2qw;
+ret;
+@L122:
+ldidw 0;
+dw2qw;
+ret;
+@L111:
+.data
+.align 8
+@T110:
+.dword 0
+.dword 4
+.qword @L122
+.qword @L112
+.qword @L122
+.qword @L113
+.qword @L119
+.text
+ldidw 0;
+ret;
+.extern pop_scope
+.extern memset
+.extern file_exists
+.extern include_libc
+# ==== start of definition of function `new_const_addr' ====
+.text
+new_const_addr:
+addsp 4;         
+# param:`val', offset:-24
+# var: a, offset: 4
+ldidw 0;
+ldiqw new_address;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern C_source
+.extern analyze_cast_expression
+# ==== start of definition of function `install_vn' ====
+.text
+install_vn:
+addsp 12;        
+# param:`op', offset:-20
+# param:`cat', offset:-24
+# param:`vn1', offset:-28
+# param:`vn2', offset:-32
+# param:`val', offset:-40
+# param:`scoped', offset:-44
+# var: h, offset: 4
+# var: p, offset: 8
+ldbp -40;
+ldqw;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw vn_hash;
+call 24;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw 40;
+pop;
+ldiqw vn_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw vn_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 28;
+addqw;
+stdw;
+pop;
+ldiqw vn_table;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw vn_table;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -44;
+lddw;
+jmpf @L123;
+ldbp 4;
+lddw;
+ldidw 1;
+negdw;
+ldiqw push_undo;
+call 8;
+pop;
+pop;
+@L123:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern stringify_type_exp
+.extern add_quote_dir
+# ==== start of definition of function `avail_transfer' ====
+.text
+avail_transfer:
+addsp 12;        
+# param:`s', offset:-24
+# param:`kill', offset:-32
+# param:`i', offset:-36
+# param:`first', offset:-40
+# var: nid, offset: 4
+# var: p, offset: 8
+ldbp -36;
+lddw;
+ldiqw defined_nid;
+call 4;
+pop;
+ldbp 4;
+stdw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L124;
+ldiqw 0;
+ret;
+@L124:
+ldiqw copies_of_nid;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L125:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L127;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L128;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L128:
+@L126:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L125;
+@L127:
+ldiqw quad2copy;
+ldqw;
+ldbp -36;
+lddw;
+ldbp -40;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L129;
+ldiqw quad2copy;
+ldqw;
+ldbp -36;
+lddw;
+ldbp -40;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp -24;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L129:
+ldidw 0;
+ret;
+.extern stat_number_of_ast_nodes
+.extern strtoul
+.extern fprintf
+.extern get_type_qual
+.extern read_file
+.extern address_taken_variables
+.extern is_signed_int
+.extern printf
+.extern get_c_token
+.bss
+.align 8
+reachable:
+.res 8
+.extern lookup_tag
+.extern get_rank
+.extern is_external_id
+# ==== start of definition of function `dead_code_elimination' ====
+.text
+dead_code_elimination:
+addsp 24;        
+# param:`fn', offset:-20
+# var: changed, offset: 4
+# var: b, offset: 8
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ldiqw bset_new;
+call 4;
+ldiqw dce_live;
+stqw;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L130:
+ldbp 8;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+uletdw;
+jmpf @L132;
+# var: i, offset: 12
+ldiqw cfg_nodes;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw dce_live;
+ldqw;
+ldiqw bset_cpy;
+call 16;
+pop;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+@L133:
+ldbp 12;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+sgetdw;
+jmpf @L135;
+# var: tar, offset: 16
+# var: arg1, offset: 20
+# var: arg2, offset: 24
+ldiqw ic_instructions;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 20;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T136;
+jmptab;
+@L138:
+@L139:
+@L140:
+@L141:
+@L142:
+@L143:
+@L144:
+@L145:
+@L146:
+@L147:
+@L148:
+@L149:
+@L150:
+@L151:
+@L152:
+@L153:
+@L154:
+@L155:
+@L156:
+@L157:
+@L158:
+@L159:
+@L160:
+@L161:
+@L162:
+@L163:
+@L164:
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw dce_live;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L165;
+ldbp 16;
+lddw;
+ldiqw is_tracked;
+call 4;
+pop;
+jmpf @L165;
+ldidw 1;
+jmp @L166;
+@L165:
+ldidw 0;
+@L166:
+jmpf @L167;
+ldidw 39;
+ldiqw ic_instructions;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+jmp @L134;
+@L167:
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw dce_live;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 25;
+eqdw;
+jmpf @L168;
+jmp @L134;
+@L168:
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L171;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L171;
+ldidw 0;
+jmp @L172;
+@L171:
+ldidw 1;
+@L172:
+notdw;
+jmpf @L169;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw dce_live;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+jmp @L170;
+@L169:
+ldidw 0;
+@L170:
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L173;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L176;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L176;
+ldidw 0;
+jmp @L177;
+@L176:
+ldidw 1;
+@L177:
+notdw;
+jmpf @L174;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw dce_live;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+jmp @L175;
+@L174:
+ldidw 0;
+@L175:
+pop;
+@L173:
+jmp @L134;
+@L178:
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw dce_live;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L181;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L181;
+ldidw 0;
+jmp @L182;
+@L181:
+ldidw 1;
+@L182:
+notdw;
+jmpf @L179;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw dce_live;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+jmp @L180;
+@L179:
+ldidw 0;
+@L180:
+pop;
+jmp @L134;
+@L183:
+@L184:
+ldbp 16;
+lddw;
+jmpf @L185;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw dce_live;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+@L185:
+ldiqw ic_instructions;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 29;
+eqdw;
+jmpf @L186;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L189;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L189;
+ldidw 0;
+jmp @L190;
+@L189:
+ldidw 1;
+@L190:
+notdw;
+jmpf @L187;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw dce_live;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+jmp @L188;
+@L187:
+ldidw 0;
+@L188:
+pop;
+@L186:
+jmp @L134;
+@L191:
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L194;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L194;
+ldidw 0;
+jmp @L195;
+@L194:
+ldidw 1;
+@L195:
+notdw;
+jmpf @L192;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw dce_live;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+jmp @L193;
+@L192:
+ldidw 0;
+@L193:
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L198;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L198;
+ldidw 0;
+jmp @L199;
+@L198:
+ldidw 1;
+@L199:
+notdw;
+jmpf @L196;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw dce_live;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+jmp @L197;
+@L196:
+ldidw 0;
+@L197:
+pop;
+jmp @L134;
+@L200:
+@L201:
+@L202:
+@L203:
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L206;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L206;
+ldidw 0;
+jmp @L207;
+@L206:
+ldidw 1;
+@L207:
+notdw;
+jmpf @L204;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw dce_live;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+jmp @L205;
+@L204:
+ldidw 0;
+@L205:
+pop;
+jmp @L134;
+@L208:
+jmp @L134;
+@L137:
+.data
+.align 8
+@T136:
+.dword 0
+.dword 38
+.qword @L208
+.qword @L138
+.qword @L139
+.qword @L140
+.qword @L141
+.qword @L142
+.qword @L143
+.qword @L144
+.qword @L145
+.qword @L146
+.qword @L147
+.qword @L148
+.qword @L149
+.qword @L150
+.qword @L151
+.qword @L152
+.qword @L153
+.qword @L154
+.qword @L155
+.qword @L156
+.qword @L157
+.qword @L158
+.qword @L159
+.qword @L160
+.qword @L161
+.qword @L162
+.qword @L164
+.qword @L178
+.qword @L163
+.qword @L183
+.qword @L184
+.qword @L191
+.qword @L208
+.qword @L208
+.qword @L200
+.qword @L201
+.qword @L202
+.qword @L208
+.qword @L203
+.text
+@L134:
+decldw 12;
+jmp @L133;
+@L135:
+@L131:
+incldw 8;
+jmp @L130;
+@L132:
+ldiqw dce_live;
+ldqw;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern sprintf
+.data
+.align 8
+long_long_ty:
+.align 8
+.align 8
+.qword long_long_expr+0
+.align 8
+.zero 8
+.extern strcat
+.extern are_compatible
+.bss
+.align 8
+def_blocks:
+.res 8
+.extern error_count
+.bss
+.align 8
+copies_arena:
+.res 8
+.extern free_pre_token
+.extern cg_nodes_counter
+# ==== start of definition of function `propagate_quad' ====
+.text
+propagate_quad:
+addsp 52;        
+# param:`s', offset:-24
+# param:`i', offset:-28
+# var: q, offset: 8
+# var: changed, offset: 16
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T209;
+jmptab;
+@L211:
+@L212:
+@L213:
+@L214:
+@L215:
+@L216:
+@L217:
+@L218:
+@L219:
+@L220:
+@L221:
+@L222:
+@L223:
+@L224:
+@L225:
+@L226:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L227;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L227;
+ldidw 0;
+jmp @L228;
+@L227:
+ldidw 1;
+@L228:
+notdw;
+jmpf @L229;
+ldbp 16;
+lddw;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw propagate_operand;
+call 20;
+pop;
+ordw;
+ldbp 16;
+stdw;
+pop;
+@L229:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L230;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L230;
+ldidw 0;
+jmp @L231;
+@L230:
+ldidw 1;
+@L231:
+notdw;
+jmpf @L232;
+ldbp 16;
+lddw;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw propagate_operand;
+call 20;
+pop;
+ordw;
+ldbp 16;
+stdw;
+pop;
+@L232:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L233;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L233;
+ldidw 1;
+jmp @L234;
+@L233:
+ldidw 0;
+@L234:
+jmpf @L235;
+# var: sav, offset: 24
+ldbp 8;
+ldqw;
+ldbp 24;
+swap2;
+memcpy 32;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldiqw fold_quad;
+call 4;
+pop;
+notdw;
+jmpf @L236;
+ldbp 24;
+ldbp 8;
+ldqw;
+swap2;
+memcpy 32;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ret;
+@L236:
+ldidw 1;
+ldbp 16;
+stdw;
+pop;
+@L235:
+jmp @L210;
+@L237:
+@L238:
+@L239:
+@L240:
+@L241:
+@L242:
+@L243:
+@L244:
+@L245:
+@L246:
+@L247:
+@L248:
+@L249:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L250;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L250;
+ldidw 0;
+jmp @L251;
+@L250:
+ldidw 1;
+@L251:
+notdw;
+jmpf @L252;
+ldbp 16;
+lddw;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw propagate_operand;
+call 20;
+pop;
+ordw;
+ldbp 16;
+stdw;
+pop;
+@L252:
+jmp @L210;
+@L253:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L254;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L254;
+ldidw 0;
+jmp @L255;
+@L254:
+ldidw 1;
+@L255:
+notdw;
+jmpf @L256;
+ldbp 16;
+lddw;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw propagate_operand;
+call 20;
+pop;
+ordw;
+ldbp 16;
+stdw;
+pop;
+@L256:
+@L257:
+@L258:
+@L259:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L260;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L260;
+ldidw 0;
+jmp @L261;
+@L260:
+ldidw 1;
+@L261:
+notdw;
+jmpf @L262;
+ldbp 16;
+lddw;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw propagate_operand;
+call 20;
+pop;
+ordw;
+ldbp 16;
+stdw;
+pop;
+@L262:
+jmp @L210;
+@L263:
+jmp @L210;
+@L210:
+.data
+.align 8
+@T209:
+.dword 0
+.dword 38
+.qword @L263
+.qword @L211
+.qword @L212
+.qword @L213
+.qword @L214
+.qword @L215
+.qword @L216
+.qword @L217
+.qword @L218
+.qword @L219
+.qword @L220
+.qword @L221
+.qword @L222
+.qword @L223
+.qword @L224
+.qword @L225
+.qword @L226
+.qword @L237
+.qword @L238
+.qword @L239
+.qword @L240
+.qword @L241
+.qword @L242
+.qword @L243
+.qword @L244
+.qword @L245
+.qword @L263
+.qword @L257
+.qword @L246
+.qword @L263
+.qword @L258
+.qword @L253
+.qword @L263
+.qword @L263
+.qword @L247
+.qword @L248
+.qword @L259
+.qword @L263
+.qword @L249
+.text
+ldbp 16;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern round_up
+.extern analyze_declarator
+.extern include_liblux
+.extern stat_number_of_pre_tokens
+.extern bset_eq
+.extern strchr
+# ==== start of definition of function `fold_constants' ====
+.text
+fold_constants:
+addsp 12;        
+# param:`fn', offset:-20
+# var: i, offset: 4
+# var: first, offset: 8
+# var: last, offset: 12
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L264:
+ldbp 4;
+lddw;
+ldbp 12;
+lddw;
+uletdw;
+jmpf @L266;
+ldbp 4;
+lddw;
+ldiqw fold_quad;
+call 4;
+pop;
+pop;
+@L265:
+incldw 4;
+jmp @L264;
+@L266:
+ldidw 0;
+ret;
+.extern add_angle_dir
+.extern analyze_conditional_expression
+.extern ic_outpath
+.extern arena_alloc
+.extern stdout
+.extern get_type_category
+.bss
+.align 4
+vn_undo_max:
+.res 4
+.data
+.align 8
+int_expr:
+.align 8
+.align 4
+.dword 60
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.align 8
+.zero 8
+.extern ilog2
+# ==== start of definition of function `is_tracked' ====
+.text
+is_tracked:
+addsp 12;        
+# param:`a', offset:-20
+# var: e, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L267;
+ldidw 1;
+dw2qw;
+ret;
+@L267:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+neqdw;
+jmpf @L268;
+ldidw 0;
+dw2qw;
+ret;
+@L268:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 0;
+eqdw;
+jmpf @L275;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw address_taken_variables;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L275;
+ldidw 1;
+jmp @L276;
+@L275:
+ldidw 0;
+@L276:
+jmpf @L273;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw addressed_variables;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L273;
+ldidw 1;
+jmp @L274;
+@L273:
+ldidw 0;
+@L274:
+jmpf @L271;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw is_scalar_type;
+call 8;
+pop;
+jmpf @L271;
+ldidw 1;
+jmp @L272;
+@L271:
+ldidw 0;
+@L272:
+jmpf @L269;
+ldbp 8;
+ldqw;
+ldiqw is_volatile;
+call 8;
+pop;
+notdw;
+jmpf @L269;
+ldidw 1;
+jmp @L270;
+@L269:
+ldidw 0;
+@L270:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern strcmp
+.extern bset_fill
+.extern strtok
+.extern strtol
+.extern parse_header
+.extern stdin
+.extern dflow_Dom
+.bss
+.align 8
+vn_table:
+.res 8072
+.extern is_integer
+.extern analyze_postfix_expression
+.extern ftell
+.extern strcpy
+.bss
+.align 8
+copies:
+.res 8
+.bss
+.align 4
+ncopies:
+.res 4
+.extern install_tag
+# ==== start of definition of function `reset_copies' ====
+.text
+reset_copies:
+addsp 4;         
+# var: c, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L277:
+ldbp 4;
+lddw;
+ldiqw ncopies;
+lddw;
+ultdw;
+jmpf @L279;
+ldidw 0;
+dw2qw;
+ldiqw copies_of_nid;
+ldqw;
+ldiqw copies;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldiqw copies;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L280;
+ldidw 0;
+dw2qw;
+ldiqw copies_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw copies;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L280:
+@L278:
+incldw 4;
+jmp @L277;
+@L279:
+ldiqw copies_arena;
+ldqw;
+ldiqw arena_reset;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern ic_function_to_print
+.bss
+.align 4
+copies_max:
+.res 4
+.extern strtoull
+.bss
+.align 8
+avail_tmp:
+.res 8
+.extern strlen
+.extern token_table
+.bss
+.align 8
+idom:
+.res 8
+# ==== start of definition of function `place_phi_functions' ====
+.text
+place_phi_functions:
+addsp 84;        
+# param:`fn', offset:-20
+# var: b, offset: 4
+# var: nbb, offset: 8
+# var: nnames, offset: 12
+# var: names, offset: 16
+# var: work, offset: 24
+# var: wtop, offset: 32
+# var: has_phi, offset: 40
+# var: in_work, offset: 48
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw gvn_entry_bb;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L281:
+ldbp 4;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+uletdw;
+jmpf @L283;
+# var: i, offset: 56
+ldiqw reachable;
+ldqw;
+ldbp 4;
+lddw;
+ldiqw gvn_entry_bb;
+lddw;
+subdw;
+udw2qw;
+ldxb 1;
+notdw;
+jmpf @L284;
+jmp @L282;
+@L284:
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 56;
+stdw;
+pop;
+@L285:
+ldbp 56;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+uletdw;
+jmpf @L287;
+# var: nid, offset: 60
+ldbp 56;
+lddw;
+ldiqw defined_nid;
+call 4;
+pop;
+ldbp 60;
+stdw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L288;
+ldiqw ic_instructions;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw is_tracked;
+call 4;
+pop;
+notdw;
+jmpt @L288;
+ldidw 0;
+jmp @L289;
+@L288:
+ldidw 1;
+@L289:
+jmpf @L290;
+jmp @L286;
+@L290:
+ldiqw def_blocks;
+ldqw;
+ldbp 60;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L291;
+ldbp 12;
+lddw;
+ldbp 12;
+lddw;
+ldidw 1;
+subdw;
+anddw;
+ldidw 0;
+eqdw;
+jmpf @L292;
+ldbp 12;
+lddw;
+jmpf @L293;
+ldbp 12;
+lddw;
+ldidw 2;
+muldw;
+jmp @L294;
+@L293:
+ldidw 1;
+@L294:
+udw2qw;
+ldiqw 4;
+mulqw;
+ldbp 16;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L292:
+ldbp 60;
+lddw;
+ldbp 16;
+ldqw;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L295;
+@L291:
+ldiqw def_blocks;
+ldqw;
+ldbp 60;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 4;
+lddw;
+eqdw;
+jmpf @L296;
+jmp @L286;
+@L296:
+@L295:
+ldbp 4;
+lddw;
+ldiqw def_blocks;
+ldqw;
+ldbp 60;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+ldiqw add_block_node;
+call 12;
+pop;
+pop;
+@L286:
+incldw 56;
+jmp @L285;
+@L287:
+@L282:
+incldw 4;
+jmp @L281;
+@L283:
+ldiqw 4;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldiqw 4;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldbp 48;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L297:
+ldbp 12;
+lddw;
+jmpf @L298;
+# var: n, offset: 56
+# var: p, offset: 64
+ldbp 16;
+ldqw;
+ldbp 12;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 56;
+stdw;
+pop;
+ldidw 0;
+ldbp 32;
+stdw;
+pop;
+ldiqw def_blocks;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 64;
+stqw;
+pop;
+pop;
+@L299:
+ldbp 64;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L301;
+ldbp 56;
+lddw;
+ldidw 1;
+adddw;
+ldbp 48;
+ldqw;
+ldbp 64;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw gvn_entry_bb;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 64;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 24;
+ldqw;
+ldbp 32;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L300:
+ldbp 64;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+jmp @L299;
+@L301:
+ldidw 0;
+dw2qw;
+ldiqw def_blocks;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L302:
+ldbp 32;
+lddw;
+jmpf @L303;
+# var: d, offset: 72
+ldbp 24;
+ldqw;
+ldbp 32;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 72;
+stdw;
+pop;
+ldiqw dom_frontier;
+ldqw;
+ldbp 72;
+lddw;
+ldiqw gvn_entry_bb;
+lddw;
+subdw;
+udw2qw;
+ldxqw 8;
+ldbp 64;
+stqw;
+pop;
+pop;
+@L304:
+ldbp 64;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L306;
+# var: k, offset: 76
+ldbp 64;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw gvn_entry_bb;
+lddw;
+subdw;
+ldbp 76;
+stdw;
+pop;
+ldbp 40;
+ldqw;
+ldbp 76;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 56;
+lddw;
+ldidw 1;
+adddw;
+neqdw;
+jmpf @L307;
+# var: np, offset: 80
+ldiqw 16;
+pop;
+ldiqw ssa_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 80;
+stqw;
+pop;
+pop;
+ldbp 56;
+lddw;
+ldbp 80;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw phi_names;
+ldqw;
+ldbp 76;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 80;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 80;
+ldqw;
+ldiqw phi_names;
+ldqw;
+ldbp 76;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 56;
+lddw;
+ldidw 1;
+adddw;
+ldbp 40;
+ldqw;
+ldbp 76;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L307:
+ldbp 48;
+ldqw;
+ldbp 76;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 56;
+lddw;
+ldidw 1;
+adddw;
+neqdw;
+jmpf @L308;
+ldbp 56;
+lddw;
+ldidw 1;
+adddw;
+ldbp 48;
+ldqw;
+ldbp 76;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 64;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 24;
+ldqw;
+ldbp 32;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L308:
+@L305:
+ldbp 64;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+jmp @L304;
+@L306:
+jmp @L302;
+@L303:
+jmp @L297;
+@L298:
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `is_commutative' ====
+.text
+is_commutative:
+addsp 0;         
+# param:`op', offset:-20
+ldbp -20;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L315;
+ldbp -20;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L315;
+ldidw 0;
+jmp @L316;
+@L315:
+ldidw 1;
+@L316:
+jmpt @L313;
+ldbp -20;
+lddw;
+ldidw 7;
+eqdw;
+jmpt @L313;
+ldidw 0;
+jmp @L314;
+@L313:
+ldidw 1;
+@L314:
+jmpt @L311;
+ldbp -20;
+lddw;
+ldidw 8;
+eqdw;
+jmpt @L311;
+ldidw 0;
+jmp @L312;
+@L311:
+ldidw 1;
+@L312:
+jmpt @L309;
+ldbp -20;
+lddw;
+ldidw 9;
+eqdw;
+jmpt @L309;
+ldidw 0;
+jmp @L310;
+@L309:
+ldidw 1;
+@L310:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern bset_free
+.extern analyze_expression
+.extern cfg_nodes
+.extern memchr
+.extern new_type_exp_node
+.extern analyze_primary_expression
+.extern dup_decl_specs
+.extern new_declaration_node
+.extern vfprintf
+.extern eval_const_expr
+.extern hash
+.extern bsearch
+# ==== start of definition of function `propagate_operand' ====
+.text
+propagate_operand:
+addsp 8;         
+# param:`s', offset:-24
+# param:`pa', offset:-32
+# param:`allow_const', offset:-36
+# var: c, offset: 4
+# var: src, offset: 8
+ldbp -32;
+ldqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw find_avail_copy;
+call 12;
+pop;
+ldbp 4;
+stdw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L317;
+ldidw 0;
+dw2qw;
+ret;
+@L317:
+ldiqw copies;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L318;
+ldbp -36;
+lddw;
+notdw;
+jmpf @L319;
+ldidw 0;
+dw2qw;
+ret;
+@L319:
+ldiqw copies;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw new_const_addr;
+call 8;
+pop;
+ldbp -32;
+ldqw;
+stdw;
+pop;
+jmp @L320;
+@L318:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw new_address;
+call 4;
+pop;
+ldbp -32;
+ldqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+ldqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+swap2;
+memcpy 32;
+pop;
+pop;
+@L320:
+ldidw 1;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern pre_save_pch
+.extern qsort
+.extern analyze_parameter_declaration
+.extern cg_outpath
+.bss
+.align 4
+gvn_entry_bb:
+.res 4
+.extern memcmp
+.extern bset_insert
+.extern pre_load_pch
+.extern dflow_free_LiveOut
+.extern vsnprintf
+.extern vsprintf
+.bss
+.align 8
+copies_of_nid:
+.res 8
+.extern nid_counter
+.extern new_cg_node
+.extern warning_count
+.extern memcpy
+# ==== start of definition of function `add_block_node' ====
+.text
+add_block_node:
+addsp 12;        
+# param:`list', offset:-24
+# param:`b', offset:-28
+# var: p, offset: 8
+ldiqw 16;
+pop;
+ldiqw ssa_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern fopen
+.extern be_atoi
+.extern bset_delete
+# ==== start of definition of function `set_vn' ====
+.text
+set_vn:
+addsp 0;         
+# param:`nid', offset:-20
+# param:`vn', offset:-24
+ldiqw vn_of_nid;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp -20;
+lddw;
+ldiqw push_undo;
+call 8;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldiqw vn_of_nid;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern push_scope
+.extern free_c_token
+.extern ic_main
+.extern new_address
+# ==== start of definition of function `defined_nid' ====
+.text
+defined_nid:
+addsp 0;         
+# param:`i', offset:-20
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T321;
+jmptab;
+@L323:
+@L324:
+@L325:
+@L326:
+@L327:
+@L328:
+@L329:
+@L330:
+@L331:
+@L332:
+@L333:
+@L334:
+@L335:
+@L336:
+@L337:
+@L338:
+@L339:
+@L340:
+@L341:
+@L342:
+@L343:
+@L344:
+@L345:
+@L346:
+@L347:
+@L348:
+@L349:
+@L350:
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ret;
+@L351:
+@L352:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+jmpf @L353;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+jmp @L354;
+@L353:
+ldidw 1;
+negdw;
+@L354:
+dw2qw;
+ret;
+@L355:
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L322:
+.data
+.align 8
+@T321:
+.dword 0
+.dword 30
+.qword @L355
+.qword @L323
+.qword @L324
+.qword @L325
+.qword @L326
+.qword @L327
+.qword @L328
+.qword @L329
+.qword @L330
+.qword @L331
+.qword @L332
+.qword @L333
+.qword @L334
+.qword @L335
+.qword @L336
+.qword @L337
+.qword @L338
+.qword @L339
+.qword @L340
+.qword @L341
+.qword @L342
+.qword @L343
+.qword @L344
+.qword @L345
+.qword @L346
+.qword @L347
+.qword @L348
+.qword @L349
+.qword @L350
+.qword @L351
+.qword @L352
+.text
+ldidw 0;
+ret;
+# ==== start of definition of function `vn_hash' ====
+.text
+vn_hash:
+addsp 0;         
+# param:`op', offset:-20
+# param:`cat', offset:-24
+# param:`vn1', offset:-28
+# param:`vn2', offset:-32
+# param:`val', offset:-40
+ldbp -20;
+lddw;
+ldidw 31;
+muldw;
+ldbp -24;
+lddw;
+ldidw 17;
+muldw;
+adddw;
+ldbp -28;
+lddw;
+ldidw 7;
+muldw;
+adddw;
+ldbp -32;
+lddw;
+adddw;
+ldbp -40;
+ldqw;
+pop;
+adddw;
+ldidw 1009;
+umoddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern parse
+.extern get_pre_token
+# ==== start of definition of function `mark_reachable' ====
+.text
+mark_reachable:
+addsp 28;        
+# param:`fn', offset:-20
+# var: stack, offset: 8
+# var: top, offset: 16
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldbp 16;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+dw2b;
+ldiqw reachable;
+ldqw;
+ldidw 0;
+dw2qw;
+addqw;
+stb;
+pop;
+@L356:
+ldbp 16;
+lddw;
+jmpf @L357;
+# var: b, offset: 20
+# var: j, offset: 24
+ldbp 8;
+ldqw;
+ldbp 16;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 20;
+stdw;
+pop;
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L358:
+ldbp 24;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ultdw;
+jmpf @L360;
+# var: s, offset: 28
+ldiqw cfg_nodes;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 28;
+stdw;
+pop;
+ldiqw reachable;
+ldqw;
+ldbp 28;
+lddw;
+ldiqw gvn_entry_bb;
+lddw;
+subdw;
+udw2qw;
+ldxb 1;
+notdw;
+jmpf @L361;
+ldidw 1;
+dw2b;
+ldiqw reachable;
+ldqw;
+ldbp 28;
+lddw;
+ldiqw gvn_entry_bb;
+lddw;
+subdw;
+udw2qw;
+addqw;
+stb;
+pop;
+ldbp 28;
+lddw;
+ldbp 8;
+ldqw;
+ldbp 16;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L361:
+@L359:
+incldw 24;
+jmp @L358;
+@L360:
+jmp @L356;
+@L357:
+ldbp 8;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern get_member_descriptor
+.extern decl_init
+.extern ic_free_function
+# ==== start of definition of function `gvn_block' ====
+.text
+gvn_block:
+addsp 40;        
+# param:`b', offset:-20
+# var: changed, offset: 4
+# var: i, offset: 8
+# var: undo_mark, offset: 12
+# var: n, offset: 16
+# var: c, offset: 24
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldiqw vn_undo_top;
+lddw;
+ldbp 12;
+stdw;
+pop;
+ldiqw phi_names;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw gvn_entry_bb;
+lddw;
+subdw;
+udw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L362:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L364;
+ldiqw vn_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw set_vn;
+call 8;
+pop;
+pop;
+@L363:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L362;
+@L364:
+ldiqw cfg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L365:
+ldbp 8;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+uletdw;
+jmpf @L367;
+# var: tar, offset: 32
+# var: arg1, offset: 36
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 32;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 36;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T368;
+jmptab;
+@L370:
+@L371:
+@L372:
+@L373:
+@L374:
+@L375:
+@L376:
+@L377:
+@L378:
+@L379:
+@L380:
+@L381:
+@L382:
+@L383:
+@L384:
+@L385:
+@L386:
+@L387:
+@L388:
+@L389:
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+ldiqw gvn_expression;
+call 4;
+pop;
+ordw;
+ldbp 4;
+stdw;
+pop;
+jmp @L369;
+@L390:
+ldbp 32;
+lddw;
+ldiqw is_tracked;
+call 4;
+pop;
+notdw;
+jmpf @L391;
+jmp @L369;
+@L391:
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpt @L392;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L396;
+ldbp 36;
+lddw;
+ldiqw is_tracked;
+call 4;
+pop;
+jmpf @L396;
+ldidw 1;
+jmp @L397;
+@L396:
+ldidw 0;
+@L397:
+jmpf @L394;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+eqdw;
+jmpf @L394;
+ldidw 1;
+jmp @L395;
+@L394:
+ldidw 0;
+@L395:
+jmpt @L392;
+ldidw 0;
+jmp @L393;
+@L392:
+ldidw 1;
+@L393:
+jmpf @L398;
+ldbp 36;
+lddw;
+ldiqw operand_vn;
+call 4;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw set_vn;
+call 8;
+pop;
+pop;
+jmp @L399;
+@L398:
+ldiqw vn_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw set_vn;
+call 8;
+pop;
+pop;
+@L399:
+jmp @L369;
+@L400:
+# var: nid, offset: 40
+ldbp 8;
+lddw;
+ldiqw defined_nid;
+call 4;
+pop;
+ldbp 40;
+stdw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L401;
+ldbp 32;
+lddw;
+ldiqw is_tracked;
+call 4;
+pop;
+jmpf @L401;
+ldidw 1;
+jmp @L402;
+@L401:
+ldidw 0;
+@L402:
+jmpf @L403;
+ldiqw vn_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldbp 40;
+lddw;
+ldiqw set_vn;
+call 8;
+pop;
+pop;
+@L403:
+jmp @L369;
+@L369:
+.data
+.align 8
+@T368:
+.dword 0
+.dword 28
+.qword @L400
+.qword @L370
+.qword @L371
+.qword @L372
+.qword @L373
+.qword @L374
+.qword @L375
+.qword @L376
+.qword @L377
+.qword @L378
+.qword @L379
+.qword @L400
+.qword @L400
+.qword @L400
+.qword @L400
+.qword @L400
+.qword @L400
+.qword @L380
+.qword @L381
+.qword @L382
+.qword @L383
+.qword @L384
+.qword @L385
+.qword @L386
+.qword @L387
+.qword @L388
+.qword @L389
+.qword @L400
+.qword @L390
+.text
+@L366:
+incldw 8;
+jmp @L365;
+@L367:
+ldiqw dom_children;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw gvn_entry_bb;
+lddw;
+subdw;
+udw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L404:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L406;
+ldbp 4;
+lddw;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw gvn_block;
+call 4;
+pop;
+ordw;
+ldbp 4;
+stdw;
+pop;
+@L405:
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L404;
+@L406:
+@L407:
+ldiqw vn_undo_top;
+lddw;
+ldbp 12;
+lddw;
+ugtdw;
+jmpf @L408;
+ldiqw vn_undo_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldiqw vn_undo;
+ldqw;
+ldiqw vn_undo_top;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L409;
+ldiqw vn_table;
+ldiqw vn_undo;
+ldqw;
+ldiqw vn_undo_top;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+udw2qw;
+ldxqw 8;
+ldiqw 32;
+addqw;
+ldqw;
+ldiqw vn_table;
+ldiqw vn_undo;
+ldqw;
+ldiqw vn_undo_top;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L410;
+@L409:
+ldiqw vn_undo;
+ldqw;
+ldiqw vn_undo_top;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldiqw vn_of_nid;
+ldqw;
+ldiqw vn_undo;
+ldqw;
+ldiqw vn_undo_top;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L410:
+jmp @L407;
+@L408:
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern dup_declarator
+.extern cg_nodes
+.extern strncat
+.bss
+.align 8
+dom_frontier:
+.res 8
+.extern dflow_free_Dom
+.extern fileno
+.extern bset_update
+.bss
+.align 8
+quad2copy:
+.res 8
+.extern dflow_LiveOut
+.extern lookup_external_id
+.extern hash2
+.extern analyze_type_name
+.data
+.align 8
+int_ty:
+.align 8
+.align 8
+.qword int_expr+0
+.align 8
+.zero 8
+# ==== start of definition of function `add_copy_node' ====
+.text
+add_copy_node:
+addsp 12;        
+# param:`nid', offset:-20
+# param:`c', offset:-24
+# var: p, offset: 8
+ldiqw 16;
+pop;
+ldiqw copies_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw copies_of_nid;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw copies_of_nid;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern is_unsigned_int
+.extern memmove
+.extern replace_extension
+.extern analyze_struct_declarator
+.extern get_type_spec
+.bss
+.align 8
+addressed_variables:
+.res 8
+# ==== start of definition of function `lookup_vn' ====
+.text
+lookup_vn:
+addsp 12;        
+# param:`op', offset:-20
+# param:`cat', offset:-24
+# param:`vn1', offset:-28
+# param:`vn2', offset:-32
+# param:`val', offset:-40
+# var: p, offset: 8
+ldiqw vn_table;
+ldbp -40;
+ldqw;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw vn_hash;
+call 24;
+pop;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L411:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L413;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -20;
+lddw;
+eqdw;
+jmpf @L420;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp -24;
+lddw;
+eqdw;
+jmpf @L420;
+ldidw 1;
+jmp @L421;
+@L420:
+ldidw 0;
+@L421:
+jmpf @L418;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp -28;
+lddw;
+eqdw;
+jmpf @L418;
+ldidw 1;
+jmp @L419;
+@L418:
+ldidw 0;
+@L419:
+jmpf @L416;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp -32;
+lddw;
+eqdw;
+jmpf @L416;
+ldidw 1;
+jmp @L417;
+@L416:
+ldidw 0;
+@L417:
+jmpf @L414;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp -40;
+ldqw;
+eqqw;
+jmpf @L414;
+ldidw 1;
+jmp @L415;
+@L414:
+ldidw 0;
+@L415:
+jmpf @L422;
+ldbp 8;
+ldqw;
+ret;
+@L422:
+@L412:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L411;
+@L413:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `fold_quad' ====
+.text
+fold_quad:
+addsp 68;        
+# param:`i', offset:-20
+# var: q, offset: 8
+# var: cat, offset: 16
+# var: x, offset: 24
+# var: y, offset: 32
+# var: r, offset: 40
+# var: ux, offset: 48
+# var: uy, offset: 56
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T423;
+switch;
+@L425:
+@L426:
+@L427:
+@L428:
+@L429:
+@L430:
+@L431:
+@L432:
+@L433:
+@L434:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+neqdw;
+jmpt @L435;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+neqdw;
+jmpt @L435;
+ldidw 0;
+jmp @L436;
+@L435:
+ldidw 1;
+@L436:
+jmpf @L437;
+ldidw 0;
+dw2qw;
+ret;
+@L437:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw truncate_const;
+call 16;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw truncate_const;
+call 16;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldbp 48;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldbp 56;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T438;
+jmptab;
+@L440:
+ldbp 48;
+ldqw;
+ldbp 56;
+ldqw;
+addqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L439;
+@L441:
+ldbp 48;
+ldqw;
+ldbp 56;
+ldqw;
+subqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L439;
+@L442:
+ldbp 48;
+ldqw;
+ldbp 56;
+ldqw;
+mulqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L439;
+@L443:
+@L444:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L445;
+ldidw 0;
+dw2qw;
+ret;
+@L445:
+ldbp 16;
+lddw;
+ldiqw is_signed_int;
+call 4;
+pop;
+jmpf @L446;
+ldbp 32;
+ldqw;
+ldidw 1;
+negdw;
+dw2qw;
+eqqw;
+jmpf @L447;
+ldbp 24;
+ldqw;
+ldiqw 1;
+ldidw 63;
+sllqw;
+eqqw;
+jmpf @L447;
+ldidw 1;
+jmp @L448;
+@L447:
+ldidw 0;
+@L448:
+jmpf @L449;
+ldidw 0;
+dw2qw;
+ret;
+@L449:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L450;
+ldbp 24;
+ldqw;
+ldbp 32;
+ldqw;
+sdivqw;
+jmp @L451;
+@L450:
+ldbp 24;
+ldqw;
+ldbp 32;
+ldqw;
+smodqw;
+@L451:
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L452;
+@L446:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldiqw 8;
+ultqw;
+jmpf @L453;
+ldbp 48;
+ldqw;
+ldiqw 1;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldidw 8;
+muldw;
+sllqw;
+ldidw 1;
+dw2qw;
+subqw;
+andqw;
+ldbp 48;
+stqw;
+pop;
+pop;
+ldbp 56;
+ldqw;
+ldiqw 1;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldidw 8;
+muldw;
+sllqw;
+ldidw 1;
+dw2qw;
+subqw;
+andqw;
+ldbp 56;
+stqw;
+pop;
+pop;
+@L453:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L454;
+ldbp 48;
+ldqw;
+ldbp 56;
+ldqw;
+udivqw;
+jmp @L455;
+@L454:
+ldbp 48;
+ldqw;
+ldbp 56;
+ldqw;
+umodqw;
+@L455:
+ldbp 40;
+stqw;
+pop;
+pop;
+@L452:
+jmp @L439;
+@L456:
+@L457:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+sltqw;
+jmpt @L458;
+ldbp 32;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldidw 8;
+muldw;
+udw2qw;
+ugetqw;
+jmpt @L458;
+ldidw 0;
+jmp @L459;
+@L458:
+ldidw 1;
+@L459:
+jmpf @L460;
+ldidw 0;
+dw2qw;
+ret;
+@L460:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 5;
+eqdw;
+jmpf @L461;
+ldbp 48;
+ldqw;
+ldbp 32;
+ldqw;
+pop;
+sllqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L462;
+@L461:
+ldbp 16;
+lddw;
+ldiqw is_signed_int;
+call 4;
+pop;
+jmpf @L463;
+ldbp 24;
+ldqw;
+ldbp 32;
+ldqw;
+pop;
+sraqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L464;
+@L463:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldiqw 8;
+ultqw;
+jmpf @L465;
+ldbp 48;
+ldqw;
+ldiqw 1;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldidw 8;
+muldw;
+sllqw;
+ldidw 1;
+dw2qw;
+subqw;
+andqw;
+ldbp 32;
+ldqw;
+pop;
+srlqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L466;
+@L465:
+ldbp 48;
+ldqw;
+ldbp 32;
+ldqw;
+pop;
+srlqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+@L466:
+@L464:
+@L462:
+jmp @L439;
+@L467:
+ldbp 24;
+ldqw;
+ldbp 32;
+ldqw;
+andqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L439;
+@L468:
+ldbp 24;
+ldqw;
+ldbp 32;
+ldqw;
+orqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L439;
+@L469:
+ldbp 24;
+ldqw;
+ldbp 32;
+ldqw;
+xorqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L439;
+@L470:
+@L471:
+ldidw 0;
+notdw;
+jmpf @L474;
+ldidw 168;
+ldiqw @S3;
+ldiqw @S4;
+ldiqw @S5;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L474:
+@L472:
+ldidw 0;
+jmpf @L473;
+jmp @L471;
+@L473:
+ldidw 0;
+dw2qw;
+ret;
+@L439:
+.data
+.align 8
+@T438:
+.dword 0
+.dword 10
+.qword @L470
+.qword @L440
+.qword @L441
+.qword @L442
+.qword @L443
+.qword @L444
+.qword @L456
+.qword @L457
+.qword @L467
+.qword @L468
+.qword @L469
+.text
+ldidw 27;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 40;
+ldqw;
+ldiqw truncate_const;
+call 16;
+ldiqw new_const_addr;
+call 8;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stdw;
+pop;
+ldidw 1;
+dw2qw;
+ret;
+@L475:
+@L476:
+@L477:
+@L478:
+@L479:
+@L480:
+# var: flags, offset: 64
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+neqdw;
+jmpt @L481;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+neqdw;
+jmpt @L481;
+ldidw 0;
+jmp @L482;
+@L481:
+ldidw 1;
+@L482:
+jmpf @L483;
+ldidw 0;
+dw2qw;
+ret;
+@L483:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 64;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+notqw;
+jmpf @L484;
+ldbp 64;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L485;
+ldbp 24;
+ldqw;
+pop;
+dw2qw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+pop;
+dw2qw;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L486;
+@L485:
+ldbp 24;
+ldqw;
+pop;
+udw2qw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+pop;
+udw2qw;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L486:
+@L484:
+ldbp 24;
+ldqw;
+ldbp 48;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldbp 56;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T487;
+jmptab;
+@L489:
+ldbp 24;
+ldqw;
+ldbp 32;
+ldqw;
+eqqw;
+dw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L488;
+@L490:
+ldbp 24;
+ldqw;
+ldbp 32;
+ldqw;
+neqqw;
+dw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L488;
+@L491:
+ldbp 64;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L492;
+ldbp 24;
+ldqw;
+ldbp 32;
+ldqw;
+sltqw;
+jmp @L493;
+@L492:
+ldbp 48;
+ldqw;
+ldbp 56;
+ldqw;
+ultqw;
+@L493:
+dw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L488;
+@L494:
+ldbp 64;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L495;
+ldbp 24;
+ldqw;
+ldbp 32;
+ldqw;
+sletqw;
+jmp @L496;
+@L495:
+ldbp 48;
+ldqw;
+ldbp 56;
+ldqw;
+uletqw;
+@L496:
+dw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L488;
+@L497:
+ldbp 64;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L498;
+ldbp 24;
+ldqw;
+ldbp 32;
+ldqw;
+sgtqw;
+jmp @L499;
+@L498:
+ldbp 48;
+ldqw;
+ldbp 56;
+ldqw;
+ugtqw;
+@L499:
+dw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L488;
+@L500:
+ldbp 64;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L501;
+ldbp 24;
+ldqw;
+ldbp 32;
+ldqw;
+sgetqw;
+jmp @L502;
+@L501:
+ldbp 48;
+ldqw;
+ldbp 56;
+ldqw;
+ugetqw;
+@L502:
+dw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L488;
+@L503:
+@L504:
+ldidw 0;
+notdw;
+jmpf @L507;
+ldidw 200;
+ldiqw @S6;
+ldiqw @S7;
+ldiqw @S8;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L507:
+@L505:
+ldidw 0;
+jmpf @L506;
+jmp @L504;
+@L506:
+ldidw 0;
+dw2qw;
+ret;
+@L488:
+.data
+.align 8
+@T487:
+.dword 10
+.dword 6
+.qword @L503
+.qword @L489
+.qword @L490
+.qword @L491
+.qword @L494
+.qword @L497
+.qword @L500
+.text
+ldidw 27;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw int_ty;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldiqw new_const_addr;
+call 8;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stdw;
+pop;
+ldidw 1;
+dw2qw;
+ret;
+@L508:
+@L509:
+@L510:
+@L511:
+@L512:
+@L513:
+@L514:
+@L515:
+@L516:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L517;
+ldidw 0;
+dw2qw;
+ret;
+@L517:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T518;
+jmptab;
+@L520:
+ldiqw 0;
+ldbp 24;
+ldqw;
+subqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L519;
+@L521:
+ldbp 24;
+ldqw;
+cmplqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L519;
+@L522:
+ldbp 24;
+ldqw;
+notqw;
+dw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldiqw int_ty;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L519;
+@L523:
+ldbp 24;
+ldqw;
+pop;
+dw2b;
+dw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L519;
+@L524:
+ldbp 24;
+ldqw;
+pop;
+dw2ub;
+udw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L519;
+@L525:
+ldbp 24;
+ldqw;
+pop;
+dw2w;
+dw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L519;
+@L526:
+ldbp 24;
+ldqw;
+pop;
+dw2uw;
+udw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L519;
+@L527:
+ldbp 24;
+ldqw;
+pop;
+dw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldiqw long_long_ty;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L519;
+@L528:
+ldbp 24;
+ldqw;
+pop;
+udw2qw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldiqw long_long_ty;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L519;
+@L529:
+@L530:
+ldidw 0;
+notdw;
+jmpf @L533;
+ldidw 225;
+ldiqw @S9;
+ldiqw @S10;
+ldiqw @S11;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L533:
+@L531:
+ldidw 0;
+jmpf @L532;
+jmp @L530;
+@L532:
+ldidw 0;
+dw2qw;
+ret;
+@L519:
+.data
+.align 8
+@T518:
+.dword 16
+.dword 9
+.qword @L529
+.qword @L520
+.qword @L521
+.qword @L522
+.qword @L523
+.qword @L524
+.qword @L525
+.qword @L526
+.qword @L527
+.qword @L528
+.text
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L534;
+ldiqw int_ty;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L534:
+ldidw 27;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 40;
+ldqw;
+ldiqw truncate_const;
+call 16;
+ldiqw new_const_addr;
+call 8;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+ldidw 1;
+dw2qw;
+ret;
+@L535:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L536;
+ldidw 0;
+dw2qw;
+ret;
+@L536:
+ldidw 32;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+notqw;
+jmpf @L537;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+@L537:
+ldidw 1;
+dw2qw;
+ret;
+@L538:
+ldidw 0;
+dw2qw;
+ret;
+@L424:
+.data
+.align 8
+@T423:
+.dword 27
+.dword 0
+.dword 1
+.dword 2
+.dword 3
+.dword 4
+.dword 5
+.dword 6
+.dword 7
+.dword 8
+.dword 9
+.dword 10
+.dword 11
+.dword 12
+.dword 13
+.dword 14
+.dword 15
+.dword 16
+.dword 17
+.dword 18
+.dword 19
+.dword 20
+.dword 21
+.dword 22
+.dword 23
+.dword 24
+.dword 37
+.qword @L538
+.qword @L425
+.qword @L426
+.qword @L427
+.qword @L428
+.qword @L429
+.qword @L430
+.qword @L431
+.qword @L432
+.qword @L433
+.qword @L434
+.qword @L475
+.qword @L476
+.qword @L477
+.qword @L478
+.qword @L479
+.qword @L480
+.qword @L508
+.qword @L509
+.qword @L510
+.qword @L511
+.qword @L512
+.qword @L513
+.qword @L514
+.qword @L515
+.qword @L516
+.qword @L535
+.text
+ldidw 0;
+ret;
+.extern cfg_nodes_counter
+.extern analyze_function_definition
+.extern strdup
+.extern bset_new
+.bss
+.align 8
+dce_live:
+.res 8
+.extern arena_new
+.extern analyze_init_declarator
+.extern cfg_function_to_print
+.extern strncmp
+.extern arena_set_nom_siz
+.extern bset_union_diff
+.extern analyze_multiplicative_expression
+.extern analyze_additive_expression
+.extern stat_number_of_c_tokens
+.extern strncpy
+.bss
+.align 8
+ssa_arena:
+.res 8
+.extern bset_clear
+.extern decl_save_pch
+.extern bset_card
+# ==== start of definition of function `compute_dominance' ====
+.text
+compute_dominance:
+addsp 44;        
+# param:`fn', offset:-20
+# var: b, offset: 4
+# var: entry_bb, offset: 8
+# var: exit_bb, offset: 12
+# var: domcard, offset: 16
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldiqw dflow_Dom;
+call 4;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+udw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L539:
+ldbp 4;
+lddw;
+ldbp 12;
+lddw;
+uletdw;
+jmpf @L541;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+ldqw;
+ldiqw bset_card;
+call 8;
+pop;
+ldbp 16;
+ldqw;
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L540:
+incldw 4;
+jmp @L539;
+@L541:
+ldbp 8;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+stdw;
+pop;
+@L542:
+ldbp 4;
+lddw;
+ldbp 12;
+lddw;
+uletdw;
+jmpf @L544;
+# var: d, offset: 24
+# var: best, offset: 28
+ldiqw reachable;
+ldqw;
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+subdw;
+udw2qw;
+ldxb 1;
+notdw;
+jmpf @L545;
+jmp @L543;
+@L545:
+ldidw 0;
+ldbp 28;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+ldqw;
+ldiqw bset_iterate;
+call 8;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L546:
+ldbp 24;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L548;
+ldbp 24;
+lddw;
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+subdw;
+eqdw;
+jmpf @L549;
+jmp @L547;
+@L549:
+ldbp 28;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L550;
+ldbp 16;
+ldqw;
+ldbp 24;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+ldqw;
+ldbp 28;
+lddw;
+ldbp 8;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ugtdw;
+jmpt @L550;
+ldidw 0;
+jmp @L551;
+@L550:
+ldidw 1;
+@L551:
+jmpf @L552;
+ldbp 24;
+lddw;
+ldbp 8;
+lddw;
+adddw;
+ldbp 28;
+stdw;
+pop;
+@L552:
+@L547:
+ldidw 0;
+dw2qw;
+ldiqw bset_iterate;
+call 8;
+pop;
+ldbp 24;
+stdw;
+pop;
+jmp @L546;
+@L548:
+@L553:
+ldbp 28;
+lddw;
+ldidw 0;
+neqdw;
+notdw;
+jmpf @L556;
+ldidw 1002;
+ldiqw @S12;
+ldiqw @S13;
+ldiqw @S14;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L556:
+@L554:
+ldidw 0;
+jmpf @L555;
+jmp @L553;
+@L555:
+ldbp 28;
+lddw;
+ldiqw idom;
+ldqw;
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw dom_children;
+ldqw;
+ldbp 28;
+lddw;
+ldbp 8;
+lddw;
+subdw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+ldiqw add_block_node;
+call 12;
+pop;
+pop;
+@L543:
+incldw 4;
+jmp @L542;
+@L544:
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L557:
+ldbp 4;
+lddw;
+ldbp 12;
+lddw;
+uletdw;
+jmpf @L559;
+# var: j, offset: 24
+# var: npreds, offset: 28
+ldiqw reachable;
+ldqw;
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+subdw;
+udw2qw;
+ldxb 1;
+notdw;
+jmpf @L560;
+jmp @L558;
+@L560:
+ldidw 0;
+ldbp 28;
+stdw;
+pop;
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L561:
+ldbp 24;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ultdw;
+jmpf @L563;
+ldiqw reachable;
+ldqw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 8;
+lddw;
+subdw;
+udw2qw;
+ldxb 1;
+jmpf @L564;
+incldw 28;
+@L564:
+@L562:
+incldw 24;
+jmp @L561;
+@L563:
+ldbp 28;
+lddw;
+ldidw 2;
+ultdw;
+jmpf @L565;
+jmp @L558;
+@L565:
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L566:
+ldbp 24;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ultdw;
+jmpf @L568;
+# var: runner, offset: 32
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+ldiqw reachable;
+ldqw;
+ldbp 32;
+lddw;
+ldbp 8;
+lddw;
+subdw;
+udw2qw;
+ldxb 1;
+notdw;
+jmpf @L569;
+jmp @L567;
+@L569:
+@L570:
+ldbp 32;
+lddw;
+ldiqw idom;
+ldqw;
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+neqdw;
+jmpf @L571;
+# var: df, offset: 40
+ldiqw dom_frontier;
+ldqw;
+ldbp 32;
+lddw;
+ldbp 8;
+lddw;
+subdw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L572;
+ldbp 40;
+ldqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 4;
+lddw;
+neqdw;
+jmpt @L572;
+ldidw 0;
+jmp @L573;
+@L572:
+ldidw 1;
+@L573:
+jmpf @L574;
+ldbp 4;
+lddw;
+ldbp 40;
+ldqw;
+ldiqw add_block_node;
+call 12;
+pop;
+pop;
+@L574:
+ldiqw idom;
+ldqw;
+ldbp 32;
+lddw;
+ldbp 8;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp 32;
+stdw;
+pop;
+jmp @L570;
+@L571:
+@L567:
+incldw 24;
+jmp @L566;
+@L568:
+@L558:
+incldw 4;
+jmp @L557;
+@L559:
+ldbp -20;
+lddw;
+ldiqw dflow_free_Dom;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern analyze_assignment_expression
+.extern ic_instructions
+.extern new_extern_id_node
+.extern decl_load_pch
+.extern bset_union
+.extern analyze_translation_unit
+.extern strnlen
+.extern bset_new_in
+.extern analyze_enumerator
+.extern targeting_arch64
+.extern set_attributes
+.extern is_typedef_name
+# ==== start of definition of function `operand_vn' ====
+.text
+operand_vn:
+addsp 12;        
+# param:`a', offset:-20
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T575;
+jmptab;
+@L577:
+# var: p, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+ldidw 0;
+ldidw 0;
+ldidw 39;
+ldiqw lookup_vn;
+call 24;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L578;
+ldidw 0;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+ldidw 0;
+ldidw 0;
+ldidw 39;
+ldiqw install_vn;
+call 28;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L578:
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+udw2qw;
+ret;
+@L579:
+@L580:
+ldbp -20;
+lddw;
+ldiqw is_tracked;
+call 4;
+pop;
+jmpf @L581;
+ldiqw vn_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ret;
+@L581:
+@L582:
+ldiqw vn_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+udw2qw;
+ret;
+@L576:
+.data
+.align 8
+@T575:
+.dword 0
+.dword 4
+.qword @L582
+.qword @L577
+.qword @L582
+.qword @L580
+.qword @L579
+.text
+ldidw 0;
+ret;
+.extern dflow_exit_function
+.extern arena_reset
+.extern fread
+.extern strrchr
+.extern bset_next
+.extern disable_warnings
+.extern bset_diff
+.extern install_macro
+.extern bset_inters
+.extern edge_add
+.extern ferror
+.bss
+.align 8
+vn_arena:
+.res 8
+.extern random
+.extern ic_instructions_counter
+.extern free
+.extern malloc
+.extern get_external_declarations
+.extern new_decl_list_node
+.extern compute_liveness_and_next_use
+.extern srandom
+.bss
+.align 4
+vn_counter:
+.res 4
+.extern lookup_struct_descriptor
+.extern new_exec_node
+.extern get_alignment
+.extern fgetc
+# ==== start of definition of function `collect_copies' ====
+.text
+collect_copies:
+addsp 20;        
+# param:`fn', offset:-20
+# var: i, offset: 4
+# var: first, offset: 8
+# var: last, offset: 12
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+ldidw 0;
+ldiqw ncopies;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L583:
+ldbp 4;
+lddw;
+ldbp 12;
+lddw;
+uletdw;
+jmpf @L585;
+# var: tar, offset: 16
+# var: arg1, offset: 20
+ldidw 1;
+negdw;
+ldiqw quad2copy;
+ldqw;
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_copy_candidate;
+call 4;
+pop;
+notdw;
+jmpf @L586;
+jmp @L584;
+@L586:
+ldiqw ncopies;
+lddw;
+ldiqw copies_max;
+lddw;
+ugetdw;
+jmpf @L587;
+ldiqw copies_max;
+lddw;
+ldidw 2;
+muldw;
+ldiqw copies_max;
+stdw;
+pop;
+ldiqw copies_max;
+lddw;
+udw2qw;
+ldiqw 16;
+mulqw;
+ldiqw copies;
+ldqw;
+ldiqw realloc;
+call 16;
+ldiqw copies;
+stqw;
+pop;
+pop;
+@L587:
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 20;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw copies;
+ldqw;
+ldiqw ncopies;
+lddw;
+udw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 20;
+lddw;
+ldiqw copies;
+ldqw;
+ldiqw ncopies;
+lddw;
+udw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L588;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw copies;
+ldqw;
+ldiqw ncopies;
+lddw;
+udw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L589;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw copies;
+ldqw;
+ldiqw ncopies;
+lddw;
+udw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw truncate_const;
+call 16;
+ldiqw copies;
+ldqw;
+ldiqw ncopies;
+lddw;
+udw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L589:
+jmp @L590;
+@L588:
+ldiqw ncopies;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw add_copy_node;
+call 8;
+pop;
+pop;
+@L590:
+ldiqw ncopies;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw add_copy_node;
+call 8;
+pop;
+pop;
+ldiqw ncopies;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw quad2copy;
+ldqw;
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L584:
+incldw 4;
+jmp @L583;
+@L585:
+ldidw 0;
+ret;
+.data
+@S0:
+.byte 103
+.byte 108
+.byte 111
+.byte 98
+.byte 97
+.byte 108
+.byte 95
+.byte 118
+.byte 97
+.byte 108
+.byte 117
+.byte 101
+.byte 95
+.byte 110
+.byte 117
+.byte 109
+.byte 98
+.byte 101
+.byte 114
+.byte 105
+.byte 110
+.byte 103
+.byte 0
+@S1:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 111
+.byte 112
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S2:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S3:
+.byte 102
+.byte 111
+.byte 108
+.byte 100
+.byte 95
+.byte 113
+.byte 117
+.byte 97
+.byte 100
+.byte 0
+@S4:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 111
+.byte 112
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S5:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S6:
+.byte 102
+.byte 111
+.byte 108
+.byte 100
+.byte 95
+.byte 113
+.byte 117
+.byte 97
+.byte 100
+.byte 0
+@S7:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 111
+.byte 112
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S8:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S9:
+.byte 102
+.byte 111
+.byte 108
+.byte 100
+.byte 95
+.byte 113
+.byte 117
+.byte 97
+.byte 100
+.byte 0
+@S10:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 111
+.byte 112
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S11:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S12:
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 117
+.byte 116
+.byte 101
+.byte 95
+.byte 100
+.byte 111
+.byte 109
+.byte 105
+.byte 110
+.byte 97
+.byte 110
+.byte 99
+.byte 101
+.byte 0
+@S13:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 111
+.byte 112
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S14:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
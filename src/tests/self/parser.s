@@ -0,0 +1,12917 @@
+# ==== start of definition of function `relational_expression' ====
+.text
+relational_expression:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw shift_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L1:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 20;
+sgetdw;
+jmpf @L3;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 23;
+sletdw;
+jmpf @L3;
+ldidw 1;
+jmp @L4;
+@L3:
+ldidw 0;
+@L4:
+jmpf @L2;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw new_op_node;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw shift_expression;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_relational_equality_expression;
+call 8;
+pop;
+pop;
+jmp @L1;
+@L2:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern fgets
+.extern get_promoted_type
+.extern analyze_bitwise_operator
+# ==== start of definition of function `statement' ====
+.text
+statement:
+addsp 0;         
+# param:`in_loop', offset:-20
+# param:`in_switch', offset:-24
+@@statement_start:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw @T5;
+switch;
+@L7:
+ldiqw asm_statement;
+call 0;
+ret;
+@L8:
+ldiqw va_buitin_start_statement;
+call 0;
+ret;
+@L9:
+ldiqw static_assert_statement;
+call 0;
+pop;
+pop;
+jmp @@statement_start;
+@L10:
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldidw 1;
+ldiqw compound_statement;
+call 12;
+ret;
+@L11:
+@L12:
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw selection_statement;
+call 8;
+ret;
+@L13:
+@L14:
+@L15:
+ldbp -24;
+lddw;
+ldiqw iteration_statement;
+call 4;
+ret;
+@L16:
+@L17:
+@L18:
+@L19:
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw jump_statement;
+call 8;
+ret;
+@L20:
+@L21:
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw labeled_statement;
+call 8;
+ret;
+@L22:
+ldidw 2;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 31;
+eqdw;
+jmpf @L23;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw labeled_statement;
+call 8;
+ret;
+@L23:
+@L24:
+ldiqw expression_statement;
+call 0;
+ret;
+@L6:
+.data
+.align 8
+@T5:
+.dword 17
+.dword 4
+.dword 47
+.dword 48
+.dword 51
+.dword 52
+.dword 53
+.dword 57
+.dword 58
+.dword 59
+.dword 63
+.dword 69
+.dword 75
+.dword 76
+.dword 116
+.dword 117
+.dword 118
+.qword @L24
+.qword @L10
+.qword @L18
+.qword @L20
+.qword @L17
+.qword @L21
+.qword @L14
+.qword @L15
+.qword @L16
+.qword @L11
+.qword @L19
+.qword @L12
+.qword @L13
+.qword @L22
+.qword @L9
+.qword @L7
+.qword @L8
+.text
+ldidw 0;
+ret;
+.extern verbose_asm
+# ==== start of definition of function `in_first_storage_class_specifier' ====
+.text
+in_first_storage_class_specifier:
+addsp 0;         
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw @T25;
+switch;
+@L27:
+@L28:
+@L29:
+@L30:
+@L31:
+ldidw 1;
+dw2qw;
+ret;
+@L32:
+ldidw 0;
+dw2qw;
+ret;
+@L26:
+.data
+.align 8
+@T25:
+.dword 6
+.dword 46
+.dword 56
+.dword 62
+.dword 67
+.dword 70
+.qword @L32
+.qword @L30
+.qword @L28
+.qword @L31
+.qword @L29
+.qword @L27
+.text
+ldidw 0;
+ret;
+# ==== start of definition of function `assignment_expression' ====
+.text
+assignment_expression:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw conditional_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 35;
+sgetdw;
+jmpf @L33;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 45;
+sletdw;
+jmpf @L33;
+ldidw 1;
+jmp @L34;
+@L33:
+ldidw 0;
+@L34:
+jmpf @L35;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw new_op_node;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw assignment_expression;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_assignment_expression;
+call 8;
+pop;
+pop;
+@L35:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern is_complete
+.extern cfg_outpath
+.extern analyze_unary_expression
+# ==== start of definition of function `print_vertex' ====
+.text
+print_vertex:
+addsp 0;         
+# param:`vertex', offset:-20
+# param:`label', offset:-28
+ldbp -28;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L36;
+ldbp -28;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw @S0;
+ldiqw dotfile;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+jmp @L37;
+@L36:
+ldbp -20;
+lddw;
+ldiqw @S1;
+ldiqw dotfile;
+ldqw;
+ldiqw fprintf;
+call 20;
+pop;
+pop;
+@L37:
+ldidw 0;
+ret;
+.extern target_arch
+.extern emit_warning
+.extern arena_destroy
+# ==== start of definition of function `install_new_tag' ====
+.text
+install_new_tag:
+addsp 12;        
+# param:`n', offset:-24
+# var: s, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldiqw parser_str_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw install_tag;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `inclusive_OR_expression' ====
+.text
+inclusive_OR_expression:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw exclusive_OR_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L38:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 27;
+eqdw;
+jmpf @L39;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw new_op_node;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw exclusive_OR_expression;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_bitwise_operator;
+call 8;
+pop;
+pop;
+jmp @L38;
+@L39:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `new_extern_decl_node' ====
+.text
+new_extern_decl_node:
+addsp 12;        
+# var: n, offset: 8
+ldiqw 24;
+pop;
+ldiqw parser_node_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw stat_number_of_ast_nodes;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern is_struct_union_enum
+# ==== start of definition of function `equality_expression' ====
+.text
+equality_expression:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw relational_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L40:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 24;
+eqdw;
+jmpt @L42;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 25;
+eqdw;
+jmpt @L42;
+ldidw 0;
+jmp @L43;
+@L42:
+ldidw 1;
+@L43:
+jmpf @L41;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw new_op_node;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw relational_expression;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_relational_equality_expression;
+call 8;
+pop;
+pop;
+jmp @L40;
+@L41:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern get_sizeof
+.extern emit_error
+.extern get_curr_scope_id
+# ==== start of definition of function `new_stmt_node' ====
+.text
+new_stmt_node:
+addsp 12;        
+# param:`kind', offset:-20
+# var: n, offset: 8
+ldiqw new_exec_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 48;
+addqw;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern getenv
+.extern can_assign_to
+.extern atoi
+.extern exit
+# ==== start of definition of function `enumerator_list' ====
+.text
+enumerator_list:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw enumerator;
+call 0;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L44:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 34;
+eqdw;
+jmpf @L46;
+ldidw 2;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 5;
+neqdw;
+jmpf @L46;
+ldidw 1;
+jmp @L47;
+@L46:
+ldidw 0;
+@L47:
+jmpf @L45;
+ldidw 34;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw enumerator;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L44;
+@L45:
+ldiqw reset_enum_val;
+call 0;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `function_definition' ====
+.text
+function_definition:
+addsp 12;        
+# param:`decl_specs', offset:-24
+# param:`header', offset:-32
+# var: f, offset: 8
+ldiqw new_declaration_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw restore_scope;
+call 0;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_function_definition;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldidw 0;
+ldidw 0;
+ldiqw compound_statement;
+call 12;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw pop_scope;
+call 0;
+pop;
+pop;
+ldiqw resolve_gotos;
+call 0;
+pop;
+pop;
+ldiqw empty_label_table;
+call 0;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern stmt_done
+.extern stderr
+.bss
+.align 8
+void_ty:
+.res 16
+.extern opt_level
+.extern restore_scope
+# ==== start of definition of function `lookahead' ====
+.text
+lookahead:
+addsp 12;        
+# param:`i', offset:-20
+# var: p, offset: 8
+ldiqw curr_tok;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L48:
+ldbp -20;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+jmpf @L49;
+ldbp 8;
+ldqw;
+ldiqw next_token;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L48;
+@L49:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 8
+void_param:
+.res 16
+# ==== start of definition of function `new_op_node' ====
+.text
+new_op_node:
+addsp 12;        
+# param:`op', offset:-20
+# var: n, offset: 8
+ldiqw new_exec_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 48;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern tolower
+# ==== start of definition of function `match' ====
+.text
+match:
+addsp 12;        
+# param:`token', offset:-20
+ldiqw curr_tok;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -20;
+lddw;
+eqdw;
+jmpf @L50;
+# var: p, offset: 8
+ldiqw curr_tok;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw curr_tok;
+ldqw;
+ldiqw next_token;
+call 8;
+ldiqw curr_tok;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw curr_tok;
+ldqw;
+neqqw;
+jmpf @L53;
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldb;
+notdw;
+jmpf @L53;
+ldidw 1;
+jmp @L54;
+@L53:
+ldidw 0;
+@L54:
+jmpf @L51;
+ldiqw keep_tokens;
+lddw;
+notdw;
+jmpf @L51;
+ldidw 1;
+jmp @L52;
+@L51:
+ldidw 0;
+@L52:
+jmpf @L55;
+ldbp 8;
+ldqw;
+ldiqw free_c_token;
+call 8;
+pop;
+pop;
+@L55:
+jmp @L56;
+@L50:
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw token_table;
+ldbp -20;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S2;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 44;
+pop;
+pop;
+@L56:
+ldidw 0;
+ret;
+# ==== start of definition of function `constant_expression' ====
+.text
+constant_expression:
+addsp 0;         
+ldiqw conditional_expression;
+call 0;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `declaration_list' ====
+.text
+declaration_list:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw new_decl_list_node;
+call 0;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldidw 0;
+dw2qw;
+ldiqw declaration;
+call 16;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L57:
+ldiqw in_first_declaration_specifiers;
+call 0;
+pop;
+jmpf @L58;
+ldiqw new_decl_list_node;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldidw 0;
+dw2qw;
+ldiqw declaration;
+call 16;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L57;
+@L58:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern rewind
+# ==== start of definition of function `additive_expression' ====
+.text
+additive_expression:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw multiplicative_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L59:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 12;
+eqdw;
+jmpt @L61;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 13;
+eqdw;
+jmpt @L61;
+ldidw 0;
+jmp @L62;
+@L61:
+ldidw 1;
+@L62:
+jmpf @L60;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw new_op_node;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw multiplicative_expression;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_additive_expression;
+call 8;
+pop;
+pop;
+jmp @L59;
+@L60:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 4
+vertex_counter:
+.res 4
+.extern get_type_node
+.extern analyze_logical_operator
+# ==== start of definition of function `init_declarator' ====
+.text
+init_declarator:
+addsp 12;        
+# param:`decl_specs', offset:-24
+# param:`first_declarator', offset:-32
+# var: n, offset: 8
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L63;
+ldiqw concrete_declarator;
+call 0;
+jmp @L64;
+@L63:
+ldbp -32;
+ldqw;
+@L64:
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw analyze_declarator;
+call 20;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 35;
+eqdw;
+jmpf @L65;
+ldidw 35;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw initializer;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+@L65:
+ldidw 0;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw analyze_init_declarator;
+call 20;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern realloc
+# ==== start of definition of function `specifier_qualifier_list' ====
+.text
+specifier_qualifier_list:
+addsp 12;        
+# param:`type_spec_seen', offset:-20
+# var: n, offset: 8
+ldiqw in_first_type_specifier;
+call 0;
+pop;
+jmpf @L66;
+ldiqw type_specifier;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp -20;
+stdw;
+pop;
+jmp @L67;
+@L66:
+ldiqw in_first_type_qualifier;
+call 0;
+pop;
+jmpf @L68;
+ldiqw type_qualifier;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L69;
+@L68:
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw @S3;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L69:
+@L67:
+ldiqw in_first_specifier_qualifier_list;
+call 0;
+pop;
+jmpf @L70;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 76;
+neqdw;
+jmpt @L72;
+ldbp -20;
+lddw;
+notdw;
+jmpt @L72;
+ldidw 0;
+jmp @L73;
+@L72:
+ldidw 1;
+@L73:
+jmpf @L70;
+ldidw 1;
+jmp @L71;
+@L70:
+ldidw 0;
+@L71:
+jmpf @L74;
+ldbp -20;
+lddw;
+ldiqw specifier_qualifier_list;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+@L74:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `iteration_statement' ====
+.text
+iteration_statement:
+addsp 12;        
+# param:`in_switch', offset:-20
+# var: n, offset: 8
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw @T75;
+switch;
+@L77:
+ldidw 1;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 75;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 2;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 3;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldidw 1;
+ldiqw statement;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L76;
+@L78:
+ldidw 2;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 53;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldidw 1;
+ldiqw statement;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 75;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 2;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 3;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 32;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L76;
+@L79:
+ldidw 3;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 57;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 2;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 32;
+neqdw;
+jmpf @L80;
+ldiqw expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L80:
+ldidw 32;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 32;
+neqdw;
+jmpf @L81;
+ldiqw expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L81:
+ldidw 32;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 3;
+neqdw;
+jmpf @L82;
+ldiqw expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L82:
+ldidw 3;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldidw 1;
+ldiqw statement;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 3;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L76;
+@L76:
+.data
+.align 8
+@T75:
+.dword 4
+.dword 53
+.dword 57
+.dword 75
+.qword @L76
+.qword @L78
+.qword @L79
+.qword @L77
+.text
+ldbp 8;
+ldqw;
+ldiqw analyze_iteration_statement;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `next_token' ====
+.text
+next_token:
+addsp 0;         
+# param:`p', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 91;
+eqdw;
+jmpf @L83;
+ldbp -24;
+ldqw;
+ret;
+@L83:
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L84;
+ldiqw get_c_token;
+call 0;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+@L84:
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern lookup_ordinary_id
+.extern snprintf
+# ==== start of definition of function `typedef_name' ====
+.text
+typedef_name:
+addsp 12;        
+# var: n, offset: 8
+ldiqw new_type_exp_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 92;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 76;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern strpbrk
+.extern pop_struct_descriptor
+# ==== start of definition of function `parameter_list' ====
+.text
+parameter_list:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw new_decl_list_node;
+call 0;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw parameter_declaration;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L85:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 34;
+eqdw;
+jmpf @L87;
+ldidw 2;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 33;
+neqdw;
+jmpf @L87;
+ldidw 1;
+jmp @L88;
+@L87:
+ldidw 0;
+@L88:
+jmpf @L86;
+ldidw 34;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw new_decl_list_node;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw parameter_declaration;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L85;
+@L86:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern fseek
+.extern islower
+.extern push_struct_descriptor
+# ==== start of definition of function `initializer' ====
+.text
+initializer:
+addsp 12;        
+# var: n, offset: 8
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 4;
+eqdw;
+jmpf @L89;
+ldidw 4;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 114;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw initializer_list;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 34;
+eqdw;
+jmpf @L90;
+ldidw 34;
+ldiqw match;
+call 4;
+pop;
+pop;
+@L90:
+ldidw 5;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L91;
+@L89:
+ldiqw assignment_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L91:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern sscanf
+.extern fputc
+.extern stmt_init
+# ==== start of definition of function `print_edge' ====
+.text
+print_edge:
+addsp 0;         
+# param:`src_vertex', offset:-20
+# param:`dst_vertex', offset:-24
+# param:`label', offset:-32
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L92;
+ldbp -32;
+ldqw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw @S4;
+ldiqw dotfile;
+ldqw;
+ldiqw fprintf;
+call 32;
+pop;
+pop;
+jmp @L93;
+@L92:
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw @S5;
+ldiqw dotfile;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+@L93:
+ldidw 0;
+ret;
+# ==== start of definition of function `enum_specifier' ====
+.text
+enum_specifier:
+addsp 28;        
+# var: n, offset: 8
+ldiqw new_type_exp_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 55;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 76;
+eqdw;
+jmpf @L94;
+# var: cur, offset: 16
+# var: all, offset: 24
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_tag;
+call 12;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_tag;
+call 12;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L95;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L96;
+ldidw 2;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 32;
+eqdw;
+jmpt @L98;
+ldidw 2;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 4;
+eqdw;
+jmpt @L98;
+ldidw 0;
+jmp @L99;
+@L98:
+ldidw 1;
+@L99:
+jmpf @L96;
+ldidw 1;
+jmp @L97;
+@L96:
+ldidw 0;
+@L97:
+jmpf @L100;
+ldbp 8;
+ldqw;
+ldiqw install_new_tag;
+call 8;
+pop;
+pop;
+jmp @L101;
+@L100:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+neqdw;
+jmpf @L102;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S6;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L102:
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L101:
+jmp @L103;
+@L95:
+ldbp 8;
+ldqw;
+ldiqw install_new_tag;
+call 8;
+pop;
+pop;
+@L103:
+ldidw 76;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 4;
+eqdw;
+jmpf @L104;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L105;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L105;
+ldidw 1;
+jmp @L106;
+@L105:
+ldidw 0;
+@L106:
+jmpf @L107;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S7;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L107:
+ldidw 4;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw enumerator_list;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 34;
+eqdw;
+jmpf @L108;
+ldidw 34;
+ldiqw match;
+call 4;
+pop;
+pop;
+@L108:
+ldidw 5;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L109;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L109:
+@L104:
+jmp @L110;
+@L94:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 4;
+eqdw;
+jmpf @L111;
+ldiqw 12;
+pop;
+ldiqw parser_str_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw @S8;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+ldidw 4;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw enumerator_list;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 34;
+eqdw;
+jmpf @L112;
+ldidw 34;
+ldiqw match;
+call 4;
+pop;
+pop;
+@L112:
+ldidw 5;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L113;
+@L111:
+ldiqw @S9;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L113:
+@L110:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `labeled_statement' ====
+.text
+labeled_statement:
+addsp 12;        
+# param:`in_loop', offset:-20
+# param:`in_switch', offset:-24
+# var: n, offset: 8
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw @T114;
+switch;
+@L116:
+ldidw 12;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 76;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 31;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw statement;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L115;
+@L117:
+ldidw 10;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 48;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw constant_expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 31;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw statement;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L115;
+@L118:
+ldidw 11;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 52;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 31;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw statement;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L115;
+@L115:
+.data
+.align 8
+@T114:
+.dword 4
+.dword 48
+.dword 52
+.dword 76
+.qword @L115
+.qword @L117
+.qword @L118
+.qword @L116
+.text
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw analyze_labeled_statement;
+call 12;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern vsscanf
+# ==== start of definition of function `in_first_parenthesized_type_name' ====
+.text
+in_first_parenthesized_type_name:
+addsp 12;        
+# var: res, offset: 4
+# var: temp, offset: 8
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 2;
+neqdw;
+jmpf @L119;
+ldidw 0;
+dw2qw;
+ret;
+@L119:
+ldiqw curr_tok;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw curr_tok;
+ldqw;
+ldiqw next_token;
+call 8;
+ldiqw curr_tok;
+stqw;
+pop;
+pop;
+ldiqw in_first_specifier_qualifier_list;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw curr_tok;
+stqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `struct_declaration' ====
+.text
+struct_declaration:
+addsp 12;        
+# var: n, offset: 8
+ldiqw new_declaration_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw specifier_qualifier_list;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw analyze_decl_specs;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw struct_declarator_list;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 32;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern analyze_selection_statement
+.extern fwrite
+.extern is_pointer
+# ==== start of definition of function `enumerator' ====
+.text
+enumerator:
+addsp 12;        
+# var: n, offset: 8
+ldiqw enumeration_constant;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 35;
+eqdw;
+jmpf @L120;
+ldidw 35;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw constant_expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+@L120:
+ldbp 8;
+ldqw;
+ldiqw analyze_enumerator;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern colored_diagnostics
+# ==== start of definition of function `declarator' ====
+.text
+declarator:
+addsp 28;        
+# param:`dc', offset:-20
+# var: n, offset: 8
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 11;
+eqdw;
+jmpf @L121;
+# var: p, offset: 16
+# var: temp, offset: 24
+ldiqw pointer;
+call 0;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldiqw direct_declarator;
+call 4;
+ldbp 24;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L122;
+@L123:
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L124;
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L123;
+@L124:
+ldbp 16;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L125;
+@L122:
+ldbp 16;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L125:
+jmp @L126;
+@L121:
+ldbp -20;
+lddw;
+ldiqw direct_declarator;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L126:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern read_stream
+.extern strspn
+.extern ispunct
+.extern reset_enum_val
+.extern strtoll
+.extern analyze_relational_equality_expression
+.bss
+.align 4
+keep_tokens:
+.res 4
+.extern get_sto_class_spec
+# ==== start of definition of function `compound_statement' ====
+.text
+compound_statement:
+addsp 12;        
+# param:`new_scope', offset:-20
+# param:`in_loop', offset:-24
+# param:`in_switch', offset:-28
+# var: n, offset: 8
+ldidw 8;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 4;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw in_first_declaration_specifiers;
+call 0;
+pop;
+jmpf @L127;
+ldbp -20;
+lddw;
+jmpf @L128;
+ldiqw push_scope;
+call 0;
+pop;
+pop;
+@L128:
+ldiqw declaration_list;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw get_curr_scope_id;
+call 0;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+@L127:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 5;
+neqdw;
+jmpf @L129;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldiqw statement_list;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L129:
+ldidw 5;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp -20;
+lddw;
+jmpf @L130;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L130;
+ldidw 1;
+jmp @L131;
+@L130:
+ldidw 0;
+@L131:
+jmpf @L132;
+ldiqw pop_scope;
+call 0;
+pop;
+pop;
+@L132:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `external_declaration' ====
+.text
+external_declaration:
+addsp 28;        
+# var: e, offset: 8
+# var: p, offset: 16
+# var: q, offset: 24
+ldiqw new_extern_decl_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw declaration_specifiers;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw analyze_decl_specs;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 32;
+neqdw;
+jmpf @L133;
+ldiqw concrete_declarator;
+call 0;
+jmp @L134;
+@L133:
+ldidw 0;
+dw2qw;
+@L134:
+ldbp 24;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 4;
+eqdw;
+jmpf @L135;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 24;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw function_definition;
+call 16;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L136;
+@L135:
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 24;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw declaration;
+call 16;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L136:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `print_TypeExp_node' ====
+.text
+print_TypeExp_node:
+addsp 128;       
+# param:`n', offset:-24
+# var: buf, offset: 4
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T137;
+switch;
+@L139:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S10;
+ldbp 4;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+jmp @L138;
+@L140:
+ldiqw @S11;
+ldbp 4;
+ldiqw sprintf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L141;
+ldbp 4;
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw @S12;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldiqw vertex_counter;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw print_TypeExp_node;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L141:
+jmp @L138;
+@L142:
+ldiqw @S13;
+ldbp 4;
+ldiqw sprintf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L143;
+ldbp 4;
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw @S14;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldiqw vertex_counter;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L143:
+jmp @L138;
+@L144:
+ldiqw @S15;
+ldbp 4;
+ldiqw sprintf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L145;
+ldbp 4;
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw @S16;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldiqw vertex_counter;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw print_DeclList;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L145:
+jmp @L138;
+@L146:
+ldiqw token_table;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S17;
+ldbp 4;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+jmp @L138;
+@L138:
+.data
+.align 8
+@T137:
+.dword 5
+.dword 11
+.dword 76
+.dword 97
+.dword 98
+.qword @L146
+.qword @L140
+.qword @L139
+.qword @L142
+.qword @L144
+.text
+ldbp 4;
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `enumeration_constant' ====
+.text
+enumeration_constant:
+addsp 12;        
+# var: n, offset: 8
+ldiqw new_type_exp_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 113;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 76;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern analyze_jump_statement
+.extern fclose
+# ==== start of definition of function `multiplicative_expression' ====
+.text
+multiplicative_expression:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw cast_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L147:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 11;
+eqdw;
+jmpt @L151;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 16;
+eqdw;
+jmpt @L151;
+ldidw 0;
+jmp @L152;
+@L151:
+ldidw 1;
+@L152:
+jmpt @L149;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 17;
+eqdw;
+jmpt @L149;
+ldidw 0;
+jmp @L150;
+@L149:
+ldidw 1;
+@L150:
+jmpf @L148;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 11;
+neqdw;
+jmpf @L153;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+jmp @L154;
+@L153:
+ldidw 102;
+@L154:
+ldiqw new_op_node;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw cast_expression;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_multiplicative_expression;
+call 8;
+pop;
+pop;
+jmp @L147;
+@L148:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern preprocess
+.extern analyze_decl_specs
+# ==== start of definition of function `logical_OR_expression' ====
+.text
+logical_OR_expression:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw logical_AND_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L155:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 29;
+eqdw;
+jmpf @L156;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw new_op_node;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw logical_AND_expression;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_logical_operator;
+call 8;
+pop;
+pop;
+jmp @L155;
+@L156:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern strstr
+.extern calloc
+.extern pop_scope
+.extern memset
+# ==== start of definition of function `get_lexeme' ====
+.text
+get_lexeme:
+addsp 12;        
+# param:`i', offset:-20
+# var: p, offset: 8
+ldiqw curr_tok;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L157:
+ldbp -20;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+jmpf @L158;
+ldbp 8;
+ldqw;
+ldiqw next_token;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L157;
+@L158:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern file_exists
+.extern include_libc
+.extern increase_switch_nesting_level
+.extern analyze_cast_expression
+.extern stringify_type_exp
+# ==== start of definition of function `struct_declarator' ====
+.text
+struct_declarator:
+addsp 12;        
+# param:`sql', offset:-24
+# var: n, offset: 8
+ldiqw concrete_declarator;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw analyze_struct_declarator;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern add_quote_dir
+.extern stat_number_of_ast_nodes
+.extern strtoul
+.extern isprint
+.extern set_return_type
+.extern fprintf
+# ==== start of definition of function `print_declarator' ====
+.text
+print_declarator:
+addsp 4;         
+# param:`n', offset:-24
+# var: tmp_vertex, offset: 4
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw print_TypeExp_node;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L159;
+ldiqw @S18;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw print_declarator;
+call 8;
+pop;
+pop;
+@L159:
+ldidw 0;
+ret;
+.extern get_type_qual
+.extern read_file
+# ==== start of definition of function `struct_declarator_list' ====
+.text
+struct_declarator_list:
+addsp 28;        
+# param:`sql', offset:-24
+# var: n, offset: 8
+# var: temp, offset: 16
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 92;
+neqdw;
+jmpf @L160;
+ldbp -24;
+ldqw;
+ldiqw struct_declarator;
+call 8;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L161:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 34;
+eqdw;
+jmpf @L162;
+ldidw 34;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw struct_declarator;
+call 8;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L161;
+@L162:
+jmp @L163;
+@L160:
+# var: unmod_sql, offset: 24
+ldbp -24;
+ldqw;
+ldiqw dup_decl_specs;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw struct_declarator;
+call 8;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L164:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 34;
+eqdw;
+jmpf @L165;
+ldidw 34;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw dup_decl_specs;
+call 8;
+ldiqw struct_declarator;
+call 8;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L164;
+@L165:
+@L163:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `declaration_specifiers' ====
+.text
+declaration_specifiers:
+addsp 12;        
+# param:`type_spec_seen', offset:-20
+# var: n, offset: 8
+ldiqw in_first_storage_class_specifier;
+call 0;
+pop;
+jmpf @L166;
+ldiqw storage_class_specifier;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L167;
+@L166:
+ldiqw in_first_type_specifier;
+call 0;
+pop;
+jmpf @L168;
+ldiqw type_specifier;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp -20;
+stdw;
+pop;
+jmp @L169;
+@L168:
+ldiqw in_first_type_qualifier;
+call 0;
+pop;
+jmpf @L170;
+ldiqw type_qualifier;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L171;
+@L170:
+ldiqw @S19;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L171:
+@L169:
+@L167:
+ldiqw in_first_declaration_specifiers;
+call 0;
+pop;
+jmpf @L172;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 76;
+neqdw;
+jmpt @L174;
+ldbp -20;
+lddw;
+notdw;
+jmpt @L174;
+ldidw 0;
+jmp @L175;
+@L174:
+ldidw 1;
+@L175:
+jmpf @L172;
+ldidw 1;
+jmp @L173;
+@L172:
+ldidw 0;
+@L173:
+jmpf @L176;
+ldbp -20;
+lddw;
+ldiqw declaration_specifiers;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+@L176:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern is_signed_int
+.extern printf
+.extern get_c_token
+.extern lookup_tag
+.extern get_rank
+# ==== start of definition of function `shift_expression' ====
+.text
+shift_expression:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw additive_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L177:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 18;
+eqdw;
+jmpt @L179;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 19;
+eqdw;
+jmpt @L179;
+ldidw 0;
+jmp @L180;
+@L179:
+ldidw 1;
+@L180:
+jmpf @L178;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw new_op_node;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw additive_expression;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_bitwise_operator;
+call 8;
+pop;
+pop;
+jmp @L177;
+@L178:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `struct_declaration_list' ====
+.text
+struct_declaration_list:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw new_decl_list_node;
+call 0;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw struct_declaration;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L181:
+ldiqw in_first_specifier_qualifier_list;
+call 0;
+pop;
+jmpf @L182;
+ldiqw new_decl_list_node;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw struct_declaration;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L181;
+@L182:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `in_first_type_specifier' ====
+.text
+in_first_type_specifier:
+addsp 0;         
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw @T183;
+switch;
+@L185:
+@L186:
+@L187:
+@L188:
+@L189:
+@L190:
+@L191:
+@L192:
+@L193:
+@L194:
+ldidw 1;
+dw2qw;
+ret;
+@L195:
+ldidw 2;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 31;
+eqdw;
+jmpf @L196;
+ldidw 0;
+dw2qw;
+ret;
+@L196:
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw is_typedef_name;
+call 8;
+pop;
+dw2qw;
+ret;
+@L197:
+ldidw 0;
+dw2qw;
+ret;
+@L184:
+.data
+.align 8
+@T183:
+.dword 12
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 65
+.dword 68
+.dword 71
+.dword 72
+.dword 73
+.dword 76
+.qword @L197
+.qword @L186
+.qword @L194
+.qword @L188
+.qword @L189
+.qword @L187
+.qword @L190
+.qword @L192
+.qword @L193
+.qword @L191
+.qword @L185
+.qword @L195
+.text
+ldidw 0;
+ret;
+.extern is_external_id
+# ==== start of definition of function `type_name' ====
+.text
+type_name:
+addsp 12;        
+# var: n, offset: 8
+ldiqw new_declaration_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw specifier_qualifier_list;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 3;
+neqdw;
+jmpf @L198;
+ldiqw abstract_declarator;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L198:
+ldbp 8;
+ldqw;
+ldiqw analyze_type_name;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern isalnum
+.extern sprintf
+# ==== start of definition of function `expression' ====
+.text
+expression:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw assignment_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L199:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 34;
+eqdw;
+jmpf @L200;
+ldidw 34;
+ldiqw new_op_node;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 34;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw assignment_expression;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_expression;
+call 8;
+pop;
+pop;
+jmp @L199;
+@L200:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern isxdigit
+.extern strcat
+.extern are_compatible
+.extern resolve_gotos
+.extern error_count
+# ==== start of definition of function `AND_expression' ====
+.text
+AND_expression:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw equality_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L201:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 10;
+eqdw;
+jmpf @L202;
+ldidw 104;
+ldiqw new_op_node;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw equality_expression;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_bitwise_operator;
+call 8;
+pop;
+pop;
+jmp @L201;
+@L202:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern free_pre_token
+.extern round_up
+.extern analyze_declarator
+.extern include_liblux
+.extern stat_number_of_pre_tokens
+# ==== start of definition of function `type_qualifier_list' ====
+.text
+type_qualifier_list:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw type_qualifier;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L203:
+ldiqw in_first_type_qualifier;
+call 0;
+pop;
+jmpf @L204;
+ldiqw type_qualifier;
+call 0;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+neqdw;
+jmpf @L205;
+ldidw 112;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+@L205:
+jmp @L203;
+@L204:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `init_declarator_list' ====
+.text
+init_declarator_list:
+addsp 28;        
+# param:`decl_specs', offset:-24
+# param:`first_declarator', offset:-32
+# var: n, offset: 8
+# var: temp, offset: 16
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 92;
+neqdw;
+jmpf @L206;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw init_declarator;
+call 16;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L207:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 34;
+eqdw;
+jmpf @L208;
+ldidw 34;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw init_declarator;
+call 16;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L207;
+@L208:
+jmp @L209;
+@L206:
+# var: unmod_ds, offset: 24
+ldbp -24;
+ldqw;
+ldiqw dup_decl_specs;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw init_declarator;
+call 16;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L210:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 34;
+eqdw;
+jmpf @L211;
+ldidw 34;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 24;
+ldqw;
+ldiqw dup_decl_specs;
+call 8;
+ldiqw init_declarator;
+call 16;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L210;
+@L211:
+@L209:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern strchr
+# ==== start of definition of function `print_initializer' ====
+.text
+print_initializer:
+addsp 0;         
+# param:`n', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L212;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+eqdw;
+jmpf @L212;
+ldidw 1;
+jmp @L213;
+@L212:
+ldidw 0;
+@L213:
+jmpf @L214;
+ldiqw @S20;
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw @S21;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldiqw vertex_counter;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw print_initializer_list;
+call 8;
+pop;
+pop;
+jmp @L215;
+@L214:
+ldbp -24;
+ldqw;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+@L215:
+ldidw 0;
+ret;
+# ==== start of definition of function `concrete_declarator' ====
+.text
+concrete_declarator:
+addsp 0;         
+ldidw 1;
+ldiqw declarator;
+call 4;
+ret;
+ldidw 0;
+ret;
+.extern toupper
+.extern add_angle_dir
+.extern analyze_conditional_expression
+.extern ic_outpath
+.extern arena_alloc
+.extern stdout
+.extern get_type_category
+# ==== start of definition of function `print_initializer_list' ====
+.text
+print_initializer_list:
+addsp 4;         
+# param:`n', offset:-24
+@L216:
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L218;
+# var: tmp_vertex, offset: 4
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw print_initializer;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L219;
+ldiqw @S22;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+@L219:
+@L217:
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+jmp @L216;
+@L218:
+ldidw 0;
+ret;
+# ==== start of definition of function `postfix' ====
+.text
+postfix:
+addsp 12;        
+# var: n, offset: 8
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw @T220;
+jmptab;
+@L222:
+ldidw 97;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L221;
+@L223:
+ldidw 98;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 2;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 3;
+neqdw;
+jmpf @L224;
+ldiqw argument_expression_list;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L224:
+ldidw 3;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L221;
+@L225:
+ldidw 6;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 6;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 3;
+ldiqw new_pri_exp_node;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 76;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L221;
+@L226:
+ldidw 7;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 7;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 3;
+ldiqw new_pri_exp_node;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 76;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L221;
+@L227:
+ldidw 94;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 8;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L221;
+@L228:
+ldidw 96;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 9;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L221;
+@L221:
+.data
+.align 8
+@T220:
+.dword 0
+.dword 10
+.qword @L221
+.qword @L222
+.qword @L221
+.qword @L223
+.qword @L221
+.qword @L221
+.qword @L221
+.qword @L225
+.qword @L226
+.qword @L227
+.qword @L228
+.text
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `translation_unit' ====
+.text
+translation_unit:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw external_declaration;
+call 0;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L229:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 91;
+neqdw;
+jmpf @L230;
+ldiqw external_declaration;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L229;
+@L230:
+ldidw 91;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw analyze_translation_unit;
+call 0;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `parameter_type_list' ====
+.text
+parameter_type_list:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw push_scope;
+call 0;
+pop;
+pop;
+ldiqw parameter_list;
+call 0;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw pop_scope;
+call 0;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 34;
+eqdw;
+jmpf @L231;
+ldidw 34;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 33;
+ldiqw match;
+call 4;
+pop;
+pop;
+@L232:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L233;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L232;
+@L233:
+ldiqw new_decl_list_node;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw new_declaration_node;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw new_type_exp_node;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 33;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L231:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern ilog2
+.extern strcmp
+# ==== start of definition of function `in_first_type_qualifier' ====
+.text
+in_first_type_qualifier:
+addsp 0;         
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 50;
+eqdw;
+jmpt @L234;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 74;
+eqdw;
+jmpt @L234;
+ldidw 0;
+jmp @L235;
+@L234:
+ldidw 1;
+@L235:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `direct_declarator' ====
+.text
+direct_declarator:
+addsp 20;        
+# param:`dc', offset:-20
+# var: la2, offset: 4
+# var: n, offset: 8
+ldidw 0;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+# var: temp, offset: 16
+ldidw 0;
+dw2qw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 76;
+eqdw;
+jmpf @L236;
+ldbp -20;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L237;
+ldiqw @S23;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L237:
+ldiqw new_type_exp_node;
+call 0;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 76;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 76;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L238;
+@L236:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 2;
+eqdw;
+jmpf @L241;
+ldidw 2;
+ldiqw lookahead;
+call 4;
+pop;
+ldbp 4;
+stdw;
+ldidw 3;
+neqdw;
+jmpf @L241;
+ldidw 1;
+jmp @L242;
+@L241:
+ldidw 0;
+@L242:
+jmpf @L239;
+ldbp 4;
+lddw;
+ldidw 2;
+eqdw;
+jmpt @L247;
+ldbp 4;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L247;
+ldidw 0;
+jmp @L248;
+@L247:
+ldidw 1;
+@L248:
+jmpt @L245;
+ldbp 4;
+lddw;
+ldidw 11;
+eqdw;
+jmpt @L245;
+ldidw 0;
+jmp @L246;
+@L245:
+ldidw 1;
+@L246:
+jmpt @L243;
+ldbp 4;
+lddw;
+ldidw 76;
+eqdw;
+jmpf @L249;
+ldbp -20;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L251;
+ldidw 2;
+ldiqw get_lexeme;
+call 4;
+ldiqw is_typedef_name;
+call 8;
+pop;
+notdw;
+jmpt @L251;
+ldidw 0;
+jmp @L252;
+@L251:
+ldidw 1;
+@L252:
+jmpf @L249;
+ldidw 1;
+jmp @L250;
+@L249:
+ldidw 0;
+@L250:
+jmpt @L243;
+ldidw 0;
+jmp @L244;
+@L243:
+ldidw 1;
+@L244:
+jmpf @L239;
+ldidw 1;
+jmp @L240;
+@L239:
+ldidw 0;
+@L240:
+jmpf @L253;
+ldidw 2;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldiqw declarator;
+call 4;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 3;
+ldiqw match;
+call 4;
+pop;
+pop;
+@L253:
+@L238:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L254;
+ldbp -20;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L254;
+ldidw 1;
+jmp @L255;
+@L254:
+ldidw 0;
+@L255:
+jmpf @L256;
+ldiqw @S24;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L256:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 0;
+eqdw;
+jmpt @L257;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 2;
+eqdw;
+jmpt @L257;
+ldidw 0;
+jmp @L258;
+@L257:
+ldidw 1;
+@L258:
+jmpf @L259;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L260;
+ldiqw direct_declarator_postfix;
+call 0;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L261:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 0;
+eqdw;
+jmpt @L263;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 2;
+eqdw;
+jmpt @L263;
+ldidw 0;
+jmp @L264;
+@L263:
+ldidw 1;
+@L264:
+jmpf @L262;
+ldiqw direct_declarator_postfix;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L261;
+@L262:
+jmp @L265;
+@L260:
+@L266:
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L267;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L266;
+@L267:
+@L268:
+ldiqw direct_declarator_postfix;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L269:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 0;
+eqdw;
+jmpt @L271;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 2;
+eqdw;
+jmpt @L271;
+ldidw 0;
+jmp @L272;
+@L271:
+ldidw 1;
+@L272:
+jmpf @L270;
+jmp @L268;
+@L270:
+@L265:
+@L259:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern strtok
+.extern strtol
+# ==== start of definition of function `parse_header' ====
+.text
+parse_header:
+.global parse_header
+addsp 84;        
+# param:`tokens', offset:-24
+# var: e, offset: 8
+# var: head, offset: 16
+# var: last, offset: 64
+# var: first, offset: 72
+# var: p, offset: 80
+ldbp -24;
+ldqw;
+ldiqw parser_init;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw keep_tokens;
+stdw;
+pop;
+ldbp 16;
+ldbp 64;
+stqw;
+pop;
+pop;
+@L273:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 91;
+neqdw;
+jmpf @L274;
+ldiqw curr_tok;
+ldqw;
+ldbp 72;
+stqw;
+pop;
+pop;
+ldiqw external_declaration;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw is_definition;
+call 8;
+pop;
+notdw;
+jmpf @L275;
+jmp @L273;
+@L275:
+ldbp 72;
+ldqw;
+ldbp 80;
+stqw;
+pop;
+pop;
+@L276:
+ldbp 80;
+ldqw;
+ldiqw curr_tok;
+ldqw;
+neqqw;
+jmpf @L278;
+ldiqw 48;
+ldiqw malloc;
+call 8;
+ldbp 64;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 64;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+ldbp 80;
+ldqw;
+ldbp 64;
+ldqw;
+swap2;
+memcpy 48;
+pop;
+pop;
+ldidw 0;
+dw2b;
+ldbp 64;
+ldqw;
+ldiqw 32;
+addqw;
+stb;
+pop;
+@L277:
+ldbp 80;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 80;
+stqw;
+pop;
+pop;
+jmp @L276;
+@L278:
+jmp @L273;
+@L274:
+ldidw 0;
+dw2qw;
+ldbp 64;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw keep_tokens;
+stdw;
+pop;
+ldiqw stmt_done;
+call 0;
+pop;
+pop;
+ldbp 16;
+ldiqw 40;
+addqw;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern is_modif_lvalue
+# ==== start of definition of function `print_Declaration' ====
+.text
+print_Declaration:
+addsp 4;         
+# param:`n', offset:-24
+# var: tmp_vertex, offset: 4
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw @S25;
+ldbp 4;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L279;
+ldiqw @S26;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw print_declaration_specifiers;
+call 8;
+pop;
+pop;
+jmp @L280;
+@L279:
+@L280:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L281;
+ldiqw @S27;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw print_init_declarator_list;
+call 8;
+pop;
+pop;
+@L281:
+ldidw 0;
+ret;
+.extern stdin
+.extern current_function_name
+.extern is_integer
+# ==== start of definition of function `type_specifier' ====
+.text
+type_specifier:
+addsp 12;        
+# var: n, offset: 8
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw @T282;
+switch;
+@L284:
+@L285:
+@L286:
+@L287:
+@L288:
+@L289:
+@L290:
+ldiqw new_type_exp_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L283;
+@L291:
+@L292:
+ldiqw struct_or_union_specifier;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L283;
+@L293:
+ldiqw enum_specifier;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L283;
+@L294:
+ldiqw typedef_name;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L283;
+@L295:
+@L296:
+ldidw 0;
+notdw;
+jmpf @L299;
+ldidw 548;
+ldiqw @S28;
+ldiqw @S29;
+ldiqw @S30;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L299:
+@L297:
+ldidw 0;
+jmpf @L298;
+jmp @L296;
+@L298:
+jmp @L283;
+@L283:
+.data
+.align 8
+@T282:
+.dword 12
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 65
+.dword 68
+.dword 71
+.dword 72
+.dword 73
+.dword 76
+.qword @L295
+.qword @L285
+.qword @L293
+.qword @L287
+.qword @L288
+.qword @L286
+.qword @L289
+.qword @L291
+.qword @L292
+.qword @L290
+.qword @L284
+.qword @L294
+.text
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern analyze_postfix_expression
+.extern ftell
+.extern strcpy
+# ==== start of definition of function `print_function_definition' ====
+.text
+print_function_definition:
+addsp 4;         
+# param:`n', offset:-24
+# var: tmp_vertex, offset: 4
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw @S31;
+ldbp 4;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw @S32;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw print_declaration_specifiers;
+call 8;
+pop;
+pop;
+ldiqw @S33;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw print_declarator;
+call 8;
+pop;
+pop;
+ldiqw @S34;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern install_tag
+.extern ic_function_to_print
+.extern isupper
+.extern strtoull
+.extern strlen
+.extern token_table
+# ==== start of definition of function `direct_declarator_postfix' ====
+.text
+direct_declarator_postfix:
+addsp 12;        
+# var: n, offset: 8
+ldiqw new_type_exp_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L300;
+ldidw 97;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 1;
+neqdw;
+jmpf @L301;
+ldiqw constant_expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+@L301:
+ldidw 1;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L302;
+@L300:
+ldidw 98;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 2;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 3;
+neqdw;
+jmpf @L303;
+ldiqw parameter_type_list;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L304;
+@L303:
+ldiqw push_scope;
+call 0;
+pop;
+pop;
+ldiqw void_param;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw pop_scope;
+call 0;
+pop;
+pop;
+@L304:
+ldidw 3;
+ldiqw match;
+call 4;
+pop;
+pop;
+@L302:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `selection_statement' ====
+.text
+selection_statement:
+addsp 12;        
+# param:`in_loop', offset:-20
+# param:`in_switch', offset:-24
+# var: n, offset: 8
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw @T305;
+switch;
+@L307:
+ldidw 0;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 59;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 2;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 3;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw statement;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 54;
+eqdw;
+jmpf @L308;
+ldidw 54;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw statement;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L308:
+jmp @L306;
+@L309:
+ldidw 9;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 69;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 2;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 3;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw increase_switch_nesting_level;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldbp -20;
+lddw;
+ldiqw statement;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw decrease_switch_nesting_level;
+call 0;
+pop;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L306;
+@L306:
+.data
+.align 8
+@T305:
+.dword 3
+.dword 59
+.dword 69
+.qword @L306
+.qword @L307
+.qword @L309
+.text
+ldbp 8;
+ldqw;
+ldiqw analyze_selection_statement;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `new_pri_exp_node' ====
+.text
+new_pri_exp_node:
+addsp 12;        
+# param:`kind', offset:-20
+# var: n, offset: 8
+ldiqw new_exec_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 48;
+addqw;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 52;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `initializer_list' ====
+.text
+initializer_list:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw initializer;
+call 0;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L310:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 34;
+eqdw;
+jmpf @L312;
+ldidw 2;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 5;
+neqdw;
+jmpf @L312;
+ldidw 1;
+jmp @L313;
+@L312:
+ldidw 0;
+@L313:
+jmpf @L311;
+ldidw 34;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw initializer;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L310;
+@L311:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern analyze_expression
+# ==== start of definition of function `primary_expression' ====
+.text
+primary_expression:
+addsp 28;        
+# var: n, offset: 8
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw @T314;
+switch;
+@L316:
+# var: s, offset: 16
+ldidw 3;
+ldiqw new_pri_exp_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 76;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw lookup_ordinary_id;
+call 12;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L317;
+# var: scs, offset: 24
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 24;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L318;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 70;
+neqdw;
+jmpt @L318;
+ldidw 0;
+jmp @L319;
+@L318:
+ldidw 1;
+@L319:
+jmpf @L320;
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw set_attributes;
+call 16;
+pop;
+pop;
+jmp @L321;
+@L320:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S35;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L321:
+jmp @L322;
+@L317:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S36;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+ldidw 90;
+ldiqw get_type_node;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L322:
+jmp @L315;
+@L323:
+@L324:
+@L325:
+@L326:
+@L327:
+@L328:
+@L329:
+@L330:
+@L331:
+@L332:
+@L333:
+@L334:
+ldidw 1;
+ldiqw new_pri_exp_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw curr_tok;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw curr_tok;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L315;
+@L335:
+ldidw 2;
+ldiqw new_pri_exp_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 77;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L315;
+@L336:
+ldidw 2;
+ldiqw new_pri_exp_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw current_function_name;
+ldqw;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldiqw parser_str_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw current_function_name;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+ldidw 115;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L315;
+@L337:
+ldidw 2;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 3;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+@L338:
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw @S37;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+jmp @L315;
+@L315:
+.data
+.align 8
+@T314:
+.dword 17
+.dword 2
+.dword 76
+.dword 77
+.dword 78
+.dword 79
+.dword 80
+.dword 81
+.dword 82
+.dword 83
+.dword 84
+.dword 85
+.dword 86
+.dword 87
+.dword 88
+.dword 89
+.dword 115
+.qword @L338
+.qword @L337
+.qword @L316
+.qword @L335
+.qword @L323
+.qword @L324
+.qword @L325
+.qword @L326
+.qword @L327
+.qword @L328
+.qword @L329
+.qword @L330
+.qword @L331
+.qword @L332
+.qword @L333
+.qword @L334
+.qword @L336
+.text
+ldbp 8;
+ldqw;
+ldiqw analyze_primary_expression;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `jump_statement' ====
+.text
+jump_statement:
+addsp 12;        
+# param:`in_loop', offset:-20
+# param:`in_switch', offset:-24
+# var: n, offset: 8
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw @T339;
+switch;
+@L341:
+ldidw 13;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 58;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 76;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L340;
+@L342:
+ldidw 5;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 51;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L340;
+@L343:
+ldidw 4;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 47;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L340;
+@L344:
+ldidw 6;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 63;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 32;
+neqdw;
+jmpf @L345;
+ldiqw expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L345:
+jmp @L340;
+@L340:
+.data
+.align 8
+@T339:
+.dword 5
+.dword 47
+.dword 51
+.dword 58
+.dword 63
+.qword @L340
+.qword @L343
+.qword @L342
+.qword @L341
+.qword @L344
+.text
+ldidw 32;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw analyze_jump_statement;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern memchr
+# ==== start of definition of function `new_type_exp_node' ====
+.text
+new_type_exp_node:
+.global new_type_exp_node
+addsp 12;        
+# var: n, offset: 8
+ldiqw 48;
+pop;
+ldiqw parser_node_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw curr_tok;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+dw2b;
+ldiqw curr_tok;
+ldqw;
+ldiqw 32;
+addqw;
+stb;
+pop;
+ldiqw stat_number_of_ast_nodes;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern analyze_primary_expression
+.extern dup_decl_specs
+# ==== start of definition of function `new_declaration_node' ====
+.text
+new_declaration_node:
+.global new_declaration_node
+addsp 12;        
+# var: n, offset: 8
+ldiqw 16;
+pop;
+ldiqw parser_node_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw stat_number_of_ast_nodes;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern vfprintf
+.extern eval_const_expr
+.extern hash
+# ==== start of definition of function `asm_statement' ====
+.text
+asm_statement:
+addsp 12;        
+# var: n, offset: 8
+ldidw 117;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 2;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 14;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 77;
+eqdw;
+jmpf @L346;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+@L346:
+ldidw 77;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 3;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 32;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern iscntrl
+.extern bsearch
+.extern pre_save_pch
+.extern qsort
+.extern analyze_parameter_declaration
+.extern cg_outpath
+.extern memcmp
+.extern pre_load_pch
+.extern vsnprintf
+.extern vsprintf
+# ==== start of definition of function `type_qualifier' ====
+.text
+type_qualifier:
+addsp 12;        
+# var: n, offset: 8
+ldiqw new_type_exp_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 50;
+eqdw;
+jmpf @L347;
+ldidw 50;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L348;
+@L347:
+ldidw 74;
+ldiqw match;
+call 4;
+pop;
+pop;
+@L348:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern warning_count
+# ==== start of definition of function `storage_class_specifier' ====
+.text
+storage_class_specifier:
+addsp 12;        
+# var: s, offset: 8
+ldiqw new_type_exp_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern memcpy
+# ==== start of definition of function `print_DeclList' ====
+.text
+print_DeclList:
+addsp 4;         
+# param:`n', offset:-24
+@L349:
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L351;
+# var: tmp_vertex, offset: 4
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw @S38;
+ldbp 4;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw @S39;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw print_Declaration;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L352;
+ldiqw @S40;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+@L352:
+@L350:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+jmp @L349;
+@L351:
+ldidw 0;
+ret;
+# ==== start of definition of function `in_first_specifier_qualifier_list' ====
+.text
+in_first_specifier_qualifier_list:
+addsp 0;         
+ldiqw in_first_type_specifier;
+call 0;
+pop;
+jmpt @L353;
+ldiqw in_first_type_qualifier;
+call 0;
+pop;
+jmpt @L353;
+ldidw 0;
+jmp @L354;
+@L353:
+ldidw 1;
+@L354:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `in_first_declaration_specifiers' ====
+.text
+in_first_declaration_specifiers:
+addsp 0;         
+ldiqw in_first_storage_class_specifier;
+call 0;
+pop;
+jmpt @L357;
+ldiqw in_first_type_specifier;
+call 0;
+pop;
+jmpt @L357;
+ldidw 0;
+jmp @L358;
+@L357:
+ldidw 1;
+@L358:
+jmpt @L355;
+ldiqw in_first_type_qualifier;
+call 0;
+pop;
+jmpt @L355;
+ldidw 0;
+jmp @L356;
+@L355:
+ldidw 1;
+@L356:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern fopen
+.extern be_atoi
+.extern analyze_labeled_statement
+# ==== start of definition of function `cast_expression' ====
+.text
+cast_expression:
+addsp 12;        
+# var: n, offset: 8
+ldiqw in_first_parenthesized_type_name;
+call 0;
+pop;
+jmpf @L359;
+ldidw 2;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 105;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw type_name;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 3;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw cast_expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_cast_expression;
+call 8;
+pop;
+pop;
+jmp @L360;
+@L359:
+ldiqw unary_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L360:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern push_scope
+.extern free_c_token
+.bss
+.align 8
+parser_node_arena:
+.res 8
+.global parser_node_arena
+# ==== start of definition of function `unary_expression' ====
+.text
+unary_expression:
+addsp 12;        
+# var: n, offset: 8
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw @T361;
+switch;
+@L363:
+ldidw 93;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 8;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw unary_expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L362;
+@L364:
+ldidw 95;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 9;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw unary_expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L362;
+@L365:
+@L366:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw in_first_parenthesized_type_name;
+call 0;
+pop;
+jmpf @L367;
+ldidw 2;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw type_name;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 3;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L368;
+@L367:
+ldiqw unary_expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L368:
+jmp @L362;
+@L369:
+ldidw 103;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 10;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw cast_expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L362;
+@L370:
+ldidw 101;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 11;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw cast_expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L362;
+@L371:
+ldidw 99;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 12;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw cast_expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L362;
+@L372:
+ldidw 100;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 13;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw cast_expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L362;
+@L373:
+@L374:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw new_op_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw cast_expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L362;
+@L375:
+ldiqw postfix_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+@L362:
+.data
+.align 8
+@T361:
+.dword 11
+.dword 8
+.dword 9
+.dword 10
+.dword 11
+.dword 12
+.dword 13
+.dword 14
+.dword 15
+.dword 66
+.dword 119
+.qword @L375
+.qword @L363
+.qword @L364
+.qword @L369
+.qword @L370
+.qword @L371
+.qword @L372
+.qword @L373
+.qword @L374
+.qword @L366
+.qword @L365
+.text
+ldbp 8;
+ldqw;
+ldiqw analyze_unary_expression;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `parse' ====
+.text
+parse:
+.global parse
+addsp 12;        
+# param:`tokens', offset:-24
+# param:`ast_outpath', offset:-32
+# var: n, offset: 8
+ldbp -24;
+ldqw;
+ldiqw parser_init;
+call 8;
+pop;
+pop;
+ldiqw translation_unit;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw stmt_done;
+call 0;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L376;
+ldiqw @S41;
+ldbp -32;
+ldqw;
+ldiqw fopen;
+call 16;
+ldiqw dotfile;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw print_ast;
+call 8;
+pop;
+pop;
+ldiqw dotfile;
+ldqw;
+ldiqw fclose;
+call 8;
+pop;
+pop;
+@L376:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern get_pre_token
+.extern get_member_descriptor
+.extern decl_init
+# ==== start of definition of function `logical_AND_expression' ====
+.text
+logical_AND_expression:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw inclusive_OR_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L377:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 28;
+eqdw;
+jmpf @L378;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw new_op_node;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw inclusive_OR_expression;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_logical_operator;
+call 8;
+pop;
+pop;
+jmp @L377;
+@L378:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `parser_init' ====
+.text
+parser_init:
+addsp 0;         
+# param:`tokens', offset:-24
+ldidw 73;
+ldiqw get_type_node;
+call 4;
+ldiqw void_ty;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw void_ty;
+ldiqw void_param;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw curr_tok;
+stqw;
+pop;
+pop;
+ldiqw decl_init;
+call 0;
+pop;
+pop;
+ldiqw stmt_init;
+call 0;
+pop;
+pop;
+ldidw 1;
+ldidw 4096;
+ldiqw arena_new;
+call 8;
+ldiqw parser_node_arena;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldidw 1024;
+ldiqw arena_new;
+call 8;
+ldiqw parser_str_arena;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern dup_declarator
+.extern strncat
+.extern fileno
+# ==== start of definition of function `pointer' ====
+.text
+pointer:
+addsp 28;        
+# var: n, offset: 8
+ldiqw new_type_exp_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 11;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw in_first_type_qualifier;
+call 0;
+pop;
+jmpf @L379;
+ldiqw type_qualifier_list;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+@L379:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 11;
+eqdw;
+jmpf @L380;
+# var: p, offset: 16
+# var: temp, offset: 24
+ldiqw pointer;
+call 0;
+ldbp 24;
+stqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L381:
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L382;
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L381;
+@L382:
+ldbp 8;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L380:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern isdigit
+# ==== start of definition of function `print_declaration_specifiers' ====
+.text
+print_declaration_specifiers:
+addsp 4;         
+# param:`n', offset:-24
+# var: tmp_vertex, offset: 4
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw print_TypeExp_node;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L383;
+ldiqw @S42;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw print_declaration_specifiers;
+call 8;
+pop;
+pop;
+@L383:
+ldidw 0;
+ret;
+.extern lookup_external_id
+.extern isspace
+.extern hash2
+.extern analyze_type_name
+.bss
+.align 8
+curr_tok:
+.res 8
+.extern isalpha
+.extern is_unsigned_int
+.extern memmove
+.extern replace_extension
+.bss
+.align 8
+parser_str_arena:
+.res 8
+.extern analyze_struct_declarator
+# ==== start of definition of function `print_ExecNode_node' ====
+.text
+print_ExecNode_node:
+addsp 144;       
+# param:`n', offset:-24
+# var: buf, offset: 4
+# var: tmp_vertex, offset: 132
+ldbp -24;
+ldqw;
+ldiqw 48;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L384;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T385;
+jmptab;
+@L387:
+@L388:
+@L389:
+@L390:
+@L391:
+@L392:
+@L393:
+@L394:
+@L395:
+@L396:
+@L397:
+# var: lab, offset: 136
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldbp 132;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T398;
+jmptab;
+@L400:
+ldiqw @S43;
+ldbp 136;
+stqw;
+pop;
+pop;
+jmp @L399;
+@L401:
+ldiqw @S44;
+ldbp 136;
+stqw;
+pop;
+pop;
+jmp @L399;
+@L402:
+ldiqw @S45;
+ldbp 136;
+stqw;
+pop;
+pop;
+jmp @L399;
+@L403:
+ldiqw @S46;
+ldbp 136;
+stqw;
+pop;
+pop;
+jmp @L399;
+@L404:
+ldiqw @S47;
+ldbp 136;
+stqw;
+pop;
+pop;
+jmp @L399;
+@L405:
+ldiqw @S48;
+ldbp 136;
+stqw;
+pop;
+pop;
+jmp @L399;
+@L406:
+ldiqw @S49;
+ldbp 136;
+stqw;
+pop;
+pop;
+jmp @L399;
+@L407:
+ldiqw @S50;
+ldbp 136;
+stqw;
+pop;
+pop;
+jmp @L399;
+@L408:
+ldiqw @S51;
+ldbp 136;
+stqw;
+pop;
+pop;
+jmp @L399;
+@L409:
+ldiqw @S52;
+ldbp 136;
+stqw;
+pop;
+pop;
+jmp @L399;
+@L410:
+ldiqw @S53;
+ldbp 136;
+stqw;
+pop;
+pop;
+jmp @L399;
+@L399:
+.data
+.align 8
+@T398:
+.dword 0
+.dword 12
+.qword @L399
+.qword @L400
+.qword @L402
+.qword @L403
+.qword @L404
+.qword @L406
+.qword @L407
+.qword @L408
+.qword @L405
+.qword @L399
+.qword @L401
+.qword @L409
+.qword @L410
+.text
+ldbp 136;
+ldqw;
+ldbp 132;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L411;
+ldiqw @S54;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 132;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+@L411:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L412;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 6;
+neqdw;
+jmpf @L412;
+ldidw 1;
+jmp @L413;
+@L412:
+ldidw 0;
+@L413:
+jmpf @L414;
+ldiqw @S55;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 132;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+@L414:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L415;
+ldiqw @S56;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 132;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+@L415:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 3;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L416;
+ldiqw @S57;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 132;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 3;
+dw2qw;
+ldxqw 8;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+@L416:
+ldiqw 0;
+ret;
+@L417:
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldbp 132;
+stdw;
+pop;
+ldiqw @S58;
+ldbp 132;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L418;
+ldiqw @S59;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 132;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw print_DeclList;
+call 8;
+pop;
+pop;
+@L418:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L419;
+# var: n2, offset: 136
+ldiqw @S60;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 132;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 136;
+stqw;
+pop;
+pop;
+@L420:
+ldbp 136;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L422;
+# var: stmt_vertex, offset: 144
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 144;
+stdw;
+pop;
+ldbp 136;
+ldqw;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+ldbp 136;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L423;
+ldiqw @S61;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 144;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+@L423:
+@L421:
+ldbp 136;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 136;
+stqw;
+pop;
+pop;
+jmp @L420;
+@L422:
+@L419:
+ldiqw 0;
+ret;
+@L424:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S62;
+ldbp 4;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+ldbp 4;
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw @S63;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldiqw vertex_counter;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L425:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S64;
+ldbp 4;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+ldbp 4;
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L386:
+.data
+.align 8
+@T385:
+.dword 0
+.dword 14
+.qword @L386
+.qword @L387
+.qword @L389
+.qword @L390
+.qword @L391
+.qword @L393
+.qword @L394
+.qword @L395
+.qword @L392
+.qword @L417
+.qword @L388
+.qword @L396
+.qword @L397
+.qword @L424
+.qword @L425
+.text
+jmp @L426;
+@L384:
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T427;
+jmptab;
+@L429:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T430;
+switch;
+@L432:
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldbp 132;
+stdw;
+pop;
+ldiqw @S65;
+ldbp 132;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw @S66;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 132;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L433;
+# var: n2, offset: 136
+ldiqw @S67;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 132;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp 136;
+stqw;
+pop;
+pop;
+@L434:
+ldbp 136;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L436;
+# var: arg_vertex, offset: 144
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 144;
+stdw;
+pop;
+ldbp 136;
+ldqw;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+ldbp 136;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L437;
+ldiqw @S68;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 144;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+@L437:
+@L435:
+ldbp 136;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 136;
+stqw;
+pop;
+pop;
+jmp @L434;
+@L436:
+@L433:
+ldiqw 0;
+ret;
+@L438:
+@L439:
+@L440:
+@L441:
+@L442:
+@L443:
+@L444:
+@L445:
+@L446:
+@L447:
+ldiqw token_table;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S69;
+ldbp 4;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+ldbp 4;
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw @S70;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldiqw vertex_counter;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L448:
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldbp 132;
+stdw;
+pop;
+ldiqw @S71;
+ldbp 132;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw @S72;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 132;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+ldiqw @S73;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 132;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw print_Declaration;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L449:
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldbp 132;
+stdw;
+pop;
+ldiqw token_table;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S74;
+ldbp 4;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+ldbp 4;
+ldbp 132;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw @S75;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 132;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+ldiqw @S76;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 132;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 30;
+eqdw;
+jmpf @L450;
+ldiqw @S77;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 132;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw print_ExecNode_node;
+call 8;
+pop;
+pop;
+@L450:
+ldiqw 0;
+ret;
+@L431:
+.data
+.align 8
+@T430:
+.dword 13
+.dword 14
+.dword 15
+.dword 93
+.dword 94
+.dword 95
+.dword 96
+.dword 98
+.dword 99
+.dword 100
+.dword 101
+.dword 103
+.dword 105
+.qword @L449
+.qword @L446
+.qword @L447
+.qword @L440
+.qword @L438
+.qword @L441
+.qword @L439
+.qword @L432
+.qword @L444
+.qword @L445
+.qword @L443
+.qword @L442
+.qword @L448
+.text
+@L451:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S78;
+ldbp 4;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+ldbp 4;
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L452:
+ldiqw @S79;
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L453:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S80;
+ldbp 4;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+ldbp 4;
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L428:
+.data
+.align 8
+@T427:
+.dword 0
+.dword 4
+.qword @L428
+.qword @L429
+.qword @L451
+.qword @L452
+.qword @L453
+.text
+@L426:
+ldidw 0;
+ret;
+.extern get_type_spec
+# ==== start of definition of function `exclusive_OR_expression' ====
+.text
+exclusive_OR_expression:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw AND_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L454:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 26;
+eqdw;
+jmpf @L455;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw new_op_node;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw AND_expression;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_bitwise_operator;
+call 8;
+pop;
+pop;
+jmp @L454;
+@L455:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `expression_statement' ====
+.text
+expression_statement:
+addsp 12;        
+# var: n, offset: 8
+ldidw 7;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 32;
+neqdw;
+jmpf @L456;
+ldiqw expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L456:
+ldidw 32;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern isgraph
+.extern analyze_function_definition
+.extern strdup
+# ==== start of definition of function `parameter_declaration' ====
+.text
+parameter_declaration:
+addsp 12;        
+# var: n, offset: 8
+ldiqw new_declaration_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw declaration_specifiers;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 34;
+neqdw;
+jmpf @L457;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 3;
+neqdw;
+jmpf @L457;
+ldidw 1;
+jmp @L458;
+@L457:
+ldidw 0;
+@L458:
+jmpf @L459;
+ldidw 2;
+ldiqw declarator;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L459:
+ldbp 8;
+ldqw;
+ldiqw analyze_parameter_declaration;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern arena_new
+.extern analyze_init_declarator
+.extern cfg_function_to_print
+.extern strncmp
+.extern arena_set_nom_siz
+# ==== start of definition of function `conditional_expression' ====
+.text
+conditional_expression:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw logical_OR_expression;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 30;
+eqdw;
+jmpf @L460;
+ldidw 30;
+ldiqw new_op_node;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 30;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw expression;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 31;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw conditional_expression;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_conditional_expression;
+call 8;
+pop;
+pop;
+@L460:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `struct_or_union' ====
+.text
+struct_or_union:
+addsp 12;        
+# var: n, offset: 8
+ldiqw new_type_exp_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 68;
+eqdw;
+jmpf @L461;
+ldidw 68;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L462;
+@L461:
+ldidw 71;
+ldiqw match;
+call 4;
+pop;
+pop;
+@L462:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern analyze_multiplicative_expression
+.extern analyze_additive_expression
+.extern stat_number_of_c_tokens
+.extern strncpy
+.extern decl_save_pch
+# ==== start of definition of function `argument_expression_list' ====
+.text
+argument_expression_list:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw assignment_expression;
+call 0;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L463:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 34;
+eqdw;
+jmpf @L464;
+ldidw 34;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw assignment_expression;
+call 0;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L463;
+@L464:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern analyze_assignment_expression
+# ==== start of definition of function `static_assert_statement' ====
+.text
+static_assert_statement:
+addsp 84;        
+# var: c, offset: 8
+# var: ep, offset: 16
+# var: e, offset: 24
+# var: ty, offset: 32
+# var: assert_tok, offset: 40
+ldiqw curr_tok;
+ldqw;
+ldbp 40;
+swap2;
+memcpy 48;
+pop;
+pop;
+ldidw 116;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 2;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strtol;
+call 20;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 78;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 34;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw @T465;
+switch2;
+@L467:
+ldiqw assignment_expression;
+call 0;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldidw 34;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw type_name;
+call 0;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldidw 1;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw are_compatible;
+call 40;
+pop;
+notdw;
+jmpf @L468;
+ldbp 40;
+ldiqw curr_tok;
+stqw;
+pop;
+pop;
+ldiqw @S81;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L468:
+jmp @L466;
+@L469:
+ldiqw assignment_expression;
+call 0;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw is_modif_lvalue;
+call 8;
+pop;
+jmpf @L470;
+ldbp 40;
+ldiqw curr_tok;
+stqw;
+pop;
+pop;
+ldiqw @S82;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L470:
+jmp @L466;
+@L471:
+jmp @L466;
+@L466:
+.data
+.align 8
+@T465:
+.dword 3
+.dword 0
+.dword 0
+.dword 0
+.dword 1
+.dword 0
+.qword @L471
+.qword @L467
+.qword @L469
+.text
+ldidw 3;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 32;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern new_extern_id_node
+.extern decl_load_pch
+.extern analyze_iteration_statement
+.extern analyze_translation_unit
+# ==== start of definition of function `print_init_declarator_list' ====
+.text
+print_init_declarator_list:
+addsp 4;         
+# param:`n', offset:-24
+@L472:
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L474;
+# var: tmp_vertex, offset: 4
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw print_init_declarator;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L475;
+ldiqw @S83;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+@L475:
+@L473:
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+jmp @L472;
+@L474:
+ldidw 0;
+ret;
+.extern strnlen
+.bss
+.align 8
+dotfile:
+.res 8
+# ==== start of definition of function `struct_or_union_specifier' ====
+.text
+struct_or_union_specifier:
+addsp 28;        
+# var: n, offset: 8
+ldiqw struct_or_union;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 76;
+eqdw;
+jmpf @L476;
+# var: cur, offset: 16
+# var: all, offset: 24
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_tag;
+call 12;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw lookup_tag;
+call 12;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L477;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L478;
+ldidw 2;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 32;
+eqdw;
+jmpt @L480;
+ldidw 2;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 4;
+eqdw;
+jmpt @L480;
+ldidw 0;
+jmp @L481;
+@L480:
+ldidw 1;
+@L481:
+jmpf @L478;
+ldidw 1;
+jmp @L479;
+@L478:
+ldidw 0;
+@L479:
+jmpf @L482;
+ldbp 8;
+ldqw;
+ldiqw install_new_tag;
+call 8;
+pop;
+pop;
+jmp @L483;
+@L482:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+neqdw;
+jmpf @L484;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S84;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L484:
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L483:
+jmp @L485;
+@L477:
+ldbp 8;
+ldqw;
+ldiqw install_new_tag;
+call 8;
+pop;
+pop;
+@L485:
+ldidw 76;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 4;
+eqdw;
+jmpf @L486;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L487;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L487;
+ldidw 1;
+jmp @L488;
+@L487:
+ldidw 0;
+@L488:
+jmpf @L489;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw token_table;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S85;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 44;
+pop;
+pop;
+@L489:
+ldbp 8;
+ldqw;
+ldiqw push_struct_descriptor;
+call 8;
+pop;
+pop;
+ldidw 4;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw struct_declaration_list;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 5;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L490;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L490:
+ldiqw pop_struct_descriptor;
+call 0;
+pop;
+pop;
+@L486:
+jmp @L491;
+@L476:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 4;
+eqdw;
+jmpf @L492;
+ldiqw 12;
+pop;
+ldiqw parser_str_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw @S86;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw push_struct_descriptor;
+call 8;
+pop;
+pop;
+ldidw 4;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw struct_declaration_list;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 5;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw pop_struct_descriptor;
+call 0;
+pop;
+pop;
+jmp @L493;
+@L492:
+ldiqw @S87;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L493:
+@L491:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern empty_label_table
+# ==== start of definition of function `print_init_declarator' ====
+.text
+print_init_declarator:
+addsp 4;         
+# param:`n', offset:-24
+# var: tmp_vertex, offset: 4
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw print_declarator;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+eqdw;
+jmpf @L494;
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L494;
+ldidw 1;
+jmp @L495;
+@L494:
+ldidw 0;
+@L495:
+jmpf @L496;
+ldiqw @S88;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw print_initializer;
+call 8;
+pop;
+pop;
+@L496:
+ldidw 0;
+ret;
+.extern analyze_enumerator
+.extern targeting_arch64
+.extern set_attributes
+.extern is_typedef_name
+# ==== start of definition of function `declaration' ====
+.text
+declaration:
+addsp 12;        
+# param:`decl_specs', offset:-24
+# param:`first_declarator', offset:-32
+# var: d, offset: 8
+ldiqw new_declaration_node;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L497;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L498;
+@L497:
+ldidw 0;
+ldiqw declaration_specifiers;
+call 4;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw analyze_decl_specs;
+call 8;
+pop;
+pop;
+@L498:
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpt @L499;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 32;
+neqdw;
+jmpt @L499;
+ldidw 0;
+jmp @L500;
+@L499:
+ldidw 1;
+@L500:
+jmpf @L501;
+ldbp -32;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw init_declarator_list;
+call 16;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L502;
+@L501:
+@L502:
+ldidw 32;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern arena_reset
+.extern fread
+.extern strrchr
+.extern disable_warnings
+# ==== start of definition of function `print_ast' ====
+.text
+print_ast:
+addsp 4;         
+# param:`n', offset:-24
+ldiqw @S89;
+ldiqw dotfile;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+@L503:
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L505;
+# var: tmp_vertex, offset: 4
+ldiqw vertex_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw @S90;
+ldbp 4;
+lddw;
+ldiqw print_vertex;
+call 12;
+pop;
+pop;
+ldiqw @S91;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L506;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw print_function_definition;
+call 8;
+pop;
+pop;
+jmp @L507;
+@L506:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw print_Declaration;
+call 8;
+pop;
+pop;
+@L507:
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L508;
+ldiqw @S92;
+ldiqw vertex_counter;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+lddw;
+ldiqw print_edge;
+call 16;
+pop;
+pop;
+@L508:
+@L504:
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+jmp @L503;
+@L505:
+ldiqw @S93;
+ldiqw dotfile;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern decrease_switch_nesting_level
+.extern install_macro
+# ==== start of definition of function `abstract_declarator' ====
+.text
+abstract_declarator:
+addsp 0;         
+ldidw 0;
+ldiqw declarator;
+call 4;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `statement_list' ====
+.text
+statement_list:
+addsp 20;        
+# param:`in_loop', offset:-20
+# param:`in_switch', offset:-24
+# var: n, offset: 8
+# var: temp, offset: 16
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw statement;
+call 8;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L509:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 5;
+neqdw;
+jmpf @L510;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw statement;
+call 8;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L509;
+@L510:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern ferror
+.extern random
+.extern isblank
+.extern free
+.extern malloc
+.extern get_external_declarations
+# ==== start of definition of function `is_definition' ====
+.text
+is_definition:
+addsp 12;        
+# param:`e', offset:-24
+# var: p, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L511;
+ldidw 1;
+dw2qw;
+ret;
+@L511:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L512:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L514;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L515;
+ldidw 1;
+dw2qw;
+ret;
+@L515:
+@L513:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L512;
+@L514:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `new_decl_list_node' ====
+.text
+new_decl_list_node:
+.global new_decl_list_node
+addsp 12;        
+# var: n, offset: 8
+ldiqw 16;
+pop;
+ldiqw parser_node_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw stat_number_of_ast_nodes;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `postfix_expression' ====
+.text
+postfix_expression:
+addsp 20;        
+# var: n, offset: 8
+# var: temp, offset: 16
+ldiqw primary_expression;
+call 0;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L516:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 0;
+eqdw;
+jmpt @L526;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 2;
+eqdw;
+jmpt @L526;
+ldidw 0;
+jmp @L527;
+@L526:
+ldidw 1;
+@L527:
+jmpt @L524;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 6;
+eqdw;
+jmpt @L524;
+ldidw 0;
+jmp @L525;
+@L524:
+ldidw 1;
+@L525:
+jmpt @L522;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 7;
+eqdw;
+jmpt @L522;
+ldidw 0;
+jmp @L523;
+@L522:
+ldidw 1;
+@L523:
+jmpt @L520;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 8;
+eqdw;
+jmpt @L520;
+ldidw 0;
+jmp @L521;
+@L520:
+ldidw 1;
+@L521:
+jmpt @L518;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 9;
+eqdw;
+jmpt @L518;
+ldidw 0;
+jmp @L519;
+@L518:
+ldidw 1;
+@L519:
+jmpf @L517;
+ldiqw postfix;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw analyze_postfix_expression;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L516;
+@L517:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern srandom
+.extern lookup_struct_descriptor
+# ==== start of definition of function `new_exec_node' ====
+.text
+new_exec_node:
+.global new_exec_node
+addsp 12;        
+# var: n, offset: 8
+ldiqw 104;
+pop;
+ldiqw parser_node_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw curr_tok;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 96;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+dw2b;
+ldiqw curr_tok;
+ldqw;
+ldiqw 32;
+addqw;
+stb;
+pop;
+ldiqw stat_number_of_ast_nodes;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern get_alignment
+# ==== start of definition of function `va_buitin_start_statement' ====
+.text
+va_buitin_start_statement:
+addsp 60;        
+# var: n, offset: 8
+# var: va_start_tok, offset: 16
+ldiqw curr_tok;
+ldqw;
+ldbp 16;
+swap2;
+memcpy 48;
+pop;
+pop;
+ldidw 118;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 2;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 15;
+ldiqw new_stmt_node;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw assignment_expression;
+call 0;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 3;
+neqdw;
+jmpf @L528;
+ldbp 16;
+ldiqw curr_tok;
+stqw;
+pop;
+pop;
+ldiqw @S94;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L528:
+ldidw 3;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 32;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern fgetc
+.data
+@S0:
+.byte 86
+.byte 37
+.byte 100
+.byte 91
+.byte 108
+.byte 97
+.byte 98
+.byte 101
+.byte 108
+.byte 61
+.byte 34
+.byte 37
+.byte 115
+.byte 34
+.byte 93
+.byte 59
+.byte 10
+.byte 0
+@S1:
+.byte 86
+.byte 37
+.byte 100
+.byte 59
+.byte 10
+.byte 0
+@S2:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 59
+.byte 32
+.byte 102
+.byte 111
+.byte 117
+.byte 110
+.byte 100
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S3:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 32
+.byte 111
+.byte 114
+.byte 32
+.byte 113
+.byte 117
+.byte 97
+.byte 108
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 59
+.byte 32
+.byte 102
+.byte 111
+.byte 117
+.byte 110
+.byte 100
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S4:
+.byte 86
+.byte 37
+.byte 100
+.byte 32
+.byte 45
+.byte 62
+.byte 32
+.byte 86
+.byte 37
+.byte 100
+.byte 32
+.byte 91
+.byte 108
+.byte 97
+.byte 98
+.byte 101
+.byte 108
+.byte 61
+.byte 34
+.byte 32
+.byte 37
+.byte 115
+.byte 34
+.byte 93
+.byte 59
+.byte 10
+.byte 0
+@S5:
+.byte 86
+.byte 37
+.byte 100
+.byte 32
+.byte 45
+.byte 62
+.byte 32
+.byte 86
+.byte 37
+.byte 100
+.byte 59
+.byte 10
+.byte 0
+@S6:
+.byte 117
+.byte 115
+.byte 101
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 116
+.byte 97
+.byte 103
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 116
+.byte 104
+.byte 97
+.byte 116
+.byte 32
+.byte 100
+.byte 111
+.byte 101
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 109
+.byte 97
+.byte 116
+.byte 99
+.byte 104
+.byte 32
+.byte 112
+.byte 114
+.byte 101
+.byte 118
+.byte 105
+.byte 111
+.byte 117
+.byte 115
+.byte 32
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S7:
+.byte 114
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 101
+.byte 110
+.byte 117
+.byte 109
+.byte 32
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S8:
+.byte 60
+.byte 97
+.byte 110
+.byte 111
+.byte 110
+.byte 121
+.byte 109
+.byte 111
+.byte 117
+.byte 115
+.byte 62
+.byte 0
+@S9:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 105
+.byte 100
+.byte 101
+.byte 110
+.byte 116
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 32
+.byte 111
+.byte 114
+.byte 32
+.byte 101
+.byte 110
+.byte 117
+.byte 109
+.byte 101
+.byte 114
+.byte 97
+.byte 116
+.byte 111
+.byte 114
+.byte 45
+.byte 108
+.byte 105
+.byte 115
+.byte 116
+.byte 0
+@S10:
+.byte 84
+.byte 121
+.byte 112
+.byte 101
+.byte 69
+.byte 120
+.byte 112
+.byte 92
+.byte 110
+.byte 40
+.byte 37
+.byte 115
+.byte 41
+.byte 0
+@S11:
+.byte 84
+.byte 121
+.byte 112
+.byte 101
+.byte 69
+.byte 120
+.byte 112
+.byte 92
+.byte 110
+.byte 40
+.byte 42
+.byte 41
+.byte 0
+@S12:
+.byte 97
+.byte 116
+.byte 116
+.byte 114
+.byte 46
+.byte 101
+.byte 108
+.byte 0
+@S13:
+.byte 84
+.byte 121
+.byte 112
+.byte 101
+.byte 69
+.byte 120
+.byte 112
+.byte 92
+.byte 110
+.byte 40
+.byte 91
+.byte 93
+.byte 41
+.byte 0
+@S14:
+.byte 97
+.byte 116
+.byte 116
+.byte 114
+.byte 46
+.byte 101
+.byte 0
+@S15:
+.byte 84
+.byte 121
+.byte 112
+.byte 101
+.byte 69
+.byte 120
+.byte 112
+.byte 92
+.byte 110
+.byte 40
+.byte 40
+.byte 41
+.byte 41
+.byte 0
+@S16:
+.byte 97
+.byte 116
+.byte 116
+.byte 114
+.byte 46
+.byte 100
+.byte 108
+.byte 0
+@S17:
+.byte 84
+.byte 121
+.byte 112
+.byte 101
+.byte 69
+.byte 120
+.byte 112
+.byte 92
+.byte 110
+.byte 40
+.byte 37
+.byte 115
+.byte 41
+.byte 0
+@S18:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 0
+@S19:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 45
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 0
+@S20:
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 97
+.byte 108
+.byte 105
+.byte 122
+.byte 101
+.byte 114
+.byte 45
+.byte 108
+.byte 105
+.byte 115
+.byte 116
+.byte 0
+@S21:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+@S22:
+.byte 115
+.byte 105
+.byte 98
+.byte 108
+.byte 105
+.byte 110
+.byte 103
+.byte 0
+@S23:
+.byte 105
+.byte 100
+.byte 101
+.byte 110
+.byte 116
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 97
+.byte 108
+.byte 108
+.byte 111
+.byte 119
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 97
+.byte 98
+.byte 115
+.byte 116
+.byte 114
+.byte 97
+.byte 99
+.byte 116
+.byte 45
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 111
+.byte 114
+.byte 0
+@S24:
+.byte 109
+.byte 105
+.byte 115
+.byte 115
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 105
+.byte 100
+.byte 101
+.byte 110
+.byte 116
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 110
+.byte 111
+.byte 110
+.byte 45
+.byte 97
+.byte 98
+.byte 115
+.byte 116
+.byte 114
+.byte 97
+.byte 99
+.byte 116
+.byte 45
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 111
+.byte 114
+.byte 0
+@S25:
+.byte 68
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S26:
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 95
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 115
+.byte 0
+@S27:
+.byte 105
+.byte 100
+.byte 108
+.byte 0
+@S28:
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 95
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 0
+@S29:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 112
+.byte 97
+.byte 114
+.byte 115
+.byte 101
+.byte 114
+.byte 46
+.byte 99
+.byte 0
+@S30:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S31:
+.byte 68
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S32:
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 95
+.byte 115
+.byte 112
+.byte 101
+.byte 99
+.byte 115
+.byte 0
+@S33:
+.byte 105
+.byte 100
+.byte 108
+.byte 0
+@S34:
+.byte 97
+.byte 116
+.byte 116
+.byte 114
+.byte 46
+.byte 101
+.byte 0
+@S35:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 112
+.byte 114
+.byte 105
+.byte 109
+.byte 97
+.byte 114
+.byte 121
+.byte 45
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 59
+.byte 32
+.byte 102
+.byte 111
+.byte 117
+.byte 110
+.byte 100
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 45
+.byte 110
+.byte 97
+.byte 109
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S36:
+.byte 117
+.byte 110
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 100
+.byte 101
+.byte 110
+.byte 116
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S37:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 112
+.byte 114
+.byte 105
+.byte 109
+.byte 97
+.byte 114
+.byte 121
+.byte 45
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 59
+.byte 32
+.byte 102
+.byte 111
+.byte 117
+.byte 110
+.byte 100
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S38:
+.byte 68
+.byte 101
+.byte 99
+.byte 108
+.byte 76
+.byte 105
+.byte 115
+.byte 116
+.byte 0
+@S39:
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 0
+@S40:
+.byte 110
+.byte 101
+.byte 120
+.byte 116
+.byte 0
+@S41:
+.byte 119
+.byte 98
+.byte 0
+@S42:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 0
+@S43:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 105
+.byte 102
+.byte 41
+.byte 0
+@S44:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 41
+.byte 0
+@S45:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 119
+.byte 104
+.byte 105
+.byte 108
+.byte 101
+.byte 41
+.byte 0
+@S46:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 100
+.byte 111
+.byte 41
+.byte 0
+@S47:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 102
+.byte 111
+.byte 114
+.byte 41
+.byte 0
+@S48:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 101
+.byte 120
+.byte 112
+.byte 45
+.byte 115
+.byte 116
+.byte 109
+.byte 116
+.byte 41
+.byte 0
+@S49:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 98
+.byte 114
+.byte 101
+.byte 97
+.byte 107
+.byte 41
+.byte 0
+@S50:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 99
+.byte 111
+.byte 110
+.byte 116
+.byte 105
+.byte 110
+.byte 117
+.byte 101
+.byte 41
+.byte 0
+@S51:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 114
+.byte 101
+.byte 116
+.byte 117
+.byte 114
+.byte 110
+.byte 41
+.byte 0
+@S52:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 99
+.byte 97
+.byte 115
+.byte 101
+.byte 41
+.byte 0
+@S53:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 100
+.byte 101
+.byte 102
+.byte 97
+.byte 117
+.byte 108
+.byte 116
+.byte 41
+.byte 0
+@S54:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+@S55:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 91
+.byte 49
+.byte 93
+.byte 0
+@S56:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 91
+.byte 50
+.byte 93
+.byte 0
+@S57:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 91
+.byte 51
+.byte 93
+.byte 0
+@S58:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 123
+.byte 125
+.byte 41
+.byte 0
+@S59:
+.byte 108
+.byte 111
+.byte 99
+.byte 97
+.byte 108
+.byte 115
+.byte 0
+@S60:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+@S61:
+.byte 115
+.byte 105
+.byte 98
+.byte 108
+.byte 105
+.byte 110
+.byte 103
+.byte 0
+@S62:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 37
+.byte 115
+.byte 58
+.byte 41
+.byte 0
+@S63:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+@S64:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 103
+.byte 111
+.byte 116
+.byte 111
+.byte 32
+.byte 37
+.byte 115
+.byte 41
+.byte 0
+@S65:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 40
+.byte 41
+.byte 41
+.byte 0
+@S66:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+@S67:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 91
+.byte 49
+.byte 93
+.byte 0
+@S68:
+.byte 115
+.byte 105
+.byte 98
+.byte 108
+.byte 105
+.byte 110
+.byte 103
+.byte 0
+@S69:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 37
+.byte 115
+.byte 41
+.byte 0
+@S70:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+@S71:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 99
+.byte 97
+.byte 115
+.byte 116
+.byte 41
+.byte 0
+@S72:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+@S73:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 91
+.byte 49
+.byte 93
+.byte 0
+@S74:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 37
+.byte 115
+.byte 41
+.byte 0
+@S75:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+@S76:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 91
+.byte 49
+.byte 93
+.byte 0
+@S77:
+.byte 99
+.byte 104
+.byte 105
+.byte 108
+.byte 100
+.byte 91
+.byte 50
+.byte 93
+.byte 0
+@S78:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 37
+.byte 108
+.byte 108
+.byte 117
+.byte 41
+.byte 0
+@S79:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 115
+.byte 116
+.byte 114
+.byte 105
+.byte 110
+.byte 103
+.byte 45
+.byte 108
+.byte 105
+.byte 116
+.byte 101
+.byte 114
+.byte 97
+.byte 108
+.byte 41
+.byte 0
+@S80:
+.byte 69
+.byte 120
+.byte 101
+.byte 99
+.byte 78
+.byte 111
+.byte 100
+.byte 101
+.byte 92
+.byte 110
+.byte 40
+.byte 37
+.byte 115
+.byte 41
+.byte 0
+@S81:
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 32
+.byte 97
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 58
+.byte 32
+.byte 116
+.byte 104
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 115
+.byte 32
+.byte 97
+.byte 114
+.byte 101
+.byte 32
+.byte 100
+.byte 105
+.byte 102
+.byte 102
+.byte 101
+.byte 114
+.byte 101
+.byte 110
+.byte 116
+.byte 0
+@S82:
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 32
+.byte 97
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 58
+.byte 32
+.byte 116
+.byte 104
+.byte 101
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 105
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 105
+.byte 109
+.byte 109
+.byte 117
+.byte 116
+.byte 97
+.byte 98
+.byte 108
+.byte 101
+.byte 0
+@S83:
+.byte 115
+.byte 105
+.byte 98
+.byte 108
+.byte 105
+.byte 110
+.byte 103
+.byte 0
+@S84:
+.byte 117
+.byte 115
+.byte 101
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 116
+.byte 97
+.byte 103
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 116
+.byte 104
+.byte 97
+.byte 116
+.byte 32
+.byte 100
+.byte 111
+.byte 101
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 109
+.byte 97
+.byte 116
+.byte 99
+.byte 104
+.byte 32
+.byte 112
+.byte 114
+.byte 101
+.byte 118
+.byte 105
+.byte 111
+.byte 117
+.byte 115
+.byte 32
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S85:
+.byte 114
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S86:
+.byte 60
+.byte 97
+.byte 110
+.byte 111
+.byte 110
+.byte 121
+.byte 109
+.byte 111
+.byte 117
+.byte 115
+.byte 62
+.byte 0
+@S87:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 105
+.byte 100
+.byte 101
+.byte 110
+.byte 116
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 32
+.byte 111
+.byte 114
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 45
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 97
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 45
+.byte 108
+.byte 105
+.byte 115
+.byte 116
+.byte 0
+@S88:
+.byte 97
+.byte 116
+.byte 116
+.byte 114
+.byte 46
+.byte 101
+.byte 0
+@S89:
+.byte 100
+.byte 105
+.byte 103
+.byte 114
+.byte 97
+.byte 112
+.byte 104
+.byte 32
+.byte 123
+.byte 10
+.byte 0
+@S90:
+.byte 69
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 68
+.byte 101
+.byte 99
+.byte 108
+.byte 0
+@S91:
+.byte 100
+.byte 0
+@S92:
+.byte 115
+.byte 105
+.byte 98
+.byte 108
+.byte 105
+.byte 110
+.byte 103
+.byte 0
+@S93:
+.byte 125
+.byte 10
+.byte 0
+@S94:
+.byte 95
+.byte 95
+.byte 98
+.byte 117
+.byte 105
+.byte 108
+.byte 116
+.byte 105
+.byte 110
+.byte 95
+.byte 118
+.byte 97
+.byte 95
+.byte 115
+.byte 116
+.byte 97
+.byte 114
+.byte 116
+.byte 58
+.byte 32
+.byte 118
+.byte 97
+.byte 95
+.byte 108
+.byte 105
+.byte 115
+.byte 116
+.byte 32
+.byte 111
+.byte 98
+.byte 106
+.byte 101
+.byte 99
+.byte 116
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 101
+.byte 100
+.byte 0
@@ -0,0 +1,57 @@
+#ifndef PCH_H_
+#define PCH_H_
+
+#include "parser.h"
+#include "pre.h"
+
+/*
+ * Precompiled headers.
+ *
+ * A precompiled header is an image of the state reached after
+ * preprocessing and parsing a header: the macro table, the include
+ * guards, and the file scope symbols, tags, struct descriptors and
+ * external declarations. Objects are copied into the image with their
+ * pointers replaced by offsets; loading the image relocates them in
+ * place and interns again the strings that were atoms.
+ *
+ * Function definitions and initialized objects are saved as plain
+ * declarations, followed by the tokens of their definitions, which
+ * each translation unit parses again (see parse_header()).
+ */
+
+typedef unsigned PchOff; /* offset into the image, 0 stands for NULL */
+
+/* what the image contains (the vectors are written in table order) */
+enum {
+    PCH_MACROS,             /* vector of macros */
+    PCH_FILES,              /* vector of guarded/#pragma once files */
+    PCH_ORDINARY_IDS,       /* vector of symbols */
+    PCH_TAGS,               /* vector of tags */
+    PCH_STRUCT_DESCRIPTORS, /* vector of struct descriptors */
+    PCH_EXTERN_IDS,         /* vector of external declarations */
+    PCH_DEFINITIONS,        /* list of tokens */
+    PCH_SCOPE_ID,           /* a plain value */
+    PCH_NROOTS
+};
+
+void pch_write(char *outpath, TokenNode *defs);
+TokenNode *pch_read(char *path);
+
+/* writing */
+PchOff pch_lookup(void *p);
+PchOff pch_copy(void *p, unsigned size);
+void *pch_ptr(PchOff off);
+void pch_set_ptr(PchOff field, PchOff target);
+void pch_set_str(PchOff field, char *s);
+PchOff pch_new_vector(unsigned n);
+void pch_set_elem(PchOff vec, unsigned i, PchOff obj);
+void pch_set_root(int root, unsigned val);
+PchOff pch_type_exp(TypeExp *t);
+PchOff pch_declaration(Declaration *d);
+PchOff pch_pre_tokens(PreTokenNode *p);
+
+/* reading */
+void **pch_get_vector(int root, unsigned *n);
+unsigned pch_get_root(int root);
+
+#endif
@@ -0,0 +1,2195 @@
+#include "pre.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <assert.h>
+#include <stddef.h>
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef _POSIX_MAPPED_FILES
+#include <sys/mman.h>
+#endif
+#include "util/util.h"
+#include "util/atom.h"
+#include "imp_lim.h"
+#include "error.h"
+#include "util/arena.h"
+#include "luxcc.h"
+#include "pch.h"
+
+#define SRC_FILE            curr_source_file
+#define SRC_LINE            curr_line
+#define SRC_COLUMN          src_column
+#define ERROR(...)          emit_error(TRUE, SRC_FILE, SRC_LINE, SRC_COLUMN, __VA_ARGS__)
+#define MACRO_TABLE_SIZE    4093
+#define HASH_VAL(s)         (atom_hash(s)%MACRO_TABLE_SIZE)
+#define FILE_TABLE_SIZE     101
+#define ERR_BUF_SIZ         2048
+#define MIN_PAGE_SIZE       4096
+
+/* get_token()'s possible states */
+typedef enum {
+    STATE_START,
+    STATE_DONE,
+    STATE_INID,
+    STATE_INNUM,
+    STATE_INCHAR,
+    STATE_INSTR,
+    STATE_INCOMMENT1,
+    STATE_INCOMMENT2,
+    STATE_INLINECOMMENT,
+    /*STATE_INCMD*/
+} State;
+typedef enum {
+    FIXED_LIST,
+    VAR_LIST
+} ParaListKind;
+typedef struct Macro Macro;
+typedef struct FileInfo FileInfo;
+
+static char *default_angle_dirs[] = {
+    "include/",
+    "src/lib/include/",
+    "/usr/local/lib/luxcc/include/",
+};
+static int ndefault_angle_dirs = NELEMS(default_angle_dirs);
+static char *angle_dirs[64];
+static int nangle_dirs;
+static char *quote_dirs[64];
+static int nquote_dirs;
+
+static struct Macro {
+    char *name;
+    MacroKind kind;
+    PreTokenNode *rep, *params;
+    int enabled;
+    Macro *next;
+} *macro_table[MACRO_TABLE_SIZE];
+
+/* include guard detection states */
+enum {
+    GUARD_START,    /* only new-lines read so far */
+    GUARD_OPEN,     /* inside the #ifndef that opened the file */
+    GUARD_CLOSED,   /* the #endif matching that #ifndef was read */
+    GUARD_NONE      /* the file is not wrapped in a guard */
+};
+
+/*
+ * Every file read is remembered (by path) until the end of the
+ * translation unit. Its contents are kept so later inclusions do
+ * not have to read it again, and, if the whole file was found to
+ * be wrapped in
+ *      #ifndef X
+ *      ...
+ *      #endif
+ * or it contained `#pragma once', later inclusions are skipped
+ * entirely while X remains defined (always for #pragma once).
+ */
+static struct FileInfo {
+    char *path;         /* atom */
+    char *contents;     /* '\0'-terminated */
+    char *guard;        /* X above */
+    int guard_state;
+    int guard_level;    /* if_nest_level at the guard's #ifndef */
+    char once;
+    FileInfo *next;
+} *file_table[FILE_TABLE_SIZE];
+
+static FileInfo *curr_file;
+static char *curr, *curr_source_file;
+static char token_string[MAX_LOG_LINE_LEN+1];
+static PreTokenNode *curr_tok;
+static int curr_line, curr_column;
+static int src_column; /* token's first char column # */
+static int at_line_start; /* nothing has been read from the current line */
+static PreTokenNode *out_head; /* first token not yet handed to the lexer */
+static PreTokenNode *free_nodes; /* recycled nodes */
+static Arena *pre_str_arena;
+static Arena *pre_node_arena;
+
+/* files whose reading was suspended by an #include */
+static struct IncFile {
+    FileInfo *file;
+    char *curr;
+    int line, column;
+    struct IncFile *prev;
+} *inc_stack;
+
+/* state of the conditional inclusion directives being processed */
+static struct {
+    char outer_skip; /* the whole if-section is within a skipped group */
+    char taken;      /* some group of the if-section was already included */
+    char in_else;    /* #else was seen */
+    char skip;       /* the current group is being skipped */
+} if_stack[MAX_IF_NEST];
+static int if_nest_level;
+
+/* atoms of the spellings the preprocessor looks for */
+enum {
+    A_SHARP, A_IF, A_IFDEF, A_IFNDEF, A_ELIF, A_ELSE, A_ENDIF,
+    A_INCLUDE, A_DEFINE, A_UNDEF, A_ERROR, A_NEWLINE, A_LT, A_GT,
+    A_LPAREN, A_RPAREN, A_COMMA, A_ELLIPSIS, A_VA_ARGS, A_FILE, A_LINE,
+    A_PRAGMA, A_ONCE, NPRE_ATOMS
+};
+static char *pre_atom_spellings[NPRE_ATOMS] = {
+    "#", "if", "ifdef", "ifndef", "elif", "else", "endif",
+    "include", "define", "undef", "error", "\n", "<", ">",
+    "(", ")", ",", "...", "__VA_ARGS__", "__FILE__", "__LINE__",
+    "pragma", "once"
+};
+static char *pre_atoms[NPRE_ATOMS];
+
+static char *dup_lexeme(const char *s)
+{
+    char *t;
+    unsigned len;
+
+    if (!s)
+        return NULL;
+    len = strlen(s);
+    t = arena_alloc(pre_str_arena, len+1);
+    memcpy(t, s, len+1);
+    return t;
+}
+
+/*
+ * Note: `lexeme' is not copied. The lexemes of all the tokens
+ * but string literals are atoms; string literals are duplicated
+ * once when they are read and shared by all the copies of the
+ * token (the lexer converts them without modifying them).
+ */
+static PreTokenNode *new_node(PreToken token, char *lexeme)
+{
+    PreTokenNode *temp;
+
+    if (free_nodes != NULL) {
+        temp = free_nodes;
+        free_nodes = free_nodes->next;
+    } else {
+        temp = arena_alloc(pre_node_arena, sizeof(PreTokenNode));
+    }
+    temp->token = token;
+    temp->lexeme = lexeme;
+    temp->next = NULL;
+    temp->deleted = FALSE;
+    temp->no_expand = FALSE;
+    temp->src_line = curr_line;
+    temp->src_column = src_column;
+    temp->src_file = curr_source_file;
+    ++stat_number_of_pre_tokens;
+    return temp;
+}
+
+/*
+ * Return a node to the free list. The node's
+ * lexeme is not released (other nodes or the
+ * C tokens may be sharing it).
+ */
+void free_pre_token(PreTokenNode *p)
+{
+    p->next = free_nodes;
+    free_nodes = p;
+}
+
+/* return the information about `path' (an atom), creating it if needed */
+static FileInfo *get_file_info(char *path)
+{
+    FileInfo *fi;
+    unsigned h;
+
+    h = atom_hash(path)%FILE_TABLE_SIZE;
+    for (fi = file_table[h]; fi != NULL; fi = fi->next)
+        if (fi->path == path)
+            return fi;
+    fi = malloc(sizeof(FileInfo));
+    fi->path = path;
+    fi->contents = NULL;
+    fi->guard = NULL;
+    fi->guard_state = GUARD_NONE;
+    fi->guard_level = 0;
+    fi->once = FALSE;
+    fi->next = file_table[h];
+    file_table[h] = fi;
+    return fi;
+}
+
+/*
+ * Read the contents of a file. The file is mapped into memory
+ * when there is room in its last page for the terminating '\0'
+ * (the part of the page past the end of the file reads as zeros);
+ * otherwise (or if the C library has no mmap()) it is read into
+ * a buffer. The contents are never released.
+ */
+static void read_contents(FileInfo *fi)
+{
+    int fd;
+    long flen, n, r;
+    char *p;
+
+    if ((fd=open(fi->path, O_RDONLY, 0)) == -1)
+        TERMINATE("Error reading file `%s'", fi->path);
+
+    flen = lseek(fd, 0, SEEK_END);
+#ifdef _POSIX_MAPPED_FILES
+    if (flen>0 && flen%MIN_PAGE_SIZE!=0
+    && (p=mmap(NULL, flen, PROT_READ, MAP_PRIVATE, fd, 0))!=MAP_FAILED) {
+        ;
+    } else
+#endif
+    {
+        if (flen < 0)
+            flen = 0;
+        p = malloc(flen+1);
+        lseek(fd, 0, SEEK_SET);
+        n = 0;
+        while (n<flen && (r=read(fd, p+n, flen-n))>0)
+            n += r;
+        p[n] = '\0';
+    }
+    close(fd);
+    fi->contents = p;
+}
+
+/*
+ * Start reading a file. The file currently being
+ * read (if any) is suspended until the end of the
+ * new one is reached.
+ */
+static void init(char *file_path)
+{
+    FileInfo *fi;
+
+    fi = get_file_info(atom(file_path));
+    if (fi->contents == NULL)
+        read_contents(fi);
+
+    if (curr_file != NULL) {
+        struct IncFile *f;
+
+        f = malloc(sizeof(struct IncFile));
+        f->file = curr_file;
+        f->curr = curr;
+        f->line = curr_line;
+        f->column = curr_column;
+        f->prev = inc_stack;
+        inc_stack = f;
+    }
+
+    curr_file = fi;
+    curr = fi->contents;
+    fi->guard_state = GUARD_START;
+    /*
+     * Set the current file global var. Each token has attached
+     * the name of the file from where it was obtained. This is
+     * used for diagnostic messages.
+     */
+    curr_source_file = fi->path;
+    curr_line = 1, curr_column = 0;
+    at_line_start = TRUE;
+}
+
+/*
+ * The end of an included file was reached,
+ * resume reading the file that included it.
+ */
+static void resume_includer(void)
+{
+    struct IncFile *f;
+
+    f = inc_stack;
+    curr_file = f->file;
+    curr = f->curr;
+    curr_source_file = curr_file->path;
+    curr_line = f->line;
+    curr_column = f->column;
+    inc_stack = f->prev;
+    free(f);
+    at_line_start = TRUE;
+}
+
+static char *dupdir(char *dir)
+{
+    int n;
+    char *p;
+
+    n = strlen(dir);
+    if (dir[n-1] != '/') {
+        p = malloc(n+2);
+        strcpy(p, dir);
+        strcat(p, "/");
+    } else {
+        p = malloc(n+1);
+        strcpy(p, dir);
+    }
+    return p;
+}
+
+void add_angle_dir(char *dir)
+{
+    angle_dirs[nangle_dirs++] = dupdir(dir);
+}
+
+void add_quote_dir(char *dir)
+{
+    quote_dirs[nquote_dirs++] = dupdir(dir);
+}
+
+static char *search_angle(char *inc_arg)
+{
+    int i;
+    char *path;
+
+    /*
+     * 1) Search in the directories specified
+     * through '-I' options.
+     */
+    path = malloc(256);
+    for (i = 0; i < nangle_dirs; i++) {
+        strcpy(path, angle_dirs[i]);
+        strcat(path, inc_arg);
+        if (file_exists(path))
+            return path;
+    }
+
+    /*
+     * 2) Search in the default directories.
+     */
+    for (i = 0; i < ndefault_angle_dirs; i++) {
+        strcpy(path, default_angle_dirs[i]);
+        strcat(path, inc_arg);
+        if (file_exists(path))
+            return path;
+    }
+
+    /* not found */
+    free(path);
+    return NULL;
+}
+
+static char *search_quote(char *inc_arg)
+{
+    int i;
+    char *p, *path;
+
+    /*
+     * 1) Search in the same directory as the file
+     * that contains the #include directive.
+     */
+    p = strrchr(curr_source_file, '/');
+    if (p == NULL) {
+        /* the file being processed is in the compiler's working directory */
+        path = strdup(inc_arg);
+    } else {
+        int n;
+
+        /* Construct the path. For example if the file being processed
+           is src/foo.c and the argument of #include is "foo.h", the
+           resulting path is src/foo.h. */
+        n = p-curr_source_file+1;
+        path = malloc(n+strlen(inc_arg)+1);
+        strncpy(path, curr_source_file, n);
+        path[n] = '\0';
+        strcat(path, inc_arg);
+    }
+    if (file_exists(path))
+        return path;
+    else
+        free(path);
+
+    /*
+     * 2) Search in the directories specified
+     * through '-i' options.
+     */
+    path = malloc(256);
+    for (i = 0; i < nquote_dirs; i++) {
+        strcpy(path, quote_dirs[i]);
+        strcat(path, inc_arg);
+        if (file_exists(path))
+            return path;
+    }
+
+    /*
+     * 3) Search in the same places as for "<...>".
+     */
+    return search_angle(inc_arg);
+}
+
+static PreTokenNode *next_node(PreTokenNode *p);
+
+static PreToken lookahead(int i)
+{
+    PreTokenNode *p;
+
+    p = curr_tok;
+    while (--i)
+        p = next_node(p);
+    return p->token;
+}
+
+static char *get_lexeme(int i)
+{
+    PreTokenNode *p;
+
+    p = curr_tok;
+    while (--i)
+        p = next_node(p);
+    return p->lexeme;
+}
+
+static int get_next_char(void)
+{
+    if (*curr == '\0')
+        return '\0';
+
+    if (*curr == '\r') {
+        ++curr;
+        if (*curr == '\n') /* DOS EOL */
+            ++curr;
+        return '\n';
+    }
+
+    while (*curr=='\\' && (*(curr+1)=='\n' || *(curr+1)=='\r')) {
+        ++curr;
+        if (*curr=='\r' && *(curr+1)=='\n')
+            ++curr;
+        ++curr;
+        ++curr_line, curr_column=0;
+    }
+
+    return *curr++;
+}
+
+static int peek(int n)
+{
+    char *cp = curr;
+
+next:
+    if (*curr == '\0')
+        return '\0';
+
+    if (*cp == '\r') {
+        ++cp;
+        if (*cp == '\n')
+            ++cp;
+        if (--n)
+            goto next;
+        return '\n';
+    }
+
+    while (*cp=='\\' && (*(cp+1)=='\n' || *(cp+1)=='\r')) {
+        ++cp;
+        if (*cp=='\r' && *(cp+1)=='\n')
+            ++cp;
+        ++cp;
+    }
+
+    if (--n) {
+        ++cp;
+        goto next;
+    }
+    return *cp;
+}
+
+/*
+ * Return the next token.
+ * Start to read at `curr'.
+ * The lexeme is left into `token_string[]'.
+ */
+static PreToken get_token(void)
+{
+    State state;
+    PreToken token;
+    int tok_str_ind, save, cb;
+
+    cb = 0; /* consecutive backslashes counter (even = stop, odd = don't stop) */
+    tok_str_ind = 0;
+    state = STATE_START;
+
+    while (state != STATE_DONE) {
+        int c;
+
+        c = get_next_char();
+        save = TRUE;
+        ++curr_column;
+
+        switch (state) {
+        case STATE_START:
+            src_column = curr_column-1;
+            if (c==' ' || c=='\t' /* add other desired white space chars here */) {
+                save = FALSE;
+            } else if (isdigit(c)) {
+                state = STATE_INNUM;
+            } else if (isalpha(c) || (c=='_')) {
+                state = STATE_INID;
+            } else if (c == '\'') {
+                save = FALSE;
+                state = STATE_INCHAR;
+            } else if (c == '\"') {
+                state = STATE_INSTR;
+            } else if ((c=='/') && ((peek(1)=='/')||(peek(1)=='*'))) { // /* or //
+                save = FALSE;
+                if (peek(1) == '/')
+                    state = STATE_INLINECOMMENT;
+                else
+                    state = STATE_INCOMMENT1;
+            } else {
+                state = STATE_DONE;
+                switch (c) {
+                case '\0':
+                    save = FALSE;
+                    token = PRE_TOK_EOF;
+                    break;
+                case '\n':
+                    token = PRE_TOK_NL;
+                    ++curr_line, curr_column=0;
+                    break;
+                /*
+                 * single-char punctuators
+                 */
+                case '(':
+                case ')':
+                case '[':
+                case ']':
+                case '{':
+                case '}':
+                case ';':
+                case ',':
+                case '\?':
+                case ':':
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                /*
+                 * multi-char punctuators
+                 */
+#define ADVANCE() (get_next_char())
+#define REWIND()  (--curr_column, --curr)
+#define SAVE_AND_ADVANCE() token_string[tok_str_ind++] = (char)c, c = ADVANCE()
+                case '+': /* +, ++ or += */
+                    if (peek(1)=='+' || peek(1)=='=')
+                        SAVE_AND_ADVANCE();
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                case '-': /* -, --, -> or -= */
+                    if (peek(1)=='-' || peek(1)=='>' || peek(1)=='=')
+                        SAVE_AND_ADVANCE();
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                case '*': /* * or *= */
+                    if (peek(1) == '=')
+                        SAVE_AND_ADVANCE();
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                case '/': /* / or /= */
+                    if (peek(1) == '=')
+                        SAVE_AND_ADVANCE();
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                case '%': /* % or %= */
+                    if (peek(1) == '=')
+                        SAVE_AND_ADVANCE();
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                case '^': /* ^ or ^= */
+                    if (peek(1) == '=')
+                        SAVE_AND_ADVANCE();
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                case '~': /* ~ or ~= */
+                    if (peek(1) == '=')
+                        SAVE_AND_ADVANCE();
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                case '=': /* = or == */
+                    if (peek(1) == '=')
+                        SAVE_AND_ADVANCE();
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                case '|': /* |, || or |= */
+                    if (peek(1)=='|' || peek(1)=='=')
+                        SAVE_AND_ADVANCE();
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                case '&': /* &, && or &= */
+                    if (peek(1)=='&' || peek(1)=='=')
+                        SAVE_AND_ADVANCE();
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                case '!': /* ! or != */
+                    if (peek(1) == '=')
+                        SAVE_AND_ADVANCE();
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                case '#': /* # or ## */
+                    if (peek(1) == '#')
+                        SAVE_AND_ADVANCE();
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                case '<': /* <, <=, << or <<= */
+                    if (peek(1) == '=') {
+                        SAVE_AND_ADVANCE();
+                    } else if (peek(1) == '<') {
+                        SAVE_AND_ADVANCE();
+                        if (peek(1) == '=')
+                            SAVE_AND_ADVANCE();
+                    }
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                case '>': /* >, >=, >> or >>= */
+                    if (peek(1) == '=') {
+                        SAVE_AND_ADVANCE();
+                    } else if (peek(1) == '>') {
+                        SAVE_AND_ADVANCE();
+                        if (peek(1) == '=')
+                            SAVE_AND_ADVANCE();
+                    }
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                case '.': /* . or ... */
+                    if (peek(1)=='.' && peek(2)=='.') {
+                        SAVE_AND_ADVANCE();
+                        SAVE_AND_ADVANCE();
+                    }
+                    token = PRE_TOK_PUNCTUATOR;
+                    break;
+                default:
+                    /*
+                     * In ASCII, characters included in the 'other' group are @, $, `, and
+                     * any control characters other than NUL.
+                     */
+                    token = PRE_TOK_OTHER;
+                    break;
+                } /* switch (c) */
+            }
+            break; /* STATE_START */
+        case STATE_INNUM:
+        case STATE_INID:
+            if (!isalpha(c) && !isdigit(c) && (c!='_')) {
+                save = FALSE;
+                REWIND();
+                token = (state==STATE_INNUM)?PRE_TOK_NUM:PRE_TOK_ID;
+                state = STATE_DONE;
+            }
+            break;
+        case STATE_INCHAR:
+            if (c=='\0' || c=='\n') {
+                ERROR("missing terminating \"'\" character");
+            } else if (c=='\'' && cb%2==0) {
+                if (tok_str_ind == 0) {
+                    ERROR("empty character constant");
+                } else {
+                    save = FALSE;
+                    state = STATE_DONE;
+                    token = PRE_TOK_CHACON;
+                }
+            } else if (c == '\\') {
+                ++cb;
+            } else {
+                cb = 0;
+            }
+            break;
+        case STATE_INSTR:
+            if (c=='\0' || c=='\n') {
+                ERROR("missing terminating '\"' character");
+            } if (c=='\"' && cb%2==0) {
+                state = STATE_DONE;
+                token = PRE_TOK_STRLIT;
+            } else if (c == '\\') {
+                ++cb;
+            } else {
+                cb = 0;
+            }
+            break;
+        case STATE_INCOMMENT1:
+            save = FALSE;
+            if (c == '\0')
+                ERROR("unterminated comment");
+            else if (c == '*')
+                state = STATE_INCOMMENT2;
+            else if (c == '\n')
+                ++curr_line, curr_column=0;
+            break;
+        case STATE_INCOMMENT2:
+            save = FALSE;
+            if (c == '\0') {
+                ERROR("unterminated comment");
+            } else if (c == '/') {
+                state = STATE_START;
+            } else if (c != '*') {
+                state = STATE_INCOMMENT1;
+                if (c == '\n')
+                    ++curr_line, curr_column=0;
+            }
+            break;
+        case STATE_INLINECOMMENT:
+            save = FALSE;
+            if (c == '\n') {
+                REWIND();
+                state = STATE_START;
+            } else if (c == '\0') {
+                /* get_next_char() doesn't go past the '\0' */
+                state = STATE_START;
+            }
+            break;
+        case STATE_DONE:
+        default:
+            assert(0);
+            break;
+        } /* switch (state) */
+
+        if (save) {
+            if (tok_str_ind > MAX_LOG_LINE_LEN)
+                TERMINATE("Logical line exceeds maximum length of %u characters", MAX_LOG_LINE_LEN);
+            token_string[tok_str_ind++] = (char)c;
+        }
+        if (state == STATE_DONE)
+            token_string[tok_str_ind] = '\0';
+    } /* while (state != STATE_DONE) */
+
+    return token;
+}
+
+/*
+ * Tokenize the next line of the file being read and append
+ * the resulting tokens to `p'. The end of an included file
+ * doesn't produce an EOF token, the tokenization continues
+ * with the file that included it. If the last line of a file
+ * is not terminated by a new-line, one is supplied.
+ */
+static void tokenize_line(PreTokenNode *p)
+{
+    PreToken tok;
+    char *lexeme;
+
+    for (;;) {
+        tok = get_token();
+        if (tok == PRE_TOK_EOF) {
+            if (!at_line_start) {
+                tok = PRE_TOK_NL;
+                strcpy(token_string, "\n");
+            } else if (inc_stack != NULL) {
+                resume_includer();
+                continue;
+            }
+        }
+        if (tok == PRE_TOK_STRLIT)
+            lexeme = dup_lexeme(token_string);
+        else
+            lexeme = atom(token_string);
+        p->next = new_node(tok, lexeme);
+        p->next->next_char = *curr;
+        p = p->next;
+        at_line_start = (tok == PRE_TOK_NL);
+        if (tok==PRE_TOK_NL || tok==PRE_TOK_EOF)
+            break;
+    }
+}
+
+/*
+ * Return the token that follows `p'. Lines
+ * are tokenized as they are needed.
+ */
+static PreTokenNode *next_node(PreTokenNode *p)
+{
+    if (p->token == PRE_TOK_EOF)
+        return p;
+    if (p->next == NULL)
+        tokenize_line(p);
+    return p->next;
+}
+
+#undef SRC_FILE
+#undef SRC_LINE
+#undef SRC_COLUMN
+#define SRC_FILE    curr_tok->src_file
+#define SRC_LINE    curr_tok->src_line
+#define SRC_COLUMN  curr_tok->src_column
+
+void install_macro(MacroKind kind, char *name, PreTokenNode *rep, PreTokenNode *params)
+{
+    Macro *np;
+    unsigned h;
+
+    name = atom(name);
+    h = HASH_VAL(name);
+	for(np = macro_table[h]; np != NULL; np = np->next)
+		if(np->enabled && name == np->name)
+			break;
+
+    if (np == NULL) { /* not found */
+        np = malloc(sizeof(Macro));
+        np->kind = kind;
+        np->name = name;
+        np->rep = rep;
+        np->enabled = TRUE;
+        np->params = params;
+        np->next = macro_table[h];
+        macro_table[h] = np;
+    } else {
+        ERROR("macro `%s' redefined", name);
+    }
+}
+
+static void uninstall_macro(char *name)
+{
+    unsigned h;
+	Macro *np, *prev;
+
+    h = HASH_VAL(name);
+	for(np=macro_table[h], prev=NULL;
+        np!=NULL && name != np->name;
+        prev=np, np=np->next);
+
+	if (np == NULL)
+        return; /* not found */
+    if (prev == NULL)
+        macro_table[h] = np->next;
+    else
+        prev->next = np->next;
+    free(np);
+}
+
+static Macro *lookup_macro(char *name)
+{
+	Macro *np;
+
+	for(np = macro_table[HASH_VAL(name)]; np != NULL; np = np->next)
+		if(np->enabled && name == np->name)
+			return np;
+	return NULL;
+}
+
+/* like lookup_macro(), but a disabled macro is returned if there is no other */
+static Macro *find_macro(char *name)
+{
+    Macro *np, *disabled;
+
+    disabled = NULL;
+    for (np = macro_table[HASH_VAL(name)]; np != NULL; np = np->next) {
+        if (name == np->name) {
+            if (np->enabled)
+                return np;
+            disabled = np;
+        }
+    }
+    return disabled;
+}
+
+static void reenable_macro(char *name)
+{
+    Macro *m;
+
+    for(m = macro_table[HASH_VAL(name)]; m != NULL; m = m->next) {
+        if(name == m->name) {
+            m->enabled = TRUE;
+            break;
+        }
+    }
+}
+
+static char *pre_token_table[] = {
+    "EOF", "punctuator",
+    "preprocessor number", "identifier",
+    "character constant", "string literal",
+    "new line", "other"
+};
+
+static void match(PreToken x)
+{
+    if (curr_tok->token == x)
+        curr_tok = next_node(curr_tok);
+    else
+        ERROR("expecting: `%s'; found: `%s'", pre_token_table[x], curr_tok->lexeme);
+}
+
+/* same as match but mark the token as deleted */
+static void match2(PreToken x)
+{
+    if (curr_tok->token == x) {
+        curr_tok->deleted = TRUE;
+        curr_tok = next_node(curr_tok);
+    } else {
+        ERROR("expecting: `%s'; found: `%s'", pre_token_table[x], curr_tok->lexeme);
+    }
+}
+
+/* parser functions */
+static void group_part(void);
+static void if_group(int skip);
+static void elif_group(void);
+static void else_group(void);
+static void endif_line(void);
+static void control_line(int skip);
+static void pp_tokens(int skip);
+static void preprocessing_token(int skip);
+
+static long long pre_eval_expr(void);
+static long long pre_eval_cond_expr(void);
+static long long pre_eval_OR_expr(void);
+static long long pre_eval_AND_expr(void);
+static long long pre_eval_bwOR_expr(void);
+static long long pre_eval_bwXOR_expr(void);
+static long long pre_eval_bwAND_expr(void);
+static long long pre_eval_equ_expr(void);
+static long long pre_eval_rel_expr(void);
+static long long pre_eval_shi_expr(void);
+static long long pre_eval_add_expr(void);
+static long long pre_eval_mul_expr(void);
+static long long pre_eval_una_expr(void);
+static long long pre_eval_pri_expr(void);
+
+/*
+ * Return the next preprocessing token of the translation unit.
+ *
+ * The preprocessor works one line at a time and only when the lexer
+ * asks for more tokens. The nodes of the tokens deleted during
+ * preprocessing (directives, skipped groups, macro calls, etc.) are
+ * recycled here; the ones returned must be given back by the caller
+ * through free_pre_token(). New-line tokens are returned (marked as
+ * deleted) so that the -p option can reproduce the line structure.
+ *
+ * preprocessing_file = [ group ] end_of_file
+ * group = group_part { group_part }
+ */
+PreTokenNode *get_pre_token(void)
+{
+    PreTokenNode *p;
+
+    for (;;) {
+        while (out_head == curr_tok) {
+            if (curr_tok->token == PRE_TOK_EOF) {
+                if (if_nest_level > 0)
+                    ERROR("`#endif' expected");
+                return curr_tok;
+            }
+            group_part();
+        }
+        p = out_head;
+        out_head = out_head->next;
+        if (!p->deleted || p->token==PRE_TOK_NL)
+            return p;
+        free_pre_token(p);
+    }
+}
+
+/*
+ * Follow the shape of file `fi' as its lines are processed:
+ * it has an include guard if, new-lines aside, it consists
+ * of a single #ifndef section (without #elif/#else).
+ */
+static void track_include_guard(FileInfo *fi)
+{
+    char *dir;
+
+    if (fi->guard_state==GUARD_NONE || lookahead(1)==PRE_TOK_NL)
+        return;
+    dir = (get_lexeme(1) == pre_atoms[A_SHARP]) ? get_lexeme(2) : NULL;
+    switch (fi->guard_state) {
+    case GUARD_START:
+        if (dir==pre_atoms[A_IFNDEF] && lookahead(3)==PRE_TOK_ID && lookahead(4)==PRE_TOK_NL) {
+            fi->guard = get_lexeme(3);
+            fi->guard_level = if_nest_level;
+            fi->guard_state = GUARD_OPEN;
+        } else {
+            fi->guard_state = GUARD_NONE;
+        }
+        break;
+    case GUARD_OPEN:
+        if (if_nest_level == fi->guard_level+1) {
+            if (dir == pre_atoms[A_ENDIF])
+                fi->guard_state = GUARD_CLOSED;
+            else if (dir==pre_atoms[A_ELIF] || dir==pre_atoms[A_ELSE])
+                fi->guard_state = GUARD_NONE;
+        }
+        break;
+    case GUARD_CLOSED: /* something after the #endif */
+        fi->guard_state = GUARD_NONE;
+        break;
+    }
+}
+
+/*
+ * group_part = [ pp_tokens ] new_line |
+ *              if_section |
+ *              control_line
+ *
+ * if_section = if_group [ elif_groups ] [ else_group ] endif_line
+ * elif_groups = elif_group { elif_group }
+ *
+ * The groups of the if-sections are not parsed recursively, instead
+ * the state of each unfinished if-section is kept in `if_stack[]'.
+ */
+void group_part(void)
+{
+    int skip;
+
+    skip = (if_nest_level > 0) ? if_stack[if_nest_level-1].skip : FALSE;
+    track_include_guard(get_file_info(curr_tok->src_file));
+    if (get_lexeme(1) == pre_atoms[A_SHARP]) {
+        if (get_lexeme(2) == pre_atoms[A_IF]
+        ||  get_lexeme(2) == pre_atoms[A_IFDEF]
+        ||  get_lexeme(2) == pre_atoms[A_IFNDEF])
+            if_group(skip);
+        else if (get_lexeme(2) == pre_atoms[A_ELIF])
+            elif_group();
+        else if (get_lexeme(2) == pre_atoms[A_ELSE])
+            else_group();
+        else if (get_lexeme(2) == pre_atoms[A_ENDIF])
+            endif_line();
+        else
+            control_line(skip);
+    } else {
+        if (lookahead(1) != PRE_TOK_NL)
+            pp_tokens(skip);
+        match2(PRE_TOK_NL);
+    }
+}
+
+/*
+ * if_group = "#" "if" constant_expression new_line [ group ] |
+ *            "#" "ifdef" identifier new_line [ group ] |
+ *            "#" "ifndef" identifier new_line [ group ]
+ */
+void if_group(int skip)
+{
+    long long cond_res;
+
+    if (if_nest_level >= MAX_IF_NEST)
+        ERROR("conditional inclusion directives nested too deeply");
+
+    /*
+     * group_part() confirmed either #if, #ifdef or #ifndef
+     */
+    match2(PRE_TOK_PUNCTUATOR); /* # */
+    if (get_lexeme(1) == pre_atoms[A_IF]) {
+        match2(PRE_TOK_ID);
+        cond_res = pre_eval_expr();
+    } else if (get_lexeme(1) == pre_atoms[A_IFDEF]) {
+        match2(PRE_TOK_ID);
+        cond_res = (lookup_macro(get_lexeme(1)) != NULL);
+        match2(PRE_TOK_ID);
+    } else { /* ifndef */
+        match2(PRE_TOK_ID);
+        cond_res = (lookup_macro(get_lexeme(1)) == NULL);
+        match2(PRE_TOK_ID);
+    }
+    match2(PRE_TOK_NL);
+
+    /*
+     * Skip if the condition evaluated to false or if the
+     * if/ifdef/ifndef already is within of a block being skipped.
+     */
+    if_stack[if_nest_level].outer_skip = (char)skip;
+    if_stack[if_nest_level].taken = (cond_res != 0);
+    if_stack[if_nest_level].in_else = FALSE;
+    if_stack[if_nest_level].skip = (cond_res==0)?1:(char)skip;
+    ++if_nest_level;
+}
+
+/*
+ * elif_group = "#" "elif" constant_expression new_line [ group ]
+ */
+void elif_group(void)
+{
+    long long cond_res;
+
+    if (if_nest_level == 0)
+        ERROR("`#elif' without `#if'");
+    if (if_stack[if_nest_level-1].in_else)
+        ERROR("`#endif' expected");
+
+    /*
+     * group_part() confirmed # and elif
+     */
+    match2(PRE_TOK_PUNCTUATOR);
+    match2(PRE_TOK_ID);
+    cond_res = pre_eval_expr();
+    match2(PRE_TOK_NL);
+
+    if_stack[if_nest_level-1].skip = (cond_res==0)?1:(if_stack[if_nest_level-1].outer_skip
+                                                     || if_stack[if_nest_level-1].taken);
+    if (cond_res)
+        if_stack[if_nest_level-1].taken = TRUE;
+}
+
+/*
+ * else_group = "#" "else" new_line [ group ]
+ */
+void else_group(void)
+{
+    if (if_nest_level == 0)
+        ERROR("`#else' without `#if'");
+    if (if_stack[if_nest_level-1].in_else)
+        ERROR("`#endif' expected");
+
+    /*
+     * group_part() confirmed # and else
+     */
+    match2(PRE_TOK_PUNCTUATOR); /* # */
+    match2(PRE_TOK_ID); /* else */
+    match2(PRE_TOK_NL);
+
+    if_stack[if_nest_level-1].skip = if_stack[if_nest_level-1].outer_skip || if_stack[if_nest_level-1].taken;
+    if_stack[if_nest_level-1].in_else = TRUE;
+}
+
+/*
+ * endif_line = "#" "endif" new_line
+ */
+void endif_line(void)
+{
+    if (if_nest_level == 0)
+        ERROR("`#endif' without `#if'");
+
+    /*
+     * group_part() confirmed # and endif
+     */
+    match2(PRE_TOK_PUNCTUATOR); /* # */
+    match2(PRE_TOK_ID); /* endif */
+    match2(PRE_TOK_NL);
+    --if_nest_level;
+}
+
+/*
+ * Remove the `.' components, the repeated slashes and
+ * the `dir/..' pairs from `path' (in place), so that the
+ * different spellings of the path of a file (for example
+ * "sub/s.h" and "./sub/s.h") share the same FileInfo.
+ */
+static void simplify_path(char *path)
+{
+    char *s, *d, *root, *q;
+
+    s = d = path;
+    if (*s == '/')
+        *d++ = *s++;
+    root = d;
+    while (*s != '\0') {
+        if (*s == '/') {
+            ++s;
+        } else if (s[0]=='.' && (s[1]=='/' || s[1]=='\0')) {
+            ++s;
+        } else if (s[0]=='.' && s[1]=='.' && (s[2]=='/' || s[2]=='\0')
+        && d>root && !(d-root>=3 && d[-3]=='.' && d[-2]=='.' && (d-3==root || d[-4]=='/'))) {
+            /* drop the previous component (unless it is a `..' itself) */
+            for (q = d-1; q>root && q[-1]!='/'; q--)
+                ;
+            d = q;
+            s += 2;
+        } else {
+            while (*s!='\0' && *s!='/')
+                *d++ = *s++;
+            if (*s == '/')
+                *d++ = *s++;
+        }
+    }
+    if (d>root && d[-1]=='/')
+        --d;
+    *d = '\0';
+}
+
+/*
+ * #include the file at `path', unless that
+ * would not change the translation unit.
+ */
+static void include_file(char *path)
+{
+    FileInfo *fi;
+
+    simplify_path(path);
+    fi = get_file_info(atom(path));
+    if (fi->once
+    || (fi->guard_state==GUARD_CLOSED && lookup_macro(fi->guard)!=NULL))
+        return;
+    init(path);
+}
+
+static void simple_define(void);
+static void parameterized_define(void);
+
+/*
+ * control_line = "#" "include" pp_tokens new_line |
+ *                "#" "define" identifier replacement_list new_line |
+ *                "#" "define" identifier lparen [ identifier_list ] ")" replacement_list new_line |
+ *                "#" "undef" identifier new_line |
+ *                "#" "line" pp_tokens new_line |
+ *                "#" "error" [ pp_tokens ] new_line |
+ *                "#" "pragma" [ pp_tokens ] new_line |
+ *                "#" new_line
+ */
+void control_line(int skip)
+{
+    if (skip)
+        goto bottom;
+
+    /* by group_part() confirmed # */
+    match2(PRE_TOK_PUNCTUATOR);
+
+    /*
+     * Identify and interpret directive.
+     */
+    if (get_lexeme(1) == pre_atoms[A_INCLUDE]) {
+        char inc_arg[256], *path;
+
+        match2(PRE_TOK_ID);
+        /*
+         * The only supported forms of the include directive are:
+         *      #include "file.h"
+         *      #include <file.h>
+         */
+        if (lookahead(1) == PRE_TOK_STRLIT) {
+            curr_source_file = curr_tok->src_file; /* search_quote() uses curr_source_file */
+            strcpy(inc_arg, curr_tok->lexeme+1);
+            inc_arg[strlen(inc_arg)-1] = '\0';
+            if ((path=search_quote(inc_arg)) == NULL)
+                ERROR("include: cannot find file `%s'", inc_arg);
+            include_file(path);
+            free(path);
+            match2(lookahead(1)); /* filename */
+        } else if (get_lexeme(1) == pre_atoms[A_LT]) {
+            match2(PRE_TOK_PUNCTUATOR);
+            if (get_lexeme(1) == pre_atoms[A_GT])
+                ERROR("include: empty `<>'");
+            inc_arg[0] = '\0';
+            do {
+                if (lookahead(1) == PRE_TOK_NL)
+                    ERROR("include: missing closing `>'");
+                strcat(inc_arg, get_lexeme(1));
+                match2(lookahead(1));
+            } while (get_lexeme(1) != pre_atoms[A_GT]);
+            if ((path=search_angle(inc_arg)) == NULL)
+                ERROR("include: cannot find file `%s'", inc_arg);
+            include_file(path);
+            free(path);
+            match2(PRE_TOK_PUNCTUATOR); /* > */
+        } else {
+            ERROR("include: \"file.h\" or <file.h> expected");
+        }
+        /*
+         * Now at new-line. The line that follows is
+         * going to be read from the included file.
+         */
+    } else if (get_lexeme(1) == pre_atoms[A_DEFINE]) {
+        match2(PRE_TOK_ID);
+        if (lookahead(1) == PRE_TOK_ID) {
+            if (curr_tok->next_char == '(')
+                parameterized_define();
+            else
+                simple_define();
+        } else {
+            ERROR("define: name expected");
+        }
+    } else if (get_lexeme(1) == pre_atoms[A_UNDEF]) {
+        match2(PRE_TOK_ID);
+        if (lookahead(1) == PRE_TOK_ID)
+            uninstall_macro(get_lexeme(1));
+        else
+            ERROR("undef: name expected");
+    } else if (get_lexeme(1) == pre_atoms[A_ERROR]) {
+        char buf[ERR_BUF_SIZ], *cp;
+
+        buf[0] = '\0';
+        match(PRE_TOK_ID);
+        if (lookahead(1) != PRE_TOK_NL) {
+            strcpy(buf, get_lexeme(1));
+            cp = buf+strlen(get_lexeme(1));
+            match(lookahead(1));
+            while (lookahead(1) != PRE_TOK_NL) {
+                strcat(cp++, " ");
+                strcat(cp, get_lexeme(1));
+                cp += strlen(get_lexeme(1));
+                match(lookahead(1));
+            }
+        }
+        ERROR("%s", buf);
+    } else if (get_lexeme(1) == pre_atoms[A_PRAGMA]) {
+        match2(PRE_TOK_ID);
+        if (get_lexeme(1) == pre_atoms[A_ONCE])
+            get_file_info(curr_tok->src_file)->once = TRUE;
+        /* other pragmas are ignored */
+    } else if (get_lexeme(1) == pre_atoms[A_NEWLINE]) {
+        ; /* NULL directive */
+    /* --> add the remaining directives here <-- */
+    } else {
+        ERROR("unknown directive `%s'", get_lexeme(1));
+    }
+
+bottom:
+    /*
+     * Mark the rest of the line as deleted.
+     */
+    while (lookahead(1) != PRE_TOK_NL)
+        match2(lookahead(1));
+    match2(PRE_TOK_NL);
+}
+
+/*
+ * Make a copy of the rest of the current line (new-line included).
+ * The nodes of the line itself are going to be recycled.
+ */
+static PreTokenNode *copy_line(void)
+{
+    PreTokenNode *p, *copy, *temp;
+
+    p = curr_tok;
+    copy = temp = new_node(p->token, NULL);
+    *temp = *p;
+    while (p->token != PRE_TOK_NL) {
+        p = p->next;
+        temp->next = new_node(p->token, NULL);
+        temp = temp->next;
+        *temp = *p;
+    }
+    temp->next = NULL;
+    return copy;
+}
+
+void simple_define(void)
+{
+    PreTokenNode *def;
+
+    def = copy_line();
+    install_macro(SIMPLE_MACRO, def->lexeme, def->next, NULL);
+}
+
+void parameterized_define(void)
+{
+    /*
+     * TODO: check for duplicate parameter names.
+     */
+
+    PreTokenNode *def, *rep;
+
+    def = copy_line();
+    /*
+     * #define ABC( a1, a2 ... an   )
+     *          ^                   ^
+     *    we are here           and must go here
+     */
+    for (rep = def->next->next; rep->lexeme != pre_atoms[A_RPAREN]; ) {
+        if (rep->lexeme == pre_atoms[A_ELLIPSIS]) {
+            if (rep->next->lexeme != pre_atoms[A_RPAREN])
+                ERROR("`...' not at the end of the parameter list");
+        } else if (rep->token != PRE_TOK_ID) {
+            ERROR("expecting parameter name");
+        }
+
+        rep = rep->next;
+        if (rep->lexeme == pre_atoms[A_COMMA]) {
+            rep = rep->next;
+            if (rep->lexeme == pre_atoms[A_RPAREN]) /* something like #define A(x,) */
+                ERROR("missing parameter name");
+        } else if (rep->lexeme != pre_atoms[A_RPAREN]) {
+            /* otherwise (a,b...) would be considered valid */
+            ERROR("expecting parameter name");
+        }
+    }
+    install_macro(PARAMETERIZED_MACRO, def->lexeme, rep->next, def->next->next);
+}
+
+/*
+ * pp_tokens = preprocessing_token { preprocessing_token }
+ */
+void pp_tokens(int skip)
+{
+    preprocessing_token(skip);
+    while (lookahead(1) != PRE_TOK_NL) /* FOLLOW(pp_tokens) = { "\n" } */
+        preprocessing_token(skip);
+}
+
+static void expand_simple_macro(Macro *m);
+static void expand_parameterized_macro(Macro *m);
+
+/*
+ * preprocessing_token = header_name
+ *                       identifier
+ *                       pp_number
+ *                       character_constant
+ *                       string_literal
+ *                       punctuator
+ *                       each non-white-space character that cannot be one of the above
+ */
+void preprocessing_token(int skip)
+{
+    if (skip) {
+        match2(lookahead(1));
+        return;
+    }
+
+    if (lookahead(1) == PRE_TOK_ID) {
+        Macro *m;
+
+        if (curr_tok->lexeme == pre_atoms[A_FILE]) {
+            /*
+             * Note: __FILE__ depends on the compiler's working directory.
+             * Example invocations and __FILE__'s value:
+             *      (1) luxcc test.c         -> __FILE__="test.c"
+             *      (2) luxcc src/test.c     -> __FILE__="src/test.c"
+             *      (3) luxcc ../test_file.c -> __FILE__="../test_file.c"
+             */
+            unsigned n;
+
+            n = strlen(curr_tok->src_file);
+            curr_tok->lexeme = arena_alloc(pre_str_arena, n+2+1); /* +2 for "", +1 for '\0' */
+            curr_tok->lexeme[0] = '\"';
+            strcpy(curr_tok->lexeme+1, curr_tok->src_file);
+            curr_tok->lexeme[n+1] = '\"';
+            curr_tok->lexeme[n+2] = '\0';
+            curr_tok->token = PRE_TOK_STRLIT;
+            match(lookahead(1));
+        } else if (curr_tok->lexeme == pre_atoms[A_LINE]) {
+            char n[11];
+
+            sprintf(n, "%d", curr_tok->src_line);
+            curr_tok->lexeme = atom(n);
+            curr_tok->token = PRE_TOK_NUM;
+            match(lookahead(1));
+        } else if (!curr_tok->no_expand && (m=find_macro(get_lexeme(1))) != NULL) {
+            DEBUG_PRINTF("found macro `%s'\n", get_lexeme(1));
+            if (!m->enabled) {
+                /*
+                 * The name of a macro found while replacing that macro is
+                 * not replaced, not even when it is rescanned later as part
+                 * of the argument of another macro.
+                 */
+                curr_tok->no_expand = TRUE;
+                match(lookahead(1));
+            } else if (m->kind == SIMPLE_MACRO)
+                expand_simple_macro(m);
+            else
+                expand_parameterized_macro(m);
+        } else {
+            match(lookahead(1));
+        }
+    } else if (lookahead(1) == PRE_TOK_MACRO_REENABLER) {
+        DEBUG_PRINTF("reenabling macro `%s'\n", get_lexeme(1));
+        reenable_macro(get_lexeme(1));
+        match2(PRE_TOK_MACRO_REENABLER);
+    } else {
+        match(lookahead(1));
+    }
+}
+
+static void copy_node_info(PreTokenNode *dest, PreTokenNode *src)
+{
+    dest->src_file = src->src_file;
+    dest->src_line = src->src_line;
+    dest->src_column = src->src_column;
+}
+
+/* duplicate a replacement list */
+static PreTokenNode *dup_rep_list(PreTokenNode *r)
+{
+    PreTokenNode *new_rep_list, *temp;
+
+    /* test for empty replacement list */
+    if (r->token == PRE_TOK_NL)
+        return NULL;
+
+    /* make the duplicate */
+    new_rep_list = temp = new_node(r->token, r->lexeme);
+    copy_node_info(new_rep_list, curr_tok);
+    r = r->next;
+    while (r->token != PRE_TOK_NL) {
+        temp->next = new_node(r->token, r->lexeme);
+        copy_node_info(temp->next, curr_tok);
+        temp = temp->next;
+        r = r->next;
+    }
+    return new_rep_list;
+}
+
+/* expand an object-like macro */
+void expand_simple_macro(Macro *m)
+{
+    PreTokenNode *r, *old_next;
+
+    /* test empty replacement list */
+    if ((r=dup_rep_list(m->rep)) == NULL)
+        goto empty_rep_list;
+    /* insert the replacement list between the identifier and the next token */
+    old_next = curr_tok->next;
+    curr_tok->next = r;
+    while (r->next != NULL)
+        r = r->next;
+    r->next = new_node(PRE_TOK_MACRO_REENABLER, m->name);
+    r->next->next = old_next;
+    m->enabled = FALSE; /* disable the macro temporally */
+empty_rep_list:
+    /* mark the identifier as deleted and advance. */
+    match2(lookahead(1));
+}
+
+/*
+ * Support function for parameterized macro calls.
+ * Make a copy of the token string that conform an argument.
+ * `kind' modifies the main loop stop condition.
+ */
+static PreTokenNode *copy_arg(PreTokenNode **a, ParaListKind kind)
+{
+    int pn; /* parenthesis nesting level counter */
+    PreTokenNode *copy, *temp;
+
+    if ((*a)->token==PRE_TOK_PUNCTUATOR && ((*a)->lexeme == pre_atoms[A_COMMA] || (*a)->lexeme == pre_atoms[A_RPAREN]))
+        ERROR("empty macro argument");
+
+    pn = 0;
+    if ((*a)->token==PRE_TOK_PUNCTUATOR && (*a)->lexeme == pre_atoms[A_LPAREN])
+        ++pn;
+    copy = temp = new_node((*a)->token, (*a)->lexeme);
+    copy_node_info(copy, *a);
+    copy->no_expand = (*a)->no_expand;
+    (*a) = next_node(*a);
+
+    while (pn>0 || ((kind==VAR_LIST||(*a)->lexeme != pre_atoms[A_COMMA]) && (*a)->lexeme != pre_atoms[A_RPAREN])) {
+        if ((*a)->token==PRE_TOK_PUNCTUATOR && (*a)->lexeme == pre_atoms[A_LPAREN]) pn++;
+        else if ((*a)->token==PRE_TOK_PUNCTUATOR && (*a)->lexeme == pre_atoms[A_RPAREN]) pn--;
+        else if ((*a)->token == PRE_TOK_EOF) ERROR("missing `)' in macro call");
+        temp->next = new_node((*a)->token, (*a)->lexeme);
+        copy_node_info(temp->next, *a);
+        temp->next->no_expand = (*a)->no_expand;
+        temp = temp->next;
+        *a = next_node(*a);
+    }
+    return copy;
+}
+
+/*
+ * Second support function. Make a copy of an
+ * argument created previously with copy_arg().
+ */
+static PreTokenNode *copy_arg2(PreTokenNode *a, PreTokenNode **last)
+{
+    PreTokenNode *copy;
+
+    copy = *last = new_node(a->token, a->lexeme);
+    copy_node_info(copy, a);
+    copy->no_expand = a->no_expand;
+    a = a->next;
+
+    while (a != NULL) {
+        (*last)->next = new_node(a->token, a->lexeme);
+        *last = (*last)->next;
+        copy_node_info(*last, a);
+        (*last)->no_expand = a->no_expand;
+        a = a->next;
+    }
+    return copy;
+}
+
+/*
+ * Fully macro-replace an argument (a list made by copy_arg()) before
+ * it is substituted into the replacement list. The argument is
+ * scanned by itself, as if it were the rest of the file.
+ */
+static PreTokenNode *expand_arg(PreTokenNode *a)
+{
+    PreTokenNode *p, *q, *saved_curr, *res, *last;
+
+    if (a == NULL)
+        return NULL;
+    for (p = a; p->next != NULL; p = p->next)
+        ;
+    p->next = new_node(PRE_TOK_EOF, NULL);
+    copy_node_info(p->next, p);
+
+    saved_curr = curr_tok;
+    curr_tok = a;
+    while (curr_tok->token != PRE_TOK_EOF)
+        preprocessing_token(FALSE);
+    curr_tok = saved_curr;
+
+    /* keep what was not deleted */
+    res = last = NULL;
+    for (p = a; p->token != PRE_TOK_EOF; p = q) {
+        q = p->next;
+        if (p->deleted) {
+            free_pre_token(p);
+            continue;
+        }
+        p->next = NULL;
+        if (last == NULL)
+            res = p;
+        else
+            last->next = p;
+        last = p;
+    }
+    free_pre_token(p);
+    return res;
+}
+
+void expand_parameterized_macro(Macro *m)
+{
+    PreTokenNode *r, *p, *prev, *param, *arg;
+    PreTokenNode *par_arg_tab[16][2] = { { NULL } };
+    int tab_size = 0, i;
+
+    /*
+     * The name of a function-like macro not followed by
+     * left parenthesis is not an invocation to the macro.
+     */
+    arg = next_node(curr_tok);
+    while (arg->token==PRE_TOK_NL || arg->token==PRE_TOK_MACRO_REENABLER) arg = next_node(arg);
+    if (arg->lexeme != pre_atoms[A_LPAREN]) {
+        match(lookahead(1));
+        return;
+    }
+
+    // if ((r=dup_rep_list(m->rep)) == NULL)
+        // goto empty_rep_list;
+    r = dup_rep_list(m->rep);
+
+    param = m->params;
+    // arg = curr_tok->next->next; /* ID -> "(" -> first-argument */
+    arg = next_node(arg); /* first-argument */
+
+    /*
+     * Associate actual argument token strings
+     * with the corresponding formal parameter
+     * names.
+     */
+    while (param->lexeme != pre_atoms[A_RPAREN] && arg->lexeme != pre_atoms[A_RPAREN]) {
+        if (param->lexeme == pre_atoms[A_ELLIPSIS]) {
+            par_arg_tab[tab_size][0] = new_node(PRE_TOK_ID, pre_atoms[A_VA_ARGS]);
+            par_arg_tab[tab_size][1] = expand_arg(copy_arg(&arg, VAR_LIST)); /* arg is left pointing to ")" */
+            ++tab_size;
+            param = param->next; /* advance to ")" */
+            break;
+        }
+
+        par_arg_tab[tab_size][0] = param;
+        par_arg_tab[tab_size][1] = expand_arg(copy_arg(&arg, FIXED_LIST)); /* arg is left pointing to "," or ")" */
+        ++tab_size;
+
+        param = param->next; /* advance to "," or ")" */
+
+        if (param->lexeme != arg->lexeme) {
+            /*
+             * Check if it's the case where there are not
+             * actual arguments corresponding to '...'.
+             * For example:
+             *      #define ABC(a,...) a+__VA_ARGS__
+             *      ABC(123)
+             */
+            if (param->lexeme == pre_atoms[A_COMMA] && param->next->lexeme == pre_atoms[A_ELLIPSIS] /*&& arg->lexeme == pre_atoms[A_RPAREN]*/)
+                param = param->next;
+            else
+                ERROR("argument number mismatch in macro call");
+        } else if (param->lexeme != pre_atoms[A_RPAREN]) {
+            param=param->next, arg=next_node(arg);
+        }
+    }
+
+    if (param->lexeme != arg->lexeme) { /* both should be equal to ")" */
+        if (param->lexeme != pre_atoms[A_ELLIPSIS]) { /* or '...' must not have matching arguments */
+            ERROR("argument number mismatch in macro call");
+        } else {
+            par_arg_tab[tab_size][0] = new_node(PRE_TOK_ID, pre_atoms[A_VA_ARGS]);
+            par_arg_tab[tab_size][1] = NULL;
+            ++tab_size;
+        }
+    }
+
+    /*int i = 0;
+    while (i < tab_size) {
+        PreTokenNode *p;
+
+        printf("par=%s ==> arg= ", par_arg_tab[i][0]->lexeme);
+        p = par_arg_tab[i][1];
+        while (p != NULL)
+            printf("%s ->> ", p->lexeme), p=p->next;
+        printf("\n");
+        ++i;
+    }*/
+
+    /*
+     * Replace every occurrence of a formal parameter
+     * for a copy of the actual argument token sequence
+     * associated with it (that is, build the 'expansion'
+     * of the macro).
+     */
+    prev=NULL, p=r;
+    while (p != NULL) {
+        if (p->token != PRE_TOK_ID) {
+            prev=p, p=p->next;
+            continue;
+        }
+
+        for (i = 0; i < tab_size; i++) {
+            if (par_arg_tab[i][0]->lexeme == p->lexeme) {
+                // PreTokenNode *last;
+
+                if (par_arg_tab[i][1] != NULL) {
+                    PreTokenNode *last;
+
+                    if (prev != NULL)
+                        /* a -> <b -> x> -> c -> NULL */
+                        prev->next = copy_arg2(par_arg_tab[i][1], &last);
+                    else
+                        /* <a -> x> -> b -> c -> NULL */
+                        r = copy_arg2(par_arg_tab[i][1], &last);
+                    last->next = p->next;
+                    free_pre_token(p);
+                    prev = last;
+                    p = last->next;
+                } else {
+                    /*
+                     * `...' doesn't correspond to nothing, make
+                     * disappear __VA_ARGS__ from the replacement list.
+                     */
+                    if (prev != NULL) {
+                        /* a -> <b -> > -> c -> NULL */
+                        prev->next = p->next;
+                        free_pre_token(p);
+                        p = prev->next;
+                    } else {
+                        /* <a -> > -> b -> c -> NULL */
+                        r = p->next;
+                        free_pre_token(p);
+                        p = r;
+                    }
+                }
+                break;
+            }
+        }
+        if (i == tab_size) /* no match */
+            prev=p, p=p->next;
+    }
+
+    /*
+     * Delete the original copies of the arguments.
+     */
+    for (i = 0; i < tab_size; i++) {
+        PreTokenNode *temp;
+
+        if (par_arg_tab[i][0]->lexeme == pre_atoms[A_VA_ARGS])
+            free_pre_token(par_arg_tab[i][0]);
+
+        while (par_arg_tab[i][1] != NULL) {
+            temp = par_arg_tab[i][1];
+            par_arg_tab[i][1] = par_arg_tab[i][1]->next;
+            free_pre_token(temp);
+        }
+    }
+    /*while (r != NULL) {
+        printf("r=%s\n", r->lexeme);
+        r = r->next;
+    }
+    exit(0);*/
+// empty_rep_list:
+    /*
+     * Mark the macro call as deleted.
+     */
+    while (curr_tok != arg) {
+        if (curr_tok->token == PRE_TOK_MACRO_REENABLER) {
+            DEBUG_PRINTF("reenabling macro `%s'\n", curr_tok->lexeme);
+            reenable_macro(curr_tok->lexeme);
+        }
+        match2(lookahead(1));
+    }
+    /*
+     * Insert the replacement list next
+     * to the macro call.
+     */
+    if (r != NULL) {
+        prev->next = new_node(PRE_TOK_MACRO_REENABLER, m->name);
+        prev->next->next = curr_tok->next;
+        m->enabled = FALSE;
+        // prev->next = curr_tok->next;
+        curr_tok->next = r;
+    }
+    match2(lookahead(1)); /* ) */
+}
+
+/*
+ * Start preprocessing the source file. The
+ * resulting preprocessing tokens are obtained
+ * one by one through get_pre_token().
+ */
+void preprocess(char *source_file)
+{
+    int i;
+    PreTokenNode head;
+
+    for (i = 0; i < NPRE_ATOMS; i++)
+        pre_atoms[i] = atom(pre_atom_spellings[i]);
+    pre_node_arena = arena_new(sizeof(PreTokenNode)*128, FALSE);
+    pre_str_arena = arena_new(1024, FALSE);
+    init(source_file);
+    tokenize_line(&head);
+    out_head = curr_tok = head.next;
+}
+
+/*
+ * Precompiled headers: the macros defined and the files
+ * known to be guarded (or #pragma once) are saved.
+ */
+void pre_save_pch(void)
+{
+    int i, n;
+    Macro *m;
+    FileInfo *fi;
+    PchOff vec, off;
+
+    for (i = n = 0; i < MACRO_TABLE_SIZE; i++)
+        for (m = macro_table[i]; m != NULL; m = m->next)
+            ++n;
+    vec = pch_new_vector(n);
+    for (i = n = 0; i < MACRO_TABLE_SIZE; i++) {
+        for (m = macro_table[i]; m != NULL; m = m->next) {
+            off = pch_copy(m, sizeof(Macro));
+            pch_set_str(off+offsetof(Macro, name), m->name);
+            pch_set_ptr(off+offsetof(Macro, rep), pch_pre_tokens(m->rep));
+            pch_set_ptr(off+offsetof(Macro, params), pch_pre_tokens(m->params));
+            pch_set_ptr(off+offsetof(Macro, next), 0);
+            pch_set_elem(vec, n++, off);
+        }
+    }
+    pch_set_root(PCH_MACROS, vec);
+
+    for (i = n = 0; i < FILE_TABLE_SIZE; i++)
+        for (fi = file_table[i]; fi != NULL; fi = fi->next)
+            if (fi->guard_state==GUARD_CLOSED || fi->once)
+                ++n;
+    vec = pch_new_vector(n);
+    for (i = n = 0; i < FILE_TABLE_SIZE; i++) {
+        for (fi = file_table[i]; fi != NULL; fi = fi->next) {
+            if (fi->guard_state!=GUARD_CLOSED && !fi->once)
+                continue;
+            off = pch_copy(fi, sizeof(FileInfo));
+            pch_set_str(off+offsetof(FileInfo, path), fi->path);
+            pch_set_ptr(off+offsetof(FileInfo, contents), 0);
+            pch_set_str(off+offsetof(FileInfo, guard), fi->guard);
+            pch_set_ptr(off+offsetof(FileInfo, next), 0);
+            pch_set_elem(vec, n++, off);
+        }
+    }
+    pch_set_root(PCH_FILES, vec);
+}
+
+/*
+ * Macros already defined (i.e. from the command line) take
+ * precedence over the ones in the precompiled header.
+ */
+void pre_load_pch(void)
+{
+    unsigned i, n, h;
+    Macro **mv, *m;
+    FileInfo **fv, *fi;
+
+    mv = (Macro **)pch_get_vector(PCH_MACROS, &n);
+    for (i = n; i-- > 0; ) {
+        if (lookup_macro(mv[i]->name) != NULL)
+            continue;
+        m = malloc(sizeof(Macro));
+        *m = *mv[i];
+        m->enabled = TRUE;
+        h = HASH_VAL(m->name);
+        m->next = macro_table[h];
+        macro_table[h] = m;
+    }
+
+    fv = (FileInfo **)pch_get_vector(PCH_FILES, &n);
+    for (i = n; i-- > 0; ) {
+        h = atom_hash(fv[i]->path)%FILE_TABLE_SIZE;
+        for (fi = file_table[h]; fi != NULL; fi = fi->next)
+            if (fi->path == fv[i]->path)
+                break;
+        if (fi != NULL)
+            continue;
+        fi = malloc(sizeof(FileInfo));
+        *fi = *fv[i];
+        fi->next = file_table[h];
+        file_table[h] = fi;
+    }
+}
+
+/*                                 */
+/* Expression evaluation functions */
+/*                                 */
+
+long long pre_eval_expr(void)
+{
+    return pre_eval_cond_expr();
+}
+
+long long pre_eval_cond_expr(void)
+{
+    long long r;
+
+    r = pre_eval_OR_expr();
+    if (equal(get_lexeme(1), "?")) {
+        long long e1, e2;
+
+        match2(PRE_TOK_PUNCTUATOR);
+        /* [ TOFIX ] both expressions will be evaluated! */
+        e1 = pre_eval_expr();
+        if (!equal(get_lexeme(1), ":"))
+            ERROR("expecting `:'; got `%s'", curr_tok->lexeme);
+        match2(PRE_TOK_PUNCTUATOR);
+        e2 = pre_eval_cond_expr();
+        r = r ? e1 : e2;
+    }
+    return r;
+}
+
+long long pre_eval_OR_expr(void)
+{
+    long long r;
+
+    /* [ TOFIX ] both expressions will be evaluated! */
+    r = pre_eval_AND_expr();
+    while (equal(get_lexeme(1), "||")) {
+        long long r2;
+
+        match2(PRE_TOK_PUNCTUATOR);
+        r2 = pre_eval_AND_expr();
+        r = r||r2;
+    }
+    return r;
+}
+
+long long pre_eval_AND_expr(void)
+{
+    long long r;
+
+    /* [ TOFIX ] both expressions will be evaluated! */
+    r = pre_eval_bwOR_expr();
+    while (equal(get_lexeme(1), "&&")) {
+        long long r2;
+
+        match2(PRE_TOK_PUNCTUATOR);
+        r2 = pre_eval_bwOR_expr();
+        r = r&&r2;
+    }
+    return r;
+}
+
+long long pre_eval_bwOR_expr(void)
+{
+    long long r;
+
+    r = pre_eval_bwXOR_expr();
+    while (equal(get_lexeme(1), "|")) {
+        match2(PRE_TOK_PUNCTUATOR);
+        r = r|pre_eval_bwXOR_expr();
+    }
+    return r;
+}
+
+long long pre_eval_bwXOR_expr(void)
+{
+    long long r;
+
+    r = pre_eval_bwAND_expr();
+    while (equal(get_lexeme(1), "^")) {
+        match2(PRE_TOK_PUNCTUATOR);
+        r = r^pre_eval_bwAND_expr();
+    }
+    return r;
+}
+
+long long pre_eval_bwAND_expr(void)
+{
+    long long r;
+
+    r = pre_eval_equ_expr();
+    while (equal(get_lexeme(1), "&")) {
+        match2(PRE_TOK_PUNCTUATOR);
+        r = r&pre_eval_equ_expr();
+    }
+    return r;
+}
+
+long long pre_eval_equ_expr(void)
+{
+    long long r;
+
+    r = pre_eval_rel_expr();
+    while (lookahead(1) == PRE_TOK_PUNCTUATOR) {
+        char *s;
+
+        s = get_lexeme(1);
+        if (equal(s, "==")) {
+            match2(PRE_TOK_PUNCTUATOR);
+            r = r==pre_eval_rel_expr();
+        } else if (equal(s, "!=")) {
+            match2(PRE_TOK_PUNCTUATOR);
+            r = r!=pre_eval_rel_expr();
+        } else {
+            break;
+        }
+    }
+    return r;
+}
+
+long long pre_eval_rel_expr(void)
+{
+    long long r;
+
+    r = pre_eval_shi_expr();
+    while (lookahead(1) == PRE_TOK_PUNCTUATOR) {
+        char *s;
+
+        s = get_lexeme(1);
+        if (equal(s, "<")) {
+            match2(PRE_TOK_PUNCTUATOR);
+            r = r<pre_eval_shi_expr();
+        } else if (equal(s, ">")) {
+            match2(PRE_TOK_PUNCTUATOR);
+            r = r>pre_eval_shi_expr();
+        } else if (equal(s, "<=")) {
+            match2(PRE_TOK_PUNCTUATOR);
+            r = r<=pre_eval_shi_expr();
+        } else if (equal(s, ">=")) {
+            match2(PRE_TOK_PUNCTUATOR);
+            r = r>=pre_eval_shi_expr();
+        } else {
+            break;
+        }
+    }
+    return r;
+}
+
+long long pre_eval_shi_expr(void)
+{
+    long long r;
+
+    r = pre_eval_add_expr();
+    while (lookahead(1) == PRE_TOK_PUNCTUATOR) {
+        char *s;
+
+        s = get_lexeme(1);
+        if (equal(s, "<<")) {
+            match2(PRE_TOK_PUNCTUATOR);
+            r = r<<pre_eval_add_expr();
+        } else if (equal(s, ">>")) {
+            match2(PRE_TOK_PUNCTUATOR);
+            r = r>>pre_eval_add_expr();
+        } else {
+            break;
+        }
+    }
+    return r;
+}
+
+long long pre_eval_add_expr(void)
+{
+    long long r;
+
+    r = pre_eval_mul_expr();
+    while (lookahead(1) == PRE_TOK_PUNCTUATOR) {
+        char *s;
+
+        s = get_lexeme(1);
+        if (equal(s, "+")) {
+            match2(PRE_TOK_PUNCTUATOR);
+            r = r+pre_eval_mul_expr();
+        } else if (equal(s, "-")) {
+            match2(PRE_TOK_PUNCTUATOR);
+            r = r-pre_eval_mul_expr();
+        } else {
+            break;
+        }
+    }
+    return r;
+}
+
+long long pre_eval_mul_expr(void)
+{
+    long long r;
+
+    r = pre_eval_una_expr();
+    while (lookahead(1) == PRE_TOK_PUNCTUATOR) {
+        char *s;
+
+        s = get_lexeme(1);
+        if (equal(s, "*")) {
+            match2(PRE_TOK_PUNCTUATOR);
+            r = r*pre_eval_una_expr();
+        } else if (equal(s, "/")) {
+            match2(PRE_TOK_PUNCTUATOR);
+            r = r/pre_eval_una_expr();
+        } else if (equal(s, "%")) {
+            match2(PRE_TOK_PUNCTUATOR);
+            r = r%pre_eval_una_expr();
+        } else {
+            break;
+        }
+    }
+    return r;
+}
+
+long long pre_eval_una_expr(void)
+{
+    char *s;
+    long long r;
+
+    s = get_lexeme(1);
+    if (equal(s, "defined")) {
+        match2(PRE_TOK_ID);
+        if (equal(get_lexeme(1), "(")) { /* "defined" "(" identifier ")" */
+            match2(PRE_TOK_PUNCTUATOR);
+            if (lookahead(1) == PRE_TOK_ID)
+                r = (lookup_macro(get_lexeme(1)) != NULL);
+            match2(PRE_TOK_ID);
+            if (!equal(get_lexeme(1), ")"))
+                ERROR("expecting `)'; got `%s'", curr_tok->lexeme);
+            match2(PRE_TOK_PUNCTUATOR);
+        } else { /* "defined" identifier */
+            if (lookahead(1) == PRE_TOK_ID)
+                r = (lookup_macro(get_lexeme(1)) != NULL);
+            match2(PRE_TOK_ID);
+        }
+        return r;
+    } else if (s[1] != '\0') {
+        return pre_eval_pri_expr();
+    }
+    switch (s[0]) {
+    case '+':
+    case '-':
+    case '~':
+    case '!':
+        match2(PRE_TOK_PUNCTUATOR);
+        r = pre_eval_una_expr();
+        return (s[0] == '+') ? r : (s[0] == '-') ? -r : (s[0] == '~') ? ~r : !r;
+    default:
+        return pre_eval_pri_expr();
+    }
+}
+
+long long pre_eval_pri_expr(void)
+{
+    char *endp;
+    long long r;
+
+    switch (lookahead(1)) {
+    case PRE_TOK_PUNCTUATOR:
+        if (!equal(get_lexeme(1), "("))
+            break;
+        match2(PRE_TOK_PUNCTUATOR);
+        r = pre_eval_expr();
+        if (!equal(get_lexeme(1), ")"))
+            ERROR("expecting `)'; got `%s'", curr_tok->lexeme);
+        match2(PRE_TOK_PUNCTUATOR);
+        return r;
+
+    case PRE_TOK_ID: {
+        Macro *m;
+
+        if ((m=lookup_macro(get_lexeme(1))) != NULL)
+            r = strtoll(m->rep->lexeme, &endp, 10);
+        else
+            r = 0; /* undefined macro names evaluate to zero */
+        match2(PRE_TOK_ID);
+        return r;
+    }
+
+    case PRE_TOK_NUM:
+        r = strtoll(get_lexeme(1), &endp, 10);
+        match2(PRE_TOK_NUM);
+        return r;
+    }
+
+    ERROR("expecting primary-expression; got `%s'", curr_tok->lexeme);
+}
@@ -0,0 +1,41 @@
+#ifndef PRE_H_
+#define PRE_H_
+
+typedef enum {
+    PRE_TOK_EOF,
+    PRE_TOK_PUNCTUATOR,
+    PRE_TOK_NUM,
+    PRE_TOK_ID,
+    PRE_TOK_CHACON,
+    PRE_TOK_STRLIT,
+    PRE_TOK_NL,
+    PRE_TOK_OTHER,
+    PRE_TOK_MACRO_REENABLER
+} PreToken;
+
+typedef struct PreTokenNode PreTokenNode;
+struct PreTokenNode {
+    PreToken token;
+    char *lexeme, *src_file;
+    int src_line, src_column;
+    char next_char; /* needed to distinguish between
+                      "name(" and "name (" in #define */
+    char deleted; /* TRUE/FALSE */
+    char no_expand; /* name of a macro found while the macro was disabled */
+    PreTokenNode *next;
+};
+typedef enum {
+    SIMPLE_MACRO,
+    PARAMETERIZED_MACRO
+} MacroKind;
+
+void preprocess(char *source_file);
+PreTokenNode *get_pre_token(void);
+void free_pre_token(PreTokenNode *p);
+void install_macro(MacroKind kind, char *name, PreTokenNode *rep, PreTokenNode *params);
+void add_angle_dir(char *dir);
+void add_quote_dir(char *dir);
+void pre_save_pch(void);
+void pre_load_pch(void);
+
+#endif
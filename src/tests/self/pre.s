@@ -0,0 +1,10345 @@
+.extern fgets
+# ==== start of definition of function `match2' ====
+.text
+match2:
+addsp 0;         
+# param:`x', offset:-20
+ldiqw curr_tok;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -20;
+lddw;
+eqdw;
+jmpf @L1;
+ldidw 1;
+dw2b;
+ldiqw curr_tok;
+ldqw;
+ldiqw 33;
+addqw;
+stb;
+pop;
+ldiqw curr_tok;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw curr_tok;
+stqw;
+pop;
+pop;
+jmp @L2;
+@L1:
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw pre_token_table;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S0;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 44;
+pop;
+pop;
+@L2:
+ldidw 0;
+ret;
+.bss
+.align 8
+curr_source_file:
+.res 8
+# ==== start of definition of function `copy_arg2' ====
+.text
+copy_arg2:
+addsp 12;        
+# param:`a', offset:-24
+# param:`last', offset:-32
+# var: copy, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw new_node;
+call 12;
+ldbp -32;
+ldqw;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+@L3:
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L4;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw new_node;
+call 12;
+ldbp -32;
+ldqw;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp -32;
+ldqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+jmp @L3;
+@L4:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 8
+pre_node_arena:
+.res 8
+.global pre_node_arena
+# ==== start of definition of function `else_group' ====
+.text
+else_group:
+addsp 0;         
+# param:`skip', offset:-20
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldidw 3;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldidw 6;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldiqw is_group_part;
+call 0;
+pop;
+jmpf @L5;
+ldbp -20;
+lddw;
+ldiqw group;
+call 4;
+pop;
+pop;
+@L5:
+ldidw 0;
+ret;
+.extern verbose_asm
+# ==== start of definition of function `group' ====
+.text
+group:
+addsp 0;         
+# param:`skip', offset:-20
+ldbp -20;
+lddw;
+ldiqw group_part;
+call 4;
+pop;
+pop;
+@L6:
+ldiqw is_group_part;
+call 0;
+pop;
+jmpf @L7;
+ldbp -20;
+lddw;
+ldiqw group_part;
+call 4;
+pop;
+pop;
+jmp @L6;
+@L7:
+ldidw 0;
+ret;
+# ==== start of definition of function `search_angle' ====
+.text
+search_angle:
+addsp 12;        
+# param:`inc_arg', offset:-24
+# var: i, offset: 4
+# var: path, offset: 8
+ldidw 256;
+dw2qw;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L8:
+ldbp 4;
+lddw;
+ldiqw nangle_dirs;
+lddw;
+sltdw;
+jmpf @L10;
+ldiqw angle_dirs;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw file_exists;
+call 8;
+pop;
+jmpf @L11;
+ldbp 8;
+ldqw;
+ret;
+@L11:
+@L9:
+incldw 4;
+jmp @L8;
+@L10:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L12:
+ldbp 4;
+lddw;
+ldiqw ndefault_angle_dirs;
+lddw;
+sltdw;
+jmpf @L14;
+ldiqw default_angle_dirs;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw file_exists;
+call 8;
+pop;
+jmpf @L15;
+ldbp 8;
+ldqw;
+ret;
+@L15:
+@L13:
+incldw 4;
+jmp @L12;
+@L14:
+ldbp 8;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern cfg_outpath
+# ==== start of definition of function `reenable_macro' ====
+.text
+reenable_macro:
+addsp 12;        
+# param:`name', offset:-24
+# var: m, offset: 8
+ldiqw macro_table;
+ldbp -24;
+ldqw;
+ldiqw hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L16:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L18;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L19;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+stdw;
+pop;
+jmp @L18;
+@L19:
+@L17:
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L16;
+@L18:
+ldidw 0;
+ret;
+.extern target_arch
+.extern emit_warning
+.extern arena_destroy
+# ==== start of definition of function `elif_group' ====
+.text
+elif_group:
+addsp 12;        
+# param:`skip', offset:-20
+# var: cond_res, offset: 8
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldidw 3;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldiqw pre_eval_expr;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 6;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L20;
+ldidw 1;
+jmp @L21;
+@L20:
+ldbp -20;
+lddw;
+@L21:
+ldbp -20;
+stdw;
+pop;
+ldiqw is_group_part;
+call 0;
+pop;
+jmpf @L22;
+ldbp -20;
+lddw;
+ldiqw group;
+call 4;
+pop;
+pop;
+@L22:
+ldbp 8;
+ldqw;
+notqw;
+notdw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `simple_define' ====
+.text
+simple_define:
+addsp 0;         
+ldidw 0;
+dw2qw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldidw 0;
+ldiqw install_macro;
+call 28;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `tokenize' ====
+.text
+tokenize:
+addsp 20;        
+# var: tok, offset: 4
+# var: n, offset: 8
+# var: p, offset: 16
+ldidw 1;
+ldiqw curr_line;
+stdw;
+pop;
+ldiqw get_token;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw token_string;
+ldbp 4;
+lddw;
+ldiqw new_node;
+call 12;
+ldiqw penultimate_node;
+stqw;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw curr;
+ldqw;
+ldb;
+ldbp 16;
+ldqw;
+ldiqw 32;
+addqw;
+stb;
+pop;
+@L23:
+ldbp 4;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L24;
+ldiqw get_token;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw token_string;
+ldbp 4;
+lddw;
+ldiqw new_node;
+call 12;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw curr;
+ldqw;
+ldb;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 32;
+addqw;
+stb;
+pop;
+ldbp 16;
+ldqw;
+ldiqw penultimate_node;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L23;
+@L24:
+ldiqw buf;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `dup_rep_list' ====
+.text
+dup_rep_list:
+addsp 20;        
+# param:`r', offset:-24
+# var: new_rep_list, offset: 8
+# var: temp, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 6;
+eqdw;
+jmpf @L25;
+ldidw 0;
+dw2qw;
+ret;
+@L25:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw new_node;
+call 12;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw curr_tok;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw copy_node_info;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+@L26:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 6;
+neqdw;
+jmpf @L27;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw new_node;
+call 12;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw curr_tok;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw copy_node_info;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+jmp @L26;
+@L27:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `search_quote' ====
+.text
+search_quote:
+addsp 24;        
+# param:`inc_arg', offset:-24
+# var: i, offset: 4
+# var: p, offset: 8
+# var: path, offset: 16
+ldidw 47;
+ldiqw curr_source_file;
+ldqw;
+ldiqw strrchr;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L28;
+ldbp -24;
+ldqw;
+ldiqw strdup;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L29;
+@L28:
+# var: n, offset: 24
+ldbp 8;
+ldqw;
+ldiqw curr_source_file;
+ldqw;
+subqw;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp 24;
+lddw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw strlen;
+call 8;
+addqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldiqw malloc;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 24;
+lddw;
+dw2qw;
+ldiqw curr_source_file;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw strncpy;
+call 24;
+pop;
+pop;
+ldidw 0;
+dw2b;
+ldbp 16;
+ldqw;
+ldbp 24;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+ldbp -24;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+@L29:
+ldbp 16;
+ldqw;
+ldiqw file_exists;
+call 8;
+pop;
+jmpf @L30;
+ldbp 16;
+ldqw;
+ret;
+jmp @L31;
+@L30:
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+@L31:
+ldidw 256;
+dw2qw;
+ldiqw malloc;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L32:
+ldbp 4;
+lddw;
+ldiqw nquote_dirs;
+lddw;
+sltdw;
+jmpf @L34;
+ldiqw quote_dirs;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldqw;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw file_exists;
+call 8;
+pop;
+jmpf @L35;
+ldbp 16;
+ldqw;
+ret;
+@L35:
+@L33:
+incldw 4;
+jmp @L32;
+@L34:
+ldbp -24;
+ldqw;
+ldiqw search_angle;
+call 8;
+ret;
+ldidw 0;
+ret;
+.extern emit_error
+.bss
+token_string:
+.res 4096
+.extern getenv
+.extern atoi
+# ==== start of definition of function `copy_node_info' ====
+.text
+copy_node_info:
+addsp 0;         
+# param:`dest', offset:-24
+# param:`src', offset:-32
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 24;
+addqw;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 28;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern exit
+# ==== start of definition of function `elif_groups' ====
+.text
+elif_groups:
+addsp 4;         
+# param:`skip', offset:-20
+# var: cond_res, offset: 4
+ldbp -20;
+lddw;
+ldiqw elif_group;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L36:
+ldiqw @S1;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L38;
+ldiqw @S2;
+ldidw 2;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L38;
+ldidw 1;
+jmp @L39;
+@L38:
+ldidw 0;
+@L39:
+jmpf @L37;
+ldbp -20;
+lddw;
+jmpt @L40;
+ldbp 4;
+lddw;
+jmpt @L40;
+ldidw 0;
+jmp @L41;
+@L40:
+ldidw 1;
+@L41:
+ldiqw elif_group;
+call 4;
+pop;
+jmpf @L42;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+@L42:
+jmp @L36;
+@L37:
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `pp_tokens' ====
+.text
+pp_tokens:
+addsp 0;         
+# param:`skip', offset:-20
+ldbp -20;
+lddw;
+ldiqw preprocessing_token;
+call 4;
+pop;
+pop;
+@L43:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 6;
+neqdw;
+jmpf @L44;
+ldbp -20;
+lddw;
+ldiqw preprocessing_token;
+call 4;
+pop;
+pop;
+jmp @L43;
+@L44:
+ldidw 0;
+ret;
+.extern stderr
+.extern opt_level
+# ==== start of definition of function `lookahead' ====
+.text
+lookahead:
+addsp 12;        
+# param:`i', offset:-20
+# var: p, offset: 8
+ldiqw curr_tok;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L45:
+ldbp -20;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+jmpf @L46;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L45;
+@L46:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern tolower
+# ==== start of definition of function `match' ====
+.text
+match:
+addsp 0;         
+# param:`x', offset:-20
+ldiqw curr_tok;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -20;
+lddw;
+eqdw;
+jmpf @L47;
+ldiqw curr_tok;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw curr_tok;
+stqw;
+pop;
+pop;
+jmp @L48;
+@L47:
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw pre_token_table;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S3;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 44;
+pop;
+pop;
+@L48:
+ldidw 0;
+ret;
+# ==== start of definition of function `expand_parameterized_macro' ====
+.text
+expand_parameterized_macro:
+addsp 316;       
+# param:`m', offset:-24
+# var: r, offset: 8
+# var: p, offset: 16
+# var: prev, offset: 24
+# var: param, offset: 32
+# var: arg, offset: 40
+# var: par_arg_tab, offset: 48
+ldidw 0;
+dw2qw;
+ldbp 48;
+stqw;
+pop;
+pop;
+ldbp 56;
+ldidw 0;
+fill 8;
+pop;
+pop;
+ldbp 64;
+ldidw 0;
+fill 240;
+pop;
+pop;
+# var: tab_size, offset: 304
+ldidw 0;
+ldbp 304;
+stdw;
+pop;
+# var: i, offset: 308
+ldiqw curr_tok;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+@L49:
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 6;
+eqdw;
+jmpt @L51;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 8;
+eqdw;
+jmpt @L51;
+ldidw 0;
+jmp @L52;
+@L51:
+ldidw 1;
+@L52:
+jmpf @L50;
+ldbp 40;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+jmp @L49;
+@L50:
+ldiqw @S4;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L53;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L53:
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw dup_rep_list;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+@L54:
+ldiqw @S5;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L56;
+ldiqw @S6;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L56;
+ldidw 1;
+jmp @L57;
+@L56:
+ldidw 0;
+@L57:
+jmpf @L55;
+ldiqw @S7;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L58;
+ldiqw @S8;
+ldidw 3;
+ldiqw new_node;
+call 12;
+ldbp 48;
+ldbp 304;
+lddw;
+dw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp 40;
+ldiqw copy_arg;
+call 12;
+ldbp 48;
+ldbp 304;
+lddw;
+dw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+incldw 304;
+ldbp 32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L55;
+@L58:
+ldbp 32;
+ldqw;
+ldbp 48;
+ldbp 304;
+lddw;
+dw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 40;
+ldiqw copy_arg;
+call 12;
+ldbp 48;
+ldbp 304;
+lddw;
+dw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+incldw 304;
+ldbp 32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L59;
+ldiqw @S9;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L60;
+ldiqw @S10;
+ldbp 32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L60;
+ldidw 1;
+jmp @L61;
+@L60:
+ldidw 0;
+@L61:
+jmpf @L62;
+ldbp 32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L63;
+@L62:
+ldiqw @S11;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L63:
+jmp @L64;
+@L59:
+ldiqw @S12;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L65;
+ldbp 32;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+@L65:
+@L64:
+jmp @L54;
+@L55:
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L66;
+ldiqw @S13;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L67;
+ldiqw @S14;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+jmp @L68;
+@L67:
+ldiqw @S15;
+ldidw 3;
+ldiqw new_node;
+call 12;
+ldbp 48;
+ldbp 304;
+lddw;
+dw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldidw 0;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 48;
+ldbp 304;
+lddw;
+dw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+incldw 304;
+@L68:
+@L66:
+ldidw 0;
+dw2qw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L69:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L70;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+neqdw;
+jmpf @L71;
+ldbp 16;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L69;
+@L71:
+ldidw 0;
+ldbp 308;
+stdw;
+pop;
+@L72:
+ldbp 308;
+lddw;
+ldbp 304;
+lddw;
+sltdw;
+jmpf @L74;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 48;
+ldbp 308;
+lddw;
+dw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L75;
+ldbp 48;
+ldbp 308;
+lddw;
+dw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L76;
+# var: last, offset: 312
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L77;
+ldbp 312;
+ldbp 48;
+ldbp 308;
+lddw;
+dw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw copy_arg2;
+call 16;
+ldbp 24;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L78;
+@L77:
+ldbp 312;
+ldbp 48;
+ldbp 308;
+lddw;
+dw2qw;
+ldiqw 16;
+mulqw;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw copy_arg2;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L78:
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 312;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 312;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 312;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L79;
+@L76:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L80;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L81;
+@L80:
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L81:
+@L79:
+jmp @L74;
+@L75:
+@L73:
+incldw 308;
+jmp @L72;
+@L74:
+ldbp 308;
+lddw;
+ldbp 304;
+lddw;
+eqdw;
+jmpf @L82;
+ldbp 16;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L82:
+jmp @L69;
+@L70:
+@L83:
+ldiqw curr_tok;
+ldqw;
+ldbp 40;
+ldqw;
+neqqw;
+jmpf @L84;
+ldiqw curr_tok;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 8;
+eqdw;
+jmpf @L85;
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw reenable_macro;
+call 8;
+pop;
+pop;
+@L85:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match2;
+call 4;
+pop;
+pop;
+jmp @L83;
+@L84:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L86;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldidw 8;
+ldiqw new_node;
+call 12;
+ldbp 24;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw curr_tok;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+@L86:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern rewind
+.extern realloc
+.extern snprintf
+.extern strpbrk
+.bss
+.align 8
+pre_str_arena:
+.res 8
+# ==== start of definition of function `pre_eval_expr' ====
+.text
+pre_eval_expr:
+addsp 0;         
+ldiqw pre_eval_cond_expr;
+call 0;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `pre_eval_bwXOR_expr' ====
+.text
+pre_eval_bwXOR_expr:
+addsp 12;        
+# var: r, offset: 8
+ldiqw pre_eval_bwAND_expr;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L87:
+ldiqw @S16;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L88;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_bwAND_expr;
+call 0;
+xorqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L87;
+@L88:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern fseek
+# ==== start of definition of function `if_group' ====
+.text
+if_group:
+addsp 12;        
+# param:`skip', offset:-20
+# var: cond_res, offset: 8
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldiqw @S17;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L89;
+ldidw 3;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldiqw pre_eval_expr;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L90;
+@L89:
+ldiqw @S18;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L91;
+ldidw 3;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw lookup_macro;
+call 8;
+ldidw 0;
+dw2qw;
+neqqw;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 3;
+ldiqw match2;
+call 4;
+pop;
+pop;
+jmp @L92;
+@L91:
+ldidw 3;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw lookup_macro;
+call 8;
+ldidw 0;
+dw2qw;
+eqqw;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 3;
+ldiqw match2;
+call 4;
+pop;
+pop;
+@L92:
+@L90:
+ldidw 6;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L93;
+ldidw 1;
+jmp @L94;
+@L93:
+ldbp -20;
+lddw;
+@L94:
+ldbp -20;
+stdw;
+pop;
+ldiqw is_group_part;
+call 0;
+pop;
+jmpf @L95;
+ldbp -20;
+lddw;
+ldiqw group;
+call 4;
+pop;
+pop;
+@L95:
+ldbp 8;
+ldqw;
+notqw;
+notdw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern islower
+# ==== start of definition of function `pre_eval_shi_expr' ====
+.text
+pre_eval_shi_expr:
+addsp 20;        
+# var: r, offset: 8
+ldiqw pre_eval_add_expr;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L96:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 1;
+eqdw;
+jmpf @L97;
+# var: s, offset: 16
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw @S19;
+ldbp 16;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L98;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_add_expr;
+call 0;
+pop;
+sllqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L99;
+@L98:
+ldiqw @S20;
+ldbp 16;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L100;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_add_expr;
+call 0;
+pop;
+sraqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L101;
+@L100:
+jmp @L97;
+@L101:
+@L99:
+jmp @L96;
+@L97:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern sscanf
+.extern fputc
+# ==== start of definition of function `pre_eval_una_expr' ====
+.text
+pre_eval_una_expr:
+addsp 20;        
+# var: s, offset: 8
+# var: r, offset: 16
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw @S21;
+ldbp 8;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L102;
+ldidw 3;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldiqw @S22;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L103;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 3;
+eqdw;
+jmpf @L104;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw lookup_macro;
+call 8;
+ldidw 0;
+dw2qw;
+neqqw;
+dw2qw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L104:
+ldidw 3;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldiqw @S23;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L105;
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S24;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L105:
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+jmp @L106;
+@L103:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 3;
+eqdw;
+jmpf @L107;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw lookup_macro;
+call 8;
+ldidw 0;
+dw2qw;
+neqqw;
+dw2qw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L107:
+ldidw 3;
+ldiqw match2;
+call 4;
+pop;
+pop;
+@L106:
+ldbp 16;
+ldqw;
+ret;
+jmp @L108;
+@L102:
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxb 1;
+ldidw 0;
+neqdw;
+jmpf @L109;
+ldiqw pre_eval_pri_expr;
+call 0;
+ret;
+@L109:
+@L108:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxb 1;
+ldiqw @T110;
+switch;
+@L112:
+@L113:
+@L114:
+@L115:
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldiqw pre_eval_una_expr;
+call 0;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxb 1;
+ldidw 43;
+eqdw;
+jmpf @L116;
+ldbp 16;
+ldqw;
+jmp @L117;
+@L116:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxb 1;
+ldidw 45;
+eqdw;
+jmpf @L118;
+ldbp 16;
+ldqw;
+negqw;
+jmp @L119;
+@L118:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxb 1;
+ldidw 126;
+eqdw;
+jmpf @L120;
+ldbp 16;
+ldqw;
+cmplqw;
+jmp @L121;
+@L120:
+ldbp 16;
+ldqw;
+notqw;
+dw2qw;
+@L121:
+@L119:
+@L117:
+ret;
+@L122:
+ldiqw pre_eval_pri_expr;
+call 0;
+ret;
+@L111:
+.data
+.align 8
+@T110:
+.dword 5
+.dword 33
+.dword 43
+.dword 45
+.dword 126
+.qword @L122
+.qword @L115
+.qword @L112
+.qword @L113
+.qword @L114
+.text
+ldidw 0;
+ret;
+.extern vsscanf
+# ==== start of definition of function `lookup_macro' ====
+.text
+lookup_macro:
+addsp 12;        
+# param:`name', offset:-24
+# var: np, offset: 8
+ldiqw macro_table;
+ldbp -24;
+ldqw;
+ldiqw hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L123:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L125;
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+lddw;
+jmpf @L126;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L126;
+ldidw 1;
+jmp @L127;
+@L126:
+ldidw 0;
+@L127:
+jmpf @L128;
+ldbp 8;
+ldqw;
+ret;
+@L128:
+@L124:
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L123;
+@L125:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern fwrite
+.extern colored_diagnostics
+.extern strspn
+.extern ispunct
+# ==== start of definition of function `get_next_char' ====
+.text
+get_next_char:
+addsp 0;         
+ldiqw curr;
+ldqw;
+ldb;
+ldidw 0;
+eqdw;
+jmpf @L129;
+ldidw 0;
+dw2qw;
+ret;
+@L129:
+ldiqw curr;
+ldqw;
+ldb;
+ldidw 13;
+eqdw;
+jmpf @L130;
+ldiqw curr;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+ldiqw curr;
+ldqw;
+ldb;
+ldidw 10;
+eqdw;
+jmpf @L131;
+ldiqw curr;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+@L131:
+ldidw 10;
+dw2qw;
+ret;
+@L130:
+@L132:
+ldiqw curr;
+ldqw;
+ldb;
+ldidw 92;
+eqdw;
+jmpf @L134;
+ldiqw curr;
+ldqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldb;
+ldidw 10;
+eqdw;
+jmpt @L136;
+ldiqw curr;
+ldqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldb;
+ldidw 13;
+eqdw;
+jmpt @L136;
+ldidw 0;
+jmp @L137;
+@L136:
+ldidw 1;
+@L137:
+jmpf @L134;
+ldidw 1;
+jmp @L135;
+@L134:
+ldidw 0;
+@L135:
+jmpf @L133;
+ldiqw curr;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+ldiqw curr;
+ldqw;
+ldb;
+ldidw 13;
+eqdw;
+jmpf @L138;
+ldiqw curr;
+ldqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldb;
+ldidw 10;
+eqdw;
+jmpf @L138;
+ldidw 1;
+jmp @L139;
+@L138:
+ldidw 0;
+@L139:
+jmpf @L140;
+ldiqw curr;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+@L140:
+ldiqw curr;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+ldiqw curr_line;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ldiqw curr_column;
+stdw;
+pop;
+jmp @L132;
+@L133:
+ldiqw curr;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldb;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern strtoll
+# ==== start of definition of function `group_part' ====
+.text
+group_part:
+addsp 0;         
+# param:`skip', offset:-20
+ldiqw @S25;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L141;
+ldiqw @S26;
+ldidw 2;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpt @L144;
+ldiqw @S27;
+ldidw 2;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpt @L144;
+ldidw 0;
+jmp @L145;
+@L144:
+ldidw 1;
+@L145:
+jmpt @L142;
+ldiqw @S28;
+ldidw 2;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpt @L142;
+ldidw 0;
+jmp @L143;
+@L142:
+ldidw 1;
+@L143:
+jmpf @L146;
+ldbp -20;
+lddw;
+ldiqw if_section;
+call 4;
+pop;
+pop;
+jmp @L147;
+@L146:
+ldbp -20;
+lddw;
+ldiqw control_line;
+call 4;
+pop;
+pop;
+@L147:
+jmp @L148;
+@L141:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 6;
+neqdw;
+jmpf @L149;
+ldbp -20;
+lddw;
+ldiqw pp_tokens;
+call 4;
+pop;
+pop;
+@L149:
+ldidw 6;
+ldiqw match2;
+call 4;
+pop;
+pop;
+@L148:
+ldidw 0;
+ret;
+.extern fclose
+# ==== start of definition of function `preprocess' ====
+.text
+preprocess:
+.global preprocess
+addsp 12;        
+# param:`source_file', offset:-24
+# var: token_list, offset: 8
+ldidw 0;
+ldiqw 48;
+ldidw 128;
+dw2qw;
+mulqw;
+pop;
+ldiqw arena_new;
+call 8;
+ldiqw pre_node_arena;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldidw 1024;
+ldiqw arena_new;
+call 8;
+ldiqw pre_str_arena;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw init;
+call 8;
+pop;
+pop;
+ldiqw tokenize;
+call 0;
+ldiqw curr_tok;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw preprocessing_file;
+call 0;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern strstr
+.extern calloc
+# ==== start of definition of function `pre_eval_AND_expr' ====
+.text
+pre_eval_AND_expr:
+addsp 20;        
+# var: r, offset: 8
+ldiqw pre_eval_bwOR_expr;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L150:
+ldiqw @S29;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L151;
+# var: r2, offset: 16
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldiqw pre_eval_bwOR_expr;
+call 0;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ordw;
+jmpf @L152;
+ldbp 16;
+ldqw;
+ordw;
+jmpf @L152;
+ldidw 1;
+jmp @L153;
+@L152:
+ldidw 0;
+@L153:
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L150;
+@L151:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern memset
+# ==== start of definition of function `get_lexeme' ====
+.text
+get_lexeme:
+addsp 12;        
+# param:`i', offset:-20
+# var: p, offset: 8
+ldiqw curr_tok;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L154:
+ldbp -20;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+jmpf @L155;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L154;
+@L155:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.data
+.align 4
+ndefault_angle_dirs:
+.align 4
+.dword 3
+.extern file_exists
+.extern include_libc
+# ==== start of definition of function `add_quote_dir' ====
+.text
+add_quote_dir:
+.global add_quote_dir
+addsp 0;         
+# param:`dir', offset:-24
+ldbp -24;
+ldqw;
+ldiqw dupdir;
+call 8;
+ldiqw quote_dirs;
+ldiqw nquote_dirs;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern stat_number_of_ast_nodes
+.extern strtoul
+.extern isprint
+.extern fprintf
+.extern read_file
+.extern printf
+# ==== start of definition of function `pre_eval_pri_expr' ====
+.text
+pre_eval_pri_expr:
+addsp 28;        
+# var: endp, offset: 8
+# var: r, offset: 16
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw @T156;
+jmptab;
+@L158:
+ldiqw @S30;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L159;
+jmp @L157;
+@L159:
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldiqw pre_eval_expr;
+call 0;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw @S31;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L160;
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S32;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L160:
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ret;
+@L161:
+# var: m, offset: 24
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw lookup_macro;
+call 8;
+ldbp 24;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L162;
+ldidw 10;
+ldbp 8;
+ldbp 24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strtoll;
+call 20;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L163;
+@L162:
+ldidw 0;
+dw2qw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L163:
+ldidw 3;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ret;
+@L164:
+ldidw 10;
+ldbp 8;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strtoll;
+call 20;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 2;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ret;
+@L157:
+.data
+.align 8
+@T156:
+.dword 1
+.dword 3
+.qword @L157
+.qword @L158
+.qword @L164
+.qword @L161
+.text
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S33;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+penultimate_node:
+.res 8
+# ==== start of definition of function `pre_eval_bwOR_expr' ====
+.text
+pre_eval_bwOR_expr:
+addsp 12;        
+# var: r, offset: 8
+ldiqw pre_eval_bwXOR_expr;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L165:
+ldiqw @S34;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L166;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_bwXOR_expr;
+call 0;
+orqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L165;
+@L166:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern isalnum
+.extern sprintf
+.extern isxdigit
+.extern strcat
+# ==== start of definition of function `control_line' ====
+.text
+control_line:
+addsp 2060;      
+# param:`skip', offset:-20
+ldbp -20;
+lddw;
+jmpf @L167;
+jmp @@control_line_bottom;
+@L167:
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldiqw @S35;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L168;
+# var: inc_arg, offset: 4
+# var: path, offset: 264
+# var: tokenized_file, offset: 272
+ldidw 3;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L169;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw curr_source_file;
+stqw;
+pop;
+pop;
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldbp 4;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+ldidw 0;
+dw2b;
+ldbp 4;
+ldbp 4;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+subqw;
+addqw;
+stb;
+pop;
+ldbp 4;
+ldiqw search_quote;
+call 8;
+ldbp 264;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L170;
+ldbp 4;
+ldiqw @S36;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 32;
+pop;
+pop;
+@L170:
+ldbp 264;
+ldqw;
+ldiqw init;
+call 8;
+pop;
+pop;
+ldbp 264;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match2;
+call 4;
+pop;
+pop;
+jmp @L171;
+@L169:
+ldiqw @S37;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L172;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldiqw @S38;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L173;
+ldiqw @S39;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L173:
+ldidw 0;
+dw2b;
+ldbp 4;
+ldidw 0;
+dw2qw;
+addqw;
+stb;
+pop;
+@L174:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 6;
+eqdw;
+jmpf @L177;
+ldiqw @S40;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L177:
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 4;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match2;
+call 4;
+pop;
+pop;
+@L175:
+ldiqw @S41;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L176;
+jmp @L174;
+@L176:
+ldbp 4;
+ldiqw search_angle;
+call 8;
+ldbp 264;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L178;
+ldbp 4;
+ldiqw @S42;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 32;
+pop;
+pop;
+@L178:
+ldbp 264;
+ldqw;
+ldiqw init;
+call 8;
+pop;
+pop;
+ldbp 264;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+jmp @L179;
+@L172:
+ldiqw @S43;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L179:
+@L171:
+ldiqw tokenize;
+call 0;
+ldbp 272;
+stqw;
+pop;
+pop;
+ldiqw curr_tok;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw penultimate_node;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 272;
+ldqw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L180;
+@L168:
+ldiqw @S44;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L181;
+ldidw 3;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 3;
+eqdw;
+jmpf @L182;
+ldiqw curr_tok;
+ldqw;
+ldiqw 32;
+addqw;
+ldb;
+ldidw 40;
+eqdw;
+jmpf @L183;
+ldiqw parameterized_define;
+call 0;
+pop;
+pop;
+jmp @L184;
+@L183:
+ldiqw simple_define;
+call 0;
+pop;
+pop;
+@L184:
+jmp @L185;
+@L182:
+ldiqw @S45;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L185:
+jmp @L186;
+@L181:
+ldiqw @S46;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L187;
+ldidw 3;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 3;
+eqdw;
+jmpf @L188;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw uninstall_macro;
+call 8;
+pop;
+pop;
+jmp @L189;
+@L188:
+ldiqw @S47;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L189:
+jmp @L190;
+@L187:
+ldiqw @S48;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L191;
+# var: buf, offset: 4
+# var: cp, offset: 2056
+ldidw 0;
+dw2b;
+ldbp 4;
+ldidw 0;
+dw2qw;
+addqw;
+stb;
+pop;
+ldidw 3;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 6;
+neqdw;
+jmpf @L192;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 4;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+ldbp 4;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strlen;
+call 8;
+addqw;
+ldbp 2056;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+@L193:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 6;
+neqdw;
+jmpf @L194;
+ldiqw @S49;
+ldbp 2056;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 2056;
+ldqw;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+ldbp 2056;
+ldqw;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strlen;
+call 8;
+addqw;
+ldbp 2056;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L193;
+@L194:
+@L192:
+ldbp 4;
+ldiqw @S50;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 32;
+pop;
+pop;
+jmp @L195;
+@L191:
+ldiqw @S51;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L196;
+jmp @L197;
+@L196:
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw @S52;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L197:
+@L195:
+@L190:
+@L186:
+@L180:
+@@control_line_bottom:
+@L198:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 6;
+neqdw;
+jmpf @L199;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match2;
+call 4;
+pop;
+pop;
+jmp @L198;
+@L199:
+ldidw 6;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern error_count
+.bss
+.align 4
+src_column:
+.res 4
+.data
+.align 8
+default_angle_dirs:
+.align 8
+.qword @S53+0
+.align 8
+.qword @S54+0
+.align 8
+.qword @S55+0
+.extern round_up
+.bss
+.align 4
+nquote_dirs:
+.res 4
+.extern include_liblux
+# ==== start of definition of function `copy_arg' ====
+.text
+copy_arg:
+addsp 20;        
+# param:`a', offset:-24
+# param:`kind', offset:-28
+# var: pn, offset: 4
+# var: copy, offset: 8
+# var: temp, offset: 16
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L200;
+ldiqw @S56;
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpt @L202;
+ldiqw @S57;
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpt @L202;
+ldidw 0;
+jmp @L203;
+@L202:
+ldidw 1;
+@L203:
+jmpf @L200;
+ldidw 1;
+jmp @L201;
+@L200:
+ldidw 0;
+@L201:
+jmpf @L204;
+ldiqw @S58;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L204:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L205;
+ldiqw @S59;
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L205;
+ldidw 1;
+jmp @L206;
+@L205:
+ldidw 0;
+@L206:
+jmpf @L207;
+incldw 4;
+@L207:
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw new_node;
+call 12;
+ldbp 16;
+stqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+stqw;
+pop;
+pop;
+@L208:
+ldbp 4;
+lddw;
+ldidw 0;
+sgtdw;
+jmpt @L210;
+ldbp -28;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L214;
+ldiqw @S60;
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+neqdw;
+jmpt @L214;
+ldidw 0;
+jmp @L215;
+@L214:
+ldidw 1;
+@L215:
+jmpf @L212;
+ldiqw @S61;
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L212;
+ldidw 1;
+jmp @L213;
+@L212:
+ldidw 0;
+@L213:
+jmpt @L210;
+ldidw 0;
+jmp @L211;
+@L210:
+ldidw 1;
+@L211:
+jmpf @L209;
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L216;
+ldiqw @S62;
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L216;
+ldidw 1;
+jmp @L217;
+@L216:
+ldidw 0;
+@L217:
+jmpf @L218;
+incldw 4;
+jmp @L219;
+@L218:
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L220;
+ldiqw @S63;
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L220;
+ldidw 1;
+jmp @L221;
+@L220:
+ldidw 0;
+@L221:
+jmpf @L222;
+decldw 4;
+jmp @L223;
+@L222:
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L224;
+ldiqw @S64;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L224:
+@L223:
+@L219:
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw new_node;
+call 12;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+stqw;
+pop;
+pop;
+jmp @L208;
+@L209:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern stat_number_of_pre_tokens
+.extern strchr
+# ==== start of definition of function `is_group_part' ====
+.text
+is_group_part:
+addsp 0;         
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 0;
+eqdw;
+jmpt @L225;
+ldiqw @S65;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L227;
+ldiqw @S66;
+ldidw 2;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpt @L231;
+ldiqw @S67;
+ldidw 2;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpt @L231;
+ldidw 0;
+jmp @L232;
+@L231:
+ldidw 1;
+@L232:
+jmpt @L229;
+ldiqw @S68;
+ldidw 2;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpt @L229;
+ldidw 0;
+jmp @L230;
+@L229:
+ldidw 1;
+@L230:
+jmpf @L227;
+ldidw 1;
+jmp @L228;
+@L227:
+ldidw 0;
+@L228:
+jmpt @L225;
+ldidw 0;
+jmp @L226;
+@L225:
+ldidw 1;
+@L226:
+jmpf @L233;
+ldidw 0;
+dw2qw;
+ret;
+@L233:
+ldidw 1;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `dup_lexeme' ====
+.text
+dup_lexeme:
+addsp 16;        
+# param:`s', offset:-24
+# var: t, offset: 8
+# var: len, offset: 16
+ldbp -24;
+ldqw;
+notqw;
+jmpf @L234;
+ldidw 0;
+dw2qw;
+ret;
+@L234:
+ldbp -24;
+ldqw;
+ldiqw strlen;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldidw 1;
+adddw;
+ldiqw pre_str_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 1;
+adddw;
+udw2qw;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw memcpy;
+call 24;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern toupper
+# ==== start of definition of function `add_angle_dir' ====
+.text
+add_angle_dir:
+.global add_angle_dir
+addsp 0;         
+# param:`dir', offset:-24
+ldbp -24;
+ldqw;
+ldiqw dupdir;
+call 8;
+ldiqw angle_dirs;
+ldiqw nangle_dirs;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+macro_table:
+.res 32744
+.extern ic_outpath
+.extern arena_alloc
+# ==== start of definition of function `new_node' ====
+.text
+new_node:
+addsp 12;        
+# param:`token', offset:-20
+# param:`lexeme', offset:-28
+# var: temp, offset: 8
+ldiqw 48;
+pop;
+ldiqw pre_node_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp -28;
+ldqw;
+ldiqw dup_lexeme;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2b;
+ldbp 8;
+ldqw;
+ldiqw 33;
+addqw;
+stb;
+pop;
+ldiqw curr_line;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stdw;
+pop;
+ldiqw src_column;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 28;
+addqw;
+stdw;
+pop;
+ldiqw curr_source_file;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw stat_number_of_pre_tokens;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern stdout
+.bss
+.align 4
+nangle_dirs:
+.res 4
+.extern ilog2
+.extern strcmp
+.extern strtok
+.extern strtol
+.extern stdin
+.extern ftell
+.extern strcpy
+# ==== start of definition of function `pre_eval_rel_expr' ====
+.text
+pre_eval_rel_expr:
+addsp 20;        
+# var: r, offset: 8
+ldiqw pre_eval_shi_expr;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L235:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 1;
+eqdw;
+jmpf @L236;
+# var: s, offset: 16
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw @S69;
+ldbp 16;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L237;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_shi_expr;
+call 0;
+sltqw;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L238;
+@L237:
+ldiqw @S70;
+ldbp 16;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L239;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_shi_expr;
+call 0;
+sgtqw;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L240;
+@L239:
+ldiqw @S71;
+ldbp 16;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L241;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_shi_expr;
+call 0;
+sletqw;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L242;
+@L241:
+ldiqw @S72;
+ldbp 16;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L243;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_shi_expr;
+call 0;
+sgetqw;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L244;
+@L243:
+jmp @L236;
+@L244:
+@L242:
+@L240:
+@L238:
+jmp @L235;
+@L236:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `get_token' ====
+.text
+get_token:
+addsp 24;        
+# var: state, offset: 4
+# var: token, offset: 8
+# var: tok_str_ind, offset: 12
+# var: save, offset: 16
+# var: cb, offset: 20
+ldidw 0;
+ldbp 20;
+stdw;
+pop;
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L245:
+ldbp 4;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L246;
+# var: c, offset: 24
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldidw 1;
+ldbp 16;
+stdw;
+pop;
+ldiqw curr_column;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @T247;
+jmptab;
+@L249:
+ldiqw curr_column;
+lddw;
+ldidw 1;
+subdw;
+ldiqw src_column;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldidw 32;
+eqdw;
+jmpt @L250;
+ldbp 24;
+lddw;
+ldidw 9;
+eqdw;
+jmpt @L250;
+ldidw 0;
+jmp @L251;
+@L250:
+ldidw 1;
+@L251:
+jmpf @L252;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+jmp @L253;
+@L252:
+ldbp 24;
+lddw;
+ldiqw isdigit;
+call 4;
+pop;
+jmpf @L254;
+ldidw 3;
+ldbp 4;
+stdw;
+pop;
+jmp @L255;
+@L254:
+ldbp 24;
+lddw;
+ldiqw isalpha;
+call 4;
+pop;
+jmpt @L256;
+ldbp 24;
+lddw;
+ldidw 95;
+eqdw;
+jmpt @L256;
+ldidw 0;
+jmp @L257;
+@L256:
+ldidw 1;
+@L257:
+jmpf @L258;
+ldidw 2;
+ldbp 4;
+stdw;
+pop;
+jmp @L259;
+@L258:
+ldbp 24;
+lddw;
+ldidw 39;
+eqdw;
+jmpf @L260;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldidw 4;
+ldbp 4;
+stdw;
+pop;
+jmp @L261;
+@L260:
+ldbp 24;
+lddw;
+ldidw 34;
+eqdw;
+jmpf @L262;
+ldidw 5;
+ldbp 4;
+stdw;
+pop;
+jmp @L263;
+@L262:
+ldbp 24;
+lddw;
+ldidw 47;
+eqdw;
+jmpf @L264;
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 47;
+eqdw;
+jmpt @L266;
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 42;
+eqdw;
+jmpt @L266;
+ldidw 0;
+jmp @L267;
+@L266:
+ldidw 1;
+@L267:
+jmpf @L264;
+ldidw 1;
+jmp @L265;
+@L264:
+ldidw 0;
+@L265:
+jmpf @L268;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 47;
+eqdw;
+jmpf @L269;
+ldidw 8;
+ldbp 4;
+stdw;
+pop;
+jmp @L270;
+@L269:
+ldidw 6;
+ldbp 4;
+stdw;
+pop;
+@L270:
+jmp @L271;
+@L268:
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldiqw @T272;
+switch;
+@L274:
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L275:
+ldidw 6;
+ldbp 8;
+stdw;
+pop;
+ldiqw curr_line;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ldiqw curr_column;
+stdw;
+pop;
+jmp @L273;
+@L276:
+@L277:
+@L278:
+@L279:
+@L280:
+@L281:
+@L282:
+@L283:
+@L284:
+@L285:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L286:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 43;
+eqdw;
+jmpt @L287;
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 61;
+eqdw;
+jmpt @L287;
+ldidw 0;
+jmp @L288;
+@L287:
+ldidw 1;
+@L288:
+jmpf @L289;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L289:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L290:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 45;
+eqdw;
+jmpt @L293;
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 62;
+eqdw;
+jmpt @L293;
+ldidw 0;
+jmp @L294;
+@L293:
+ldidw 1;
+@L294:
+jmpt @L291;
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 61;
+eqdw;
+jmpt @L291;
+ldidw 0;
+jmp @L292;
+@L291:
+ldidw 1;
+@L292:
+jmpf @L295;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L295:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L296:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 61;
+eqdw;
+jmpf @L297;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L297:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L298:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 61;
+eqdw;
+jmpf @L299;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L299:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L300:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 61;
+eqdw;
+jmpf @L301;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L301:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L302:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 61;
+eqdw;
+jmpf @L303;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L303:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L304:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 61;
+eqdw;
+jmpf @L305;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L305:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L306:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 61;
+eqdw;
+jmpf @L307;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L307:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L308:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 124;
+eqdw;
+jmpt @L309;
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 61;
+eqdw;
+jmpt @L309;
+ldidw 0;
+jmp @L310;
+@L309:
+ldidw 1;
+@L310:
+jmpf @L311;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L311:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L312:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 38;
+eqdw;
+jmpt @L313;
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 61;
+eqdw;
+jmpt @L313;
+ldidw 0;
+jmp @L314;
+@L313:
+ldidw 1;
+@L314:
+jmpf @L315;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L315:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L316:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 61;
+eqdw;
+jmpf @L317;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L317:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L318:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 35;
+eqdw;
+jmpf @L319;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L319:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L320:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 61;
+eqdw;
+jmpf @L321;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+jmp @L322;
+@L321:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 60;
+eqdw;
+jmpf @L323;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 61;
+eqdw;
+jmpf @L324;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L324:
+@L323:
+@L322:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L325:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 61;
+eqdw;
+jmpf @L326;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+jmp @L327;
+@L326:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 62;
+eqdw;
+jmpf @L328;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 61;
+eqdw;
+jmpf @L329;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L329:
+@L328:
+@L327:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L330:
+ldidw 1;
+ldiqw peek;
+call 4;
+pop;
+ldidw 46;
+eqdw;
+jmpf @L331;
+ldidw 2;
+ldiqw peek;
+call 4;
+pop;
+ldidw 46;
+eqdw;
+jmpf @L331;
+ldidw 1;
+jmp @L332;
+@L331:
+ldidw 0;
+@L332:
+jmpf @L333;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw get_next_char;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+@L333:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L334:
+ldidw 7;
+ldbp 8;
+stdw;
+pop;
+jmp @L273;
+@L273:
+.data
+.align 8
+@T272:
+.dword 28
+.dword 0
+.dword 10
+.dword 33
+.dword 35
+.dword 37
+.dword 38
+.dword 40
+.dword 41
+.dword 42
+.dword 43
+.dword 44
+.dword 45
+.dword 46
+.dword 47
+.dword 58
+.dword 59
+.dword 60
+.dword 61
+.dword 62
+.dword 63
+.dword 91
+.dword 93
+.dword 94
+.dword 123
+.dword 124
+.dword 125
+.dword 126
+.qword @L334
+.qword @L274
+.qword @L275
+.qword @L316
+.qword @L318
+.qword @L300
+.qword @L312
+.qword @L276
+.qword @L277
+.qword @L296
+.qword @L286
+.qword @L283
+.qword @L290
+.qword @L330
+.qword @L298
+.qword @L285
+.qword @L282
+.qword @L320
+.qword @L306
+.qword @L325
+.qword @L284
+.qword @L278
+.qword @L279
+.qword @L302
+.qword @L280
+.qword @L308
+.qword @L281
+.qword @L304
+.text
+@L271:
+@L263:
+@L261:
+@L259:
+@L255:
+@L253:
+jmp @L248;
+@L335:
+@L336:
+ldbp 24;
+lddw;
+ldiqw isalpha;
+call 4;
+pop;
+notdw;
+jmpf @L339;
+ldbp 24;
+lddw;
+ldiqw isdigit;
+call 4;
+pop;
+notdw;
+jmpf @L339;
+ldidw 1;
+jmp @L340;
+@L339:
+ldidw 0;
+@L340:
+jmpf @L337;
+ldbp 24;
+lddw;
+ldidw 95;
+neqdw;
+jmpf @L337;
+ldidw 1;
+jmp @L338;
+@L337:
+ldidw 0;
+@L338:
+jmpf @L341;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldiqw curr_column;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldiqw curr;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+subqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L342;
+ldidw 2;
+jmp @L343;
+@L342:
+ldidw 3;
+@L343:
+ldbp 8;
+stdw;
+pop;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+@L341:
+jmp @L248;
+@L344:
+ldbp 24;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L345;
+ldbp 24;
+lddw;
+ldidw 10;
+eqdw;
+jmpt @L345;
+ldidw 0;
+jmp @L346;
+@L345:
+ldidw 1;
+@L346:
+jmpf @L347;
+ldiqw @S73;
+ldiqw src_column;
+lddw;
+ldiqw curr_line;
+lddw;
+ldiqw curr_source_file;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+jmp @L348;
+@L347:
+ldbp 24;
+lddw;
+ldidw 39;
+eqdw;
+jmpf @L349;
+ldbp 20;
+lddw;
+ldidw 2;
+smoddw;
+ldidw 0;
+eqdw;
+jmpf @L349;
+ldidw 1;
+jmp @L350;
+@L349:
+ldidw 0;
+@L350:
+jmpf @L351;
+ldbp 12;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L352;
+ldiqw @S74;
+ldiqw src_column;
+lddw;
+ldiqw curr_line;
+lddw;
+ldiqw curr_source_file;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+jmp @L353;
+@L352:
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldidw 4;
+ldbp 8;
+stdw;
+pop;
+@L353:
+jmp @L354;
+@L351:
+ldbp 24;
+lddw;
+ldidw 92;
+eqdw;
+jmpf @L355;
+incldw 20;
+jmp @L356;
+@L355:
+ldidw 0;
+ldbp 20;
+stdw;
+pop;
+@L356:
+@L354:
+@L348:
+jmp @L248;
+@L357:
+ldbp 24;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L358;
+ldbp 24;
+lddw;
+ldidw 10;
+eqdw;
+jmpt @L358;
+ldidw 0;
+jmp @L359;
+@L358:
+ldidw 1;
+@L359:
+jmpf @L360;
+ldiqw @S75;
+ldiqw src_column;
+lddw;
+ldiqw curr_line;
+lddw;
+ldiqw curr_source_file;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L360:
+ldbp 24;
+lddw;
+ldidw 34;
+eqdw;
+jmpf @L361;
+ldbp 20;
+lddw;
+ldidw 2;
+smoddw;
+ldidw 0;
+eqdw;
+jmpf @L361;
+ldidw 1;
+jmp @L362;
+@L361:
+ldidw 0;
+@L362:
+jmpf @L363;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldidw 5;
+ldbp 8;
+stdw;
+pop;
+jmp @L364;
+@L363:
+ldbp 24;
+lddw;
+ldidw 92;
+eqdw;
+jmpf @L365;
+incldw 20;
+jmp @L366;
+@L365:
+ldidw 0;
+ldbp 20;
+stdw;
+pop;
+@L366:
+@L364:
+jmp @L248;
+@L367:
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L368;
+ldiqw @S76;
+ldiqw src_column;
+lddw;
+ldiqw curr_line;
+lddw;
+ldiqw curr_source_file;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+jmp @L369;
+@L368:
+ldbp 24;
+lddw;
+ldidw 42;
+eqdw;
+jmpf @L370;
+ldidw 7;
+ldbp 4;
+stdw;
+pop;
+jmp @L371;
+@L370:
+ldbp 24;
+lddw;
+ldidw 10;
+eqdw;
+jmpf @L372;
+ldiqw curr_line;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ldiqw curr_column;
+stdw;
+pop;
+@L372:
+@L371:
+@L369:
+jmp @L248;
+@L373:
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L374;
+ldiqw @S77;
+ldiqw src_column;
+lddw;
+ldiqw curr_line;
+lddw;
+ldiqw curr_source_file;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+jmp @L375;
+@L374:
+ldbp 24;
+lddw;
+ldidw 47;
+eqdw;
+jmpf @L376;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+jmp @L377;
+@L376:
+ldbp 24;
+lddw;
+ldidw 42;
+neqdw;
+jmpf @L378;
+ldidw 6;
+ldbp 4;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldidw 10;
+eqdw;
+jmpf @L379;
+ldiqw curr_line;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ldiqw curr_column;
+stdw;
+pop;
+@L379:
+@L378:
+@L377:
+@L375:
+jmp @L248;
+@L380:
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldidw 10;
+eqdw;
+jmpf @L381;
+ldiqw curr_column;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldiqw curr;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+subqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+jmp @L382;
+@L381:
+ldbp 24;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L383;
+ldiqw curr_column;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldiqw curr;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+subqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L383:
+@L382:
+jmp @L248;
+@L384:
+@L385:
+@L386:
+ldidw 0;
+notdw;
+jmpf @L389;
+ldidw 545;
+ldiqw @S78;
+ldiqw @S79;
+ldiqw @S80;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L389:
+@L387:
+ldidw 0;
+jmpf @L388;
+jmp @L386;
+@L388:
+jmp @L248;
+@L248:
+.data
+.align 8
+@T247:
+.dword 0
+.dword 9
+.qword @L385
+.qword @L249
+.qword @L384
+.qword @L336
+.qword @L335
+.qword @L344
+.qword @L357
+.qword @L367
+.qword @L373
+.qword @L380
+.text
+ldbp 16;
+lddw;
+jmpf @L390;
+ldbp 12;
+lddw;
+ldidw 4095;
+sgtdw;
+jmpf @L391;
+ldidw 4095;
+ldiqw @S81;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 20;
+pop;
+pop;
+ldiqw @S82;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L391:
+ldbp 24;
+lddw;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+@L390:
+ldbp 4;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L392;
+ldidw 0;
+dw2b;
+ldiqw token_string;
+ldbp 12;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L392:
+jmp @L245;
+@L246:
+ldbp 8;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern ic_function_to_print
+.extern isupper
+.extern strtoull
+.extern strlen
+# ==== start of definition of function `expand_simple_macro' ====
+.text
+expand_simple_macro:
+addsp 20;        
+# param:`m', offset:-24
+# var: r, offset: 8
+# var: old_next, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw dup_rep_list;
+call 8;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L393;
+jmp @@expand_simple_macro_empty_rep_list;
+@L393:
+ldiqw curr_tok;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+@L394:
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L395;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L394;
+@L395:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldidw 8;
+ldiqw new_node;
+call 12;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+stdw;
+pop;
+@@expand_simple_macro_empty_rep_list:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `preprocessing_token' ====
+.text
+preprocessing_token:
+addsp 24;        
+# param:`skip', offset:-20
+ldbp -20;
+lddw;
+jmpf @L396;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L396:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 3;
+eqdw;
+jmpf @L397;
+# var: m, offset: 8
+ldiqw @S83;
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L398;
+# var: n, offset: 16
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw strlen;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldidw 2;
+adddw;
+ldidw 1;
+adddw;
+ldiqw pre_str_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 34;
+dw2b;
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+addqw;
+stb;
+pop;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+ldidw 34;
+dw2b;
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+lddw;
+ldidw 1;
+adddw;
+udw2qw;
+addqw;
+stb;
+pop;
+ldidw 0;
+dw2b;
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+lddw;
+ldidw 2;
+adddw;
+udw2qw;
+addqw;
+stb;
+pop;
+ldidw 5;
+ldiqw curr_tok;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L399;
+@L398:
+ldiqw @S84;
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L400;
+# var: n, offset: 16
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw @S85;
+ldbp 16;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldbp 16;
+ldiqw dup_lexeme;
+call 8;
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 2;
+ldiqw curr_tok;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+jmp @L401;
+@L400:
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw lookup_macro;
+call 8;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L402;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L403;
+ldbp 8;
+ldqw;
+ldiqw expand_simple_macro;
+call 8;
+pop;
+pop;
+jmp @L404;
+@L403:
+ldbp 8;
+ldqw;
+ldiqw expand_parameterized_macro;
+call 8;
+pop;
+pop;
+@L404:
+jmp @L405;
+@L402:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+@L405:
+@L401:
+@L399:
+jmp @L406;
+@L397:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 8;
+eqdw;
+jmpf @L407;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw reenable_macro;
+call 8;
+pop;
+pop;
+ldidw 8;
+ldiqw match2;
+call 4;
+pop;
+pop;
+jmp @L408;
+@L407:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldiqw match;
+call 4;
+pop;
+pop;
+@L408:
+@L406:
+ldidw 0;
+ret;
+.extern memchr
+# ==== start of definition of function `pre_eval_bwAND_expr' ====
+.text
+pre_eval_bwAND_expr:
+addsp 12;        
+# var: r, offset: 8
+ldiqw pre_eval_equ_expr;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L409:
+ldiqw @S86;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L410;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_equ_expr;
+call 0;
+andqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L409;
+@L410:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern vfprintf
+.extern hash
+.extern iscntrl
+.extern bsearch
+.bss
+.align 4
+curr_column:
+.res 4
+.extern qsort
+.extern cg_outpath
+.extern memcmp
+.extern vsnprintf
+.extern vsprintf
+# ==== start of definition of function `if_section' ====
+.text
+if_section:
+addsp 8;         
+# param:`skip', offset:-20
+# var: if_cond, offset: 4
+# var: elif_cond, offset: 8
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldiqw if_group;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw @S87;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L411;
+ldiqw @S88;
+ldidw 2;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L411;
+ldidw 1;
+jmp @L412;
+@L411:
+ldidw 0;
+@L412:
+jmpf @L413;
+ldbp -20;
+lddw;
+jmpt @L414;
+ldbp 4;
+lddw;
+jmpt @L414;
+ldidw 0;
+jmp @L415;
+@L414:
+ldidw 1;
+@L415:
+ldiqw elif_groups;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+@L413:
+ldiqw @S89;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L416;
+ldiqw @S90;
+ldidw 2;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L416;
+ldidw 1;
+jmp @L417;
+@L416:
+ldidw 0;
+@L417:
+jmpf @L418;
+ldbp -20;
+lddw;
+jmpt @L421;
+ldbp 4;
+lddw;
+jmpt @L421;
+ldidw 0;
+jmp @L422;
+@L421:
+ldidw 1;
+@L422:
+jmpt @L419;
+ldbp 8;
+lddw;
+jmpt @L419;
+ldidw 0;
+jmp @L420;
+@L419:
+ldidw 1;
+@L420:
+ldiqw else_group;
+call 4;
+pop;
+pop;
+@L418:
+ldiqw endif_line;
+call 0;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern warning_count
+.extern memcpy
+# ==== start of definition of function `pre_eval_equ_expr' ====
+.text
+pre_eval_equ_expr:
+addsp 20;        
+# var: r, offset: 8
+ldiqw pre_eval_rel_expr;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L423:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 1;
+eqdw;
+jmpf @L424;
+# var: s, offset: 16
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw @S91;
+ldbp 16;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L425;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_rel_expr;
+call 0;
+eqqw;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L426;
+@L425:
+ldiqw @S92;
+ldbp 16;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L427;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_rel_expr;
+call 0;
+neqqw;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L428;
+@L427:
+jmp @L424;
+@L428:
+@L426:
+jmp @L423;
+@L424:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern fopen
+.extern be_atoi
+# ==== start of definition of function `peek' ====
+.text
+peek:
+addsp 12;        
+# param:`n', offset:-20
+# var: cp, offset: 8
+ldiqw curr;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@@peek_next:
+ldiqw curr;
+ldqw;
+ldb;
+ldidw 0;
+eqdw;
+jmpf @L429;
+ldidw 0;
+dw2qw;
+ret;
+@L429:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 13;
+eqdw;
+jmpf @L430;
+ldbp 8;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 10;
+eqdw;
+jmpf @L431;
+ldbp 8;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+@L431:
+ldbp -20;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+jmpf @L432;
+jmp @@peek_next;
+@L432:
+ldidw 10;
+dw2qw;
+ret;
+@L430:
+@L433:
+ldbp 8;
+ldqw;
+ldb;
+ldidw 92;
+eqdw;
+jmpf @L435;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldb;
+ldidw 10;
+eqdw;
+jmpt @L437;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldb;
+ldidw 13;
+eqdw;
+jmpt @L437;
+ldidw 0;
+jmp @L438;
+@L437:
+ldidw 1;
+@L438:
+jmpf @L435;
+ldidw 1;
+jmp @L436;
+@L435:
+ldidw 0;
+@L436:
+jmpf @L434;
+ldbp 8;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldb;
+ldidw 13;
+eqdw;
+jmpf @L439;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldb;
+ldidw 10;
+eqdw;
+jmpf @L439;
+ldidw 1;
+jmp @L440;
+@L439:
+ldidw 0;
+@L440:
+jmpf @L441;
+ldbp 8;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+@L441:
+ldbp 8;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+jmp @L433;
+@L434:
+ldbp -20;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+jmpf @L442;
+ldbp 8;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+jmp @@peek_next;
+@L442:
+ldbp 8;
+ldqw;
+ldb;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `preprocessing_file' ====
+.text
+preprocessing_file:
+addsp 0;         
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L443;
+ldidw 0;
+ldiqw group;
+call 4;
+pop;
+pop;
+@L443:
+ldidw 0;
+ldiqw match;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+quote_dirs:
+.res 512
+.extern strncat
+.extern fileno
+.extern isdigit
+.extern isspace
+.extern hash2
+.bss
+.align 4
+curr_line:
+.res 4
+.bss
+.align 8
+curr_tok:
+.res 8
+.bss
+.align 8
+angle_dirs:
+.res 512
+.extern isalpha
+.extern memmove
+.extern replace_extension
+.extern isgraph
+# ==== start of definition of function `pre_eval_cond_expr' ====
+.text
+pre_eval_cond_expr:
+addsp 28;        
+# var: r, offset: 8
+ldiqw pre_eval_OR_expr;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw @S93;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L444;
+# var: e1, offset: 16
+# var: e2, offset: 24
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldiqw pre_eval_expr;
+call 0;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw @S94;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L445;
+ldiqw curr_tok;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S95;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L445:
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldiqw pre_eval_cond_expr;
+call 0;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ordw;
+jmpf @L446;
+ldbp 16;
+ldqw;
+jmp @L447;
+@L446:
+ldbp 24;
+ldqw;
+@L447:
+ldbp 8;
+stqw;
+pop;
+pop;
+@L444:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern strdup
+# ==== start of definition of function `endif_line' ====
+.text
+endif_line:
+addsp 0;         
+ldiqw @S96;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L448;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+jmp @L449;
+@L448:
+ldiqw @S97;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L449:
+ldiqw @S98;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L450;
+ldidw 3;
+ldiqw match2;
+call 4;
+pop;
+pop;
+jmp @L451;
+@L450:
+ldiqw @S99;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L451:
+ldidw 6;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern arena_new
+.extern cfg_function_to_print
+.extern strncmp
+# ==== start of definition of function `pre_eval_add_expr' ====
+.text
+pre_eval_add_expr:
+addsp 20;        
+# var: r, offset: 8
+ldiqw pre_eval_mul_expr;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L452:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 1;
+eqdw;
+jmpf @L453;
+# var: s, offset: 16
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw @S100;
+ldbp 16;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L454;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_mul_expr;
+call 0;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L455;
+@L454:
+ldiqw @S101;
+ldbp 16;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L456;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_mul_expr;
+call 0;
+subqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L457;
+@L456:
+jmp @L453;
+@L457:
+@L455:
+jmp @L452;
+@L453:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern arena_set_nom_siz
+# ==== start of definition of function `parameterized_define' ====
+.text
+parameterized_define:
+addsp 12;        
+# var: rep, offset: 8
+ldiqw curr_tok;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L458:
+ldiqw @S102;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L459;
+ldiqw @S103;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L460;
+ldiqw @S104;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L461;
+ldiqw @S105;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L461:
+jmp @L462;
+@L460:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+neqdw;
+jmpf @L463;
+ldiqw @S106;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L463:
+@L462:
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw @S107;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L464;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw @S108;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L465;
+ldiqw @S109;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L465:
+jmp @L466;
+@L464:
+ldiqw @S110;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L467;
+ldiqw @S111;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L467:
+@L466:
+jmp @L458;
+@L459:
+ldiqw curr_tok;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldidw 1;
+ldiqw install_macro;
+call 28;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `pre_eval_OR_expr' ====
+.text
+pre_eval_OR_expr:
+addsp 20;        
+# var: r, offset: 8
+ldiqw pre_eval_AND_expr;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L468:
+ldiqw @S112;
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L469;
+# var: r2, offset: 16
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldiqw pre_eval_AND_expr;
+call 0;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ordw;
+jmpt @L470;
+ldbp 16;
+ldqw;
+ordw;
+jmpt @L470;
+ldidw 0;
+jmp @L471;
+@L470:
+ldidw 1;
+@L471:
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L468;
+@L469:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern stat_number_of_c_tokens
+.extern strncpy
+# ==== start of definition of function `uninstall_macro' ====
+.text
+uninstall_macro:
+addsp 20;        
+# param:`name', offset:-24
+# var: h, offset: 4
+# var: np, offset: 8
+# var: prev, offset: 16
+ldbp -24;
+ldqw;
+ldiqw hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw macro_table;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L472:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L475;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L475;
+ldidw 1;
+jmp @L476;
+@L475:
+ldidw 0;
+@L476:
+jmpf @L474;
+@L473:
+ldbp 8;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L472;
+@L474:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L477;
+ldiqw 0;
+ret;
+@L477:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L478;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldiqw macro_table;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L479;
+@L478:
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+@L479:
+ldbp 8;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `dupdir' ====
+.text
+dupdir:
+addsp 12;        
+# param:`dir', offset:-24
+# var: n, offset: 4
+# var: p, offset: 8
+ldbp -24;
+ldqw;
+ldiqw strlen;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldbp 4;
+lddw;
+ldidw 1;
+subdw;
+dw2qw;
+ldxb 1;
+ldidw 47;
+neqdw;
+jmpf @L480;
+ldbp 4;
+lddw;
+ldidw 2;
+adddw;
+dw2qw;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+ldiqw @S113;
+ldbp 8;
+ldqw;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+jmp @L481;
+@L480:
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+@L481:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern strnlen
+# ==== start of definition of function `init' ====
+.text
+init:
+addsp 16;        
+# param:`file_path', offset:-24
+# var: fp, offset: 8
+# var: flen, offset: 16
+ldiqw @S114;
+ldbp -24;
+ldqw;
+ldiqw fopen;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L482;
+ldbp -24;
+ldqw;
+ldiqw @S115;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 24;
+pop;
+pop;
+ldiqw @S116;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L482:
+ldidw 2;
+ldidw 0;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw fseek;
+call 20;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw ftell;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw rewind;
+call 8;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldidw 2;
+adddw;
+udw2qw;
+ldiqw malloc;
+call 8;
+ldiqw buf;
+stqw;
+ldiqw curr;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 1;
+ldiqw buf;
+ldqw;
+ldiqw fread;
+call 32;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldidw 0;
+dw2b;
+ldiqw buf;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+addqw;
+stb;
+pop;
+ldbp 8;
+ldqw;
+ldiqw fclose;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw dup_lexeme;
+call 8;
+ldiqw curr_source_file;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern targeting_arch64
+.data
+.align 8
+pre_token_table:
+.align 8
+.qword @S117+0
+.align 8
+.qword @S118+0
+.align 8
+.qword @S119+0
+.align 8
+.qword @S120+0
+.align 8
+.qword @S121+0
+.align 8
+.qword @S122+0
+.align 8
+.qword @S123+0
+.align 8
+.qword @S124+0
+.extern arena_reset
+.extern fread
+.extern strrchr
+.bss
+.align 8
+buf:
+.res 8
+.extern disable_warnings
+# ==== start of definition of function `pre_eval_mul_expr' ====
+.text
+pre_eval_mul_expr:
+addsp 20;        
+# var: r, offset: 8
+ldiqw pre_eval_una_expr;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L483:
+ldidw 1;
+ldiqw lookahead;
+call 4;
+pop;
+ldidw 1;
+eqdw;
+jmpf @L484;
+# var: s, offset: 16
+ldidw 1;
+ldiqw get_lexeme;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw @S125;
+ldbp 16;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L485;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_una_expr;
+call 0;
+mulqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L486;
+@L485:
+ldiqw @S126;
+ldbp 16;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L487;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_una_expr;
+call 0;
+sdivqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L488;
+@L487:
+ldiqw @S127;
+ldbp 16;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L489;
+ldidw 1;
+ldiqw match2;
+call 4;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw pre_eval_una_expr;
+call 0;
+smodqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L490;
+@L489:
+jmp @L484;
+@L490:
+@L488:
+@L486:
+jmp @L483;
+@L484:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 8
+curr:
+.res 8
+# ==== start of definition of function `install_macro' ====
+.text
+install_macro:
+.global install_macro
+addsp 16;        
+# param:`kind', offset:-20
+# param:`name', offset:-28
+# param:`rep', offset:-36
+# param:`params', offset:-44
+# var: np, offset: 8
+# var: h, offset: 16
+ldbp -28;
+ldqw;
+ldiqw hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+ldbp 16;
+stdw;
+pop;
+ldiqw macro_table;
+ldbp 16;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L491:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L493;
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+lddw;
+jmpf @L494;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -28;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L494;
+ldidw 1;
+jmp @L495;
+@L494:
+ldidw 0;
+@L495:
+jmpf @L496;
+jmp @L493;
+@L496:
+@L492:
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L491;
+@L493:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L497;
+ldiqw 48;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp -28;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -36;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+stdw;
+pop;
+ldbp -44;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw macro_table;
+ldbp 16;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 40;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw macro_table;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L498;
+@L497:
+ldbp -28;
+ldqw;
+ldiqw @S128;
+ldiqw curr_tok;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldiqw curr_tok;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 1;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L498:
+ldidw 0;
+ret;
+.extern ferror
+.extern random
+.extern isblank
+.extern free
+.extern malloc
+.extern srandom
+.extern fgetc
+.data
+@S0:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 58
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 59
+.byte 32
+.byte 102
+.byte 111
+.byte 117
+.byte 110
+.byte 100
+.byte 58
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S1:
+.byte 35
+.byte 0
+@S2:
+.byte 101
+.byte 108
+.byte 105
+.byte 102
+.byte 0
+@S3:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 58
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 59
+.byte 32
+.byte 102
+.byte 111
+.byte 117
+.byte 110
+.byte 100
+.byte 58
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S4:
+.byte 40
+.byte 0
+@S5:
+.byte 41
+.byte 0
+@S6:
+.byte 41
+.byte 0
+@S7:
+.byte 46
+.byte 46
+.byte 46
+.byte 0
+@S8:
+.byte 95
+.byte 95
+.byte 86
+.byte 65
+.byte 95
+.byte 65
+.byte 82
+.byte 71
+.byte 83
+.byte 95
+.byte 95
+.byte 0
+@S9:
+.byte 44
+.byte 0
+@S10:
+.byte 46
+.byte 46
+.byte 46
+.byte 0
+@S11:
+.byte 97
+.byte 114
+.byte 103
+.byte 117
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 110
+.byte 117
+.byte 109
+.byte 98
+.byte 101
+.byte 114
+.byte 32
+.byte 109
+.byte 105
+.byte 115
+.byte 109
+.byte 97
+.byte 116
+.byte 99
+.byte 104
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 109
+.byte 97
+.byte 99
+.byte 114
+.byte 111
+.byte 32
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 0
+@S12:
+.byte 41
+.byte 0
+@S13:
+.byte 46
+.byte 46
+.byte 46
+.byte 0
+@S14:
+.byte 97
+.byte 114
+.byte 103
+.byte 117
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 110
+.byte 117
+.byte 109
+.byte 98
+.byte 101
+.byte 114
+.byte 32
+.byte 109
+.byte 105
+.byte 115
+.byte 109
+.byte 97
+.byte 116
+.byte 99
+.byte 104
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 109
+.byte 97
+.byte 99
+.byte 114
+.byte 111
+.byte 32
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 0
+@S15:
+.byte 95
+.byte 95
+.byte 86
+.byte 65
+.byte 95
+.byte 65
+.byte 82
+.byte 71
+.byte 83
+.byte 95
+.byte 95
+.byte 0
+@S16:
+.byte 94
+.byte 0
+@S17:
+.byte 105
+.byte 102
+.byte 0
+@S18:
+.byte 105
+.byte 102
+.byte 100
+.byte 101
+.byte 102
+.byte 0
+@S19:
+.byte 60
+.byte 60
+.byte 0
+@S20:
+.byte 62
+.byte 62
+.byte 0
+@S21:
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 101
+.byte 100
+.byte 0
+@S22:
+.byte 40
+.byte 0
+@S23:
+.byte 41
+.byte 0
+@S24:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 96
+.byte 41
+.byte 39
+.byte 59
+.byte 32
+.byte 103
+.byte 111
+.byte 116
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S25:
+.byte 35
+.byte 0
+@S26:
+.byte 105
+.byte 102
+.byte 0
+@S27:
+.byte 105
+.byte 102
+.byte 100
+.byte 101
+.byte 102
+.byte 0
+@S28:
+.byte 105
+.byte 102
+.byte 110
+.byte 100
+.byte 101
+.byte 102
+.byte 0
+@S29:
+.byte 38
+.byte 38
+.byte 0
+@S30:
+.byte 40
+.byte 0
+@S31:
+.byte 41
+.byte 0
+@S32:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 96
+.byte 41
+.byte 39
+.byte 59
+.byte 32
+.byte 103
+.byte 111
+.byte 116
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S33:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 112
+.byte 114
+.byte 105
+.byte 109
+.byte 97
+.byte 114
+.byte 121
+.byte 45
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 59
+.byte 32
+.byte 103
+.byte 111
+.byte 116
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S34:
+.byte 124
+.byte 0
+@S35:
+.byte 105
+.byte 110
+.byte 99
+.byte 108
+.byte 117
+.byte 100
+.byte 101
+.byte 0
+@S36:
+.byte 105
+.byte 110
+.byte 99
+.byte 108
+.byte 117
+.byte 100
+.byte 101
+.byte 58
+.byte 32
+.byte 99
+.byte 97
+.byte 110
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 102
+.byte 105
+.byte 110
+.byte 100
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S37:
+.byte 60
+.byte 0
+@S38:
+.byte 62
+.byte 0
+@S39:
+.byte 105
+.byte 110
+.byte 99
+.byte 108
+.byte 117
+.byte 100
+.byte 101
+.byte 58
+.byte 32
+.byte 101
+.byte 109
+.byte 112
+.byte 116
+.byte 121
+.byte 32
+.byte 96
+.byte 60
+.byte 62
+.byte 39
+.byte 0
+@S40:
+.byte 105
+.byte 110
+.byte 99
+.byte 108
+.byte 117
+.byte 100
+.byte 101
+.byte 58
+.byte 32
+.byte 109
+.byte 105
+.byte 115
+.byte 115
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 99
+.byte 108
+.byte 111
+.byte 115
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 96
+.byte 62
+.byte 39
+.byte 0
+@S41:
+.byte 62
+.byte 0
+@S42:
+.byte 105
+.byte 110
+.byte 99
+.byte 108
+.byte 117
+.byte 100
+.byte 101
+.byte 58
+.byte 32
+.byte 99
+.byte 97
+.byte 110
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 102
+.byte 105
+.byte 110
+.byte 100
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S43:
+.byte 105
+.byte 110
+.byte 99
+.byte 108
+.byte 117
+.byte 100
+.byte 101
+.byte 58
+.byte 32
+.byte 34
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 46
+.byte 104
+.byte 34
+.byte 32
+.byte 111
+.byte 114
+.byte 32
+.byte 60
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 46
+.byte 104
+.byte 62
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 101
+.byte 100
+.byte 0
+@S44:
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 101
+.byte 0
+@S45:
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 101
+.byte 58
+.byte 32
+.byte 110
+.byte 97
+.byte 109
+.byte 101
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 101
+.byte 100
+.byte 0
+@S46:
+.byte 117
+.byte 110
+.byte 100
+.byte 101
+.byte 102
+.byte 0
+@S47:
+.byte 117
+.byte 110
+.byte 100
+.byte 101
+.byte 102
+.byte 58
+.byte 32
+.byte 110
+.byte 97
+.byte 109
+.byte 101
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 101
+.byte 100
+.byte 0
+@S48:
+.byte 101
+.byte 114
+.byte 114
+.byte 111
+.byte 114
+.byte 0
+@S49:
+.byte 32
+.byte 0
+@S50:
+.byte 37
+.byte 115
+.byte 0
+@S51:
+.byte 10
+.byte 0
+@S52:
+.byte 117
+.byte 110
+.byte 107
+.byte 110
+.byte 111
+.byte 119
+.byte 110
+.byte 32
+.byte 100
+.byte 105
+.byte 114
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 118
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S53:
+.byte 105
+.byte 110
+.byte 99
+.byte 108
+.byte 117
+.byte 100
+.byte 101
+.byte 47
+.byte 0
+@S54:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 108
+.byte 105
+.byte 98
+.byte 47
+.byte 105
+.byte 110
+.byte 99
+.byte 108
+.byte 117
+.byte 100
+.byte 101
+.byte 47
+.byte 0
+@S55:
+.byte 47
+.byte 117
+.byte 115
+.byte 114
+.byte 47
+.byte 108
+.byte 111
+.byte 99
+.byte 97
+.byte 108
+.byte 47
+.byte 108
+.byte 105
+.byte 98
+.byte 47
+.byte 108
+.byte 117
+.byte 120
+.byte 99
+.byte 99
+.byte 47
+.byte 105
+.byte 110
+.byte 99
+.byte 108
+.byte 117
+.byte 100
+.byte 101
+.byte 47
+.byte 0
+@S56:
+.byte 44
+.byte 0
+@S57:
+.byte 41
+.byte 0
+@S58:
+.byte 101
+.byte 109
+.byte 112
+.byte 116
+.byte 121
+.byte 32
+.byte 109
+.byte 97
+.byte 99
+.byte 114
+.byte 111
+.byte 32
+.byte 97
+.byte 114
+.byte 103
+.byte 117
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 0
+@S59:
+.byte 40
+.byte 0
+@S60:
+.byte 44
+.byte 0
+@S61:
+.byte 41
+.byte 0
+@S62:
+.byte 40
+.byte 0
+@S63:
+.byte 41
+.byte 0
+@S64:
+.byte 109
+.byte 105
+.byte 115
+.byte 115
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 96
+.byte 41
+.byte 39
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 109
+.byte 97
+.byte 99
+.byte 114
+.byte 111
+.byte 32
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 0
+@S65:
+.byte 35
+.byte 0
+@S66:
+.byte 101
+.byte 108
+.byte 105
+.byte 102
+.byte 0
+@S67:
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 0
+@S68:
+.byte 101
+.byte 110
+.byte 100
+.byte 105
+.byte 102
+.byte 0
+@S69:
+.byte 60
+.byte 0
+@S70:
+.byte 62
+.byte 0
+@S71:
+.byte 60
+.byte 61
+.byte 0
+@S72:
+.byte 62
+.byte 61
+.byte 0
+@S73:
+.byte 109
+.byte 105
+.byte 115
+.byte 115
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 116
+.byte 101
+.byte 114
+.byte 109
+.byte 105
+.byte 110
+.byte 97
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 34
+.byte 39
+.byte 34
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 97
+.byte 99
+.byte 116
+.byte 101
+.byte 114
+.byte 0
+@S74:
+.byte 101
+.byte 109
+.byte 112
+.byte 116
+.byte 121
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 97
+.byte 99
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S75:
+.byte 109
+.byte 105
+.byte 115
+.byte 115
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 116
+.byte 101
+.byte 114
+.byte 109
+.byte 105
+.byte 110
+.byte 97
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 39
+.byte 34
+.byte 39
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 97
+.byte 99
+.byte 116
+.byte 101
+.byte 114
+.byte 0
+@S76:
+.byte 117
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 109
+.byte 105
+.byte 110
+.byte 97
+.byte 116
+.byte 101
+.byte 100
+.byte 32
+.byte 99
+.byte 111
+.byte 109
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 0
+@S77:
+.byte 117
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 109
+.byte 105
+.byte 110
+.byte 97
+.byte 116
+.byte 101
+.byte 100
+.byte 32
+.byte 99
+.byte 111
+.byte 109
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 0
+@S78:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 116
+.byte 111
+.byte 107
+.byte 101
+.byte 110
+.byte 0
+@S79:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 112
+.byte 114
+.byte 101
+.byte 46
+.byte 99
+.byte 0
+@S80:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S81:
+.byte 76
+.byte 111
+.byte 103
+.byte 105
+.byte 99
+.byte 97
+.byte 108
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 101
+.byte 120
+.byte 99
+.byte 101
+.byte 101
+.byte 100
+.byte 115
+.byte 32
+.byte 109
+.byte 97
+.byte 120
+.byte 105
+.byte 109
+.byte 117
+.byte 109
+.byte 32
+.byte 108
+.byte 101
+.byte 110
+.byte 103
+.byte 116
+.byte 104
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 37
+.byte 117
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 97
+.byte 99
+.byte 116
+.byte 101
+.byte 114
+.byte 115
+.byte 0
+@S82:
+.byte 10
+.byte 0
+@S83:
+.byte 95
+.byte 95
+.byte 70
+.byte 73
+.byte 76
+.byte 69
+.byte 95
+.byte 95
+.byte 0
+@S84:
+.byte 95
+.byte 95
+.byte 76
+.byte 73
+.byte 78
+.byte 69
+.byte 95
+.byte 95
+.byte 0
+@S85:
+.byte 37
+.byte 100
+.byte 0
+@S86:
+.byte 38
+.byte 0
+@S87:
+.byte 35
+.byte 0
+@S88:
+.byte 101
+.byte 108
+.byte 105
+.byte 102
+.byte 0
+@S89:
+.byte 35
+.byte 0
+@S90:
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 0
+@S91:
+.byte 61
+.byte 61
+.byte 0
+@S92:
+.byte 33
+.byte 61
+.byte 0
+@S93:
+.byte 63
+.byte 0
+@S94:
+.byte 58
+.byte 0
+@S95:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 96
+.byte 58
+.byte 39
+.byte 59
+.byte 32
+.byte 103
+.byte 111
+.byte 116
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S96:
+.byte 35
+.byte 0
+@S97:
+.byte 96
+.byte 35
+.byte 101
+.byte 110
+.byte 100
+.byte 105
+.byte 102
+.byte 39
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 101
+.byte 100
+.byte 0
+@S98:
+.byte 101
+.byte 110
+.byte 100
+.byte 105
+.byte 102
+.byte 0
+@S99:
+.byte 96
+.byte 35
+.byte 101
+.byte 110
+.byte 100
+.byte 105
+.byte 102
+.byte 39
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 101
+.byte 100
+.byte 0
+@S100:
+.byte 43
+.byte 0
+@S101:
+.byte 45
+.byte 0
+@S102:
+.byte 41
+.byte 0
+@S103:
+.byte 46
+.byte 46
+.byte 46
+.byte 0
+@S104:
+.byte 41
+.byte 0
+@S105:
+.byte 96
+.byte 46
+.byte 46
+.byte 46
+.byte 39
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 97
+.byte 116
+.byte 32
+.byte 116
+.byte 104
+.byte 101
+.byte 32
+.byte 101
+.byte 110
+.byte 100
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 116
+.byte 104
+.byte 101
+.byte 32
+.byte 112
+.byte 97
+.byte 114
+.byte 97
+.byte 109
+.byte 101
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 108
+.byte 105
+.byte 115
+.byte 116
+.byte 0
+@S106:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 112
+.byte 97
+.byte 114
+.byte 97
+.byte 109
+.byte 101
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 110
+.byte 97
+.byte 109
+.byte 101
+.byte 0
+@S107:
+.byte 44
+.byte 0
+@S108:
+.byte 41
+.byte 0
+@S109:
+.byte 109
+.byte 105
+.byte 115
+.byte 115
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 112
+.byte 97
+.byte 114
+.byte 97
+.byte 109
+.byte 101
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 110
+.byte 97
+.byte 109
+.byte 101
+.byte 0
+@S110:
+.byte 41
+.byte 0
+@S111:
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 112
+.byte 97
+.byte 114
+.byte 97
+.byte 109
+.byte 101
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 110
+.byte 97
+.byte 109
+.byte 101
+.byte 0
+@S112:
+.byte 124
+.byte 124
+.byte 0
+@S113:
+.byte 47
+.byte 0
+@S114:
+.byte 114
+.byte 98
+.byte 0
+@S115:
+.byte 69
+.byte 114
+.byte 114
+.byte 111
+.byte 114
+.byte 32
+.byte 114
+.byte 101
+.byte 97
+.byte 100
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S116:
+.byte 10
+.byte 0
+@S117:
+.byte 69
+.byte 79
+.byte 70
+.byte 0
+@S118:
+.byte 112
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 117
+.byte 97
+.byte 116
+.byte 111
+.byte 114
+.byte 0
+@S119:
+.byte 112
+.byte 114
+.byte 101
+.byte 112
+.byte 114
+.byte 111
+.byte 99
+.byte 101
+.byte 115
+.byte 115
+.byte 111
+.byte 114
+.byte 32
+.byte 110
+.byte 117
+.byte 109
+.byte 98
+.byte 101
+.byte 114
+.byte 0
+@S120:
+.byte 105
+.byte 100
+.byte 101
+.byte 110
+.byte 116
+.byte 105
+.byte 102
+.byte 105
+.byte 101
+.byte 114
+.byte 0
+@S121:
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 97
+.byte 99
+.byte 116
+.byte 101
+.byte 114
+.byte 32
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S122:
+.byte 115
+.byte 116
+.byte 114
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 108
+.byte 105
+.byte 116
+.byte 101
+.byte 114
+.byte 97
+.byte 108
+.byte 0
+@S123:
+.byte 110
+.byte 101
+.byte 119
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 0
+@S124:
+.byte 111
+.byte 116
+.byte 104
+.byte 101
+.byte 114
+.byte 0
+@S125:
+.byte 42
+.byte 0
+@S126:
+.byte 47
+.byte 0
+@S127:
+.byte 37
+.byte 0
+@S128:
+.byte 109
+.byte 97
+.byte 99
+.byte 114
+.byte 111
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 114
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 101
+.byte 100
+.byte 0
@@ -0,0 +1,2589 @@
+.extern fgets
+.extern bset_iterate
+.extern edge_iterate
+.extern static_objects_list
+.extern is_complete
+.extern ic_addresses
+.extern arena_destroy
+.extern liveness_and_next_use
+.extern is_struct_union_enum
+.extern get_curr_scope_id
+.extern getenv
+.extern atoi
+# ==== start of definition of function `cmp_start' ====
+.text
+cmp_start:
+addsp 16;        
+# param:`p1', offset:-24
+# param:`p2', offset:-32
+# var: k1, offset: 4
+# var: k2, offset: 8
+# var: s1, offset: 12
+# var: s2, offset: 16
+ldbp -24;
+ldqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw ra_intervals;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+ldiqw ra_intervals;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldbp 16;
+lddw;
+neqdw;
+jmpf @L1;
+ldbp 12;
+lddw;
+ldbp 16;
+lddw;
+sgtdw;
+ldbp 12;
+lddw;
+ldbp 16;
+lddw;
+sltdw;
+subdw;
+dw2qw;
+ret;
+@L1:
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+sgtdw;
+ldbp 4;
+lddw;
+ldbp 8;
+lddw;
+sltdw;
+subdw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern bset_member
+.extern exit
+.extern stderr
+.extern restore_scope
+.extern nid2lnid
+.extern rewind
+.extern realloc
+.extern lookup_ordinary_id
+.extern snprintf
+.extern strpbrk
+.extern pop_struct_descriptor
+.extern nid2sid_tab
+.extern fseek
+.extern push_struct_descriptor
+.bss
+.align 8
+ra_intervals:
+.res 8
+.global ra_intervals
+.extern sscanf
+.extern fputc
+.extern vsscanf
+.extern dflow_enter_function
+.extern fwrite
+.extern read_stream
+.extern strspn
+# ==== start of definition of function `update_live' ====
+.text
+update_live:
+addsp 0;         
+# param:`a', offset:-20
+# param:`i', offset:-24
+# param:`is_def', offset:-28
+ldiqw interval_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L2;
+ldiqw 0;
+ret;
+@L2:
+ldbp -28;
+lddw;
+jmpf @L3;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw live;
+ldqw;
+ldiqw bset_delete;
+call 12;
+pop;
+pop;
+jmp @L4;
+@L3:
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw live;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L4:
+ldidw 0;
+ret;
+.extern reset_enum_val
+.extern strtoll
+.extern get_var_nid
+.extern get_sto_class_spec
+.extern bset_cpy
+.extern fclose
+.extern preprocess
+.extern analyze_decl_specs
+.extern strstr
+.extern calloc
+.extern pop_scope
+.extern memset
+.extern file_exists
+.bss
+.align 8
+candidate:
+.res 8
+.extern C_source
+.extern stringify_type_exp
+.extern add_quote_dir
+.extern strtoul
+.extern fprintf
+.extern get_type_qual
+.extern read_file
+.extern address_taken_variables
+.extern printf
+.extern get_c_token
+.extern lookup_tag
+.extern is_external_id
+.extern sprintf
+.extern strcat
+.extern are_compatible
+.extern free_pre_token
+.extern cg_nodes_counter
+.extern round_up
+.extern analyze_declarator
+.bss
+.align 8
+interval_of_nid:
+.res 8
+.extern bset_eq
+.extern strchr
+.extern add_angle_dir
+.extern arena_alloc
+.extern stdout
+.extern ilog2
+.extern strcmp
+.extern bset_fill
+.extern strtok
+.extern strtol
+.extern parse_header
+.extern stdin
+.extern dflow_Dom
+.extern ftell
+.extern strcpy
+.extern install_tag
+.extern strtoull
+.bss
+.align 4
+ra_max_intervals:
+.res 4
+.extern strlen
+.extern token_table
+.extern bset_free
+.extern cfg_nodes
+.extern memchr
+.extern new_type_exp_node
+.extern dup_decl_specs
+.extern new_declaration_node
+.extern vfprintf
+.extern hash
+.extern bsearch
+.extern pre_save_pch
+.bss
+.align 8
+live:
+.res 8
+.extern qsort
+.extern analyze_parameter_declaration
+.extern memcmp
+.extern bset_insert
+.extern pre_load_pch
+.extern dflow_free_LiveOut
+.extern vsnprintf
+.extern vsprintf
+.extern nid_counter
+.extern new_cg_node
+.extern memcpy
+.extern fopen
+.extern be_atoi
+.bss
+.align 4
+ra_nintervals:
+.res 4
+.global ra_nintervals
+# ==== start of definition of function `add_access' ====
+.text
+add_access:
+addsp 12;        
+# param:`a', offset:-20
+# param:`i', offset:-24
+# param:`is_def', offset:-28
+# var: k, offset: 4
+# var: p, offset: 8
+ldiqw interval_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 4;
+stdw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L5;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L10;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw cross_block_temps;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+notdw;
+jmpf @L10;
+ldidw 1;
+jmp @L11;
+@L10:
+ldidw 0;
+@L11:
+jmpt @L8;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw addressed_variables;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpt @L8;
+ldidw 0;
+jmp @L9;
+@L8:
+ldidw 1;
+@L9:
+jmpt @L6;
+ldbp -20;
+lddw;
+ldiqw candidate;
+ldqw;
+call 4;
+pop;
+notdw;
+jmpt @L6;
+ldidw 0;
+jmp @L7;
+@L6:
+ldidw 1;
+@L7:
+jmpf @L12;
+ldiqw 0;
+ret;
+@L12:
+ldiqw ra_nintervals;
+lddw;
+ldiqw ra_max_intervals;
+lddw;
+sgetdw;
+jmpf @L13;
+ldiqw ra_max_intervals;
+lddw;
+jmpf @L14;
+ldiqw ra_max_intervals;
+lddw;
+ldidw 2;
+muldw;
+jmp @L15;
+@L14:
+ldidw 64;
+@L15:
+ldiqw ra_max_intervals;
+stdw;
+pop;
+ldiqw ra_max_intervals;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+ldiqw ra_intervals;
+ldqw;
+ldiqw realloc;
+call 16;
+ldiqw ra_intervals;
+stqw;
+pop;
+pop;
+@L13:
+ldiqw ra_nintervals;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw interval_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ra_intervals;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldidw 1;
+negdw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+@L5:
+ldiqw ra_intervals;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw extend_interval;
+call 12;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw access_weight;
+lddw;
+adddw;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern bset_delete
+.extern push_scope
+.extern free_c_token
+.extern ic_main
+.extern new_address
+.extern parse
+.extern get_pre_token
+.extern get_member_descriptor
+.extern decl_init
+.extern ic_free_function
+.bss
+.align 8
+ra_reg_of_nid:
+.res 8
+.global ra_reg_of_nid
+.extern dup_declarator
+.extern cg_nodes
+.extern strncat
+.extern dflow_free_Dom
+.extern fileno
+.extern bset_update
+.extern dflow_LiveOut
+.extern lookup_external_id
+.extern hash2
+.extern analyze_type_name
+.extern memmove
+.extern replace_extension
+.extern analyze_struct_declarator
+.extern get_type_spec
+.bss
+.align 8
+addressed_variables:
+.res 8
+.extern cfg_nodes_counter
+.extern analyze_function_definition
+.extern strdup
+.extern bset_new
+.extern arena_new
+.extern analyze_init_declarator
+.bss
+.align 8
+cross_block_temps:
+.res 8
+.extern strncmp
+# ==== start of definition of function `extend_interval' ====
+.text
+extend_interval:
+addsp 0;         
+# param:`p', offset:-24
+# param:`i', offset:-28
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 4;
+addqw;
+lddw;
+sltdw;
+jmpf @L16;
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 4;
+addqw;
+stdw;
+pop;
+@L16:
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+sgtdw;
+jmpf @L17;
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+@L17:
+ldidw 0;
+ret;
+.extern arena_set_nom_siz
+.extern bset_union_diff
+# ==== start of definition of function `visit_operands' ====
+.text
+visit_operands:
+addsp 12;        
+# param:`i', offset:-20
+# param:`f', offset:-28
+# var: tar, offset: 4
+# var: arg1, offset: 8
+# var: arg2, offset: 12
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T18;
+jmptab;
+@L20:
+@L21:
+@L22:
+@L23:
+@L24:
+@L25:
+@L26:
+@L27:
+@L28:
+@L29:
+@L30:
+@L31:
+@L32:
+@L33:
+@L34:
+@L35:
+ldidw 1;
+ldbp -20;
+lddw;
+ldbp 4;
+lddw;
+ldbp -28;
+ldqw;
+call 12;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L36;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L36;
+ldidw 0;
+jmp @L37;
+@L36:
+ldidw 1;
+@L37:
+notdw;
+jmpf @L38;
+ldidw 0;
+ldbp -20;
+lddw;
+ldbp 8;
+lddw;
+ldbp -28;
+ldqw;
+call 12;
+pop;
+pop;
+@L38:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L39;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L39;
+ldidw 0;
+jmp @L40;
+@L39:
+ldidw 1;
+@L40:
+notdw;
+jmpf @L41;
+ldidw 0;
+ldbp -20;
+lddw;
+ldbp 12;
+lddw;
+ldbp -28;
+ldqw;
+call 12;
+pop;
+pop;
+@L41:
+jmp @L19;
+@L42:
+@L43:
+@L44:
+@L45:
+@L46:
+@L47:
+@L48:
+@L49:
+@L50:
+@L51:
+@L52:
+ldidw 1;
+ldbp -20;
+lddw;
+ldbp 4;
+lddw;
+ldbp -28;
+ldqw;
+call 12;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L53;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L53;
+ldidw 0;
+jmp @L54;
+@L53:
+ldidw 1;
+@L54:
+notdw;
+jmpf @L55;
+ldidw 0;
+ldbp -20;
+lddw;
+ldbp 8;
+lddw;
+ldbp -28;
+ldqw;
+call 12;
+pop;
+pop;
+@L55:
+jmp @L19;
+@L56:
+ldidw 1;
+ldbp -20;
+lddw;
+ldbp 4;
+lddw;
+ldbp -28;
+ldqw;
+call 12;
+pop;
+pop;
+jmp @L19;
+@L57:
+@L58:
+@L59:
+@L60:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L61;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L61;
+ldidw 0;
+jmp @L62;
+@L61:
+ldidw 1;
+@L62:
+notdw;
+jmpf @L63;
+ldidw 0;
+ldbp -20;
+lddw;
+ldbp 8;
+lddw;
+ldbp -28;
+ldqw;
+call 12;
+pop;
+pop;
+@L63:
+jmp @L19;
+@L64:
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L65;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L65;
+ldidw 0;
+jmp @L66;
+@L65:
+ldidw 1;
+@L66:
+notdw;
+jmpf @L67;
+ldidw 0;
+ldbp -20;
+lddw;
+ldbp 8;
+lddw;
+ldbp -28;
+ldqw;
+call 12;
+pop;
+pop;
+@L67:
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L68;
+ldiqw ic_addresses;
+ldqw;
+ldbp 12;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L68;
+ldidw 0;
+jmp @L69;
+@L68:
+ldidw 1;
+@L69:
+notdw;
+jmpf @L70;
+ldidw 0;
+ldbp -20;
+lddw;
+ldbp 12;
+lddw;
+ldbp -28;
+ldqw;
+call 12;
+pop;
+pop;
+@L70:
+jmp @L19;
+@L71:
+@L72:
+ldbp 4;
+lddw;
+jmpf @L73;
+ldidw 1;
+ldbp -20;
+lddw;
+ldbp 4;
+lddw;
+ldbp -28;
+ldqw;
+call 12;
+pop;
+pop;
+@L73:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 29;
+eqdw;
+jmpf @L74;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L76;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L76;
+ldidw 0;
+jmp @L77;
+@L76:
+ldidw 1;
+@L77:
+notdw;
+jmpf @L74;
+ldidw 1;
+jmp @L75;
+@L74:
+ldidw 0;
+@L75:
+jmpf @L78;
+ldidw 0;
+ldbp -20;
+lddw;
+ldbp 8;
+lddw;
+ldbp -28;
+ldqw;
+call 12;
+pop;
+pop;
+@L78:
+jmp @L19;
+@L19:
+.data
+.align 8
+@T18:
+.dword 0
+.dword 38
+.qword @L19
+.qword @L20
+.qword @L21
+.qword @L22
+.qword @L23
+.qword @L24
+.qword @L25
+.qword @L26
+.qword @L27
+.qword @L28
+.qword @L29
+.qword @L30
+.qword @L31
+.qword @L32
+.qword @L33
+.qword @L34
+.qword @L35
+.qword @L42
+.qword @L43
+.qword @L44
+.qword @L45
+.qword @L47
+.qword @L48
+.qword @L49
+.qword @L50
+.qword @L51
+.qword @L56
+.qword @L52
+.qword @L46
+.qword @L71
+.qword @L72
+.qword @L64
+.qword @L19
+.qword @L19
+.qword @L57
+.qword @L58
+.qword @L59
+.qword @L19
+.qword @L60
+.text
+ldidw 0;
+ret;
+.bss
+.align 4
+access_weight:
+.res 4
+# ==== start of definition of function `ra_init' ====
+.text
+ra_init:
+.global ra_init
+addsp 0;         
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw malloc;
+call 8;
+ldiqw ra_reg_of_nid;
+stqw;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldidw 1;
+negdw;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw interval_of_nid;
+stqw;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldiqw interval_of_nid;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern strncpy
+.extern bset_clear
+.extern decl_save_pch
+.extern bset_card
+.extern ic_instructions
+.extern new_extern_id_node
+.extern decl_load_pch
+.extern bset_union
+.extern analyze_translation_unit
+.extern strnlen
+.extern bset_new_in
+.extern analyze_enumerator
+.extern set_attributes
+.extern is_typedef_name
+.extern dflow_exit_function
+.extern arena_reset
+.extern fread
+.extern strrchr
+.extern bset_next
+# ==== start of definition of function `ra_allocate' ====
+.text
+ra_allocate:
+.global ra_allocate
+addsp 120;       
+# param:`fn', offset:-20
+# param:`nregs', offset:-24
+# param:`is_candidate', offset:-32
+# var: b, offset: 4
+# var: i, offset: 8
+# var: k, offset: 12
+# var: r, offset: 16
+# var: entry_bb, offset: 20
+# var: exit_bb, offset: 24
+# var: used, offset: 28
+# var: depth, offset: 32
+# var: order, offset: 40
+# var: active, offset: 48
+@L79:
+ldbp -24;
+lddw;
+ldidw 16;
+sletdw;
+notdw;
+jmpf @L82;
+ldidw 168;
+ldiqw @S0;
+ldiqw @S1;
+ldiqw @S2;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L82:
+@L80:
+ldidw 0;
+jmpf @L81;
+jmp @L79;
+@L81:
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+@L83:
+ldbp 12;
+lddw;
+ldiqw ra_nintervals;
+lddw;
+sltdw;
+jmpf @L85;
+ldidw 1;
+negdw;
+dw2b;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ra_intervals;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+ldidw 1;
+negdw;
+ldiqw interval_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ra_intervals;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L84:
+incldw 12;
+jmp @L83;
+@L85:
+ldidw 0;
+ldiqw ra_nintervals;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L86;
+ldidw 0;
+dw2qw;
+ret;
+@L86:
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 20;
+stdw;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 24;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw candidate;
+stqw;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldiqw dflow_enter_function;
+call 4;
+pop;
+pop;
+ldiqw 4;
+ldbp 24;
+lddw;
+ldbp 20;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L87:
+ldbp 4;
+lddw;
+ldbp 24;
+lddw;
+uletdw;
+jmpf @L89;
+# var: succ, offset: 112
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw edge_iterate;
+call 8;
+pop;
+ldbp 112;
+stdw;
+pop;
+@L90:
+ldbp 112;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L92;
+ldbp 112;
+lddw;
+ldbp 4;
+lddw;
+uletdw;
+jmpf @L93;
+ldbp 112;
+lddw;
+ldbp 12;
+stdw;
+pop;
+@L94:
+ldbp 12;
+lddw;
+ldbp 4;
+lddw;
+sletdw;
+jmpf @L96;
+ldbp 32;
+ldqw;
+ldbp 12;
+lddw;
+ldbp 20;
+lddw;
+subdw;
+udw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+@L95:
+incldw 12;
+jmp @L94;
+@L96:
+@L93:
+@L91:
+ldidw 0;
+dw2qw;
+ldiqw edge_iterate;
+call 8;
+pop;
+ldbp 112;
+stdw;
+pop;
+jmp @L90;
+@L92:
+@L88:
+incldw 4;
+jmp @L87;
+@L89:
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ldiqw bset_new;
+call 4;
+ldiqw cross_block_temps;
+stqw;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ldiqw bset_new;
+call 4;
+ldiqw addressed_variables;
+stqw;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L97:
+ldbp 4;
+lddw;
+ldbp 24;
+lddw;
+uletdw;
+jmpf @L99;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw cross_block_temps;
+ldqw;
+ldiqw bset_union;
+call 16;
+pop;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L100:
+ldbp 8;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+sletdw;
+jmpf @L102;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 25;
+eqdw;
+jmpf @L103;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw addressed_variables;
+ldqw;
+ldiqw bset_insert;
+call 12;
+pop;
+pop;
+@L103:
+@L101:
+incldw 8;
+jmp @L100;
+@L102:
+@L98:
+incldw 4;
+jmp @L97;
+@L99:
+ldbp 20;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L104:
+ldbp 4;
+lddw;
+ldbp 24;
+lddw;
+uletdw;
+jmpf @L106;
+# var: d, offset: 112
+ldbp 32;
+ldqw;
+ldbp 4;
+lddw;
+ldbp 20;
+lddw;
+subdw;
+udw2qw;
+ldxdw 4;
+ldbp 112;
+stdw;
+ldidw 5;
+sgtdw;
+jmpf @L107;
+ldidw 5;
+ldbp 112;
+stdw;
+pop;
+@L107:
+ldidw 1;
+ldidw 3;
+ldbp 112;
+lddw;
+muldw;
+slldw;
+ldiqw access_weight;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L108:
+ldbp 8;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+sletdw;
+jmpf @L110;
+ldiqw add_access;
+ldbp 8;
+lddw;
+ldiqw visit_operands;
+call 12;
+pop;
+pop;
+@L109:
+incldw 8;
+jmp @L108;
+@L110:
+@L105:
+incldw 4;
+jmp @L104;
+@L106:
+ldiqw cross_block_temps;
+ldqw;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+ldiqw addressed_variables;
+ldqw;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldiqw cg_nodes;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 64;
+addqw;
+lddw;
+ldiqw bset_new;
+call 4;
+ldiqw live;
+stqw;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L111:
+ldbp 4;
+lddw;
+ldbp 24;
+lddw;
+uletdw;
+jmpf @L113;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw live;
+ldqw;
+ldiqw bset_cpy;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+@L114:
+ldbp 12;
+lddw;
+ldiqw ra_nintervals;
+lddw;
+sltdw;
+jmpf @L116;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ra_intervals;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw live;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L117;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldiqw ra_intervals;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw extend_interval;
+call 12;
+pop;
+pop;
+@L117:
+@L115:
+incldw 12;
+jmp @L114;
+@L116:
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+@L118:
+ldbp 8;
+lddw;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+sgetdw;
+jmpf @L120;
+ldiqw update_live;
+ldbp 8;
+lddw;
+ldiqw visit_operands;
+call 12;
+pop;
+pop;
+@L119:
+decldw 8;
+jmp @L118;
+@L120:
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+@L121:
+ldbp 12;
+lddw;
+ldiqw ra_nintervals;
+lddw;
+sltdw;
+jmpf @L123;
+ldiqw nid2lnid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ra_intervals;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw live;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L124;
+ldiqw cfg_nodes;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw ra_intervals;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw extend_interval;
+call 12;
+pop;
+pop;
+@L124:
+@L122:
+incldw 12;
+jmp @L121;
+@L123:
+@L112:
+incldw 4;
+jmp @L111;
+@L113:
+ldiqw live;
+ldqw;
+ldiqw bset_free;
+call 8;
+pop;
+pop;
+ldiqw ra_nintervals;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+@L125:
+ldbp 12;
+lddw;
+ldiqw ra_nintervals;
+lddw;
+sltdw;
+jmpf @L127;
+ldbp 12;
+lddw;
+ldbp 40;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L126:
+incldw 12;
+jmp @L125;
+@L127:
+ldiqw cmp_start;
+ldiqw 4;
+ldiqw ra_nintervals;
+lddw;
+dw2qw;
+ldbp 40;
+ldqw;
+ldiqw qsort;
+call 32;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L128:
+ldbp 16;
+lddw;
+ldbp -24;
+lddw;
+sltdw;
+jmpf @L130;
+ldidw 1;
+negdw;
+ldbp 48;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L129:
+incldw 16;
+jmp @L128;
+@L130:
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+@L131:
+ldbp 12;
+lddw;
+ldiqw ra_nintervals;
+lddw;
+sltdw;
+jmpf @L133;
+# var: p, offset: 112
+# var: victim, offset: 120
+ldiqw ra_intervals;
+ldqw;
+ldbp 40;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldbp 112;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L134:
+ldbp 16;
+lddw;
+ldbp -24;
+lddw;
+sltdw;
+jmpf @L136;
+ldbp 48;
+ldbp 16;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L137;
+ldiqw ra_intervals;
+ldqw;
+ldbp 48;
+ldbp 16;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 112;
+ldqw;
+ldiqw 4;
+addqw;
+lddw;
+sltdw;
+jmpf @L137;
+ldidw 1;
+jmp @L138;
+@L137:
+ldidw 0;
+@L138:
+jmpf @L139;
+ldidw 1;
+negdw;
+ldbp 48;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L139:
+@L135:
+incldw 16;
+jmp @L134;
+@L136:
+ldbp 112;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldidw 3;
+sltdw;
+jmpf @L140;
+jmp @L132;
+@L140:
+ldidw 1;
+negdw;
+ldbp 120;
+stdw;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L141:
+ldbp 16;
+lddw;
+ldbp -24;
+lddw;
+sltdw;
+jmpf @L143;
+ldbp 48;
+ldbp 16;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L144;
+jmp @L143;
+@L144:
+ldbp 120;
+lddw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L145;
+ldiqw ra_intervals;
+ldqw;
+ldbp 48;
+ldbp 16;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw ra_intervals;
+ldqw;
+ldbp 48;
+ldbp 120;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+sltdw;
+jmpt @L145;
+ldidw 0;
+jmp @L146;
+@L145:
+ldidw 1;
+@L146:
+jmpf @L147;
+ldbp 16;
+lddw;
+ldbp 120;
+stdw;
+pop;
+@L147:
+@L142:
+incldw 16;
+jmp @L141;
+@L143:
+ldbp 16;
+lddw;
+ldbp -24;
+lddw;
+eqdw;
+jmpf @L148;
+ldiqw ra_intervals;
+ldqw;
+ldbp 48;
+ldbp 120;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 112;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+sgetdw;
+jmpf @L149;
+jmp @L132;
+@L149:
+ldidw 1;
+negdw;
+ldiqw ra_intervals;
+ldqw;
+ldbp 48;
+ldbp 120;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldbp 120;
+lddw;
+ldbp 16;
+stdw;
+pop;
+@L148:
+ldbp 16;
+lddw;
+ldbp 112;
+ldqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldbp 40;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 48;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L132:
+incldw 12;
+jmp @L131;
+@L133:
+ldbp 40;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldbp 28;
+stdw;
+pop;
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+@L150:
+ldbp 12;
+lddw;
+ldiqw ra_nintervals;
+lddw;
+sltdw;
+jmpf @L152;
+ldiqw ra_intervals;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L153;
+ldbp 16;
+lddw;
+dw2b;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ra_intervals;
+ldqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+ldbp 28;
+lddw;
+ldidw 1;
+ldbp 16;
+lddw;
+slldw;
+ordw;
+ldbp 28;
+stdw;
+pop;
+@L153:
+@L151:
+incldw 12;
+jmp @L150;
+@L152:
+ldbp 28;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern bset_diff
+.extern install_macro
+.extern bset_inters
+.extern edge_add
+.extern ferror
+.extern random
+.extern ic_instructions_counter
+.extern free
+.extern malloc
+.extern get_external_declarations
+.extern new_decl_list_node
+.extern compute_liveness_and_next_use
+.extern srandom
+.extern lookup_struct_descriptor
+.extern new_exec_node
+.extern fgetc
+.data
+@S0:
+.byte 114
+.byte 97
+.byte 95
+.byte 97
+.byte 108
+.byte 108
+.byte 111
+.byte 99
+.byte 97
+.byte 116
+.byte 101
+.byte 0
+@S1:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 114
+.byte 101
+.byte 103
+.byte 97
+.byte 108
+.byte 108
+.byte 111
+.byte 99
+.byte 46
+.byte 99
+.byte 0
+@S2:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
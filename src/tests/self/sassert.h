@@ -0,0 +1,7 @@
+#ifndef _SASSERT_H
+#define _SASSERT_H
+
+#define _ASSERT_TYPE        0
+#define _ASSERT_IMMUTABLE   1
+
+#endif
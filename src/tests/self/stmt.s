@@ -0,0 +1,3116 @@
+.extern fgets
+.extern get_promoted_type
+.extern analyze_bitwise_operator
+.extern atom_n
+.bss
+.align 8
+ret_ty:
+.res 16
+.extern is_complete
+.extern analyze_unary_expression
+.bss
+.align 8
+label_names_arena:
+.res 8
+.extern emit_warning
+.extern arena_destroy
+.extern is_struct_union_enum
+.extern get_sizeof
+.extern emit_error
+.extern get_curr_scope_id
+.extern getenv
+.extern can_assign_to
+.extern atoi
+.extern atom
+.bss
+.align 8
+unresolved_gotos_list:
+.res 8
+.extern exit
+.bss
+.align 8
+switch_arena:
+.res 128
+# ==== start of definition of function `stmt_done' ====
+.text
+stmt_done:
+.global stmt_done
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L1:
+ldbp 4;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L3;
+ldiqw switch_arena;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw arena_destroy;
+call 8;
+pop;
+pop;
+@L2:
+incldw 4;
+jmp @L1;
+@L3:
+ldiqw label_names_arena;
+ldqw;
+ldiqw arena_destroy;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern stderr
+.bss
+.align 8
+switch_labels_list:
+.res 128
+.extern restore_scope
+.extern tolower
+.extern rewind
+.extern get_type_node
+.extern analyze_logical_operator
+.extern realloc
+.extern lookup_ordinary_id
+.extern snprintf
+.data
+.align 4
+switch_nesting_level:
+.align 4
+.dword -1
+.extern strpbrk
+.extern pop_struct_descriptor
+.extern fseek
+.extern atom_tag
+.extern islower
+.extern push_struct_descriptor
+.extern sscanf
+.extern fputc
+# ==== start of definition of function `stmt_init' ====
+.text
+stmt_init:
+.global stmt_init
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L4:
+ldbp 4;
+lddw;
+ldidw 16;
+sltdw;
+jmpf @L6;
+ldidw 0;
+ldiqw 32;
+ldidw 8;
+dw2qw;
+mulqw;
+pop;
+ldiqw arena_new;
+call 8;
+ldiqw switch_arena;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L5:
+incldw 4;
+jmp @L4;
+@L6:
+ldidw 0;
+ldiqw 24;
+ldidw 16;
+dw2qw;
+mulqw;
+pop;
+ldiqw arena_new;
+call 8;
+ldiqw label_names_arena;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern vsscanf
+.extern atom_set_tag
+.bss
+.align 4
+switch_case_counter:
+.res 64
+# ==== start of definition of function `analyze_selection_statement' ====
+.text
+analyze_selection_statement:
+.global analyze_selection_statement
+addsp 4;         
+# param:`s', offset:-24
+# var: ty, offset: 4
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 90;
+eqdw;
+jmpf @L7;
+ldiqw 0;
+ret;
+@L7:
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L8;
+ldbp 4;
+lddw;
+ldiqw is_scalar;
+call 4;
+pop;
+notdw;
+jmpf @L9;
+ldiqw @S0;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L9:
+jmp @L10;
+@L8:
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpf @L11;
+ldiqw @S1;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L11:
+@L10:
+ldidw 0;
+ret;
+.extern fwrite
+.extern is_pointer
+.extern read_stream
+.extern strspn
+.extern ispunct
+.extern reset_enum_val
+.extern strtoll
+.extern analyze_relational_equality_expression
+.extern get_sto_class_spec
+# ==== start of definition of function `analyze_jump_statement' ====
+.text
+analyze_jump_statement:
+.global analyze_jump_statement
+addsp 20;        
+# param:`s', offset:-24
+# param:`in_loop', offset:-28
+# param:`in_switch', offset:-32
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T12;
+jmptab;
+@L14:
+# var: lab, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw lookup_label_name;
+call 8;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L15;
+# var: new_node, offset: 16
+ldiqw 16;
+ldiqw malloc;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw unresolved_gotos_list;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw unresolved_gotos_list;
+stqw;
+pop;
+pop;
+@L15:
+jmp @L13;
+@L16:
+ldbp -28;
+lddw;
+notdw;
+jmpf @L17;
+ldiqw @S2;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L17:
+jmp @L13;
+@L18:
+ldbp -28;
+lddw;
+notdw;
+jmpf @L19;
+ldbp -32;
+lddw;
+notdw;
+jmpf @L19;
+ldidw 1;
+jmp @L20;
+@L19:
+ldidw 0;
+@L20:
+jmpf @L21;
+ldiqw @S3;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L21:
+jmp @L13;
+@L22:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L23;
+ldiqw ret_ty;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L24;
+ldiqw ret_ty;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L24;
+ldidw 1;
+jmp @L25;
+@L24:
+ldidw 0;
+@L25:
+jmpf @L26;
+@L27:
+ldiqw @S4;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L28:
+ldidw 0;
+jmpf @L29;
+jmp @L27;
+@L29:
+@L26:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 90;
+eqdw;
+jmpf @L30;
+ldiqw 0;
+ret;
+@L30:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw ret_ty;
+ldiqw can_assign_to;
+call 16;
+pop;
+notdw;
+jmpf @L31;
+# var: ty1, offset: 8
+# var: ty2, offset: 16
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw stringify_type_exp;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldiqw ret_ty;
+ldiqw stringify_type_exp;
+call 12;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S5;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 44;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+@L31:
+ldiqw ret_ty;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw ret_ty;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L32;
+@L23:
+ldiqw ret_ty;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpt @L33;
+ldiqw ret_ty;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+neqdw;
+jmpt @L33;
+ldidw 0;
+jmp @L34;
+@L33:
+ldidw 1;
+@L34:
+jmpf @L35;
+ldiqw @S6;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L35:
+@L32:
+jmp @L13;
+@L13:
+.data
+.align 8
+@T12:
+.dword 4
+.dword 10
+.qword @L13
+.qword @L18
+.qword @L16
+.qword @L22
+.qword @L13
+.qword @L13
+.qword @L13
+.qword @L13
+.qword @L13
+.qword @L13
+.qword @L14
+.text
+ldidw 0;
+ret;
+.extern fclose
+.extern preprocess
+.extern analyze_decl_specs
+.extern strstr
+.extern calloc
+.bss
+.align 8
+label_names_list:
+.res 8
+.extern pop_scope
+.extern memset
+.extern file_exists
+.extern analyze_cast_expression
+# ==== start of definition of function `increase_switch_nesting_level' ====
+.text
+increase_switch_nesting_level:
+.global increase_switch_nesting_level
+addsp 0;         
+# param:`e', offset:-24
+ldiqw switch_nesting_level;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldiqw switch_nesting_level;
+lddw;
+ldidw 16;
+sgetdw;
+jmpf @L36;
+ldidw 16;
+ldiqw @S7;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 20;
+pop;
+pop;
+ldiqw @S8;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L36:
+ldidw 1;
+ldiqw switch_case_counter;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw switch_contr_expr_types;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern stringify_type_exp
+.extern add_quote_dir
+.extern strtoul
+.extern isprint
+# ==== start of definition of function `set_return_type' ====
+.text
+set_return_type:
+.global set_return_type
+addsp 0;         
+# param:`ds', offset:-24
+# param:`dct', offset:-32
+ldbp -24;
+ldqw;
+ldiqw ret_ty;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw ret_ty;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern fprintf
+.extern get_type_qual
+.extern read_file
+.extern is_signed_int
+.extern printf
+.extern get_c_token
+.extern lookup_tag
+.extern get_rank
+.extern is_external_id
+.extern isalnum
+.extern sprintf
+.extern errno
+.extern isxdigit
+.extern strcat
+.extern are_compatible
+# ==== start of definition of function `resolve_gotos' ====
+.text
+resolve_gotos:
+.global resolve_gotos
+addsp 28;        
+# var: p, offset: 8
+ldiqw unresolved_gotos_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L37:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L38;
+# var: lab, offset: 16
+# var: temp, offset: 24
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw lookup_label_name;
+call 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L39;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S9;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L39:
+ldbp 8;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+jmp @L37;
+@L38:
+ldidw 0;
+dw2qw;
+ldiqw unresolved_gotos_list;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern free_pre_token
+.extern round_up
+.extern analyze_declarator
+# ==== start of definition of function `lookup_label_name' ====
+.text
+lookup_label_name:
+addsp 12;        
+# param:`name', offset:-24
+# var: np, offset: 8
+ldiqw label_names;
+ldbp -24;
+ldqw;
+ldiqw atom_hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L40:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L42;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+eqqw;
+jmpf @L43;
+ldbp 8;
+ldqw;
+ret;
+@L43:
+@L41:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L40;
+@L42:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern strchr
+.extern toupper
+.extern add_angle_dir
+.extern analyze_conditional_expression
+.extern arena_alloc
+.extern stdout
+.extern get_type_category
+.extern ilog2
+.extern strcmp
+.extern strtok
+.extern strtol
+.extern parse_header
+.extern stdin
+.extern is_integer
+.extern analyze_postfix_expression
+.extern ftell
+.extern strcpy
+.bss
+.align 8
+switch_labels:
+.res 523904
+.extern install_tag
+.extern isupper
+.extern strtoull
+.extern strlen
+.extern token_table
+.extern analyze_expression
+.extern memchr
+.extern new_type_exp_node
+.extern analyze_primary_expression
+.extern dup_decl_specs
+.extern new_declaration_node
+.extern vfprintf
+.extern eval_const_expr
+.extern hash
+.extern iscntrl
+.extern bsearch
+.bss
+.align 8
+label_names:
+.res 32744
+.extern pre_save_pch
+.extern qsort
+.extern analyze_parameter_declaration
+.extern memcmp
+.extern pre_load_pch
+.extern vsnprintf
+.extern vsprintf
+.extern memcpy
+.bss
+.align 4
+switch_contr_expr_types:
+.res 64
+.extern fopen
+.extern be_atoi
+# ==== start of definition of function `install_switch_label' ====
+.text
+install_switch_label:
+addsp 20;        
+# param:`val', offset:-24
+# param:`is_default', offset:-28
+# var: np, offset: 8
+# var: h, offset: 16
+ldbp -28;
+lddw;
+jmpf @L44;
+ldidw 0;
+dw2qw;
+jmp @L45;
+@L44:
+ldbp -24;
+ldqw;
+ldiqw hash2;
+call 8;
+ldidw 4093;
+dw2qw;
+umodqw;
+@L45:
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw switch_labels;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 32744;
+mulqw;
+addqw;
+ldbp 16;
+ldqw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L46:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L47;
+ldbp -28;
+lddw;
+jmpf @L48;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+jmpf @L49;
+jmp @L47;
+@L49:
+jmp @L50;
+@L48:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+notdw;
+jmpf @L51;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+eqqw;
+jmpf @L51;
+ldidw 1;
+jmp @L52;
+@L51:
+ldidw 0;
+@L52:
+jmpf @L53;
+jmp @L47;
+@L53:
+@L50:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L46;
+@L47:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L54;
+ldiqw 32;
+pop;
+ldiqw switch_arena;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldiqw switch_labels;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 32744;
+mulqw;
+addqw;
+ldbp 16;
+ldqw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw switch_labels;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 32744;
+mulqw;
+addqw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw switch_labels_list;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw switch_labels_list;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 1;
+dw2qw;
+ret;
+jmp @L55;
+@L54:
+ldidw 0;
+dw2qw;
+ret;
+@L55:
+ldidw 0;
+ret;
+# ==== start of definition of function `analyze_labeled_statement' ====
+.text
+analyze_labeled_statement:
+.global analyze_labeled_statement
+addsp 20;        
+# param:`s', offset:-24
+# param:`in_switch', offset:-28
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T56;
+jmptab;
+@L58:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw install_label_name;
+call 8;
+pop;
+notdw;
+jmpf @L59;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S10;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L59:
+jmp @L57;
+@L60:
+# var: val, offset: 8
+# var: ty, offset: 16
+# var: cty, offset: 20
+ldiqw switch_case_counter;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldbp -28;
+lddw;
+notdw;
+jmpf @L61;
+ldiqw @S11;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L61:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 16;
+stdw;
+ldidw 90;
+eqdw;
+jmpf @L62;
+ldiqw 0;
+ret;
+@L62:
+ldbp 16;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpf @L63;
+@L64:
+ldiqw @S12;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L65:
+ldidw 0;
+jmpf @L66;
+jmp @L64;
+@L66:
+@L63:
+ldidw 1;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw eval_const_expr;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw switch_contr_expr_types;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 20;
+stdw;
+pop;
+ldbp 20;
+lddw;
+ldidw 110;
+neqdw;
+jmpf @L67;
+ldbp 20;
+lddw;
+ldidw 111;
+neqdw;
+jmpf @L67;
+ldidw 1;
+jmp @L68;
+@L67:
+ldidw 0;
+@L68:
+jmpf @L69;
+ldbp 8;
+ldqw;
+pop;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L69:
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw install_switch_label;
+call 12;
+pop;
+notdw;
+jmpf @L70;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S13;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 36;
+pop;
+pop;
+@L70:
+jmp @L57;
+@L71:
+ldbp -28;
+lddw;
+notdw;
+jmpf @L72;
+@L73:
+ldiqw @S14;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L74:
+ldidw 0;
+jmpf @L75;
+jmp @L73;
+@L75:
+@L72:
+ldidw 1;
+ldidw 0;
+dw2qw;
+ldiqw install_switch_label;
+call 12;
+pop;
+notdw;
+jmpf @L76;
+ldiqw @S15;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 28;
+pop;
+pop;
+@L76:
+jmp @L57;
+@L57:
+.data
+.align 8
+@T56:
+.dword 10
+.dword 3
+.qword @L57
+.qword @L60
+.qword @L71
+.qword @L58
+.text
+ldidw 0;
+ret;
+.extern push_scope
+.extern free_c_token
+.extern parse
+.extern get_pre_token
+.extern get_member_descriptor
+.extern decl_init
+.extern dup_declarator
+.extern strncat
+.extern fileno
+.extern isdigit
+.extern lookup_external_id
+.extern isspace
+.extern hash2
+.extern analyze_type_name
+.extern isalpha
+.extern is_unsigned_int
+.extern memmove
+.extern replace_extension
+.extern analyze_struct_declarator
+.extern get_type_spec
+.extern isgraph
+.extern analyze_function_definition
+.extern strdup
+.extern arena_new
+.extern analyze_init_declarator
+.extern strncmp
+.extern arena_set_nom_siz
+.extern atom_hash
+.extern analyze_multiplicative_expression
+.extern analyze_additive_expression
+.extern strncpy
+.extern decl_save_pch
+# ==== start of definition of function `is_scalar' ====
+.text
+is_scalar:
+addsp 0;         
+# param:`op', offset:-20
+ldbp -20;
+lddw;
+ldidw 11;
+eqdw;
+jmpt @L81;
+ldbp -20;
+lddw;
+ldidw 97;
+eqdw;
+jmpt @L81;
+ldidw 0;
+jmp @L82;
+@L81:
+ldidw 1;
+@L82:
+jmpt @L79;
+ldbp -20;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L79;
+ldidw 0;
+jmp @L80;
+@L79:
+ldidw 1;
+@L80:
+jmpt @L77;
+ldbp -20;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpt @L77;
+ldidw 0;
+jmp @L78;
+@L77:
+ldidw 1;
+@L78:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern analyze_assignment_expression
+.extern new_extern_id_node
+.extern decl_load_pch
+# ==== start of definition of function `analyze_iteration_statement' ====
+.text
+analyze_iteration_statement:
+.global analyze_iteration_statement
+addsp 4;         
+# param:`s', offset:-24
+# var: ty, offset: 4
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L83;
+ldiqw 0;
+ret;
+@L83:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 90;
+eqdw;
+jmpf @L84;
+ldiqw 0;
+ret;
+@L84:
+ldbp 4;
+lddw;
+ldiqw is_scalar;
+call 4;
+pop;
+notdw;
+jmpf @L85;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L86;
+ldiqw @S16;
+jmp @L87;
+@L86:
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L88;
+ldiqw @S17;
+jmp @L89;
+@L88:
+ldiqw @S18;
+@L89:
+@L87:
+ldiqw @S19;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 28;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 96;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+ldiqw emit_error;
+call 32;
+pop;
+pop;
+@L85:
+ldidw 0;
+ret;
+.extern analyze_translation_unit
+.extern strnlen
+# ==== start of definition of function `empty_label_table' ====
+.text
+empty_label_table:
+.global empty_label_table
+addsp 12;        
+# var: np, offset: 8
+ldiqw label_names_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L90:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L92;
+ldidw 0;
+dw2qw;
+ldiqw label_names;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw atom_hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L91:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L90;
+@L92:
+ldidw 0;
+dw2qw;
+ldiqw label_names_list;
+stqw;
+pop;
+pop;
+ldiqw label_names_arena;
+ldqw;
+ldiqw arena_reset;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern analyze_enumerator
+.extern set_attributes
+.extern is_typedef_name
+.extern arena_reset
+.extern fread
+.extern strrchr
+# ==== start of definition of function `decrease_switch_nesting_level' ====
+.text
+decrease_switch_nesting_level:
+.global decrease_switch_nesting_level
+addsp 12;        
+# var: np, offset: 8
+@L93:
+ldiqw switch_nesting_level;
+lddw;
+ldidw 0;
+sgetdw;
+notdw;
+jmpf @L96;
+ldidw 137;
+ldiqw @S20;
+ldiqw @S21;
+ldiqw @S22;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L96:
+@L94:
+ldidw 0;
+jmpf @L95;
+jmp @L93;
+@L95:
+ldiqw switch_labels_list;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L97:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L99;
+ldidw 0;
+dw2qw;
+ldiqw switch_labels;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 32744;
+mulqw;
+addqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+jmpf @L100;
+ldidw 0;
+dw2qw;
+jmp @L101;
+@L100:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw hash2;
+call 8;
+ldidw 4093;
+dw2qw;
+umodqw;
+@L101:
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L98:
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L97;
+@L99:
+ldidw 0;
+dw2qw;
+ldiqw switch_labels_list;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw switch_arena;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw arena_reset;
+call 8;
+pop;
+pop;
+ldiqw switch_case_counter;
+ldiqw switch_nesting_level;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+subqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern install_macro
+.extern ferror
+.extern random
+# ==== start of definition of function `install_label_name' ====
+.text
+install_label_name:
+addsp 12;        
+# param:`name', offset:-24
+# var: h, offset: 4
+# var: np, offset: 8
+ldbp -24;
+ldqw;
+ldiqw atom_hash;
+call 8;
+pop;
+ldidw 4093;
+umoddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw label_names;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L102:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L104;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+eqqw;
+jmpf @L105;
+jmp @L104;
+@L105:
+@L103:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L102;
+@L104:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L106;
+ldiqw 24;
+pop;
+ldiqw label_names_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw label_names;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw label_names;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw label_names_list;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw label_names_list;
+stqw;
+pop;
+pop;
+ldidw 1;
+dw2qw;
+ret;
+jmp @L107;
+@L106:
+ldidw 0;
+dw2qw;
+ret;
+@L107:
+ldidw 0;
+ret;
+.extern isblank
+.extern free
+.extern malloc
+.extern get_external_declarations
+.extern new_decl_list_node
+.extern srandom
+.extern lookup_struct_descriptor
+.extern new_exec_node
+.extern get_alignment
+.extern fgetc
+.data
+@S0:
+.byte 99
+.byte 111
+.byte 110
+.byte 116
+.byte 114
+.byte 111
+.byte 108
+.byte 108
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 105
+.byte 102
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 110
+.byte 45
+.byte 115
+.byte 99
+.byte 97
+.byte 108
+.byte 97
+.byte 114
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S1:
+.byte 99
+.byte 111
+.byte 110
+.byte 116
+.byte 114
+.byte 111
+.byte 108
+.byte 108
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 110
+.byte 45
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S2:
+.byte 99
+.byte 111
+.byte 110
+.byte 116
+.byte 105
+.byte 110
+.byte 117
+.byte 101
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 105
+.byte 110
+.byte 32
+.byte 97
+.byte 32
+.byte 108
+.byte 111
+.byte 111
+.byte 112
+.byte 0
+@S3:
+.byte 98
+.byte 114
+.byte 101
+.byte 97
+.byte 107
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 110
+.byte 111
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 105
+.byte 110
+.byte 32
+.byte 108
+.byte 111
+.byte 111
+.byte 112
+.byte 32
+.byte 111
+.byte 114
+.byte 32
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 0
+@S4:
+.byte 114
+.byte 101
+.byte 116
+.byte 117
+.byte 114
+.byte 110
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 97
+.byte 110
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 118
+.byte 111
+.byte 105
+.byte 100
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S5:
+.byte 105
+.byte 110
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 97
+.byte 116
+.byte 105
+.byte 98
+.byte 108
+.byte 101
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 115
+.byte 32
+.byte 119
+.byte 104
+.byte 101
+.byte 110
+.byte 32
+.byte 114
+.byte 101
+.byte 116
+.byte 117
+.byte 114
+.byte 110
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 98
+.byte 117
+.byte 116
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 119
+.byte 97
+.byte 115
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 101
+.byte 100
+.byte 0
+@S6:
+.byte 114
+.byte 101
+.byte 116
+.byte 117
+.byte 114
+.byte 110
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 111
+.byte 117
+.byte 116
+.byte 32
+.byte 97
+.byte 110
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 110
+.byte 111
+.byte 110
+.byte 45
+.byte 118
+.byte 111
+.byte 105
+.byte 100
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S7:
+.byte 101
+.byte 114
+.byte 114
+.byte 111
+.byte 114
+.byte 58
+.byte 32
+.byte 116
+.byte 111
+.byte 111
+.byte 32
+.byte 109
+.byte 97
+.byte 110
+.byte 121
+.byte 32
+.byte 110
+.byte 101
+.byte 115
+.byte 116
+.byte 101
+.byte 100
+.byte 32
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 115
+.byte 32
+.byte 40
+.byte 62
+.byte 61
+.byte 32
+.byte 37
+.byte 100
+.byte 41
+.byte 0
+@S8:
+.byte 10
+.byte 0
+@S9:
+.byte 117
+.byte 115
+.byte 101
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 117
+.byte 110
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 101
+.byte 100
+.byte 32
+.byte 108
+.byte 97
+.byte 98
+.byte 101
+.byte 108
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S10:
+.byte 100
+.byte 117
+.byte 112
+.byte 108
+.byte 105
+.byte 99
+.byte 97
+.byte 116
+.byte 101
+.byte 32
+.byte 108
+.byte 97
+.byte 98
+.byte 101
+.byte 108
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 0
+@S11:
+.byte 99
+.byte 97
+.byte 115
+.byte 101
+.byte 32
+.byte 108
+.byte 97
+.byte 98
+.byte 101
+.byte 108
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 105
+.byte 110
+.byte 32
+.byte 97
+.byte 32
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 0
+@S12:
+.byte 99
+.byte 97
+.byte 115
+.byte 101
+.byte 32
+.byte 108
+.byte 97
+.byte 98
+.byte 101
+.byte 108
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 110
+.byte 45
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 103
+.byte 101
+.byte 114
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S13:
+.byte 100
+.byte 117
+.byte 112
+.byte 108
+.byte 105
+.byte 99
+.byte 97
+.byte 116
+.byte 101
+.byte 32
+.byte 99
+.byte 97
+.byte 115
+.byte 101
+.byte 32
+.byte 118
+.byte 97
+.byte 108
+.byte 117
+.byte 101
+.byte 32
+.byte 96
+.byte 37
+.byte 108
+.byte 100
+.byte 39
+.byte 0
+@S14:
+.byte 100
+.byte 101
+.byte 102
+.byte 97
+.byte 117
+.byte 108
+.byte 116
+.byte 32
+.byte 108
+.byte 97
+.byte 98
+.byte 101
+.byte 108
+.byte 32
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 105
+.byte 110
+.byte 32
+.byte 97
+.byte 32
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 0
+@S15:
+.byte 109
+.byte 117
+.byte 108
+.byte 116
+.byte 105
+.byte 112
+.byte 108
+.byte 101
+.byte 32
+.byte 100
+.byte 101
+.byte 102
+.byte 97
+.byte 117
+.byte 108
+.byte 116
+.byte 32
+.byte 108
+.byte 97
+.byte 98
+.byte 101
+.byte 108
+.byte 115
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 111
+.byte 110
+.byte 101
+.byte 32
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 0
+@S16:
+.byte 119
+.byte 104
+.byte 105
+.byte 108
+.byte 101
+.byte 0
+@S17:
+.byte 100
+.byte 111
+.byte 0
+@S18:
+.byte 102
+.byte 111
+.byte 114
+.byte 0
+@S19:
+.byte 99
+.byte 111
+.byte 110
+.byte 116
+.byte 114
+.byte 111
+.byte 108
+.byte 108
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 101
+.byte 115
+.byte 115
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 101
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 104
+.byte 97
+.byte 115
+.byte 32
+.byte 110
+.byte 111
+.byte 110
+.byte 45
+.byte 115
+.byte 99
+.byte 97
+.byte 108
+.byte 97
+.byte 114
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 0
+@S20:
+.byte 100
+.byte 101
+.byte 99
+.byte 114
+.byte 101
+.byte 97
+.byte 115
+.byte 101
+.byte 95
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 95
+.byte 110
+.byte 101
+.byte 115
+.byte 116
+.byte 105
+.byte 110
+.byte 103
+.byte 95
+.byte 108
+.byte 101
+.byte 118
+.byte 101
+.byte 108
+.byte 0
+@S21:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 115
+.byte 116
+.byte 109
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S22:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
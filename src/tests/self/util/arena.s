@@ -0,0 +1,574 @@
+.extern fgets
+# ==== start of definition of function `arena_destroy' ====
+.text
+arena_destroy:
+.global arena_destroy
+addsp 20;        
+# param:`a', offset:-24
+# var: p, offset: 8
+# var: q, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L1:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L2;
+ldbp 8;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+jmp @L1;
+@L2:
+ldbp -24;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern getenv
+.extern atoi
+.extern exit
+.extern stderr
+.extern rewind
+.extern realloc
+.extern snprintf
+.extern fseek
+.extern sscanf
+.extern fputc
+.extern vsscanf
+.extern fwrite
+# ==== start of definition of function `allocate' ====
+.text
+allocate:
+addsp 16;        
+# param:`a', offset:-24
+# param:`n', offset:-28
+# var: ap, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L3:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+addqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ugtqw;
+jmpf @L5;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L6;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L7;
+@L6:
+# var: m, offset: 16
+ldidw 4;
+ldbp -28;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+adddw;
+udw2qw;
+ldiqw 24;
+addqw;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 20;
+addqw;
+lddw;
+jmpf @L8;
+ldbp 16;
+lddw;
+udw2qw;
+ldidw 1;
+dw2qw;
+ldiqw calloc;
+call 16;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L9;
+@L8:
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw malloc;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+@L9:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L10;
+ldidw 0;
+dw2qw;
+ret;
+@L10:
+ldbp 8;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+addqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+@L7:
+@L4:
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L3;
+@L5:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+addqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+subqw;
+ret;
+ldidw 0;
+ret;
+.extern read_stream
+.extern strtoll
+.extern fclose
+.extern calloc
+.extern file_exists
+.extern strtoul
+.extern fprintf
+.extern read_file
+.extern printf
+.extern sprintf
+.extern round_up
+# ==== start of definition of function `arena_alloc' ====
+.text
+arena_alloc:
+.global arena_alloc
+addsp 12;        
+# param:`a', offset:-24
+# param:`n', offset:-28
+# var: p, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ugtqw;
+jmpf @L11;
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw allocate;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L11:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern stdout
+.extern ilog2
+.extern strtol
+.extern stdin
+.extern ftell
+.extern strtoull
+.extern vfprintf
+.extern hash
+.extern bsearch
+.extern qsort
+.extern vsnprintf
+.extern vsprintf
+.extern fopen
+.extern be_atoi
+.extern fileno
+.extern hash2
+.extern replace_extension
+# ==== start of definition of function `arena_new' ====
+.text
+arena_new:
+.global arena_new
+addsp 16;        
+# param:`size', offset:-20
+# param:`zero', offset:-24
+# var: a, offset: 8
+# var: n, offset: 16
+ldiqw 24;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 4;
+ldiqw 24;
+ldbp -20;
+lddw;
+udw2qw;
+addqw;
+pop;
+ldiqw round_up;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -24;
+lddw;
+jmpf @L12;
+ldbp 16;
+lddw;
+udw2qw;
+ldidw 1;
+dw2qw;
+ldiqw calloc;
+call 16;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L13;
+@L12:
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw malloc;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+@L13:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+addqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 10;
+ldidw 1024;
+muldw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 20;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `arena_set_nom_siz' ====
+.text
+arena_set_nom_siz:
+.global arena_set_nom_siz
+addsp 0;         
+# param:`a', offset:-24
+# param:`size', offset:-28
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `arena_reset' ====
+.text
+arena_reset:
+.global arena_reset
+addsp 0;         
+# param:`a', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern fread
+.extern ferror
+.extern random
+.extern free
+.extern malloc
+.extern srandom
+.extern fgetc
@@ -0,0 +1,17 @@
+#ifndef ATOM_H_
+#define ATOM_H_
+
+/*
+ * Atoms are unique copies of strings: interning the same
+ * sequence of characters twice gives back the same pointer,
+ * so two atoms can be compared with `=='. Every atom records
+ * its hash value and an integer tag the user can set (zero
+ * by default).
+ */
+char *atom(char *s);
+char *atom_n(char *s, unsigned n);
+unsigned atom_hash(char *a);
+int atom_tag(char *a);
+void atom_set_tag(char *a, int tag);
+
+#endif
@@ -0,0 +1,615 @@
+.extern fgets
+# ==== start of definition of function `atom_n' ====
+.text
+atom_n:
+.global atom_n
+addsp 20;        
+# param:`s', offset:-24
+# param:`n', offset:-28
+# var: a, offset: 8
+# var: h, offset: 16
+# var: i, offset: 20
+ldiqw atom_table;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L1;
+ldidw 1024;
+ldiqw table_size;
+stdw;
+pop;
+ldiqw 8;
+ldiqw table_size;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldiqw atom_table;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldidw 8192;
+ldiqw arena_new;
+call 8;
+ldiqw atom_arena;
+stqw;
+pop;
+pop;
+@L1:
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldidw 0;
+ldbp 20;
+stdw;
+pop;
+@L2:
+ldbp 20;
+lddw;
+ldbp -28;
+lddw;
+ultdw;
+jmpf @L4;
+ldbp -24;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldxb 1;
+ldidw 31;
+ldbp 16;
+lddw;
+muldw;
+adddw;
+ldbp 16;
+stdw;
+pop;
+@L3:
+incldw 20;
+jmp @L2;
+@L4:
+ldiqw atom_table;
+ldqw;
+ldbp 16;
+lddw;
+ldiqw table_size;
+lddw;
+ldidw 1;
+subdw;
+anddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L5:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L7;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 16;
+lddw;
+eqdw;
+jmpf @L10;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp -28;
+lddw;
+eqdw;
+jmpf @L10;
+ldidw 1;
+jmp @L11;
+@L10:
+ldidw 0;
+@L11:
+jmpf @L8;
+ldbp -28;
+lddw;
+udw2qw;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldiqw 24;
+mulqw;
+addqw;
+ldiqw memcmp;
+call 24;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L8;
+ldidw 1;
+jmp @L9;
+@L8:
+ldidw 0;
+@L9:
+jmpf @L12;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldiqw 24;
+mulqw;
+addqw;
+ret;
+@L12:
+@L6:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L5;
+@L7:
+ldiqw natoms;
+lddw;
+ldiqw table_size;
+lddw;
+ugetdw;
+jmpf @L13;
+ldiqw grow_table;
+call 0;
+pop;
+pop;
+@L13:
+ldiqw 8;
+pop;
+ldiqw 24;
+ldbp -28;
+lddw;
+udw2qw;
+addqw;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldiqw round_up;
+call 8;
+pop;
+ldiqw atom_arena;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldbp -28;
+lddw;
+udw2qw;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldiqw 24;
+mulqw;
+addqw;
+ldiqw memcpy;
+call 24;
+pop;
+pop;
+ldidw 0;
+dw2b;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldiqw 24;
+mulqw;
+addqw;
+ldbp -28;
+lddw;
+udw2qw;
+addqw;
+stb;
+pop;
+ldiqw atom_table;
+ldqw;
+ldbp 16;
+lddw;
+ldiqw table_size;
+lddw;
+ldidw 1;
+subdw;
+anddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw atom_table;
+ldqw;
+ldbp 16;
+lddw;
+ldiqw table_size;
+lddw;
+ldidw 1;
+subdw;
+anddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw natoms;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldiqw 24;
+mulqw;
+addqw;
+ret;
+ldidw 0;
+ret;
+.extern arena_destroy
+.extern getenv
+.extern atoi
+# ==== start of definition of function `atom' ====
+.text
+atom:
+.global atom
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw strlen;
+call 8;
+pop;
+ldbp -24;
+ldqw;
+ldiqw atom_n;
+call 12;
+ret;
+ldidw 0;
+ret;
+.extern exit
+.extern stderr
+.extern rewind
+.extern realloc
+.extern snprintf
+.extern strpbrk
+.bss
+.align 4
+table_size:
+.res 4
+.extern fseek
+# ==== start of definition of function `atom_tag' ====
+.text
+atom_tag:
+.global atom_tag
+addsp 0;         
+# param:`a', offset:-24
+ldbp -24;
+ldqw;
+ldidw 1;
+dw2qw;
+ldiqw 24;
+mulqw;
+subqw;
+ldiqw 16;
+addqw;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern sscanf
+.extern fputc
+.extern vsscanf
+# ==== start of definition of function `atom_set_tag' ====
+.text
+atom_set_tag:
+.global atom_set_tag
+addsp 0;         
+# param:`a', offset:-24
+# param:`tag', offset:-28
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldidw 1;
+dw2qw;
+ldiqw 24;
+mulqw;
+subqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern fwrite
+.extern read_stream
+.extern strspn
+.extern strtoll
+.extern fclose
+.extern strstr
+.extern calloc
+.extern memset
+.extern file_exists
+.extern strtoul
+.extern fprintf
+.extern read_file
+.extern printf
+.extern sprintf
+# ==== start of definition of function `grow_table' ====
+.text
+grow_table:
+addsp 36;        
+# var: i, offset: 4
+# var: new_size, offset: 8
+# var: new_table, offset: 16
+# var: a, offset: 24
+# var: next, offset: 32
+ldiqw table_size;
+lddw;
+ldidw 2;
+muldw;
+ldbp 8;
+stdw;
+pop;
+ldiqw 8;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L14:
+ldbp 4;
+lddw;
+ldiqw table_size;
+lddw;
+ultdw;
+jmpf @L16;
+ldiqw atom_table;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L17:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L19;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+lddw;
+ldidw 1;
+subdw;
+anddw;
+udw2qw;
+ldxqw 8;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldbp 16;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+lddw;
+ldidw 1;
+subdw;
+anddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L18:
+ldbp 32;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L17;
+@L19:
+@L15:
+incldw 4;
+jmp @L14;
+@L16:
+ldiqw atom_table;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw atom_table;
+stqw;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw table_size;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern strcat
+.extern round_up
+.extern strchr
+.extern arena_alloc
+.extern stdout
+.bss
+.align 8
+atom_table:
+.res 8
+.extern ilog2
+.extern strcmp
+.extern strtok
+.extern strtol
+.extern stdin
+.bss
+.align 4
+natoms:
+.res 4
+.extern ftell
+.extern strcpy
+.extern strtoull
+.extern strlen
+.extern memchr
+.extern vfprintf
+.extern hash
+.extern bsearch
+.extern qsort
+.extern memcmp
+.extern vsnprintf
+.extern vsprintf
+.extern memcpy
+.extern fopen
+.extern be_atoi
+.extern strncat
+.extern fileno
+.extern hash2
+.extern memmove
+.extern replace_extension
+.extern strdup
+.extern arena_new
+.extern strncmp
+.extern arena_set_nom_siz
+# ==== start of definition of function `atom_hash' ====
+.text
+atom_hash:
+.global atom_hash
+addsp 0;         
+# param:`a', offset:-24
+ldbp -24;
+ldqw;
+ldidw 1;
+dw2qw;
+ldiqw 24;
+mulqw;
+subqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern strncpy
+.extern strnlen
+.extern arena_reset
+.extern fread
+.extern strrchr
+.bss
+.align 8
+atom_arena:
+.res 8
+.extern ferror
+.extern random
+.extern free
+.extern malloc
+.extern srandom
+.extern fgetc
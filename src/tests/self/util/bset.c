@@ -0,0 +1,231 @@
+#include "bset.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/*
+ * Sets are stored in 64-bit words, so the whole-set operations below
+ * touch half as many words as with 32-bit ones on 64-bit hosts.
+ */
+typedef unsigned long long Word;
+
+#define BPW (sizeof(Word)*8)
+
+struct BSet {
+    unsigned siz;
+    Word *v; /* v[siz] */
+};
+
+/* number of trailing zeros of w (w != 0) */
+static int ctz(Word w)
+{
+#ifdef __GNUC__
+    return __builtin_ctzll(w);
+#else
+    int n;
+
+    n = 0;
+    if ((w&0xFFFFFFFF) == 0)
+        n += 32, w >>= 32;
+    if ((w&0xFFFF) == 0)
+        n += 16, w >>= 16;
+    if ((w&0xFF) == 0)
+        n += 8, w >>= 8;
+    if ((w&0xF) == 0)
+        n += 4, w >>= 4;
+    if ((w&0x3) == 0)
+        n += 2, w >>= 2;
+    if ((w&0x1) == 0)
+        n += 1;
+    return n;
+#endif
+}
+
+BSet *bset_new(int nmemb)
+{
+    BSet *s;
+
+    s = malloc(sizeof(BSet));
+    s->siz = (nmemb+BPW-1)/BPW;
+    s->v = calloc(s->siz, sizeof(Word));
+    return s;
+}
+
+/*
+ * Like bset_new(), but take the storage from arena `a'.
+ * The set goes away when the arena is reset or destroyed.
+ */
+BSet *bset_new_in(Arena *a, int nmemb)
+{
+    BSet *s;
+    unsigned hdr;
+
+    hdr = (sizeof(BSet)+sizeof(Word)-1)/sizeof(Word)*sizeof(Word);
+    s = arena_alloc(a, hdr+(nmemb+BPW-1)/BPW*sizeof(Word));
+    s->siz = (nmemb+BPW-1)/BPW;
+    s->v = (Word *)((char *)s+hdr);
+    memset(s->v, 0, s->siz*sizeof(Word));
+    return s;
+}
+
+void bset_free(BSet *s)
+{
+    free(s->v);
+    free(s);
+}
+
+void bset_cpy(BSet *s1, BSet *s2)
+{
+    assert(s1->siz == s2->siz);
+    memcpy(s1->v, s2->v, s1->siz*sizeof(Word));
+}
+
+void bset_clear(BSet *s)
+{
+    memset(s->v, 0, s->siz*sizeof(Word));
+}
+
+int bset_eq(BSet *s1, BSet *s2)
+{
+    assert(s1->siz == s2->siz);
+    return (memcmp(s1->v, s2->v, s1->siz*sizeof(Word)) == 0);
+}
+
+void bset_union(BSet *s1, BSet *s2)
+{
+    int i;
+
+    assert(s1->siz == s2->siz);
+    for (i = 0; i < s1->siz; i++)
+        s1->v[i] |= s2->v[i];
+}
+
+void bset_inters(BSet *s1, BSet *s2)
+{
+    int i;
+
+    assert(s1->siz == s2->siz);
+    for (i = 0; i < s1->siz; i++)
+        s1->v[i] &= s2->v[i];
+}
+
+void bset_diff(BSet *s1, BSet *s2)
+{
+    int i;
+
+    assert(s1->siz == s2->siz);
+    for (i = 0; i < s1->siz; i++)
+        s1->v[i] &= ~s2->v[i];
+}
+
+int bset_update(BSet *s1, BSet *s2)
+{
+    int i;
+    Word c;
+
+    assert(s1->siz == s2->siz);
+    c = 0;
+    for (i = 0; i < s1->siz; i++) {
+        c |= s1->v[i] ^ s2->v[i];
+        s1->v[i] = s2->v[i];
+    }
+    return (c != 0);
+}
+
+int bset_union_diff(BSet *s1, BSet *s2, BSet *s3, BSet *s4)
+{
+    int i;
+    Word c;
+
+    assert(s1->siz==s2->siz && s1->siz==s3->siz && s1->siz==s4->siz);
+    c = 0;
+    for (i = 0; i < s1->siz; i++) {
+        Word w;
+
+        w = s2->v[i] | (s3->v[i]&~s4->v[i]);
+        c |= w & ~s1->v[i];
+        s1->v[i] |= w;
+    }
+    return (c != 0);
+}
+
+int bset_member(BSet *s, int e)
+{
+    assert(e < s->siz*BPW);
+    return ((s->v[e/BPW] & ((Word)1 << (e%BPW))) != 0);
+}
+
+void bset_insert(BSet *s, int e)
+{
+    assert(e < s->siz*BPW);
+    s->v[e/BPW] |= ((Word)1 << (e%BPW));
+}
+
+void bset_delete(BSet *s, int e)
+{
+    assert(e < s->siz*BPW);
+    s->v[e/BPW] &= ~((Word)1 << (e%BPW));
+}
+
+int bset_card(BSet *s)
+{
+    int i, c;
+    Word n;
+
+    c = 0;
+    for (i = 0; i < s->siz; i++)
+        for (n = s->v[i]; n; c++)
+            n = n & n-1;
+    return c;
+}
+
+int bset_next(BSet *s, int e)
+{
+    unsigned i;
+    Word w;
+
+    if (e < 0)
+        e = 0;
+    if ((i=e/BPW) >= s->siz)
+        return -1;
+    /* drop the members below e in the first word */
+    w = s->v[i] & (~(Word)0 << e%BPW);
+    while (w == 0) {
+        if (++i >= s->siz)
+            return -1;
+        w = s->v[i];
+    }
+    return i*BPW+ctz(w);
+}
+
+int bset_iterate(BSet *s)
+{
+    static int i;
+    static BSet *curr;
+
+    if (s != NULL) {
+        i = 0;
+        curr = s;
+    }
+    if (i == -1)
+        return -1;
+    if ((i=bset_next(curr, i)) == -1)
+        return -1;
+    return i++;
+}
+
+void bset_fill(BSet *s, int n)
+{
+    int i;
+
+    for (i = 0; i<s->siz && n; i++) {
+        if (n >= BPW) {
+            s->v[i] = ~(Word)0;
+            n -= BPW;
+        } else {
+            s->v[i] |= ((Word)1 << n)-1;
+            n = 0;
+        }
+    }
+}
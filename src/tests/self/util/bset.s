@@ -0,0 +1,2818 @@
+.extern fgets
+# ==== start of definition of function `bset_iterate' ====
+.text
+bset_iterate:
+.global bset_iterate
+addsp 0;         
+# param:`s', offset:-24
+.bss
+.align 4
+@bset_iterate_i:
+.res 4
+.text
+.bss
+.align 8
+@bset_iterate_curr:
+.res 8
+.text
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1;
+ldidw 0;
+ldiqw @bset_iterate_i;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw @bset_iterate_curr;
+stqw;
+pop;
+pop;
+@L1:
+ldiqw @bset_iterate_i;
+lddw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L2;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L2:
+ldiqw @bset_iterate_i;
+lddw;
+ldiqw @bset_iterate_curr;
+ldqw;
+ldiqw bset_next;
+call 12;
+pop;
+ldiqw @bset_iterate_i;
+stdw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L3;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L3:
+ldiqw @bset_iterate_i;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern arena_destroy
+.extern getenv
+.extern atoi
+# ==== start of definition of function `bset_member' ====
+.text
+bset_member:
+.global bset_member
+addsp 0;         
+# param:`s', offset:-24
+# param:`e', offset:-28
+@L4:
+ldbp -28;
+lddw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+mulqw;
+ultqw;
+notdw;
+jmpf @L7;
+ldidw 155;
+ldiqw @S0;
+ldiqw @S1;
+ldiqw @S2;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L7:
+@L5:
+ldidw 0;
+jmpf @L6;
+jmp @L4;
+@L6:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -28;
+lddw;
+dw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+udivqw;
+ldxqw 8;
+ldidw 1;
+dw2qw;
+ldbp -28;
+lddw;
+dw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+umodqw;
+pop;
+sllqw;
+andqw;
+ldidw 0;
+dw2qw;
+neqqw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern exit
+.extern stderr
+# ==== start of definition of function `ctz' ====
+.text
+ctz:
+addsp 4;         
+# param:`w', offset:-24
+# var: n, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+ldidw 32;
+dw2qw;
+ugtqw;
+jmpf @L8;
+ldbp -24;
+ldqw;
+ldidw -1;
+udw2qw;
+andqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L8;
+ldidw 1;
+jmp @L9;
+@L8:
+ldidw 0;
+@L9:
+jmpf @L10;
+ldbp 4;
+lddw;
+ldidw 32;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldidw 16;
+srlqw;
+ldidw 16;
+srlqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+@L10:
+ldbp -24;
+ldqw;
+ldidw 65535;
+dw2qw;
+andqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L11;
+ldbp 4;
+lddw;
+ldidw 16;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldidw 16;
+srlqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+@L11:
+ldbp -24;
+ldqw;
+ldidw 255;
+dw2qw;
+andqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L12;
+ldbp 4;
+lddw;
+ldidw 8;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldidw 8;
+srlqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+@L12:
+ldbp -24;
+ldqw;
+ldidw 15;
+dw2qw;
+andqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L13;
+ldbp 4;
+lddw;
+ldidw 4;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldidw 4;
+srlqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+@L13:
+ldbp -24;
+ldqw;
+ldidw 3;
+dw2qw;
+andqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L14;
+ldbp 4;
+lddw;
+ldidw 2;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldidw 2;
+srlqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+@L14:
+ldbp -24;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L15;
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+ldbp 4;
+stdw;
+pop;
+@L15:
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern rewind
+.extern realloc
+.extern snprintf
+.extern strpbrk
+.extern fseek
+.extern sscanf
+.extern fputc
+.extern vsscanf
+.extern fwrite
+.extern strspn
+.extern strtoll
+# ==== start of definition of function `bset_cpy' ====
+.text
+bset_cpy:
+.global bset_cpy
+addsp 0;         
+# param:`s1', offset:-24
+# param:`s2', offset:-32
+@L16:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+eqdw;
+notdw;
+jmpf @L19;
+ldidw 80;
+ldiqw @S3;
+ldiqw @S4;
+ldiqw @S5;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L19:
+@L17:
+ldidw 0;
+jmpf @L18;
+jmp @L16;
+@L18:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw memcpy;
+call 24;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern fclose
+.extern strstr
+.extern calloc
+.extern memset
+.extern strtoul
+.extern fprintf
+.extern printf
+.extern sprintf
+.extern strcat
+# ==== start of definition of function `bset_eq' ====
+.text
+bset_eq:
+.global bset_eq
+addsp 0;         
+# param:`s1', offset:-24
+# param:`s2', offset:-32
+@L20:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+eqdw;
+notdw;
+jmpf @L23;
+ldidw 91;
+ldiqw @S6;
+ldiqw @S7;
+ldiqw @S8;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L23:
+@L21:
+ldidw 0;
+jmpf @L22;
+jmp @L20;
+@L22:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw memcmp;
+call 24;
+pop;
+ldidw 0;
+eqdw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern strchr
+.extern arena_alloc
+.extern stdout
+.extern strcmp
+# ==== start of definition of function `bset_fill' ====
+.text
+bset_fill:
+.global bset_fill
+addsp 4;         
+# param:`s', offset:-24
+# param:`n', offset:-28
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L24:
+ldbp 4;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ultdw;
+jmpf @L27;
+ldbp -28;
+lddw;
+jmpf @L27;
+ldidw 1;
+jmp @L28;
+@L27:
+ldidw 0;
+@L28:
+jmpf @L26;
+ldbp -28;
+lddw;
+dw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+ugetqw;
+jmpf @L29;
+ldidw 0;
+dw2qw;
+cmplqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+subdw;
+pop;
+ldbp -28;
+stdw;
+pop;
+jmp @L30;
+@L29:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 1;
+dw2qw;
+ldbp -28;
+lddw;
+sllqw;
+ldidw 1;
+dw2qw;
+subqw;
+orqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp -28;
+stdw;
+pop;
+@L30:
+@L25:
+incldw 4;
+jmp @L24;
+@L26:
+ldidw 0;
+ret;
+.extern strtok
+.extern strtol
+.extern stdin
+.extern ftell
+.extern strcpy
+.extern strtoull
+.extern strlen
+# ==== start of definition of function `bset_free' ====
+.text
+bset_free:
+.global bset_free
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern memchr
+.extern vfprintf
+.extern bsearch
+.extern qsort
+.extern memcmp
+# ==== start of definition of function `bset_insert' ====
+.text
+bset_insert:
+.global bset_insert
+addsp 0;         
+# param:`s', offset:-24
+# param:`e', offset:-28
+@L31:
+ldbp -28;
+lddw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+mulqw;
+ultqw;
+notdw;
+jmpf @L34;
+ldidw 161;
+ldiqw @S9;
+ldiqw @S10;
+ldiqw @S11;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L34:
+@L32:
+ldidw 0;
+jmpf @L33;
+jmp @L31;
+@L33:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -28;
+lddw;
+dw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+udivqw;
+ldxqw 8;
+ldidw 1;
+dw2qw;
+ldbp -28;
+lddw;
+dw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+umodqw;
+pop;
+sllqw;
+orqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -28;
+lddw;
+dw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+udivqw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern vsnprintf
+.extern vsprintf
+.extern memcpy
+.extern fopen
+# ==== start of definition of function `bset_delete' ====
+.text
+bset_delete:
+.global bset_delete
+addsp 0;         
+# param:`s', offset:-24
+# param:`e', offset:-28
+@L35:
+ldbp -28;
+lddw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+mulqw;
+ultqw;
+notdw;
+jmpf @L38;
+ldidw 167;
+ldiqw @S12;
+ldiqw @S13;
+ldiqw @S14;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L38:
+@L36:
+ldidw 0;
+jmpf @L37;
+jmp @L35;
+@L37:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -28;
+lddw;
+dw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+udivqw;
+ldxqw 8;
+ldidw 1;
+dw2qw;
+ldbp -28;
+lddw;
+dw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+umodqw;
+pop;
+sllqw;
+cmplqw;
+andqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -28;
+lddw;
+dw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+udivqw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern strncat
+.extern fileno
+# ==== start of definition of function `bset_update' ====
+.text
+bset_update:
+.global bset_update
+addsp 12;        
+# param:`s1', offset:-24
+# param:`s2', offset:-32
+# var: i, offset: 4
+# var: c, offset: 8
+@L39:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+eqdw;
+notdw;
+jmpf @L42;
+ldidw 127;
+ldiqw @S15;
+ldiqw @S16;
+ldiqw @S17;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L42:
+@L40:
+ldidw 0;
+jmpf @L41;
+jmp @L39;
+@L41:
+ldidw 0;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L43:
+ldbp 4;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ultdw;
+jmpf @L45;
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+xorqw;
+orqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L44:
+incldw 4;
+jmp @L43;
+@L45:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern memmove
+.extern strdup
+# ==== start of definition of function `bset_new' ====
+.text
+bset_new:
+.global bset_new
+addsp 12;        
+# param:`nmemb', offset:-20
+# var: s, offset: 8
+ldiqw 16;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+addqw;
+ldidw 1;
+dw2qw;
+subqw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+udivqw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw 8;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw calloc;
+call 16;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern arena_new
+.extern strncmp
+.extern arena_set_nom_siz
+# ==== start of definition of function `bset_union_diff' ====
+.text
+bset_union_diff:
+.global bset_union_diff
+addsp 20;        
+# param:`s1', offset:-24
+# param:`s2', offset:-32
+# param:`s3', offset:-40
+# param:`s4', offset:-48
+# var: i, offset: 4
+# var: c, offset: 8
+@L46:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+eqdw;
+jmpf @L51;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+eqdw;
+jmpf @L51;
+ldidw 1;
+jmp @L52;
+@L51:
+ldidw 0;
+@L52:
+jmpf @L49;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -48;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+eqdw;
+jmpf @L49;
+ldidw 1;
+jmp @L50;
+@L49:
+ldidw 0;
+@L50:
+notdw;
+jmpf @L53;
+ldidw 141;
+ldiqw @S18;
+ldiqw @S19;
+ldiqw @S20;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L53:
+@L47:
+ldidw 0;
+jmpf @L48;
+jmp @L46;
+@L48:
+ldidw 0;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L54:
+ldbp 4;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ultdw;
+jmpf @L56;
+# var: w, offset: 16
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp -48;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+cmplqw;
+andqw;
+orqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+cmplqw;
+andqw;
+orqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldqw;
+orqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L55:
+incldw 4;
+jmp @L54;
+@L56:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern strncpy
+# ==== start of definition of function `bset_clear' ====
+.text
+bset_clear:
+.global bset_clear
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `bset_card' ====
+.text
+bset_card:
+.global bset_card
+addsp 20;        
+# param:`s', offset:-24
+# var: i, offset: 4
+# var: c, offset: 8
+# var: n, offset: 16
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L57:
+ldbp 4;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ultdw;
+jmpf @L59;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L60:
+ldbp 16;
+ldqw;
+ordw;
+jmpf @L62;
+ldbp 16;
+ldqw;
+ldbp 16;
+ldqw;
+ldidw 1;
+dw2qw;
+subqw;
+andqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L61:
+incldw 8;
+jmp @L60;
+@L62:
+@L58:
+incldw 4;
+jmp @L57;
+@L59:
+ldbp 8;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `bset_union' ====
+.text
+bset_union:
+.global bset_union
+addsp 4;         
+# param:`s1', offset:-24
+# param:`s2', offset:-32
+# var: i, offset: 4
+@L63:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+eqdw;
+notdw;
+jmpf @L66;
+ldidw 99;
+ldiqw @S21;
+ldiqw @S22;
+ldiqw @S23;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L66:
+@L64:
+ldidw 0;
+jmpf @L65;
+jmp @L63;
+@L65:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L67:
+ldbp 4;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ultdw;
+jmpf @L69;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+orqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L68:
+incldw 4;
+jmp @L67;
+@L69:
+ldidw 0;
+ret;
+.extern strnlen
+# ==== start of definition of function `bset_new_in' ====
+.text
+bset_new_in:
+.global bset_new_in
+addsp 16;        
+# param:`a', offset:-24
+# param:`nmemb', offset:-28
+# var: s, offset: 8
+# var: hdr, offset: 16
+ldiqw 16;
+ldiqw 8;
+addqw;
+ldidw 1;
+dw2qw;
+subqw;
+ldiqw 8;
+udivqw;
+ldiqw 8;
+mulqw;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 16;
+lddw;
+udw2qw;
+ldbp -28;
+lddw;
+dw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+addqw;
+ldidw 1;
+dw2qw;
+subqw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+udivqw;
+ldiqw 8;
+mulqw;
+addqw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+dw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+addqw;
+ldidw 1;
+dw2qw;
+subqw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+udivqw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+addqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern arena_reset
+.extern fread
+.extern strrchr
+# ==== start of definition of function `bset_next' ====
+.text
+bset_next:
+.global bset_next
+addsp 12;        
+# param:`s', offset:-24
+# param:`e', offset:-28
+# var: i, offset: 4
+# var: w, offset: 8
+ldbp -28;
+lddw;
+ldidw 0;
+sltdw;
+jmpf @L70;
+ldidw 0;
+ldbp -28;
+stdw;
+pop;
+@L70:
+ldbp -28;
+lddw;
+dw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+udivqw;
+pop;
+ldbp 4;
+stdw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ugetdw;
+jmpf @L71;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L71:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+cmplqw;
+ldbp -28;
+lddw;
+dw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+umodqw;
+pop;
+sllqw;
+andqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L72:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L73;
+ldbp 4;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ugetdw;
+jmpf @L74;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L74:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L72;
+@L73:
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 8;
+ldidw 8;
+dw2qw;
+mulqw;
+mulqw;
+ldbp 8;
+ldqw;
+ldiqw ctz;
+call 8;
+pop;
+dw2qw;
+addqw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `bset_diff' ====
+.text
+bset_diff:
+.global bset_diff
+addsp 4;         
+# param:`s1', offset:-24
+# param:`s2', offset:-32
+# var: i, offset: 4
+@L75:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+eqdw;
+notdw;
+jmpf @L78;
+ldidw 117;
+ldiqw @S24;
+ldiqw @S25;
+ldiqw @S26;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L78:
+@L76:
+ldidw 0;
+jmpf @L77;
+jmp @L75;
+@L77:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L79:
+ldbp 4;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ultdw;
+jmpf @L81;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+cmplqw;
+andqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L80:
+incldw 4;
+jmp @L79;
+@L81:
+ldidw 0;
+ret;
+# ==== start of definition of function `bset_inters' ====
+.text
+bset_inters:
+.global bset_inters
+addsp 4;         
+# param:`s1', offset:-24
+# param:`s2', offset:-32
+# var: i, offset: 4
+@L82:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+eqdw;
+notdw;
+jmpf @L85;
+ldidw 108;
+ldiqw @S27;
+ldiqw @S28;
+ldiqw @S29;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L85:
+@L83:
+ldidw 0;
+jmpf @L84;
+jmp @L82;
+@L84:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L86:
+ldbp 4;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ultdw;
+jmpf @L88;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+andqw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L87:
+incldw 4;
+jmp @L86;
+@L88:
+ldidw 0;
+ret;
+.extern ferror
+.extern random
+.extern free
+.extern malloc
+.extern srandom
+.extern fgetc
+.data
+@S0:
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 95
+.byte 109
+.byte 101
+.byte 109
+.byte 98
+.byte 101
+.byte 114
+.byte 0
+@S1:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 117
+.byte 116
+.byte 105
+.byte 108
+.byte 47
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S2:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S3:
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 95
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S4:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 117
+.byte 116
+.byte 105
+.byte 108
+.byte 47
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S5:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S6:
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 95
+.byte 101
+.byte 113
+.byte 0
+@S7:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 117
+.byte 116
+.byte 105
+.byte 108
+.byte 47
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S8:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S9:
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 95
+.byte 105
+.byte 110
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 0
+@S10:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 117
+.byte 116
+.byte 105
+.byte 108
+.byte 47
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S11:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S12:
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 95
+.byte 100
+.byte 101
+.byte 108
+.byte 101
+.byte 116
+.byte 101
+.byte 0
+@S13:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 117
+.byte 116
+.byte 105
+.byte 108
+.byte 47
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S14:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S15:
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 95
+.byte 117
+.byte 112
+.byte 100
+.byte 97
+.byte 116
+.byte 101
+.byte 0
+@S16:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 117
+.byte 116
+.byte 105
+.byte 108
+.byte 47
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S17:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S18:
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 95
+.byte 117
+.byte 110
+.byte 105
+.byte 111
+.byte 110
+.byte 95
+.byte 100
+.byte 105
+.byte 102
+.byte 102
+.byte 0
+@S19:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 117
+.byte 116
+.byte 105
+.byte 108
+.byte 47
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S20:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S21:
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 95
+.byte 117
+.byte 110
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S22:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 117
+.byte 116
+.byte 105
+.byte 108
+.byte 47
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S23:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S24:
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 95
+.byte 100
+.byte 105
+.byte 102
+.byte 102
+.byte 0
+@S25:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 117
+.byte 116
+.byte 105
+.byte 108
+.byte 47
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S26:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S27:
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 95
+.byte 105
+.byte 110
+.byte 116
+.byte 101
+.byte 114
+.byte 115
+.byte 0
+@S28:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 117
+.byte 116
+.byte 105
+.byte 108
+.byte 47
+.byte 98
+.byte 115
+.byte 101
+.byte 116
+.byte 46
+.byte 99
+.byte 0
+@S29:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
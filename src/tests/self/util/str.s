@@ -0,0 +1,678 @@
+.extern fgets
+# ==== start of definition of function `string_write' ====
+.text
+string_write:
+.global string_write
+addsp 0;         
+# param:`s', offset:-24
+# param:`fp', offset:-32
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldidw 1;
+dw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw fwrite;
+call 32;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern getenv
+.extern atoi
+.extern exit
+.extern stderr
+# ==== start of definition of function `string_get_pos' ====
+.text
+string_get_pos:
+.global string_get_pos
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern rewind
+.extern realloc
+.extern snprintf
+.extern strpbrk
+.extern fseek
+# ==== start of definition of function `string_set_pos' ====
+.text
+string_set_pos:
+.global string_set_pos
+addsp 0;         
+# param:`s', offset:-24
+# param:`n', offset:-28
+ldbp -28;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern sscanf
+.extern fputc
+.extern vsscanf
+.extern fwrite
+# ==== start of definition of function `string_curr' ====
+.text
+string_curr:
+.global string_curr
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+addqw;
+ret;
+ldidw 0;
+ret;
+.extern strspn
+.extern strtoll
+# ==== start of definition of function `string_free' ====
+.text
+string_free:
+.global string_free
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern fclose
+.extern strstr
+.extern calloc
+.extern memset
+.extern strtoul
+.extern fprintf
+.extern printf
+.extern sprintf
+.extern strcat
+.extern strchr
+.extern stdout
+.extern strcmp
+.extern strtok
+.extern strtol
+.extern stdin
+.extern ftell
+.extern strcpy
+.extern strtoull
+.extern strlen
+# ==== start of definition of function `string_vprintf' ====
+.text
+string_vprintf:
+.global string_vprintf
+addsp 28;        
+# param:`s', offset:-24
+# param:`fmt', offset:-32
+# param:`ap', offset:-40
+# var: ap2, offset: 8
+# var: avail, offset: 16
+# var: n, offset: 20
+ldbp -40;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+subdw;
+ldbp 16;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+addqw;
+ldiqw vsnprintf;
+call 32;
+pop;
+ldbp 20;
+stdw;
+ldbp 16;
+lddw;
+ugetdw;
+jmpf @L1;
+# var: p, offset: 24
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldbp 20;
+lddw;
+adddw;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp 24;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L2;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L2:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldbp 20;
+lddw;
+adddw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp 24;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+addqw;
+ldiqw vsprintf;
+call 24;
+pop;
+pop;
+@L1:
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 20;
+lddw;
+adddw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldbp 20;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern memchr
+.extern vfprintf
+# ==== start of definition of function `string_clear' ====
+.text
+string_clear:
+.global string_clear
+addsp 0;         
+# param:`s', offset:-24
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern bsearch
+.extern qsort
+# ==== start of definition of function `string_new' ====
+.text
+string_new:
+.global string_new
+addsp 12;        
+# param:`siz', offset:-20
+# var: s, offset: 8
+ldiqw 16;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw malloc;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern memcmp
+.extern vsnprintf
+.extern vsprintf
+.extern memcpy
+.extern fopen
+.extern strncat
+.extern fileno
+# ==== start of definition of function `string_printf' ====
+.text
+string_printf:
+.global string_printf
+addsp 28;        
+# param:`s', offset:-24
+# param:`fmt', offset:-32
+# var: args, offset: 8
+# var: avail, offset: 16
+# var: n, offset: 20
+ldbp -32;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+subdw;
+ldbp 16;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldbp -32;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+addqw;
+ldiqw vsnprintf;
+call 32;
+pop;
+ldbp 20;
+stdw;
+ldbp 16;
+lddw;
+ugetdw;
+jmpf @L3;
+# var: p, offset: 24
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldbp 20;
+lddw;
+adddw;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp 24;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L4;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L4:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldbp 20;
+lddw;
+adddw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp 24;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+addqw;
+ldiqw vsprintf;
+call 24;
+pop;
+pop;
+@L3:
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 20;
+lddw;
+adddw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldbp 20;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern memmove
+.extern strdup
+.extern strncmp
+.extern strncpy
+.extern strnlen
+.extern fread
+.extern strrchr
+# ==== start of definition of function `string_append' ====
+.text
+string_append:
+.global string_append
+addsp 0;         
+# param:`s', offset:-24
+# param:`t', offset:-32
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+adddw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ugetdw;
+jmpf @L5;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldidw 2;
+muldw;
+ldbp -32;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+adddw;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+@L5:
+ldbp -32;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+addqw;
+ldiqw memcpy;
+call 24;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldbp -32;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+adddw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldidw 0;
+dw2b;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+addqw;
+stb;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `string_buf' ====
+.text
+string_buf:
+.global string_buf
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern ferror
+.extern random
+.extern free
+.extern malloc
+.extern srandom
+.extern fgetc
@@ -0,0 +1,602 @@
+.extern fgets
+.extern stat
+.extern getenv
+.extern atoi
+.extern exit
+.extern stderr
+.extern rewind
+.extern realloc
+.extern snprintf
+.extern strpbrk
+.extern fseek
+.extern sscanf
+.extern fputc
+.extern vsscanf
+.extern fwrite
+# ==== start of definition of function `read_stream' ====
+.text
+read_stream:
+.global read_stream
+addsp 20;        
+# param:`fp', offset:-24
+# var: buf, offset: 8
+# var: len, offset: 16
+# var: max, offset: 20
+ldidw 8192;
+ldbp 20;
+stdw;
+pop;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L1:
+ldbp 16;
+lddw;
+udw2qw;
+ldbp -24;
+ldqw;
+ldbp 20;
+lddw;
+ldbp 16;
+lddw;
+subdw;
+ldidw 1;
+subdw;
+udw2qw;
+ldidw 1;
+dw2qw;
+ldbp 8;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+addqw;
+ldiqw fread;
+call 32;
+addqw;
+pop;
+ldbp 16;
+stdw;
+ldbp 20;
+lddw;
+ldidw 1;
+subdw;
+eqdw;
+jmpf @L2;
+ldbp 20;
+lddw;
+ldidw 2;
+muldw;
+ldbp 20;
+stdw;
+pop;
+ldbp 20;
+lddw;
+udw2qw;
+ldbp 8;
+ldqw;
+ldiqw realloc;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L1;
+@L2:
+ldidw 0;
+dw2b;
+ldbp 8;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+addqw;
+stb;
+pop;
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern strspn
+.extern strtoll
+.extern fclose
+.extern strstr
+.extern calloc
+.extern memset
+# ==== start of definition of function `file_exists' ====
+.text
+file_exists:
+.global file_exists
+addsp 144;       
+# param:`file_path', offset:-24
+# var: st, offset: 4
+ldbp 4;
+ldbp -24;
+ldqw;
+ldiqw stat;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern strtoul
+.extern fprintf
+# ==== start of definition of function `read_file' ====
+.text
+read_file:
+.global read_file
+addsp 24;        
+# param:`path', offset:-24
+# var: fp, offset: 8
+# var: buf, offset: 16
+# var: len, offset: 24
+ldiqw @S0;
+ldbp -24;
+ldqw;
+ldiqw fopen;
+call 16;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L3;
+ldidw 0;
+dw2qw;
+ret;
+@L3:
+ldidw 2;
+ldidw 0;
+dw2qw;
+ldbp 8;
+ldqw;
+ldiqw fseek;
+call 20;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw ftell;
+call 8;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw rewind;
+call 8;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldidw 1;
+adddw;
+udw2qw;
+ldiqw malloc;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldidw 1;
+dw2qw;
+ldbp 16;
+ldqw;
+ldiqw fread;
+call 32;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldidw 0;
+dw2b;
+ldbp 16;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+addqw;
+stb;
+pop;
+ldbp 8;
+ldqw;
+ldiqw fclose;
+call 8;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern printf
+.extern sprintf
+.extern strcat
+# ==== start of definition of function `round_up' ====
+.text
+round_up:
+.global round_up
+addsp 4;         
+# param:`num', offset:-20
+# param:`mul', offset:-24
+# var: rem, offset: 4
+ldbp -24;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L4;
+ldbp -20;
+lddw;
+ldbp -24;
+lddw;
+smoddw;
+ldbp 4;
+stdw;
+ldidw 0;
+eqdw;
+jmpt @L4;
+ldidw 0;
+jmp @L5;
+@L4:
+ldidw 1;
+@L5:
+jmpf @L6;
+ldbp -20;
+lddw;
+dw2qw;
+ret;
+@L6:
+ldbp -20;
+lddw;
+ldidw 0;
+sltdw;
+jmpf @L7;
+ldbp -20;
+lddw;
+ldbp -24;
+lddw;
+subdw;
+ldbp 4;
+lddw;
+subdw;
+jmp @L8;
+@L7:
+ldbp -20;
+lddw;
+ldbp -24;
+lddw;
+adddw;
+ldbp 4;
+lddw;
+subdw;
+@L8:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern strchr
+.extern stdout
+# ==== start of definition of function `ilog2' ====
+.text
+ilog2:
+.global ilog2
+addsp 4;         
+# param:`val', offset:-20
+# var: x, offset: 4
+ldidw 1;
+negdw;
+ldbp 4;
+stdw;
+pop;
+@L9:
+ldbp -20;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L10;
+ldbp -20;
+lddw;
+ldidw 1;
+srldw;
+ldbp -20;
+stdw;
+pop;
+incldw 4;
+jmp @L9;
+@L10:
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern strcmp
+.extern strtok
+.extern strtol
+.extern stdin
+.extern ftell
+.extern strcpy
+.extern strtoull
+.extern strlen
+.extern isatty
+.extern memchr
+.extern vfprintf
+# ==== start of definition of function `hash' ====
+.text
+hash:
+.global hash
+addsp 4;         
+# param:`s', offset:-24
+# var: hash_val, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L11:
+ldbp -24;
+ldqw;
+ldb;
+ldidw 0;
+neqdw;
+jmpf @L13;
+ldbp -24;
+ldqw;
+ldb;
+ldidw 31;
+ldbp 4;
+lddw;
+muldw;
+adddw;
+ldbp 4;
+stdw;
+pop;
+@L12:
+ldbp -24;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+pop;
+pop;
+jmp @L11;
+@L13:
+ldbp 4;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern bsearch
+.extern qsort
+.extern memcmp
+.extern vsnprintf
+.extern vsprintf
+.extern memcpy
+.extern fopen
+# ==== start of definition of function `be_atoi' ====
+.text
+be_atoi:
+.global be_atoi
+addsp 12;        
+# param:`s', offset:-24
+# var: us, offset: 8
+ldbp -24;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxub 1;
+ldidw 24;
+slldw;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxub 1;
+ldidw 16;
+slldw;
+ordw;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+ldxub 1;
+ldidw 8;
+slldw;
+ordw;
+ldbp 8;
+ldqw;
+ldidw 3;
+dw2qw;
+ldxub 1;
+ordw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern strncat
+.extern fileno
+# ==== start of definition of function `hash2' ====
+.text
+hash2:
+.global hash2
+addsp 0;         
+# param:`k', offset:-24
+ldbp -24;
+ldqw;
+ldbp -24;
+ldqw;
+ldidw 3;
+dw2qw;
+addqw;
+mulqw;
+ret;
+ldidw 0;
+ret;
+.extern memmove
+# ==== start of definition of function `replace_extension' ====
+.text
+replace_extension:
+.global replace_extension
+addsp 16;        
+# param:`fname', offset:-24
+# param:`newext', offset:-32
+# var: p, offset: 8
+ldidw 46;
+ldbp -24;
+ldqw;
+ldiqw strrchr;
+call 12;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L14;
+ldbp -24;
+ldqw;
+ldiqw strlen;
+call 8;
+ldbp -32;
+ldqw;
+ldiqw strlen;
+call 8;
+addqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw strcpy;
+call 16;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+jmp @L15;
+@L14:
+# var: n, offset: 16
+ldbp 8;
+ldqw;
+ldbp -24;
+ldqw;
+subqw;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 16;
+lddw;
+dw2qw;
+ldbp -32;
+ldqw;
+ldiqw strlen;
+call 8;
+addqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 16;
+lddw;
+dw2qw;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw strncpy;
+call 24;
+pop;
+pop;
+ldidw 0;
+dw2b;
+ldbp 8;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+ldbp -32;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw strcat;
+call 16;
+pop;
+pop;
+@L15:
+ldbp 8;
+ldqw;
+ret;
+ldidw 0;
+ret;
+.extern strdup
+.extern strncmp
+.extern strncpy
+.extern strnlen
+.extern fread
+.extern strrchr
+.extern ferror
+.extern random
+.extern free
+.extern malloc
+.extern srandom
+.extern fgetc
+.data
+@S0:
+.byte 114
+.byte 98
+.byte 0
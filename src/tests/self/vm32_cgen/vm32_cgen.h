@@ -0,0 +1,8 @@
+#ifndef VM32_CGEN_H_
+#define VM32_CGEN_H_
+
+#include <stdio.h>
+
+void vm32_cgen(FILE *outf);
+
+#endif
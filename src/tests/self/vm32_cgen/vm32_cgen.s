@@ -0,0 +1,16045 @@
+.extern fgets
+# ==== start of definition of function `void_expression' ====
+.text
+void_expression:
+addsp 12;        
+# param:`e', offset:-24
+# var: cat, offset: 4
+# var: op, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 93;
+eqdw;
+jmpt @L2;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 94;
+eqdw;
+jmpt @L2;
+ldidw 0;
+jmp @L3;
+@L2:
+ldidw 1;
+@L3:
+jmpf @L4;
+ldiqw @S0;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L5;
+@L4:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 95;
+eqdw;
+jmpt @L6;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 96;
+eqdw;
+jmpt @L6;
+ldidw 0;
+jmp @L7;
+@L6:
+ldidw 1;
+@L7:
+jmpf @L8;
+ldiqw @S1;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L8:
+@L5:
+@L1:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L13;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L13;
+ldidw 1;
+jmp @L14;
+@L13:
+ldidw 0;
+@L14:
+jmpf @L11;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+neqdw;
+jmpf @L11;
+ldidw 1;
+jmp @L12;
+@L11:
+ldidw 0;
+@L12:
+jmpf @L9;
+ldbp 4;
+lddw;
+ldidw 60;
+eqdw;
+jmpt @L21;
+ldbp 4;
+lddw;
+ldidw 72;
+eqdw;
+jmpt @L21;
+ldidw 0;
+jmp @L22;
+@L21:
+ldidw 1;
+@L22:
+jmpt @L19;
+ldbp 4;
+lddw;
+ldidw 61;
+eqdw;
+jmpt @L19;
+ldidw 0;
+jmp @L20;
+@L19:
+ldidw 1;
+@L20:
+jmpt @L17;
+ldbp 4;
+lddw;
+ldidw 109;
+eqdw;
+jmpt @L17;
+ldidw 0;
+jmp @L18;
+@L17:
+ldidw 1;
+@L18:
+jmpt @L15;
+ldbp 4;
+lddw;
+ldidw 55;
+eqdw;
+jmpt @L15;
+ldidw 0;
+jmp @L16;
+@L15:
+ldidw 1;
+@L16:
+jmpf @L9;
+ldidw 1;
+jmp @L10;
+@L9:
+ldidw 0;
+@L10:
+jmpf @L23;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw location_get_offset;
+call 8;
+pop;
+ldbp 8;
+ldqw;
+ldiqw @S2;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S3;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L23:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S4;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S5;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L24;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L24;
+ldidw 1;
+jmp @L25;
+@L24:
+ldidw 0;
+@L25:
+jmpf @L26;
+ldiqw @S6;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S7;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L26:
+ldidw 0;
+ret;
+.extern get_promoted_type
+.extern analyze_bitwise_operator
+# ==== start of definition of function `vm32_cgen' ====
+.text
+vm32_cgen:
+.global vm32_cgen
+addsp 20;        
+# param:`outf', offset:-24
+# var: ed, offset: 8
+ldiqw location_init;
+call 0;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw output_file;
+stqw;
+pop;
+pop;
+ldidw 4096;
+ldiqw string_new;
+call 4;
+ldiqw output_buffer;
+stqw;
+pop;
+pop;
+ldidw 60;
+ldiqw get_type_node;
+call 4;
+ldiqw int_ty;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw int_ty;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw get_external_declarations;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L27:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L29;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L30;
+# var: scs, offset: 16
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L31;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L31;
+ldidw 0;
+jmp @L32;
+@L31:
+ldidw 1;
+@L32:
+jmpf @L33;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S8;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S9;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L33:
+jmp @L34;
+@L30:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L35;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L35;
+ldidw 1;
+jmp @L36;
+@L35:
+ldidw 0;
+@L36:
+jmpf @L37;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw function_definition;
+call 16;
+pop;
+pop;
+jmp @L38;
+@L37:
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw static_object_definition;
+call 20;
+pop;
+pop;
+@L38:
+@L34:
+ldiqw output_file;
+ldqw;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+@L28:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L27;
+@L29:
+ldiqw temp_struct_size;
+lddw;
+ldidw 0;
+ugtdw;
+jmpf @L39;
+ldiqw @S10;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S11;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S12;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S13;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S14;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S15;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw temp_struct_size;
+lddw;
+ldiqw @S16;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S17;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw output_file;
+ldqw;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+@L39:
+ldiqw emit_string_literals;
+call 0;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `statement' ====
+.text
+statement:
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T40;
+jmptab;
+@L42:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw compound_statement;
+call 12;
+pop;
+pop;
+jmp @L41;
+@L43:
+ldbp -24;
+ldqw;
+ldiqw if_statement;
+call 8;
+pop;
+pop;
+jmp @L41;
+@L44:
+ldbp -24;
+ldqw;
+ldiqw switch_statement;
+call 8;
+pop;
+pop;
+jmp @L41;
+@L45:
+ldbp -24;
+ldqw;
+ldiqw while_statement;
+call 8;
+pop;
+pop;
+jmp @L41;
+@L46:
+ldbp -24;
+ldqw;
+ldiqw do_statement;
+call 8;
+pop;
+pop;
+jmp @L41;
+@L47:
+ldbp -24;
+ldqw;
+ldiqw for_statement;
+call 8;
+pop;
+pop;
+jmp @L41;
+@L48:
+ldbp -24;
+ldqw;
+ldiqw goto_statement;
+call 8;
+pop;
+pop;
+jmp @L41;
+@L49:
+ldiqw continue_statement;
+call 0;
+pop;
+pop;
+jmp @L41;
+@L50:
+ldiqw break_statement;
+call 0;
+pop;
+pop;
+jmp @L41;
+@L51:
+ldbp -24;
+ldqw;
+ldiqw return_statement;
+call 8;
+pop;
+pop;
+jmp @L41;
+@L52:
+ldbp -24;
+ldqw;
+ldiqw case_statement;
+call 8;
+pop;
+pop;
+jmp @L41;
+@L53:
+ldbp -24;
+ldqw;
+ldiqw default_statement;
+call 8;
+pop;
+pop;
+jmp @L41;
+@L54:
+ldbp -24;
+ldqw;
+ldiqw expression_statement;
+call 8;
+pop;
+pop;
+jmp @L41;
+@L55:
+ldbp -24;
+ldqw;
+ldiqw label_statement;
+call 8;
+pop;
+pop;
+jmp @L41;
+@L56:
+ldbp -24;
+ldqw;
+ldiqw asm_statement;
+call 8;
+pop;
+pop;
+jmp @L41;
+@L41:
+.data
+.align 8
+@T40:
+.dword 0
+.dword 15
+.qword @L41
+.qword @L43
+.qword @L45
+.qword @L46
+.qword @L47
+.qword @L50
+.qword @L49
+.qword @L51
+.qword @L54
+.qword @L42
+.qword @L44
+.qword @L52
+.qword @L53
+.qword @L55
+.qword @L48
+.qword @L56
+.text
+ldidw 0;
+ret;
+.extern verbose_asm
+.bss
+.align 8
+ret_ty:
+.res 16
+.extern is_complete
+.bss
+.align 4
+str_lit_count:
+.res 4
+.extern cfg_outpath
+.data
+.align 4
+size_of_local_area:
+.align 4
+.dword 0
+.extern analyze_unary_expression
+.extern string_write
+.extern target_arch
+.extern emit_warning
+.extern is_struct_union_enum
+.extern get_sizeof
+.extern emit_error
+.extern get_curr_scope_id
+.extern getenv
+.extern can_assign_to
+.extern atoi
+.extern exit
+# ==== start of definition of function `function_definition' ====
+.text
+function_definition:
+addsp 68;        
+# param:`decl_specs', offset:-24
+# param:`header', offset:-32
+# var: p, offset: 8
+# var: scs, offset: 16
+# var: param_offs, offset: 24
+# var: num, offset: 28
+# var: cp, offset: 40
+# var: addsp_param, offset: 48
+# var: pos_tmp, offset: 52
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw curr_func_name;
+stqw;
+pop;
+pop;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S18;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S19;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S20;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S21;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S22;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S23;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L57;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L57;
+ldidw 0;
+jmp @L58;
+@L57:
+ldidw 1;
+@L58:
+jmpf @L59;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S24;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S25;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L59:
+ldiqw @S26;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldbp 48;
+stdw;
+pop;
+ldiqw @S27;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S28;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw location_push_scope;
+call 0;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L60;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L60;
+ldidw 1;
+jmp @L61;
+@L60:
+ldidw 0;
+@L61:
+jmpf @L62;
+ldidw 0;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L62:
+ldidw 8;
+negdw;
+ldbp 24;
+stdw;
+pop;
+@L63:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L64;
+# var: pty, offset: 56
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L65;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpf @L65;
+ldidw 1;
+jmp @L66;
+@L65:
+ldidw 0;
+@L66:
+jmpf @L67;
+jmp @L64;
+@L67:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldidw 4;
+ldbp 56;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw round_up;
+call 8;
+pop;
+subdw;
+ldbp 24;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw location_new;
+call 12;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S29;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S30;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L63;
+@L64:
+ldbp -24;
+ldqw;
+ldiqw ret_ty;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw ret_ty;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw compound_statement;
+call 12;
+pop;
+pop;
+ldiqw location_pop_scope;
+call 0;
+pop;
+pop;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldbp 52;
+stdw;
+pop;
+ldbp 48;
+lddw;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldidw 4;
+ldiqw size_of_local_area;
+lddw;
+ldidw 4;
+subdw;
+ldiqw round_up;
+call 8;
+pop;
+ldiqw @S31;
+ldbp 28;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_curr;
+call 8;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldidw 10;
+dw2qw;
+ldbp 28;
+ldbp 40;
+ldqw;
+ldiqw strncpy;
+call 24;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldbp 28;
+ldiqw strlen;
+call 8;
+addqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldidw 59;
+dw2b;
+ldbp 40;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+stb;
+pop;
+@L68:
+ldbp 40;
+ldqw;
+ldb;
+ldidw 10;
+neqdw;
+jmpf @L69;
+ldidw 32;
+dw2b;
+ldbp 40;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+stb;
+pop;
+jmp @L68;
+@L69:
+ldbp 52;
+lddw;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldidw 4;
+ldiqw local_offset;
+stdw;
+pop;
+ldiqw @S32;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S33;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S34;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S35;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern stderr
+.extern opt_level
+.extern restore_scope
+.extern string_get_pos
+.extern tolower
+.extern rewind
+.extern get_type_node
+.extern analyze_logical_operator
+.extern realloc
+.extern lookup_ordinary_id
+# ==== start of definition of function `switch_statement' ====
+.text
+switch_statement:
+addsp 8260;      
+# param:`s', offset:-24
+# var: ST, offset: 4
+# var: EXIT, offset: 8
+# var: DEF, offset: 12
+# var: i, offset: 16
+# var: st_size, offset: 20
+# var: ce64, offset: 24
+# var: ncase, offset: 28
+# var: sw_pos, offset: 32
+# var: pos_tmp, offset: 36
+# var: min, offset: 40
+# var: max, offset: 48
+# var: v, offset: 56
+# var: search_table, offset: 64
+# var: np, offset: 8256
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+ldbp 24;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S36;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S37;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldbp 24;
+lddw;
+jmpf @L70;
+ldiqw @S38;
+jmp @L71;
+@L70:
+ldiqw @S39;
+@L71:
+ldiqw @S40;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S41;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw switch_nesting_level;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw push_break_target;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldiqw pop_break_target;
+call 0;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S42;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S43;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 20;
+stdw;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L72:
+ldbp 16;
+lddw;
+ldidw 1009;
+sltdw;
+jmpf @L74;
+ldiqw switch_labels;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8072;
+mulqw;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L75;
+ldiqw switch_labels;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8072;
+mulqw;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8256;
+stqw;
+pop;
+pop;
+@L76:
+ldbp 8256;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L78;
+ldbp 8256;
+ldqw;
+ldbp 64;
+ldbp 20;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L77:
+ldbp 8256;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8256;
+stqw;
+pop;
+pop;
+jmp @L76;
+@L78:
+ldidw 0;
+dw2qw;
+ldiqw switch_labels;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8072;
+mulqw;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L75:
+@L73:
+incldw 16;
+jmp @L72;
+@L74:
+ldiqw switch_nesting_level;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldbp 20;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L79;
+ldiqw cmp_switch_label;
+ldiqw 8;
+ldbp 20;
+lddw;
+dw2qw;
+ldbp 64;
+ldiqw qsort;
+call 32;
+pop;
+pop;
+@L79:
+ldiqw @S44;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S45;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S46;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S47;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S48;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S49;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L80;
+ldiqw @S50;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S51;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 24;
+lddw;
+jmpf @L81;
+ldiqw @S52;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S53;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L81:
+ldbp 8;
+lddw;
+ldiqw @S54;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S55;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S56;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S57;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L80:
+ldbp 64;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 16;
+addqw;
+lddw;
+jmpf @L82;
+ldbp 20;
+lddw;
+ldidw 1;
+subdw;
+jmp @L83;
+@L82:
+ldbp 20;
+lddw;
+@L83:
+ldbp 28;
+stdw;
+pop;
+ldbp 28;
+lddw;
+ldidw 3;
+sgetdw;
+jmpf @L84;
+ldbp 64;
+ldbp 20;
+lddw;
+ldbp 28;
+lddw;
+subdw;
+dw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 64;
+ldbp 20;
+lddw;
+ldidw 1;
+subdw;
+dw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 48;
+stqw;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldbp 40;
+ldqw;
+subqw;
+ldbp 28;
+lddw;
+ldidw 10;
+adddw;
+dw2qw;
+ultqw;
+jmpf @L85;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldbp 36;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldidw 6;
+dw2qw;
+ldiqw @S58;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_curr;
+call 8;
+ldiqw memcpy;
+call 24;
+pop;
+pop;
+ldbp 36;
+lddw;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldbp 40;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldiqw @S59;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S60;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 24;
+lddw;
+jmpf @L86;
+ldbp 40;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldiqw @S61;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S62;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L86:
+ldbp 48;
+ldqw;
+ldbp 40;
+ldqw;
+subqw;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldiqw @S63;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S64;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 24;
+lddw;
+jmpf @L87;
+ldiqw @S65;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S66;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L87:
+ldbp 64;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 16;
+addqw;
+lddw;
+jmpf @L88;
+ldbp 64;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 0;
+addqw;
+lddw;
+jmp @L89;
+@L88:
+ldbp 8;
+lddw;
+@L89:
+ldbp 12;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S67;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S68;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldbp 28;
+lddw;
+subdw;
+ldbp 16;
+stdw;
+pop;
+ldbp 40;
+ldqw;
+ldbp 56;
+stqw;
+pop;
+pop;
+@L90:
+ldbp 64;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 56;
+ldqw;
+eqqw;
+jmpf @L93;
+ldbp 64;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @S69;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S70;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldbp 20;
+lddw;
+eqdw;
+jmpf @L94;
+jmp @L92;
+@L94:
+jmp @L95;
+@L93:
+ldbp 12;
+lddw;
+ldiqw @S71;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S72;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L95:
+@L91:
+ldbp 56;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+pop;
+pop;
+jmp @L90;
+@L92:
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L96:
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+sltdw;
+jmpf @L98;
+ldbp 64;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw free;
+call 8;
+pop;
+pop;
+@L97:
+incldw 16;
+jmp @L96;
+@L98:
+ldiqw @S73;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S74;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L85:
+@L84:
+ldbp 64;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 16;
+addqw;
+lddw;
+notdw;
+jmpf @L99;
+ldbp 20;
+lddw;
+ldidw 1;
+adddw;
+ldiqw @S75;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S76;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+jmp @L100;
+@L99:
+ldbp 20;
+lddw;
+ldiqw @S77;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S78;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldbp 16;
+stdw;
+pop;
+@L100:
+ldbp 24;
+lddw;
+jmpf @L101;
+ldiqw @S79;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S80;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L101:
+@L102:
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+sltdw;
+jmpf @L103;
+ldbp 64;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldiqw @S81;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S82;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 24;
+lddw;
+jmpf @L104;
+ldbp 64;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldiqw @S83;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S84;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L104:
+incldw 16;
+jmp @L102;
+@L103:
+ldbp 64;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 16;
+addqw;
+lddw;
+notdw;
+jmpf @L105;
+ldbp 8;
+lddw;
+ldiqw @S85;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S86;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L105:
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L106:
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+sltdw;
+jmpf @L108;
+ldbp 64;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @S87;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S88;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 64;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw free;
+call 8;
+pop;
+pop;
+@L107:
+incldw 16;
+jmp @L106;
+@L108:
+ldiqw @S89;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S90;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern snprintf
+# ==== start of definition of function `for_statement' ====
+.text
+for_statement:
+addsp 12;        
+# param:`s', offset:-24
+# var: L1, offset: 4
+# var: L2, offset: 8
+# var: L3, offset: 12
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L109;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw void_expression;
+call 8;
+pop;
+pop;
+@L109:
+ldiqw new_label;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L110;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+@L110:
+ldiqw new_label;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S91;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S92;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L111;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S93;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S94;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L111:
+ldbp 12;
+lddw;
+ldiqw push_break_target;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L112;
+ldbp 8;
+lddw;
+jmp @L113;
+@L112:
+ldbp 4;
+lddw;
+@L113:
+ldiqw push_continue_target;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 3;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldiqw pop_break_target;
+call 0;
+pop;
+pop;
+ldiqw pop_continue_target;
+call 0;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L114;
+ldbp 8;
+lddw;
+ldiqw @S95;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S96;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw void_expression;
+call 8;
+pop;
+pop;
+@L114:
+ldbp 4;
+lddw;
+ldiqw @S97;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S98;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S99;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S100;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.data
+.align 4
+switch_nesting_level:
+.align 4
+.dword -1
+# ==== start of definition of function `store' ====
+.text
+store:
+addsp 0;         
+# param:`dest_ty', offset:-24
+ldbp -24;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T115;
+switch;
+@L117:
+@L118:
+@L119:
+ldiqw @S101;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S102;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L116;
+@L120:
+@L121:
+ldiqw @S103;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S104;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L116;
+@L122:
+@L123:
+@L124:
+@L125:
+@L126:
+@L127:
+@L128:
+@L129:
+ldiqw @S105;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S106;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L116;
+@L130:
+@L131:
+ldiqw @S107;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S108;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L116;
+@L132:
+@L133:
+ldiqw @S109;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S110;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S111;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S112;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L116;
+@L116:
+.data
+.align 8
+@T115:
+.dword 18
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 68
+.dword 71
+.dword 72
+.dword 97
+.dword 98
+.dword 106
+.dword 107
+.dword 108
+.dword 109
+.dword 110
+.dword 111
+.qword @L116
+.qword @L122
+.qword @L117
+.qword @L126
+.qword @L125
+.qword @L123
+.qword @L120
+.qword @L132
+.qword @L133
+.qword @L127
+.qword @L128
+.qword @L129
+.qword @L118
+.qword @L119
+.qword @L121
+.qword @L124
+.qword @L130
+.qword @L131
+.text
+ldidw 0;
+ret;
+.extern strpbrk
+.extern pop_struct_descriptor
+# ==== start of definition of function `indexed_load' ====
+.text
+indexed_load:
+addsp 0;         
+# param:`ty', offset:-24
+ldbp -24;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T134;
+switch;
+@L136:
+@L137:
+ldiqw @S113;
+ret;
+@L138:
+ldiqw @S114;
+ret;
+@L139:
+@L140:
+@L141:
+@L142:
+@L143:
+@L144:
+ldiqw @S115;
+ret;
+@L145:
+@L146:
+ldiqw @S116;
+ret;
+@L147:
+ldidw 0;
+dw2qw;
+ret;
+@L135:
+.data
+.align 8
+@T134:
+.dword 12
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 72
+.dword 106
+.dword 107
+.dword 109
+.dword 110
+.dword 111
+.qword @L147
+.qword @L139
+.qword @L136
+.qword @L144
+.qword @L140
+.qword @L142
+.qword @L141
+.qword @L137
+.qword @L138
+.qword @L143
+.qword @L145
+.qword @L146
+.text
+ldidw 0;
+ret;
+# ==== start of definition of function `do_static_init' ====
+.text
+do_static_init:
+addsp 68;        
+# param:`ds', offset:-24
+# param:`dct', offset:-32
+# param:`e', offset:-40
+# var: ts, offset: 8
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L148;
+# var: nelem, offset: 16
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L149;
+jmp @@do_static_init_scalar;
+@L149:
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L150;
+# var: n, offset: 20
+# var: c, offset: 24
+ldidw 0;
+ldbp 20;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L151:
+ldbp 24;
+ldqw;
+ldub;
+ldiqw @S117;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S118;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 20;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+@L152:
+ldbp 20;
+lddw;
+ldbp 16;
+lddw;
+ultdw;
+jmpf @L154;
+ldbp 24;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldub;
+ldidw 0;
+neqdw;
+jmpf @L154;
+ldidw 1;
+jmp @L155;
+@L154:
+ldidw 0;
+@L155:
+jmpf @L153;
+jmp @L151;
+@L153:
+ldbp 20;
+lddw;
+ldbp 16;
+lddw;
+ultdw;
+jmpf @L156;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+subdw;
+ldiqw @S119;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S120;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L156:
+jmp @L157;
+@L150:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L158:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L161;
+ldbp 16;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L161;
+ldidw 1;
+jmp @L162;
+@L161:
+ldidw 0;
+@L162:
+jmpf @L160;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw do_static_init;
+call 24;
+pop;
+pop;
+@L159:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 16;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+jmp @L158;
+@L160:
+ldbp 16;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L163;
+# var: elem_ty, offset: 24
+ldbp -24;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw @S121;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S122;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+muldw;
+ldiqw @S123;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S124;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L163:
+@L157:
+jmp @L164;
+@L148:
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 68;
+eqdw;
+jmpf @L165;
+# var: d, offset: 16
+# var: full_init, offset: 24
+# var: ty, offset: 32
+# var: align, offset: 48
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 32;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 32;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 48;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L166;
+ldbp 48;
+lddw;
+ldiqw @S125;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S126;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L166:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L167:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L169;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L170:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L173;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L173;
+ldidw 1;
+jmp @L174;
+@L173:
+ldidw 0;
+@L174:
+jmpf @L172;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw do_static_init;
+call 24;
+pop;
+pop;
+@L171:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L170;
+@L172:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L175;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L176;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L176;
+ldidw 1;
+jmp @L177;
+@L176:
+ldidw 0;
+@L177:
+jmpf @L178;
+ldidw 1;
+ldbp 24;
+stdw;
+pop;
+@L178:
+jmp @L169;
+@L175:
+@L168:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L167;
+@L169:
+ldbp 24;
+lddw;
+notdw;
+jmpf @L179;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L180;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L180:
+@L181:
+ldidw 1;
+jmpf @L182;
+@L183:
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L184;
+# var: ty, offset: 56
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 56;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw @S127;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S128;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 56;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S129;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S130;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L183;
+@L184:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L185;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L186;
+@L185:
+jmp @L182;
+@L186:
+jmp @L181;
+@L182:
+@L179:
+jmp @L187;
+@L165:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+jmpf @L188;
+# var: ty, offset: 16
+# var: align, offset: 32
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 32;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L189;
+ldbp 32;
+lddw;
+ldiqw @S131;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S132;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L189:
+ldbp -40;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw do_static_init;
+call 24;
+pop;
+pop;
+jmp @L190;
+@L188:
+# var: dest_ty, offset: 16
+@@do_static_init_scalar:
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L191;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+eqdw;
+jmpf @L191;
+ldidw 1;
+jmp @L192;
+@L191:
+ldidw 0;
+@L192:
+jmpf @L193;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L193:
+ldbp -24;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T194;
+switch;
+@L196:
+@L197:
+@L198:
+ldiqw @S133;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L195;
+@L199:
+@L200:
+ldiqw @S134;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S135;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S136;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L195;
+@L201:
+@L202:
+@L203:
+@L204:
+@L205:
+@L206:
+ldiqw @S137;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S138;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S139;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L195;
+@L207:
+@L208:
+ldiqw @S140;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S141;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S142;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -40;
+ldqw;
+ldiqw do_static_expr;
+call 8;
+ldiqw @S143;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S144;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L195:
+.data
+.align 8
+@T194:
+.dword 14
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.dword 109
+.dword 110
+.dword 111
+.qword @L195
+.qword @L201
+.qword @L196
+.qword @L206
+.qword @L204
+.qword @L202
+.qword @L199
+.qword @L205
+.qword @L197
+.qword @L198
+.qword @L200
+.qword @L203
+.qword @L207
+.qword @L208
+.text
+ldbp -40;
+ldqw;
+ldiqw do_static_expr;
+call 8;
+pop;
+ldiqw @S145;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S146;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L190:
+@L187:
+@L164:
+ldidw 0;
+ret;
+.extern fseek
+# ==== start of definition of function `controlling_expression' ====
+.text
+controlling_expression:
+addsp 4;         
+# param:`e', offset:-24
+# var: cat, offset: 4
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L209;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L209;
+ldidw 1;
+jmp @L210;
+@L209:
+ldidw 0;
+@L210:
+jmpf @L211;
+ldiqw @S147;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S148;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L211:
+ldidw 0;
+ret;
+.extern islower
+.extern string_set_pos
+.extern push_struct_descriptor
+# ==== start of definition of function `new_label' ====
+.text
+new_label:
+addsp 0;         
+.data
+.align 4
+@new_label_label_count:
+.align 4
+.dword 1
+.text
+ldiqw @new_label_label_count;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern sscanf
+.extern fputc
+# ==== start of definition of function `function_argument' ====
+.text
+function_argument:
+addsp 32;        
+# param:`arg', offset:-24
+# param:`param', offset:-32
+# var: ty_cat, offset: 4
+# var: ty, offset: 8
+# var: arg_area_size, offset: 24
+# var: real_arg_size, offset: 28
+# var: aligned_arg_size, offset: 32
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L212;
+ldidw 0;
+dw2qw;
+ret;
+@L212:
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L213;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+neqdw;
+jmpt @L213;
+ldidw 0;
+jmp @L214;
+@L213:
+ldidw 1;
+@L214:
+jmpf @L215;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldiqw function_argument;
+call 16;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L216;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+eqdw;
+jmpf @L216;
+ldidw 1;
+jmp @L217;
+@L216:
+ldidw 0;
+@L217:
+jmpf @L218;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L219;
+@L218:
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L219:
+ldbp 8;
+ldbp -24;
+ldqw;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 28;
+stdw;
+pop;
+jmp @L220;
+@L215:
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldiqw function_argument;
+call 16;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 8;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L221;
+ldbp 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpt @L223;
+ldbp 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L223;
+ldidw 0;
+jmp @L224;
+@L223:
+ldidw 1;
+@L224:
+jmpf @L221;
+ldidw 1;
+jmp @L222;
+@L221:
+ldidw 0;
+@L222:
+jmpf @L225;
+ldidw 4;
+ldbp 28;
+stdw;
+pop;
+jmp @L226;
+@L225:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 28;
+stdw;
+pop;
+@L226:
+@L220:
+ldidw 4;
+ldbp 28;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldbp 32;
+lddw;
+adddw;
+ldbp 24;
+stdw;
+pop;
+ldbp 8;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L227;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L227;
+ldidw 0;
+jmp @L228;
+@L227:
+ldidw 1;
+@L228:
+jmpf @L229;
+ldbp 28;
+lddw;
+ldiqw @S149;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S150;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L229:
+ldbp 24;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `if_statement' ====
+.text
+if_statement:
+addsp 8;         
+# param:`s', offset:-24
+# var: L1, offset: 4
+# var: L2, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S151;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S152;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L230;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S153;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S154;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S155;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S156;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+@L230:
+ldbp 8;
+lddw;
+ldiqw @S157;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S158;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern vsscanf
+.extern fwrite
+.extern is_pointer
+.extern colored_diagnostics
+.extern string_curr
+.extern read_stream
+# ==== start of definition of function `static_object_definition' ====
+.text
+static_object_definition:
+addsp 40;        
+# param:`decl_specs', offset:-24
+# param:`declarator', offset:-32
+# param:`mangle_name', offset:-36
+# var: scs, offset: 8
+# var: ty, offset: 16
+# var: initializer, offset: 32
+# var: alignment, offset: 40
+ldbp -24;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L231;
+ldiqw @S159;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S160;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L232;
+@L231:
+ldiqw @S161;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S162;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L232:
+ldbp 16;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 40;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L233;
+ldbp 40;
+lddw;
+ldiqw @S163;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S164;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L233:
+ldbp -36;
+lddw;
+jmpf @L234;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S165;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S166;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L235;
+@L234:
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S167;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S168;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L235:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L236;
+ldbp 32;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw do_static_init;
+call 24;
+pop;
+pop;
+jmp @L237;
+@L236:
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S169;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S170;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L237:
+ldbp -24;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L238;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L238;
+ldidw 0;
+jmp @L239;
+@L238:
+ldidw 1;
+@L239:
+jmpf @L240;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S171;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S172;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L240:
+ldidw 0;
+ret;
+.extern strspn
+.extern location_pop_scope
+# ==== start of definition of function `pop_continue_target' ====
+.text
+pop_continue_target:
+addsp 0;         
+ldiqw ct_stack_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `continue_statement' ====
+.text
+continue_statement:
+addsp 0;         
+ldiqw ctarget_stack;
+ldiqw ct_stack_top;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw @S173;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S174;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern ispunct
+.extern reset_enum_val
+.extern strtoll
+.extern analyze_relational_equality_expression
+# ==== start of definition of function `pop_break_target' ====
+.text
+pop_break_target:
+addsp 0;         
+ldiqw bt_stack_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+.extern get_sto_class_spec
+# ==== start of definition of function `compound_statement' ====
+.text
+compound_statement:
+addsp 60;        
+# param:`s', offset:-24
+# param:`push_scope', offset:-28
+# var: sl, offset: 8
+# var: old_local_offset, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L241;
+# var: dl, offset: 24
+ldiqw local_offset;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+jmpf @L242;
+ldiqw location_push_scope;
+call 0;
+pop;
+pop;
+@L242:
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L243:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L245;
+# var: dct, offset: 32
+# var: scs, offset: 40
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 40;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L246;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+eqdw;
+jmpf @L247;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L248:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L250;
+ldidw 1;
+ldbp 32;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw static_object_definition;
+call 20;
+pop;
+pop;
+@L249:
+ldbp 32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L248;
+@L250:
+ldiqw @S175;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S176;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L244;
+jmp @L251;
+@L247:
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 56;
+eqdw;
+jmpt @L252;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 70;
+eqdw;
+jmpt @L252;
+ldidw 0;
+jmp @L253;
+@L252:
+ldidw 1;
+@L253:
+jmpf @L254;
+jmp @L244;
+@L254:
+@L251:
+@L246:
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L255:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L257;
+# var: lty, offset: 48
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 48;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 98;
+eqdw;
+jmpf @L258;
+jmp @L256;
+@L258:
+ldbp 48;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw local_offset;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldiqw local_offset;
+stdw;
+pop;
+ldiqw local_offset;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw location_new;
+call 12;
+pop;
+pop;
+ldiqw local_offset;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S177;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S178;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L259;
+ldiqw local_offset;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw do_auto_init;
+call 28;
+pop;
+pop;
+@L259:
+ldiqw local_offset;
+lddw;
+ldbp 48;
+ldiqw get_sizeof;
+call 8;
+pop;
+adddw;
+ldiqw local_offset;
+stdw;
+pop;
+@L256:
+ldbp 32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L255;
+@L257:
+@L244:
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L243;
+@L245:
+@L241:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L260:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L262;
+ldbp 8;
+ldqw;
+ldiqw statement;
+call 8;
+pop;
+pop;
+@L261:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L260;
+@L262:
+ldiqw local_offset;
+lddw;
+ldiqw size_of_local_area;
+lddw;
+sgtdw;
+jmpf @L263;
+ldiqw local_offset;
+lddw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+@L263:
+ldbp -28;
+lddw;
+jmpf @L264;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L264;
+ldidw 1;
+jmp @L265;
+@L264:
+ldidw 0;
+@L265:
+jmpf @L266;
+ldbp 16;
+lddw;
+ldiqw local_offset;
+stdw;
+pop;
+ldiqw location_pop_scope;
+call 0;
+pop;
+pop;
+@L266:
+ldidw 0;
+ret;
+.extern string_free
+.extern fclose
+.extern preprocess
+.extern analyze_decl_specs
+.extern strstr
+.extern calloc
+.extern pop_scope
+.extern memset
+.extern file_exists
+.extern include_libc
+.extern analyze_cast_expression
+.extern location_push_scope
+.bss
+.align 4
+ctarget_stack:
+.res 512
+.extern stringify_type_exp
+.extern add_quote_dir
+.extern stat_number_of_ast_nodes
+.extern strtoul
+.extern isprint
+# ==== start of definition of function `expr_convert' ====
+.text
+expr_convert:
+addsp 8;         
+# param:`e', offset:-24
+# param:`dest', offset:-32
+# var: cat_dest, offset: 4
+# var: cat_src, offset: 8
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @T267;
+switch;
+@L269:
+@L270:
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L271;
+ldbp 8;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L271;
+ldidw 1;
+jmp @L272;
+@L271:
+ldidw 0;
+@L272:
+jmpf @L273;
+ldiqw @S179;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S180;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S181;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S182;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L274;
+@L273:
+ldbp 8;
+lddw;
+ldidw 49;
+neqdw;
+jmpf @L275;
+ldbp 8;
+lddw;
+ldidw 106;
+neqdw;
+jmpf @L275;
+ldidw 1;
+jmp @L276;
+@L275:
+ldidw 0;
+@L276:
+jmpf @L277;
+ldiqw @S183;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S184;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L277:
+@L274:
+jmp @L268;
+@L278:
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L279;
+ldbp 8;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L279;
+ldidw 1;
+jmp @L280;
+@L279:
+ldidw 0;
+@L280:
+jmpf @L281;
+ldiqw @S185;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S186;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S187;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S188;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L282;
+@L281:
+ldbp 8;
+lddw;
+ldidw 107;
+neqdw;
+jmpf @L283;
+ldiqw @S189;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S190;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L283:
+@L282:
+jmp @L268;
+@L284:
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L285;
+ldbp 8;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L285;
+ldidw 1;
+jmp @L286;
+@L285:
+ldidw 0;
+@L286:
+jmpf @L287;
+ldiqw @S191;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S192;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S193;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S194;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L288;
+@L287:
+ldbp 8;
+lddw;
+ldiqw @T289;
+switch;
+@L291:
+@L292:
+@L293:
+@L294:
+jmp @L290;
+@L295:
+ldiqw @S195;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S196;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L290;
+@L290:
+.data
+.align 8
+@T289:
+.dword 5
+.dword 49
+.dword 64
+.dword 106
+.dword 107
+.qword @L295
+.qword @L291
+.qword @L294
+.qword @L292
+.qword @L293
+.text
+@L288:
+jmp @L268;
+@L296:
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L297;
+ldbp 8;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L297;
+ldidw 1;
+jmp @L298;
+@L297:
+ldidw 0;
+@L298:
+jmpf @L299;
+ldiqw @S197;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S198;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S199;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S200;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L300;
+@L299:
+ldbp 8;
+lddw;
+ldidw 107;
+neqdw;
+jmpf @L301;
+ldbp 8;
+lddw;
+ldidw 108;
+neqdw;
+jmpf @L301;
+ldidw 1;
+jmp @L302;
+@L301:
+ldidw 0;
+@L302:
+jmpf @L303;
+ldiqw @S201;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S202;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L303:
+@L300:
+jmp @L268;
+@L304:
+@L305:
+@L306:
+@L307:
+@L308:
+@L309:
+@L310:
+@L311:
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L312;
+ldbp 8;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L312;
+ldidw 1;
+jmp @L313;
+@L312:
+ldidw 0;
+@L313:
+jmpf @L314;
+ldiqw @S203;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S204;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L314:
+jmp @L268;
+@L315:
+@L316:
+ldbp 8;
+lddw;
+ldidw 110;
+neqdw;
+jmpf @L317;
+ldbp 8;
+lddw;
+ldidw 111;
+neqdw;
+jmpf @L317;
+ldidw 1;
+jmp @L318;
+@L317:
+ldidw 0;
+@L318:
+jmpf @L319;
+ldbp 8;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L320;
+ldiqw @S205;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S206;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L321;
+@L320:
+ldiqw @S207;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S208;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L321:
+@L319:
+jmp @L268;
+@L322:
+jmp @L268;
+@L268:
+.data
+.align 8
+@T267:
+.dword 16
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 72
+.dword 97
+.dword 98
+.dword 106
+.dword 107
+.dword 108
+.dword 109
+.dword 110
+.dword 111
+.qword @L322
+.qword @L307
+.qword @L269
+.qword @L306
+.qword @L304
+.qword @L308
+.qword @L284
+.qword @L305
+.qword @L310
+.qword @L311
+.qword @L270
+.qword @L278
+.qword @L296
+.qword @L309
+.qword @L315
+.qword @L316
+.text
+ldidw 0;
+ret;
+.extern fprintf
+.extern get_type_qual
+.extern read_file
+.extern is_signed_int
+.extern printf
+.extern get_c_token
+.extern lookup_tag
+.extern get_rank
+.extern is_external_id
+.data
+.align 4
+bt_stack_top:
+.align 4
+.dword -1
+.extern isalnum
+.extern sprintf
+# ==== start of definition of function `expression' ====
+.text
+expression:
+addsp 108;       
+# param:`e', offset:-24
+# param:`is_addr', offset:-28
+# var: cat, offset: 4
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T323;
+jmptab;
+@L325:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T326;
+switch;
+@L328:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw void_expression;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+jmp @L327;
+@L329:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw store;
+call 8;
+pop;
+pop;
+jmp @L327;
+@L330:
+@L331:
+@L332:
+@L333:
+@L334:
+@L335:
+@L336:
+@L337:
+@L338:
+@L339:
+# var: new_e, offset: 8
+ldbp -24;
+ldqw;
+ldbp 8;
+swap2;
+memcpy 104;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T340;
+jmptab;
+@L342:
+ldidw 102;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L341;
+@L343:
+ldidw 16;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L341;
+@L344:
+ldidw 17;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L341;
+@L345:
+ldidw 12;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L341;
+@L346:
+ldidw 13;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L341;
+@L347:
+ldidw 18;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L341;
+@L348:
+ldidw 19;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L341;
+@L349:
+ldidw 104;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L341;
+@L350:
+ldidw 26;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L341;
+@L351:
+ldidw 27;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L341;
+@L341:
+.data
+.align 8
+@T340:
+.dword 36
+.dword 10
+.qword @L341
+.qword @L342
+.qword @L343
+.qword @L344
+.qword @L345
+.qword @L346
+.qword @L347
+.qword @L348
+.qword @L349
+.qword @L350
+.qword @L351
+.text
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 3;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw store;
+call 8;
+pop;
+pop;
+jmp @L327;
+@L352:
+# var: L1, offset: 8
+# var: L2, offset: 12
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S209;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S210;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S211;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S212;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S213;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S214;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S215;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S216;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L327;
+@L353:
+# var: L1, offset: 8
+# var: L2, offset: 12
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S217;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S218;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S219;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S220;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S221;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S222;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S223;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S224;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S225;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S226;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S227;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S228;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S229;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S230;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L327;
+@L354:
+# var: L1, offset: 8
+# var: L2, offset: 12
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S231;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S232;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S233;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S234;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S235;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S236;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S237;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S238;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S239;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S240;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S241;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S242;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S243;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S244;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L327;
+@L355:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L356;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldiqw @S245;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S246;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L357;
+@L356:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S247;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S248;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L357:
+jmp @L327;
+@L358:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L359;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldiqw @S249;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S250;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L360;
+@L359:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S251;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S252;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L360:
+jmp @L327;
+@L361:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L362;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldiqw @S253;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S254;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L363;
+@L362:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S255;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S256;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L363:
+jmp @L327;
+@L364:
+@L365:
+# var: op, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 24;
+eqdw;
+jmpf @L366;
+ldiqw @S257;
+jmp @L367;
+@L366:
+ldiqw @S258;
+@L367:
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L368;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L368;
+ldidw 1;
+jmp @L369;
+@L368:
+ldidw 0;
+@L369:
+jmpf @L370;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw @S259;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S260;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L371;
+@L370:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L372;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L372;
+ldidw 1;
+jmp @L373;
+@L372:
+ldidw 0;
+@L373:
+jmpf @L374;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw @S261;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S262;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L375;
+@L374:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw @S263;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S264;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L327;
+@L375:
+@L371:
+jmp @L327;
+@L376:
+@L377:
+@L378:
+@L379:
+# var: sign, offset: 8
+# var: size, offset: 16
+# var: cat1, offset: 24
+# var: cat2, offset: 28
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 28;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L380;
+ldbp 24;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L380;
+ldidw 1;
+jmp @L381;
+@L380:
+ldidw 0;
+@L381:
+jmpf @L382;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldiqw @S265;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L383;
+@L382:
+ldbp 28;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L384;
+ldbp 28;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L384;
+ldidw 1;
+jmp @L385;
+@L384:
+ldidw 0;
+@L385:
+jmpf @L386;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S266;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L387;
+@L386:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S267;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L387:
+@L383:
+ldbp 24;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L388;
+ldbp 28;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L388;
+ldidw 1;
+jmp @L389;
+@L388:
+ldidw 0;
+@L389:
+jmpf @L390;
+ldbp 24;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpt @L391;
+ldbp 28;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpt @L391;
+ldidw 0;
+jmp @L392;
+@L391:
+ldidw 1;
+@L392:
+jmpf @L393;
+ldiqw @S268;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L394;
+@L393:
+ldiqw @S269;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L394:
+jmp @L395;
+@L390:
+ldiqw @S270;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L395:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T396;
+jmptab;
+@L398:
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S271;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S272;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L397;
+@L399:
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S273;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S274;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L397;
+@L400:
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S275;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S276;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L397;
+@L401:
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S277;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S278;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L397;
+@L397:
+.data
+.align 8
+@T396:
+.dword 20
+.dword 4
+.qword @L397
+.qword @L398
+.qword @L399
+.qword @L400
+.qword @L401
+.text
+jmp @L327;
+@L402:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw int_ty;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L403;
+ldiqw @S279;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S280;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L404;
+@L403:
+ldiqw @S281;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S282;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L404:
+jmp @L327;
+@L405:
+# var: skind, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L406;
+ldiqw @S283;
+jmp @L407;
+@L406:
+ldiqw @S284;
+@L407:
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw int_ty;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L408;
+ldbp 8;
+ldqw;
+ldiqw @S285;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S286;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L409;
+@L408:
+ldbp 8;
+ldqw;
+ldiqw @S287;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S288;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L409:
+jmp @L327;
+@L410:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L411;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L412;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldiqw @S289;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S290;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L413;
+@L412:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S291;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S292;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L413:
+jmp @L414;
+@L411:
+# var: i, offset: 8
+# var: j, offset: 12
+# var: size, offset: 16
+# var: ty, offset: 24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L415;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldidw 1;
+ldbp 12;
+stdw;
+pop;
+jmp @L416;
+@L415:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+@L416:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 16;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L417;
+ldbp 16;
+lddw;
+ldiqw @S293;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S294;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S295;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S296;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L417:
+ldiqw @S297;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S298;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L414:
+jmp @L327;
+@L418:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L419;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L420;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldiqw @S299;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S300;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L421;
+@L420:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S301;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S302;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L421:
+jmp @L422;
+@L419:
+# var: size, offset: 8
+# var: ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L423;
+ldbp 8;
+lddw;
+ldidw 1;
+ugtdw;
+jmpf @L424;
+ldbp 8;
+lddw;
+ldiqw @S303;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S304;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S305;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S306;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L424:
+ldiqw @S307;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S308;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L425;
+@L423:
+ldiqw @S309;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S310;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldidw 1;
+ugtdw;
+jmpf @L426;
+ldbp 8;
+lddw;
+ldiqw @S311;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S312;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S313;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S314;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L426:
+@L425:
+@L422:
+jmp @L327;
+@L427:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L428;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldiqw @S315;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S316;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L429;
+@L428:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S317;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S318;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L429:
+jmp @L327;
+@L430:
+@L431:
+# var: sign, offset: 8
+# var: op, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L432;
+ldiqw @S319;
+jmp @L433;
+@L432:
+ldiqw @S320;
+@L433:
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 16;
+eqdw;
+jmpf @L434;
+ldiqw @S321;
+jmp @L435;
+@L434:
+ldiqw @S322;
+@L435:
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L436;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S323;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S324;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L437;
+@L436:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S325;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S326;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L437:
+jmp @L327;
+@L438:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+jmp @L327;
+@L439:
+@L440:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L441;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L441;
+ldidw 1;
+jmp @L442;
+@L441:
+ldidw 0;
+@L442:
+jmpf @L443;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S327;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S328;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 93;
+eqdw;
+jmpf @L444;
+ldiqw @S329;
+jmp @L445;
+@L444:
+ldiqw @S330;
+@L445:
+ldiqw @S331;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S332;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw store;
+call 8;
+pop;
+pop;
+jmp @L446;
+@L443:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S333;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S334;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S335;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S336;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L447;
+ldiqw @S337;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S338;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L448;
+@L447:
+# var: pointed_to_ty, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S339;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S340;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L448:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 93;
+eqdw;
+jmpf @L449;
+ldiqw @S341;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S342;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+jmp @L450;
+@L449:
+ldiqw @S343;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S344;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+@L450:
+pop;
+ldiqw @S345;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S346;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw store;
+call 8;
+pop;
+pop;
+ldiqw @S347;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S348;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+@L446:
+jmp @L327;
+@L451:
+@L452:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L453;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L453;
+ldidw 1;
+jmp @L454;
+@L453:
+ldidw 0;
+@L454:
+jmpf @L455;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S349;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S350;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 94;
+eqdw;
+jmpf @L456;
+ldiqw @S351;
+jmp @L457;
+@L456:
+ldiqw @S352;
+@L457:
+ldiqw @S353;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S354;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw store;
+call 8;
+pop;
+pop;
+ldiqw @S355;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S356;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L458;
+@L455:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S357;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S358;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+ldiqw @S359;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S360;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S361;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S362;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L459;
+ldiqw @S363;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S364;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L460;
+@L459:
+# var: pointed_to_ty, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S365;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S366;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L460:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 94;
+eqdw;
+jmpf @L461;
+ldiqw @S367;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S368;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+jmp @L462;
+@L461:
+ldiqw @S369;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S370;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+@L462:
+pop;
+ldiqw @S371;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S372;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw store;
+call 8;
+pop;
+pop;
+ldiqw @S373;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S374;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L458:
+jmp @L327;
+@L463:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+jmp @L327;
+@L464:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -28;
+lddw;
+notdw;
+jmpf @L465;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+@L465:
+jmp @L327;
+@L466:
+@L467:
+@L468:
+# var: size, offset: 8
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L469;
+ldiqw @S375;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L470;
+@L469:
+ldiqw @S376;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L470:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T471;
+switch;
+@L473:
+jmp @L472;
+@L474:
+ldbp 8;
+ldqw;
+ldiqw @S377;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S378;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L472;
+@L475:
+ldbp 8;
+ldqw;
+ldiqw @S379;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S380;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L472;
+@L472:
+.data
+.align 8
+@T471:
+.dword 4
+.dword 14
+.dword 99
+.dword 100
+.qword @L472
+.qword @L475
+.qword @L473
+.qword @L474
+.text
+jmp @L327;
+@L476:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L477;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L477;
+ldidw 1;
+jmp @L478;
+@L477:
+ldidw 0;
+@L478:
+jmpf @L479;
+ldiqw @S381;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S382;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L480;
+@L479:
+ldiqw @S383;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S384;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L480:
+jmp @L327;
+@L481:
+# var: ldx, offset: 8
+# var: size, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpf @L482;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+jmp @L483;
+@L482:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+@L483:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+notdw;
+jmpf @L484;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw indexed_load;
+call 8;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L484;
+ldidw 1;
+jmp @L485;
+@L484:
+ldidw 0;
+@L485:
+jmpf @L486;
+ldbp 16;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw @S385;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S386;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L487;
+@L486:
+ldbp 16;
+lddw;
+ldidw 1;
+ugtdw;
+jmpf @L488;
+ldbp 16;
+lddw;
+ldiqw @S387;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S388;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S389;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S390;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L488:
+ldiqw @S391;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S392;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -28;
+lddw;
+notdw;
+jmpf @L489;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+@L489:
+@L487:
+jmp @L327;
+@L490:
+# var: arg_siz, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw function_argument;
+call 16;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S393;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S394;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L491;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L491;
+ldidw 1;
+jmp @L492;
+@L491:
+ldidw 0;
+@L492:
+jmpf @L493;
+ldiqw @S395;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S396;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S397;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S398;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S399;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S400;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L493:
+jmp @L327;
+@L494:
+@L495:
+# var: is_union, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 6;
+eqdw;
+jmpf @L496;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 71;
+eqdw;
+ldbp 8;
+stdw;
+pop;
+jmp @L497;
+@L496:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+ldbp 8;
+stdw;
+pop;
+@L497:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp 8;
+lddw;
+notdw;
+jmpf @L498;
+# var: m, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw get_member_descriptor;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw @S401;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S402;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S403;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S404;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L498:
+ldbp -28;
+lddw;
+notdw;
+jmpf @L499;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+@L499:
+jmp @L327;
+@L327:
+.data
+.align 8
+@T326:
+.dword 47
+.dword 6
+.dword 7
+.dword 12
+.dword 13
+.dword 14
+.dword 15
+.dword 16
+.dword 17
+.dword 18
+.dword 19
+.dword 20
+.dword 21
+.dword 22
+.dword 23
+.dword 24
+.dword 25
+.dword 26
+.dword 27
+.dword 28
+.dword 29
+.dword 30
+.dword 34
+.dword 35
+.dword 36
+.dword 37
+.dword 38
+.dword 39
+.dword 40
+.dword 41
+.dword 42
+.dword 43
+.dword 44
+.dword 45
+.dword 93
+.dword 94
+.dword 95
+.dword 96
+.dword 97
+.dword 98
+.dword 99
+.dword 100
+.dword 101
+.dword 102
+.dword 103
+.dword 104
+.dword 105
+.qword @L327
+.qword @L494
+.qword @L495
+.qword @L410
+.qword @L418
+.qword @L468
+.qword @L476
+.qword @L430
+.qword @L431
+.qword @L402
+.qword @L405
+.qword @L376
+.qword @L377
+.qword @L378
+.qword @L379
+.qword @L364
+.qword @L365
+.qword @L358
+.qword @L355
+.qword @L354
+.qword @L353
+.qword @L352
+.qword @L328
+.qword @L329
+.qword @L330
+.qword @L331
+.qword @L332
+.qword @L333
+.qword @L334
+.qword @L335
+.qword @L336
+.qword @L337
+.qword @L338
+.qword @L339
+.qword @L439
+.qword @L451
+.qword @L440
+.qword @L452
+.qword @L481
+.qword @L490
+.qword @L466
+.qword @L467
+.qword @L464
+.qword @L427
+.qword @L463
+.qword @L361
+.qword @L438
+.text
+jmp @L324;
+@L500:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L501;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S405;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S406;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L502;
+@L501:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+ldiqw @S407;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S408;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L502:
+jmp @L324;
+@L503:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw new_string_literal;
+call 8;
+pop;
+ldiqw @S409;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S410;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L324;
+@L504:
+ldbp -24;
+ldqw;
+ldiqw load_addr;
+call 8;
+pop;
+pop;
+ldbp -28;
+lddw;
+notdw;
+jmpf @L505;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+@L505:
+jmp @L324;
+@L324:
+.data
+.align 8
+@T323:
+.dword 0
+.dword 4
+.qword @L324
+.qword @L325
+.qword @L500
+.qword @L503
+.qword @L504
+.text
+ldidw 0;
+ret;
+.extern isxdigit
+.extern strcat
+.extern are_compatible
+.extern error_count
+# ==== start of definition of function `do_auto_init' ====
+.text
+do_auto_init:
+addsp 36;        
+# param:`ds', offset:-24
+# param:`dct', offset:-32
+# param:`e', offset:-40
+# param:`offset', offset:-44
+# var: ts, offset: 8
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L506;
+# var: nelem, offset: 16
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L507;
+jmp @@do_auto_init_scalar;
+@L507:
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L508;
+# var: n, offset: 20
+ldbp -44;
+lddw;
+ldiqw @S411;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S412;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp -40;
+ldqw;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+eqdw;
+jmpf @L509;
+ldbp 20;
+lddw;
+ldiqw @S413;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S414;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L510;
+@L509:
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+ultdw;
+jmpf @L511;
+ldbp 16;
+lddw;
+ldiqw @S415;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S416;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L512;
+@L511:
+ldbp 20;
+lddw;
+ldiqw @S417;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S418;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldiqw @S419;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S420;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S421;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S422;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S423;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S424;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+subdw;
+ldiqw @S425;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S426;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L512:
+@L510:
+ldiqw @S427;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S428;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L513;
+@L508:
+# var: elem_size, offset: 20
+# var: elem_ty, offset: 24
+ldbp -24;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L514:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L517;
+ldbp 16;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L517;
+ldidw 1;
+jmp @L518;
+@L517:
+ldidw 0;
+@L518:
+jmpf @L516;
+ldbp -44;
+lddw;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw do_auto_init;
+call 28;
+pop;
+pop;
+ldbp -44;
+lddw;
+ldbp 20;
+lddw;
+adddw;
+ldbp -44;
+stdw;
+pop;
+@L515:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 16;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+jmp @L514;
+@L516:
+ldbp 16;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L519;
+ldbp -44;
+lddw;
+ldiqw @S429;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S430;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S431;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S432;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+muldw;
+ldiqw @S433;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S434;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S435;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S436;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L519:
+@L513:
+jmp @L520;
+@L506:
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 68;
+eqdw;
+jmpf @L521;
+# var: d, offset: 16
+# var: full_init, offset: 24
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+neqdw;
+jmpf @L522;
+jmp @@do_auto_init_scalar;
+@L522:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L523:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L525;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L526:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L529;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L529;
+ldidw 1;
+jmp @L530;
+@L529:
+ldidw 0;
+@L530:
+jmpf @L528;
+# var: mem_offs, offset: 28
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw get_member_descriptor;
+call 16;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 28;
+stdw;
+pop;
+ldbp -44;
+lddw;
+ldbp 28;
+lddw;
+adddw;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw do_auto_init;
+call 28;
+pop;
+pop;
+@L527:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L526;
+@L528:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L531;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L532;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L532;
+ldidw 1;
+jmp @L533;
+@L532:
+ldidw 0;
+@L533:
+jmpf @L534;
+ldidw 1;
+ldbp 24;
+stdw;
+pop;
+@L534:
+jmp @L525;
+@L531:
+@L524:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L523;
+@L525:
+ldbp 24;
+lddw;
+notdw;
+jmpf @L535;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L536;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L536:
+@L537:
+ldidw 1;
+jmpf @L538;
+@L539:
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L540;
+# var: md, offset: 32
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw get_member_descriptor;
+call 16;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp -44;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+adddw;
+ldiqw @S437;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S438;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S439;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S440;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw @S441;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S442;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S443;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S444;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L539;
+@L540:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L541;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L542;
+@L541:
+jmp @L538;
+@L542:
+jmp @L537;
+@L538:
+@L535:
+jmp @L543;
+@L521:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+jmpf @L544;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+neqdw;
+jmpf @L545;
+jmp @@do_auto_init_scalar;
+@L545:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -44;
+lddw;
+ldbp -40;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw do_auto_init;
+call 28;
+pop;
+pop;
+jmp @L546;
+@L544:
+# var: cat, offset: 16
+# var: dest_ty, offset: 24
+@@do_auto_init_scalar:
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L547;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+eqdw;
+jmpf @L547;
+ldidw 1;
+jmp @L548;
+@L547:
+ldidw 0;
+@L548:
+jmpf @L549;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L549:
+ldbp -24;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldbp -40;
+ldqw;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -44;
+lddw;
+ldiqw @S445;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S446;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 24;
+ldiqw store;
+call 8;
+pop;
+pop;
+ldiqw @S447;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S448;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 24;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 16;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L550;
+ldbp 16;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L550;
+ldidw 1;
+jmp @L551;
+@L550:
+ldidw 0;
+@L551:
+jmpf @L552;
+ldiqw @S449;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S450;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L552:
+@L546:
+@L543:
+@L520:
+ldidw 0;
+ret;
+# ==== start of definition of function `push_break_target' ====
+.text
+push_break_target:
+addsp 0;         
+# param:`lab', offset:-20
+ldbp -20;
+lddw;
+ldiqw btarget_stack;
+ldiqw bt_stack_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern free_pre_token
+.bss
+.align 4
+btarget_stack:
+.res 512
+.extern round_up
+.extern analyze_declarator
+.extern location_init
+# ==== start of definition of function `label_statement' ====
+.text
+label_statement:
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S451;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S452;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern include_liblux
+# ==== start of definition of function `case_statement' ====
+.text
+case_statement:
+addsp 4;         
+# param:`s', offset:-24
+# var: L, offset: 4
+ldiqw new_label;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw install_switch_label;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S453;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S454;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern stat_number_of_pre_tokens
+.extern strchr
+.extern toupper
+# ==== start of definition of function `do_static_expr' ====
+.text
+do_static_expr:
+addsp 28;        
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T553;
+jmptab;
+@L555:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T556;
+switch;
+@L558:
+# var: pi, offset: 4
+# var: ii, offset: 8
+# var: ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L559;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+jmp @L560;
+@L559:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L560:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+mulqw;
+addqw;
+ret;
+@L561:
+@L562:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 71;
+neqdw;
+jmpf @L563;
+# var: m, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw get_member_descriptor;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+addqw;
+ret;
+jmp @L564;
+@L563:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ret;
+@L564:
+@L565:
+@L566:
+@L567:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ret;
+@L568:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L569;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+addqw;
+ret;
+jmp @L570;
+@L569:
+# var: pi, offset: 4
+# var: ii, offset: 8
+# var: ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L571;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+jmp @L572;
+@L571:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L572:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+mulqw;
+addqw;
+ret;
+@L570:
+@L573:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L574;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+subqw;
+ret;
+jmp @L575;
+@L574:
+# var: ty, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 8;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ldbp 8;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+mulqw;
+subqw;
+ret;
+@L575:
+@L576:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ordw;
+jmpf @L577;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ret;
+jmp @L578;
+@L577:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ret;
+@L578:
+@L579:
+@L580:
+ldidw 0;
+notdw;
+jmpf @L583;
+ldidw 1684;
+ldiqw @S455;
+ldiqw @S456;
+ldiqw @S457;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L583:
+@L581:
+ldidw 0;
+jmpf @L582;
+jmp @L580;
+@L582:
+@L557:
+.data
+.align 8
+@T556:
+.dword 10
+.dword 6
+.dword 7
+.dword 12
+.dword 13
+.dword 30
+.dword 97
+.dword 101
+.dword 103
+.dword 105
+.qword @L579
+.qword @L561
+.qword @L562
+.qword @L568
+.qword @L573
+.qword @L576
+.qword @L558
+.qword @L566
+.qword @L565
+.qword @L567
+.text
+@L584:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ret;
+@L585:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw new_string_literal;
+call 8;
+pop;
+ldiqw @S458;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ret;
+@L586:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L587;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S459;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+jmp @L588;
+@L587:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S460;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+@L588:
+ldidw 0;
+dw2qw;
+ret;
+@L554:
+.data
+.align 8
+@T553:
+.dword 0
+.dword 4
+.qword @L554
+.qword @L555
+.qword @L584
+.qword @L585
+.qword @L586
+.text
+ldidw 0;
+ret;
+.extern add_angle_dir
+.extern analyze_conditional_expression
+.extern ic_outpath
+.extern stdout
+.extern get_type_category
+# ==== start of definition of function `return_statement' ====
+.text
+return_statement:
+addsp 8;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L589;
+# var: cat, offset: 4
+ldiqw ret_ty;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldiqw ret_ty;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L590;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 5;
+eqdw;
+jmpf @L590;
+ldidw 1;
+jmp @L591;
+@L590:
+ldidw 0;
+@L591:
+jmpf @L592;
+ldiqw @S461;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S462;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L593;
+@L592:
+ldbp 4;
+lddw;
+ldidw 68;
+eqdw;
+jmpt @L594;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L594;
+ldidw 0;
+jmp @L595;
+@L594:
+ldidw 1;
+@L595:
+jmpf @L596;
+# var: size, offset: 8
+ldiqw ret_ty;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw temp_struct_size;
+lddw;
+ugtdw;
+jmpf @L597;
+ldbp 8;
+lddw;
+ldiqw temp_struct_size;
+stdw;
+pop;
+@L597:
+ldiqw @S463;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S464;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S465;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S466;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S467;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S468;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L596:
+@L593:
+jmp @L598;
+@L589:
+ldiqw @S469;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S470;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L598:
+ldiqw @S471;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S472;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern ilog2
+# ==== start of definition of function `load_addr' ====
+.text
+load_addr:
+addsp 4;         
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L599;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L600;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S473;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S474;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L601;
+@L600:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S475;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S476;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L601:
+jmp @L602;
+@L599:
+# var: offset, offset: 4
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw location_get_offset;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S477;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S478;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L602:
+ldidw 0;
+ret;
+.extern strcmp
+.extern strtok
+.extern strtol
+.extern parse_header
+.extern stdin
+.extern is_integer
+.extern analyze_postfix_expression
+.extern ftell
+.extern strcpy
+.bss
+.align 8
+switch_labels:
+.res 129152
+.extern install_tag
+.extern location_new
+.extern ic_function_to_print
+.extern isupper
+.extern strtoull
+.bss
+.align 4
+temp_struct_size:
+.res 4
+.extern strlen
+.extern token_table
+# ==== start of definition of function `while_statement' ====
+.text
+while_statement:
+addsp 8;         
+# param:`s', offset:-24
+# var: L1, offset: 4
+# var: L2, offset: 8
+ldiqw new_label;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S479;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S480;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S481;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S482;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw push_break_target;
+call 4;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw push_continue_target;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldiqw pop_break_target;
+call 0;
+pop;
+pop;
+ldiqw pop_continue_target;
+call 0;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S483;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S484;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S485;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S486;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern string_vprintf
+.extern analyze_expression
+# ==== start of definition of function `cmp_switch_label' ====
+.text
+cmp_switch_label:
+addsp 20;        
+# param:`p1', offset:-24
+# param:`p2', offset:-32
+# var: x1, offset: 8
+ldbp -24;
+ldqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+# var: x2, offset: 16
+ldbp -32;
+ldqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+jmpf @L603;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L603:
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+jmpf @L604;
+ldidw 1;
+dw2qw;
+ret;
+@L604:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+sltqw;
+jmpf @L605;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+jmp @L606;
+@L605:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L607;
+ldidw 0;
+dw2qw;
+ret;
+jmp @L608;
+@L607:
+ldidw 1;
+dw2qw;
+ret;
+@L608:
+@L606:
+ldidw 0;
+ret;
+# ==== start of definition of function `default_statement' ====
+.text
+default_statement:
+addsp 4;         
+# param:`s', offset:-24
+# var: L, offset: 4
+ldiqw new_label;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 1;
+ldidw 0;
+dw2qw;
+ldiqw install_switch_label;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S487;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S488;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern memchr
+.extern new_type_exp_node
+.extern analyze_primary_expression
+.extern dup_decl_specs
+.extern new_declaration_node
+.extern vfprintf
+.extern eval_const_expr
+.extern hash
+.extern string_clear
+# ==== start of definition of function `asm_statement' ====
+.text
+asm_statement:
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S489;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern iscntrl
+.extern bsearch
+.extern pre_save_pch
+.extern qsort
+.extern analyze_parameter_declaration
+# ==== start of definition of function `goto_statement' ====
+.text
+goto_statement:
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S490;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S491;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern string_new
+.extern cg_outpath
+.extern memcmp
+.bss
+.align 8
+output_buffer:
+.res 8
+.extern pre_load_pch
+.extern vsnprintf
+.extern vsprintf
+.extern warning_count
+.extern memcpy
+.extern fopen
+.extern be_atoi
+# ==== start of definition of function `install_switch_label' ====
+.text
+install_switch_label:
+addsp 12;        
+# param:`val', offset:-24
+# param:`is_default', offset:-28
+# param:`lab', offset:-32
+# var: h, offset: 4
+# var: np, offset: 8
+ldiqw 32;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldbp -28;
+lddw;
+jmpf @L609;
+ldidw 0;
+dw2qw;
+jmp @L610;
+@L609:
+ldbp -24;
+ldqw;
+ldiqw hash2;
+call 8;
+ldidw 1009;
+dw2qw;
+umodqw;
+@L610:
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw switch_labels;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8072;
+mulqw;
+addqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw switch_labels;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8072;
+mulqw;
+addqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern push_scope
+.extern free_c_token
+.extern parse
+.bss
+.align 8
+curr_func_name:
+.res 8
+.extern get_pre_token
+.extern get_member_descriptor
+.extern decl_init
+.extern dup_declarator
+.extern strncat
+.extern fileno
+.extern isdigit
+# ==== start of definition of function `emit_string_literals' ====
+.text
+emit_string_literals:
+addsp 12;        
+# var: n, offset: 4
+# var: c, offset: 8
+ldiqw str_lit_count;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L611;
+ldiqw 0;
+ret;
+@L611:
+ldiqw @S492;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S493;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L612:
+ldbp 4;
+lddw;
+ldiqw str_lit_count;
+lddw;
+ultdw;
+jmpf @L614;
+ldbp 4;
+lddw;
+ldiqw @S494;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S495;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw string_literal_pool;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L615:
+ldbp 8;
+ldqw;
+ldub;
+ldiqw @S496;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S497;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L616:
+ldbp 8;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldub;
+ldidw 0;
+neqdw;
+jmpf @L617;
+jmp @L615;
+@L617:
+@L613:
+incldw 4;
+jmp @L612;
+@L614:
+ldiqw output_file;
+ldqw;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern string_printf
+.extern lookup_external_id
+.extern isspace
+.extern hash2
+.extern analyze_type_name
+.bss
+.align 8
+int_ty:
+.res 16
+.extern isalpha
+.extern is_unsigned_int
+.extern memmove
+.extern replace_extension
+.extern analyze_struct_declarator
+# ==== start of definition of function `push_continue_target' ====
+.text
+push_continue_target:
+addsp 0;         
+# param:`lab', offset:-20
+ldbp -20;
+lddw;
+ldiqw ctarget_stack;
+ldiqw ct_stack_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern get_type_spec
+# ==== start of definition of function `expression_statement' ====
+.text
+expression_statement:
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L618;
+ldiqw 0;
+ret;
+@L618:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw void_expression;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern isgraph
+# ==== start of definition of function `break_statement' ====
+.text
+break_statement:
+addsp 0;         
+ldiqw btarget_stack;
+ldiqw bt_stack_top;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw @S498;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S499;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern analyze_function_definition
+.extern strdup
+.bss
+.align 8
+output_file:
+.res 8
+.extern analyze_init_declarator
+.extern cfg_function_to_print
+.extern strncmp
+.extern location_get_offset
+.extern analyze_multiplicative_expression
+.extern analyze_additive_expression
+.data
+.align 4
+ct_stack_top:
+.align 4
+.dword -1
+.extern stat_number_of_c_tokens
+.extern strncpy
+.extern decl_save_pch
+.extern analyze_assignment_expression
+.extern new_extern_id_node
+.extern decl_load_pch
+.data
+.align 4
+local_offset:
+.align 4
+.dword 4
+.extern analyze_translation_unit
+.extern strnlen
+# ==== start of definition of function `load' ====
+.text
+load:
+addsp 4;         
+# param:`e', offset:-24
+# var: cat, offset: 4
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @T619;
+switch;
+@L621:
+@L622:
+jmp @L620;
+@L623:
+@L624:
+jmp @L620;
+@L625:
+@L626:
+@L627:
+@L628:
+@L629:
+@L630:
+ldiqw @S500;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S501;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L620;
+@L631:
+@L632:
+ldiqw @S502;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S503;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L620;
+@L633:
+ldiqw @S504;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S505;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L620;
+@L634:
+ldiqw @S506;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S507;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L620;
+@L635:
+@L636:
+ldiqw @S508;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S509;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L620;
+@L637:
+ldiqw @S510;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S511;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L620;
+@L620:
+.data
+.align 8
+@T619:
+.dword 18
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 68
+.dword 71
+.dword 72
+.dword 97
+.dword 98
+.dword 106
+.dword 107
+.dword 108
+.dword 109
+.dword 110
+.dword 111
+.qword @L620
+.qword @L625
+.qword @L635
+.qword @L630
+.qword @L628
+.qword @L626
+.qword @L633
+.qword @L621
+.qword @L622
+.qword @L629
+.qword @L624
+.qword @L623
+.qword @L636
+.qword @L637
+.qword @L634
+.qword @L627
+.qword @L631
+.qword @L632
+.text
+ldidw 0;
+ret;
+.extern analyze_enumerator
+.extern targeting_arch64
+# ==== start of definition of function `do_statement' ====
+.text
+do_statement:
+addsp 12;        
+# param:`s', offset:-24
+# var: L1, offset: 4
+# var: L2, offset: 8
+# var: L3, offset: 12
+ldiqw new_label;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S512;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S513;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw push_break_target;
+call 4;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw push_continue_target;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldiqw pop_break_target;
+call 0;
+pop;
+pop;
+ldiqw pop_continue_target;
+call 0;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S514;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S515;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S516;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S517;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S518;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S519;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S520;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S521;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern set_attributes
+.extern is_typedef_name
+.extern fread
+.extern strrchr
+.extern disable_warnings
+.extern string_append
+.extern install_macro
+.extern string_buf
+.extern ferror
+.extern random
+.extern isblank
+# ==== start of definition of function `new_string_literal' ====
+.text
+new_string_literal:
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw string_literal_pool;
+ldiqw str_lit_count;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw str_lit_count;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern free
+.extern malloc
+.extern get_external_declarations
+.extern new_decl_list_node
+.extern srandom
+.bss
+.align 8
+string_literal_pool:
+.res 8192
+.extern lookup_struct_descriptor
+.extern new_exec_node
+.extern get_alignment
+.extern fgetc
+.data
+@S0:
+.byte 105
+.byte 110
+.byte 99
+.byte 108
+.byte 100
+.byte 119
+.byte 0
+@S1:
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 100
+.byte 119
+.byte 0
+@S2:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S3:
+.byte 10
+.byte 0
+@S4:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S5:
+.byte 10
+.byte 0
+@S6:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S7:
+.byte 10
+.byte 0
+@S8:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S9:
+.byte 10
+.byte 0
+@S10:
+.byte 46
+.byte 98
+.byte 115
+.byte 115
+.byte 0
+@S11:
+.byte 10
+.byte 0
+@S12:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 52
+.byte 0
+@S13:
+.byte 10
+.byte 0
+@S14:
+.byte 95
+.byte 95
+.byte 116
+.byte 101
+.byte 109
+.byte 112
+.byte 95
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 58
+.byte 0
+@S15:
+.byte 10
+.byte 0
+@S16:
+.byte 46
+.byte 114
+.byte 101
+.byte 115
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S17:
+.byte 10
+.byte 0
+@S18:
+.byte 35
+.byte 32
+.byte 61
+.byte 61
+.byte 61
+.byte 61
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 114
+.byte 116
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 61
+.byte 61
+.byte 61
+.byte 61
+.byte 0
+@S19:
+.byte 10
+.byte 0
+@S20:
+.byte 46
+.byte 116
+.byte 101
+.byte 120
+.byte 116
+.byte 0
+@S21:
+.byte 10
+.byte 0
+@S22:
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S23:
+.byte 10
+.byte 0
+@S24:
+.byte 46
+.byte 103
+.byte 108
+.byte 111
+.byte 98
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S25:
+.byte 10
+.byte 0
+@S26:
+.byte 97
+.byte 100
+.byte 100
+.byte 115
+.byte 112
+.byte 32
+.byte 0
+@S27:
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 0
+@S28:
+.byte 10
+.byte 0
+@S29:
+.byte 35
+.byte 32
+.byte 112
+.byte 97
+.byte 114
+.byte 97
+.byte 109
+.byte 58
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 44
+.byte 32
+.byte 111
+.byte 102
+.byte 102
+.byte 115
+.byte 101
+.byte 116
+.byte 58
+.byte 37
+.byte 100
+.byte 0
+@S30:
+.byte 10
+.byte 0
+@S31:
+.byte 37
+.byte 100
+.byte 0
+@S32:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 48
+.byte 59
+.byte 0
+@S33:
+.byte 10
+.byte 0
+@S34:
+.byte 114
+.byte 101
+.byte 116
+.byte 59
+.byte 0
+@S35:
+.byte 10
+.byte 0
+@S36:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 64
+.byte 84
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S37:
+.byte 10
+.byte 0
+@S38:
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 50
+.byte 0
+@S39:
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 0
+@S40:
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S41:
+.byte 10
+.byte 0
+@S42:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S43:
+.byte 10
+.byte 0
+@S44:
+.byte 46
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S45:
+.byte 10
+.byte 0
+@S46:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 52
+.byte 0
+@S47:
+.byte 10
+.byte 0
+@S48:
+.byte 64
+.byte 84
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S49:
+.byte 10
+.byte 0
+@S50:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 49
+.byte 0
+@S51:
+.byte 10
+.byte 0
+@S52:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 48
+.byte 0
+@S53:
+.byte 10
+.byte 0
+@S54:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S55:
+.byte 10
+.byte 0
+@S56:
+.byte 46
+.byte 116
+.byte 101
+.byte 120
+.byte 116
+.byte 0
+@S57:
+.byte 10
+.byte 0
+@S58:
+.byte 106
+.byte 109
+.byte 112
+.byte 116
+.byte 97
+.byte 98
+.byte 0
+@S59:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S60:
+.byte 10
+.byte 0
+@S61:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S62:
+.byte 10
+.byte 0
+@S63:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S64:
+.byte 10
+.byte 0
+@S65:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 48
+.byte 0
+@S66:
+.byte 10
+.byte 0
+@S67:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S68:
+.byte 10
+.byte 0
+@S69:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S70:
+.byte 10
+.byte 0
+@S71:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S72:
+.byte 10
+.byte 0
+@S73:
+.byte 46
+.byte 116
+.byte 101
+.byte 120
+.byte 116
+.byte 0
+@S74:
+.byte 10
+.byte 0
+@S75:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S76:
+.byte 10
+.byte 0
+@S77:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S78:
+.byte 10
+.byte 0
+@S79:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 48
+.byte 0
+@S80:
+.byte 10
+.byte 0
+@S81:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S82:
+.byte 10
+.byte 0
+@S83:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S84:
+.byte 10
+.byte 0
+@S85:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S86:
+.byte 10
+.byte 0
+@S87:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S88:
+.byte 10
+.byte 0
+@S89:
+.byte 46
+.byte 116
+.byte 101
+.byte 120
+.byte 116
+.byte 0
+@S90:
+.byte 10
+.byte 0
+@S91:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S92:
+.byte 10
+.byte 0
+@S93:
+.byte 106
+.byte 109
+.byte 112
+.byte 102
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S94:
+.byte 10
+.byte 0
+@S95:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S96:
+.byte 10
+.byte 0
+@S97:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S98:
+.byte 10
+.byte 0
+@S99:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S100:
+.byte 10
+.byte 0
+@S101:
+.byte 115
+.byte 116
+.byte 98
+.byte 59
+.byte 0
+@S102:
+.byte 10
+.byte 0
+@S103:
+.byte 115
+.byte 116
+.byte 119
+.byte 59
+.byte 0
+@S104:
+.byte 10
+.byte 0
+@S105:
+.byte 115
+.byte 116
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S106:
+.byte 10
+.byte 0
+@S107:
+.byte 115
+.byte 116
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S108:
+.byte 10
+.byte 0
+@S109:
+.byte 115
+.byte 119
+.byte 97
+.byte 112
+.byte 59
+.byte 0
+@S110:
+.byte 10
+.byte 0
+@S111:
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S112:
+.byte 10
+.byte 0
+@S113:
+.byte 108
+.byte 100
+.byte 120
+.byte 98
+.byte 0
+@S114:
+.byte 108
+.byte 100
+.byte 120
+.byte 117
+.byte 98
+.byte 0
+@S115:
+.byte 108
+.byte 100
+.byte 120
+.byte 100
+.byte 119
+.byte 0
+@S116:
+.byte 108
+.byte 100
+.byte 120
+.byte 113
+.byte 119
+.byte 0
+@S117:
+.byte 46
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S118:
+.byte 10
+.byte 0
+@S119:
+.byte 46
+.byte 122
+.byte 101
+.byte 114
+.byte 111
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S120:
+.byte 10
+.byte 0
+@S121:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S122:
+.byte 10
+.byte 0
+@S123:
+.byte 46
+.byte 122
+.byte 101
+.byte 114
+.byte 111
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S124:
+.byte 10
+.byte 0
+@S125:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S126:
+.byte 10
+.byte 0
+@S127:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S128:
+.byte 10
+.byte 0
+@S129:
+.byte 46
+.byte 122
+.byte 101
+.byte 114
+.byte 111
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S130:
+.byte 10
+.byte 0
+@S131:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S132:
+.byte 10
+.byte 0
+@S133:
+.byte 46
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 0
+@S134:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 50
+.byte 0
+@S135:
+.byte 10
+.byte 0
+@S136:
+.byte 46
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 0
+@S137:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 52
+.byte 0
+@S138:
+.byte 10
+.byte 0
+@S139:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 0
+@S140:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 52
+.byte 0
+@S141:
+.byte 10
+.byte 0
+@S142:
+.byte 46
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 0
+@S143:
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 0
+@S144:
+.byte 10
+.byte 0
+@S145:
+.byte 37
+.byte 100
+.byte 0
+@S146:
+.byte 10
+.byte 0
+@S147:
+.byte 111
+.byte 114
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S148:
+.byte 10
+.byte 0
+@S149:
+.byte 108
+.byte 100
+.byte 110
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S150:
+.byte 10
+.byte 0
+@S151:
+.byte 106
+.byte 109
+.byte 112
+.byte 102
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S152:
+.byte 10
+.byte 0
+@S153:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S154:
+.byte 10
+.byte 0
+@S155:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S156:
+.byte 10
+.byte 0
+@S157:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S158:
+.byte 10
+.byte 0
+@S159:
+.byte 46
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S160:
+.byte 10
+.byte 0
+@S161:
+.byte 46
+.byte 98
+.byte 115
+.byte 115
+.byte 0
+@S162:
+.byte 10
+.byte 0
+@S163:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S164:
+.byte 10
+.byte 0
+@S165:
+.byte 64
+.byte 37
+.byte 115
+.byte 95
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S166:
+.byte 10
+.byte 0
+@S167:
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S168:
+.byte 10
+.byte 0
+@S169:
+.byte 46
+.byte 114
+.byte 101
+.byte 115
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S170:
+.byte 10
+.byte 0
+@S171:
+.byte 46
+.byte 103
+.byte 108
+.byte 111
+.byte 98
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S172:
+.byte 10
+.byte 0
+@S173:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S174:
+.byte 10
+.byte 0
+@S175:
+.byte 46
+.byte 116
+.byte 101
+.byte 120
+.byte 116
+.byte 0
+@S176:
+.byte 10
+.byte 0
+@S177:
+.byte 35
+.byte 32
+.byte 118
+.byte 97
+.byte 114
+.byte 58
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 111
+.byte 102
+.byte 102
+.byte 115
+.byte 101
+.byte 116
+.byte 58
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S178:
+.byte 10
+.byte 0
+@S179:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S180:
+.byte 10
+.byte 0
+@S181:
+.byte 100
+.byte 119
+.byte 50
+.byte 98
+.byte 59
+.byte 0
+@S182:
+.byte 10
+.byte 0
+@S183:
+.byte 100
+.byte 119
+.byte 50
+.byte 98
+.byte 59
+.byte 0
+@S184:
+.byte 10
+.byte 0
+@S185:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S186:
+.byte 10
+.byte 0
+@S187:
+.byte 100
+.byte 119
+.byte 50
+.byte 117
+.byte 98
+.byte 59
+.byte 0
+@S188:
+.byte 10
+.byte 0
+@S189:
+.byte 100
+.byte 119
+.byte 50
+.byte 117
+.byte 98
+.byte 59
+.byte 0
+@S190:
+.byte 10
+.byte 0
+@S191:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S192:
+.byte 10
+.byte 0
+@S193:
+.byte 100
+.byte 119
+.byte 50
+.byte 119
+.byte 59
+.byte 0
+@S194:
+.byte 10
+.byte 0
+@S195:
+.byte 100
+.byte 119
+.byte 50
+.byte 119
+.byte 59
+.byte 0
+@S196:
+.byte 10
+.byte 0
+@S197:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S198:
+.byte 10
+.byte 0
+@S199:
+.byte 100
+.byte 119
+.byte 50
+.byte 117
+.byte 119
+.byte 59
+.byte 0
+@S200:
+.byte 10
+.byte 0
+@S201:
+.byte 100
+.byte 119
+.byte 50
+.byte 117
+.byte 119
+.byte 59
+.byte 0
+@S202:
+.byte 10
+.byte 0
+@S203:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S204:
+.byte 10
+.byte 0
+@S205:
+.byte 117
+.byte 100
+.byte 119
+.byte 50
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S206:
+.byte 10
+.byte 0
+@S207:
+.byte 100
+.byte 119
+.byte 50
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S208:
+.byte 10
+.byte 0
+@S209:
+.byte 106
+.byte 109
+.byte 112
+.byte 102
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S210:
+.byte 10
+.byte 0
+@S211:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S212:
+.byte 10
+.byte 0
+@S213:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S214:
+.byte 10
+.byte 0
+@S215:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S216:
+.byte 10
+.byte 0
+@S217:
+.byte 106
+.byte 109
+.byte 112
+.byte 116
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S218:
+.byte 10
+.byte 0
+@S219:
+.byte 106
+.byte 109
+.byte 112
+.byte 116
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S220:
+.byte 10
+.byte 0
+@S221:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 48
+.byte 59
+.byte 0
+@S222:
+.byte 10
+.byte 0
+@S223:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S224:
+.byte 10
+.byte 0
+@S225:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S226:
+.byte 10
+.byte 0
+@S227:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 49
+.byte 59
+.byte 0
+@S228:
+.byte 10
+.byte 0
+@S229:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S230:
+.byte 10
+.byte 0
+@S231:
+.byte 106
+.byte 109
+.byte 112
+.byte 102
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S232:
+.byte 10
+.byte 0
+@S233:
+.byte 106
+.byte 109
+.byte 112
+.byte 102
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S234:
+.byte 10
+.byte 0
+@S235:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 49
+.byte 59
+.byte 0
+@S236:
+.byte 10
+.byte 0
+@S237:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S238:
+.byte 10
+.byte 0
+@S239:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S240:
+.byte 10
+.byte 0
+@S241:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 48
+.byte 59
+.byte 0
+@S242:
+.byte 10
+.byte 0
+@S243:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S244:
+.byte 10
+.byte 0
+@S245:
+.byte 111
+.byte 114
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S246:
+.byte 10
+.byte 0
+@S247:
+.byte 111
+.byte 114
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S248:
+.byte 10
+.byte 0
+@S249:
+.byte 120
+.byte 111
+.byte 114
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S250:
+.byte 10
+.byte 0
+@S251:
+.byte 120
+.byte 111
+.byte 114
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S252:
+.byte 10
+.byte 0
+@S253:
+.byte 97
+.byte 110
+.byte 100
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S254:
+.byte 10
+.byte 0
+@S255:
+.byte 97
+.byte 110
+.byte 100
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S256:
+.byte 10
+.byte 0
+@S257:
+.byte 101
+.byte 113
+.byte 0
+@S258:
+.byte 110
+.byte 101
+.byte 113
+.byte 0
+@S259:
+.byte 37
+.byte 115
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S260:
+.byte 10
+.byte 0
+@S261:
+.byte 37
+.byte 115
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S262:
+.byte 10
+.byte 0
+@S263:
+.byte 37
+.byte 115
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S264:
+.byte 10
+.byte 0
+@S265:
+.byte 113
+.byte 119
+.byte 0
+@S266:
+.byte 113
+.byte 119
+.byte 0
+@S267:
+.byte 100
+.byte 119
+.byte 0
+@S268:
+.byte 117
+.byte 0
+@S269:
+.byte 115
+.byte 0
+@S270:
+.byte 117
+.byte 0
+@S271:
+.byte 37
+.byte 115
+.byte 108
+.byte 116
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S272:
+.byte 10
+.byte 0
+@S273:
+.byte 37
+.byte 115
+.byte 103
+.byte 116
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S274:
+.byte 10
+.byte 0
+@S275:
+.byte 37
+.byte 115
+.byte 108
+.byte 101
+.byte 116
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S276:
+.byte 10
+.byte 0
+@S277:
+.byte 37
+.byte 115
+.byte 103
+.byte 101
+.byte 116
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S278:
+.byte 10
+.byte 0
+@S279:
+.byte 115
+.byte 108
+.byte 108
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S280:
+.byte 10
+.byte 0
+@S281:
+.byte 115
+.byte 108
+.byte 108
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S282:
+.byte 10
+.byte 0
+@S283:
+.byte 108
+.byte 0
+@S284:
+.byte 97
+.byte 0
+@S285:
+.byte 115
+.byte 114
+.byte 37
+.byte 115
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S286:
+.byte 10
+.byte 0
+@S287:
+.byte 115
+.byte 114
+.byte 37
+.byte 115
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S288:
+.byte 10
+.byte 0
+@S289:
+.byte 97
+.byte 100
+.byte 100
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S290:
+.byte 10
+.byte 0
+@S291:
+.byte 97
+.byte 100
+.byte 100
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S292:
+.byte 10
+.byte 0
+@S293:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S294:
+.byte 10
+.byte 0
+@S295:
+.byte 109
+.byte 117
+.byte 108
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S296:
+.byte 10
+.byte 0
+@S297:
+.byte 97
+.byte 100
+.byte 100
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S298:
+.byte 10
+.byte 0
+@S299:
+.byte 115
+.byte 117
+.byte 98
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S300:
+.byte 10
+.byte 0
+@S301:
+.byte 115
+.byte 117
+.byte 98
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S302:
+.byte 10
+.byte 0
+@S303:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S304:
+.byte 10
+.byte 0
+@S305:
+.byte 109
+.byte 117
+.byte 108
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S306:
+.byte 10
+.byte 0
+@S307:
+.byte 115
+.byte 117
+.byte 98
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S308:
+.byte 10
+.byte 0
+@S309:
+.byte 115
+.byte 117
+.byte 98
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S310:
+.byte 10
+.byte 0
+@S311:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S312:
+.byte 10
+.byte 0
+@S313:
+.byte 115
+.byte 100
+.byte 105
+.byte 118
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S314:
+.byte 10
+.byte 0
+@S315:
+.byte 109
+.byte 117
+.byte 108
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S316:
+.byte 10
+.byte 0
+@S317:
+.byte 109
+.byte 117
+.byte 108
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S318:
+.byte 10
+.byte 0
+@S319:
+.byte 117
+.byte 0
+@S320:
+.byte 115
+.byte 0
+@S321:
+.byte 100
+.byte 105
+.byte 118
+.byte 0
+@S322:
+.byte 109
+.byte 111
+.byte 100
+.byte 0
+@S323:
+.byte 37
+.byte 115
+.byte 37
+.byte 115
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S324:
+.byte 10
+.byte 0
+@S325:
+.byte 37
+.byte 115
+.byte 37
+.byte 115
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S326:
+.byte 10
+.byte 0
+@S327:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 49
+.byte 59
+.byte 0
+@S328:
+.byte 10
+.byte 0
+@S329:
+.byte 97
+.byte 100
+.byte 100
+.byte 0
+@S330:
+.byte 115
+.byte 117
+.byte 98
+.byte 0
+@S331:
+.byte 37
+.byte 115
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S332:
+.byte 10
+.byte 0
+@S333:
+.byte 100
+.byte 117
+.byte 112
+.byte 59
+.byte 0
+@S334:
+.byte 10
+.byte 0
+@S335:
+.byte 100
+.byte 117
+.byte 112
+.byte 59
+.byte 0
+@S336:
+.byte 10
+.byte 0
+@S337:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 49
+.byte 59
+.byte 0
+@S338:
+.byte 10
+.byte 0
+@S339:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S340:
+.byte 10
+.byte 0
+@S341:
+.byte 97
+.byte 100
+.byte 100
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S342:
+.byte 10
+.byte 0
+@S343:
+.byte 115
+.byte 117
+.byte 98
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S344:
+.byte 10
+.byte 0
+@S345:
+.byte 115
+.byte 119
+.byte 97
+.byte 112
+.byte 59
+.byte 0
+@S346:
+.byte 10
+.byte 0
+@S347:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S348:
+.byte 10
+.byte 0
+@S349:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 49
+.byte 59
+.byte 0
+@S350:
+.byte 10
+.byte 0
+@S351:
+.byte 97
+.byte 100
+.byte 100
+.byte 0
+@S352:
+.byte 115
+.byte 117
+.byte 98
+.byte 0
+@S353:
+.byte 37
+.byte 115
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S354:
+.byte 10
+.byte 0
+@S355:
+.byte 97
+.byte 100
+.byte 100
+.byte 115
+.byte 112
+.byte 32
+.byte 45
+.byte 56
+.byte 59
+.byte 0
+@S356:
+.byte 10
+.byte 0
+@S357:
+.byte 100
+.byte 117
+.byte 112
+.byte 59
+.byte 0
+@S358:
+.byte 10
+.byte 0
+@S359:
+.byte 115
+.byte 119
+.byte 97
+.byte 112
+.byte 59
+.byte 0
+@S360:
+.byte 10
+.byte 0
+@S361:
+.byte 100
+.byte 117
+.byte 112
+.byte 59
+.byte 0
+@S362:
+.byte 10
+.byte 0
+@S363:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 49
+.byte 59
+.byte 0
+@S364:
+.byte 10
+.byte 0
+@S365:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S366:
+.byte 10
+.byte 0
+@S367:
+.byte 97
+.byte 100
+.byte 100
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S368:
+.byte 10
+.byte 0
+@S369:
+.byte 115
+.byte 117
+.byte 98
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S370:
+.byte 10
+.byte 0
+@S371:
+.byte 115
+.byte 119
+.byte 97
+.byte 112
+.byte 59
+.byte 0
+@S372:
+.byte 10
+.byte 0
+@S373:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S374:
+.byte 10
+.byte 0
+@S375:
+.byte 113
+.byte 119
+.byte 0
+@S376:
+.byte 100
+.byte 119
+.byte 0
+@S377:
+.byte 110
+.byte 101
+.byte 103
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S378:
+.byte 10
+.byte 0
+@S379:
+.byte 99
+.byte 109
+.byte 112
+.byte 108
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S380:
+.byte 10
+.byte 0
+@S381:
+.byte 110
+.byte 111
+.byte 116
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S382:
+.byte 10
+.byte 0
+@S383:
+.byte 110
+.byte 111
+.byte 116
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S384:
+.byte 10
+.byte 0
+@S385:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S386:
+.byte 10
+.byte 0
+@S387:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S388:
+.byte 10
+.byte 0
+@S389:
+.byte 109
+.byte 117
+.byte 108
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S390:
+.byte 10
+.byte 0
+@S391:
+.byte 97
+.byte 100
+.byte 100
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S392:
+.byte 10
+.byte 0
+@S393:
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S394:
+.byte 10
+.byte 0
+@S395:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 45
+.byte 52
+.byte 59
+.byte 0
+@S396:
+.byte 10
+.byte 0
+@S397:
+.byte 97
+.byte 100
+.byte 100
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S398:
+.byte 10
+.byte 0
+@S399:
+.byte 108
+.byte 100
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S400:
+.byte 10
+.byte 0
+@S401:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S402:
+.byte 10
+.byte 0
+@S403:
+.byte 97
+.byte 100
+.byte 100
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S404:
+.byte 10
+.byte 0
+@S405:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 59
+.byte 0
+@S406:
+.byte 10
+.byte 0
+@S407:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S408:
+.byte 10
+.byte 0
+@S409:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S410:
+.byte 10
+.byte 0
+@S411:
+.byte 108
+.byte 100
+.byte 98
+.byte 112
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S412:
+.byte 10
+.byte 0
+@S413:
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S414:
+.byte 10
+.byte 0
+@S415:
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S416:
+.byte 10
+.byte 0
+@S417:
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S418:
+.byte 10
+.byte 0
+@S419:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S420:
+.byte 10
+.byte 0
+@S421:
+.byte 97
+.byte 100
+.byte 100
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S422:
+.byte 10
+.byte 0
+@S423:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 48
+.byte 59
+.byte 0
+@S424:
+.byte 10
+.byte 0
+@S425:
+.byte 102
+.byte 105
+.byte 108
+.byte 108
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S426:
+.byte 10
+.byte 0
+@S427:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S428:
+.byte 10
+.byte 0
+@S429:
+.byte 108
+.byte 100
+.byte 98
+.byte 112
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S430:
+.byte 10
+.byte 0
+@S431:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 48
+.byte 59
+.byte 0
+@S432:
+.byte 10
+.byte 0
+@S433:
+.byte 102
+.byte 105
+.byte 108
+.byte 108
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S434:
+.byte 10
+.byte 0
+@S435:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S436:
+.byte 10
+.byte 0
+@S437:
+.byte 108
+.byte 100
+.byte 98
+.byte 112
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S438:
+.byte 10
+.byte 0
+@S439:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 48
+.byte 59
+.byte 0
+@S440:
+.byte 10
+.byte 0
+@S441:
+.byte 102
+.byte 105
+.byte 108
+.byte 108
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S442:
+.byte 10
+.byte 0
+@S443:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S444:
+.byte 10
+.byte 0
+@S445:
+.byte 108
+.byte 100
+.byte 98
+.byte 112
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S446:
+.byte 10
+.byte 0
+@S447:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S448:
+.byte 10
+.byte 0
+@S449:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S450:
+.byte 10
+.byte 0
+@S451:
+.byte 64
+.byte 64
+.byte 37
+.byte 115
+.byte 95
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S452:
+.byte 10
+.byte 0
+@S453:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S454:
+.byte 10
+.byte 0
+@S455:
+.byte 100
+.byte 111
+.byte 95
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 95
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 0
+@S456:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 118
+.byte 109
+.byte 51
+.byte 50
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 118
+.byte 109
+.byte 51
+.byte 50
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S457:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S458:
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 43
+.byte 0
+@S459:
+.byte 64
+.byte 37
+.byte 115
+.byte 95
+.byte 37
+.byte 115
+.byte 43
+.byte 0
+@S460:
+.byte 37
+.byte 115
+.byte 43
+.byte 0
+@S461:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 115
+.byte 112
+.byte 59
+.byte 0
+@S462:
+.byte 10
+.byte 0
+@S463:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 95
+.byte 95
+.byte 116
+.byte 101
+.byte 109
+.byte 112
+.byte 95
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 59
+.byte 0
+@S464:
+.byte 10
+.byte 0
+@S465:
+.byte 115
+.byte 119
+.byte 97
+.byte 112
+.byte 59
+.byte 0
+@S466:
+.byte 10
+.byte 0
+@S467:
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S468:
+.byte 10
+.byte 0
+@S469:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 48
+.byte 59
+.byte 0
+@S470:
+.byte 10
+.byte 0
+@S471:
+.byte 114
+.byte 101
+.byte 116
+.byte 59
+.byte 0
+@S472:
+.byte 10
+.byte 0
+@S473:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 64
+.byte 37
+.byte 115
+.byte 95
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S474:
+.byte 10
+.byte 0
+@S475:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S476:
+.byte 10
+.byte 0
+@S477:
+.byte 108
+.byte 100
+.byte 98
+.byte 112
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S478:
+.byte 10
+.byte 0
+@S479:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S480:
+.byte 10
+.byte 0
+@S481:
+.byte 106
+.byte 109
+.byte 112
+.byte 102
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S482:
+.byte 10
+.byte 0
+@S483:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S484:
+.byte 10
+.byte 0
+@S485:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S486:
+.byte 10
+.byte 0
+@S487:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S488:
+.byte 10
+.byte 0
+@S489:
+.byte 37
+.byte 115
+.byte 0
+@S490:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 64
+.byte 37
+.byte 115
+.byte 95
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S491:
+.byte 10
+.byte 0
+@S492:
+.byte 46
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S493:
+.byte 10
+.byte 0
+@S494:
+.byte 64
+.byte 83
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S495:
+.byte 10
+.byte 0
+@S496:
+.byte 46
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S497:
+.byte 10
+.byte 0
+@S498:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S499:
+.byte 10
+.byte 0
+@S500:
+.byte 108
+.byte 100
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S501:
+.byte 10
+.byte 0
+@S502:
+.byte 108
+.byte 100
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S503:
+.byte 10
+.byte 0
+@S504:
+.byte 108
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S505:
+.byte 10
+.byte 0
+@S506:
+.byte 108
+.byte 100
+.byte 117
+.byte 119
+.byte 59
+.byte 0
+@S507:
+.byte 10
+.byte 0
+@S508:
+.byte 108
+.byte 100
+.byte 98
+.byte 59
+.byte 0
+@S509:
+.byte 10
+.byte 0
+@S510:
+.byte 108
+.byte 100
+.byte 117
+.byte 98
+.byte 59
+.byte 0
+@S511:
+.byte 10
+.byte 0
+@S512:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S513:
+.byte 10
+.byte 0
+@S514:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S515:
+.byte 10
+.byte 0
+@S516:
+.byte 106
+.byte 109
+.byte 112
+.byte 102
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S517:
+.byte 10
+.byte 0
+@S518:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S519:
+.byte 10
+.byte 0
+@S520:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S521:
+.byte 10
+.byte 0
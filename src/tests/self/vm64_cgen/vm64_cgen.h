@@ -0,0 +1,8 @@
+#ifndef VM64_CGEN_H_
+#define VM64_CGEN_H_
+
+#include <stdio.h>
+
+void vm64_cgen(FILE *outf);
+
+#endif
@@ -0,0 +1,16012 @@
+.extern fgets
+# ==== start of definition of function `void_expression' ====
+.text
+void_expression:
+addsp 12;        
+# param:`e', offset:-24
+# var: cat, offset: 4
+# var: op, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L1;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 93;
+eqdw;
+jmpt @L2;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 94;
+eqdw;
+jmpt @L2;
+ldidw 0;
+jmp @L3;
+@L2:
+ldidw 1;
+@L3:
+jmpf @L4;
+ldiqw @S0;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L5;
+@L4:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 95;
+eqdw;
+jmpt @L6;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 96;
+eqdw;
+jmpt @L6;
+ldidw 0;
+jmp @L7;
+@L6:
+ldidw 1;
+@L7:
+jmpf @L8;
+ldiqw @S1;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L8:
+@L5:
+@L1:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L13;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L13;
+ldidw 1;
+jmp @L14;
+@L13:
+ldidw 0;
+@L14:
+jmpf @L11;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+neqdw;
+jmpf @L11;
+ldidw 1;
+jmp @L12;
+@L11:
+ldidw 0;
+@L12:
+jmpf @L9;
+ldbp 4;
+lddw;
+ldidw 60;
+eqdw;
+jmpt @L17;
+ldbp 4;
+lddw;
+ldidw 72;
+eqdw;
+jmpt @L17;
+ldidw 0;
+jmp @L18;
+@L17:
+ldidw 1;
+@L18:
+jmpt @L15;
+ldbp 4;
+lddw;
+ldidw 55;
+eqdw;
+jmpt @L15;
+ldidw 0;
+jmp @L16;
+@L15:
+ldidw 1;
+@L16:
+jmpf @L9;
+ldidw 1;
+jmp @L10;
+@L9:
+ldidw 0;
+@L10:
+jmpf @L19;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw location_get_offset;
+call 8;
+pop;
+ldbp 8;
+ldqw;
+ldiqw @S2;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S3;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L19:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S4;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S5;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_64val;
+call 4;
+pop;
+jmpf @L20;
+ldiqw @S6;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S7;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L20:
+ldidw 0;
+ret;
+.extern get_promoted_type
+.extern analyze_bitwise_operator
+# ==== start of definition of function `statement' ====
+.text
+statement:
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T21;
+jmptab;
+@L23:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw compound_statement;
+call 12;
+pop;
+pop;
+jmp @L22;
+@L24:
+ldbp -24;
+ldqw;
+ldiqw if_statement;
+call 8;
+pop;
+pop;
+jmp @L22;
+@L25:
+ldbp -24;
+ldqw;
+ldiqw switch_statement;
+call 8;
+pop;
+pop;
+jmp @L22;
+@L26:
+ldbp -24;
+ldqw;
+ldiqw while_statement;
+call 8;
+pop;
+pop;
+jmp @L22;
+@L27:
+ldbp -24;
+ldqw;
+ldiqw do_statement;
+call 8;
+pop;
+pop;
+jmp @L22;
+@L28:
+ldbp -24;
+ldqw;
+ldiqw for_statement;
+call 8;
+pop;
+pop;
+jmp @L22;
+@L29:
+ldbp -24;
+ldqw;
+ldiqw goto_statement;
+call 8;
+pop;
+pop;
+jmp @L22;
+@L30:
+ldiqw continue_statement;
+call 0;
+pop;
+pop;
+jmp @L22;
+@L31:
+ldiqw break_statement;
+call 0;
+pop;
+pop;
+jmp @L22;
+@L32:
+ldbp -24;
+ldqw;
+ldiqw return_statement;
+call 8;
+pop;
+pop;
+jmp @L22;
+@L33:
+ldbp -24;
+ldqw;
+ldiqw case_statement;
+call 8;
+pop;
+pop;
+jmp @L22;
+@L34:
+ldbp -24;
+ldqw;
+ldiqw default_statement;
+call 8;
+pop;
+pop;
+jmp @L22;
+@L35:
+ldbp -24;
+ldqw;
+ldiqw expression_statement;
+call 8;
+pop;
+pop;
+jmp @L22;
+@L36:
+ldbp -24;
+ldqw;
+ldiqw label_statement;
+call 8;
+pop;
+pop;
+jmp @L22;
+@L37:
+ldbp -24;
+ldqw;
+ldiqw asm_statement;
+call 8;
+pop;
+pop;
+jmp @L22;
+@L22:
+.data
+.align 8
+@T21:
+.dword 0
+.dword 15
+.qword @L22
+.qword @L24
+.qword @L26
+.qword @L27
+.qword @L28
+.qword @L31
+.qword @L30
+.qword @L32
+.qword @L35
+.qword @L23
+.qword @L25
+.qword @L33
+.qword @L34
+.qword @L36
+.qword @L29
+.qword @L37
+.text
+ldidw 0;
+ret;
+.extern verbose_asm
+.bss
+.align 8
+ret_ty:
+.res 16
+.extern is_complete
+.bss
+.align 4
+str_lit_count:
+.res 4
+.extern cfg_outpath
+.data
+.align 4
+size_of_local_area:
+.align 4
+.dword 0
+.extern analyze_unary_expression
+.extern string_write
+.extern target_arch
+.extern emit_warning
+.extern is_struct_union_enum
+.extern get_sizeof
+.extern emit_error
+.bss
+.align 8
+long_ty:
+.res 16
+.extern get_curr_scope_id
+.extern getenv
+.extern can_assign_to
+.extern atoi
+.extern exit
+# ==== start of definition of function `function_definition' ====
+.text
+function_definition:
+addsp 68;        
+# param:`decl_specs', offset:-24
+# param:`header', offset:-32
+# var: p, offset: 8
+# var: scs, offset: 16
+# var: param_offs, offset: 24
+# var: num, offset: 28
+# var: cp, offset: 40
+# var: addsp_param, offset: 48
+# var: pos_tmp, offset: 52
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw curr_func_name;
+stqw;
+pop;
+pop;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S8;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S9;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S10;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S11;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S12;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S13;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L38;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L38;
+ldidw 0;
+jmp @L39;
+@L38:
+ldidw 1;
+@L39:
+jmpf @L40;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S14;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S15;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L40:
+ldiqw @S16;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldbp 48;
+stdw;
+pop;
+ldiqw @S17;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S18;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw location_push_scope;
+call 0;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L41;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L41;
+ldidw 1;
+jmp @L42;
+@L41:
+ldidw 0;
+@L42:
+jmpf @L43;
+ldidw 0;
+dw2qw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L43:
+ldidw 16;
+negdw;
+ldbp 24;
+stdw;
+pop;
+@L44:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L45;
+# var: pty, offset: 56
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L46;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpf @L46;
+ldidw 1;
+jmp @L47;
+@L46:
+ldidw 0;
+@L47:
+jmpf @L48;
+jmp @L45;
+@L48:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldidw 4;
+ldbp 56;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw round_up;
+call 8;
+pop;
+subdw;
+ldbp 24;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw location_new;
+call 12;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S19;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S20;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L44;
+@L45:
+ldbp -24;
+ldqw;
+ldiqw ret_ty;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw ret_ty;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw compound_statement;
+call 12;
+pop;
+pop;
+ldiqw location_pop_scope;
+call 0;
+pop;
+pop;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldbp 52;
+stdw;
+pop;
+ldbp 48;
+lddw;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldidw 4;
+ldiqw size_of_local_area;
+lddw;
+ldidw 4;
+subdw;
+ldiqw round_up;
+call 8;
+pop;
+ldiqw @S21;
+ldbp 28;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_curr;
+call 8;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldidw 10;
+dw2qw;
+ldbp 28;
+ldbp 40;
+ldqw;
+ldiqw strncpy;
+call 24;
+pop;
+pop;
+ldbp 40;
+ldqw;
+ldbp 28;
+ldiqw strlen;
+call 8;
+addqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldidw 59;
+dw2b;
+ldbp 40;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+stb;
+pop;
+@L49:
+ldbp 40;
+ldqw;
+ldb;
+ldidw 10;
+neqdw;
+jmpf @L50;
+ldidw 32;
+dw2b;
+ldbp 40;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+stb;
+pop;
+jmp @L49;
+@L50:
+ldbp 52;
+lddw;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldidw 4;
+ldiqw local_offset;
+stdw;
+pop;
+ldiqw @S22;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S23;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S24;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S25;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern stderr
+.extern opt_level
+.extern restore_scope
+.extern string_get_pos
+.extern tolower
+.extern rewind
+.extern get_type_node
+.extern analyze_logical_operator
+.extern realloc
+.extern lookup_ordinary_id
+# ==== start of definition of function `switch_statement' ====
+.text
+switch_statement:
+addsp 8260;      
+# param:`s', offset:-24
+# var: ST, offset: 4
+# var: EXIT, offset: 8
+# var: DEF, offset: 12
+# var: i, offset: 16
+# var: st_size, offset: 20
+# var: ce64, offset: 24
+# var: ncase, offset: 28
+# var: sw_pos, offset: 32
+# var: pos_tmp, offset: 36
+# var: min, offset: 40
+# var: max, offset: 48
+# var: v, offset: 56
+# var: search_table, offset: 64
+# var: np, offset: 8256
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 4;
+sgetdw;
+ldbp 24;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S26;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S27;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldbp 24;
+lddw;
+jmpf @L51;
+ldiqw @S28;
+jmp @L52;
+@L51:
+ldiqw @S29;
+@L52:
+ldiqw @S30;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S31;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw switch_nesting_level;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw push_break_target;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldiqw pop_break_target;
+call 0;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S32;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S33;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 20;
+stdw;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L53:
+ldbp 16;
+lddw;
+ldidw 1009;
+sltdw;
+jmpf @L55;
+ldiqw switch_labels;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8072;
+mulqw;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L56;
+ldiqw switch_labels;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8072;
+mulqw;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8256;
+stqw;
+pop;
+pop;
+@L57:
+ldbp 8256;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L59;
+ldbp 8256;
+ldqw;
+ldbp 64;
+ldbp 20;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L58:
+ldbp 8256;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8256;
+stqw;
+pop;
+pop;
+jmp @L57;
+@L59:
+ldidw 0;
+dw2qw;
+ldiqw switch_labels;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8072;
+mulqw;
+addqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L56:
+@L54:
+incldw 16;
+jmp @L53;
+@L55:
+ldiqw switch_nesting_level;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldbp 20;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L60;
+ldiqw cmp_switch_label;
+ldiqw 8;
+ldbp 20;
+lddw;
+dw2qw;
+ldbp 64;
+ldiqw qsort;
+call 32;
+pop;
+pop;
+@L60:
+ldiqw @S34;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S35;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S36;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S37;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S38;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S39;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L61;
+ldiqw @S40;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S41;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 24;
+lddw;
+jmpf @L62;
+ldiqw @S42;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S43;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L62:
+ldbp 8;
+lddw;
+ldiqw @S44;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S45;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S46;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S47;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L61:
+ldbp 64;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 16;
+addqw;
+lddw;
+jmpf @L63;
+ldbp 20;
+lddw;
+ldidw 1;
+subdw;
+jmp @L64;
+@L63:
+ldbp 20;
+lddw;
+@L64:
+ldbp 28;
+stdw;
+pop;
+ldbp 28;
+lddw;
+ldidw 3;
+sgetdw;
+jmpf @L65;
+ldbp 64;
+ldbp 20;
+lddw;
+ldbp 28;
+lddw;
+subdw;
+dw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 64;
+ldbp 20;
+lddw;
+ldidw 1;
+subdw;
+dw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 48;
+stqw;
+pop;
+pop;
+ldbp 48;
+ldqw;
+ldbp 40;
+ldqw;
+subqw;
+ldbp 28;
+lddw;
+ldidw 10;
+adddw;
+dw2qw;
+ultqw;
+jmpf @L66;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldbp 36;
+stdw;
+pop;
+ldbp 32;
+lddw;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldidw 6;
+dw2qw;
+ldiqw @S48;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_curr;
+call 8;
+ldiqw memcpy;
+call 24;
+pop;
+pop;
+ldbp 36;
+lddw;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldbp 40;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldiqw @S49;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S50;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 24;
+lddw;
+jmpf @L67;
+ldbp 40;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldiqw @S51;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S52;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L67:
+ldbp 48;
+ldqw;
+ldbp 40;
+ldqw;
+subqw;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldiqw @S53;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S54;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 24;
+lddw;
+jmpf @L68;
+ldiqw @S55;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S56;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L68:
+ldbp 64;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 16;
+addqw;
+lddw;
+jmpf @L69;
+ldbp 64;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 0;
+addqw;
+lddw;
+jmp @L70;
+@L69:
+ldbp 8;
+lddw;
+@L70:
+ldbp 12;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S57;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S58;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldbp 28;
+lddw;
+subdw;
+ldbp 16;
+stdw;
+pop;
+ldbp 40;
+ldqw;
+ldbp 56;
+stqw;
+pop;
+pop;
+@L71:
+ldbp 64;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 56;
+ldqw;
+eqqw;
+jmpf @L74;
+ldbp 64;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @S59;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S60;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldbp 20;
+lddw;
+eqdw;
+jmpf @L75;
+jmp @L73;
+@L75:
+jmp @L76;
+@L74:
+ldbp 12;
+lddw;
+ldiqw @S61;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S62;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L76:
+@L72:
+ldbp 56;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+pop;
+pop;
+jmp @L71;
+@L73:
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L77:
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+sltdw;
+jmpf @L79;
+ldbp 64;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw free;
+call 8;
+pop;
+pop;
+@L78:
+incldw 16;
+jmp @L77;
+@L79:
+ldiqw @S63;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S64;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L66:
+@L65:
+ldbp 64;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 16;
+addqw;
+lddw;
+notdw;
+jmpf @L80;
+ldbp 20;
+lddw;
+ldidw 1;
+adddw;
+ldiqw @S65;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S66;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+jmp @L81;
+@L80:
+ldbp 20;
+lddw;
+ldiqw @S67;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S68;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldbp 16;
+stdw;
+pop;
+@L81:
+ldbp 24;
+lddw;
+jmpf @L82;
+ldiqw @S69;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S70;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L82:
+@L83:
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+sltdw;
+jmpf @L84;
+ldbp 64;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldiqw @S71;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S72;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 24;
+lddw;
+jmpf @L85;
+ldbp 64;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 8;
+addqw;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldiqw @S73;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S74;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L85:
+incldw 16;
+jmp @L83;
+@L84:
+ldbp 64;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 16;
+addqw;
+lddw;
+notdw;
+jmpf @L86;
+ldbp 8;
+lddw;
+ldiqw @S75;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S76;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L86:
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L87:
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+sltdw;
+jmpf @L89;
+ldbp 64;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @S77;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S78;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 64;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw free;
+call 8;
+pop;
+pop;
+@L88:
+incldw 16;
+jmp @L87;
+@L89:
+ldiqw @S79;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S80;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern snprintf
+# ==== start of definition of function `for_statement' ====
+.text
+for_statement:
+addsp 12;        
+# param:`s', offset:-24
+# var: L1, offset: 4
+# var: L2, offset: 8
+# var: L3, offset: 12
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L90;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw void_expression;
+call 8;
+pop;
+pop;
+@L90:
+ldiqw new_label;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L91;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+@L91:
+ldiqw new_label;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S81;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S82;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L92;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S83;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S84;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L92:
+ldbp 12;
+lddw;
+ldiqw push_break_target;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L93;
+ldbp 8;
+lddw;
+jmp @L94;
+@L93:
+ldbp 4;
+lddw;
+@L94:
+ldiqw push_continue_target;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 3;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldiqw pop_break_target;
+call 0;
+pop;
+pop;
+ldiqw pop_continue_target;
+call 0;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L95;
+ldbp 8;
+lddw;
+ldiqw @S85;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S86;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw void_expression;
+call 8;
+pop;
+pop;
+@L95:
+ldbp 4;
+lddw;
+ldiqw @S87;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S88;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S89;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S90;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.data
+.align 4
+switch_nesting_level:
+.align 4
+.dword -1
+# ==== start of definition of function `store' ====
+.text
+store:
+addsp 0;         
+# param:`dest_ty', offset:-24
+ldbp -24;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T96;
+switch;
+@L98:
+@L99:
+@L100:
+ldiqw @S91;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S92;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L97;
+@L101:
+@L102:
+ldiqw @S93;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S94;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L97;
+@L103:
+@L104:
+@L105:
+ldiqw @S95;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S96;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L97;
+@L106:
+@L107:
+@L108:
+@L109:
+@L110:
+@L111:
+@L112:
+ldiqw @S97;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S98;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L97;
+@L113:
+@L114:
+ldiqw @S99;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S100;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S101;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S102;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L97;
+@L97:
+.data
+.align 8
+@T96:
+.dword 18
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 68
+.dword 71
+.dword 72
+.dword 97
+.dword 98
+.dword 106
+.dword 107
+.dword 108
+.dword 109
+.dword 110
+.dword 111
+.qword @L97
+.qword @L106
+.qword @L98
+.qword @L104
+.qword @L103
+.qword @L109
+.qword @L101
+.qword @L113
+.qword @L114
+.qword @L105
+.qword @L107
+.qword @L108
+.qword @L99
+.qword @L100
+.qword @L102
+.qword @L110
+.qword @L111
+.qword @L112
+.text
+ldidw 0;
+ret;
+.extern strpbrk
+.extern pop_struct_descriptor
+# ==== start of definition of function `indexed_load' ====
+.text
+indexed_load:
+addsp 0;         
+# param:`ty', offset:-24
+ldbp -24;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T115;
+switch;
+@L117:
+@L118:
+ldiqw @S103;
+ret;
+@L119:
+ldiqw @S104;
+ret;
+@L120:
+@L121:
+@L122:
+ldiqw @S105;
+ret;
+@L123:
+@L124:
+@L125:
+@L126:
+@L127:
+ldiqw @S106;
+ret;
+@L128:
+ldidw 0;
+dw2qw;
+ret;
+@L116:
+.data
+.align 8
+@T115:
+.dword 12
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 72
+.dword 106
+.dword 107
+.dword 109
+.dword 110
+.dword 111
+.qword @L128
+.qword @L123
+.qword @L117
+.qword @L122
+.qword @L120
+.qword @L124
+.qword @L121
+.qword @L118
+.qword @L119
+.qword @L125
+.qword @L126
+.qword @L127
+.text
+ldidw 0;
+ret;
+# ==== start of definition of function `do_static_init' ====
+.text
+do_static_init:
+addsp 68;        
+# param:`ds', offset:-24
+# param:`dct', offset:-32
+# param:`e', offset:-40
+# var: ts, offset: 8
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L129;
+# var: nelem, offset: 16
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L130;
+jmp @@do_static_init_scalar;
+@L130:
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L131;
+# var: n, offset: 20
+# var: c, offset: 24
+ldidw 0;
+ldbp 20;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L132:
+ldbp 24;
+ldqw;
+ldub;
+ldiqw @S107;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S108;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 20;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+@L133:
+ldbp 20;
+lddw;
+ldbp 16;
+lddw;
+ultdw;
+jmpf @L135;
+ldbp 24;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldub;
+ldidw 0;
+neqdw;
+jmpf @L135;
+ldidw 1;
+jmp @L136;
+@L135:
+ldidw 0;
+@L136:
+jmpf @L134;
+jmp @L132;
+@L134:
+ldbp 20;
+lddw;
+ldbp 16;
+lddw;
+ultdw;
+jmpf @L137;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+subdw;
+ldiqw @S109;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S110;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L137:
+jmp @L138;
+@L131:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L139:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L142;
+ldbp 16;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L142;
+ldidw 1;
+jmp @L143;
+@L142:
+ldidw 0;
+@L143:
+jmpf @L141;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw do_static_init;
+call 24;
+pop;
+pop;
+@L140:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 16;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+jmp @L139;
+@L141:
+ldbp 16;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L144;
+# var: elem_ty, offset: 24
+ldbp -24;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw @S111;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S112;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+muldw;
+ldiqw @S113;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S114;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L144:
+@L138:
+jmp @L145;
+@L129:
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 68;
+eqdw;
+jmpf @L146;
+# var: d, offset: 16
+# var: full_init, offset: 24
+# var: ty, offset: 32
+# var: align, offset: 48
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 32;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 32;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 48;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L147;
+ldbp 48;
+lddw;
+ldiqw @S115;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S116;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L147:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L148:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L150;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L151:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L154;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L154;
+ldidw 1;
+jmp @L155;
+@L154:
+ldidw 0;
+@L155:
+jmpf @L153;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw do_static_init;
+call 24;
+pop;
+pop;
+@L152:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L151;
+@L153:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L156;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L157;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L157;
+ldidw 1;
+jmp @L158;
+@L157:
+ldidw 0;
+@L158:
+jmpf @L159;
+ldidw 1;
+ldbp 24;
+stdw;
+pop;
+@L159:
+jmp @L150;
+@L156:
+@L149:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L148;
+@L150:
+ldbp 24;
+lddw;
+notdw;
+jmpf @L160;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L161;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L161:
+@L162:
+ldidw 1;
+jmpf @L163;
+@L164:
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L165;
+# var: ty, offset: 56
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 56;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw @S117;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S118;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 56;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S119;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S120;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L164;
+@L165:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L166;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L167;
+@L166:
+jmp @L163;
+@L167:
+jmp @L162;
+@L163:
+@L160:
+jmp @L168;
+@L146:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+jmpf @L169;
+# var: ty, offset: 16
+# var: align, offset: 32
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 32;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L170;
+ldbp 32;
+lddw;
+ldiqw @S121;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S122;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L170:
+ldbp -40;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw do_static_init;
+call 24;
+pop;
+pop;
+jmp @L171;
+@L169:
+# var: dest_ty, offset: 16
+@@do_static_init_scalar:
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L172;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+eqdw;
+jmpf @L172;
+ldidw 1;
+jmp @L173;
+@L172:
+ldidw 0;
+@L173:
+jmpf @L174;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L174:
+ldbp -24;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T175;
+switch;
+@L177:
+@L178:
+@L179:
+ldiqw @S123;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L176;
+@L180:
+@L181:
+ldiqw @S124;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S125;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S126;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L176;
+@L182:
+@L183:
+@L184:
+ldiqw @S127;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S128;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S129;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L176;
+@L185:
+@L186:
+@L187:
+@L188:
+@L189:
+ldiqw @S130;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S131;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S132;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -40;
+ldqw;
+ldiqw do_static_expr;
+call 8;
+ldiqw @S133;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S134;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L176:
+.data
+.align 8
+@T175:
+.dword 14
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.dword 109
+.dword 110
+.dword 111
+.qword @L176
+.qword @L185
+.qword @L177
+.qword @L184
+.qword @L182
+.qword @L186
+.qword @L180
+.qword @L183
+.qword @L178
+.qword @L179
+.qword @L181
+.qword @L187
+.qword @L188
+.qword @L189
+.text
+ldbp -40;
+ldqw;
+ldiqw do_static_expr;
+call 8;
+pop;
+ldiqw @S135;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S136;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L171:
+@L168:
+@L145:
+ldidw 0;
+ret;
+.extern fseek
+# ==== start of definition of function `controlling_expression' ====
+.text
+controlling_expression:
+addsp 0;         
+# param:`e', offset:-24
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_64val;
+call 4;
+pop;
+jmpf @L190;
+ldiqw @S137;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S138;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L190:
+ldidw 0;
+ret;
+.extern islower
+.extern string_set_pos
+.extern push_struct_descriptor
+# ==== start of definition of function `new_label' ====
+.text
+new_label:
+addsp 0;         
+.data
+.align 4
+@new_label_label_count:
+.align 4
+.dword 1
+.text
+ldiqw @new_label_label_count;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern sscanf
+.extern fputc
+# ==== start of definition of function `function_argument' ====
+.text
+function_argument:
+addsp 32;        
+# param:`arg', offset:-24
+# param:`param', offset:-32
+# var: ty_cat, offset: 4
+# var: ty, offset: 8
+# var: arg_area_size, offset: 24
+# var: real_arg_size, offset: 28
+# var: aligned_arg_size, offset: 32
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L191;
+ldidw 0;
+dw2qw;
+ret;
+@L191:
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L192;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+neqdw;
+jmpt @L192;
+ldidw 0;
+jmp @L193;
+@L192:
+ldidw 1;
+@L193:
+jmpf @L194;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldiqw function_argument;
+call 16;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L195;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+eqdw;
+jmpf @L195;
+ldidw 1;
+jmp @L196;
+@L195:
+ldidw 0;
+@L196:
+jmpf @L197;
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+jmp @L198;
+@L197:
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+@L198:
+ldbp 8;
+ldbp -24;
+ldqw;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 28;
+stdw;
+pop;
+jmp @L199;
+@L194:
+ldbp -32;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldiqw function_argument;
+call 16;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 8;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L200;
+ldbp 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+eqdw;
+jmpt @L202;
+ldbp 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpt @L202;
+ldidw 0;
+jmp @L203;
+@L202:
+ldidw 1;
+@L203:
+jmpf @L200;
+ldidw 1;
+jmp @L201;
+@L200:
+ldidw 0;
+@L201:
+jmpf @L204;
+ldidw 4;
+ldbp 28;
+stdw;
+pop;
+jmp @L205;
+@L204:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 28;
+stdw;
+pop;
+@L205:
+@L199:
+ldidw 4;
+ldbp 28;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldbp 32;
+lddw;
+adddw;
+ldbp 24;
+stdw;
+pop;
+ldbp 8;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L206;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L206;
+ldidw 0;
+jmp @L207;
+@L206:
+ldidw 1;
+@L207:
+jmpf @L208;
+ldbp 28;
+lddw;
+ldiqw @S139;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S140;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L208:
+ldbp 24;
+lddw;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `if_statement' ====
+.text
+if_statement:
+addsp 8;         
+# param:`s', offset:-24
+# var: L1, offset: 4
+# var: L2, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S141;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S142;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L209;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S143;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S144;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S145;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S146;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+@L209:
+ldbp 8;
+lddw;
+ldiqw @S147;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S148;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern vsscanf
+.extern fwrite
+.extern is_pointer
+.extern colored_diagnostics
+.extern string_curr
+.extern read_stream
+# ==== start of definition of function `static_object_definition' ====
+.text
+static_object_definition:
+addsp 40;        
+# param:`decl_specs', offset:-24
+# param:`declarator', offset:-32
+# param:`mangle_name', offset:-36
+# var: scs, offset: 8
+# var: ty, offset: 16
+# var: initializer, offset: 32
+# var: alignment, offset: 40
+ldbp -24;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L210;
+ldiqw @S149;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S150;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L211;
+@L210:
+ldiqw @S151;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S152;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L211:
+ldbp 16;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 40;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L212;
+ldbp 40;
+lddw;
+ldiqw @S153;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S154;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L212:
+ldbp -36;
+lddw;
+jmpf @L213;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S155;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S156;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L214;
+@L213:
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S157;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S158;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L214:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L215;
+ldbp 32;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw do_static_init;
+call 24;
+pop;
+pop;
+jmp @L216;
+@L215:
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S159;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S160;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L216:
+ldbp -24;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L217;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L217;
+ldidw 0;
+jmp @L218;
+@L217:
+ldidw 1;
+@L218:
+jmpf @L219;
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S161;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S162;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L219:
+ldidw 0;
+ret;
+.extern strspn
+.extern location_pop_scope
+# ==== start of definition of function `pop_continue_target' ====
+.text
+pop_continue_target:
+addsp 0;         
+ldiqw ct_stack_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `continue_statement' ====
+.text
+continue_statement:
+addsp 0;         
+ldiqw ctarget_stack;
+ldiqw ct_stack_top;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw @S163;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S164;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern ispunct
+.extern reset_enum_val
+.extern strtoll
+.extern analyze_relational_equality_expression
+# ==== start of definition of function `pop_break_target' ====
+.text
+pop_break_target:
+addsp 0;         
+ldiqw bt_stack_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+ldidw 0;
+ret;
+.extern get_sto_class_spec
+# ==== start of definition of function `compound_statement' ====
+.text
+compound_statement:
+addsp 60;        
+# param:`s', offset:-24
+# param:`push_scope', offset:-28
+# var: sl, offset: 8
+# var: old_local_offset, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L220;
+# var: dl, offset: 24
+ldiqw local_offset;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+jmpf @L221;
+ldiqw location_push_scope;
+call 0;
+pop;
+pop;
+@L221:
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+@L222:
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L224;
+# var: dct, offset: 32
+# var: scs, offset: 40
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 40;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L225;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+eqdw;
+jmpf @L226;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L227:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L229;
+ldidw 1;
+ldbp 32;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw static_object_definition;
+call 20;
+pop;
+pop;
+@L228:
+ldbp 32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L227;
+@L229:
+ldiqw @S165;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S166;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L223;
+jmp @L230;
+@L226:
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 56;
+eqdw;
+jmpt @L231;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 70;
+eqdw;
+jmpt @L231;
+ldidw 0;
+jmp @L232;
+@L231:
+ldidw 1;
+@L232:
+jmpf @L233;
+jmp @L223;
+@L233:
+@L230:
+@L225:
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L234:
+ldbp 32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L236;
+# var: lty, offset: 48
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 48;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 98;
+eqdw;
+jmpf @L237;
+jmp @L235;
+@L237:
+ldbp 48;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw local_offset;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldiqw local_offset;
+stdw;
+pop;
+ldiqw local_offset;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw location_new;
+call 12;
+pop;
+pop;
+ldiqw local_offset;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S167;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S168;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L238;
+ldiqw local_offset;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 48;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw do_auto_init;
+call 28;
+pop;
+pop;
+@L238:
+ldiqw local_offset;
+lddw;
+ldbp 48;
+ldiqw get_sizeof;
+call 8;
+pop;
+adddw;
+ldiqw local_offset;
+stdw;
+pop;
+@L235:
+ldbp 32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L234;
+@L236:
+@L223:
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L222;
+@L224:
+@L220:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L239:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L241;
+ldbp 8;
+ldqw;
+ldiqw statement;
+call 8;
+pop;
+pop;
+@L240:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L239;
+@L241:
+ldiqw local_offset;
+lddw;
+ldiqw size_of_local_area;
+lddw;
+sgtdw;
+jmpf @L242;
+ldiqw local_offset;
+lddw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+@L242:
+ldbp -28;
+lddw;
+jmpf @L243;
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L243;
+ldidw 1;
+jmp @L244;
+@L243:
+ldidw 0;
+@L244:
+jmpf @L245;
+ldbp 16;
+lddw;
+ldiqw local_offset;
+stdw;
+pop;
+ldiqw location_pop_scope;
+call 0;
+pop;
+pop;
+@L245:
+ldidw 0;
+ret;
+.extern string_free
+# ==== start of definition of function `vm64_cgen' ====
+.text
+vm64_cgen:
+.global vm64_cgen
+addsp 20;        
+# param:`outf', offset:-24
+# var: ed, offset: 8
+ldiqw location_init;
+call 0;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw output_file;
+stqw;
+pop;
+pop;
+ldidw 4096;
+ldiqw string_new;
+call 4;
+ldiqw output_buffer;
+stqw;
+pop;
+pop;
+ldidw 60;
+ldiqw get_type_node;
+call 4;
+ldiqw int_ty;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw int_ty;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 61;
+ldiqw get_type_node;
+call 4;
+ldiqw long_ty;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw long_ty;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw get_external_declarations;
+call 0;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L246:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L248;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L249;
+# var: scs, offset: 16
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L250;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L250;
+ldidw 0;
+jmp @L251;
+@L250:
+ldidw 1;
+@L251:
+jmpf @L252;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S169;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S170;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L252:
+jmp @L253;
+@L249:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L254;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 98;
+eqdw;
+jmpf @L254;
+ldidw 1;
+jmp @L255;
+@L254:
+ldidw 0;
+@L255:
+jmpf @L256;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw function_definition;
+call 16;
+pop;
+pop;
+jmp @L257;
+@L256:
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw static_object_definition;
+call 20;
+pop;
+pop;
+@L257:
+@L253:
+ldiqw output_file;
+ldqw;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+@L247:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L246;
+@L248:
+ldiqw temp_struct_size;
+lddw;
+ldidw 0;
+ugtdw;
+jmpf @L258;
+ldiqw @S171;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S172;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S173;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S174;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S175;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S176;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw temp_struct_size;
+lddw;
+ldiqw @S177;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S178;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw output_file;
+ldqw;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+@L258:
+ldiqw emit_string_literals;
+call 0;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern fclose
+.extern preprocess
+.extern analyze_decl_specs
+.extern strstr
+.extern calloc
+.extern pop_scope
+.extern memset
+.extern file_exists
+.extern include_libc
+.extern analyze_cast_expression
+.extern location_push_scope
+.bss
+.align 4
+ctarget_stack:
+.res 512
+.extern stringify_type_exp
+.extern add_quote_dir
+.extern stat_number_of_ast_nodes
+.extern strtoul
+.extern isprint
+# ==== start of definition of function `expr_convert' ====
+.text
+expr_convert:
+addsp 8;         
+# param:`e', offset:-24
+# param:`dest', offset:-32
+# var: cat_dest, offset: 4
+# var: cat_src, offset: 8
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -32;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @T259;
+switch;
+@L261:
+@L262:
+ldbp 8;
+lddw;
+ldiqw is_64val;
+call 4;
+pop;
+jmpf @L263;
+ldiqw @S179;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S180;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S181;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S182;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L264;
+@L263:
+ldbp 8;
+lddw;
+ldidw 49;
+neqdw;
+jmpf @L265;
+ldbp 8;
+lddw;
+ldidw 106;
+neqdw;
+jmpf @L265;
+ldidw 1;
+jmp @L266;
+@L265:
+ldidw 0;
+@L266:
+jmpf @L267;
+ldiqw @S183;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S184;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L267:
+@L264:
+jmp @L260;
+@L268:
+ldbp 8;
+lddw;
+ldiqw is_64val;
+call 4;
+pop;
+jmpf @L269;
+ldiqw @S185;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S186;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S187;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S188;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L270;
+@L269:
+ldbp 8;
+lddw;
+ldidw 107;
+neqdw;
+jmpf @L271;
+ldiqw @S189;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S190;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L271:
+@L270:
+jmp @L260;
+@L272:
+ldbp 8;
+lddw;
+ldiqw is_64val;
+call 4;
+pop;
+jmpf @L273;
+ldiqw @S191;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S192;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S193;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S194;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L274;
+@L273:
+ldbp 8;
+lddw;
+ldiqw @T275;
+switch;
+@L277:
+@L278:
+@L279:
+@L280:
+jmp @L276;
+@L281:
+ldiqw @S195;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S196;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L276;
+@L276:
+.data
+.align 8
+@T275:
+.dword 5
+.dword 49
+.dword 64
+.dword 106
+.dword 107
+.qword @L281
+.qword @L277
+.qword @L280
+.qword @L278
+.qword @L279
+.text
+@L274:
+jmp @L260;
+@L282:
+ldbp 8;
+lddw;
+ldiqw is_64val;
+call 4;
+pop;
+jmpf @L283;
+ldiqw @S197;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S198;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S199;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S200;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L284;
+@L283:
+ldbp 8;
+lddw;
+ldidw 107;
+neqdw;
+jmpf @L285;
+ldbp 8;
+lddw;
+ldidw 108;
+neqdw;
+jmpf @L285;
+ldidw 1;
+jmp @L286;
+@L285:
+ldidw 0;
+@L286:
+jmpf @L287;
+ldiqw @S201;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S202;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L287:
+@L284:
+jmp @L260;
+@L288:
+@L289:
+@L290:
+ldbp 8;
+lddw;
+ldiqw is_64val;
+call 4;
+pop;
+jmpf @L291;
+ldiqw @S203;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S204;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L291:
+jmp @L260;
+@L292:
+@L293:
+@L294:
+@L295:
+@L296:
+@L297:
+@L298:
+ldbp 8;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L299;
+ldbp 8;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 3;
+sletdw;
+jmpf @L299;
+ldidw 1;
+jmp @L300;
+@L299:
+ldidw 0;
+@L300:
+jmpf @L301;
+ldbp 8;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L302;
+ldiqw @S205;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S206;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L303;
+@L302:
+ldiqw @S207;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S208;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L303:
+@L301:
+jmp @L260;
+@L304:
+jmp @L260;
+@L260:
+.data
+.align 8
+@T259:
+.dword 16
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 72
+.dword 97
+.dword 98
+.dword 106
+.dword 107
+.dword 108
+.dword 109
+.dword 110
+.dword 111
+.qword @L304
+.qword @L292
+.qword @L261
+.qword @L289
+.qword @L288
+.qword @L295
+.qword @L272
+.qword @L290
+.qword @L293
+.qword @L294
+.qword @L262
+.qword @L268
+.qword @L282
+.qword @L296
+.qword @L297
+.qword @L298
+.text
+ldidw 0;
+ret;
+.extern fprintf
+.extern get_type_qual
+.extern read_file
+.extern is_signed_int
+.extern printf
+.extern get_c_token
+.extern lookup_tag
+# ==== start of definition of function `is_64val' ====
+.text
+is_64val:
+addsp 0;         
+# param:`cat', offset:-20
+ldbp -20;
+lddw;
+ldiqw @T305;
+switch;
+@L307:
+@L308:
+@L309:
+@L310:
+@L311:
+@L312:
+@L313:
+@L314:
+@L315:
+ldidw 1;
+dw2qw;
+ret;
+@L316:
+ldidw 0;
+dw2qw;
+ret;
+@L306:
+.data
+.align 8
+@T305:
+.dword 10
+.dword 11
+.dword 61
+.dword 68
+.dword 71
+.dword 97
+.dword 98
+.dword 109
+.dword 110
+.dword 111
+.qword @L316
+.qword @L311
+.qword @L307
+.qword @L314
+.qword @L315
+.qword @L312
+.qword @L313
+.qword @L308
+.qword @L309
+.qword @L310
+.text
+ldidw 0;
+ret;
+.extern get_rank
+.extern is_external_id
+.data
+.align 4
+bt_stack_top:
+.align 4
+.dword -1
+.extern isalnum
+.extern sprintf
+# ==== start of definition of function `expression' ====
+.text
+expression:
+addsp 108;       
+# param:`e', offset:-24
+# param:`is_addr', offset:-28
+# var: cat, offset: 4
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T317;
+jmptab;
+@L319:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T320;
+switch;
+@L322:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw void_expression;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+jmp @L321;
+@L323:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw store;
+call 8;
+pop;
+pop;
+jmp @L321;
+@L324:
+@L325:
+@L326:
+@L327:
+@L328:
+@L329:
+@L330:
+@L331:
+@L332:
+@L333:
+# var: new_e, offset: 8
+ldbp -24;
+ldqw;
+ldbp 8;
+swap2;
+memcpy 104;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T334;
+jmptab;
+@L336:
+ldidw 102;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L335;
+@L337:
+ldidw 16;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L335;
+@L338:
+ldidw 17;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L335;
+@L339:
+ldidw 12;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L335;
+@L340:
+ldidw 13;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L335;
+@L341:
+ldidw 18;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L335;
+@L342:
+ldidw 19;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L335;
+@L343:
+ldidw 104;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L335;
+@L344:
+ldidw 26;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L335;
+@L345:
+ldidw 27;
+ldbp 8;
+ldiqw 56;
+addqw;
+stdw;
+pop;
+jmp @L335;
+@L335:
+.data
+.align 8
+@T334:
+.dword 36
+.dword 10
+.qword @L335
+.qword @L336
+.qword @L337
+.qword @L338
+.qword @L339
+.qword @L340
+.qword @L341
+.qword @L342
+.qword @L343
+.qword @L344
+.qword @L345
+.text
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 3;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw store;
+call 8;
+pop;
+pop;
+jmp @L321;
+@L346:
+# var: L1, offset: 8
+# var: L2, offset: 12
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S209;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S210;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S211;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S212;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S213;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S214;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S215;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S216;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L321;
+@L347:
+# var: L1, offset: 8
+# var: L2, offset: 12
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S217;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S218;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S219;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S220;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S221;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S222;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S223;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S224;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S225;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S226;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S227;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S228;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S229;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S230;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L321;
+@L348:
+# var: L1, offset: 8
+# var: L2, offset: 12
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S231;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S232;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S233;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S234;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S235;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S236;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S237;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S238;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S239;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S240;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S241;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S242;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S243;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S244;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L321;
+@L349:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 4;
+sgetdw;
+jmpf @L350;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldiqw @S245;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S246;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L351;
+@L350:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S247;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S248;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L351:
+jmp @L321;
+@L352:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 4;
+sgetdw;
+jmpf @L353;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldiqw @S249;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S250;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L354;
+@L353:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S251;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S252;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L354:
+jmp @L321;
+@L355:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 4;
+sgetdw;
+jmpf @L356;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldiqw @S253;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S254;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L357;
+@L356:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S255;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S256;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L357:
+jmp @L321;
+@L358:
+@L359:
+# var: op, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 24;
+eqdw;
+jmpf @L360;
+ldiqw @S257;
+jmp @L361;
+@L360:
+ldiqw @S258;
+@L361:
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_64val;
+call 4;
+pop;
+jmpf @L362;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw @S259;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S260;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L363;
+@L362:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_64val;
+call 4;
+pop;
+jmpf @L364;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw @S261;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S262;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L365;
+@L364:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw @S263;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S264;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L321;
+@L365:
+@L363:
+jmp @L321;
+@L366:
+@L367:
+@L368:
+@L369:
+# var: sign, offset: 8
+# var: size, offset: 16
+# var: cat1, offset: 24
+# var: cat2, offset: 28
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 28;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldiqw is_64val;
+call 4;
+pop;
+jmpf @L370;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldiqw @S265;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L371;
+@L370:
+ldbp 28;
+lddw;
+ldiqw is_64val;
+call 4;
+pop;
+jmpf @L372;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S266;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L373;
+@L372:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S267;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L373:
+@L371:
+ldbp 24;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L374;
+ldbp 28;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L374;
+ldidw 1;
+jmp @L375;
+@L374:
+ldidw 0;
+@L375:
+jmpf @L376;
+ldbp 24;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpt @L377;
+ldbp 28;
+lddw;
+ldiqw get_promoted_type;
+call 4;
+pop;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpt @L377;
+ldidw 0;
+jmp @L378;
+@L377:
+ldidw 1;
+@L378:
+jmpf @L379;
+ldiqw @S268;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L380;
+@L379:
+ldiqw @S269;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L380:
+jmp @L381;
+@L376:
+ldiqw @S270;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L381:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T382;
+jmptab;
+@L384:
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S271;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S272;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L383;
+@L385:
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S273;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S274;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L383;
+@L386:
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S275;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S276;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L383;
+@L387:
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S277;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S278;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L383;
+@L383:
+.data
+.align 8
+@T382:
+.dword 20
+.dword 4
+.qword @L383
+.qword @L384
+.qword @L385
+.qword @L386
+.qword @L387
+.text
+jmp @L321;
+@L388:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw int_ty;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 4;
+sgetdw;
+jmpf @L389;
+ldiqw @S279;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S280;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L390;
+@L389:
+ldiqw @S281;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S282;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L390:
+jmp @L321;
+@L391:
+# var: skind, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L392;
+ldiqw @S283;
+jmp @L393;
+@L392:
+ldiqw @S284;
+@L393:
+ldbp 8;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw int_ty;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 4;
+sgetdw;
+jmpf @L394;
+ldbp 8;
+ldqw;
+ldiqw @S285;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S286;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L395;
+@L394:
+ldbp 8;
+ldqw;
+ldiqw @S287;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S288;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L395:
+jmp @L321;
+@L396:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L397;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 4;
+sgetdw;
+jmpf @L398;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldiqw @S289;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S290;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L399;
+@L398:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S291;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S292;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L399:
+jmp @L400;
+@L397:
+# var: i, offset: 8
+# var: j, offset: 12
+# var: size, offset: 16
+# var: ty, offset: 24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L401;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldidw 1;
+ldbp 12;
+stdw;
+pop;
+jmp @L402;
+@L401:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp 12;
+stdw;
+pop;
+@L402:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 12;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 16;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L403;
+ldbp 16;
+lddw;
+ldiqw @S293;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S294;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S295;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S296;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L403:
+ldiqw @S297;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S298;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L400:
+jmp @L321;
+@L404:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L405;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 4;
+sgetdw;
+jmpf @L406;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldiqw @S299;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S300;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L407;
+@L406:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S301;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S302;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L407:
+jmp @L408;
+@L405:
+# var: size, offset: 8
+# var: ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L409;
+ldbp 8;
+lddw;
+ldidw 1;
+ugtdw;
+jmpf @L410;
+ldbp 8;
+lddw;
+ldiqw @S303;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S304;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S305;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S306;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L410:
+ldiqw @S307;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S308;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L411;
+@L409:
+ldiqw @S309;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S310;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldidw 1;
+ugtdw;
+jmpf @L412;
+ldbp 8;
+lddw;
+ldiqw @S311;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S312;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S313;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S314;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L412:
+@L411:
+@L408:
+jmp @L321;
+@L413:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 4;
+sgetdw;
+jmpf @L414;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldiqw @S315;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S316;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L415;
+@L414:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S317;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S318;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L415:
+jmp @L321;
+@L416:
+@L417:
+# var: sign, offset: 8
+# var: op, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L418;
+ldiqw @S319;
+jmp @L419;
+@L418:
+ldiqw @S320;
+@L419:
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 16;
+eqdw;
+jmpf @L420;
+ldiqw @S321;
+jmp @L421;
+@L420:
+ldiqw @S322;
+@L421:
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 4;
+sgetdw;
+jmpf @L422;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S323;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S324;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L423;
+@L422:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S325;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S326;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L423:
+jmp @L321;
+@L424:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+jmp @L321;
+@L425:
+@L426:
+# var: is64, offset: 8
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S327;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S328;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S329;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S330;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L427;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 3;
+sletdw;
+jmpf @L428;
+ldiqw @S331;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S332;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+jmp @L429;
+@L428:
+ldiqw @S333;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S334;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L429:
+jmp @L430;
+@L427:
+# var: pointed_to_ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S335;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S336;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L430:
+ldbp 8;
+lddw;
+jmpf @L431;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 93;
+eqdw;
+jmpf @L432;
+ldiqw @S337;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S338;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+jmp @L433;
+@L432:
+ldiqw @S339;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S340;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+@L433:
+pop;
+ldiqw @S341;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S342;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw store;
+call 8;
+pop;
+pop;
+jmp @L434;
+@L431:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 93;
+eqdw;
+jmpf @L435;
+ldiqw @S343;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S344;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+jmp @L436;
+@L435:
+ldiqw @S345;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S346;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+@L436:
+pop;
+ldiqw @S347;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S348;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S349;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S350;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw store;
+call 8;
+pop;
+pop;
+@L434:
+ldiqw @S351;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S352;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S353;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S354;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+jmp @L321;
+@L437:
+@L438:
+# var: is64, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_64val;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldiqw @S355;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S356;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+notdw;
+jmpf @L439;
+ldiqw @S357;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S358;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L439:
+ldiqw @S359;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S360;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S361;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S362;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+notdw;
+jmpf @L440;
+ldbp 4;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L441;
+ldiqw @S363;
+jmp @L442;
+@L441:
+ldiqw @S364;
+@L442:
+ldiqw @S365;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S366;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L440:
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L443;
+ldiqw @S367;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S368;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L444;
+@L443:
+# var: pointed_to_ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S369;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S370;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L444:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 94;
+eqdw;
+jmpf @L445;
+ldiqw @S371;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S372;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+jmp @L446;
+@L445:
+ldiqw @S373;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S374;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+@L446:
+pop;
+ldbp 8;
+lddw;
+notdw;
+jmpf @L447;
+ldiqw @S375;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S376;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S377;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S378;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L447:
+ldiqw @S379;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S380;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw store;
+call 8;
+pop;
+pop;
+ldiqw @S381;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S382;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S383;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S384;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+notdw;
+jmpf @L448;
+ldiqw @S385;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S386;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L448:
+jmp @L321;
+@L449:
+ldidw 1;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+jmp @L321;
+@L450:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -28;
+lddw;
+notdw;
+jmpf @L451;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+@L451:
+jmp @L321;
+@L452:
+@L453:
+@L454:
+# var: size, offset: 8
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 4;
+sgetdw;
+jmpf @L455;
+ldiqw @S387;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L456;
+@L455:
+ldiqw @S388;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L456:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T457;
+switch;
+@L459:
+jmp @L458;
+@L460:
+ldbp 8;
+ldqw;
+ldiqw @S389;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S390;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L458;
+@L461:
+ldbp 8;
+ldqw;
+ldiqw @S391;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S392;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L458;
+@L458:
+.data
+.align 8
+@T457:
+.dword 4
+.dword 14
+.dword 99
+.dword 100
+.qword @L458
+.qword @L461
+.qword @L459
+.qword @L460
+.text
+jmp @L321;
+@L462:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_64val;
+call 4;
+pop;
+jmpf @L463;
+ldiqw @S393;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S394;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L464;
+@L463:
+ldiqw @S395;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S396;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L464:
+jmp @L321;
+@L465:
+# var: ldx, offset: 8
+# var: size, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_pointer;
+call 4;
+pop;
+jmpf @L466;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+jmp @L467;
+@L466:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+@L467:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+notdw;
+jmpf @L468;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw indexed_load;
+call 8;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L468;
+ldidw 1;
+jmp @L469;
+@L468:
+ldidw 0;
+@L469:
+jmpf @L470;
+ldbp 16;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw @S397;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S398;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L471;
+@L470:
+ldbp 16;
+lddw;
+ldidw 1;
+ugtdw;
+jmpf @L472;
+ldbp 16;
+lddw;
+ldiqw @S399;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S400;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S401;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S402;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L472:
+ldiqw @S403;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S404;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -28;
+lddw;
+notdw;
+jmpf @L473;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+@L473:
+@L471:
+jmp @L321;
+@L474:
+# var: arg_siz, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 40;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw function_argument;
+call 16;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S405;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S406;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 73;
+eqdw;
+jmpt @L475;
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L477;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 3;
+sletdw;
+jmpf @L477;
+ldidw 1;
+jmp @L478;
+@L477:
+ldidw 0;
+@L478:
+jmpt @L475;
+ldidw 0;
+jmp @L476;
+@L475:
+ldidw 1;
+@L476:
+jmpf @L479;
+ldiqw @S407;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S408;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L479:
+jmp @L321;
+@L480:
+@L481:
+# var: is_union, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 6;
+eqdw;
+jmpf @L482;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 71;
+eqdw;
+ldbp 8;
+stdw;
+pop;
+jmp @L483;
+@L482:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+ldbp 8;
+stdw;
+pop;
+@L483:
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp 8;
+lddw;
+notdw;
+jmpf @L484;
+# var: m, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw get_member_descriptor;
+call 16;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw @S409;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S410;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S411;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S412;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L484:
+ldbp -28;
+lddw;
+notdw;
+jmpf @L485;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+@L485:
+jmp @L321;
+@L321:
+.data
+.align 8
+@T320:
+.dword 47
+.dword 6
+.dword 7
+.dword 12
+.dword 13
+.dword 14
+.dword 15
+.dword 16
+.dword 17
+.dword 18
+.dword 19
+.dword 20
+.dword 21
+.dword 22
+.dword 23
+.dword 24
+.dword 25
+.dword 26
+.dword 27
+.dword 28
+.dword 29
+.dword 30
+.dword 34
+.dword 35
+.dword 36
+.dword 37
+.dword 38
+.dword 39
+.dword 40
+.dword 41
+.dword 42
+.dword 43
+.dword 44
+.dword 45
+.dword 93
+.dword 94
+.dword 95
+.dword 96
+.dword 97
+.dword 98
+.dword 99
+.dword 100
+.dword 101
+.dword 102
+.dword 103
+.dword 104
+.dword 105
+.qword @L321
+.qword @L480
+.qword @L481
+.qword @L396
+.qword @L404
+.qword @L454
+.qword @L462
+.qword @L416
+.qword @L417
+.qword @L388
+.qword @L391
+.qword @L366
+.qword @L367
+.qword @L368
+.qword @L369
+.qword @L358
+.qword @L359
+.qword @L352
+.qword @L349
+.qword @L348
+.qword @L347
+.qword @L346
+.qword @L322
+.qword @L323
+.qword @L324
+.qword @L325
+.qword @L326
+.qword @L327
+.qword @L328
+.qword @L329
+.qword @L330
+.qword @L331
+.qword @L332
+.qword @L333
+.qword @L425
+.qword @L437
+.qword @L426
+.qword @L438
+.qword @L465
+.qword @L474
+.qword @L452
+.qword @L453
+.qword @L450
+.qword @L413
+.qword @L449
+.qword @L355
+.qword @L424
+.text
+jmp @L318;
+@L486:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 4;
+sgetdw;
+jmpf @L487;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S413;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S414;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L488;
+@L487:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+ldiqw @S415;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S416;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L488:
+jmp @L318;
+@L489:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw new_string_literal;
+call 8;
+pop;
+ldiqw @S417;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S418;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L318;
+@L490:
+ldbp -24;
+ldqw;
+ldiqw load_addr;
+call 8;
+pop;
+pop;
+ldbp -28;
+lddw;
+notdw;
+jmpf @L491;
+ldbp -24;
+ldqw;
+ldiqw load;
+call 8;
+pop;
+pop;
+@L491:
+jmp @L318;
+@L318:
+.data
+.align 8
+@T317:
+.dword 0
+.dword 4
+.qword @L318
+.qword @L319
+.qword @L486
+.qword @L489
+.qword @L490
+.text
+ldidw 0;
+ret;
+.extern isxdigit
+.extern strcat
+.extern are_compatible
+.extern error_count
+# ==== start of definition of function `do_auto_init' ====
+.text
+do_auto_init:
+addsp 36;        
+# param:`ds', offset:-24
+# param:`dct', offset:-32
+# param:`e', offset:-40
+# param:`offset', offset:-44
+# var: ts, offset: 8
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L492;
+# var: nelem, offset: 16
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L493;
+jmp @@do_auto_init_scalar;
+@L493:
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L494;
+# var: n, offset: 20
+ldbp -44;
+lddw;
+ldiqw @S419;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S420;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp -40;
+ldqw;
+ldiqw expression;
+call 12;
+pop;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+eqdw;
+jmpf @L495;
+ldbp 20;
+lddw;
+ldiqw @S421;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S422;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L496;
+@L495:
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+ultdw;
+jmpf @L497;
+ldbp 16;
+lddw;
+ldiqw @S423;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S424;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L498;
+@L497:
+ldbp 20;
+lddw;
+ldiqw @S425;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S426;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldiqw @S427;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S428;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S429;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S430;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S431;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S432;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+subdw;
+ldiqw @S433;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S434;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L498:
+@L496:
+ldiqw @S435;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S436;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S437;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S438;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L499;
+@L494:
+# var: elem_size, offset: 20
+# var: elem_ty, offset: 24
+ldbp -24;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L500:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L503;
+ldbp 16;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L503;
+ldidw 1;
+jmp @L504;
+@L503:
+ldidw 0;
+@L504:
+jmpf @L502;
+ldbp -44;
+lddw;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw do_auto_init;
+call 28;
+pop;
+pop;
+ldbp -44;
+lddw;
+ldbp 20;
+lddw;
+adddw;
+ldbp -44;
+stdw;
+pop;
+@L501:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 16;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+jmp @L500;
+@L502:
+ldbp 16;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L505;
+ldbp -44;
+lddw;
+ldiqw @S439;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S440;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S441;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S442;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+muldw;
+ldiqw @S443;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S444;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S445;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S446;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S447;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S448;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L505:
+@L499:
+jmp @L506;
+@L492:
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 68;
+eqdw;
+jmpf @L507;
+# var: d, offset: 16
+# var: full_init, offset: 24
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+neqdw;
+jmpf @L508;
+jmp @@do_auto_init_scalar;
+@L508:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L509:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L511;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L512:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L515;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L515;
+ldidw 1;
+jmp @L516;
+@L515:
+ldidw 0;
+@L516:
+jmpf @L514;
+# var: mem_offs, offset: 28
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw get_member_descriptor;
+call 16;
+ldiqw 12;
+addqw;
+lddw;
+ldbp 28;
+stdw;
+pop;
+ldbp -44;
+lddw;
+ldbp 28;
+lddw;
+adddw;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw do_auto_init;
+call 28;
+pop;
+pop;
+@L513:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L512;
+@L514:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L517;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L518;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L518;
+ldidw 1;
+jmp @L519;
+@L518:
+ldidw 0;
+@L519:
+jmpf @L520;
+ldidw 1;
+ldbp 24;
+stdw;
+pop;
+@L520:
+jmp @L511;
+@L517:
+@L510:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L509;
+@L511:
+ldbp 24;
+lddw;
+notdw;
+jmpf @L521;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L522;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L522:
+@L523:
+ldidw 1;
+jmpf @L524;
+@L525:
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L526;
+# var: md, offset: 32
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw get_member_descriptor;
+call 16;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp -44;
+lddw;
+ldbp 32;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+adddw;
+ldiqw @S449;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S450;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S451;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S452;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw @S453;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S454;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S455;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S456;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S457;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S458;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L525;
+@L526:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L527;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L528;
+@L527:
+jmp @L524;
+@L528:
+jmp @L523;
+@L524:
+@L521:
+jmp @L529;
+@L507:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+jmpf @L530;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+neqdw;
+jmpf @L531;
+jmp @@do_auto_init_scalar;
+@L531:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -44;
+lddw;
+ldbp -40;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw do_auto_init;
+call 28;
+pop;
+pop;
+jmp @L532;
+@L530:
+# var: dest_ty, offset: 16
+@@do_auto_init_scalar:
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L533;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+eqdw;
+jmpf @L533;
+ldidw 1;
+jmp @L534;
+@L533:
+ldidw 0;
+@L534:
+jmpf @L535;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L535:
+ldbp -24;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldbp -40;
+ldqw;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+ldbp -44;
+lddw;
+ldiqw @S459;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S460;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldiqw store;
+call 8;
+pop;
+pop;
+ldiqw @S461;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S462;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_64val;
+call 4;
+pop;
+jmpf @L536;
+ldiqw @S463;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S464;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L536:
+@L532:
+@L529:
+@L506:
+ldidw 0;
+ret;
+# ==== start of definition of function `push_break_target' ====
+.text
+push_break_target:
+addsp 0;         
+# param:`lab', offset:-20
+ldbp -20;
+lddw;
+ldiqw btarget_stack;
+ldiqw bt_stack_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern free_pre_token
+.bss
+.align 4
+btarget_stack:
+.res 512
+.extern round_up
+.extern analyze_declarator
+.extern location_init
+# ==== start of definition of function `label_statement' ====
+.text
+label_statement:
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S465;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S466;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern include_liblux
+# ==== start of definition of function `case_statement' ====
+.text
+case_statement:
+addsp 4;         
+# param:`s', offset:-24
+# var: L, offset: 4
+ldiqw new_label;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 0;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw install_switch_label;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S467;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S468;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern stat_number_of_pre_tokens
+.extern strchr
+.extern toupper
+# ==== start of definition of function `do_static_expr' ====
+.text
+do_static_expr:
+addsp 28;        
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T537;
+jmptab;
+@L539:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T540;
+switch;
+@L542:
+# var: pi, offset: 4
+# var: ii, offset: 8
+# var: ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L543;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+jmp @L544;
+@L543:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L544:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+mulqw;
+addqw;
+ret;
+@L545:
+@L546:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 71;
+neqdw;
+jmpf @L547;
+# var: m, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw get_member_descriptor;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+addqw;
+ret;
+jmp @L548;
+@L547:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ret;
+@L548:
+@L549:
+@L550:
+@L551:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ret;
+@L552:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L553;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+addqw;
+ret;
+jmp @L554;
+@L553:
+# var: pi, offset: 4
+# var: ii, offset: 8
+# var: ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L555;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+jmp @L556;
+@L555:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L556:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+mulqw;
+addqw;
+ret;
+@L554:
+@L557:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L558;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+subqw;
+ret;
+jmp @L559;
+@L558:
+# var: ty, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 8;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ldbp 8;
+ldiqw get_sizeof;
+call 8;
+pop;
+udw2qw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+mulqw;
+subqw;
+ret;
+@L559:
+@L560:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ordw;
+jmpf @L561;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ret;
+jmp @L562;
+@L561:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw do_static_expr;
+call 8;
+ret;
+@L562:
+@L563:
+@L564:
+ldidw 0;
+notdw;
+jmpf @L567;
+ldidw 1665;
+ldiqw @S469;
+ldiqw @S470;
+ldiqw @S471;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L567:
+@L565:
+ldidw 0;
+jmpf @L566;
+jmp @L564;
+@L566:
+@L541:
+.data
+.align 8
+@T540:
+.dword 10
+.dword 6
+.dword 7
+.dword 12
+.dword 13
+.dword 30
+.dword 97
+.dword 101
+.dword 103
+.dword 105
+.qword @L563
+.qword @L545
+.qword @L546
+.qword @L552
+.qword @L557
+.qword @L560
+.qword @L542
+.qword @L550
+.qword @L549
+.qword @L551
+.text
+@L568:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ret;
+@L569:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw new_string_literal;
+call 8;
+pop;
+ldiqw @S472;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ret;
+@L570:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L571;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S473;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+jmp @L572;
+@L571:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S474;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+@L572:
+ldidw 0;
+dw2qw;
+ret;
+@L538:
+.data
+.align 8
+@T537:
+.dword 0
+.dword 4
+.qword @L538
+.qword @L539
+.qword @L568
+.qword @L569
+.qword @L570
+.text
+ldidw 0;
+ret;
+.extern add_angle_dir
+.extern analyze_conditional_expression
+.extern ic_outpath
+.extern stdout
+.extern get_type_category
+# ==== start of definition of function `return_statement' ====
+.text
+return_statement:
+addsp 8;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L573;
+# var: cat, offset: 4
+ldiqw ret_ty;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L574;
+ldbp 4;
+lddw;
+ldiqw get_rank;
+call 4;
+pop;
+ldidw 3;
+sletdw;
+jmpf @L574;
+ldidw 1;
+jmp @L575;
+@L574:
+ldidw 0;
+@L575:
+jmpf @L576;
+ldiqw long_ty;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+jmp @L577;
+@L576:
+ldiqw ret_ty;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw expr_convert;
+call 16;
+pop;
+pop;
+@L577:
+ldbp 4;
+lddw;
+ldidw 68;
+eqdw;
+jmpt @L578;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L578;
+ldidw 0;
+jmp @L579;
+@L578:
+ldidw 1;
+@L579:
+jmpf @L580;
+# var: size, offset: 8
+ldiqw ret_ty;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw temp_struct_size;
+lddw;
+ugtdw;
+jmpf @L581;
+ldbp 8;
+lddw;
+ldiqw temp_struct_size;
+stdw;
+pop;
+@L581:
+ldiqw @S475;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S476;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S477;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S478;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S479;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S480;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L580:
+jmp @L582;
+@L573:
+ldiqw @S481;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S482;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L582:
+ldiqw @S483;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S484;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern ilog2
+# ==== start of definition of function `load_addr' ====
+.text
+load_addr:
+addsp 4;         
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L583;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L584;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S485;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S486;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L585;
+@L584:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S487;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S488;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L585:
+jmp @L586;
+@L583:
+# var: offset, offset: 4
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw location_get_offset;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S489;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S490;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L586:
+ldidw 0;
+ret;
+.extern strcmp
+.extern strtok
+.extern strtol
+.extern parse_header
+.extern stdin
+.extern is_integer
+.extern analyze_postfix_expression
+.extern ftell
+.extern strcpy
+.bss
+.align 8
+switch_labels:
+.res 129152
+.extern install_tag
+.extern location_new
+.extern ic_function_to_print
+.extern isupper
+.extern strtoull
+.bss
+.align 4
+temp_struct_size:
+.res 4
+.extern strlen
+.extern token_table
+# ==== start of definition of function `while_statement' ====
+.text
+while_statement:
+addsp 8;         
+# param:`s', offset:-24
+# var: L1, offset: 4
+# var: L2, offset: 8
+ldiqw new_label;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S491;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S492;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S493;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S494;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw push_break_target;
+call 4;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw push_continue_target;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldiqw pop_break_target;
+call 0;
+pop;
+pop;
+ldiqw pop_continue_target;
+call 0;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S495;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S496;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S497;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S498;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern string_vprintf
+.extern analyze_expression
+# ==== start of definition of function `cmp_switch_label' ====
+.text
+cmp_switch_label:
+addsp 20;        
+# param:`p1', offset:-24
+# param:`p2', offset:-32
+# var: x1, offset: 8
+ldbp -24;
+ldqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+# var: x2, offset: 16
+ldbp -32;
+ldqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+jmpf @L587;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+@L587:
+ldbp 16;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+jmpf @L588;
+ldidw 1;
+dw2qw;
+ret;
+@L588:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+sltqw;
+jmpf @L589;
+ldidw 1;
+negdw;
+dw2qw;
+ret;
+jmp @L590;
+@L589:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L591;
+ldidw 0;
+dw2qw;
+ret;
+jmp @L592;
+@L591:
+ldidw 1;
+dw2qw;
+ret;
+@L592:
+@L590:
+ldidw 0;
+ret;
+# ==== start of definition of function `default_statement' ====
+.text
+default_statement:
+addsp 4;         
+# param:`s', offset:-24
+# var: L, offset: 4
+ldiqw new_label;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 1;
+ldidw 0;
+dw2qw;
+ldiqw install_switch_label;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S499;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S500;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern memchr
+.extern new_type_exp_node
+.extern analyze_primary_expression
+.extern dup_decl_specs
+.extern new_declaration_node
+.extern vfprintf
+.extern eval_const_expr
+.extern hash
+.extern string_clear
+# ==== start of definition of function `asm_statement' ====
+.text
+asm_statement:
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S501;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern iscntrl
+.extern bsearch
+.extern pre_save_pch
+.extern qsort
+.extern analyze_parameter_declaration
+# ==== start of definition of function `goto_statement' ====
+.text
+goto_statement:
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func_name;
+ldqw;
+ldiqw @S502;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S503;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern string_new
+.extern cg_outpath
+.extern memcmp
+.bss
+.align 8
+output_buffer:
+.res 8
+.extern pre_load_pch
+.extern vsnprintf
+.extern vsprintf
+.extern warning_count
+.extern memcpy
+.extern fopen
+.extern be_atoi
+# ==== start of definition of function `install_switch_label' ====
+.text
+install_switch_label:
+addsp 12;        
+# param:`val', offset:-24
+# param:`is_default', offset:-28
+# param:`lab', offset:-32
+# var: h, offset: 4
+# var: np, offset: 8
+ldiqw 32;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp -24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldbp -28;
+lddw;
+jmpf @L593;
+ldidw 0;
+dw2qw;
+jmp @L594;
+@L593:
+ldbp -24;
+ldqw;
+ldiqw hash2;
+call 8;
+ldidw 1009;
+dw2qw;
+umodqw;
+@L594:
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw switch_labels;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8072;
+mulqw;
+addqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw switch_labels;
+ldiqw switch_nesting_level;
+lddw;
+dw2qw;
+ldiqw 8072;
+mulqw;
+addqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern push_scope
+.extern free_c_token
+.extern parse
+.bss
+.align 8
+curr_func_name:
+.res 8
+.extern get_pre_token
+.extern get_member_descriptor
+.extern decl_init
+.extern dup_declarator
+.extern strncat
+.extern fileno
+.extern isdigit
+# ==== start of definition of function `emit_string_literals' ====
+.text
+emit_string_literals:
+addsp 12;        
+# var: n, offset: 4
+# var: c, offset: 8
+ldiqw str_lit_count;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L595;
+ldiqw 0;
+ret;
+@L595:
+ldiqw @S504;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S505;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L596:
+ldbp 4;
+lddw;
+ldiqw str_lit_count;
+lddw;
+ultdw;
+jmpf @L598;
+ldbp 4;
+lddw;
+ldiqw @S506;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S507;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw string_literal_pool;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L599:
+ldbp 8;
+ldqw;
+ldub;
+ldiqw @S508;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S509;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L600:
+ldbp 8;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldub;
+ldidw 0;
+neqdw;
+jmpf @L601;
+jmp @L599;
+@L601:
+@L597:
+incldw 4;
+jmp @L596;
+@L598:
+ldiqw output_file;
+ldqw;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern string_printf
+.extern lookup_external_id
+.extern isspace
+.extern hash2
+.extern analyze_type_name
+.bss
+.align 8
+int_ty:
+.res 16
+.extern isalpha
+.extern is_unsigned_int
+.extern memmove
+.extern replace_extension
+.extern analyze_struct_declarator
+# ==== start of definition of function `push_continue_target' ====
+.text
+push_continue_target:
+addsp 0;         
+# param:`lab', offset:-20
+ldbp -20;
+lddw;
+ldiqw ctarget_stack;
+ldiqw ct_stack_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern get_type_spec
+# ==== start of definition of function `expression_statement' ====
+.text
+expression_statement:
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L602;
+ldiqw 0;
+ret;
+@L602:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw void_expression;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern isgraph
+# ==== start of definition of function `break_statement' ====
+.text
+break_statement:
+addsp 0;         
+ldiqw btarget_stack;
+ldiqw bt_stack_top;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw @S510;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S511;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern analyze_function_definition
+.extern strdup
+.bss
+.align 8
+output_file:
+.res 8
+.extern analyze_init_declarator
+.extern cfg_function_to_print
+.extern strncmp
+.extern location_get_offset
+.extern analyze_multiplicative_expression
+.extern analyze_additive_expression
+.data
+.align 4
+ct_stack_top:
+.align 4
+.dword -1
+.extern stat_number_of_c_tokens
+.extern strncpy
+.extern decl_save_pch
+.extern analyze_assignment_expression
+.extern new_extern_id_node
+.extern decl_load_pch
+.data
+.align 4
+local_offset:
+.align 4
+.dword 4
+.extern analyze_translation_unit
+.extern strnlen
+# ==== start of definition of function `load' ====
+.text
+load:
+addsp 4;         
+# param:`e', offset:-24
+# var: cat, offset: 4
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @T603;
+switch;
+@L605:
+@L606:
+jmp @L604;
+@L607:
+@L608:
+jmp @L604;
+@L609:
+@L610:
+@L611:
+@L612:
+@L613:
+ldiqw @S512;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S513;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L604;
+@L614:
+@L615:
+@L616:
+ldiqw @S514;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S515;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L604;
+@L617:
+ldiqw @S516;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S517;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L604;
+@L618:
+ldiqw @S518;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S519;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L604;
+@L619:
+@L620:
+ldiqw @S520;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S521;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L604;
+@L621:
+ldiqw @S522;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S523;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L604;
+@L604:
+.data
+.align 8
+@T603:
+.dword 18
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 61
+.dword 64
+.dword 68
+.dword 71
+.dword 72
+.dword 97
+.dword 98
+.dword 106
+.dword 107
+.dword 108
+.dword 109
+.dword 110
+.dword 111
+.qword @L604
+.qword @L609
+.qword @L619
+.qword @L616
+.qword @L614
+.qword @L610
+.qword @L617
+.qword @L605
+.qword @L606
+.qword @L615
+.qword @L608
+.qword @L607
+.qword @L620
+.qword @L621
+.qword @L618
+.qword @L611
+.qword @L612
+.qword @L613
+.text
+ldidw 0;
+ret;
+.extern analyze_enumerator
+.extern targeting_arch64
+# ==== start of definition of function `do_statement' ====
+.text
+do_statement:
+addsp 12;        
+# param:`s', offset:-24
+# var: L1, offset: 4
+# var: L2, offset: 8
+# var: L3, offset: 12
+ldiqw new_label;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldiqw new_label;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S524;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S525;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw push_break_target;
+call 4;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw push_continue_target;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw statement;
+call 8;
+pop;
+pop;
+ldiqw pop_break_target;
+call 0;
+pop;
+pop;
+ldiqw pop_continue_target;
+call 0;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldiqw @S526;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S527;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw controlling_expression;
+call 8;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S528;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S529;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S530;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S531;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 12;
+lddw;
+ldiqw @S532;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S533;
+ldiqw output_buffer;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern set_attributes
+.extern is_typedef_name
+.extern fread
+.extern strrchr
+.extern disable_warnings
+.extern string_append
+.extern install_macro
+.extern string_buf
+.extern ferror
+.extern random
+.extern isblank
+# ==== start of definition of function `new_string_literal' ====
+.text
+new_string_literal:
+addsp 0;         
+# param:`s', offset:-24
+ldbp -24;
+ldqw;
+ldiqw string_literal_pool;
+ldiqw str_lit_count;
+lddw;
+udw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldiqw str_lit_count;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+dw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+udw2qw;
+ret;
+ldidw 0;
+ret;
+.extern free
+.extern malloc
+.extern get_external_declarations
+.extern new_decl_list_node
+.extern srandom
+.bss
+.align 8
+string_literal_pool:
+.res 8192
+.extern lookup_struct_descriptor
+.extern new_exec_node
+.extern get_alignment
+.extern fgetc
+.data
+@S0:
+.byte 105
+.byte 110
+.byte 99
+.byte 108
+.byte 100
+.byte 119
+.byte 0
+@S1:
+.byte 100
+.byte 101
+.byte 99
+.byte 108
+.byte 100
+.byte 119
+.byte 0
+@S2:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S3:
+.byte 10
+.byte 0
+@S4:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S5:
+.byte 10
+.byte 0
+@S6:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S7:
+.byte 10
+.byte 0
+@S8:
+.byte 35
+.byte 32
+.byte 61
+.byte 61
+.byte 61
+.byte 61
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 114
+.byte 116
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 61
+.byte 61
+.byte 61
+.byte 61
+.byte 0
+@S9:
+.byte 10
+.byte 0
+@S10:
+.byte 46
+.byte 116
+.byte 101
+.byte 120
+.byte 116
+.byte 0
+@S11:
+.byte 10
+.byte 0
+@S12:
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S13:
+.byte 10
+.byte 0
+@S14:
+.byte 46
+.byte 103
+.byte 108
+.byte 111
+.byte 98
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S15:
+.byte 10
+.byte 0
+@S16:
+.byte 97
+.byte 100
+.byte 100
+.byte 115
+.byte 112
+.byte 32
+.byte 0
+@S17:
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 0
+@S18:
+.byte 10
+.byte 0
+@S19:
+.byte 35
+.byte 32
+.byte 112
+.byte 97
+.byte 114
+.byte 97
+.byte 109
+.byte 58
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 44
+.byte 32
+.byte 111
+.byte 102
+.byte 102
+.byte 115
+.byte 101
+.byte 116
+.byte 58
+.byte 37
+.byte 100
+.byte 0
+@S20:
+.byte 10
+.byte 0
+@S21:
+.byte 37
+.byte 100
+.byte 0
+@S22:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 48
+.byte 59
+.byte 0
+@S23:
+.byte 10
+.byte 0
+@S24:
+.byte 114
+.byte 101
+.byte 116
+.byte 59
+.byte 0
+@S25:
+.byte 10
+.byte 0
+@S26:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 64
+.byte 84
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S27:
+.byte 10
+.byte 0
+@S28:
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 50
+.byte 0
+@S29:
+.byte 115
+.byte 119
+.byte 105
+.byte 116
+.byte 99
+.byte 104
+.byte 0
+@S30:
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S31:
+.byte 10
+.byte 0
+@S32:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S33:
+.byte 10
+.byte 0
+@S34:
+.byte 46
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S35:
+.byte 10
+.byte 0
+@S36:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 56
+.byte 0
+@S37:
+.byte 10
+.byte 0
+@S38:
+.byte 64
+.byte 84
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S39:
+.byte 10
+.byte 0
+@S40:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 49
+.byte 0
+@S41:
+.byte 10
+.byte 0
+@S42:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 48
+.byte 0
+@S43:
+.byte 10
+.byte 0
+@S44:
+.byte 46
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S45:
+.byte 10
+.byte 0
+@S46:
+.byte 46
+.byte 116
+.byte 101
+.byte 120
+.byte 116
+.byte 0
+@S47:
+.byte 10
+.byte 0
+@S48:
+.byte 106
+.byte 109
+.byte 112
+.byte 116
+.byte 97
+.byte 98
+.byte 0
+@S49:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S50:
+.byte 10
+.byte 0
+@S51:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S52:
+.byte 10
+.byte 0
+@S53:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S54:
+.byte 10
+.byte 0
+@S55:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 48
+.byte 0
+@S56:
+.byte 10
+.byte 0
+@S57:
+.byte 46
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S58:
+.byte 10
+.byte 0
+@S59:
+.byte 46
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S60:
+.byte 10
+.byte 0
+@S61:
+.byte 46
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S62:
+.byte 10
+.byte 0
+@S63:
+.byte 46
+.byte 116
+.byte 101
+.byte 120
+.byte 116
+.byte 0
+@S64:
+.byte 10
+.byte 0
+@S65:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S66:
+.byte 10
+.byte 0
+@S67:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S68:
+.byte 10
+.byte 0
+@S69:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 48
+.byte 0
+@S70:
+.byte 10
+.byte 0
+@S71:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S72:
+.byte 10
+.byte 0
+@S73:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S74:
+.byte 10
+.byte 0
+@S75:
+.byte 46
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S76:
+.byte 10
+.byte 0
+@S77:
+.byte 46
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S78:
+.byte 10
+.byte 0
+@S79:
+.byte 46
+.byte 116
+.byte 101
+.byte 120
+.byte 116
+.byte 0
+@S80:
+.byte 10
+.byte 0
+@S81:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S82:
+.byte 10
+.byte 0
+@S83:
+.byte 106
+.byte 109
+.byte 112
+.byte 102
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S84:
+.byte 10
+.byte 0
+@S85:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S86:
+.byte 10
+.byte 0
+@S87:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S88:
+.byte 10
+.byte 0
+@S89:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S90:
+.byte 10
+.byte 0
+@S91:
+.byte 115
+.byte 116
+.byte 98
+.byte 59
+.byte 0
+@S92:
+.byte 10
+.byte 0
+@S93:
+.byte 115
+.byte 116
+.byte 119
+.byte 59
+.byte 0
+@S94:
+.byte 10
+.byte 0
+@S95:
+.byte 115
+.byte 116
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S96:
+.byte 10
+.byte 0
+@S97:
+.byte 115
+.byte 116
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S98:
+.byte 10
+.byte 0
+@S99:
+.byte 115
+.byte 119
+.byte 97
+.byte 112
+.byte 50
+.byte 59
+.byte 0
+@S100:
+.byte 10
+.byte 0
+@S101:
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S102:
+.byte 10
+.byte 0
+@S103:
+.byte 108
+.byte 100
+.byte 120
+.byte 98
+.byte 0
+@S104:
+.byte 108
+.byte 100
+.byte 120
+.byte 117
+.byte 98
+.byte 0
+@S105:
+.byte 108
+.byte 100
+.byte 120
+.byte 100
+.byte 119
+.byte 0
+@S106:
+.byte 108
+.byte 100
+.byte 120
+.byte 113
+.byte 119
+.byte 0
+@S107:
+.byte 46
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S108:
+.byte 10
+.byte 0
+@S109:
+.byte 46
+.byte 122
+.byte 101
+.byte 114
+.byte 111
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S110:
+.byte 10
+.byte 0
+@S111:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S112:
+.byte 10
+.byte 0
+@S113:
+.byte 46
+.byte 122
+.byte 101
+.byte 114
+.byte 111
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S114:
+.byte 10
+.byte 0
+@S115:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S116:
+.byte 10
+.byte 0
+@S117:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S118:
+.byte 10
+.byte 0
+@S119:
+.byte 46
+.byte 122
+.byte 101
+.byte 114
+.byte 111
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S120:
+.byte 10
+.byte 0
+@S121:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S122:
+.byte 10
+.byte 0
+@S123:
+.byte 46
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 0
+@S124:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 50
+.byte 0
+@S125:
+.byte 10
+.byte 0
+@S126:
+.byte 46
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 0
+@S127:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 52
+.byte 0
+@S128:
+.byte 10
+.byte 0
+@S129:
+.byte 46
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 0
+@S130:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 56
+.byte 0
+@S131:
+.byte 10
+.byte 0
+@S132:
+.byte 46
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 0
+@S133:
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 0
+@S134:
+.byte 10
+.byte 0
+@S135:
+.byte 37
+.byte 100
+.byte 0
+@S136:
+.byte 10
+.byte 0
+@S137:
+.byte 111
+.byte 114
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S138:
+.byte 10
+.byte 0
+@S139:
+.byte 108
+.byte 100
+.byte 110
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S140:
+.byte 10
+.byte 0
+@S141:
+.byte 106
+.byte 109
+.byte 112
+.byte 102
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S142:
+.byte 10
+.byte 0
+@S143:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S144:
+.byte 10
+.byte 0
+@S145:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S146:
+.byte 10
+.byte 0
+@S147:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S148:
+.byte 10
+.byte 0
+@S149:
+.byte 46
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S150:
+.byte 10
+.byte 0
+@S151:
+.byte 46
+.byte 98
+.byte 115
+.byte 115
+.byte 0
+@S152:
+.byte 10
+.byte 0
+@S153:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S154:
+.byte 10
+.byte 0
+@S155:
+.byte 64
+.byte 37
+.byte 115
+.byte 95
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S156:
+.byte 10
+.byte 0
+@S157:
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S158:
+.byte 10
+.byte 0
+@S159:
+.byte 46
+.byte 114
+.byte 101
+.byte 115
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S160:
+.byte 10
+.byte 0
+@S161:
+.byte 46
+.byte 103
+.byte 108
+.byte 111
+.byte 98
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S162:
+.byte 10
+.byte 0
+@S163:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S164:
+.byte 10
+.byte 0
+@S165:
+.byte 46
+.byte 116
+.byte 101
+.byte 120
+.byte 116
+.byte 0
+@S166:
+.byte 10
+.byte 0
+@S167:
+.byte 35
+.byte 32
+.byte 118
+.byte 97
+.byte 114
+.byte 58
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 111
+.byte 102
+.byte 102
+.byte 115
+.byte 101
+.byte 116
+.byte 58
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S168:
+.byte 10
+.byte 0
+@S169:
+.byte 46
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S170:
+.byte 10
+.byte 0
+@S171:
+.byte 46
+.byte 98
+.byte 115
+.byte 115
+.byte 0
+@S172:
+.byte 10
+.byte 0
+@S173:
+.byte 46
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 56
+.byte 0
+@S174:
+.byte 10
+.byte 0
+@S175:
+.byte 95
+.byte 95
+.byte 116
+.byte 101
+.byte 109
+.byte 112
+.byte 95
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 58
+.byte 0
+@S176:
+.byte 10
+.byte 0
+@S177:
+.byte 46
+.byte 114
+.byte 101
+.byte 115
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S178:
+.byte 10
+.byte 0
+@S179:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S180:
+.byte 10
+.byte 0
+@S181:
+.byte 100
+.byte 119
+.byte 50
+.byte 98
+.byte 59
+.byte 0
+@S182:
+.byte 10
+.byte 0
+@S183:
+.byte 100
+.byte 119
+.byte 50
+.byte 98
+.byte 59
+.byte 0
+@S184:
+.byte 10
+.byte 0
+@S185:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S186:
+.byte 10
+.byte 0
+@S187:
+.byte 100
+.byte 119
+.byte 50
+.byte 117
+.byte 98
+.byte 59
+.byte 0
+@S188:
+.byte 10
+.byte 0
+@S189:
+.byte 100
+.byte 119
+.byte 50
+.byte 117
+.byte 98
+.byte 59
+.byte 0
+@S190:
+.byte 10
+.byte 0
+@S191:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S192:
+.byte 10
+.byte 0
+@S193:
+.byte 100
+.byte 119
+.byte 50
+.byte 119
+.byte 59
+.byte 0
+@S194:
+.byte 10
+.byte 0
+@S195:
+.byte 100
+.byte 119
+.byte 50
+.byte 119
+.byte 59
+.byte 0
+@S196:
+.byte 10
+.byte 0
+@S197:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S198:
+.byte 10
+.byte 0
+@S199:
+.byte 100
+.byte 119
+.byte 50
+.byte 117
+.byte 119
+.byte 59
+.byte 0
+@S200:
+.byte 10
+.byte 0
+@S201:
+.byte 100
+.byte 119
+.byte 50
+.byte 117
+.byte 119
+.byte 59
+.byte 0
+@S202:
+.byte 10
+.byte 0
+@S203:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S204:
+.byte 10
+.byte 0
+@S205:
+.byte 117
+.byte 100
+.byte 119
+.byte 50
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S206:
+.byte 10
+.byte 0
+@S207:
+.byte 100
+.byte 119
+.byte 50
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S208:
+.byte 10
+.byte 0
+@S209:
+.byte 106
+.byte 109
+.byte 112
+.byte 102
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S210:
+.byte 10
+.byte 0
+@S211:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S212:
+.byte 10
+.byte 0
+@S213:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S214:
+.byte 10
+.byte 0
+@S215:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S216:
+.byte 10
+.byte 0
+@S217:
+.byte 106
+.byte 109
+.byte 112
+.byte 116
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S218:
+.byte 10
+.byte 0
+@S219:
+.byte 106
+.byte 109
+.byte 112
+.byte 116
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S220:
+.byte 10
+.byte 0
+@S221:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 48
+.byte 59
+.byte 0
+@S222:
+.byte 10
+.byte 0
+@S223:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S224:
+.byte 10
+.byte 0
+@S225:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S226:
+.byte 10
+.byte 0
+@S227:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 49
+.byte 59
+.byte 0
+@S228:
+.byte 10
+.byte 0
+@S229:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S230:
+.byte 10
+.byte 0
+@S231:
+.byte 106
+.byte 109
+.byte 112
+.byte 102
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S232:
+.byte 10
+.byte 0
+@S233:
+.byte 106
+.byte 109
+.byte 112
+.byte 102
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S234:
+.byte 10
+.byte 0
+@S235:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 49
+.byte 59
+.byte 0
+@S236:
+.byte 10
+.byte 0
+@S237:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S238:
+.byte 10
+.byte 0
+@S239:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S240:
+.byte 10
+.byte 0
+@S241:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 48
+.byte 59
+.byte 0
+@S242:
+.byte 10
+.byte 0
+@S243:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S244:
+.byte 10
+.byte 0
+@S245:
+.byte 111
+.byte 114
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S246:
+.byte 10
+.byte 0
+@S247:
+.byte 111
+.byte 114
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S248:
+.byte 10
+.byte 0
+@S249:
+.byte 120
+.byte 111
+.byte 114
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S250:
+.byte 10
+.byte 0
+@S251:
+.byte 120
+.byte 111
+.byte 114
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S252:
+.byte 10
+.byte 0
+@S253:
+.byte 97
+.byte 110
+.byte 100
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S254:
+.byte 10
+.byte 0
+@S255:
+.byte 97
+.byte 110
+.byte 100
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S256:
+.byte 10
+.byte 0
+@S257:
+.byte 101
+.byte 113
+.byte 0
+@S258:
+.byte 110
+.byte 101
+.byte 113
+.byte 0
+@S259:
+.byte 37
+.byte 115
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S260:
+.byte 10
+.byte 0
+@S261:
+.byte 37
+.byte 115
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S262:
+.byte 10
+.byte 0
+@S263:
+.byte 37
+.byte 115
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S264:
+.byte 10
+.byte 0
+@S265:
+.byte 113
+.byte 119
+.byte 0
+@S266:
+.byte 113
+.byte 119
+.byte 0
+@S267:
+.byte 100
+.byte 119
+.byte 0
+@S268:
+.byte 117
+.byte 0
+@S269:
+.byte 115
+.byte 0
+@S270:
+.byte 117
+.byte 0
+@S271:
+.byte 37
+.byte 115
+.byte 108
+.byte 116
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S272:
+.byte 10
+.byte 0
+@S273:
+.byte 37
+.byte 115
+.byte 103
+.byte 116
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S274:
+.byte 10
+.byte 0
+@S275:
+.byte 37
+.byte 115
+.byte 108
+.byte 101
+.byte 116
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S276:
+.byte 10
+.byte 0
+@S277:
+.byte 37
+.byte 115
+.byte 103
+.byte 101
+.byte 116
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S278:
+.byte 10
+.byte 0
+@S279:
+.byte 115
+.byte 108
+.byte 108
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S280:
+.byte 10
+.byte 0
+@S281:
+.byte 115
+.byte 108
+.byte 108
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S282:
+.byte 10
+.byte 0
+@S283:
+.byte 108
+.byte 0
+@S284:
+.byte 97
+.byte 0
+@S285:
+.byte 115
+.byte 114
+.byte 37
+.byte 115
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S286:
+.byte 10
+.byte 0
+@S287:
+.byte 115
+.byte 114
+.byte 37
+.byte 115
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S288:
+.byte 10
+.byte 0
+@S289:
+.byte 97
+.byte 100
+.byte 100
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S290:
+.byte 10
+.byte 0
+@S291:
+.byte 97
+.byte 100
+.byte 100
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S292:
+.byte 10
+.byte 0
+@S293:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S294:
+.byte 10
+.byte 0
+@S295:
+.byte 109
+.byte 117
+.byte 108
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S296:
+.byte 10
+.byte 0
+@S297:
+.byte 97
+.byte 100
+.byte 100
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S298:
+.byte 10
+.byte 0
+@S299:
+.byte 115
+.byte 117
+.byte 98
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S300:
+.byte 10
+.byte 0
+@S301:
+.byte 115
+.byte 117
+.byte 98
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S302:
+.byte 10
+.byte 0
+@S303:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S304:
+.byte 10
+.byte 0
+@S305:
+.byte 109
+.byte 117
+.byte 108
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S306:
+.byte 10
+.byte 0
+@S307:
+.byte 115
+.byte 117
+.byte 98
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S308:
+.byte 10
+.byte 0
+@S309:
+.byte 115
+.byte 117
+.byte 98
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S310:
+.byte 10
+.byte 0
+@S311:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S312:
+.byte 10
+.byte 0
+@S313:
+.byte 115
+.byte 100
+.byte 105
+.byte 118
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S314:
+.byte 10
+.byte 0
+@S315:
+.byte 109
+.byte 117
+.byte 108
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S316:
+.byte 10
+.byte 0
+@S317:
+.byte 109
+.byte 117
+.byte 108
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S318:
+.byte 10
+.byte 0
+@S319:
+.byte 117
+.byte 0
+@S320:
+.byte 115
+.byte 0
+@S321:
+.byte 100
+.byte 105
+.byte 118
+.byte 0
+@S322:
+.byte 109
+.byte 111
+.byte 100
+.byte 0
+@S323:
+.byte 37
+.byte 115
+.byte 37
+.byte 115
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S324:
+.byte 10
+.byte 0
+@S325:
+.byte 37
+.byte 115
+.byte 37
+.byte 115
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S326:
+.byte 10
+.byte 0
+@S327:
+.byte 100
+.byte 117
+.byte 112
+.byte 50
+.byte 59
+.byte 0
+@S328:
+.byte 10
+.byte 0
+@S329:
+.byte 100
+.byte 117
+.byte 112
+.byte 50
+.byte 59
+.byte 0
+@S330:
+.byte 10
+.byte 0
+@S331:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 49
+.byte 59
+.byte 0
+@S332:
+.byte 10
+.byte 0
+@S333:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 49
+.byte 59
+.byte 0
+@S334:
+.byte 10
+.byte 0
+@S335:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S336:
+.byte 10
+.byte 0
+@S337:
+.byte 97
+.byte 100
+.byte 100
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S338:
+.byte 10
+.byte 0
+@S339:
+.byte 115
+.byte 117
+.byte 98
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S340:
+.byte 10
+.byte 0
+@S341:
+.byte 115
+.byte 119
+.byte 97
+.byte 112
+.byte 50
+.byte 59
+.byte 0
+@S342:
+.byte 10
+.byte 0
+@S343:
+.byte 97
+.byte 100
+.byte 100
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S344:
+.byte 10
+.byte 0
+@S345:
+.byte 115
+.byte 117
+.byte 98
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S346:
+.byte 10
+.byte 0
+@S347:
+.byte 100
+.byte 117
+.byte 112
+.byte 59
+.byte 0
+@S348:
+.byte 10
+.byte 0
+@S349:
+.byte 115
+.byte 119
+.byte 97
+.byte 112
+.byte 50
+.byte 59
+.byte 0
+@S350:
+.byte 10
+.byte 0
+@S351:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S352:
+.byte 10
+.byte 0
+@S353:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S354:
+.byte 10
+.byte 0
+@S355:
+.byte 100
+.byte 117
+.byte 112
+.byte 50
+.byte 59
+.byte 0
+@S356:
+.byte 10
+.byte 0
+@S357:
+.byte 100
+.byte 119
+.byte 50
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S358:
+.byte 10
+.byte 0
+@S359:
+.byte 115
+.byte 119
+.byte 97
+.byte 112
+.byte 50
+.byte 59
+.byte 0
+@S360:
+.byte 10
+.byte 0
+@S361:
+.byte 100
+.byte 117
+.byte 112
+.byte 50
+.byte 59
+.byte 0
+@S362:
+.byte 10
+.byte 0
+@S363:
+.byte 100
+.byte 119
+.byte 0
+@S364:
+.byte 117
+.byte 100
+.byte 119
+.byte 0
+@S365:
+.byte 37
+.byte 115
+.byte 50
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S366:
+.byte 10
+.byte 0
+@S367:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 49
+.byte 59
+.byte 0
+@S368:
+.byte 10
+.byte 0
+@S369:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S370:
+.byte 10
+.byte 0
+@S371:
+.byte 97
+.byte 100
+.byte 100
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S372:
+.byte 10
+.byte 0
+@S373:
+.byte 115
+.byte 117
+.byte 98
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S374:
+.byte 10
+.byte 0
+@S375:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S376:
+.byte 10
+.byte 0
+@S377:
+.byte 100
+.byte 117
+.byte 112
+.byte 59
+.byte 0
+@S378:
+.byte 10
+.byte 0
+@S379:
+.byte 115
+.byte 119
+.byte 97
+.byte 112
+.byte 50
+.byte 59
+.byte 0
+@S380:
+.byte 10
+.byte 0
+@S381:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S382:
+.byte 10
+.byte 0
+@S383:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S384:
+.byte 10
+.byte 0
+@S385:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S386:
+.byte 10
+.byte 0
+@S387:
+.byte 113
+.byte 119
+.byte 0
+@S388:
+.byte 100
+.byte 119
+.byte 0
+@S389:
+.byte 110
+.byte 101
+.byte 103
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S390:
+.byte 10
+.byte 0
+@S391:
+.byte 99
+.byte 109
+.byte 112
+.byte 108
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S392:
+.byte 10
+.byte 0
+@S393:
+.byte 110
+.byte 111
+.byte 116
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S394:
+.byte 10
+.byte 0
+@S395:
+.byte 110
+.byte 111
+.byte 116
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S396:
+.byte 10
+.byte 0
+@S397:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S398:
+.byte 10
+.byte 0
+@S399:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S400:
+.byte 10
+.byte 0
+@S401:
+.byte 109
+.byte 117
+.byte 108
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S402:
+.byte 10
+.byte 0
+@S403:
+.byte 97
+.byte 100
+.byte 100
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S404:
+.byte 10
+.byte 0
+@S405:
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S406:
+.byte 10
+.byte 0
+@S407:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S408:
+.byte 10
+.byte 0
+@S409:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S410:
+.byte 10
+.byte 0
+@S411:
+.byte 97
+.byte 100
+.byte 100
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S412:
+.byte 10
+.byte 0
+@S413:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 59
+.byte 0
+@S414:
+.byte 10
+.byte 0
+@S415:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S416:
+.byte 10
+.byte 0
+@S417:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S418:
+.byte 10
+.byte 0
+@S419:
+.byte 108
+.byte 100
+.byte 98
+.byte 112
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S420:
+.byte 10
+.byte 0
+@S421:
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S422:
+.byte 10
+.byte 0
+@S423:
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S424:
+.byte 10
+.byte 0
+@S425:
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S426:
+.byte 10
+.byte 0
+@S427:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S428:
+.byte 10
+.byte 0
+@S429:
+.byte 97
+.byte 100
+.byte 100
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S430:
+.byte 10
+.byte 0
+@S431:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 48
+.byte 59
+.byte 0
+@S432:
+.byte 10
+.byte 0
+@S433:
+.byte 102
+.byte 105
+.byte 108
+.byte 108
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S434:
+.byte 10
+.byte 0
+@S435:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S436:
+.byte 10
+.byte 0
+@S437:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S438:
+.byte 10
+.byte 0
+@S439:
+.byte 108
+.byte 100
+.byte 98
+.byte 112
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S440:
+.byte 10
+.byte 0
+@S441:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 48
+.byte 59
+.byte 0
+@S442:
+.byte 10
+.byte 0
+@S443:
+.byte 102
+.byte 105
+.byte 108
+.byte 108
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S444:
+.byte 10
+.byte 0
+@S445:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S446:
+.byte 10
+.byte 0
+@S447:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S448:
+.byte 10
+.byte 0
+@S449:
+.byte 108
+.byte 100
+.byte 98
+.byte 112
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S450:
+.byte 10
+.byte 0
+@S451:
+.byte 108
+.byte 100
+.byte 105
+.byte 100
+.byte 119
+.byte 32
+.byte 48
+.byte 59
+.byte 0
+@S452:
+.byte 10
+.byte 0
+@S453:
+.byte 102
+.byte 105
+.byte 108
+.byte 108
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S454:
+.byte 10
+.byte 0
+@S455:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S456:
+.byte 10
+.byte 0
+@S457:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S458:
+.byte 10
+.byte 0
+@S459:
+.byte 108
+.byte 100
+.byte 98
+.byte 112
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S460:
+.byte 10
+.byte 0
+@S461:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S462:
+.byte 10
+.byte 0
+@S463:
+.byte 112
+.byte 111
+.byte 112
+.byte 59
+.byte 0
+@S464:
+.byte 10
+.byte 0
+@S465:
+.byte 64
+.byte 64
+.byte 37
+.byte 115
+.byte 95
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S466:
+.byte 10
+.byte 0
+@S467:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S468:
+.byte 10
+.byte 0
+@S469:
+.byte 100
+.byte 111
+.byte 95
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 95
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 0
+@S470:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 118
+.byte 109
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 118
+.byte 109
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S471:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S472:
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 43
+.byte 0
+@S473:
+.byte 64
+.byte 37
+.byte 115
+.byte 95
+.byte 37
+.byte 115
+.byte 43
+.byte 0
+@S474:
+.byte 37
+.byte 115
+.byte 43
+.byte 0
+@S475:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 95
+.byte 95
+.byte 116
+.byte 101
+.byte 109
+.byte 112
+.byte 95
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 59
+.byte 0
+@S476:
+.byte 10
+.byte 0
+@S477:
+.byte 115
+.byte 119
+.byte 97
+.byte 112
+.byte 50
+.byte 59
+.byte 0
+@S478:
+.byte 10
+.byte 0
+@S479:
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S480:
+.byte 10
+.byte 0
+@S481:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 48
+.byte 59
+.byte 0
+@S482:
+.byte 10
+.byte 0
+@S483:
+.byte 114
+.byte 101
+.byte 116
+.byte 59
+.byte 0
+@S484:
+.byte 10
+.byte 0
+@S485:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 64
+.byte 37
+.byte 115
+.byte 95
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S486:
+.byte 10
+.byte 0
+@S487:
+.byte 108
+.byte 100
+.byte 105
+.byte 113
+.byte 119
+.byte 32
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S488:
+.byte 10
+.byte 0
+@S489:
+.byte 108
+.byte 100
+.byte 98
+.byte 112
+.byte 32
+.byte 37
+.byte 100
+.byte 59
+.byte 0
+@S490:
+.byte 10
+.byte 0
+@S491:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S492:
+.byte 10
+.byte 0
+@S493:
+.byte 106
+.byte 109
+.byte 112
+.byte 102
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S494:
+.byte 10
+.byte 0
+@S495:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S496:
+.byte 10
+.byte 0
+@S497:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S498:
+.byte 10
+.byte 0
+@S499:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S500:
+.byte 10
+.byte 0
+@S501:
+.byte 37
+.byte 115
+.byte 0
+@S502:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 64
+.byte 37
+.byte 115
+.byte 95
+.byte 37
+.byte 115
+.byte 59
+.byte 0
+@S503:
+.byte 10
+.byte 0
+@S504:
+.byte 46
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S505:
+.byte 10
+.byte 0
+@S506:
+.byte 64
+.byte 83
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S507:
+.byte 10
+.byte 0
+@S508:
+.byte 46
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S509:
+.byte 10
+.byte 0
+@S510:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S511:
+.byte 10
+.byte 0
+@S512:
+.byte 108
+.byte 100
+.byte 113
+.byte 119
+.byte 59
+.byte 0
+@S513:
+.byte 10
+.byte 0
+@S514:
+.byte 108
+.byte 100
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S515:
+.byte 10
+.byte 0
+@S516:
+.byte 108
+.byte 100
+.byte 119
+.byte 59
+.byte 0
+@S517:
+.byte 10
+.byte 0
+@S518:
+.byte 108
+.byte 100
+.byte 117
+.byte 119
+.byte 59
+.byte 0
+@S519:
+.byte 10
+.byte 0
+@S520:
+.byte 108
+.byte 100
+.byte 98
+.byte 59
+.byte 0
+@S521:
+.byte 10
+.byte 0
+@S522:
+.byte 108
+.byte 100
+.byte 117
+.byte 98
+.byte 59
+.byte 0
+@S523:
+.byte 10
+.byte 0
+@S524:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S525:
+.byte 10
+.byte 0
+@S526:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S527:
+.byte 10
+.byte 0
+@S528:
+.byte 106
+.byte 109
+.byte 112
+.byte 102
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S529:
+.byte 10
+.byte 0
+@S530:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 59
+.byte 0
+@S531:
+.byte 10
+.byte 0
+@S532:
+.byte 64
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S533:
+.byte 10
+.byte 0
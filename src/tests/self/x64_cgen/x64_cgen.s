@@ -0,0 +1,29345 @@
+.extern fgets
+.extern get_promoted_type
+.extern analyze_bitwise_operator
+# ==== start of definition of function `x64_load_addr' ====
+.text
+x64_load_addr:
+addsp 12;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+# var: e, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L1;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L2;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S0;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 40;
+pop;
+pop;
+ldiqw @S1;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L3;
+@L2:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S2;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S3;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L3:
+jmp @L4;
+@L1:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S4;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S5;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L4:
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_allocate_static_objects' ====
+.text
+x64_allocate_static_objects:
+addsp 52;        
+# var: np, offset: 8
+ldiqw static_objects_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L5:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L7;
+# var: al, offset: 16
+# var: ty, offset: 24
+# var: initzr, offset: 40
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L8;
+@L9:
+ldiqw curr_segment;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L12;
+ldiqw str_segment;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw @S6;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S7;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw curr_segment;
+stdw;
+pop;
+@L12:
+@L10:
+ldidw 0;
+jmpf @L11;
+jmp @L9;
+@L11:
+ldbp 16;
+lddw;
+ldidw 1;
+ugtdw;
+jmpf @L13;
+ldbp 16;
+lddw;
+ldiqw @S8;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S9;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L13:
+jmp @L14;
+@L8:
+@L15:
+ldiqw curr_segment;
+lddw;
+ldidw 2;
+neqdw;
+jmpf @L18;
+ldiqw str_segment;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw @S10;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S11;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 2;
+ldiqw curr_segment;
+stdw;
+pop;
+@L18:
+@L16:
+ldidw 0;
+jmpf @L17;
+jmp @L15;
+@L17:
+ldbp 16;
+lddw;
+ldidw 1;
+ugtdw;
+jmpf @L19;
+ldbp 16;
+lddw;
+ldiqw @S12;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S13;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L19:
+@L14:
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw enclosing_function;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L20;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw @S14;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S15;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L21;
+@L20:
+# var: scs, offset: 48
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 48;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L22;
+ldbp 48;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L22;
+ldidw 0;
+jmp @L23;
+@L22:
+ldidw 1;
+@L23:
+jmpf @L24;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S16;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S17;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L24:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S18;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S19;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L21:
+ldbp 40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L25;
+ldbp 40;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw x64_static_init;
+call 24;
+pop;
+pop;
+jmp @L26;
+@L25:
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S20;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S21;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L26:
+@L6:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L5;
+@L7:
+ldidw 0;
+ret;
+.extern verbose_asm
+.extern bset_iterate
+.extern edge_iterate
+.data
+.align 8
+x64_lbreg_str:
+.align 8
+.qword @S22+0
+.align 8
+.qword @S23+0
+.align 8
+.qword @S24+0
+.align 8
+.qword @S25+0
+.align 8
+.qword @S26+0
+.align 8
+.qword @S27+0
+.align 8
+.qword @S28+0
+.align 8
+.qword @S29+0
+.align 8
+.qword @S30+0
+.align 8
+.qword @S31+0
+.align 8
+.qword @S32+0
+.align 8
+.qword @S33+0
+.align 8
+.qword @S34+0
+.align 8
+.qword @S35+0
+# ==== start of definition of function `x64_shl' ====
+.text
+x64_shl:
+addsp 20;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: res, offset: 8
+# var: islong, offset: 12
+# var: reg_str, offset: 16
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw x64_islong;
+call 4;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L27;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 12;
+lddw;
+jmpf @L28;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+jmp @L29;
+@L28:
+ldiqw x64_ldreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+@L29:
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 16;
+ldqw;
+ldiqw @S36;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S37;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L30;
+@L27:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 2;
+neqdw;
+jmpf @L31;
+ldidw 2;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 2;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+@L31:
+ldidw 1;
+ldiqw pinned;
+ldidw 2;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 12;
+lddw;
+jmpf @L32;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+jmp @L33;
+@L32:
+ldiqw x64_ldreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+@L33:
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw @S38;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S39;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldidw 2;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L30:
+@L34:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L35:
+ldidw 0;
+jmpf @L36;
+jmp @L34;
+@L36:
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_shr' ====
+.text
+x64_shr:
+addsp 28;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: instr, offset: 8
+# var: res, offset: 16
+# var: islong, offset: 20
+# var: reg_str, offset: 24
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw x64_islong;
+call 4;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L37;
+ldiqw @S40;
+jmp @L38;
+@L37:
+ldiqw @S41;
+@L38:
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L39;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 20;
+lddw;
+jmpf @L40;
+ldiqw x64_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+jmp @L41;
+@L40:
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+@L41:
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S42;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S43;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L42;
+@L39:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 2;
+neqdw;
+jmpf @L43;
+ldidw 2;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 2;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+@L43:
+ldidw 1;
+ldiqw pinned;
+ldidw 2;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 20;
+lddw;
+jmpf @L44;
+ldiqw x64_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+jmp @L45;
+@L44:
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+@L45:
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S44;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S45;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldidw 2;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L42:
+@L46:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L47:
+ldidw 0;
+jmpf @L48;
+jmp @L46;
+@L48:
+ldidw 0;
+ret;
+.extern static_objects_list
+# ==== start of definition of function `x64_cgen_str' ====
+.text
+x64_cgen_str:
+.global x64_cgen_str
+addsp 0;         
+# param:`outs', offset:-24
+ldbp -24;
+ldqw;
+ldiqw x64_output_str;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw x64_cgen;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern is_complete
+.extern ic_addresses
+.extern cfg_outpath
+.bss
+.align 4
+size_of_local_area:
+.res 4
+.extern analyze_unary_expression
+.extern string_write
+.extern target_arch
+.extern emit_warning
+.data
+.align 8
+x64_lwreg_str:
+.align 8
+.qword @S46+0
+.align 8
+.qword @S47+0
+.align 8
+.qword @S48+0
+.align 8
+.qword @S49+0
+.align 8
+.qword @S50+0
+.align 8
+.qword @S51+0
+.align 8
+.qword @S52+0
+.align 8
+.qword @S53+0
+.align 8
+.qword @S54+0
+.align 8
+.qword @S55+0
+.align 8
+.qword @S56+0
+.align 8
+.qword @S57+0
+.align 8
+.qword @S58+0
+.align 8
+.qword @S59+0
+# ==== start of definition of function `x64_store_home' ====
+.text
+x64_store_home:
+addsp 0;         
+# param:`r', offset:-20
+# param:`h', offset:-24
+# param:`cat', offset:-28
+ldbp -28;
+lddw;
+ldiqw @T49;
+switch;
+@L51:
+@L52:
+ldiqw x64_ldreg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp -24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S60;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S61;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L50;
+@L53:
+ldiqw x64_ldreg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_ldreg_str;
+ldbp -24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S62;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S63;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L50;
+@L54:
+ldiqw x64_lwreg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp -24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S64;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S65;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L50;
+@L55:
+ldiqw x64_lwreg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_ldreg_str;
+ldbp -24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S66;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S67;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L50;
+@L56:
+@L57:
+ldiqw x64_lbreg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp -24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S68;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S69;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L50;
+@L58:
+ldiqw x64_lbreg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_ldreg_str;
+ldbp -24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S70;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S71;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L50;
+@L59:
+ldbp -20;
+lddw;
+ldbp -24;
+lddw;
+neqdw;
+jmpf @L60;
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp -24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S72;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S73;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L60:
+jmp @L50;
+@L50:
+.data
+.align 8
+@T49:
+.dword 9
+.dword 49
+.dword 55
+.dword 60
+.dword 64
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.qword @L59
+.qword @L56
+.qword @L52
+.qword @L51
+.qword @L54
+.qword @L53
+.qword @L57
+.qword @L58
+.qword @L55
+.text
+ldidw 0;
+ret;
+.extern arena_destroy
+.extern liveness_and_next_use
+.extern is_struct_union_enum
+.extern get_sizeof
+.extern emit_error
+.extern get_curr_scope_id
+.extern getenv
+.extern can_assign_to
+.extern atoi
+.bss
+.align 8
+x64_output_str:
+.res 8
+.extern bset_member
+.extern exit
+.data
+.align 8
+x64_reg_str:
+.align 8
+.qword @S74+0
+.align 8
+.qword @S75+0
+.align 8
+.qword @S76+0
+.align 8
+.qword @S77+0
+.align 8
+.qword @S78+0
+.align 8
+.qword @S79+0
+.align 8
+.qword @S80+0
+.align 8
+.qword @S81+0
+.align 8
+.qword @S82+0
+.align 8
+.qword @S83+0
+.align 8
+.qword @S84+0
+.align 8
+.qword @S85+0
+.align 8
+.qword @S86+0
+.align 8
+.qword @S87+0
+.extern stderr
+# ==== start of definition of function `x64_sub' ====
+.text
+x64_sub:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw x64_islong;
+call 4;
+pop;
+jmpf @L61;
+ldbp -32;
+lddw;
+ldiqw x64_get_operand64;
+call 4;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S88;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S89;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L62;
+@L61:
+ldbp -32;
+lddw;
+ldiqw x64_get_operand32;
+call 4;
+ldiqw x64_ldreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S90;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S91;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L62:
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L63:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L64:
+ldidw 0;
+jmpf @L65;
+jmp @L63;
+@L65:
+ldidw 0;
+ret;
+.extern opt_level
+.extern restore_scope
+.extern nid2lnid
+.bss
+.align 4
+reg_args:
+.res 120
+.extern string_get_pos
+.bss
+.align 8
+temp_list:
+.res 8
+.extern rewind
+.extern get_type_node
+.extern analyze_logical_operator
+.extern realloc
+.extern lookup_ordinary_id
+.extern snprintf
+.extern strpbrk
+.extern pop_struct_descriptor
+# ==== start of definition of function `x64_get' ====
+.text
+x64_get:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+# var: res, offset: 16
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L68;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L70;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L70;
+ldidw 0;
+jmp @L71;
+@L70:
+ldidw 1;
+@L71:
+jmpt @L68;
+ldidw 0;
+jmp @L69;
+@L68:
+ldidw 1;
+@L69:
+jmpt @L66;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L66;
+ldidw 0;
+jmp @L67;
+@L66:
+ldidw 1;
+@L67:
+jmpf @L72;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+jmp @L73;
+@L72:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+stdw;
+pop;
+@L73:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L74;
+ldbp -32;
+lddw;
+ldiqw x64_get_operand64;
+call 4;
+ldiqw x64_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S92;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S93;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L75;
+@L74:
+ldbp -32;
+lddw;
+ldiqw x64_get_operand32;
+call 4;
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S94;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S95;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L75:
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L76;
+ldiqw x64_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L77;
+ldiqw @S96;
+jmp @L78;
+@L77:
+ldiqw @S97;
+@L78:
+ldiqw @S98;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S99;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x64_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S100;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S101;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L79:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L80:
+ldidw 0;
+jmpf @L81;
+jmp @L79;
+@L81:
+jmp @L82;
+@L76:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L82:
+ldidw 0;
+ret;
+.extern nid2sid_tab
+# ==== start of definition of function `dump_reg_descr_tab' ====
+.text
+dump_reg_descr_tab:
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L83:
+ldbp 4;
+lddw;
+ldidw 14;
+sltdw;
+jmpf @L85;
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L86;
+ldiqw nid2sid_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S102;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 32;
+pop;
+pop;
+@L86:
+@L84:
+incldw 4;
+jmp @L83;
+@L85:
+ldidw 0;
+ret;
+.extern fseek
+# ==== start of definition of function `x64_ch' ====
+.text
+x64_ch:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw x64_lbreg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S103;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S104;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L87:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L88:
+ldidw 0;
+jmpf @L89;
+jmp @L87;
+@L89:
+ldidw 0;
+ret;
+.extern push_struct_descriptor
+.extern string_set_pos
+.extern ra_intervals
+# ==== start of definition of function `x64_cbr' ====
+.text
+x64_cbr:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldidw 0;
+ldbp -28;
+lddw;
+ldiqw x64_compare_against_constant;
+call 8;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L90;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S105;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S106;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L91;
+@L90:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S107;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S108;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L91:
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_eq' ====
+.text
+x64_eq:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+# var: res, offset: 16
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L94;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L96;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L96;
+ldidw 0;
+jmp @L97;
+@L96:
+ldidw 1;
+@L97:
+jmpt @L94;
+ldidw 0;
+jmp @L95;
+@L94:
+ldidw 1;
+@L95:
+jmpt @L92;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L92;
+ldidw 0;
+jmp @L93;
+@L92:
+ldidw 1;
+@L93:
+jmpf @L98;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+jmp @L99;
+@L98:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+stdw;
+pop;
+@L99:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L100;
+ldbp -32;
+lddw;
+ldiqw x64_get_operand64;
+call 4;
+ldiqw x64_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S109;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S110;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L101;
+@L100:
+ldbp -32;
+lddw;
+ldiqw x64_get_operand32;
+call 4;
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S111;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S112;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L101:
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L102;
+ldiqw x64_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S113;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S114;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x64_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S115;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S116;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L103:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L104:
+ldidw 0;
+jmpf @L105;
+jmp @L103;
+@L105:
+jmp @L106;
+@L102:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L106:
+ldidw 0;
+ret;
+.bss
+.align 8
+func_epilog:
+.res 8
+.extern sscanf
+.extern fputc
+# ==== start of definition of function `x64_gt' ====
+.text
+x64_gt:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+# var: res, offset: 16
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L109;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L111;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L111;
+ldidw 0;
+jmp @L112;
+@L111:
+ldidw 1;
+@L112:
+jmpt @L109;
+ldidw 0;
+jmp @L110;
+@L109:
+ldidw 1;
+@L110:
+jmpt @L107;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L107;
+ldidw 0;
+jmp @L108;
+@L107:
+ldidw 1;
+@L108:
+jmpf @L113;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+jmp @L114;
+@L113:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+stdw;
+pop;
+@L114:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L115;
+ldbp -32;
+lddw;
+ldiqw x64_get_operand64;
+call 4;
+ldiqw x64_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S117;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S118;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L116;
+@L115:
+ldbp -32;
+lddw;
+ldiqw x64_get_operand32;
+call 4;
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S119;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S120;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L116:
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L117;
+ldiqw x64_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L118;
+ldiqw @S121;
+jmp @L119;
+@L118:
+ldiqw @S122;
+@L119:
+ldiqw @S123;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S124;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x64_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S125;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S126;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L120:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L121:
+ldidw 0;
+jmpf @L122;
+jmp @L120;
+@L122:
+jmp @L123;
+@L117:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L123:
+ldidw 0;
+ret;
+# ==== start of definition of function `emit_raw_string' ====
+.text
+emit_raw_string:
+addsp 8;         
+# param:`q', offset:-24
+# param:`s', offset:-32
+# var: len, offset: 4
+# var: i, offset: 8
+ldbp -32;
+ldqw;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+udivdw;
+ldbp 8;
+stdw;
+pop;
+@L124:
+ldbp 8;
+lddw;
+jmpf @L126;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxb 1;
+ldbp -32;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxb 1;
+ldbp -32;
+ldqw;
+ldidw 2;
+dw2qw;
+ldxb 1;
+ldbp -32;
+ldqw;
+ldidw 3;
+dw2qw;
+ldxb 1;
+ldiqw @S127;
+ldbp -24;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldidw 4;
+dw2qw;
+addqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L125:
+decldw 8;
+jmp @L124;
+@L126:
+ldbp 4;
+lddw;
+ldidw 4;
+umoddw;
+ldbp 8;
+stdw;
+pop;
+@L127:
+ldbp 8;
+lddw;
+jmpf @L129;
+ldbp -32;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldb;
+ldiqw @S128;
+ldbp -24;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+@L128:
+decldw 8;
+jmp @L127;
+@L129:
+ldidw 0;
+ret;
+.extern vsscanf
+# ==== start of definition of function `x64_xor' ====
+.text
+x64_xor:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw x64_islong;
+call 4;
+pop;
+jmpf @L130;
+ldbp -32;
+lddw;
+ldiqw x64_get_operand64;
+call 4;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S129;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S130;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L131;
+@L130:
+ldbp -32;
+lddw;
+ldiqw x64_get_operand32;
+call 4;
+ldiqw x64_ldreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S131;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S132;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L131:
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L132:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L133:
+ldidw 0;
+jmpf @L134;
+jmp @L132;
+@L134:
+ldidw 0;
+ret;
+.extern dflow_enter_function
+# ==== start of definition of function `x64_pre_call' ====
+.text
+x64_pre_call:
+addsp 52;        
+# param:`i', offset:-20
+# param:`arg2', offset:-24
+# var: cat, offset: 4
+# var: k, offset: 8
+# var: src, offset: 12
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+@L135:
+ldbp 8;
+lddw;
+ldiqw nreg_args;
+lddw;
+sltdw;
+jmpf @L137;
+# var: a, offset: 36
+ldiqw reg_args;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 36;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L142;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L142;
+ldidw 0;
+jmp @L143;
+@L142:
+ldidw 1;
+@L143:
+notdw;
+jmpf @L140;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L140;
+ldidw 1;
+jmp @L141;
+@L140:
+ldidw 0;
+@L141:
+jmpf @L138;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+jmp @L139;
+@L138:
+ldidw 1;
+negdw;
+@L139:
+ldbp 12;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L136:
+incldw 8;
+jmp @L135;
+@L137:
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+@L144:
+ldbp 8;
+lddw;
+ldidw 14;
+sltdw;
+jmpf @L146;
+# var: a, offset: 36
+ldiqw reg_descr_tab;
+ldbp 8;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+jmpf @L147;
+jmp @L145;
+@L147:
+ldiqw reg_descr_tab;
+ldbp 8;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 36;
+stdw;
+pop;
+ldbp 36;
+lddw;
+ldiqw x64_dead_reg_arg;
+call 4;
+pop;
+jmpf @L148;
+ldidw 1;
+negdw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L149;
+@L148:
+ldbp 8;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L152;
+ldbp 8;
+lddw;
+ldidw 10;
+sltdw;
+jmpf @L152;
+ldidw 1;
+jmp @L153;
+@L152:
+ldidw 0;
+@L153:
+jmpt @L150;
+ldbp 36;
+lddw;
+ldiqw x64_must_spill_at_call;
+call 4;
+pop;
+jmpt @L150;
+ldidw 0;
+jmp @L151;
+@L150:
+ldidw 1;
+@L151:
+jmpf @L154;
+ldbp 8;
+lddw;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+@L154:
+@L149:
+@L145:
+incldw 8;
+jmp @L144;
+@L146:
+@L155:
+# var: j, offset: 36
+# var: m, offset: 40
+# var: ready, offset: 44
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldidw 1;
+negdw;
+ldbp 44;
+stdw;
+ldbp 40;
+stdw;
+pop;
+@L157:
+ldbp 8;
+lddw;
+ldiqw nreg_args;
+lddw;
+sltdw;
+jmpf @L159;
+ldbp 12;
+ldbp 8;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+sltdw;
+jmpf @L160;
+jmp @L158;
+@L160:
+ldbp 12;
+ldbp 8;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw reg_args;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpf @L161;
+ldidw 2;
+negdw;
+ldbp 12;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L158;
+@L161:
+ldbp 8;
+lddw;
+ldbp 40;
+stdw;
+pop;
+ldidw 0;
+ldbp 36;
+stdw;
+pop;
+@L162:
+ldbp 36;
+lddw;
+ldiqw nreg_args;
+lddw;
+sltdw;
+jmpf @L164;
+ldbp 36;
+lddw;
+ldbp 8;
+lddw;
+neqdw;
+jmpf @L165;
+ldbp 12;
+ldbp 36;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw reg_args;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpf @L165;
+ldidw 1;
+jmp @L166;
+@L165:
+ldidw 0;
+@L166:
+jmpf @L167;
+jmp @L164;
+@L167:
+@L163:
+incldw 36;
+jmp @L162;
+@L164:
+ldbp 36;
+lddw;
+ldiqw nreg_args;
+lddw;
+eqdw;
+jmpf @L168;
+ldbp 8;
+lddw;
+ldbp 44;
+stdw;
+pop;
+jmp @L159;
+@L168:
+@L158:
+incldw 8;
+jmp @L157;
+@L159:
+ldbp 44;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L169;
+ldiqw x64_reg_str;
+ldbp 12;
+ldbp 44;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldiqw reg_args;
+ldbp 44;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S133;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S134;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 2;
+negdw;
+ldbp 12;
+ldbp 44;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L170;
+@L169:
+ldbp 40;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L171;
+# var: d, offset: 48
+# var: s, offset: 52
+ldiqw reg_args;
+ldbp 40;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 48;
+stdw;
+pop;
+ldbp 12;
+ldbp 40;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 52;
+stdw;
+pop;
+ldiqw x64_reg_str;
+ldbp 52;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp 48;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S135;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S136;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 36;
+stdw;
+pop;
+@L172:
+ldbp 36;
+lddw;
+ldiqw nreg_args;
+lddw;
+sltdw;
+jmpf @L174;
+ldbp 12;
+ldbp 36;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 48;
+lddw;
+eqdw;
+jmpf @L175;
+ldbp 52;
+lddw;
+ldbp 12;
+ldbp 36;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L176;
+@L175:
+ldbp 12;
+ldbp 36;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 52;
+lddw;
+eqdw;
+jmpf @L177;
+ldbp 48;
+lddw;
+ldbp 12;
+ldbp 36;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L177:
+@L176:
+@L173:
+incldw 36;
+jmp @L172;
+@L174:
+ldidw 2;
+negdw;
+ldbp 12;
+ldbp 40;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L178;
+@L171:
+jmp @L156;
+@L178:
+@L170:
+jmp @L155;
+@L156:
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+@L179:
+ldbp 8;
+lddw;
+ldiqw nreg_args;
+lddw;
+sltdw;
+jmpf @L181;
+# var: p, offset: 40
+ldiqw reg_args;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 12;
+ldbp 8;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L182;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+jmp @L183;
+@L182:
+ldiqw ic_addresses;
+ldqw;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L184;
+ldbp 40;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L184;
+ldidw 1;
+jmp @L185;
+@L184:
+ldidw 0;
+@L185:
+jmpf @L186;
+ldiqw ic_addresses;
+ldqw;
+ldbp 40;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw x64_store_home;
+call 12;
+pop;
+pop;
+@L186:
+@L183:
+ldidw 1;
+ldiqw pinned;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 40;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L187;
+jmp @L180;
+@L187:
+ldbp 40;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L188;
+ldidw 1;
+ldiqw pinned;
+ldbp 40;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 40;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 8;
+subdw;
+ldidw 8;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 40;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw x64_load_eightbyte;
+call 16;
+pop;
+pop;
+ldidw 8;
+ldidw 0;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw x64_load_eightbyte;
+call 16;
+pop;
+pop;
+jmp @L189;
+@L188:
+ldbp 40;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 0;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 40;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw x64_load_eightbyte;
+call 16;
+pop;
+pop;
+@L189:
+@L180:
+incldw 8;
+jmp @L179;
+@L181:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L190;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L190;
+ldidw 0;
+jmp @L191;
+@L190:
+ldidw 1;
+@L191:
+jmpf @L192;
+# var: siz, offset: 36
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 36;
+stdw;
+pop;
+ldbp 36;
+lddw;
+ldiqw temp_struct_size;
+lddw;
+ugtdw;
+jmpf @L193;
+ldbp 36;
+lddw;
+ldiqw temp_struct_size;
+stdw;
+pop;
+@L193:
+ldbp 36;
+lddw;
+ldidw 16;
+ugtdw;
+jmpf @L194;
+ldiqw @S137;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldiqw calls_to_fix;
+ldiqw calls_to_fix_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw @S138;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S139;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldidw 5;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L194:
+@L192:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+ldidw 1;
+subdw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 39;
+eqdw;
+jmpf @L195;
+ldiqw @S140;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S141;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L195:
+ldiqw arg_nb;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `get_reg0' ====
+.text
+get_reg0:
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L196:
+ldbp 4;
+lddw;
+ldidw 14;
+sltdw;
+jmpf @L198;
+ldiqw pinned;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+notdw;
+jmpf @L199;
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+jmpf @L199;
+ldidw 1;
+jmp @L200;
+@L199:
+ldidw 0;
+@L200:
+jmpf @L201;
+ldidw 1;
+ldiqw modified;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+@L201:
+@L197:
+incldw 4;
+jmp @L196;
+@L198:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L202:
+ldbp 4;
+lddw;
+ldidw 14;
+sltdw;
+jmpf @L204;
+ldiqw pinned;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+notdw;
+jmpf @L205;
+ldidw 1;
+ldiqw modified;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+@L205:
+@L203:
+incldw 4;
+jmp @L202;
+@L204:
+@L206:
+ldidw 0;
+notdw;
+jmpf @L209;
+ldidw 342;
+ldiqw @S142;
+ldiqw @S143;
+ldiqw @S144;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L209:
+@L207:
+ldidw 0;
+jmpf @L208;
+jmp @L206;
+@L208:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern fwrite
+.extern is_pointer
+.extern colored_diagnostics
+# ==== start of definition of function `x64_lt' ====
+.text
+x64_lt:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+# var: res, offset: 16
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L212;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L214;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L214;
+ldidw 0;
+jmp @L215;
+@L214:
+ldidw 1;
+@L215:
+jmpt @L212;
+ldidw 0;
+jmp @L213;
+@L212:
+ldidw 1;
+@L213:
+jmpt @L210;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L210;
+ldidw 0;
+jmp @L211;
+@L210:
+ldidw 1;
+@L211:
+jmpf @L216;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+jmp @L217;
+@L216:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+stdw;
+pop;
+@L217:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L218;
+ldbp -32;
+lddw;
+ldiqw x64_get_operand64;
+call 4;
+ldiqw x64_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S145;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S146;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L219;
+@L218:
+ldbp -32;
+lddw;
+ldiqw x64_get_operand32;
+call 4;
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S147;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S148;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L219:
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L220;
+ldiqw x64_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L221;
+ldiqw @S149;
+jmp @L222;
+@L221:
+ldiqw @S150;
+@L222:
+ldiqw @S151;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S152;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x64_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S153;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S154;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L223:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L224:
+ldidw 0;
+jmpf @L225;
+jmp @L223;
+@L225:
+jmp @L226;
+@L220:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L226:
+ldidw 0;
+ret;
+.extern string_curr
+.extern read_stream
+.extern strspn
+.bss
+.align 4
+calls_to_fix_counter:
+.res 4
+# ==== start of definition of function `x64_write' ====
+.text
+x64_write:
+addsp 0;         
+# param:`s', offset:-24
+ldiqw x64_output_str;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L227;
+ldbp -24;
+ldqw;
+ldiqw x64_output_str;
+ldqw;
+ldiqw string_append;
+call 16;
+pop;
+pop;
+jmp @L228;
+@L227:
+ldiqw x64_output_file;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+@L228:
+ldidw 0;
+ret;
+.extern reset_enum_val
+.extern strtoll
+.extern analyze_relational_equality_expression
+.extern get_var_nid
+# ==== start of definition of function `dump_addr_descr_tab' ====
+.text
+dump_addr_descr_tab:
+addsp 8;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L229:
+ldbp 4;
+lddw;
+ldiqw nid_counter;
+lddw;
+sltdw;
+jmpf @L231;
+# var: ad, offset: 8
+ldiqw addr_descr_tab;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+stdw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L232;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw nid2sid_tab;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S155;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 32;
+pop;
+pop;
+@L232:
+@L230:
+incldw 4;
+jmp @L229;
+@L231:
+ldidw 0;
+ret;
+.extern get_sto_class_spec
+# ==== start of definition of function `x64_or' ====
+.text
+x64_or:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw x64_islong;
+call 4;
+pop;
+jmpf @L233;
+ldbp -32;
+lddw;
+ldiqw x64_get_operand64;
+call 4;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S156;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S157;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L234;
+@L233:
+ldbp -32;
+lddw;
+ldiqw x64_get_operand32;
+call 4;
+ldiqw x64_ldreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S158;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S159;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L234:
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L235:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L236:
+ldidw 0;
+jmpf @L237;
+jmp @L235;
+@L237:
+ldidw 0;
+ret;
+.extern bset_cpy
+.extern string_free
+.extern fclose
+.extern preprocess
+.extern analyze_decl_specs
+.extern strstr
+.extern calloc
+# ==== start of definition of function `x64_lab' ====
+.text
+x64_lab:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S160;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S161;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_load' ====
+.text
+x64_load:
+addsp 36;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+ldidw 0;
+ldiqw need_to_extend;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L238;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S162;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S163;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L239;
+@L238:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L240;
+ldbp -24;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S164;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S165;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L241;
+@L240:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L242;
+# var: e, offset: 8
+# var: siz_str, offset: 16
+# var: mov_str, offset: 24
+# var: reg_str, offset: 32
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L243;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp -20;
+lddw;
+eqdw;
+jmpf @L244;
+jmp @L245;
+@L244:
+ldiqw x64_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+ldqw;
+ldiqw @S166;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S167;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L245:
+ldidw 1;
+ldiqw need_to_extend;
+stdw;
+pop;
+ldiqw 0;
+ret;
+@L243:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L246;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L247;
+@L246:
+ldidw 1;
+negdw;
+@L247:
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L248;
+ldiqw x64_reg_str;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L249;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L250;
+@L249:
+ldidw 1;
+negdw;
+@L250:
+dw2qw;
+ldxqw 8;
+ldbp 32;
+ldqw;
+ldiqw @S168;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S169;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw x64_islong;
+call 4;
+pop;
+ldiqw need_to_extend;
+stdw;
+pop;
+ldiqw 0;
+ret;
+@L248:
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T251;
+switch;
+@L253:
+@L254:
+@L255:
+@L256:
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x64_load_addr;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L257:
+@L258:
+ldiqw @S170;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw @S171;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L252;
+@L259:
+ldiqw @S172;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw @S173;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw x64_ldreg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L252;
+@L260:
+ldiqw @S174;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw @S175;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L252;
+@L261:
+ldiqw @S176;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw @S177;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L252;
+@L262:
+@L263:
+ldiqw @S178;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw @S179;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L252;
+@L264:
+ldiqw @S180;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw @S181;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L252;
+@L265:
+ldiqw @S182;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw @S183;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldiqw need_to_extend;
+stdw;
+pop;
+jmp @L252;
+@L252:
+.data
+.align 8
+@T251:
+.dword 13
+.dword 49
+.dword 55
+.dword 60
+.dword 64
+.dword 68
+.dword 71
+.dword 72
+.dword 97
+.dword 98
+.dword 106
+.dword 107
+.dword 108
+.qword @L265
+.qword @L262
+.qword @L258
+.qword @L257
+.qword @L260
+.qword @L253
+.qword @L254
+.qword @L259
+.qword @L255
+.qword @L256
+.qword @L263
+.qword @L264
+.qword @L261
+.text
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L266;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L267;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldbp 16;
+ldqw;
+ldbp 32;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw @S184;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 56;
+pop;
+pop;
+ldiqw @S185;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L268;
+@L267:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldbp 32;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw @S186;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 48;
+pop;
+pop;
+ldiqw @S187;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L268:
+jmp @L269;
+@L266:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldbp 32;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw @S188;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 44;
+pop;
+pop;
+ldiqw @S189;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L269:
+jmp @L270;
+@L242:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L271;
+ldidw 1;
+ldiqw need_to_extend;
+stdw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L272;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp -20;
+lddw;
+eqdw;
+jmpf @L273;
+ldiqw 0;
+ret;
+jmp @L274;
+@L273:
+ldiqw x64_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S190;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S191;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L274:
+jmp @L275;
+@L272:
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L276;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L277;
+@L276:
+ldidw 1;
+negdw;
+@L277:
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L278;
+ldiqw x64_reg_str;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L279;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L280;
+@L279:
+ldidw 1;
+negdw;
+@L280:
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S192;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S193;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L281;
+@L278:
+ldbp -24;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S194;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S195;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L281:
+@L275:
+@L271:
+@L270:
+@L241:
+@L239:
+ldidw 0;
+ret;
+.extern pop_scope
+.bss
+.align 4
+arg_nb:
+.res 4
+.extern memset
+# ==== start of definition of function `x64_sh' ====
+.text
+x64_sh:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw x64_lwreg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S196;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S197;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L282:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L283:
+ldidw 0;
+jmpf @L284;
+jmp @L282;
+@L284:
+ldidw 0;
+ret;
+.bss
+.align 4
+nreg_args:
+.res 4
+# ==== start of definition of function `x64_must_spill_at_call' ====
+.text
+x64_must_spill_at_call:
+addsp 12;        
+# param:`a', offset:-20
+# var: e, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+neqdw;
+jmpf @L285;
+ldidw 0;
+dw2qw;
+ret;
+@L285:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpt @L286;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw address_taken_variables;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpt @L286;
+ldidw 0;
+jmp @L287;
+@L286:
+ldidw 1;
+@L287:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern file_exists
+.extern include_libc
+.extern C_source
+.extern analyze_cast_expression
+.extern stringify_type_exp
+.extern add_quote_dir
+# ==== start of definition of function `x64_arg_class' ====
+.text
+x64_arg_class:
+addsp 40;        
+# param:`q', offset:-20
+# var: j, offset: 4
+# var: c, offset: 8
+# var: avail, offset: 12
+# var: cls, offset: 16
+# var: cat, offset: 20
+ldbp -20;
+lddw;
+ldbp 4;
+stdw;
+pop;
+@L288:
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpf @L290;
+@L289:
+incldw 4;
+jmp @L288;
+@L290:
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 39;
+eqdw;
+jmpf @L291;
+ldbp 4;
+lddw;
+ldidw 2;
+adddw;
+jmp @L292;
+@L291:
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+@L292:
+ldbp 8;
+stdw;
+pop;
+@L293:
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 28;
+eqdw;
+jmpt @L296;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 29;
+eqdw;
+jmpt @L296;
+ldidw 0;
+jmp @L297;
+@L296:
+ldidw 1;
+@L297:
+notdw;
+jmpf @L298;
+ldidw 1974;
+ldiqw @S198;
+ldiqw @S199;
+ldiqw @S200;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L298:
+@L294:
+ldidw 0;
+jmpf @L295;
+jmp @L293;
+@L295:
+ldidw 6;
+ldbp 12;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 20;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L301;
+ldbp 20;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L301;
+ldidw 0;
+jmp @L302;
+@L301:
+ldidw 1;
+@L302:
+jmpf @L299;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldidw 16;
+ugtdw;
+jmpf @L299;
+ldidw 1;
+jmp @L300;
+@L299:
+ldidw 0;
+@L300:
+jmpf @L303;
+decldw 12;
+@L303:
+ldidw 1;
+negdw;
+ldbp 16;
+stdw;
+pop;
+@L304:
+ldbp 4;
+lddw;
+ldbp -20;
+lddw;
+sgetdw;
+jmpf @L306;
+# var: n, offset: 24
+# var: ty, offset: 32
+ldiqw ic_instructions;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 20;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L307;
+ldbp 20;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L307;
+ldidw 0;
+jmp @L308;
+@L307:
+ldidw 1;
+@L308:
+jmpf @L309;
+# var: siz, offset: 40
+ldbp 32;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 40;
+stdw;
+pop;
+ldbp 40;
+lddw;
+ldidw 16;
+ugtdw;
+jmpf @L310;
+ldidw 7;
+jmp @L311;
+@L310:
+ldidw 8;
+ldbp 40;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldidw 8;
+sdivdw;
+@L311:
+ldbp 24;
+stdw;
+pop;
+jmp @L312;
+@L309:
+ldidw 1;
+ldbp 24;
+stdw;
+pop;
+@L312:
+ldbp 24;
+lddw;
+ldbp 12;
+lddw;
+sletdw;
+jmpf @L313;
+ldidw 6;
+ldbp 12;
+lddw;
+subdw;
+ldbp 16;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldbp 24;
+lddw;
+subdw;
+ldbp 12;
+stdw;
+pop;
+jmp @L314;
+@L313:
+ldidw 1;
+negdw;
+ldbp 16;
+stdw;
+pop;
+@L314:
+@L305:
+decldw 4;
+jmp @L304;
+@L306:
+ldbp 16;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_switch' ====
+.text
+x64_switch:
+addsp 108;       
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+# var: tr1, offset: 8
+# var: tr2, offset: 12
+# var: lab_arena, offset: 16
+# var: jmp_tab, offset: 24
+# var: def_lab, offset: 32
+# var: def_val, offset: 48
+# var: min, offset: 56
+# var: max, offset: 64
+# var: ncase, offset: 72
+# var: interval_size, offset: 80
+# var: holes, offset: 88
+# var: cmp_reg_str, offset: 96
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldidw 8;
+eqdw;
+jmpf @L315;
+ldiqw x64_reg_str;
+jmp @L316;
+@L315:
+ldiqw x64_ldreg_str;
+@L316:
+ldbp 96;
+stqw;
+pop;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L317;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+jmp @L318;
+@L317:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 4;
+stdw;
+pop;
+@L318:
+ldidw 1;
+ldiqw pinned;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+subqw;
+ldbp 72;
+stqw;
+pop;
+pop;
+incldw -20;
+ldbp 72;
+ldqw;
+ldidw 3;
+dw2qw;
+sgetqw;
+jmpf @L319;
+# var: case_start, offset: 104
+ldbp -20;
+lddw;
+ldbp 104;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 64;
+stqw;
+ldbp 56;
+stqw;
+pop;
+pop;
+incldw -20;
+@L320:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ordw;
+jmpf @L323;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 48;
+stdw;
+pop;
+jmp @L322;
+@L323:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 56;
+ldqw;
+sltqw;
+jmpf @L324;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 56;
+stqw;
+pop;
+pop;
+jmp @L325;
+@L324:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 64;
+ldqw;
+sgtqw;
+jmpf @L326;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+@L326:
+@L325:
+@L321:
+incldw -20;
+jmp @L320;
+@L322:
+ldbp 104;
+lddw;
+ldbp -20;
+stdw;
+pop;
+ldbp 64;
+ldqw;
+ldbp 56;
+ldqw;
+subqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldbp 80;
+stqw;
+pop;
+pop;
+ldbp 80;
+ldqw;
+ldbp 72;
+ldqw;
+subqw;
+ldbp 88;
+stqw;
+pop;
+pop;
+ldbp 64;
+ldqw;
+ldbp 56;
+ldqw;
+subqw;
+ldbp 72;
+ldqw;
+ldidw 10;
+dw2qw;
+addqw;
+ultqw;
+jmpf @L327;
+jmp @@x64_switch_jump_table;
+@L327:
+@L319:
+jmp @@x64_switch_linear_search;
+@@x64_switch_jump_table:
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 56;
+ldqw;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S201;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S202;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 64;
+ldqw;
+ldiqw x64_reg_str;
+ldbp 12;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S203;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S204;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S205;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S206;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 48;
+lddw;
+ldiqw @S207;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S208;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x64_reg_str;
+ldbp 12;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S209;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S210;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 48;
+lddw;
+ldiqw @S211;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S212;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 56;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L328;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S213;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S214;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L328:
+ldiqw jump_tables_counter;
+lddw;
+ldiqw x64_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S215;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S216;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 8;
+ldbp 80;
+ldqw;
+ldiqw calloc;
+call 16;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 80;
+ldqw;
+ldidw 16;
+dw2qw;
+mulqw;
+pop;
+ldiqw arena_new;
+call 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 48;
+lddw;
+ldiqw @S217;
+ldbp 32;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+@L329:
+# var: s, offset: 104
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ordw;
+jmpf @L332;
+jmp @L331;
+@L332:
+ldidw 16;
+ldbp 16;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 104;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S218;
+ldbp 104;
+ldqw;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldbp 104;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 56;
+ldqw;
+subqw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L330:
+incldw -20;
+jmp @L329;
+@L331:
+ldidw 0;
+ldbp -20;
+stdw;
+pop;
+@L333:
+ldbp 88;
+ldqw;
+ordw;
+jmpf @L335;
+ldbp 24;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L336;
+ldbp 32;
+ldbp 24;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 88;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+subqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+@L336:
+@L334:
+incldw -20;
+jmp @L333;
+@L335:
+@L337:
+ldiqw curr_segment;
+lddw;
+ldidw 3;
+neqdw;
+jmpf @L340;
+ldiqw str_segment;
+ldidw 3;
+dw2qw;
+ldxqw 8;
+ldiqw @S219;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S220;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 3;
+ldiqw curr_segment;
+stdw;
+pop;
+@L340:
+@L338:
+ldidw 0;
+jmpf @L339;
+jmp @L337;
+@L339:
+ldiqw jump_tables_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S221;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S222;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp -20;
+stdw;
+pop;
+@L341:
+ldbp -20;
+lddw;
+dw2qw;
+ldbp 80;
+ldqw;
+sltqw;
+jmpf @L343;
+ldbp 24;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S223;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S224;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L342:
+incldw -20;
+jmp @L341;
+@L343:
+@L344:
+ldiqw curr_segment;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L347;
+ldiqw str_segment;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S225;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S226;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw curr_segment;
+stdw;
+pop;
+@L347:
+@L345:
+ldidw 0;
+jmpf @L346;
+jmp @L344;
+@L346:
+ldbp 24;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw arena_destroy;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw 0;
+ret;
+@@x64_switch_linear_search:
+ldidw 1;
+negdw;
+ldbp 8;
+stdw;
+pop;
+@L348:
+# var: val, offset: 104
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ordw;
+jmpf @L351;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S227;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S228;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L350;
+@L351:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 104;
+stqw;
+pop;
+pop;
+ldbp 104;
+ldqw;
+ldiqw 2147483648;
+negqw;
+sgetqw;
+jmpf @L352;
+ldbp 104;
+ldqw;
+ldidw 2147483647;
+dw2qw;
+sletqw;
+jmpf @L352;
+ldidw 1;
+jmp @L353;
+@L352:
+ldidw 0;
+@L353:
+jmpf @L354;
+ldbp 104;
+ldqw;
+pop;
+ldbp 96;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S229;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S230;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L355;
+@L354:
+ldbp 8;
+lddw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L356;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 8;
+stdw;
+pop;
+@L356:
+ldbp 104;
+ldqw;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S231;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S232;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S233;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S234;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L355:
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S235;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S236;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L349:
+incldw -20;
+jmp @L348;
+@L350:
+ldidw 0;
+ldiqw pinned;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_let' ====
+.text
+x64_let:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+# var: res, offset: 16
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L359;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L361;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L361;
+ldidw 0;
+jmp @L362;
+@L361:
+ldidw 1;
+@L362:
+jmpt @L359;
+ldidw 0;
+jmp @L360;
+@L359:
+ldidw 1;
+@L360:
+jmpt @L357;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L357;
+ldidw 0;
+jmp @L358;
+@L357:
+ldidw 1;
+@L358:
+jmpf @L363;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+jmp @L364;
+@L363:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+stdw;
+pop;
+@L364:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L365;
+ldbp -32;
+lddw;
+ldiqw x64_get_operand64;
+call 4;
+ldiqw x64_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S237;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S238;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L366;
+@L365:
+ldbp -32;
+lddw;
+ldiqw x64_get_operand32;
+call 4;
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S239;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S240;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L366:
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L367;
+ldiqw x64_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L368;
+ldiqw @S241;
+jmp @L369;
+@L368:
+ldiqw @S242;
+@L369:
+ldiqw @S243;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S244;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x64_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S245;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S246;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L370:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L371:
+ldidw 0;
+jmpf @L372;
+jmp @L370;
+@L372:
+jmp @L373;
+@L367:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L373:
+ldidw 0;
+ret;
+.extern stat_number_of_ast_nodes
+# ==== start of definition of function `x64_div_rem' ====
+.text
+x64_div_rem:
+addsp 32;        
+# param:`res', offset:-20
+# param:`i', offset:-24
+# param:`tar', offset:-28
+# param:`arg1', offset:-32
+# param:`arg2', offset:-36
+# var: cat, offset: 4
+# var: islong, offset: 8
+# var: instr, offset: 16
+# var: divop, offset: 24
+ldiqw ic_instructions;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw x64_islong;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -24;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L374;
+ldidw 0;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+@L374:
+ldbp -32;
+lddw;
+ldidw 0;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 3;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldidw 3;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L375;
+ldiqw @S247;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S248;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S249;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L376;
+@L375:
+ldbp 8;
+lddw;
+jmpf @L377;
+ldiqw @S250;
+jmp @L378;
+@L377:
+ldiqw @S251;
+@L378:
+ldiqw @S252;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S253;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S254;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L376:
+ldiqw ic_addresses;
+ldqw;
+ldbp -36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L379;
+ldbp 8;
+lddw;
+jmpf @L380;
+ldbp -36;
+lddw;
+ldiqw x64_get_operand64;
+call 4;
+jmp @L381;
+@L380:
+ldbp -36;
+lddw;
+ldiqw x64_get_operand32;
+call 4;
+@L381:
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L382;
+@L379:
+# var: r, offset: 32
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldbp -36;
+lddw;
+ldbp 32;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldbp 8;
+lddw;
+jmpf @L383;
+ldiqw x64_reg_str;
+ldbp 32;
+lddw;
+dw2qw;
+ldxqw 8;
+jmp @L384;
+@L383:
+ldiqw x64_ldreg_str;
+ldbp 32;
+lddw;
+dw2qw;
+ldxqw 8;
+@L384:
+ldbp 24;
+stqw;
+pop;
+pop;
+@L382:
+ldbp 24;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw @S255;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S256;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldidw 3;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L385:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -36;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldbp -20;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L386:
+ldidw 0;
+jmpf @L387;
+jmp @L385;
+@L387:
+ldidw 0;
+ret;
+.extern strtoul
+.extern fprintf
+.bss
+.align 4
+qrets_to_fix:
+.res 256
+.extern get_type_qual
+.extern read_file
+.extern address_taken_variables
+.extern is_signed_int
+.extern printf
+.extern get_c_token
+.extern lookup_tag
+# ==== start of definition of function `x64_dead_reg_arg' ====
+.text
+x64_dead_reg_arg:
+addsp 8;         
+# param:`a', offset:-20
+# var: k, offset: 4
+# var: found, offset: 8
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L388:
+ldbp 4;
+lddw;
+ldiqw nreg_args;
+lddw;
+sltdw;
+jmpf @L390;
+ldiqw ic_addresses;
+ldqw;
+ldiqw reg_args;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+neqdw;
+jmpf @L391;
+jmp @L389;
+@L391:
+ldiqw liveness_and_next_use;
+ldqw;
+ldiqw reg_args;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+jmpt @L392;
+ldiqw liveness_and_next_use;
+ldqw;
+ldiqw reg_args;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+jmpt @L392;
+ldidw 0;
+jmp @L393;
+@L392:
+ldidw 1;
+@L393:
+jmpf @L394;
+ldidw 0;
+dw2qw;
+ret;
+@L394:
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L389:
+incldw 4;
+jmp @L388;
+@L390:
+ldbp 8;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern get_rank
+# ==== start of definition of function `x64_ind_asn' ====
+.text
+x64_ind_asn:
+addsp 36;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: pr, offset: 8
+# var: siz_str, offset: 16
+ldiqw spill_aliased_objects;
+call 0;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L395;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L395;
+ldidw 0;
+jmp @L396;
+@L395:
+ldidw 1;
+@L396:
+jmpf @L397;
+# var: cluttered, offset: 24
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 4;
+neqdw;
+jmpf @L398;
+ldiqw reg_descr_tab;
+ldidw 4;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L399;
+ldbp 24;
+lddw;
+ldidw 1;
+ordw;
+ldbp 24;
+stdw;
+pop;
+ldiqw @S257;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S258;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L399:
+ldbp -32;
+lddw;
+ldidw 4;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+@L398:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 5;
+neqdw;
+jmpf @L400;
+ldiqw reg_descr_tab;
+ldidw 5;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L401;
+ldbp 24;
+lddw;
+ldidw 2;
+ordw;
+ldbp 24;
+stdw;
+pop;
+ldiqw @S259;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S260;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L401:
+ldbp -28;
+lddw;
+ldidw 5;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+@L400:
+ldiqw reg_descr_tab;
+ldidw 2;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L402;
+ldbp 24;
+lddw;
+ldidw 4;
+ordw;
+ldbp 24;
+stdw;
+pop;
+ldiqw @S261;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S262;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L402:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S263;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S264;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S265;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S266;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldidw 4;
+anddw;
+jmpf @L403;
+ldiqw @S267;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S268;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L403:
+ldbp 24;
+lddw;
+ldidw 2;
+anddw;
+jmpf @L404;
+ldiqw @S269;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S270;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L404:
+ldbp 24;
+lddw;
+ldidw 1;
+anddw;
+jmpf @L405;
+ldiqw @S271;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S272;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L405:
+jmp @@x64_ind_asn_done;
+@L397:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L406;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L407;
+@L406:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+@L407:
+ldbp 4;
+lddw;
+ldiqw @T408;
+switch;
+@L410:
+@L411:
+@L412:
+ldiqw @S273;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L409;
+@L413:
+@L414:
+ldiqw @S274;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L409;
+@L415:
+@L416:
+@L417:
+ldiqw @S275;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L409;
+@L418:
+ldiqw @S276;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L409;
+@L409:
+.data
+.align 8
+@T408:
+.dword 9
+.dword 49
+.dword 55
+.dword 60
+.dword 64
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.qword @L418
+.qword @L415
+.qword @L411
+.qword @L410
+.qword @L413
+.qword @L412
+.qword @L416
+.qword @L417
+.qword @L414
+.text
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L419;
+# var: val, offset: 24
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw @S277;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+notdw;
+jmpt @L420;
+ldbp 24;
+ldqw;
+ldiqw 2147483648;
+negqw;
+sgetqw;
+jmpf @L422;
+ldbp 24;
+ldqw;
+ldiqw 2147483648;
+negqw;
+sletqw;
+jmpf @L422;
+ldidw 1;
+jmp @L423;
+@L422:
+ldidw 0;
+@L423:
+jmpt @L420;
+ldidw 0;
+jmp @L421;
+@L420:
+ldidw 1;
+@L421:
+jmpf @L424;
+ldbp 24;
+ldqw;
+pop;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldqw;
+ldiqw @S278;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S279;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L425;
+@L424:
+# var: r, offset: 32
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 32;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldbp 32;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw x64_reg_str;
+ldbp 32;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S280;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S281;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L425:
+jmp @L426;
+@L419:
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L427;
+ldiqw @S282;
+ldbp 16;
+ldqw;
+ldiqw strcmp;
+call 16;
+pop;
+ldidw 0;
+eqdw;
+jmpf @L428;
+# var: r, offset: 24
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldbp 24;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw x64_reg_str;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S283;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S284;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L429;
+@L428:
+ldbp -32;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldqw;
+ldiqw @S285;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S286;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L429:
+jmp @L430;
+@L427:
+# var: r, offset: 24
+# var: reg_str, offset: 32
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L431;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldbp 24;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+jmp @L432;
+@L431:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 24;
+stdw;
+pop;
+@L432:
+ldbp 4;
+lddw;
+ldiqw @T433;
+switch;
+@L435:
+@L436:
+@L437:
+ldiqw x64_ldreg_str;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L434;
+@L438:
+@L439:
+ldiqw x64_lwreg_str;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L434;
+@L440:
+@L441:
+@L442:
+ldiqw x64_lbreg_str;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L434;
+@L443:
+ldiqw x64_reg_str;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L434;
+@L434:
+.data
+.align 8
+@T433:
+.dword 9
+.dword 49
+.dword 55
+.dword 60
+.dword 64
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.qword @L443
+.qword @L440
+.qword @L436
+.qword @L435
+.qword @L438
+.qword @L437
+.qword @L441
+.qword @L442
+.qword @L439
+.text
+ldbp 32;
+ldqw;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldqw;
+ldiqw @S287;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 40;
+pop;
+pop;
+ldiqw @S288;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L430:
+@L426:
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@@x64_ind_asn_done:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `update_arg_descriptors' ====
+.text
+update_arg_descriptors:
+addsp 0;         
+# param:`arg', offset:-20
+# param:`liveness', offset:-24
+# param:`next_use', offset:-28
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L446;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L446;
+ldidw 0;
+jmp @L447;
+@L446:
+ldidw 1;
+@L447:
+jmpt @L444;
+ldbp -28;
+lddw;
+jmpt @L444;
+ldidw 0;
+jmp @L445;
+@L444:
+ldidw 1;
+@L445:
+jmpf @L448;
+ldiqw 0;
+ret;
+@L448:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L449;
+ldbp -24;
+ldub;
+jmpf @L450;
+ldbp -20;
+lddw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw x64_store;
+call 8;
+pop;
+pop;
+jmp @L451;
+@L450:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L452;
+ldbp -20;
+lddw;
+ldiqw free_temp;
+call 4;
+pop;
+pop;
+@L452:
+@L451:
+ldidw 0;
+ldiqw reg_descr_tab;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+negdw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L453;
+@L449:
+ldbp -24;
+ldub;
+jmpf @L454;
+jmp @L455;
+@L454:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L456;
+ldbp -20;
+lddw;
+ldiqw free_temp;
+call 4;
+pop;
+pop;
+@L456:
+@L455:
+@L453:
+ldidw 0;
+ret;
+.extern is_external_id
+# ==== start of definition of function `x64_get_operand32' ====
+.text
+x64_get_operand32:
+addsp 16;        
+# param:`a', offset:-20
+.bss
+@x64_get_operand32_op:
+.res 256
+.text
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L457;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S289;
+ldiqw @x64_get_operand32_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+jmp @L458;
+@L457:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L459;
+ldbp -20;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldiqw @S290;
+ldiqw @x64_get_operand32_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+jmp @L460;
+@L459:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L461;
+# var: e, offset: 8
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L462;
+ldiqw x64_ldreg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxqw 8;
+ret;
+@L462:
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L463;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L464;
+@L463:
+ldidw 1;
+negdw;
+@L464:
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L465;
+ldiqw x64_ldreg_str;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L466;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L467;
+@L466:
+ldidw 1;
+negdw;
+@L467:
+dw2qw;
+ldxqw 8;
+ret;
+@L465:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T468;
+switch;
+@L470:
+@L471:
+@L472:
+@L473:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L474;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L475;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S291;
+ldiqw @x64_get_operand32_op;
+ldiqw sprintf;
+call 32;
+pop;
+pop;
+jmp @L476;
+@L475:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S292;
+ldiqw @x64_get_operand32_op;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+@L476:
+ldiqw @x64_get_operand32_op;
+ret;
+jmp @L477;
+@L474:
+# var: r, offset: 16
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw x64_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S293;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S294;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ret;
+@L477:
+@L478:
+@L479:
+@L480:
+@L481:
+@L482:
+# var: r, offset: 16
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ret;
+@L483:
+jmp @L469;
+@L469:
+.data
+.align 8
+@T468:
+.dword 10
+.dword 49
+.dword 64
+.dword 68
+.dword 71
+.dword 97
+.dword 98
+.dword 106
+.dword 107
+.dword 108
+.qword @L483
+.qword @L480
+.qword @L478
+.qword @L470
+.qword @L471
+.qword @L472
+.qword @L473
+.qword @L481
+.qword @L482
+.qword @L479
+.text
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L484;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L485;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S295;
+ldiqw @x64_get_operand32_op;
+ldiqw sprintf;
+call 32;
+pop;
+pop;
+jmp @L486;
+@L485:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S296;
+ldiqw @x64_get_operand32_op;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+@L486:
+jmp @L487;
+@L484:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw @S297;
+ldiqw @x64_get_operand32_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+@L487:
+jmp @L488;
+@L461:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L489;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L490;
+ldiqw x64_ldreg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxqw 8;
+ret;
+jmp @L491;
+@L490:
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L492;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L493;
+@L492:
+ldidw 1;
+negdw;
+@L493:
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L494;
+ldiqw x64_ldreg_str;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L495;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L496;
+@L495:
+ldidw 1;
+negdw;
+@L496:
+dw2qw;
+ldxqw 8;
+ret;
+jmp @L497;
+@L494:
+ldbp -20;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldiqw @S298;
+ldiqw @x64_get_operand32_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+@L497:
+@L491:
+@L489:
+@L488:
+@L460:
+@L458:
+ldiqw @x64_get_operand32_op;
+ret;
+ldidw 0;
+ret;
+.extern sprintf
+.extern strcat
+.extern are_compatible
+.extern error_count
+# ==== start of definition of function `x64_get_operand64' ====
+.text
+x64_get_operand64:
+addsp 16;        
+# param:`a', offset:-20
+.bss
+@x64_get_operand64_op:
+.res 256
+.text
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L498;
+# var: val, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 2147483648;
+negqw;
+sgetqw;
+jmpf @L499;
+ldbp 8;
+ldqw;
+ldidw 2147483647;
+dw2qw;
+sletqw;
+jmpf @L499;
+ldidw 1;
+jmp @L500;
+@L499:
+ldidw 0;
+@L500:
+jmpf @L501;
+ldbp 8;
+ldqw;
+pop;
+ldiqw @S299;
+ldiqw @x64_get_operand64_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+jmp @L502;
+@L501:
+# var: r, offset: 16
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw x64_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ret;
+@L502:
+jmp @L503;
+@L498:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L504;
+# var: r, offset: 4
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw x64_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ret;
+jmp @L505;
+@L504:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L506;
+# var: e, offset: 8
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L507;
+ldiqw x64_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxqw 8;
+ret;
+@L507:
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L508;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L509;
+@L508:
+ldidw 1;
+negdw;
+@L509:
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L510;
+ldiqw x64_reg_str;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L511;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L512;
+@L511:
+ldidw 1;
+negdw;
+@L512:
+dw2qw;
+ldxqw 8;
+ret;
+@L510:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T513;
+switch;
+@L515:
+@L516:
+@L517:
+@L518:
+# var: r, offset: 16
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L519;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L520;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldiqw x64_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S300;
+ldiqw @x64_get_operand64_op;
+ldiqw sprintf;
+call 40;
+pop;
+pop;
+jmp @L521;
+@L520:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw x64_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S301;
+ldiqw @x64_get_operand64_op;
+ldiqw sprintf;
+call 32;
+pop;
+pop;
+@L521:
+ldiqw @x64_get_operand64_op;
+ret;
+jmp @L522;
+@L519:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw x64_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S302;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S303;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x64_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ret;
+@L522:
+@L523:
+@L524:
+@L525:
+@L526:
+@L527:
+@L528:
+@L529:
+@L530:
+# var: r, offset: 16
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw x64_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ret;
+@L531:
+jmp @L514;
+@L514:
+.data
+.align 8
+@T513:
+.dword 13
+.dword 49
+.dword 55
+.dword 60
+.dword 64
+.dword 68
+.dword 71
+.dword 72
+.dword 97
+.dword 98
+.dword 106
+.dword 107
+.dword 108
+.qword @L531
+.qword @L528
+.qword @L524
+.qword @L523
+.qword @L526
+.qword @L515
+.qword @L516
+.qword @L525
+.qword @L517
+.qword @L518
+.qword @L529
+.qword @L530
+.qword @L527
+.text
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L532;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L533;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S304;
+ldiqw @x64_get_operand64_op;
+ldiqw sprintf;
+call 32;
+pop;
+pop;
+jmp @L534;
+@L533:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S305;
+ldiqw @x64_get_operand64_op;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+@L534:
+jmp @L535;
+@L532:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw @S306;
+ldiqw @x64_get_operand64_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+@L535:
+jmp @L536;
+@L506:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L537;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L538;
+ldiqw x64_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxqw 8;
+ret;
+jmp @L539;
+@L538:
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L540;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L541;
+@L540:
+ldidw 1;
+negdw;
+@L541:
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L542;
+ldiqw x64_reg_str;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L543;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L544;
+@L543:
+ldidw 1;
+negdw;
+@L544:
+dw2qw;
+ldxqw 8;
+ret;
+jmp @L545;
+@L542:
+ldbp -20;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldiqw @S307;
+ldiqw @x64_get_operand64_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+@L545:
+@L539:
+@L537:
+@L536:
+@L505:
+@L503:
+ldiqw @x64_get_operand64_op;
+ret;
+ldidw 0;
+ret;
+.extern free_pre_token
+.extern cg_nodes_counter
+.extern round_up
+.extern analyze_declarator
+# ==== start of definition of function `free_all_temps' ====
+.text
+free_all_temps:
+addsp 20;        
+# var: p, offset: 8
+# var: q, offset: 16
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L546:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L547;
+ldbp 8;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+jmp @L546;
+@L547:
+ldidw 0;
+dw2qw;
+ldiqw temp_list;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+func_prolog:
+.res 8
+# ==== start of definition of function `x64_uch' ====
+.text
+x64_uch:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw x64_lbreg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_ldreg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S308;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S309;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L548:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L549:
+ldidw 0;
+jmpf @L550;
+jmp @L548;
+@L550:
+ldidw 0;
+ret;
+.extern include_liblux
+# ==== start of definition of function `x64_indcall' ====
+.text
+x64_indcall:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: nb, offset: 4
+ldbp -32;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x64_pre_call;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldiqw x64_get_operand64;
+call 4;
+ldiqw @S310;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S311;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x64_post_call;
+call 8;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldbp -24;
+lddw;
+jmpf @L551;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldidw 0;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L551:
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_cmpl' ====
+.text
+x64_cmpl:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw x64_islong;
+call 4;
+pop;
+jmpf @L552;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+jmp @L553;
+@L552:
+ldiqw x64_ldreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+@L553:
+ldiqw @S312;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S313;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L554:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L555:
+ldidw 0;
+jmpf @L556;
+jmp @L554;
+@L556:
+ldidw 0;
+ret;
+.extern stat_number_of_pre_tokens
+.extern bset_eq
+.extern strchr
+.bss
+.align 4
+orets_to_fix_counter:
+.res 4
+.extern add_angle_dir
+.extern analyze_conditional_expression
+.extern ic_outpath
+.extern arena_alloc
+.bss
+.align 4
+calls_to_fix:
+.res 256
+.extern stdout
+.extern get_type_category
+.bss
+.align 4
+orets_to_fix:
+.res 256
+.extern ilog2
+.data
+.align 4
+x64_home_reg:
+.align 4
+.dword 1
+.align 4
+.dword 10
+.align 4
+.dword 11
+.align 4
+.dword 12
+.align 4
+.dword 13
+.extern strcmp
+# ==== start of definition of function `x64_div' ====
+.text
+x64_div:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldidw 0;
+ldiqw x64_div_rem;
+call 20;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+func_body:
+.res 8
+.extern bset_fill
+.extern strtok
+.extern strtol
+.extern parse_header
+.extern stdin
+.extern dflow_Dom
+.extern is_integer
+.extern analyze_postfix_expression
+.extern ftell
+.extern strcpy
+.extern install_tag
+# ==== start of definition of function `spill_aliased_objects' ====
+.text
+spill_aliased_objects:
+addsp 8;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L557:
+ldbp 4;
+lddw;
+ldidw 14;
+sltdw;
+jmpf @L559;
+# var: a, offset: 8
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+jmpf @L560;
+jmp @L558;
+@L560:
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L561;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw address_taken_variables;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L561;
+ldidw 1;
+jmp @L562;
+@L561:
+ldidw 0;
+@L562:
+jmpf @L563;
+ldbp 4;
+lddw;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+@L563:
+@L558:
+incldw 4;
+jmp @L557;
+@L559:
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_addr_of' ====
+.text
+x64_addr_of:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x64_load_addr;
+call 8;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern ic_function_to_print
+.extern strtoull
+.bss
+.align 4
+temp_struct_size:
+.res 4
+.extern strlen
+.extern token_table
+.bss
+.align 4
+modified:
+.res 56
+.extern string_vprintf
+.extern bset_free
+# ==== start of definition of function `x64_ush' ====
+.text
+x64_ush:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw x64_lwreg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_ldreg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S314;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S315;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L564:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L565:
+ldidw 0;
+jmpf @L566;
+jmp @L564;
+@L566:
+ldidw 0;
+ret;
+.bss
+.align 4
+jump_tables_counter:
+.res 4
+.extern analyze_expression
+# ==== start of definition of function `free_temp' ====
+.text
+free_temp:
+addsp 12;        
+# param:`a', offset:-20
+# var: p, offset: 8
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L567:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L569;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+notdw;
+jmpf @L570;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpf @L570;
+ldidw 1;
+jmp @L571;
+@L570:
+ldidw 0;
+@L571:
+jmpf @L572;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+jmp @L569;
+@L572:
+@L568:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L567;
+@L569:
+ldidw 0;
+ret;
+.data
+.align 8
+str_segment:
+.align 8
+.qword @S316+0
+.align 8
+.qword @S317+0
+.align 8
+.qword @S318+0
+.align 8
+.qword @S319+0
+.bss
+.align 4
+reg_descr_tab:
+.res 56
+.extern cfg_nodes
+.extern memchr
+.extern new_type_exp_node
+.extern analyze_primary_expression
+.extern dup_decl_specs
+.extern new_declaration_node
+.extern vfprintf
+.extern eval_const_expr
+.extern hash
+# ==== start of definition of function `x64_static_init' ====
+.text
+x64_static_init:
+addsp 68;        
+# param:`ds', offset:-24
+# param:`dct', offset:-32
+# param:`e', offset:-40
+# var: ts, offset: 8
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L573;
+# var: nelem, offset: 16
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L574;
+jmp @@x64_static_init_scalar;
+@L574:
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L575;
+# var: n, offset: 20
+ldidw 0;
+dw2b;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 16;
+lddw;
+ldidw 1;
+subdw;
+udw2qw;
+addqw;
+stb;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw asm_decls;
+ldqw;
+ldiqw emit_raw_string;
+call 16;
+pop;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldbp 20;
+stdw;
+ldbp 16;
+lddw;
+ultdw;
+jmpf @L576;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+subdw;
+ldiqw @S320;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S321;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L576:
+jmp @L577;
+@L575:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L578:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L580;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw x64_static_init;
+call 24;
+pop;
+pop;
+@L579:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 16;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+jmp @L578;
+@L580:
+ldbp 16;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L581;
+# var: ty, offset: 24
+ldbp -24;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw @S322;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S323;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+muldw;
+ldiqw @S324;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S325;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L581:
+@L577:
+jmp @L582;
+@L573:
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 68;
+eqdw;
+jmpf @L583;
+# var: d, offset: 16
+# var: full_init, offset: 24
+# var: ty, offset: 32
+# var: align, offset: 48
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 32;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 32;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 48;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L584;
+ldbp 48;
+lddw;
+ldiqw @S326;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S327;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L584:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L585:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L587;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L588:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L591;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L591;
+ldidw 1;
+jmp @L592;
+@L591:
+ldidw 0;
+@L592:
+jmpf @L590;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw x64_static_init;
+call 24;
+pop;
+pop;
+@L589:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L588;
+@L590:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L593;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L594;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L594;
+ldidw 1;
+jmp @L595;
+@L594:
+ldidw 0;
+@L595:
+jmpf @L596;
+ldidw 1;
+ldbp 24;
+stdw;
+pop;
+@L596:
+jmp @L587;
+@L593:
+@L586:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L585;
+@L587:
+ldbp 24;
+lddw;
+notdw;
+jmpf @L597;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L598;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L598:
+@L599:
+ldidw 1;
+jmpf @L600;
+@L601:
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L602;
+# var: ty, offset: 56
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 56;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw @S328;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S329;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 56;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S330;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S331;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L601;
+@L602:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L603;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L604;
+@L603:
+jmp @L600;
+@L604:
+jmp @L599;
+@L600:
+@L597:
+jmp @L605;
+@L583:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+jmpf @L606;
+# var: ty, offset: 16
+# var: align, offset: 32
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 32;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L607;
+ldbp 32;
+lddw;
+ldiqw @S332;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S333;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L607:
+ldbp -40;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw x64_static_init;
+call 24;
+pop;
+pop;
+jmp @L608;
+@L606:
+# var: dest_ty, offset: 16
+@@x64_static_init_scalar:
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L609;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+eqdw;
+jmpf @L609;
+ldidw 1;
+jmp @L610;
+@L609:
+ldidw 0;
+@L610:
+jmpf @L611;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L611:
+ldbp -24;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T612;
+switch;
+@L614:
+@L615:
+@L616:
+ldiqw @S334;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L613;
+@L617:
+@L618:
+ldiqw @S335;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S336;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S337;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L613;
+@L619:
+@L620:
+@L621:
+ldiqw @S338;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S339;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S340;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L613;
+@L622:
+ldiqw @S341;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S342;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S343;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L613;
+@L613:
+.data
+.align 8
+@T612:
+.dword 9
+.dword 49
+.dword 55
+.dword 60
+.dword 64
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.qword @L622
+.qword @L614
+.qword @L621
+.qword @L619
+.qword @L617
+.qword @L620
+.qword @L615
+.qword @L616
+.qword @L618
+.text
+ldbp -40;
+ldqw;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+ldiqw @S344;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L608:
+@L605:
+@L582:
+ldidw 0;
+ret;
+.data
+.align 8
+instruction_handlers:
+.align 8
+.qword x64_add+0
+.align 8
+.qword x64_sub+0
+.align 8
+.qword x64_mul+0
+.align 8
+.qword x64_div+0
+.align 8
+.qword x64_rem+0
+.align 8
+.qword x64_shl+0
+.align 8
+.qword x64_shr+0
+.align 8
+.qword x64_and+0
+.align 8
+.qword x64_or+0
+.align 8
+.qword x64_xor+0
+.align 8
+.qword x64_eq+0
+.align 8
+.qword x64_neq+0
+.align 8
+.qword x64_lt+0
+.align 8
+.qword x64_let+0
+.align 8
+.qword x64_gt+0
+.align 8
+.qword x64_get+0
+.align 8
+.qword x64_neg+0
+.align 8
+.qword x64_cmpl+0
+.align 8
+.qword x64_not+0
+.align 8
+.qword x64_ch+0
+.align 8
+.qword x64_uch+0
+.align 8
+.qword x64_sh+0
+.align 8
+.qword x64_ush+0
+.align 8
+.qword x64_llsx+0
+.align 8
+.qword x64_llzx+0
+.align 8
+.qword x64_addr_of+0
+.align 8
+.qword x64_ind+0
+.align 8
+.qword x64_asn+0
+.align 8
+.qword x64_call+0
+.align 8
+.qword x64_indcall+0
+.align 8
+.qword x64_ind_asn+0
+.align 8
+.qword x64_lab+0
+.align 8
+.qword x64_jmp+0
+.align 8
+.qword x64_arg+0
+.align 8
+.qword x64_ret+0
+.align 8
+.qword x64_switch+0
+.align 8
+.qword x64_case+0
+.align 8
+.qword x64_cbr+0
+.align 8
+.qword x64_begarg+0
+.align 8
+.qword x64_nop+0
+.extern string_clear
+.bss
+.align 8
+asm_decls:
+.res 8
+# ==== start of definition of function `x64_call' ====
+.text
+x64_call:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: nb, offset: 4
+ldbp -32;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x64_pre_call;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S345;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S346;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x64_post_call;
+call 8;
+pop;
+pop;
+ldbp -24;
+lddw;
+jmpf @L623;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldidw 0;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L623:
+ldidw 0;
+ret;
+.extern bsearch
+.extern pre_save_pch
+.extern qsort
+.extern analyze_parameter_declaration
+.extern string_new
+.extern cg_outpath
+.extern memcmp
+.extern bset_insert
+.extern pre_load_pch
+# ==== start of definition of function `x64_function_definition' ====
+.text
+x64_function_definition:
+addsp 68;        
+# param:`decl_specs', offset:-24
+# param:`header', offset:-32
+# var: cat, offset: 4
+# var: scs, offset: 8
+# var: i, offset: 16
+# var: j, offset: 20
+# var: last_i, offset: 24
+# var: ty, offset: 32
+# var: fn, offset: 48
+# var: pos_tmp, offset: 52
+.data
+.align 4
+@x64_function_definition_first_func:
+.align 4
+.dword 1
+.text
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw curr_func;
+stqw;
+pop;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw new_cg_node;
+call 8;
+pop;
+ldbp 48;
+stdw;
+pop;
+ldidw 8;
+ldiqw cg_nodes;
+ldqw;
+ldbp 48;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 40;
+addqw;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldbp 48;
+lddw;
+ldiqw compute_liveness_and_next_use;
+call 4;
+pop;
+pop;
+ldiqw opt_level;
+lddw;
+jmpf @L624;
+# var: homes, offset: 56
+ldiqw x64_home_candidate;
+ldidw 5;
+ldbp 48;
+lddw;
+ldiqw ra_allocate;
+call 16;
+pop;
+ldbp 56;
+stdw;
+pop;
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+@L625:
+ldbp 16;
+lddw;
+ldidw 5;
+sltdw;
+jmpf @L627;
+ldbp 56;
+lddw;
+ldidw 1;
+ldbp 16;
+lddw;
+slldw;
+anddw;
+jmpf @L628;
+ldidw 1;
+ldiqw pinned;
+ldiqw x64_home_reg;
+ldbp 16;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 1;
+ldiqw modified;
+ldiqw x64_home_reg;
+ldbp 16;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L628:
+@L626:
+incldw 16;
+jmp @L625;
+@L627:
+@L624:
+ldbp -24;
+ldqw;
+ldbp 32;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 32;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L631;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L631;
+ldidw 0;
+jmp @L632;
+@L631:
+ldidw 1;
+@L632:
+jmpf @L629;
+ldbp 32;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldidw 16;
+ugtdw;
+jmpf @L629;
+ldidw 1;
+jmp @L630;
+@L629:
+ldidw 0;
+@L630:
+jmpf @L633;
+ldidw 1;
+ldiqw big_return;
+stdw;
+pop;
+@L633:
+ldiqw @x64_function_definition_first_func;
+lddw;
+notdw;
+jmpf @L634;
+ldiqw @S347;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L634:
+ldiqw curr_func;
+ldqw;
+ldiqw @S348;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S349;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L635:
+ldiqw curr_segment;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L638;
+ldiqw str_segment;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S350;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S351;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw curr_segment;
+stdw;
+pop;
+@L638:
+@L636:
+ldidw 0;
+jmpf @L637;
+jmp @L635;
+@L637:
+ldbp -24;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 8;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L639;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L639;
+ldidw 0;
+jmp @L640;
+@L639:
+ldidw 1;
+@L640:
+jmpf @L641;
+ldiqw curr_func;
+ldqw;
+ldiqw @S352;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S353;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L641:
+ldiqw curr_func;
+ldqw;
+ldiqw @S354;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S355;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S356;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S357;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S358;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S359;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 48;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 48;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 24;
+stdw;
+pop;
+ldbp 24;
+lddw;
+ldiqw func_last_quad;
+stdw;
+pop;
+ldidw 0;
+ldbp 20;
+stdw;
+pop;
+@L642:
+ldbp 20;
+lddw;
+ldiqw ra_nintervals;
+lddw;
+sltdw;
+jmpf @L644;
+# var: a, offset: 56
+# var: h, offset: 60
+ldiqw ra_intervals;
+ldqw;
+ldbp 20;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 56;
+stdw;
+pop;
+ldiqw ra_intervals;
+ldqw;
+ldbp 20;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L649;
+ldiqw ra_intervals;
+ldqw;
+ldbp 20;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 16;
+lddw;
+neqdw;
+jmpt @L649;
+ldidw 0;
+jmp @L650;
+@L649:
+ldidw 1;
+@L650:
+jmpt @L647;
+ldiqw ic_addresses;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+neqdw;
+jmpt @L647;
+ldidw 0;
+jmp @L648;
+@L647:
+ldidw 1;
+@L648:
+jmpt @L645;
+ldiqw ic_addresses;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 14;
+addqw;
+ldb;
+notdw;
+jmpt @L645;
+ldidw 0;
+jmp @L646;
+@L645:
+ldidw 1;
+@L646:
+jmpf @L651;
+jmp @L643;
+@L651:
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L652;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L653;
+@L652:
+ldidw 1;
+negdw;
+@L653:
+ldbp 60;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw x64_reg_str;
+ldbp 60;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S360;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S361;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 56;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 60;
+lddw;
+ldbp 60;
+lddw;
+ldiqw x64_store_home;
+call 12;
+pop;
+pop;
+@L643:
+incldw 20;
+jmp @L642;
+@L644:
+@L654:
+ldbp 16;
+lddw;
+ldbp 24;
+lddw;
+sletdw;
+jmpf @L656;
+# var: tar, offset: 56
+# var: arg1, offset: 60
+# var: arg2, offset: 64
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 56;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 60;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 64;
+stdw;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L657;
+ldiqw C_source;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L657;
+ldidw 1;
+jmp @L658;
+@L657:
+ldidw 0;
+@L658:
+jmpf @L659;
+ldiqw C_source;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S362;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S363;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L659:
+ldbp 64;
+lddw;
+ldbp 60;
+lddw;
+ldbp 56;
+lddw;
+ldbp 16;
+lddw;
+ldiqw instruction_handlers;
+ldiqw ic_instructions;
+ldqw;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+dw2qw;
+ldxqw 8;
+call 16;
+pop;
+pop;
+@L655:
+incldw 16;
+jmp @L654;
+@L656:
+ldiqw size_of_local_area;
+lddw;
+ldidw 8;
+ldiqw temp_struct_size;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+subdw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldbp 52;
+stdw;
+pop;
+@L660:
+ldiqw calls_to_fix_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldidw 0;
+sgetdw;
+jmpf @L661;
+# var: n, offset: 56
+# var: s, offset: 64
+ldiqw calls_to_fix;
+ldiqw calls_to_fix_counter;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw func_body;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_curr;
+call 8;
+ldbp 64;
+stqw;
+pop;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldiqw @S364;
+ldbp 64;
+ldqw;
+ldiqw sprintf;
+call 20;
+pop;
+ldbp 56;
+stdw;
+pop;
+ldidw 93;
+dw2b;
+ldbp 64;
+ldqw;
+ldbp 56;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+@L662:
+ldbp 64;
+ldqw;
+ldbp 56;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 88;
+eqdw;
+jmpf @L664;
+ldidw 32;
+dw2b;
+ldbp 64;
+ldqw;
+ldbp 56;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L663:
+incldw 56;
+jmp @L662;
+@L664:
+jmp @L660;
+@L661:
+@L665:
+ldiqw orets_to_fix_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldidw 0;
+sgetdw;
+jmpf @L666;
+# var: n, offset: 56
+# var: s, offset: 64
+ldiqw orets_to_fix;
+ldiqw orets_to_fix_counter;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw func_body;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_curr;
+call 8;
+ldbp 64;
+stqw;
+pop;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldiqw size_of_local_area;
+lddw;
+ldidw 8;
+adddw;
+ldiqw size_of_local_area;
+lddw;
+ldiqw @S365;
+ldbp 64;
+ldqw;
+ldiqw sprintf;
+call 28;
+pop;
+ldbp 56;
+stdw;
+pop;
+ldidw 32;
+dw2b;
+ldbp 64;
+ldqw;
+ldbp 56;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+@L667:
+ldbp 64;
+ldqw;
+ldbp 56;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 88;
+eqdw;
+jmpf @L669;
+ldidw 32;
+dw2b;
+ldbp 64;
+ldqw;
+ldbp 56;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L668:
+incldw 56;
+jmp @L667;
+@L669:
+jmp @L665;
+@L666:
+@L670:
+ldiqw qrets_to_fix_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldidw 0;
+sgetdw;
+jmpf @L671;
+# var: n, offset: 56
+# var: s, offset: 64
+ldiqw qrets_to_fix;
+ldiqw qrets_to_fix_counter;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw func_body;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_curr;
+call 8;
+ldbp 64;
+stqw;
+pop;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldiqw size_of_local_area;
+lddw;
+ldiqw @S366;
+ldbp 64;
+ldqw;
+ldiqw sprintf;
+call 24;
+pop;
+ldbp 56;
+stdw;
+pop;
+ldidw 32;
+dw2b;
+ldbp 64;
+ldqw;
+ldbp 56;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+@L672:
+ldbp 64;
+ldqw;
+ldbp 56;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 88;
+eqdw;
+jmpf @L674;
+ldidw 32;
+dw2b;
+ldbp 64;
+ldqw;
+ldbp 56;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L673:
+incldw 56;
+jmp @L672;
+@L674:
+jmp @L670;
+@L671:
+ldbp 52;
+lddw;
+ldiqw func_body;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldiqw size_of_local_area;
+lddw;
+jmpf @L675;
+ldiqw size_of_local_area;
+lddw;
+negdw;
+ldiqw @S367;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S368;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L675:
+ldiqw big_return;
+lddw;
+jmpf @L676;
+ldidw 16;
+negdw;
+jmp @L677;
+@L676:
+ldidw 8;
+negdw;
+@L677:
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw x64_spill_reg_args;
+call 12;
+pop;
+pop;
+ldiqw modified;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+jmpf @L678;
+ldiqw @S369;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S370;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L678:
+ldiqw modified;
+ldidw 10;
+dw2qw;
+ldxdw 4;
+jmpf @L679;
+ldiqw @S371;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S372;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L679:
+ldiqw modified;
+ldidw 11;
+dw2qw;
+ldxdw 4;
+jmpf @L680;
+ldiqw @S373;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S374;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L680:
+ldiqw modified;
+ldidw 12;
+dw2qw;
+ldxdw 4;
+jmpf @L681;
+ldiqw @S375;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S376;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L681:
+ldiqw modified;
+ldidw 13;
+dw2qw;
+ldxdw 4;
+jmpf @L682;
+ldiqw @S377;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S378;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L682:
+ldiqw big_return;
+lddw;
+jmpf @L683;
+ldiqw @S379;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S380;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S381;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S382;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L683:
+ldiqw modified;
+ldidw 13;
+dw2qw;
+ldxdw 4;
+jmpf @L684;
+ldiqw @S383;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S384;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L684:
+ldiqw modified;
+ldidw 12;
+dw2qw;
+ldxdw 4;
+jmpf @L685;
+ldiqw @S385;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S386;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L685:
+ldiqw modified;
+ldidw 11;
+dw2qw;
+ldxdw 4;
+jmpf @L686;
+ldiqw @S387;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S388;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L686:
+ldiqw modified;
+ldidw 10;
+dw2qw;
+ldxdw 4;
+jmpf @L687;
+ldiqw @S389;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S390;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L687:
+ldiqw modified;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+jmpf @L688;
+ldiqw @S391;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S392;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L688:
+ldiqw @S393;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S394;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S395;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S396;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S397;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S398;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw func_prolog;
+ldqw;
+ldiqw x64_write;
+call 8;
+pop;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw x64_write;
+call 8;
+pop;
+pop;
+ldiqw func_epilog;
+ldqw;
+ldiqw x64_write;
+call 8;
+pop;
+pop;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldiqw temp_struct_size;
+stdw;
+pop;
+ldidw 0;
+ldiqw calls_to_fix_counter;
+stdw;
+pop;
+ldidw 0;
+ldiqw qrets_to_fix_counter;
+stdw;
+pop;
+ldidw 0;
+ldiqw orets_to_fix_counter;
+stdw;
+pop;
+ldiqw 4;
+ldidw 14;
+dw2qw;
+mulqw;
+ldidw 0;
+ldiqw modified;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldiqw 4;
+ldidw 14;
+dw2qw;
+mulqw;
+ldidw 0;
+ldiqw pinned;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldiqw free_all_temps;
+call 0;
+pop;
+pop;
+ldbp 48;
+lddw;
+ldiqw ic_free_function;
+call 4;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldiqw 4;
+ldidw 14;
+dw2qw;
+mulqw;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldidw 0;
+ldiqw big_return;
+stdw;
+pop;
+ldidw 0;
+ldiqw @x64_function_definition_first_func;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern dflow_free_LiveOut
+.extern vsnprintf
+.extern vsprintf
+.bss
+.align 8
+str_lits:
+.res 8
+.extern nid_counter
+.extern new_cg_node
+.extern warning_count
+.extern memcpy
+.bss
+.align 4
+func_last_quad:
+.res 4
+# ==== start of definition of function `x64_case' ====
+.text
+x64_case:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldidw 0;
+ret;
+.extern fopen
+.extern be_atoi
+.extern ra_nintervals
+.bss
+.align 4
+big_return:
+.res 4
+.extern bset_delete
+# ==== start of definition of function `spill_reg' ====
+.text
+spill_reg:
+addsp 4;         
+# param:`r', offset:-20
+# var: a, offset: 4
+ldiqw reg_descr_tab;
+ldbp -20;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+jmpf @L689;
+ldiqw 0;
+ret;
+@L689:
+ldiqw reg_descr_tab;
+ldbp -20;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x64_store;
+call 8;
+pop;
+pop;
+ldidw 1;
+negdw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ret;
+.extern push_scope
+.extern free_c_token
+.extern ic_main
+.extern new_address
+.extern parse
+.extern get_pre_token
+# ==== start of definition of function `get_temp_offs' ====
+.text
+get_temp_offs:
+addsp 12;        
+# param:`a', offset:-20
+# var: p, offset: 8
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L690:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L692;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+notdw;
+jmpf @L693;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpf @L693;
+ldidw 1;
+jmp @L694;
+@L693:
+ldidw 0;
+@L694:
+jmpf @L695;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ret;
+@L695:
+@L691:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L690;
+@L692:
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L696:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L698;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+jmpf @L699;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ret;
+@L699:
+@L697:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L696;
+@L698:
+ldiqw 24;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldidw 8;
+subdw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw temp_list;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_post_call' ====
+.text
+x64_post_call:
+addsp 12;        
+# param:`i', offset:-20
+# param:`nb', offset:-24
+# var: k, offset: 4
+# var: cat, offset: 8
+# var: siz, offset: 12
+ldbp -24;
+lddw;
+jmpf @L700;
+ldbp -24;
+lddw;
+ldiqw @S399;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S400;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L700:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L701;
+ldbp 8;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L701;
+ldidw 0;
+jmp @L702;
+@L701:
+ldidw 1;
+@L702:
+jmpf @L703;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldidw 16;
+ugtdw;
+jmpf @L704;
+jmp @L705;
+@L704:
+ldbp 12;
+lddw;
+ldidw 8;
+ugtdw;
+jmpf @L706;
+ldiqw func_body;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldiqw orets_to_fix;
+ldiqw orets_to_fix_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw @S401;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S402;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L707;
+@L706:
+ldiqw func_body;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldiqw qrets_to_fix;
+ldiqw qrets_to_fix_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw @S403;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S404;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L707:
+@L705:
+@L703:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L708:
+ldbp 4;
+lddw;
+ldidw 6;
+sltdw;
+jmpf @L710;
+ldidw 0;
+ldiqw pinned;
+ldiqw x64_arg_reg;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L709:
+incldw 4;
+jmp @L708;
+@L710:
+ldidw 0;
+ldiqw pinned;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L711:
+ldbp 4;
+lddw;
+ldiqw nreg_args;
+lddw;
+sltdw;
+jmpf @L713;
+ldiqw liveness_and_next_use;
+ldqw;
+ldiqw reg_args;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldiqw reg_args;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldiqw reg_args;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+@L712:
+incldw 4;
+jmp @L711;
+@L713:
+ldidw 0;
+ldiqw nreg_args;
+stdw;
+pop;
+ldidw 0;
+ldiqw arg_nb;
+stdw;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_store' ====
+.text
+x64_store:
+addsp 32;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L714;
+# var: e, offset: 8
+# var: siz_str, offset: 16
+# var: reg_str, offset: 24
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L715;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L716;
+@L715:
+ldidw 1;
+negdw;
+@L716:
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L717;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L718;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L719;
+@L718:
+ldidw 1;
+negdw;
+@L719:
+ldbp -20;
+lddw;
+ldiqw x64_store_home;
+call 12;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L717:
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T720;
+switch;
+@L722:
+@L723:
+# var: cluttered, offset: 32
+ldidw 0;
+ldbp 32;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldidw 4;
+neqdw;
+jmpf @L724;
+ldiqw reg_descr_tab;
+ldidw 4;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L725;
+ldbp 32;
+lddw;
+ldidw 1;
+ordw;
+ldbp 32;
+stdw;
+pop;
+ldiqw @S405;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S406;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L725:
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S407;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S408;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L724:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 5;
+neqdw;
+jmpf @L726;
+ldiqw reg_descr_tab;
+ldidw 5;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L727;
+ldbp 32;
+lddw;
+ldidw 2;
+ordw;
+ldbp 32;
+stdw;
+pop;
+ldiqw @S409;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S410;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L727:
+ldbp -24;
+lddw;
+ldidw 5;
+ldiqw x64_load_addr;
+call 8;
+pop;
+pop;
+@L726:
+ldiqw reg_descr_tab;
+ldidw 2;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L728;
+ldbp 32;
+lddw;
+ldidw 4;
+ordw;
+ldbp 32;
+stdw;
+pop;
+ldiqw @S411;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S412;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L728:
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S413;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S414;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S415;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S416;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+lddw;
+ldidw 4;
+anddw;
+jmpf @L729;
+ldiqw @S417;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S418;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L729:
+ldbp 32;
+lddw;
+ldidw 2;
+anddw;
+jmpf @L730;
+ldiqw @S419;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S420;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L730:
+ldbp 32;
+lddw;
+ldidw 1;
+anddw;
+jmpf @L731;
+ldiqw @S421;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S422;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L731:
+ldiqw 0;
+ret;
+@L732:
+@L733:
+@L734:
+ldiqw @S423;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw x64_ldreg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L721;
+@L735:
+@L736:
+ldiqw @S424;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw x64_lwreg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L721;
+@L737:
+@L738:
+@L739:
+ldiqw @S425;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw x64_lbreg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L721;
+@L740:
+ldiqw @S426;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+jmp @L721;
+@L721:
+.data
+.align 8
+@T720:
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 64
+.dword 68
+.dword 71
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.qword @L740
+.qword @L737
+.qword @L733
+.qword @L732
+.qword @L735
+.qword @L722
+.qword @L723
+.qword @L734
+.qword @L738
+.qword @L739
+.qword @L736
+.text
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L741;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L742;
+ldbp 24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw @S427;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 48;
+pop;
+pop;
+ldiqw @S428;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L743;
+@L742:
+ldbp 24;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw @S429;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 40;
+pop;
+pop;
+ldiqw @S430;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L743:
+jmp @L744;
+@L741:
+ldbp 24;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw @S431;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S432;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L744:
+jmp @L745;
+@L714:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L746;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L747;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L748;
+@L747:
+ldidw 1;
+negdw;
+@L748:
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L749;
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L750;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L751;
+@L750:
+ldidw 1;
+negdw;
+@L751:
+dw2qw;
+ldxqw 8;
+ldiqw @S433;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S434;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L752;
+@L749:
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp -24;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldiqw @S435;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S436;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L752:
+@L746:
+@L745:
+ldidw 0;
+ret;
+.extern get_member_descriptor
+# ==== start of definition of function `x64_mul' ====
+.text
+x64_mul:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw x64_islong;
+call 4;
+pop;
+jmpf @L753;
+ldbp -32;
+lddw;
+ldiqw x64_get_operand64;
+call 4;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S437;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S438;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L754;
+@L753:
+ldbp -32;
+lddw;
+ldiqw x64_get_operand32;
+call 4;
+ldiqw x64_ldreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S439;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S440;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L754:
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L755:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L756:
+ldidw 0;
+jmpf @L757;
+jmp @L755;
+@L757:
+ldidw 0;
+ret;
+.extern decl_init
+.extern ic_free_function
+# ==== start of definition of function `x64_ind' ====
+.text
+x64_ind:
+addsp 12;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+# var: reg_str, offset: 8
+ldiqw spill_aliased_objects;
+call 0;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw x64_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T758;
+switch;
+@L760:
+@L761:
+jmp @L759;
+@L762:
+@L763:
+ldbp 8;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S441;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S442;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L759;
+@L764:
+ldbp 8;
+ldqw;
+ldiqw x64_ldreg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S443;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S444;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L759;
+@L765:
+ldbp 8;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S445;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S446;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L759;
+@L766:
+ldbp 8;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S447;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S448;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L759;
+@L767:
+@L768:
+ldbp 8;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S449;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S450;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L759;
+@L769:
+ldbp 8;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S451;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S452;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L759;
+@L770:
+ldbp 8;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S453;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S454;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L759;
+@L759:
+.data
+.align 8
+@T758:
+.dword 11
+.dword 49
+.dword 55
+.dword 60
+.dword 64
+.dword 68
+.dword 71
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.qword @L770
+.qword @L767
+.qword @L763
+.qword @L762
+.qword @L765
+.qword @L760
+.qword @L761
+.qword @L764
+.qword @L768
+.qword @L769
+.qword @L766
+.text
+@L771:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L772:
+ldidw 0;
+jmpf @L773;
+jmp @L771;
+@L773:
+ldidw 0;
+ret;
+.extern ra_reg_of_nid
+.extern dup_declarator
+.extern cg_nodes
+.extern strncat
+.extern dflow_free_Dom
+.extern fileno
+.extern bset_update
+.extern dflow_LiveOut
+.extern string_printf
+.extern lookup_external_id
+.bss
+.align 8
+addr_descr_tab:
+.res 8
+.extern hash2
+.extern analyze_type_name
+# ==== start of definition of function `x64_llsx' ====
+.text
+x64_llsx:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw need_to_extend;
+lddw;
+jmpf @L774;
+ldiqw x64_ldreg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S455;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S456;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L774:
+@L775:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L776:
+ldidw 0;
+jmpf @L777;
+jmp @L775;
+@L777:
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_home_candidate' ====
+.text
+x64_home_candidate:
+addsp 20;        
+# param:`a', offset:-20
+# var: cat, offset: 4
+# var: e, offset: 8
+# var: tq, offset: 16
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L778;
+ldidw 1;
+dw2qw;
+ret;
+@L778:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 0;
+neqdw;
+jmpt @L779;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw address_taken_variables;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpt @L779;
+ldidw 0;
+jmp @L780;
+@L779:
+ldidw 1;
+@L780:
+jmpf @L781;
+ldidw 0;
+dw2qw;
+ret;
+@L781:
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw is_integer;
+call 4;
+pop;
+notdw;
+jmpf @L782;
+ldbp 4;
+lddw;
+ldidw 11;
+neqdw;
+jmpf @L782;
+ldidw 1;
+jmp @L783;
+@L782:
+ldidw 0;
+@L783:
+jmpf @L784;
+ldidw 0;
+dw2qw;
+ret;
+@L784:
+ldbp 4;
+lddw;
+ldidw 11;
+eqdw;
+jmpf @L785;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+jmp @L786;
+@L785:
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_qual;
+call 8;
+@L786:
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L787;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 74;
+neqdw;
+jmpf @L789;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 112;
+neqdw;
+jmpf @L789;
+ldidw 1;
+jmp @L790;
+@L789:
+ldidw 0;
+@L790:
+jmpt @L787;
+ldidw 0;
+jmp @L788;
+@L787:
+ldidw 1;
+@L788:
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_add' ====
+.text
+x64_add:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw x64_islong;
+call 4;
+pop;
+jmpf @L791;
+ldbp -32;
+lddw;
+ldiqw x64_get_operand64;
+call 4;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S457;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S458;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L792;
+@L791:
+ldbp -32;
+lddw;
+ldiqw x64_get_operand32;
+call 4;
+ldiqw x64_ldreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S459;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S460;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L792:
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L793:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L794:
+ldidw 0;
+jmpf @L795;
+jmp @L793;
+@L795:
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_rem' ====
+.text
+x64_rem:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldidw 3;
+ldiqw x64_div_rem;
+call 20;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_ret' ====
+.text
+x64_ret:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: siz, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 16;
+ugtdw;
+jmpf @L796;
+ldbp -28;
+lddw;
+ldidw 4;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw reg_descr_tab;
+ldidw 5;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L797;
+ldidw 5;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+@L797:
+ldiqw @S461;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S462;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw reg_descr_tab;
+ldidw 2;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L798;
+ldidw 2;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+@L798:
+ldbp 4;
+lddw;
+ldiqw @S463;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S464;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S465;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S466;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L799;
+@L796:
+ldbp 4;
+lddw;
+ldidw 8;
+ugtdw;
+jmpf @L800;
+ldbp -28;
+lddw;
+ldidw 0;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @T801;
+jmptab;
+@L803:
+ldiqw @S467;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S468;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L802;
+@L804:
+ldiqw @S469;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S470;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L802;
+@L805:
+ldiqw @S471;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S472;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L802;
+@L806:
+ldiqw @S473;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S474;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L802;
+@L807:
+ldidw 4;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldidw 5;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldidw 2;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldiqw @S475;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S476;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S477;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S478;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S479;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S480;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 8;
+subdw;
+ldiqw @S481;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S482;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S483;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S484;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S485;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S486;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L802;
+@L802:
+.data
+.align 8
+@T801:
+.dword 9
+.dword 8
+.qword @L807
+.qword @L803
+.qword @L804
+.qword @L807
+.qword @L805
+.qword @L807
+.qword @L807
+.qword @L807
+.qword @L806
+.text
+ldiqw @S487;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S488;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L808;
+@L800:
+# var: cat, offset: 8
+ldbp -28;
+lddw;
+ldidw 0;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L809;
+ldbp 8;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L809;
+ldidw 0;
+jmp @L810;
+@L809:
+ldidw 1;
+@L810:
+jmpf @L811;
+ldbp 4;
+lddw;
+ldiqw @T812;
+jmptab;
+@L814:
+ldiqw @S489;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S490;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L813;
+@L815:
+ldiqw @S491;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S492;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L813;
+@L816:
+ldiqw @S493;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S494;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L813;
+@L817:
+ldiqw @S495;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S496;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L813;
+@L818:
+ldidw 4;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldidw 5;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldidw 2;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldiqw @S497;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S498;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S499;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S500;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S501;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S502;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S503;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S504;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S505;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S506;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S507;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S508;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L813;
+@L813:
+.data
+.align 8
+@T812:
+.dword 1
+.dword 8
+.qword @L818
+.qword @L814
+.qword @L815
+.qword @L818
+.qword @L816
+.qword @L818
+.qword @L818
+.qword @L818
+.qword @L817
+.text
+@L811:
+@L808:
+@L799:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+x64_output_file:
+.res 8
+.extern is_unsigned_int
+.extern memmove
+.extern replace_extension
+.extern analyze_struct_declarator
+# ==== start of definition of function `x64_begarg' ====
+.text
+x64_begarg:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldidw 0;
+ret;
+.extern get_type_spec
+.data
+.align 8
+x64_ldreg_str:
+.align 8
+.qword @S509+0
+.align 8
+.qword @S510+0
+.align 8
+.qword @S511+0
+.align 8
+.qword @S512+0
+.align 8
+.qword @S513+0
+.align 8
+.qword @S514+0
+.align 8
+.qword @S515+0
+.align 8
+.qword @S516+0
+.align 8
+.qword @S517+0
+.align 8
+.qword @S518+0
+.align 8
+.qword @S519+0
+.align 8
+.qword @S520+0
+.align 8
+.qword @S521+0
+.align 8
+.qword @S522+0
+.extern cfg_nodes_counter
+.bss
+.align 8
+enclosing_function:
+.res 8
+.extern analyze_function_definition
+.extern strdup
+.extern bset_new
+# ==== start of definition of function `x64_spill_reg_args' ====
+.text
+x64_spill_reg_args:
+addsp 44;        
+# param:`p', offset:-24
+# param:`offs', offset:-28
+# var: r, offset: 4
+# var: nfree_reg, offset: 8
+# var: tmp, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 73;
+eqdw;
+jmpf @L819;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L819;
+ldidw 1;
+jmp @L820;
+@L819:
+ldidw 0;
+@L820:
+jmpf @L821;
+ldiqw 0;
+ret;
+@L821:
+ldbp -24;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L822:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L824;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L825;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 33;
+eqdw;
+jmpf @L825;
+ldidw 1;
+jmp @L826;
+@L825:
+ldidw 0;
+@L826:
+jmpf @L827;
+ldbp -28;
+lddw;
+ldiqw @S523;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S524;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldidw 8;
+subdw;
+ldiqw @S525;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S526;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldidw 16;
+subdw;
+ldiqw @S527;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S528;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldidw 24;
+subdw;
+ldiqw @S529;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S530;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldidw 32;
+subdw;
+ldiqw @S531;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S532;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldidw 40;
+subdw;
+ldiqw @S533;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S534;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L827:
+@L823:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L822;
+@L824:
+ldiqw big_return;
+lddw;
+jmpf @L828;
+ldidw 5;
+jmp @L829;
+@L828:
+ldidw 6;
+@L829:
+ldbp 8;
+stdw;
+pop;
+@L830:
+ldbp -24;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L831;
+# var: siz, offset: 24
+# var: ty, offset: 32
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 32;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 32;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 24;
+stdw;
+ldidw 16;
+ugtdw;
+jmpt @L832;
+ldbp 24;
+lddw;
+ldbp 8;
+lddw;
+ldidw 8;
+muldw;
+ugtdw;
+jmpt @L832;
+ldidw 0;
+jmp @L833;
+@L832:
+ldidw 1;
+@L833:
+jmpf @L834;
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+jmp @L830;
+@L834:
+ldbp 24;
+lddw;
+ldidw 8;
+ugtdw;
+jmpf @L835;
+ldiqw x64_arg_reg;
+ldidw 6;
+ldbp 8;
+lddw;
+subdw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxdw 4;
+ldbp 4;
+stdw;
+pop;
+ldiqw x64_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp -28;
+lddw;
+ldiqw @S535;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S536;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldidw 8;
+subdw;
+ldbp -28;
+stdw;
+pop;
+ldiqw x64_arg_reg;
+ldidw 6;
+ldbp 8;
+lddw;
+subdw;
+dw2qw;
+ldxdw 4;
+ldbp 4;
+stdw;
+pop;
+ldiqw x64_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp -28;
+lddw;
+ldiqw @S537;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S538;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldidw 2;
+subdw;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldidw 8;
+subdw;
+ldbp -28;
+stdw;
+pop;
+jmp @L836;
+@L835:
+ldiqw x64_arg_reg;
+ldidw 6;
+ldbp 8;
+lddw;
+subdw;
+dw2qw;
+ldxdw 4;
+ldbp 4;
+stdw;
+pop;
+ldiqw x64_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp -28;
+lddw;
+ldiqw @S539;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S540;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+decldw 8;
+ldbp -28;
+lddw;
+ldidw 8;
+subdw;
+ldbp -28;
+stdw;
+pop;
+@L836:
+ldbp -24;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -24;
+stqw;
+pop;
+pop;
+jmp @L830;
+@L831:
+ldidw 0;
+ret;
+.extern arena_new
+.data
+.align 4
+x64_arg_reg:
+.align 4
+.dword 5
+.align 4
+.dword 4
+.align 4
+.dword 3
+.align 4
+.dword 2
+.align 4
+.dword 6
+.align 4
+.dword 7
+# ==== start of definition of function `x64_llzx' ====
+.text
+x64_llzx:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw need_to_extend;
+lddw;
+jmpf @L837;
+ldiqw x64_ldreg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_ldreg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S541;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S542;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L837:
+@L838:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L839:
+ldidw 0;
+jmpf @L840;
+jmp @L838;
+@L840:
+ldidw 0;
+ret;
+.extern analyze_init_declarator
+# ==== start of definition of function `do_relop_jump' ====
+.text
+do_relop_jump:
+addsp 24;        
+# param:`i', offset:-20
+# param:`flags', offset:-28
+# param:`tar', offset:-32
+# param:`arg1', offset:-36
+# param:`arg2', offset:-40
+# var: nid, offset: 4
+# var: j, offset: 8
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -36;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -40;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldidw 1;
+adddw;
+ldbp 8;
+stdw;
+pop;
+@L841:
+# var: lab, offset: 12
+# var: tar_2, offset: 16
+# var: tar_3, offset: 20
+# var: arg2_2, offset: 24
+@L844:
+ldbp 8;
+lddw;
+ldiqw func_last_quad;
+lddw;
+sletdw;
+notdw;
+jmpf @L847;
+ldidw 1153;
+ldiqw @S543;
+ldiqw @S544;
+ldiqw @S545;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L847:
+@L845:
+ldidw 0;
+jmpf @L846;
+jmp @L844;
+@L846:
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 37;
+neqdw;
+jmpt @L848;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+lddw;
+neqdw;
+jmpt @L848;
+ldidw 0;
+jmp @L849;
+@L848:
+ldidw 1;
+@L849:
+jmpf @L850;
+jmp @L842;
+@L850:
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 20;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 24;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L851;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T852;
+jmptab;
+@L854:
+ldbp 12;
+lddw;
+ldiqw @S546;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S547;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L853;
+@L855:
+ldbp 12;
+lddw;
+ldiqw @S548;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S549;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L853;
+@L856:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L857;
+ldbp 12;
+lddw;
+ldiqw @S550;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S551;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L858;
+@L857:
+ldbp 12;
+lddw;
+ldiqw @S552;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S553;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L858:
+jmp @L853;
+@L859:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L860;
+ldbp 12;
+lddw;
+ldiqw @S554;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S555;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L861;
+@L860:
+ldbp 12;
+lddw;
+ldiqw @S556;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S557;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L861:
+jmp @L853;
+@L862:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L863;
+ldbp 12;
+lddw;
+ldiqw @S558;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S559;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L864;
+@L863:
+ldbp 12;
+lddw;
+ldiqw @S560;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S561;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L864:
+jmp @L853;
+@L865:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L866;
+ldbp 12;
+lddw;
+ldiqw @S562;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S563;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L867;
+@L866:
+ldbp 12;
+lddw;
+ldiqw @S564;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S565;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L867:
+jmp @L853;
+@L853:
+.data
+.align 8
+@T852:
+.dword 10
+.dword 6
+.qword @L853
+.qword @L854
+.qword @L855
+.qword @L856
+.qword @L859
+.qword @L862
+.qword @L865
+.text
+jmp @L868;
+@L851:
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T869;
+jmptab;
+@L871:
+ldbp 12;
+lddw;
+ldiqw @S566;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S567;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L870;
+@L872:
+ldbp 12;
+lddw;
+ldiqw @S568;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S569;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L870;
+@L873:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L874;
+ldbp 12;
+lddw;
+ldiqw @S570;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S571;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L875;
+@L874:
+ldbp 12;
+lddw;
+ldiqw @S572;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S573;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L875:
+jmp @L870;
+@L876:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L877;
+ldbp 12;
+lddw;
+ldiqw @S574;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S575;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L878;
+@L877:
+ldbp 12;
+lddw;
+ldiqw @S576;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S577;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L878:
+jmp @L870;
+@L879:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L880;
+ldbp 12;
+lddw;
+ldiqw @S578;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S579;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L881;
+@L880:
+ldbp 12;
+lddw;
+ldiqw @S580;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S581;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L881:
+jmp @L870;
+@L882:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L883;
+ldbp 12;
+lddw;
+ldiqw @S582;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S583;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L884;
+@L883:
+ldbp 12;
+lddw;
+ldiqw @S584;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S585;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L884:
+jmp @L870;
+@L870:
+.data
+.align 8
+@T869:
+.dword 10
+.dword 6
+.qword @L870
+.qword @L871
+.qword @L872
+.qword @L873
+.qword @L876
+.qword @L879
+.qword @L882
+.text
+@L868:
+ldidw 39;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L843;
+@L842:
+incldw 8;
+jmp @L841;
+@L843:
+ldidw 0;
+ret;
+.extern cfg_function_to_print
+.extern strncmp
+.extern arena_set_nom_siz
+.extern bset_union_diff
+.bss
+.align 4
+string_literals_counter:
+.res 4
+# ==== start of definition of function `x64_neg' ====
+.text
+x64_neg:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw x64_islong;
+call 4;
+pop;
+jmpf @L885;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+jmp @L886;
+@L885:
+ldiqw x64_ldreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+@L886:
+ldiqw @S586;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S587;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L887:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L888:
+ldidw 0;
+jmpf @L889;
+jmp @L887;
+@L889:
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_neq' ====
+.text
+x64_neq:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+# var: res, offset: 16
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L892;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L894;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L894;
+ldidw 0;
+jmp @L895;
+@L894:
+ldidw 1;
+@L895:
+jmpt @L892;
+ldidw 0;
+jmp @L893;
+@L892:
+ldidw 1;
+@L893:
+jmpt @L890;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L890;
+ldidw 0;
+jmp @L891;
+@L890:
+ldidw 1;
+@L891:
+jmpf @L896;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+jmp @L897;
+@L896:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 16;
+stdw;
+pop;
+@L897:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L898;
+ldbp -32;
+lddw;
+ldiqw x64_get_operand64;
+call 4;
+ldiqw x64_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S588;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S589;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L899;
+@L898:
+ldbp -32;
+lddw;
+ldiqw x64_get_operand32;
+call 4;
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S590;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S591;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L899:
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L900;
+ldiqw x64_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S592;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S593;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x64_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_ldreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S594;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S595;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L901:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L902:
+ldidw 0;
+jmpf @L903;
+jmp @L901;
+@L903:
+jmp @L904;
+@L900:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L904:
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_compare_against_constant' ====
+.text
+x64_compare_against_constant:
+addsp 20;        
+# param:`a', offset:-20
+# param:`c', offset:-24
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L905;
+@L906:
+ldidw 0;
+notdw;
+jmpf @L909;
+ldidw 813;
+ldiqw @S596;
+ldiqw @S597;
+ldiqw @S598;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L909:
+@L907:
+ldidw 0;
+jmpf @L908;
+jmp @L906;
+@L908:
+jmp @L910;
+@L905:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L911;
+@L912:
+ldidw 0;
+notdw;
+jmpf @L915;
+ldidw 815;
+ldiqw @S599;
+ldiqw @S600;
+ldiqw @S601;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L915:
+@L913:
+ldidw 0;
+jmpf @L914;
+jmp @L912;
+@L914:
+jmp @L916;
+@L911:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L917;
+# var: e, offset: 8
+# var: siz_str, offset: 16
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L918;
+ldbp -24;
+lddw;
+ldiqw x64_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxqw 8;
+ldiqw @S602;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S603;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L918:
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L919;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L920;
+@L919:
+ldidw 1;
+negdw;
+@L920:
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L921;
+ldbp -24;
+lddw;
+ldiqw x64_reg_str;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L922;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L923;
+@L922:
+ldidw 1;
+negdw;
+@L923:
+dw2qw;
+ldxqw 8;
+ldiqw @S604;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S605;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L921:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T924;
+switch;
+@L926:
+@L927:
+@L928:
+ldiqw @S606;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L925;
+@L929:
+@L930:
+ldiqw @S607;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L925;
+@L931:
+@L932:
+@L933:
+ldiqw @S608;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L925;
+@L934:
+ldiqw @S609;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L925;
+@L925:
+.data
+.align 8
+@T924:
+.dword 9
+.dword 49
+.dword 55
+.dword 60
+.dword 64
+.dword 72
+.dword 106
+.dword 107
+.dword 108
+.qword @L934
+.qword @L931
+.qword @L927
+.qword @L926
+.qword @L929
+.qword @L928
+.qword @L932
+.qword @L933
+.qword @L930
+.text
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L935;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L936;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw @S610;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 44;
+pop;
+pop;
+ldiqw @S611;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L937;
+@L936:
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw @S612;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S613;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L937:
+jmp @L938;
+@L935:
+ldbp -24;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw @S614;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S615;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L938:
+jmp @L939;
+@L917:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L940;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L941;
+ldbp -24;
+lddw;
+ldiqw x64_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ldxqw 8;
+ldiqw @S616;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S617;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L942;
+@L941:
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L943;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L944;
+@L943:
+ldidw 1;
+negdw;
+@L944:
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L945;
+ldbp -24;
+lddw;
+ldiqw x64_reg_str;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L946;
+ldiqw x64_home_reg;
+ldiqw ra_reg_of_nid;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxb 1;
+dw2qw;
+ldxdw 4;
+jmp @L947;
+@L946:
+ldidw 1;
+negdw;
+@L947:
+dw2qw;
+ldxqw 8;
+ldiqw @S618;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S619;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L948;
+@L945:
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldiqw @S620;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S621;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L948:
+@L942:
+@L940:
+@L939:
+@L916:
+@L910:
+ldidw 0;
+ret;
+.extern analyze_multiplicative_expression
+.extern ra_init
+.extern analyze_additive_expression
+# ==== start of definition of function `x64_and' ====
+.text
+x64_and:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw x64_islong;
+call 4;
+pop;
+jmpf @L949;
+ldbp -32;
+lddw;
+ldiqw x64_get_operand64;
+call 4;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S622;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S623;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L950;
+@L949:
+ldbp -32;
+lddw;
+ldiqw x64_get_operand32;
+call 4;
+ldiqw x64_ldreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S624;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S625;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L950:
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L951:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L952:
+ldidw 0;
+jmpf @L953;
+jmp @L951;
+@L953:
+ldidw 0;
+ret;
+.extern stat_number_of_c_tokens
+.extern strncpy
+.extern bset_clear
+.extern decl_save_pch
+.extern bset_card
+.extern analyze_assignment_expression
+.bss
+.align 4
+need_to_extend:
+.res 4
+.extern ic_instructions
+.extern new_extern_id_node
+.extern decl_load_pch
+.extern bset_union
+.extern analyze_translation_unit
+.extern strnlen
+# ==== start of definition of function `x64_arg' ====
+.text
+x64_arg:
+addsp 36;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cls, offset: 4
+# var: cat, offset: 8
+# var: ty, offset: 16
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L954:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L957;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+neqdw;
+jmpt @L957;
+ldidw 0;
+jmp @L958;
+@L957:
+ldidw 1;
+@L958:
+notdw;
+jmpf @L959;
+ldidw 2011;
+ldiqw @S626;
+ldiqw @S627;
+ldiqw @S628;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L959:
+@L955:
+ldidw 0;
+jmpf @L956;
+jmp @L954;
+@L956:
+ldbp -20;
+lddw;
+ldiqw x64_arg_class;
+call 4;
+pop;
+ldbp 4;
+stdw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L960;
+# var: p, offset: 24
+ldiqw reg_args;
+ldiqw nreg_args;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 20;
+mulqw;
+addqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldbp 24;
+ldqw;
+ldiqw 4;
+addqw;
+stdw;
+pop;
+ldiqw x64_arg_reg;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 24;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldidw 1;
+negdw;
+ldbp 24;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 24;
+ldqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldbp 16;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L961;
+ldbp 8;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L961;
+ldidw 0;
+jmp @L962;
+@L961:
+ldidw 1;
+@L962:
+jmpf @L963;
+ldbp 16;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 16;
+addqw;
+stdw;
+pop;
+ldbp 24;
+ldqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 8;
+ugtdw;
+jmpf @L964;
+ldiqw x64_arg_reg;
+ldbp 4;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldxdw 4;
+ldbp 24;
+ldqw;
+ldiqw 12;
+addqw;
+stdw;
+pop;
+@L964:
+@L963:
+ldiqw 0;
+ret;
+@L960:
+ldbp 16;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 8;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L965;
+ldbp 8;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L965;
+ldidw 0;
+jmp @L966;
+@L965:
+ldidw 1;
+@L966:
+jmpf @L967;
+# var: siz, offset: 24
+# var: asiz, offset: 28
+# var: cluttered, offset: 32
+# var: savnb, offset: 36
+ldbp 16;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldidw 8;
+ldbp 24;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldbp 28;
+stdw;
+pop;
+ldbp 28;
+lddw;
+ldiqw @S629;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S630;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw arg_nb;
+lddw;
+ldbp 28;
+lddw;
+adddw;
+ldiqw arg_nb;
+stdw;
+pop;
+ldidw 0;
+ldbp 36;
+stdw;
+ldbp 32;
+stdw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 4;
+neqdw;
+jmpf @L968;
+ldiqw reg_descr_tab;
+ldidw 4;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L969;
+ldbp 32;
+lddw;
+ldidw 1;
+ordw;
+ldbp 32;
+stdw;
+pop;
+ldiqw @S631;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S632;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 36;
+lddw;
+ldidw 8;
+adddw;
+ldbp 36;
+stdw;
+pop;
+@L969:
+ldbp -28;
+lddw;
+ldidw 4;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+@L968:
+ldiqw reg_descr_tab;
+ldidw 5;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L970;
+ldbp 32;
+lddw;
+ldidw 2;
+ordw;
+ldbp 32;
+stdw;
+pop;
+ldiqw @S633;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S634;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 36;
+lddw;
+ldidw 8;
+adddw;
+ldbp 36;
+stdw;
+pop;
+@L970:
+ldbp 36;
+lddw;
+notdw;
+jmpf @L971;
+ldiqw @S635;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S636;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L972;
+@L971:
+ldbp 36;
+lddw;
+ldiqw @S637;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S638;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L972:
+ldiqw reg_descr_tab;
+ldidw 2;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L973;
+ldbp 32;
+lddw;
+ldidw 4;
+ordw;
+ldbp 32;
+stdw;
+pop;
+ldiqw @S639;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S640;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L973:
+ldbp 24;
+lddw;
+ldiqw @S641;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S642;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S643;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S644;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 32;
+lddw;
+ldidw 4;
+anddw;
+jmpf @L974;
+ldiqw @S645;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S646;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L974:
+ldbp 32;
+lddw;
+ldidw 2;
+anddw;
+jmpf @L975;
+ldiqw @S647;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S648;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L975:
+ldbp 32;
+lddw;
+ldidw 1;
+anddw;
+jmpf @L976;
+ldiqw @S649;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S650;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L976:
+jmp @L977;
+@L967:
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L978;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L978;
+ldidw 1;
+jmp @L979;
+@L978:
+ldidw 0;
+@L979:
+jmpf @L980;
+# var: r, offset: 24
+# var: vr, offset: 28
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 28;
+stdw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 28;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 28;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 24;
+lddw;
+ldbp 28;
+lddw;
+ldiqw x64_store_home;
+call 12;
+pop;
+pop;
+ldiqw x64_reg_str;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S651;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S652;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw arg_nb;
+lddw;
+ldidw 8;
+adddw;
+ldiqw arg_nb;
+stdw;
+pop;
+jmp @L981;
+@L980:
+ldbp -28;
+lddw;
+ldiqw x64_get_operand64;
+call 4;
+ldiqw @S653;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S654;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw arg_nb;
+lddw;
+ldidw 8;
+adddw;
+ldiqw arg_nb;
+stdw;
+pop;
+@L981:
+@L977:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern bset_new_in
+.extern analyze_enumerator
+.extern targeting_arch64
+# ==== start of definition of function `x64_asn' ====
+.text
+x64_asn:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+@L982:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L983:
+ldidw 0;
+jmpf @L984;
+jmp @L982;
+@L984:
+ldidw 0;
+ret;
+.extern set_attributes
+.extern is_typedef_name
+.extern dflow_exit_function
+.extern arena_reset
+.extern fread
+.extern strrchr
+.data
+.align 4
+curr_segment:
+.align 4
+.dword -1
+.extern bset_next
+# ==== start of definition of function `update_tar_descriptors' ====
+.text
+update_tar_descriptors:
+addsp 0;         
+# param:`res', offset:-20
+# param:`tar', offset:-24
+# param:`liveness', offset:-28
+# param:`next_use', offset:-32
+ldbp -20;
+lddw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -24;
+lddw;
+ldiqw reg_descr_tab;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+notdw;
+jmpf @L985;
+ldbp -28;
+ldub;
+jmpf @L986;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x64_store;
+call 8;
+pop;
+pop;
+@L986:
+ldidw 1;
+negdw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L985:
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_static_expr' ====
+.text
+x64_static_expr:
+addsp 28;        
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T987;
+jmptab;
+@L989:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T990;
+switch;
+@L992:
+# var: pi, offset: 4
+# var: ii, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L993;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+jmp @L994;
+@L993:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L994:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L995;
+# var: ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S655;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+@L995:
+jmp @L991;
+@L996:
+@L997:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 71;
+neqdw;
+jmpf @L998;
+# var: m, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw get_member_descriptor;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+jmpf @L999;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw @S656;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+@L999:
+jmp @L1000;
+@L998:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+@L1000:
+jmp @L991;
+@L1001:
+@L1002:
+@L1003:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+jmp @L991;
+@L1004:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L1005;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+ldiqw @S657;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+jmp @L1006;
+@L1005:
+# var: pi, offset: 4
+# var: ii, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L1007;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+jmp @L1008;
+@L1007:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L1008:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1009;
+# var: ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S658;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+@L1009:
+@L1006:
+jmp @L991;
+@L1010:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L1011;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+ldiqw @S659;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+jmp @L1012;
+@L1011:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1013;
+# var: ty, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 8;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S660;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+@L1013:
+@L1012:
+jmp @L991;
+@L1014:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ordw;
+jmpf @L1015;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+jmp @L1016;
+@L1015:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw x64_static_expr;
+call 8;
+pop;
+pop;
+@L1016:
+jmp @L991;
+@L1017:
+@L1018:
+ldidw 0;
+notdw;
+jmpf @L1021;
+ldidw 2687;
+ldiqw @S661;
+ldiqw @S662;
+ldiqw @S663;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L1021:
+@L1019:
+ldidw 0;
+jmpf @L1020;
+jmp @L1018;
+@L1020:
+@L991:
+.data
+.align 8
+@T990:
+.dword 10
+.dword 6
+.dword 7
+.dword 12
+.dword 13
+.dword 30
+.dword 97
+.dword 101
+.dword 103
+.dword 105
+.qword @L1017
+.qword @L996
+.qword @L997
+.qword @L1004
+.qword @L1010
+.qword @L1014
+.qword @L992
+.qword @L1002
+.qword @L1001
+.qword @L1003
+.text
+jmp @L988;
+@L1022:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S664;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+jmp @L988;
+@L1023:
+ldiqw string_literals_counter;
+lddw;
+ldiqw @S665;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S666;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw str_lits;
+ldqw;
+ldiqw emit_raw_string;
+call 16;
+pop;
+pop;
+ldiqw string_literals_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S667;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+jmp @L988;
+@L1024:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L1025;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw enclosing_function;
+ldqw;
+ldiqw @S668;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+jmp @L1026;
+@L1025:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S669;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+@L1026:
+jmp @L988;
+@L988:
+.data
+.align 8
+@T987:
+.dword 0
+.dword 4
+.qword @L988
+.qword @L989
+.qword @L1022
+.qword @L1023
+.qword @L1024
+.text
+ldidw 0;
+ret;
+.extern disable_warnings
+.extern string_append
+# ==== start of definition of function `x64_nop' ====
+.text
+x64_nop:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_not' ====
+.text
+x64_not:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x64_load;
+call 8;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldiqw x64_islong;
+call 4;
+pop;
+jmpf @L1027;
+ldiqw x64_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S670;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S671;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L1028;
+@L1027:
+ldiqw x64_ldreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S672;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S673;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L1028:
+ldiqw x64_lbreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S674;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S675;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x64_lbreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_ldreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S676;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S677;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L1029:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L1030:
+ldidw 0;
+jmpf @L1031;
+jmp @L1029;
+@L1031:
+ldidw 0;
+ret;
+.extern ra_allocate
+.bss
+.align 8
+curr_func:
+.res 8
+.extern bset_diff
+.extern install_macro
+# ==== start of definition of function `get_reg' ====
+.text
+get_reg:
+addsp 4;         
+# param:`i', offset:-20
+# var: arg1, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L1036;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L1036;
+ldidw 0;
+jmp @L1037;
+@L1036:
+ldidw 1;
+@L1037:
+notdw;
+jmpf @L1034;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L1034;
+ldidw 1;
+jmp @L1035;
+@L1034:
+ldidw 0;
+@L1035:
+jmpf @L1032;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+notdw;
+jmpf @L1032;
+ldidw 1;
+jmp @L1033;
+@L1032:
+ldidw 0;
+@L1033:
+jmpf @L1038;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxdw 4;
+dw2qw;
+ret;
+@L1038:
+ldiqw get_reg0;
+call 0;
+pop;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern bset_inters
+# ==== start of definition of function `x64_load_eightbyte' ====
+.text
+x64_load_eightbyte:
+addsp 8;         
+# param:`r', offset:-20
+# param:`b', offset:-24
+# param:`offs', offset:-28
+# param:`n', offset:-32
+# var: piece, offset: 4
+# var: pos, offset: 8
+ldbp -32;
+lddw;
+ldiqw @T1039;
+jmptab;
+@L1041:
+ldbp -28;
+lddw;
+ldiqw x64_reg_str;
+ldbp -24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S678;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S679;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1042:
+ldbp -28;
+lddw;
+ldiqw x64_reg_str;
+ldbp -24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_ldreg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S680;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S681;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1043:
+ldbp -28;
+lddw;
+ldiqw x64_reg_str;
+ldbp -24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S682;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S683;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1044:
+ldbp -28;
+lddw;
+ldiqw x64_reg_str;
+ldbp -24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S684;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S685;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L1040:
+.data
+.align 8
+@T1039:
+.dword 1
+.dword 8
+.qword @L1040
+.qword @L1044
+.qword @L1043
+.qword @L1040
+.qword @L1042
+.qword @L1040
+.qword @L1040
+.qword @L1040
+.qword @L1041
+.text
+ldiqw @S686;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S687;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+ldidw 4;
+ldbp 4;
+stdw;
+pop;
+@L1045:
+ldbp 4;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L1047;
+ldbp -32;
+lddw;
+ldbp 4;
+lddw;
+anddw;
+notdw;
+jmpf @L1048;
+jmp @L1046;
+@L1048:
+ldbp 4;
+lddw;
+ldidw 4;
+eqdw;
+jmpf @L1049;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+adddw;
+ldiqw x64_reg_str;
+ldbp -24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S688;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S689;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L1050;
+@L1049:
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+adddw;
+ldiqw x64_reg_str;
+ldbp -24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 4;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L1051;
+ldiqw @S690;
+jmp @L1052;
+@L1051:
+ldiqw @S691;
+@L1052:
+ldiqw @S692;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S693;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L1050:
+ldbp 8;
+lddw;
+jmpf @L1053;
+ldbp 8;
+lddw;
+ldidw 8;
+muldw;
+ldiqw @S694;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S695;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L1053:
+ldiqw @S696;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S697;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+lddw;
+ldbp 4;
+lddw;
+adddw;
+ldbp 8;
+stdw;
+pop;
+@L1046:
+ldbp 4;
+lddw;
+ldidw 1;
+srldw;
+ldbp 4;
+stdw;
+pop;
+jmp @L1045;
+@L1047:
+ldiqw x64_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S698;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S699;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern edge_add
+.extern string_buf
+.extern ferror
+.extern random
+# ==== start of definition of function `new_string_literal' ====
+.text
+new_string_literal:
+addsp 0;         
+# param:`a', offset:-20
+ldiqw string_literals_counter;
+lddw;
+ldiqw @S700;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S701;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw str_lits;
+ldqw;
+ldiqw emit_raw_string;
+call 16;
+pop;
+pop;
+ldiqw string_literals_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern ic_instructions_counter
+.extern free
+.extern malloc
+.extern get_external_declarations
+# ==== start of definition of function `x64_islong' ====
+.text
+x64_islong:
+addsp 0;         
+# param:`cat', offset:-20
+ldbp -20;
+lddw;
+ldiqw @T1054;
+switch;
+@L1056:
+@L1057:
+@L1058:
+@L1059:
+@L1060:
+@L1061:
+@L1062:
+ldidw 1;
+dw2qw;
+ret;
+@L1055:
+.data
+.align 8
+@T1054:
+.dword 8
+.dword 11
+.dword 61
+.dword 97
+.dword 98
+.dword 109
+.dword 110
+.dword 111
+.qword @L1055
+.qword @L1056
+.qword @L1059
+.qword @L1057
+.qword @L1058
+.qword @L1060
+.qword @L1061
+.qword @L1062
+.text
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `x64_jmp' ====
+.text
+x64_jmp:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 31;
+eqdw;
+jmpf @L1063;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L1063;
+ldidw 1;
+jmp @L1064;
+@L1063:
+ldidw 0;
+@L1064:
+jmpf @L1065;
+ldiqw 0;
+ret;
+@L1065:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S702;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S703;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 4
+pinned:
+.res 56
+.extern new_decl_list_node
+.bss
+.align 4
+qrets_to_fix_counter:
+.res 4
+.extern compute_liveness_and_next_use
+.extern srandom
+.extern lookup_struct_descriptor
+.extern new_exec_node
+.extern get_alignment
+# ==== start of definition of function `x64_cgen' ====
+.text
+x64_cgen:
+.global x64_cgen
+addsp 40;        
+# param:`outf', offset:-24
+# var: i, offset: 4
+# var: j, offset: 8
+# var: ed, offset: 16
+# var: func_def_list, offset: 24
+# var: ext_sym_list, offset: 32
+ldbp -24;
+ldqw;
+ldiqw x64_output_file;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldbp 24;
+ldiqw ic_main;
+call 16;
+pop;
+pop;
+ldiqw ra_init;
+call 0;
+pop;
+pop;
+ldidw 512;
+ldiqw string_new;
+call 4;
+ldiqw asm_decls;
+stqw;
+pop;
+pop;
+ldidw 512;
+ldiqw string_new;
+call 4;
+ldiqw str_lits;
+stqw;
+pop;
+pop;
+ldidw 1024;
+ldiqw string_new;
+call 4;
+ldiqw func_body;
+stqw;
+pop;
+pop;
+ldidw 1024;
+ldiqw string_new;
+call 4;
+ldiqw func_prolog;
+stqw;
+pop;
+pop;
+ldidw 1024;
+ldiqw string_new;
+call 4;
+ldiqw func_epilog;
+stqw;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw addr_descr_tab;
+stqw;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L1066:
+ldbp 24;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1068;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw x64_function_definition;
+call 16;
+pop;
+pop;
+@L1067:
+incldw 4;
+jmp @L1066;
+@L1068:
+ldiqw func_body;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw @S704;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S705;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x64_allocate_static_objects;
+call 0;
+pop;
+pop;
+ldiqw @S706;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S707;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+@L1069:
+ldbp 32;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L1071;
+# var: tmp, offset: 40
+ldiqw nid_counter;
+lddw;
+ldbp 40;
+stdw;
+pop;
+ldidw 0;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_var_nid;
+call 12;
+pop;
+pop;
+ldbp 40;
+lddw;
+ldiqw nid_counter;
+lddw;
+eqdw;
+jmpf @L1072;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S708;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S709;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L1072:
+@L1070:
+incldw 8;
+jmp @L1069;
+@L1071:
+ldiqw include_libc;
+lddw;
+jmpf @L1073;
+ldiqw @S710;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S711;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S712;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S713;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L1073:
+ldiqw string_literals_counter;
+lddw;
+jmpf @L1074;
+ldiqw @S714;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S715;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S716;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S717;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L1074:
+ldiqw asm_decls;
+ldqw;
+ldiqw x64_write;
+call 8;
+pop;
+pop;
+ldiqw str_lits;
+ldqw;
+ldiqw x64_write;
+call 8;
+pop;
+pop;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw str_lits;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern fgetc
+.data
+@S0:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S1:
+.byte 10
+.byte 0
+@S2:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S3:
+.byte 10
+.byte 0
+@S4:
+.byte 108
+.byte 101
+.byte 97
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S5:
+.byte 10
+.byte 0
+@S6:
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S7:
+.byte 10
+.byte 0
+@S8:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S9:
+.byte 10
+.byte 0
+@S10:
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S11:
+.byte 10
+.byte 0
+@S12:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 98
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S13:
+.byte 10
+.byte 0
+@S14:
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S15:
+.byte 10
+.byte 0
+@S16:
+.byte 103
+.byte 108
+.byte 111
+.byte 98
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S17:
+.byte 10
+.byte 0
+@S18:
+.byte 36
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S19:
+.byte 10
+.byte 0
+@S20:
+.byte 114
+.byte 101
+.byte 115
+.byte 98
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S21:
+.byte 10
+.byte 0
+@S22:
+.byte 97
+.byte 108
+.byte 0
+@S23:
+.byte 98
+.byte 108
+.byte 0
+@S24:
+.byte 99
+.byte 108
+.byte 0
+@S25:
+.byte 100
+.byte 108
+.byte 0
+@S26:
+.byte 115
+.byte 105
+.byte 108
+.byte 0
+@S27:
+.byte 100
+.byte 105
+.byte 108
+.byte 0
+@S28:
+.byte 114
+.byte 56
+.byte 98
+.byte 0
+@S29:
+.byte 114
+.byte 57
+.byte 98
+.byte 0
+@S30:
+.byte 114
+.byte 49
+.byte 48
+.byte 98
+.byte 0
+@S31:
+.byte 114
+.byte 49
+.byte 49
+.byte 98
+.byte 0
+@S32:
+.byte 114
+.byte 49
+.byte 50
+.byte 98
+.byte 0
+@S33:
+.byte 114
+.byte 49
+.byte 51
+.byte 98
+.byte 0
+@S34:
+.byte 114
+.byte 49
+.byte 52
+.byte 98
+.byte 0
+@S35:
+.byte 114
+.byte 49
+.byte 53
+.byte 98
+.byte 0
+@S36:
+.byte 115
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S37:
+.byte 10
+.byte 0
+@S38:
+.byte 115
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 99
+.byte 108
+.byte 0
+@S39:
+.byte 10
+.byte 0
+@S40:
+.byte 115
+.byte 104
+.byte 114
+.byte 0
+@S41:
+.byte 115
+.byte 97
+.byte 114
+.byte 0
+@S42:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S43:
+.byte 10
+.byte 0
+@S44:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 99
+.byte 108
+.byte 0
+@S45:
+.byte 10
+.byte 0
+@S46:
+.byte 97
+.byte 120
+.byte 0
+@S47:
+.byte 98
+.byte 120
+.byte 0
+@S48:
+.byte 99
+.byte 120
+.byte 0
+@S49:
+.byte 100
+.byte 120
+.byte 0
+@S50:
+.byte 115
+.byte 105
+.byte 0
+@S51:
+.byte 100
+.byte 105
+.byte 0
+@S52:
+.byte 114
+.byte 56
+.byte 119
+.byte 0
+@S53:
+.byte 114
+.byte 57
+.byte 119
+.byte 0
+@S54:
+.byte 114
+.byte 49
+.byte 48
+.byte 119
+.byte 0
+@S55:
+.byte 114
+.byte 49
+.byte 49
+.byte 119
+.byte 0
+@S56:
+.byte 114
+.byte 49
+.byte 50
+.byte 119
+.byte 0
+@S57:
+.byte 114
+.byte 49
+.byte 51
+.byte 119
+.byte 0
+@S58:
+.byte 114
+.byte 49
+.byte 52
+.byte 119
+.byte 0
+@S59:
+.byte 114
+.byte 49
+.byte 53
+.byte 119
+.byte 0
+@S60:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S61:
+.byte 10
+.byte 0
+@S62:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S63:
+.byte 10
+.byte 0
+@S64:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S65:
+.byte 10
+.byte 0
+@S66:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S67:
+.byte 10
+.byte 0
+@S68:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S69:
+.byte 10
+.byte 0
+@S70:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S71:
+.byte 10
+.byte 0
+@S72:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S73:
+.byte 10
+.byte 0
+@S74:
+.byte 114
+.byte 97
+.byte 120
+.byte 0
+@S75:
+.byte 114
+.byte 98
+.byte 120
+.byte 0
+@S76:
+.byte 114
+.byte 99
+.byte 120
+.byte 0
+@S77:
+.byte 114
+.byte 100
+.byte 120
+.byte 0
+@S78:
+.byte 114
+.byte 115
+.byte 105
+.byte 0
+@S79:
+.byte 114
+.byte 100
+.byte 105
+.byte 0
+@S80:
+.byte 114
+.byte 56
+.byte 0
+@S81:
+.byte 114
+.byte 57
+.byte 0
+@S82:
+.byte 114
+.byte 49
+.byte 48
+.byte 0
+@S83:
+.byte 114
+.byte 49
+.byte 49
+.byte 0
+@S84:
+.byte 114
+.byte 49
+.byte 50
+.byte 0
+@S85:
+.byte 114
+.byte 49
+.byte 51
+.byte 0
+@S86:
+.byte 114
+.byte 49
+.byte 52
+.byte 0
+@S87:
+.byte 114
+.byte 49
+.byte 53
+.byte 0
+@S88:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S89:
+.byte 10
+.byte 0
+@S90:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S91:
+.byte 10
+.byte 0
+@S92:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S93:
+.byte 10
+.byte 0
+@S94:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S95:
+.byte 10
+.byte 0
+@S96:
+.byte 103
+.byte 101
+.byte 0
+@S97:
+.byte 97
+.byte 101
+.byte 0
+@S98:
+.byte 115
+.byte 101
+.byte 116
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S99:
+.byte 10
+.byte 0
+@S100:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S101:
+.byte 10
+.byte 0
+@S102:
+.byte 37
+.byte 115
+.byte 32
+.byte 61
+.byte 62
+.byte 32
+.byte 37
+.byte 115
+.byte 10
+.byte 0
+@S103:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S104:
+.byte 10
+.byte 0
+@S105:
+.byte 106
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S106:
+.byte 10
+.byte 0
+@S107:
+.byte 106
+.byte 110
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S108:
+.byte 10
+.byte 0
+@S109:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S110:
+.byte 10
+.byte 0
+@S111:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S112:
+.byte 10
+.byte 0
+@S113:
+.byte 115
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S114:
+.byte 10
+.byte 0
+@S115:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S116:
+.byte 10
+.byte 0
+@S117:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S118:
+.byte 10
+.byte 0
+@S119:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S120:
+.byte 10
+.byte 0
+@S121:
+.byte 103
+.byte 0
+@S122:
+.byte 97
+.byte 0
+@S123:
+.byte 115
+.byte 101
+.byte 116
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S124:
+.byte 10
+.byte 0
+@S125:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S126:
+.byte 10
+.byte 0
+@S127:
+.byte 100
+.byte 100
+.byte 32
+.byte 48
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 10
+.byte 0
+@S128:
+.byte 100
+.byte 98
+.byte 32
+.byte 48
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 10
+.byte 0
+@S129:
+.byte 120
+.byte 111
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S130:
+.byte 10
+.byte 0
+@S131:
+.byte 120
+.byte 111
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S132:
+.byte 10
+.byte 0
+@S133:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S134:
+.byte 10
+.byte 0
+@S135:
+.byte 120
+.byte 99
+.byte 104
+.byte 103
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S136:
+.byte 10
+.byte 0
+@S137:
+.byte 108
+.byte 101
+.byte 97
+.byte 32
+.byte 114
+.byte 100
+.byte 105
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 0
+@S138:
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 0
+@S139:
+.byte 10
+.byte 0
+@S140:
+.byte 120
+.byte 111
+.byte 114
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 0
+@S141:
+.byte 10
+.byte 0
+@S142:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 114
+.byte 101
+.byte 103
+.byte 48
+.byte 0
+@S143:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S144:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S145:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S146:
+.byte 10
+.byte 0
+@S147:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S148:
+.byte 10
+.byte 0
+@S149:
+.byte 108
+.byte 0
+@S150:
+.byte 98
+.byte 0
+@S151:
+.byte 115
+.byte 101
+.byte 116
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S152:
+.byte 10
+.byte 0
+@S153:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S154:
+.byte 10
+.byte 0
+@S155:
+.byte 37
+.byte 115
+.byte 32
+.byte 61
+.byte 62
+.byte 32
+.byte 37
+.byte 115
+.byte 10
+.byte 0
+@S156:
+.byte 111
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S157:
+.byte 10
+.byte 0
+@S158:
+.byte 111
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S159:
+.byte 10
+.byte 0
+@S160:
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S161:
+.byte 10
+.byte 0
+@S162:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 0
+@S163:
+.byte 10
+.byte 0
+@S164:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S165:
+.byte 10
+.byte 0
+@S166:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S167:
+.byte 10
+.byte 0
+@S168:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S169:
+.byte 10
+.byte 0
+@S170:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 0
+@S171:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S172:
+.byte 109
+.byte 111
+.byte 118
+.byte 0
+@S173:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S174:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 0
+@S175:
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S176:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 0
+@S177:
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S178:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 0
+@S179:
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 0
+@S180:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 0
+@S181:
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 0
+@S182:
+.byte 109
+.byte 111
+.byte 118
+.byte 0
+@S183:
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S184:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S185:
+.byte 10
+.byte 0
+@S186:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S187:
+.byte 10
+.byte 0
+@S188:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S189:
+.byte 10
+.byte 0
+@S190:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S191:
+.byte 10
+.byte 0
+@S192:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S193:
+.byte 10
+.byte 0
+@S194:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S195:
+.byte 10
+.byte 0
+@S196:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S197:
+.byte 10
+.byte 0
+@S198:
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 97
+.byte 114
+.byte 103
+.byte 95
+.byte 99
+.byte 108
+.byte 97
+.byte 115
+.byte 115
+.byte 0
+@S199:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S200:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S201:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 0
+@S202:
+.byte 10
+.byte 0
+@S203:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 0
+@S204:
+.byte 10
+.byte 0
+@S205:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S206:
+.byte 10
+.byte 0
+@S207:
+.byte 106
+.byte 108
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S208:
+.byte 10
+.byte 0
+@S209:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S210:
+.byte 10
+.byte 0
+@S211:
+.byte 106
+.byte 103
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S212:
+.byte 10
+.byte 0
+@S213:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S214:
+.byte 10
+.byte 0
+@S215:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 42
+.byte 56
+.byte 43
+.byte 46
+.byte 106
+.byte 116
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S216:
+.byte 10
+.byte 0
+@S217:
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S218:
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S219:
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S220:
+.byte 10
+.byte 0
+@S221:
+.byte 46
+.byte 106
+.byte 116
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S222:
+.byte 10
+.byte 0
+@S223:
+.byte 100
+.byte 113
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S224:
+.byte 10
+.byte 0
+@S225:
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S226:
+.byte 10
+.byte 0
+@S227:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S228:
+.byte 10
+.byte 0
+@S229:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S230:
+.byte 10
+.byte 0
+@S231:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 0
+@S232:
+.byte 10
+.byte 0
+@S233:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S234:
+.byte 10
+.byte 0
+@S235:
+.byte 106
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S236:
+.byte 10
+.byte 0
+@S237:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S238:
+.byte 10
+.byte 0
+@S239:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S240:
+.byte 10
+.byte 0
+@S241:
+.byte 108
+.byte 101
+.byte 0
+@S242:
+.byte 98
+.byte 101
+.byte 0
+@S243:
+.byte 115
+.byte 101
+.byte 116
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S244:
+.byte 10
+.byte 0
+@S245:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S246:
+.byte 10
+.byte 0
+@S247:
+.byte 120
+.byte 111
+.byte 114
+.byte 32
+.byte 101
+.byte 100
+.byte 120
+.byte 44
+.byte 32
+.byte 101
+.byte 100
+.byte 120
+.byte 0
+@S248:
+.byte 10
+.byte 0
+@S249:
+.byte 100
+.byte 105
+.byte 118
+.byte 0
+@S250:
+.byte 99
+.byte 113
+.byte 111
+.byte 0
+@S251:
+.byte 99
+.byte 100
+.byte 113
+.byte 0
+@S252:
+.byte 37
+.byte 115
+.byte 0
+@S253:
+.byte 10
+.byte 0
+@S254:
+.byte 105
+.byte 100
+.byte 105
+.byte 118
+.byte 0
+@S255:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S256:
+.byte 10
+.byte 0
+@S257:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 115
+.byte 105
+.byte 0
+@S258:
+.byte 10
+.byte 0
+@S259:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 100
+.byte 105
+.byte 0
+@S260:
+.byte 10
+.byte 0
+@S261:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 99
+.byte 120
+.byte 0
+@S262:
+.byte 10
+.byte 0
+@S263:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S264:
+.byte 10
+.byte 0
+@S265:
+.byte 114
+.byte 101
+.byte 112
+.byte 32
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 98
+.byte 0
+@S266:
+.byte 10
+.byte 0
+@S267:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 99
+.byte 120
+.byte 0
+@S268:
+.byte 10
+.byte 0
+@S269:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 100
+.byte 105
+.byte 0
+@S270:
+.byte 10
+.byte 0
+@S271:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 115
+.byte 105
+.byte 0
+@S272:
+.byte 10
+.byte 0
+@S273:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S274:
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S275:
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 0
+@S276:
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S277:
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S278:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S279:
+.byte 10
+.byte 0
+@S280:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S281:
+.byte 10
+.byte 0
+@S282:
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S283:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S284:
+.byte 10
+.byte 0
+@S285:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S286:
+.byte 10
+.byte 0
+@S287:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S288:
+.byte 10
+.byte 0
+@S289:
+.byte 37
+.byte 100
+.byte 0
+@S290:
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S291:
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S292:
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S293:
+.byte 108
+.byte 101
+.byte 97
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S294:
+.byte 10
+.byte 0
+@S295:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S296:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S297:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S298:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S299:
+.byte 37
+.byte 100
+.byte 0
+@S300:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S301:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S302:
+.byte 108
+.byte 101
+.byte 97
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S303:
+.byte 10
+.byte 0
+@S304:
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S305:
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S306:
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S307:
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S308:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S309:
+.byte 10
+.byte 0
+@S310:
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S311:
+.byte 10
+.byte 0
+@S312:
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S313:
+.byte 10
+.byte 0
+@S314:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S315:
+.byte 10
+.byte 0
+@S316:
+.byte 46
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S317:
+.byte 46
+.byte 116
+.byte 101
+.byte 120
+.byte 116
+.byte 0
+@S318:
+.byte 46
+.byte 98
+.byte 115
+.byte 115
+.byte 0
+@S319:
+.byte 46
+.byte 114
+.byte 111
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S320:
+.byte 116
+.byte 105
+.byte 109
+.byte 101
+.byte 115
+.byte 32
+.byte 37
+.byte 117
+.byte 32
+.byte 100
+.byte 98
+.byte 32
+.byte 48
+.byte 0
+@S321:
+.byte 10
+.byte 0
+@S322:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S323:
+.byte 10
+.byte 0
+@S324:
+.byte 116
+.byte 105
+.byte 109
+.byte 101
+.byte 115
+.byte 32
+.byte 37
+.byte 117
+.byte 32
+.byte 100
+.byte 98
+.byte 32
+.byte 48
+.byte 0
+@S325:
+.byte 10
+.byte 0
+@S326:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S327:
+.byte 10
+.byte 0
+@S328:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S329:
+.byte 10
+.byte 0
+@S330:
+.byte 116
+.byte 105
+.byte 109
+.byte 101
+.byte 115
+.byte 32
+.byte 37
+.byte 117
+.byte 32
+.byte 100
+.byte 98
+.byte 32
+.byte 48
+.byte 0
+@S331:
+.byte 10
+.byte 0
+@S332:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S333:
+.byte 10
+.byte 0
+@S334:
+.byte 100
+.byte 98
+.byte 32
+.byte 0
+@S335:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 50
+.byte 0
+@S336:
+.byte 10
+.byte 0
+@S337:
+.byte 100
+.byte 119
+.byte 32
+.byte 0
+@S338:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 52
+.byte 0
+@S339:
+.byte 10
+.byte 0
+@S340:
+.byte 100
+.byte 100
+.byte 32
+.byte 0
+@S341:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 56
+.byte 0
+@S342:
+.byte 10
+.byte 0
+@S343:
+.byte 100
+.byte 113
+.byte 32
+.byte 0
+@S344:
+.byte 10
+.byte 0
+@S345:
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 32
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S346:
+.byte 10
+.byte 0
+@S347:
+.byte 10
+.byte 0
+@S348:
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 61
+.byte 61
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 114
+.byte 116
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 61
+.byte 61
+.byte 61
+.byte 61
+.byte 0
+@S349:
+.byte 10
+.byte 0
+@S350:
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S351:
+.byte 10
+.byte 0
+@S352:
+.byte 103
+.byte 108
+.byte 111
+.byte 98
+.byte 97
+.byte 108
+.byte 32
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S353:
+.byte 10
+.byte 0
+@S354:
+.byte 36
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S355:
+.byte 10
+.byte 0
+@S356:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 98
+.byte 112
+.byte 0
+@S357:
+.byte 10
+.byte 0
+@S358:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 98
+.byte 112
+.byte 44
+.byte 32
+.byte 114
+.byte 115
+.byte 112
+.byte 0
+@S359:
+.byte 10
+.byte 0
+@S360:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S361:
+.byte 10
+.byte 0
+@S362:
+.byte 59
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S363:
+.byte 10
+.byte 0
+@S364:
+.byte 37
+.byte 100
+.byte 0
+@S365:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 114
+.byte 97
+.byte 120
+.byte 10
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 114
+.byte 100
+.byte 120
+.byte 10
+.byte 108
+.byte 101
+.byte 97
+.byte 32
+.byte 114
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S366:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 114
+.byte 97
+.byte 120
+.byte 10
+.byte 108
+.byte 101
+.byte 97
+.byte 32
+.byte 114
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S367:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 115
+.byte 112
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S368:
+.byte 10
+.byte 0
+@S369:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 98
+.byte 120
+.byte 0
+@S370:
+.byte 10
+.byte 0
+@S371:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 49
+.byte 50
+.byte 0
+@S372:
+.byte 10
+.byte 0
+@S373:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 0
+@S374:
+.byte 10
+.byte 0
+@S375:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 49
+.byte 52
+.byte 0
+@S376:
+.byte 10
+.byte 0
+@S377:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 49
+.byte 53
+.byte 0
+@S378:
+.byte 10
+.byte 0
+@S379:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 45
+.byte 56
+.byte 93
+.byte 44
+.byte 32
+.byte 114
+.byte 100
+.byte 105
+.byte 0
+@S380:
+.byte 10
+.byte 0
+@S381:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 45
+.byte 56
+.byte 93
+.byte 0
+@S382:
+.byte 10
+.byte 0
+@S383:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 49
+.byte 53
+.byte 0
+@S384:
+.byte 10
+.byte 0
+@S385:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 49
+.byte 52
+.byte 0
+@S386:
+.byte 10
+.byte 0
+@S387:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 49
+.byte 51
+.byte 0
+@S388:
+.byte 10
+.byte 0
+@S389:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 49
+.byte 50
+.byte 0
+@S390:
+.byte 10
+.byte 0
+@S391:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 98
+.byte 120
+.byte 0
+@S392:
+.byte 10
+.byte 0
+@S393:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 115
+.byte 112
+.byte 44
+.byte 32
+.byte 114
+.byte 98
+.byte 112
+.byte 0
+@S394:
+.byte 10
+.byte 0
+@S395:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 98
+.byte 112
+.byte 0
+@S396:
+.byte 10
+.byte 0
+@S397:
+.byte 114
+.byte 101
+.byte 116
+.byte 0
+@S398:
+.byte 10
+.byte 0
+@S399:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 114
+.byte 115
+.byte 112
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S400:
+.byte 10
+.byte 0
+@S401:
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 0
+@S402:
+.byte 10
+.byte 0
+@S403:
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 0
+@S404:
+.byte 10
+.byte 0
+@S405:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 115
+.byte 105
+.byte 0
+@S406:
+.byte 10
+.byte 0
+@S407:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 115
+.byte 105
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S408:
+.byte 10
+.byte 0
+@S409:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 100
+.byte 105
+.byte 0
+@S410:
+.byte 10
+.byte 0
+@S411:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 99
+.byte 120
+.byte 0
+@S412:
+.byte 10
+.byte 0
+@S413:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S414:
+.byte 10
+.byte 0
+@S415:
+.byte 114
+.byte 101
+.byte 112
+.byte 32
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 98
+.byte 0
+@S416:
+.byte 10
+.byte 0
+@S417:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 99
+.byte 120
+.byte 0
+@S418:
+.byte 10
+.byte 0
+@S419:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 100
+.byte 105
+.byte 0
+@S420:
+.byte 10
+.byte 0
+@S421:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 115
+.byte 105
+.byte 0
+@S422:
+.byte 10
+.byte 0
+@S423:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S424:
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S425:
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 0
+@S426:
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S427:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S428:
+.byte 10
+.byte 0
+@S429:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S430:
+.byte 10
+.byte 0
+@S431:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S432:
+.byte 10
+.byte 0
+@S433:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S434:
+.byte 10
+.byte 0
+@S435:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S436:
+.byte 10
+.byte 0
+@S437:
+.byte 105
+.byte 109
+.byte 117
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S438:
+.byte 10
+.byte 0
+@S439:
+.byte 105
+.byte 109
+.byte 117
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S440:
+.byte 10
+.byte 0
+@S441:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S442:
+.byte 10
+.byte 0
+@S443:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S444:
+.byte 10
+.byte 0
+@S445:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S446:
+.byte 10
+.byte 0
+@S447:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S448:
+.byte 10
+.byte 0
+@S449:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S450:
+.byte 10
+.byte 0
+@S451:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S452:
+.byte 10
+.byte 0
+@S453:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S454:
+.byte 10
+.byte 0
+@S455:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S456:
+.byte 10
+.byte 0
+@S457:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S458:
+.byte 10
+.byte 0
+@S459:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S460:
+.byte 10
+.byte 0
+@S461:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 100
+.byte 105
+.byte 44
+.byte 32
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 45
+.byte 56
+.byte 93
+.byte 0
+@S462:
+.byte 10
+.byte 0
+@S463:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S464:
+.byte 10
+.byte 0
+@S465:
+.byte 114
+.byte 101
+.byte 112
+.byte 32
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 98
+.byte 0
+@S466:
+.byte 10
+.byte 0
+@S467:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 108
+.byte 44
+.byte 32
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 91
+.byte 114
+.byte 97
+.byte 120
+.byte 43
+.byte 56
+.byte 93
+.byte 0
+@S468:
+.byte 10
+.byte 0
+@S469:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 120
+.byte 44
+.byte 32
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 97
+.byte 120
+.byte 43
+.byte 56
+.byte 93
+.byte 0
+@S470:
+.byte 10
+.byte 0
+@S471:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 100
+.byte 120
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 97
+.byte 120
+.byte 43
+.byte 56
+.byte 93
+.byte 0
+@S472:
+.byte 10
+.byte 0
+@S473:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 100
+.byte 120
+.byte 44
+.byte 32
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 97
+.byte 120
+.byte 43
+.byte 56
+.byte 93
+.byte 0
+@S474:
+.byte 10
+.byte 0
+@S475:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 115
+.byte 112
+.byte 44
+.byte 32
+.byte 56
+.byte 0
+@S476:
+.byte 10
+.byte 0
+@S477:
+.byte 108
+.byte 101
+.byte 97
+.byte 32
+.byte 114
+.byte 115
+.byte 105
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 97
+.byte 120
+.byte 43
+.byte 56
+.byte 93
+.byte 0
+@S478:
+.byte 10
+.byte 0
+@S479:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 100
+.byte 105
+.byte 44
+.byte 32
+.byte 114
+.byte 115
+.byte 112
+.byte 0
+@S480:
+.byte 10
+.byte 0
+@S481:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S482:
+.byte 10
+.byte 0
+@S483:
+.byte 114
+.byte 101
+.byte 112
+.byte 32
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 98
+.byte 0
+@S484:
+.byte 10
+.byte 0
+@S485:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 100
+.byte 120
+.byte 0
+@S486:
+.byte 10
+.byte 0
+@S487:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 97
+.byte 120
+.byte 93
+.byte 0
+@S488:
+.byte 10
+.byte 0
+@S489:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 97
+.byte 108
+.byte 44
+.byte 32
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 91
+.byte 114
+.byte 97
+.byte 120
+.byte 93
+.byte 0
+@S490:
+.byte 10
+.byte 0
+@S491:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 97
+.byte 120
+.byte 93
+.byte 0
+@S492:
+.byte 10
+.byte 0
+@S493:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 97
+.byte 120
+.byte 93
+.byte 0
+@S494:
+.byte 10
+.byte 0
+@S495:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 97
+.byte 120
+.byte 93
+.byte 0
+@S496:
+.byte 10
+.byte 0
+@S497:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 115
+.byte 112
+.byte 44
+.byte 32
+.byte 56
+.byte 0
+@S498:
+.byte 10
+.byte 0
+@S499:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 115
+.byte 105
+.byte 44
+.byte 32
+.byte 114
+.byte 97
+.byte 120
+.byte 0
+@S500:
+.byte 10
+.byte 0
+@S501:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 100
+.byte 105
+.byte 44
+.byte 32
+.byte 114
+.byte 115
+.byte 112
+.byte 0
+@S502:
+.byte 10
+.byte 0
+@S503:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S504:
+.byte 10
+.byte 0
+@S505:
+.byte 114
+.byte 101
+.byte 112
+.byte 32
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 98
+.byte 0
+@S506:
+.byte 10
+.byte 0
+@S507:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 97
+.byte 120
+.byte 0
+@S508:
+.byte 10
+.byte 0
+@S509:
+.byte 101
+.byte 97
+.byte 120
+.byte 0
+@S510:
+.byte 101
+.byte 98
+.byte 120
+.byte 0
+@S511:
+.byte 101
+.byte 99
+.byte 120
+.byte 0
+@S512:
+.byte 101
+.byte 100
+.byte 120
+.byte 0
+@S513:
+.byte 101
+.byte 115
+.byte 105
+.byte 0
+@S514:
+.byte 101
+.byte 100
+.byte 105
+.byte 0
+@S515:
+.byte 114
+.byte 56
+.byte 100
+.byte 0
+@S516:
+.byte 114
+.byte 57
+.byte 100
+.byte 0
+@S517:
+.byte 114
+.byte 49
+.byte 48
+.byte 100
+.byte 0
+@S518:
+.byte 114
+.byte 49
+.byte 49
+.byte 100
+.byte 0
+@S519:
+.byte 114
+.byte 49
+.byte 50
+.byte 100
+.byte 0
+@S520:
+.byte 114
+.byte 49
+.byte 51
+.byte 100
+.byte 0
+@S521:
+.byte 114
+.byte 49
+.byte 52
+.byte 100
+.byte 0
+@S522:
+.byte 114
+.byte 49
+.byte 53
+.byte 100
+.byte 0
+@S523:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 114
+.byte 57
+.byte 0
+@S524:
+.byte 10
+.byte 0
+@S525:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 114
+.byte 56
+.byte 0
+@S526:
+.byte 10
+.byte 0
+@S527:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 114
+.byte 99
+.byte 120
+.byte 0
+@S528:
+.byte 10
+.byte 0
+@S529:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 114
+.byte 100
+.byte 120
+.byte 0
+@S530:
+.byte 10
+.byte 0
+@S531:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 114
+.byte 115
+.byte 105
+.byte 0
+@S532:
+.byte 10
+.byte 0
+@S533:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 114
+.byte 100
+.byte 105
+.byte 0
+@S534:
+.byte 10
+.byte 0
+@S535:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S536:
+.byte 10
+.byte 0
+@S537:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S538:
+.byte 10
+.byte 0
+@S539:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S540:
+.byte 10
+.byte 0
+@S541:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S542:
+.byte 10
+.byte 0
+@S543:
+.byte 100
+.byte 111
+.byte 95
+.byte 114
+.byte 101
+.byte 108
+.byte 111
+.byte 112
+.byte 95
+.byte 106
+.byte 117
+.byte 109
+.byte 112
+.byte 0
+@S544:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S545:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S546:
+.byte 106
+.byte 110
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S547:
+.byte 10
+.byte 0
+@S548:
+.byte 106
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S549:
+.byte 10
+.byte 0
+@S550:
+.byte 106
+.byte 103
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S551:
+.byte 10
+.byte 0
+@S552:
+.byte 106
+.byte 97
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S553:
+.byte 10
+.byte 0
+@S554:
+.byte 106
+.byte 103
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S555:
+.byte 10
+.byte 0
+@S556:
+.byte 106
+.byte 97
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S557:
+.byte 10
+.byte 0
+@S558:
+.byte 106
+.byte 108
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S559:
+.byte 10
+.byte 0
+@S560:
+.byte 106
+.byte 98
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S561:
+.byte 10
+.byte 0
+@S562:
+.byte 106
+.byte 108
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S563:
+.byte 10
+.byte 0
+@S564:
+.byte 106
+.byte 98
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S565:
+.byte 10
+.byte 0
+@S566:
+.byte 106
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S567:
+.byte 10
+.byte 0
+@S568:
+.byte 106
+.byte 110
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S569:
+.byte 10
+.byte 0
+@S570:
+.byte 106
+.byte 108
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S571:
+.byte 10
+.byte 0
+@S572:
+.byte 106
+.byte 98
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S573:
+.byte 10
+.byte 0
+@S574:
+.byte 106
+.byte 108
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S575:
+.byte 10
+.byte 0
+@S576:
+.byte 106
+.byte 98
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S577:
+.byte 10
+.byte 0
+@S578:
+.byte 106
+.byte 103
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S579:
+.byte 10
+.byte 0
+@S580:
+.byte 106
+.byte 97
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S581:
+.byte 10
+.byte 0
+@S582:
+.byte 106
+.byte 103
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S583:
+.byte 10
+.byte 0
+@S584:
+.byte 106
+.byte 97
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S585:
+.byte 10
+.byte 0
+@S586:
+.byte 110
+.byte 101
+.byte 103
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S587:
+.byte 10
+.byte 0
+@S588:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S589:
+.byte 10
+.byte 0
+@S590:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S591:
+.byte 10
+.byte 0
+@S592:
+.byte 115
+.byte 101
+.byte 116
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S593:
+.byte 10
+.byte 0
+@S594:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S595:
+.byte 10
+.byte 0
+@S596:
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 97
+.byte 114
+.byte 101
+.byte 95
+.byte 97
+.byte 103
+.byte 97
+.byte 105
+.byte 110
+.byte 115
+.byte 116
+.byte 95
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S597:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S598:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S599:
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 97
+.byte 114
+.byte 101
+.byte 95
+.byte 97
+.byte 103
+.byte 97
+.byte 105
+.byte 110
+.byte 115
+.byte 116
+.byte 95
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S600:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S601:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S602:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S603:
+.byte 10
+.byte 0
+@S604:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S605:
+.byte 10
+.byte 0
+@S606:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S607:
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S608:
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 0
+@S609:
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S610:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S611:
+.byte 10
+.byte 0
+@S612:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S613:
+.byte 10
+.byte 0
+@S614:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S615:
+.byte 10
+.byte 0
+@S616:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S617:
+.byte 10
+.byte 0
+@S618:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S619:
+.byte 10
+.byte 0
+@S620:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 114
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S621:
+.byte 10
+.byte 0
+@S622:
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S623:
+.byte 10
+.byte 0
+@S624:
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S625:
+.byte 10
+.byte 0
+@S626:
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 97
+.byte 114
+.byte 103
+.byte 0
+@S627:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S628:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S629:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 114
+.byte 115
+.byte 112
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S630:
+.byte 10
+.byte 0
+@S631:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 115
+.byte 105
+.byte 0
+@S632:
+.byte 10
+.byte 0
+@S633:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 100
+.byte 105
+.byte 0
+@S634:
+.byte 10
+.byte 0
+@S635:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 100
+.byte 105
+.byte 44
+.byte 32
+.byte 114
+.byte 115
+.byte 112
+.byte 0
+@S636:
+.byte 10
+.byte 0
+@S637:
+.byte 108
+.byte 101
+.byte 97
+.byte 32
+.byte 114
+.byte 100
+.byte 105
+.byte 44
+.byte 32
+.byte 91
+.byte 114
+.byte 115
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S638:
+.byte 10
+.byte 0
+@S639:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 114
+.byte 99
+.byte 120
+.byte 0
+@S640:
+.byte 10
+.byte 0
+@S641:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S642:
+.byte 10
+.byte 0
+@S643:
+.byte 114
+.byte 101
+.byte 112
+.byte 32
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 98
+.byte 0
+@S644:
+.byte 10
+.byte 0
+@S645:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 99
+.byte 120
+.byte 0
+@S646:
+.byte 10
+.byte 0
+@S647:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 100
+.byte 105
+.byte 0
+@S648:
+.byte 10
+.byte 0
+@S649:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 114
+.byte 115
+.byte 105
+.byte 0
+@S650:
+.byte 10
+.byte 0
+@S651:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S652:
+.byte 10
+.byte 0
+@S653:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S654:
+.byte 10
+.byte 0
+@S655:
+.byte 43
+.byte 37
+.byte 117
+.byte 42
+.byte 0
+@S656:
+.byte 43
+.byte 37
+.byte 117
+.byte 0
+@S657:
+.byte 43
+.byte 0
+@S658:
+.byte 43
+.byte 37
+.byte 117
+.byte 42
+.byte 0
+@S659:
+.byte 45
+.byte 0
+@S660:
+.byte 45
+.byte 37
+.byte 117
+.byte 42
+.byte 0
+@S661:
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 95
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 0
+@S662:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 54
+.byte 52
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S663:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S664:
+.byte 37
+.byte 108
+.byte 108
+.byte 100
+.byte 0
+@S665:
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S666:
+.byte 10
+.byte 0
+@S667:
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S668:
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S669:
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S670:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 48
+.byte 0
+@S671:
+.byte 10
+.byte 0
+@S672:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 48
+.byte 0
+@S673:
+.byte 10
+.byte 0
+@S674:
+.byte 115
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S675:
+.byte 10
+.byte 0
+@S676:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S677:
+.byte 10
+.byte 0
+@S678:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 113
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S679:
+.byte 10
+.byte 0
+@S680:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S681:
+.byte 10
+.byte 0
+@S682:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S683:
+.byte 10
+.byte 0
+@S684:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S685:
+.byte 10
+.byte 0
+@S686:
+.byte 120
+.byte 111
+.byte 114
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 100
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 100
+.byte 0
+@S687:
+.byte 10
+.byte 0
+@S688:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 114
+.byte 49
+.byte 48
+.byte 100
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S689:
+.byte 10
+.byte 0
+@S690:
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S691:
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 0
+@S692:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 114
+.byte 49
+.byte 48
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S693:
+.byte 10
+.byte 0
+@S694:
+.byte 115
+.byte 104
+.byte 108
+.byte 32
+.byte 114
+.byte 49
+.byte 48
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S695:
+.byte 10
+.byte 0
+@S696:
+.byte 111
+.byte 114
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 48
+.byte 0
+@S697:
+.byte 10
+.byte 0
+@S698:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 114
+.byte 49
+.byte 49
+.byte 0
+@S699:
+.byte 10
+.byte 0
+@S700:
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S701:
+.byte 10
+.byte 0
+@S702:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S703:
+.byte 10
+.byte 0
+@S704:
+.byte 10
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 32
+.byte 111
+.byte 98
+.byte 106
+.byte 101
+.byte 99
+.byte 116
+.byte 115
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 32
+.byte 100
+.byte 117
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S705:
+.byte 10
+.byte 0
+@S706:
+.byte 10
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 32
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 115
+.byte 121
+.byte 109
+.byte 98
+.byte 111
+.byte 108
+.byte 115
+.byte 0
+@S707:
+.byte 10
+.byte 0
+@S708:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S709:
+.byte 10
+.byte 0
+@S710:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S711:
+.byte 10
+.byte 0
+@S712:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 109
+.byte 101
+.byte 109
+.byte 115
+.byte 101
+.byte 116
+.byte 0
+@S713:
+.byte 10
+.byte 0
+@S714:
+.byte 10
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 108
+.byte 105
+.byte 116
+.byte 101
+.byte 114
+.byte 97
+.byte 108
+.byte 115
+.byte 0
+@S715:
+.byte 10
+.byte 0
+@S716:
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 46
+.byte 114
+.byte 111
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S717:
+.byte 10
+.byte 0
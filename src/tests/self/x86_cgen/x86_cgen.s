@@ -0,0 +1,31887 @@
+# ==== start of definition of function `x86_call' ====
+.text
+x86_call:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldbp -20;
+lddw;
+ldiqw x86_pre_call;
+call 4;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S0;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S1;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_post_call;
+call 4;
+pop;
+pop;
+ldbp -24;
+lddw;
+jmpf @L1;
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L2;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L2;
+ldidw 0;
+jmp @L3;
+@L2:
+ldidw 1;
+@L3:
+jmpf @L4;
+# var: r, offset: 8
+ldidw 0;
+dw2w;
+ldbp 8;
+stw;
+pop;
+ldidw 3;
+dw2w;
+ldbp 10;
+stw;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+jmp @L5;
+@L4:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldidw 0;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L5:
+@L1:
+ldidw 0;
+ret;
+.extern fgets
+.extern get_promoted_type
+.extern analyze_bitwise_operator
+# ==== start of definition of function `x86_store2' ====
+.text
+x86_store2:
+addsp 12;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L6;
+# var: e, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L7;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L8;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S2;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 40;
+pop;
+pop;
+ldiqw @S3;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S4;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 40;
+pop;
+pop;
+ldiqw @S5;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L9;
+@L8:
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S6;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S7;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S8;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S9;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L9:
+jmp @L10;
+@L7:
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw @S10;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S11;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 4;
+adddw;
+ldiqw @S12;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S13;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L10:
+jmp @L11;
+@L6:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L12;
+# var: offs, offset: 4
+ldbp -24;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldbp 4;
+lddw;
+ldiqw @S14;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S15;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldbp 4;
+lddw;
+ldidw 4;
+adddw;
+ldiqw @S16;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S17;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L12:
+@L11:
+ldidw 0;
+ret;
+.extern verbose_asm
+.extern bset_iterate
+.extern edge_iterate
+.extern static_objects_list
+# ==== start of definition of function `x86_case' ====
+.text
+x86_case:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldidw 0;
+ret;
+.extern is_complete
+.extern ic_addresses
+# ==== start of definition of function `x86_ch' ====
+.text
+x86_ch:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+eqdw;
+jmpt @L13;
+ldbp 4;
+lddw;
+ldidw 5;
+eqdw;
+jmpt @L13;
+ldidw 0;
+jmp @L14;
+@L13:
+ldidw 1;
+@L14:
+jmpf @L15;
+ldiqw @S18;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S19;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S20;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S21;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S22;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S23;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S24;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S25;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L16;
+@L15:
+ldiqw x86_lbreg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S26;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S27;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L16:
+@L17:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L18:
+ldidw 0;
+jmpf @L19;
+jmp @L17;
+@L19:
+ldidw 0;
+ret;
+.extern cfg_outpath
+.bss
+.align 4
+size_of_local_area:
+.res 4
+# ==== start of definition of function `x86_uch' ====
+.text
+x86_uch:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+eqdw;
+jmpt @L20;
+ldbp 4;
+lddw;
+ldidw 5;
+eqdw;
+jmpt @L20;
+ldidw 0;
+jmp @L21;
+@L20:
+ldidw 1;
+@L21:
+jmpf @L22;
+ldiqw @S28;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S29;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S30;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S31;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S32;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S33;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S34;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S35;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L23;
+@L22:
+ldiqw x86_lbreg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S36;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S37;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L23:
+@L24:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L25:
+ldidw 0;
+jmpf @L26;
+jmp @L24;
+@L26:
+ldidw 0;
+ret;
+.extern analyze_unary_expression
+.extern string_write
+# ==== start of definition of function `x86_eq' ====
+.text
+x86_eq:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L27;
+ldidw 8;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x86_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L28;
+@L27:
+# var: res, offset: 16
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L31;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L33;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L33;
+ldidw 0;
+jmp @L34;
+@L33:
+ldidw 1;
+@L34:
+jmpt @L31;
+ldidw 0;
+jmp @L32;
+@L31:
+ldidw 1;
+@L32:
+jmpt @L29;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L29;
+ldidw 0;
+jmp @L30;
+@L29:
+ldidw 1;
+@L30:
+jmpf @L35;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+jmp @L36;
+@L35:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+stdw;
+pop;
+@L36:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S38;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S39;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L37;
+ldiqw x86_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S40;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S41;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S42;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S43;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L38:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L39:
+ldidw 0;
+jmpf @L40;
+jmp @L38;
+@L40:
+jmp @L41;
+@L37:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L41:
+@L28:
+ldidw 0;
+ret;
+.extern target_arch
+.extern emit_warning
+.extern arena_destroy
+.extern liveness_and_next_use
+# ==== start of definition of function `x86_gt' ====
+.text
+x86_gt:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L42;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L43;
+ldidw 15;
+jmp @L44;
+@L43:
+ldidw 11;
+@L44:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x86_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L45;
+@L42:
+# var: res, offset: 16
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L48;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L50;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L50;
+ldidw 0;
+jmp @L51;
+@L50:
+ldidw 1;
+@L51:
+jmpt @L48;
+ldidw 0;
+jmp @L49;
+@L48:
+ldidw 1;
+@L49:
+jmpt @L46;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L46;
+ldidw 0;
+jmp @L47;
+@L46:
+ldidw 1;
+@L47:
+jmpf @L52;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+jmp @L53;
+@L52:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+stdw;
+pop;
+@L53:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S44;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S45;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L54;
+ldiqw x86_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L55;
+ldiqw @S46;
+jmp @L56;
+@L55:
+ldiqw @S47;
+@L56:
+ldiqw @S48;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S49;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S50;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S51;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L57:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L58:
+ldidw 0;
+jmpf @L59;
+jmp @L57;
+@L59:
+jmp @L60;
+@L54:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L60:
+@L45:
+ldidw 0;
+ret;
+.extern is_struct_union_enum
+.extern get_sizeof
+.extern emit_error
+.extern get_curr_scope_id
+.extern getenv
+.extern can_assign_to
+.extern atoi
+.extern bset_member
+.extern exit
+# ==== start of definition of function `x86_div' ====
+.text
+x86_div:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldidw 0;
+ldiqw x86_div_rem;
+call 20;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `x86_lt' ====
+.text
+x86_lt:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L61;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L62;
+ldidw 14;
+jmp @L63;
+@L62:
+ldidw 10;
+@L63:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x86_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L64;
+@L61:
+# var: res, offset: 16
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L67;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L69;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L69;
+ldidw 0;
+jmp @L70;
+@L69:
+ldidw 1;
+@L70:
+jmpt @L67;
+ldidw 0;
+jmp @L68;
+@L67:
+ldidw 1;
+@L68:
+jmpt @L65;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L65;
+ldidw 0;
+jmp @L66;
+@L65:
+ldidw 1;
+@L66:
+jmpf @L71;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+jmp @L72;
+@L71:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+stdw;
+pop;
+@L72:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S52;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S53;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L73;
+ldiqw x86_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L74;
+ldiqw @S54;
+jmp @L75;
+@L74:
+ldiqw @S55;
+@L75:
+ldiqw @S56;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S57;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S58;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S59;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L76:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L77:
+ldidw 0;
+jmpf @L78;
+jmp @L76;
+@L78:
+jmp @L79;
+@L73:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L79:
+@L64:
+ldidw 0;
+ret;
+.bss
+.align 4
+arg_stack:
+.res 256
+.extern stderr
+# ==== start of definition of function `x86_llsx' ====
+.text
+x86_llsx:
+addsp 20;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+# var: r1, offset: 8
+# var: r2, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 4;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw @S60;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S61;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw @S62;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S63;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L80:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L81:
+ldidw 0;
+jmpf @L82;
+jmp @L80;
+@L82:
+ldidw 0;
+ret;
+.data
+.align 8
+x86_lbreg_str:
+.align 8
+.qword @S64+0
+.align 8
+.qword @S65+0
+.align 8
+.qword @S66+0
+.align 8
+.qword @S67+0
+.align 8
+.qword @S68+0
+.align 8
+.qword @S69+0
+.extern opt_level
+.extern restore_scope
+.extern nid2lnid
+# ==== start of definition of function `x86_or' ====
+.text
+x86_or:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L83;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L83;
+ldidw 0;
+jmp @L84;
+@L83:
+ldidw 1;
+@L84:
+jmpf @L85;
+# var: op, offset: 8
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 16;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw x86_load2;
+call 8;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S70;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S71;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S72;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S73;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L86:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L87:
+ldidw 0;
+jmpf @L88;
+jmp @L86;
+@L88:
+jmp @L89;
+@L85:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S74;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S75;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L90:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L91:
+ldidw 0;
+jmpf @L92;
+jmp @L90;
+@L92:
+@L89:
+ldidw 0;
+ret;
+.extern string_get_pos
+# ==== start of definition of function `x86_begarg' ====
+.text
+x86_begarg:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldidw 0;
+ret;
+.bss
+.align 8
+temp_list:
+.res 8
+.extern rewind
+.extern get_type_node
+.extern analyze_logical_operator
+.extern realloc
+# ==== start of definition of function `x86_sh' ====
+.text
+x86_sh:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldiqw x86_lwreg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S76;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S77;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L93:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L94:
+ldidw 0;
+jmpf @L95;
+jmp @L93;
+@L95:
+ldidw 0;
+ret;
+.extern lookup_ordinary_id
+.extern snprintf
+# ==== start of definition of function `x86_ush' ====
+.text
+x86_ush:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldiqw x86_lwreg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S78;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S79;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L96:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L97:
+ldidw 0;
+jmpf @L98;
+jmp @L96;
+@L98:
+ldidw 0;
+ret;
+# ==== start of definition of function `x86_llzx' ====
+.text
+x86_llzx:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 4;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S80;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S81;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L99:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L100:
+ldidw 0;
+jmpf @L101;
+jmp @L99;
+@L101:
+ldidw 0;
+ret;
+.extern strpbrk
+.extern pop_struct_descriptor
+.extern nid2sid_tab
+# ==== start of definition of function `dump_reg_descr_tab' ====
+.text
+dump_reg_descr_tab:
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L102:
+ldbp 4;
+lddw;
+ldidw 6;
+sltdw;
+jmpf @L104;
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L105;
+ldiqw nid2sid_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S82;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 32;
+pop;
+pop;
+@L105:
+@L103:
+incldw 4;
+jmp @L102;
+@L104:
+ldidw 0;
+ret;
+.extern fseek
+.extern push_struct_descriptor
+.extern string_set_pos
+# ==== start of definition of function `x86_do_switch64' ====
+.text
+x86_do_switch64:
+addsp 12;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+.bss
+.align 4
+@x86_do_switch64_nlab:
+.res 4
+.text
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L106;
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 4;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw x86_load2;
+call 8;
+pop;
+pop;
+jmp @L107;
+@L106:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldbp 4;
+swap2;
+memcpy 4;
+pop;
+pop;
+@L107:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+incldw -20;
+@L108:
+# var: p, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ordw;
+jmpf @L111;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S83;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S84;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L110;
+@L111:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldiqw x86_reg_str;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S85;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S86;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @x86_do_switch64_nlab;
+lddw;
+ldiqw @S87;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S88;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldiqw x86_reg_str;
+ldbp 4;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S89;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S90;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S91;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S92;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @x86_do_switch64_nlab;
+lddw;
+ldiqw @S93;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S94;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @x86_do_switch64_nlab;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+adddw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+@L109:
+incldw -20;
+jmp @L108;
+@L110:
+ldidw 0;
+ret;
+.bss
+.align 8
+func_epilog:
+.res 8
+.extern sscanf
+.extern fputc
+# ==== start of definition of function `emit_raw_string' ====
+.text
+emit_raw_string:
+addsp 8;         
+# param:`q', offset:-24
+# param:`s', offset:-32
+# var: len, offset: 4
+# var: i, offset: 8
+ldbp -32;
+ldqw;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+udivdw;
+ldbp 8;
+stdw;
+pop;
+@L112:
+ldbp 8;
+lddw;
+jmpf @L114;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxb 1;
+ldbp -32;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxb 1;
+ldbp -32;
+ldqw;
+ldidw 2;
+dw2qw;
+ldxb 1;
+ldbp -32;
+ldqw;
+ldidw 3;
+dw2qw;
+ldxb 1;
+ldiqw @S95;
+ldbp -24;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldidw 4;
+dw2qw;
+addqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L113:
+decldw 8;
+jmp @L112;
+@L114:
+ldbp 4;
+lddw;
+ldidw 4;
+umoddw;
+ldbp 8;
+stdw;
+pop;
+@L115:
+ldbp 8;
+lddw;
+jmpf @L117;
+ldbp -32;
+dup2;
+ldqw;
+swap2;
+dup2;
+ldqw;
+ldiqw 1;
+addqw;
+swap2;
+stqw;
+pop;
+pop;
+ldb;
+ldiqw @S96;
+ldbp -24;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+@L116:
+decldw 8;
+jmp @L115;
+@L117:
+ldidw 0;
+ret;
+# ==== start of definition of function `x86_static_init' ====
+.text
+x86_static_init:
+addsp 68;        
+# param:`ds', offset:-24
+# param:`dct', offset:-32
+# param:`e', offset:-40
+# var: ts, offset: 8
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L118;
+# var: nelem, offset: 16
+ldbp -32;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 97;
+neqdw;
+jmpf @L119;
+jmp @@x86_static_init_scalar;
+@L119:
+ldbp -32;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L120;
+# var: n, offset: 20
+ldidw 0;
+dw2b;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 16;
+lddw;
+ldidw 1;
+subdw;
+udw2qw;
+addqw;
+stb;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw asm_decls;
+ldqw;
+ldiqw emit_raw_string;
+call 16;
+pop;
+pop;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw strlen;
+call 8;
+ldidw 1;
+dw2qw;
+addqw;
+pop;
+ldbp 20;
+stdw;
+ldbp 16;
+lddw;
+ultdw;
+jmpf @L121;
+ldbp 16;
+lddw;
+ldbp 20;
+lddw;
+subdw;
+ldiqw @S97;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S98;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L121:
+jmp @L122;
+@L120:
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L123:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L125;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw x86_static_init;
+call 24;
+pop;
+pop;
+@L124:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 16;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+pop;
+jmp @L123;
+@L125:
+ldbp 16;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L126;
+# var: ty, offset: 24
+ldbp -24;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw @S99;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S100;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+muldw;
+ldiqw @S101;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S102;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L126:
+@L122:
+jmp @L127;
+@L118:
+ldbp -24;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldbp 8;
+stqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 68;
+eqdw;
+jmpf @L128;
+# var: d, offset: 16
+# var: full_init, offset: 24
+# var: ty, offset: 32
+# var: align, offset: 48
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 32;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 32;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 48;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L129;
+ldbp 48;
+lddw;
+ldiqw @S103;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S104;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L129:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L130:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+notdw;
+jmpf @L133;
+ldidw 2707;
+ldiqw @S105;
+ldiqw @S106;
+ldiqw @S107;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L133:
+@L131:
+ldidw 0;
+jmpf @L132;
+jmp @L130;
+@L132:
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+@L134:
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L136;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L137:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L140;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L140;
+ldidw 1;
+jmp @L141;
+@L140:
+ldidw 0;
+@L141:
+jmpf @L139;
+ldbp -40;
+ldqw;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw x86_static_init;
+call 24;
+pop;
+pop;
+@L138:
+ldbp -40;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L137;
+@L139:
+ldbp -40;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L142;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L143;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L143;
+ldidw 1;
+jmp @L144;
+@L143:
+ldidw 0;
+@L144:
+jmpf @L145;
+ldidw 1;
+ldbp 24;
+stdw;
+pop;
+@L145:
+jmp @L136;
+@L142:
+@L135:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L134;
+@L136:
+ldbp 24;
+lddw;
+notdw;
+jmpf @L146;
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L147;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+@L147:
+@L148:
+ldidw 1;
+jmpf @L149;
+@L150:
+ldbp -32;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L151;
+# var: ty, offset: 56
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 56;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 56;
+ldiqw get_alignment;
+call 8;
+pop;
+ldiqw @S108;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S109;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 56;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S110;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S111;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L150;
+@L151:
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L152;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp -32;
+stqw;
+pop;
+pop;
+jmp @L153;
+@L152:
+jmp @L149;
+@L153:
+jmp @L148;
+@L149:
+@L146:
+jmp @L154;
+@L128:
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 71;
+eqdw;
+jmpf @L155;
+# var: ty, offset: 16
+# var: align, offset: 32
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 32;
+stdw;
+ldidw 1;
+ugtdw;
+jmpf @L156;
+ldbp 32;
+lddw;
+ldiqw @S112;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S113;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L156:
+ldbp -40;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw x86_static_init;
+call 24;
+pop;
+pop;
+jmp @L157;
+@L155:
+# var: dest_ty, offset: 16
+@@x86_static_init_scalar:
+ldbp -40;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L158;
+ldbp -40;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldidw 114;
+eqdw;
+jmpf @L158;
+ldidw 1;
+jmp @L159;
+@L158:
+ldidw 0;
+@L159:
+jmpf @L160;
+ldbp -40;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldbp -40;
+stqw;
+pop;
+pop;
+@L160:
+ldbp -24;
+ldqw;
+ldbp 16;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T161;
+switch;
+@L163:
+@L164:
+@L165:
+ldiqw @S114;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L162;
+@L166:
+@L167:
+ldiqw @S115;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S116;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S117;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L162;
+@L168:
+@L169:
+ldiqw @S118;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S119;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S120;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L162;
+@L170:
+ldiqw @S121;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S122;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S123;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L162;
+@L162:
+.data
+.align 8
+@T161:
+.dword 8
+.dword 49
+.dword 64
+.dword 106
+.dword 107
+.dword 108
+.dword 110
+.dword 111
+.qword @L170
+.qword @L163
+.qword @L166
+.qword @L164
+.qword @L165
+.qword @L167
+.qword @L168
+.qword @L169
+.text
+ldbp -40;
+ldqw;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+ldiqw @S124;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L157:
+@L154:
+@L127:
+ldidw 0;
+ret;
+.extern vsscanf
+.extern dflow_enter_function
+# ==== start of definition of function `get_reg0' ====
+.text
+get_reg0:
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L171:
+ldbp 4;
+lddw;
+ldidw 6;
+sltdw;
+jmpf @L173;
+ldiqw pinned;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+notdw;
+jmpf @L174;
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+jmpf @L174;
+ldidw 1;
+jmp @L175;
+@L174:
+ldidw 0;
+@L175:
+jmpf @L176;
+ldidw 1;
+ldiqw modified;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+@L176:
+@L172:
+incldw 4;
+jmp @L171;
+@L173:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L177:
+ldbp 4;
+lddw;
+ldidw 6;
+sltdw;
+jmpf @L179;
+ldiqw pinned;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+notdw;
+jmpf @L180;
+ldidw 1;
+ldiqw modified;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldbp 4;
+lddw;
+dw2qw;
+ret;
+@L180:
+@L178:
+incldw 4;
+jmp @L177;
+@L179:
+@L181:
+ldidw 0;
+notdw;
+jmpf @L184;
+ldidw 284;
+ldiqw @S125;
+ldiqw @S126;
+ldiqw @S127;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L184:
+@L182:
+ldidw 0;
+jmpf @L183;
+jmp @L181;
+@L183:
+ldidw 0;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `get_reg2' ====
+.text
+get_reg2:
+addsp 8;         
+# param:`i', offset:-20
+# var: r, offset: 4
+# var: arg1, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L187;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L187;
+ldidw 0;
+jmp @L188;
+@L187:
+ldidw 1;
+@L188:
+notdw;
+jmpf @L185;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+notdw;
+jmpf @L185;
+ldidw 1;
+jmp @L186;
+@L185:
+ldidw 0;
+@L186:
+jmpf @L189;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L190;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+jmp @L191;
+@L190:
+ldiqw get_reg0;
+call 0;
+pop;
+@L191:
+dw2w;
+ldbp 4;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L192;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+jmp @L193;
+@L192:
+ldiqw get_reg0;
+call 0;
+pop;
+@L193:
+dw2w;
+ldbp 4;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L194;
+@L189:
+ldiqw get_reg0;
+call 0;
+pop;
+dw2w;
+ldbp 4;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw get_reg0;
+call 0;
+pop;
+dw2w;
+ldbp 4;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 4;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L194:
+ldbp 4;
+ldiqw __temp_struct;
+swap2;
+memcpy 4;
+ret;
+ldidw 0;
+ret;
+.extern fwrite
+.extern is_pointer
+# ==== start of definition of function `x86_allocate_static_objects' ====
+.text
+x86_allocate_static_objects:
+addsp 52;        
+# var: np, offset: 8
+ldiqw static_objects_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L195:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L197;
+# var: al, offset: 16
+# var: ty, offset: 24
+# var: initzr, offset: 40
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 40;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldiqw get_alignment;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp 40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L198;
+@L199:
+ldiqw curr_segment;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L202;
+ldiqw str_segment;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw @S128;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S129;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw curr_segment;
+stdw;
+pop;
+@L202:
+@L200:
+ldidw 0;
+jmpf @L201;
+jmp @L199;
+@L201:
+ldbp 16;
+lddw;
+ldidw 1;
+ugtdw;
+jmpf @L203;
+ldbp 16;
+lddw;
+ldiqw @S130;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S131;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L203:
+jmp @L204;
+@L198:
+@L205:
+ldiqw curr_segment;
+lddw;
+ldidw 2;
+neqdw;
+jmpf @L208;
+ldiqw str_segment;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw @S132;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S133;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 2;
+ldiqw curr_segment;
+stdw;
+pop;
+@L208:
+@L206:
+ldidw 0;
+jmpf @L207;
+jmp @L205;
+@L207:
+ldbp 16;
+lddw;
+ldidw 1;
+ugtdw;
+jmpf @L209;
+ldbp 16;
+lddw;
+ldiqw @S134;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S135;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L209:
+@L204:
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw enclosing_function;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L210;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw @S136;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S137;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L211;
+@L210:
+# var: scs, offset: 48
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 48;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L212;
+ldbp 48;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L212;
+ldidw 0;
+jmp @L213;
+@L212:
+ldidw 1;
+@L213:
+jmpf @L214;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S138;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S139;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L214:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S140;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S141;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L211:
+ldbp 40;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L215;
+ldbp 40;
+ldqw;
+ldbp 24;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 24;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw x86_static_init;
+call 24;
+pop;
+pop;
+jmp @L216;
+@L215:
+ldbp 24;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S142;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S143;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L216:
+@L196:
+ldbp 8;
+ldqw;
+ldiqw 32;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L195;
+@L197:
+ldidw 0;
+ret;
+.extern colored_diagnostics
+.extern string_curr
+.extern read_stream
+.extern strspn
+.bss
+.align 4
+calls_to_fix_counter:
+.res 4
+.extern reset_enum_val
+.extern strtoll
+.extern analyze_relational_equality_expression
+.extern get_var_nid
+# ==== start of definition of function `dump_addr_descr_tab' ====
+.text
+dump_addr_descr_tab:
+addsp 8;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L217:
+ldbp 4;
+lddw;
+ldiqw nid_counter;
+lddw;
+sltdw;
+jmpf @L219;
+# var: ad, offset: 8
+ldiqw addr_descr_tab;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L220;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L221;
+ldiqw x86_reg_str;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw nid2sid_tab;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S144;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 40;
+pop;
+pop;
+jmp @L222;
+@L221:
+ldiqw x86_reg_str;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw nid2sid_tab;
+ldqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S145;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 32;
+pop;
+pop;
+@L222:
+@L220:
+@L218:
+incldw 4;
+jmp @L217;
+@L219:
+ldidw 0;
+ret;
+.extern get_sto_class_spec
+# ==== start of definition of function `x86_mul' ====
+.text
+x86_mul:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L223;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L223;
+ldidw 0;
+jmp @L224;
+@L223:
+ldidw 1;
+@L224:
+jmpf @L225;
+ldidw 0;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x86_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L226;
+@L225:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S146;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S147;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L227:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L228:
+ldidw 0;
+jmpf @L229;
+jmp @L227;
+@L229:
+@L226:
+ldidw 0;
+ret;
+.extern bset_cpy
+# ==== start of definition of function `x86_ind' ====
+.text
+x86_ind:
+addsp 20;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw spill_aliased_objects;
+call 0;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L230;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L230;
+ldidw 0;
+jmp @L231;
+@L230:
+ldidw 1;
+@L231:
+jmpf @L232;
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S148;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S149;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S150;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S151;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L233:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L234:
+ldidw 0;
+jmpf @L235;
+jmp @L233;
+@L235:
+jmp @L236;
+@L232:
+# var: res, offset: 8
+# var: reg_str, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @T237;
+switch;
+@L239:
+@L240:
+jmp @L238;
+@L241:
+ldbp 16;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw @S152;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S153;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L238;
+@L242:
+ldbp 16;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw @S154;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S155;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L238;
+@L243:
+@L244:
+ldbp 16;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw @S156;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S157;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L238;
+@L245:
+ldbp 16;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw @S158;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S159;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L238;
+@L246:
+ldbp 16;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw @S160;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S161;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L238;
+@L238:
+.data
+.align 8
+@T237:
+.dword 8
+.dword 49
+.dword 64
+.dword 68
+.dword 71
+.dword 106
+.dword 107
+.dword 108
+.qword @L246
+.qword @L243
+.qword @L241
+.qword @L239
+.qword @L240
+.qword @L244
+.qword @L245
+.qword @L242
+.text
+@L247:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L248:
+ldidw 0;
+jmpf @L249;
+jmp @L247;
+@L249:
+@L236:
+ldidw 0;
+ret;
+.extern string_free
+.extern fclose
+.extern preprocess
+.extern analyze_decl_specs
+.extern strstr
+.extern calloc
+.extern pop_scope
+.extern memset
+# ==== start of definition of function `x86_cgen' ====
+.text
+x86_cgen:
+.global x86_cgen
+addsp 40;        
+# param:`outf', offset:-24
+# var: i, offset: 4
+# var: j, offset: 8
+# var: ed, offset: 16
+# var: func_def_list, offset: 24
+# var: ext_sym_list, offset: 32
+ldbp -24;
+ldqw;
+ldiqw x86_output_file;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldbp 24;
+ldiqw ic_main;
+call 16;
+pop;
+pop;
+ldidw 512;
+ldiqw string_new;
+call 4;
+ldiqw asm_decls;
+stqw;
+pop;
+pop;
+ldidw 512;
+ldiqw string_new;
+call 4;
+ldiqw str_lits;
+stqw;
+pop;
+pop;
+ldidw 1024;
+ldiqw string_new;
+call 4;
+ldiqw func_body;
+stqw;
+pop;
+pop;
+ldidw 1024;
+ldiqw string_new;
+call 4;
+ldiqw func_prolog;
+stqw;
+pop;
+pop;
+ldidw 1024;
+ldiqw string_new;
+call 4;
+ldiqw func_epilog;
+stqw;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldiqw malloc;
+call 8;
+ldiqw addr_descr_tab;
+stqw;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L250:
+ldbp 24;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L252;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw x86_function_definition;
+call 16;
+pop;
+pop;
+@L251:
+incldw 4;
+jmp @L250;
+@L252:
+ldiqw func_body;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw @S162;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S163;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_allocate_static_objects;
+call 0;
+pop;
+pop;
+ldiqw @S164;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S165;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+@L253:
+ldbp 32;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L255;
+# var: tmp, offset: 40
+ldiqw nid_counter;
+lddw;
+ldbp 40;
+stdw;
+pop;
+ldidw 0;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_var_nid;
+call 12;
+pop;
+pop;
+ldbp 40;
+lddw;
+ldiqw nid_counter;
+lddw;
+eqdw;
+jmpf @L256;
+ldbp 16;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw @S166;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S167;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L256:
+@L254:
+incldw 8;
+jmp @L253;
+@L255:
+ldiqw include_libc;
+lddw;
+jmpf @L257;
+ldiqw @S168;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S169;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S170;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S171;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L257:
+ldiqw include_liblux;
+lddw;
+jmpf @L258;
+ldiqw @S172;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S173;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S174;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S175;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S176;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S177;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S178;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S179;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S180;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S181;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S182;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S183;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S184;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S185;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S186;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S187;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S188;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S189;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S190;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S191;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L258:
+ldiqw string_literals_counter;
+lddw;
+jmpf @L259;
+ldiqw @S192;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S193;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S194;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S195;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L259:
+ldiqw asm_decls;
+ldqw;
+ldiqw x86_write;
+call 8;
+pop;
+pop;
+ldiqw str_lits;
+ldqw;
+ldiqw x86_write;
+call 8;
+pop;
+pop;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldiqw str_lits;
+ldqw;
+ldiqw string_free;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern file_exists
+.extern include_libc
+.extern C_source
+.extern analyze_cast_expression
+.extern stringify_type_exp
+.extern add_quote_dir
+# ==== start of definition of function `x86_add' ====
+.text
+x86_add:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L260;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L260;
+ldidw 0;
+jmp @L261;
+@L260:
+ldidw 1;
+@L261:
+jmpf @L262;
+# var: op, offset: 8
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 16;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw x86_load2;
+call 8;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S196;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S197;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S198;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S199;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L263:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L264:
+ldidw 0;
+jmpf @L265;
+jmp @L263;
+@L265:
+jmp @L266;
+@L262:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S200;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S201;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L267:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L268:
+ldidw 0;
+jmpf @L269;
+jmp @L267;
+@L269:
+@L266:
+ldidw 0;
+ret;
+# ==== start of definition of function `x86_rem' ====
+.text
+x86_rem:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldidw 3;
+ldiqw x86_div_rem;
+call 20;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `x86_ret' ====
+.text
+x86_ret:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldiqw qword_return;
+lddw;
+jmpf @L270;
+# var: r, offset: 4
+ldidw 0;
+dw2w;
+ldbp 4;
+stw;
+pop;
+ldidw 3;
+dw2w;
+ldbp 6;
+stw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+ldn 4;
+ldiqw x86_load2;
+call 8;
+pop;
+pop;
+jmp @L271;
+@L270:
+ldiqw big_return;
+lddw;
+jmpf @L272;
+# var: siz, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldidw 4;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw modified;
+ldidw 4;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw reg_descr_tab;
+ldidw 5;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L273;
+ldidw 5;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+@L273:
+ldiqw @S202;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S203;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw modified;
+ldidw 5;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw reg_descr_tab;
+ldidw 2;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L274;
+ldidw 2;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+@L274:
+ldbp 4;
+lddw;
+ldiqw @S204;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S205;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S206;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S207;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L275;
+@L272:
+ldbp -28;
+lddw;
+ldidw 0;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+@L275:
+@L271:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern stat_number_of_ast_nodes
+.extern strtoul
+.extern fprintf
+.extern get_type_qual
+.extern read_file
+.extern address_taken_variables
+.extern is_signed_int
+.extern printf
+.extern get_c_token
+.extern lookup_tag
+.extern get_rank
+# ==== start of definition of function `update_arg_descriptors' ====
+.text
+update_arg_descriptors:
+addsp 0;         
+# param:`arg', offset:-20
+# param:`liveness', offset:-24
+# param:`next_use', offset:-28
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L278;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L278;
+ldidw 0;
+jmp @L279;
+@L278:
+ldidw 1;
+@L279:
+jmpt @L276;
+ldbp -28;
+lddw;
+jmpt @L276;
+ldidw 0;
+jmp @L277;
+@L276:
+ldidw 1;
+@L277:
+jmpf @L280;
+ldiqw 0;
+ret;
+@L280:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L281;
+ldbp -24;
+ldub;
+jmpf @L282;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L283;
+ldbp -20;
+lddw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldn 4;
+ldiqw x86_store2;
+call 8;
+pop;
+pop;
+jmp @L284;
+@L283:
+ldbp -20;
+lddw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw x86_store;
+call 8;
+pop;
+pop;
+@L284:
+jmp @L285;
+@L282:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L286;
+ldbp -20;
+lddw;
+ldiqw free_temp;
+call 4;
+pop;
+pop;
+@L286:
+@L285:
+ldidw 0;
+ldiqw reg_descr_tab;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L287;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L287:
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+stw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+jmp @L288;
+@L281:
+ldbp -24;
+ldub;
+jmpf @L289;
+jmp @L290;
+@L289:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L291;
+ldbp -20;
+lddw;
+ldiqw free_temp;
+call 4;
+pop;
+pop;
+@L291:
+@L290:
+@L288:
+ldidw 0;
+ret;
+.extern is_external_id
+.extern sprintf
+# ==== start of definition of function `x86_neg' ====
+.text
+x86_neg:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L292;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L292;
+ldidw 0;
+jmp @L293;
+@L292:
+ldidw 1;
+@L293:
+jmpf @L294;
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw x86_load2;
+call 8;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S208;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S209;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S210;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S211;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S212;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S213;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L295:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L296:
+ldidw 0;
+jmpf @L297;
+jmp @L295;
+@L297:
+jmp @L298;
+@L294:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S214;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S215;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L299:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L300:
+ldidw 0;
+jmpf @L301;
+jmp @L299;
+@L301:
+@L298:
+ldidw 0;
+ret;
+# ==== start of definition of function `x86_neq' ====
+.text
+x86_neq:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L302;
+ldidw 9;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x86_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L303;
+@L302:
+# var: res, offset: 16
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L306;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L308;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L308;
+ldidw 0;
+jmp @L309;
+@L308:
+ldidw 1;
+@L309:
+jmpt @L306;
+ldidw 0;
+jmp @L307;
+@L306:
+ldidw 1;
+@L307:
+jmpt @L304;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L304;
+ldidw 0;
+jmp @L305;
+@L304:
+ldidw 1;
+@L305:
+jmpf @L310;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+jmp @L311;
+@L310:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+stdw;
+pop;
+@L311:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S216;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S217;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L312;
+ldiqw x86_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S218;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S219;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S220;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S221;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L313:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L314:
+ldidw 0;
+jmpf @L315;
+jmp @L313;
+@L315:
+jmp @L316;
+@L312:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L316:
+@L303:
+ldidw 0;
+ret;
+.extern strcat
+.extern are_compatible
+.extern error_count
+# ==== start of definition of function `x86_and' ====
+.text
+x86_and:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L317;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L317;
+ldidw 0;
+jmp @L318;
+@L317:
+ldidw 1;
+@L318:
+jmpf @L319;
+# var: op, offset: 8
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 16;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw x86_load2;
+call 8;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S222;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S223;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S224;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S225;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L320:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L321:
+ldidw 0;
+jmpf @L322;
+jmp @L320;
+@L322:
+jmp @L323;
+@L319:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S226;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S227;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L324:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L325:
+ldidw 0;
+jmpf @L326;
+jmp @L324;
+@L326:
+@L323:
+ldidw 0;
+ret;
+.extern free_pre_token
+.extern cg_nodes_counter
+.extern round_up
+.extern analyze_declarator
+# ==== start of definition of function `free_all_temps' ====
+.text
+free_all_temps:
+addsp 20;        
+# var: p, offset: 8
+# var: q, offset: 16
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L327:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L328;
+ldbp 8;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+jmp @L327;
+@L328:
+ldidw 0;
+dw2qw;
+ldiqw temp_list;
+stqw;
+pop;
+pop;
+ldidw 0;
+ret;
+.bss
+.align 8
+func_prolog:
+.res 8
+.extern include_liblux
+# ==== start of definition of function `x86_function_definition' ====
+.text
+x86_function_definition:
+addsp 60;        
+# param:`decl_specs', offset:-24
+# param:`header', offset:-32
+# var: cat, offset: 4
+# var: i, offset: 8
+# var: last_i, offset: 12
+# var: fn, offset: 16
+# var: pos_tmp, offset: 20
+# var: scs, offset: 24
+# var: ty, offset: 32
+.data
+.align 4
+@x86_function_definition_first_func:
+.align 4
+.dword 1
+.text
+ldbp -32;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw curr_func;
+stqw;
+pop;
+pop;
+ldiqw curr_func;
+ldqw;
+ldiqw new_cg_node;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldidw 4;
+ldiqw cg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 40;
+addqw;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldbp 16;
+lddw;
+ldiqw compute_liveness_and_next_use;
+call 4;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldbp 32;
+ldiqw 0;
+addqw;
+stqw;
+pop;
+pop;
+ldbp -32;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 32;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 32;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L329;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L329;
+ldidw 0;
+jmp @L330;
+@L329:
+ldidw 1;
+@L330:
+jmpf @L331;
+ldidw 1;
+ldiqw big_return;
+stdw;
+pop;
+jmp @L332;
+@L331:
+ldbp 4;
+lddw;
+ldidw 110;
+eqdw;
+jmpt @L333;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L333;
+ldidw 0;
+jmp @L334;
+@L333:
+ldidw 1;
+@L334:
+jmpf @L335;
+ldidw 1;
+ldiqw qword_return;
+stdw;
+pop;
+@L335:
+@L332:
+ldiqw @x86_function_definition_first_func;
+lddw;
+notdw;
+jmpf @L336;
+ldiqw @S228;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L336:
+ldiqw curr_func;
+ldqw;
+ldiqw @S229;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S230;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L337:
+ldiqw curr_segment;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L340;
+ldiqw str_segment;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S231;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S232;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw curr_segment;
+stdw;
+pop;
+@L340:
+@L338:
+ldidw 0;
+jmpf @L339;
+jmp @L337;
+@L339:
+ldbp -24;
+ldqw;
+ldiqw get_sto_class_spec;
+call 8;
+ldbp 24;
+stqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L341;
+ldbp 24;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 67;
+neqdw;
+jmpt @L341;
+ldidw 0;
+jmp @L342;
+@L341:
+ldidw 1;
+@L342:
+jmpf @L343;
+ldiqw curr_func;
+ldqw;
+ldiqw @S233;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S234;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L343:
+ldiqw curr_func;
+ldqw;
+ldiqw @S235;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S236;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw big_return;
+lddw;
+jmpf @L344;
+ldiqw @S237;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S238;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S239;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S240;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L344:
+ldiqw @S241;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S242;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S243;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S244;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldbp 8;
+stdw;
+pop;
+ldiqw cfg_nodes;
+ldqw;
+ldiqw cg_nodes;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 72;
+mulqw;
+addqw;
+ldiqw 12;
+addqw;
+lddw;
+udw2qw;
+ldiqw 80;
+mulqw;
+addqw;
+ldiqw 4;
+addqw;
+lddw;
+ldbp 12;
+stdw;
+pop;
+ldbp 12;
+lddw;
+ldiqw func_last_quad;
+stdw;
+pop;
+@L345:
+ldbp 8;
+lddw;
+ldbp 12;
+lddw;
+sletdw;
+jmpf @L347;
+# var: tar, offset: 48
+# var: arg1, offset: 52
+# var: arg2, offset: 56
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 48;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 52;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 56;
+stdw;
+pop;
+ldiqw verbose_asm;
+lddw;
+jmpf @L348;
+ldiqw C_source;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L348;
+ldidw 1;
+jmp @L349;
+@L348:
+ldidw 0;
+@L349:
+jmpf @L350;
+ldiqw C_source;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S245;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S246;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L350:
+ldbp 56;
+lddw;
+ldbp 52;
+lddw;
+ldbp 48;
+lddw;
+ldbp 8;
+lddw;
+ldiqw instruction_handlers;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+dw2qw;
+ldxqw 8;
+call 16;
+pop;
+pop;
+@L346:
+incldw 8;
+jmp @L345;
+@L347:
+ldiqw size_of_local_area;
+lddw;
+ldidw 4;
+ldiqw temp_struct_size;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+subdw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldbp 20;
+stdw;
+pop;
+@L351:
+ldiqw calls_to_fix_counter;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+ldidw 0;
+sgetdw;
+jmpf @L352;
+# var: n, offset: 48
+# var: s, offset: 56
+ldiqw calls_to_fix;
+ldiqw calls_to_fix_counter;
+lddw;
+dw2qw;
+ldxdw 4;
+ldiqw func_body;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_curr;
+call 8;
+ldbp 56;
+stqw;
+pop;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldiqw @S247;
+ldbp 56;
+ldqw;
+ldiqw sprintf;
+call 20;
+pop;
+ldbp 48;
+stdw;
+pop;
+ldidw 93;
+dw2b;
+ldbp 56;
+ldqw;
+ldbp 48;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+addqw;
+stb;
+pop;
+@L353:
+ldbp 56;
+ldqw;
+ldbp 48;
+lddw;
+dw2qw;
+ldxb 1;
+ldidw 88;
+eqdw;
+jmpf @L355;
+ldidw 32;
+dw2b;
+ldbp 56;
+ldqw;
+ldbp 48;
+lddw;
+dw2qw;
+addqw;
+stb;
+pop;
+@L354:
+incldw 48;
+jmp @L353;
+@L355:
+jmp @L351;
+@L352:
+ldbp 20;
+lddw;
+ldiqw func_body;
+ldqw;
+ldiqw string_set_pos;
+call 12;
+pop;
+pop;
+ldiqw size_of_local_area;
+lddw;
+jmpf @L356;
+ldiqw size_of_local_area;
+lddw;
+negdw;
+ldiqw @S248;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S249;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L356:
+ldiqw modified;
+ldidw 4;
+dw2qw;
+ldxdw 4;
+jmpf @L357;
+ldiqw @S250;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S251;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L357:
+ldiqw modified;
+ldidw 5;
+dw2qw;
+ldxdw 4;
+jmpf @L358;
+ldiqw @S252;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S253;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L358:
+ldiqw modified;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+jmpf @L359;
+ldiqw @S254;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S255;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L359:
+ldiqw big_return;
+lddw;
+jmpf @L360;
+ldiqw @S256;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S257;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S258;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S259;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L360:
+ldiqw modified;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+jmpf @L361;
+ldiqw @S260;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S261;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L361:
+ldiqw modified;
+ldidw 5;
+dw2qw;
+ldxdw 4;
+jmpf @L362;
+ldiqw @S262;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S263;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L362:
+ldiqw modified;
+ldidw 4;
+dw2qw;
+ldxdw 4;
+jmpf @L363;
+ldiqw @S264;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S265;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L363:
+ldiqw @S266;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S267;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S268;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S269;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S270;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S271;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw func_prolog;
+ldqw;
+ldiqw x86_write;
+call 8;
+pop;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw x86_write;
+call 8;
+pop;
+pop;
+ldiqw func_epilog;
+ldqw;
+ldiqw x86_write;
+call 8;
+pop;
+pop;
+ldiqw func_prolog;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+ldiqw func_epilog;
+ldqw;
+ldiqw string_clear;
+call 8;
+pop;
+pop;
+ldidw 0;
+ldiqw temp_struct_size;
+stdw;
+pop;
+ldidw 0;
+ldiqw calls_to_fix_counter;
+stdw;
+pop;
+ldiqw 4;
+ldidw 6;
+dw2qw;
+mulqw;
+ldidw 0;
+ldiqw modified;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldiqw 4;
+ldidw 6;
+dw2qw;
+mulqw;
+ldidw 0;
+ldiqw pinned;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldiqw free_all_temps;
+call 0;
+pop;
+pop;
+ldbp 16;
+lddw;
+ldiqw ic_free_function;
+call 4;
+pop;
+pop;
+ldiqw nid_counter;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+ldidw 1;
+negdw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldiqw 4;
+ldidw 6;
+dw2qw;
+mulqw;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldiqw memset;
+call 20;
+pop;
+pop;
+ldidw 0;
+ldiqw qword_return;
+stdw;
+ldiqw big_return;
+stdw;
+pop;
+ldiqw dump_addr_descr_tab;
+call 0;
+pop;
+pop;
+ldiqw dump_reg_descr_tab;
+call 0;
+pop;
+pop;
+ldidw 0;
+ldiqw @x86_function_definition_first_func;
+stdw;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `x86_arg' ====
+.text
+x86_arg:
+addsp 28;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: ty, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L364:
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpt @L367;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 76;
+neqdw;
+jmpt @L367;
+ldidw 0;
+jmp @L368;
+@L367:
+ldidw 1;
+@L368:
+notdw;
+jmpf @L369;
+ldidw 2094;
+ldiqw @S272;
+ldiqw @S273;
+ldiqw @S274;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L369:
+@L365:
+ldidw 0;
+jmpf @L366;
+jmp @L364;
+@L366:
+ldbp 8;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L370;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L370;
+ldidw 0;
+jmp @L371;
+@L370:
+ldidw 1;
+@L371:
+jmpf @L372;
+# var: op, offset: 16
+ldbp -28;
+lddw;
+ldiqw x86_get_operand2;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S275;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S276;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw @S277;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S278;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 8;
+ldiqw arg_stack;
+ldiqw arg_stack_top;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L373;
+@L372:
+ldbp 4;
+lddw;
+ldidw 68;
+eqdw;
+jmpt @L374;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L374;
+ldidw 0;
+jmp @L375;
+@L374:
+ldidw 1;
+@L375:
+jmpf @L376;
+# var: siz, offset: 16
+# var: asiz, offset: 20
+# var: cluttered, offset: 24
+# var: savnb, offset: 28
+ldbp 8;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldidw 4;
+ldbp 16;
+lddw;
+ldiqw round_up;
+call 8;
+pop;
+ldbp 20;
+stdw;
+pop;
+ldbp 20;
+lddw;
+ldiqw @S279;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S280;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 20;
+lddw;
+ldiqw arg_stack;
+ldiqw arg_stack_top;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 28;
+stdw;
+ldbp 24;
+stdw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 4;
+neqdw;
+jmpf @L377;
+ldiqw reg_descr_tab;
+ldidw 4;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L378;
+ldbp 24;
+lddw;
+ldidw 1;
+ordw;
+ldbp 24;
+stdw;
+pop;
+ldiqw @S281;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S282;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 28;
+lddw;
+ldidw 4;
+adddw;
+ldbp 28;
+stdw;
+pop;
+jmp @L379;
+@L378:
+ldidw 1;
+ldiqw modified;
+ldidw 4;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L379:
+ldbp -28;
+lddw;
+ldidw 4;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+@L377:
+ldiqw reg_descr_tab;
+ldidw 5;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L380;
+ldbp 24;
+lddw;
+ldidw 2;
+ordw;
+ldbp 24;
+stdw;
+pop;
+ldiqw @S283;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S284;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 28;
+lddw;
+ldidw 4;
+adddw;
+ldbp 28;
+stdw;
+pop;
+jmp @L381;
+@L380:
+ldidw 1;
+ldiqw modified;
+ldidw 5;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L381:
+ldbp 28;
+lddw;
+notdw;
+jmpf @L382;
+ldiqw @S285;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S286;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L383;
+@L382:
+ldbp 28;
+lddw;
+ldiqw @S287;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S288;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L383:
+ldiqw reg_descr_tab;
+ldidw 2;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L384;
+ldbp 24;
+lddw;
+ldidw 4;
+ordw;
+ldbp 24;
+stdw;
+pop;
+ldiqw @S289;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S290;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L384:
+ldbp 16;
+lddw;
+ldiqw @S291;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S292;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S293;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S294;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldidw 4;
+anddw;
+jmpf @L385;
+ldiqw @S295;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S296;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L385:
+ldbp 24;
+lddw;
+ldidw 2;
+anddw;
+jmpf @L386;
+ldiqw @S297;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S298;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L386:
+ldbp 24;
+lddw;
+ldidw 1;
+anddw;
+jmpf @L387;
+ldiqw @S299;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S300;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L387:
+jmp @L388;
+@L376:
+ldbp -28;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldiqw @S301;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S302;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 4;
+ldiqw arg_stack;
+ldiqw arg_stack_top;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L388:
+@L373:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern stat_number_of_pre_tokens
+.data
+.align 8
+libfuncs:
+.align 8
+.qword @S303+0
+.align 8
+.qword @S304+0
+.align 8
+.qword @S305+0
+.align 8
+.qword @S306+0
+.align 8
+.qword @S307+0
+.align 8
+.qword @S308+0
+.align 8
+.qword @S309+0
+.align 8
+.qword @S310+0
+.align 8
+.qword @S311+0
+.align 8
+.qword @S312+0
+.align 8
+.qword @S313+0
+.align 8
+.qword @S314+0
+.align 8
+.qword @S315+0
+.align 8
+.qword @S316+0
+.align 8
+.qword @S317+0
+.align 8
+.qword @S318+0
+.align 8
+.qword @S319+0
+.align 8
+.qword @S320+0
+.extern bset_eq
+# ==== start of definition of function `x86_do_libcall' ====
+.text
+x86_do_libcall:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# param:`func', offset:-36
+# var: nb, offset: 4
+ldbp -36;
+lddw;
+ldiqw @T389;
+jmptab;
+@L391:
+@L392:
+@L393:
+@L394:
+@L395:
+# var: op, offset: 8
+# var: res, offset: 16
+ldidw 0;
+dw2w;
+ldbp 16;
+stw;
+pop;
+ldidw 3;
+dw2w;
+ldbp 18;
+stw;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S321;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S322;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw @S323;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S324;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 8;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldiqw x86_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S325;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S326;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw @S327;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S328;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 8;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldiqw libfuncs;
+ldbp -36;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S329;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S330;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S331;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S332;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L396:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L397:
+ldidw 0;
+jmpf @L398;
+jmp @L396;
+@L398:
+jmp @L390;
+@L399:
+@L400:
+@L401:
+# var: op, offset: 8
+# var: res, offset: 16
+ldidw 0;
+dw2w;
+ldbp 16;
+stw;
+pop;
+ldidw 3;
+dw2w;
+ldbp 18;
+stw;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldiqw @S333;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S334;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldiqw x86_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S335;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S336;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw @S337;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S338;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 8;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldiqw libfuncs;
+ldbp -36;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S339;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S340;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S341;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S342;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L402:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L403:
+ldidw 0;
+jmpf @L404;
+jmp @L402;
+@L404:
+jmp @L390;
+@L405:
+# var: op, offset: 8
+# var: res, offset: 16
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldiqw @S343;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S344;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S345;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S346;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 8;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldiqw x86_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S347;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S348;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw @S349;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S350;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 8;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldiqw @S351;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S352;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S353;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S354;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S355;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S356;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S357;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S358;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S359;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S360;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L406:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L407:
+ldidw 0;
+jmpf @L408;
+jmp @L406;
+@L408:
+jmp @L390;
+@L409:
+@L410:
+@L411:
+@L412:
+@L413:
+@L414:
+@L415:
+@L416:
+@L417:
+@L418:
+# var: op, offset: 8
+# var: res, offset: 16
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S361;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S362;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw @S363;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S364;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 8;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldiqw x86_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S365;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S366;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw @S367;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S368;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 8;
+adddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldiqw libfuncs;
+ldbp -36;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S369;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S370;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S371;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S372;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -36;
+lddw;
+ldiqw @T419;
+jmptab;
+@L421:
+ldiqw @S373;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S374;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S375;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S376;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S377;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S378;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L420;
+@L422:
+ldiqw @S379;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S380;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S381;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S382;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S383;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S384;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L420;
+@L423:
+@L424:
+ldiqw @S385;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S386;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S387;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S388;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S389;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S390;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L420;
+@L425:
+@L426:
+ldiqw @S391;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S392;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S393;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S394;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S395;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S396;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L420;
+@L427:
+@L428:
+ldiqw @S397;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S398;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S399;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S400;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S401;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S402;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L420;
+@L429:
+@L430:
+ldiqw @S403;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S404;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S405;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S406;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S407;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S408;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L420;
+@L420:
+.data
+.align 8
+@T419:
+.dword 8
+.dword 10
+.qword @L420
+.qword @L421
+.qword @L422
+.qword @L423
+.qword @L425
+.qword @L427
+.qword @L429
+.qword @L424
+.qword @L426
+.qword @L428
+.qword @L430
+.text
+@L431:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L432:
+ldidw 0;
+jmpf @L433;
+jmp @L431;
+@L433:
+jmp @L390;
+@L390:
+.data
+.align 8
+@T389:
+.dword 0
+.dword 19
+.qword @L390
+.qword @L391
+.qword @L392
+.qword @L393
+.qword @L394
+.qword @L395
+.qword @L399
+.qword @L400
+.qword @L401
+.qword @L409
+.qword @L410
+.qword @L412
+.qword @L414
+.qword @L416
+.qword @L418
+.qword @L411
+.qword @L413
+.qword @L415
+.qword @L417
+.qword @L405
+.text
+ldidw 0;
+ret;
+# ==== start of definition of function `x86_asn' ====
+.text
+x86_asn:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L434;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L434;
+ldidw 0;
+jmp @L435;
+@L434:
+ldidw 1;
+@L435:
+jmpf @L436;
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw x86_load2;
+call 8;
+pop;
+pop;
+@L437:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L438:
+ldidw 0;
+jmpf @L439;
+jmp @L437;
+@L439:
+jmp @L440;
+@L436:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+@L441:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L442:
+ldidw 0;
+jmpf @L443;
+jmp @L441;
+@L443:
+@L440:
+ldidw 0;
+ret;
+.extern strchr
+.extern add_angle_dir
+.extern analyze_conditional_expression
+.extern ic_outpath
+.extern arena_alloc
+.bss
+.align 4
+calls_to_fix:
+.res 256
+.data
+.align 8
+x86_reg_str:
+.align 8
+.qword @S409+0
+.align 8
+.qword @S410+0
+.align 8
+.qword @S411+0
+.align 8
+.qword @S412+0
+.align 8
+.qword @S413+0
+.align 8
+.qword @S414+0
+.extern stdout
+.extern get_type_category
+# ==== start of definition of function `x86_nop' ====
+.text
+x86_nop:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldidw 0;
+ret;
+# ==== start of definition of function `x86_not' ====
+.text
+x86_not:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L444;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L444;
+ldidw 0;
+jmp @L445;
+@L444:
+ldidw 1;
+@L445:
+jmpf @L446;
+ldidw 18;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x86_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L447;
+@L446:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S415;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S416;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_lbreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S417;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S418;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_lbreg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S419;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S420;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L448:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L449:
+ldidw 0;
+jmpf @L450;
+jmp @L448;
+@L450:
+@L447:
+ldidw 0;
+ret;
+.extern ilog2
+.extern strcmp
+.bss
+.align 8
+func_body:
+.res 8
+.extern bset_fill
+.extern strtok
+.extern strtol
+.extern parse_header
+.extern stdin
+.extern dflow_Dom
+.extern is_integer
+.extern analyze_postfix_expression
+.extern ftell
+.extern strcpy
+# ==== start of definition of function `x86_static_expr' ====
+.text
+x86_static_expr:
+addsp 28;        
+# param:`e', offset:-24
+ldbp -24;
+ldqw;
+ldiqw 52;
+addqw;
+lddw;
+ldiqw @T451;
+jmptab;
+@L453:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+lddw;
+ldiqw @T454;
+switch;
+@L456:
+# var: pi, offset: 4
+# var: ii, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L457;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+jmp @L458;
+@L457:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L458:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L459;
+# var: ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S421;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+@L459:
+jmp @L455;
+@L460:
+@L461:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldidw 71;
+neqdw;
+jmpf @L462;
+# var: m, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw 0;
+addqw;
+ldqw;
+ldiqw get_type_spec;
+call 8;
+ldiqw get_member_descriptor;
+call 16;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+jmpf @L463;
+ldbp 8;
+ldqw;
+ldiqw 12;
+addqw;
+lddw;
+ldiqw @S422;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+@L463:
+jmp @L464;
+@L462:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+@L464:
+jmp @L455;
+@L465:
+@L466:
+@L467:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+jmp @L455;
+@L468:
+ldbp -24;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L469;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+ldiqw @S423;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+jmp @L470;
+@L469:
+# var: pi, offset: 4
+# var: ii, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L471;
+ldidw 1;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+jmp @L472;
+@L471:
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+ldidw 1;
+ldbp 8;
+stdw;
+pop;
+@L472:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L473;
+# var: ty, offset: 16
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 4;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 16;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 16;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 16;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S424;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+@L473:
+@L470:
+jmp @L455;
+@L474:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw is_integer;
+call 4;
+pop;
+jmpf @L475;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+ldiqw @S425;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+jmp @L476;
+@L475:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L477;
+# var: ty, offset: 8
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 72;
+addqw;
+ldbp 8;
+swap2;
+memcpy 16;
+pop;
+pop;
+ldbp 8;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw 24;
+addqw;
+ldqw;
+ldbp 8;
+ldiqw 8;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S426;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+@L477:
+@L476:
+jmp @L455;
+@L478:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw 56;
+addqw;
+ldqw;
+ordw;
+jmpf @L479;
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+jmp @L480;
+@L479:
+ldbp -24;
+ldqw;
+ldiqw 0;
+addqw;
+ldidw 2;
+dw2qw;
+ldxqw 8;
+ldiqw x86_static_expr;
+call 8;
+pop;
+pop;
+@L480:
+jmp @L455;
+@L481:
+@L482:
+ldidw 0;
+notdw;
+jmpf @L485;
+ldidw 2632;
+ldiqw @S427;
+ldiqw @S428;
+ldiqw @S429;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L485:
+@L483:
+ldidw 0;
+jmpf @L484;
+jmp @L482;
+@L484:
+@L455:
+.data
+.align 8
+@T454:
+.dword 10
+.dword 6
+.dword 7
+.dword 12
+.dword 13
+.dword 30
+.dword 97
+.dword 101
+.dword 103
+.dword 105
+.qword @L481
+.qword @L460
+.qword @L461
+.qword @L468
+.qword @L474
+.qword @L478
+.qword @L456
+.qword @L466
+.qword @L465
+.qword @L467
+.text
+jmp @L452;
+@L486:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S430;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+jmp @L452;
+@L487:
+ldiqw string_literals_counter;
+lddw;
+ldiqw @S431;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S432;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw str_lits;
+ldqw;
+ldiqw emit_raw_string;
+call 16;
+pop;
+pop;
+ldiqw string_literals_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S433;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+jmp @L452;
+@L488:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L489;
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw enclosing_function;
+ldqw;
+ldiqw @S434;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+jmp @L490;
+@L489:
+ldbp -24;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S435;
+ldiqw asm_decls;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+@L490:
+jmp @L452;
+@L452:
+.data
+.align 8
+@T451:
+.dword 0
+.dword 4
+.qword @L452
+.qword @L453
+.qword @L486
+.qword @L487
+.qword @L488
+.text
+ldidw 0;
+ret;
+.bss
+.align 4
+arg_stack_top:
+.res 4
+# ==== start of definition of function `x86_jmp' ====
+.text
+x86_jmp:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 31;
+eqdw;
+jmpf @L491;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L491;
+ldidw 1;
+jmp @L492;
+@L491:
+ldidw 0;
+@L492:
+jmpf @L493;
+ldiqw 0;
+ret;
+@L493:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S436;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S437;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern install_tag
+# ==== start of definition of function `x86_write' ====
+.text
+x86_write:
+addsp 0;         
+# param:`s', offset:-24
+ldiqw x86_output_str;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L494;
+ldbp -24;
+ldqw;
+ldiqw x86_output_str;
+ldqw;
+ldiqw string_append;
+call 16;
+pop;
+pop;
+jmp @L495;
+@L494:
+ldiqw x86_output_file;
+ldqw;
+ldbp -24;
+ldqw;
+ldiqw string_write;
+call 16;
+pop;
+pop;
+@L495:
+ldidw 0;
+ret;
+# ==== start of definition of function `spill_aliased_objects' ====
+.text
+spill_aliased_objects:
+addsp 8;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L496:
+ldbp 4;
+lddw;
+ldidw 6;
+sltdw;
+jmpf @L498;
+# var: a, offset: 8
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+jmpf @L499;
+jmp @L497;
+@L499:
+ldiqw reg_descr_tab;
+ldbp 4;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 8;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L500;
+ldiqw ic_addresses;
+ldqw;
+ldbp 8;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldiqw address_taken_variables;
+ldqw;
+ldiqw bset_member;
+call 12;
+pop;
+jmpf @L500;
+ldidw 1;
+jmp @L501;
+@L500:
+ldidw 0;
+@L501:
+jmpf @L502;
+ldbp 4;
+lddw;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+@L502:
+@L497:
+incldw 4;
+jmp @L496;
+@L498:
+ldidw 0;
+ret;
+.extern ic_function_to_print
+.extern strtoull
+.bss
+.align 4
+temp_struct_size:
+.res 4
+.extern strlen
+.extern token_table
+.bss
+.align 4
+modified:
+.res 24
+# ==== start of definition of function `x86_compare_against_constant' ====
+.text
+x86_compare_against_constant:
+addsp 20;        
+# param:`a', offset:-20
+# param:`c', offset:-24
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L503;
+@L504:
+ldidw 0;
+notdw;
+jmpf @L507;
+ldidw 763;
+ldiqw @S438;
+ldiqw @S439;
+ldiqw @S440;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L507:
+@L505:
+ldidw 0;
+jmpf @L506;
+jmp @L504;
+@L506:
+jmp @L508;
+@L503:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L509;
+@L510:
+ldidw 0;
+notdw;
+jmpf @L513;
+ldidw 765;
+ldiqw @S441;
+ldiqw @S442;
+ldiqw @S443;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L513:
+@L511:
+ldidw 0;
+jmpf @L512;
+jmp @L510;
+@L512:
+jmp @L514;
+@L509:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L515;
+# var: e, offset: 8
+# var: siz_str, offset: 16
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L516;
+ldbp -24;
+lddw;
+ldiqw x86_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S444;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S445;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L516:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T517;
+switch;
+@L519:
+@L520:
+ldiqw @S446;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L518;
+@L521:
+@L522:
+@L523:
+ldiqw @S447;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L518;
+@L524:
+ldiqw @S448;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L518;
+@L518:
+.data
+.align 8
+@T517:
+.dword 6
+.dword 49
+.dword 64
+.dword 106
+.dword 107
+.dword 108
+.qword @L524
+.qword @L521
+.qword @L519
+.qword @L522
+.qword @L523
+.qword @L520
+.text
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L525;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L526;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw @S449;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 44;
+pop;
+pop;
+ldiqw @S450;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L527;
+@L526:
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw @S451;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S452;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L527:
+jmp @L528;
+@L525:
+ldbp -24;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw @S453;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S454;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L528:
+jmp @L529;
+@L515:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L530;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L531;
+ldbp -24;
+lddw;
+ldiqw x86_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S455;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S456;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L532;
+@L531:
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldiqw @S457;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S458;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L532:
+@L530:
+@L529:
+@L514:
+@L508:
+ldidw 0;
+ret;
+.extern string_vprintf
+.extern bset_free
+.bss
+.align 4
+jump_tables_counter:
+.res 4
+.extern analyze_expression
+# ==== start of definition of function `free_temp' ====
+.text
+free_temp:
+addsp 12;        
+# param:`a', offset:-20
+# var: p, offset: 8
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L533:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L535;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+notdw;
+jmpf @L536;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpf @L536;
+ldidw 1;
+jmp @L537;
+@L536:
+ldidw 0;
+@L537:
+jmpf @L538;
+ldidw 1;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+jmp @L535;
+@L538:
+@L534:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L533;
+@L535:
+ldidw 0;
+ret;
+.data
+.align 8
+str_segment:
+.align 8
+.qword @S459+0
+.align 8
+.qword @S460+0
+.align 8
+.qword @S461+0
+.align 8
+.qword @S462+0
+.bss
+.align 4
+reg_descr_tab:
+.res 24
+.extern cfg_nodes
+.extern memchr
+.extern new_type_exp_node
+.extern analyze_primary_expression
+.extern dup_decl_specs
+.extern new_declaration_node
+.extern vfprintf
+.extern eval_const_expr
+.extern hash
+.data
+.align 8
+instruction_handlers:
+.align 8
+.qword x86_add+0
+.align 8
+.qword x86_sub+0
+.align 8
+.qword x86_mul+0
+.align 8
+.qword x86_div+0
+.align 8
+.qword x86_rem+0
+.align 8
+.qword x86_shl+0
+.align 8
+.qword x86_shr+0
+.align 8
+.qword x86_and+0
+.align 8
+.qword x86_or+0
+.align 8
+.qword x86_xor+0
+.align 8
+.qword x86_eq+0
+.align 8
+.qword x86_neq+0
+.align 8
+.qword x86_lt+0
+.align 8
+.qword x86_let+0
+.align 8
+.qword x86_gt+0
+.align 8
+.qword x86_get+0
+.align 8
+.qword x86_neg+0
+.align 8
+.qword x86_cmpl+0
+.align 8
+.qword x86_not+0
+.align 8
+.qword x86_ch+0
+.align 8
+.qword x86_uch+0
+.align 8
+.qword x86_sh+0
+.align 8
+.qword x86_ush+0
+.align 8
+.qword x86_llsx+0
+.align 8
+.qword x86_llzx+0
+.align 8
+.qword x86_addr_of+0
+.align 8
+.qword x86_ind+0
+.align 8
+.qword x86_asn+0
+.align 8
+.qword x86_call+0
+.align 8
+.qword x86_indcall+0
+.align 8
+.qword x86_ind_asn+0
+.align 8
+.qword x86_lab+0
+.align 8
+.qword x86_jmp+0
+.align 8
+.qword x86_arg+0
+.align 8
+.qword x86_ret+0
+.align 8
+.qword x86_switch+0
+.align 8
+.qword x86_case+0
+.align 8
+.qword x86_cbr+0
+.align 8
+.qword x86_begarg+0
+.align 8
+.qword x86_nop+0
+.extern string_clear
+.bss
+.align 8
+asm_decls:
+.res 8
+# ==== start of definition of function `x86_shl' ====
+.text
+x86_shl:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L539;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L539;
+ldidw 0;
+jmp @L540;
+@L539:
+ldidw 1;
+@L540:
+jmpf @L541;
+ldidw 5;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x86_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L542;
+@L541:
+# var: res, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L543;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S463;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S464;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L544;
+@L543:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 2;
+neqdw;
+jmpf @L545;
+ldidw 2;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 2;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+@L545:
+ldidw 1;
+ldiqw pinned;
+ldidw 2;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S465;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S466;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldidw 2;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L544:
+@L546:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L547:
+ldidw 0;
+jmpf @L548;
+jmp @L546;
+@L548:
+@L542:
+ldidw 0;
+ret;
+# ==== start of definition of function `x86_shr' ====
+.text
+x86_shr:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L549;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L549;
+ldidw 0;
+jmp @L550;
+@L549:
+ldidw 1;
+@L550:
+jmpf @L551;
+ldbp 4;
+lddw;
+ldiqw is_signed_int;
+call 4;
+pop;
+jmpf @L552;
+ldidw 6;
+jmp @L553;
+@L552:
+ldidw 7;
+@L553:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x86_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L554;
+@L551:
+# var: instr, offset: 8
+# var: res, offset: 16
+ldbp 4;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L555;
+ldiqw @S467;
+jmp @L556;
+@L555:
+ldiqw @S468;
+@L556:
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L557;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw @S469;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S470;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L558;
+@L557:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 2;
+neqdw;
+jmpf @L559;
+ldidw 2;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldidw 2;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+@L559:
+ldidw 1;
+ldiqw pinned;
+ldidw 2;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldiqw @S471;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S472;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldidw 2;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L558:
+@L560:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L561:
+ldidw 0;
+jmpf @L562;
+jmp @L560;
+@L562:
+@L554:
+ldidw 0;
+ret;
+.extern bsearch
+.extern pre_save_pch
+.extern qsort
+.extern analyze_parameter_declaration
+.extern string_new
+.extern cg_outpath
+# ==== start of definition of function `x86_cgen_str' ====
+.text
+x86_cgen_str:
+.global x86_cgen_str
+addsp 0;         
+# param:`outs', offset:-24
+ldbp -24;
+ldqw;
+ldiqw x86_output_str;
+stqw;
+pop;
+pop;
+ldidw 0;
+dw2qw;
+ldiqw x86_cgen;
+call 8;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern memcmp
+.extern bset_insert
+.extern pre_load_pch
+.extern dflow_free_LiveOut
+.extern vsnprintf
+.extern vsprintf
+.bss
+.align 8
+str_lits:
+.res 8
+.extern nid_counter
+.extern new_cg_node
+.extern warning_count
+.extern memcpy
+.bss
+.align 4
+func_last_quad:
+.res 4
+# ==== start of definition of function `x86_load_addr' ====
+.text
+x86_load_addr:
+addsp 12;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+# var: e, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L563;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L564;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldiqw x86_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S473;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 40;
+pop;
+pop;
+ldiqw @S474;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L565;
+@L564:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw x86_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S475;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S476;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L565:
+jmp @L566;
+@L563:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw x86_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S477;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S478;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L566:
+ldidw 0;
+ret;
+.extern fopen
+.extern be_atoi
+.bss
+.align 4
+big_return:
+.res 4
+.extern bset_delete
+# ==== start of definition of function `spill_reg' ====
+.text
+spill_reg:
+addsp 8;         
+# param:`r', offset:-20
+# var: a, offset: 4
+ldiqw reg_descr_tab;
+ldbp -20;
+lddw;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+jmpf @L567;
+ldiqw 0;
+ret;
+@L567:
+ldiqw reg_descr_tab;
+ldbp -20;
+lddw;
+dw2qw;
+ldxdw 4;
+ldbp 4;
+stdw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L568;
+# var: rr, offset: 8
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw x86_store2;
+call 8;
+pop;
+pop;
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+stw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+ldiqw reg_descr_tab;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L569;
+@L568:
+ldbp 4;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x86_store;
+call 8;
+pop;
+pop;
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L569:
+ldidw 0;
+ret;
+.extern push_scope
+.extern free_c_token
+# ==== start of definition of function `x86_load' ====
+.text
+x86_load:
+addsp 28;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L570;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw x86_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S479;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S480;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L571;
+@L570:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L572;
+ldbp -24;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldiqw x86_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S481;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S482;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L573;
+@L572:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L574;
+# var: e, offset: 8
+# var: siz_str, offset: 16
+# var: mov_str, offset: 24
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L575;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+lddw;
+eqdw;
+jmpf @L576;
+jmp @L577;
+@L576:
+ldiqw x86_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S483;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S484;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L577:
+ldiqw 0;
+ret;
+@L575:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T578;
+switch;
+@L580:
+@L581:
+@L582:
+@L583:
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x86_load_addr;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L584:
+ldiqw @S485;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw @S486;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L579;
+@L585:
+ldiqw @S487;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw @S488;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L579;
+@L586:
+@L587:
+ldiqw @S489;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw @S490;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L579;
+@L588:
+ldiqw @S491;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw @S492;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L579;
+@L589:
+ldiqw @S493;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw @S494;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L579;
+@L579:
+.data
+.align 8
+@T578:
+.dword 10
+.dword 49
+.dword 64
+.dword 68
+.dword 71
+.dword 97
+.dword 98
+.dword 106
+.dword 107
+.dword 108
+.qword @L589
+.qword @L586
+.qword @L584
+.qword @L580
+.qword @L581
+.qword @L582
+.qword @L583
+.qword @L587
+.qword @L588
+.qword @L585
+.text
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L590;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L591;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw x86_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 24;
+ldqw;
+ldiqw @S495;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 56;
+pop;
+pop;
+ldiqw @S496;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L592;
+@L591:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 16;
+ldqw;
+ldiqw x86_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 24;
+ldqw;
+ldiqw @S497;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 48;
+pop;
+pop;
+ldiqw @S498;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L592:
+jmp @L593;
+@L590:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+ldqw;
+ldiqw x86_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 24;
+ldqw;
+ldiqw @S499;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 44;
+pop;
+pop;
+ldiqw @S500;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L593:
+jmp @L594;
+@L574:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L595;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L596;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+lddw;
+eqdw;
+jmpf @L597;
+ldiqw 0;
+ret;
+jmp @L598;
+@L597:
+ldiqw x86_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S501;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S502;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L598:
+jmp @L599;
+@L596:
+ldbp -24;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldiqw x86_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S503;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S504;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L599:
+@L595:
+@L594:
+@L573:
+@L571:
+ldidw 0;
+ret;
+.extern ic_main
+.extern new_address
+.extern parse
+.extern get_pre_token
+# ==== start of definition of function `get_temp_offs' ====
+.text
+get_temp_offs:
+addsp 12;        
+# param:`a', offset:-20
+# var: p, offset: 8
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L600:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L602;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+notdw;
+jmpf @L603;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+eqdw;
+jmpf @L603;
+ldidw 1;
+jmp @L604;
+@L603:
+ldidw 0;
+@L604:
+jmpf @L605;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ret;
+@L605:
+@L601:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L600;
+@L602:
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L606:
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L608;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+lddw;
+jmpf @L609;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ret;
+@L609:
+@L607:
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L606;
+@L608:
+ldiqw 24;
+ldiqw malloc;
+call 8;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldidw 8;
+subdw;
+ldiqw size_of_local_area;
+stdw;
+pop;
+ldiqw size_of_local_area;
+lddw;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+ldqw;
+ldiqw 8;
+addqw;
+stdw;
+pop;
+ldiqw temp_list;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 16;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw temp_list;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 4;
+addqw;
+lddw;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.bss
+.align 4
+qword_return:
+.res 4
+# ==== start of definition of function `x86_get_operand2' ====
+.text
+x86_get_operand2:
+addsp 12;        
+# param:`a', offset:-20
+.bss
+@x86_get_operand2_op1:
+.res 256
+.bss
+@x86_get_operand2_op2:
+.res 256
+.text
+.data
+.align 8
+@x86_get_operand2_op:
+.align 8
+.qword @x86_get_operand2_op1+0
+.align 8
+.qword @x86_get_operand2_op2+0
+.text
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L610;
+# var: p, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldiqw @S505;
+ldiqw @x86_get_operand2_op1;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldiqw @S506;
+ldiqw @x86_get_operand2_op2;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+jmp @L611;
+@L610:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L612;
+ldbp -20;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldiqw @S507;
+ldiqw @x86_get_operand2_op1;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw @S508;
+ldiqw @x86_get_operand2_op2;
+ldiqw sprintf;
+call 16;
+pop;
+pop;
+jmp @L613;
+@L612:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L614;
+# var: cat, offset: 4
+# var: e, offset: 8
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L615;
+@L616:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+notdw;
+jmpf @L619;
+ldidw 590;
+ldiqw @S509;
+ldiqw @S510;
+ldiqw @S511;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L619:
+@L617:
+ldidw 0;
+jmpf @L618;
+jmp @L616;
+@L618:
+ldiqw x86_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S512;
+ldiqw @x86_get_operand2_op1;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S513;
+ldiqw @x86_get_operand2_op2;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+ldiqw @x86_get_operand2_op;
+ret;
+@L615:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L620:
+ldbp 4;
+lddw;
+ldidw 110;
+eqdw;
+jmpt @L623;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L623;
+ldidw 0;
+jmp @L624;
+@L623:
+ldidw 1;
+@L624:
+notdw;
+jmpf @L625;
+ldidw 598;
+ldiqw @S514;
+ldiqw @S515;
+ldiqw @S516;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L625:
+@L621:
+ldidw 0;
+jmpf @L622;
+jmp @L620;
+@L622:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L626;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L627;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S517;
+ldiqw @x86_get_operand2_op1;
+ldiqw sprintf;
+call 32;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S518;
+ldiqw @x86_get_operand2_op2;
+ldiqw sprintf;
+call 32;
+pop;
+pop;
+jmp @L628;
+@L627:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S519;
+ldiqw @x86_get_operand2_op1;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S520;
+ldiqw @x86_get_operand2_op2;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+@L628:
+jmp @L629;
+@L626:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw @S521;
+ldiqw @x86_get_operand2_op1;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 4;
+adddw;
+ldiqw @S522;
+ldiqw @x86_get_operand2_op2;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+@L629:
+jmp @L630;
+@L614:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L631;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L632;
+@L633:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+notdw;
+jmpf @L636;
+ldidw 614;
+ldiqw @S523;
+ldiqw @S524;
+ldiqw @S525;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L636:
+@L634:
+ldidw 0;
+jmpf @L635;
+jmp @L633;
+@L635:
+ldiqw x86_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S526;
+ldiqw @x86_get_operand2_op1;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S527;
+ldiqw @x86_get_operand2_op2;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+jmp @L637;
+@L632:
+# var: offs, offset: 4
+ldbp -20;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw @S528;
+ldiqw @x86_get_operand2_op1;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+adddw;
+ldiqw @S529;
+ldiqw @x86_get_operand2_op2;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+@L637:
+@L631:
+@L630:
+@L613:
+@L611:
+ldiqw @x86_get_operand2_op;
+ret;
+ldidw 0;
+ret;
+# ==== start of definition of function `x86_switch' ====
+.text
+x86_switch:
+addsp 100;       
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: res, offset: 8
+# var: def_val, offset: 16
+# var: lab_arena, offset: 24
+# var: jmp_tab, offset: 32
+# var: def_lab, offset: 40
+# var: ncase, offset: 56
+# var: min, offset: 64
+# var: max, offset: 72
+# var: interval_size, offset: 80
+# var: holes, offset: 88
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L638;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L638;
+ldidw 0;
+jmp @L639;
+@L638:
+ldidw 1;
+@L639:
+jmpf @L640;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x86_do_switch64;
+call 16;
+pop;
+pop;
+ldiqw 0;
+ret;
+@L640:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L641;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+jmp @L642;
+@L641:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+stdw;
+pop;
+@L642:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldidw 1;
+dw2qw;
+subqw;
+ldbp 56;
+stqw;
+pop;
+pop;
+incldw -20;
+ldbp 56;
+ldqw;
+ldidw 3;
+dw2qw;
+sgetqw;
+jmpf @L643;
+# var: case_start, offset: 96
+ldbp -20;
+lddw;
+ldbp 96;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 72;
+stqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+incldw -20;
+@L644:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ordw;
+jmpf @L647;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L646;
+@L647:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 64;
+ldqw;
+sltqw;
+jmpf @L648;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 64;
+stqw;
+pop;
+pop;
+jmp @L649;
+@L648:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 72;
+ldqw;
+sgtqw;
+jmpf @L650;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 72;
+stqw;
+pop;
+pop;
+@L650:
+@L649:
+@L645:
+incldw -20;
+jmp @L644;
+@L646:
+ldbp 96;
+lddw;
+ldbp -20;
+stdw;
+pop;
+ldbp 72;
+ldqw;
+ldbp 64;
+ldqw;
+subqw;
+ldidw 1;
+dw2qw;
+addqw;
+ldbp 80;
+stqw;
+pop;
+pop;
+ldbp 80;
+ldqw;
+ldbp 56;
+ldqw;
+subqw;
+ldbp 88;
+stqw;
+pop;
+pop;
+ldbp 88;
+ldqw;
+ldidw 10;
+dw2qw;
+sletqw;
+jmpf @L651;
+jmp @@x86_switch_jump_table;
+@L651:
+@L643:
+jmp @@x86_switch_linear_search;
+@@x86_switch_jump_table:
+ldbp 64;
+ldqw;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S530;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S531;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+pop;
+ldiqw @S532;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S533;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 72;
+ldqw;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S534;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S535;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 16;
+ldqw;
+pop;
+ldiqw @S536;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S537;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 64;
+ldqw;
+ldidw 0;
+dw2qw;
+neqqw;
+jmpf @L652;
+ldbp 64;
+ldqw;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S538;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S539;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L652:
+ldiqw jump_tables_counter;
+lddw;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S540;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S541;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw 8;
+ldbp 80;
+ldqw;
+ldiqw calloc;
+call 16;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldidw 0;
+ldbp 80;
+ldqw;
+ldidw 16;
+dw2qw;
+mulqw;
+pop;
+ldiqw arena_new;
+call 8;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 16;
+ldqw;
+ldiqw @S542;
+ldbp 40;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+@L653:
+# var: s, offset: 96
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ordw;
+jmpf @L656;
+jmp @L655;
+@L656:
+ldidw 16;
+ldbp 24;
+ldqw;
+ldiqw arena_alloc;
+call 12;
+ldbp 96;
+stqw;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S543;
+ldbp 96;
+ldqw;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+ldbp 96;
+ldqw;
+ldbp 32;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 64;
+ldqw;
+subqw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+@L654:
+incldw -20;
+jmp @L653;
+@L655:
+ldidw 0;
+ldbp -20;
+stdw;
+pop;
+@L657:
+ldbp 88;
+ldqw;
+ordw;
+jmpf @L659;
+ldbp 32;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldidw 0;
+dw2qw;
+eqqw;
+jmpf @L660;
+ldbp 40;
+ldbp 32;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 8;
+mulqw;
+addqw;
+stqw;
+pop;
+pop;
+ldbp 88;
+dup2;
+dup2;
+ldqw;
+ldiqw 1;
+subqw;
+swap2;
+stqw;
+pop;
+pop;
+ldqw;
+pop;
+pop;
+@L660:
+@L658:
+incldw -20;
+jmp @L657;
+@L659:
+@L661:
+ldiqw curr_segment;
+lddw;
+ldidw 3;
+neqdw;
+jmpf @L664;
+ldiqw str_segment;
+ldidw 3;
+dw2qw;
+ldxqw 8;
+ldiqw @S544;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S545;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 3;
+ldiqw curr_segment;
+stdw;
+pop;
+@L664:
+@L662:
+ldidw 0;
+jmpf @L663;
+jmp @L661;
+@L663:
+ldiqw jump_tables_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+ldiqw @S546;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S547;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldbp -20;
+stdw;
+pop;
+@L665:
+ldbp -20;
+lddw;
+dw2qw;
+ldbp 80;
+ldqw;
+sltqw;
+jmpf @L667;
+ldbp 32;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S548;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S549;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L666:
+incldw -20;
+jmp @L665;
+@L667:
+@L668:
+ldiqw curr_segment;
+lddw;
+ldidw 1;
+neqdw;
+jmpf @L671;
+ldiqw str_segment;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw @S550;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S551;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 1;
+ldiqw curr_segment;
+stdw;
+pop;
+@L671:
+@L669:
+ldidw 0;
+jmpf @L670;
+jmp @L668;
+@L670:
+ldbp 32;
+ldqw;
+ldiqw free;
+call 8;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldiqw arena_destroy;
+call 8;
+pop;
+pop;
+ldiqw 0;
+ret;
+@@x86_switch_linear_search:
+@L672:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp -24;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp -28;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp -32;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ordw;
+jmpf @L675;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S552;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S553;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L674;
+@L675:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S554;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S555;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S556;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S557;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L673:
+incldw -20;
+jmp @L672;
+@L674:
+ldidw 0;
+ret;
+.extern get_member_descriptor
+# ==== start of definition of function `x86_sub' ====
+.text
+x86_sub:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L676;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L676;
+ldidw 0;
+jmp @L677;
+@L676:
+ldidw 1;
+@L677:
+jmpf @L678;
+# var: op, offset: 8
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 16;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw x86_load2;
+call 8;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S558;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S559;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S560;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S561;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L679:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L680:
+ldidw 0;
+jmpf @L681;
+jmp @L679;
+@L681:
+jmp @L682;
+@L678:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S562;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S563;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L683:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L684:
+ldidw 0;
+jmpf @L685;
+jmp @L683;
+@L685:
+@L682:
+ldidw 0;
+ret;
+.extern decl_init
+.extern ic_free_function
+.data
+.align 8
+x86_lwreg_str:
+.align 8
+.qword @S564+0
+.align 8
+.qword @S565+0
+.align 8
+.qword @S566+0
+.align 8
+.qword @S567+0
+.align 8
+.qword @S568+0
+.align 8
+.qword @S569+0
+.extern dup_declarator
+# ==== start of definition of function `x86_load2' ====
+.text
+x86_load2:
+addsp 12;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L686;
+# var: p, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S570;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S571;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S572;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S573;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L687;
+@L686:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L688;
+ldbp -24;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S574;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S575;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S576;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S577;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L689;
+@L688:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L690;
+# var: cat, offset: 4
+# var: e, offset: 8
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L691;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+neqdw;
+jmpf @L692;
+@L693:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+neqdw;
+notdw;
+jmpf @L696;
+ldidw 461;
+ldiqw @S578;
+ldiqw @S579;
+ldiqw @S580;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L696:
+@L694:
+ldidw 0;
+jmpf @L695;
+jmp @L693;
+@L695:
+ldiqw x86_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S581;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S582;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S583;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S584;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L697;
+@L692:
+@L698:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+eqdw;
+notdw;
+jmpf @L701;
+ldidw 465;
+ldiqw @S585;
+ldiqw @S586;
+ldiqw @S587;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L701:
+@L699:
+ldidw 0;
+jmpf @L700;
+jmp @L698;
+@L700:
+@L697:
+ldiqw 0;
+ret;
+@L691:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+pop;
+@L702:
+ldbp 4;
+lddw;
+ldidw 110;
+eqdw;
+jmpt @L705;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L705;
+ldidw 0;
+jmp @L706;
+@L705:
+ldidw 1;
+@L706:
+notdw;
+jmpf @L707;
+ldidw 472;
+ldiqw @S588;
+ldiqw @S589;
+ldiqw @S590;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L707:
+@L703:
+ldidw 0;
+jmpf @L704;
+jmp @L702;
+@L704:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L708;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L709;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S591;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 40;
+pop;
+pop;
+ldiqw @S592;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S593;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 40;
+pop;
+pop;
+ldiqw @S594;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L710;
+@L709:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S595;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S596;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S597;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S598;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L710:
+jmp @L711;
+@L708:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S599;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S600;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldidw 4;
+adddw;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S601;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S602;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L711:
+jmp @L712;
+@L690:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L713;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L714;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+neqdw;
+jmpf @L715;
+ldiqw x86_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S603;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S604;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L715:
+@L716:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+notdw;
+jmpf @L719;
+ldidw 490;
+ldiqw @S605;
+ldiqw @S606;
+ldiqw @S607;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L719:
+@L717:
+ldidw 0;
+jmpf @L718;
+jmp @L716;
+@L718:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+neqdw;
+jmpf @L720;
+ldiqw x86_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S608;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S609;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L720:
+jmp @L721;
+@L714:
+# var: offs, offset: 4
+ldbp -24;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S610;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S611;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 4;
+lddw;
+ldidw 4;
+adddw;
+ldiqw x86_reg_str;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S612;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S613;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L721:
+@L713:
+@L712:
+@L689:
+@L687:
+ldidw 0;
+ret;
+.extern cg_nodes
+.extern strncat
+.extern dflow_free_Dom
+.extern fileno
+# ==== start of definition of function `x86_div_rem' ====
+.text
+x86_div_rem:
+addsp 24;        
+# param:`res', offset:-20
+# param:`i', offset:-24
+# param:`tar', offset:-28
+# param:`arg1', offset:-32
+# param:`arg2', offset:-36
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L722;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L722;
+ldidw 0;
+jmp @L723;
+@L722:
+ldidw 1;
+@L723:
+jmpf @L724;
+# var: f, offset: 8
+ldbp 4;
+lddw;
+ldiqw is_signed_int;
+call 4;
+pop;
+jmpf @L725;
+ldbp -20;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L726;
+ldidw 1;
+jmp @L727;
+@L726:
+ldidw 3;
+@L727:
+ldbp 8;
+stdw;
+pop;
+jmp @L728;
+@L725:
+ldbp -20;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L729;
+ldidw 2;
+jmp @L730;
+@L729:
+ldidw 4;
+@L730:
+ldbp 8;
+stdw;
+pop;
+@L728:
+ldbp 8;
+lddw;
+ldbp -36;
+lddw;
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldiqw x86_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L731;
+@L724:
+# var: instr, offset: 8
+# var: divop, offset: 16
+ldbp -24;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldidw 0;
+neqdw;
+jmpf @L732;
+ldidw 0;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+@L732:
+ldbp -32;
+lddw;
+ldidw 0;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 3;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldidw 3;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 4;
+lddw;
+ldiqw is_unsigned_int;
+call 4;
+pop;
+jmpf @L733;
+ldiqw @S614;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S615;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S616;
+ldbp 8;
+stqw;
+pop;
+pop;
+jmp @L734;
+@L733:
+ldiqw @S617;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S618;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S619;
+ldbp 8;
+stqw;
+pop;
+pop;
+@L734:
+ldiqw ic_addresses;
+ldqw;
+ldbp -36;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+neqdw;
+jmpf @L735;
+ldbp -36;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L736;
+@L735:
+# var: r, offset: 24
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp -36;
+lddw;
+ldbp 24;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+stqw;
+pop;
+pop;
+@L736:
+ldbp 16;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw @S620;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S621;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldidw 0;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldidw 3;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L737:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -36;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -24;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldbp -20;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L738:
+ldidw 0;
+jmpf @L739;
+jmp @L737;
+@L739:
+@L731:
+ldidw 0;
+ret;
+.extern bset_update
+# ==== start of definition of function `spill_all' ====
+.text
+spill_all:
+addsp 4;         
+# var: i, offset: 4
+ldidw 0;
+ldbp 4;
+stdw;
+pop;
+@L740:
+ldbp 4;
+lddw;
+ldidw 6;
+sltdw;
+jmpf @L742;
+ldbp 4;
+lddw;
+ldiqw spill_reg;
+call 4;
+pop;
+pop;
+@L741:
+incldw 4;
+jmp @L740;
+@L742:
+ldidw 0;
+ret;
+.extern dflow_LiveOut
+.extern string_printf
+.extern lookup_external_id
+.bss
+.align 8
+addr_descr_tab:
+.res 8
+.extern hash2
+.extern analyze_type_name
+# ==== start of definition of function `update_tar_descriptors2' ====
+.text
+update_tar_descriptors2:
+addsp 0;         
+# param:`res', offset:-20
+# param:`tar', offset:-24
+# param:`liveness', offset:-28
+# param:`next_use', offset:-32
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldbp -24;
+lddw;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -24;
+lddw;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+notdw;
+jmpf @L743;
+ldbp -28;
+ldub;
+jmpf @L744;
+ldbp -24;
+lddw;
+ldbp -20;
+ldn 4;
+ldiqw x86_store2;
+call 8;
+pop;
+pop;
+@L744:
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp -20;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L743:
+ldidw 0;
+ret;
+.bss
+.align 8
+x86_output_str:
+.res 8
+# ==== start of definition of function `x86_ind_asn' ====
+.text
+x86_ind_asn:
+addsp 40;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+# var: pr, offset: 8
+# var: siz_str, offset: 16
+ldiqw spill_aliased_objects;
+call 0;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L745;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L745;
+ldidw 0;
+jmp @L746;
+@L745:
+ldidw 1;
+@L746:
+jmpf @L747;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L748;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L749;
+@L748:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+stdw;
+pop;
+@L749:
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L750;
+# var: p, offset: 24
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxdw 4;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S622;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S623;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 24;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxdw 4;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S624;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S625;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L751;
+@L750:
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L752;
+ldbp -32;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S626;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S627;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S628;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S629;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L753;
+@L752:
+# var: r, offset: 24
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L754;
+ldiqw get_reg0;
+call 0;
+pop;
+dw2w;
+ldbp 24;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 24;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw get_reg0;
+call 0;
+pop;
+dw2w;
+ldbp 24;
+ldiqw 2;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 24;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldbp 24;
+ldn 4;
+ldiqw x86_load2;
+call 8;
+pop;
+pop;
+jmp @L755;
+@L754:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 24;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 2;
+addqw;
+ldw;
+ldbp 24;
+ldiqw 2;
+addqw;
+stw;
+pop;
+@L756:
+ldbp 24;
+ldiqw 2;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+notdw;
+jmpf @L759;
+ldidw 1955;
+ldiqw @S630;
+ldiqw @S631;
+ldiqw @S632;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L759:
+@L757:
+ldidw 0;
+jmpf @L758;
+jmp @L756;
+@L758:
+@L755:
+ldiqw x86_reg_str;
+ldbp 24;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S633;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S634;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 24;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S635;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S636;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L753:
+@L751:
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @@x86_ind_asn_done;
+jmp @L760;
+@L747:
+ldbp 4;
+lddw;
+ldidw 68;
+eqdw;
+jmpt @L761;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L761;
+ldidw 0;
+jmp @L762;
+@L761:
+ldidw 1;
+@L762:
+jmpf @L763;
+# var: cluttered, offset: 24
+ldidw 0;
+ldbp 24;
+stdw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 4;
+neqdw;
+jmpf @L764;
+ldiqw reg_descr_tab;
+ldidw 4;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L765;
+ldbp 24;
+lddw;
+ldidw 1;
+ordw;
+ldbp 24;
+stdw;
+pop;
+ldiqw @S637;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S638;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L766;
+@L765:
+ldidw 1;
+ldiqw modified;
+ldidw 4;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L766:
+ldbp -32;
+lddw;
+ldidw 4;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+@L764:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 5;
+neqdw;
+jmpf @L767;
+ldiqw reg_descr_tab;
+ldidw 5;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L768;
+ldbp 24;
+lddw;
+ldidw 2;
+ordw;
+ldbp 24;
+stdw;
+pop;
+ldiqw @S639;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S640;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L769;
+@L768:
+ldidw 1;
+ldiqw modified;
+ldidw 5;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L769:
+ldbp -28;
+lddw;
+ldidw 5;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+@L767:
+ldiqw reg_descr_tab;
+ldidw 2;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L770;
+ldbp 24;
+lddw;
+ldidw 4;
+ordw;
+ldbp 24;
+stdw;
+pop;
+ldiqw @S641;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S642;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L770:
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S643;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S644;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S645;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S646;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 24;
+lddw;
+ldidw 4;
+anddw;
+jmpf @L771;
+ldiqw @S647;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S648;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L771:
+ldbp 24;
+lddw;
+ldidw 2;
+anddw;
+jmpf @L772;
+ldiqw @S649;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S650;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L772:
+ldbp 24;
+lddw;
+ldidw 1;
+anddw;
+jmpf @L773;
+ldiqw @S651;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S652;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L773:
+jmp @@x86_ind_asn_done;
+@L763:
+@L760:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L774;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+jmp @L775;
+@L774:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 8;
+stdw;
+pop;
+@L775:
+ldbp 4;
+lddw;
+ldiqw @T776;
+switch;
+@L778:
+@L779:
+ldiqw @S653;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L777;
+@L780:
+@L781:
+@L782:
+ldiqw @S654;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L777;
+@L783:
+ldiqw @S655;
+ldbp 16;
+stqw;
+pop;
+pop;
+jmp @L777;
+@L777:
+.data
+.align 8
+@T776:
+.dword 6
+.dword 49
+.dword 64
+.dword 106
+.dword 107
+.dword 108
+.qword @L783
+.qword @L780
+.qword @L778
+.qword @L781
+.qword @L782
+.qword @L779
+.text
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L784;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldqw;
+ldiqw @S656;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S657;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L785;
+@L784:
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L786;
+ldbp -32;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldqw;
+ldiqw @S658;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S659;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L787;
+@L786:
+# var: r, offset: 24
+# var: reg_str, offset: 32
+# var: clutter_eax, offset: 40
+ldidw 0;
+ldbp 40;
+stdw;
+pop;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpf @L788;
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 24;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldbp 24;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+jmp @L789;
+@L788:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 24;
+stdw;
+pop;
+@L789:
+ldbp 4;
+lddw;
+ldiqw @T790;
+switch;
+@L792:
+@L793:
+ldiqw x86_lwreg_str;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L791;
+@L794:
+@L795:
+@L796:
+ldbp 24;
+lddw;
+ldidw 4;
+eqdw;
+jmpt @L797;
+ldbp 24;
+lddw;
+ldidw 5;
+eqdw;
+jmpt @L797;
+ldidw 0;
+jmp @L798;
+@L797:
+ldidw 1;
+@L798:
+jmpf @L799;
+ldiqw @S660;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S661;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S662;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S663;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S664;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp 40;
+stdw;
+pop;
+jmp @L800;
+@L799:
+ldiqw x86_lbreg_str;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L800:
+jmp @L791;
+@L801:
+ldiqw x86_reg_str;
+ldbp 24;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L791;
+@L791:
+.data
+.align 8
+@T790:
+.dword 6
+.dword 49
+.dword 64
+.dword 106
+.dword 107
+.dword 108
+.qword @L801
+.qword @L794
+.qword @L792
+.qword @L795
+.qword @L796
+.qword @L793
+.text
+ldbp 32;
+ldqw;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 16;
+ldqw;
+ldiqw @S665;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 40;
+pop;
+pop;
+ldiqw @S666;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 40;
+lddw;
+jmpf @L802;
+ldiqw @S667;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S668;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L802:
+@L787:
+@L785:
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@@x86_ind_asn_done:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldidw 0;
+ret;
+# ==== start of definition of function `x86_get' ====
+.text
+x86_get:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L803;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L804;
+ldidw 16;
+jmp @L805;
+@L804:
+ldidw 12;
+@L805:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x86_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L806;
+@L803:
+# var: res, offset: 16
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L809;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L811;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L811;
+ldidw 0;
+jmp @L812;
+@L811:
+ldidw 1;
+@L812:
+jmpt @L809;
+ldidw 0;
+jmp @L810;
+@L809:
+ldidw 1;
+@L810:
+jmpt @L807;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L807;
+ldidw 0;
+jmp @L808;
+@L807:
+ldidw 1;
+@L808:
+jmpf @L813;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+jmp @L814;
+@L813:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+stdw;
+pop;
+@L814:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S669;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S670;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L815;
+ldiqw x86_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L816;
+ldiqw @S671;
+jmp @L817;
+@L816:
+ldiqw @S672;
+@L817:
+ldiqw @S673;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S674;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S675;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S676;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L818:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L819:
+ldidw 0;
+jmpf @L820;
+jmp @L818;
+@L820:
+jmp @L821;
+@L815:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L821:
+@L806:
+ldidw 0;
+ret;
+.extern is_unsigned_int
+.extern memmove
+.extern replace_extension
+.extern analyze_struct_declarator
+.extern get_type_spec
+# ==== start of definition of function `x86_get_operand' ====
+.text
+x86_get_operand:
+addsp 16;        
+# param:`a', offset:-20
+.bss
+@x86_get_operand_op:
+.res 256
+.text
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpf @L822;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S677;
+ldiqw @x86_get_operand_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+jmp @L823;
+@L822:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpf @L824;
+ldbp -20;
+lddw;
+ldiqw new_string_literal;
+call 4;
+pop;
+ldiqw @S678;
+ldiqw @x86_get_operand_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+jmp @L825;
+@L824:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L826;
+# var: e, offset: 8
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L827;
+ldiqw x86_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ret;
+@L827:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T828;
+switch;
+@L830:
+@L831:
+@L832:
+@L833:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L834;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L835;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S679;
+ldiqw @x86_get_operand_op;
+ldiqw sprintf;
+call 32;
+pop;
+pop;
+jmp @L836;
+@L835:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S680;
+ldiqw @x86_get_operand_op;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+@L836:
+ldiqw @x86_get_operand_op;
+ret;
+jmp @L837;
+@L834:
+# var: r, offset: 16
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S681;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S682;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ret;
+@L837:
+@L838:
+@L839:
+@L840:
+@L841:
+@L842:
+# var: r, offset: 16
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ret;
+@L843:
+jmp @L829;
+@L829:
+.data
+.align 8
+@T828:
+.dword 10
+.dword 49
+.dword 64
+.dword 68
+.dword 71
+.dword 97
+.dword 98
+.dword 106
+.dword 107
+.dword 108
+.qword @L843
+.qword @L840
+.qword @L838
+.qword @L830
+.qword @L831
+.qword @L832
+.qword @L833
+.qword @L841
+.qword @L842
+.qword @L839
+.text
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L844;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L845;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldiqw @S683;
+ldiqw @x86_get_operand_op;
+ldiqw sprintf;
+call 32;
+pop;
+pop;
+jmp @L846;
+@L845:
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw @S684;
+ldiqw @x86_get_operand_op;
+ldiqw sprintf;
+call 24;
+pop;
+pop;
+@L846:
+jmp @L847;
+@L844:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldiqw @S685;
+ldiqw @x86_get_operand_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+@L847:
+jmp @L848;
+@L826:
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L849;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L850;
+ldiqw x86_reg_str;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ret;
+jmp @L851;
+@L850:
+ldbp -20;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldiqw @S686;
+ldiqw @x86_get_operand_op;
+ldiqw sprintf;
+call 20;
+pop;
+pop;
+@L851:
+@L849:
+@L848:
+@L825:
+@L823:
+ldiqw @x86_get_operand_op;
+ret;
+ldidw 0;
+ret;
+.extern cfg_nodes_counter
+.bss
+.align 8
+enclosing_function:
+.res 8
+.extern analyze_function_definition
+.extern strdup
+.extern bset_new
+# ==== start of definition of function `x86_post_call' ====
+.text
+x86_post_call:
+addsp 8;         
+# param:`arg2', offset:-20
+# var: na, offset: 4
+# var: nb, offset: 8
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldidw 0;
+ldbp 8;
+stdw;
+pop;
+@L852:
+ldbp 4;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+subqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+jmpf @L853;
+ldbp 8;
+lddw;
+ldiqw arg_stack;
+ldiqw arg_stack_top;
+dup2;
+dup2;
+lddw;
+ldidw 1;
+subdw;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+lddw;
+dw2qw;
+ldxdw 4;
+adddw;
+ldbp 8;
+stdw;
+pop;
+jmp @L852;
+@L853:
+@L854:
+ldiqw arg_stack_top;
+lddw;
+ldidw 0;
+sgetdw;
+notdw;
+jmpf @L857;
+ldidw 1874;
+ldiqw @S687;
+ldiqw @S688;
+ldiqw @S689;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L857:
+@L855:
+ldidw 0;
+jmpf @L856;
+jmp @L854;
+@L856:
+ldbp 8;
+lddw;
+jmpf @L858;
+ldbp 8;
+lddw;
+ldiqw @S690;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S691;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L858:
+ldidw 0;
+ret;
+.extern arena_new
+# ==== start of definition of function `x86_cbr' ====
+.text
+x86_cbr:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L859;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L859;
+ldidw 0;
+jmp @L860;
+@L859:
+ldidw 1;
+@L860:
+jmpf @L861;
+# var: r, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw x86_load2;
+call 8;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S692;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S693;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S694;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S695;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L862;
+@L861:
+ldidw 0;
+ldbp -28;
+lddw;
+ldiqw x86_compare_against_constant;
+call 8;
+pop;
+pop;
+@L862:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L863;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S696;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S697;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L864;
+@L863:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S698;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S699;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L864:
+ldidw 0;
+ret;
+.extern analyze_init_declarator
+# ==== start of definition of function `do_relop_jump' ====
+.text
+do_relop_jump:
+addsp 24;        
+# param:`i', offset:-20
+# param:`flags', offset:-28
+# param:`tar', offset:-32
+# param:`arg1', offset:-36
+# param:`arg2', offset:-40
+# var: nid, offset: 4
+# var: j, offset: 8
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -36;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -40;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -32;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldidw 1;
+adddw;
+ldbp 8;
+stdw;
+pop;
+@L865:
+# var: lab, offset: 12
+# var: tar_2, offset: 16
+# var: tar_3, offset: 20
+# var: arg2_2, offset: 24
+@L868:
+ldbp 8;
+lddw;
+ldiqw func_last_quad;
+lddw;
+sletdw;
+notdw;
+jmpf @L871;
+ldidw 1377;
+ldiqw @S700;
+ldiqw @S701;
+ldiqw @S702;
+ldiqw stderr;
+ldqw;
+ldiqw fprintf;
+call 28;
+pop;
+pop;
+ldidw 1;
+ldiqw exit;
+call 4;
+pop;
+pop;
+@L871:
+@L869:
+ldidw 0;
+jmpf @L870;
+jmp @L868;
+@L870:
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 37;
+neqdw;
+jmpt @L872;
+ldiqw ic_addresses;
+ldqw;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+ldbp 4;
+lddw;
+neqdw;
+jmpt @L872;
+ldidw 0;
+jmp @L873;
+@L872:
+ldidw 1;
+@L873:
+jmpf @L874;
+jmp @L866;
+@L874:
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 16;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+ldidw 1;
+adddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 20;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 24;
+addqw;
+lddw;
+ldbp 24;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+eqqw;
+jmpf @L875;
+ldiqw ic_addresses;
+ldqw;
+ldbp 24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T876;
+jmptab;
+@L878:
+ldbp 12;
+lddw;
+ldiqw @S703;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S704;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L877;
+@L879:
+ldbp 12;
+lddw;
+ldiqw @S705;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S706;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L877;
+@L880:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L881;
+ldbp 12;
+lddw;
+ldiqw @S707;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S708;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L882;
+@L881:
+ldbp 12;
+lddw;
+ldiqw @S709;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S710;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L882:
+jmp @L877;
+@L883:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L884;
+ldbp 12;
+lddw;
+ldiqw @S711;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S712;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L885;
+@L884:
+ldbp 12;
+lddw;
+ldiqw @S713;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S714;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L885:
+jmp @L877;
+@L886:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L887;
+ldbp 12;
+lddw;
+ldiqw @S715;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S716;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L888;
+@L887:
+ldbp 12;
+lddw;
+ldiqw @S717;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S718;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L888:
+jmp @L877;
+@L889:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L890;
+ldbp 12;
+lddw;
+ldiqw @S719;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S720;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L891;
+@L890:
+ldbp 12;
+lddw;
+ldiqw @S721;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S722;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L891:
+jmp @L877;
+@L877:
+.data
+.align 8
+@T876:
+.dword 10
+.dword 6
+.qword @L877
+.qword @L878
+.qword @L879
+.qword @L880
+.qword @L883
+.qword @L886
+.qword @L889
+.text
+jmp @L892;
+@L875:
+ldiqw ic_addresses;
+ldqw;
+ldbp 16;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldbp 12;
+stdw;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldiqw @T893;
+jmptab;
+@L895:
+ldbp 12;
+lddw;
+ldiqw @S723;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S724;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L894;
+@L896:
+ldbp 12;
+lddw;
+ldiqw @S725;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S726;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L894;
+@L897:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L898;
+ldbp 12;
+lddw;
+ldiqw @S727;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S728;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L899;
+@L898:
+ldbp 12;
+lddw;
+ldiqw @S729;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S730;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L899:
+jmp @L894;
+@L900:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L901;
+ldbp 12;
+lddw;
+ldiqw @S731;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S732;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L902;
+@L901:
+ldbp 12;
+lddw;
+ldiqw @S733;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S734;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L902:
+jmp @L894;
+@L903:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L904;
+ldbp 12;
+lddw;
+ldiqw @S735;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S736;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L905;
+@L904:
+ldbp 12;
+lddw;
+ldiqw @S737;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S738;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L905:
+jmp @L894;
+@L906:
+ldbp -28;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L907;
+ldbp 12;
+lddw;
+ldiqw @S739;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S740;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L908;
+@L907:
+ldbp 12;
+lddw;
+ldiqw @S741;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S742;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L908:
+jmp @L894;
+@L894:
+.data
+.align 8
+@T893:
+.dword 10
+.dword 6
+.qword @L894
+.qword @L895
+.qword @L896
+.qword @L897
+.qword @L900
+.qword @L903
+.qword @L906
+.text
+@L892:
+ldidw 39;
+ldiqw ic_instructions;
+ldqw;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stdw;
+pop;
+jmp @L867;
+@L866:
+incldw 8;
+jmp @L865;
+@L867:
+ldidw 0;
+ret;
+.extern cfg_function_to_print
+.extern strncmp
+.extern arena_set_nom_siz
+.extern bset_union_diff
+# ==== start of definition of function `x86_cmpl' ====
+.text
+x86_cmpl:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L909;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L909;
+ldidw 0;
+jmp @L910;
+@L909:
+ldidw 1;
+@L910:
+jmpf @L911;
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 8;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw x86_load2;
+call 8;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S743;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S744;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S745;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S746;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L912:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L913:
+ldidw 0;
+jmpf @L914;
+jmp @L912;
+@L914:
+jmp @L915;
+@L911:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S747;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S748;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L916:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L917:
+ldidw 0;
+jmpf @L918;
+jmp @L916;
+@L918:
+@L915:
+ldidw 0;
+ret;
+.bss
+.align 4
+string_literals_counter:
+.res 4
+.extern analyze_multiplicative_expression
+# ==== start of definition of function `x86_indcall' ====
+.text
+x86_indcall:
+addsp 8;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldbp -20;
+lddw;
+ldiqw x86_pre_call;
+call 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldiqw @S749;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S750;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_post_call;
+call 4;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldbp -24;
+lddw;
+jmpf @L919;
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L920;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L920;
+ldidw 0;
+jmp @L921;
+@L920:
+ldidw 1;
+@L921:
+jmpf @L922;
+# var: r, offset: 8
+ldidw 0;
+dw2w;
+ldbp 8;
+stw;
+pop;
+ldidw 3;
+dw2w;
+ldbp 10;
+stw;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+jmp @L923;
+@L922:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldidw 0;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L923:
+@L919:
+ldidw 0;
+ret;
+.extern analyze_additive_expression
+.extern stat_number_of_c_tokens
+.extern strncpy
+.extern bset_clear
+.bss
+.align 8
+x86_output_file:
+.res 8
+# ==== start of definition of function `x86_xor' ====
+.text
+x86_xor:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: cat, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 110;
+eqdw;
+jmpt @L924;
+ldbp 4;
+lddw;
+ldidw 111;
+eqdw;
+jmpt @L924;
+ldidw 0;
+jmp @L925;
+@L924:
+ldidw 1;
+@L925:
+jmpf @L926;
+# var: op, offset: 8
+# var: res, offset: 16
+ldbp -20;
+lddw;
+ldiqw get_reg2;
+call 4;
+ldbp 16;
+swap2;
+memcpy 4;
+pop;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw x86_load2;
+call 8;
+pop;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand2;
+call 4;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 0;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S751;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S752;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+ldiqw 2;
+addqw;
+ldw;
+dw2qw;
+ldxqw 8;
+ldiqw @S753;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S754;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L927:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+ldn 4;
+ldiqw update_tar_descriptors2;
+call 16;
+pop;
+pop;
+@L928:
+ldidw 0;
+jmpf @L929;
+jmp @L927;
+@L929:
+jmp @L930;
+@L926:
+# var: res, offset: 8
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 8;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+ldidw 1;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldiqw x86_reg_str;
+ldbp 8;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S755;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S756;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 8;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L931:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 8;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L932:
+ldidw 0;
+jmpf @L933;
+jmp @L931;
+@L933:
+@L930:
+ldidw 0;
+ret;
+.extern decl_save_pch
+.extern bset_card
+.extern analyze_assignment_expression
+.extern ic_instructions
+.extern new_extern_id_node
+.extern decl_load_pch
+.extern bset_union
+.extern analyze_translation_unit
+# ==== start of definition of function `x86_pre_call' ====
+.text
+x86_pre_call:
+addsp 8;         
+# param:`i', offset:-20
+# var: cat, offset: 4
+ldiqw spill_all;
+call 0;
+pop;
+pop;
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldbp 4;
+stdw;
+ldidw 68;
+eqdw;
+jmpt @L934;
+ldbp 4;
+lddw;
+ldidw 71;
+eqdw;
+jmpt @L934;
+ldidw 0;
+jmp @L935;
+@L934:
+ldidw 1;
+@L935:
+jmpf @L936;
+# var: siz, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldbp 8;
+stdw;
+pop;
+ldbp 8;
+lddw;
+ldiqw temp_struct_size;
+lddw;
+ugtdw;
+jmpf @L937;
+ldbp 8;
+lddw;
+ldiqw temp_struct_size;
+stdw;
+pop;
+@L937:
+ldiqw @S757;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw func_body;
+ldqw;
+ldiqw string_get_pos;
+call 8;
+pop;
+ldiqw calls_to_fix;
+ldiqw calls_to_fix_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldiqw @S758;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S759;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S760;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S761;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L936:
+ldidw 0;
+ret;
+.extern strnlen
+.extern bset_new_in
+.extern analyze_enumerator
+.extern targeting_arch64
+.extern set_attributes
+.extern is_typedef_name
+.extern dflow_exit_function
+.extern arena_reset
+.extern fread
+.extern strrchr
+.data
+.align 4
+curr_segment:
+.align 4
+.dword -1
+.extern bset_next
+# ==== start of definition of function `update_tar_descriptors' ====
+.text
+update_tar_descriptors:
+addsp 0;         
+# param:`res', offset:-20
+# param:`tar', offset:-24
+# param:`liveness', offset:-28
+# param:`next_use', offset:-32
+ldbp -20;
+lddw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldbp -24;
+lddw;
+ldiqw reg_descr_tab;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+notdw;
+jmpf @L938;
+ldbp -28;
+ldub;
+jmpf @L939;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x86_store;
+call 8;
+pop;
+pop;
+@L939:
+ldidw 1;
+negdw;
+dw2w;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+stw;
+pop;
+ldidw 0;
+ldiqw reg_descr_tab;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L938:
+ldidw 0;
+ret;
+.extern disable_warnings
+.extern string_append
+.bss
+.align 8
+curr_func:
+.res 8
+.extern bset_diff
+.extern install_macro
+# ==== start of definition of function `get_reg' ====
+.text
+get_reg:
+addsp 4;         
+# param:`i', offset:-20
+# var: arg1, offset: 4
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 20;
+addqw;
+lddw;
+ldbp 4;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L944;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L944;
+ldidw 0;
+jmp @L945;
+@L944:
+ldidw 1;
+@L945:
+notdw;
+jmpf @L942;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+neqdw;
+jmpf @L942;
+ldidw 1;
+jmp @L943;
+@L942:
+ldidw 0;
+@L943:
+jmpf @L940;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+notdw;
+jmpf @L940;
+ldidw 1;
+jmp @L941;
+@L940:
+ldidw 0;
+@L941:
+jmpf @L946;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp 4;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+dw2qw;
+ret;
+@L946:
+ldiqw get_reg0;
+call 0;
+pop;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern bset_inters
+# ==== start of definition of function `x86_lab' ====
+.text
+x86_lab:
+addsp 0;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+pop;
+ldiqw @S762;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S763;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern edge_add
+.extern string_buf
+# ==== start of definition of function `x86_addr_of' ====
+.text
+x86_addr_of:
+addsp 4;         
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: res, offset: 4
+ldiqw get_reg0;
+call 0;
+pop;
+ldbp 4;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 4;
+lddw;
+ldiqw x86_load_addr;
+call 8;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 4;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+ldidw 0;
+ret;
+.extern ferror
+.extern random
+# ==== start of definition of function `new_string_literal' ====
+.text
+new_string_literal:
+addsp 0;         
+# param:`a', offset:-20
+ldiqw string_literals_counter;
+lddw;
+ldiqw @S764;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S765;
+ldiqw str_lits;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -20;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldiqw str_lits;
+ldqw;
+ldiqw emit_raw_string;
+call 16;
+pop;
+pop;
+ldiqw string_literals_counter;
+dup2;
+lddw;
+dw2qw;
+swap2;
+dup2;
+lddw;
+udw2qw;
+ldiqw 1;
+addqw;
+pop;
+dup;
+swap2;
+stdw;
+pop;
+pop;
+pop;
+dw2qw;
+ret;
+ldidw 0;
+ret;
+.extern ic_instructions_counter
+.extern free
+.extern malloc
+.extern get_external_declarations
+# ==== start of definition of function `x86_let' ====
+.text
+x86_let:
+addsp 16;        
+# param:`i', offset:-20
+# param:`tar', offset:-24
+# param:`arg1', offset:-28
+# param:`arg2', offset:-32
+# var: flags, offset: 8
+ldiqw ic_instructions;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldidw 2;
+dw2qw;
+andqw;
+ordw;
+jmpf @L947;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L948;
+ldidw 17;
+jmp @L949;
+@L948:
+ldidw 13;
+@L949:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp -20;
+lddw;
+ldiqw x86_do_libcall;
+call 20;
+pop;
+pop;
+jmp @L950;
+@L947:
+# var: res, offset: 16
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpt @L953;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 0;
+eqdw;
+jmpt @L955;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 1;
+eqdw;
+jmpt @L955;
+ldidw 0;
+jmp @L956;
+@L955:
+ldidw 1;
+@L956:
+jmpt @L953;
+ldidw 0;
+jmp @L954;
+@L953:
+ldidw 1;
+@L954:
+jmpt @L951;
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 1;
+negdw;
+eqdw;
+jmpt @L951;
+ldidw 0;
+jmp @L952;
+@L951:
+ldidw 1;
+@L952:
+jmpf @L957;
+ldbp -20;
+lddw;
+ldiqw get_reg;
+call 4;
+pop;
+ldbp 16;
+stdw;
+pop;
+ldbp -28;
+lddw;
+ldbp 16;
+lddw;
+ldiqw x86_load;
+call 8;
+pop;
+pop;
+jmp @L958;
+@L957:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -28;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldbp 16;
+stdw;
+pop;
+@L958:
+ldidw 1;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp -32;
+lddw;
+ldiqw x86_get_operand;
+call 4;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S766;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S767;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldidw 0;
+ldiqw pinned;
+ldbp 16;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+ldbp 8;
+ldqw;
+ldidw 4;
+dw2qw;
+andqw;
+ordw;
+jmpf @L959;
+ldiqw x86_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 8;
+ldqw;
+ldidw 1;
+dw2qw;
+andqw;
+ordw;
+jmpf @L960;
+ldiqw @S768;
+jmp @L961;
+@L960:
+ldiqw @S769;
+@L961:
+ldiqw @S770;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S771;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_lbreg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw x86_reg_str;
+ldbp 16;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S772;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 32;
+pop;
+pop;
+ldiqw @S773;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L962:
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 16;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 2;
+anddw;
+dw2ub;
+ldbp -28;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 32;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 4;
+anddw;
+dw2ub;
+ldbp -32;
+lddw;
+ldiqw update_arg_descriptors;
+call 12;
+pop;
+pop;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 8;
+anddw;
+ldiqw liveness_and_next_use;
+ldqw;
+ldbp -20;
+lddw;
+dw2qw;
+ldxub 1;
+ldidw 1;
+anddw;
+dw2ub;
+ldbp -24;
+lddw;
+ldbp 16;
+lddw;
+ldiqw update_tar_descriptors;
+call 16;
+pop;
+pop;
+@L963:
+ldidw 0;
+jmpf @L964;
+jmp @L962;
+@L964:
+jmp @L965;
+@L959:
+ldbp -32;
+lddw;
+ldbp -28;
+lddw;
+ldbp -24;
+lddw;
+ldbp 8;
+ldqw;
+ldbp -20;
+lddw;
+ldiqw do_relop_jump;
+call 24;
+pop;
+pop;
+@L965:
+@L950:
+ldidw 0;
+ret;
+.bss
+.align 4
+pinned:
+.res 24
+.extern new_decl_list_node
+.extern compute_liveness_and_next_use
+.extern srandom
+# ==== start of definition of function `x86_store' ====
+.text
+x86_store:
+addsp 40;        
+# param:`r', offset:-20
+# param:`a', offset:-24
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 2;
+eqdw;
+jmpf @L966;
+# var: e, offset: 8
+# var: clutter_eax, offset: 16
+# var: siz_str, offset: 24
+# var: reg_str, offset: 32
+ldidw 0;
+ldbp 16;
+stdw;
+pop;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 8;
+addqw;
+ldqw;
+ldbp 8;
+stqw;
+pop;
+pop;
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_type_category;
+call 8;
+pop;
+ldiqw @T967;
+switch;
+@L969:
+@L970:
+# var: cluttered, offset: 40
+ldidw 0;
+ldbp 40;
+stdw;
+pop;
+ldbp -20;
+lddw;
+ldidw 4;
+neqdw;
+jmpf @L971;
+ldiqw reg_descr_tab;
+ldidw 4;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L972;
+ldbp 40;
+lddw;
+ldidw 1;
+ordw;
+ldbp 40;
+stdw;
+pop;
+ldiqw @S774;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S775;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L973;
+@L972:
+ldidw 1;
+ldiqw modified;
+ldidw 4;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L973:
+ldiqw x86_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S776;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S777;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L971:
+ldiqw addr_descr_tab;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+lddw;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+ldw;
+ldidw 5;
+neqdw;
+jmpf @L974;
+ldiqw reg_descr_tab;
+ldidw 5;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L975;
+ldbp 40;
+lddw;
+ldidw 2;
+ordw;
+ldbp 40;
+stdw;
+pop;
+ldiqw @S778;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S779;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L976;
+@L975:
+ldidw 1;
+ldiqw modified;
+ldidw 5;
+dw2qw;
+ldiqw 4;
+mulqw;
+addqw;
+stdw;
+pop;
+@L976:
+ldbp -24;
+lddw;
+ldidw 5;
+ldiqw x86_load_addr;
+call 8;
+pop;
+pop;
+@L974:
+ldiqw reg_descr_tab;
+ldidw 2;
+dw2qw;
+ldxdw 4;
+ldidw 0;
+eqdw;
+notdw;
+jmpf @L977;
+ldbp 40;
+lddw;
+ldidw 4;
+ordw;
+ldbp 40;
+stdw;
+pop;
+ldiqw @S780;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S781;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L977:
+ldbp 8;
+ldqw;
+ldiqw 72;
+addqw;
+ldiqw get_sizeof;
+call 8;
+pop;
+ldiqw @S782;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 20;
+pop;
+pop;
+ldiqw @S783;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S784;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S785;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldbp 40;
+lddw;
+ldidw 4;
+anddw;
+jmpf @L978;
+ldiqw @S786;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S787;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L978:
+ldbp 40;
+lddw;
+ldidw 2;
+anddw;
+jmpf @L979;
+ldiqw @S788;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S789;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L979:
+ldbp 40;
+lddw;
+ldidw 1;
+anddw;
+jmpf @L980;
+ldiqw @S790;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S791;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L980:
+ldiqw 0;
+ret;
+@L981:
+@L982:
+ldiqw @S792;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw x86_lwreg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L968;
+@L983:
+@L984:
+@L985:
+ldiqw @S793;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldbp -20;
+lddw;
+ldidw 4;
+eqdw;
+jmpt @L986;
+ldbp -20;
+lddw;
+ldidw 5;
+eqdw;
+jmpt @L986;
+ldidw 0;
+jmp @L987;
+@L986:
+ldidw 1;
+@L987:
+jmpf @L988;
+ldiqw @S794;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S795;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldiqw @S796;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 24;
+pop;
+pop;
+ldiqw @S797;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S798;
+ldbp 32;
+stqw;
+pop;
+pop;
+ldidw 1;
+ldbp 16;
+stdw;
+pop;
+jmp @L989;
+@L988:
+ldiqw x86_lbreg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+@L989:
+jmp @L968;
+@L990:
+ldiqw @S799;
+ldbp 24;
+stqw;
+pop;
+pop;
+ldiqw x86_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp 32;
+stqw;
+pop;
+pop;
+jmp @L968;
+@L968:
+.data
+.align 8
+@T967:
+.dword 8
+.dword 49
+.dword 64
+.dword 68
+.dword 71
+.dword 106
+.dword 107
+.dword 108
+.qword @L990
+.qword @L983
+.qword @L981
+.qword @L969
+.qword @L970
+.qword @L984
+.qword @L985
+.qword @L982
+.text
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 13;
+addqw;
+ldb;
+ldidw 1;
+eqdw;
+jmpf @L991;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldiqw 12;
+addqw;
+ldb;
+ldidw 2;
+eqdw;
+jmpf @L992;
+ldbp 32;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldiqw curr_func;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw @S800;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 48;
+pop;
+pop;
+ldiqw @S801;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+jmp @L993;
+@L992:
+ldbp 32;
+ldqw;
+ldbp 8;
+ldqw;
+ldiqw 56;
+addqw;
+ldqw;
+ldbp 24;
+ldqw;
+ldiqw @S802;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 40;
+pop;
+pop;
+ldiqw @S803;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L993:
+jmp @L994;
+@L991:
+ldbp 32;
+ldqw;
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 8;
+addqw;
+ldiqw 16;
+addqw;
+lddw;
+ldbp 24;
+ldqw;
+ldiqw @S804;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 36;
+pop;
+pop;
+ldiqw @S805;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L994:
+ldbp 16;
+lddw;
+jmpf @L995;
+ldiqw @S806;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+ldiqw @S807;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L995:
+jmp @L996;
+@L966:
+ldiqw ic_addresses;
+ldqw;
+ldbp -24;
+lddw;
+udw2qw;
+ldiqw 32;
+mulqw;
+addqw;
+ldiqw 0;
+addqw;
+lddw;
+ldidw 3;
+eqdw;
+jmpf @L997;
+ldiqw x86_reg_str;
+ldbp -20;
+lddw;
+dw2qw;
+ldxqw 8;
+ldbp -24;
+lddw;
+ldiqw get_temp_offs;
+call 4;
+pop;
+ldiqw @S808;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 28;
+pop;
+pop;
+ldiqw @S809;
+ldiqw func_body;
+ldqw;
+ldiqw string_printf;
+call 16;
+pop;
+pop;
+@L997:
+@L996:
+ldidw 0;
+ret;
+.extern lookup_struct_descriptor
+.extern new_exec_node
+.extern get_alignment
+.extern fgetc
+.bss
+.align 8
+__temp_struct:
+.res 4
+.data
+@S0:
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 32
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S1:
+.byte 10
+.byte 0
+@S2:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S3:
+.byte 10
+.byte 0
+@S4:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 43
+.byte 52
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S5:
+.byte 10
+.byte 0
+@S6:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S7:
+.byte 10
+.byte 0
+@S8:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 43
+.byte 52
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S9:
+.byte 10
+.byte 0
+@S10:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S11:
+.byte 10
+.byte 0
+@S12:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S13:
+.byte 10
+.byte 0
+@S14:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S15:
+.byte 10
+.byte 0
+@S16:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S17:
+.byte 10
+.byte 0
+@S18:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 0
+@S19:
+.byte 10
+.byte 0
+@S20:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S21:
+.byte 10
+.byte 0
+@S22:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S23:
+.byte 10
+.byte 0
+@S24:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 0
+@S25:
+.byte 10
+.byte 0
+@S26:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S27:
+.byte 10
+.byte 0
+@S28:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 0
+@S29:
+.byte 10
+.byte 0
+@S30:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S31:
+.byte 10
+.byte 0
+@S32:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S33:
+.byte 10
+.byte 0
+@S34:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 0
+@S35:
+.byte 10
+.byte 0
+@S36:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S37:
+.byte 10
+.byte 0
+@S38:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S39:
+.byte 10
+.byte 0
+@S40:
+.byte 115
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S41:
+.byte 10
+.byte 0
+@S42:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S43:
+.byte 10
+.byte 0
+@S44:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S45:
+.byte 10
+.byte 0
+@S46:
+.byte 103
+.byte 0
+@S47:
+.byte 97
+.byte 0
+@S48:
+.byte 115
+.byte 101
+.byte 116
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S49:
+.byte 10
+.byte 0
+@S50:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S51:
+.byte 10
+.byte 0
+@S52:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S53:
+.byte 10
+.byte 0
+@S54:
+.byte 108
+.byte 0
+@S55:
+.byte 98
+.byte 0
+@S56:
+.byte 115
+.byte 101
+.byte 116
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S57:
+.byte 10
+.byte 0
+@S58:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S59:
+.byte 10
+.byte 0
+@S60:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S61:
+.byte 10
+.byte 0
+@S62:
+.byte 115
+.byte 97
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 51
+.byte 49
+.byte 0
+@S63:
+.byte 10
+.byte 0
+@S64:
+.byte 97
+.byte 108
+.byte 0
+@S65:
+.byte 98
+.byte 108
+.byte 0
+@S66:
+.byte 99
+.byte 108
+.byte 0
+@S67:
+.byte 100
+.byte 108
+.byte 0
+@S68:
+.byte 63
+.byte 63
+.byte 0
+@S69:
+.byte 63
+.byte 63
+.byte 0
+@S70:
+.byte 111
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S71:
+.byte 10
+.byte 0
+@S72:
+.byte 111
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S73:
+.byte 10
+.byte 0
+@S74:
+.byte 111
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S75:
+.byte 10
+.byte 0
+@S76:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S77:
+.byte 10
+.byte 0
+@S78:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S79:
+.byte 10
+.byte 0
+@S80:
+.byte 120
+.byte 111
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S81:
+.byte 10
+.byte 0
+@S82:
+.byte 37
+.byte 115
+.byte 32
+.byte 61
+.byte 62
+.byte 32
+.byte 37
+.byte 115
+.byte 10
+.byte 0
+@S83:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S84:
+.byte 10
+.byte 0
+@S85:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S86:
+.byte 10
+.byte 0
+@S87:
+.byte 106
+.byte 110
+.byte 101
+.byte 32
+.byte 46
+.byte 115
+.byte 119
+.byte 54
+.byte 52
+.byte 76
+.byte 37
+.byte 117
+.byte 0
+@S88:
+.byte 10
+.byte 0
+@S89:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S90:
+.byte 10
+.byte 0
+@S91:
+.byte 106
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S92:
+.byte 10
+.byte 0
+@S93:
+.byte 46
+.byte 115
+.byte 119
+.byte 54
+.byte 52
+.byte 76
+.byte 37
+.byte 117
+.byte 58
+.byte 0
+@S94:
+.byte 10
+.byte 0
+@S95:
+.byte 100
+.byte 100
+.byte 32
+.byte 48
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 10
+.byte 0
+@S96:
+.byte 100
+.byte 98
+.byte 32
+.byte 48
+.byte 120
+.byte 37
+.byte 48
+.byte 50
+.byte 120
+.byte 10
+.byte 0
+@S97:
+.byte 116
+.byte 105
+.byte 109
+.byte 101
+.byte 115
+.byte 32
+.byte 37
+.byte 117
+.byte 32
+.byte 100
+.byte 98
+.byte 32
+.byte 48
+.byte 0
+@S98:
+.byte 10
+.byte 0
+@S99:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S100:
+.byte 10
+.byte 0
+@S101:
+.byte 116
+.byte 105
+.byte 109
+.byte 101
+.byte 115
+.byte 32
+.byte 37
+.byte 117
+.byte 32
+.byte 100
+.byte 98
+.byte 32
+.byte 48
+.byte 0
+@S102:
+.byte 10
+.byte 0
+@S103:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S104:
+.byte 10
+.byte 0
+@S105:
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 95
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 0
+@S106:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S107:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S108:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S109:
+.byte 10
+.byte 0
+@S110:
+.byte 116
+.byte 105
+.byte 109
+.byte 101
+.byte 115
+.byte 32
+.byte 37
+.byte 117
+.byte 32
+.byte 100
+.byte 98
+.byte 32
+.byte 48
+.byte 0
+@S111:
+.byte 10
+.byte 0
+@S112:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S113:
+.byte 10
+.byte 0
+@S114:
+.byte 100
+.byte 98
+.byte 32
+.byte 0
+@S115:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 50
+.byte 0
+@S116:
+.byte 10
+.byte 0
+@S117:
+.byte 100
+.byte 119
+.byte 32
+.byte 0
+@S118:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 52
+.byte 0
+@S119:
+.byte 10
+.byte 0
+@S120:
+.byte 100
+.byte 113
+.byte 32
+.byte 0
+@S121:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 52
+.byte 0
+@S122:
+.byte 10
+.byte 0
+@S123:
+.byte 100
+.byte 100
+.byte 32
+.byte 0
+@S124:
+.byte 10
+.byte 0
+@S125:
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 114
+.byte 101
+.byte 103
+.byte 48
+.byte 0
+@S126:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S127:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S128:
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S129:
+.byte 10
+.byte 0
+@S130:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S131:
+.byte 10
+.byte 0
+@S132:
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S133:
+.byte 10
+.byte 0
+@S134:
+.byte 97
+.byte 108
+.byte 105
+.byte 103
+.byte 110
+.byte 98
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S135:
+.byte 10
+.byte 0
+@S136:
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S137:
+.byte 10
+.byte 0
+@S138:
+.byte 103
+.byte 108
+.byte 111
+.byte 98
+.byte 97
+.byte 108
+.byte 32
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S139:
+.byte 10
+.byte 0
+@S140:
+.byte 36
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S141:
+.byte 10
+.byte 0
+@S142:
+.byte 114
+.byte 101
+.byte 115
+.byte 98
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S143:
+.byte 10
+.byte 0
+@S144:
+.byte 37
+.byte 115
+.byte 32
+.byte 61
+.byte 62
+.byte 32
+.byte 37
+.byte 115
+.byte 58
+.byte 37
+.byte 115
+.byte 10
+.byte 0
+@S145:
+.byte 37
+.byte 115
+.byte 32
+.byte 61
+.byte 62
+.byte 32
+.byte 37
+.byte 115
+.byte 10
+.byte 0
+@S146:
+.byte 105
+.byte 109
+.byte 117
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S147:
+.byte 10
+.byte 0
+@S148:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 43
+.byte 52
+.byte 93
+.byte 0
+@S149:
+.byte 10
+.byte 0
+@S150:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S151:
+.byte 10
+.byte 0
+@S152:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S153:
+.byte 10
+.byte 0
+@S154:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S155:
+.byte 10
+.byte 0
+@S156:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S157:
+.byte 10
+.byte 0
+@S158:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S159:
+.byte 10
+.byte 0
+@S160:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S161:
+.byte 10
+.byte 0
+@S162:
+.byte 10
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 32
+.byte 111
+.byte 98
+.byte 106
+.byte 101
+.byte 99
+.byte 116
+.byte 115
+.byte 32
+.byte 119
+.byte 105
+.byte 116
+.byte 104
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 32
+.byte 100
+.byte 117
+.byte 114
+.byte 97
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 0
+@S163:
+.byte 10
+.byte 0
+@S164:
+.byte 10
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 32
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 115
+.byte 121
+.byte 109
+.byte 98
+.byte 111
+.byte 108
+.byte 115
+.byte 0
+@S165:
+.byte 10
+.byte 0
+@S166:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S167:
+.byte 10
+.byte 0
+@S168:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 109
+.byte 101
+.byte 109
+.byte 99
+.byte 112
+.byte 121
+.byte 0
+@S169:
+.byte 10
+.byte 0
+@S170:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 109
+.byte 101
+.byte 109
+.byte 115
+.byte 101
+.byte 116
+.byte 0
+@S171:
+.byte 10
+.byte 0
+@S172:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 109
+.byte 117
+.byte 108
+.byte 54
+.byte 52
+.byte 0
+@S173:
+.byte 10
+.byte 0
+@S174:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 100
+.byte 105
+.byte 118
+.byte 54
+.byte 52
+.byte 0
+@S175:
+.byte 10
+.byte 0
+@S176:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 100
+.byte 105
+.byte 118
+.byte 54
+.byte 52
+.byte 0
+@S177:
+.byte 10
+.byte 0
+@S178:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 109
+.byte 111
+.byte 100
+.byte 54
+.byte 52
+.byte 0
+@S179:
+.byte 10
+.byte 0
+@S180:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 109
+.byte 111
+.byte 100
+.byte 54
+.byte 52
+.byte 0
+@S181:
+.byte 10
+.byte 0
+@S182:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 104
+.byte 108
+.byte 54
+.byte 52
+.byte 0
+@S183:
+.byte 10
+.byte 0
+@S184:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 115
+.byte 104
+.byte 114
+.byte 54
+.byte 52
+.byte 0
+@S185:
+.byte 10
+.byte 0
+@S186:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 115
+.byte 104
+.byte 114
+.byte 54
+.byte 52
+.byte 0
+@S187:
+.byte 10
+.byte 0
+@S188:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S189:
+.byte 10
+.byte 0
+@S190:
+.byte 101
+.byte 120
+.byte 116
+.byte 101
+.byte 114
+.byte 110
+.byte 32
+.byte 36
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S191:
+.byte 10
+.byte 0
+@S192:
+.byte 10
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 105
+.byte 110
+.byte 103
+.byte 32
+.byte 108
+.byte 105
+.byte 116
+.byte 101
+.byte 114
+.byte 97
+.byte 108
+.byte 115
+.byte 0
+@S193:
+.byte 10
+.byte 0
+@S194:
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 46
+.byte 114
+.byte 111
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S195:
+.byte 10
+.byte 0
+@S196:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S197:
+.byte 10
+.byte 0
+@S198:
+.byte 97
+.byte 100
+.byte 99
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S199:
+.byte 10
+.byte 0
+@S200:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S201:
+.byte 10
+.byte 0
+@S202:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 100
+.byte 105
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 45
+.byte 52
+.byte 93
+.byte 0
+@S203:
+.byte 10
+.byte 0
+@S204:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S205:
+.byte 10
+.byte 0
+@S206:
+.byte 114
+.byte 101
+.byte 112
+.byte 32
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 98
+.byte 0
+@S207:
+.byte 10
+.byte 0
+@S208:
+.byte 110
+.byte 101
+.byte 103
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S209:
+.byte 10
+.byte 0
+@S210:
+.byte 97
+.byte 100
+.byte 99
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 48
+.byte 0
+@S211:
+.byte 10
+.byte 0
+@S212:
+.byte 110
+.byte 101
+.byte 103
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S213:
+.byte 10
+.byte 0
+@S214:
+.byte 110
+.byte 101
+.byte 103
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S215:
+.byte 10
+.byte 0
+@S216:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S217:
+.byte 10
+.byte 0
+@S218:
+.byte 115
+.byte 101
+.byte 116
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S219:
+.byte 10
+.byte 0
+@S220:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S221:
+.byte 10
+.byte 0
+@S222:
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S223:
+.byte 10
+.byte 0
+@S224:
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S225:
+.byte 10
+.byte 0
+@S226:
+.byte 97
+.byte 110
+.byte 100
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S227:
+.byte 10
+.byte 0
+@S228:
+.byte 10
+.byte 0
+@S229:
+.byte 59
+.byte 32
+.byte 61
+.byte 61
+.byte 61
+.byte 61
+.byte 32
+.byte 115
+.byte 116
+.byte 97
+.byte 114
+.byte 116
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 100
+.byte 101
+.byte 102
+.byte 105
+.byte 110
+.byte 105
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 111
+.byte 102
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 96
+.byte 37
+.byte 115
+.byte 39
+.byte 32
+.byte 61
+.byte 61
+.byte 61
+.byte 61
+.byte 0
+@S230:
+.byte 10
+.byte 0
+@S231:
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S232:
+.byte 10
+.byte 0
+@S233:
+.byte 103
+.byte 108
+.byte 111
+.byte 98
+.byte 97
+.byte 108
+.byte 32
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S234:
+.byte 10
+.byte 0
+@S235:
+.byte 36
+.byte 37
+.byte 115
+.byte 58
+.byte 0
+@S236:
+.byte 10
+.byte 0
+@S237:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 0
+@S238:
+.byte 10
+.byte 0
+@S239:
+.byte 120
+.byte 99
+.byte 104
+.byte 103
+.byte 32
+.byte 91
+.byte 101
+.byte 115
+.byte 112
+.byte 93
+.byte 44
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 0
+@S240:
+.byte 10
+.byte 0
+@S241:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 98
+.byte 112
+.byte 0
+@S242:
+.byte 10
+.byte 0
+@S243:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 98
+.byte 112
+.byte 44
+.byte 32
+.byte 101
+.byte 115
+.byte 112
+.byte 0
+@S244:
+.byte 10
+.byte 0
+@S245:
+.byte 59
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S246:
+.byte 10
+.byte 0
+@S247:
+.byte 37
+.byte 100
+.byte 0
+@S248:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 101
+.byte 115
+.byte 112
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S249:
+.byte 10
+.byte 0
+@S250:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 115
+.byte 105
+.byte 0
+@S251:
+.byte 10
+.byte 0
+@S252:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 100
+.byte 105
+.byte 0
+@S253:
+.byte 10
+.byte 0
+@S254:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 98
+.byte 120
+.byte 0
+@S255:
+.byte 10
+.byte 0
+@S256:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 45
+.byte 52
+.byte 93
+.byte 44
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 0
+@S257:
+.byte 10
+.byte 0
+@S258:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 45
+.byte 52
+.byte 93
+.byte 0
+@S259:
+.byte 10
+.byte 0
+@S260:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 98
+.byte 120
+.byte 0
+@S261:
+.byte 10
+.byte 0
+@S262:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 100
+.byte 105
+.byte 0
+@S263:
+.byte 10
+.byte 0
+@S264:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 115
+.byte 105
+.byte 0
+@S265:
+.byte 10
+.byte 0
+@S266:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 115
+.byte 112
+.byte 44
+.byte 32
+.byte 101
+.byte 98
+.byte 112
+.byte 0
+@S267:
+.byte 10
+.byte 0
+@S268:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 98
+.byte 112
+.byte 0
+@S269:
+.byte 10
+.byte 0
+@S270:
+.byte 114
+.byte 101
+.byte 116
+.byte 0
+@S271:
+.byte 10
+.byte 0
+@S272:
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 97
+.byte 114
+.byte 103
+.byte 0
+@S273:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S274:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S275:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S276:
+.byte 10
+.byte 0
+@S277:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S278:
+.byte 10
+.byte 0
+@S279:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 101
+.byte 115
+.byte 112
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S280:
+.byte 10
+.byte 0
+@S281:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 115
+.byte 105
+.byte 0
+@S282:
+.byte 10
+.byte 0
+@S283:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 100
+.byte 105
+.byte 0
+@S284:
+.byte 10
+.byte 0
+@S285:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 100
+.byte 105
+.byte 44
+.byte 32
+.byte 101
+.byte 115
+.byte 112
+.byte 0
+@S286:
+.byte 10
+.byte 0
+@S287:
+.byte 108
+.byte 101
+.byte 97
+.byte 32
+.byte 101
+.byte 100
+.byte 105
+.byte 44
+.byte 32
+.byte 91
+.byte 101
+.byte 115
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S288:
+.byte 10
+.byte 0
+@S289:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 0
+@S290:
+.byte 10
+.byte 0
+@S291:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S292:
+.byte 10
+.byte 0
+@S293:
+.byte 114
+.byte 101
+.byte 112
+.byte 32
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 98
+.byte 0
+@S294:
+.byte 10
+.byte 0
+@S295:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 0
+@S296:
+.byte 10
+.byte 0
+@S297:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 100
+.byte 105
+.byte 0
+@S298:
+.byte 10
+.byte 0
+@S299:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 115
+.byte 105
+.byte 0
+@S300:
+.byte 10
+.byte 0
+@S301:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S302:
+.byte 10
+.byte 0
+@S303:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 109
+.byte 117
+.byte 108
+.byte 54
+.byte 52
+.byte 0
+@S304:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 100
+.byte 105
+.byte 118
+.byte 54
+.byte 52
+.byte 0
+@S305:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 100
+.byte 105
+.byte 118
+.byte 54
+.byte 52
+.byte 0
+@S306:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 109
+.byte 111
+.byte 100
+.byte 54
+.byte 52
+.byte 0
+@S307:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 109
+.byte 111
+.byte 100
+.byte 54
+.byte 52
+.byte 0
+@S308:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 104
+.byte 108
+.byte 54
+.byte 52
+.byte 0
+@S309:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 115
+.byte 104
+.byte 114
+.byte 54
+.byte 52
+.byte 0
+@S310:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 115
+.byte 104
+.byte 114
+.byte 54
+.byte 52
+.byte 0
+@S311:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S312:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S313:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S314:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S315:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S316:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S317:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S318:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S319:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S320:
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 115
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S321:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S322:
+.byte 10
+.byte 0
+@S323:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S324:
+.byte 10
+.byte 0
+@S325:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S326:
+.byte 10
+.byte 0
+@S327:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S328:
+.byte 10
+.byte 0
+@S329:
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S330:
+.byte 10
+.byte 0
+@S331:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 101
+.byte 115
+.byte 112
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S332:
+.byte 10
+.byte 0
+@S333:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S334:
+.byte 10
+.byte 0
+@S335:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S336:
+.byte 10
+.byte 0
+@S337:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S338:
+.byte 10
+.byte 0
+@S339:
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S340:
+.byte 10
+.byte 0
+@S341:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 101
+.byte 115
+.byte 112
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S342:
+.byte 10
+.byte 0
+@S343:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 48
+.byte 0
+@S344:
+.byte 10
+.byte 0
+@S345:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 48
+.byte 0
+@S346:
+.byte 10
+.byte 0
+@S347:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S348:
+.byte 10
+.byte 0
+@S349:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S350:
+.byte 10
+.byte 0
+@S351:
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 32
+.byte 95
+.byte 95
+.byte 108
+.byte 117
+.byte 120
+.byte 95
+.byte 117
+.byte 99
+.byte 109
+.byte 112
+.byte 54
+.byte 52
+.byte 0
+@S352:
+.byte 10
+.byte 0
+@S353:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 101
+.byte 115
+.byte 112
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S354:
+.byte 10
+.byte 0
+@S355:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 49
+.byte 0
+@S356:
+.byte 10
+.byte 0
+@S357:
+.byte 115
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S358:
+.byte 10
+.byte 0
+@S359:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S360:
+.byte 10
+.byte 0
+@S361:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S362:
+.byte 10
+.byte 0
+@S363:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S364:
+.byte 10
+.byte 0
+@S365:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S366:
+.byte 10
+.byte 0
+@S367:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S368:
+.byte 10
+.byte 0
+@S369:
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S370:
+.byte 10
+.byte 0
+@S371:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 101
+.byte 115
+.byte 112
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S372:
+.byte 10
+.byte 0
+@S373:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 49
+.byte 0
+@S374:
+.byte 10
+.byte 0
+@S375:
+.byte 115
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S376:
+.byte 10
+.byte 0
+@S377:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S378:
+.byte 10
+.byte 0
+@S379:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 49
+.byte 0
+@S380:
+.byte 10
+.byte 0
+@S381:
+.byte 115
+.byte 101
+.byte 116
+.byte 110
+.byte 101
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S382:
+.byte 10
+.byte 0
+@S383:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S384:
+.byte 10
+.byte 0
+@S385:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 52
+.byte 0
+@S386:
+.byte 10
+.byte 0
+@S387:
+.byte 115
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S388:
+.byte 10
+.byte 0
+@S389:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S390:
+.byte 10
+.byte 0
+@S391:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 50
+.byte 0
+@S392:
+.byte 10
+.byte 0
+@S393:
+.byte 115
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S394:
+.byte 10
+.byte 0
+@S395:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S396:
+.byte 10
+.byte 0
+@S397:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 52
+.byte 0
+@S398:
+.byte 10
+.byte 0
+@S399:
+.byte 115
+.byte 101
+.byte 116
+.byte 110
+.byte 101
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S400:
+.byte 10
+.byte 0
+@S401:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S402:
+.byte 10
+.byte 0
+@S403:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 50
+.byte 0
+@S404:
+.byte 10
+.byte 0
+@S405:
+.byte 115
+.byte 101
+.byte 116
+.byte 110
+.byte 101
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S406:
+.byte 10
+.byte 0
+@S407:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 97
+.byte 108
+.byte 0
+@S408:
+.byte 10
+.byte 0
+@S409:
+.byte 101
+.byte 97
+.byte 120
+.byte 0
+@S410:
+.byte 101
+.byte 98
+.byte 120
+.byte 0
+@S411:
+.byte 101
+.byte 99
+.byte 120
+.byte 0
+@S412:
+.byte 101
+.byte 100
+.byte 120
+.byte 0
+@S413:
+.byte 101
+.byte 115
+.byte 105
+.byte 0
+@S414:
+.byte 101
+.byte 100
+.byte 105
+.byte 0
+@S415:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 48
+.byte 0
+@S416:
+.byte 10
+.byte 0
+@S417:
+.byte 115
+.byte 101
+.byte 116
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S418:
+.byte 10
+.byte 0
+@S419:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S420:
+.byte 10
+.byte 0
+@S421:
+.byte 43
+.byte 37
+.byte 117
+.byte 42
+.byte 0
+@S422:
+.byte 43
+.byte 37
+.byte 117
+.byte 0
+@S423:
+.byte 43
+.byte 0
+@S424:
+.byte 43
+.byte 37
+.byte 117
+.byte 42
+.byte 0
+@S425:
+.byte 45
+.byte 0
+@S426:
+.byte 45
+.byte 37
+.byte 117
+.byte 42
+.byte 0
+@S427:
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 115
+.byte 116
+.byte 97
+.byte 116
+.byte 105
+.byte 99
+.byte 95
+.byte 101
+.byte 120
+.byte 112
+.byte 114
+.byte 0
+@S428:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S429:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S430:
+.byte 37
+.byte 108
+.byte 108
+.byte 117
+.byte 0
+@S431:
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S432:
+.byte 10
+.byte 0
+@S433:
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S434:
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S435:
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S436:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S437:
+.byte 10
+.byte 0
+@S438:
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 97
+.byte 114
+.byte 101
+.byte 95
+.byte 97
+.byte 103
+.byte 97
+.byte 105
+.byte 110
+.byte 115
+.byte 116
+.byte 95
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S439:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S440:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S441:
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 111
+.byte 109
+.byte 112
+.byte 97
+.byte 114
+.byte 101
+.byte 95
+.byte 97
+.byte 103
+.byte 97
+.byte 105
+.byte 110
+.byte 115
+.byte 116
+.byte 95
+.byte 99
+.byte 111
+.byte 110
+.byte 115
+.byte 116
+.byte 97
+.byte 110
+.byte 116
+.byte 0
+@S442:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S443:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S444:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S445:
+.byte 10
+.byte 0
+@S446:
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S447:
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 0
+@S448:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S449:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S450:
+.byte 10
+.byte 0
+@S451:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S452:
+.byte 10
+.byte 0
+@S453:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S454:
+.byte 10
+.byte 0
+@S455:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S456:
+.byte 10
+.byte 0
+@S457:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S458:
+.byte 10
+.byte 0
+@S459:
+.byte 46
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S460:
+.byte 46
+.byte 116
+.byte 101
+.byte 120
+.byte 116
+.byte 0
+@S461:
+.byte 46
+.byte 98
+.byte 115
+.byte 115
+.byte 0
+@S462:
+.byte 46
+.byte 114
+.byte 111
+.byte 100
+.byte 97
+.byte 116
+.byte 97
+.byte 0
+@S463:
+.byte 115
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S464:
+.byte 10
+.byte 0
+@S465:
+.byte 115
+.byte 97
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 99
+.byte 108
+.byte 0
+@S466:
+.byte 10
+.byte 0
+@S467:
+.byte 115
+.byte 104
+.byte 114
+.byte 0
+@S468:
+.byte 115
+.byte 97
+.byte 114
+.byte 0
+@S469:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S470:
+.byte 10
+.byte 0
+@S471:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 99
+.byte 108
+.byte 0
+@S472:
+.byte 10
+.byte 0
+@S473:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S474:
+.byte 10
+.byte 0
+@S475:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S476:
+.byte 10
+.byte 0
+@S477:
+.byte 108
+.byte 101
+.byte 97
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S478:
+.byte 10
+.byte 0
+@S479:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S480:
+.byte 10
+.byte 0
+@S481:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S482:
+.byte 10
+.byte 0
+@S483:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S484:
+.byte 10
+.byte 0
+@S485:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 0
+@S486:
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S487:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 0
+@S488:
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S489:
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 120
+.byte 0
+@S490:
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 0
+@S491:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 0
+@S492:
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 0
+@S493:
+.byte 109
+.byte 111
+.byte 118
+.byte 0
+@S494:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S495:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S496:
+.byte 10
+.byte 0
+@S497:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S498:
+.byte 10
+.byte 0
+@S499:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S500:
+.byte 10
+.byte 0
+@S501:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S502:
+.byte 10
+.byte 0
+@S503:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S504:
+.byte 10
+.byte 0
+@S505:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S506:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S507:
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S508:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 48
+.byte 0
+@S509:
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 50
+.byte 0
+@S510:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S511:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S512:
+.byte 37
+.byte 115
+.byte 0
+@S513:
+.byte 37
+.byte 115
+.byte 0
+@S514:
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 50
+.byte 0
+@S515:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S516:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S517:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S518:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 43
+.byte 52
+.byte 93
+.byte 0
+@S519:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S520:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 43
+.byte 52
+.byte 93
+.byte 0
+@S521:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S522:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S523:
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 103
+.byte 101
+.byte 116
+.byte 95
+.byte 111
+.byte 112
+.byte 101
+.byte 114
+.byte 97
+.byte 110
+.byte 100
+.byte 50
+.byte 0
+@S524:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S525:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S526:
+.byte 37
+.byte 115
+.byte 0
+@S527:
+.byte 37
+.byte 115
+.byte 0
+@S528:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S529:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S530:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 108
+.byte 100
+.byte 0
+@S531:
+.byte 10
+.byte 0
+@S532:
+.byte 106
+.byte 108
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S533:
+.byte 10
+.byte 0
+@S534:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 108
+.byte 100
+.byte 0
+@S535:
+.byte 10
+.byte 0
+@S536:
+.byte 106
+.byte 103
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S537:
+.byte 10
+.byte 0
+@S538:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 108
+.byte 100
+.byte 0
+@S539:
+.byte 10
+.byte 0
+@S540:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 42
+.byte 52
+.byte 43
+.byte 46
+.byte 106
+.byte 116
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S541:
+.byte 10
+.byte 0
+@S542:
+.byte 46
+.byte 76
+.byte 37
+.byte 108
+.byte 100
+.byte 0
+@S543:
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S544:
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S545:
+.byte 10
+.byte 0
+@S546:
+.byte 46
+.byte 106
+.byte 116
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S547:
+.byte 10
+.byte 0
+@S548:
+.byte 100
+.byte 100
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S549:
+.byte 10
+.byte 0
+@S550:
+.byte 115
+.byte 101
+.byte 103
+.byte 109
+.byte 101
+.byte 110
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S551:
+.byte 10
+.byte 0
+@S552:
+.byte 106
+.byte 109
+.byte 112
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S553:
+.byte 10
+.byte 0
+@S554:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S555:
+.byte 10
+.byte 0
+@S556:
+.byte 106
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S557:
+.byte 10
+.byte 0
+@S558:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S559:
+.byte 10
+.byte 0
+@S560:
+.byte 115
+.byte 98
+.byte 98
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S561:
+.byte 10
+.byte 0
+@S562:
+.byte 115
+.byte 117
+.byte 98
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S563:
+.byte 10
+.byte 0
+@S564:
+.byte 97
+.byte 120
+.byte 0
+@S565:
+.byte 98
+.byte 120
+.byte 0
+@S566:
+.byte 99
+.byte 120
+.byte 0
+@S567:
+.byte 100
+.byte 120
+.byte 0
+@S568:
+.byte 115
+.byte 105
+.byte 0
+@S569:
+.byte 100
+.byte 105
+.byte 0
+@S570:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S571:
+.byte 10
+.byte 0
+@S572:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S573:
+.byte 10
+.byte 0
+@S574:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S575:
+.byte 10
+.byte 0
+@S576:
+.byte 120
+.byte 111
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S577:
+.byte 10
+.byte 0
+@S578:
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 108
+.byte 111
+.byte 97
+.byte 100
+.byte 50
+.byte 0
+@S579:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S580:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S581:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S582:
+.byte 10
+.byte 0
+@S583:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S584:
+.byte 10
+.byte 0
+@S585:
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 108
+.byte 111
+.byte 97
+.byte 100
+.byte 50
+.byte 0
+@S586:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S587:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S588:
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 108
+.byte 111
+.byte 97
+.byte 100
+.byte 50
+.byte 0
+@S589:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S590:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S591:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S592:
+.byte 10
+.byte 0
+@S593:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 43
+.byte 52
+.byte 93
+.byte 0
+@S594:
+.byte 10
+.byte 0
+@S595:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S596:
+.byte 10
+.byte 0
+@S597:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 43
+.byte 52
+.byte 93
+.byte 0
+@S598:
+.byte 10
+.byte 0
+@S599:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S600:
+.byte 10
+.byte 0
+@S601:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S602:
+.byte 10
+.byte 0
+@S603:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S604:
+.byte 10
+.byte 0
+@S605:
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 108
+.byte 111
+.byte 97
+.byte 100
+.byte 50
+.byte 0
+@S606:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S607:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S608:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S609:
+.byte 10
+.byte 0
+@S610:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S611:
+.byte 10
+.byte 0
+@S612:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S613:
+.byte 10
+.byte 0
+@S614:
+.byte 120
+.byte 111
+.byte 114
+.byte 32
+.byte 101
+.byte 100
+.byte 120
+.byte 44
+.byte 32
+.byte 101
+.byte 100
+.byte 120
+.byte 0
+@S615:
+.byte 10
+.byte 0
+@S616:
+.byte 100
+.byte 105
+.byte 118
+.byte 0
+@S617:
+.byte 99
+.byte 100
+.byte 113
+.byte 0
+@S618:
+.byte 10
+.byte 0
+@S619:
+.byte 105
+.byte 100
+.byte 105
+.byte 118
+.byte 0
+@S620:
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S621:
+.byte 10
+.byte 0
+@S622:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S623:
+.byte 10
+.byte 0
+@S624:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 43
+.byte 52
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S625:
+.byte 10
+.byte 0
+@S626:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S627:
+.byte 10
+.byte 0
+@S628:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 43
+.byte 52
+.byte 93
+.byte 44
+.byte 32
+.byte 48
+.byte 0
+@S629:
+.byte 10
+.byte 0
+@S630:
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 105
+.byte 110
+.byte 100
+.byte 95
+.byte 97
+.byte 115
+.byte 110
+.byte 0
+@S631:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S632:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S633:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S634:
+.byte 10
+.byte 0
+@S635:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 43
+.byte 52
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S636:
+.byte 10
+.byte 0
+@S637:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 115
+.byte 105
+.byte 0
+@S638:
+.byte 10
+.byte 0
+@S639:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 100
+.byte 105
+.byte 0
+@S640:
+.byte 10
+.byte 0
+@S641:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 0
+@S642:
+.byte 10
+.byte 0
+@S643:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S644:
+.byte 10
+.byte 0
+@S645:
+.byte 114
+.byte 101
+.byte 112
+.byte 32
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 98
+.byte 0
+@S646:
+.byte 10
+.byte 0
+@S647:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 0
+@S648:
+.byte 10
+.byte 0
+@S649:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 100
+.byte 105
+.byte 0
+@S650:
+.byte 10
+.byte 0
+@S651:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 115
+.byte 105
+.byte 0
+@S652:
+.byte 10
+.byte 0
+@S653:
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S654:
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 0
+@S655:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S656:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S657:
+.byte 10
+.byte 0
+@S658:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S659:
+.byte 10
+.byte 0
+@S660:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 0
+@S661:
+.byte 10
+.byte 0
+@S662:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S663:
+.byte 10
+.byte 0
+@S664:
+.byte 97
+.byte 108
+.byte 0
+@S665:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S666:
+.byte 10
+.byte 0
+@S667:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 0
+@S668:
+.byte 10
+.byte 0
+@S669:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S670:
+.byte 10
+.byte 0
+@S671:
+.byte 103
+.byte 101
+.byte 0
+@S672:
+.byte 97
+.byte 101
+.byte 0
+@S673:
+.byte 115
+.byte 101
+.byte 116
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S674:
+.byte 10
+.byte 0
+@S675:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S676:
+.byte 10
+.byte 0
+@S677:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S678:
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 0
+@S679:
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 0
+@S680:
+.byte 36
+.byte 37
+.byte 115
+.byte 0
+@S681:
+.byte 108
+.byte 101
+.byte 97
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S682:
+.byte 10
+.byte 0
+@S683:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S684:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 93
+.byte 0
+@S685:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S686:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 0
+@S687:
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 112
+.byte 111
+.byte 115
+.byte 116
+.byte 95
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 0
+@S688:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S689:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S690:
+.byte 97
+.byte 100
+.byte 100
+.byte 32
+.byte 101
+.byte 115
+.byte 112
+.byte 44
+.byte 32
+.byte 37
+.byte 100
+.byte 0
+@S691:
+.byte 10
+.byte 0
+@S692:
+.byte 111
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S693:
+.byte 10
+.byte 0
+@S694:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 48
+.byte 0
+@S695:
+.byte 10
+.byte 0
+@S696:
+.byte 106
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S697:
+.byte 10
+.byte 0
+@S698:
+.byte 106
+.byte 110
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S699:
+.byte 10
+.byte 0
+@S700:
+.byte 100
+.byte 111
+.byte 95
+.byte 114
+.byte 101
+.byte 108
+.byte 111
+.byte 112
+.byte 95
+.byte 106
+.byte 117
+.byte 109
+.byte 112
+.byte 0
+@S701:
+.byte 115
+.byte 114
+.byte 99
+.byte 47
+.byte 116
+.byte 101
+.byte 115
+.byte 116
+.byte 115
+.byte 47
+.byte 115
+.byte 101
+.byte 108
+.byte 102
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 47
+.byte 120
+.byte 56
+.byte 54
+.byte 95
+.byte 99
+.byte 103
+.byte 101
+.byte 110
+.byte 46
+.byte 99
+.byte 0
+@S702:
+.byte 65
+.byte 115
+.byte 115
+.byte 101
+.byte 114
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 102
+.byte 97
+.byte 105
+.byte 108
+.byte 101
+.byte 100
+.byte 32
+.byte 105
+.byte 110
+.byte 32
+.byte 102
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 102
+.byte 117
+.byte 110
+.byte 99
+.byte 116
+.byte 105
+.byte 111
+.byte 110
+.byte 32
+.byte 37
+.byte 115
+.byte 40
+.byte 41
+.byte 44
+.byte 32
+.byte 108
+.byte 105
+.byte 110
+.byte 101
+.byte 32
+.byte 37
+.byte 100
+.byte 10
+.byte 0
+@S703:
+.byte 106
+.byte 110
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S704:
+.byte 10
+.byte 0
+@S705:
+.byte 106
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S706:
+.byte 10
+.byte 0
+@S707:
+.byte 106
+.byte 103
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S708:
+.byte 10
+.byte 0
+@S709:
+.byte 106
+.byte 97
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S710:
+.byte 10
+.byte 0
+@S711:
+.byte 106
+.byte 103
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S712:
+.byte 10
+.byte 0
+@S713:
+.byte 106
+.byte 97
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S714:
+.byte 10
+.byte 0
+@S715:
+.byte 106
+.byte 108
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S716:
+.byte 10
+.byte 0
+@S717:
+.byte 106
+.byte 98
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S718:
+.byte 10
+.byte 0
+@S719:
+.byte 106
+.byte 108
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S720:
+.byte 10
+.byte 0
+@S721:
+.byte 106
+.byte 98
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S722:
+.byte 10
+.byte 0
+@S723:
+.byte 106
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S724:
+.byte 10
+.byte 0
+@S725:
+.byte 106
+.byte 110
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S726:
+.byte 10
+.byte 0
+@S727:
+.byte 106
+.byte 108
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S728:
+.byte 10
+.byte 0
+@S729:
+.byte 106
+.byte 98
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S730:
+.byte 10
+.byte 0
+@S731:
+.byte 106
+.byte 108
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S732:
+.byte 10
+.byte 0
+@S733:
+.byte 106
+.byte 98
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S734:
+.byte 10
+.byte 0
+@S735:
+.byte 106
+.byte 103
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S736:
+.byte 10
+.byte 0
+@S737:
+.byte 106
+.byte 97
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S738:
+.byte 10
+.byte 0
+@S739:
+.byte 106
+.byte 103
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S740:
+.byte 10
+.byte 0
+@S741:
+.byte 106
+.byte 97
+.byte 101
+.byte 32
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 0
+@S742:
+.byte 10
+.byte 0
+@S743:
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S744:
+.byte 10
+.byte 0
+@S745:
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S746:
+.byte 10
+.byte 0
+@S747:
+.byte 110
+.byte 111
+.byte 116
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S748:
+.byte 10
+.byte 0
+@S749:
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S750:
+.byte 10
+.byte 0
+@S751:
+.byte 120
+.byte 111
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S752:
+.byte 10
+.byte 0
+@S753:
+.byte 120
+.byte 111
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S754:
+.byte 10
+.byte 0
+@S755:
+.byte 120
+.byte 111
+.byte 114
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S756:
+.byte 10
+.byte 0
+@S757:
+.byte 108
+.byte 101
+.byte 97
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 0
+@S758:
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 88
+.byte 0
+@S759:
+.byte 10
+.byte 0
+@S760:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 0
+@S761:
+.byte 10
+.byte 0
+@S762:
+.byte 46
+.byte 76
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S763:
+.byte 10
+.byte 0
+@S764:
+.byte 95
+.byte 64
+.byte 83
+.byte 37
+.byte 100
+.byte 58
+.byte 0
+@S765:
+.byte 10
+.byte 0
+@S766:
+.byte 99
+.byte 109
+.byte 112
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S767:
+.byte 10
+.byte 0
+@S768:
+.byte 108
+.byte 101
+.byte 0
+@S769:
+.byte 98
+.byte 101
+.byte 0
+@S770:
+.byte 115
+.byte 101
+.byte 116
+.byte 37
+.byte 115
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S771:
+.byte 10
+.byte 0
+@S772:
+.byte 109
+.byte 111
+.byte 118
+.byte 122
+.byte 120
+.byte 32
+.byte 37
+.byte 115
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S773:
+.byte 10
+.byte 0
+@S774:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 115
+.byte 105
+.byte 0
+@S775:
+.byte 10
+.byte 0
+@S776:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 115
+.byte 105
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S777:
+.byte 10
+.byte 0
+@S778:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 100
+.byte 105
+.byte 0
+@S779:
+.byte 10
+.byte 0
+@S780:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 0
+@S781:
+.byte 10
+.byte 0
+@S782:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 44
+.byte 32
+.byte 37
+.byte 117
+.byte 0
+@S783:
+.byte 10
+.byte 0
+@S784:
+.byte 114
+.byte 101
+.byte 112
+.byte 32
+.byte 109
+.byte 111
+.byte 118
+.byte 115
+.byte 98
+.byte 0
+@S785:
+.byte 10
+.byte 0
+@S786:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 99
+.byte 120
+.byte 0
+@S787:
+.byte 10
+.byte 0
+@S788:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 100
+.byte 105
+.byte 0
+@S789:
+.byte 10
+.byte 0
+@S790:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 115
+.byte 105
+.byte 0
+@S791:
+.byte 10
+.byte 0
+@S792:
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S793:
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 0
+@S794:
+.byte 112
+.byte 117
+.byte 115
+.byte 104
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 0
+@S795:
+.byte 10
+.byte 0
+@S796:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S797:
+.byte 10
+.byte 0
+@S798:
+.byte 97
+.byte 108
+.byte 0
+@S799:
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 0
+@S800:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 64
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S801:
+.byte 10
+.byte 0
+@S802:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 36
+.byte 37
+.byte 115
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S803:
+.byte 10
+.byte 0
+@S804:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 37
+.byte 115
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S805:
+.byte 10
+.byte 0
+@S806:
+.byte 112
+.byte 111
+.byte 112
+.byte 32
+.byte 101
+.byte 97
+.byte 120
+.byte 0
+@S807:
+.byte 10
+.byte 0
+@S808:
+.byte 109
+.byte 111
+.byte 118
+.byte 32
+.byte 100
+.byte 119
+.byte 111
+.byte 114
+.byte 100
+.byte 32
+.byte 91
+.byte 101
+.byte 98
+.byte 112
+.byte 43
+.byte 37
+.byte 100
+.byte 93
+.byte 44
+.byte 32
+.byte 37
+.byte 115
+.byte 0
+@S809:
+.byte 10
+.byte 0
@@ -0,0 +1,94 @@
+#include "atom.h"
+#include <stdlib.h>
+#include <string.h>
+#include "util.h"
+#include "arena.h"
+
+#define INIT_TABLE_SIZE 1024 /* must be a power of two */
+
+typedef struct Atom Atom;
+struct Atom {
+    Atom *next;
+    unsigned hash, len;
+    int tag;
+    /* the characters follow */
+};
+
+#define ATOM_STR(a) ((char *)((a)+1))
+#define STR_ATOM(s) ((Atom *)(s)-1)
+
+static Atom **atom_table;
+static unsigned table_size, natoms;
+static Arena *atom_arena;
+
+/* double the number of buckets (keeps the chains short) */
+static void grow_table(void)
+{
+    unsigned i, new_size;
+    Atom **new_table, *a, *next;
+
+    new_size = table_size*2;
+    new_table = calloc(new_size, sizeof(Atom *));
+    for (i = 0; i < table_size; i++) {
+        for (a = atom_table[i]; a != NULL; a = next) {
+            next = a->next;
+            a->next = new_table[a->hash&(new_size-1)];
+            new_table[a->hash&(new_size-1)] = a;
+        }
+    }
+    free(atom_table);
+    atom_table = new_table;
+    table_size = new_size;
+}
+
+/* intern the first `n' characters of `s' */
+char *atom_n(char *s, unsigned n)
+{
+    Atom *a;
+    unsigned h, i;
+
+    if (atom_table == NULL) {
+        table_size = INIT_TABLE_SIZE;
+        atom_table = calloc(table_size, sizeof(Atom *));
+        atom_arena = arena_new(8192, FALSE);
+    }
+
+    for (h = 0, i = 0; i < n; i++)
+        h = (unsigned)s[i] + 31*h;
+    for (a = atom_table[h&(table_size-1)]; a != NULL; a = a->next)
+        if (a->hash==h && a->len==n && memcmp(ATOM_STR(a), s, n)==0)
+            return ATOM_STR(a);
+
+    if (natoms >= table_size)
+        grow_table();
+    a = arena_alloc(atom_arena, round_up(sizeof(Atom)+n+1, sizeof(Atom *)));
+    a->hash = h;
+    a->len = n;
+    a->tag = 0;
+    memcpy(ATOM_STR(a), s, n);
+    ATOM_STR(a)[n] = '\0';
+    a->next = atom_table[h&(table_size-1)];
+    atom_table[h&(table_size-1)] = a;
+    ++natoms;
+    return ATOM_STR(a);
+}
+
+char *atom(char *s)
+{
+    return atom_n(s, strlen(s));
+}
+
+unsigned atom_hash(char *a)
+{
+    return STR_ATOM(a)->hash;
+}
+
+int atom_tag(char *a)
+{
+    return STR_ATOM(a)->tag;
+}
+
+void atom_set_tag(char *a, int tag)
+{
+    STR_ATOM(a)->tag = tag;
+}
@@ -1,9 +1,12 @@
 #ifndef BSET_H_
 #define BSET_H_
 
+#include "arena.h"
+
 typedef struct BSet BSet;
 
 BSet *bset_new(int nmemb);
+BSet *bset_new_in(Arena *a, int nmemb); /* must not be passed to bset_free() */
 void bset_free(BSet *s);
 void bset_cpy(BSet *s1, BSet *s2); /* s1 = s2 */
 void bset_clear(BSet *s);
@@ -11,6 +14,12 @@ int bset_eq(BSet *s1, BSet *s2);
 void bset_union(BSet *s1, BSet *s2); /* s1 = s1 U s2 */
 void bset_inters(BSet *s1, BSet *s2); /* s1 = s1 ∩ s2 */
 void bset_diff(BSet *s1, BSet *s2); /* s1 = s1 \ s2 */
+/*
+ * Fused operations for dataflow solvers.
+ * They return non-zero if s1 changed.
+ */
+int bset_update(BSet *s1, BSet *s2); /* s1 = s2 */
+int bset_union_diff(BSet *s1, BSet *s2, BSet *s3, BSet *s4); /* s1 = s1 U s2 U (s3 \ s4) */
 int bset_member(BSet *s, int e);
 void bset_insert(BSet *s, int e);
 void bset_delete(BSet *s, int e);
@@ -20,6 +29,7 @@ int bset_card(BSet *s); /* |s| */
  * Note the least-significant bit is at position zero.
  */
 int bset_iterate(BSet *s);
+int bset_next(BSet *s, int e); /* smallest member >= e, or -1 if there is none */
 void bset_fill(BSet *s, int n); /* give membership to everything up to (and excluding) n */
 
 #endif
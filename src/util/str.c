@@ -1,6 +1,7 @@
 #include "str.h"
 #include <stdlib.h>
 #include <stdarg.h>
+#include <string.h>
 
 struct String {
     char *buf;
@@ -79,6 +80,24 @@ void string_write(String *s, FILE *fp)
     fwrite(s->buf, 1, s->buf_next, fp);
 }
 
+/* append the contents of `t' to `s' */
+void string_append(String *s, String *t)
+{
+    if (s->buf_next+t->buf_next >= s->buf_max) {
+        s->buf_max = s->buf_max*2+t->buf_next;
+        s->buf = realloc(s->buf, s->buf_max);
+    }
+    memcpy(s->buf+s->buf_next, t->buf, t->buf_next);
+    s->buf_next += t->buf_next;
+    s->buf[s->buf_next] = '\0';
+}
+
+/* the contents of `s' (NUL-terminated after string_printf() or string_append()) */
+char *string_buf(String *s)
+{
+    return s->buf;
+}
+
 char *string_curr(String *s)
 {
     return s->buf+s->buf_next;
@@ -15,6 +15,8 @@ void string_free(String *s);
 int string_printf(String *s, char *fmt, ...);
 int string_vprintf(String *s, char *fmt, va_list ap);
 void string_write(String *s, FILE *fp);
+void string_append(String *s, String *t);
+char *string_buf(String *s);
 void string_clear(String *s);
 char *string_curr(String *s);
 unsigned string_get_pos(String *s);
@@ -93,3 +93,20 @@ char *read_file(char *path)
     fclose(fp);
     return buf;
 }
+
+/* like read_file(), but for streams that cannot be rewound (e.g. pipes) */
+char *read_stream(FILE *fp)
+{
+    char *buf;
+    unsigned len, max;
+
+    max = 8192;
+    buf = malloc(max);
+    len = 0;
+    while ((len+=fread(buf+len, 1, max-len-1, fp)) == max-1) {
+        max *= 2;
+        buf = realloc(buf, max);
+    }
+    buf[len] = '\0';
+    return buf;
+}
@@ -1,6 +1,8 @@
 #ifndef UTIL_H_
 #define UTIL_H_
 
+#include <stdio.h>
+
 #define TRUE  1
 #define FALSE 0
 
@@ -27,5 +29,6 @@ int file_exists(char *file_path);
 char *replace_extension(char *fname, char *newext);
 int be_atoi(char *s);
 char *read_file(char *path);
+char *read_stream(FILE *fp);
 
 #endif
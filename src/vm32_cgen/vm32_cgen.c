@@ -83,6 +83,8 @@ static void label_statement(ExecNode *s);
 static void asm_statement(ExecNode *s);
 static void statement(ExecNode *s);
 static void expression(ExecNode *e, int is_addr);
+static void void_expression(ExecNode *e);
+static char *indexed_load(Declaration *ty);
 static void expr_convert(ExecNode *e, Declaration *dest);
 static unsigned function_argument(ExecNode *arg, DeclList *param);
 static void load(ExecNode *e);
@@ -102,6 +104,60 @@ static void push_break_target(unsigned lab)
     btarget_stack[++bt_stack_top] = lab;
 }
 
+/* superinstruction that loads an element of type ty given the base address and the index */
+char *indexed_load(Declaration *ty)
+{
+    switch (get_type_category(ty)) {
+    case TOK_CHAR:
+    case TOK_SIGNED_CHAR:
+        return "ldxb";
+    case TOK_UNSIGNED_CHAR:
+        return "ldxub";
+    case TOK_STAR:
+    case TOK_INT:
+    case TOK_UNSIGNED:
+    case TOK_LONG:
+    case TOK_UNSIGNED_LONG:
+    case TOK_ENUM:
+        return "ldxdw";
+    case TOK_LONG_LONG:
+    case TOK_UNSIGNED_LONG_LONG:
+        return "ldxqw";
+    default:
+        return NULL;
+    }
+}
+
+/*
+ * Evaluate e only for its side effects. Increments and decrements
+ * of dword variables with automatic storage become incldw/decldw.
+ */
+void void_expression(ExecNode *e)
+{
+    Token cat;
+    char *op;
+
+    cat = get_type_category(&e->type);
+    op = NULL;
+    if (e->kind.exp == OpExp) {
+        if (e->attr.op==TOK_PRE_INC || e->attr.op==TOK_POS_INC)
+            op = "incldw";
+        else if (e->attr.op==TOK_PRE_DEC || e->attr.op==TOK_POS_DEC)
+            op = "decldw";
+    }
+    if (op!=NULL && e->child[0]->kind.exp==IdExp
+    && e->child[0]->attr.var.duration!=DURATION_STATIC
+    && (cat==TOK_INT || cat==TOK_UNSIGNED || cat==TOK_LONG
+    || cat==TOK_UNSIGNED_LONG || cat==TOK_ENUM)) {
+        emitln("%s %d;", op, location_get_offset(e->child[0]->attr.str));
+        return;
+    }
+    expression(e, FALSE);
+    emitln("pop;");
+    if (is_integer(cat) && get_rank(cat)==LLONG_RANK)
+        emitln("pop;");
+}
+
 static void pop_break_target(void)
 {
     --bt_stack_top;
@@ -492,15 +548,11 @@ void for_statement(ExecNode *s)
      *      stmt;
      */
 
-    Token cat;
     unsigned L1, L2, L3;
 
     /* e1 */
     if (s->child[1] != NULL) {
-        expression(s->child[1], FALSE);
-        emitln("pop;");
-        if (is_integer(cat=get_type_category(&s->child[1]->type)) && get_rank(cat)==LLONG_RANK)
-            emitln("pop;");
+        void_expression(s->child[1]);
     }
 
     L1 = new_label();
@@ -521,10 +573,7 @@ void for_statement(ExecNode *s)
     /* e3 */
     if (s->child[2] != NULL) {
         emit_lab(L2);
-        expression(s->child[2], FALSE);
-        emitln("pop;");
-        if (is_integer(cat=get_type_category(&s->child[2]->type)) && get_rank(cat)==LLONG_RANK)
-            emitln("pop;");
+        void_expression(s->child[2]);
     }
     emit_jmp(L1);
     emit_lab(L3);
@@ -632,15 +681,10 @@ void return_statement(ExecNode *s)
 
 void expression_statement(ExecNode *s)
 {
-    Token cat;
-
     if (s->child[0] == NULL)
         return;
 
-    expression(s->child[0], FALSE);
-    emitln("pop;");
-    if (is_integer(cat=get_type_category(&s->child[0]->type)) && get_rank(cat)==LLONG_RANK)
-        emitln("pop;");
+    void_expression(s->child[0]);
 }
 
 /*
@@ -649,6 +693,8 @@ void expression_statement(ExecNode *s)
  *  - avoid the HASH_SIZE iterations when building the search table.
  */
 #define HASH_SIZE       1009
+#define JMP_TAB_MIN_SIZ     3
+#define JMP_TAB_MAX_HOLES   10
 #define HASH_VAL(s)     (hash(s)%HASH_SIZE)
 #define HASH_VAL2(x)    (hash2(x)%HASH_SIZE)
 
@@ -696,8 +742,10 @@ static void install_switch_label(long long val, int is_default, unsigned lab)
 
 void switch_statement(ExecNode *s)
 {
-    unsigned ST, EXIT;
-    int i, st_size, ce64;
+    unsigned ST, EXIT, DEF;
+    int i, st_size, ce64, ncase;
+    unsigned sw_pos, pos_tmp;
+    long long min, max, v;
     SwitchLabel *search_table[MAX_CASE_LABELS], *np;
 
     /*
@@ -707,6 +755,7 @@ void switch_statement(ExecNode *s)
     ST = new_label();
     expression(s->child[0], FALSE);
     emitln("ldidw @T%d;", ST);
+    sw_pos = string_get_pos(output_buffer);
     emitln("%s;", ce64 ? "switch2" : "switch");
 
     /*
@@ -749,6 +798,47 @@ void switch_statement(ExecNode *s)
         return;
     }
 
+    /*
+     * If the case values are dense enough, emit a jump table indexed by
+     * value-min instead and turn the switch into a jmptab (same length,
+     * so the mnemonic can be patched in place).
+     */
+    ncase = search_table[0]->is_default ? st_size-1 : st_size;
+    if (ncase >= JMP_TAB_MIN_SIZ) {
+        min = search_table[st_size-ncase]->val;
+        max = search_table[st_size-1]->val;
+        if ((unsigned long long)max-min < ncase+JMP_TAB_MAX_HOLES) {
+            pos_tmp = string_get_pos(output_buffer);
+            string_set_pos(output_buffer, sw_pos);
+            memcpy(string_curr(output_buffer), "jmptab", 6);
+            string_set_pos(output_buffer, pos_tmp);
+
+            emitln(".dword %d", ((int *)&min)[0]);
+            if (ce64)
+                emitln(".dword %d", ((int *)&min)[1]);
+            emitln(".dword %d", (int)(max-min+1));
+            if (ce64)
+                emitln(".dword 0");
+            /* the first label corresponds to out-of-range values */
+            DEF = search_table[0]->is_default ? search_table[0]->lab : EXIT;
+            emitln(".dword @L%d", DEF);
+            i = st_size-ncase;
+            for (v = min; ; v++) {
+                if (search_table[i]->val == v) {
+                    emitln(".dword @L%d", search_table[i]->lab);
+                    if (++i == st_size)
+                        break;
+                } else {
+                    emitln(".dword @L%d", DEF);
+                }
+            }
+            for (i = 0; i < st_size; i++)
+                free(search_table[i]);
+            emitln(".text");
+            return;
+        }
+    }
+
     /* emit case values */
     /* the first value corresponds to the default case and is the size of the search table */
     if (!search_table[0]->is_default) {
@@ -941,10 +1031,7 @@ void expression(ExecNode *e, int is_addr)
     case OpExp:
         switch (e->attr.op) {
         case TOK_COMMA:
-            expression(e->child[0], FALSE);
-            emitln("pop;");
-            if (is_integer(cat=get_type_category(&e->child[0]->type)) && get_rank(cat)==LLONG_RANK)
-                emitln("pop;");
+            void_expression(e->child[0]);
             expression(e->child[1], FALSE);
             break;
         case TOK_ASSIGN:
@@ -1364,6 +1451,7 @@ void expression(ExecNode *e, int is_addr)
             break;
 
         case TOK_SUBSCRIPT: {
+            char *ldx;
             unsigned size;
 
             if (is_pointer(get_type_category(&e->child[0]->type))) { /* a[i] */
@@ -1373,13 +1461,18 @@ void expression(ExecNode *e, int is_addr)
                 expression(e->child[1], FALSE);
                 expr_convert(e->child[0], &e->child[1]->type);
             }
-            if ((size=get_sizeof(&e->type)) > 1) {
-                emitln("ldidw %d;", size);
-                emitln("muldw;");
+            size = get_sizeof(&e->type);
+            if (!is_addr && (ldx=indexed_load(&e->type))!=NULL) {
+                emitln("%s %u;", ldx, size);
+            } else {
+                if (size > 1) {
+                    emitln("ldidw %d;", size);
+                    emitln("muldw;");
+                }
+                emitln("adddw;");
+                if (!is_addr)
+                    load(e);
             }
-            emitln("adddw;");
-            if (!is_addr)
-                load(e);
         }
             break;
         case TOK_FUNCTION: {
@@ -28,6 +28,7 @@
 #include "../error.h"
 #include "../ic.h"
 #include "../dflow.h"
+#include "../regalloc.h"
 #include "../util/str.h"
 #include "../luxcc.h"
 
@@ -117,6 +118,20 @@ static char *x64_lbreg_str[] = {
     "r14b",
     "r15b",
 };
+/*
+ * Registers used as the home location of the values given
+ * a register by the global allocator (callee-saved).
+ */
+static X64_Reg x64_home_reg[] = {
+    X64_RBX,
+    X64_R12,
+    X64_R13,
+    X64_R14,
+    X64_R15,
+};
+#define X64_NHOME   5
+#define home_reg(a) (ra_reg(a)!=-1 ? x64_home_reg[ra_reg(a)] : -1)
+
 static X64_Reg x64_arg_reg[] = {
     X64_RDI,
     X64_RSI,
@@ -128,18 +143,32 @@ static X64_Reg x64_arg_reg[] = {
 
 static int size_of_local_area;
 static char *curr_func, *enclosing_function;
-static unsigned temp_struct_size;
+static unsigned temp_struct_size; /* every struct valued call has its own temporary */
+static unsigned ret_slot;
 static int big_return;
-static int arg_stack[64], arg_stack_top;
-static int arg_reg_avail = 6;
-static unsigned calls_to_fix[64];
+/*
+ * Register arguments of the call being set up. x64_arg() only records
+ * them; x64_pre_call() loads them straight into their registers.
+ */
+static struct RegArg {
+    unsigned a;     /* argument (the address of the struct for structs) */
+    int i;          /* OpArg quad */
+    X64_Reg r1, r2; /* r2 is -1 unless a struct is passed in two registers */
+    unsigned siz;   /* size of the struct; 0 for scalars */
+} reg_args[6];
+static int nreg_args;
+static int arg_nb; /* # of bytes pushed for the memory arguments */
+static struct RetFix {
+    unsigned pos;   /* where the placeholder is in func_body */
+    unsigned slot;  /* offset of the temporary within the temporaries area */
+} calls_to_fix[64], qrets_to_fix[64], orets_to_fix[64];
 static int calls_to_fix_counter;
-static unsigned qrets_to_fix[64];
 static int qrets_to_fix_counter;
-static unsigned orets_to_fix[64];
 static int orets_to_fix_counter;
 static int string_literals_counter;
 static FILE *x64_output_file;
+static String *x64_output_str; /* used instead of x64_output_file if not NULL */
+
 static int func_last_quad;
 static int need_to_extend;
 
@@ -188,7 +217,6 @@ static void dump_addr_descr_tab(void);
 static void dump_reg_descr_tab(void);
 
 static void spill_reg(X64_Reg r);
-static void spill_all(void);
 static void spill_aliased_objects(void);
 static X64_Reg get_reg(int intr);
 static X64_Reg get_reg0(void);
@@ -198,6 +226,7 @@ static void x64_load_addr(X64_Reg r, unsigned a);
 static char *x64_get_operand32(unsigned a);
 static char *x64_get_operand64(unsigned a);
 static void x64_store(X64_Reg r, unsigned a);
+static void x64_store_home(X64_Reg r, X64_Reg h, Token cat);
 static void x64_compare_against_constant(unsigned a, int c);
 static void x64_function_definition(TypeExp *decl_specs, TypeExp *header);
 
@@ -271,14 +300,6 @@ void spill_reg(X64_Reg r)
     reg_descr_tab[r] = 0;
 }
 
-void spill_all(void)
-{
-    int i;
-
-    for (i = 0; i < X64_NREG; i++)
-        spill_reg((X64_Reg)i);
-}
-
 /*
  * Currently all address-taken variables are considered to be aliased.
  * => Possible improvement: use type information to narrow down the set
@@ -425,6 +446,12 @@ void x64_load(X64_Reg r, unsigned a)
         }
 
         e = address(a).cont.var.e;
+        if (home_reg(a) != -1) {
+            /* homes are kept extended to 64 bits */
+            emitln("mov %s, %s", reg_str, x64_reg_str[home_reg(a)]);
+            need_to_extend = x64_islong(get_type_category(&e->type));
+            return;
+        }
         switch (get_type_category(&e->type)) {
         case TOK_STRUCT:
         case TOK_UNION:
@@ -481,6 +508,8 @@ void x64_load(X64_Reg r, unsigned a)
                 return; /* already in the register */
             else
                 emitln("mov %s, %s", x64_reg_str[r], x64_reg_str[addr_reg(a)]);
+        } else if (home_reg(a) != -1) {
+            emitln("mov %s, %s", x64_reg_str[r], x64_reg_str[home_reg(a)]);
         } else {
             emitln("mov %s, qword [rbp+%d]", x64_reg_str[r], get_temp_offs(a));
         }
@@ -500,6 +529,8 @@ char *x64_get_operand32(unsigned a)
 
         if (addr_reg(a) != -1)
             return x64_ldreg_str[addr_reg(a)];
+        if (home_reg(a) != -1)
+            return x64_ldreg_str[home_reg(a)];
 
         e = address(a).cont.var.e;
         switch (get_type_category(&e->type)) {
@@ -546,6 +577,8 @@ char *x64_get_operand32(unsigned a)
     } else if (address(a).kind == TempKind) {
         if (addr_reg(a) != -1)
             return x64_ldreg_str[addr_reg(a)];
+        else if (home_reg(a) != -1)
+            return x64_ldreg_str[home_reg(a)];
         else
             sprintf(op, "dword [rbp+%d]", get_temp_offs(a));
     }
@@ -581,6 +614,8 @@ char *x64_get_operand64(unsigned a)
 
         if (addr_reg(a) != -1)
             return x64_reg_str[addr_reg(a)];
+        if (home_reg(a) != -1)
+            return x64_reg_str[home_reg(a)];
 
         e = address(a).cont.var.e;
         switch (get_type_category(&e->type)) {
@@ -631,6 +666,8 @@ char *x64_get_operand64(unsigned a)
     } else if (address(a).kind == TempKind) {
         if (addr_reg(a) != -1)
             return x64_reg_str[addr_reg(a)];
+        else if (home_reg(a) != -1)
+            return x64_reg_str[home_reg(a)];
         else
             sprintf(op, "qword [rbp+%d]", get_temp_offs(a));
     }
@@ -660,6 +697,10 @@ void x64_store(X64_Reg r, unsigned a)
         char *siz_str, *reg_str;
 
         e = address(a).cont.var.e;
+        if (home_reg(a) != -1) {
+            x64_store_home(r, home_reg(a), get_type_category(&e->type));
+            return;
+        }
         switch (get_type_category(&e->type)) {
         case TOK_STRUCT:
         case TOK_UNION: {
@@ -727,7 +768,44 @@ void x64_store(X64_Reg r, unsigned a)
             emitln("mov %s [rbp+%d], %s", siz_str, local_offset(a), reg_str);
         }
     } else if (address(a).kind == TempKind) {
-        emitln("mov qword [rbp+%d], %s", get_temp_offs(a), x64_reg_str[r]);
+        if (home_reg(a) != -1)
+            emitln("mov %s, %s", x64_reg_str[home_reg(a)], x64_reg_str[r]);
+        else
+            emitln("mov qword [rbp+%d], %s", get_temp_offs(a), x64_reg_str[r]);
+    }
+}
+
+/*
+ * Copy r into the home register h of a variable with type category cat,
+ * extending the value to 64 bits as a load from memory would do.
+ */
+void x64_store_home(X64_Reg r, X64_Reg h, Token cat)
+{
+    switch (cat) {
+    case TOK_INT:
+    case TOK_ENUM:
+        emitln("movsx %s, %s", x64_reg_str[h], x64_ldreg_str[r]);
+        break;
+    case TOK_UNSIGNED:
+        emitln("mov %s, %s", x64_ldreg_str[h], x64_ldreg_str[r]);
+        break;
+    case TOK_SHORT:
+        emitln("movsx %s, %s", x64_reg_str[h], x64_lwreg_str[r]);
+        break;
+    case TOK_UNSIGNED_SHORT:
+        emitln("movzx %s, %s", x64_ldreg_str[h], x64_lwreg_str[r]);
+        break;
+    case TOK_CHAR:
+    case TOK_SIGNED_CHAR:
+        emitln("movsx %s, %s", x64_reg_str[h], x64_lbreg_str[r]);
+        break;
+    case TOK_UNSIGNED_CHAR:
+        emitln("movzx %s, %s", x64_ldreg_str[h], x64_lbreg_str[r]);
+        break;
+    default:
+        if (r != h)
+            emitln("mov %s, %s", x64_reg_str[h], x64_reg_str[r]);
+        break;
     }
 }
 
@@ -745,6 +823,10 @@ void x64_compare_against_constant(unsigned a, int c)
             emitln("cmp %s, %d", x64_reg_str[addr_reg(a)], c);
             return;
         }
+        if (home_reg(a) != -1) {
+            emitln("cmp %s, %d", x64_reg_str[home_reg(a)], c);
+            return;
+        }
 
         e = address(a).cont.var.e;
         switch (get_type_category(&e->type)) {
@@ -778,6 +860,8 @@ void x64_compare_against_constant(unsigned a, int c)
     } else if (address(a).kind == TempKind) {
         if (addr_reg(a) != -1)
             emitln("cmp %s, %d", x64_reg_str[addr_reg(a)], c);
+        else if (home_reg(a) != -1)
+            emitln("cmp %s, %d", x64_reg_str[home_reg(a)], c);
         else
             emitln("cmp qword [rbp+%d], %d", get_temp_offs(a), c);
     }
@@ -1477,105 +1561,211 @@ static void x64_asn(int i, unsigned tar, unsigned arg1, unsigned arg2)
     UPDATE_ADDRESSES_UNARY(res);
 }
 
+/*
+ * Return TRUE if the value of address 'a' must be in memory
+ * when a function is called.
+ */
+static int x64_must_spill_at_call(unsigned a)
+{
+    ExecNode *e;
+
+    if (address(a).kind != IdKind)
+        return FALSE;
+    e = address(a).cont.var.e;
+    return (e->attr.var.duration==DURATION_STATIC || bset_member(address_taken_variables, address_nid(a)));
+}
+
+/* the value of 'a' is not needed after the call being set up */
+static int x64_dead_reg_arg(unsigned a)
+{
+    int k, found;
+
+    found = FALSE;
+    for (k = 0; k < nreg_args; k++) {
+        if (address_nid(reg_args[k].a) != address_nid(a))
+            continue;
+        if (arg1_liveness(reg_args[k].i) || arg1_next_use(reg_args[k].i))
+            return FALSE;
+        found = TRUE;
+    }
+    return found;
+}
+
+/*
+ * Load into 'r' the 'n' bytes (1 <= n <= 8) at [b+offs], zero extended.
+ * r may be the same as b. r10 and r11 are used as scratch if n is not
+ * a power of two.
+ */
+static void x64_load_eightbyte(X64_Reg r, X64_Reg b, int offs, unsigned n)
+{
+    unsigned piece, pos;
+
+    switch (n) {
+    case 8:
+        emitln("mov %s, qword [%s+%d]", x64_reg_str[r], x64_reg_str[b], offs);
+        return;
+    case 4:
+        emitln("mov %s, dword [%s+%d]", x64_ldreg_str[r], x64_reg_str[b], offs);
+        return;
+    case 2:
+        emitln("movzx %s, word [%s+%d]", x64_reg_str[r], x64_reg_str[b], offs);
+        return;
+    case 1:
+        emitln("movzx %s, byte [%s+%d]", x64_reg_str[r], x64_reg_str[b], offs);
+        return;
+    }
+    emitln("xor r11d, r11d");
+    for (pos = 0, piece = 4; piece != 0; piece >>= 1) {
+        if (!(n & piece))
+            continue;
+        if (piece == 4)
+            emitln("mov r10d, dword [%s+%d]", x64_reg_str[b], offs+pos);
+        else
+            emitln("movzx r10, %s [%s+%d]", piece==2?"word":"byte", x64_reg_str[b], offs+pos);
+        if (pos)
+            emitln("shl r10, %u", pos*8);
+        emitln("or r11, r10");
+        pos += piece;
+    }
+    emitln("mov %s, r11", x64_reg_str[r]);
+}
+
+/*
+ * Set up the call at quad 'i': spill what the callee could clobber or
+ * read from memory, and load the register arguments.
+ */
 static int x64_pre_call(int i, unsigned arg2)
 {
     Token cat;
-    int na, nb, offs;
-    int top;
-    unsigned siz;
+    int k, src[6];
 
-    spill_all();
+    /* where the register arguments live right now */
+    for (k = 0; k < nreg_args; k++) {
+        unsigned a;
 
-    if ((cat=get_type_category(instruction(i).type))==TOK_STRUCT || cat==TOK_UNION) {
-        siz = get_sizeof(instruction(i).type);
-        if (siz > temp_struct_size)
-            temp_struct_size = siz;
-        if (siz > 16) {
-            emit("lea rdi, [rbp+");
-            calls_to_fix[calls_to_fix_counter++] = string_get_pos(func_body);
-            emitln("XXXXXXXXXXXXXXXX");
-            --arg_reg_avail;
-        }
+        a = reg_args[k].a;
+        src[k] = (!const_addr(a) && addr_reg(a)!=-1) ? addr_reg(a) : -1;
     }
 
-    offs = 0;
-    top = arg_stack_top;
+    /*
+     * Caller-saved registers do not survive the call, and the callee
+     * could access static and address-taken objects. Values that are
+     * only needed as arguments are dropped instead of stored.
+     */
+    for (k = 0; k < X64_NREG; k++) {
+        unsigned a;
 
-    /* pass register arguments (left-to-right) */
-    for (na = (int)address(arg2).cont.val; na != 0; na--) {
-        siz = arg_stack[--top];
-        if (siz>16 || siz>arg_reg_avail*8) {
-            ;
-        } else {
-            X64_Reg r;
+        if (reg_isempty(k))
+            continue;
+        a = reg_descr_tab[k];
+        if (x64_dead_reg_arg(a)) {
+            addr_reg(a) = -1;
+            reg_descr_tab[k] = 0;
+        } else if (k!=X64_RBX && k<X64_R12 || x64_must_spill_at_call(a)) {
+            spill_reg((X64_Reg)k);
+        }
+    }
 
-            arg_stack[top] = 1;
-            r = x64_arg_reg[6-arg_reg_avail];
-            --arg_reg_avail;
-            emitln("mov %s, [rsp+%d]", x64_reg_str[r], offs);
-            if (siz > 8) {
-                arg_stack[top] = 2;
-                r = x64_arg_reg[6-arg_reg_avail];
-                --arg_reg_avail;
-                emitln("mov %s, [rsp+%d]", x64_reg_str[r], offs+8);
+    /*
+     * Register to register moves. This is a parallel assignment: do first
+     * the moves whose target is not the source of another move, and break
+     * cycles with xchg.
+     */
+    for (;;) {
+        int j, m, ready;
+
+        for (k = 0, m = ready = -1; k < nreg_args; k++) {
+            if (src[k] < 0) /* load or done */
+                continue;
+            if (src[k] == reg_args[k].r1) {
+                src[k] = -2;
+                continue;
+            }
+            m = k;
+            for (j = 0; j < nreg_args; j++)
+                if (j!=k && src[j]==reg_args[k].r1)
+                    break;
+            if (j == nreg_args) {
+                ready = k;
+                break;
             }
         }
-        offs += siz;
+        if (ready != -1) {
+            emitln("mov %s, %s", x64_reg_str[reg_args[ready].r1], x64_reg_str[src[ready]]);
+            src[ready] = -2;
+        } else if (m != -1) {
+            X64_Reg d, s;
+
+            d = reg_args[m].r1;
+            s = src[m];
+            emitln("xchg %s, %s", x64_reg_str[d], x64_reg_str[s]);
+            for (j = 0; j < nreg_args; j++) {
+                if (src[j] == d)
+                    src[j] = s;
+                else if (src[j] == s)
+                    src[j] = d;
+            }
+            src[m] = -2;
+        } else {
+            break;
+        }
+    }
+
+    /* loads (they only write their own register) */
+    for (k = 0; k < nreg_args; k++) {
+        struct RegArg *p;
+
+        p = &reg_args[k];
+        if (src[k] == -1)
+            x64_load(p->r1, p->a);
+        else if (address(p->a).kind==IdKind && p->siz==0) /* extend as a load from memory would do */
+            x64_store_home(p->r1, p->r1, get_type_category(&address(p->a).cont.var.e->type));
+        pin_reg(p->r1);
+        if (p->siz == 0)
+            continue;
+        /* p->r1 has the address of the struct */
+        if (p->r2 != -1) {
+            pin_reg(p->r2);
+            x64_load_eightbyte(p->r2, p->r1, 8, p->siz-8);
+            x64_load_eightbyte(p->r1, p->r1, 0, 8);
+        } else {
+            x64_load_eightbyte(p->r1, p->r1, 0, p->siz);
+        }
     }
-    arg_stack_top = top;
-    nb = offs;
 
-    /* pass stack arguments (right-to-left) */
-    for (na = (int)address(arg2).cont.val; na != 0; na--) {
+    if ((cat=get_type_category(instruction(i).type))==TOK_STRUCT || cat==TOK_UNION) {
         unsigned siz;
 
-        siz = arg_stack[top++];
-        if (siz == 1) {
-            offs -= 8;
-        } else if (siz == 2) {
-            offs -= 16;
-        } else {
-            nb += siz;
-            switch (siz) {
-            case 8:
-                emitln("push qword [rsp+%d]", offs-siz);
-                break;
-            case 16:
-                emitln("push qword [rsp+%d]", offs-siz+8);
-                emitln("push qword [rsp+%d]", offs-siz+8);
-                break;
-            default:
-				/* save */
-				emitln("mov r11, rdi");
-				emitln("mov r12, rsi");
-				emitln("mov r13, rcx");
-				/* copy */
-                emitln("sub rsp, %u", siz);
-                emitln("lea rsi, [rsp+%d]", offs);
-                emitln("mov rdi, rsp");
-                emitln("mov rcx, %u", siz);
-                emitln("rep movsb");
-                /* restore */
-                emitln("mov rdi, r11");
-                emitln("mov rsi, r12");
-                emitln("mov rcx, r13");
-                break;
-            }
+        /*
+         * The result can be passed to another call together with the
+         * results of other calls, so don't share the temporary.
+         */
+        siz = get_sizeof(instruction(i).type);
+        ret_slot = temp_struct_size;
+        temp_struct_size += round_up(siz, 8);
+        if (siz > 16) {
+            emit("lea rdi, [rbp+");
+            calls_to_fix[calls_to_fix_counter].slot = ret_slot;
+            calls_to_fix[calls_to_fix_counter++].pos = string_get_pos(func_body);
+            emitln("XXXXXXXXXXXXXXXX");
+            pin_reg(X64_RDI);
         }
     }
 
-    if (instruction(i-1).op == OpNOp)
+    if (instruction(i-1).op == OpNOp) {
         emitln("xor eax, eax"); /* zero vector registers used */
+        pin_reg(X64_RAX);
+    }
 
-    return nb;
+    return arg_nb;
 }
 
 static void x64_post_call(int i, int nb)
 {
+    int k;
     Token cat;
     unsigned siz;
 
-    assert(arg_stack_top >= 0);
     if (nb)
         emitln("add rsp, %d", nb);
     /*
@@ -1588,14 +1778,22 @@ static void x64_post_call(int i, int nb)
         if (siz > 16) {
             ;
         } else if (siz > 8) {
-            orets_to_fix[orets_to_fix_counter++] = string_get_pos(func_body);
+            orets_to_fix[orets_to_fix_counter].slot = ret_slot;
+            orets_to_fix[orets_to_fix_counter++].pos = string_get_pos(func_body);
             emitln("XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX");
         } else {
-            qrets_to_fix[qrets_to_fix_counter++] = string_get_pos(func_body);
+            qrets_to_fix[qrets_to_fix_counter].slot = ret_slot;
+            qrets_to_fix[qrets_to_fix_counter++].pos = string_get_pos(func_body);
             emitln("XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX");
         }
     }
-    arg_reg_avail = 6;
+    for (k = 0; k < 6; k++)
+        unpin_reg(x64_arg_reg[k]);
+    unpin_reg(X64_RAX);
+    for (k = 0; k < nreg_args; k++)
+        update_arg_descriptors(reg_args[k].a, arg1_liveness(reg_args[k].i), arg1_next_use(reg_args[k].i));
+    nreg_args = 0;
+    arg_nb = 0;
 }
 
 static void x64_indcall(int i, unsigned tar, unsigned arg1, unsigned arg2)
@@ -1768,14 +1966,77 @@ static void x64_jmp(int i, unsigned tar, unsigned arg1, unsigned arg2)
     emit_jmp(address(tar).cont.val);
 }
 
+/*
+ * Return the index in x64_arg_reg[] of the (first) register that gets the
+ * argument of the OpArg at quad 'q', or -1 if it is passed in memory.
+ * The OpArgs of a call go in a row right before it (optionally followed
+ * by an OpNOp), from the last argument to the first.
+ */
+static int x64_arg_class(int q)
+{
+    int j, c, avail, cls;
+    Token cat;
+
+    for (j = q; instruction(j+1).op == OpArg; j++)
+        ;
+    c = (instruction(j+1).op == OpNOp) ? j+2 : j+1;
+    assert(instruction(c).op==OpCall || instruction(c).op==OpIndCall);
+    avail = 6;
+    if (((cat=get_type_category(instruction(c).type))==TOK_STRUCT || cat==TOK_UNION)
+    && get_sizeof(instruction(c).type)>16)
+        --avail; /* rdi has the address of the returned struct */
+
+    /* classify from the first argument to the one at q */
+    for (cls = -1; j >= q; j--) {
+        int n;
+        Declaration *ty;
+
+        ty = instruction(j).type;
+        if ((cat=get_type_category(ty))==TOK_STRUCT || cat==TOK_UNION) {
+            unsigned siz;
+
+            siz = get_sizeof(ty);
+            n = (siz > 16) ? 7 : (int)round_up(siz, 8)/8;
+        } else {
+            n = 1;
+        }
+        if (n <= avail) {
+            cls = 6-avail;
+            avail -= n;
+        } else {
+            cls = -1;
+        }
+    }
+    return cls;
+}
+
 static void x64_arg(int i, unsigned tar, unsigned arg1, unsigned arg2)
 {
+    int cls;
     Token cat;
     Declaration *ty;
 
     ty = instruction(i).type;
     assert(ty->idl==NULL || ty->idl->op!=TOK_ID);
 
+    if ((cls=x64_arg_class(i)) != -1) {
+        struct RegArg *p;
+
+        /* loaded by x64_pre_call() */
+        p = &reg_args[nreg_args++];
+        p->a = arg1;
+        p->i = i;
+        p->r1 = x64_arg_reg[cls];
+        p->r2 = -1;
+        p->siz = 0;
+        if ((cat=get_type_category(ty))==TOK_STRUCT || cat==TOK_UNION) {
+            p->siz = get_sizeof(ty);
+            if (p->siz > 8)
+                p->r2 = x64_arg_reg[cls+1];
+        }
+        return;
+    }
+
     if ((cat=get_type_category(ty))==TOK_STRUCT || cat==TOK_UNION) {
         unsigned siz, asiz;
         int cluttered, savnb;
@@ -1783,7 +2044,7 @@ static void x64_arg(int i, unsigned tar, unsigned arg1, unsigned arg2)
         siz = get_sizeof(ty);
         asiz = round_up(siz, 8);
         emitln("sub rsp, %u", asiz);
-        arg_stack[arg_stack_top++] = asiz;
+        arg_nb += asiz;
 
         cluttered = savnb = 0;
         if (addr_reg(arg1) != X64_RSI) {
@@ -1815,9 +2076,20 @@ static void x64_arg(int i, unsigned tar, unsigned arg1, unsigned arg2)
             emitln("pop rdi");
         if (cluttered & 1)
             emitln("pop rsi");
+    } else if (address(arg1).kind==IdKind && addr_reg(arg1)!=-1) {
+        X64_Reg r, vr;
+
+        /* only the bits of the variable's type are valid in the register */
+        vr = addr_reg(arg1);
+        pin_reg(vr);
+        r = get_reg0();
+        unpin_reg(vr);
+        x64_store_home(vr, r, get_type_category(&address(arg1).cont.var.e->type));
+        emitln("push %s", x64_reg_str[r]);
+        arg_nb += 8;
     } else {
         emitln("push %s", x64_get_operand64(arg1));
-        arg_stack[arg_stack_top++] = 8;
+        arg_nb += 8;
     }
     update_arg_descriptors(arg1, arg1_liveness(i), arg1_next_use(i));
 }
@@ -1926,7 +2198,9 @@ static void x64_switch(int i, unsigned tar, unsigned arg1, unsigned arg2)
     int def_val;
     long long min, max;
     long long ncase, interval_size, holes;
+    char **cmp_reg_str;
 
+    cmp_reg_str = (get_sizeof(instruction(i).type) == 8) ? x64_reg_str : x64_ldreg_str;
     if (addr_reg(arg1) == -1) {
         res = get_reg(i);
         x64_load(res, arg1);
@@ -1964,7 +2238,8 @@ static void x64_switch(int i, unsigned tar, unsigned arg1, unsigned arg2)
         interval_size = max-min+1;
         holes = interval_size-ncase;
 
-        if (holes <= JMP_TAB_MAX_HOLES)
+        /* max-min can overflow when the values are far apart */
+        if ((unsigned long long)max-min < (unsigned long long)ncase+JMP_TAB_MAX_HOLES)
             goto jump_table;
     }
     goto linear_search;
@@ -2032,7 +2307,7 @@ linear_search:
 
         val = address(tar).cont.uval;
         if (val>=INT_MIN && val<=INT_MAX) {
-            emitln("cmp %s, %d", x64_ldreg_str[res], (int)val);
+            emitln("cmp %s, %d", cmp_reg_str[res], (int)val);
         } else {
             if (tr1 == -1)
                 tr1 = get_reg0();
@@ -2122,11 +2397,40 @@ static void x64_spill_reg_args(DeclList *p, int offs)
     }
 }
 
+/*
+ * Values that can live in a home register: temporaries and
+ * non-volatile scalar locals/parameters whose address is never taken.
+ */
+static int x64_home_candidate(unsigned a)
+{
+    Token cat;
+    ExecNode *e;
+    TypeExp *tq;
+
+    if (address(a).kind == TempKind)
+        return TRUE;
+    e = address(a).cont.var.e;
+    if (e->attr.var.duration!=DURATION_AUTO || bset_member(address_taken_variables, address_nid(a)))
+        return FALSE;
+    if (!is_integer(cat=get_type_category(&e->type)) && cat!=TOK_STAR)
+        return FALSE;
+    tq = (cat == TOK_STAR) ? e->type.idl->attr.el : get_type_qual(e->type.decl_specs);
+    return (tq==NULL || tq->op!=TOK_VOLATILE && tq->op!=TOK_CONST_VOLATILE);
+}
+
+static void x64_write(String *s)
+{
+    if (x64_output_str != NULL)
+        string_append(x64_output_str, s);
+    else
+        string_write(s, x64_output_file);
+}
+
 void x64_function_definition(TypeExp *decl_specs, TypeExp *header)
 {
     Token cat;
     TypeExp *scs;
-    int i, last_i;
+    int i, j, last_i;
     Declaration ty;
     unsigned fn, pos_tmp;
     static int first_func = TRUE;
@@ -2134,6 +2438,20 @@ void x64_function_definition(TypeExp *decl_specs, TypeExp *header)
     curr_func = header->str;
     fn = new_cg_node(curr_func);
     size_of_local_area = round_up(cg_node(fn).size_of_local_area, 8);
+    compute_liveness_and_next_use(fn);
+
+    if (opt_level) {
+        unsigned homes;
+
+        /* home registers are off-limits for the local allocator */
+        homes = ra_allocate(fn, X64_NHOME, x64_home_candidate);
+        for (i = 0; i < X64_NHOME; i++) {
+            if (homes & 1U<<i) {
+                pin_reg(x64_home_reg[i]);
+                modified[x64_home_reg[i]] = TRUE;
+            }
+        }
+    }
 
     ty.decl_specs = decl_specs;
     ty.idl = header->child->child;
@@ -2153,6 +2471,20 @@ void x64_function_definition(TypeExp *decl_specs, TypeExp *header)
     i = cfg_node(cg_node(fn).bb_i).leader;
     last_i = cfg_node(cg_node(fn).bb_f).last;
     func_last_quad = last_i;
+
+    /* move into their home the parameters that are live on entry */
+    for (j = 0; j < ra_nintervals; j++) {
+        unsigned a;
+        X64_Reg h;
+
+        a = ra_intervals[j].addr;
+        if (ra_intervals[j].reg==-1 || ra_intervals[j].start!=i
+        || address(a).kind!=IdKind || !address(a).cont.var.e->attr.var.is_param)
+            continue;
+        h = home_reg(a);
+        emitln("mov %s, qword [rbp+%d]", x64_reg_str[h], local_offset(a));
+        x64_store_home(h, h, get_type_category(&address(a).cont.var.e->type));
+    }
     for (; i <= last_i; i++) {
         unsigned tar, arg1, arg2;
 
@@ -2174,9 +2506,9 @@ void x64_function_definition(TypeExp *decl_specs, TypeExp *header)
         int n;
         char *s;
 
-        string_set_pos(func_body, calls_to_fix[calls_to_fix_counter]);
+        string_set_pos(func_body, calls_to_fix[calls_to_fix_counter].pos);
         s = string_curr(func_body);
-        n = sprintf(s, "%d", size_of_local_area);
+        n = sprintf(s, "%d", size_of_local_area+(int)calls_to_fix[calls_to_fix_counter].slot);
         s[n++] = ']';
         for (; s[n] == 'X'; n++)
             s[n] = ' ';
@@ -2186,15 +2518,16 @@ void x64_function_definition(TypeExp *decl_specs, TypeExp *header)
      * Fix calls to struct/union valued functions (with 8 < size <= 16)
      */
     while (--orets_to_fix_counter >= 0) {
-        int n;
+        int n, offs;
         char *s;
 
-        string_set_pos(func_body, orets_to_fix[orets_to_fix_counter]);
+        string_set_pos(func_body, orets_to_fix[orets_to_fix_counter].pos);
+        offs = size_of_local_area+(int)orets_to_fix[orets_to_fix_counter].slot;
         s = string_curr(func_body);
         n = sprintf(s, "mov [rbp+%d], rax\n"
                        "mov [rbp+%d], rdx\n"
                        "lea rax, [rbp+%d]",
-                       size_of_local_area, size_of_local_area+8, size_of_local_area);
+                       offs, offs+8, offs);
         s[n++] = ' ';
         for (; s[n] == 'X'; n++)
             s[n] = ' ';
@@ -2204,14 +2537,15 @@ void x64_function_definition(TypeExp *decl_specs, TypeExp *header)
      * Fix calls to struct/union valued functions (with size <= 8)
      */
     while (--qrets_to_fix_counter >= 0) {
-        int n;
+        int n, offs;
         char *s;
 
-        string_set_pos(func_body, qrets_to_fix[qrets_to_fix_counter]);
+        string_set_pos(func_body, qrets_to_fix[qrets_to_fix_counter].pos);
+        offs = size_of_local_area+(int)qrets_to_fix[qrets_to_fix_counter].slot;
         s = string_curr(func_body);
         n = sprintf(s, "mov [rbp+%d], rax\n"
                        "lea rax, [rbp+%d]",
-                       size_of_local_area, size_of_local_area);
+                       offs, offs);
         s[n++] = ' ';
         for (; s[n] == 'X'; n++)
             s[n] = ' ';
@@ -2241,9 +2575,9 @@ void x64_function_definition(TypeExp *decl_specs, TypeExp *header)
     emit_epilogln("pop rbp");
     emit_epilogln("ret");
 
-    string_write(func_prolog, x64_output_file);
-    string_write(func_body, x64_output_file);
-    string_write(func_epilog, x64_output_file);
+    x64_write(func_prolog);
+    x64_write(func_body);
+    x64_write(func_epilog);
 
     /* reset everything */
     string_clear(func_prolog);
@@ -2256,6 +2590,7 @@ void x64_function_definition(TypeExp *decl_specs, TypeExp *header)
     memset(modified, 0, sizeof(int)*X64_NREG);
     memset(pinned, 0, sizeof(int)*X64_NREG);
     free_all_temps();
+    ic_free_function(fn);
 #if 1
     memset(addr_descr_tab, -1, nid_counter*sizeof(int));
     memset(reg_descr_tab, 0, sizeof(unsigned)*X64_NREG);
@@ -2565,6 +2900,13 @@ void x64_allocate_static_objects(void)
     }
 }
 
+/* like x64_cgen(), but append the assembly to `outs' */
+void x64_cgen_str(String *outs)
+{
+    x64_output_str = outs;
+    x64_cgen(NULL);
+}
+
 void x64_cgen(FILE *outf)
 {
     unsigned i, j;
@@ -2574,7 +2916,7 @@ void x64_cgen(FILE *outf)
 
     /* generate intermediate code and do some analysis */
     ic_main(&func_def_list, &ext_sym_list); //exit(0);
-    compute_liveness_and_next_use();
+    ra_init();
 
     /* generate assembly */
     asm_decls = string_new(512);
@@ -2610,13 +2952,12 @@ void x64_cgen(FILE *outf)
         emit_declln("extern $memset");
     }
 
-    string_write(asm_decls, x64_output_file);
-    string_free(asm_decls);
-
     if (string_literals_counter) {
-        fprintf(x64_output_file, "\n; == string literals\n");
-        fprintf(x64_output_file, "segment .rodata\n");
-        string_write(str_lits, x64_output_file);
+        emit_declln("\n; == string literals");
+        emit_declln("segment .rodata");
     }
+    x64_write(asm_decls);
+    x64_write(str_lits);
+    string_free(asm_decls);
     string_free(str_lits);
 }
@@ -2,7 +2,9 @@
 #define X64_CGEN_H_
 
 #include <stdio.h>
+#include "../util/str.h"
 
 void x64_cgen(FILE *outf);
+void x64_cgen_str(String *outs);
 
 #endif
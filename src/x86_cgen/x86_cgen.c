@@ -81,6 +81,8 @@ static int calls_to_fix_counter;
 static unsigned calls_to_fix[64];
 static int string_literals_counter;
 static FILE *x86_output_file;
+static String *x86_output_str; /* used instead of x86_output_file if not NULL */
+
 static int func_last_quad;
 
 #define JMP_TAB_MIN_SIZ   3
@@ -2301,7 +2303,8 @@ static void x86_switch(int i, unsigned tar, unsigned arg1, unsigned arg2)
         fprintf(stderr, "interval=%d\n", interval_size);
         fprintf(stderr, "holes=%d\n", holes);
 #endif
-        if (holes <= JMP_TAB_MAX_HOLES)
+        /* max-min can overflow when the values are far apart */
+        if ((unsigned long long)max-min < (unsigned long long)ncase+JMP_TAB_MAX_HOLES)
             goto jump_table;
     }
     goto linear_search;
@@ -2391,6 +2394,14 @@ static void (*instruction_handlers[])(int, unsigned, unsigned, unsigned) = {
     x86_begarg, x86_nop
 };
 
+static void x86_write(String *s)
+{
+    if (x86_output_str != NULL)
+        string_append(x86_output_str, s);
+    else
+        string_write(s, x86_output_file);
+}
+
 void x86_function_definition(TypeExp *decl_specs, TypeExp *header)
 {
     /*
@@ -2431,6 +2442,7 @@ void x86_function_definition(TypeExp *decl_specs, TypeExp *header)
     curr_func = header->str;
     fn = new_cg_node(curr_func);
     size_of_local_area = round_up(cg_node(fn).size_of_local_area, 4);
+    compute_liveness_and_next_use(fn);
 
     ty.decl_specs = decl_specs;
     ty.idl = header->child->child;
@@ -2500,9 +2512,9 @@ void x86_function_definition(TypeExp *decl_specs, TypeExp *header)
     emit_epilogln("pop ebp");
     emit_epilogln("ret");
 
-    string_write(func_prolog, x86_output_file);
-    string_write(func_body, x86_output_file);
-    string_write(func_epilog, x86_output_file);
+    x86_write(func_prolog);
+    x86_write(func_body);
+    x86_write(func_epilog);
 
     /* reset everything */
     string_clear(func_prolog);
@@ -2513,6 +2525,7 @@ void x86_function_definition(TypeExp *decl_specs, TypeExp *header)
     memset(modified, 0, sizeof(int)*X86_NREG);
     memset(pinned, 0, sizeof(int)*X86_NREG);
     free_all_temps();
+    ic_free_function(fn);
 #if 1
     memset(addr_descr_tab, -1, nid_counter*sizeof(int));
     memset(reg_descr_tab, 0, sizeof(unsigned)*X86_NREG);
@@ -2822,6 +2835,13 @@ void x86_allocate_static_objects(void)
     }
 }
 
+/* like x86_cgen(), but append the assembly to `outs' */
+void x86_cgen_str(String *outs)
+{
+    x86_output_str = outs;
+    x86_cgen(NULL);
+}
+
 void x86_cgen(FILE *outf)
 {
     unsigned i, j;
@@ -2831,7 +2851,6 @@ void x86_cgen(FILE *outf)
 
     /* generate intermediate code and do some analysis */
     ic_main(&func_def_list, &ext_sym_list); //exit(0);
-    compute_liveness_and_next_use();
 
     /* generate assembly */
     asm_decls = string_new(512);
@@ -2880,13 +2899,12 @@ void x86_cgen(FILE *outf)
         emit_declln("extern $__lux_scmp64");
     }
 
-    string_write(asm_decls, x86_output_file);
-    string_free(asm_decls);
-
     if (string_literals_counter) {
-        fprintf(x86_output_file, "\n; == string literals\n");
-        fprintf(x86_output_file, "segment .rodata\n");
-        string_write(str_lits, x86_output_file);
+        emit_declln("\n; == string literals");
+        emit_declln("segment .rodata");
     }
+    x86_write(asm_decls);
+    x86_write(str_lits);
+    string_free(asm_decls);
     string_free(str_lits);
 }
@@ -2,7 +2,9 @@
 #define X86_CGEN_H_
 
 #include <stdio.h>
+#include "../util/str.h"
 
 void x86_cgen(FILE *outf);
+void x86_cgen_str(String *outs);
 
 #endif